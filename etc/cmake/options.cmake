@@ -31,6 +31,8 @@ find_package(PkgConfig)
 
 option(OTBR_DOC "Build documentation" OFF)
 
+option(OTBR_BENCHMARK "Build benchmarks" OFF)
+
 option(OTBR_BORDER_AGENT "Enable Border Agent" ON)
 if (OTBR_BORDER_AGENT)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_BORDER_AGENT=1)
@@ -73,6 +75,28 @@ if (OTBR_DUA_ROUTING)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_DUA_ROUTING=1)
 endif()
 
+cmake_dependent_option(OTBR_ND_PROXY_NFTABLES "Install the ND Proxy NFQUEUE rule with libnftables instead of ip6tables" OFF "OTBR_DUA_ROUTING" OFF)
+if (OTBR_ND_PROXY_NFTABLES)
+    pkg_check_modules(NFTABLES REQUIRED libnftables)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_ND_PROXY_NFTABLES=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_ND_PROXY_NFTABLES=0)
+endif()
+
+cmake_dependent_option(OTBR_ND_PROXY_KERNEL_OFFLOAD "Answer ND Proxy Neighbor Solicitations with kernel proxy_ndp entries" OFF "OTBR_DUA_ROUTING" OFF)
+if (OTBR_ND_PROXY_KERNEL_OFFLOAD)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_ND_PROXY_KERNEL_OFFLOAD=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_ND_PROXY_KERNEL_OFFLOAD=0)
+endif()
+
+cmake_dependent_option(OTBR_BACKBONE_ROUTER_WARM_SECONDARY "Keep DUA routing and ND Proxy prepared while Secondary for a fast Primary takeover" OFF "OTBR_DUA_ROUTING" OFF)
+if (OTBR_BACKBONE_ROUTER_WARM_SECONDARY)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_BACKBONE_ROUTER_WARM_SECONDARY=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_BACKBONE_ROUTER_WARM_SECONDARY=0)
+endif()
+
 option(OTBR_OPENWRT "Enable OpenWrt support" OFF)
 if(OTBR_OPENWRT)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_OPENWRT=1)
@@ -83,6 +107,12 @@ if(OTBR_REST)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_REST_SERVER=1)
 endif()
 
+cmake_dependent_option(OTBR_REST_COMPRESSION "Compress REST responses with gzip or deflate when the client accepts it" OFF "OTBR_REST" OFF)
+if (OTBR_REST_COMPRESSION)
+    find_package(ZLIB REQUIRED)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_REST_COMPRESSION=1)
+endif()
+
 option(OTBR_SRP_ADVERTISING_PROXY "Enable Advertising Proxy" OFF)
 if (OTBR_SRP_ADVERTISING_PROXY)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_SRP_ADVERTISING_PROXY=1)
@@ -161,6 +191,53 @@ endif()
 option(OTBR_LINK_METRICS_TELEMETRY "Enable Link Metrics Telemetry Upload" OFF)
 if (OTBR_LINK_METRICS_TELEMETRY)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_LINK_METRICS_TELEMETRY=1)
+    set(OTBR_LINK_METRICS_SAMPLE_INTERVAL "30000" CACHE STRING "Link metrics sampling interval in milliseconds")
+    target_compile_definitions(otbr-config INTERFACE
+        OTBR_CONFIG_LINK_METRICS_SAMPLE_INTERVAL=${OTBR_LINK_METRICS_SAMPLE_INTERVAL})
 else()
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_LINK_METRICS_TELEMETRY=0)
 endif()
+
+option(OTBR_CHANNEL_SAMPLING "Enable background channel occupancy sampling and channel recommendation" OFF)
+if (OTBR_CHANNEL_SAMPLING)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_CHANNEL_SAMPLING=1)
+    set(OTBR_CHANNEL_SAMPLE_INTERVAL "10000" CACHE STRING "Channel energy sampling interval in milliseconds")
+    target_compile_definitions(otbr-config INTERFACE
+        OTBR_CONFIG_CHANNEL_SAMPLE_INTERVAL=${OTBR_CHANNEL_SAMPLE_INTERVAL})
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_CHANNEL_SAMPLING=0)
+endif()
+
+option(OTBR_MAINLOOP_STATS "Enable mainloop latency and per-processor cost statistics" OFF)
+if (OTBR_MAINLOOP_STATS)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_MAINLOOP_STATS=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_MAINLOOP_STATS=0)
+endif()
+
+option(OTBR_TRACE "Enable the trace points emitted to the kernel trace marker for Perfetto or LTTng" OFF)
+if (OTBR_TRACE)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_TRACE=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_TRACE=0)
+endif()
+
+option(OTBR_NETIF_IO_URING "Use io_uring for the Thread network interface data path" OFF)
+if (OTBR_NETIF_IO_URING)
+    if (NOT CMAKE_SYSTEM_NAME STREQUAL "Linux")
+        message(FATAL_ERROR "OTBR_NETIF_IO_URING is only supported on Linux")
+    endif()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_NETIF_IO_URING=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_NETIF_IO_URING=0)
+endif()
+
+if (OTBR_COPROCESSOR STREQUAL "rcp")
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_RCP_HOST=1 OTBR_ENABLE_NCP_HOST=0)
+elseif (OTBR_COPROCESSOR STREQUAL "ncp")
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_RCP_HOST=0 OTBR_ENABLE_NCP_HOST=1)
+elseif (OTBR_COPROCESSOR STREQUAL "any")
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_RCP_HOST=1 OTBR_ENABLE_NCP_HOST=1)
+else()
+    message(FATAL_ERROR "OTBR_COPROCESSOR=\"${OTBR_COPROCESSOR}\" is not supported")
+endif()
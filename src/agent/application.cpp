@@ -33,6 +33,9 @@
 
 #define OTBR_LOG_TAG "APP"
 
+#include <string.h>
+#include <unistd.h>
+
 #ifdef HAVE_LIBSYSTEMD
 #include <systemd/sd-daemon.h>
 #endif
@@ -40,11 +43,56 @@
 #include "agent/application.hpp"
 #include "common/code_utils.hpp"
 #include "common/mainloop_manager.hpp"
+#include "common/startup_timing.hpp"
+#include "common/time.hpp"
+#include "ncp/ncp_host.hpp"
 #include "utils/infra_link_selector.hpp"
 
 namespace otbr {
 
+namespace {
+
+// The hosts taken over from the previous agent are withdrawn unless their SRP clients re-register within the
+// default SRP lease.
+constexpr Milliseconds kHandoverHostLease = std::chrono::hours(2);
+
+int64_t ElapsedMilliseconds(Timepoint aStart)
+{
+    return std::chrono::duration_cast<Milliseconds>(Clock::now() - aStart).count();
+}
+
+/**
+ * This function runs one initialization step and logs how long it took, so a slow startup can be attributed.
+ */
+template <typename InitFunc> void TimeInitStep(const char *aName, InitFunc aInitFunc)
+{
+    Timepoint start = Clock::now();
+
+    aInitFunc();
+    otbrLogInfo("Initialized %s in %lld ms", aName, static_cast<long long>(ElapsedMilliseconds(start)));
+}
+
+void MarkStartupPhase(StartupTiming::Phase aPhase)
+{
+    VerifyOrExit(StartupTiming::Get().Mark(aPhase));
+
+#ifdef HAVE_LIBSYSTEMD
+    if (getenv("SYSTEMD_EXEC_PID") != nullptr)
+    {
+        // Ignored return value as systemd recommends.
+        sd_notifyf(0, "STATUS=Startup phase %s completed at %u ms", StartupTiming::PhaseToString(aPhase),
+                   StartupTiming::Get().GetElapsedMs(aPhase));
+    }
+#endif
+
+exit:
+    return;
+}
+
+} // namespace
+
 std::atomic_bool     Application::sShouldTerminate(false);
+std::atomic_bool     Application::sShouldReload(false);
 const struct timeval Application::kPollTimeout = {10, 0};
 
 Application::Application(const std::string               &aInterfaceName,
@@ -52,7 +100,9 @@ Application::Application(const std::string               &aInterfaceName,
                          const std::vector<const char *> &aRadioUrls,
                          bool                             aEnableAutoAttach,
                          const std::string               &aRestListenAddress,
-                         int                              aRestListenPort)
+                         int                              aRestListenPort,
+                         uint32_t                         aRestMaxConnections,
+                         const std::string               &aRestUnixSocketPath)
     : mInterfaceName(aInterfaceName)
 #if __linux__
     , mInfraLinkSelector(aBackboneInterfaceNames)
@@ -66,23 +116,39 @@ Application::Application(const std::string               &aInterfaceName,
                                     /* aDryRun */ false,
                                     aEnableAutoAttach))
 #if OTBR_ENABLE_MDNS
-    , mPublisher(Mdns::Publisher::Create([this](Mdns::Publisher::State aState) { this->HandleMdnsState(aState); }))
+    , mPublisher(static_cast<Mdns::PublisherImpl *>(
+          Mdns::Publisher::Create([this](Mdns::Publisher::State aState) { this->HandleMdnsState(aState); })))
 #endif
 #if OTBR_ENABLE_DBUS_SERVER && OTBR_ENABLE_BORDER_AGENT
     , mDBusAgent(MakeUnique<DBus::DBusAgent>(*mHost, *mPublisher))
 #endif
 {
-    if (mHost->GetCoprocessorType() == OT_COPROCESSOR_RCP)
+    if (Ncp::GetCoprocessorType(*mHost) == OT_COPROCESSOR_RCP)
     {
-        CreateRcpMode(aRestListenAddress, aRestListenPort);
+        CreateRcpMode(aRestListenAddress, aRestListenPort, aRestMaxConnections, aRestUnixSocketPath);
     }
 }
 
 void Application::Init(void)
 {
-    mHost->Init();
+    Timepoint start = Clock::now();
+
+#if OTBR_ENABLE_DBUS_SERVER && OTBR_ENABLE_BORDER_AGENT
+    // Connecting to the D-Bus daemon only depends on the daemon itself, so let it overlap the other steps.
+    mDBusAgent->ConnectAsync();
+#endif
 
-    switch (mHost->GetCoprocessorType())
+    if (mHandoverState.mTunFd != -1 && Ncp::GetCoprocessorType(*mHost) == OT_COPROCESSOR_NCP)
+    {
+        static_cast<Ncp::NcpHost &>(*mHost).GetNetif().SetHandoverTunDevice(mHandoverState.mTunFd,
+                                                                            mHandoverState.mIp6Addresses);
+        mHandoverState.mTunFd = -1;
+    }
+
+    TimeInitStep("Thread host", [this]() { mHost->Init(); });
+    MarkStartupPhase(StartupTiming::kPhaseHostInitialized);
+
+    switch (Ncp::GetCoprocessorType(*mHost))
     {
     case OT_COPROCESSOR_RCP:
         InitRcpMode();
@@ -95,12 +161,54 @@ void Application::Init(void)
         break;
     }
 
+    // The TUN device of an NCP agent is of no use in RCP mode, where OpenThread creates the Thread interface.
+    if (mHandoverState.mTunFd != -1)
+    {
+        close(mHandoverState.mTunFd);
+        mHandoverState.mTunFd = -1;
+    }
+
+    if (mHandover != nullptr)
+    {
+        mHandover->Listen([this](Handover::State &aState) { GetHandoverState(aState); },
+                          []() { sShouldTerminate = true; });
+    }
+
     otbrLogInfo("Co-processor version: %s", mHost->GetCoprocessorVersion());
+    otbrLogInfo("Initialized all subsystems in %lld ms", static_cast<long long>(ElapsedMilliseconds(start)));
+}
+
+void Application::SetHandover(Handover &aHandover, Handover::State &&aState)
+{
+    mHandover      = &aHandover;
+    mHandoverState = std::move(aState);
+}
+
+void Application::GetHandoverState(Handover::State &aState)
+{
+    switch (Ncp::GetCoprocessorType(*mHost))
+    {
+    case OT_COPROCESSOR_NCP:
+    {
+        Netif &netif = static_cast<Ncp::NcpHost &>(*mHost).GetNetif();
+
+        aState.mTunFd        = netif.GetTunFd();
+        aState.mIp6Addresses = netif.GetIp6UnicastAddresses();
+        break;
+    }
+    case OT_COPROCESSOR_RCP:
+#if OTBR_ENABLE_MDNS
+        aState.mHosts = mPublisher->GetPublishedHosts();
+#endif
+        break;
+    default:
+        break;
+    }
 }
 
 void Application::Deinit(void)
 {
-    switch (mHost->GetCoprocessorType())
+    switch (Ncp::GetCoprocessorType(*mHost))
     {
     case OT_COPROCESSOR_RCP:
         DeinitRcpMode();
@@ -121,6 +229,8 @@ otbrError Application::Run(void)
     otbrError error = OTBR_ERROR_NONE;
 
     otbrLogInfo("Thread Border Router started on AIL %s.", mBackboneInterfaceName);
+    MarkStartupPhase(StartupTiming::kPhaseReady);
+    StartupTiming::Get().LogSummary();
 
 #ifdef HAVE_LIBSYSTEMD
     if (getenv("SYSTEMD_EXEC_PID") != nullptr)
@@ -146,12 +256,19 @@ otbrError Application::Run(void)
 
     // allow quitting elegantly
     signal(SIGTERM, HandleSignal);
+    signal(SIGHUP, HandleReloadSignal);
 
     while (!sShouldTerminate)
     {
         otbr::MainloopContext mainloop;
         int                   rval;
 
+        // The signal interrupts select(), so the reload runs right after it.
+        if (sShouldReload.exchange(false))
+        {
+            ReloadConfig();
+        }
+
         mainloop.mMaxFd   = -1;
         mainloop.mTimeout = kPollTimeout;
 
@@ -161,8 +278,7 @@ otbrError Application::Run(void)
 
         MainloopManager::GetInstance().Update(mainloop);
 
-        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
-                      &mainloop.mTimeout);
+        rval = MainloopManager::Poll(mainloop);
 
         if (rval >= 0)
         {
@@ -172,7 +288,8 @@ otbrError Application::Run(void)
             {
                 const char *newInfraLink = mInfraLinkSelector.Select();
 
-                if (mBackboneInterfaceName != newInfraLink)
+                // A reload replaces the names with equal copies, which must not restart the agent.
+                if (strcmp(mBackboneInterfaceName, newInfraLink) != 0)
                 {
                     error = OTBR_ERROR_INFRA_LINK_CHANGED;
                     break;
@@ -195,6 +312,17 @@ void Application::HandleMdnsState(Mdns::Publisher::State aState)
 {
     OTBR_UNUSED_VARIABLE(aState);
 
+    if (aState == Mdns::Publisher::State::kReady)
+    {
+        MarkStartupPhase(StartupTiming::kPhaseMdnsReady);
+
+#if OTBR_ENABLE_MDNS
+        // The hosts are taken over before the proxies publish theirs, so that the ones published again are claimed.
+        mPublisher->AdoptHosts(mHandoverState.mHosts, kHandoverHostLease);
+        mHandoverState.mHosts.clear();
+#endif
+    }
+
 #if OTBR_ENABLE_BORDER_AGENT
     mBorderAgent->HandleMdnsState(aState);
 #endif
@@ -215,7 +343,58 @@ void Application::HandleSignal(int aSignal)
     signal(aSignal, SIG_DFL);
 }
 
-void Application::CreateRcpMode(const std::string &aRestListenAddress, int aRestListenPort)
+void Application::HandleReloadSignal(int aSignal)
+{
+    OTBR_UNUSED_VARIABLE(aSignal);
+
+    sShouldReload = true;
+}
+
+otbrError Application::ReloadConfig(void)
+{
+    otbrError        error = OTBR_ERROR_NONE;
+    ReloadableConfig config;
+
+    otbrLogNotice("Reloading configuration");
+    VerifyOrExit(mConfigLoader != nullptr, error = OTBR_ERROR_NOT_IMPLEMENTED);
+
+    // The configuration is fully loaded before any of it is applied, so an invalid one changes nothing.
+    SuccessOrExit(error = mConfigLoader(config));
+
+    otbrLogSetLevel(config.mLogLevel);
+    otbrLogClearTagLevels();
+    for (const auto &tagLevel : config.mLogTagLevels)
+    {
+        SuccessOrExit(error = otbrLogSetTagLevel(tagLevel.first.c_str(), tagLevel.second));
+    }
+
+#if __linux__
+    mInfraLinkSelector.SetInfraLinkNames(config.mBackboneInterfaceNames);
+#endif
+
+#if OTBR_ENABLE_REST_SERVER
+    if (mRestWebServer != nullptr)
+    {
+        SuccessOrExit(error = mRestWebServer->SetListenAddress(config.mRestListenAddress, config.mRestListenPort));
+    }
+#endif
+
+exit:
+    if (error == OTBR_ERROR_NONE)
+    {
+        otbrLogNotice("Reloaded configuration");
+    }
+    else
+    {
+        otbrLogWarning("Failed to reload configuration: %s", otbrErrorString(error));
+    }
+    return error;
+}
+
+void Application::CreateRcpMode(const std::string &aRestListenAddress,
+                                int                aRestListenPort,
+                                uint32_t           aRestMaxConnections,
+                                const std::string &aRestUnixSocketPath)
 {
     otbr::Ncp::RcpHost &rcpHost = static_cast<otbr::Ncp::RcpHost &>(*mHost);
 #if OTBR_ENABLE_BORDER_AGENT
@@ -229,6 +408,9 @@ void Application::CreateRcpMode(const std::string &aRestListenAddress, int aRest
 #endif
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
     mDiscoveryProxy = MakeUnique<Dnssd::DiscoveryProxy>(rcpHost, *mPublisher);
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    mDiscoveryProxy->SetAdvertisingProxy(mAdvertisingProxy.get());
+#endif
 #endif
 #if OTBR_ENABLE_TREL
     mTrelDnssd = MakeUnique<TrelDnssd::TrelDnssd>(rcpHost, *mPublisher);
@@ -237,7 +419,8 @@ void Application::CreateRcpMode(const std::string &aRestListenAddress, int aRest
     mUbusAgent = MakeUnique<ubus::UBusAgent>(rcpHost);
 #endif
 #if OTBR_ENABLE_REST_SERVER
-    mRestWebServer = MakeUnique<rest::RestWebServer>(rcpHost, aRestListenAddress, aRestListenPort);
+    mRestWebServer = MakeUnique<rest::RestWebServer>(rcpHost, aRestListenAddress, aRestListenPort, aRestMaxConnections,
+                                                     aRestUnixSocketPath);
 #endif
 #if OTBR_ENABLE_VENDOR_SERVER
     mVendorServer = vendor::VendorServer::newInstance(*this);
@@ -245,12 +428,16 @@ void Application::CreateRcpMode(const std::string &aRestListenAddress, int aRest
 
     OT_UNUSED_VARIABLE(aRestListenAddress);
     OT_UNUSED_VARIABLE(aRestListenPort);
+    OT_UNUSED_VARIABLE(aRestMaxConnections);
+    OT_UNUSED_VARIABLE(aRestUnixSocketPath);
 }
 
 void Application::InitRcpMode(void)
 {
+    // The steps below share the OpenThread instance and the mainloop, so they run on this thread in dependency
+    // order: the publisher before its users, and the Border Agent before the D-Bus agent which exposes it.
 #if OTBR_ENABLE_MDNS
-    mPublisher->Start();
+    TimeInitStep("mDNS publisher", [this]() { mPublisher->Start(); });
 #endif
 #if OTBR_ENABLE_BORDER_AGENT
 // This is for delaying publishing the MeshCoP service until the correct
@@ -258,34 +445,81 @@ void Application::InitRcpMode(void)
 #if OTBR_STOP_BORDER_AGENT_ON_INIT
     mBorderAgent->SetEnabled(false);
 #else
-    mBorderAgent->SetEnabled(true);
+    TimeInitStep("Border Agent", [this]() { mBorderAgent->SetEnabled(true); });
 #endif
 #endif
 #if OTBR_ENABLE_BACKBONE_ROUTER
-    mBackboneAgent->Init();
+    TimeInitStep("Backbone Agent", [this]() { mBackboneAgent->Init(); });
 #endif
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
-    mAdvertisingProxy->SetEnabled(true);
+    TimeInitStep("Advertising Proxy", [this]() { mAdvertisingProxy->SetEnabled(true); });
 #endif
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
-    mDiscoveryProxy->SetEnabled(true);
+    TimeInitStep("Discovery Proxy", [this]() { mDiscoveryProxy->SetEnabled(true); });
 #endif
 #if OTBR_ENABLE_OPENWRT
-    mUbusAgent->Init();
+    TimeInitStep("ubus agent", [this]() { mUbusAgent->Init(); });
 #endif
 #if OTBR_ENABLE_REST_SERVER
-    mRestWebServer->Init();
+    TimeInitStep("REST server", [this]() { mRestWebServer->Init(); });
 #endif
+    MarkStartupPhase(StartupTiming::kPhaseServicesInitialized);
 #if OTBR_ENABLE_DBUS_SERVER
-    mDBusAgent->Init(*mBorderAgent);
+    TimeInitStep("D-Bus agent", [this]() {
+        const TrelDnssdTelemetryInfo              *trelDnssdInfo       = nullptr;
+        const BackboneRouter::BackboneRouterStats *backboneRouterStats = nullptr;
+
+#if OTBR_ENABLE_TREL
+        trelDnssdInfo = &mTrelDnssd->GetTelemetryInfo();
+#endif
+#if OTBR_ENABLE_BACKBONE_ROUTER
+        backboneRouterStats = &mBackboneAgent->GetStats();
+#endif
+        mDBusAgent->SetConfigReloadHandler([this]() { return ReloadConfig(); });
+        mDBusAgent->Init(*mBorderAgent, trelDnssdInfo, backboneRouterStats);
+    });
+    MarkStartupPhase(StartupTiming::kPhaseDBusReady);
 #endif
 #if OTBR_ENABLE_VENDOR_SERVER
-    mVendorServer->Init();
+    TimeInitStep("vendor server", [this]() { InitVendorServer(); });
 #endif
 }
 
+#if OTBR_ENABLE_VENDOR_SERVER
+void Application::InitVendorServer(void)
+{
+    otbr::Ncp::RcpHost &rcpHost   = static_cast<otbr::Ncp::RcpHost &>(*mHost);
+    otChangedFlags      stateMask = 0;
+
+    mVendorServer->Init();
+
+    stateMask = mVendorServer->GetThreadStateChangedMask();
+    if (stateMask != 0)
+    {
+        rcpHost.AddThreadStateChangedCallback(stateMask, [this](const otbr::Ncp::ThreadStateSnapshot &aSnapshot) {
+            mVendorServer->HandleThreadStateChanged(aSnapshot);
+        });
+    }
+
+    // The counter history belongs to the thread helper, which is recreated when the host is reset.
+    AddVendorCountersCallback();
+    rcpHost.RegisterResetHandler([this]() { AddVendorCountersCallback(); });
+}
+
+void Application::AddVendorCountersCallback(void)
+{
+    otbr::Ncp::RcpHost &rcpHost = static_cast<otbr::Ncp::RcpHost &>(*mHost);
+
+    rcpHost.GetThreadHelper()->GetCounterHistory().AddSampledCallback(
+        [this](const agent::CounterHistory &aHistory) { mVendorServer->HandleCountersSampled(aHistory); });
+}
+#endif
+
 void Application::DeinitRcpMode(void)
 {
+#if OTBR_ENABLE_VENDOR_SERVER
+    mVendorServer->Deinit();
+#endif
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
     mAdvertisingProxy->SetEnabled(false);
 #endif
@@ -303,7 +537,8 @@ void Application::DeinitRcpMode(void)
 void Application::InitNcpMode(void)
 {
 #if OTBR_ENABLE_DBUS_SERVER
-    mDBusAgent->Init(*mBorderAgent);
+    TimeInitStep("D-Bus agent", [this]() { mDBusAgent->Init(*mBorderAgent, nullptr, nullptr); });
+    MarkStartupPhase(StartupTiming::kPhaseDBusReady);
 #endif
 }
 
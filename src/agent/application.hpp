@@ -37,13 +37,21 @@
 #include "openthread-br/config.h"
 
 #include <atomic>
+#include <functional>
+#include <map>
 #include <signal.h>
 #include <stdint.h>
+#include <string>
 #include <vector>
 
 #if OTBR_ENABLE_BORDER_AGENT
 #include "border_agent/border_agent.hpp"
 #endif
+#include "agent/handover.hpp"
+#include "common/logging.hpp"
+#if OTBR_ENABLE_MDNS
+#include "mdns/publisher_impl.hpp"
+#endif
 #include "ncp/rcp_host.hpp"
 #if OTBR_ENABLE_BACKBONE_ROUTER
 #include "backbone_router/backbone_agent.hpp"
@@ -87,6 +95,28 @@ class VendorServer;
 class Application : private NonCopyable
 {
 public:
+    /**
+     * This structure represents the settings which a configuration reload applies in place.
+     */
+    struct ReloadableConfig
+    {
+        otbrLogLevel                        mLogLevel;               ///< The log level.
+        std::map<std::string, otbrLogLevel> mLogTagLevels;           ///< The log levels of modules by log tag.
+        std::string                         mRestListenAddress;      ///< The REST address, any address if empty.
+        int                                 mRestListenPort;         ///< The REST port.
+        std::vector<std::string>            mBackboneInterfaceNames; ///< The backbone interface candidates.
+    };
+
+    /**
+     * This function loads the configuration, without applying it.
+     *
+     * @param[out] aConfig  The loaded configuration.
+     *
+     * @retval OTBR_ERROR_NONE  Successfully loaded the configuration.
+     * @retval ...              Failed to load the configuration, which is then left unchanged.
+     */
+    using ConfigLoader = std::function<otbrError(ReloadableConfig &aConfig)>;
+
     /**
      * This constructor initializes the Application instance.
      *
@@ -96,13 +126,17 @@ public:
      * @param[in] aEnableAutoAttach      Whether or not to automatically attach to the saved network.
      * @param[in] aRestListenAddress     Network address to listen on.
      * @param[in] aRestListenPort        Network port to listen on.
+     * @param[in] aRestMaxConnections    Maximum number of REST connections served at the same time.
+     * @param[in] aRestUnixSocketPath    Path of a UNIX domain socket the REST server listens on too, none if empty.
      */
     explicit Application(const std::string               &aInterfaceName,
                          const std::vector<const char *> &aBackboneInterfaceNames,
                          const std::vector<const char *> &aRadioUrls,
                          bool                             aEnableAutoAttach,
                          const std::string               &aRestListenAddress,
-                         int                              aRestListenPort);
+                         int                              aRestListenPort,
+                         uint32_t                         aRestMaxConnections,
+                         const std::string               &aRestUnixSocketPath);
 
     /**
      * This method initializes the Application instance.
@@ -114,6 +148,40 @@ public:
      */
     void Deinit(void);
 
+    /**
+     * This method sets how the configuration is loaded when it's reloaded.
+     *
+     * The configuration is reloaded on SIGHUP or on the `ReloadConfig` D-Bus method.
+     *
+     * @param[in] aLoader  The configuration loader.
+     */
+    void SetConfigLoader(ConfigLoader aLoader) { mConfigLoader = std::move(aLoader); }
+
+    /**
+     * This method makes the application take over the state handed over by the previous agent, and hand over its
+     * own state to the next agent.
+     *
+     * This method must be called before `Init()`. In NCP mode the Thread interface is taken over, in RCP mode the
+     * hosts published on behalf of the SRP clients are.
+     *
+     * @param[in] aHandover  The handover, which must outlive the application.
+     * @param[in] aState     The state received from the previous agent, empty if there was none.
+     */
+    void SetHandover(Handover &aHandover, Handover::State &&aState);
+
+    /**
+     * This method reloads the configuration and applies it in place.
+     *
+     * The log levels, the REST listen address and the backbone interface candidates change without restarting the
+     * Thread stack. Only removing the backbone interface in use still restarts the agent, on the next infra link
+     * selection.
+     *
+     * @retval OTBR_ERROR_NONE             Successfully applied the configuration.
+     * @retval OTBR_ERROR_NOT_IMPLEMENTED  No configuration loader is set.
+     * @retval ...                         Failed to load or apply the configuration.
+     */
+    otbrError ReloadConfig(void);
+
     /**
      * This method runs the application until exit.
      *
@@ -135,7 +203,7 @@ public:
      *
      * @returns The Publisher object.
      */
-    Mdns::Publisher &GetPublisher(void)
+    Mdns::PublisherImpl &GetPublisher(void)
     {
         return *mPublisher;
     }
@@ -249,14 +317,25 @@ private:
     static const struct timeval kPollTimeout;
 
     static void HandleSignal(int aSignal);
+    static void HandleReloadSignal(int aSignal);
 
-    void CreateRcpMode(const std::string &aRestListenAddress, int aRestListenPort);
+    void CreateRcpMode(const std::string &aRestListenAddress,
+                       int                aRestListenPort,
+                       uint32_t           aRestMaxConnections,
+                       const std::string &aRestUnixSocketPath);
     void InitRcpMode(void);
     void DeinitRcpMode(void);
 
     void InitNcpMode(void);
     void DeinitNcpMode(void);
 
+    void GetHandoverState(Handover::State &aState);
+
+#if OTBR_ENABLE_VENDOR_SERVER
+    void InitVendorServer(void);
+    void AddVendorCountersCallback(void);
+#endif
+
     std::string mInterfaceName;
 #if __linux__
     otbr::Utils::InfraLinkSelector mInfraLinkSelector;
@@ -264,7 +343,7 @@ private:
     const char                      *mBackboneInterfaceName;
     std::unique_ptr<Ncp::ThreadHost> mHost;
 #if OTBR_ENABLE_MDNS
-    std::unique_ptr<Mdns::Publisher> mPublisher;
+    std::unique_ptr<Mdns::PublisherImpl> mPublisher;
 #endif
 #if OTBR_ENABLE_BORDER_AGENT
     std::unique_ptr<BorderAgent> mBorderAgent;
@@ -293,8 +372,12 @@ private:
 #if OTBR_ENABLE_VENDOR_SERVER
     std::shared_ptr<vendor::VendorServer> mVendorServer;
 #endif
+    ConfigLoader    mConfigLoader;
+    Handover       *mHandover = nullptr;
+    Handover::State mHandoverState;
 
     static std::atomic_bool sShouldTerminate;
+    static std::atomic_bool sShouldReload;
 };
 
 /**
@@ -0,0 +1,642 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the handover of the agent state to a new agent process.
+ */
+
+#define OTBR_LOG_TAG "HANDOVER"
+
+#include "agent/handover.hpp"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "common/logging.hpp"
+#include "common/mainloop.hpp"
+#include "common/mainloop_manager.hpp"
+#include "utils/socket_utils.hpp"
+
+namespace otbr {
+
+namespace {
+
+// The time a new agent is given to read the state before sending it fails.
+constexpr time_t kSendTimeoutSec = 5;
+
+constexpr uint8_t kAddressFlagPreferred = 1 << 0;
+constexpr uint8_t kAddressFlagMeshLocal = 1 << 1;
+
+void AppendUint8(std::vector<uint8_t> &aBuffer, uint8_t aValue)
+{
+    aBuffer.push_back(aValue);
+}
+
+void AppendUint16(std::vector<uint8_t> &aBuffer, uint16_t aValue)
+{
+    aBuffer.push_back(static_cast<uint8_t>(aValue >> 8));
+    aBuffer.push_back(static_cast<uint8_t>(aValue & 0xff));
+}
+
+void AppendUint32(std::vector<uint8_t> &aBuffer, uint32_t aValue)
+{
+    AppendUint16(aBuffer, static_cast<uint16_t>(aValue >> 16));
+    AppendUint16(aBuffer, static_cast<uint16_t>(aValue & 0xffff));
+}
+
+void AppendBytes(std::vector<uint8_t> &aBuffer, const uint8_t *aBytes, size_t aLength)
+{
+    aBuffer.insert(aBuffer.end(), aBytes, aBytes + aLength);
+}
+
+// Strings and byte arrays are prefixed with their 16-bit length, which DNS names and TXT data never exceed.
+void AppendString(std::vector<uint8_t> &aBuffer, const std::string &aString)
+{
+    AppendUint16(aBuffer, static_cast<uint16_t>(aString.size()));
+    AppendBytes(aBuffer, reinterpret_cast<const uint8_t *>(aString.data()), aString.size());
+}
+
+/**
+ * This class reads the fields of an encoded state, failing on reads past its end.
+ */
+class Reader
+{
+public:
+    Reader(const uint8_t *aBuffer, size_t aLength)
+        : mCursor(aBuffer)
+        , mEnd(aBuffer + aLength)
+    {
+    }
+
+    bool ReadBytes(uint8_t *aBytes, size_t aLength)
+    {
+        bool succeeded = false;
+
+        VerifyOrExit(static_cast<size_t>(mEnd - mCursor) >= aLength);
+        memcpy(aBytes, mCursor, aLength);
+        mCursor += aLength;
+        succeeded = true;
+
+    exit:
+        return succeeded;
+    }
+
+    bool ReadUint8(uint8_t &aValue) { return ReadBytes(&aValue, sizeof(aValue)); }
+
+    bool ReadUint16(uint16_t &aValue)
+    {
+        uint8_t bytes[sizeof(uint16_t)];
+        bool    succeeded = ReadBytes(bytes, sizeof(bytes));
+
+        aValue = static_cast<uint16_t>((bytes[0] << 8) | bytes[1]);
+        return succeeded;
+    }
+
+    bool ReadUint32(uint32_t &aValue)
+    {
+        uint16_t high      = 0;
+        uint16_t low       = 0;
+        bool     succeeded = ReadUint16(high) && ReadUint16(low);
+
+        aValue = (static_cast<uint32_t>(high) << 16) | low;
+        return succeeded;
+    }
+
+    bool ReadString(std::string &aString)
+    {
+        uint16_t length;
+        bool     succeeded = false;
+
+        VerifyOrExit(ReadUint16(length));
+        VerifyOrExit(static_cast<size_t>(mEnd - mCursor) >= length);
+        aString.assign(reinterpret_cast<const char *>(mCursor), length);
+        mCursor += length;
+        succeeded = true;
+
+    exit:
+        return succeeded;
+    }
+
+    bool IsAtEnd(void) const { return mCursor == mEnd; }
+
+private:
+    const uint8_t *mCursor;
+    const uint8_t *mEnd;
+};
+
+otbrError WaitReadable(int aFd, Timepoint aDeadline)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    pollfd    pollFd;
+    int       rval;
+
+    pollFd.fd     = aFd;
+    pollFd.events = POLLIN;
+
+    do
+    {
+        Milliseconds remaining = std::chrono::duration_cast<Milliseconds>(aDeadline - Clock::now());
+
+        VerifyOrExit(remaining.count() > 0, error = OTBR_ERROR_TIMEOUT);
+        pollFd.revents = 0;
+        rval           = poll(&pollFd, 1, static_cast<int>(remaining.count()));
+    } while (rval < 0 && errno == EINTR);
+
+    VerifyOrExit(rval >= 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(rval > 0, error = OTBR_ERROR_TIMEOUT);
+
+exit:
+    return error;
+}
+
+// Receives exactly @p aLength bytes, and the fd passed along with them if @p aPassedFd isn't null.
+otbrError ReceiveAll(int aFd, uint8_t *aBuffer, size_t aLength, Timepoint aDeadline, int *aPassedFd)
+{
+    otbrError error    = OTBR_ERROR_NONE;
+    size_t    received = 0;
+
+    while (received < aLength)
+    {
+        iovec   iov;
+        msghdr  msg;
+        ssize_t rval;
+        union
+        {
+            cmsghdr mHeader;
+            uint8_t mBuffer[CMSG_SPACE(sizeof(int))];
+        } control;
+
+        SuccessOrExit(error = WaitReadable(aFd, aDeadline));
+
+        memset(&msg, 0, sizeof(msg));
+        iov.iov_base       = aBuffer + received;
+        iov.iov_len        = aLength - received;
+        msg.msg_iov        = &iov;
+        msg.msg_iovlen     = 1;
+        msg.msg_control    = control.mBuffer;
+        msg.msg_controllen = sizeof(control.mBuffer);
+
+        rval = recvmsg(aFd, &msg, 0);
+        if (rval < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrExit(rval >= 0, error = OTBR_ERROR_ERRNO);
+        VerifyOrExit(rval > 0, error = OTBR_ERROR_ABORTED);
+
+        for (cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg))
+        {
+            int fd;
+
+            if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS)
+            {
+                continue;
+            }
+
+            memcpy(&fd, CMSG_DATA(cmsg), sizeof(fd));
+            if (aPassedFd != nullptr && *aPassedFd == -1)
+            {
+                *aPassedFd = fd;
+            }
+            else
+            {
+                close(fd);
+            }
+        }
+
+        received += static_cast<size_t>(rval);
+    }
+
+exit:
+    return error;
+}
+
+otbrError WaitForClose(int aFd, Timepoint aDeadline)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    uint8_t   scratch[16];
+    ssize_t   rval;
+
+    do
+    {
+        SuccessOrExit(error = WaitReadable(aFd, aDeadline));
+        rval = read(aFd, scratch, sizeof(scratch));
+    } while (rval > 0 || (rval < 0 && errno == EINTR));
+
+    VerifyOrExit(rval == 0, error = OTBR_ERROR_ERRNO);
+
+exit:
+    return error;
+}
+
+otbrError SendAll(int aFd, const uint8_t *aBuffer, size_t aLength)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    size_t    sent  = 0;
+
+    while (sent < aLength)
+    {
+        ssize_t rval = send(aFd, aBuffer + sent, aLength - sent, MSG_NOSIGNAL);
+
+        if (rval < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrExit(rval > 0, error = OTBR_ERROR_ERRNO);
+        sent += static_cast<size_t>(rval);
+    }
+
+exit:
+    return error;
+}
+
+} // namespace
+
+constexpr uint32_t Handover::kMagic;
+constexpr uint8_t  Handover::kVersion;
+constexpr uint32_t Handover::kMaxStateLength;
+
+Handover::Handover(std::string aSocketPath)
+    : mSocketPath(std::move(aSocketPath))
+    , mListenFd(-1)
+    , mPeerFd(-1)
+{
+}
+
+Handover::~Handover(void)
+{
+    if (mListenFd != -1)
+    {
+        MainloopManager::GetInstance().RemoveFd(mListenFd);
+        close(mListenFd);
+        unlink(mSocketPath.c_str());
+    }
+
+    if (mPeerFd != -1)
+    {
+        close(mPeerFd);
+    }
+}
+
+otbrError Handover::Receive(State &aState, Milliseconds aTimeout)
+{
+    otbrError            error    = OTBR_ERROR_NONE;
+    Timepoint            deadline = Clock::now() + aTimeout;
+    int                  fd       = -1;
+    int                  tunFd    = -1;
+    sockaddr_un          address;
+    uint8_t              header[sizeof(uint32_t)];
+    uint32_t             length;
+    std::vector<uint8_t> buffer;
+    State                state;
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    VerifyOrExit(mSocketPath.size() < sizeof(address.sun_path), error = OTBR_ERROR_INVALID_ARGS);
+    memcpy(address.sun_path, mSocketPath.c_str(), mSocketPath.size());
+
+    fd = SocketWithCloseExec(AF_UNIX, SOCK_STREAM, 0, kSocketBlock);
+    VerifyOrExit(fd != -1, error = OTBR_ERROR_ERRNO);
+
+    if (connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0)
+    {
+        // The socket file of an agent which didn't exit cleanly refuses connections.
+        error = (errno == ENOENT || errno == ECONNREFUSED) ? OTBR_ERROR_NOT_FOUND : OTBR_ERROR_ERRNO;
+        ExitNow();
+    }
+
+    otbrLogNotice("Taking over from the agent listening on %s", mSocketPath.c_str());
+
+    SuccessOrExit(error = ReceiveAll(fd, header, sizeof(header), deadline, &tunFd));
+    length = (static_cast<uint32_t>(header[0]) << 24) | (static_cast<uint32_t>(header[1]) << 16) |
+             (static_cast<uint32_t>(header[2]) << 8) | header[3];
+    VerifyOrExit(length <= kMaxStateLength, error = OTBR_ERROR_PARSE);
+
+    buffer.resize(length);
+    SuccessOrExit(error = ReceiveAll(fd, buffer.data(), buffer.size(), deadline, nullptr));
+    SuccessOrExit(error = Decode(buffer.data(), buffer.size(), state));
+
+    // The agent closes the connection by exiting, which releases the co-processor for this agent.
+    SuccessOrExit(error = WaitForClose(fd, deadline));
+
+    state.mTunFd = tunFd;
+    tunFd        = -1;
+    aState       = std::move(state);
+
+    otbrLogNotice("Took over %s TUN device, %zu addresses and %zu hosts", aState.mTunFd != -1 ? "the" : "no",
+                  aState.mIp6Addresses.size(), aState.mHosts.size());
+
+exit:
+    if (tunFd != -1)
+    {
+        close(tunFd);
+    }
+
+    if (fd != -1)
+    {
+        close(fd);
+    }
+
+    if (error != OTBR_ERROR_NONE && error != OTBR_ERROR_NOT_FOUND)
+    {
+        otbrLogErr("Failed to take over from the agent listening on %s: %s", mSocketPath.c_str(),
+                   error == OTBR_ERROR_ERRNO ? strerror(errno) : otbrErrorString(error));
+    }
+
+    return error;
+}
+
+otbrError Handover::Listen(StateProvider aProvider, DoneHandler aDone)
+{
+    otbrError   error = OTBR_ERROR_NONE;
+    sockaddr_un address;
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    VerifyOrExit(mSocketPath.size() < sizeof(address.sun_path), error = OTBR_ERROR_INVALID_ARGS);
+    memcpy(address.sun_path, mSocketPath.c_str(), mSocketPath.size());
+
+    mListenFd = SocketWithCloseExec(AF_UNIX, SOCK_STREAM, 0, kSocketNonBlock);
+    VerifyOrExit(mListenFd != -1, error = OTBR_ERROR_ERRNO);
+
+    // The socket file of the agent taken over from is left behind, and makes bind() fail.
+    unlink(mSocketPath.c_str());
+
+    VerifyOrExit(bind(mListenFd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+    // Only processes of the same user may take over the agent.
+    VerifyOrExit(chmod(mSocketPath.c_str(), S_IRUSR | S_IWUSR) == 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(listen(mListenFd, 1) == 0, error = OTBR_ERROR_ERRNO);
+
+    SuccessOrExit(error = MainloopManager::GetInstance().AddFd(mListenFd, MainloopContext::kReadFdSet,
+                                                               [this](uint8_t) { HandleAccept(); }));
+
+    mProvider = std::move(aProvider);
+    mDone     = std::move(aDone);
+    otbrLogInfo("Listening for a new agent on %s", mSocketPath.c_str());
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogErr("Failed to listen for a new agent on %s: %s", mSocketPath.c_str(),
+                   error == OTBR_ERROR_ERRNO ? strerror(errno) : otbrErrorString(error));
+
+        if (mListenFd != -1)
+        {
+            close(mListenFd);
+            mListenFd = -1;
+        }
+    }
+
+    return error;
+}
+
+void Handover::HandleAccept(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    int       fd    = accept(mListenFd, nullptr, nullptr);
+    int       flags;
+
+    VerifyOrExit(fd != -1, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(fcntl(fd, F_SETFD, FD_CLOEXEC) == 0, error = OTBR_ERROR_ERRNO);
+
+    // The state is small enough to be sent at once, with the time the new agent is given to read it bounded.
+    flags = fcntl(fd, F_GETFL);
+    VerifyOrExit(flags != -1 && fcntl(fd, F_SETFL, flags & ~O_NONBLOCK) == 0, error = OTBR_ERROR_ERRNO);
+
+    SuccessOrExit(error = SendState(fd));
+
+    mPeerFd = fd;
+    fd      = -1;
+
+    // No other agent may take over once the state is handed over.
+    MainloopManager::GetInstance().RemoveFd(mListenFd);
+    close(mListenFd);
+    mListenFd = -1;
+
+    otbrLogNotice("Handed over to a new agent, exiting");
+    mDone();
+
+exit:
+    if (fd != -1)
+    {
+        close(fd);
+    }
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to hand over to a new agent: %s",
+                       error == OTBR_ERROR_ERRNO ? strerror(errno) : otbrErrorString(error));
+    }
+}
+
+otbrError Handover::SendState(int aFd)
+{
+    otbrError            error   = OTBR_ERROR_NONE;
+    timeval              timeout = {kSendTimeoutSec, 0};
+    State                state;
+    std::vector<uint8_t> buffer;
+    std::vector<uint8_t> header;
+    iovec                iov;
+    msghdr               msg;
+    union
+    {
+        cmsghdr mHeader;
+        uint8_t mBuffer[CMSG_SPACE(sizeof(int))];
+    } control;
+
+    VerifyOrExit(setsockopt(aFd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout)) == 0, error = OTBR_ERROR_ERRNO);
+
+    mProvider(state);
+    Encode(state, buffer);
+    AppendUint32(header, static_cast<uint32_t>(buffer.size()));
+
+    memset(&msg, 0, sizeof(msg));
+    iov.iov_base   = header.data();
+    iov.iov_len    = header.size();
+    msg.msg_iov    = &iov;
+    msg.msg_iovlen = 1;
+
+    // The TUN device is passed along with the length, which is read first.
+    if (state.mTunFd != -1)
+    {
+        cmsghdr *cmsg;
+
+        memset(&control, 0, sizeof(control));
+        msg.msg_control    = control.mBuffer;
+        msg.msg_controllen = sizeof(control.mBuffer);
+
+        cmsg             = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type  = SCM_RIGHTS;
+        cmsg->cmsg_len   = CMSG_LEN(sizeof(int));
+        memcpy(CMSG_DATA(cmsg), &state.mTunFd, sizeof(int));
+    }
+
+    VerifyOrExit(sendmsg(aFd, &msg, MSG_NOSIGNAL) == static_cast<ssize_t>(header.size()), error = OTBR_ERROR_ERRNO);
+    SuccessOrExit(error = SendAll(aFd, buffer.data(), buffer.size()));
+
+exit:
+    return error;
+}
+
+void Handover::Encode(const State &aState, std::vector<uint8_t> &aBuffer)
+{
+    aBuffer.clear();
+    AppendUint32(aBuffer, kMagic);
+    AppendUint8(aBuffer, kVersion);
+
+    AppendUint16(aBuffer, static_cast<uint16_t>(aState.mIp6Addresses.size()));
+    for (const Ip6AddressInfo &addressInfo : aState.mIp6Addresses)
+    {
+        uint8_t flags = 0;
+
+        flags |= addressInfo.mPreferred ? kAddressFlagPreferred : 0;
+        flags |= addressInfo.mMeshLocal ? kAddressFlagMeshLocal : 0;
+
+        AppendBytes(aBuffer, addressInfo.mAddress.mFields.m8, sizeof(addressInfo.mAddress.mFields.m8));
+        AppendUint8(aBuffer, addressInfo.mPrefixLength);
+        AppendUint8(aBuffer, addressInfo.mScope);
+        AppendUint8(aBuffer, flags);
+    }
+
+    AppendUint32(aBuffer, static_cast<uint32_t>(aState.mHosts.size()));
+    for (const Mdns::Publisher::PublishedHost &host : aState.mHosts)
+    {
+        AppendString(aBuffer, host.mName);
+
+        AppendUint16(aBuffer, static_cast<uint16_t>(host.mAddresses.size()));
+        for (const Ip6Address &address : host.mAddresses)
+        {
+            AppendBytes(aBuffer, address.m8, sizeof(address.m8));
+        }
+
+        AppendUint16(aBuffer, static_cast<uint16_t>(host.mServices.size()));
+        for (const Mdns::Publisher::HostedService &service : host.mServices)
+        {
+            AppendString(aBuffer, service.mName);
+            AppendString(aBuffer, service.mType);
+            AppendUint16(aBuffer, static_cast<uint16_t>(service.mSubTypeList.size()));
+            for (const std::string &subType : service.mSubTypeList)
+            {
+                AppendString(aBuffer, subType);
+            }
+            AppendUint16(aBuffer, service.mPort);
+            AppendUint16(aBuffer, static_cast<uint16_t>(service.mTxtData.size()));
+            AppendBytes(aBuffer, service.mTxtData.data(), service.mTxtData.size());
+        }
+    }
+}
+
+otbrError Handover::Decode(const uint8_t *aBuffer, size_t aLength, State &aState)
+{
+    otbrError error = OTBR_ERROR_PARSE;
+    Reader    reader(aBuffer, aLength);
+    uint32_t  magic;
+    uint8_t   version;
+    uint16_t  addressCount;
+    uint32_t  hostCount;
+
+    aState = State();
+
+    VerifyOrExit(reader.ReadUint32(magic) && magic == kMagic);
+    VerifyOrExit(reader.ReadUint8(version) && version == kVersion);
+
+    VerifyOrExit(reader.ReadUint16(addressCount));
+    for (uint16_t i = 0; i < addressCount; i++)
+    {
+        Ip6AddressInfo addressInfo;
+        uint8_t        scope;
+        uint8_t        flags;
+
+        VerifyOrExit(reader.ReadBytes(addressInfo.mAddress.mFields.m8, sizeof(addressInfo.mAddress.mFields.m8)));
+        VerifyOrExit(reader.ReadUint8(addressInfo.mPrefixLength));
+        VerifyOrExit(reader.ReadUint8(scope));
+        VerifyOrExit(reader.ReadUint8(flags));
+
+        addressInfo.mScope     = scope;
+        addressInfo.mPreferred = (flags & kAddressFlagPreferred) != 0;
+        addressInfo.mMeshLocal = (flags & kAddressFlagMeshLocal) != 0;
+        aState.mIp6Addresses.push_back(addressInfo);
+    }
+
+    VerifyOrExit(reader.ReadUint32(hostCount));
+    for (uint32_t i = 0; i < hostCount; i++)
+    {
+        Mdns::Publisher::PublishedHost host;
+        uint16_t                       count;
+
+        VerifyOrExit(reader.ReadString(host.mName));
+
+        VerifyOrExit(reader.ReadUint16(count));
+        host.mAddresses.resize(count);
+        for (Ip6Address &address : host.mAddresses)
+        {
+            VerifyOrExit(reader.ReadBytes(address.m8, sizeof(address.m8)));
+        }
+
+        VerifyOrExit(reader.ReadUint16(count));
+        host.mServices.resize(count);
+        for (Mdns::Publisher::HostedService &service : host.mServices)
+        {
+            uint16_t subTypeCount;
+            uint16_t txtLength;
+
+            VerifyOrExit(reader.ReadString(service.mName));
+            VerifyOrExit(reader.ReadString(service.mType));
+            VerifyOrExit(reader.ReadUint16(subTypeCount));
+            service.mSubTypeList.resize(subTypeCount);
+            for (std::string &subType : service.mSubTypeList)
+            {
+                VerifyOrExit(reader.ReadString(subType));
+            }
+            VerifyOrExit(reader.ReadUint16(service.mPort));
+            VerifyOrExit(reader.ReadUint16(txtLength));
+            service.mTxtData.resize(txtLength);
+            VerifyOrExit(reader.ReadBytes(service.mTxtData.data(), txtLength));
+        }
+
+        aState.mHosts.push_back(std::move(host));
+    }
+
+    VerifyOrExit(reader.IsAtEnd());
+    error = OTBR_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+} // namespace otbr
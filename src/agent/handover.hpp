@@ -0,0 +1,155 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of the handover of the agent state to a new agent process.
+ */
+
+#ifndef OTBR_AGENT_HANDOVER_HPP_
+#define OTBR_AGENT_HANDOVER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stdint.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/time.hpp"
+#include "common/types.hpp"
+#include "mdns/mdns.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements the handover of the agent state from a running agent to a new agent process, so that the
+ * agent can be upgraded without the Thread interface and the advertised services going away.
+ *
+ * The running agent listens on a UNIX domain socket. The new agent connects to it before it opens the co-processor,
+ * receives the state, with the TUN device as an `SCM_RIGHTS` ancillary message, and waits for the running agent to
+ * close the connection, which it does by exiting and so releasing the co-processor.
+ */
+class Handover : private NonCopyable
+{
+public:
+    /**
+     * This structure represents the state handed over.
+     */
+    struct State
+    {
+        int                                mTunFd = -1;   ///< The TUN device of the Thread interface, or -1.
+        std::vector<Ip6AddressInfo>        mIp6Addresses; ///< The unicast addresses added to the Thread interface.
+        Mdns::Publisher::PublishedHostList mHosts;        ///< The hosts published on behalf of the SRP clients.
+    };
+
+    /**
+     * This function fills the state to hand over.
+     *
+     * @param[out] aState  The state, empty when called.
+     */
+    using StateProvider = std::function<void(State &aState)>;
+
+    /**
+     * This function is called after the state is handed over, when the agent should exit.
+     */
+    using DoneHandler = std::function<void(void)>;
+
+    /**
+     * This constructor initializes the handover.
+     *
+     * @param[in] aSocketPath  The path of the UNIX domain socket.
+     */
+    explicit Handover(std::string aSocketPath);
+
+    ~Handover(void);
+
+    /**
+     * This method receives the state from the running agent.
+     *
+     * @param[out] aState    The received state. The caller owns `aState.mTunFd`.
+     * @param[in]  aTimeout  The time to wait for the state and then for the running agent to exit.
+     *
+     * @retval OTBR_ERROR_NONE       Successfully received the state and the running agent has exited.
+     * @retval OTBR_ERROR_NOT_FOUND  No agent is listening on the socket.
+     * @retval OTBR_ERROR_PARSE      The state is malformed or of an unsupported version.
+     * @retval ...                   Failed to receive the state.
+     */
+    otbrError Receive(State &aState, Milliseconds aTimeout);
+
+    /**
+     * This method starts listening for a new agent on the socket.
+     *
+     * @param[in] aProvider  The provider of the state, called when a new agent connects.
+     * @param[in] aDone      The handler called after the state is handed over.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully started listening.
+     * @retval OTBR_ERROR_ERRNO  Failed to listen on the socket.
+     */
+    otbrError Listen(StateProvider aProvider, DoneHandler aDone);
+
+    /**
+     * This function encodes a state, without its TUN device.
+     *
+     * @param[in]  aState   The state.
+     * @param[out] aBuffer  The encoded state.
+     */
+    static void Encode(const State &aState, std::vector<uint8_t> &aBuffer);
+
+    /**
+     * This function decodes a state, without its TUN device.
+     *
+     * @param[in]  aBuffer  The encoded state.
+     * @param[in]  aLength  The length of @p aBuffer.
+     * @param[out] aState   The decoded state.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully decoded the state.
+     * @retval OTBR_ERROR_PARSE  The state is malformed or of an unsupported version.
+     */
+    static otbrError Decode(const uint8_t *aBuffer, size_t aLength, State &aState);
+
+private:
+    static constexpr uint32_t kMagic          = 0x4f544248; // "OTBH"
+    static constexpr uint8_t  kVersion        = 1;
+    static constexpr uint32_t kMaxStateLength = 1024 * 1024;
+
+    void      HandleAccept(void);
+    otbrError SendState(int aFd);
+
+    std::string   mSocketPath;
+    int           mListenFd;
+    int           mPeerFd; // Kept open until exit, which tells the new agent that the co-processor is released.
+    StateProvider mProvider;
+    DoneHandler   mDone;
+};
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_HANDOVER_HPP_
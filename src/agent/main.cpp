@@ -31,10 +31,14 @@
 #include <openthread-br/config.h>
 
 #include <algorithm>
+#include <fstream>
+#include <map>
+#include <string>
 #include <vector>
 
 #include <assert.h>
 #include <getopt.h>
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -48,11 +52,18 @@
 #endif
 
 #include "agent/application.hpp"
+#include "agent/handover.hpp"
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 #include "common/mainloop.hpp"
+#include "common/mainloop_watchdog.hpp"
+#include "common/startup_timing.hpp"
+#include "common/thread_scheduling.hpp"
 #include "common/types.hpp"
 #include "ncp/thread_host.hpp"
+#if OTBR_ENABLE_DBUS_SERVER
+#include "dbus/common/dbus_message_dump.hpp"
+#endif
 
 #ifdef OTBR_ENABLE_PLATFORM_ANDROID
 #ifndef __ANDROID__
@@ -65,6 +76,12 @@ static const char kDefaultInterfaceName[] = "wpan0";
 // Port number used by Rest server.
 static const uint32_t kPortNumber = 8081;
 
+// Default maximum number of connections served by the REST server at the same time.
+static const uint32_t kRestMaxConnections = 500;
+
+// The time given to the running agent to hand over its state and exit.
+static const uint32_t kHandoverTimeoutMs = 10000;
+
 enum
 {
     OTBR_OPT_BACKBONE_INTERFACE_NAME = 'B',
@@ -79,6 +96,18 @@ enum
     OTBR_OPT_AUTO_ATTACH,
     OTBR_OPT_REST_LISTEN_ADDR,
     OTBR_OPT_REST_LISTEN_PORT,
+    OTBR_OPT_REST_MAX_CONNECTIONS,
+    OTBR_OPT_REST_UNIX_SOCKET,
+    OTBR_OPT_DBUS_TRACE_INTERVAL,
+    OTBR_OPT_DBUS_TRACE_MAX_LENGTH,
+    OTBR_OPT_LOG_TAG_LEVEL,
+    OTBR_OPT_MAINLOOP_WATCHDOG,
+    OTBR_OPT_CONFIG_FILE,
+    OTBR_OPT_HANDOVER_SOCKET,
+    OTBR_OPT_MAINLOOP_CPUS,
+    OTBR_OPT_MAINLOOP_RT_PRIORITY,
+    OTBR_OPT_MAINLOOP_NICE,
+    OTBR_OPT_MANAGEMENT_NICE,
 };
 
 #ifndef OTBR_ENABLE_PLATFORM_ANDROID
@@ -99,6 +128,18 @@ static const struct option kOptions[] = {
     {"auto-attach", optional_argument, nullptr, OTBR_OPT_AUTO_ATTACH},
     {"rest-listen-address", required_argument, nullptr, OTBR_OPT_REST_LISTEN_ADDR},
     {"rest-listen-port", required_argument, nullptr, OTBR_OPT_REST_LISTEN_PORT},
+    {"rest-max-connections", required_argument, nullptr, OTBR_OPT_REST_MAX_CONNECTIONS},
+    {"rest-unix-socket", required_argument, nullptr, OTBR_OPT_REST_UNIX_SOCKET},
+    {"dbus-trace-interval", required_argument, nullptr, OTBR_OPT_DBUS_TRACE_INTERVAL},
+    {"dbus-trace-max-length", required_argument, nullptr, OTBR_OPT_DBUS_TRACE_MAX_LENGTH},
+    {"log-tag-level", required_argument, nullptr, OTBR_OPT_LOG_TAG_LEVEL},
+    {"mainloop-watchdog", required_argument, nullptr, OTBR_OPT_MAINLOOP_WATCHDOG},
+    {"config-file", required_argument, nullptr, OTBR_OPT_CONFIG_FILE},
+    {"handover-socket", required_argument, nullptr, OTBR_OPT_HANDOVER_SOCKET},
+    {"mainloop-cpus", required_argument, nullptr, OTBR_OPT_MAINLOOP_CPUS},
+    {"mainloop-rt-priority", required_argument, nullptr, OTBR_OPT_MAINLOOP_RT_PRIORITY},
+    {"mainloop-nice", required_argument, nullptr, OTBR_OPT_MAINLOOP_NICE},
+    {"management-nice", required_argument, nullptr, OTBR_OPT_MANAGEMENT_NICE},
     {0, 0, 0, 0}};
 
 static bool ParseInteger(const char *aStr, long &aOutResult)
@@ -145,11 +186,135 @@ static void PrintHelp(const char *aProgramName)
             "Usage: %s [-I interfaceName] [-B backboneIfName] [-d DEBUG_LEVEL] [-v] [-s] [--auto-attach[=0/1]] "
             "RADIO_URL [RADIO_URL]\n"
             "    --auto-attach defaults to 1\n"
-            "    -s disables syslog and prints to standard out\n",
+            "    -s disables syslog and prints to standard out\n"
+            "    --dbus-trace-interval=N traces D-Bus traffic, dumping every Nth message, defaults to 0 (disabled)\n"
+            "    --dbus-trace-max-length=LEN truncates the D-Bus trace dumps to LEN characters, 0 disables dumps\n"
+            "    --log-tag-level=TAG:LEVEL sets the log level of the module with log tag TAG, may be repeated\n"
+            "    --mainloop-watchdog=MS reports mainloop processors or tasks running over MS ms, defaults to 0 "
+            "(disabled)\n"
+            "    --rest-unix-socket=PATH also serves the REST API to local clients on a UNIX domain socket at PATH\n"
+            "    --config-file=PATH reads debug-level, log-tag-level, rest-listen-address, rest-listen-port and\n"
+            "      backbone-ifname as KEY=VALUE lines overriding the options, reloaded on SIGHUP\n"
+            "    --handover-socket=PATH takes over from the agent listening on the UNIX domain socket at PATH, and\n"
+            "      listens there for the next agent to hand over to\n"
+            "    --mainloop-cpus=LIST pins the mainloop thread to the CPUs in LIST, e.g. 0,2-3\n"
+            "    --mainloop-rt-priority=N runs the mainloop thread with the SCHED_FIFO priority N\n"
+            "    --mainloop-nice=N runs the mainloop thread with the nice value N\n"
+            "    --management-nice=N runs the management threads, e.g. the ubus server, with the nice value N\n",
             aProgramName);
     fprintf(stderr, "%s", otSysGetRadioUrlHelpString());
 }
 
+static bool ParseLogLevel(const char *aStr, otbrLogLevel &aLevel)
+{
+    bool succeeded = false;
+    long level;
+
+    VerifyOrExit(ParseInteger(aStr, level));
+    VerifyOrExit(OTBR_LOG_EMERG <= level && level <= OTBR_LOG_DEBUG);
+    aLevel    = static_cast<otbrLogLevel>(level);
+    succeeded = true;
+
+exit:
+    return succeeded;
+}
+
+static bool ParseLogTagLevel(const char *aLogTagLevel, std::map<std::string, otbrLogLevel> &aLogTagLevels)
+{
+    bool         succeeded = false;
+    const char  *separator = strrchr(aLogTagLevel, ':');
+    std::string  logTag;
+    otbrLogLevel level;
+
+    VerifyOrExit(separator != nullptr && separator != aLogTagLevel);
+    logTag.assign(aLogTagLevel, separator - aLogTagLevel);
+    VerifyOrExit(ParseLogLevel(separator + 1, level));
+    aLogTagLevels[logTag] = level;
+    succeeded             = true;
+
+exit:
+    return succeeded;
+}
+
+/**
+ * This function loads the settings of a configuration file over @p aConfig.
+ *
+ * Each line of the file is empty, a comment starting with `#`, or a `KEY=VALUE` setting whose key is the name of
+ * the long option. The `backbone-ifname` settings replace the backbone interfaces given as options.
+ */
+static otbrError LoadConfigFile(const char *aPath, otbr::Application::ReloadableConfig &aConfig)
+{
+    otbrError                error = OTBR_ERROR_NONE;
+    std::ifstream            file(aPath);
+    std::string              line;
+    std::vector<std::string> backboneInterfaceNames;
+    uint32_t                 lineNumber = 0;
+    long                     port;
+
+    VerifyOrExit(file.is_open(), error = OTBR_ERROR_ERRNO, otbrLogErr("Failed to open config file %s", aPath));
+
+    while (std::getline(file, line))
+    {
+        size_t      begin = line.find_first_not_of(" \t");
+        size_t      end   = line.find_last_not_of(" \t\r");
+        size_t      separator;
+        std::string key;
+        std::string value;
+
+        lineNumber++;
+
+        if (begin == std::string::npos || line[begin] == '#')
+        {
+            continue;
+        }
+
+        line      = line.substr(begin, end - begin + 1);
+        separator = line.find('=');
+        VerifyOrExit(separator != std::string::npos, error = OTBR_ERROR_PARSE);
+        key   = line.substr(0, separator);
+        value = line.substr(separator + 1);
+
+        if (key == "debug-level")
+        {
+            VerifyOrExit(ParseLogLevel(value.c_str(), aConfig.mLogLevel), error = OTBR_ERROR_PARSE);
+        }
+        else if (key == "log-tag-level")
+        {
+            VerifyOrExit(ParseLogTagLevel(value.c_str(), aConfig.mLogTagLevels), error = OTBR_ERROR_PARSE);
+        }
+        else if (key == "rest-listen-address")
+        {
+            aConfig.mRestListenAddress = value;
+        }
+        else if (key == "rest-listen-port")
+        {
+            VerifyOrExit(ParseInteger(value.c_str(), port) && 0 < port && port <= UINT16_MAX,
+                         error = OTBR_ERROR_PARSE);
+            aConfig.mRestListenPort = static_cast<int>(port);
+        }
+        else if (key == "backbone-ifname")
+        {
+            backboneInterfaceNames.push_back(value);
+        }
+        else
+        {
+            ExitNow(error = OTBR_ERROR_PARSE);
+        }
+    }
+
+    if (!backboneInterfaceNames.empty())
+    {
+        aConfig.mBackboneInterfaceNames = std::move(backboneInterfaceNames);
+    }
+
+exit:
+    if (error == OTBR_ERROR_PARSE)
+    {
+        otbrLogErr("Invalid setting in config file %s line %u", aPath, lineNumber);
+    }
+    return error;
+}
+
 static void PrintVersion(void)
 {
     printf("%s\n", OTBR_PACKAGE_VERSION);
@@ -200,18 +365,30 @@ static int realmain(int argc, char *argv[])
 {
     otbrLogLevel              logLevel = GetDefaultLogLevel();
     int                       opt;
-    int                       ret               = EXIT_SUCCESS;
-    const char               *interfaceName     = kDefaultInterfaceName;
-    bool                      verbose           = false;
-    bool                      syslogDisable     = false;
-    bool                      printRadioVersion = false;
-    bool                      enableAutoAttach  = true;
-    const char               *restListenAddress = "";
-    int                       restListenPort    = kPortNumber;
+    int                       ret                = EXIT_SUCCESS;
+    const char               *interfaceName      = kDefaultInterfaceName;
+    bool                      verbose            = false;
+    bool                      syslogDisable      = false;
+    bool                      printRadioVersion  = false;
+    bool                      enableAutoAttach   = true;
+    const char               *restListenAddress  = "";
+    int                       restListenPort     = kPortNumber;
+    uint32_t                  restMaxConnections = kRestMaxConnections;
+    const char               *restUnixSocket     = "";
+    const char               *configFile         = nullptr;
+    const char               *handoverSocket     = nullptr;
+    uint32_t                  dbusTraceInterval  = 0;
+    long                      dbusTraceMaxLength = -1;
+    uint32_t                  watchdogThreshold  = 0;
     std::vector<const char *> radioUrls;
     std::vector<const char *> backboneInterfaceNames;
+    std::vector<const char *> logTagLevels;
     long                      parseResult;
 
+    otbr::Application::ReloadableConfig optionConfig;
+    otbr::Application::ReloadableConfig config;
+    otbr::ThreadScheduling::Config      schedulingConfig;
+
     std::set_new_handler(OnAllocateFailed);
 
     while ((opt = getopt_long(argc, argv, "B:d:hI:Vvs", kOptions, nullptr)) != -1)
@@ -275,6 +452,69 @@ static int realmain(int argc, char *argv[])
             restListenPort = parseResult;
             break;
 
+        case OTBR_OPT_REST_MAX_CONNECTIONS:
+            VerifyOrExit(ParseInteger(optarg, parseResult), ret = EXIT_FAILURE);
+            VerifyOrExit(0 < parseResult && parseResult <= FD_SETSIZE, ret = EXIT_FAILURE);
+            restMaxConnections = static_cast<uint32_t>(parseResult);
+            break;
+
+        case OTBR_OPT_REST_UNIX_SOCKET:
+            restUnixSocket = optarg;
+            break;
+
+        case OTBR_OPT_DBUS_TRACE_INTERVAL:
+            VerifyOrExit(ParseInteger(optarg, parseResult), ret = EXIT_FAILURE);
+            VerifyOrExit(0 <= parseResult && parseResult <= UINT32_MAX, ret = EXIT_FAILURE);
+            dbusTraceInterval = static_cast<uint32_t>(parseResult);
+            break;
+
+        case OTBR_OPT_DBUS_TRACE_MAX_LENGTH:
+            VerifyOrExit(ParseInteger(optarg, parseResult), ret = EXIT_FAILURE);
+            VerifyOrExit(0 <= parseResult, ret = EXIT_FAILURE);
+            dbusTraceMaxLength = parseResult;
+            break;
+
+        case OTBR_OPT_LOG_TAG_LEVEL:
+            logTagLevels.push_back(optarg);
+            break;
+
+        case OTBR_OPT_MAINLOOP_WATCHDOG:
+            VerifyOrExit(ParseInteger(optarg, parseResult), ret = EXIT_FAILURE);
+            VerifyOrExit(0 <= parseResult && parseResult <= UINT32_MAX, ret = EXIT_FAILURE);
+            watchdogThreshold = static_cast<uint32_t>(parseResult);
+            break;
+
+        case OTBR_OPT_CONFIG_FILE:
+            configFile = optarg;
+            break;
+
+        case OTBR_OPT_HANDOVER_SOCKET:
+            handoverSocket = optarg;
+            break;
+
+        case OTBR_OPT_MAINLOOP_CPUS:
+            VerifyOrExit(otbr::ThreadScheduling::ParseCpuList(optarg, schedulingConfig.mMainloopCpus),
+                         ret = EXIT_FAILURE);
+            break;
+
+        case OTBR_OPT_MAINLOOP_RT_PRIORITY:
+            VerifyOrExit(ParseInteger(optarg, parseResult), ret = EXIT_FAILURE);
+            VerifyOrExit(0 <= parseResult && parseResult <= INT_MAX, ret = EXIT_FAILURE);
+            schedulingConfig.mMainloopRealtimePriority = static_cast<int>(parseResult);
+            break;
+
+        case OTBR_OPT_MAINLOOP_NICE:
+            VerifyOrExit(ParseInteger(optarg, parseResult), ret = EXIT_FAILURE);
+            VerifyOrExit(INT_MIN <= parseResult && parseResult <= INT_MAX, ret = EXIT_FAILURE);
+            schedulingConfig.mMainloopNice = static_cast<int>(parseResult);
+            break;
+
+        case OTBR_OPT_MANAGEMENT_NICE:
+            VerifyOrExit(ParseInteger(optarg, parseResult), ret = EXIT_FAILURE);
+            VerifyOrExit(INT_MIN <= parseResult && parseResult <= INT_MAX, ret = EXIT_FAILURE);
+            schedulingConfig.mManagementNice = static_cast<int>(parseResult);
+            break;
+
         default:
             PrintHelp(argv[0]);
             ExitNow(ret = EXIT_FAILURE);
@@ -283,6 +523,41 @@ static int realmain(int argc, char *argv[])
     }
 
     otbrLogInit(argv[0], logLevel, verbose, syslogDisable);
+
+    optionConfig.mLogLevel          = logLevel;
+    optionConfig.mRestListenAddress = restListenAddress;
+    optionConfig.mRestListenPort    = restListenPort;
+    optionConfig.mBackboneInterfaceNames.assign(backboneInterfaceNames.begin(), backboneInterfaceNames.end());
+
+    for (const char *logTagLevel : logTagLevels)
+    {
+        VerifyOrExit(ParseLogTagLevel(logTagLevel, optionConfig.mLogTagLevels),
+                     otbrLogErr("Invalid log tag level: %s", logTagLevel), ret = EXIT_FAILURE);
+    }
+
+    // The config file settings override the options, at start as on every reload.
+    config = optionConfig;
+    if (configFile != nullptr)
+    {
+        VerifyOrExit(LoadConfigFile(configFile, config) == OTBR_ERROR_NONE, ret = EXIT_FAILURE);
+    }
+
+    otbrLogSetLevel(config.mLogLevel);
+    for (const auto &tagLevel : config.mLogTagLevels)
+    {
+        VerifyOrExit(otbrLogSetTagLevel(tagLevel.first.c_str(), tagLevel.second) == OTBR_ERROR_NONE,
+                     ret = EXIT_FAILURE);
+    }
+
+    backboneInterfaceNames.clear();
+    for (const std::string &name : config.mBackboneInterfaceNames)
+    {
+        backboneInterfaceNames.push_back(name.c_str());
+    }
+
+    otbr::StartupTiming::Get().Mark(otbr::StartupTiming::kPhaseLoggingReady);
+
+    otbrLogSetAsyncEnabled(true);
     otbrLogNotice("Running %s", OTBR_PACKAGE_VERSION);
     otbrLogNotice("Thread version: %s", otbr::Ncp::RcpHost::GetThreadVersion());
     otbrLogNotice("Thread interface: %s", interfaceName);
@@ -304,9 +579,59 @@ static int realmain(int argc, char *argv[])
         assert(false);
     }
 
+#if OTBR_ENABLE_DBUS_SERVER
+    if (dbusTraceInterval != 0)
     {
-        otbr::Application app(interfaceName, backboneInterfaceNames, radioUrls, enableAutoAttach, restListenAddress,
-                              restListenPort);
+        otbr::DBus::DBusMessageTracer::Get().Configure(
+            dbusTraceInterval, dbusTraceMaxLength < 0 ? otbr::DBus::DBusMessageTracer::kDefaultMaxDumpLength
+                                                      : static_cast<size_t>(dbusTraceMaxLength));
+    }
+#else
+    OTBR_UNUSED_VARIABLE(dbusTraceInterval);
+    OTBR_UNUSED_VARIABLE(dbusTraceMaxLength);
+#endif
+
+    // This thread runs the mainloop, the management threads started later reset the settings they inherit.
+    VerifyOrExit(otbr::ThreadScheduling::Get().ApplyToMainloopThread(schedulingConfig) == OTBR_ERROR_NONE,
+                 ret = EXIT_FAILURE);
+
+    if (watchdogThreshold != 0)
+    {
+        otbr::MainloopWatchdog::Get().Start(otbr::Milliseconds(watchdogThreshold));
+    }
+
+    {
+        std::unique_ptr<otbr::Handover> handover;
+        otbr::Handover::State           handoverState;
+
+        // The running agent must have released the radio before this agent opens it.
+        if (handoverSocket != nullptr)
+        {
+            otbrError error;
+
+            handover = otbr::MakeUnique<otbr::Handover>(handoverSocket);
+            error = handover->Receive(handoverState, otbr::Milliseconds(kHandoverTimeoutMs));
+            VerifyOrExit(error == OTBR_ERROR_NONE || error == OTBR_ERROR_NOT_FOUND, ret = EXIT_FAILURE);
+        }
+
+        otbr::Application app(interfaceName, backboneInterfaceNames, radioUrls, enableAutoAttach,
+                              config.mRestListenAddress, config.mRestListenPort, restMaxConnections, restUnixSocket);
+
+        if (handover != nullptr)
+        {
+            app.SetHandover(*handover, std::move(handoverState));
+        }
+
+        app.SetConfigLoader([&optionConfig, configFile](otbr::Application::ReloadableConfig &aConfig) {
+            otbrError error = OTBR_ERROR_NONE;
+
+            aConfig = optionConfig;
+            if (configFile != nullptr)
+            {
+                error = LoadConfigFile(configFile, aConfig);
+            }
+            return error;
+        });
 
         gApp = &app;
         app.Init();
@@ -316,6 +641,7 @@ static int realmain(int argc, char *argv[])
         app.Deinit();
     }
 
+    otbr::MainloopWatchdog::Get().Stop();
     otbrLogDeinit();
 
 exit:
@@ -344,6 +670,8 @@ void otPlatReset(otInstance *aInstance)
 
 int main(int argc, char *argv[])
 {
+    otbr::StartupTiming::Get().Start();
+
 #ifndef OTBR_ENABLE_PLATFORM_ANDROID
     if (setjmp(sResetJump))
     {
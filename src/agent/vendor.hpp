@@ -37,6 +37,8 @@
 #include "openthread-br/config.h"
 
 #include "agent/application.hpp"
+#include "ncp/rcp_host.hpp"
+#include "utils/counter_history.hpp"
 
 namespace otbr {
 
@@ -46,6 +48,14 @@ namespace vendor {
 
 /**
  * An interface for customized behavior depending on OpenThread API and state.
+ *
+ * The vendor server lives on the mainloop thread like the built-in servers, so it uses the OpenThread APIs and the
+ * other servers directly. It should not spin threads of its own:
+ * - A vendor server handling sockets or timers also derives from `MainloopProcessor`, or adds its sockets with
+ *   `MainloopManager::AddFd()`.
+ * - Work is deferred or delayed with the task runner returned by `Ncp::ThreadHost::GetTaskRunner()`, which is also
+ *   the way back to the mainloop for work done on a `WorkerPool`.
+ * - Thread state changes and counter samples are delivered to the handlers below, in place.
  */
 class VendorServer
 {
@@ -70,6 +80,43 @@ public:
      * servers have been created and initialized.
      */
     virtual void Init(void) = 0;
+
+    /**
+     * Deinitializes the vendor server.
+     *
+     * This will be called by `Application::Deinit()` before the built-in servers are stopped.
+     */
+    virtual void Deinit(void) {}
+
+    /**
+     * Returns the Thread state changes the vendor server is interested in.
+     *
+     * This will be called once, after `Init()`.
+     *
+     * @returns The flags passed to `HandleThreadStateChanged()`, none by default.
+     */
+    virtual otChangedFlags GetThreadStateChangedMask(void) const { return 0; }
+
+    /**
+     * Handles Thread state changes.
+     *
+     * This will be called on the mainloop when any of the flags returned by `GetThreadStateChangedMask()` changed.
+     *
+     * @param[in] aSnapshot  The Thread state, which is only valid during the call.
+     */
+    virtual void HandleThreadStateChanged(const Ncp::ThreadStateSnapshot &aSnapshot)
+    {
+        OTBR_UNUSED_VARIABLE(aSnapshot);
+    }
+
+    /**
+     * Handles a new sample of the Thread interface and neighbor counters.
+     *
+     * This will be called on the mainloop every `OTBR_CONFIG_COUNTER_HISTORY_SAMPLE_INTERVAL`.
+     *
+     * @param[in] aHistory  The history of the counters, which is only valid during the call.
+     */
+    virtual void HandleCountersSampled(const agent::CounterHistory &aHistory) { OTBR_UNUSED_VARIABLE(aHistory); }
 };
 
 } // namespace vendor
@@ -43,6 +43,7 @@
 #include <openthread/backbone_router_ftd.h>
 
 #include "common/code_utils.hpp"
+#include "common/time.hpp"
 
 namespace otbr {
 namespace BackboneRouter {
@@ -51,8 +52,8 @@ BackboneAgent::BackboneAgent(otbr::Ncp::RcpHost &aHost, std::string aInterfaceNa
     : mHost(aHost)
     , mBackboneRouterState(OT_BACKBONE_ROUTER_STATE_DISABLED)
 #if OTBR_ENABLE_DUA_ROUTING
-    , mNdProxyManager(aHost, aBackboneInterfaceName)
-    , mDuaRoutingManager(aInterfaceName, aBackboneInterfaceName)
+    , mNdProxyManager(aHost, aBackboneInterfaceName, mStats)
+    , mDuaRoutingManager(aInterfaceName, aBackboneInterfaceName, mStats)
 #endif
 {
     OTBR_UNUSED_VARIABLE(aInterfaceName);
@@ -61,7 +62,9 @@ BackboneAgent::BackboneAgent(otbr::Ncp::RcpHost &aHost, std::string aInterfaceNa
 
 void BackboneAgent::Init(void)
 {
-    mHost.AddThreadStateChangedCallback([this](otChangedFlags aFlags) { HandleThreadStateChanged(aFlags); });
+    mHost.AddThreadStateChangedCallback(
+        OT_CHANGED_THREAD_BACKBONE_ROUTER_STATE,
+        [this](const Ncp::ThreadStateSnapshot &aSnapshot) { HandleBackboneRouterState(aSnapshot.mBackboneRouterState); });
     otBackboneRouterSetDomainPrefixCallback(mHost.GetInstance(), &BackboneAgent::HandleBackboneRouterDomainPrefixEvent,
                                             this);
 #if OTBR_ENABLE_DUA_ROUTING
@@ -74,24 +77,15 @@ void BackboneAgent::Init(void)
 #endif
 }
 
-void BackboneAgent::HandleThreadStateChanged(otChangedFlags aFlags)
+void BackboneAgent::HandleBackboneRouterState(otBackboneRouterState aState)
 {
-    if (aFlags & OT_CHANGED_THREAD_BACKBONE_ROUTER_STATE)
-    {
-        HandleBackboneRouterState();
-    }
-}
-
-void BackboneAgent::HandleBackboneRouterState(void)
-{
-    otBackboneRouterState state      = otBackboneRouterGetState(mHost.GetInstance());
-    bool                  wasPrimary = (mBackboneRouterState == OT_BACKBONE_ROUTER_STATE_PRIMARY);
+    bool wasPrimary = (mBackboneRouterState == OT_BACKBONE_ROUTER_STATE_PRIMARY);
 
-    otbrLogDebug("BackboneAgent: HandleBackboneRouterState: state=%d, mBackboneRouterState=%d", state,
+    otbrLogDebug("BackboneAgent: HandleBackboneRouterState: state=%d, mBackboneRouterState=%d", aState,
                  mBackboneRouterState);
-    VerifyOrExit(mBackboneRouterState != state);
+    VerifyOrExit(mBackboneRouterState != aState);
 
-    mBackboneRouterState = state;
+    mBackboneRouterState = aState;
 
     if (IsPrimary())
     {
@@ -101,6 +95,12 @@ void BackboneAgent::HandleBackboneRouterState(void)
     {
         OnResignPrimary();
     }
+#if OTBR_ENABLE_DUA_ROUTING
+    else
+    {
+        UpdateWarmSecondary();
+    }
+#endif
 
 exit:
     return;
@@ -108,25 +108,35 @@ exit:
 
 void BackboneAgent::OnBecomePrimary(void)
 {
+    Timepoint start = Clock::now();
+
     otbrLogNotice("BackboneAgent: Backbone Router becomes Primary!");
 
 #if OTBR_ENABLE_DUA_ROUTING
     if (mDomainPrefix.IsValid())
     {
+        // Only switches the routes and the ND Proxy on if they were prepared as a warm Secondary.
         mDuaRoutingManager.Enable(mDomainPrefix);
         mNdProxyManager.Enable(mDomainPrefix);
     }
 #endif
+
+    mStats.mBecomePrimaryCount++;
+    mStats.mBecomePrimaryTime.Record(std::chrono::duration_cast<Microseconds>(Clock::now() - start));
 }
 
 void BackboneAgent::OnResignPrimary(void)
 {
+    Timepoint start = Clock::now();
+
     otbrLogNotice("BackboneAgent: Backbone Router resigns Primary to %s!", StateToString(mBackboneRouterState));
 
 #if OTBR_ENABLE_DUA_ROUTING
-    mDuaRoutingManager.Disable();
-    mNdProxyManager.Disable();
+    UpdateWarmSecondary();
 #endif
+
+    mStats.mResignPrimaryCount++;
+    mStats.mResignPrimaryTime.Record(std::chrono::duration_cast<Microseconds>(Clock::now() - start));
 }
 
 const char *BackboneAgent::StateToString(otBackboneRouterState aState)
@@ -170,6 +180,13 @@ void BackboneAgent::HandleBackboneRouterDomainPrefixEvent(otBackboneRouterDomain
         assert(mDomainPrefix.IsValid());
     }
 
+#if OTBR_ENABLE_DUA_ROUTING
+    if (!IsPrimary())
+    {
+        UpdateWarmSecondary();
+    }
+#endif
+
     VerifyOrExit(IsPrimary() && aEvent != OT_BACKBONE_ROUTER_DOMAIN_PREFIX_REMOVED);
 
 #if OTBR_ENABLE_DUA_ROUTING
@@ -185,6 +202,27 @@ exit:
 }
 
 #if OTBR_ENABLE_DUA_ROUTING
+bool BackboneAgent::IsWarmSecondary(void) const
+{
+    return OTBR_ENABLE_BACKBONE_ROUTER_WARM_SECONDARY && mBackboneRouterState == OT_BACKBONE_ROUTER_STATE_SECONDARY &&
+           mDomainPrefix.IsValid();
+}
+
+void BackboneAgent::UpdateWarmSecondary(void)
+{
+    if (IsWarmSecondary())
+    {
+        // Keep the sockets, the NFQUEUE and the routes ready so that becoming Primary is a quick switch.
+        mDuaRoutingManager.Prepare(mDomainPrefix);
+        mNdProxyManager.Prepare(mDomainPrefix);
+    }
+    else
+    {
+        mDuaRoutingManager.Disable();
+        mNdProxyManager.Disable();
+    }
+}
+
 void BackboneAgent::HandleBackboneRouterNdProxyEvent(void                        *aContext,
                                                      otBackboneRouterNdProxyEvent aEvent,
                                                      const otIp6Address          *aAddress)
@@ -194,6 +232,22 @@ void BackboneAgent::HandleBackboneRouterNdProxyEvent(void
 
 void BackboneAgent::HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEvent aEvent, const otIp6Address *aDua)
 {
+    switch (aEvent)
+    {
+    case OT_BACKBONE_ROUTER_NDPROXY_ADDED:
+        mStats.mDuaAddedEvents++;
+        break;
+    case OT_BACKBONE_ROUTER_NDPROXY_RENEWED:
+        mStats.mDuaRenewedEvents++;
+        break;
+    case OT_BACKBONE_ROUTER_NDPROXY_REMOVED:
+        mStats.mDuaRemovedEvents++;
+        break;
+    case OT_BACKBONE_ROUTER_NDPROXY_CLEARED:
+        mStats.mDuaClearedEvents++;
+        break;
+    }
+
     mNdProxyManager.HandleBackboneRouterNdProxyEvent(aEvent, aDua);
 }
 #endif
@@ -44,6 +44,7 @@
 
 #include <openthread/backbone_router_ftd.h>
 
+#include "backbone_router/backbone_stats.hpp"
 #include "backbone_router/dua_routing_manager.hpp"
 #include "backbone_router/nd_proxy.hpp"
 #include "common/code_utils.hpp"
@@ -81,18 +82,26 @@ public:
      */
     void Init(void);
 
+    /**
+     * This method returns the Backbone Router statistics.
+     *
+     * @returns The Backbone Router statistics.
+     */
+    const BackboneRouterStats &GetStats(void) const { return mStats; }
+
 private:
     void        OnBecomePrimary(void);
     void        OnResignPrimary(void);
     bool        IsPrimary(void) const { return mBackboneRouterState == OT_BACKBONE_ROUTER_STATE_PRIMARY; }
-    void        HandleThreadStateChanged(otChangedFlags aFlags);
-    void        HandleBackboneRouterState(void);
+    void        HandleBackboneRouterState(otBackboneRouterState aState);
     static void HandleBackboneRouterDomainPrefixEvent(void                             *aContext,
                                                       otBackboneRouterDomainPrefixEvent aEvent,
                                                       const otIp6Prefix                *aDomainPrefix);
     void        HandleBackboneRouterDomainPrefixEvent(otBackboneRouterDomainPrefixEvent aEvent,
                                                       const otIp6Prefix                *aDomainPrefix);
 #if OTBR_ENABLE_DUA_ROUTING
+    bool        IsWarmSecondary(void) const;
+    void        UpdateWarmSecondary(void);
     static void HandleBackboneRouterNdProxyEvent(void                        *aContext,
                                                  otBackboneRouterNdProxyEvent aEvent,
                                                  const otIp6Address          *aAddress);
@@ -104,6 +113,7 @@ private:
     otbr::Ncp::RcpHost   &mHost;
     otBackboneRouterState mBackboneRouterState;
     Ip6Prefix             mDomainPrefix;
+    BackboneRouterStats   mStats;
 #if OTBR_ENABLE_DUA_ROUTING
     NdProxyManager    mNdProxyManager;
     DuaRoutingManager mDuaRoutingManager;
@@ -0,0 +1,83 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file defines the statistics of the Backbone Router.
+ */
+
+#ifndef BACKBONE_ROUTER_BACKBONE_STATS_HPP_
+#define BACKBONE_ROUTER_BACKBONE_STATS_HPP_
+
+#include <stdint.h>
+
+#include "common/mainloop_stats.hpp"
+
+namespace otbr {
+namespace BackboneRouter {
+
+/**
+ * This structure represents the counters and latency histograms of the Backbone Router.
+ */
+struct BackboneRouterStats
+{
+    BackboneRouterStats(void)
+        : mNsReceived(0)
+        , mNsAnswered(0)
+        , mNsDropped(0)
+        , mDuaAddedEvents(0)
+        , mDuaRenewedEvents(0)
+        , mDuaRemovedEvents(0)
+        , mDuaClearedEvents(0)
+        , mBecomePrimaryCount(0)
+        , mResignPrimaryCount(0)
+    {
+    }
+
+    uint64_t mNsReceived; ///< The number of Neighbor Solicitations received by the ND Proxy.
+    uint64_t mNsAnswered; ///< The number of Neighbor Solicitations answered with a Neighbor Advertisement.
+    uint64_t mNsDropped;  ///< The number of Neighbor Solicitations ignored, e.g. for a target which is not proxied.
+
+    uint64_t mDuaAddedEvents;   ///< The number of DUAs added to the ND Proxy table.
+    uint64_t mDuaRenewedEvents; ///< The number of DUAs renewed in the ND Proxy table.
+    uint64_t mDuaRemovedEvents; ///< The number of DUAs removed from the ND Proxy table.
+    uint64_t mDuaClearedEvents; ///< The number of times the ND Proxy table is cleared.
+
+    uint32_t mBecomePrimaryCount; ///< The number of transitions to the Primary state.
+    uint32_t mResignPrimaryCount; ///< The number of transitions from the Primary state.
+
+    DurationHistogram mNfqVerdictLatency;    ///< The time from receiving an NFQUEUE packet to sending its verdict.
+    DurationHistogram mRouteProgrammingTime; ///< The time spent on programming DUA routes and rules.
+    DurationHistogram mBecomePrimaryTime;    ///< The time spent on enabling DUA routing and ND Proxy as Primary.
+    DurationHistogram mResignPrimaryTime;    ///< The time spent on disabling DUA routing and ND Proxy.
+};
+
+} // namespace BackboneRouter
+} // namespace otbr
+
+#endif // BACKBONE_ROUTER_BACKBONE_STATS_HPP_
@@ -54,6 +54,7 @@ namespace BackboneRouter {
 enum
 {
     kDuaRecentTime = 20, ///< Time period (in seconds) during which a DUA registration is considered 'recent' at a BBR.
+    kOpenThreadRouteTable = 88, ///< The id of the "openthread" routing table, see `script/_rt_tables`.
 };
 
 /**
@@ -35,63 +35,127 @@
 
 #if OTBR_ENABLE_DUA_ROUTING
 
+#include "backbone_router/constants.hpp"
 #include "common/code_utils.hpp"
+#include "common/time.hpp"
 
 namespace otbr {
 
 namespace BackboneRouter {
 
+void DuaRoutingManager::Prepare(const Ip6Prefix &aDomainPrefix)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    if (mPrepared && mDomainPrefix != aDomainPrefix)
+    {
+        Disable();
+    }
+
+    if (mEnabled)
+    {
+        mEnabled = false;
+        DelDefaultRouteToThread();
+        DelPolicyRuleToBackbone();
+    }
+
+    if (!mPrepared)
+    {
+        mPrepared     = true;
+        mDomainPrefix = aDomainPrefix;
+
+        // The route in the "openthread" table is not used until the policy rule is added.
+        AddPolicyRouteToBackbone();
+    }
+
+    error = CommitRoutes();
+
+    otbrLogResult(error, "DuaRoutingManager: %s", __FUNCTION__);
+}
+
 void DuaRoutingManager::Enable(const Ip6Prefix &aDomainPrefix)
 {
-    VerifyOrExit(!mEnabled);
-    mEnabled = true;
+    otbrError error = OTBR_ERROR_NONE;
 
-    mDomainPrefix = aDomainPrefix;
+    VerifyOrExit(!mEnabled || mDomainPrefix != aDomainPrefix);
+
+    Prepare(aDomainPrefix);
+    mEnabled = true;
 
     AddDefaultRouteToThread();
-    AddPolicyRouteToBackbone();
+    AddPolicyRuleToBackbone();
+    error = CommitRoutes();
 
 exit:
-    otbrLogResult(OTBR_ERROR_NONE, "DuaRoutingManager: %s", __FUNCTION__);
+    otbrLogResult(error, "DuaRoutingManager: %s", __FUNCTION__);
 }
 
 void DuaRoutingManager::Disable(void)
 {
-    VerifyOrExit(mEnabled);
-    mEnabled = false;
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mPrepared);
+    mPrepared = false;
+
+    if (mEnabled)
+    {
+        mEnabled = false;
+        DelDefaultRouteToThread();
+        DelPolicyRuleToBackbone();
+    }
 
-    DelDefaultRouteToThread();
     DelPolicyRouteToBackbone();
+    error = CommitRoutes();
 
 exit:
-    otbrLogResult(OTBR_ERROR_NONE, "DuaRoutingManager: %s", __FUNCTION__);
+    otbrLogResult(error, "DuaRoutingManager: %s", __FUNCTION__);
 }
 
 void DuaRoutingManager::AddDefaultRouteToThread(void)
 {
-    SystemUtils::ExecuteCommand("ip -6 route add %s dev %s proto static metric 1", mDomainPrefix.ToString().c_str(),
-                                mInterfaceName.c_str());
+    mNetlink.QueueRoute(/* aIsAdd */ true, mDomainPrefix, mInterfaceName, RT_TABLE_MAIN, /* aMetric */ 1);
 }
 
 void DuaRoutingManager::DelDefaultRouteToThread(void)
 {
-    SystemUtils::ExecuteCommand("ip -6 route del %s dev %s proto static metric 1", mDomainPrefix.ToString().c_str(),
-                                mInterfaceName.c_str());
+    mNetlink.QueueRoute(/* aIsAdd */ false, mDomainPrefix, mInterfaceName, RT_TABLE_MAIN, /* aMetric */ 1);
 }
 
-void DuaRoutingManager::AddPolicyRouteToBackbone(void)
+void DuaRoutingManager::AddPolicyRuleToBackbone(void)
 {
     // Packets from Thread interface use route table "openthread"
-    SystemUtils::ExecuteCommand("ip -6 rule add iif %s table openthread", mInterfaceName.c_str());
-    SystemUtils::ExecuteCommand("ip -6 route add %s dev %s proto static table openthread",
-                                mDomainPrefix.ToString().c_str(), mBackboneInterfaceName.c_str());
+    mNetlink.QueueRule(/* aIsAdd */ true, mInterfaceName, kOpenThreadRouteTable);
+}
+
+void DuaRoutingManager::DelPolicyRuleToBackbone(void)
+{
+    mNetlink.QueueRule(/* aIsAdd */ false, mInterfaceName, kOpenThreadRouteTable);
+}
+
+void DuaRoutingManager::AddPolicyRouteToBackbone(void)
+{
+    mNetlink.QueueRoute(/* aIsAdd */ true, mDomainPrefix, mBackboneInterfaceName, kOpenThreadRouteTable,
+                        /* aMetric */ 0);
 }
 
 void DuaRoutingManager::DelPolicyRouteToBackbone(void)
 {
-    SystemUtils::ExecuteCommand("ip -6 rule del iif %s table openthread", mInterfaceName.c_str());
-    SystemUtils::ExecuteCommand("ip -6 route del %s dev %s proto static table openthread",
-                                mDomainPrefix.ToString().c_str(), mBackboneInterfaceName.c_str());
+    mNetlink.QueueRoute(/* aIsAdd */ false, mDomainPrefix, mBackboneInterfaceName, kOpenThreadRouteTable,
+                        /* aMetric */ 0);
+}
+
+otbrError DuaRoutingManager::CommitRoutes(void)
+{
+    Timepoint start = Clock::now();
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mNetlink.HasPendingRequests());
+
+    error = mNetlink.Commit();
+    mStats.mRouteProgrammingTime.Record(std::chrono::duration_cast<Microseconds>(Clock::now() - start));
+
+exit:
+    return error;
 }
 
 } // namespace BackboneRouter
@@ -42,9 +42,10 @@
 #include <utility>
 #include <openthread/backbone_router_ftd.h>
 
+#include "backbone_router/backbone_stats.hpp"
 #include "common/code_utils.hpp"
 #include "ncp/rcp_host.hpp"
-#include "utils/system_utils.hpp"
+#include "utils/netlink_route.hpp"
 
 namespace otbr {
 namespace BackboneRouter {
@@ -66,34 +67,58 @@ class DuaRoutingManager : private NonCopyable
 public:
     /**
      * This constructor initializes a DUA routing manager instance.
+     *
+     * @param[in] aInterfaceName          The name of the Thread interface.
+     * @param[in] aBackboneInterfaceName  The name of the backbone interface.
+     * @param[in] aStats                  The Backbone Router statistics to update.
      */
-    explicit DuaRoutingManager(std::string aInterfaceName, std::string aBackboneInterfaceName)
-        : mEnabled(false)
+    DuaRoutingManager(std::string aInterfaceName, std::string aBackboneInterfaceName, BackboneRouterStats &aStats)
+        : mPrepared(false)
+        , mEnabled(false)
         , mInterfaceName(std::move(aInterfaceName))
         , mBackboneInterfaceName(std::move(aBackboneInterfaceName))
+        , mStats(aStats)
     {
     }
 
     /**
-     * This method enables the DUA routing manager.
+     * This method prepares the DUA routing manager without routing any DUA.
+     *
+     * The route to the backbone is added to the "openthread" table, which is not used until `Enable()` adds the
+     * policy rule. An enabled DUA routing manager is deactivated but stays prepared.
+     *
+     * @param[in] aDomainPrefix  The Domain Prefix.
+     */
+    void Prepare(const Ip6Prefix &aDomainPrefix);
+
+    /**
+     * This method enables the DUA routing manager, preparing it first if needed.
+     *
+     * @param[in] aDomainPrefix  The Domain Prefix.
      */
     void Enable(const Ip6Prefix &aDomainPrefix);
 
     /**
-     * This method disables the DUA routing manager.
+     * This method disables the DUA routing manager and removes all the prepared routes.
      */
     void Disable(void);
 
 private:
-    void AddDefaultRouteToThread(void);
-    void DelDefaultRouteToThread(void);
-    void AddPolicyRouteToBackbone(void);
-    void DelPolicyRouteToBackbone(void);
-
-    Ip6Prefix   mDomainPrefix;
-    bool        mEnabled : 1;
-    std::string mInterfaceName;
-    std::string mBackboneInterfaceName;
+    void      AddDefaultRouteToThread(void);
+    void      DelDefaultRouteToThread(void);
+    void      AddPolicyRuleToBackbone(void);
+    void      DelPolicyRuleToBackbone(void);
+    void      AddPolicyRouteToBackbone(void);
+    void      DelPolicyRouteToBackbone(void);
+    otbrError CommitRoutes(void);
+
+    Ip6Prefix                 mDomainPrefix;
+    bool                      mPrepared : 1;
+    bool                      mEnabled : 1;
+    std::string               mInterfaceName;
+    std::string               mBackboneInterfaceName;
+    BackboneRouterStats      &mStats;
+    Utils::NetlinkRouteSocket mNetlink;
 };
 
 /**
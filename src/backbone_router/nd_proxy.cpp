@@ -40,10 +40,13 @@
 #include <openthread/backbone_router_ftd.h>
 
 #include <assert.h>
+#include <errno.h>
 #include <net/if.h>
 #include <netinet/icmp6.h>
 #include <netinet/ip6.h>
+#include <stdio.h>
 #include <sys/ioctl.h>
+#include <sys/socket.h>
 #include <unistd.h>
 
 #if __linux__
@@ -55,31 +58,49 @@
 #include "backbone_router/constants.hpp"
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/time.hpp"
 #include "common/types.hpp"
 #include "utils/system_utils.hpp"
 
 namespace otbr {
 namespace BackboneRouter {
 
-void NdProxyManager::Enable(const Ip6Prefix &aDomainPrefix)
+void NdProxyManager::Prepare(const Ip6Prefix &aDomainPrefix)
 {
     otbrError error = OTBR_ERROR_NONE;
 
-    VerifyOrExit(!IsEnabled());
-
     assert(aDomainPrefix.IsValid());
+
+    if (IsPrepared() && mDomainPrefix != aDomainPrefix)
+    {
+        Disable();
+    }
+
+    if (IsEnabled())
+    {
+        Deactivate();
+    }
+
+    VerifyOrExit(!IsPrepared());
+
     mDomainPrefix = aDomainPrefix;
 
+    // The socket passes no NS until the ND Proxy is activated.
     SuccessOrExit(error = InitIcmp6RawSocket());
     SuccessOrExit(error = UpdateMacAddress());
-    SuccessOrExit(error = InitNetfilterQueue());
 
-    // Add ip6tables rule for unicast ICMPv6 messages
-    VerifyOrExit(SystemUtils::ExecuteCommand(
-                     "ip6tables -t raw -A PREROUTING -6 -d %s -p icmpv6 --icmpv6-type neighbor-solicitation -i %s -j "
-                     "NFQUEUE --queue-num 88",
-                     mDomainPrefix.ToString().c_str(), mBackboneInterfaceName.c_str()) == 0,
-                 error = OTBR_ERROR_ERRNO);
+    // The new socket holds no memberships yet.
+    mPendingGroupChanges.clear();
+    for (const auto &group : mSolicitedNodeGroups)
+    {
+        mPendingGroupChanges[group.first] = true;
+    }
+
+#if !OTBR_ENABLE_ND_PROXY_KERNEL_OFFLOAD
+    // Unicast NS queued before the activation are accepted right away, see `HandleNetfilterQueue()`.
+    SuccessOrExit(error = InitNetfilterQueue());
+    SuccessOrExit(error = AddNetfilterRule());
+#endif
 
 exit:
     if (error != OTBR_ERROR_NONE)
@@ -91,37 +112,197 @@ exit:
     otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
 }
 
+void NdProxyManager::Enable(const Ip6Prefix &aDomainPrefix)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(!IsEnabled() || mDomainPrefix != aDomainPrefix);
+
+    Prepare(aDomainPrefix);
+    VerifyOrExit(IsPrepared(), error = OTBR_ERROR_INVALID_STATE);
+
+    SuccessOrExit(error = SetNeighborSolicitFilter(/* aPass */ true));
+#if OTBR_ENABLE_ND_PROXY_KERNEL_OFFLOAD
+    SuccessOrExit(error = EnableKernelProxy());
+#endif
+
+    mIsActive = true;
+
+exit:
+    otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
+}
+
+void NdProxyManager::Deactivate(void)
+{
+    // Leave the groups joined on the socket, and keep the references so they are joined again on activation.
+    for (const auto &change : mPendingGroupChanges)
+    {
+        if (!change.second)
+        {
+            UpdateSolicitedNodeGroupMembership(change.first, /* aJoin */ false);
+        }
+    }
+
+    for (const auto &group : mSolicitedNodeGroups)
+    {
+        if (mPendingGroupChanges.find(group.first) == mPendingGroupChanges.end())
+        {
+            UpdateSolicitedNodeGroupMembership(group.first, /* aJoin */ false);
+        }
+    }
+
+    mPendingGroupChanges.clear();
+    for (const auto &group : mSolicitedNodeGroups)
+    {
+        mPendingGroupChanges[group.first] = true;
+    }
+
+    FlushNeighborAdvertisements();
+    FlushVerdicts();
+
+#if OTBR_ENABLE_ND_PROXY_KERNEL_OFFLOAD
+    DisableKernelProxy();
+#endif
+    SetNeighborSolicitFilter(/* aPass */ false);
+
+    mIsActive = false;
+
+    otbrLogInfo("NdProxyManager: Deactivated");
+}
+
 void NdProxyManager::Disable(void)
 {
     otbrError error = OTBR_ERROR_NONE;
 
-    VerifyOrExit(IsEnabled());
+    VerifyOrExit(IsPrepared());
 
+#if OTBR_ENABLE_ND_PROXY_KERNEL_OFFLOAD
+    if (IsEnabled())
+    {
+        DisableKernelProxy();
+    }
+    FiniIcmp6RawSocket();
+#else
     FiniNetfilterQueue();
     FiniIcmp6RawSocket();
+    error = RemoveNetfilterRule();
+#endif
 
-    // Remove ip6tables rule for unicast ICMPv6 messages
-    VerifyOrExit(SystemUtils::ExecuteCommand(
-                     "ip6tables -t raw -D PREROUTING -6 -d %s -p icmpv6 --icmpv6-type neighbor-solicitation -i %s -j "
-                     "NFQUEUE --queue-num 88",
-                     mDomainPrefix.ToString().c_str(), mBackboneInterfaceName.c_str()) == 0,
-                 error = OTBR_ERROR_ERRNO);
+    mIsActive = false;
 
 exit:
     otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
 }
 
+NdProxyManager::~NdProxyManager(void)
+{
+#if OTBR_ENABLE_ND_PROXY_NFTABLES
+    if (mNftContext != nullptr)
+    {
+        nft_ctx_free(mNftContext);
+    }
+#endif
+}
+
 void NdProxyManager::Init(void)
 {
     mBackboneIfIndex = if_nametoindex(mBackboneInterfaceName.c_str());
     VerifyOrDie(mBackboneIfIndex > 0, "if_nametoindex failed");
+
+#if OTBR_ENABLE_ND_PROXY_NFTABLES
+    mNftContext = nft_ctx_new(NFT_CTX_DEFAULT);
+    VerifyOrDie(mNftContext != nullptr, "nft_ctx_new failed");
+    VerifyOrDie(nft_ctx_buffer_error(mNftContext) == 0, "nft_ctx_buffer_error failed");
+#endif
+}
+
+#if OTBR_ENABLE_ND_PROXY_NFTABLES
+// The NFQUEUE rule lives in a dedicated table. Each command buffer below is applied by the kernel as a single
+// transaction, and "add table" before "delete table" makes the removal succeed whether or not the table exists,
+// so a stale table left by a previous run is replaced rather than duplicated.
+static constexpr char kNftTableCommand[] = "add table ip6 otbr-nd-proxy\n"
+                                           "delete table ip6 otbr-nd-proxy\n";
+
+otbrError NdProxyManager::AddNetfilterRule(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    char      command[512];
+
+    snprintf(command, sizeof(command),
+             "%s"
+             "add table ip6 otbr-nd-proxy\n"
+             "add chain ip6 otbr-nd-proxy prerouting { type filter hook prerouting priority raw; }\n"
+             "add rule ip6 otbr-nd-proxy prerouting iifname \"%s\" ip6 daddr %s icmpv6 type nd-neighbor-solicit "
+             "queue num %d\n",
+             kNftTableCommand, mBackboneInterfaceName.c_str(), mDomainPrefix.ToInfoString().AsCString(),
+             kNetfilterQueueNum);
+
+    if (nft_run_cmd_from_buffer(mNftContext, command) != 0)
+    {
+        otbrLogWarning("NdProxyManager: Failed to add the nftables rule: %s", nft_ctx_get_error_buffer(mNftContext));
+        error = OTBR_ERROR_ERRNO;
+    }
+
+    return error;
 }
 
+otbrError NdProxyManager::RemoveNetfilterRule(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    if (nft_run_cmd_from_buffer(mNftContext, kNftTableCommand) != 0)
+    {
+        otbrLogWarning("NdProxyManager: Failed to remove the nftables rule: %s",
+                       nft_ctx_get_error_buffer(mNftContext));
+        error = OTBR_ERROR_ERRNO;
+    }
+
+    return error;
+}
+#else
+otbrError NdProxyManager::AddNetfilterRule(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    // Add ip6tables rule for unicast ICMPv6 messages
+    VerifyOrExit(SystemUtils::ExecuteCommand(
+                     "ip6tables -t raw -A PREROUTING -6 -d %s -p icmpv6 --icmpv6-type neighbor-solicitation -i %s -j "
+                     "NFQUEUE --queue-num %d",
+                     mDomainPrefix.ToInfoString().AsCString(), mBackboneInterfaceName.c_str(),
+                     kNetfilterQueueNum) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+exit:
+    return error;
+}
+
+otbrError NdProxyManager::RemoveNetfilterRule(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    // Remove ip6tables rule for unicast ICMPv6 messages
+    VerifyOrExit(SystemUtils::ExecuteCommand(
+                     "ip6tables -t raw -D PREROUTING -6 -d %s -p icmpv6 --icmpv6-type neighbor-solicitation -i %s -j "
+                     "NFQUEUE --queue-num %d",
+                     mDomainPrefix.ToInfoString().AsCString(), mBackboneInterfaceName.c_str(),
+                     kNetfilterQueueNum) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+exit:
+    return error;
+}
+#endif // OTBR_ENABLE_ND_PROXY_NFTABLES
+
 void NdProxyManager::Update(MainloopContext &aMainloop)
 {
-    if (mIcmp6RawSock >= 0)
+    if (IsEnabled())
     {
         aMainloop.AddFdToReadSet(mIcmp6RawSock);
+
+        if (!mPendingGroupChanges.empty())
+        {
+            aMainloop.mTimeout = ToTimeval(Microseconds::zero());
+        }
     }
 
     if (mUnicastNsQueueSock >= 0)
@@ -132,59 +313,121 @@ void NdProxyManager::Update(MainloopContext &aMainloop)
 
 void NdProxyManager::Process(const MainloopContext &aMainloop)
 {
-    VerifyOrExit(IsEnabled());
+    VerifyOrExit(IsPrepared());
 
-    if (FD_ISSET(mIcmp6RawSock, &aMainloop.mReadFdSet))
+    if (IsEnabled())
     {
-        ProcessMulticastNeighborSolicition();
+        ApplySolicitedNodeGroupChanges();
+
+        if (FD_ISSET(mIcmp6RawSock, &aMainloop.mReadFdSet))
+        {
+            ProcessMulticastNeighborSolicition();
+        }
     }
 
-    if (FD_ISSET(mUnicastNsQueueSock, &aMainloop.mReadFdSet))
+    if (mUnicastNsQueueSock >= 0 && FD_ISSET(mUnicastNsQueueSock, &aMainloop.mReadFdSet))
     {
         ProcessUnicastNeighborSolicition();
     }
+
+    FlushNeighborAdvertisements();
 exit:
     return;
 }
 
-void NdProxyManager::ProcessMulticastNeighborSolicition()
+void NdProxyManager::ProcessMulticastNeighborSolicition(void)
 {
-    struct msghdr     msghdr;
-    sockaddr_in6      sin6;
-    struct iovec      iovec;
-    ssize_t           len;
-    struct icmp6_hdr *icmp6header;
-    struct cmsghdr   *cmsghdr;
-    unsigned char     cbuf[2 * CMSG_SPACE(sizeof(struct in6_pktinfo))];
-    uint8_t           packet[kMaxICMP6PacketSize];
-    otbrError         error = OTBR_ERROR_NONE;
-    bool              found = false;
+    struct MulticastNsBuffer
+    {
+        sockaddr_in6  mSource;
+        struct iovec  mIovec;
+        unsigned char mControl[2 * CMSG_SPACE(sizeof(struct in6_pktinfo))];
+        uint8_t       mPacket[kMaxICMP6PacketSize];
+    };
+
+    MulticastNsBuffer buffers[kRecvBatchSize];
+    struct mmsghdr    messages[kRecvBatchSize];
+    uint32_t          numProcessed = 0;
+
+    // Drain the socket in batches, but bound the work of one mainloop iteration so that an NS flood
+    // can't starve other processors. Remaining packets keep the socket readable for the next iteration.
+    while (numProcessed < kMaxNsPerIteration)
+    {
+        int numReceived;
+
+        memset(messages, 0, sizeof(messages));
 
-    iovec.iov_len  = kMaxICMP6PacketSize;
-    iovec.iov_base = packet;
+        for (uint32_t i = 0; i < kRecvBatchSize; i++)
+        {
+            buffers[i].mIovec.iov_base = buffers[i].mPacket;
+            buffers[i].mIovec.iov_len  = sizeof(buffers[i].mPacket);
+
+            messages[i].msg_hdr.msg_name       = &buffers[i].mSource;
+            messages[i].msg_hdr.msg_namelen    = sizeof(buffers[i].mSource);
+            messages[i].msg_hdr.msg_iov        = &buffers[i].mIovec;
+            messages[i].msg_hdr.msg_iovlen     = 1;
+            messages[i].msg_hdr.msg_control    = buffers[i].mControl;
+            messages[i].msg_hdr.msg_controllen = sizeof(buffers[i].mControl);
+        }
 
-    msghdr.msg_name       = &sin6;
-    msghdr.msg_namelen    = sizeof(sin6);
-    msghdr.msg_iov        = &iovec;
-    msghdr.msg_iovlen     = 1;
-    msghdr.msg_control    = cbuf;
-    msghdr.msg_controllen = sizeof(cbuf);
+        numReceived = recvmmsg(mIcmp6RawSock, messages, kRecvBatchSize, MSG_DONTWAIT, nullptr);
 
-    len = recvmsg(mIcmp6RawSock, &msghdr, 0);
+        if (numReceived <= 0)
+        {
+            if (numReceived < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            {
+                otbrLogWarning("NdProxyManager: Failed to receive multicast NS: %s", strerror(errno));
+            }
+            break;
+        }
 
-    VerifyOrExit(len >= static_cast<ssize_t>(sizeof(struct icmp6_hdr)), error = OTBR_ERROR_ERRNO);
+        for (int i = 0; i < numReceived; i++)
+        {
+            HandleMulticastNeighborSolicition(buffers[i].mPacket, messages[i].msg_len, messages[i].msg_hdr);
+        }
+
+        numProcessed += static_cast<uint32_t>(numReceived);
+
+        if (numReceived < static_cast<int>(kRecvBatchSize))
+        {
+            break;
+        }
+    }
+}
+
+void NdProxyManager::HandleMulticastNeighborSolicition(const uint8_t *aPacket, size_t aLength, struct msghdr &aMsgHdr)
+{
+    const struct icmp6_hdr *icmp6header;
+    struct cmsghdr         *cmsghdr;
+    otbrError               error             = OTBR_ERROR_NONE;
+    bool                    found             = false;
+    bool                    isNeighborSolicit = false;
+
+    VerifyOrExit(aLength >= sizeof(struct icmp6_hdr), error = OTBR_ERROR_PARSE);
 
     {
-        Ip6Address &src = *reinterpret_cast<Ip6Address *>(&sin6.sin6_addr);
+        const Ip6Address &src = *reinterpret_cast<const Ip6Address *>(
+            &reinterpret_cast<const sockaddr_in6 *>(aMsgHdr.msg_name)->sin6_addr);
 
-        icmp6header = reinterpret_cast<icmp6_hdr *>(packet);
+        icmp6header = reinterpret_cast<const icmp6_hdr *>(aPacket);
 
         // only process neighbor solicit
         VerifyOrExit(icmp6header->icmp6_type == ND_NEIGHBOR_SOLICIT, error = OTBR_ERROR_PARSE);
+        VerifyOrExit(aLength >= sizeof(struct nd_neighbor_solicit), error = OTBR_ERROR_PARSE);
+
+        otbrLogDebug("NdProxyManager: Received ND-NS from %s", src.ToInfoString().AsCString());
+        mStats.mNsReceived++;
+        isNeighborSolicit = true;
 
-        otbrLogDebug("NdProxyManager: Received ND-NS from %s", src.ToString().c_str());
+#if OTBR_ENABLE_ND_PROXY_KERNEL_OFFLOAD
+        // The kernel answers all but DAD NS from its proxy neighbor entries.
+        VerifyOrExit(src.IsUnspecified());
+#endif
 
-        for (cmsghdr = CMSG_FIRSTHDR(&msghdr); cmsghdr; cmsghdr = CMSG_NXTHDR(&msghdr, cmsghdr))
+        const struct nd_neighbor_solicit *ns     = reinterpret_cast<const struct nd_neighbor_solicit *>(aPacket);
+        const Ip6Address                 &target = *reinterpret_cast<const Ip6Address *>(&ns->nd_ns_target);
+
+        for (cmsghdr = CMSG_FIRSTHDR(&aMsgHdr); cmsghdr; cmsghdr = CMSG_NXTHDR(&aMsgHdr, cmsghdr))
         {
             if (cmsghdr->cmsg_level != IPPROTO_IPV6)
             {
@@ -200,17 +443,13 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
                     Ip6Address         &dst     = *reinterpret_cast<Ip6Address *>(&pktinfo->ipi6_addr);
                     uint32_t            ifindex = pktinfo->ipi6_ifindex;
 
-                    for (const Ip6Address &ipaddr : mNdProxySet)
-                    {
-                        if (ipaddr.ToSolicitedNodeMulticastAddress() == dst)
-                        {
-                            found = true;
-                            break;
-                        }
-                    }
-
-                    otbrLogDebug("NdProxyManager: dst=%s, ifindex=%d, proxying=%s", dst.ToString().c_str(), ifindex,
-                                 found ? "Y" : "N");
+                    // The target is looked up in the hashed table, the destination must then be its
+                    // solicited-node multicast address on the backbone interface.
+                    found = ifindex == mBackboneIfIndex && mNdProxySet.find(target) != mNdProxySet.end() &&
+                            target.ToSolicitedNodeMulticastAddress() == dst;
+
+                    otbrLogDebug("NdProxyManager: dst=%s, ifindex=%d, proxying=%s", dst.ToInfoString().AsCString(),
+                                 ifindex, found ? "Y" : "N");
                 }
                 break;
 
@@ -221,7 +460,7 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
 
                     otbrLogDebug("NdProxyManager: hops=%d (%s)", hops, hops == 255 ? "Good" : "Bad");
 
-                    VerifyOrExit(hops == 255);
+                    VerifyOrExit(hops == 255, error = OTBR_ERROR_PARSE);
                 }
                 break;
             }
@@ -229,34 +468,117 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
 
         VerifyOrExit(found, error = OTBR_ERROR_NOT_FOUND);
 
-        {
-            struct nd_neighbor_solicit *ns     = reinterpret_cast<struct nd_neighbor_solicit *>(packet);
-            Ip6Address                 &target = *reinterpret_cast<Ip6Address *>(&ns->nd_ns_target);
-
-            otbrLogInfo("NdProxyManager: send solicited NA for multicast NS: src=%s, target=%s", src.ToString().c_str(),
-                        target.ToString().c_str());
+        otbrLogInfo("NdProxyManager: send solicited NA for multicast NS: src=%s, target=%s",
+                    src.ToInfoString().AsCString(), target.ToInfoString().AsCString());
 
-            SendNeighborAdvertisement(target, src);
-        }
+        SendNeighborAdvertisement(target, src);
+        mStats.mNsAnswered++;
     }
 
 exit:
+    if (isNeighborSolicit && error != OTBR_ERROR_NONE)
+    {
+        mStats.mNsDropped++;
+    }
+
     otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
 }
 
 void NdProxyManager::ProcessUnicastNeighborSolicition(void)
 {
-    otbrError error = OTBR_ERROR_NONE;
-    char      packet[kMaxICMP6PacketSize];
-    ssize_t   len;
+    struct NfqBuffer
+    {
+        struct iovec mIovec;
+        char         mMessage[kMaxNfqMessageSize];
+    };
 
-    VerifyOrExit((len = recv(mUnicastNsQueueSock, packet, sizeof(packet), 0)) >= 0, error = OTBR_ERROR_ERRNO);
-    VerifyOrExit(nfq_handle_packet(mNfqHandler, packet, len) == 0, error = OTBR_ERROR_ERRNO);
+    NfqBuffer      buffers[kRecvBatchSize];
+    struct mmsghdr messages[kRecvBatchSize];
+    uint32_t       numProcessed = 0;
 
-    error = OTBR_ERROR_NONE;
+    while (numProcessed < kMaxNsPerIteration)
+    {
+        int numReceived;
+
+        memset(messages, 0, sizeof(messages));
+
+        for (uint32_t i = 0; i < kRecvBatchSize; i++)
+        {
+            buffers[i].mIovec.iov_base = buffers[i].mMessage;
+            buffers[i].mIovec.iov_len  = sizeof(buffers[i].mMessage);
+
+            messages[i].msg_hdr.msg_iov    = &buffers[i].mIovec;
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        numReceived     = recvmmsg(mUnicastNsQueueSock, messages, kRecvBatchSize, MSG_DONTWAIT, nullptr);
+        mNfqReceiveTime = Clock::now();
+
+        if (numReceived <= 0)
+        {
+            if (numReceived < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            {
+                otbrLogWarning("NdProxyManager: Failed to receive from NFQUEUE: %s", strerror(errno));
+            }
+            break;
+        }
+
+        // The callback only records verdicts, they are sent below in as few batches as possible.
+        for (int i = 0; i < numReceived; i++)
+        {
+            if (nfq_handle_packet(mNfqHandler, buffers[i].mMessage, static_cast<int>(messages[i].msg_len)) != 0)
+            {
+                otbrLogWarning("NdProxyManager: Failed to handle NFQUEUE message");
+            }
+        }
+
+        FlushVerdicts();
+
+        numProcessed += static_cast<uint32_t>(numReceived);
+
+        if (numReceived < static_cast<int>(kRecvBatchSize))
+        {
+            break;
+        }
+    }
+}
+
+void NdProxyManager::QueueVerdict(uint32_t aPacketId, int aVerdict)
+{
+    // A batch verdict applies to every packet up to the given id which has no verdict yet, so the packets
+    // are grouped into runs of the same verdict and only the last id of each run is sent to the kernel.
+    if (mHasPendingVerdict && mPendingVerdict != aVerdict)
+    {
+        FlushVerdicts();
+    }
+
+    mHasPendingVerdict = true;
+    mPendingVerdict    = aVerdict;
+    mPendingVerdictId  = aPacketId;
+    mNumPendingVerdicts++;
+}
+
+void NdProxyManager::FlushVerdicts(void)
+{
+    Microseconds latency;
+
+    VerifyOrExit(mHasPendingVerdict);
+
+    mHasPendingVerdict = false;
+
+    if (nfq_set_verdict_batch(mNfqQueueHandler, mPendingVerdictId, mPendingVerdict) < 0)
+    {
+        otbrLogWarning("NdProxyManager: Failed to set verdict %d up to packet %u", mPendingVerdict, mPendingVerdictId);
+    }
+
+    latency = std::chrono::duration_cast<Microseconds>(Clock::now() - mNfqReceiveTime);
+    for (; mNumPendingVerdicts > 0; mNumPendingVerdicts--)
+    {
+        mStats.mNfqVerdictLatency.Record(latency);
+    }
 
 exit:
-    otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
+    return;
 }
 
 void NdProxyManager::HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEvent aEvent, const otIp6Address *aDua)
@@ -278,71 +600,199 @@ void NdProxyManager::HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEve
 
         if (isNewInsert)
         {
-            JoinSolicitedNodeMulticastGroup(target);
+            AddSolicitedNodeGroupRef(target);
+#if OTBR_ENABLE_ND_PROXY_KERNEL_OFFLOAD
+            UpdateKernelProxy(/* aIsAdd */ true, target);
+#endif
         }
 
         SendNeighborAdvertisement(target, Ip6Address::GetLinkLocalAllNodesMulticastAddress());
+        FlushNeighborAdvertisements();
         break;
     }
     case OT_BACKBONE_ROUTER_NDPROXY_REMOVED:
-        mNdProxySet.erase(target);
-        LeaveSolicitedNodeMulticastGroup(target);
+        if (mNdProxySet.erase(target) != 0)
+        {
+            RemoveSolicitedNodeGroupRef(target);
+        }
+#if OTBR_ENABLE_ND_PROXY_KERNEL_OFFLOAD
+        UpdateKernelProxy(/* aIsAdd */ false, target);
+#endif
         break;
     case OT_BACKBONE_ROUTER_NDPROXY_CLEARED:
+#if OTBR_ENABLE_ND_PROXY_KERNEL_OFFLOAD
+        if (IsEnabled())
+        {
+            DisableKernelProxy();
+        }
+#endif
         for (const Ip6Address &proxingTarget : mNdProxySet)
         {
-            LeaveSolicitedNodeMulticastGroup(proxingTarget);
+            RemoveSolicitedNodeGroupRef(proxingTarget);
         }
         mNdProxySet.clear();
         break;
     }
 }
 
-void NdProxyManager::SendNeighborAdvertisement(const Ip6Address &aTarget, const Ip6Address &aDst)
+void NdProxyManager::UpdateNeighborAdvertisementTemplate(void)
 {
-    uint8_t                    packet[kMaxICMP6PacketSize];
-    uint16_t                   len = 0;
-    struct nd_neighbor_advert &na  = *reinterpret_cast<struct nd_neighbor_advert *>(packet);
-    struct nd_opt_hdr         &opt = *reinterpret_cast<struct nd_opt_hdr *>(packet + sizeof(struct nd_neighbor_advert));
-    bool                       isSolicited = !aDst.IsMulticast();
-    sockaddr_in6               dst;
-    otbrError                  error = OTBR_ERROR_NONE;
-    otBackboneRouterNdProxyInfo aNdProxyInfo;
+    struct nd_neighbor_advert &na  = *reinterpret_cast<struct nd_neighbor_advert *>(mNaTemplate);
+    struct nd_opt_hdr         &opt = *reinterpret_cast<struct nd_opt_hdr *>(mNaTemplate + sizeof(nd_neighbor_advert));
 
-    VerifyOrExit(otBackboneRouterGetNdProxyInfo(mHost.GetInstance(), reinterpret_cast<const otIp6Address *>(&aTarget),
-                                                &aNdProxyInfo) == OT_ERROR_NONE,
-                 error = OTBR_ERROR_OPENTHREAD);
-
-    memset(packet, 0, sizeof(packet));
+    memset(mNaTemplate, 0, sizeof(mNaTemplate));
 
     na.nd_na_type = ND_NEIGHBOR_ADVERT;
     na.nd_na_code = 0;
-    // set Solicited
-    na.nd_na_flags_reserved = isSolicited ? ND_NA_FLAG_SOLICITED : 0;
-    // set Router
-    na.nd_na_flags_reserved |= ND_NA_FLAG_ROUTER;
-    // set Override
-    na.nd_na_flags_reserved |= aNdProxyInfo.mTimeSinceLastTransaction <= kDuaRecentTime ? ND_NA_FLAG_OVERRIDE : 0;
-
-    memcpy(&na.nd_na_target, aTarget.m8, sizeof(Ip6Address));
-    len += sizeof(struct nd_neighbor_advert);
 
     opt.nd_opt_type = ND_OPT_TARGET_LINKADDR;
     opt.nd_opt_len  = 1;
 
     memcpy(reinterpret_cast<uint8_t *>(&opt) + 2, mMacAddress.m8, sizeof(mMacAddress));
+}
 
-    len += (opt.nd_opt_len * 8);
+void NdProxyManager::SendNeighborAdvertisement(const Ip6Address &aTarget, const Ip6Address &aDst)
+{
+    bool                          isSolicited = !aDst.IsMulticast();
+    otbrError                     error       = OTBR_ERROR_NONE;
+    otBackboneRouterNdProxyInfo   aNdProxyInfo;
+    PendingNeighborAdvertisement *pending;
 
-    aDst.CopyTo(dst);
+    VerifyOrExit(IsEnabled(), error = OTBR_ERROR_INVALID_STATE);
+    VerifyOrExit(otBackboneRouterGetNdProxyInfo(mHost.GetInstance(), reinterpret_cast<const otIp6Address *>(&aTarget),
+                                                &aNdProxyInfo) == OT_ERROR_NONE,
+                 error = OTBR_ERROR_OPENTHREAD);
 
-    VerifyOrExit(sendto(mIcmp6RawSock, packet, len, 0, reinterpret_cast<const sockaddr *>(&dst), sizeof(dst)) == len,
-                 error = OTBR_ERROR_ERRNO);
+    if (mNumPendingNas == kRecvBatchSize)
+    {
+        FlushNeighborAdvertisements();
+    }
+
+    // Only the flags and the target differ from the template. The kernel fills in the ICMPv6 checksum of raw
+    // ICMPv6 sockets.
+    pending = &mPendingNas[mNumPendingNas++];
+    memcpy(pending->mPacket, mNaTemplate, sizeof(mNaTemplate));
+
+    {
+        struct nd_neighbor_advert &na = *reinterpret_cast<struct nd_neighbor_advert *>(pending->mPacket);
+
+        // set Solicited
+        na.nd_na_flags_reserved = isSolicited ? ND_NA_FLAG_SOLICITED : 0;
+        // set Router
+        na.nd_na_flags_reserved |= ND_NA_FLAG_ROUTER;
+        // set Override
+        na.nd_na_flags_reserved |= aNdProxyInfo.mTimeSinceLastTransaction <= kDuaRecentTime ? ND_NA_FLAG_OVERRIDE : 0;
+
+        memcpy(&na.nd_na_target, aTarget.m8, sizeof(Ip6Address));
+    }
+
+    aDst.CopyTo(pending->mDst);
 
 exit:
     otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
 }
 
+void NdProxyManager::FlushNeighborAdvertisements(void)
+{
+    struct iovec   iovecs[kRecvBatchSize];
+    struct mmsghdr messages[kRecvBatchSize];
+    uint32_t       numSent = 0;
+
+    VerifyOrExit(mNumPendingNas > 0);
+
+    memset(messages, 0, sizeof(messages));
+
+    for (uint32_t i = 0; i < mNumPendingNas; i++)
+    {
+        iovecs[i].iov_base = mPendingNas[i].mPacket;
+        iovecs[i].iov_len  = sizeof(mPendingNas[i].mPacket);
+
+        messages[i].msg_hdr.msg_name    = &mPendingNas[i].mDst;
+        messages[i].msg_hdr.msg_namelen = sizeof(mPendingNas[i].mDst);
+        messages[i].msg_hdr.msg_iov     = &iovecs[i];
+        messages[i].msg_hdr.msg_iovlen  = 1;
+    }
+
+    while (numSent < mNumPendingNas)
+    {
+        int rval = sendmmsg(mIcmp6RawSock, messages + numSent, mNumPendingNas - numSent, 0);
+
+        if (rval <= 0)
+        {
+            otbrLogWarning("NdProxyManager: Failed to send %u NA: %s", mNumPendingNas - numSent, strerror(errno));
+            break;
+        }
+
+        numSent += static_cast<uint32_t>(rval);
+    }
+
+    mNumPendingNas = 0;
+
+exit:
+    return;
+}
+
+#if OTBR_ENABLE_ND_PROXY_KERNEL_OFFLOAD
+static otbrError WriteIp6ConfSysctl(const std::string &aInterfaceName, const char *aName, const char *aValue)
+{
+    otbrError   error = OTBR_ERROR_NONE;
+    std::string path  = "/proc/sys/net/ipv6/conf/" + aInterfaceName + "/" + aName;
+    FILE       *file  = fopen(path.c_str(), "w");
+
+    VerifyOrExit(file != nullptr, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(fputs(aValue, file) >= 0, error = OTBR_ERROR_ERRNO);
+
+exit:
+    if (file != nullptr && fclose(file) != 0)
+    {
+        error = OTBR_ERROR_ERRNO;
+    }
+
+    otbrLogResult(error, "NdProxyManager: Set %s to %s", path.c_str(), aValue);
+    return error;
+}
+
+otbrError NdProxyManager::EnableKernelProxy(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = WriteIp6ConfSysctl(mBackboneInterfaceName, "proxy_ndp", "1"));
+    // Answer multicast NS right away instead of after a random delay of up to 0.8 seconds.
+    SuccessOrExit(error = WriteIp6ConfSysctl(mBackboneInterfaceName, "proxy_delay", "0"));
+
+    for (const Ip6Address &target : mNdProxySet)
+    {
+        mNetlink.QueueProxyNeighbor(/* aIsAdd */ true, target, mBackboneInterfaceName);
+    }
+
+    error = mNetlink.Commit();
+
+exit:
+    return error;
+}
+
+void NdProxyManager::DisableKernelProxy(void)
+{
+    for (const Ip6Address &target : mNdProxySet)
+    {
+        mNetlink.QueueProxyNeighbor(/* aIsAdd */ false, target, mBackboneInterfaceName);
+    }
+
+    mNetlink.Commit();
+}
+
+void NdProxyManager::UpdateKernelProxy(bool aIsAdd, const Ip6Address &aTarget)
+{
+    VerifyOrExit(IsEnabled());
+
+    mNetlink.QueueProxyNeighbor(aIsAdd, aTarget, mBackboneInterfaceName);
+    mNetlink.Commit();
+
+exit:
+    return;
+}
+#endif // OTBR_ENABLE_ND_PROXY_KERNEL_OFFLOAD
+
 otbrError NdProxyManager::UpdateMacAddress(void)
 {
     otbrError error = OTBR_ERROR_NONE;
@@ -355,20 +805,20 @@ otbrError NdProxyManager::UpdateMacAddress(void)
 
     VerifyOrExit(ioctl(mIcmp6RawSock, SIOCGIFHWADDR, &ifr) != -1, error = OTBR_ERROR_ERRNO);
     memcpy(mMacAddress.m8, ifr.ifr_hwaddr.sa_data, sizeof(mMacAddress));
+    UpdateNeighborAdvertisementTemplate();
 #else
     ExitNow(error = OTBR_ERROR_NOT_IMPLEMENTED);
 #endif
 exit:
-    otbrLogResult(error, "NdProxyManager: UpdateMacAddress to %s", mMacAddress.ToString().c_str());
+    otbrLogResult(error, "NdProxyManager: UpdateMacAddress to %s", mMacAddress.ToInfoString().AsCString());
     return error;
 }
 
 otbrError NdProxyManager::InitIcmp6RawSocket(void)
 {
-    otbrError           error = OTBR_ERROR_NONE;
-    int                 on    = 1;
-    int                 hops  = 255;
-    struct icmp6_filter filter;
+    otbrError error = OTBR_ERROR_NONE;
+    int       on    = 1;
+    int       hops  = 255;
 
     mIcmp6RawSock = socket(AF_INET6, SOCK_RAW, IPPROTO_ICMPV6);
     VerifyOrExit(mIcmp6RawSock >= 0, error = OTBR_ERROR_ERRNO);
@@ -392,11 +842,8 @@ otbrError NdProxyManager::InitIcmp6RawSocket(void)
     VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IPV6, IPV6_UNICAST_HOPS, &hops, sizeof(hops)) == 0,
                  error = OTBR_ERROR_ERRNO);
 
-    ICMP6_FILTER_SETBLOCKALL(&filter);
-    ICMP6_FILTER_SETPASS(ND_NEIGHBOR_SOLICIT, &filter);
+    SuccessOrExit(error = SetNeighborSolicitFilter(/* aPass */ false));
 
-    VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_ICMPV6, ICMP6_FILTER, &filter, sizeof(filter)) == 0,
-                 error = OTBR_ERROR_ERRNO);
 exit:
     if (error != OTBR_ERROR_NONE)
     {
@@ -406,8 +853,29 @@ exit:
     return error;
 }
 
+otbrError NdProxyManager::SetNeighborSolicitFilter(bool aPass)
+{
+    otbrError           error = OTBR_ERROR_NONE;
+    struct icmp6_filter filter;
+
+    // Nothing but the NAs sent by the ND Proxy goes through the socket while NS are blocked.
+    ICMP6_FILTER_SETBLOCKALL(&filter);
+    if (aPass)
+    {
+        ICMP6_FILTER_SETPASS(ND_NEIGHBOR_SOLICIT, &filter);
+    }
+
+    VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_ICMPV6, ICMP6_FILTER, &filter, sizeof(filter)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+exit:
+    return error;
+}
+
 void NdProxyManager::FiniIcmp6RawSocket(void)
 {
+    mNumPendingNas = 0;
+
     if (mIcmp6RawSock != -1)
     {
         close(mIcmp6RawSock);
@@ -423,7 +891,7 @@ otbrError NdProxyManager::InitNetfilterQueue(void)
     VerifyOrExit(nfq_unbind_pf(mNfqHandler, AF_INET6) >= 0);
     VerifyOrExit(nfq_bind_pf(mNfqHandler, AF_INET6) >= 0);
 
-    VerifyOrExit((mNfqQueueHandler = nfq_create_queue(mNfqHandler, 88, HandleNetfilterQueue, this)) != nullptr);
+    VerifyOrExit((mNfqQueueHandler = nfq_create_queue(mNfqHandler, kNetfilterQueueNum, HandleNetfilterQueue, this)) != nullptr);
     VerifyOrExit(nfq_set_mode(mNfqQueueHandler, NFQNL_COPY_PACKET, 0xffff) >= 0);
     VerifyOrExit((mUnicastNsQueueSock = nfq_fd(mNfqHandler)) >= 0);
 
@@ -442,6 +910,8 @@ exit:
 
 void NdProxyManager::FiniNetfilterQueue(void)
 {
+    mHasPendingVerdict = false;
+
     if (mUnicastNsQueueSock != -1)
     {
         close(mUnicastNsQueueSock);
@@ -473,6 +943,7 @@ int NdProxyManager::HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
                                          struct nfgenmsg     *aNfMsg,
                                          struct nfq_data     *aNfData)
 {
+    OTBR_UNUSED_VARIABLE(aNfQueueHandler);
     OTBR_UNUSED_VARIABLE(aNfMsg);
 
     struct nfqnl_msg_packet_hdr *ph;
@@ -502,11 +973,13 @@ int NdProxyManager::HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
 
     VerifyOrExit(ip6header->ip6_nxt == IPPROTO_ICMPV6);
 
-    otbrLogDebug("NdProxyManager: Handle Neighbor Solicitation: from %s to %s", src.ToString().c_str(),
-                 dst.ToString().c_str());
+    otbrLogDebug("NdProxyManager: Handle Neighbor Solicitation: from %s to %s", src.ToInfoString().AsCString(),
+                 dst.ToInfoString().AsCString());
 
     icmp6header = reinterpret_cast<struct icmp6_hdr *>(data + sizeof(struct ip6_hdr));
     VerifyOrExit(icmp6header->icmp6_type == ND_NEIGHBOR_SOLICIT);
+    VerifyOrExit(IsEnabled());
+    mStats.mNsReceived++;
 
     VerifyOrExit(mNdProxySet.find(dst) != mNdProxySet.end(), error = OTBR_ERROR_NOT_FOUND);
 
@@ -514,52 +987,89 @@ int NdProxyManager::HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
         struct nd_neighbor_solicit &ns = *reinterpret_cast<struct nd_neighbor_solicit *>(data + sizeof(struct ip6_hdr));
         Ip6Address                 &target = *reinterpret_cast<Ip6Address *>(&ns.nd_ns_target);
 
-        otbrLogDebug("NdProxyManager: %s: target: %s, hoplimit %d", __FUNCTION__, target.ToString().c_str(),
+        otbrLogDebug("NdProxyManager: %s: target: %s, hoplimit %d", __FUNCTION__, target.ToInfoString().AsCString(),
                      ip6header->ip6_hlim);
         VerifyOrExit(ip6header->ip6_hlim == 255, error = OTBR_ERROR_PARSE);
         SendNeighborAdvertisement(target, src);
+        mStats.mNsAnswered++;
         verdict = NF_DROP;
     }
 
 exit:
-    ret = nfq_set_verdict(aNfQueueHandler, id, verdict, len, data);
+    if (ph != nullptr)
+    {
+        QueueVerdict(id, verdict);
+    }
 
-    otbrLogResult(error, "NdProxyManager: %s (nfq_set_verdict id  %d, ret %d verdict %d)", __FUNCTION__, id, ret,
-                  verdict);
+    if (icmp6header != nullptr && icmp6header->icmp6_type == ND_NEIGHBOR_SOLICIT && error != OTBR_ERROR_NONE)
+    {
+        mStats.mNsDropped++;
+    }
+
+    otbrLogResult(error, "NdProxyManager: %s (queued verdict id %u verdict %d)", __FUNCTION__, id, verdict);
 
     return ret;
 }
 
-void NdProxyManager::JoinSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const
+void NdProxyManager::AddSolicitedNodeGroupRef(const Ip6Address &aTarget)
 {
-    ipv6_mreq  mreq;
-    otbrError  error                     = OTBR_ERROR_NONE;
-    Ip6Address solicitedMulticastAddress = aTarget.ToSolicitedNodeMulticastAddress();
+    Ip6Address group = aTarget.ToSolicitedNodeMulticastAddress();
 
-    mreq.ipv6mr_interface = mBackboneIfIndex;
-    solicitedMulticastAddress.CopyTo(mreq.ipv6mr_multiaddr);
+    // Up to 2^24 DUAs share a solicited-node group, only the first reference joins it.
+    if (mSolicitedNodeGroups[group]++ == 0)
+    {
+        mPendingGroupChanges[group] = true;
+    }
+}
+
+void NdProxyManager::RemoveSolicitedNodeGroupRef(const Ip6Address &aTarget)
+{
+    Ip6Address group = aTarget.ToSolicitedNodeMulticastAddress();
+    auto       it    = mSolicitedNodeGroups.find(group);
+
+    VerifyOrExit(it != mSolicitedNodeGroups.end());
+    VerifyOrExit(--it->second == 0);
+
+    mSolicitedNodeGroups.erase(it);
+
+    // A join which was not applied yet is simply cancelled.
+    if (!mPendingGroupChanges.erase(group))
+    {
+        mPendingGroupChanges[group] = false;
+    }
 
-    VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IPV6, IPV6_JOIN_GROUP, &mreq, sizeof(mreq)) == 0,
-                 error = OTBR_ERROR_ERRNO);
 exit:
-    otbrLogResult(error, "NdProxyManager: JoinSolicitedNodeMulticastGroup of %s: %s", aTarget.ToString().c_str(),
-                  solicitedMulticastAddress.ToString().c_str());
+    return;
+}
+
+void NdProxyManager::ApplySolicitedNodeGroupChanges(void)
+{
+    for (const auto &change : mPendingGroupChanges)
+    {
+        UpdateSolicitedNodeGroupMembership(change.first, /* aJoin */ change.second);
+    }
+
+    mPendingGroupChanges.clear();
 }
 
-void NdProxyManager::LeaveSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const
+void NdProxyManager::UpdateSolicitedNodeGroupMembership(const Ip6Address &aGroup, bool aJoin) const
 {
-    ipv6_mreq  mreq;
-    otbrError  error                     = OTBR_ERROR_NONE;
-    Ip6Address solicitedMulticastAddress = aTarget.ToSolicitedNodeMulticastAddress();
+    group_req    req;
+    sockaddr_in6 group;
+    otbrError    error = OTBR_ERROR_NONE;
+
+    memset(&req, 0, sizeof(req));
+    aGroup.CopyTo(group);
 
-    mreq.ipv6mr_interface = mBackboneIfIndex;
-    solicitedMulticastAddress.CopyTo(mreq.ipv6mr_multiaddr);
+    req.gr_interface = mBackboneIfIndex;
+    memcpy(&req.gr_group, &group, sizeof(group));
 
-    VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IPV6, IPV6_LEAVE_GROUP, &mreq, sizeof(mreq)) == 0,
+    VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IPV6, aJoin ? MCAST_JOIN_GROUP : MCAST_LEAVE_GROUP, &req,
+                            sizeof(req)) == 0,
                  error = OTBR_ERROR_ERRNO);
 exit:
-    otbrLogResult(error, "NdProxyManager: LeaveSolicitedNodeMulticastGroup of %s: %s", aTarget.ToString().c_str(),
-                  solicitedMulticastAddress.ToString().c_str());
+    otbrLogResult(error, "NdProxyManager: %s solicited-node multicast group %s", aJoin ? "Join" : "Leave",
+                  aGroup.ToInfoString().AsCString());
 }
 
 } // namespace BackboneRouter
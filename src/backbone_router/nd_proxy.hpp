@@ -42,20 +42,32 @@
 #define __APPLE_USE_RFC_3542
 #endif
 
+#include <functional>
 #include <inttypes.h>
 #include <libnetfilter_queue/libnetfilter_queue.h>
 #include <map>
+#include <netinet/icmp6.h>
 #include <netinet/in.h>
-#include <set>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 #include <openthread/backbone_router_ftd.h>
 
+#if OTBR_ENABLE_ND_PROXY_NFTABLES
+#include <nftables/libnftables.h>
+#endif
+
+#include "backbone_router/backbone_stats.hpp"
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/time.hpp"
 #include "common/types.hpp"
 #include "ncp/rcp_host.hpp"
+#if OTBR_ENABLE_ND_PROXY_KERNEL_OFFLOAD
+#include "utils/netlink_route.hpp"
+#endif
 
 namespace otbr {
 namespace BackboneRouter {
@@ -71,42 +83,77 @@ namespace BackboneRouter {
 
 /**
  * This class implements ND Proxy manager.
+ *
+ * By default, Neighbor Solicitations for the proxied DUAs are answered in userspace: multicast NS are received on a
+ * raw ICMPv6 socket and unicast NS are diverted to an NFQUEUE. With `OTBR_ENABLE_ND_PROXY_KERNEL_OFFLOAD`, each DUA is
+ * instead programmed as a kernel proxy neighbor entry and the kernel answers NS in steady state. Only DAD NS are still
+ * answered in userspace, where the Override flag follows the DUA registration recency.
  */
 class NdProxyManager : public MainloopProcessor, private NonCopyable
 {
 public:
     /**
      * This constructor initializes a NdProxyManager instance.
+     *
+     * @param[in] aHost                   The Thread controller instance.
+     * @param[in] aBackboneInterfaceName  The name of the backbone interface.
+     * @param[in] aStats                  The Backbone Router statistics to update.
      */
-    explicit NdProxyManager(otbr::Ncp::RcpHost &aHost, std::string aBackboneInterfaceName)
+    NdProxyManager(otbr::Ncp::RcpHost &aHost, std::string aBackboneInterfaceName, BackboneRouterStats &aStats)
         : mHost(aHost)
+        , mStats(aStats)
         , mBackboneInterfaceName(std::move(aBackboneInterfaceName))
+        , mIsActive(false)
         , mIcmp6RawSock(-1)
         , mUnicastNsQueueSock(-1)
         , mNfqHandler(nullptr)
         , mNfqQueueHandler(nullptr)
+        , mHasPendingVerdict(false)
+        , mPendingVerdict(0)
+        , mPendingVerdictId(0)
+        , mNumPendingVerdicts(0)
+        , mNumPendingNas(0)
+#if OTBR_ENABLE_ND_PROXY_NFTABLES
+        , mNftContext(nullptr)
+#endif
     {
     }
 
+    /**
+     * This destructor deinitializes the ND Proxy manager instance.
+     */
+    ~NdProxyManager(void);
+
     /**
      * This method initializes a ND Proxy manager instance.
      */
     void Init(void);
 
     /**
-     * This method enables the ND Proxy manager.
+     * This method prepares the ND Proxy manager without answering any Neighbor Solicitation.
+     *
+     * The sockets, the NFQUEUE handles and the NFQUEUE rule are set up, so that a later `Enable()` only switches
+     * the ND Proxy on. An enabled ND Proxy manager is deactivated but stays prepared.
+     *
+     * @param[in] aDomainPrefix  The Domain Prefix.
+     */
+    void Prepare(const Ip6Prefix &aDomainPrefix);
+
+    /**
+     * This method enables the ND Proxy manager, preparing it first if needed.
      *
      * @param[in] aDomainPrefix  The Domain Prefix.
      */
     void Enable(const Ip6Prefix &aDomainPrefix);
 
     /**
-     * This method disables the ND Proxy manager.
+     * This method disables the ND Proxy manager and releases all the prepared resources.
      */
     void Disable(void);
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "NdProxyManager"; }
+    void        Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
 
     /**
      * This method handles a Backbone Router ND Proxy event.
@@ -122,40 +169,101 @@ public:
      *
      * @returns If the ND Proxy manager is enabled;
      */
-    bool IsEnabled(void) const { return mIcmp6RawSock >= 0; }
+    bool IsEnabled(void) const { return mIsActive; }
+
+    /**
+     * This method returns if the ND Proxy manager is prepared or enabled.
+     *
+     * @returns If the ND Proxy manager is prepared or enabled;
+     */
+    bool IsPrepared(void) const { return mIcmp6RawSock >= 0; }
 
 private:
     enum
     {
-        kMaxICMP6PacketSize = 1500, ///< Max size of an ICMP6 packet in bytes.
+        kMaxICMP6PacketSize = 1500,                      ///< Max size of an ICMP6 packet in bytes.
+        kNetfilterQueueNum  = 88,                        ///< The NFQUEUE number of unicast Neighbor Solicitations.
+        kRecvBatchSize      = 16,                        ///< Max number of packets received by one `recvmmsg()`.
+        kMaxNsPerIteration  = 64,                        ///< Max number of NS handled per socket per iteration.
+        kMaxNfqMessageSize  = kMaxICMP6PacketSize + 256, ///< Max size of an NFQUEUE netlink message in bytes.
+    };
+
+    using NdProxyTable = std::unordered_set<Ip6Address>;
+
+    // Maps a solicited-node multicast group to the number of proxied DUAs in it.
+    using GroupRefTable = std::unordered_map<Ip6Address, uint32_t>;
+
+    // Maps a solicited-node multicast group to whether it is to be joined or left in the next iteration.
+    using GroupChangeTable = std::unordered_map<Ip6Address, bool>;
+
+    static constexpr size_t kNaLength = sizeof(struct nd_neighbor_advert) + 8; ///< NA with a target link-layer option.
+
+    struct PendingNeighborAdvertisement
+    {
+        uint8_t      mPacket[kNaLength];
+        sockaddr_in6 mDst;
     };
 
+    void       Deactivate(void);
+    void       UpdateNeighborAdvertisementTemplate(void);
     void       SendNeighborAdvertisement(const Ip6Address &aTarget, const Ip6Address &aDst);
+    void       FlushNeighborAdvertisements(void);
     otbrError  UpdateMacAddress(void);
     otbrError  InitIcmp6RawSocket(void);
+    otbrError  SetNeighborSolicitFilter(bool aPass);
     void       FiniIcmp6RawSocket(void);
     otbrError  InitNetfilterQueue(void);
     void       FiniNetfilterQueue(void);
+    otbrError  AddNetfilterRule(void);
+    otbrError  RemoveNetfilterRule(void);
+#if OTBR_ENABLE_ND_PROXY_KERNEL_OFFLOAD
+    otbrError EnableKernelProxy(void);
+    void      DisableKernelProxy(void);
+    void      UpdateKernelProxy(bool aIsAdd, const Ip6Address &aTarget);
+#endif
     void       ProcessMulticastNeighborSolicition(void);
+    void       HandleMulticastNeighborSolicition(const uint8_t *aPacket, size_t aLength, struct msghdr &aMsgHdr);
     void       ProcessUnicastNeighborSolicition(void);
-    void       JoinSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const;
-    void       LeaveSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const;
+    void       QueueVerdict(uint32_t aPacketId, int aVerdict);
+    void       FlushVerdicts(void);
+    void       AddSolicitedNodeGroupRef(const Ip6Address &aTarget);
+    void       RemoveSolicitedNodeGroupRef(const Ip6Address &aTarget);
+    void       ApplySolicitedNodeGroupChanges(void);
+    void       UpdateSolicitedNodeGroupMembership(const Ip6Address &aGroup, bool aJoin) const;
     static int HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
                                     struct nfgenmsg     *aNfMsg,
                                     struct nfq_data     *aNfData,
                                     void                *aContext);
     int HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler, struct nfgenmsg *aNfMsg, struct nfq_data *aNfData);
 
-    otbr::Ncp::RcpHost  &mHost;
-    std::string          mBackboneInterfaceName;
-    std::set<Ip6Address> mNdProxySet;
-    uint32_t             mBackboneIfIndex;
-    int                  mIcmp6RawSock;
-    int                  mUnicastNsQueueSock;
-    struct nfq_handle   *mNfqHandler;      ///< A pointer to an NFQUEUE handler.
-    struct nfq_q_handle *mNfqQueueHandler; ///< A pointer to a newly created queue.
-    MacAddress           mMacAddress;
-    Ip6Prefix            mDomainPrefix;
+    otbr::Ncp::RcpHost          &mHost;
+    BackboneRouterStats         &mStats;
+    std::string                  mBackboneInterfaceName;
+    NdProxyTable                 mNdProxySet;
+    GroupRefTable                mSolicitedNodeGroups;
+    GroupChangeTable             mPendingGroupChanges;
+    uint32_t                     mBackboneIfIndex;
+    bool                         mIsActive;
+    int                          mIcmp6RawSock;
+    int                          mUnicastNsQueueSock;
+    struct nfq_handle           *mNfqHandler;      ///< A pointer to an NFQUEUE handler.
+    struct nfq_q_handle         *mNfqQueueHandler; ///< A pointer to a newly created queue.
+    bool                         mHasPendingVerdict;
+    int                          mPendingVerdict;
+    uint32_t                     mPendingVerdictId;
+    uint32_t                     mNumPendingVerdicts; ///< The number of packets covered by the pending verdicts.
+    Timepoint                    mNfqReceiveTime;     ///< The time the NFQUEUE messages being handled are received.
+    MacAddress                   mMacAddress;
+    uint8_t                      mNaTemplate[kNaLength];     ///< The NA built for the MAC, without flags and target.
+    PendingNeighborAdvertisement mPendingNas[kRecvBatchSize]; ///< The NAs to send with the next `sendmmsg()`.
+    uint32_t                     mNumPendingNas;
+    Ip6Prefix                    mDomainPrefix;
+#if OTBR_ENABLE_ND_PROXY_NFTABLES
+    struct nft_ctx *mNftContext; ///< The libnftables context used to install the NFQUEUE rule.
+#endif
+#if OTBR_ENABLE_ND_PROXY_KERNEL_OFFLOAD
+    Utils::NetlinkRouteSocket mNetlink;
+#endif
 };
 
 /**
@@ -81,6 +81,42 @@ static const char    kBorderAgentEpskcServiceType[] = "_meshcop-e._udp"; ///< Bo
 static constexpr int kBorderAgentServiceDummyPort   = 49152;
 static constexpr int kEpskcRandomGenLen             = 8;
 
+/**
+ * The Thread state changes which may change each MeshCoP TXT entry.
+ *
+ * Entries which only change with the Border Agent's own configuration, e.g. "vn" and "mn", aren't listed.
+ */
+static const struct
+{
+    const char    *mKey;
+    otChangedFlags mFlags;
+} kMeshCopTxtDependencies[] = {
+    {"nn", OT_CHANGED_THREAD_NETWORK_NAME},
+    {"xp", OT_CHANGED_THREAD_EXT_PANID},
+    {"sb", OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_BACKBONE_ROUTER_STATE},
+    {"at", OT_CHANGED_THREAD_ROLE | OT_CHANGED_ACTIVE_DATASET},
+    {"pt", OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID},
+#if OTBR_ENABLE_BACKBONE_ROUTER
+    {"sq", OT_CHANGED_THREAD_BACKBONE_ROUTER_STATE | OT_CHANGED_THREAD_NETDATA},
+    {"bb", OT_CHANGED_THREAD_BACKBONE_ROUTER_STATE},
+#endif
+#if OTBR_ENABLE_BORDER_ROUTING
+    {"omr", OT_CHANGED_THREAD_NETDATA},
+#endif
+};
+
+static otChangedFlags GetMeshCopTxtDependencyFlags(void)
+{
+    otChangedFlags flags = 0;
+
+    for (const auto &dependency : kMeshCopTxtDependencies)
+    {
+        flags |= dependency.mFlags;
+    }
+
+    return flags;
+}
+
 /**
  * Locators
  */
@@ -164,8 +200,13 @@ BorderAgent::BorderAgent(otbr::Ncp::RcpHost &aHost, Mdns::Publisher &aPublisher)
     , mVendorName(OTBR_VENDOR_NAME)
     , mProductName(OTBR_PRODUCT_NAME)
     , mBaseServiceInstanceName(OTBR_MESHCOP_SERVICE_INSTANCE_NAME)
+    , mPublishedMeshCopPort(0)
+    , mIsEpskcServicePublished(false)
 {
-    mHost.AddThreadStateChangedCallback([this](otChangedFlags aFlags) { HandleThreadStateChanged(aFlags); });
+    mHost.AddThreadStateChangedCallback(GetMeshCopTxtDependencyFlags(),
+                                        [this](const Ncp::ThreadStateSnapshot &aSnapshot) {
+                                            HandleThreadStateChanged(aSnapshot);
+                                        });
     otbrLogInfo("Ephemeral Key is: %s during initialization", (mIsEphemeralKeyEnabled ? "enabled" : "disabled"));
 }
 
@@ -293,12 +334,16 @@ void BorderAgent::Stop(void)
 void BorderAgent::HandleEpskcStateChanged(void *aContext)
 {
     BorderAgent *borderAgent = static_cast<BorderAgent *>(aContext);
+    bool         isActive    = otBorderAgentIsEphemeralKeyActive(borderAgent->mHost.GetInstance());
 
-    if (otBorderAgentIsEphemeralKeyActive(borderAgent->mHost.GetInstance()))
+    // The state also changes when a commissioner connects or disconnects with the ephemeral key, which
+    // doesn't change the meshcop-e service, so it's only published or unpublished when the key becomes
+    // active or inactive.
+    if (isActive && !borderAgent->mIsEpskcServicePublished)
     {
         borderAgent->PublishEpskcService();
     }
-    else
+    else if (!isActive && borderAgent->mIsEpskcServicePublished)
     {
         borderAgent->UnpublishEpskcService();
     }
@@ -317,6 +362,8 @@ void BorderAgent::PublishEpskcService()
     otbrLogInfo("Publish meshcop-e service %s.%s.local. port %d", mServiceInstanceName.c_str(),
                 kBorderAgentEpskcServiceType, port);
 
+    mIsEpskcServicePublished = true;
+
     mPublisher.PublishService(/* aHostName */ "", mServiceInstanceName, kBorderAgentEpskcServiceType,
                               Mdns::Publisher::SubTypeList{}, port, /* aTxtData */ {}, [this](otbrError aError) {
                                   if (aError == OTBR_ERROR_ABORTED)
@@ -350,6 +397,8 @@ void BorderAgent::UnpublishEpskcService()
 {
     otbrLogInfo("Unpublish meshcop-e service %s.%s.local", mServiceInstanceName.c_str(), kBorderAgentEpskcServiceType);
 
+    mIsEpskcServicePublished = false;
+
     mPublisher.UnpublishService(mServiceInstanceName, kBorderAgentEpskcServiceType, [this](otbrError aError) {
         otbrLogResult(aError, "Result of unpublish meshcop-e service %s.%s.local", mServiceInstanceName.c_str(),
                       kBorderAgentEpskcServiceType);
@@ -368,7 +417,13 @@ void BorderAgent::HandleMdnsState(Mdns::Publisher::State aState)
     switch (aState)
     {
     case Mdns::Publisher::State::kReady:
+        // The publisher lost all services when it restarted.
+        mPublishedMeshCopInstanceName.clear();
         UpdateMeshCopService();
+        if (mIsEpskcServicePublished)
+        {
+            PublishEpskcService();
+        }
         break;
     default:
         otbrLogWarning("mDNS publisher not available!");
@@ -523,8 +578,6 @@ void BorderAgent::PublishMeshCopService(void)
 
     OTBR_UNUSED_VARIABLE(error);
 
-    otbrLogInfo("Publish meshcop service %s.%s.local.", mServiceInstanceName.c_str(), kBorderAgentServiceType);
-
 #if OTBR_ENABLE_PUBLISH_MESHCOP_BA_ID
     {
         otError         error;
@@ -599,6 +652,21 @@ void BorderAgent::PublishMeshCopService(void)
     error = Mdns::Publisher::EncodeTxtData(txtList, txtData);
     assert(error == OTBR_ERROR_NONE);
 
+    // Re-publishing an unchanged service would only send another mDNS announcement.
+    if (mPublishedMeshCopInstanceName == mServiceInstanceName && mPublishedMeshCopPort == port &&
+        mPublishedMeshCopTxtData == txtData)
+    {
+        otbrLogDebug("Meshcop service %s.%s.local. is unchanged", mServiceInstanceName.c_str(),
+                     kBorderAgentServiceType);
+        ExitNow();
+    }
+
+    otbrLogInfo("Publish meshcop service %s.%s.local.", mServiceInstanceName.c_str(), kBorderAgentServiceType);
+
+    mPublishedMeshCopInstanceName = mServiceInstanceName;
+    mPublishedMeshCopPort         = port;
+    mPublishedMeshCopTxtData      = txtData;
+
     mPublisher.PublishService(/* aHostName */ "", mServiceInstanceName, kBorderAgentServiceType,
                               Mdns::Publisher::SubTypeList{}, port, txtData, [this](otbrError aError) {
                                   if (aError == OTBR_ERROR_ABORTED)
@@ -614,6 +682,11 @@ void BorderAgent::PublishMeshCopService(void)
                                       otbrLogResult(aError, "Result of publish meshcop service %s.%s.local",
                                                     mServiceInstanceName.c_str(), kBorderAgentServiceType);
                                   }
+                                  if (aError != OTBR_ERROR_NONE && aError != OTBR_ERROR_ABORTED)
+                                  {
+                                      // Allows the next update to retry even if the TXT doesn't change.
+                                      mPublishedMeshCopInstanceName.clear();
+                                  }
                                   if (aError == OTBR_ERROR_DUPLICATED)
                                   {
                                       // Try to unpublish current service in case we are trying to register
@@ -624,12 +697,17 @@ void BorderAgent::PublishMeshCopService(void)
                                       PublishMeshCopService();
                                   }
                               });
+
+exit:
+    return;
 }
 
 void BorderAgent::UnpublishMeshCopService(void)
 {
     otbrLogInfo("Unpublish meshcop service %s.%s.local", mServiceInstanceName.c_str(), kBorderAgentServiceType);
 
+    mPublishedMeshCopInstanceName.clear();
+
     mPublisher.UnpublishService(mServiceInstanceName, kBorderAgentServiceType, [this](otbrError aError) {
         otbrLogResult(aError, "Result of unpublish meshcop service %s.%s.local", mServiceInstanceName.c_str(),
                       kBorderAgentServiceType);
@@ -654,30 +732,38 @@ void BorderAgent::HandleUpdateVendorMeshCoPTxtEntries(std::map<std::string, std:
 }
 #endif
 
-void BorderAgent::HandleThreadStateChanged(otChangedFlags aFlags)
+void BorderAgent::HandleThreadStateChanged(const Ncp::ThreadStateSnapshot &aSnapshot)
 {
+    std::string changedKeys;
+
     VerifyOrExit(IsEnabled());
 
-    if (aFlags & OT_CHANGED_THREAD_ROLE)
+    if (aSnapshot.mFlags & OT_CHANGED_THREAD_ROLE)
     {
-        otbrLogInfo("Thread is %s", (IsThreadStarted() ? "up" : "down"));
+        otbrLogInfo("Thread is %s", (IsThreadStarted(aSnapshot.mDeviceRole) ? "up" : "down"));
     }
 
-    if (aFlags & (OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_EXT_PANID | OT_CHANGED_THREAD_NETWORK_NAME |
-                  OT_CHANGED_THREAD_BACKBONE_ROUTER_STATE | OT_CHANGED_THREAD_NETDATA))
+    for (const auto &dependency : kMeshCopTxtDependencies)
     {
-        UpdateMeshCopService();
+        if (aSnapshot.mFlags & dependency.mFlags)
+        {
+            changedKeys += changedKeys.empty() ? "" : ",";
+            changedKeys += dependency.mKey;
+        }
     }
+    VerifyOrExit(!changedKeys.empty());
+
+    // A burst of changes is coalesced into one update, which is only published if the TXT data changed.
+    otbrLogDebug("Thread state changes may affect meshcop TXT entries %s", changedKeys.c_str());
+    UpdateMeshCopService();
 
 exit:
     return;
 }
 
-bool BorderAgent::IsThreadStarted(void) const
+bool BorderAgent::IsThreadStarted(otDeviceRole aRole)
 {
-    otDeviceRole role = mHost.GetDeviceRole();
-
-    return role == OT_DEVICE_ROLE_CHILD || role == OT_DEVICE_ROLE_ROUTER || role == OT_DEVICE_ROLE_LEADER;
+    return aRole == OT_DEVICE_ROLE_CHILD || aRole == OT_DEVICE_ROLE_ROUTER || aRole == OT_DEVICE_ROLE_LEADER;
 }
 
 std::string BorderAgent::GetServiceInstanceNameWithExtAddr(const std::string &aServiceInstanceName) const
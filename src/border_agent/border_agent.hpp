@@ -170,9 +170,9 @@ private:
     void HandleUpdateVendorMeshCoPTxtEntries(std::map<std::string, std::vector<uint8_t>> aUpdate);
 #endif
 
-    void HandleThreadStateChanged(otChangedFlags aFlags);
+    void HandleThreadStateChanged(const Ncp::ThreadStateSnapshot &aSnapshot);
 
-    bool        IsThreadStarted(void) const;
+    static bool IsThreadStarted(otDeviceRole aRole);
     std::string GetServiceInstanceNameWithExtAddr(const std::string &aServiceInstanceName) const;
     std::string GetAlternativeServiceInstanceName() const;
 
@@ -203,6 +203,14 @@ private:
     // "OpenThread Border Router #7AC3 (14379)".
     std::string mServiceInstanceName;
 
+    // The meshcop service as last requested to the publisher, to skip re-publishing it unchanged. The
+    // instance name is empty if the service isn't published.
+    std::string              mPublishedMeshCopInstanceName;
+    int                      mPublishedMeshCopPort;
+    Mdns::Publisher::TxtData mPublishedMeshCopTxtData;
+
+    bool mIsEpskcServicePublished;
+
     std::vector<EphemeralKeyChangedCallback> mEphemeralKeyChangedCallbacks;
 };
 
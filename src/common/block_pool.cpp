@@ -0,0 +1,124 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements a pool of memory blocks in size classes.
+ */
+
+#include "common/block_pool.hpp"
+
+#include <assert.h>
+
+namespace otbr {
+
+BlockPool::BlockPool(size_t aBlocksPerChunk)
+    : mBlocksPerChunk(aBlocksPerChunk)
+    , mFreeLists()
+{
+    assert(aBlocksPerChunk > 0);
+}
+
+void *BlockPool::Allocate(size_t aSize)
+{
+    void      *block;
+    FreeBlock *freeBlock;
+    size_t     sizeClass = GetSizeClass(aSize);
+
+    if (aSize > kMaxBlockSize)
+    {
+        ExitNow(block = ::operator new(aSize));
+    }
+
+    if (mFreeLists[sizeClass] == nullptr)
+    {
+        AddChunk(sizeClass);
+    }
+
+    freeBlock             = mFreeLists[sizeClass];
+    mFreeLists[sizeClass] = freeBlock->mNext;
+    block                 = freeBlock;
+
+exit:
+    return block;
+}
+
+void BlockPool::Free(void *aBlock, size_t aSize)
+{
+    FreeBlock *freeBlock = static_cast<FreeBlock *>(aBlock);
+    size_t     sizeClass = GetSizeClass(aSize);
+
+    VerifyOrExit(aBlock != nullptr);
+
+    if (aSize > kMaxBlockSize)
+    {
+        ::operator delete(aBlock);
+        ExitNow();
+    }
+
+    freeBlock->mNext      = mFreeLists[sizeClass];
+    mFreeLists[sizeClass] = freeBlock;
+
+exit:
+    return;
+}
+
+size_t BlockPool::GetNumFreeBlocks(size_t aSize) const
+{
+    size_t           count = 0;
+    const FreeBlock *freeBlock;
+
+    VerifyOrExit(aSize <= kMaxBlockSize);
+
+    for (freeBlock = mFreeLists[GetSizeClass(aSize)]; freeBlock != nullptr; freeBlock = freeBlock->mNext)
+    {
+        ++count;
+    }
+
+exit:
+    return count;
+}
+
+void BlockPool::AddChunk(size_t aSizeClass)
+{
+    size_t blockSize = (aSizeClass + 1) * kGranularity;
+    char  *chunk     = new char[blockSize * mBlocksPerChunk];
+
+    mChunks.emplace_back(chunk);
+
+    // The blocks are linked in order so that they are handed out in order.
+    for (size_t i = mBlocksPerChunk; i > 0; --i)
+    {
+        FreeBlock *freeBlock = reinterpret_cast<FreeBlock *>(chunk + (i - 1) * blockSize);
+
+        freeBlock->mNext       = mFreeLists[aSizeClass];
+        mFreeLists[aSizeClass] = freeBlock;
+    }
+}
+
+} // namespace otbr
@@ -0,0 +1,122 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines a pool of memory blocks in size classes.
+ */
+
+#ifndef OTBR_COMMON_BLOCK_POOL_HPP_
+#define OTBR_COMMON_BLOCK_POOL_HPP_
+
+#include <openthread-br/config.h>
+
+#include <stddef.h>
+
+#include <memory>
+#include <vector>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a pool of memory blocks in size classes.
+ *
+ * Blocks are carved from chunks holding a number of blocks of one size class, and freed blocks are kept on the free
+ * list of their size class instead of being returned to the heap. So objects which are allocated and freed at a
+ * steady population, such as the mDNS registrations renewed with the SRP leases, are served from a few chunks
+ * without hitting the heap allocator or fragmenting it. Blocks larger than `kMaxBlockSize` are allocated on the heap.
+ *
+ * The chunks are only freed along with the pool. The pool isn't thread-safe.
+ */
+class BlockPool : private NonCopyable
+{
+public:
+    static constexpr size_t kGranularity    = 32; ///< The size classes are multiples of this.
+    static constexpr size_t kNumSizeClasses = 16; ///< The number of size classes.
+    static constexpr size_t kMaxBlockSize   = kGranularity * kNumSizeClasses; ///< The largest pooled block.
+
+    /**
+     * The constructor initializes an empty pool.
+     *
+     * @param[in] aBlocksPerChunk  The number of blocks in a chunk.
+     */
+    explicit BlockPool(size_t aBlocksPerChunk);
+
+    /**
+     * This method allocates a block, which is aligned for any object.
+     *
+     * @param[in] aSize  The size of the block.
+     *
+     * @returns A pointer to the block.
+     */
+    void *Allocate(size_t aSize);
+
+    /**
+     * This method frees a block.
+     *
+     * @param[in] aBlock  A pointer to the block allocated by `Allocate()`, or nullptr.
+     * @param[in] aSize   The size of the block, as given to `Allocate()`.
+     */
+    void Free(void *aBlock, size_t aSize);
+
+    /**
+     * This method returns the number of chunks allocated by the pool.
+     *
+     * @returns The number of chunks.
+     */
+    size_t GetNumChunks(void) const { return mChunks.size(); }
+
+    /**
+     * This method returns the number of free blocks in the size class of a size.
+     *
+     * @param[in] aSize  The size of the blocks.
+     *
+     * @returns The number of free blocks of @p aSize, or 0 if @p aSize isn't pooled.
+     */
+    size_t GetNumFreeBlocks(size_t aSize) const;
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock *mNext;
+    };
+
+    static size_t GetSizeClass(size_t aSize) { return aSize == 0 ? 0 : (aSize - 1) / kGranularity; }
+
+    void AddChunk(size_t aSizeClass);
+
+    size_t                               mBlocksPerChunk;
+    FreeBlock                           *mFreeLists[kNumSizeClasses];
+    std::vector<std::unique_ptr<char[]>> mChunks;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_BLOCK_POOL_HPP_
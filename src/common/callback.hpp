@@ -31,11 +31,200 @@
 
 #include "openthread-br/config.h"
 
+#include <cstddef>
 #include <functional>
+#include <new>
 #include <type_traits>
+#include <utility>
 
 namespace otbr {
 
+template <class T> class UniqueFunction;
+
+/**
+ * A move-only callable wrapper with inline storage.
+ *
+ * Unlike `std::function`, a `UniqueFunction` can hold a callable which is not copyable (e.g. a lambda capturing a
+ * `std::unique_ptr`), and stores callables up to `kInlineSize` bytes inside the object itself so that wrapping and
+ * moving them doesn't allocate. Larger callables are stored on the heap.
+ *
+ * Example usage:
+ *  struct Getter
+ *  {
+ *      int operator()(void) const { return *mValue; }
+ *
+ *      std::unique_ptr<int> mValue;
+ *  };
+ *
+ *  UniqueFunction<int(void)> getter(Getter{std::unique_ptr<int>(new int(5))});
+ *  getter(); // Returns 5.
+ */
+template <typename R, typename... Args> class UniqueFunction<R(Args...)>
+{
+public:
+    /**
+     * The maximum size of a callable which is stored inline.
+     */
+    static constexpr size_t kInlineSize = 48;
+
+    UniqueFunction(void) noexcept
+        : mOps(nullptr)
+    {
+    }
+
+    UniqueFunction(std::nullptr_t) noexcept
+        : mOps(nullptr)
+    {
+    }
+
+    // Constructs a new `UniqueFunction` instance with a callable.
+    template <typename F,
+              typename D = typename std::decay<F>::type,
+              typename   = typename std::enable_if<!std::is_same<D, UniqueFunction>::value>::type>
+    UniqueFunction(F &&aFunc)
+        : mOps(nullptr)
+    {
+        if (!IsNullCallable(aFunc))
+        {
+            Construct<D>(std::forward<F>(aFunc), std::integral_constant<bool, IsInline<D>()>());
+        }
+    }
+
+    UniqueFunction(UniqueFunction &&aOther) noexcept
+        : mOps(nullptr)
+    {
+        MoveFrom(aOther);
+    }
+
+    UniqueFunction &operator=(UniqueFunction &&aOther) noexcept
+    {
+        if (this != &aOther)
+        {
+            Reset();
+            MoveFrom(aOther);
+        }
+
+        return *this;
+    }
+
+    UniqueFunction &operator=(std::nullptr_t) noexcept
+    {
+        Reset();
+
+        return *this;
+    }
+
+    UniqueFunction(const UniqueFunction &)            = delete;
+    UniqueFunction &operator=(const UniqueFunction &) = delete;
+
+    ~UniqueFunction(void) { Reset(); }
+
+    R operator()(Args... aArgs) const { return mOps->mInvoke(&mStorage, std::forward<Args>(aArgs)...); }
+
+    explicit operator bool(void) const noexcept { return mOps != nullptr; }
+
+    bool operator==(std::nullptr_t) const noexcept { return mOps == nullptr; }
+    bool operator!=(std::nullptr_t) const noexcept { return mOps != nullptr; }
+
+private:
+    typedef typename std::aligned_storage<kInlineSize, alignof(std::max_align_t)>::type Storage;
+
+    struct Ops
+    {
+        R (*mInvoke)(void *aStorage, Args &&...aArgs);
+        void (*mMove)(void *aDst, void *aSrc);
+        void (*mDestroy)(void *aStorage);
+    };
+
+    template <typename D> static constexpr bool IsInline(void)
+    {
+        return sizeof(D) <= sizeof(Storage) && alignof(Storage) % alignof(D) == 0 &&
+               std::is_nothrow_move_constructible<D>::value;
+    }
+
+    template <typename F> static bool IsNullCallable(const F &) { return false; }
+    template <typename F> static bool IsNullCallable(F *const &aFunc) { return aFunc == nullptr; }
+    template <typename S> static bool IsNullCallable(const std::function<S> &aFunc) { return !aFunc; }
+
+    template <typename D> struct InlineOps
+    {
+        static R Invoke(void *aStorage, Args &&...aArgs)
+        {
+            return (*static_cast<D *>(aStorage))(std::forward<Args>(aArgs)...);
+        }
+
+        static void Move(void *aDst, void *aSrc)
+        {
+            new (aDst) D(std::move(*static_cast<D *>(aSrc)));
+            static_cast<D *>(aSrc)->~D();
+        }
+
+        static void Destroy(void *aStorage) { static_cast<D *>(aStorage)->~D(); }
+
+        static const Ops kOps;
+    };
+
+    template <typename D> struct HeapOps
+    {
+        static R Invoke(void *aStorage, Args &&...aArgs)
+        {
+            return (**static_cast<D **>(aStorage))(std::forward<Args>(aArgs)...);
+        }
+
+        static void Move(void *aDst, void *aSrc) { *static_cast<D **>(aDst) = *static_cast<D **>(aSrc); }
+
+        static void Destroy(void *aStorage) { delete *static_cast<D **>(aStorage); }
+
+        static const Ops kOps;
+    };
+
+    template <typename D, typename F> void Construct(F &&aFunc, std::true_type)
+    {
+        new (&mStorage) D(std::forward<F>(aFunc));
+        mOps = &InlineOps<D>::kOps;
+    }
+
+    template <typename D, typename F> void Construct(F &&aFunc, std::false_type)
+    {
+        *reinterpret_cast<D **>(&mStorage) = new D(std::forward<F>(aFunc));
+        mOps                               = &HeapOps<D>::kOps;
+    }
+
+    void MoveFrom(UniqueFunction &aOther) noexcept
+    {
+        if (aOther.mOps != nullptr)
+        {
+            aOther.mOps->mMove(&mStorage, &aOther.mStorage);
+            mOps        = aOther.mOps;
+            aOther.mOps = nullptr;
+        }
+    }
+
+    void Reset(void) noexcept
+    {
+        if (mOps != nullptr)
+        {
+            mOps->mDestroy(&mStorage);
+            mOps = nullptr;
+        }
+    }
+
+    mutable Storage mStorage;
+    const Ops      *mOps;
+};
+
+template <typename R, typename... Args>
+template <typename D>
+const typename UniqueFunction<R(Args...)>::Ops UniqueFunction<R(Args...)>::InlineOps<D>::kOps = {
+    &UniqueFunction<R(Args...)>::InlineOps<D>::Invoke, &UniqueFunction<R(Args...)>::InlineOps<D>::Move,
+    &UniqueFunction<R(Args...)>::InlineOps<D>::Destroy};
+
+template <typename R, typename... Args>
+template <typename D>
+const typename UniqueFunction<R(Args...)>::Ops UniqueFunction<R(Args...)>::HeapOps<D>::kOps = {
+    &UniqueFunction<R(Args...)>::HeapOps<D>::Invoke, &UniqueFunction<R(Args...)>::HeapOps<D>::Move,
+    &UniqueFunction<R(Args...)>::HeapOps<D>::Destroy};
+
 template <class T> class OnceCallback;
 
 /**
@@ -102,7 +291,7 @@ public:
     bool IsNull() const { return mFunc == nullptr; }
 
 private:
-    std::function<R(Args...)> mFunc;
+    UniqueFunction<R(Args...)> mFunc;
 };
 
 } // namespace otbr
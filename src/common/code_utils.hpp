@@ -196,6 +196,27 @@ protected:
     NonCopyable(void) = default;
 };
 
+/**
+ * This structure represents a location in the source code.
+ *
+ * Used as the default argument of a function parameter, `Current()` captures the location of the caller.
+ */
+struct SourceLocation
+{
+#if defined(__GNUC__) || defined(__clang__)
+    static SourceLocation Current(const char *aFile = __builtin_FILE(),
+                                  uint32_t    aLine = static_cast<uint32_t>(__builtin_LINE()))
+#else
+    static SourceLocation Current(const char *aFile = nullptr, uint32_t aLine = 0)
+#endif
+    {
+        return SourceLocation{aFile, aLine};
+    }
+
+    const char *mFile; ///< The source file name, or `nullptr` if unknown.
+    uint32_t    mLine; ///< The line in the source file.
+};
+
 template <typename T> class Optional
 {
 public:
@@ -0,0 +1,120 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements a fixed-memory time series of counters.
+ */
+
+#include "common/counter_series.hpp"
+
+#include <algorithm>
+
+#include <assert.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+CounterSeries::CounterSeries(uint8_t aNumCounters, uint16_t aCapacity)
+    : mNumCounters(aNumCounters)
+    , mCapacity(aCapacity)
+    , mValues(aNumCounters)
+    , mTotalDeltas(aNumCounters)
+    , mDurations(aCapacity)
+    , mDeltas(aCapacity * aNumCounters)
+{
+    assert(aNumCounters > 0 && aCapacity > 0);
+
+    Clear();
+}
+
+void CounterSeries::Clear(void)
+{
+    mFirstSlot     = 0;
+    mNumIntervals  = 0;
+    mHasBaseline   = false;
+    mTotalDuration = 0;
+    std::fill(mValues.begin(), mValues.end(), 0);
+    std::fill(mTotalDeltas.begin(), mTotalDeltas.end(), 0);
+}
+
+void CounterSeries::Record(Timepoint aTime, const uint64_t *aValues)
+{
+    uint16_t slot;
+
+    if (!mHasBaseline)
+    {
+        mHasBaseline = true;
+        ExitNow();
+    }
+
+    if (mNumIntervals == mCapacity)
+    {
+        // Drop the oldest interval, its slot is reused for the new one.
+        slot = mFirstSlot;
+        mTotalDuration -= mDurations[slot];
+
+        for (uint8_t i = 0; i < mNumCounters; i++)
+        {
+            mTotalDeltas[i] -= mDeltas[slot * mNumCounters + i];
+        }
+
+        mFirstSlot = (mFirstSlot + 1) % mCapacity;
+    }
+    else
+    {
+        slot = ToSlot(mNumIntervals);
+        mNumIntervals++;
+    }
+
+    mDurations[slot] = static_cast<uint32_t>(std::min<int64_t>(
+        std::chrono::duration_cast<Milliseconds>(aTime - mLastTime).count(), UINT32_MAX));
+    mTotalDuration += mDurations[slot];
+
+    for (uint8_t i = 0; i < mNumCounters; i++)
+    {
+        uint64_t delta = (aValues[i] >= mValues[i]) ? aValues[i] - mValues[i] : aValues[i];
+
+        mDeltas[slot * mNumCounters + i] = static_cast<uint32_t>(std::min<uint64_t>(delta, UINT32_MAX));
+        mTotalDeltas[i] += mDeltas[slot * mNumCounters + i];
+    }
+
+exit:
+    mLastTime = aTime;
+    std::copy(aValues, aValues + mNumCounters, mValues.begin());
+}
+
+uint64_t CounterSeries::GetRatePerMinute(uint8_t aCounter) const
+{
+    static constexpr uint64_t kMillisecondsPerMinute = 60000;
+
+    return (mTotalDuration == 0) ? 0 : mTotalDeltas[aCounter] * kMillisecondsPerMinute / mTotalDuration;
+}
+
+} // namespace otbr
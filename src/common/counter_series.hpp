@@ -0,0 +1,155 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines a fixed-memory time series of counters.
+ */
+
+#ifndef OTBR_COMMON_COUNTER_SERIES_HPP_
+#define OTBR_COMMON_COUNTER_SERIES_HPP_
+
+#include "openthread-br/config.h"
+
+#include <vector>
+
+#include <stdint.h>
+
+#include "common/time.hpp"
+
+namespace otbr {
+
+/**
+ * This class keeps the recent history of a set of monotonic counters.
+ *
+ * The counters are sampled together. The history holds the increment of each counter in each interval between two
+ * consecutive samples, so the history of a counter takes 4 bytes per interval whatever the width of the counter.
+ * The memory is allocated once at construction, and the oldest interval is dropped when the history is full.
+ *
+ * A counter which decreases between two samples, e.g. because the counters were reset, is considered restarted from
+ * zero.
+ */
+class CounterSeries
+{
+public:
+    /**
+     * This constructor initializes an empty history.
+     *
+     * @param[in] aNumCounters  The number of counters in each sample.
+     * @param[in] aCapacity     The maximum number of intervals kept.
+     */
+    CounterSeries(uint8_t aNumCounters, uint16_t aCapacity);
+
+    /**
+     * This method records a sample of the counters.
+     *
+     * The first sample only sets the baseline, each following sample adds an interval to the history.
+     *
+     * @param[in] aTime    The time of the sample, not earlier than the previous sample.
+     * @param[in] aValues  The values of the counters, `GetNumCounters()` entries.
+     */
+    void Record(Timepoint aTime, const uint64_t *aValues);
+
+    /**
+     * This method removes all samples.
+     */
+    void Clear(void);
+
+    /**
+     * This method returns the number of counters in each sample.
+     *
+     * @returns The number of counters.
+     */
+    uint8_t GetNumCounters(void) const { return mNumCounters; }
+
+    /**
+     * This method returns the number of intervals in the history.
+     *
+     * @returns The number of intervals.
+     */
+    uint16_t GetNumIntervals(void) const { return mNumIntervals; }
+
+    /**
+     * This method returns the value of a counter in the latest sample.
+     *
+     * @param[in] aCounter  The index of the counter.
+     *
+     * @returns The latest value of the counter, or 0 if no sample is recorded.
+     */
+    uint64_t GetValue(uint8_t aCounter) const { return mValues[aCounter]; }
+
+    /**
+     * This method returns the duration of an interval.
+     *
+     * @param[in] aIndex  The index of the interval, 0 for the oldest one.
+     *
+     * @returns The duration of the interval in milliseconds.
+     */
+    uint32_t GetIntervalDuration(uint16_t aIndex) const { return mDurations[ToSlot(aIndex)]; }
+
+    /**
+     * This method returns the increment of a counter in an interval.
+     *
+     * @param[in] aIndex    The index of the interval, 0 for the oldest one.
+     * @param[in] aCounter  The index of the counter.
+     *
+     * @returns The increment of the counter, saturated to UINT32_MAX.
+     */
+    uint32_t GetDelta(uint16_t aIndex, uint8_t aCounter) const
+    {
+        return mDeltas[ToSlot(aIndex) * mNumCounters + aCounter];
+    }
+
+    /**
+     * This method returns the average rate of a counter over the whole history.
+     *
+     * @param[in] aCounter  The index of the counter.
+     *
+     * @returns The average increment of the counter per minute, or 0 if the history is empty.
+     */
+    uint64_t GetRatePerMinute(uint8_t aCounter) const;
+
+private:
+    uint16_t ToSlot(uint16_t aIndex) const { return (mFirstSlot + aIndex) % mCapacity; }
+
+    uint8_t               mNumCounters;
+    uint16_t              mCapacity;
+    uint16_t              mFirstSlot;
+    uint16_t              mNumIntervals;
+    bool                  mHasBaseline;
+    Timepoint             mLastTime;
+    uint64_t              mTotalDuration;
+    std::vector<uint64_t> mValues;
+    std::vector<uint64_t> mTotalDeltas;
+    std::vector<uint32_t> mDurations;
+    std::vector<uint32_t> mDeltas;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_COUNTER_SERIES_HPP_
@@ -0,0 +1,190 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the interned, case-folded keys of DNS names.
+ */
+
+#include "common/dns_name_key.hpp"
+
+#include <assert.h>
+
+#include <functional>
+#include <unordered_set>
+#include <utility>
+
+namespace otbr {
+
+class DnsNameKey::Table
+{
+public:
+    static Table &Get(void)
+    {
+        // Never destroyed, so that keys held by static objects may outlive it.
+        static Table *sTable = new Table();
+
+        return *sTable;
+    }
+
+    Entry *Find(StringView aFirst, const StringView *aSecond, char aSeparator)
+    {
+        auto it = mEntries.end();
+
+        // The lookup entry's name buffer is reused, so looking up doesn't allocate.
+        mLookup.mName.clear();
+        AppendLowercase(mLookup.mName, aFirst);
+        if (aSecond != nullptr)
+        {
+            mLookup.mName.push_back(aSeparator);
+            AppendLowercase(mLookup.mName, *aSecond);
+        }
+        mLookup.mHash = std::hash<std::string>()(mLookup.mName);
+
+        it = mEntries.find(&mLookup);
+
+        return it != mEntries.end() ? *it : nullptr;
+    }
+
+    Entry *Intern(StringView aFirst, const StringView *aSecond, char aSeparator)
+    {
+        Entry *entry = Find(aFirst, aSecond, aSeparator);
+
+        if (entry == nullptr)
+        {
+            entry = new Entry{mLookup.mName, mLookup.mHash, 0};
+            mEntries.insert(entry);
+        }
+
+        return entry;
+    }
+
+    void Remove(Entry *aEntry)
+    {
+        mEntries.erase(aEntry);
+        delete aEntry;
+    }
+
+    size_t GetSize(void) const { return mEntries.size(); }
+
+private:
+    struct EntryHash
+    {
+        size_t operator()(const Entry *aEntry) const { return aEntry->mHash; }
+    };
+
+    struct EntryEqual
+    {
+        bool operator()(const Entry *aEntry1, const Entry *aEntry2) const { return aEntry1->mName == aEntry2->mName; }
+    };
+
+    static void AppendLowercase(std::string &aString, StringView aName)
+    {
+        for (char c : aName)
+        {
+            aString.push_back((c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c);
+        }
+    }
+
+    std::unordered_set<Entry *, EntryHash, EntryEqual> mEntries;
+    Entry                                              mLookup{};
+};
+
+DnsNameKey::DnsNameKey(Entry *aEntry)
+    : mEntry(aEntry)
+{
+    if (mEntry != nullptr)
+    {
+        mEntry->mRefCount++;
+    }
+}
+
+DnsNameKey::DnsNameKey(const DnsNameKey &aOther)
+    : DnsNameKey(aOther.mEntry)
+{
+}
+
+DnsNameKey::DnsNameKey(DnsNameKey &&aOther) noexcept
+    : mEntry(aOther.mEntry)
+{
+    aOther.mEntry = nullptr;
+}
+
+DnsNameKey &DnsNameKey::operator=(DnsNameKey aOther) noexcept
+{
+    std::swap(mEntry, aOther.mEntry);
+
+    return *this;
+}
+
+DnsNameKey::~DnsNameKey(void)
+{
+    if (mEntry != nullptr)
+    {
+        assert(mEntry->mRefCount > 0);
+
+        if (--mEntry->mRefCount == 0)
+        {
+            Table::Get().Remove(mEntry);
+        }
+    }
+}
+
+DnsNameKey DnsNameKey::Intern(StringView aName)
+{
+    return DnsNameKey(Table::Get().Intern(aName, nullptr, '\0'));
+}
+
+DnsNameKey DnsNameKey::Intern(StringView aFirst, StringView aSecond, char aSeparator)
+{
+    return DnsNameKey(Table::Get().Intern(aFirst, &aSecond, aSeparator));
+}
+
+DnsNameKey DnsNameKey::Find(StringView aName)
+{
+    return DnsNameKey(Table::Get().Find(aName, nullptr, '\0'));
+}
+
+DnsNameKey DnsNameKey::Find(StringView aFirst, StringView aSecond, char aSeparator)
+{
+    return DnsNameKey(Table::Get().Find(aFirst, &aSecond, aSeparator));
+}
+
+size_t DnsNameKey::GetNumInterned(void)
+{
+    return Table::Get().GetSize();
+}
+
+const std::string &DnsNameKey::GetName(void) const
+{
+    static const std::string kEmptyName;
+
+    return mEntry != nullptr ? mEntry->mName : kEmptyName;
+}
+
+} // namespace otbr
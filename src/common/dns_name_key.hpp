@@ -0,0 +1,173 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines the interned, case-folded keys of DNS names.
+ */
+
+#ifndef OTBR_COMMON_DNS_NAME_KEY_HPP_
+#define OTBR_COMMON_DNS_NAME_KEY_HPP_
+
+#include <openthread-br/config.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+#include "common/string_view.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements the key of a DNS name, which is compared without regard to ASCII case.
+ *
+ * The keys of equal names share a single interned copy of the lowercase name with its precomputed hash, so keying the
+ * containers of the mDNS publisher and the SRP and DNS-SD proxies by `DnsNameKey` stores each name once however many
+ * containers refer to it, hashes it once and compares keys by pointer. A name is released once the last of its keys
+ * is destroyed.
+ *
+ * Keys must only be created, copied and destroyed on the mainloop thread.
+ */
+class DnsNameKey
+{
+public:
+    /**
+     * This structure implements the hash of a key for unordered containers.
+     */
+    struct Hash
+    {
+        size_t operator()(const DnsNameKey &aKey) const { return aKey.GetHash(); }
+    };
+
+    /**
+     * This constructor initializes a null key, which doesn't equal the key of any name.
+     */
+    DnsNameKey(void) = default;
+
+    DnsNameKey(const DnsNameKey &aOther);
+    DnsNameKey(DnsNameKey &&aOther) noexcept;
+    DnsNameKey &operator=(DnsNameKey aOther) noexcept;
+    ~DnsNameKey(void);
+
+    /**
+     * This function returns the key of a name, interning the name if it isn't yet.
+     *
+     * @param[in] aName  The name.
+     *
+     * @returns The key of @p aName.
+     */
+    static DnsNameKey Intern(StringView aName);
+
+    /**
+     * This function returns the key of a composite name made of labels joined with a separator.
+     *
+     * The composite name isn't built unless it is interned for the first time.
+     *
+     * @param[in] aFirst      The first label.
+     * @param[in] aSecond     The second label.
+     * @param[in] aSeparator  The separator.
+     *
+     * @returns The key of "<aFirst><aSeparator><aSecond>".
+     */
+    static DnsNameKey Intern(StringView aFirst, StringView aSecond, char aSeparator = '.');
+
+    /**
+     * This function returns the key of a name if it is interned.
+     *
+     * As no container refers to a name which isn't interned, lookups use `Find()` so that they don't intern the
+     * names they look for.
+     *
+     * @param[in] aName  The name.
+     *
+     * @returns The key of @p aName, or a null key if @p aName isn't interned.
+     */
+    static DnsNameKey Find(StringView aName);
+
+    /**
+     * This function returns the key of a composite name if it is interned.
+     *
+     * @param[in] aFirst      The first label.
+     * @param[in] aSecond     The second label.
+     * @param[in] aSeparator  The separator.
+     *
+     * @returns The key of "<aFirst><aSeparator><aSecond>", or a null key if it isn't interned.
+     */
+    static DnsNameKey Find(StringView aFirst, StringView aSecond, char aSeparator = '.');
+
+    /**
+     * This function returns the number of the names currently interned.
+     *
+     * @returns The number of interned names.
+     */
+    static size_t GetNumInterned(void);
+
+    /**
+     * This method indicates whether the key is null.
+     *
+     * @retval TRUE   The key is null.
+     * @retval FALSE  The key is the key of a name.
+     */
+    bool IsNull(void) const { return mEntry == nullptr; }
+
+    /**
+     * This method returns the lowercase name of the key.
+     *
+     * @returns The lowercase name, empty for a null key.
+     */
+    const std::string &GetName(void) const;
+
+    /**
+     * This method returns the precomputed hash of the key.
+     *
+     * @returns The hash of the lowercase name, zero for a null key.
+     */
+    size_t GetHash(void) const { return mEntry != nullptr ? mEntry->mHash : 0; }
+
+    bool operator==(const DnsNameKey &aOther) const { return mEntry == aOther.mEntry; }
+    bool operator!=(const DnsNameKey &aOther) const { return mEntry != aOther.mEntry; }
+
+private:
+    struct Entry
+    {
+        std::string mName;
+        size_t      mHash;
+        uint32_t    mRefCount;
+    };
+
+    class Table;
+
+    explicit DnsNameKey(Entry *aEntry);
+
+    Entry *mEntry = nullptr;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_DNS_NAME_KEY_HPP_
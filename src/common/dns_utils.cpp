@@ -28,68 +28,156 @@
 
 #include "common/dns_utils.hpp"
 
-#include <assert.h>
-
 #include "common/code_utils.hpp"
 
-static bool NameEndsWithDot(const std::string &aName)
+using otbr::StringView;
+
+static StringView StripTrailingDot(StringView aName)
 {
-    return !aName.empty() && aName.back() == '.';
+    return aName.EndsWith('.') ? aName.Substr(0, aName.Size() - 1) : aName;
 }
 
-DnsNameInfo SplitFullDnsName(const std::string &aName)
+static std::string ToDomainString(StringView aDomain)
 {
-    size_t      transportPos;
-    DnsNameInfo nameInfo;
-    std::string fullName = aName;
+    std::string domain;
+
+    domain.reserve(aDomain.Size() + 1);
+    domain.append(aDomain.Data(), aDomain.Size());
+    domain += '.';
+
+    return domain;
+}
 
-    if (!NameEndsWithDot(fullName))
+// Returns the position of the last "._udp" or "._tcp" label (given by `aTransport`) in `aName`.
+static size_t FindTransportLabel(StringView aName, const char *aTransport)
+{
+    static constexpr size_t kTransportLength = sizeof("._udp") - 1;
+
+    size_t pos = aName.Size() >= kTransportLength ? aName.Size() - kTransportLength + 1 : 0;
+
+    while (pos > 0)
     {
-        fullName += '.';
+        --pos;
+
+        if ((pos + kTransportLength == aName.Size() || aName[pos + kTransportLength] == '.') &&
+            aName.Substr(pos, kTransportLength) == StringView(aTransport, kTransportLength))
+        {
+            return pos;
+        }
     }
 
-    transportPos = fullName.rfind("._udp.");
+    return std::string::npos;
+}
+
+DnsNameView SplitFullDnsNameView(StringView aName)
+{
+    StringView  name = StripTrailingDot(aName);
+    size_t      transportPos;
+    DnsNameView nameView;
+
+    transportPos = FindTransportLabel(name, "._udp");
 
     if (transportPos == std::string::npos)
     {
-        transportPos = fullName.rfind("._tcp.");
+        transportPos = FindTransportLabel(name, "._tcp");
     }
 
     if (transportPos == std::string::npos)
     {
         // host.domain or domain
-        size_t dotPos = fullName.find_first_of('.');
-
-        assert(dotPos != std::string::npos);
+        size_t dotPos = name.Find('.');
 
-        // host.domain
-        nameInfo.mHostName = fullName.substr(0, dotPos);
-        nameInfo.mDomain   = fullName.substr(dotPos + 1, fullName.length() - dotPos - 1);
+        nameView.mHostName = name.Substr(0, dotPos);
+        nameView.mDomain   = dotPos == std::string::npos ? StringView() : name.Substr(dotPos + 1);
     }
     else
     {
         // service or service instance
-        size_t dotPos = transportPos > 0 ? fullName.find_last_of('.', transportPos - 1) : std::string::npos;
+        size_t dotPos = transportPos > 0 ? name.RFind('.', transportPos - 1) : std::string::npos;
 
-        nameInfo.mDomain = fullName.substr(transportPos + 6); // 6 is the length of "._tcp." or "._udp."
+        nameView.mDomain = name.Substr(transportPos + 6); // 6 is the length of "._tcp." or "._udp."
 
         if (dotPos == std::string::npos)
         {
             // service.domain
-            nameInfo.mServiceName = fullName.substr(0, transportPos + 5);
+            nameView.mServiceName = name.Substr(0, transportPos + 5);
         }
         else
         {
             // instance.service.domain
-            nameInfo.mInstanceName = fullName.substr(0, dotPos);
-            nameInfo.mServiceName  = fullName.substr(dotPos + 1, transportPos + 4 - dotPos);
+            nameView.mInstanceName = name.Substr(0, dotPos);
+            nameView.mServiceName  = name.Substr(dotPos + 1, transportPos + 4 - dotPos);
         }
     }
 
-    if (!NameEndsWithDot(nameInfo.mDomain))
-    {
-        nameInfo.mDomain += '.';
-    }
+    return nameView;
+}
+
+otbrError SplitFullServiceInstanceName(StringView  aFullName,
+                                       StringView &aInstanceName,
+                                       StringView &aType,
+                                       StringView &aDomain)
+{
+    otbrError   error    = OTBR_ERROR_NONE;
+    DnsNameView nameView = SplitFullDnsNameView(aFullName);
+
+    VerifyOrExit(nameView.IsServiceInstance(), error = OTBR_ERROR_INVALID_ARGS);
+
+    aInstanceName = nameView.mInstanceName;
+    aType         = nameView.mServiceName;
+    aDomain       = nameView.mDomain;
+
+exit:
+    return error;
+}
+
+otbrError SplitFullServiceName(StringView aFullName, StringView &aType, StringView &aDomain)
+{
+    otbrError   error    = OTBR_ERROR_NONE;
+    DnsNameView nameView = SplitFullDnsNameView(aFullName);
+
+    VerifyOrExit(nameView.IsService(), error = OTBR_ERROR_INVALID_ARGS);
+
+    aType   = nameView.mServiceName;
+    aDomain = nameView.mDomain;
+
+exit:
+    return error;
+}
+
+otbrError SplitFullHostName(StringView aFullName, StringView &aHostName, StringView &aDomain)
+{
+    otbrError   error    = OTBR_ERROR_NONE;
+    DnsNameView nameView = SplitFullDnsNameView(aFullName);
+
+    VerifyOrExit(nameView.IsHost(), error = OTBR_ERROR_INVALID_ARGS);
+
+    aHostName = nameView.mHostName;
+    aDomain   = nameView.mDomain;
+
+exit:
+    return error;
+}
+
+bool DnsLabelsEqual(StringView aLabel1, StringView aLabel2)
+{
+    return aLabel1.EqualsIgnoreCase(aLabel2);
+}
+
+bool DnsNamesEqual(StringView aName1, StringView aName2)
+{
+    return StripTrailingDot(aName1).EqualsIgnoreCase(StripTrailingDot(aName2));
+}
+
+DnsNameInfo SplitFullDnsName(const std::string &aName)
+{
+    DnsNameView nameView = SplitFullDnsNameView(aName);
+    DnsNameInfo nameInfo;
+
+    nameInfo.mInstanceName = nameView.mInstanceName.ToString();
+    nameInfo.mServiceName  = nameView.mServiceName.ToString();
+    nameInfo.mHostName     = nameView.mHostName.ToString();
+    nameInfo.mDomain       = ToDomainString(nameView.mDomain);
 
     return nameInfo;
 }
@@ -99,14 +187,16 @@ otbrError SplitFullServiceInstanceName(const std::string &aFullName,
                                        std::string       &aType,
                                        std::string       &aDomain)
 {
-    otbrError   error    = OTBR_ERROR_NONE;
-    DnsNameInfo nameInfo = SplitFullDnsName(aFullName);
+    otbrError  error;
+    StringView instanceName;
+    StringView type;
+    StringView domain;
 
-    VerifyOrExit(nameInfo.IsServiceInstance(), error = OTBR_ERROR_INVALID_ARGS);
+    SuccessOrExit(error = SplitFullServiceInstanceName(StringView(aFullName), instanceName, type, domain));
 
-    aInstanceName = std::move(nameInfo.mInstanceName);
-    aType         = std::move(nameInfo.mServiceName);
-    aDomain       = std::move(nameInfo.mDomain);
+    aInstanceName = instanceName.ToString();
+    aType         = type.ToString();
+    aDomain       = ToDomainString(domain);
 
 exit:
     return error;
@@ -114,13 +204,14 @@ exit:
 
 otbrError SplitFullServiceName(const std::string &aFullName, std::string &aType, std::string &aDomain)
 {
-    otbrError   error    = OTBR_ERROR_NONE;
-    DnsNameInfo nameInfo = SplitFullDnsName(aFullName);
+    otbrError  error;
+    StringView type;
+    StringView domain;
 
-    VerifyOrExit(nameInfo.IsService(), error = OTBR_ERROR_INVALID_ARGS);
+    SuccessOrExit(error = SplitFullServiceName(StringView(aFullName), type, domain));
 
-    aType   = std::move(nameInfo.mServiceName);
-    aDomain = std::move(nameInfo.mDomain);
+    aType   = type.ToString();
+    aDomain = ToDomainString(domain);
 
 exit:
     return error;
@@ -128,13 +219,14 @@ exit:
 
 otbrError SplitFullHostName(const std::string &aFullName, std::string &aHostName, std::string &aDomain)
 {
-    otbrError   error    = OTBR_ERROR_NONE;
-    DnsNameInfo nameInfo = SplitFullDnsName(aFullName);
+    otbrError  error;
+    StringView hostName;
+    StringView domain;
 
-    VerifyOrExit(nameInfo.IsHost(), error = OTBR_ERROR_INVALID_ARGS);
+    SuccessOrExit(error = SplitFullHostName(StringView(aFullName), hostName, domain));
 
-    aHostName = std::move(nameInfo.mHostName);
-    aDomain   = std::move(nameInfo.mDomain);
+    aHostName = hostName.ToString();
+    aDomain   = ToDomainString(domain);
 
 exit:
     return error;
@@ -35,6 +35,7 @@
 
 #include "openthread-br/config.h"
 
+#include "common/string_view.hpp"
 #include "common/types.hpp"
 
 /**
@@ -71,6 +72,114 @@ struct DnsNameInfo
     bool IsHost(void) const { return mServiceName.empty(); }
 };
 
+/**
+ * This structure represents DNS Name information as views into the dissected name.
+ *
+ * Unlike `DnsNameInfo`, the domain never includes the trailing dot. The views are only valid as long as the name
+ * they were split from.
+ *
+ * @sa SplitFullDnsNameView
+ */
+struct DnsNameView
+{
+    otbr::StringView mInstanceName; ///< Instance name, or empty if the DNS name is not a service instance.
+    otbr::StringView mServiceName;  ///< Service name, or empty if the DNS name is not a service or service instance.
+    otbr::StringView mHostName;     ///< Host name, or empty if the DNS name is not a host name.
+    otbr::StringView mDomain;       ///< Domain name without the trailing dot.
+
+    /**
+     * This method returns if the DNS name is a service instance.
+     *
+     * @returns Whether the DNS name is a service instance.
+     */
+    bool IsServiceInstance(void) const { return !mInstanceName.IsEmpty(); };
+
+    /**
+     * This method returns if the DNS name is a service.
+     *
+     * @returns Whether the DNS name is a service.
+     */
+    bool IsService(void) const { return !mServiceName.IsEmpty() && mInstanceName.IsEmpty(); }
+
+    /**
+     * This method returns if the DNS name is a host.
+     *
+     * @returns Whether the DNS name is a host.
+     */
+    bool IsHost(void) const { return mServiceName.IsEmpty(); }
+};
+
+/**
+ * This method splits a full DNS name into name components without copying them.
+ *
+ * @param[in] aName  The full DNS name to dissect.
+ *
+ * @returns A `DnsNameView` structure referring into @p aName.
+ *
+ * @sa DnsNameView
+ */
+DnsNameView SplitFullDnsNameView(otbr::StringView aName);
+
+/**
+ * This function splits a full service name into components without copying them.
+ *
+ * @param[in]  aFullName  The full service name to split.
+ * @param[out] aType      A reference to a view to receive the service type.
+ * @param[out] aDomain    A reference to a view to receive the domain, without the trailing dot.
+ *
+ * @retval OTBR_ERROR_NONE          Successfully split the full service name.
+ * @retval OTBR_ERROR_INVALID_ARGS  If the full service name is not valid.
+ */
+otbrError SplitFullServiceName(otbr::StringView aFullName, otbr::StringView &aType, otbr::StringView &aDomain);
+
+/**
+ * This function splits a full service instance name into components without copying them.
+ *
+ * @param[in]  aFullName      The full service instance name to split.
+ * @param[out] aInstanceName  A reference to a view to receive the instance name.
+ * @param[out] aType          A reference to a view to receive the service type.
+ * @param[out] aDomain        A reference to a view to receive the domain, without the trailing dot.
+ *
+ * @retval OTBR_ERROR_NONE          Successfully split the full service instance name.
+ * @retval OTBR_ERROR_INVALID_ARGS  If the full service instance name is not valid.
+ */
+otbrError SplitFullServiceInstanceName(otbr::StringView  aFullName,
+                                       otbr::StringView &aInstanceName,
+                                       otbr::StringView &aType,
+                                       otbr::StringView &aDomain);
+
+/**
+ * This function splits a full host name into components without copying them.
+ *
+ * @param[in]  aFullName  The full host name to split.
+ * @param[out] aHostName  A reference to a view to receive the host name.
+ * @param[out] aDomain    A reference to a view to receive the domain, without the trailing dot.
+ *
+ * @retval OTBR_ERROR_NONE          Successfully split the full host name.
+ * @retval OTBR_ERROR_INVALID_ARGS  If the full host name is not valid.
+ */
+otbrError SplitFullHostName(otbr::StringView aFullName, otbr::StringView &aHostName, otbr::StringView &aDomain);
+
+/**
+ * This function compares two DNS labels ignoring the case of ASCII letters.
+ *
+ * @param[in] aLabel1  The first label.
+ * @param[in] aLabel2  The second label.
+ *
+ * @returns Whether the two labels are equal.
+ */
+bool DnsLabelsEqual(otbr::StringView aLabel1, otbr::StringView aLabel2);
+
+/**
+ * This function compares two DNS names ignoring the case of ASCII letters and a trailing dot.
+ *
+ * @param[in] aName1  The first name.
+ * @param[in] aName2  The second name.
+ *
+ * @returns Whether the two names are equal.
+ */
+bool DnsNamesEqual(otbr::StringView aName1, otbr::StringView aName2);
+
 /**
  * This method splits a full DNS name into name components.
  *
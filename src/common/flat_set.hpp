@@ -0,0 +1,168 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines a set stored as a sorted vector.
+ */
+
+#ifndef OTBR_COMMON_FLAT_SET_HPP_
+#define OTBR_COMMON_FLAT_SET_HPP_
+
+#include <openthread-br/config.h>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace otbr {
+
+/**
+ * This class implements a set stored as a sorted vector.
+ *
+ * Compared with `std::set`, the elements are contiguous, so small collections such as the addresses of an interface
+ * take a single allocation, are searched in O(log n) without chasing pointers and can be diffed with
+ * `std::set_difference()` directly. Insertion and removal are O(n), so it suits collections which are mostly
+ * searched or replaced as a whole.
+ *
+ * @tparam T        The type of the elements.
+ * @tparam Compare  The strict weak ordering of the elements.
+ */
+template <typename T, typename Compare = std::less<T>> class FlatSet
+{
+public:
+    typedef typename std::vector<T>::const_iterator ConstIterator; ///< The iterator over the sorted elements.
+
+    /**
+     * This method replaces the elements of the set with the elements of a range, duplicates are removed.
+     *
+     * The capacity of the set is reused, so replacing the elements of a set of similar size doesn't allocate.
+     *
+     * @param[in] aBegin  The beginning of the range.
+     * @param[in] aEnd    The end of the range.
+     */
+    template <typename Iterator> void Assign(Iterator aBegin, Iterator aEnd)
+    {
+        mElements.assign(aBegin, aEnd);
+        std::sort(mElements.begin(), mElements.end(), Compare());
+        mElements.erase(std::unique(mElements.begin(), mElements.end(), IsEquivalent), mElements.end());
+    }
+
+    /**
+     * This method inserts an element to the set.
+     *
+     * @param[in] aElement  The element to insert.
+     *
+     * @retval TRUE   The element is inserted.
+     * @retval FALSE  The element is already in the set.
+     */
+    bool Insert(const T &aElement)
+    {
+        auto it       = std::lower_bound(mElements.begin(), mElements.end(), aElement, Compare());
+        bool inserted = (it == mElements.end() || Compare()(aElement, *it));
+
+        if (inserted)
+        {
+            mElements.insert(it, aElement);
+        }
+
+        return inserted;
+    }
+
+    /**
+     * This method removes an element from the set.
+     *
+     * @param[in] aElement  The element to remove.
+     *
+     * @retval TRUE   The element is removed.
+     * @retval FALSE  The element isn't in the set.
+     */
+    bool Erase(const T &aElement)
+    {
+        auto it      = std::lower_bound(mElements.begin(), mElements.end(), aElement, Compare());
+        bool removed = (it != mElements.end() && !Compare()(aElement, *it));
+
+        if (removed)
+        {
+            mElements.erase(it);
+        }
+
+        return removed;
+    }
+
+    /**
+     * This method indicates whether an element is in the set.
+     *
+     * @param[in] aElement  The element to find.
+     *
+     * @retval TRUE   The element is in the set.
+     * @retval FALSE  The element isn't in the set.
+     */
+    bool Contains(const T &aElement) const
+    {
+        return std::binary_search(mElements.begin(), mElements.end(), aElement, Compare());
+    }
+
+    /**
+     * This method removes all elements from the set, the capacity is kept.
+     */
+    void Clear(void) { mElements.clear(); }
+
+    /**
+     * This method swaps the elements of two sets.
+     *
+     * @param[in] aOther  The other set.
+     */
+    void Swap(FlatSet &aOther) { mElements.swap(aOther.mElements); }
+
+    /**
+     * This method returns the number of elements in the set.
+     *
+     * @returns The number of elements.
+     */
+    size_t GetSize(void) const { return mElements.size(); }
+
+    /**
+     * This method indicates whether the set is empty.
+     *
+     * @returns Whether the set is empty.
+     */
+    bool IsEmpty(void) const { return mElements.empty(); }
+
+    ConstIterator begin(void) const { return mElements.begin(); }
+    ConstIterator end(void) const { return mElements.end(); }
+
+private:
+    static bool IsEquivalent(const T &aLhs, const T &aRhs) { return !Compare()(aLhs, aRhs) && !Compare()(aRhs, aLhs); }
+
+    std::vector<T> mElements;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_FLAT_SET_HPP_
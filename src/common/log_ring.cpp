@@ -0,0 +1,103 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the bounded lock-free ring buffer of log lines.
+ */
+
+#include "common/log_ring.hpp"
+
+namespace otbr {
+
+LogRing::LogRing(void)
+    : mEnqueuePosition(0)
+    , mDequeuePosition(0)
+    , mDroppedCount(0)
+{
+    // A slot is free for the producer at position `p` when its sequence is `p`, and holds a published line for
+    // the consumer at position `p` when its sequence is `p + 1`.
+    for (uint32_t i = 0; i < kNumSlots; i++)
+    {
+        mSlots[i].mSequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+LogRing::Line *LogRing::Reserve(uint32_t &aPosition)
+{
+    Line    *line     = nullptr;
+    uint32_t position = mEnqueuePosition.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        Slot   &slot       = mSlots[position % kNumSlots];
+        int32_t difference = static_cast<int32_t>(slot.mSequence.load(std::memory_order_acquire) - position);
+
+        if (difference == 0)
+        {
+            if (mEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                line      = &slot.mLine;
+                aPosition = position;
+                break;
+            }
+        }
+        else if (difference < 0)
+        {
+            // The slot still holds the line written one lap ago, the ring is full.
+            mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+            break;
+        }
+        else
+        {
+            position = mEnqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    return line;
+}
+
+void LogRing::Commit(uint32_t aPosition)
+{
+    mSlots[aPosition % kNumSlots].mSequence.store(aPosition + 1, std::memory_order_release);
+}
+
+const LogRing::Line *LogRing::Peek(void)
+{
+    Slot &slot = mSlots[mDequeuePosition % kNumSlots];
+
+    return (slot.mSequence.load(std::memory_order_acquire) == mDequeuePosition + 1) ? &slot.mLine : nullptr;
+}
+
+void LogRing::Release(void)
+{
+    mSlots[mDequeuePosition % kNumSlots].mSequence.store(mDequeuePosition + kNumSlots, std::memory_order_release);
+    mDequeuePosition++;
+}
+
+} // namespace otbr
@@ -0,0 +1,136 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines a bounded lock-free ring buffer of log lines.
+ */
+
+#ifndef OTBR_COMMON_LOG_RING_HPP_
+#define OTBR_COMMON_LOG_RING_HPP_
+
+#include <openthread-br/config.h>
+
+#include <atomic>
+
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a bounded lock-free multi-producer single-consumer ring buffer of log lines.
+ *
+ * Producers never block: a line is dropped and counted when the ring is full. Lines are formatted in place, a
+ * producer reserves a slot with `Reserve()`, writes the line and publishes it with `Commit()`. The consumer reads
+ * the oldest line with `Peek()` and frees its slot with `Release()`. The algorithm is the bounded MPMC queue by
+ * Dmitry Vyukov restricted to a single consumer.
+ */
+class LogRing : private NonCopyable
+{
+public:
+    enum
+    {
+        kNumSlots      = 128,  ///< The number of lines the ring holds, must be a power of two.
+        kMaxLineLength = 1024, ///< The maximum length of a line, including the null character.
+    };
+
+    /**
+     * This structure represents a log line.
+     */
+    struct Line
+    {
+        int  mLevel;                ///< The log level.
+        char mText[kMaxLineLength]; ///< The null-terminated text.
+    };
+
+    /**
+     * This constructor initializes an empty ring.
+     */
+    LogRing(void);
+
+    /**
+     * This method reserves a slot for a new line.
+     *
+     * It is safe to call this method in different threads concurrently. The slot must be published with `Commit()`.
+     *
+     * @param[out] aPosition  The position of the reserved slot, to be passed to `Commit()`.
+     *
+     * @returns A pointer to the line to fill, or nullptr if the ring is full and the line is dropped.
+     */
+    Line *Reserve(uint32_t &aPosition);
+
+    /**
+     * This method publishes a line filled after `Reserve()`.
+     *
+     * @param[in] aPosition  The position returned by `Reserve()`.
+     */
+    void Commit(uint32_t aPosition);
+
+    /**
+     * This method returns the oldest published line.
+     *
+     * This method must only be called from the single consumer thread.
+     *
+     * @returns A pointer to the oldest line, or nullptr if no line is published.
+     */
+    const Line *Peek(void);
+
+    /**
+     * This method frees the slot of the line returned by `Peek()`.
+     *
+     * This method must only be called from the single consumer thread.
+     */
+    void Release(void);
+
+    /**
+     * This method returns the number of lines dropped because the ring was full.
+     *
+     * @returns The number of dropped lines.
+     */
+    uint64_t GetDroppedCount(void) const { return mDroppedCount.load(std::memory_order_relaxed); }
+
+private:
+    static_assert((kNumSlots & (kNumSlots - 1)) == 0, "kNumSlots must be a power of two");
+
+    struct Slot
+    {
+        std::atomic<uint32_t> mSequence;
+        Line                  mLine;
+    };
+
+    Slot                  mSlots[kNumSlots];
+    std::atomic<uint32_t> mEnqueuePosition;
+    uint32_t              mDequeuePosition;
+    std::atomic<uint64_t> mDroppedCount;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_LOG_RING_HPP_
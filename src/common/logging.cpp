@@ -44,9 +44,15 @@
 #include <sys/time.h>
 #include <syslog.h>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <sstream>
+#include <thread>
 
 #include "common/code_utils.hpp"
+#include "common/log_ring.hpp"
 #include "common/time.hpp"
 
 static otbrLogLevel sLevel            = OTBR_LOG_INFO;
@@ -57,6 +63,34 @@ static bool sSyslogDisabled = false;
 
 static otbrLogLevel sDefaultLevel = OTBR_LOG_INFO;
 
+// Per-tag overrides of `sLevel`. Entries are only appended, under `sTagLevelMutex`, and published by incrementing
+// `sNumTagLevels`, so that `otbrLogGetTagLevel()` reads them without locking. A cleared entry keeps its tag.
+enum
+{
+    kMaxTagLevels = 16,
+    kMaxTagLength = 15,
+    kNoTagLevel   = -1,
+};
+
+struct TagLevel
+{
+    char             mTag[kMaxTagLength + 1];
+    std::atomic<int> mLevel;
+};
+
+static TagLevel             sTagLevels[kMaxTagLevels];
+static std::atomic<uint8_t> sNumTagLevels(0);
+static std::mutex           sTagLevelMutex;
+
+// The asynchronous backend, logs are written by `sLogWriter` so that callers don't block on syslog or stdout.
+static otbr::LogRing            sLogRing;
+static std::atomic<bool>        sAsyncEnabled(false);
+static std::thread              sLogWriter;
+static std::mutex               sLogWriterMutex;
+static std::condition_variable  sLogWriterCondition;
+static bool                     sLogWriterStopping = false;
+static const otbr::Milliseconds kLogWriterInterval(50);
+
 /** Get the current debug log level */
 otbrLogLevel otbrLogGetLevel(void)
 {
@@ -78,6 +112,100 @@ void otbrLogSetLevel(otbrLogLevel aLevel)
     sLevel = aLevel;
 }
 
+static TagLevel *FindTagLevel(const char *aLogTag, uint8_t aNumTagLevels)
+{
+    TagLevel *tagLevel = nullptr;
+
+    for (uint8_t i = 0; i < aNumTagLevels; i++)
+    {
+        if (strcmp(sTagLevels[i].mTag, aLogTag) == 0)
+        {
+            tagLevel = &sTagLevels[i];
+            break;
+        }
+    }
+
+    return tagLevel;
+}
+
+otbrLogLevel otbrLogGetTagLevel(const char *aLogTag)
+{
+    otbrLogLevel level        = sLevel;
+    uint8_t      numTagLevels = sNumTagLevels.load(std::memory_order_acquire);
+    TagLevel    *tagLevel;
+    int          tagLevelValue;
+
+    VerifyOrExit(numTagLevels != 0 && aLogTag != nullptr);
+    tagLevel = FindTagLevel(aLogTag, numTagLevels);
+    VerifyOrExit(tagLevel != nullptr);
+
+    tagLevelValue = tagLevel->mLevel.load(std::memory_order_relaxed);
+    if (tagLevelValue != kNoTagLevel)
+    {
+        level = static_cast<otbrLogLevel>(tagLevelValue);
+    }
+
+exit:
+    return level;
+}
+
+otbrError otbrLogSetTagLevel(const char *aLogTag, otbrLogLevel aLevel)
+{
+    otbrError                   error = OTBR_ERROR_NONE;
+    std::lock_guard<std::mutex> lock(sTagLevelMutex);
+    uint8_t                     numTagLevels = sNumTagLevels.load(std::memory_order_relaxed);
+    TagLevel                   *tagLevel;
+
+    VerifyOrExit(aLogTag != nullptr && aLogTag[0] != '\0' && strlen(aLogTag) <= kMaxTagLength,
+                 error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(aLevel >= OTBR_LOG_EMERG && aLevel <= OTBR_LOG_DEBUG, error = OTBR_ERROR_INVALID_ARGS);
+
+    tagLevel = FindTagLevel(aLogTag, numTagLevels);
+
+    if (tagLevel == nullptr)
+    {
+        VerifyOrExit(numTagLevels < kMaxTagLevels, error = OTBR_ERROR_ERRNO, errno = ENOBUFS);
+        tagLevel = &sTagLevels[numTagLevels];
+        strcpy(tagLevel->mTag, aLogTag);
+        tagLevel->mLevel.store(aLevel, std::memory_order_relaxed);
+        sNumTagLevels.store(numTagLevels + 1, std::memory_order_release);
+    }
+    else
+    {
+        tagLevel->mLevel.store(aLevel, std::memory_order_relaxed);
+    }
+
+exit:
+    return error;
+}
+
+otbrError otbrLogClearTagLevel(const char *aLogTag)
+{
+    otbrError                   error = OTBR_ERROR_NONE;
+    std::lock_guard<std::mutex> lock(sTagLevelMutex);
+    TagLevel                   *tagLevel;
+
+    VerifyOrExit(aLogTag != nullptr, error = OTBR_ERROR_NOT_FOUND);
+    tagLevel = FindTagLevel(aLogTag, sNumTagLevels.load(std::memory_order_relaxed));
+    VerifyOrExit(tagLevel != nullptr && tagLevel->mLevel.load(std::memory_order_relaxed) != kNoTagLevel,
+                 error = OTBR_ERROR_NOT_FOUND);
+    tagLevel->mLevel.store(kNoTagLevel, std::memory_order_relaxed);
+
+exit:
+    return error;
+}
+
+void otbrLogClearTagLevels(void)
+{
+    std::lock_guard<std::mutex> lock(sTagLevelMutex);
+    uint8_t                     numTagLevels = sNumTagLevels.load(std::memory_order_relaxed);
+
+    for (uint8_t i = 0; i < numTagLevels; i++)
+    {
+        sTagLevels[i].mLevel.store(kNoTagLevel, std::memory_order_relaxed);
+    }
+}
+
 /** Enable/disable logging with syslog */
 void otbrLogSyslogSetEnabled(bool aEnabled)
 {
@@ -130,6 +258,137 @@ static const char *GetPrefix(const char *aLogTag)
     return prefix;
 }
 
+static void WriteLine(int aLevel, const char *aLine)
+{
+    if (sSyslogDisabled)
+    {
+        printf("%s\n", aLine);
+    }
+    else
+    {
+        syslog(aLevel, "%s", aLine);
+    }
+}
+
+static void WritePendingLines(void)
+{
+    static uint64_t            sReportedDroppedCount = 0;
+    const otbr::LogRing::Line *line;
+    uint64_t                   droppedCount;
+
+    while ((line = sLogRing.Peek()) != nullptr)
+    {
+        WriteLine(line->mLevel, line->mText);
+        sLogRing.Release();
+    }
+
+    droppedCount = sLogRing.GetDroppedCount();
+
+    if (droppedCount != sReportedDroppedCount)
+    {
+        char line[64];
+
+        snprintf(line, sizeof(line), "%s-LOG-----: %llu log lines were dropped", sLevelString[OTBR_LOG_WARNING],
+                 static_cast<unsigned long long>(droppedCount - sReportedDroppedCount));
+        WriteLine(OTBR_LOG_WARNING, line);
+        sReportedDroppedCount = droppedCount;
+    }
+}
+
+static void RunLogWriter(void)
+{
+    std::unique_lock<std::mutex> lock(sLogWriterMutex);
+
+    while (true)
+    {
+        // Lines published before the stop request are written before exiting.
+        bool stopping = sLogWriterStopping;
+
+        lock.unlock();
+        WritePendingLines();
+        lock.lock();
+
+        if (stopping)
+        {
+            break;
+        }
+
+        // Producers don't take the mutex, the timeout bounds the delay of a missed notification.
+        sLogWriterCondition.wait_for(lock, kLogWriterInterval);
+    }
+}
+
+/**
+ * This function formats a log line into the ring buffer of the asynchronous backend.
+ *
+ * @retval TRUE   The line is handled by the asynchronous backend, it may have been dropped if the ring is full.
+ * @retval FALSE  The line must be written synchronously.
+ */
+static bool PushLine(otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, va_list aArgList)
+{
+    bool                 pushed = false;
+    otbr::LogRing::Line *line;
+    uint32_t             position;
+    int                  length = 0;
+
+    // Critical logs usually precede an abort, they are not deferred to the writer thread.
+    VerifyOrExit(sAsyncEnabled.load(std::memory_order_relaxed) && aLevel > OTBR_LOG_CRIT);
+    pushed = true;
+
+    VerifyOrExit((line = sLogRing.Reserve(position)) != nullptr);
+
+    if (aLogTag != nullptr)
+    {
+        length = snprintf(line->mText, sizeof(line->mText), "%s%s: ", sLevelString[aLevel], GetPrefix(aLogTag));
+        length = (length < 0) ? 0 : std::min<int>(length, sizeof(line->mText) - 1);
+    }
+
+    if (vsnprintf(line->mText + length, sizeof(line->mText) - length, aFormat, aArgList) < 0)
+    {
+        line->mText[length] = '\0';
+    }
+
+    line->mLevel = static_cast<int>(aLevel);
+    sLogRing.Commit(position);
+    sLogWriterCondition.notify_one();
+
+exit:
+    return pushed;
+}
+
+void otbrLogSetAsyncEnabled(bool aEnabled)
+{
+    std::unique_lock<std::mutex> lock(sLogWriterMutex);
+
+    VerifyOrExit(aEnabled != sLogWriter.joinable());
+
+    if (aEnabled)
+    {
+        sLogWriterStopping = false;
+        sLogWriter         = std::thread(RunLogWriter);
+        sAsyncEnabled      = true;
+    }
+    else
+    {
+        sAsyncEnabled      = false;
+        sLogWriterStopping = true;
+        lock.unlock();
+        sLogWriterCondition.notify_one();
+        sLogWriter.join();
+
+        // Writes lines published by callers which raced with disabling.
+        WritePendingLines();
+    }
+
+exit:
+    return;
+}
+
+uint64_t otbrLogGetDroppedCount(void)
+{
+    return sLogRing.GetDroppedCount();
+}
+
 /** log to the syslog or standard out */
 void otbrLog(otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, ...)
 {
@@ -139,7 +398,8 @@ void otbrLog(otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, ...)
 
     va_start(ap, aFormat);
 
-    if ((aLevel <= sLevel) && (vsnprintf(buffer, sizeof(buffer), aFormat, ap) > 0))
+    if ((aLevel <= otbrLogGetTagLevel(aLogTag)) && !PushLine(aLevel, aLogTag, aFormat, ap) &&
+        (vsnprintf(buffer, sizeof(buffer), aFormat, ap) > 0))
     {
         if (sSyslogDisabled)
         {
@@ -170,6 +430,11 @@ void otbrLogv(otbrLogLevel aLevel, const char *aFormat, va_list aArgList)
 /** log to the syslog or standard out */
 void otbrLogvNoFilter(otbrLogLevel aLevel, const char *aFormat, va_list aArgList)
 {
+    if (PushLine(aLevel, nullptr, aFormat, aArgList))
+    {
+        return;
+    }
+
     if (sSyslogDisabled)
     {
         vprintf(aFormat, aArgList);
@@ -190,7 +455,7 @@ void otbrDump(otbrLogLevel aLevel, const char *aLogTag, const char *aPrefix, con
     const uint8_t *p8;
     int            addr;
 
-    if (aLevel >= sLevel)
+    if (aLevel >= otbrLogGetTagLevel(aLogTag))
     {
         return;
     }
@@ -232,6 +497,26 @@ void otbrDump(otbrLogLevel aLevel, const char *aLogTag, const char *aPrefix, con
     }
 }
 
+bool otbr::LogRateLimiter::Allow(uint32_t &aSuppressed)
+{
+    uint64_t now     = std::chrono::duration_cast<otbr::Milliseconds>(otbr::Clock::now().time_since_epoch()).count();
+    bool     allowed = !mHasLogged || (now - mLastLogMs >= mIntervalMs);
+
+    if (allowed)
+    {
+        aSuppressed = mSuppressed;
+        mSuppressed = 0;
+        mLastLogMs  = now;
+        mHasLogged  = true;
+    }
+    else
+    {
+        mSuppressed++;
+    }
+
+    return allowed;
+}
+
 const char *otbrErrorString(otbrError aError)
 {
     const char *error;
@@ -286,6 +571,10 @@ const char *otbrErrorString(otbrError aError)
         error = "Invalid state";
         break;
 
+    case OTBR_ERROR_TIMEOUT:
+        error = "Timeout";
+        break;
+
     default:
         error = "Unknown";
     }
@@ -295,5 +584,7 @@ const char *otbrErrorString(otbrError aError)
 
 void otbrLogDeinit(void)
 {
+    otbrLogSetAsyncEnabled(false);
+    otbrLogClearTagLevels();
     closelog();
 }
@@ -37,6 +37,7 @@
 
 #include <stdarg.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #ifndef OTBR_LOG_TAG
 #error "OTBR_LOG_TAG is not defined"
@@ -59,6 +60,17 @@ typedef enum
     OTBR_LOG_DEBUG,   ///< Debug level messages
 } otbrLogLevel;
 
+/**
+ * @def OTBR_LOG_LEVEL_MAX
+ *
+ * The most verbose log level compiled in by the `otbrLog*()` macros.
+ *
+ * Logs above this level are removed at compile time, including the evaluation of their arguments.
+ */
+#ifndef OTBR_LOG_LEVEL_MAX
+#define OTBR_LOG_LEVEL_MAX OTBR_LOG_DEBUG
+#endif
+
 /**
  * Get current log level.
  */
@@ -74,6 +86,47 @@ otbrLogLevel otbrLogGetDefaultLevel(void);
  */
 void otbrLogSetLevel(otbrLogLevel aLevel);
 
+/**
+ * This function returns the log level of the module with log tag @p aLogTag.
+ *
+ * This is the level set with `otbrLogSetTagLevel()` for @p aLogTag, or the current log level if none is set.
+ *
+ * @param[in] aLogTag  The log tag, may be nullptr.
+ *
+ * @returns The log level of the module.
+ */
+otbrLogLevel otbrLogGetTagLevel(const char *aLogTag);
+
+/**
+ * This function overrides the log level of the module with log tag @p aLogTag.
+ *
+ * The override takes effect immediately for all threads, so a single module can be debugged without enabling debug
+ * logs everywhere. Up to 16 log tags of at most 15 characters each can be overridden.
+ *
+ * @param[in] aLogTag  The log tag, e.g. "NDPROXY".
+ * @param[in] aLevel   The log level of the module.
+ *
+ * @retval OTBR_ERROR_NONE          Successfully set the log level.
+ * @retval OTBR_ERROR_INVALID_ARGS  The log tag or the log level is invalid.
+ * @retval OTBR_ERROR_ERRNO         Too many log tags are overridden, errno is set to ENOBUFS.
+ */
+otbrError otbrLogSetTagLevel(const char *aLogTag, otbrLogLevel aLevel);
+
+/**
+ * This function removes the log level override of the module with log tag @p aLogTag.
+ *
+ * @param[in] aLogTag  The log tag.
+ *
+ * @retval OTBR_ERROR_NONE       Successfully removed the override.
+ * @retval OTBR_ERROR_NOT_FOUND  The log level of @p aLogTag is not overridden.
+ */
+otbrError otbrLogClearTagLevel(const char *aLogTag);
+
+/**
+ * This function removes all log level overrides.
+ */
+void otbrLogClearTagLevels(void);
+
 /**
  * Control log to syslog.
  *
@@ -81,6 +134,25 @@ void otbrLogSetLevel(otbrLogLevel aLevel);
  */
 void otbrLogSyslogSetEnabled(bool aEnabled);
 
+/**
+ * This function enables or disables the asynchronous logging backend.
+ *
+ * When enabled, logs are formatted by the caller into a lock-free ring buffer and written to syslog or stdout by a
+ * dedicated thread, so logging doesn't block the caller on a syscall. Logs at critical level and above are still
+ * written synchronously. A log is dropped if the ring buffer is full, and the number of dropped logs is reported by
+ * the writer thread. Disabling the backend writes all pending logs, it is disabled by `otbrLogDeinit()`.
+ *
+ * @param[in] aEnabled  True to enable the asynchronous backend.
+ */
+void otbrLogSetAsyncEnabled(bool aEnabled);
+
+/**
+ * This function returns the number of logs dropped by the asynchronous backend because its ring buffer was full.
+ *
+ * @returns The number of dropped logs.
+ */
+uint64_t otbrLogGetDroppedCount(void);
+
 /**
  * This function initialize the logging service.
  *
@@ -143,6 +215,95 @@ const char *otbrErrorString(otbrError aError);
  */
 void otbrLogDeinit(void);
 
+namespace otbr {
+
+/**
+ * This class limits how often a log statement is emitted.
+ *
+ * It is used through `otbrLogRateLimited()`, which keeps one instance per call site.
+ */
+class LogRateLimiter
+{
+public:
+    /**
+     * This constructor initializes the rate limiter.
+     *
+     * @param[in] aIntervalMs  The minimum interval between two emitted logs, in milliseconds.
+     */
+    explicit LogRateLimiter(uint32_t aIntervalMs)
+        : mIntervalMs(aIntervalMs)
+        , mLastLogMs(0)
+        , mSuppressed(0)
+        , mHasLogged(false)
+    {
+    }
+
+    /**
+     * This method decides whether a log may be emitted now.
+     *
+     * @param[out] aSuppressed  The number of logs suppressed since the last emitted one.
+     *
+     * @retval TRUE   The log may be emitted.
+     * @retval FALSE  The log is suppressed.
+     */
+    bool Allow(uint32_t &aSuppressed);
+
+private:
+    uint32_t mIntervalMs;
+    uint64_t mLastLogMs;
+    uint32_t mSuppressed;
+    bool     mHasLogged;
+};
+
+} // namespace otbr
+
+/**
+ * This macro evaluates to true if logs at level @p aLevel are emitted.
+ *
+ * The check is done before any argument is evaluated or formatted, so callers can use it to guard work only needed
+ * for logging.
+ *
+ * @param[in] aLevel  The log level.
+ */
+#define otbrLogIsEnabled(aLevel) (((aLevel) <= OTBR_LOG_LEVEL_MAX) && ((aLevel) <= otbrLogGetTagLevel(OTBR_LOG_TAG)))
+
+/**
+ * This macro logs at level @p aLevel if that level is enabled.
+ *
+ * The arguments are neither evaluated nor formatted if the log is filtered.
+ *
+ * @param[in] aLevel  The log level.
+ * @param[in] ...     Format string and arguments as in printf.
+ */
+#define otbrLogIfEnabled(aLevel, ...) \
+    (otbrLogIsEnabled(aLevel) ? otbrLog((aLevel), OTBR_LOG_TAG, __VA_ARGS__) : static_cast<void>(0))
+
+/**
+ * This macro logs at level @p aLevel at most once per @p aIntervalMs at this call site.
+ *
+ * The number of suppressed logs is reported before the next emitted log. It is meant for logs on the data path
+ * which may repeat for every packet, e.g. on an I/O error.
+ *
+ * @param[in] aLevel       The log level.
+ * @param[in] aIntervalMs  The minimum interval between two emitted logs, in milliseconds.
+ * @param[in] ...          Format string and arguments as in printf.
+ */
+#define otbrLogRateLimited(aLevel, aIntervalMs, ...)                                                \
+    do                                                                                              \
+    {                                                                                               \
+        static otbr::LogRateLimiter _limiter(aIntervalMs);                                          \
+        uint32_t                    _suppressed = 0;                                                \
+                                                                                                    \
+        if (otbrLogIsEnabled(aLevel) && _limiter.Allow(_suppressed))                                \
+        {                                                                                           \
+            if (_suppressed > 0)                                                                    \
+            {                                                                                       \
+                otbrLog((aLevel), OTBR_LOG_TAG, "%u similar logs were suppressed", _suppressed);    \
+            }                                                                                       \
+            otbrLog((aLevel), OTBR_LOG_TAG, __VA_ARGS__);                                           \
+        }                                                                                           \
+    } while (0)
+
 /**
  * This macro log an action result according to @p aError.
  *
@@ -156,9 +317,12 @@ void otbrLogDeinit(void);
 #define otbrLogResult(aError, aFormat, ...)                                                               \
     do                                                                                                    \
     {                                                                                                     \
-        otbrError _err = (aError);                                                                        \
-        otbrLog(_err == OTBR_ERROR_NONE ? OTBR_LOG_INFO : OTBR_LOG_WARNING, OTBR_LOG_TAG, aFormat ": %s", \
-                ##__VA_ARGS__, otbrErrorString(_err));                                                    \
+        otbrError    _err   = (aError);                                                                   \
+        otbrLogLevel _level = (_err == OTBR_ERROR_NONE ? OTBR_LOG_INFO : OTBR_LOG_WARNING);               \
+        if (otbrLogIsEnabled(_level))                                                                     \
+        {                                                                                                 \
+            otbrLog(_level, OTBR_LOG_TAG, aFormat ": %s", ##__VA_ARGS__, otbrErrorString(_err));          \
+        }                                                                                                 \
     } while (0)
 
 /**
@@ -224,13 +388,13 @@ void otbrLogDeinit(void);
  *
  * @param[in] ...  Arguments for the format specification.
  */
-#define otbrLogEmerg(...) otbrLog(OTBR_LOG_EMERG, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogAlert(...) otbrLog(OTBR_LOG_ALERT, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogCrit(...) otbrLog(OTBR_LOG_CRIT, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogErr(...) otbrLog(OTBR_LOG_ERR, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogWarning(...) otbrLog(OTBR_LOG_WARNING, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogNotice(...) otbrLog(OTBR_LOG_NOTICE, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogInfo(...) otbrLog(OTBR_LOG_INFO, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogDebug(...) otbrLog(OTBR_LOG_DEBUG, OTBR_LOG_TAG, __VA_ARGS__)
+#define otbrLogEmerg(...) otbrLogIfEnabled(OTBR_LOG_EMERG, __VA_ARGS__)
+#define otbrLogAlert(...) otbrLogIfEnabled(OTBR_LOG_ALERT, __VA_ARGS__)
+#define otbrLogCrit(...) otbrLogIfEnabled(OTBR_LOG_CRIT, __VA_ARGS__)
+#define otbrLogErr(...) otbrLogIfEnabled(OTBR_LOG_ERR, __VA_ARGS__)
+#define otbrLogWarning(...) otbrLogIfEnabled(OTBR_LOG_WARNING, __VA_ARGS__)
+#define otbrLogNotice(...) otbrLogIfEnabled(OTBR_LOG_NOTICE, __VA_ARGS__)
+#define otbrLogInfo(...) otbrLogIfEnabled(OTBR_LOG_INFO, __VA_ARGS__)
+#define otbrLogDebug(...) otbrLogIfEnabled(OTBR_LOG_DEBUG, __VA_ARGS__)
 
 #endif // OTBR_COMMON_LOGGING_HPP_
@@ -31,7 +31,12 @@
 
 namespace otbr {
 
-MainloopProcessor::MainloopProcessor(void)
+constexpr uint8_t MainloopContext::kErrorFdSet;
+constexpr uint8_t MainloopContext::kReadFdSet;
+constexpr uint8_t MainloopContext::kWriteFdSet;
+
+MainloopProcessor::MainloopProcessor(Priority aPriority)
+    : mPriority(aPriority)
 {
     MainloopManager::GetInstance().AddMainloopProcessor(this);
 }
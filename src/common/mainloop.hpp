@@ -73,10 +73,43 @@ public:
 class MainloopProcessor
 {
 public:
-    MainloopProcessor(void);
+    /**
+     * This enumeration represents the priority of a mainloop processor.
+     *
+     * Processors with a higher priority (smaller value) are processed earlier in each mainloop iteration.
+     */
+    enum Priority : uint8_t
+    {
+        kPriorityRadio      = 0, ///< Processing radio and co-processor frames.
+        kPriorityNetwork    = 1, ///< Processing network events, e.g. mDNS and netlink messages.
+        kPriorityManagement = 2, ///< Processing management requests, e.g. D-Bus and REST.
+    };
+
+    /**
+     * This constructor initializes the mainloop processor and registers it to the mainloop manager.
+     *
+     * @param[in] aPriority  The priority of the mainloop processor.
+     */
+    explicit MainloopProcessor(Priority aPriority = kPriorityNetwork);
 
     virtual ~MainloopProcessor(void);
 
+    /**
+     * This method returns the priority of the mainloop processor.
+     *
+     * @returns The priority of the mainloop processor.
+     */
+    Priority GetPriority(void) const { return mPriority; }
+
+    /**
+     * This method returns the name of the mainloop processor.
+     *
+     * The name identifies the kind of the processor in the mainloop statistics, so it must be a string literal.
+     *
+     * @returns The name of the mainloop processor.
+     */
+    virtual const char *GetName(void) const { return "Unknown"; }
+
     /**
      * This method updates the mainloop context.
      *
@@ -90,6 +123,9 @@ public:
      * @param[in] aMainloop  A reference to the mainloop context.
      */
     virtual void Process(const MainloopContext &aMainloop) = 0;
+
+private:
+    Priority mPriority;
 };
 
 } // namespace otbr
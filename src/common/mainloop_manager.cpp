@@ -25,16 +25,109 @@
  *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
  *    POSSIBILITY OF SUCH DAMAGE.
  */
+#define OTBR_LOG_TAG "MAINLOOP"
+
 #include <assert.h>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/select.h>
+
+#include <algorithm>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#else
+#include <utility>
+#include <vector>
+#endif
 
 #include "common/mainloop_manager.hpp"
+#include "common/mainloop_watchdog.hpp"
+#include "common/time.hpp"
+#include "common/trace.hpp"
 
 namespace otbr {
 
+#ifdef __linux__
+namespace {
+
+uint32_t ToEpollEvents(uint8_t aEvents)
+{
+    uint32_t events = 0;
+
+    if (aEvents & MainloopContext::kReadFdSet)
+    {
+        events |= EPOLLIN;
+    }
+    if (aEvents & MainloopContext::kWriteFdSet)
+    {
+        events |= EPOLLOUT;
+    }
+    if (aEvents & MainloopContext::kErrorFdSet)
+    {
+        events |= EPOLLPRI;
+    }
+
+    return events;
+}
+
+uint8_t FromEpollEvents(uint32_t aEpollEvents)
+{
+    uint8_t events = 0;
+
+    // Follow the semantics of `select()`: a hang-up or an error makes the fd both readable and writable,
+    // and out-of-band data is reported in the error fd set.
+    if (aEpollEvents & (EPOLLIN | EPOLLHUP | EPOLLRDHUP | EPOLLERR))
+    {
+        events |= MainloopContext::kReadFdSet;
+    }
+    if (aEpollEvents & (EPOLLOUT | EPOLLERR))
+    {
+        events |= MainloopContext::kWriteFdSet;
+    }
+    if (aEpollEvents & EPOLLPRI)
+    {
+        events |= MainloopContext::kErrorFdSet;
+    }
+
+    return events;
+}
+
+} // namespace
+#endif // __linux__
+
+MainloopManager::MainloopManager(void)
+{
+#ifdef __linux__
+    mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrDie(mEpollFd != -1, strerror(errno));
+#endif
+}
+
+MainloopManager::~MainloopManager(void)
+{
+#ifdef __linux__
+    if (mEpollFd != -1)
+    {
+        close(mEpollFd);
+        mEpollFd = -1;
+    }
+#endif
+}
+
 void MainloopManager::AddMainloopProcessor(MainloopProcessor *aMainloopProcessor)
 {
+    auto it = mMainloopProcessorList.begin();
+
     assert(aMainloopProcessor != nullptr);
-    mMainloopProcessorList.emplace_back(aMainloopProcessor);
+
+    while (it != mMainloopProcessorList.end() && (*it)->GetPriority() <= aMainloopProcessor->GetPriority())
+    {
+        ++it;
+    }
+
+    mMainloopProcessorList.insert(it, aMainloopProcessor);
 }
 
 void MainloopManager::RemoveMainloopProcessor(MainloopProcessor *aMainloopProcessor)
@@ -44,17 +137,298 @@ void MainloopManager::RemoveMainloopProcessor(MainloopProcessor *aMainloopProces
 
 void MainloopManager::Update(MainloopContext &aMainloop)
 {
+#if OTBR_ENABLE_MAINLOOP_STATS
+    Timepoint iterationStart = RealClock::now();
+#endif
+
     for (auto &mainloopProcessor : mMainloopProcessorList)
     {
+        OTBR_TRACE_SCOPE(mainloopProcessor->GetName());
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+        Timepoint start = RealClock::now();
+
+        mainloopProcessor->Update(aMainloop);
+        mStats.mProcessorStats[mainloopProcessor->GetName()].mUpdateTime.Record(
+            std::chrono::duration_cast<Microseconds>(RealClock::now() - start));
+#else
         mainloopProcessor->Update(aMainloop);
+#endif
     }
+
+    VerifyOrExit(!mFdEntries.empty());
+
+#ifdef __linux__
+    aMainloop.AddFdToReadSet(mEpollFd);
+#else
+    for (const auto &entry : mFdEntries)
+    {
+        aMainloop.AddFdToSet(entry.first, entry.second.mEvents);
+    }
+#endif
+
+exit:
+#if OTBR_ENABLE_MAINLOOP_STATS
+    mUpdateTime = std::chrono::duration_cast<Microseconds>(RealClock::now() - iterationStart);
+#endif
+    return;
 }
 
 void MainloopManager::Process(const MainloopContext &aMainloop)
 {
+    CoarseClock::Update();
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+    Timepoint iterationStart = RealClock::now();
+
+    if (mFdReady)
+    {
+        mStats.mFdWakeupCount++;
+    }
+    else
+    {
+        mStats.mTimeoutWakeupCount++;
+    }
+#endif
+
     for (auto &mainloopProcessor : mMainloopProcessorList)
     {
+        OTBR_TRACE_SCOPE(mainloopProcessor->GetName());
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+        // Look up the statistics before processing, the processor may be destroyed by itself.
+        MainloopStats::ProcessorStats &stats = mStats.mProcessorStats[mainloopProcessor->GetName()];
+        Timepoint                      start = RealClock::now();
+#endif
+
+        MainloopWatchdog::Get().EnterProcessor(mainloopProcessor->GetName());
         mainloopProcessor->Process(aMainloop);
+        MainloopWatchdog::Get().LeaveProcessor();
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+        stats.mProcessTime.Record(std::chrono::duration_cast<Microseconds>(RealClock::now() - start));
+#endif
+    }
+
+    VerifyOrExit(!mFdEntries.empty());
+
+#ifdef __linux__
+    if (FD_ISSET(mEpollFd, &aMainloop.mReadFdSet))
+    {
+        static constexpr int kMaxEvents = 64;
+
+        struct epoll_event events[kMaxEvents];
+        int                count;
+
+        do
+        {
+            count = epoll_wait(mEpollFd, events, kMaxEvents, /* timeout */ 0);
+        } while (count == -1 && errno == EINTR);
+
+        VerifyOrExit(count != -1, otbrLogWarning("Failed to wait for epoll events: %s", strerror(errno)));
+
+        // Remaining events, if any, are level-triggered and will be reported in the next iteration.
+        for (int i = 0; i < count; i++)
+        {
+            DispatchFdEvents(events[i].data.fd, FromEpollEvents(events[i].events));
+        }
+    }
+#else
+    {
+        std::vector<std::pair<int, uint8_t>> readyFds;
+
+        for (const auto &entry : mFdEntries)
+        {
+            uint8_t events = 0;
+            int     fd     = entry.first;
+
+            if (FD_ISSET(fd, &aMainloop.mReadFdSet))
+            {
+                events |= MainloopContext::kReadFdSet;
+            }
+            if (FD_ISSET(fd, &aMainloop.mWriteFdSet))
+            {
+                events |= MainloopContext::kWriteFdSet;
+            }
+            if (FD_ISSET(fd, &aMainloop.mErrorFdSet))
+            {
+                events |= MainloopContext::kErrorFdSet;
+            }
+
+            if (events != 0)
+            {
+                readyFds.emplace_back(fd, events);
+            }
+        }
+
+        for (const auto &readyFd : readyFds)
+        {
+            DispatchFdEvents(readyFd.first, readyFd.second);
+        }
+    }
+#endif
+
+exit:
+#if OTBR_ENABLE_MAINLOOP_STATS
+    mStats.mIterationTime.Record(mUpdateTime +
+                                 std::chrono::duration_cast<Microseconds>(RealClock::now() - iterationStart));
+    mUpdateTime = Microseconds::zero();
+#endif
+    return;
+}
+
+int MainloopManager::Poll(MainloopContext &aMainloop)
+{
+    int     rval;
+    timeval timeout = aMainloop.mTimeout;
+#if OTBR_ENABLE_MAINLOOP_STATS
+    Timepoint pollStart = RealClock::now();
+#endif
+
+    if (Clock::IsVirtualTimeEnabled())
+    {
+        aMainloop.mTimeout = {0, 0};
+    }
+
+    rval = select(aMainloop.mMaxFd + 1, &aMainloop.mReadFdSet, &aMainloop.mWriteFdSet, &aMainloop.mErrorFdSet,
+                  &aMainloop.mTimeout);
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+    // `select()` returns the number of ready fds, which saves scanning the fd sets in `Process()`.
+    GetInstance().mFdReady = (rval > 0);
+#endif
+
+    if (rval == 0 && Clock::IsVirtualTimeEnabled())
+    {
+        Clock::Advance(FromTimeval<Microseconds>(timeout));
+    }
+#if OTBR_ENABLE_MAINLOOP_STATS
+    else if (rval == 0)
+    {
+        // The thread should be woken up right at the timeout, how much later it was is the scheduling jitter.
+        GetInstance().mStats.mWakeupLatency.Record(std::chrono::duration_cast<Microseconds>(
+            RealClock::now() - pollStart - FromTimeval<Microseconds>(timeout)));
     }
+#endif
+
+    return rval;
+}
+
+otbrError MainloopManager::AddFd(int aFd, uint8_t aEvents, FdHandler aHandler)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(aFd >= 0 && aHandler != nullptr, error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(mFdEntries.find(aFd) == mFdEntries.end(), error = OTBR_ERROR_DUPLICATED);
+
+#ifdef __linux__
+    SuccessOrExit(error = UpdateEpoll(aFd, 0, aEvents));
+#endif
+
+    mFdEntries[aFd] = FdEntry{aEvents, std::move(aHandler)};
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to add fd %d: %s", aFd, otbrErrorString(error));
+    }
+    return error;
+}
+
+otbrError MainloopManager::UpdateFd(int aFd, uint8_t aEvents)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    auto      it    = mFdEntries.find(aFd);
+
+    VerifyOrExit(it != mFdEntries.end(), error = OTBR_ERROR_NOT_FOUND);
+    VerifyOrExit(it->second.mEvents != aEvents);
+
+#ifdef __linux__
+    SuccessOrExit(error = UpdateEpoll(aFd, it->second.mEvents, aEvents));
+#endif
+
+    it->second.mEvents = aEvents;
+
+exit:
+    return error;
 }
+
+void MainloopManager::RemoveFd(int aFd)
+{
+    auto it = mFdEntries.find(aFd);
+
+    VerifyOrExit(it != mFdEntries.end());
+
+#ifdef __linux__
+    if (UpdateEpoll(aFd, it->second.mEvents, 0) != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to remove fd %d from epoll: %s", aFd, strerror(errno));
+    }
+#endif
+
+    mFdEntries.erase(it);
+
+exit:
+    return;
+}
+
+#ifdef __linux__
+otbrError MainloopManager::UpdateEpoll(int aFd, uint8_t aOldEvents, uint8_t aNewEvents)
+{
+    otbrError          error = OTBR_ERROR_NONE;
+    struct epoll_event event;
+    int                op;
+
+    // A fd without any interested events is not kept in the epoll instance, otherwise a hang-up
+    // would be reported on every iteration.
+    if (aOldEvents == 0)
+    {
+        VerifyOrExit(aNewEvents != 0);
+        op = EPOLL_CTL_ADD;
+    }
+    else
+    {
+        op = (aNewEvents == 0) ? EPOLL_CTL_DEL : EPOLL_CTL_MOD;
+    }
+
+    memset(&event, 0, sizeof(event));
+    event.events  = ToEpollEvents(aNewEvents);
+    event.data.fd = aFd;
+
+    VerifyOrExit(epoll_ctl(mEpollFd, op, aFd, &event) == 0, error = OTBR_ERROR_ERRNO);
+
+exit:
+    return error;
+}
+#endif
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+void MainloopManager::RecordTaskQueueDepth(uint32_t aReadyTasks, uint32_t aDelayedTasks)
+{
+    mStats.mTaskQueueDepth.Record(aReadyTasks);
+    mStats.mMaxDelayedTasks = std::max(mStats.mMaxDelayedTasks, aDelayedTasks);
+}
+#endif
+
+void MainloopManager::DispatchFdEvents(int aFd, uint8_t aEvents)
+{
+    auto it = mFdEntries.find(aFd);
+
+    // The fd may have been removed by a handler which was called earlier in the same iteration.
+    VerifyOrExit(it != mFdEntries.end());
+
+    aEvents &= it->second.mEvents;
+    VerifyOrExit(aEvents != 0);
+
+    {
+        // Hold a copy of the handler in case the fd is removed by the handler itself.
+        FdHandler handler = it->second.mHandler;
+
+        handler(aEvents);
+    }
+
+exit:
+    return;
+}
+
 } // namespace otbr
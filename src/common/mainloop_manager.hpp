@@ -38,10 +38,13 @@
 
 #include <openthread/openthread-system.h>
 
+#include <functional>
 #include <list>
+#include <map>
 
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/mainloop_stats.hpp"
 #include "ncp/rcp_host.hpp"
 
 namespace otbr {
@@ -52,10 +55,23 @@ namespace otbr {
 class MainloopManager : private NonCopyable
 {
 public:
+    /**
+     * This type represents the handler of readiness events on a persistently registered fd.
+     *
+     * @param[in] aEvents  A bitmask of `MainloopContext::kReadFdSet`, `kWriteFdSet` and `kErrorFdSet`
+     *                     indicating which events are ready.
+     */
+    using FdHandler = std::function<void(uint8_t aEvents)>;
+
     /**
      * The constructor to initialize the mainloop manager.
      */
-    MainloopManager() = default;
+    MainloopManager(void);
+
+    /**
+     * The destructor to de-initialize the mainloop manager.
+     */
+    ~MainloopManager(void);
 
     /**
      * This method returns the singleton instance of the mainloop manager.
@@ -69,6 +85,9 @@ public:
     /**
      * This method adds a mainloop processors to the mainloop managger.
      *
+     * Mainloop processors are processed in the order of their priorities, and in the order
+     * they are added for the same priority.
+     *
      * @param[in] aMainloopProcessor  A pointer to the mainloop processor.
      */
     void AddMainloopProcessor(MainloopProcessor *aMainloopProcessor);
@@ -94,8 +113,103 @@ public:
      */
     void Process(const MainloopContext &aMainloop);
 
+    /**
+     * This method waits for the events of a mainloop context updated by `Update()` with `select()`.
+     *
+     * This method doesn't sleep in virtual time (see `Clock::EnableVirtualTime()`). If no file descriptor is ready,
+     * the virtual time is advanced by the timeout of the mainloop context instead, so the next timer is due.
+     *
+     * @param[in,out] aMainloop  A reference to the mainloop context.
+     *
+     * @returns The return value of `select()`.
+     */
+    static int Poll(MainloopContext &aMainloop);
+
+    /**
+     * This method registers a fd persistently to the mainloop.
+     *
+     * Unlike the fds added to the `MainloopContext` by a `MainloopProcessor` on every iteration, a persistently
+     * registered fd is only given to the kernel when its interest changes. On Linux, the fds are watched by a single
+     * epoll instance which itself is the only fd added to the `MainloopContext`, so it doesn't count against the
+     * `FD_SETSIZE` limit of `select()`. On other platforms, the fds are added to the `MainloopContext` on behalf of
+     * the caller.
+     *
+     * @param[in] aFd       The fd to watch.
+     * @param[in] aEvents   A bitmask of `MainloopContext::kReadFdSet`, `kWriteFdSet` and `kErrorFdSet`.
+     * @param[in] aHandler  The handler to be called on the mainloop when any of @p aEvents is ready.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully registered the fd.
+     * @retval OTBR_ERROR_INVALID_ARGS  The fd is invalid or the handler is empty.
+     * @retval OTBR_ERROR_DUPLICATED    The fd is already registered.
+     * @retval OTBR_ERROR_ERRNO         Failed to register the fd to the kernel.
+     */
+    otbrError AddFd(int aFd, uint8_t aEvents, FdHandler aHandler);
+
+    /**
+     * This method updates the interested events of a persistently registered fd.
+     *
+     * @param[in] aFd      The fd to update.
+     * @param[in] aEvents  A bitmask of `MainloopContext::kReadFdSet`, `kWriteFdSet` and `kErrorFdSet`.
+     *
+     * @retval OTBR_ERROR_NONE       Successfully updated the fd.
+     * @retval OTBR_ERROR_NOT_FOUND  The fd is not registered.
+     * @retval OTBR_ERROR_ERRNO      Failed to update the fd to the kernel.
+     */
+    otbrError UpdateFd(int aFd, uint8_t aEvents);
+
+    /**
+     * This method unregisters a persistently registered fd.
+     *
+     * This method must be called before the fd is closed. It's safe to call this method in a `FdHandler`.
+     *
+     * @param[in] aFd  The fd to unregister.
+     */
+    void RemoveFd(int aFd);
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+    /**
+     * This method returns the statistics of the mainloop.
+     *
+     * @returns A reference to the mainloop statistics.
+     */
+    const MainloopStats &GetStats(void) const { return mStats; }
+
+    /**
+     * This method clears the statistics of the mainloop.
+     */
+    void ClearStats(void) { mStats.Clear(); }
+
+    /**
+     * This method records the depth of the task queue of a `TaskRunner`.
+     *
+     * @param[in] aReadyTasks    The number of ready tasks run in this iteration.
+     * @param[in] aDelayedTasks  The number of delayed tasks which are pending.
+     */
+    void RecordTaskQueueDepth(uint32_t aReadyTasks, uint32_t aDelayedTasks);
+#endif
+
 private:
+    struct FdEntry
+    {
+        uint8_t   mEvents;
+        FdHandler mHandler;
+    };
+
+    void DispatchFdEvents(int aFd, uint8_t aEvents);
+#ifdef __linux__
+    otbrError UpdateEpoll(int aFd, uint8_t aOldEvents, uint8_t aNewEvents);
+#endif
+
     std::list<MainloopProcessor *> mMainloopProcessorList;
+    std::map<int, FdEntry>         mFdEntries;
+#ifdef __linux__
+    int mEpollFd;
+#endif
+#if OTBR_ENABLE_MAINLOOP_STATS
+    MainloopStats mStats;
+    Microseconds  mUpdateTime = Microseconds::zero();
+    bool          mFdReady    = false; ///< Whether the last `Poll()` was woken up by a ready fd.
+#endif
 };
 } // namespace otbr
 #endif // OTBR_COMMON_MAINLOOP_MANAGER_HPP_
@@ -0,0 +1,105 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the statistics of the mainloop.
+ */
+
+#include "common/mainloop_stats.hpp"
+
+#include <string.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace otbr {
+
+namespace {
+
+const uint32_t kDurationUpperBoundsUs[Histogram::kNumBuckets - 1] = {100, 500, 1000, 5000, 10000, 50000, 100000};
+const uint32_t kTaskQueueDepthUpperBounds[Histogram::kNumBuckets - 1] = {1, 2, 4, 8, 16, 32, 64};
+
+} // namespace
+
+constexpr uint8_t Histogram::kNumBuckets;
+
+Histogram::Histogram(const uint32_t (&aUpperBounds)[kNumBuckets - 1])
+    : mUpperBounds(&aUpperBounds)
+{
+    Clear();
+}
+
+void Histogram::Record(uint32_t aValue)
+{
+    const uint32_t *bound = std::upper_bound(std::begin(*mUpperBounds), std::end(*mUpperBounds), aValue);
+
+    mBucketCounts[bound - std::begin(*mUpperBounds)]++;
+    mCount++;
+    mSum += aValue;
+    mMax = std::max(mMax, aValue);
+}
+
+void Histogram::Clear(void)
+{
+    memset(mBucketCounts, 0, sizeof(mBucketCounts));
+    mCount = 0;
+    mSum   = 0;
+    mMax   = 0;
+}
+
+DurationHistogram::DurationHistogram(void)
+    : Histogram(kDurationUpperBoundsUs)
+{
+}
+
+void DurationHistogram::Record(Microseconds aDuration)
+{
+    auto us = std::max<Microseconds::rep>(aDuration.count(), 0);
+
+    Histogram::Record(static_cast<uint32_t>(std::min<Microseconds::rep>(us, std::numeric_limits<uint32_t>::max())));
+}
+
+MainloopStats::MainloopStats(void)
+    : mTaskQueueDepth(kTaskQueueDepthUpperBounds)
+{
+    Clear();
+}
+
+void MainloopStats::Clear(void)
+{
+    mFdWakeupCount      = 0;
+    mTimeoutWakeupCount = 0;
+    mIterationTime.Clear();
+    mTaskQueueDepth.Clear();
+    mMaxDelayedTasks = 0;
+    mWakeupLatency.Clear();
+    mProcessorStats.clear();
+}
+
+} // namespace otbr
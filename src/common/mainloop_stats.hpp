@@ -0,0 +1,178 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines the statistics of the mainloop.
+ */
+
+#ifndef OTBR_COMMON_MAINLOOP_STATS_HPP_
+#define OTBR_COMMON_MAINLOOP_STATS_HPP_
+
+#include <openthread-br/config.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#include <map>
+
+#include "common/time.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a histogram with fixed buckets.
+ *
+ * A value falls into the first bucket whose upper bound is greater than the value, the last bucket is unbounded.
+ */
+class Histogram
+{
+public:
+    static constexpr uint8_t kNumBuckets = 8; ///< The number of buckets.
+
+    /**
+     * This constructor initializes an empty histogram.
+     *
+     * @param[in] aUpperBounds  The exclusive upper bounds of the first `kNumBuckets - 1` buckets, in ascending
+     *                          order. The array must outlive the histogram.
+     */
+    explicit Histogram(const uint32_t (&aUpperBounds)[kNumBuckets - 1]);
+
+    /**
+     * This method records a value to the histogram.
+     *
+     * @param[in] aValue  The value to record.
+     */
+    void Record(uint32_t aValue);
+
+    /**
+     * This method clears all recorded values.
+     */
+    void Clear(void);
+
+    /**
+     * This method returns the upper bound of a bucket.
+     *
+     * @param[in] aIndex  The index of the bucket, must be less than `kNumBuckets - 1`.
+     *
+     * @returns The exclusive upper bound of the bucket.
+     */
+    uint32_t GetUpperBound(uint8_t aIndex) const { return (*mUpperBounds)[aIndex]; }
+
+    /**
+     * This method returns the number of values recorded in a bucket.
+     *
+     * @param[in] aIndex  The index of the bucket, must be less than `kNumBuckets`.
+     *
+     * @returns The number of values in the bucket.
+     */
+    uint32_t GetBucketCount(uint8_t aIndex) const { return mBucketCounts[aIndex]; }
+
+    uint64_t GetCount(void) const { return mCount; } ///< Returns the number of recorded values.
+    uint64_t GetSum(void) const { return mSum; }     ///< Returns the sum of recorded values.
+    uint32_t GetMax(void) const { return mMax; }     ///< Returns the maximum recorded value.
+
+private:
+    const uint32_t (*mUpperBounds)[kNumBuckets - 1];
+    uint32_t       mBucketCounts[kNumBuckets];
+    uint64_t       mCount;
+    uint64_t       mSum;
+    uint32_t       mMax;
+};
+
+/**
+ * This class implements a histogram of durations in microseconds.
+ */
+class DurationHistogram : public Histogram
+{
+public:
+    /**
+     * This constructor initializes an empty histogram with buckets from 100us to 100ms.
+     */
+    DurationHistogram(void);
+
+    /**
+     * This method records a duration to the histogram.
+     *
+     * @param[in] aDuration  The duration to record.
+     */
+    void Record(Microseconds aDuration);
+};
+
+/**
+ * This structure represents the statistics of the mainloop.
+ */
+struct MainloopStats
+{
+    /**
+     * This structure compares the names of mainloop processors by their contents.
+     */
+    struct NameLess
+    {
+        bool operator()(const char *aLhs, const char *aRhs) const { return strcmp(aLhs, aRhs) < 0; }
+    };
+
+    /**
+     * This structure represents the cost of a kind of mainloop processors.
+     */
+    struct ProcessorStats
+    {
+        DurationHistogram mUpdateTime;  ///< The time spent in `MainloopProcessor::Update()`.
+        DurationHistogram mProcessTime; ///< The time spent in `MainloopProcessor::Process()`.
+    };
+
+    MainloopStats(void);
+
+    /**
+     * This method clears all statistics.
+     */
+    void Clear(void);
+
+    uint64_t          mFdWakeupCount;      ///< The number of iterations woken up by a ready fd.
+    uint64_t          mTimeoutWakeupCount; ///< The number of iterations woken up by the timeout.
+    DurationHistogram mIterationTime;      ///< The time spent on an iteration, excluding waiting for events.
+    Histogram         mTaskQueueDepth;     ///< The number of ready tasks run by a `TaskRunner` in an iteration.
+    uint32_t          mMaxDelayedTasks;    ///< The maximum number of pending delayed tasks of a `TaskRunner`.
+
+    /**
+     * How late the iterations woken up by the timeout were woken up, which is the scheduling jitter of the mainloop
+     * thread.
+     */
+    DurationHistogram mWakeupLatency;
+
+    /**
+     * The statistics of mainloop processors, keyed by `MainloopProcessor::GetName()`. Processors of the same
+     * name, e.g. the REST connections, are accounted together. The names are string literals, so the keys are
+     * stored without copying.
+     */
+    std::map<const char *, ProcessorStats, NameLess> mProcessorStats;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_MAINLOOP_STATS_HPP_
@@ -0,0 +1,210 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "WATCHDOG"
+
+#include "common/mainloop_watchdog.hpp"
+
+#include <assert.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "common/thread_scheduling.hpp"
+
+namespace otbr {
+
+namespace {
+
+const char *GetBaseName(const char *aPath)
+{
+    const char *separator = strrchr(aPath, '/');
+
+    return separator != nullptr ? separator + 1 : aPath;
+}
+
+} // namespace
+
+MainloopWatchdog &MainloopWatchdog::Get(void)
+{
+    static MainloopWatchdog sWatchdog;
+
+    return sWatchdog;
+}
+
+MainloopWatchdog::MainloopWatchdog(void)
+    : mReportedSerial(0)
+    , mStallCounter(Metrics::Registry::Get().AddCounter("otbr_mainloop_stalls",
+                                                        "Mainloop processors or tasks which exceeded the watchdog "
+                                                        "threshold"))
+    , mThreshold(Milliseconds::zero())
+    , mStopping(false)
+    , mLastStall{nullptr, {nullptr, 0}, Milliseconds::zero()}
+{
+}
+
+MainloopWatchdog::~MainloopWatchdog(void)
+{
+    Stop();
+}
+
+void MainloopWatchdog::Start(Milliseconds aThreshold)
+{
+    std::lock_guard<std::mutex> _(mMutex);
+
+    assert(aThreshold > Milliseconds::zero());
+    VerifyOrExit(!mThread.joinable());
+
+    mThreshold = aThreshold;
+    mStopping  = false;
+    mThread    = std::thread(&MainloopWatchdog::Run, this);
+    otbrLogInfo("Started with threshold %lld ms", static_cast<long long>(aThreshold.count()));
+
+exit:
+    return;
+}
+
+void MainloopWatchdog::Stop(void)
+{
+    {
+        std::lock_guard<std::mutex> _(mMutex);
+
+        VerifyOrExit(mThread.joinable());
+        mStopping = true;
+    }
+
+    mCondition.notify_all();
+    mThread.join();
+
+exit:
+    return;
+}
+
+void MainloopWatchdog::EnterProcessor(const char *aName)
+{
+    Enter(mProcessor, aName, 0);
+}
+
+void MainloopWatchdog::LeaveProcessor(void)
+{
+    Leave(mProcessor);
+}
+
+void MainloopWatchdog::EnterTask(const SourceLocation &aLocation)
+{
+    Enter(mTask, aLocation.mFile, aLocation.mLine);
+}
+
+void MainloopWatchdog::LeaveTask(void)
+{
+    Leave(mTask);
+}
+
+MainloopWatchdog::Stall MainloopWatchdog::GetLastStall(void) const
+{
+    std::lock_guard<std::mutex> _(mMutex);
+
+    return mLastStall;
+}
+
+int64_t MainloopWatchdog::Now(void)
+{
+    return std::chrono::duration_cast<Milliseconds>(RealClock::now().time_since_epoch()).count();
+}
+
+void MainloopWatchdog::Enter(Activity &aActivity, const char *aFile, uint32_t aLine)
+{
+    aActivity.mSerial.fetch_add(1, std::memory_order_relaxed);
+    aActivity.mFile.store(aFile, std::memory_order_relaxed);
+    aActivity.mLine.store(aLine, std::memory_order_relaxed);
+    aActivity.mStartTime.store(Now(), std::memory_order_release);
+}
+
+void MainloopWatchdog::Leave(Activity &aActivity)
+{
+    aActivity.mStartTime.store(0, std::memory_order_release);
+}
+
+void MainloopWatchdog::Run(void)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    Milliseconds                 period = std::max(mThreshold / 4, Milliseconds(1));
+
+    // Pinned to the CPUs of a real-time mainloop, the watchdog couldn't report the mainloop stalling.
+    ThreadScheduling::Get().ApplyToManagementThread();
+
+    while (!mCondition.wait_for(lock, period, [this]() { return mStopping; }))
+    {
+        Check();
+    }
+}
+
+void MainloopWatchdog::Check(void)
+{
+    int64_t        now    = Now();
+    uint64_t       serial = mProcessor.mSerial.load(std::memory_order_acquire);
+    int64_t        start  = mProcessor.mStartTime.load(std::memory_order_acquire);
+    const char    *name   = mProcessor.mFile.load(std::memory_order_relaxed);
+    int64_t        taskStart;
+    SourceLocation taskLocation{nullptr, 0};
+
+    // A stalled processor is reported once.
+    VerifyOrExit(start != 0 && serial != mReportedSerial && now - start >= mThreshold.count());
+
+    taskStart = mTask.mStartTime.load(std::memory_order_acquire);
+    if (taskStart != 0)
+    {
+        taskLocation.mFile = mTask.mFile.load(std::memory_order_relaxed);
+        taskLocation.mLine = mTask.mLine.load(std::memory_order_relaxed);
+    }
+
+    // The processor has returned while the activity was being read.
+    VerifyOrExit(serial == mProcessor.mSerial.load(std::memory_order_acquire));
+
+    mReportedSerial = serial;
+    mLastStall      = {name, taskLocation, Milliseconds(now - start)};
+    mStallCount.fetch_add(1, std::memory_order_relaxed);
+    mStallCounter.Increment();
+
+    if (taskLocation.mFile != nullptr)
+    {
+        otbrLogWarning("Mainloop stalled: processor %s has run for %lld ms, in a task posted at %s:%u "
+                       "which has run for %lld ms",
+                       name, static_cast<long long>(now - start), GetBaseName(taskLocation.mFile),
+                       taskLocation.mLine, static_cast<long long>(now - taskStart));
+    }
+    else
+    {
+        otbrLogWarning("Mainloop stalled: processor %s has run for %lld ms", name, static_cast<long long>(now - start));
+    }
+
+exit:
+    return;
+}
+
+} // namespace otbr
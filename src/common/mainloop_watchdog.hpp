@@ -0,0 +1,174 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines the watchdog which detects stalls of the mainloop.
+ */
+
+#ifndef OTBR_COMMON_MAINLOOP_WATCHDOG_HPP_
+#define OTBR_COMMON_MAINLOOP_WATCHDOG_HPP_
+
+#include <openthread-br/config.h>
+
+#include <stdint.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "common/code_utils.hpp"
+#include "common/metrics.hpp"
+#include "common/time.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a watchdog which detects stalls of the mainloop.
+ *
+ * The mainloop reports the mainloop processor being processed and the task being run, and a watchdog thread checks
+ * periodically whether either of them has been running longer than the threshold. A stall is logged and counted once,
+ * attributed to the processor and to the location which posted the task.
+ *
+ * The `Enter*()` and `Leave*()` methods must be called on the mainloop thread, the other methods are thread-safe.
+ */
+class MainloopWatchdog : private NonCopyable
+{
+public:
+    /**
+     * This structure represents a stall of the mainloop.
+     */
+    struct Stall
+    {
+        const char    *mProcessorName; ///< The name of the stalled processor, `nullptr` if no stall is detected.
+        SourceLocation mTaskLocation; ///< The location which posted the stalled task, `mFile` is `nullptr` if none.
+        Milliseconds   mDuration;     ///< The time the processor had been running when the stall was detected.
+    };
+
+    /**
+     * This method returns the process-wide watchdog.
+     *
+     * @returns A reference to the watchdog.
+     */
+    static MainloopWatchdog &Get(void);
+
+    /**
+     * This destructor stops the watchdog thread.
+     */
+    ~MainloopWatchdog(void);
+
+    /**
+     * This method starts the watchdog thread.
+     *
+     * @param[in] aThreshold  The time a processor or a task may run before it's reported as a stall, not zero.
+     */
+    void Start(Milliseconds aThreshold);
+
+    /**
+     * This method stops the watchdog thread, it does nothing if the thread is not running.
+     */
+    void Stop(void);
+
+    /**
+     * This method reports that the mainloop starts processing a mainloop processor.
+     *
+     * @param[in] aName  The name of the processor, which must outlive the processing.
+     */
+    void EnterProcessor(const char *aName);
+
+    /**
+     * This method reports that the mainloop finishes processing the mainloop processor.
+     */
+    void LeaveProcessor(void);
+
+    /**
+     * This method reports that the mainloop starts running a task.
+     *
+     * @param[in] aLocation  The location which posted the task.
+     */
+    void EnterTask(const SourceLocation &aLocation);
+
+    /**
+     * This method reports that the mainloop finishes running the task.
+     */
+    void LeaveTask(void);
+
+    /**
+     * This method returns the number of stalls detected.
+     *
+     * @returns The number of stalls.
+     */
+    uint64_t GetStallCount(void) const { return mStallCount.load(std::memory_order_relaxed); }
+
+    /**
+     * This method returns the last stall detected.
+     *
+     * @returns The last stall, with `mProcessorName` set to `nullptr` if no stall is detected.
+     */
+    Stall GetLastStall(void) const;
+
+private:
+    // The activity of the mainloop, written by the mainloop thread and read by the watchdog thread. Each activity
+    // gets a new serial so that the watchdog detects activities changed while reading them.
+    struct Activity
+    {
+        std::atomic<uint64_t>     mSerial{0};
+        std::atomic<int64_t>      mStartTime{0}; // In steady clock milliseconds, zero when idle.
+        std::atomic<const char *> mFile{nullptr};
+        std::atomic<uint32_t>     mLine{0};
+    };
+
+    MainloopWatchdog(void);
+
+    static int64_t Now(void);
+
+    static void Enter(Activity &aActivity, const char *aFile, uint32_t aLine);
+    static void Leave(Activity &aActivity);
+
+    void Run(void);
+    void Check(void);
+
+    Activity mProcessor; // `mFile` holds the name of the processor.
+    Activity mTask;
+
+    std::atomic<uint64_t> mStallCount{0};
+    uint64_t              mReportedSerial;
+    Metrics::Counter     &mStallCounter;
+
+    std::thread             mThread;
+    mutable std::mutex      mMutex;
+    std::condition_variable mCondition;
+    Milliseconds            mThreshold;
+    bool                    mStopping;
+    Stall                   mLastStall;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_MAINLOOP_WATCHDOG_HPP_
@@ -0,0 +1,67 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the accounting of the memory used by the subsystems.
+ */
+
+#include "common/memory_usage.hpp"
+
+#include <algorithm>
+
+namespace otbr {
+
+MemoryUsageRegistry &MemoryUsageRegistry::Get(void)
+{
+    static MemoryUsageRegistry sRegistry;
+
+    return sRegistry;
+}
+
+void MemoryUsageRegistry::Add(const void *aOwner, const char *aName, Reporter aReporter)
+{
+    mEntries.push_back({aOwner, aName, std::move(aReporter)});
+}
+
+void MemoryUsageRegistry::Remove(const void *aOwner)
+{
+    mEntries.erase(std::remove_if(mEntries.begin(), mEntries.end(),
+                                  [aOwner](const Entry &aEntry) { return aEntry.mOwner == aOwner; }),
+                   mEntries.end());
+}
+
+void MemoryUsageRegistry::ForEach(const UsageHandler &aHandler) const
+{
+    for (const Entry &entry : mEntries)
+    {
+        aHandler(entry.mName, entry.mReporter());
+    }
+}
+
+} // namespace otbr
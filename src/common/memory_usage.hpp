@@ -0,0 +1,187 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines the accounting of the memory used by the subsystems.
+ */
+
+#ifndef OTBR_COMMON_MEMORY_USAGE_HPP_
+#define OTBR_COMMON_MEMORY_USAGE_HPP_
+
+#include <openthread-br/config.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/dns_name_key.hpp"
+
+namespace otbr {
+
+/**
+ * This structure represents the memory used by a container of a subsystem.
+ */
+struct MemoryUsage
+{
+    uint32_t mEntries; ///< The number of entries.
+    uint64_t mBytes;   ///< The estimated number of heap bytes used by the entries.
+};
+
+/**
+ * This function estimates the heap bytes used by a string.
+ *
+ * @param[in] aString  The string.
+ *
+ * @returns The capacity of @p aString if it is allocated on the heap, zero if it is stored inline.
+ */
+inline size_t EstimateHeapBytes(const std::string &aString)
+{
+    const char *data   = aString.data();
+    const char *object = reinterpret_cast<const char *>(&aString);
+
+    return (data >= object && data < object + sizeof(aString)) ? 0 : aString.capacity() + 1;
+}
+
+/**
+ * This function estimates the heap bytes used by the elements of a vector, excluding what the elements own.
+ *
+ * @param[in] aVector  The vector.
+ *
+ * @returns The estimated heap bytes.
+ */
+template <typename T> size_t EstimateHeapBytes(const std::vector<T> &aVector)
+{
+    return aVector.capacity() * sizeof(T);
+}
+
+/**
+ * This function estimates the heap bytes used by the nodes, buckets and keys of an unordered map, excluding what
+ * the mapped values own.
+ *
+ * @param[in] aMap  The unordered map.
+ *
+ * @returns The estimated heap bytes.
+ */
+template <typename Value> size_t EstimateHeapBytes(const std::unordered_map<std::string, Value> &aMap)
+{
+    // Each node holds the value, the cached hash and the link to the next node.
+    size_t bytes = aMap.bucket_count() * sizeof(void *) +
+                   aMap.size() * (sizeof(typename std::unordered_map<std::string, Value>::value_type) +
+                                  sizeof(size_t) + sizeof(void *));
+
+    for (const auto &entry : aMap)
+    {
+        bytes += EstimateHeapBytes(entry.first);
+    }
+
+    return bytes;
+}
+
+/**
+ * This function estimates the heap bytes used by the nodes and buckets of an unordered map keyed by DNS names,
+ * excluding what the mapped values own.
+ *
+ * The interned names are shared by all the containers keyed by them, so they are not attributed to any container.
+ *
+ * @param[in] aMap  The unordered map.
+ *
+ * @returns The estimated heap bytes.
+ */
+template <typename Value>
+size_t EstimateHeapBytes(const std::unordered_map<DnsNameKey, Value, DnsNameKey::Hash> &aMap)
+{
+    return aMap.bucket_count() * sizeof(void *) +
+           aMap.size() * (sizeof(typename std::unordered_map<DnsNameKey, Value, DnsNameKey::Hash>::value_type) +
+                          sizeof(size_t) + sizeof(void *));
+}
+
+/**
+ * This class collects the memory usage reported by the subsystems.
+ *
+ * A subsystem adds a reporter per major container when it's created and removes them when it's destroyed. The
+ * reporters are only invoked on demand, so the accounting costs nothing until it's queried. All methods must be
+ * called from the mainloop thread.
+ */
+class MemoryUsageRegistry : private NonCopyable
+{
+public:
+    typedef std::function<MemoryUsage(void)>                                  Reporter;
+    typedef std::function<void(const char *aName, const MemoryUsage &aUsage)> UsageHandler;
+
+    /**
+     * This method returns the process-wide registry.
+     *
+     * @returns A reference to the registry.
+     */
+    static MemoryUsageRegistry &Get(void);
+
+    /**
+     * This method adds a reporter.
+     *
+     * @param[in] aOwner     The owner of the reporter, used to remove it.
+     * @param[in] aName      The name of the container, which must outlive the reporter.
+     * @param[in] aReporter  The reporter, which returns the current memory usage of the container.
+     */
+    void Add(const void *aOwner, const char *aName, Reporter aReporter);
+
+    /**
+     * This method removes all reporters of an owner.
+     *
+     * @param[in] aOwner  The owner of the reporters.
+     */
+    void Remove(const void *aOwner);
+
+    /**
+     * This method invokes all reporters.
+     *
+     * @param[in] aHandler  The handler called with the name and the memory usage of each container.
+     */
+    void ForEach(const UsageHandler &aHandler) const;
+
+private:
+    struct Entry
+    {
+        const void *mOwner;
+        const char *mName;
+        Reporter    mReporter;
+    };
+
+    MemoryUsageRegistry(void) = default;
+
+    std::vector<Entry> mEntries;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_MEMORY_USAGE_HPP_
@@ -0,0 +1,228 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the metrics registry and its OpenMetrics text exposition.
+ */
+
+#include "common/metrics.hpp"
+
+#include <assert.h>
+
+namespace otbr {
+namespace Metrics {
+
+namespace {
+
+void AppendSample(std::string       &aOutput,
+                  const std::string &aName,
+                  const char        *aSuffix,
+                  const std::string &aLabels,
+                  const std::string &aValue)
+{
+    aOutput += aName;
+    aOutput += aSuffix;
+
+    if (!aLabels.empty())
+    {
+        aOutput += '{';
+        aOutput += aLabels;
+        aOutput += '}';
+    }
+
+    aOutput += ' ';
+    aOutput += aValue;
+    aOutput += '\n';
+}
+
+std::string JoinLabels(const std::string &aLabels, const std::string &aLabel)
+{
+    return aLabels.empty() ? aLabel : aLabels + "," + aLabel;
+}
+
+} // namespace
+
+void Counter::WriteSamples(const std::string &aName, const std::string &aLabels, std::string &aOutput) const
+{
+    AppendSample(aOutput, aName, "_total", aLabels, std::to_string(Get()));
+}
+
+void Gauge::WriteSamples(const std::string &aName, const std::string &aLabels, std::string &aOutput) const
+{
+    AppendSample(aOutput, aName, "", aLabels, std::to_string(Get()));
+}
+
+Histogram::Histogram(std::vector<uint64_t> aUpperBounds)
+    : mUpperBounds(std::move(aUpperBounds))
+    , mBuckets(new std::atomic<uint64_t>[mUpperBounds.size() + 1])
+    , mSum(0)
+{
+    for (size_t i = 0; i <= mUpperBounds.size(); i++)
+    {
+        mBuckets[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+void Histogram::Observe(uint64_t aValue)
+{
+    size_t index = 0;
+
+    while (index < mUpperBounds.size() && aValue > mUpperBounds[index])
+    {
+        index++;
+    }
+
+    mBuckets[index].fetch_add(1, std::memory_order_relaxed);
+    mSum.fetch_add(aValue, std::memory_order_relaxed);
+}
+
+uint64_t Histogram::GetCount(void) const
+{
+    uint64_t count = 0;
+
+    for (size_t i = 0; i <= mUpperBounds.size(); i++)
+    {
+        count += GetBucketCount(i);
+    }
+
+    return count;
+}
+
+void Histogram::WriteSamples(const std::string &aName, const std::string &aLabels, std::string &aOutput) const
+{
+    uint64_t count = 0;
+
+    for (size_t i = 0; i <= mUpperBounds.size(); i++)
+    {
+        std::string bound = i < mUpperBounds.size() ? std::to_string(mUpperBounds[i]) : "+Inf";
+
+        count += GetBucketCount(i);
+        AppendSample(aOutput, aName, "_bucket", JoinLabels(aLabels, "le=\"" + bound + "\""), std::to_string(count));
+    }
+
+    // The count is derived from the buckets so that it always equals the +Inf bucket.
+    AppendSample(aOutput, aName, "_count", aLabels, std::to_string(count));
+    AppendSample(aOutput, aName, "_sum", aLabels, std::to_string(GetSum()));
+}
+
+Registry &Registry::Get(void)
+{
+    static Registry sRegistry;
+
+    return sRegistry;
+}
+
+Counter &Registry::AddCounter(const char *aName, const char *aHelp, const char *aLabels)
+{
+    return Add<Counter>(kTypeCounter, aName, aHelp, aLabels);
+}
+
+Gauge &Registry::AddGauge(const char *aName, const char *aHelp, const char *aLabels)
+{
+    return Add<Gauge>(kTypeGauge, aName, aHelp, aLabels);
+}
+
+Histogram &Registry::AddHistogram(const char           *aName,
+                                  const char           *aHelp,
+                                  std::vector<uint64_t> aUpperBounds,
+                                  const char           *aLabels)
+{
+    return Add<Histogram>(kTypeHistogram, aName, aHelp, aLabels, std::move(aUpperBounds));
+}
+
+template <typename MetricType, typename... Args>
+MetricType &Registry::Add(Type aType, const char *aName, const char *aHelp, const char *aLabels, Args &&...aArgs)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    Family                     *family = nullptr;
+    MetricType                 *metric;
+
+    for (Family &existing : mFamilies)
+    {
+        if (existing.mName == aName)
+        {
+            // A name can't be used for metrics of different types.
+            assert(existing.mType == aType);
+            family = &existing;
+            break;
+        }
+    }
+
+    if (family == nullptr)
+    {
+        mFamilies.push_back({aName, aHelp, aType, {}});
+        family = &mFamilies.back();
+    }
+
+    for (Family::Child &child : family->mChildren)
+    {
+        if (child.mLabels == aLabels)
+        {
+            ExitNow(metric = static_cast<MetricType *>(child.mMetric.get()));
+        }
+    }
+
+    metric = new MetricType(std::forward<Args>(aArgs)...);
+    family->mChildren.push_back({aLabels, std::unique_ptr<Metric>(metric)});
+
+exit:
+    return *metric;
+}
+
+void Registry::WriteOpenMetrics(std::string &aOutput) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    for (const Family &family : mFamilies)
+    {
+        aOutput += "# TYPE " + family.mName + " " + TypeToString(family.mType) + "\n";
+        aOutput += "# HELP " + family.mName + " " + family.mHelp + "\n";
+
+        for (const Family::Child &child : family.mChildren)
+        {
+            child.mMetric->WriteSamples(family.mName, child.mLabels, aOutput);
+        }
+    }
+
+    aOutput += "# EOF\n";
+}
+
+const char *Registry::TypeToString(Type aType)
+{
+    static const char *const kTypeStrings[] = {
+        "counter",   // kTypeCounter
+        "gauge",     // kTypeGauge
+        "histogram", // kTypeHistogram
+    };
+
+    return kTypeStrings[aType];
+}
+
+} // namespace Metrics
+} // namespace otbr
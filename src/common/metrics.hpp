@@ -0,0 +1,305 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines the metrics registry and its OpenMetrics text exposition.
+ */
+
+#ifndef OTBR_COMMON_METRICS_HPP_
+#define OTBR_COMMON_METRICS_HPP_
+
+#include <openthread-br/config.h>
+
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace Metrics {
+
+/**
+ * This class is the base of the metrics kept by the registry.
+ */
+class Metric : private NonCopyable
+{
+public:
+    virtual ~Metric(void) = default;
+
+    /**
+     * This method appends the samples of the metric in the OpenMetrics text format.
+     *
+     * @param[in]  aName    The name of the metric family.
+     * @param[in]  aLabels  The labels of the metric, like `op="publish"`, or empty.
+     * @param[out] aOutput  The string to append the samples to.
+     */
+    virtual void WriteSamples(const std::string &aName, const std::string &aLabels, std::string &aOutput) const = 0;
+
+protected:
+    Metric(void) = default;
+};
+
+/**
+ * This class implements a monotonic counter.
+ *
+ * It may be updated from any thread without locking.
+ */
+class Counter : public Metric
+{
+public:
+    Counter(void)
+        : mValue(0)
+    {
+    }
+
+    /**
+     * This method increments the counter.
+     *
+     * @param[in] aDelta  The amount to add.
+     */
+    void Increment(uint64_t aDelta = 1) { mValue.fetch_add(aDelta, std::memory_order_relaxed); }
+
+    /**
+     * This method returns the value of the counter.
+     *
+     * @returns The value.
+     */
+    uint64_t Get(void) const { return mValue.load(std::memory_order_relaxed); }
+
+    void WriteSamples(const std::string &aName, const std::string &aLabels, std::string &aOutput) const override;
+
+private:
+    std::atomic<uint64_t> mValue;
+};
+
+/**
+ * This class implements a gauge, a value which may go up and down.
+ *
+ * It may be updated from any thread without locking.
+ */
+class Gauge : public Metric
+{
+public:
+    Gauge(void)
+        : mValue(0)
+    {
+    }
+
+    /**
+     * This method sets the value of the gauge.
+     *
+     * @param[in] aValue  The value.
+     */
+    void Set(int64_t aValue) { mValue.store(aValue, std::memory_order_relaxed); }
+
+    /**
+     * This method adds to the value of the gauge.
+     *
+     * @param[in] aDelta  The amount to add, which may be negative.
+     */
+    void Add(int64_t aDelta) { mValue.fetch_add(aDelta, std::memory_order_relaxed); }
+
+    /**
+     * This method returns the value of the gauge.
+     *
+     * @returns The value.
+     */
+    int64_t Get(void) const { return mValue.load(std::memory_order_relaxed); }
+
+    void WriteSamples(const std::string &aName, const std::string &aLabels, std::string &aOutput) const override;
+
+private:
+    std::atomic<int64_t> mValue;
+};
+
+/**
+ * This class implements a histogram with fixed buckets.
+ *
+ * It may be updated from any thread without locking. A scrape racing an observation may see the bucket and the sum
+ * of the observation in different states, which OpenMetrics tolerates.
+ */
+class Histogram : public Metric
+{
+public:
+    /**
+     * The constructor initializes the histogram.
+     *
+     * @param[in] aUpperBounds  The inclusive upper bounds of the buckets in ascending order, without the unbounded one.
+     */
+    explicit Histogram(std::vector<uint64_t> aUpperBounds);
+
+    /**
+     * This method records an observation.
+     *
+     * @param[in] aValue  The observed value.
+     */
+    void Observe(uint64_t aValue);
+
+    /**
+     * This method returns the number of observations.
+     *
+     * @returns The number of observations.
+     */
+    uint64_t GetCount(void) const;
+
+    /**
+     * This method returns the sum of the observations.
+     *
+     * @returns The sum of the observations.
+     */
+    uint64_t GetSum(void) const { return mSum.load(std::memory_order_relaxed); }
+
+    /**
+     * This method returns the number of observations in a bucket, not including the ones of the lower buckets.
+     *
+     * @param[in] aIndex  The index of the bucket, the last one being the unbounded one.
+     *
+     * @returns The number of observations in the bucket.
+     */
+    uint64_t GetBucketCount(size_t aIndex) const { return mBuckets[aIndex].load(std::memory_order_relaxed); }
+
+    void WriteSamples(const std::string &aName, const std::string &aLabels, std::string &aOutput) const override;
+
+private:
+    const std::vector<uint64_t>              mUpperBounds;
+    std::unique_ptr<std::atomic<uint64_t>[]> mBuckets;
+    std::atomic<uint64_t>                    mSum;
+};
+
+/**
+ * This class keeps the metrics of the process and writes them in the OpenMetrics text format.
+ *
+ * The modules add their metrics once and keep the returned references, which stay valid for the lifetime of the
+ * process, to update them in place. Adding a metric which already exists returns the existing one, so instances of a
+ * module share their metrics. Adding metrics and writing them are serialized by a lock, updating metrics is lock-free.
+ */
+class Registry : private NonCopyable
+{
+public:
+    /**
+     * This constructor initializes an empty registry.
+     *
+     * The modules use the process-wide registry returned by `Get()`, a separate registry is only useful to keep
+     * metrics apart from it.
+     */
+    Registry(void) = default;
+
+    /**
+     * This method returns the process-wide registry.
+     *
+     * @returns A reference to the registry.
+     */
+    static Registry &Get(void);
+
+    /**
+     * This method adds a counter.
+     *
+     * @param[in] aName    The name of the metric family, without the `_total` suffix.
+     * @param[in] aHelp    The description of the metric family, a single line without backslashes.
+     * @param[in] aLabels  The labels of the counter, like `op="publish",result="success"`, or empty.
+     *
+     * @returns A reference to the counter.
+     */
+    Counter &AddCounter(const char *aName, const char *aHelp, const char *aLabels = "");
+
+    /**
+     * This method adds a gauge.
+     *
+     * @param[in] aName    The name of the metric family.
+     * @param[in] aHelp    The description of the metric family, a single line without backslashes.
+     * @param[in] aLabels  The labels of the gauge, or empty.
+     *
+     * @returns A reference to the gauge.
+     */
+    Gauge &AddGauge(const char *aName, const char *aHelp, const char *aLabels = "");
+
+    /**
+     * This method adds a histogram.
+     *
+     * The buckets of an existing histogram are kept.
+     *
+     * @param[in] aName         The name of the metric family.
+     * @param[in] aHelp         The description of the metric family, a single line without backslashes.
+     * @param[in] aUpperBounds  The inclusive upper bounds of the buckets in ascending order.
+     * @param[in] aLabels       The labels of the histogram, or empty.
+     *
+     * @returns A reference to the histogram.
+     */
+    Histogram &AddHistogram(const char           *aName,
+                            const char           *aHelp,
+                            std::vector<uint64_t> aUpperBounds,
+                            const char           *aLabels = "");
+
+    /**
+     * This method writes all metrics in the OpenMetrics text format, terminated by `# EOF`.
+     *
+     * @param[out] aOutput  The string to append the metrics to.
+     */
+    void WriteOpenMetrics(std::string &aOutput) const;
+
+private:
+    enum Type : uint8_t
+    {
+        kTypeCounter,
+        kTypeGauge,
+        kTypeHistogram,
+    };
+
+    struct Family
+    {
+        struct Child
+        {
+            std::string             mLabels;
+            std::unique_ptr<Metric> mMetric;
+        };
+
+        std::string        mName;
+        std::string        mHelp;
+        Type               mType;
+        std::vector<Child> mChildren;
+    };
+
+    template <typename MetricType, typename... Args>
+    MetricType &Add(Type aType, const char *aName, const char *aHelp, const char *aLabels, Args &&...aArgs);
+
+    static const char *TypeToString(Type aType);
+
+    mutable std::mutex  mMutex;
+    std::vector<Family> mFamilies;
+};
+
+} // namespace Metrics
+} // namespace otbr
+
+#endif // OTBR_COMMON_METRICS_HPP_
@@ -0,0 +1,163 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines a lock-free multi-producer single-consumer queue.
+ */
+
+#ifndef OTBR_COMMON_MPSC_QUEUE_HPP_
+#define OTBR_COMMON_MPSC_QUEUE_HPP_
+
+#include <openthread-br/config.h>
+
+#include <atomic>
+#include <utility>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements an unbounded lock-free multi-producer single-consumer queue.
+ *
+ * `Push()` is wait-free and may be called from any thread concurrently. `Pop()` must only be called from a single
+ * consumer thread. The algorithm is the intrusive MPSC node-based queue by Dmitry Vyukov.
+ *
+ * @tparam T  The type of the elements, which must be default-constructible and movable.
+ */
+template <typename T> class MpscQueue : private NonCopyable
+{
+public:
+    /**
+     * This constructor initializes an empty queue.
+     */
+    MpscQueue(void)
+        : mHead(&mStub)
+        , mTail(&mStub)
+    {
+        mStub.mNext.store(nullptr, std::memory_order_relaxed);
+    }
+
+    /**
+     * This destructor frees all elements remaining in the queue.
+     */
+    ~MpscQueue(void)
+    {
+        T value;
+
+        while (Pop(value))
+        {
+        }
+    }
+
+    /**
+     * This method pushes an element to the back of the queue.
+     *
+     * It is safe to call this method in different threads concurrently.
+     *
+     * @param[in] aValue  The element to push.
+     */
+    void Push(T aValue) { PushNode(new Node(std::move(aValue))); }
+
+    /**
+     * This method pops an element from the front of the queue.
+     *
+     * This method may spuriously report an empty queue while a concurrent `Push()` is in progress, the element will
+     * be returned by a later call once the `Push()` completes.
+     *
+     * @param[out] aValue  The popped element.
+     *
+     * @retval TRUE   Successfully popped an element.
+     * @retval FALSE  The queue is empty.
+     */
+    bool Pop(T &aValue)
+    {
+        bool  popped = false;
+        Node *tail   = mTail;
+        Node *next   = tail->mNext.load(std::memory_order_acquire);
+
+        if (tail == &mStub)
+        {
+            VerifyOrExit(next != nullptr);
+            mTail = next;
+            tail  = next;
+            next  = next->mNext.load(std::memory_order_acquire);
+        }
+
+        if (next == nullptr)
+        {
+            // A producer has swapped `mHead` but not linked its node yet.
+            VerifyOrExit(tail == mHead.load(std::memory_order_acquire));
+
+            PushNode(&mStub);
+            next = tail->mNext.load(std::memory_order_acquire);
+            VerifyOrExit(next != nullptr);
+        }
+
+        mTail  = next;
+        aValue = std::move(tail->mValue);
+        delete tail;
+        popped = true;
+
+    exit:
+        return popped;
+    }
+
+private:
+    struct Node
+    {
+        Node(void) = default;
+
+        explicit Node(T aValue)
+            : mNext(nullptr)
+            , mValue(std::move(aValue))
+        {
+        }
+
+        std::atomic<Node *> mNext;
+        T                   mValue;
+    };
+
+    void PushNode(Node *aNode)
+    {
+        Node *prev;
+
+        aNode->mNext.store(nullptr, std::memory_order_relaxed);
+        prev = mHead.exchange(aNode, std::memory_order_acq_rel);
+        prev->mNext.store(aNode, std::memory_order_release);
+    }
+
+    std::atomic<Node *> mHead;
+    Node               *mTail;
+    Node                mStub;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_MPSC_QUEUE_HPP_
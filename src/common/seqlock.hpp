@@ -0,0 +1,138 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines a sequence lock publishing a value to readers on any thread.
+ */
+
+#ifndef OTBR_COMMON_SEQLOCK_HPP_
+#define OTBR_COMMON_SEQLOCK_HPP_
+
+#include <openthread-br/config.h>
+
+#include <atomic>
+#include <type_traits>
+
+#include <stdint.h>
+#include <string.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a sequence lock holding a copy of a trivially copyable value.
+ *
+ * `Store()` must only be called from a single writer thread, and never waits. `Load()` may be called from any thread
+ * concurrently and never blocks the writer: it copies the value and retries if the writer stored a new value in the
+ * meantime. The value is kept in relaxed atomic words, so the concurrent copies are not data races.
+ *
+ * @tparam T  The type of the value, which must be trivially copyable.
+ */
+template <typename T> class SeqLock : private NonCopyable
+{
+    static_assert(std::is_trivially_copyable<T>::value, "SeqLock only holds trivially copyable values");
+
+public:
+    /**
+     * This constructor initializes the sequence lock with a value of all zero bytes.
+     */
+    SeqLock(void)
+        : mSequence(0)
+    {
+        for (std::atomic<uint32_t> &word : mWords)
+        {
+            word.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * This method stores a new value.
+     *
+     * @param[in] aValue  The value.
+     */
+    void Store(const T &aValue)
+    {
+        uint32_t words[kNumWords] = {};
+        uint32_t sequence         = mSequence.load(std::memory_order_relaxed);
+
+        memcpy(words, &aValue, sizeof(T));
+
+        // An odd sequence tells the readers that the value is being written.
+        mSequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for (size_t i = 0; i < kNumWords; i++)
+        {
+            mWords[i].store(words[i], std::memory_order_relaxed);
+        }
+
+        mSequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    /**
+     * This method returns a consistent copy of the value last stored.
+     *
+     * @returns The value.
+     */
+    T Load(void) const
+    {
+        uint32_t words[kNumWords];
+        uint32_t before;
+        uint32_t after;
+        T        value;
+
+        do
+        {
+            before = mSequence.load(std::memory_order_acquire);
+
+            for (size_t i = 0; i < kNumWords; i++)
+            {
+                words[i] = mWords[i].load(std::memory_order_relaxed);
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = mSequence.load(std::memory_order_relaxed);
+        } while ((before & 1) != 0 || before != after);
+
+        memcpy(&value, words, sizeof(T));
+
+        return value;
+    }
+
+private:
+    static constexpr size_t kNumWords = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+    std::atomic<uint32_t> mSequence;
+    std::atomic<uint32_t> mWords[kNumWords];
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_SEQLOCK_HPP_
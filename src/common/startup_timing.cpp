@@ -0,0 +1,123 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the recorder of the startup phases of the agent.
+ */
+
+#define OTBR_LOG_TAG "STARTUP"
+
+#include "common/startup_timing.hpp"
+
+#include <stdio.h>
+
+#include "common/logging.hpp"
+
+namespace otbr {
+
+StartupTiming &StartupTiming::Get(void)
+{
+    static StartupTiming sStartupTiming;
+
+    return sStartupTiming;
+}
+
+StartupTiming::StartupTiming(void)
+{
+    Start();
+}
+
+void StartupTiming::Start(void)
+{
+    mStart = Clock::now();
+
+    for (uint8_t i = 0; i < kNumPhases; i++)
+    {
+        mMarked[i]    = false;
+        mElapsedMs[i] = 0;
+    }
+}
+
+bool StartupTiming::Mark(Phase aPhase)
+{
+    bool newlyMarked = !mMarked[aPhase];
+
+    VerifyOrExit(newlyMarked);
+
+    mMarked[aPhase]    = true;
+    mElapsedMs[aPhase] = static_cast<uint32_t>(std::chrono::duration_cast<Milliseconds>(Clock::now() - mStart).count());
+    otbrLogInfo("Startup phase %s completed at %u ms", PhaseToString(aPhase), mElapsedMs[aPhase]);
+
+exit:
+    return newlyMarked;
+}
+
+void StartupTiming::LogSummary(void) const
+{
+    char   summary[128];
+    size_t length = 0;
+
+    summary[0] = '\0';
+
+    for (uint8_t i = 0; i < kNumPhases && length < sizeof(summary); i++)
+    {
+        int written;
+
+        if (!mMarked[i])
+        {
+            continue;
+        }
+
+        written = snprintf(summary + length, sizeof(summary) - length, " %s=%ums",
+                           PhaseToString(static_cast<Phase>(i)), mElapsedMs[i]);
+        VerifyOrExit(written > 0);
+        length += static_cast<size_t>(written);
+    }
+
+exit:
+    otbrLogNotice("Startup timing:%s", summary);
+}
+
+const char *StartupTiming::PhaseToString(Phase aPhase)
+{
+    static const char *const kPhaseStrings[] = {
+        "logging",  // (0) kPhaseLoggingReady
+        "host",     // (1) kPhaseHostInitialized
+        "services", // (2) kPhaseServicesInitialized
+        "dbus",     // (3) kPhaseDBusReady
+        "ready",    // (4) kPhaseReady
+        "mdns",     // (5) kPhaseMdnsReady
+    };
+
+    static_assert(sizeof(kPhaseStrings) / sizeof(kPhaseStrings[0]) == kNumPhases, "kPhaseStrings is out of date");
+
+    return aPhase < kNumPhases ? kPhaseStrings[aPhase] : "unknown";
+}
+
+} // namespace otbr
@@ -0,0 +1,134 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines the recorder of the startup phases of the agent.
+ */
+
+#ifndef OTBR_COMMON_STARTUP_TIMING_HPP_
+#define OTBR_COMMON_STARTUP_TIMING_HPP_
+
+#include <openthread-br/config.h>
+
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+#include "common/time.hpp"
+
+namespace otbr {
+
+/**
+ * This class records when each startup phase of the agent completes, relative to the start of the process.
+ *
+ * The phases are marked from the mainloop thread.
+ */
+class StartupTiming : private NonCopyable
+{
+public:
+    /**
+     * The startup phases, in the order they are expected to complete.
+     */
+    enum Phase : uint8_t
+    {
+        kPhaseLoggingReady,        ///< The options are parsed and the logging is initialized.
+        kPhaseHostInitialized,     ///< The co-processor is reset and probed, and the settings are restored.
+        kPhaseServicesInitialized, ///< The Border Agent, proxies, Backbone Agent, REST and ubus are initialized.
+        kPhaseDBusReady,           ///< The D-Bus agent owns its name and serves requests.
+        kPhaseReady,               ///< The mainloop is about to run.
+        kPhaseMdnsReady,           ///< The mDNS publisher is connected to the mDNS daemon.
+        kNumPhases,
+    };
+
+    /**
+     * This method returns the process-wide startup timing.
+     *
+     * @returns A reference to the startup timing.
+     */
+    static StartupTiming &Get(void);
+
+    /**
+     * This method records the start of the process, which all phases are measured from.
+     *
+     * It also clears the phases marked before.
+     */
+    void Start(void);
+
+    /**
+     * This method marks a phase as completed now.
+     *
+     * @param[in] aPhase  The phase.
+     *
+     * @retval TRUE   The phase is newly marked.
+     * @retval FALSE  The phase was already marked, the earlier time is kept.
+     */
+    bool Mark(Phase aPhase);
+
+    /**
+     * This method indicates whether a phase is completed.
+     *
+     * @param[in] aPhase  The phase.
+     *
+     * @returns Whether @p aPhase is marked.
+     */
+    bool IsMarked(Phase aPhase) const { return mMarked[aPhase]; }
+
+    /**
+     * This method returns the time from the start of the process to the completion of a phase.
+     *
+     * @param[in] aPhase  The phase, which must be marked.
+     *
+     * @returns The elapsed time in milliseconds.
+     */
+    uint32_t GetElapsedMs(Phase aPhase) const { return mElapsedMs[aPhase]; }
+
+    /**
+     * This method logs the completed phases in a single line.
+     */
+    void LogSummary(void) const;
+
+    /**
+     * This method converts a phase to a short name.
+     *
+     * @param[in] aPhase  The phase.
+     *
+     * @returns The name of @p aPhase.
+     */
+    static const char *PhaseToString(Phase aPhase);
+
+private:
+    StartupTiming(void);
+
+    Timepoint mStart;
+    bool      mMarked[kNumPhases];
+    uint32_t  mElapsedMs[kNumPhases];
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_STARTUP_TIMING_HPP_
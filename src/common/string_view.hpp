@@ -0,0 +1,230 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the string view definition.
+ */
+
+#ifndef OTBR_COMMON_STRING_VIEW_HPP_
+#define OTBR_COMMON_STRING_VIEW_HPP_
+
+#include "openthread-br/config.h"
+
+#include <ctype.h>
+#include <stddef.h>
+#include <string.h>
+#include <string>
+
+namespace otbr {
+
+/**
+ * This class implements a non-owning reference to a sequence of characters.
+ *
+ * The project is built as C++11, which lacks `std::string_view`. The referenced characters are not NUL-terminated
+ * and must outlive the view.
+ */
+class StringView
+{
+public:
+    /**
+     * The constructor initializes an empty view.
+     */
+    StringView(void)
+        : mData("")
+        , mLength(0)
+    {
+    }
+
+    /**
+     * The constructor initializes a view of a NUL-terminated string.
+     *
+     * @param[in] aString  A pointer to the NUL-terminated string.
+     */
+    StringView(const char *aString)
+        : mData(aString)
+        , mLength(strlen(aString))
+    {
+    }
+
+    /**
+     * The constructor initializes a view of a sequence of characters.
+     *
+     * @param[in] aData    A pointer to the characters.
+     * @param[in] aLength  The number of the characters.
+     */
+    StringView(const char *aData, size_t aLength)
+        : mData(aData)
+        , mLength(aLength)
+    {
+    }
+
+    /**
+     * The constructor initializes a view of a string.
+     *
+     * @param[in] aString  The string, which must not be modified while the view is in use.
+     */
+    StringView(const std::string &aString)
+        : mData(aString.data())
+        , mLength(aString.size())
+    {
+    }
+
+    const char *Data(void) const { return mData; }
+    size_t      Size(void) const { return mLength; }
+    bool        IsEmpty(void) const { return mLength == 0; }
+    const char *begin(void) const { return mData; }
+    const char *end(void) const { return mData + mLength; }
+    char        operator[](size_t aIndex) const { return mData[aIndex]; }
+
+    /**
+     * This method returns the position of the first occurrence of a character.
+     *
+     * @param[in] aChar   The character to find.
+     * @param[in] aStart  The position to start from.
+     *
+     * @returns The position of @p aChar, or `std::string::npos` if it's absent.
+     */
+    size_t Find(char aChar, size_t aStart = 0) const
+    {
+        const void *found = aStart < mLength ? memchr(mData + aStart, aChar, mLength - aStart) : nullptr;
+
+        return found != nullptr ? static_cast<size_t>(static_cast<const char *>(found) - mData) : std::string::npos;
+    }
+
+    /**
+     * This method returns the position of the last occurrence of a character.
+     *
+     * @param[in] aChar  The character to find.
+     * @param[in] aEnd   The position to search backwards from, inclusive.
+     *
+     * @returns The position of @p aChar, or `std::string::npos` if it's absent.
+     */
+    size_t RFind(char aChar, size_t aEnd = std::string::npos) const
+    {
+        size_t pos = aEnd < mLength ? aEnd + 1 : mLength;
+
+        while (pos > 0)
+        {
+            if (mData[--pos] == aChar)
+            {
+                return pos;
+            }
+        }
+
+        return std::string::npos;
+    }
+
+    /**
+     * This method indicates whether this view ends with a character.
+     *
+     * @param[in] aChar  The character.
+     *
+     * @returns Whether the last character is @p aChar.
+     */
+    bool EndsWith(char aChar) const { return mLength > 0 && mData[mLength - 1] == aChar; }
+
+    /**
+     * This method returns a view of this view without its leading and trailing spaces and horizontal tabs.
+     *
+     * @returns The trimmed view.
+     */
+    StringView TrimSpaces(void) const
+    {
+        size_t start = 0;
+        size_t end   = mLength;
+
+        while (start < end && (mData[start] == ' ' || mData[start] == '\t'))
+        {
+            ++start;
+        }
+        while (end > start && (mData[end - 1] == ' ' || mData[end - 1] == '\t'))
+        {
+            --end;
+        }
+
+        return StringView(mData + start, end - start);
+    }
+
+    /**
+     * This method returns a view of a part of this view.
+     *
+     * @param[in] aStart   The position of the first character.
+     * @param[in] aLength  The maximum number of characters.
+     *
+     * @returns The view of at most @p aLength characters from @p aStart.
+     */
+    StringView Substr(size_t aStart, size_t aLength = std::string::npos) const
+    {
+        aStart = aStart < mLength ? aStart : mLength;
+
+        return StringView(mData + aStart, aLength < mLength - aStart ? aLength : mLength - aStart);
+    }
+
+    /**
+     * This method indicates whether this view equals another one ignoring the case of ASCII letters.
+     *
+     * @param[in] aOther  The other view.
+     *
+     * @retval TRUE   The views are equal ignoring case.
+     * @retval FALSE  The views are different.
+     */
+    bool EqualsIgnoreCase(const StringView &aOther) const
+    {
+        bool equal = (mLength == aOther.mLength);
+
+        for (size_t i = 0; equal && i < mLength; i++)
+        {
+            equal = tolower(static_cast<unsigned char>(mData[i])) ==
+                    tolower(static_cast<unsigned char>(aOther.mData[i]));
+        }
+
+        return equal;
+    }
+
+    /**
+     * This method returns a copy of the referenced characters.
+     *
+     * @returns A string contains the referenced characters.
+     */
+    std::string ToString(void) const { return std::string(mData, mLength); }
+
+    bool operator==(const StringView &aOther) const
+    {
+        return mLength == aOther.mLength && memcmp(mData, aOther.mData, mLength) == 0;
+    }
+    bool operator!=(const StringView &aOther) const { return !(*this == aOther); }
+
+private:
+    const char *mData;
+    size_t      mLength;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_STRING_VIEW_HPP_
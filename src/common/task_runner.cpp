@@ -34,16 +34,28 @@
 #include "common/task_runner.hpp"
 
 #include <algorithm>
+#include <limits>
 
 #include <fcntl.h>
 #include <unistd.h>
 
 #include "common/code_utils.hpp"
+#include "common/mainloop_watchdog.hpp"
+#include "common/trace.hpp"
+#if OTBR_ENABLE_MAINLOOP_STATS
+#include "common/mainloop_manager.hpp"
+#endif
 
 namespace otbr {
 
 TaskRunner::TaskRunner(void)
-    : mTaskQueue(DelayedTask::Comparator{})
+    : TaskRunner(DelayedTaskQueue::kHeap)
+{
+}
+
+TaskRunner::TaskRunner(DelayedTaskQueue aDelayedTaskQueue, Priority aPriority)
+    : MainloopProcessor(aPriority)
+    , mTaskQueue(DelayedTask::Comparator{})
 {
     int flags;
 
@@ -54,6 +66,11 @@ TaskRunner::TaskRunner(void)
     VerifyOrDie(fcntl(mEventFd[kRead], F_SETFL, flags | O_NONBLOCK) != -1, strerror(errno));
     flags = fcntl(mEventFd[kWrite], F_GETFL, 0);
     VerifyOrDie(fcntl(mEventFd[kWrite], F_SETFL, flags | O_NONBLOCK) != -1, strerror(errno));
+
+    if (aDelayedTaskQueue == DelayedTaskQueue::kTimerWheel)
+    {
+        mTimerWheel = MakeUnique<TimerWheel<PostedTask>>(Clock::now());
+    }
 }
 
 TaskRunner::~TaskRunner(void)
@@ -70,33 +87,46 @@ TaskRunner::~TaskRunner(void)
     }
 }
 
-void TaskRunner::Post(Task<void> aTask)
+void TaskRunner::Post(Task<void> aTask, const SourceLocation &aLocation)
 {
-    Post(Milliseconds::zero(), std::move(aTask));
+    mImmediateTaskQueue.Push(ImmediateTask{mNextTaskId++, Clock::now(), PostedTask{std::move(aTask), aLocation}});
+    WakeUp();
 }
 
-TaskRunner::TaskId TaskRunner::Post(Milliseconds aDelay, Task<void> aTask)
+TaskRunner::TaskId TaskRunner::Post(Milliseconds aDelay, Task<void> aTask, const SourceLocation &aLocation)
 {
-    return PushTask(aDelay, std::move(aTask));
+    return PushTask(aDelay, PostedTask{std::move(aTask), aLocation});
+}
+
+void TaskRunner::SetProcessBudget(uint32_t aMaxTasks, Milliseconds aMaxTime)
+{
+    mMaxTasksPerProcess = aMaxTasks;
+    mMaxTimePerProcess  = aMaxTime;
 }
 
 void TaskRunner::Update(MainloopContext &aMainloop)
 {
     aMainloop.AddFdToReadSet(mEventFd[kRead]);
 
+    if (mHasDeferredTasks)
+    {
+        aMainloop.mTimeout = {0, 0};
+    }
+    else
     {
         std::lock_guard<std::mutex> _(mTaskQueueMutex);
+        Timepoint                   deadline = GetNextDeadline();
 
-        if (!mTaskQueue.empty())
+        if (deadline != Timepoint::max())
         {
-            auto  now     = Clock::now();
-            auto &task    = mTaskQueue.top();
-            auto  delay   = std::chrono::duration_cast<Microseconds>(task.GetTimeExecute() - now);
-            auto  timeout = FromTimeval<Microseconds>(aMainloop.mTimeout);
+            auto now     = Clock::now();
+            auto delay   = Microseconds::zero();
+            auto timeout = FromTimeval<Microseconds>(aMainloop.mTimeout);
 
-            if (task.GetTimeExecute() < now)
+            if (deadline > now)
             {
-                delay = Microseconds::zero();
+                // Round up, so the mainloop doesn't wake up right before the deadline, e.g. in virtual time.
+                delay = std::chrono::duration_cast<Microseconds>(deadline - now - Clock::duration(1)) + Microseconds(1);
             }
 
             if (delay <= timeout)
@@ -108,12 +138,32 @@ void TaskRunner::Update(MainloopContext &aMainloop)
     }
 }
 
+Timepoint TaskRunner::GetNextDeadline(void) const
+{
+    Timepoint deadline = Timepoint::max();
+
+    if (mTimerWheel != nullptr)
+    {
+        deadline = mTimerWheel->GetNextDeadline();
+    }
+    else if (!mTaskQueue.empty())
+    {
+        deadline = mTaskQueue.top().GetTimeExecute();
+    }
+
+    return deadline;
+}
+
 void TaskRunner::Process(const MainloopContext &aMainloop)
 {
     OTBR_UNUSED_VARIABLE(aMainloop);
 
     ssize_t rval;
 
+    // Clear the flag before draining the pipe and popping tasks, so that a task posted
+    // concurrently is either popped below or wakes up the mainloop again.
+    mWakeUpPending.store(false);
+
     // Read any data in the pipe.
     do
     {
@@ -128,21 +178,39 @@ void TaskRunner::Process(const MainloopContext &aMainloop)
     PopTasks();
 }
 
-TaskRunner::TaskId TaskRunner::PushTask(Milliseconds aDelay, Task<void> aTask)
+TaskRunner::TaskId TaskRunner::PushTask(Milliseconds aDelay, PostedTask aTask)
 {
-    ssize_t       rval;
-    const uint8_t kOne = 1;
-    TaskId        taskId;
+    TaskId taskId;
 
     {
         std::lock_guard<std::mutex> _(mTaskQueueMutex);
 
         taskId = mNextTaskId++;
 
-        mActiveTaskIds.insert(taskId);
-        mTaskQueue.emplace(taskId, aDelay, std::move(aTask));
+        if (mTimerWheel != nullptr)
+        {
+            mTimerWheel->Add(taskId, Clock::now() + aDelay, std::move(aTask));
+        }
+        else
+        {
+            mActiveTaskIds.insert(taskId);
+            mTaskQueue.emplace(taskId, aDelay, std::move(aTask));
+        }
     }
 
+    WakeUp();
+
+    return taskId;
+}
+
+void TaskRunner::WakeUp(void)
+{
+    ssize_t       rval;
+    const uint8_t kOne = 1;
+
+    // The mainloop has been woken up but not processed tasks yet.
+    VerifyOrExit(!mWakeUpPending.exchange(true));
+
     do
     {
         rval = write(mEventFd[kWrite], &kOne, sizeof(kOne));
@@ -158,47 +226,114 @@ TaskRunner::TaskId TaskRunner::PushTask(Milliseconds aDelay, Task<void> aTask)
     otbrLogWarning("Failed to write fd %d: %s", mEventFd[kWrite], strerror(errno));
 
 exit:
-    return taskId;
+    return;
 }
 
 void TaskRunner::Cancel(TaskRunner::TaskId aTaskId)
 {
     std::lock_guard<std::mutex> _(mTaskQueueMutex);
 
-    mActiveTaskIds.erase(aTaskId);
+    if (mTimerWheel != nullptr)
+    {
+        mTimerWheel->Cancel(aTaskId);
+    }
+    else
+    {
+        mActiveTaskIds.erase(aTaskId);
+    }
 }
 
 void TaskRunner::PopTasks(void)
 {
-    while (true)
+    PostedTask task;
+    bool       popped;
+    uint32_t   count = 0;
+    Timepoint  start = (mMaxTimePerProcess != Milliseconds::zero()) ? RealClock::now() : Timepoint();
+
+    mHasDeferredTasks = false;
+
+    do
     {
-        Task<void> task;
-        bool       canceled;
+        popped = false;
 
-        // The braces here are necessary for auto-releasing of the mutex.
+        if (!mHasNextImmediateTask)
         {
-            std::lock_guard<std::mutex> _(mTaskQueueMutex);
-
-            if (!mTaskQueue.empty() && mTaskQueue.top().GetTimeExecute() <= Clock::now())
-            {
-                const DelayedTask &top    = mTaskQueue.top();
-                TaskId             taskId = top.mTaskId;
+            mHasNextImmediateTask = mImmediateTaskQueue.Pop(mNextImmediateTask);
+        }
 
-                task = std::move(top.mTask);
-                mTaskQueue.pop();
-                canceled = (mActiveTaskIds.erase(taskId) == 0);
-            }
-            else
-            {
-                break;
-            }
+        // Merge the two queues as if the immediate tasks were delayed tasks without delay, so the tasks run
+        // in the order of posting and neither of the queues starves the other.
+        if (mHasNextImmediateTask ? PopTask(mNextImmediateTask.mTimePosted, mNextImmediateTask.mTaskId, task)
+                                  : PopTask(Clock::now(), std::numeric_limits<TaskId>::max(), task))
+        {
+            OTBR_TRACE_SCOPE("task.delayed");
+            RunTask(task);
+            popped = true;
+            ++count;
+        }
+        else if (mHasNextImmediateTask)
+        {
+            OTBR_TRACE_SCOPE("task.immediate");
+            mHasNextImmediateTask = false;
+            RunTask(mNextImmediateTask.mTask);
+            popped = true;
+            ++count;
         }
 
-        if (!canceled)
+        if (popped && ((mMaxTasksPerProcess != 0 && count >= mMaxTasksPerProcess) ||
+                       (mMaxTimePerProcess != Milliseconds::zero() && RealClock::now() - start >= mMaxTimePerProcess)))
         {
-            task();
+            mHasDeferredTasks = true;
+            break;
         }
+    } while (popped);
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+    {
+        std::lock_guard<std::mutex> _(mTaskQueueMutex);
+        size_t                      delayedTasks;
+
+        delayedTasks = (mTimerWheel != nullptr) ? mTimerWheel->GetSize() : mActiveTaskIds.size();
+
+        MainloopManager::GetInstance().RecordTaskQueueDepth(count, static_cast<uint32_t>(delayedTasks));
+    }
+#endif
+}
+
+bool TaskRunner::PopTask(Timepoint aBeforeTime, TaskId aBeforeTaskId, PostedTask &aTask)
+{
+    std::lock_guard<std::mutex> _(mTaskQueueMutex);
+    bool                        found = false;
+
+    if (mTimerWheel != nullptr)
+    {
+        ExitNow(found = mTimerWheel->PopEarlierThan(aBeforeTime, aBeforeTaskId, aTask));
+    }
+
+    while (!found && !mTaskQueue.empty() &&
+           (mTaskQueue.top().GetTimeExecute() < aBeforeTime ||
+            (mTaskQueue.top().GetTimeExecute() == aBeforeTime && mTaskQueue.top().mTaskId < aBeforeTaskId)))
+    {
+        // The task is moved out of the top element which is popped immediately.
+        DelayedTask &top    = const_cast<DelayedTask &>(mTaskQueue.top());
+        TaskId       taskId = top.mTaskId;
+
+        aTask = std::move(top.mTask);
+        mTaskQueue.pop();
+
+        // Skip the canceled tasks.
+        found = (mActiveTaskIds.erase(taskId) != 0);
     }
+
+exit:
+    return found;
+}
+
+void TaskRunner::RunTask(PostedTask &aTask)
+{
+    MainloopWatchdog::Get().EnterTask(aTask.mLocation);
+    aTask.mTask();
+    MainloopWatchdog::Get().LeaveTask();
 }
 
 } // namespace otbr
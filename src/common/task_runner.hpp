@@ -36,19 +36,211 @@
 
 #include <openthread-br/config.h>
 
+#include <atomic>
 #include <chrono>
-#include <functional>
-#include <future>
+#include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <set>
 
+#include "common/callback.hpp"
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/mpsc_queue.hpp"
 #include "common/time.hpp"
+#include "common/timer_wheel.hpp"
+#include "common/types.hpp"
 
 namespace otbr {
 
+class TaskRunner;
+
+/**
+ * This class implements a cancellable future of a task posted by `TaskRunner::PostWithFuture()`.
+ *
+ * The result type must be default-constructible.
+ */
+template <class T> class TaskFuture
+{
+    friend class TaskRunner;
+
+public:
+    /**
+     * This constructor initializes an invalid future.
+     */
+    TaskFuture(void) = default;
+
+    /**
+     * This method indicates whether the future is associated with a task.
+     *
+     * @returns Whether the future is valid.
+     */
+    bool IsValid(void) const { return mState != nullptr; }
+
+    /**
+     * This method waits for the result of the task.
+     *
+     * The result can only be retrieved once.
+     *
+     * @param[in]  aTimeout  The maximum time to wait.
+     * @param[out] aResult   A reference to receive the result of the task.
+     *
+     * @retval OTBR_ERROR_NONE           The task is done and @p aResult is set.
+     * @retval OTBR_ERROR_TIMEOUT        The task is not done within @p aTimeout.
+     * @retval OTBR_ERROR_ABORTED        The task has been canceled.
+     * @retval OTBR_ERROR_INVALID_STATE  The future is invalid or the result has been retrieved.
+     */
+    otbrError WaitFor(Milliseconds aTimeout, T &aResult)
+    {
+        otbrError error = OTBR_ERROR_NONE;
+
+        VerifyOrExit(IsValid(), error = OTBR_ERROR_INVALID_STATE);
+
+        {
+            std::unique_lock<std::mutex> lock(mState->mMutex);
+
+            VerifyOrExit(mState->mCondition.wait_for(lock, aTimeout, [this]() { return mState->IsFinished(); }),
+                         error = OTBR_ERROR_TIMEOUT);
+            error = mState->Retrieve(aResult);
+        }
+
+    exit:
+        return error;
+    }
+
+    /**
+     * This method waits for the result of the task without a timeout.
+     *
+     * The result can only be retrieved once.
+     *
+     * @param[out] aResult  A reference to receive the result of the task.
+     *
+     * @retval OTBR_ERROR_NONE           The task is done and @p aResult is set.
+     * @retval OTBR_ERROR_ABORTED        The task has been canceled.
+     * @retval OTBR_ERROR_INVALID_STATE  The future is invalid or the result has been retrieved.
+     */
+    otbrError Wait(T &aResult)
+    {
+        otbrError error = OTBR_ERROR_NONE;
+
+        VerifyOrExit(IsValid(), error = OTBR_ERROR_INVALID_STATE);
+
+        {
+            std::unique_lock<std::mutex> lock(mState->mMutex);
+
+            mState->mCondition.wait(lock, [this]() { return mState->IsFinished(); });
+            error = mState->Retrieve(aResult);
+        }
+
+    exit:
+        return error;
+    }
+
+    /**
+     * This method cancels the task if it has not started running.
+     *
+     * @retval TRUE   The task is canceled and will never run.
+     * @retval FALSE  The task is running or done, or the future is invalid.
+     */
+    bool Cancel(void)
+    {
+        bool canceled = false;
+
+        VerifyOrExit(IsValid());
+
+        {
+            std::lock_guard<std::mutex> _(mState->mMutex);
+
+            if (mState->mStatus == Status::kPending || mState->mStatus == Status::kCanceled)
+            {
+                mState->mStatus = Status::kCanceled;
+                canceled        = true;
+            }
+        }
+
+    exit:
+        return canceled;
+    }
+
+private:
+    enum class Status : uint8_t
+    {
+        kPending,
+        kRunning,
+        kDone,
+        kCanceled,
+        kRetrieved,
+    };
+
+    // The state shared by the future and the posted task.
+    struct State
+    {
+        explicit State(UniqueFunction<T(void)> aTask)
+            : mStatus(Status::kPending)
+            , mTask(std::move(aTask))
+        {
+        }
+
+        void Run(void)
+        {
+            UniqueFunction<T(void)> task;
+            T                       result;
+
+            {
+                std::lock_guard<std::mutex> _(mMutex);
+
+                VerifyOrExit(mStatus == Status::kPending);
+                mStatus = Status::kRunning;
+                task    = std::move(mTask);
+            }
+
+            result = task();
+
+            {
+                std::lock_guard<std::mutex> _(mMutex);
+
+                mResult = std::move(result);
+                mStatus = Status::kDone;
+                mCondition.notify_all();
+            }
+
+        exit:
+            return;
+        }
+
+        // The following methods must be called with `mMutex` locked.
+        bool IsFinished(void) const { return mStatus != Status::kPending && mStatus != Status::kRunning; }
+
+        otbrError Retrieve(T &aResult)
+        {
+            otbrError error = OTBR_ERROR_NONE;
+
+            VerifyOrExit(mStatus != Status::kCanceled, error = OTBR_ERROR_ABORTED);
+            VerifyOrExit(mStatus != Status::kRetrieved, error = OTBR_ERROR_INVALID_STATE);
+
+            aResult = std::move(mResult);
+            mStatus = Status::kRetrieved;
+
+        exit:
+            return error;
+        }
+
+        std::mutex              mMutex;
+        std::condition_variable mCondition;
+        Status                  mStatus;
+        UniqueFunction<T(void)> mTask;
+        T                       mResult;
+    };
+
+    explicit TaskFuture(std::shared_ptr<State> aState)
+        : mState(std::move(aState))
+    {
+    }
+
+    std::shared_ptr<State> mState;
+};
+
 /**
  * This class implements the Task Runner that executes
  * tasks on the mainloop.
@@ -58,8 +250,10 @@ class TaskRunner : public MainloopProcessor, private NonCopyable
 public:
     /**
      * This type represents the generic executable task.
+     *
+     * A task is move-only and small captures are stored inline, so posting a task doesn't allocate in common cases.
      */
-    template <class T> using Task = std::function<T(void)>;
+    template <class T> using Task = UniqueFunction<T(void)>;
 
     /**
      * This type represents a unique task ID to an delayed task.
@@ -69,10 +263,29 @@ public:
     typedef uint64_t TaskId;
 
     /**
-     * This constructor initializes the Task Runner instance.
+     * This enumeration represents the data structure holding the delayed tasks.
+     */
+    enum class DelayedTaskQueue : uint8_t
+    {
+        kHeap,       ///< A binary heap, canceled tasks are dropped when they expire.
+        kTimerWheel, ///< A hierarchical timer wheel with O(1) insert and cancel.
+    };
+
+    /**
+     * This constructor initializes the Task Runner instance with a heap for delayed tasks.
      */
     TaskRunner(void);
 
+    /**
+     * This constructor initializes the Task Runner instance.
+     *
+     * The timer wheel is preferred when many delayed tasks are posted and canceled, e.g. lease and retry timers.
+     *
+     * @param[in] aDelayedTaskQueue  The data structure to hold delayed tasks.
+     * @param[in] aPriority          The mainloop priority of the tasks.
+     */
+    explicit TaskRunner(DelayedTaskQueue aDelayedTaskQueue, Priority aPriority = kPriorityNetwork);
+
     /**
      * This destructor destroys the Task Runner instance.
      */
@@ -82,24 +295,30 @@ public:
      * This method posts a task to the task runner and returns immediately.
      *
      * Tasks are executed sequentially and follow the First-Come-First-Serve rule.
-     * It is safe to call this method in different threads concurrently.
+     * It is safe to call this method in different threads concurrently. This method doesn't take any lock and only
+     * wakes up the mainloop if it has not been woken up since the last time tasks were processed.
      *
-     * @param[in] aTask  The task to be executed.
+     * @param[in] aTask      The task to be executed.
+     * @param[in] aLocation  The location which posts the task, reported by the mainloop watchdog.
      */
-    void Post(Task<void> aTask);
+    void Post(Task<void> aTask, const SourceLocation &aLocation = SourceLocation::Current());
 
     /**
      * This method posts a task to the task runner and returns immediately.
      *
-     * The task will be executed on the mainloop after `aDelay` milliseconds from now.
+     * The task will be executed on the mainloop after `aDelay` milliseconds from now. Once expired, it's executed
+     * in the order of its deadline among the tasks posted without delay, so `Post(a)` followed by
+     * `Post(Milliseconds(0), b)` in the same thread executes `a` before `b`, and `b` before `a` if posted the other
+     * way round.
      * It is safe to call this method in different threads concurrently.
      *
-     * @param[in] aDelay  The delay before executing the task (in milliseconds).
-     * @param[in] aTask   The task to be executed.
+     * @param[in] aDelay     The delay before executing the task (in milliseconds).
+     * @param[in] aTask      The task to be executed.
+     * @param[in] aLocation  The location which posts the task, reported by the mainloop watchdog.
      *
      * @returns  The unique task ID of the delayed task.
      */
-    TaskId Post(Milliseconds aDelay, Task<void> aTask);
+    TaskId Post(Milliseconds aDelay, Task<void> aTask, const SourceLocation &aLocation = SourceLocation::Current());
 
     /**
      * This method cancels a delayed task from the task runner.
@@ -114,21 +333,114 @@ public:
      *
      * Tasks are executed sequentially and follow the First-Come-First-Serve rule.
      * This method must be called in a thread other than the mainloop thread. Otherwise,
-     * the caller will be blocked forever.
+     * the caller will be blocked forever. The result type must be default-constructible.
+     *
+     * @param[in] aTask      The task to be executed.
+     * @param[in] aLocation  The location which posts the task, reported by the mainloop watchdog.
      *
      * @returns The result returned by the task @p aTask.
      */
-    template <class T> T PostAndWait(const Task<T> &aTask)
+    template <class T> T PostAndWait(const Task<T> &aTask, const SourceLocation &aLocation = SourceLocation::Current())
     {
-        std::promise<T> pro;
+        std::mutex              mutex;
+        std::condition_variable condition;
+        bool                    done = false;
+        T                       result;
 
-        Post([&pro, &aTask]() { pro.set_value(aTask()); });
+        // The state lives on the stack of the waiting thread, which doesn't return
+        // before the task releases `mutex`.
+        Post(
+            [&]() {
+                T                           value = aTask();
+                std::lock_guard<std::mutex> _(mutex);
 
-        return pro.get_future().get();
+                result = std::move(value);
+                done   = true;
+                condition.notify_one();
+            },
+            aLocation);
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+
+            condition.wait(lock, [&done]() { return done; });
+        }
+
+        return result;
     }
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    /**
+     * This method posts a task and returns a future of its result.
+     *
+     * Tasks are executed sequentially and follow the First-Come-First-Serve rule.
+     * It is safe to call this method in different threads concurrently. The result type must be
+     * default-constructible.
+     *
+     * @param[in] aTask      The task to be executed.
+     * @param[in] aLocation  The location which posts the task, reported by the mainloop watchdog.
+     *
+     * @returns A future to wait for the result or cancel the task.
+     */
+    template <class T>
+    TaskFuture<T> PostWithFuture(Task<T> aTask, const SourceLocation &aLocation = SourceLocation::Current())
+    {
+        auto state = std::make_shared<typename TaskFuture<T>::State>(std::move(aTask));
+
+        Post([state]() { state->Run(); }, aLocation);
+
+        return TaskFuture<T>(std::move(state));
+    }
+
+    /**
+     * This method posts a task and waits for the completion of the task with a timeout.
+     *
+     * Unlike `PostAndWait()`, this method returns if the mainloop doesn't start the task within the timeout,
+     * in which case the task is canceled and will never run. A task which has already started when the
+     * timeout expires is waited for until it's done, so the task may capture the caller's stack by reference.
+     * This method must be called in a thread other than the mainloop thread. The result type must be
+     * default-constructible.
+     *
+     * @param[in]  aTimeout   The maximum time to wait.
+     * @param[in]  aTask      The task to be executed.
+     * @param[out] aResult    A reference to receive the result of the task.
+     * @param[in]  aLocation  The location which posts the task, reported by the mainloop watchdog.
+     *
+     * @retval OTBR_ERROR_NONE     The task is done and @p aResult is set.
+     * @retval OTBR_ERROR_TIMEOUT  The task is not started within @p aTimeout and has been canceled.
+     */
+    template <class T>
+    otbrError PostAndWaitFor(Milliseconds          aTimeout,
+                             Task<T>               aTask,
+                             T                    &aResult,
+                             const SourceLocation &aLocation = SourceLocation::Current())
+    {
+        TaskFuture<T> future = PostWithFuture(std::move(aTask), aLocation);
+        otbrError     error  = future.WaitFor(aTimeout, aResult);
+
+        if (error == OTBR_ERROR_TIMEOUT && !future.Cancel())
+        {
+            // The task is running or has been done right after the timeout, it may still be
+            // referring to the stack of the caller.
+            error = future.Wait(aResult);
+        }
+
+        return error;
+    }
+
+    /**
+     * This method sets the budget of executing tasks in one mainloop iteration.
+     *
+     * Tasks beyond the budget are deferred to the next mainloop iteration, which then starts without
+     * waiting. This bounds the delay a flood of tasks adds to other mainloop processors, e.g. the radio.
+     *
+     * @param[in] aMaxTasks  The maximum number of tasks to execute in one iteration, zero for unlimited.
+     * @param[in] aMaxTime   The maximum time to spend on tasks in one iteration, zero for unlimited.
+     */
+    void SetProcessBudget(uint32_t aMaxTasks, Milliseconds aMaxTime);
+
+    const char *GetName(void) const override { return "TaskRunner"; }
+    void        Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
 
 private:
     enum
@@ -137,6 +449,22 @@ private:
         kWrite = 1,
     };
 
+    // A task with the location which posted it.
+    struct PostedTask
+    {
+        Task<void>     mTask;
+        SourceLocation mLocation;
+    };
+
+    // A task to be executed without delay. It's ordered among the expired delayed tasks as if it were
+    // a delayed task posted at `mTimePosted` with no delay.
+    struct ImmediateTask
+    {
+        TaskId     mTaskId;
+        Timepoint  mTimePosted;
+        PostedTask mTask;
+    };
+
     struct DelayedTask
     {
         friend class Comparator;
@@ -146,7 +474,7 @@ private:
             bool operator()(const DelayedTask &aLhs, const DelayedTask &aRhs) const { return aRhs < aLhs; }
         };
 
-        DelayedTask(TaskId aTaskId, Milliseconds aDelay, Task<void> aTask)
+        DelayedTask(TaskId aTaskId, Milliseconds aDelay, PostedTask aTask)
             : mTaskId(aTaskId)
             , mDeadline(Clock::now() + aDelay)
             , mTask(std::move(aTask))
@@ -162,24 +490,47 @@ private:
 
         TaskId     mTaskId;
         Timepoint  mDeadline;
-        Task<void> mTask;
+        PostedTask mTask;
     };
 
-    TaskId PushTask(Milliseconds aDelay, Task<void> aTask);
-    void   PopTasks(void);
+    TaskId    PushTask(Milliseconds aDelay, PostedTask aTask);
+    void      WakeUp(void);
+    void      PopTasks(void);
+    bool      PopTask(Timepoint aBeforeTime, TaskId aBeforeTaskId, PostedTask &aTask);
+    void      RunTask(PostedTask &aTask);
+    Timepoint GetNextDeadline(void) const;
 
     // The event fds which are used to wakeup the mainloop
     // when there are pending tasks in the task queue.
     int mEventFd[2];
 
+    // Whether the `mEventFd` has been written since the last time it was drained.
+    std::atomic_bool mWakeUpPending{false};
+
+    // The queue of tasks to be executed without delay, and its head which is popped but waits for the
+    // delayed tasks ordered before it.
+    MpscQueue<ImmediateTask> mImmediateTaskQueue;
+    ImmediateTask            mNextImmediateTask;
+    bool                     mHasNextImmediateTask = false;
+
     std::priority_queue<DelayedTask, std::vector<DelayedTask>, DelayedTask::Comparator> mTaskQueue;
 
     std::set<TaskId> mActiveTaskIds;
-    TaskId           mNextTaskId = 1;
 
-    // The mutex which protects the `mTaskQueue` from being
+    // The ID of the next immediate or delayed task, which also orders the tasks posted at the same time.
+    std::atomic<TaskId> mNextTaskId{1};
+
+    // The budget of executing tasks in one mainloop iteration.
+    uint32_t     mMaxTasksPerProcess = 0;
+    Milliseconds mMaxTimePerProcess  = Milliseconds::zero();
+    bool         mHasDeferredTasks   = false;
+
+    // The timer wheel which replaces `mTaskQueue` when `DelayedTaskQueue::kTimerWheel` is used.
+    std::unique_ptr<TimerWheel<PostedTask>> mTimerWheel;
+
+    // The mutex which protects the `mTaskQueue` and `mTimerWheel` from being
     // simultaneously accessed by multiple threads.
-    std::mutex mTaskQueueMutex;
+    mutable std::mutex mTaskQueueMutex;
 };
 
 } // namespace otbr
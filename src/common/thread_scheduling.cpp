@@ -0,0 +1,264 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the scheduling settings of the agent threads.
+ */
+
+#define OTBR_LOG_TAG "SCHED"
+
+#include "common/thread_scheduling.hpp"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef __linux__
+#include <pthread.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+
+#include "common/logging.hpp"
+
+namespace otbr {
+
+namespace {
+
+constexpr int  kMinNice = -20;
+constexpr int  kMaxNice = 19;
+constexpr long kMaxCpus = 1024;
+
+bool IsValidNice(int aNice)
+{
+    return kMinNice <= aNice && aNice <= kMaxNice;
+}
+
+#ifdef __linux__
+// The nice value is an attribute of each thread on Linux, which is addressed by its thread id.
+int SetThreadNice(int aNice)
+{
+    return setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), aNice);
+}
+#endif
+
+} // namespace
+
+constexpr int ThreadScheduling::kDefaultNice;
+
+ThreadScheduling &ThreadScheduling::Get(void)
+{
+    static ThreadScheduling sThreadScheduling;
+
+    return sThreadScheduling;
+}
+
+ThreadScheduling::ThreadScheduling(void)
+    : mManagementNice(kDefaultNice)
+    , mIsMainloopAdjusted(false)
+{
+#ifdef __linux__
+    CPU_ZERO(&mInitialCpus);
+    if (sched_getaffinity(0, sizeof(mInitialCpus), &mInitialCpus) != 0)
+    {
+        otbrLogWarning("Failed to get the CPU affinity: %s", strerror(errno));
+    }
+#endif
+}
+
+bool ThreadScheduling::ParseCpuList(const char *aList, std::vector<int> &aCpus)
+{
+    bool        succeeded = false;
+    const char *cursor    = aList;
+
+    aCpus.clear();
+
+    while (true)
+    {
+        char *end;
+        long  first = strtol(cursor, &end, 10);
+        long  last;
+
+        VerifyOrExit(end != cursor && first >= 0);
+        cursor = end;
+        last   = first;
+
+        if (*cursor == '-')
+        {
+            last = strtol(cursor + 1, &end, 10);
+            VerifyOrExit(end != cursor + 1 && last >= first);
+            cursor = end;
+        }
+
+        VerifyOrExit(last < kMaxCpus);
+        for (long cpu = first; cpu <= last; cpu++)
+        {
+            aCpus.push_back(static_cast<int>(cpu));
+        }
+
+        if (*cursor == '\0')
+        {
+            break;
+        }
+
+        VerifyOrExit(*cursor == ',');
+        cursor++;
+    }
+
+    std::sort(aCpus.begin(), aCpus.end());
+    aCpus.erase(std::unique(aCpus.begin(), aCpus.end()), aCpus.end());
+    succeeded = true;
+
+exit:
+    return succeeded;
+}
+
+#ifdef __linux__
+
+otbrError ThreadScheduling::ApplyToMainloopThread(const Config &aConfig)
+{
+    otbrError error    = OTBR_ERROR_NONE;
+    int       priority = aConfig.mMainloopRealtimePriority;
+
+    VerifyOrExit(priority == 0 ||
+                     (sched_get_priority_min(SCHED_FIFO) <= priority && priority <= sched_get_priority_max(SCHED_FIFO)),
+                 error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(IsValidNice(aConfig.mMainloopNice) && IsValidNice(aConfig.mManagementNice),
+                 error = OTBR_ERROR_INVALID_ARGS);
+    // The nice value doesn't apply to real-time threads.
+    VerifyOrExit(priority == 0 || aConfig.mMainloopNice == kDefaultNice, error = OTBR_ERROR_INVALID_ARGS);
+
+    mManagementNice = aConfig.mManagementNice;
+
+    if (!aConfig.mMainloopCpus.empty())
+    {
+        cpu_set_t cpus;
+
+        CPU_ZERO(&cpus);
+        for (int cpu : aConfig.mMainloopCpus)
+        {
+            VerifyOrExit(0 <= cpu && cpu < CPU_SETSIZE, error = OTBR_ERROR_INVALID_ARGS);
+            CPU_SET(cpu, &cpus);
+        }
+
+        VerifyOrExit(sched_setaffinity(0, sizeof(cpus), &cpus) == 0, error = OTBR_ERROR_ERRNO);
+        mIsMainloopAdjusted = true;
+    }
+
+    if (priority != 0)
+    {
+        sched_param param;
+        int         rval;
+
+        memset(&param, 0, sizeof(param));
+        param.sched_priority = priority;
+
+        rval = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+        VerifyOrExit(rval == 0, errno = rval, error = OTBR_ERROR_ERRNO);
+        mIsMainloopAdjusted = true;
+    }
+    else if (aConfig.mMainloopNice != kDefaultNice)
+    {
+        VerifyOrExit(SetThreadNice(aConfig.mMainloopNice) == 0, error = OTBR_ERROR_ERRNO);
+        mIsMainloopAdjusted = true;
+    }
+
+    if (mIsMainloopAdjusted)
+    {
+        otbrLogInfo("Mainloop thread runs on %zu pinned CPUs with %s priority %d", aConfig.mMainloopCpus.size(),
+                    priority != 0 ? "real-time" : "nice", priority != 0 ? priority : aConfig.mMainloopNice);
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogErr("Failed to apply the mainloop thread scheduling: %s",
+                   error == OTBR_ERROR_ERRNO ? strerror(errno) : otbrErrorString(error));
+    }
+
+    return error;
+}
+
+void ThreadScheduling::ApplyToManagementThread(void)
+{
+    VerifyOrExit(mIsMainloopAdjusted || mManagementNice != kDefaultNice);
+
+    // A thread inherits the CPUs and the policy of the thread which started it, which may be the mainloop thread.
+    if (mIsMainloopAdjusted)
+    {
+        sched_param param;
+        int         rval;
+
+        if (sched_setaffinity(0, sizeof(mInitialCpus), &mInitialCpus) != 0)
+        {
+            otbrLogWarning("Failed to reset the CPU affinity: %s", strerror(errno));
+        }
+
+        memset(&param, 0, sizeof(param));
+        rval = pthread_setschedparam(pthread_self(), SCHED_OTHER, &param);
+        if (rval != 0)
+        {
+            otbrLogWarning("Failed to reset the scheduling policy: %s", strerror(rval));
+        }
+    }
+
+    if (SetThreadNice(mManagementNice) != 0)
+    {
+        otbrLogWarning("Failed to set the nice value to %d: %s", mManagementNice, strerror(errno));
+    }
+
+exit:
+    return;
+}
+
+#else // __linux__
+
+otbrError ThreadScheduling::ApplyToMainloopThread(const Config &aConfig)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(aConfig.mMainloopCpus.empty() && aConfig.mMainloopRealtimePriority == 0 &&
+                     aConfig.mMainloopNice == kDefaultNice && aConfig.mManagementNice == kDefaultNice,
+                 error = OTBR_ERROR_NOT_IMPLEMENTED);
+
+exit:
+    return error;
+}
+
+void ThreadScheduling::ApplyToManagementThread(void)
+{
+    OTBR_UNUSED_VARIABLE(mManagementNice);
+    OTBR_UNUSED_VARIABLE(mIsMainloopAdjusted);
+}
+
+#endif // __linux__
+
+} // namespace otbr
@@ -0,0 +1,128 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines the scheduling settings of the agent threads.
+ */
+
+#ifndef OTBR_COMMON_THREAD_SCHEDULING_HPP_
+#define OTBR_COMMON_THREAD_SCHEDULING_HPP_
+
+#include <openthread-br/config.h>
+
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/types.hpp"
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace otbr {
+
+/**
+ * This class applies the scheduling settings of the agent threads.
+ *
+ * The mainloop thread, which talks to the radio, may be pinned to a CPU set and run with a real-time priority, so
+ * that other workloads of the device don't delay its responses. The management threads (the web server operations,
+ * the ubus server, the D-Bus worker pool and the mainloop watchdog) would inherit these settings from the mainloop
+ * thread, so each of them resets itself to the normal policy on the CPUs the agent was started with, at a lower
+ * priority if configured.
+ *
+ * The settings are only supported on Linux.
+ */
+class ThreadScheduling : private NonCopyable
+{
+public:
+    static constexpr int kDefaultNice = 0; ///< The nice value of a thread by default.
+
+    /**
+     * This structure represents the scheduling settings.
+     */
+    struct Config
+    {
+        std::vector<int> mMainloopCpus;                            ///< The CPUs of the mainloop thread, any if empty.
+        int              mMainloopRealtimePriority = 0;            ///< The `SCHED_FIFO` priority, 0 for `SCHED_OTHER`.
+        int              mMainloopNice             = kDefaultNice; ///< The nice value of the mainloop thread.
+        int              mManagementNice           = kDefaultNice; ///< The nice value of the management threads.
+    };
+
+    /**
+     * This function returns the singleton.
+     *
+     * @returns The thread scheduling singleton.
+     */
+    static ThreadScheduling &Get(void);
+
+    /**
+     * This function parses a CPU list, e.g. "0,2-3".
+     *
+     * @param[in]  aList  The CPU list.
+     * @param[out] aCpus  The CPUs of the list in ascending order.
+     *
+     * @retval TRUE   Successfully parsed the CPU list.
+     * @retval FALSE  The CPU list is malformed.
+     */
+    static bool ParseCpuList(const char *aList, std::vector<int> &aCpus);
+
+    /**
+     * This method applies the settings to the calling thread as the mainloop thread.
+     *
+     * This method must be called once, before the management threads are started.
+     *
+     * @param[in] aConfig  The settings.
+     *
+     * @retval OTBR_ERROR_NONE             Successfully applied the settings.
+     * @retval OTBR_ERROR_INVALID_ARGS     The settings are out of range.
+     * @retval OTBR_ERROR_NOT_IMPLEMENTED  The settings are not supported on this platform.
+     * @retval OTBR_ERROR_ERRNO            Failed to apply the settings, e.g. without the `CAP_SYS_NICE` capability.
+     */
+    otbrError ApplyToMainloopThread(const Config &aConfig);
+
+    /**
+     * This method applies the settings of the management threads to the calling thread.
+     *
+     * Failures are logged and otherwise ignored, as they don't keep a management thread from running.
+     */
+    void ApplyToManagementThread(void);
+
+private:
+    ThreadScheduling(void);
+
+#ifdef __linux__
+    cpu_set_t mInitialCpus; // The CPUs the agent was started with.
+#endif
+    int  mManagementNice;
+    bool mIsMainloopAdjusted;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_THREAD_SCHEDULING_HPP_
@@ -0,0 +1,72 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the time utilities.
+ */
+
+#include "common/time.hpp"
+
+namespace otbr {
+
+constexpr bool Clock::is_steady;
+
+std::atomic<bool>       Clock::sVirtualTimeEnabled{false};
+std::atomic<Clock::rep> Clock::sVirtualTime{0};
+Timepoint               CoarseClock::sNow;
+
+void Clock::EnableVirtualTime(void)
+{
+    if (!sVirtualTimeEnabled.load(std::memory_order_acquire))
+    {
+        sVirtualTime.store(RealClock::now().time_since_epoch().count(), std::memory_order_release);
+        sVirtualTimeEnabled.store(true, std::memory_order_release);
+    }
+}
+
+void Clock::Advance(duration aDuration)
+{
+    if (aDuration > duration::zero())
+    {
+        sVirtualTime.fetch_add(aDuration.count(), std::memory_order_acq_rel);
+    }
+}
+
+void Clock::AdvanceTo(time_point aTime)
+{
+    rep time    = aTime.time_since_epoch().count();
+    rep current = sVirtualTime.load(std::memory_order_acquire);
+
+    while (current < time && !sVirtualTime.compare_exchange_weak(current, time, std::memory_order_acq_rel))
+    {
+        // `current` is reloaded with the latest virtual time on failure.
+    }
+}
+
+} // namespace otbr
@@ -36,6 +36,7 @@
 
 #include "openthread-br/config.h"
 
+#include <atomic>
 #include <chrono>
 
 #include <stdint.h>
@@ -47,8 +48,80 @@ namespace otbr {
 using Seconds      = std::chrono::seconds;
 using Milliseconds = std::chrono::milliseconds;
 using Microseconds = std::chrono::microseconds;
-using Clock        = std::chrono::steady_clock;
-using Timepoint    = Clock::time_point;
+using RealClock    = std::chrono::steady_clock;
+
+/**
+ * This class implements the monotonic clock of OTBR.
+ *
+ * The clock follows `std::chrono::steady_clock` by default. Test and benchmark harnesses may switch it to virtual
+ * time, which only moves forward when advanced explicitly, so that timer-heavy behavior (e.g. leases and timeouts)
+ * runs deterministically and as fast as the events can be processed. The time points are the ones of the steady
+ * clock, so the time continues from the steady time when virtual time is enabled.
+ *
+ * Measurements of execution time, e.g. the mainloop statistics, use `RealClock` instead, which is not affected by
+ * virtual time.
+ */
+class Clock
+{
+public:
+    using duration   = RealClock::duration;
+    using rep        = RealClock::rep;
+    using period     = RealClock::period;
+    using time_point = RealClock::time_point;
+
+    static constexpr bool is_steady = true;
+
+    /**
+     * This method returns the current time.
+     *
+     * @returns The virtual time if it's enabled, otherwise the steady time.
+     */
+    static time_point now(void)
+    {
+        return sVirtualTimeEnabled.load(std::memory_order_acquire)
+                   ? time_point(duration(sVirtualTime.load(std::memory_order_acquire)))
+                   : RealClock::now();
+    }
+
+    /**
+     * This method switches the clock to virtual time, which starts at the current steady time.
+     *
+     * This method must not be called while the clock is read by other threads.
+     */
+    static void EnableVirtualTime(void);
+
+    /**
+     * This method switches the clock back to the steady time.
+     */
+    static void DisableVirtualTime(void) { sVirtualTimeEnabled.store(false, std::memory_order_release); }
+
+    /**
+     * This method indicates whether the clock runs in virtual time.
+     *
+     * @returns Whether the clock runs in virtual time.
+     */
+    static bool IsVirtualTimeEnabled(void) { return sVirtualTimeEnabled.load(std::memory_order_acquire); }
+
+    /**
+     * This method advances the virtual time.
+     *
+     * @param[in] aDuration  The duration to advance the virtual time by, negative durations are ignored.
+     */
+    static void Advance(duration aDuration);
+
+    /**
+     * This method advances the virtual time to a time point.
+     *
+     * @param[in] aTime  The time point to advance the virtual time to, earlier time points are ignored.
+     */
+    static void AdvanceTo(time_point aTime);
+
+private:
+    static std::atomic<bool> sVirtualTimeEnabled;
+    static std::atomic<rep>  sVirtualTime;
+};
+
+using Timepoint = Clock::time_point;
 
 template <class D> D FromTimeval(const timeval &aTime)
 {
@@ -68,6 +141,36 @@ template <class D> timeval ToTimeval(const D &aDuration)
     return ret;
 }
 
+/**
+ * This class implements a coarse monotonic clock which is sampled once per mainloop iteration.
+ *
+ * Reading the coarse clock doesn't read the system clock, but the returned time lags behind `Clock::now()` by up to
+ * the time spent in the current mainloop iteration. The coarse clock must only be read on the mainloop thread.
+ * Callers which need the precise time, e.g. for the deadlines of timers, should use `Clock::now()` instead.
+ */
+class CoarseClock
+{
+public:
+    /**
+     * This method returns the time sampled at the latest mainloop wakeup.
+     *
+     * The precise time is returned before the mainloop runs for the first time.
+     *
+     * @returns The coarse current time.
+     */
+    static Timepoint Now(void) { return sNow == Timepoint() ? Clock::now() : sNow; }
+
+    /**
+     * This method samples the current time.
+     *
+     * This method is called by the mainloop manager when the mainloop wakes up.
+     */
+    static void Update(void) { sNow = Clock::now(); }
+
+private:
+    static Timepoint sNow;
+};
+
 } // namespace otbr
 
 #endif // OTBR_COMMON_TIME_HPP_
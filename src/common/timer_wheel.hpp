@@ -0,0 +1,498 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines a hierarchical timer wheel.
+ */
+
+#ifndef OTBR_COMMON_TIMER_WHEEL_HPP_
+#define OTBR_COMMON_TIMER_WHEEL_HPP_
+
+#include <openthread-br/config.h>
+
+#include <assert.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+
+#include "common/code_utils.hpp"
+#include "common/time.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a hierarchical timer wheel.
+ *
+ * Timers are bucketed by their deadline tick into `kNumLevels` levels of `kNumSlots` slots, a slot at level N
+ * covering `kNumSlots^N` ticks. Adding and canceling a timer are both O(1), timers in higher levels are cascaded
+ * down as the wheel advances. Timers expire in the order of their deadlines and, for equal deadlines, in the order
+ * they were added.
+ *
+ * This class is not thread-safe.
+ *
+ * @tparam T  The type of the payload of a timer.
+ */
+template <typename T> class TimerWheel : private NonCopyable
+{
+public:
+    /**
+     * This type represents a unique ID of a timer.
+     *
+     * IDs must be increasing in the order timers are added.
+     */
+    typedef uint64_t TimerId;
+
+    /**
+     * This constructor initializes the timer wheel.
+     *
+     * @param[in] aNow   The current time.
+     * @param[in] aTick  The resolution of the wheel.
+     */
+    explicit TimerWheel(Timepoint aNow, Milliseconds aTick = Milliseconds(1))
+        : mEpoch(aNow)
+        , mTick(aTick)
+        , mCurrentTick(0)
+    {
+        for (auto &level : mLevels)
+        {
+            for (auto &slot : level.mSlots)
+            {
+                slot.Clear();
+            }
+            level.mOccupied = 0;
+        }
+        mOverflow.Clear();
+        mExpired.Clear();
+    }
+
+    ~TimerWheel(void)
+    {
+        for (auto &timer : mTimers)
+        {
+            delete timer.second;
+        }
+    }
+
+    /**
+     * This method adds a timer.
+     *
+     * @param[in] aId        The unique ID of the timer.
+     * @param[in] aDeadline  The time when the timer expires.
+     * @param[in] aPayload   The payload of the timer.
+     */
+    void Add(TimerId aId, Timepoint aDeadline, T aPayload)
+    {
+        Node *node = new Node(aId, aDeadline, ToTick(aDeadline), std::move(aPayload));
+
+        mTimers.emplace(aId, node);
+        Place(*node);
+    }
+
+    /**
+     * This method cancels a timer.
+     *
+     * @param[in] aId  The unique ID of the timer.
+     *
+     * @retval TRUE   Successfully canceled the timer.
+     * @retval FALSE  The timer has already expired or never existed.
+     */
+    bool Cancel(TimerId aId)
+    {
+        bool found = false;
+        auto it    = mTimers.find(aId);
+
+        VerifyOrExit(it != mTimers.end());
+        Remove(*it->second);
+        delete it->second;
+        mTimers.erase(it);
+        found = true;
+
+    exit:
+        return found;
+    }
+
+    /**
+     * This method indicates whether there is any pending timer.
+     *
+     * @retval TRUE   There is no pending timer.
+     * @retval FALSE  There is at least one pending timer.
+     */
+    bool IsEmpty(void) const { return mTimers.empty(); }
+
+    /**
+     * This method returns the number of pending timers.
+     *
+     * @returns The number of pending timers.
+     */
+    size_t GetSize(void) const { return mTimers.size(); }
+
+    /**
+     * This method returns the earliest time at which `PopExpired()` may return a timer.
+     *
+     * The returned time is never later than the deadline of the earliest timer, but may be earlier than it
+     * when the earliest timer is still in a higher level.
+     *
+     * @returns The time of next expiration, or `Timepoint::max()` if there is no pending timer.
+     */
+    Timepoint GetNextDeadline(void) const
+    {
+        Timepoint deadline = Timepoint::max();
+        uint64_t  tick;
+
+        VerifyOrExit(!IsEmpty());
+
+        if (!mExpired.IsEmpty())
+        {
+            ExitNow(deadline = static_cast<const Node *>(mExpired.mNext)->mDeadline);
+        }
+
+        for (uint8_t level = 0; level < kNumLevels; level++)
+        {
+            if (FindNextOccupiedSlot(level, tick))
+            {
+                ExitNow(deadline = ToTime(tick));
+            }
+        }
+
+        // Timers in the overflow list are re-inserted when the top level wraps.
+        deadline = ToTime((mCurrentTick | (kTopLevelSpan - 1)) + 1);
+
+    exit:
+        return deadline;
+    }
+
+    /**
+     * This method pops the earliest expired timer.
+     *
+     * @param[in]  aNow      The current time.
+     * @param[out] aPayload  The payload of the expired timer.
+     *
+     * @retval TRUE   Successfully popped a timer and @p aPayload is set.
+     * @retval FALSE  There is no expired timer.
+     */
+    bool PopExpired(Timepoint aNow, T &aPayload)
+    {
+        return PopEarlierThan(aNow, std::numeric_limits<TimerId>::max(), aPayload);
+    }
+
+    /**
+     * This method pops the earliest timer if it expires before a timer of the given deadline and ID would.
+     *
+     * This allows merging the timers with another queue ordered by the same deadlines and IDs.
+     *
+     * @param[in]  aDeadline  The deadline to compare with, must not be later than the current time.
+     * @param[in]  aId        The ID to compare with for equal deadlines.
+     * @param[out] aPayload   The payload of the expired timer.
+     *
+     * @retval TRUE   Successfully popped a timer and @p aPayload is set.
+     * @retval FALSE  There is no timer expiring before the given deadline and ID.
+     */
+    bool PopEarlierThan(Timepoint aDeadline, TimerId aId, T &aPayload)
+    {
+        bool  found = false;
+        Node *node;
+
+        Advance(aDeadline);
+
+        VerifyOrExit(!mExpired.IsEmpty());
+        node = static_cast<Node *>(mExpired.mNext);
+        VerifyOrExit(node->mDeadline < aDeadline || (node->mDeadline == aDeadline && node->mId < aId));
+
+        Remove(*node);
+        aPayload = std::move(node->mPayload);
+        mTimers.erase(node->mId);
+        delete node;
+        found = true;
+
+    exit:
+        return found;
+    }
+
+private:
+    static constexpr uint8_t  kSlotBits      = 6;
+    static constexpr uint8_t  kNumSlots      = 1 << kSlotBits;
+    static constexpr uint8_t  kNumLevels     = 4;
+    static constexpr uint64_t kSlotMask      = kNumSlots - 1;
+    static constexpr uint64_t kTopLevelSpan  = 1ULL << (kSlotBits * kNumLevels);
+    static constexpr uint8_t  kLevelExpired  = 0xfe;
+    static constexpr uint8_t  kLevelOverflow = 0xff;
+
+    struct Link
+    {
+        void Clear(void) { mPrev = mNext = this; }
+        bool IsEmpty(void) const { return mNext == this; }
+
+        void Unlink(void)
+        {
+            mPrev->mNext = mNext;
+            mNext->mPrev = mPrev;
+            Clear();
+        }
+
+        void InsertAfter(Link &aLink)
+        {
+            mPrev              = &aLink;
+            mNext              = aLink.mNext;
+            aLink.mNext->mPrev = this;
+            aLink.mNext        = this;
+        }
+
+        Link *mPrev;
+        Link *mNext;
+    };
+
+    struct Node : public Link
+    {
+        Node(TimerId aId, Timepoint aDeadline, uint64_t aTick, T aPayload)
+            : mId(aId)
+            , mDeadline(aDeadline)
+            , mTick(aTick)
+            , mLevel(kLevelExpired)
+            , mSlot(0)
+            , mPayload(std::move(aPayload))
+        {
+            this->Clear();
+        }
+
+        bool IsEarlierThan(const Node &aOther) const
+        {
+            return mDeadline < aOther.mDeadline || (mDeadline == aOther.mDeadline && mId < aOther.mId);
+        }
+
+        TimerId   mId;
+        Timepoint mDeadline;
+        uint64_t  mTick;
+        uint8_t   mLevel;
+        uint8_t   mSlot;
+        T         mPayload;
+    };
+
+    struct Level
+    {
+        Link     mSlots[kNumSlots];
+        uint64_t mOccupied;
+    };
+
+    uint64_t ToTick(Timepoint aTime) const
+    {
+        return aTime <= mEpoch ? 0 : static_cast<uint64_t>((aTime - mEpoch) / mTick);
+    }
+
+    Timepoint ToTime(uint64_t aTick) const { return mEpoch + static_cast<Milliseconds::rep>(aTick) * mTick; }
+
+    bool HasScheduled(void) const
+    {
+        bool hasScheduled = !mOverflow.IsEmpty();
+
+        for (const auto &level : mLevels)
+        {
+            hasScheduled = hasScheduled || (level.mOccupied != 0);
+        }
+
+        return hasScheduled;
+    }
+
+    void Place(Node &aNode)
+    {
+        if (aNode.mTick <= mCurrentTick)
+        {
+            InsertExpired(aNode);
+            ExitNow();
+        }
+
+        for (uint8_t level = 0; level < kNumLevels; level++)
+        {
+            uint8_t shift = kSlotBits * (level + 1);
+
+            // A timer belongs to the lowest level in which it shares all higher bits with the current tick, so the
+            // slot it is put into is always ahead of the current slot of that level.
+            if ((aNode.mTick >> shift) == (mCurrentTick >> shift))
+            {
+                aNode.mLevel = level;
+                aNode.mSlot  = static_cast<uint8_t>((aNode.mTick >> (kSlotBits * level)) & kSlotMask);
+                aNode.InsertAfter(*mLevels[level].mSlots[aNode.mSlot].mPrev);
+                mLevels[level].mOccupied |= (1ULL << aNode.mSlot);
+                ExitNow();
+            }
+        }
+
+        aNode.mLevel = kLevelOverflow;
+        aNode.InsertAfter(*mOverflow.mPrev);
+
+    exit:
+        return;
+    }
+
+    void InsertExpired(Node &aNode)
+    {
+        Link *prev = mExpired.mPrev;
+
+        // Most timers expire in order so this usually stops at the tail.
+        while (prev != &mExpired && aNode.IsEarlierThan(*static_cast<Node *>(prev)))
+        {
+            prev = prev->mPrev;
+        }
+
+        aNode.mLevel = kLevelExpired;
+        aNode.InsertAfter(*prev);
+    }
+
+    void Remove(Node &aNode)
+    {
+        aNode.Unlink();
+
+        if (aNode.mLevel < kNumLevels && mLevels[aNode.mLevel].mSlots[aNode.mSlot].IsEmpty())
+        {
+            mLevels[aNode.mLevel].mOccupied &= ~(1ULL << aNode.mSlot);
+        }
+    }
+
+    void Cascade(Link &aList)
+    {
+        Link list;
+
+        // Detach the list first since `Place()` may put timers back into the same list.
+        list.Clear();
+        VerifyOrExit(!aList.IsEmpty());
+        list.mNext        = aList.mNext;
+        list.mPrev        = aList.mPrev;
+        list.mNext->mPrev = &list;
+        list.mPrev->mNext = &list;
+        aList.Clear();
+
+        while (!list.IsEmpty())
+        {
+            Node *node = static_cast<Node *>(list.mNext);
+
+            node->Unlink();
+            Place(*node);
+        }
+
+    exit:
+        return;
+    }
+
+    void CascadeSlot(uint8_t aLevel, uint8_t aSlot)
+    {
+        mLevels[aLevel].mOccupied &= ~(1ULL << aSlot);
+        Cascade(mLevels[aLevel].mSlots[aSlot]);
+    }
+
+    void Advance(Timepoint aNow)
+    {
+        uint64_t nowTick = ToTick(aNow);
+
+        while (mCurrentTick < nowTick)
+        {
+            if (!HasScheduled())
+            {
+                mCurrentTick = nowTick;
+                break;
+            }
+
+            // Skip to the end of the current level-0 round when there is nothing left in it.
+            if ((mLevels[0].mOccupied & ~((2ULL << (mCurrentTick & kSlotMask)) - 1)) == 0)
+            {
+                mCurrentTick = std::min(nowTick, mCurrentTick | kSlotMask);
+                VerifyOrExit(mCurrentTick < nowTick);
+            }
+
+            mCurrentTick++;
+
+            for (uint8_t level = 1; level < kNumLevels; level++)
+            {
+                uint8_t shift = kSlotBits * level;
+
+                if ((mCurrentTick & ((1ULL << shift) - 1)) != 0)
+                {
+                    break;
+                }
+
+                CascadeSlot(level, static_cast<uint8_t>((mCurrentTick >> shift) & kSlotMask));
+            }
+
+            if ((mCurrentTick & (kTopLevelSpan - 1)) == 0)
+            {
+                Cascade(mOverflow);
+            }
+
+            {
+                uint8_t slot = static_cast<uint8_t>(mCurrentTick & kSlotMask);
+
+                mLevels[0].mOccupied &= ~(1ULL << slot);
+                while (!mLevels[0].mSlots[slot].IsEmpty())
+                {
+                    Node *node = static_cast<Node *>(mLevels[0].mSlots[slot].mNext);
+
+                    node->Unlink();
+                    InsertExpired(*node);
+                }
+            }
+        }
+
+    exit:
+        return;
+    }
+
+    bool FindNextOccupiedSlot(uint8_t aLevel, uint64_t &aTick) const
+    {
+        uint8_t  shift    = kSlotBits * aLevel;
+        uint8_t  current  = static_cast<uint8_t>((mCurrentTick >> shift) & kSlotMask);
+        uint64_t occupied = mLevels[aLevel].mOccupied;
+        bool     found    = false;
+        uint8_t  slot;
+
+        // Slots in a level are always ahead of the current slot, see `Place()`.
+        occupied &= ~((2ULL << current) - 1);
+        VerifyOrExit(occupied != 0);
+
+        slot  = static_cast<uint8_t>(__builtin_ctzll(occupied));
+        aTick = ((mCurrentTick >> (shift + kSlotBits)) << (shift + kSlotBits)) | (static_cast<uint64_t>(slot) << shift);
+        found = true;
+
+    exit:
+        return found;
+    }
+
+    Timepoint    mEpoch;
+    Milliseconds mTick;
+    uint64_t     mCurrentTick;
+    Level        mLevels[kNumLevels];
+    Link         mOverflow;
+    Link         mExpired;
+
+    std::unordered_map<TimerId, Node *> mTimers;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_TIMER_WHEEL_HPP_
@@ -39,6 +39,8 @@
 #include <stdint.h>
 #include <string.h>
 
+#include "common/code_utils.hpp"
+
 namespace otbr {
 
 /**
@@ -46,6 +48,8 @@ namespace otbr {
  */
 class Tlv
 {
+    friend class TlvView;
+
     enum
     {
         kLengthEscape = 0xff, ///< This length value indicates the actual length is of two-bytes length.
@@ -228,6 +232,162 @@ private:
     uint8_t mLength;
 };
 
+/**
+ * This class implements a bounds-checked view over the TLVs in a buffer.
+ *
+ * The view doesn't copy the buffer, iterating it yields the `Tlv`s in place. A TLV is only yielded if its header,
+ * including the extended length, and its value lie within the buffer. Iteration stops at the first TLV which doesn't.
+ */
+class TlvView
+{
+public:
+    /**
+     * This class implements the iterator over the TLVs of a `TlvView`.
+     */
+    class Iterator
+    {
+    public:
+        const Tlv &operator*(void) const { return *reinterpret_cast<const Tlv *>(mCur); }
+        const Tlv *operator->(void) const { return reinterpret_cast<const Tlv *>(mCur); }
+
+        Iterator &operator++(void)
+        {
+            mCur += GetTlvSize(mCur, mEnd);
+            mCur = (GetTlvSize(mCur, mEnd) != 0) ? mCur : mEnd;
+            return *this;
+        }
+
+        bool operator==(const Iterator &aOther) const { return mCur == aOther.mCur; }
+        bool operator!=(const Iterator &aOther) const { return mCur != aOther.mCur; }
+
+    private:
+        friend class TlvView;
+
+        Iterator(const uint8_t *aCur, const uint8_t *aEnd)
+            : mCur((GetTlvSize(aCur, aEnd) != 0) ? aCur : aEnd)
+            , mEnd(aEnd)
+        {
+        }
+
+        const uint8_t *mCur;
+        const uint8_t *mEnd;
+    };
+
+    /**
+     * This constructor initializes the view over a buffer.
+     *
+     * @param[in] aBuffer  A pointer to the TLVs.
+     * @param[in] aLength  The length of the TLVs in bytes.
+     */
+    TlvView(const uint8_t *aBuffer, uint16_t aLength)
+        : mBegin(aBuffer)
+        , mEnd(aBuffer + aLength)
+    {
+    }
+
+    Iterator begin(void) const { return Iterator(mBegin, mEnd); }
+    Iterator end(void) const { return Iterator(mEnd, mEnd); }
+
+    /**
+     * This method indicates whether the buffer consists of complete TLVs only.
+     *
+     * @retval TRUE   Every byte of the buffer belongs to a TLV within bounds.
+     * @retval FALSE  The buffer ends with a truncated TLV.
+     */
+    bool IsWellFormed(void) const
+    {
+        const uint8_t *cur = mBegin;
+        uint32_t       size;
+
+        while ((size = GetTlvSize(cur, mEnd)) != 0)
+        {
+            cur += size;
+        }
+
+        return cur == mEnd;
+    }
+
+    /**
+     * This method finds the first TLV of a type.
+     *
+     * @param[in] aType  The TLV type.
+     *
+     * @returns A pointer to the TLV, or nullptr if no TLV is of type @p aType.
+     */
+    const Tlv *Find(uint8_t aType) const
+    {
+        const Tlv *tlv = nullptr;
+
+        Find(&aType, &tlv, 1);
+
+        return tlv;
+    }
+
+    /**
+     * This method finds the first TLV of each of several types in a single pass over the buffer.
+     *
+     * @param[in]  aTypes  The TLV types to find.
+     * @param[out] aTlvs   On return, `aTlvs[i]` points to the first TLV of type `aTypes[i]`, or is nullptr.
+     * @param[in]  aCount  The number of TLV types.
+     *
+     * @returns The number of TLV types found.
+     */
+    uint8_t Find(const uint8_t *aTypes, const Tlv **aTlvs, uint8_t aCount) const
+    {
+        uint8_t found = 0;
+
+        for (uint8_t i = 0; i < aCount; i++)
+        {
+            aTlvs[i] = nullptr;
+        }
+
+        for (Iterator it = begin(); it != end() && found < aCount; ++it)
+        {
+            for (uint8_t i = 0; i < aCount; i++)
+            {
+                if (aTlvs[i] == nullptr && aTypes[i] == it->GetType())
+                {
+                    aTlvs[i] = &*it;
+                    found++;
+                }
+            }
+        }
+
+        return found;
+    }
+
+private:
+    // Returns the size of the TLV at @p aCur including its header, or 0 if it doesn't lie within the buffer.
+    static uint32_t GetTlvSize(const uint8_t *aCur, const uint8_t *aEnd)
+    {
+        uint32_t remaining = static_cast<uint32_t>(aEnd - aCur);
+        uint32_t size      = 0;
+
+        VerifyOrExit(remaining >= sizeof(Tlv));
+
+        if (aCur[1] != Tlv::kLengthEscape)
+        {
+            size = sizeof(Tlv) + aCur[1];
+        }
+        else
+        {
+            VerifyOrExit(remaining >= sizeof(Tlv) + sizeof(uint16_t));
+            size = sizeof(Tlv) + sizeof(uint16_t) + static_cast<uint32_t>(aCur[2] << 8 | aCur[3]);
+        }
+
+        if (size > remaining)
+        {
+            size = 0;
+        }
+
+    exit:
+        return size;
+    }
+
+    const uint8_t *mBegin;
+    const uint8_t *mEnd;
+};
+
 namespace Meshcop {
 
 enum
@@ -0,0 +1,161 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/trace.hpp"
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <functional>
+
+namespace otbr {
+namespace Trace {
+
+namespace {
+
+constexpr size_t kMaxMarkerLength = 256;
+
+class Marker
+{
+public:
+    Marker(void)
+        : mFd(-1)
+        , mPid(getpid())
+    {
+        static const char *const kPaths[] = {
+            "/sys/kernel/tracing/trace_marker",
+            "/sys/kernel/debug/tracing/trace_marker",
+        };
+
+        for (const char *path : kPaths)
+        {
+            mFd = open(path, O_WRONLY | O_CLOEXEC);
+            VerifyOrExit(mFd < 0);
+        }
+
+    exit:
+        return;
+    }
+
+    ~Marker(void)
+    {
+        if (mFd >= 0)
+        {
+            close(mFd);
+        }
+    }
+
+    bool IsOpen(void) const { return mFd >= 0; }
+    int  GetPid(void) const { return mPid; }
+
+    void Write(const char *aMarker, int aLength)
+    {
+        ssize_t rval;
+
+        VerifyOrExit(aLength > 0);
+
+        // A trace marker is best effort, a lost marker only leaves a slice open in the trace.
+        rval = write(mFd, aMarker, std::min(static_cast<size_t>(aLength), kMaxMarkerLength - 1));
+        OTBR_UNUSED_VARIABLE(rval);
+
+    exit:
+        return;
+    }
+
+private:
+    int mFd;
+    int mPid;
+};
+
+Marker &GetMarker(void)
+{
+    static Marker sMarker;
+
+    return sMarker;
+}
+
+} // namespace
+
+void Begin(const char *aName)
+{
+    Marker &marker = GetMarker();
+    char    buffer[kMaxMarkerLength];
+
+    VerifyOrExit(marker.IsOpen());
+    marker.Write(buffer, snprintf(buffer, sizeof(buffer), "B|%d|%s", marker.GetPid(), aName));
+
+exit:
+    return;
+}
+
+void End(void)
+{
+    Marker &marker = GetMarker();
+    char    buffer[kMaxMarkerLength];
+
+    VerifyOrExit(marker.IsOpen());
+    marker.Write(buffer, snprintf(buffer, sizeof(buffer), "E|%d", marker.GetPid()));
+
+exit:
+    return;
+}
+
+void AsyncBegin(const char *aName, uint64_t aCookie)
+{
+    Marker &marker = GetMarker();
+    char    buffer[kMaxMarkerLength];
+
+    VerifyOrExit(marker.IsOpen());
+    marker.Write(buffer, snprintf(buffer, sizeof(buffer), "S|%d|%s|%" PRIu64, marker.GetPid(), aName, aCookie));
+
+exit:
+    return;
+}
+
+void AsyncEnd(const char *aName, uint64_t aCookie)
+{
+    Marker &marker = GetMarker();
+    char    buffer[kMaxMarkerLength];
+
+    VerifyOrExit(marker.IsOpen());
+    marker.Write(buffer, snprintf(buffer, sizeof(buffer), "F|%d|%s|%" PRIu64, marker.GetPid(), aName, aCookie));
+
+exit:
+    return;
+}
+
+uint64_t MakeCookie(const std::string &aKey)
+{
+    return std::hash<std::string>()(aKey);
+}
+
+} // namespace Trace
+} // namespace otbr
@@ -0,0 +1,139 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines the trace points of the agent.
+ *
+ * The trace points are written to the ftrace marker in the atrace format, so they show up as slices in the system
+ * traces recorded by Perfetto (with the `ftrace/print` event) or by LTTng (with its kernel ftrace bridge) next to the
+ * scheduling events of the kernel. Trace points are compiled in only when `OTBR_ENABLE_TRACE` is set, otherwise the
+ * macros expand to nothing and their arguments are not evaluated.
+ */
+
+#ifndef OTBR_COMMON_TRACE_HPP_
+#define OTBR_COMMON_TRACE_HPP_
+
+#include <openthread-br/config.h>
+
+#include <stdint.h>
+
+#include <string>
+
+#include "common/code_utils.hpp"
+
+#if OTBR_ENABLE_TRACE
+
+#define OTBR_TRACE_CONCAT_(aPrefix, aLine) aPrefix##aLine
+#define OTBR_TRACE_CONCAT(aPrefix, aLine) OTBR_TRACE_CONCAT_(aPrefix, aLine)
+
+/**
+ * Traces the enclosing scope as a slice of the current thread.
+ *
+ * @param[in] aName  The name of the slice, a null-terminated string.
+ */
+#define OTBR_TRACE_SCOPE(aName) otbr::Trace::Scope OTBR_TRACE_CONCAT(otbrTraceScope, __LINE__)(aName)
+
+/**
+ * Begins an asynchronous slice, which may end on another thread or in a later mainloop iteration.
+ *
+ * @param[in] aName    The name of the slice, a null-terminated string.
+ * @param[in] aCookie  The cookie identifying the slice among the slices of the same name.
+ */
+#define OTBR_TRACE_ASYNC_BEGIN(aName, aCookie) otbr::Trace::AsyncBegin(aName, aCookie)
+
+/**
+ * Ends an asynchronous slice begun by `OTBR_TRACE_ASYNC_BEGIN()` with the same name and cookie.
+ *
+ * @param[in] aName    The name of the slice, a null-terminated string.
+ * @param[in] aCookie  The cookie identifying the slice among the slices of the same name.
+ */
+#define OTBR_TRACE_ASYNC_END(aName, aCookie) otbr::Trace::AsyncEnd(aName, aCookie)
+
+#else // OTBR_ENABLE_TRACE
+
+#define OTBR_TRACE_SCOPE(aName)
+#define OTBR_TRACE_ASYNC_BEGIN(aName, aCookie)
+#define OTBR_TRACE_ASYNC_END(aName, aCookie)
+
+#endif // OTBR_ENABLE_TRACE
+
+namespace otbr {
+namespace Trace {
+
+/**
+ * This function begins a slice of the current thread.
+ *
+ * @param[in] aName  The name of the slice.
+ */
+void Begin(const char *aName);
+
+/**
+ * This function ends the innermost slice of the current thread.
+ */
+void End(void);
+
+/**
+ * This function begins an asynchronous slice.
+ *
+ * @param[in] aName    The name of the slice.
+ * @param[in] aCookie  The cookie identifying the slice among the slices of the same name.
+ */
+void AsyncBegin(const char *aName, uint64_t aCookie);
+
+/**
+ * This function ends an asynchronous slice.
+ *
+ * @param[in] aName    The name of the slice.
+ * @param[in] aCookie  The cookie identifying the slice among the slices of the same name.
+ */
+void AsyncEnd(const char *aName, uint64_t aCookie);
+
+/**
+ * This function returns a cookie for the asynchronous slices of an object identified by a string.
+ *
+ * @param[in] aKey  The key of the object, e.g. the name of an mDNS service.
+ *
+ * @returns The cookie.
+ */
+uint64_t MakeCookie(const std::string &aKey);
+
+/**
+ * This class implements a slice which lasts as long as the object.
+ */
+class Scope : private NonCopyable
+{
+public:
+    explicit Scope(const char *aName) { Begin(aName); }
+    ~Scope(void) { End(); }
+};
+
+} // namespace Trace
+} // namespace otbr
+
+#endif // OTBR_COMMON_TRACE_HPP_
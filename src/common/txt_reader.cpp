@@ -0,0 +1,102 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the reader of DNS-SD TXT data.
+ */
+
+#include "common/txt_reader.hpp"
+
+#include <string.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+otbrError TxtReader::ReadNext(Entry &aEntry)
+{
+    otbrError      error = OTBR_ERROR_NOT_FOUND;
+    const uint8_t *entry;
+    const uint8_t *separator;
+    uint8_t        entryLength;
+
+    while (mOffset < mLength)
+    {
+        entryLength = mData[mOffset];
+        entry       = &mData[mOffset + 1];
+
+        VerifyOrExit(entryLength < mLength - mOffset, error = OTBR_ERROR_PARSE);
+        mOffset += entryLength + 1;
+
+        if (entryLength == 0)
+        {
+            continue;
+        }
+
+        separator = static_cast<const uint8_t *>(memchr(entry, '=', entryLength));
+
+        if (separator == nullptr)
+        {
+            aEntry.mKey                = StringView(reinterpret_cast<const char *>(entry), entryLength);
+            aEntry.mValue              = nullptr;
+            aEntry.mValueLength        = 0;
+            aEntry.mIsBooleanAttribute = true;
+        }
+        else
+        {
+            aEntry.mKey                = StringView(reinterpret_cast<const char *>(entry), separator - entry);
+            aEntry.mValue              = separator + 1;
+            aEntry.mValueLength        = static_cast<uint8_t>(entry + entryLength - aEntry.mValue);
+            aEntry.mIsBooleanAttribute = false;
+        }
+
+        ExitNow(error = OTBR_ERROR_NONE);
+    }
+
+exit:
+    return error;
+}
+
+otbrError TxtReader::Find(const StringView &aKey, Entry &aEntry) const
+{
+    TxtReader reader(mData, mLength);
+    otbrError error;
+
+    while ((error = reader.ReadNext(aEntry)) == OTBR_ERROR_NONE)
+    {
+        if (aEntry.mKey.EqualsIgnoreCase(aKey))
+        {
+            break;
+        }
+    }
+
+    return error;
+}
+
+} // namespace otbr
@@ -0,0 +1,125 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines the reader of DNS-SD TXT data.
+ */
+
+#ifndef OTBR_COMMON_TXT_READER_HPP_
+#define OTBR_COMMON_TXT_READER_HPP_
+
+#include <openthread-br/config.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "common/string_view.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class reads the entries of DNS-SD TXT data in place, without copying any key or value.
+ *
+ * The TXT data is in the format of RFC 6763 section 6: a sequence of length-prefixed `key=value` strings, or `key`
+ * alone for a boolean attribute. The entries refer to the TXT data, which must outlive them.
+ */
+class TxtReader
+{
+public:
+    /**
+     * This structure represents an entry of the TXT data.
+     */
+    struct Entry
+    {
+        StringView     mKey;                ///< The key.
+        const uint8_t *mValue;              ///< The value, `nullptr` for a boolean attribute.
+        uint8_t        mValueLength;        ///< The length of the value.
+        bool           mIsBooleanAttribute; ///< Whether the entry is a boolean attribute, encoded without `=`.
+    };
+
+    /**
+     * This constructor initializes a reader at the first entry of TXT data.
+     *
+     * @param[in] aTxtData    A pointer to the TXT data.
+     * @param[in] aTxtLength  The length of the TXT data.
+     */
+    TxtReader(const uint8_t *aTxtData, size_t aTxtLength)
+        : mData(aTxtData)
+        , mLength(aTxtLength)
+        , mOffset(0)
+    {
+    }
+
+    /**
+     * This constructor initializes a reader at the first entry of TXT data.
+     *
+     * @param[in] aTxtData  The TXT data.
+     */
+    explicit TxtReader(const std::vector<uint8_t> &aTxtData)
+        : TxtReader(aTxtData.data(), aTxtData.size())
+    {
+    }
+
+    /**
+     * This method reads the next entry, skipping the empty strings.
+     *
+     * @param[out] aEntry  The entry.
+     *
+     * @retval OTBR_ERROR_NONE       Successfully read the entry.
+     * @retval OTBR_ERROR_NOT_FOUND  There are no more entries.
+     * @retval OTBR_ERROR_PARSE      The TXT data is truncated.
+     */
+    otbrError ReadNext(Entry &aEntry);
+
+    /**
+     * This method finds the first entry of a key, ignoring the case of the keys like RFC 6763 section 6.4.
+     *
+     * The search starts from the first entry, whatever entries were read.
+     *
+     * @param[in]  aKey    The key.
+     * @param[out] aEntry  The entry.
+     *
+     * @retval OTBR_ERROR_NONE       Successfully found the entry.
+     * @retval OTBR_ERROR_NOT_FOUND  There is no entry of @p aKey.
+     * @retval OTBR_ERROR_PARSE      The TXT data is truncated before an entry of @p aKey.
+     */
+    otbrError Find(const StringView &aKey, Entry &aEntry) const;
+
+private:
+    const uint8_t *mData;
+    size_t         mLength;
+    size_t         mOffset;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_TXT_READER_HPP_
@@ -27,7 +27,7 @@
  */
 
 #include <arpa/inet.h>
-#include <sstream>
+#include <stdio.h>
 #include <sys/socket.h>
 
 #include "common/code_utils.hpp"
@@ -46,14 +46,137 @@ Ip6Address::Ip6Address(const otIp6Address &aAddress)
     memcpy(m8, aAddress.mFields.m8, sizeof(m8));
 }
 
+static const char kHexDigits[] = "0123456789abcdef";
+
+static char *WriteHex16(uint16_t aValue, char *aBuffer)
+{
+    bool started = false;
+
+    for (int shift = 12; shift >= 0; shift -= 4)
+    {
+        uint8_t digit = (aValue >> shift) & 0xf;
+
+        if (started || digit != 0 || shift == 0)
+        {
+            *aBuffer++ = kHexDigits[digit];
+            started    = true;
+        }
+    }
+
+    return aBuffer;
+}
+
+static char *WriteDecimal8(uint8_t aValue, char *aBuffer)
+{
+    if (aValue >= 100)
+    {
+        *aBuffer++ = static_cast<char>('0' + aValue / 100);
+    }
+
+    if (aValue >= 10)
+    {
+        *aBuffer++ = static_cast<char>('0' + (aValue / 10) % 10);
+    }
+
+    *aBuffer++ = static_cast<char>('0' + aValue % 10);
+
+    return aBuffer;
+}
+
+char *Ip6Address::WriteChars(char *aBuffer) const
+{
+    // Formats the address as recommended by RFC 5952: lowercase hex digits without leading zeros, the first longest
+    // run of at least two zero groups compressed to "::", and IPv4-mapped addresses in dotted decimal.
+    uint16_t groups[8];
+    int      zeroRunStart  = -1;
+    int      zeroRunLength = 1;
+    int      groupCount    = 8;
+
+    for (int i = 0; i < 8; i++)
+    {
+        groups[i] = static_cast<uint16_t>((m8[2 * i] << 8) | m8[2 * i + 1]);
+    }
+
+    for (int i = 0; i < 8;)
+    {
+        int length = 0;
+
+        while (i + length < 8 && groups[i + length] == 0)
+        {
+            length++;
+        }
+
+        if (length > zeroRunLength)
+        {
+            zeroRunStart  = i;
+            zeroRunLength = length;
+        }
+
+        i += (length > 0) ? length : 1;
+    }
+
+    if (m64[0] == 0 && groups[4] == 0 && groups[5] == 0xffff)
+    {
+        groupCount = 6;
+    }
+
+    for (int i = 0; i < groupCount; i++)
+    {
+        if (i == zeroRunStart)
+        {
+            *aBuffer++ = ':';
+            *aBuffer++ = ':';
+            i += zeroRunLength - 1;
+            continue;
+        }
+
+        if (i != 0 && i != zeroRunStart + zeroRunLength)
+        {
+            *aBuffer++ = ':';
+        }
+
+        aBuffer = WriteHex16(groups[i], aBuffer);
+    }
+
+    if (groupCount == 6)
+    {
+        *aBuffer++ = ':';
+
+        for (int i = 12; i < 16; i++)
+        {
+            if (i != 12)
+            {
+                *aBuffer++ = '.';
+            }
+
+            aBuffer = WriteDecimal8(m8[i], aBuffer);
+        }
+    }
+
+    *aBuffer = '\0';
+
+    return aBuffer;
+}
+
+void Ip6Address::AppendTo(std::string &aString) const
+{
+    InfoString string;
+
+    aString.append(string.GetBuffer(), WriteChars(string.GetBuffer()));
+}
+
 std::string Ip6Address::ToString() const
 {
-    char strbuf[INET6_ADDRSTRLEN];
+    return std::string(ToInfoString().AsCString());
+}
 
-    VerifyOrDie(inet_ntop(AF_INET6, this->m8, strbuf, sizeof(strbuf)) != nullptr,
-                "Failed to convert Ip6 address to string");
+Ip6Address::InfoString Ip6Address::ToInfoString(void) const
+{
+    InfoString string;
+
+    WriteChars(string.GetBuffer());
 
-    return std::string(strbuf);
+    return string;
 }
 
 Ip6Address Ip6Address::ToSolicitedNodeMulticastAddress(void) const
@@ -109,28 +232,31 @@ Ip6Address Ip6Address::FromString(const char *aStr)
     return addr;
 }
 
-bool Ip6Prefix::operator==(const Ip6Prefix &aOther) const
+// Returns the mask of the first @p aLength bits for the 64-bit word @p aIndex of an Ip6 address, in network byte order.
+static uint64_t GetPrefixWordMask(uint8_t aLength, uint8_t aIndex)
 {
-    bool    isEqual = false;
-    uint8_t lengthFullBytes;     // the number of complete bytes in the prefix length
-    uint8_t lengthRemainingBits; // the number of remaining bits in the prefix length that do not form a complete byte
+    int      bits = static_cast<int>(aLength) - 64 * aIndex;
+    uint64_t mask;
 
-    VerifyOrExit(mLength == aOther.mLength);
-
-    lengthFullBytes     = mLength / 8;
-    lengthRemainingBits = mLength % 8;
-    VerifyOrExit(memcmp(mPrefix.m8, aOther.mPrefix.m8, lengthFullBytes) == 0);
-
-    if (lengthRemainingBits > 0)
+    if (bits <= 0)
+    {
+        mask = 0;
+    }
+    else if (bits >= 64)
     {
-        uint8_t mask = 0xff << (8 - lengthRemainingBits);
-        VerifyOrExit((mPrefix.m8[lengthFullBytes] & mask) == (aOther.mPrefix.m8[lengthFullBytes] & mask));
+        mask = UINT64_MAX;
+    }
+    else
+    {
+        mask = ~(UINT64_MAX >> bits);
     }
 
-    isEqual = true;
+    return htobe64(mask);
+}
 
-exit:
-    return isEqual;
+bool Ip6Prefix::operator==(const Ip6Prefix &aOther) const
+{
+    return mLength == aOther.mLength && Contains(aOther.mPrefix);
 }
 
 bool Ip6Prefix::operator!=(const Ip6Prefix &aOther) const
@@ -138,6 +264,22 @@ bool Ip6Prefix::operator!=(const Ip6Prefix &aOther) const
     return !(*this == aOther);
 }
 
+bool Ip6Prefix::Contains(const Ip6Address &aAddress) const
+{
+    return ((mPrefix.m64[0] ^ aAddress.m64[0]) & GetPrefixWordMask(mLength, 0)) == 0 &&
+           ((mPrefix.m64[1] ^ aAddress.m64[1]) & GetPrefixWordMask(mLength, 1)) == 0;
+}
+
+Ip6Address Ip6Prefix::GetMaskedPrefix(void) const
+{
+    Ip6Address prefix;
+
+    prefix.m64[0] = mPrefix.m64[0] & GetPrefixWordMask(mLength, 0);
+    prefix.m64[1] = mPrefix.m64[1] & GetPrefixWordMask(mLength, 1);
+
+    return prefix;
+}
+
 void Ip6Prefix::Set(const otIp6Prefix &aPrefix)
 {
     memcpy(reinterpret_cast<void *>(this), &aPrefix, sizeof(*this));
@@ -145,28 +287,118 @@ void Ip6Prefix::Set(const otIp6Prefix &aPrefix)
 
 std::string Ip6Prefix::ToString() const
 {
-    std::stringbuf strBuilder;
-    char           strbuf[INET6_ADDRSTRLEN];
+    return std::string(ToInfoString().AsCString());
+}
 
-    VerifyOrDie(inet_ntop(AF_INET6, mPrefix.m8, strbuf, sizeof(strbuf)) != nullptr,
-                "Failed to convert Ip6 prefix to string");
+char *Ip6Prefix::WriteChars(char *aBuffer) const
+{
+    aBuffer    = mPrefix.WriteChars(aBuffer);
+    *aBuffer++ = '/';
+    aBuffer    = WriteDecimal8(mLength, aBuffer);
+    *aBuffer   = '\0';
 
-    strBuilder.sputn(strbuf, strlen(strbuf));
-    strBuilder.sputc('/');
+    return aBuffer;
+}
 
-    snprintf(strbuf, sizeof(strbuf), "%d", mLength);
-    strBuilder.sputn(strbuf, strlen(strbuf));
+void Ip6Prefix::AppendTo(std::string &aString) const
+{
+    InfoString string;
 
-    return strBuilder.str();
+    aString.append(string.GetBuffer(), WriteChars(string.GetBuffer()));
+}
+
+Ip6Prefix::InfoString Ip6Prefix::ToInfoString(void) const
+{
+    InfoString string;
+
+    WriteChars(string.GetBuffer());
+
+    return string;
+}
+
+constexpr uint32_t MdnsLatencyHistogram::kBucketUpperBounds[];
+
+void MdnsLatencyHistogram::Record(uint32_t aLatency)
+{
+    uint8_t index = 0;
+
+    while (index < kNumBuckets - 1 && aLatency >= kBucketUpperBounds[index])
+    {
+        index++;
+    }
+
+    mBuckets[index]++;
+}
+
+uint32_t MdnsLatencyHistogram::GetPercentile(uint8_t aPercentile) const
+{
+    uint64_t total   = 0;
+    uint64_t count   = 0;
+    uint32_t latency = 0;
+    uint64_t rank;
+
+    for (uint32_t bucket : mBuckets)
+    {
+        total += bucket;
+    }
+
+    VerifyOrExit(total > 0);
+
+    // The rank of the percentile among the recorded latencies, rounded up.
+    rank = (total * aPercentile + 99) / 100;
+
+    for (uint8_t index = 0; index < kNumBuckets; index++)
+    {
+        count += mBuckets[index];
+
+        if (count >= rank)
+        {
+            latency = kBucketUpperBounds[index < kNumBuckets - 1 ? index : kNumBuckets - 2];
+            break;
+        }
+    }
+
+exit:
+    return latency;
 }
 
 std::string MacAddress::ToString(void) const
 {
-    char strbuf[sizeof(m8) * 3];
+    return std::string(ToInfoString().AsCString());
+}
+
+char *MacAddress::WriteChars(char *aBuffer) const
+{
+    for (size_t i = 0; i < sizeof(m8); i++)
+    {
+        if (i != 0)
+        {
+            *aBuffer++ = ':';
+        }
+
+        *aBuffer++ = kHexDigits[m8[i] >> 4];
+        *aBuffer++ = kHexDigits[m8[i] & 0xf];
+    }
+
+    *aBuffer = '\0';
+
+    return aBuffer;
+}
+
+void MacAddress::AppendTo(std::string &aString) const
+{
+    InfoString string;
+
+    aString.append(string.GetBuffer(), WriteChars(string.GetBuffer()));
+}
+
+MacAddress::InfoString MacAddress::ToInfoString(void) const
+{
+    InfoString string;
 
-    snprintf(strbuf, sizeof(strbuf), "%02x:%02x:%02x:%02x:%02x:%02x", m8[0], m8[1], m8[2], m8[3], m8[4], m8[5]);
+    WriteChars(string.GetBuffer());
 
-    return std::string(strbuf);
+    return string;
 }
 
 otError OtbrErrorToOtError(otbrError aError)
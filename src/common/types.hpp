@@ -87,6 +87,7 @@ enum otbrError
     OTBR_ERROR_INVALID_STATE      = -13, ///< The target isn't in a valid state.
     OTBR_ERROR_INFRA_LINK_CHANGED = -14, ///< The infrastructure link is changed.
     OTBR_ERROR_DROPPED            = -15, ///< The packet is dropped.
+    OTBR_ERROR_TIMEOUT            = -16, ///< The operation timed out.
 };
 
 namespace otbr {
@@ -103,6 +104,48 @@ enum
 static constexpr char kSolicitedMulticastAddressPrefix[]   = "ff02::01:ff00:0";
 static constexpr char kLinkLocalAllNodesMulticastAddress[] = "ff02::01";
 
+/**
+ * This class implements a fixed-size string buffer.
+ *
+ * Values returned by `ToInfoString()` live until the end of the full expression, so they can be passed to the
+ * `otbrLog*` macros directly. Since those macros check the log level before evaluating their arguments, a filtered
+ * log line neither formats nor allocates anything.
+ *
+ * @tparam kSize  The buffer size, including the null terminator.
+ */
+template <uint16_t kSize> class FixedString
+{
+public:
+    /**
+     * Default constructor, initializes an empty string.
+     */
+    FixedString(void) { mBuffer[0] = '\0'; }
+
+    /**
+     * This method returns the string as a null-terminated C string.
+     *
+     * @returns A pointer to the string buffer.
+     */
+    const char *AsCString(void) const { return mBuffer; }
+
+    /**
+     * This method returns the string buffer for writing.
+     *
+     * @returns A pointer to the string buffer.
+     */
+    char *GetBuffer(void) { return mBuffer; }
+
+    /**
+     * This method returns the string buffer size.
+     *
+     * @returns The buffer size, including the null terminator.
+     */
+    static constexpr uint16_t GetSize(void) { return kSize; }
+
+private:
+    char mBuffer[kSize];
+};
+
 /**
  * This class implements the Ipv6 address functionality.
  */
@@ -158,9 +201,15 @@ public:
      *
      * @param[in] aOther  The other Ip6 address to compare with.
      *
+     * The addresses are compared in network byte order, as two 64-bit words.
+     *
      * @returns Whether the Ip6 address is smaller than the other address.
      */
-    bool operator<(const Ip6Address &aOther) const { return memcmp(this, &aOther, sizeof(Ip6Address)) < 0; }
+    bool operator<(const Ip6Address &aOther) const
+    {
+        return (m64[0] != aOther.m64[0]) ? (be64toh(m64[0]) < be64toh(aOther.m64[0]))
+                                         : (be64toh(m64[1]) < be64toh(aOther.m64[1]));
+    }
 
     /**
      * This method overloads `==` operator and compares if the Ip6 address is equal to the other address.
@@ -201,6 +250,35 @@ public:
      */
     std::string ToString(void) const;
 
+    typedef FixedString<INET6_ADDRSTRLEN> InfoString; ///< The fixed-size string type of an Ip6 address.
+
+    /**
+     * This method returns the string representation for the Ip6 address without allocating.
+     *
+     * @returns The string representation of the Ip6 address.
+     */
+    InfoString ToInfoString(void) const;
+
+    /**
+     * This method writes the string representation of the Ip6 address to a buffer without allocating.
+     *
+     * @param[out] aBuffer  The buffer to write to, it must hold at least `InfoString::GetSize()` characters.
+     *
+     * @returns A pointer to the null terminator written to @p aBuffer.
+     */
+    template <size_t kSize> char *ToChars(char (&aBuffer)[kSize]) const
+    {
+        static_assert(kSize >= InfoString::GetSize(), "The buffer is too small");
+        return WriteChars(aBuffer);
+    }
+
+    /**
+     * This method appends the string representation of the Ip6 address to a string.
+     *
+     * @param[in,out] aString  The string to append to.
+     */
+    void AppendTo(std::string &aString) const;
+
     /**
      * This method indicates whether or not the Ip6 address is the Unspecified Address.
      *
@@ -303,7 +381,11 @@ public:
     };
 
 private:
+    friend class Ip6Prefix;
+
     static Ip6Address FromString(const char *aStr);
+
+    char *WriteChars(char *aBuffer) const;
 };
 
 /**
@@ -351,6 +433,25 @@ public:
      */
     bool operator!=(const Ip6Prefix &aOther) const;
 
+    /**
+     * This method indicates whether the Ip6 prefix contains an Ip6 address.
+     *
+     * The first `mLength` bits are compared as two masked 64-bit words.
+     *
+     * @param[in] aAddress  The Ip6 address.
+     *
+     * @retval TRUE   The first `mLength` bits of @p aAddress match the Ip6 prefix.
+     * @retval FALSE  The first `mLength` bits of @p aAddress don't match the Ip6 prefix.
+     */
+    bool Contains(const Ip6Address &aAddress) const;
+
+    /**
+     * This method returns the Ip6 prefix as an Ip6 address, with the bits beyond the prefix length cleared.
+     *
+     * @returns The masked Ip6 prefix.
+     */
+    Ip6Address GetMaskedPrefix(void) const;
+
     /**
      * This method sets the Ip6 prefix to an `otIp6Prefix` value.
      *
@@ -365,6 +466,35 @@ public:
      */
     std::string ToString(void) const;
 
+    typedef FixedString<INET6_ADDRSTRLEN + sizeof("/128")> InfoString; ///< The fixed-size string type of an Ip6 prefix.
+
+    /**
+     * This method returns the string representation for the Ip6 prefix without allocating.
+     *
+     * @returns The string representation of the Ip6 prefix.
+     */
+    InfoString ToInfoString(void) const;
+
+    /**
+     * This method writes the string representation of the Ip6 prefix to a buffer without allocating.
+     *
+     * @param[out] aBuffer  The buffer to write to, it must hold at least `InfoString::GetSize()` characters.
+     *
+     * @returns A pointer to the null terminator written to @p aBuffer.
+     */
+    template <size_t kSize> char *ToChars(char (&aBuffer)[kSize]) const
+    {
+        static_assert(kSize >= InfoString::GetSize(), "The buffer is too small");
+        return WriteChars(aBuffer);
+    }
+
+    /**
+     * This method appends the string representation of the Ip6 prefix to a string.
+     *
+     * @param[in,out] aString  The string to append to.
+     */
+    void AppendTo(std::string &aString) const;
+
     /**
      * This method clears the Ip6 prefix to be unspecified.
      */
@@ -393,6 +523,9 @@ public:
 
     Ip6Address mPrefix; ///< The IPv6 prefix.
     uint8_t    mLength; ///< The IPv6 prefix length (in bits).
+
+private:
+    char *WriteChars(char *aBuffer) const;
 };
 
 /**
@@ -450,11 +583,43 @@ public:
      */
     std::string ToString(void) const;
 
+    typedef FixedString<sizeof("00:00:00:00:00:00")> InfoString; ///< The fixed-size string type of a MAC address.
+
+    /**
+     * This method returns the string representation for the MAC address without allocating.
+     *
+     * @returns The string representation of the MAC address.
+     */
+    InfoString ToInfoString(void) const;
+
+    /**
+     * This method writes the string representation of the MAC address to a buffer without allocating.
+     *
+     * @param[out] aBuffer  The buffer to write to, it must hold at least `InfoString::GetSize()` characters.
+     *
+     * @returns A pointer to the null terminator written to @p aBuffer.
+     */
+    template <size_t kSize> char *ToChars(char (&aBuffer)[kSize]) const
+    {
+        static_assert(kSize >= InfoString::GetSize(), "The buffer is too small");
+        return WriteChars(aBuffer);
+    }
+
+    /**
+     * This method appends the string representation of the MAC address to a string.
+     *
+     * @param[in,out] aString  The string to append to.
+     */
+    void AppendTo(std::string &aString) const;
+
     union
     {
         uint8_t  m8[6];
         uint16_t m16[3];
     };
+
+private:
+    char *WriteChars(char *aBuffer) const;
 };
 
 struct MdnsResponseCounters
@@ -469,6 +634,42 @@ struct MdnsResponseCounters
     uint32_t mInvalidState;   ///< The number of 'invalid state' responses
 };
 
+/**
+ * This structure represents a fixed-bucket histogram of mDNS operation latencies.
+ *
+ */
+struct MdnsLatencyHistogram
+{
+    static constexpr uint8_t kNumBuckets = 12;
+
+    // The exclusive upper bounds of the buckets in milliseconds, the last bucket is unbounded.
+    static constexpr uint32_t kBucketUpperBounds[kNumBuckets - 1] = {10,   25,   50,   100,   250,  500,
+                                                                     1000, 2500, 5000, 10000, 30000};
+
+    uint32_t mBuckets[kNumBuckets]; ///< The number of latencies falling in each bucket
+
+    /**
+     * This method records a latency.
+     *
+     * @param[in] aLatency  The latency in milliseconds.
+     *
+     */
+    void Record(uint32_t aLatency);
+
+    /**
+     * This method returns an estimate of a percentile of the recorded latencies.
+     *
+     * The estimate is the upper bound of the bucket the percentile falls in, or the
+     * lower bound of the last bucket if it falls in the unbounded one.
+     *
+     * @param[in] aPercentile  The percentile, between 1 and 100.
+     *
+     * @returns The estimated percentile latency in milliseconds, or 0 if nothing is recorded.
+     *
+     */
+    uint32_t GetPercentile(uint8_t aPercentile) const;
+};
+
 struct MdnsTelemetryInfo
 {
     static constexpr uint32_t kEmaFactorNumerator   = 1;
@@ -489,6 +690,28 @@ struct MdnsTelemetryInfo
     uint32_t mServiceRegistrationEmaLatency; ///< The EMA latency of service registrations in milliseconds
     uint32_t mHostResolutionEmaLatency;      ///< The EMA latency of host resolutions in milliseconds
     uint32_t mServiceResolutionEmaLatency;   ///< The EMA latency of service resolutions in milliseconds
+
+    MdnsLatencyHistogram mHostRegistrationLatency;    ///< The latency histogram of host registrations
+    MdnsLatencyHistogram mKeyRegistrationLatency;     ///< The latency histogram of key registrations
+    MdnsLatencyHistogram mServiceRegistrationLatency; ///< The latency histogram of service registrations
+    MdnsLatencyHistogram mHostResolutionLatency;      ///< The latency histogram of host resolutions
+    MdnsLatencyHistogram mServiceResolutionLatency;   ///< The latency histogram of service resolutions
+};
+
+struct TrelDnssdTelemetryInfo
+{
+    uint32_t mPeerDiscoveries;       ///< The number of TREL peer instances discovered
+    uint32_t mPeerRemovals;          ///< The number of TREL peer instances removed by mDNS
+    uint32_t mPeerEvictions;         ///< The number of TREL peer instances evicted because the peer cache is full
+    uint32_t mDuplicatePeers;        ///< The number of TREL peer instances discovered for an already known peer
+    uint32_t mInvalidPeers;          ///< The number of TREL peer instances ignored because of invalid TXT data
+    uint32_t mUnchangedResolutions;  ///< The number of resolutions of known TREL peer instances without any change
+    uint32_t mPeerNotifications;     ///< The number of TREL peer changes notified to OpenThread
+    uint32_t mServiceRepublications; ///< The number of times the TREL service is republished
+    uint32_t mRestoredPeers;         ///< The number of TREL peer instances restored from the peer cache
+    uint32_t mUnresolvedPeers;       ///< The number of restored TREL peer instances removed as not resolved again
+
+    MdnsLatencyHistogram mDiscoveryLatency; ///< The latency histogram from starting browsing to discovering peers
 };
 
 static constexpr size_t kVendorOuiLength      = 3;
@@ -506,4 +729,31 @@ otError OtbrErrorToOtError(otbrError aError);
 
 } // namespace otbr
 
+namespace std {
+
+/**
+ * This specialization hashes an Ip6 address, so it can be the key of unordered containers.
+ */
+template <> struct hash<otbr::Ip6Address>
+{
+    size_t operator()(const otbr::Ip6Address &aAddress) const
+    {
+        // Addresses sharing a prefix, such as the DUAs of a domain, only differ in the IID, so both words are mixed.
+        return hash<uint64_t>()(aAddress.m64[1] ^ (aAddress.m64[0] * 0x9e3779b97f4a7c15ULL));
+    }
+};
+
+/**
+ * This specialization hashes an Ip6 prefix consistently with `Ip6Prefix::operator==`.
+ */
+template <> struct hash<otbr::Ip6Prefix>
+{
+    size_t operator()(const otbr::Ip6Prefix &aPrefix) const
+    {
+        return hash<otbr::Ip6Address>()(aPrefix.GetMaskedPrefix()) ^ aPrefix.mLength;
+    }
+};
+
+} // namespace std
+
 #endif // OTBR_COMMON_TYPES_HPP_
@@ -0,0 +1,105 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements a pool of worker threads for CPU-bound work off the mainloop.
+ */
+
+#include "common/worker_pool.hpp"
+
+#include <assert.h>
+
+#include "common/thread_scheduling.hpp"
+
+namespace otbr {
+
+WorkerPool::WorkerPool(size_t aNumThreads)
+    : mStopping(false)
+{
+    assert(aNumThreads > 0);
+
+    for (size_t i = 0; i < aNumThreads; i++)
+    {
+        mThreads.emplace_back(&WorkerPool::Run, this);
+    }
+}
+
+WorkerPool::~WorkerPool(void)
+{
+    {
+        std::lock_guard<std::mutex> _(mMutex);
+
+        mStopping = true;
+    }
+
+    mCondition.notify_all();
+
+    for (std::thread &thread : mThreads)
+    {
+        thread.join();
+    }
+}
+
+void WorkerPool::Post(Work<void> aWork)
+{
+    {
+        std::lock_guard<std::mutex> _(mMutex);
+
+        mQueue.push_back(std::move(aWork));
+    }
+
+    mCondition.notify_one();
+}
+
+void WorkerPool::Run(void)
+{
+    ThreadScheduling::Get().ApplyToManagementThread();
+
+    while (true)
+    {
+        Work<void> work;
+
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+
+            mCondition.wait(lock, [this]() { return mStopping || !mQueue.empty(); });
+            VerifyOrExit(!mStopping);
+
+            work = std::move(mQueue.front());
+            mQueue.pop_front();
+        }
+
+        work();
+    }
+
+exit:
+    return;
+}
+
+} // namespace otbr
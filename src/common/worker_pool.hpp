@@ -0,0 +1,164 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines a pool of worker threads for CPU-bound work off the mainloop.
+ */
+
+#ifndef OTBR_COMMON_WORKER_POOL_HPP_
+#define OTBR_COMMON_WORKER_POOL_HPP_
+
+#include "openthread-br/config.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/callback.hpp"
+#include "common/code_utils.hpp"
+#include "common/task_runner.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a pool of worker threads.
+ *
+ * The work posted to the pool runs on the worker threads, in parallel with the mainloop, and must not access the
+ * OpenThread instance or any other state owned by the mainloop. The typical use is to run CPU-bound work, e.g.
+ * serializing a large message, on a copy of the data, and to continue on the mainloop with the result.
+ *
+ * The destructor waits for the work being run, and drops the work not started yet.
+ */
+class WorkerPool : private NonCopyable
+{
+public:
+    template <class T> using Work = UniqueFunction<T(void)>;
+
+    /**
+     * This constructor initializes the worker pool and starts its threads.
+     *
+     * @param[in] aNumThreads  The number of worker threads, at least one.
+     */
+    explicit WorkerPool(size_t aNumThreads);
+
+    /**
+     * This destructor stops the worker threads.
+     */
+    ~WorkerPool(void);
+
+    /**
+     * This method posts work to the worker threads and returns immediately.
+     *
+     * This method is thread-safe.
+     *
+     * @param[in] aWork  The work to run.
+     */
+    void Post(Work<void> aWork);
+
+    /**
+     * This method posts work to the worker threads, and continues on the task runner with its result.
+     *
+     * The work is destroyed on the worker thread before the continuation is posted. The continuation is not called
+     * if the pool is destroyed before the work is started.
+     *
+     * This method is thread-safe.
+     *
+     * @param[in] aWork          The work to run on a worker thread.
+     * @param[in] aTaskRunner    The task runner to run the continuation, which must outlive the work.
+     * @param[in] aContinuation  The continuation called on the task runner with the result of the work.
+     */
+    template <class T> void Post(Work<T> aWork, TaskRunner &aTaskRunner, UniqueFunction<void(T)> aContinuation)
+    {
+        Post(Job<T>(std::move(aWork), aTaskRunner, std::move(aContinuation)));
+    }
+
+    /**
+     * This method returns the number of worker threads.
+     *
+     * @returns The number of worker threads.
+     */
+    size_t GetNumThreads(void) const { return mThreads.size(); }
+
+private:
+    template <class T> class Continuation
+    {
+    public:
+        Continuation(UniqueFunction<void(T)> aContinuation, T aResult)
+            : mContinuation(std::move(aContinuation))
+            , mResult(std::move(aResult))
+        {
+        }
+
+        void operator()(void) { mContinuation(std::move(mResult)); }
+
+    private:
+        UniqueFunction<void(T)> mContinuation;
+        T                       mResult;
+    };
+
+    template <class T> class Job
+    {
+    public:
+        Job(Work<T> aWork, TaskRunner &aTaskRunner, UniqueFunction<void(T)> aContinuation)
+            : mWork(std::move(aWork))
+            , mTaskRunner(aTaskRunner)
+            , mContinuation(std::move(aContinuation))
+        {
+        }
+
+        void operator()(void)
+        {
+            T result = mWork();
+
+            // Release what the work holds before the continuation may run, so that objects shared by both are
+            // always released last by the continuation on the task runner.
+            mWork = nullptr;
+            mTaskRunner.Post(Continuation<T>(std::move(mContinuation), std::move(result)));
+        }
+
+    private:
+        Work<T>                 mWork;
+        TaskRunner             &mTaskRunner;
+        UniqueFunction<void(T)> mContinuation;
+    };
+
+    void Run(void);
+
+    std::vector<std::thread> mThreads;
+    std::mutex               mMutex;
+    std::condition_variable  mCondition;
+    std::deque<Work<void>>   mQueue;
+    bool                     mStopping;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_WORKER_POOL_HPP_
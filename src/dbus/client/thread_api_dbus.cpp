@@ -98,9 +98,13 @@ ThreadApiDBus::ThreadApiDBus(DBusConnection *aConnection, const std::string &aIn
 
 ClientError ThreadApiDBus::SubscribeDeviceRoleSignal(void)
 {
-    std::string matchRule = "type='signal',interface='" DBUS_INTERFACE_PROPERTIES "'";
-    DBusError   error;
-    ClientError ret = ClientError::ERROR_NONE;
+    std::string       matchRule = "type='signal',interface='" DBUS_INTERFACE_PROPERTIES "'";
+    DBusError         error;
+    ClientError       ret = ClientError::ERROR_NONE;
+    UniqueDBusMessage subscribe(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
+                                                             (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+                                                             OTBR_DBUS_THREAD_INTERFACE,
+                                                             OTBR_DBUS_SUBSCRIBE_SIGNALS_METHOD));
 
     dbus_error_init(&error);
     dbus_bus_add_match(mConnection, matchRule.c_str(), &error);
@@ -108,6 +112,12 @@ ClientError ThreadApiDBus::SubscribeDeviceRoleSignal(void)
     VerifyOrExit(!dbus_error_is_set(&error), ret = ClientError::OT_ERROR_FAILED);
 
     dbus_connection_add_filter(mConnection, sDBusMessageFilter, this, nullptr);
+
+    // Asks the agent to send its signals, which it may suppress while no client subscribed. The reply isn't
+    // awaited, an agent not knowing the method sends its signals anyway.
+    VerifyOrExit(subscribe != nullptr, ret = ClientError::ERROR_DBUS);
+    dbus_message_set_no_reply(subscribe.get(), true);
+    VerifyOrExit(dbus_connection_send(mConnection, subscribe.get(), nullptr), ret = ClientError::ERROR_DBUS);
 exit:
     dbus_error_free(&error);
     return ret;
@@ -136,6 +146,10 @@ DBusHandlerResult ThreadApiDBus::DBusMessageFilter(DBusConnection *aConnection,
     SuccessOrExit(DBusMessageExtract(&iter, interfaceName));
     VerifyOrExit(interfaceName == OTBR_DBUS_THREAD_INTERFACE);
 
+    // A change of one property often comes with changes of others the agent doesn't signal, e.g. the RLOC16 and the
+    // tables change with the device role.
+    InvalidatePropertyCache();
+
     VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY);
     dbus_message_iter_recurse(&iter, &subIter);
     VerifyOrExit(dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_DICT_ENTRY);
@@ -163,6 +177,41 @@ void ThreadApiDBus::AddDeviceRoleHandler(const DeviceRoleHandler &aHandler)
     mDeviceRoleHandlers.push_back(aHandler);
 }
 
+void ThreadApiDBus::SetPropertyCacheMaxAge(std::chrono::milliseconds aMaxAge)
+{
+    mPropertyCacheMaxAge = aMaxAge;
+    InvalidatePropertyCache();
+}
+
+DBusMessage *ThreadApiDBus::FindCachedProperty(const std::string &aPropertyName)
+{
+    DBusMessage *reply = nullptr;
+    auto         it    = mPropertyCache.find(aPropertyName);
+
+    VerifyOrExit(it != mPropertyCache.end());
+
+    if (it->second.mExpireTime <= std::chrono::steady_clock::now())
+    {
+        mPropertyCache.erase(it);
+        ExitNow();
+    }
+
+    reply = it->second.mReply.get();
+
+exit:
+    return reply;
+}
+
+void ThreadApiDBus::CacheProperty(const std::string &aPropertyName, UniqueDBusMessage aReply)
+{
+    VerifyOrExit(mPropertyCacheMaxAge.count() > 0);
+
+    mPropertyCache[aPropertyName] = {std::move(aReply), std::chrono::steady_clock::now() + mPropertyCacheMaxAge};
+
+exit:
+    return;
+}
+
 ClientError ThreadApiDBus::Scan(const ScanHandler &aHandler)
 {
     ClientError error = ClientError::ERROR_NONE;
@@ -228,6 +277,40 @@ void ThreadApiDBus::EnergyScanPendingCallHandler(DBusPendingCall *aPending)
     mEnergyScanHandler = nullptr;
 }
 
+ClientError ThreadApiDBus::SurveyScan(uint32_t aChannelMask, uint32_t aScanDuration, const SurveyScanHandler &aHandler)
+{
+    ClientError error = ClientError::ERROR_NONE;
+    const auto  args  = std::tie(aChannelMask, aScanDuration);
+
+    VerifyOrExit(mSurveyScanHandler == nullptr, error = ClientError::OT_ERROR_INVALID_STATE);
+    mSurveyScanHandler = aHandler;
+
+    error = CallDBusMethodAsync(OTBR_DBUS_SURVEY_SCAN_METHOD, args,
+                                &ThreadApiDBus::sHandleDBusPendingCall<&ThreadApiDBus::SurveyScanPendingCallHandler>);
+    if (error != ClientError::ERROR_NONE)
+    {
+        mSurveyScanHandler = nullptr;
+    }
+exit:
+    return error;
+}
+
+void ThreadApiDBus::SurveyScanPendingCallHandler(DBusPendingCall *aPending)
+{
+    std::vector<ActiveScanResult> scanResults;
+    std::vector<EnergyScanResult> energyScanResults;
+    UniqueDBusMessage             message(dbus_pending_call_steal_reply(aPending));
+    auto                          args = std::tie(scanResults, energyScanResults);
+
+    if (message != nullptr)
+    {
+        DBusMessageToTuple(*message, args);
+    }
+
+    mSurveyScanHandler(scanResults, energyScanResults);
+    mSurveyScanHandler = nullptr;
+}
+
 ClientError ThreadApiDBus::PermitUnsecureJoin(uint16_t aPort, uint32_t aSeconds)
 {
     return CallDBusMethodSync(OTBR_DBUS_PERMIT_UNSECURE_JOIN_METHOD, std::tie(aPort, aSeconds));
@@ -463,6 +546,16 @@ ClientError ThreadApiDBus::SetNat64Enabled(bool aEnabled)
     return CallDBusMethodSync(OTBR_DBUS_SET_NAT64_ENABLED_METHOD, std::tie(aEnabled));
 }
 
+ClientError ThreadApiDBus::SetLogTagLevel(const std::string &aLogTag, int32_t aLevel)
+{
+    return CallDBusMethodSync(OTBR_DBUS_SET_LOG_TAG_LEVEL_METHOD, std::tie(aLogTag, aLevel));
+}
+
+ClientError ThreadApiDBus::ReloadConfig(void)
+{
+    return CallDBusMethodSync(OTBR_DBUS_RELOAD_CONFIG_METHOD);
+}
+
 ClientError ThreadApiDBus::SetEphemeralKeyEnabled(bool aEnabled)
 {
     return SetProperty(OTBR_DBUS_PROPERTY_EPHEMERAL_KEY_ENABLED, aEnabled);
@@ -554,6 +647,11 @@ ClientError ThreadApiDBus::GetIp6Counters(IpCounters &aCounters)
     return GetProperty(OTBR_DBUS_PROPERTY_IP6_COUNTERS, aCounters);
 }
 
+ClientError ThreadApiDBus::GetCounterHistory(std::vector<CounterHistoryInfo> &aHistory)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_COUNTER_HISTORY, aHistory);
+}
+
 ClientError ThreadApiDBus::GetSupportedChannelMask(uint32_t &aChannelMask)
 {
     return GetProperty(OTBR_DBUS_PROPERTY_SUPPORTED_CHANNEL_MASK, aChannelMask);
@@ -609,6 +707,16 @@ ClientError ThreadApiDBus::GetChannelMonitorAllChannelQualities(std::vector<Chan
     return GetProperty(OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_ALL_CHANNEL_QUALITIES, aChannelQualities);
 }
 
+ClientError ThreadApiDBus::GetChannelOccupancy(std::vector<ChannelQuality> &aChannelQualities)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_CHANNEL_OCCUPANCY, aChannelQualities);
+}
+
+ClientError ThreadApiDBus::GetRecommendedChannel(uint8_t &aChannel)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_RECOMMENDED_CHANNEL, aChannel);
+}
+
 ClientError ThreadApiDBus::GetChildTable(std::vector<ChildInfo> &aChildTable)
 {
     return GetProperty(OTBR_DBUS_PROPERTY_CHILD_TABLE, aChildTable);
@@ -733,6 +841,7 @@ ClientError ThreadApiDBus::CallDBusMethodSync(const std::string &aMethodName)
     DBusError         error;
 
     dbus_error_init(&error);
+    InvalidatePropertyCache();
     VerifyOrExit(message != nullptr, ret = ClientError::ERROR_DBUS);
     reply = UniqueDBusMessage(
         dbus_connection_send_with_reply_and_block(mConnection, message.get(), DBUS_TIMEOUT_USE_DEFAULT, &error));
@@ -752,6 +861,7 @@ ClientError ThreadApiDBus::CallDBusMethodAsync(const std::string &aMethodName, D
                                                            OTBR_DBUS_THREAD_INTERFACE, aMethodName.c_str()));
     DBusPendingCall  *pending = nullptr;
 
+    InvalidatePropertyCache();
     VerifyOrExit(message != nullptr, ret = ClientError::OT_ERROR_FAILED);
     VerifyOrExit(dbus_connection_send_with_reply(mConnection, message.get(), &pending, DBUS_TIMEOUT_USE_DEFAULT) ==
                      true,
@@ -763,6 +873,118 @@ exit:
     return ret;
 }
 
+ClientError ThreadApiDBus::SendMethodCallAsync(const char               *aInterfaceName,
+                                               const std::string        &aMethodName,
+                                               const MessageBuilder     &aBuilder,
+                                               const MethodReplyHandler &aHandler)
+{
+    ClientError         ret = ClientError::ERROR_NONE;
+    UniqueDBusMessage   message(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
+                                                             (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+                                                             aInterfaceName, aMethodName.c_str()));
+    DBusPendingCall    *pending = nullptr;
+    MethodReplyHandler *handler = nullptr;
+
+    // Only the reads leave the properties unchanged.
+    if (aMethodName != DBUS_PROPERTY_GET_METHOD && aMethodName != OTBR_DBUS_GET_PROPERTIES_METHOD)
+    {
+        InvalidatePropertyCache();
+    }
+
+    VerifyOrExit(message != nullptr, ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(aBuilder == nullptr || aBuilder(*message) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(dbus_connection_send_with_reply(mConnection, message.get(), &pending, DBUS_TIMEOUT_USE_DEFAULT) &&
+                     pending != nullptr,
+                 ret = ClientError::ERROR_DBUS);
+
+    // The pending call owns the handler from here on and frees it when the call completes or times out.
+    handler = new MethodReplyHandler(aHandler);
+    if (!dbus_pending_call_set_notify(pending, sHandleMethodReply, handler, sFreeMethodReplyHandler))
+    {
+        delete handler;
+        dbus_pending_call_cancel(pending);
+        ExitNow(ret = ClientError::ERROR_DBUS);
+    }
+
+exit:
+    if (pending != nullptr)
+    {
+        dbus_pending_call_unref(pending);
+    }
+    return ret;
+}
+
+void ThreadApiDBus::sHandleMethodReply(DBusPendingCall *aPending, void *aHandler)
+{
+    const MethodReplyHandler &handler = *static_cast<MethodReplyHandler *>(aHandler);
+    UniqueDBusMessage         reply(dbus_pending_call_steal_reply(aPending));
+    ClientError               error = ClientError::ERROR_DBUS;
+
+    if (reply != nullptr)
+    {
+        error = DBus::CheckErrorMessage(reply.get());
+    }
+
+    if (handler)
+    {
+        handler(error, error == ClientError::ERROR_NONE ? reply.get() : nullptr);
+    }
+}
+
+void ThreadApiDBus::sFreeMethodReplyHandler(void *aHandler)
+{
+    delete static_cast<MethodReplyHandler *>(aHandler);
+}
+
+ClientError ThreadApiDBus::CallMethodAsync(const std::string &aMethodName, const MethodReplyHandler &aHandler)
+{
+    return SendMethodCallAsync(OTBR_DBUS_THREAD_INTERFACE, aMethodName, nullptr, aHandler);
+}
+
+ClientError ThreadApiDBus::GetPropertyAsync(const std::string &aPropertyName, const PropertyValueHandler &aHandler)
+{
+    return SendMethodCallAsync(
+        DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTY_GET_METHOD,
+        [&aPropertyName](DBusMessage &aMessage) {
+            return TupleToDBusMessage(aMessage, std::tie(OTBR_DBUS_THREAD_INTERFACE, aPropertyName));
+        },
+        [aHandler](ClientError aError, DBusMessage *aReply) {
+            DBusMessageIter iter;
+
+            if (aError == ClientError::ERROR_NONE && !dbus_message_iter_init(aReply, &iter))
+            {
+                aError = ClientError::ERROR_DBUS;
+            }
+
+            aHandler(aError, aError == ClientError::ERROR_NONE ? &iter : nullptr);
+        });
+}
+
+ClientError ThreadApiDBus::GetPropertiesAsync(const std::vector<std::string> &aPropertyNames,
+                                              const PropertyValueHandler     &aHandler)
+{
+    return SendMethodCallAsync(
+        OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_PROPERTIES_METHOD,
+        [&aPropertyNames](DBusMessage &aMessage) { return TupleToDBusMessage(aMessage, std::tie(aPropertyNames)); },
+        [aHandler](ClientError aError, DBusMessage *aReply) {
+            DBusMessageIter iter;
+            DBusMessageIter subIter;
+
+            if (aError == ClientError::ERROR_NONE &&
+                (!dbus_message_iter_init(aReply, &iter) || dbus_message_iter_get_arg_type(&iter) != DBUS_TYPE_ARRAY))
+            {
+                aError = ClientError::ERROR_DBUS;
+            }
+
+            if (aError == ClientError::ERROR_NONE)
+            {
+                dbus_message_iter_recurse(&iter, &subIter);
+            }
+
+            aHandler(aError, aError == ClientError::ERROR_NONE ? &subIter : nullptr);
+        });
+}
+
 template <typename ArgType>
 ClientError ThreadApiDBus::CallDBusMethodSync(const std::string &aMethodName, const ArgType &aArgs)
 {
@@ -774,6 +996,7 @@ ClientError ThreadApiDBus::CallDBusMethodSync(const std::string &aMethodName, co
     DBusError               error;
 
     dbus_error_init(&error);
+    InvalidatePropertyCache();
     VerifyOrExit(message != nullptr, ret = ClientError::ERROR_DBUS);
     VerifyOrExit(otbr::DBus::TupleToDBusMessage(*message, aArgs) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
     reply = DBus::UniqueDBusMessage(
@@ -798,6 +1021,7 @@ ClientError ThreadApiDBus::CallDBusMethodAsync(const std::string            &aMe
                                                                  OTBR_DBUS_THREAD_INTERFACE, aMethodName.c_str()));
     DBusPendingCall        *pending = nullptr;
 
+    InvalidatePropertyCache();
     VerifyOrExit(message != nullptr, ret = ClientError::ERROR_DBUS);
     VerifyOrExit(DBus::TupleToDBusMessage(*message, aArgs) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
     VerifyOrExit(dbus_connection_send_with_reply(mConnection, message.get(), &pending, DBUS_TIMEOUT_USE_DEFAULT) ==
@@ -822,6 +1046,7 @@ ClientError ThreadApiDBus::SetProperty(const std::string &aPropertyName, const V
     DBusMessageIter         iter;
 
     dbus_error_init(&error);
+    InvalidatePropertyCache();
     VerifyOrExit(message != nullptr, ret = ClientError::OT_ERROR_FAILED);
 
     dbus_message_iter_init_append(message.get(), &iter);
@@ -843,16 +1068,28 @@ exit:
 
 template <typename ValType> ClientError ThreadApiDBus::GetProperty(const std::string &aPropertyName, ValType &aValue)
 {
-    DBus::UniqueDBusMessage message(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
-                                                                 (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
-                                                                 DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTY_GET_METHOD));
-    DBus::UniqueDBusMessage reply = nullptr;
+    DBusMessage            *cachedReply = FindCachedProperty(aPropertyName);
+    DBus::UniqueDBusMessage message     = nullptr;
+    DBus::UniqueDBusMessage reply       = nullptr;
 
     ClientError     ret = ClientError::ERROR_NONE;
     DBusError       error;
     DBusMessageIter iter;
 
     dbus_error_init(&error);
+
+    if (cachedReply != nullptr)
+    {
+        VerifyOrExit(dbus_message_iter_init(cachedReply, &iter), ret = ClientError::ERROR_DBUS);
+        VerifyOrExit(DBus::DBusMessageExtractFromVariant(&iter, aValue) == OTBR_ERROR_NONE,
+                     ret = ClientError::ERROR_DBUS);
+        ExitNow();
+    }
+
+    message = DBus::UniqueDBusMessage(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
+                                                                   (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+                                                                   DBUS_INTERFACE_PROPERTIES,
+                                                                   DBUS_PROPERTY_GET_METHOD));
     VerifyOrExit(message != nullptr, ret = ClientError::OT_ERROR_FAILED);
     otbr::DBus::TupleToDBusMessage(*message, std::tie(OTBR_DBUS_THREAD_INTERFACE, aPropertyName));
     reply = DBus::UniqueDBusMessage(
@@ -863,6 +1100,7 @@ template <typename ValType> ClientError ThreadApiDBus::GetProperty(const std::st
     SuccessOrExit(DBus::CheckErrorMessage(reply.get()));
     VerifyOrExit(dbus_message_iter_init(reply.get(), &iter), ret = ClientError::ERROR_DBUS);
     VerifyOrExit(DBus::DBusMessageExtractFromVariant(&iter, aValue) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+    CacheProperty(aPropertyName, std::move(reply));
 
 exit:
     dbus_error_free(&error);
@@ -36,12 +36,19 @@
 
 #include "openthread-br/config.h"
 
+#include <chrono>
 #include <functional>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
 
 #include <dbus/dbus.h>
 
 #include "common/types.hpp"
 #include "dbus/common/constants.hpp"
+#include "dbus/common/dbus_message_helper.hpp"
+#include "dbus/common/dbus_resources.hpp"
 #include "dbus/common/error.hpp"
 #include "dbus/common/types.hpp"
 
@@ -56,8 +63,27 @@ public:
     using DeviceRoleHandler = std::function<void(DeviceRole)>;
     using ScanHandler       = std::function<void(const std::vector<ActiveScanResult> &)>;
     using EnergyScanHandler = std::function<void(const std::vector<EnergyScanResult> &)>;
+    using SurveyScanHandler =
+        std::function<void(const std::vector<ActiveScanResult> &, const std::vector<EnergyScanResult> &)>;
     using OtResultHandler   = std::function<void(ClientError)>;
 
+    /**
+     * The handler of an asynchronous method call.
+     *
+     * @param[in] aError  The result of the call.
+     * @param[in] aReply  The reply message on success, `nullptr` otherwise. It's only valid during the call.
+     */
+    using MethodReplyHandler = std::function<void(ClientError aError, DBusMessage *aReply)>;
+
+    /**
+     * The handler of an asynchronous property read.
+     *
+     * @param[in] aError      The result of the read.
+     * @param[in] aValueIter  The iterator of the value(s) on success, `nullptr` otherwise. It's only valid during
+     *                        the call.
+     */
+    using PropertyValueHandler = std::function<void(ClientError aError, DBusMessageIter *aValueIter)>;
+
     /**
      * The constructor of a d-bus object.
      *
@@ -119,6 +145,20 @@ public:
      */
     ClientError EnergyScan(uint32_t aScanDuration, const EnergyScanHandler &aHandler);
 
+    /**
+     * This method performs a Thread network scan and an IEEE 802.15.4 Energy Scan of each channel in turn.
+     *
+     * @param[in] aChannelMask   The channels to scan, 0 for the preferred channels.
+     * @param[in] aScanDuration  The duration for each scan of each channel, in milliseconds. Note that maximum value
+     *                           for the duration is currently 65535.
+     * @param[in] aHandler       The survey scan result handler.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     */
+    ClientError SurveyScan(uint32_t aChannelMask, uint32_t aScanDuration, const SurveyScanHandler &aHandler);
+
     /**
      * This method attaches the device to the Thread network.
      * @param[in] aNetworkName  The network name.
@@ -347,6 +387,27 @@ public:
      */
     ClientError SetNat64Enabled(bool aEnabled);
 
+    /**
+     * This method overrides the log level of one otbr-agent module.
+     *
+     * @param[in] aLogTag  The log tag of the module, e.g. "NDPROXY".
+     * @param[in] aLevel   The log level of the module, a negative level removes the override.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     */
+    ClientError SetLogTagLevel(const std::string &aLogTag, int32_t aLevel);
+
+    /**
+     * This method reloads the configuration of otbr-agent, like on SIGHUP.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     */
+    ClientError ReloadConfig(void);
+
     /**
      * This method sets the Ephemeral Key switch.
      *
@@ -479,6 +540,17 @@ public:
      */
     ClientError GetIp6Counters(IpCounters &aCounters); // For telemetry
 
+    /**
+     * This method gets the recent history of the counters of the Thread interface and of the neighbors.
+     *
+     * @param[out] aHistory  The history of the Thread interface, followed by the history of each neighbor.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     */
+    ClientError GetCounterHistory(std::vector<CounterHistoryInfo> &aHistory);
+
     /**
      * This method gets the supported channel mask.
      *
@@ -601,6 +673,29 @@ public:
      */
     ClientError GetChannelMonitorAllChannelQualities(std::vector<ChannelQuality> &aChannelQualities);
 
+    /**
+     * This method gets the channel occupancies sampled in the background by the agent.
+     *
+     * @param[out] aChannelQualities  The channel qualities.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     */
+    ClientError GetChannelOccupancy(std::vector<ChannelQuality> &aChannelQualities);
+
+    /**
+     * This method gets the least occupied preferred channel.
+     *
+     * @param[out] aChannel  The recommended channel.
+     *
+     * @retval ERROR_NONE              Successfully performed the dbus function call
+     * @retval ERROR_DBUS              dbus encode/decode error
+     * @retval OT_ERROR_INVALID_STATE  The channels are not sampled enough yet
+     * @retval ...                     OpenThread defined error value otherwise
+     */
+    ClientError GetRecommendedChannel(uint8_t &aChannel);
+
     /**
      * This method gets the child table.
      *
@@ -864,7 +959,164 @@ public:
      */
     ClientError GetCapabilities(std::vector<uint8_t> &aCapabilities);
 
+    /**
+     * This method calls a method of the Thread interface without blocking.
+     *
+     * None of the asynchronous methods block on the bus: the request is queued on the connection and @p aHandler
+     * is invoked when the caller's mainloop dispatches the connection, e.g. with
+     * `dbus_connection_read_write_dispatch()` or its own watch integration.
+     *
+     * @param[in] aMethodName  The method name.
+     * @param[in] aHandler     The handler of the reply.
+     *
+     * @retval ERROR_NONE  Successfully sent the request.
+     * @retval ERROR_DBUS  dbus encode/send error
+     */
+    ClientError CallMethodAsync(const std::string &aMethodName, const MethodReplyHandler &aHandler);
+
+    /**
+     * This method calls a method of the Thread interface with arguments without blocking.
+     *
+     * @param[in] aMethodName  The method name.
+     * @param[in] aArgs        The method arguments.
+     * @param[in] aHandler     The handler of the reply.
+     *
+     * @retval ERROR_NONE  Successfully sent the request.
+     * @retval ERROR_DBUS  dbus encode/send error
+     */
+    template <typename... FieldTypes>
+    ClientError CallMethodAsync(const std::string               &aMethodName,
+                                const std::tuple<FieldTypes...> &aArgs,
+                                const MethodReplyHandler        &aHandler)
+    {
+        return SendMethodCallAsync(
+            OTBR_DBUS_THREAD_INTERFACE, aMethodName,
+            [&aArgs](DBusMessage &aMessage) { return TupleToDBusMessage(aMessage, aArgs); }, aHandler);
+    }
+
+    /**
+     * This method reads a property without blocking.
+     *
+     * @param[in] aPropertyName  The property name.
+     * @param[in] aHandler       The handler of the value, which is passed as a variant iterator.
+     *
+     * @retval ERROR_NONE  Successfully sent the request.
+     * @retval ERROR_DBUS  dbus encode/send error
+     */
+    ClientError GetPropertyAsync(const std::string &aPropertyName, const PropertyValueHandler &aHandler);
+
+    /**
+     * This method reads a property of type @p ValType without blocking.
+     *
+     * @param[in] aPropertyName  The property name.
+     * @param[in] aHandler       The handler of the decoded value.
+     *
+     * @retval ERROR_NONE  Successfully sent the request.
+     * @retval ERROR_DBUS  dbus encode/send error
+     */
+    template <typename ValType>
+    ClientError GetPropertyAsync(const std::string                                      &aPropertyName,
+                                 const std::function<void(ClientError, const ValType &)> &aHandler)
+    {
+        PropertyValueHandler handler = [aHandler](ClientError aError, DBusMessageIter *aIter) {
+            ValType value{};
+
+            if (aError == ClientError::ERROR_NONE && DBusMessageExtractFromVariant(aIter, value) != OTBR_ERROR_NONE)
+            {
+                aError = ClientError::ERROR_DBUS;
+            }
+
+            aHandler(aError, value);
+        };
+
+        return GetPropertyAsync(aPropertyName, handler);
+    }
+
+    /**
+     * This method writes a property without blocking.
+     *
+     * @param[in] aPropertyName  The property name.
+     * @param[in] aValue         The new value.
+     * @param[in] aHandler       The handler of the result.
+     *
+     * @retval ERROR_NONE  Successfully sent the request.
+     * @retval ERROR_DBUS  dbus encode/send error
+     */
+    template <typename ValType>
+    ClientError SetPropertyAsync(const std::string &aPropertyName, const ValType &aValue, const OtResultHandler &aHandler)
+    {
+        return SendMethodCallAsync(
+            DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTY_SET_METHOD,
+            [&aPropertyName, &aValue](DBusMessage &aMessage) {
+                otbrError       error = OTBR_ERROR_NONE;
+                DBusMessageIter iter;
+
+                dbus_message_iter_init_append(&aMessage, &iter);
+                SuccessOrExit(error = DBusMessageEncode(&iter, OTBR_DBUS_THREAD_INTERFACE));
+                SuccessOrExit(error = DBusMessageEncode(&iter, aPropertyName));
+                error = DBusMessageEncodeToVariant(&iter, aValue);
+
+            exit:
+                return error;
+            },
+            [aHandler](ClientError aError, DBusMessage *) {
+                if (aHandler)
+                {
+                    aHandler(aError);
+                }
+            });
+    }
+
+    /**
+     * This method reads multiple properties in one round trip without blocking.
+     *
+     * On success, @p aHandler gets an iterator over one variant per property, in the order of @p aPropertyNames.
+     * Decode each of them with `DBusMessageExtractFromVariant()` and move to the next one with
+     * `dbus_message_iter_next()`.
+     *
+     * @param[in] aPropertyNames  The property names.
+     * @param[in] aHandler        The handler of the values.
+     *
+     * @retval ERROR_NONE  Successfully sent the request.
+     * @retval ERROR_DBUS  dbus encode/send error
+     */
+    ClientError GetPropertiesAsync(const std::vector<std::string> &aPropertyNames, const PropertyValueHandler &aHandler);
+
+    /**
+     * This method sets the maximum age of the property values cached by the getters.
+     *
+     * The cache is disabled by default. When it's enabled, a getter serves the value it last read without a D-Bus
+     * round trip, until any of the following happens:
+     * - the value is older than @p aMaxAge;
+     * - a `PropertiesChanged` signal of the Thread interface is delivered, which drops all the cached values;
+     * - a property is set or a method is called through this object.
+     *
+     * Signals are only delivered while the connection is dispatched, e.g. by `dbus_connection_read_write_dispatch()`.
+     * @p aMaxAge also bounds how stale the properties are for which the agent doesn't signal changes, such as the
+     * RLOC16 or the child table.
+     *
+     * @param[in] aMaxAge  The maximum age of a cached value, zero disables the cache.
+     */
+    void SetPropertyCacheMaxAge(std::chrono::milliseconds aMaxAge);
+
 private:
+    // A property value read by a getter, kept in the reply of the `Get` call so that any type can be cached.
+    struct CachedProperty
+    {
+        UniqueDBusMessage                     mReply;
+        std::chrono::steady_clock::time_point mExpireTime;
+    };
+
+    using MessageBuilder = std::function<otbrError(DBusMessage &aMessage)>;
+
+    ClientError SendMethodCallAsync(const char               *aInterfaceName,
+                                    const std::string        &aMethodName,
+                                    const MessageBuilder     &aBuilder,
+                                    const MethodReplyHandler &aHandler);
+
+    static void sHandleMethodReply(DBusPendingCall *aPending, void *aHandler);
+    static void sFreeMethodReplyHandler(void *aHandler);
+
     ClientError CallDBusMethodSync(const std::string &aMethodName);
     ClientError CallDBusMethodAsync(const std::string &aMethodName, DBusPendingCallNotifyFunction aFunction);
 
@@ -879,6 +1131,10 @@ private:
 
     template <typename ValType> ClientError GetProperty(const std::string &aPropertyName, ValType &aValue);
 
+    DBusMessage *FindCachedProperty(const std::string &aPropertyName);
+    void         CacheProperty(const std::string &aPropertyName, UniqueDBusMessage aReply);
+    void         InvalidatePropertyCache(void) { mPropertyCache.clear(); }
+
     ClientError              SubscribeDeviceRoleSignal(void);
     static DBusHandlerResult sDBusMessageFilter(DBusConnection *aConnection, DBusMessage *aMessage, void *aData);
     DBusHandlerResult        DBusMessageFilter(DBusConnection *aConnection, DBusMessage *aMessage);
@@ -893,6 +1149,7 @@ private:
     static void sScanPendingCallHandler(DBusPendingCall *aPending, void *aThreadApiDBus);
     void        ScanPendingCallHandler(DBusPendingCall *aPending);
     void        EnergyScanPendingCallHandler(DBusPendingCall *aPending);
+    void        SurveyScanPendingCallHandler(DBusPendingCall *aPending);
 
     static void EmptyFree(void *)
     {
@@ -904,12 +1161,16 @@ private:
 
     ScanHandler       mScanHandler;
     EnergyScanHandler mEnergyScanHandler;
+    SurveyScanHandler mSurveyScanHandler;
     OtResultHandler   mAttachHandler;
     OtResultHandler   mDetachHandler;
     OtResultHandler   mFactoryResetHandler;
     OtResultHandler   mJoinerHandler;
 
     std::vector<DeviceRoleHandler> mDeviceRoleHandlers;
+
+    std::chrono::milliseconds             mPropertyCacheMaxAge{0};
+    std::map<std::string, CachedProperty> mPropertyCache;
 };
 
 } // namespace DBus
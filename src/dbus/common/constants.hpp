@@ -46,6 +46,7 @@
 
 #define OTBR_DBUS_SCAN_METHOD "Scan"
 #define OTBR_DBUS_ENERGY_SCAN_METHOD "EnergyScan"
+#define OTBR_DBUS_SURVEY_SCAN_METHOD "SurveyScan"
 #define OTBR_DBUS_ATTACH_METHOD "Attach"
 #define OTBR_DBUS_DETACH_METHOD "Detach"
 #define OTBR_DBUS_JOIN_METHOD "Join"
@@ -66,6 +67,15 @@
 #define OTBR_DBUS_ACTIVATE_EPHEMERAL_KEY_MODE_METHOD "ActivateEphemeralKeyMode"
 #define OTBR_DBUS_DEACTIVATE_EPHEMERAL_KEY_MODE_METHOD "DeactivateEphemeralKeyMode"
 #define OTBR_DBUS_SCHEDULE_MIGRATION_METHOD "ScheduleMigration"
+#define OTBR_DBUS_GET_TELEMETRY_DATA_METHOD "GetTelemetryData"
+#define OTBR_DBUS_GET_TELEMETRY_DATA_PAGE_METHOD "GetTelemetryDataPage"
+#define OTBR_DBUS_GET_CHILD_TABLE_DELTA_METHOD "GetChildTableDelta"
+#define OTBR_DBUS_GET_NEIGHBOR_TABLE_DELTA_METHOD "GetNeighborTableDelta"
+#define OTBR_DBUS_GET_EXTERNAL_ROUTES_DELTA_METHOD "GetExternalRoutesDelta"
+#define OTBR_DBUS_SET_LOG_TAG_LEVEL_METHOD "SetLogTagLevel"
+#define OTBR_DBUS_RELOAD_CONFIG_METHOD "ReloadConfig"
+#define OTBR_DBUS_SUBSCRIBE_SIGNALS_METHOD "SubscribeSignals"
+#define OTBR_DBUS_UNSUBSCRIBE_SIGNALS_METHOD "UnsubscribeSignals"
 
 #define OTBR_DBUS_PROPERTY_MESH_LOCAL_PREFIX "MeshLocalPrefix"
 #define OTBR_DBUS_PROPERTY_LINK_MODE "LinkMode"
@@ -78,6 +88,7 @@
 #define OTBR_DBUS_PROPERTY_CCA_FAILURE_RATE "CcaFailureRate"
 #define OTBR_DBUS_PROPERTY_LINK_COUNTERS "LinkCounters"
 #define OTBR_DBUS_PROPERTY_IP6_COUNTERS "Ip6Counters"
+#define OTBR_DBUS_PROPERTY_COUNTER_HISTORY "CounterHistory"
 #define OTBR_DBUS_PROPERTY_SUPPORTED_CHANNEL_MASK "LinkSupportedChannelMask"
 #define OTBR_DBUS_PROPERTY_PREFERRED_CHANNEL_MASK "LinkPreferredChannelMask"
 #define OTBR_DBUS_PROPERTY_RLOC16 "Rloc16"
@@ -89,6 +100,8 @@
 #define OTBR_DBUS_PROPERTY_LOCAL_LEADER_WEIGHT "LocalLeaderWeight"
 #define OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_SAMPLE_COUNT "ChannelMonitorSampleCount"
 #define OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_ALL_CHANNEL_QUALITIES "ChannelMonitorAllChannelQualities"
+#define OTBR_DBUS_PROPERTY_CHANNEL_OCCUPANCY "ChannelOccupancy"
+#define OTBR_DBUS_PROPERTY_RECOMMENDED_CHANNEL "RecommendedChannel"
 #define OTBR_DBUS_PROPERTY_CHILD_TABLE "ChildTable"
 #define OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_PROEPRTY "NeighborTable"
 #define OTBR_DBUS_PROPERTY_PARTITION_ID_PROEPRTY "PartitionID"
@@ -125,6 +138,7 @@
 #define OTBR_DBUS_PROPERTY_DHCP6_PD_STATE "Dhcp6PdState"
 #define OTBR_DBUS_PROPERTY_TELEMETRY_DATA "TelemetryData"
 #define OTBR_DBUS_PROPERTY_CAPABILITIES "Capabilities"
+#define OTBR_DBUS_PROPERTY_SPINEL_FRAME_TRACE "SpinelFrameTrace"
 
 #define OTBR_NAT64_STATE_NAME_DISABLED "disabled"
 #define OTBR_NAT64_STATE_NAME_NOT_RUNNING "not_running"
@@ -132,5 +146,7 @@
 #define OTBR_NAT64_STATE_NAME_ACTIVE "active"
 
 #define OTBR_DBUS_SIGNAL_READY "Ready"
+#define OTBR_DBUS_SIGNAL_SCAN_RESULT "ScanResult"
+#define OTBR_DBUS_SIGNAL_ENERGY_SCAN_RESULT "EnergyScanResult"
 
 #endif // OTBR_DBUS_CONSTANTS_HPP_
@@ -30,6 +30,8 @@
 
 #include "dbus_message_dump.hpp"
 
+#include <algorithm>
+#include <inttypes.h>
 #include <sstream>
 
 #include "common/code_utils.hpp"
@@ -38,12 +40,17 @@
 namespace otbr {
 namespace DBus {
 
-static void DumpDBusMessage(std::ostringstream &sout, DBusMessageIter *aIter)
+static void DumpDBusMessage(std::ostringstream &sout, DBusMessageIter *aIter, size_t aMaxLength = 0)
 {
     int type = dbus_message_iter_get_arg_type(aIter);
 
     while (type != DBUS_TYPE_INVALID)
     {
+        if (aMaxLength != 0 && static_cast<size_t>(sout.tellp()) >= aMaxLength)
+        {
+            break;
+        }
+
         switch (type)
         {
         case DBUS_TYPE_BOOLEAN:
@@ -124,7 +131,7 @@ static void DumpDBusMessage(std::ostringstream &sout, DBusMessageIter *aIter)
 
             dbus_message_iter_recurse(aIter, &subIter);
             sout << "[ ";
-            DumpDBusMessage(sout, &subIter);
+            DumpDBusMessage(sout, &subIter, aMaxLength);
             sout << "], ";
             break;
         }
@@ -135,7 +142,7 @@ static void DumpDBusMessage(std::ostringstream &sout, DBusMessageIter *aIter)
 
             dbus_message_iter_recurse(aIter, &subIter);
             sout << "{ ";
-            DumpDBusMessage(sout, &subIter);
+            DumpDBusMessage(sout, &subIter, aMaxLength);
             sout << " }, ";
             break;
         }
@@ -152,7 +159,7 @@ static void DumpDBusMessage(std::ostringstream &sout, DBusMessageIter *aIter)
             {
                 DBusMessageIter valueIter;
                 dbus_message_iter_recurse(&subIter, &valueIter);
-                DumpDBusMessage(sout, &valueIter);
+                DumpDBusMessage(sout, &valueIter, aMaxLength);
             }
             sout << "}, ";
             break;
@@ -181,5 +188,199 @@ exit:
     return;
 }
 
+std::string DBusMessageToString(DBusMessage &aMessage, size_t aMaxLength)
+{
+    DBusMessageIter    iter;
+    std::ostringstream sout;
+
+    sout << "{ ";
+    if (dbus_message_iter_init(&aMessage, &iter))
+    {
+        DumpDBusMessage(sout, &iter, aMaxLength);
+    }
+
+    if (aMaxLength != 0 && static_cast<size_t>(sout.tellp()) >= aMaxLength)
+    {
+        sout << "...";
+    }
+    else
+    {
+        sout << "}";
+    }
+
+    return sout.str();
+}
+
+constexpr size_t  DBusMessageTracer::kDefaultMaxDumpLength;
+constexpr Seconds DBusMessageTracer::kSummaryInterval;
+
+DBusMessageTracer &DBusMessageTracer::Get(void)
+{
+    static DBusMessageTracer sTracer;
+
+    return sTracer;
+}
+
+DBusMessageTracer::DBusMessageTracer(void)
+    : mSampleInterval(0)
+    , mSampleCounter(0)
+    , mMaxDumpLength(kDefaultMaxDumpLength)
+    , mLastSummaryTime(Clock::now())
+{
+}
+
+void DBusMessageTracer::Configure(uint32_t aSampleInterval, size_t aMaxDumpLength)
+{
+    mSampleInterval  = aSampleInterval;
+    mSampleCounter   = 0;
+    mMaxDumpLength   = aMaxDumpLength;
+    mLastSummaryTime = Clock::now();
+    mStats.clear();
+
+    otbrLogInfo("D-Bus tracing %s, sample interval %u, max dump length %zu", IsEnabled() ? "enabled" : "disabled",
+                aSampleInterval, aMaxDumpLength);
+}
+
+bool DBusMessageTracer::Sample(void)
+{
+    bool sampled = (++mSampleCounter >= mSampleInterval);
+
+    if (sampled)
+    {
+        mSampleCounter = 0;
+    }
+
+    return sampled;
+}
+
+static uint64_t GetMessageSize(DBusMessage &aMessage)
+{
+    char *marshalled = nullptr;
+    int   length     = 0;
+
+    if (dbus_message_marshal(&aMessage, &marshalled, &length))
+    {
+        dbus_free(marshalled);
+    }
+
+    return static_cast<uint64_t>(length);
+}
+
+DBusMessageTracer::Stats &DBusMessageTracer::GetStats(const char *aKind, DBusMessage &aMessage)
+{
+    const char *interfaceName = dbus_message_get_interface(&aMessage);
+    const char *memberName    = dbus_message_get_member(&aMessage);
+    std::string key(aKind);
+
+    key += ' ';
+    key += (interfaceName != nullptr ? interfaceName : "?");
+    key += '.';
+    key += (memberName != nullptr ? memberName : "?");
+
+    return mStats[key];
+}
+
+void DBusMessageTracer::TraceReply(DBusMessage &aCall, DBusMessage &aReply, Timepoint aReceiveTime)
+{
+    Stats   *stats;
+    uint64_t latencyUs;
+
+    VerifyOrExit(IsEnabled());
+
+    stats     = &GetStats("call", aCall);
+    latencyUs = static_cast<uint64_t>(std::chrono::duration_cast<Microseconds>(Clock::now() - aReceiveTime).count());
+
+    stats->mCount++;
+    stats->mTotalLatencyUs += latencyUs;
+    stats->mMaxLatencyUs = std::max(stats->mMaxLatencyUs, latencyUs);
+
+    if (dbus_message_get_type(&aReply) == DBUS_MESSAGE_TYPE_ERROR)
+    {
+        stats->mErrorCount++;
+    }
+
+    if (Sample())
+    {
+        uint64_t replyBytes = GetMessageSize(aReply);
+
+        stats->mSampledCount++;
+        stats->mSampledCallBytes += GetMessageSize(aCall);
+        stats->mSampledReplyBytes += replyBytes;
+        stats->mMaxReplyBytes = std::max(stats->mMaxReplyBytes, replyBytes);
+
+        if (mMaxDumpLength != 0)
+        {
+            otbrLogInfo("Trace %s.%s %" PRIu64 "us: %s -> %s", dbus_message_get_interface(&aCall),
+                        dbus_message_get_member(&aCall), latencyUs,
+                        DBusMessageToString(aCall, mMaxDumpLength).c_str(),
+                        DBusMessageToString(aReply, mMaxDumpLength).c_str());
+        }
+    }
+
+    MaybeLogSummary();
+
+exit:
+    return;
+}
+
+void DBusMessageTracer::TraceSignal(DBusMessage &aSignal)
+{
+    Stats *stats;
+
+    VerifyOrExit(IsEnabled());
+
+    stats = &GetStats("signal", aSignal);
+    stats->mCount++;
+
+    if (Sample())
+    {
+        uint64_t bytes = GetMessageSize(aSignal);
+
+        stats->mSampledCount++;
+        stats->mSampledReplyBytes += bytes;
+        stats->mMaxReplyBytes = std::max(stats->mMaxReplyBytes, bytes);
+
+        if (mMaxDumpLength != 0)
+        {
+            otbrLogInfo("Trace signal %s.%s: %s", dbus_message_get_interface(&aSignal),
+                        dbus_message_get_member(&aSignal), DBusMessageToString(aSignal, mMaxDumpLength).c_str());
+        }
+    }
+
+    MaybeLogSummary();
+
+exit:
+    return;
+}
+
+void DBusMessageTracer::MaybeLogSummary(void)
+{
+    if (Clock::now() - mLastSummaryTime >= kSummaryInterval)
+    {
+        LogSummary();
+    }
+}
+
+void DBusMessageTracer::LogSummary(void)
+{
+    otbrLogInfo("D-Bus trace summary of the last %" PRIu64 "s:",
+                static_cast<uint64_t>(std::chrono::duration_cast<Seconds>(Clock::now() - mLastSummaryTime).count()));
+
+    for (const auto &entry : mStats)
+    {
+        const Stats &stats = entry.second;
+
+        otbrLogInfo("  %s: count=%" PRIu64 " errors=%" PRIu64 " avg=%" PRIu64 "us max=%" PRIu64 "us sampled=%" PRIu64
+                    " avg-in=%" PRIu64 "B avg-out=%" PRIu64 "B max-out=%" PRIu64 "B",
+                    entry.first.c_str(), stats.mCount, stats.mErrorCount,
+                    stats.mCount ? stats.mTotalLatencyUs / stats.mCount : 0, stats.mMaxLatencyUs, stats.mSampledCount,
+                    stats.mSampledCount ? stats.mSampledCallBytes / stats.mSampledCount : 0,
+                    stats.mSampledCount ? stats.mSampledReplyBytes / stats.mSampledCount : 0, stats.mMaxReplyBytes);
+    }
+
+    mStats.clear();
+    mLastSummaryTime = Clock::now();
+}
+
 } // namespace DBus
 } // namespace otbr
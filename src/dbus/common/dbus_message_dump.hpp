@@ -36,8 +36,13 @@
 
 #include "openthread-br/config.h"
 
+#include <map>
+#include <string>
+
 #include <dbus/dbus.h>
 
+#include "common/time.hpp"
+
 namespace otbr {
 namespace DBus {
 
@@ -48,6 +53,102 @@ namespace DBus {
  */
 void DumpDBusMessage(DBusMessage &aMessage);
 
+/**
+ * This function formats the arguments of a DBus message, stopping the walk once the output exceeds @p aMaxLength
+ * characters.
+ *
+ * @param[in] aMessage    The DBus message to format.
+ * @param[in] aMaxLength  The maximum length of the output, 0 for unlimited.
+ *
+ * @returns The formatted arguments, ending with "..." if truncated.
+ */
+std::string DBusMessageToString(DBusMessage &aMessage, size_t aMaxLength);
+
+/**
+ * This class implements sampled, bounded-cost tracing of the D-Bus traffic of the server.
+ *
+ * When enabled, every method call and signal is counted and the handling latency of method calls is aggregated per
+ * method. Only every Nth message is sampled: its size is measured and a truncated dump is logged at info level, so the
+ * cost of tracing stays bounded on busy gateways. The aggregated statistics are logged periodically.
+ *
+ * The tracer must only be used on the mainloop thread.
+ */
+class DBusMessageTracer
+{
+public:
+    static constexpr size_t kDefaultMaxDumpLength = 256; ///< Default maximum length of a sampled dump.
+
+    /**
+     * This method returns the tracer instance.
+     *
+     * @returns The tracer instance.
+     */
+    static DBusMessageTracer &Get(void);
+
+    /**
+     * This method configures the tracer.
+     *
+     * @param[in] aSampleInterval  Sample every Nth message, 0 to disable tracing.
+     * @param[in] aMaxDumpLength   The maximum length of a sampled dump, 0 to not dump sampled messages.
+     */
+    void Configure(uint32_t aSampleInterval, size_t aMaxDumpLength);
+
+    /**
+     * This method indicates whether tracing is enabled.
+     *
+     * @returns Whether tracing is enabled.
+     */
+    bool IsEnabled(void) const { return mSampleInterval != 0; }
+
+    /**
+     * This method traces a method reply, or an error reply, which is about to be sent.
+     *
+     * @param[in] aCall         The method call message.
+     * @param[in] aReply        The reply message.
+     * @param[in] aReceiveTime  The time when the method call was received.
+     */
+    void TraceReply(DBusMessage &aCall, DBusMessage &aReply, Timepoint aReceiveTime);
+
+    /**
+     * This method traces a signal which is about to be sent.
+     *
+     * @param[in] aSignal  The signal message.
+     */
+    void TraceSignal(DBusMessage &aSignal);
+
+    /**
+     * This method logs the aggregated statistics and resets them.
+     */
+    void LogSummary(void);
+
+private:
+    static constexpr Seconds kSummaryInterval = Seconds(60);
+
+    struct Stats
+    {
+        uint64_t mCount             = 0;
+        uint64_t mErrorCount        = 0;
+        uint64_t mSampledCount      = 0;
+        uint64_t mTotalLatencyUs    = 0;
+        uint64_t mMaxLatencyUs      = 0;
+        uint64_t mSampledCallBytes  = 0;
+        uint64_t mSampledReplyBytes = 0;
+        uint64_t mMaxReplyBytes     = 0;
+    };
+
+    DBusMessageTracer(void);
+
+    bool   Sample(void);
+    Stats &GetStats(const char *aKind, DBusMessage &aMessage);
+    void   MaybeLogSummary(void);
+
+    uint32_t                     mSampleInterval;
+    uint32_t                     mSampleCounter;
+    size_t                       mMaxDumpLength;
+    Timepoint                    mLastSummaryTime;
+    std::map<std::string, Stats> mStats;
+};
+
 } // namespace DBus
 } // namespace otbr
 
@@ -87,6 +87,8 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const SrpServerInfo &aSrpSer
 otbrError DBusMessageExtract(DBusMessageIter *aIter, SrpServerInfo &aSrpServerInfo);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsResponseCounters &aMdnsResponseCounters);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsResponseCounters &aMdnsResponseCounters);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsLatencyHistogram &aMdnsLatencyHistogram);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsLatencyHistogram &aMdnsLatencyHistogram);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsTelemetryInfo &aMdnsTelemetryInfo);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsTelemetryInfo &aMdnsTelemetryInfo);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const DnssdCounters &aDnssdCounters);
@@ -119,19 +121,346 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const TrelInfo &aTrelInfo);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, TrelInfo &aTrelInfo);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const TrelInfo::TrelPacketCounters &aCounters);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, TrelInfo::TrelPacketCounters &aCounters);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const CounterHistoryInfo &aHistory);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, CounterHistoryInfo &aHistory);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const CounterHistoryInfo::Counter &aCounter);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, CounterHistoryInfo::Counter &aCounter);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const SpinelFrameRecord &aRecord);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, SpinelFrameRecord &aRecord);
+
+/**
+ * This template holds a d-bus type signature as a compile-time string.
+ *
+ * @tparam kChars  The characters of the signature.
+ */
+template <char... kChars> struct DBusSignature
+{
+    static constexpr char kValue[sizeof...(kChars) + 1] = {kChars..., '\0'};
+};
+
+template <char... kChars> constexpr char DBusSignature<kChars...>::kValue[sizeof...(kChars) + 1];
+
+/**
+ * This template concatenates `DBusSignature`s.
+ */
+template <typename... SignatureTypes> struct DBusSignatureJoin;
+
+template <> struct DBusSignatureJoin<>
+{
+    using Type = DBusSignature<>;
+};
+
+template <char... kChars> struct DBusSignatureJoin<DBusSignature<kChars...>>
+{
+    using Type = DBusSignature<kChars...>;
+};
+
+template <char... kFirst, char... kSecond, typename... RestTypes>
+struct DBusSignatureJoin<DBusSignature<kFirst...>, DBusSignature<kSecond...>, RestTypes...>
+{
+    using Type = typename DBusSignatureJoin<DBusSignature<kFirst..., kSecond...>, RestTypes...>::Type;
+};
+
+/**
+ * This template describes the fields of a struct encoded as a d-bus struct.
+ *
+ * A struct is described by specializing this template to derive from `DBusStructFieldList`, listing the fields
+ * with `OTBR_DBUS_STRUCT_FIELD` in their d-bus order.
+ *
+ * @tparam StructType  The C++ struct type.
+ */
+template <typename StructType> struct DBusStructFields;
+
+/**
+ * This template gives the d-bus signature of a field type.
+ */
+template <typename ValueType> struct DBusFieldSignature
+{
+    // A type without a basic signature is a described struct.
+    using Type = typename DBusStructFields<ValueType>::Signature;
+};
+
+template <> struct DBusFieldSignature<bool>
+{
+    using Type = DBusSignature<'b'>;
+};
+
+template <> struct DBusFieldSignature<int8_t>
+{
+    // D-Bus doesn't have a signed byte
+    using Type = DBusSignature<'y'>;
+};
+
+template <> struct DBusFieldSignature<uint8_t>
+{
+    using Type = DBusSignature<'y'>;
+};
+
+template <> struct DBusFieldSignature<int16_t>
+{
+    using Type = DBusSignature<'n'>;
+};
+
+template <> struct DBusFieldSignature<uint16_t>
+{
+    using Type = DBusSignature<'q'>;
+};
+
+template <> struct DBusFieldSignature<int32_t>
+{
+    using Type = DBusSignature<'i'>;
+};
+
+template <> struct DBusFieldSignature<uint32_t>
+{
+    using Type = DBusSignature<'u'>;
+};
+
+template <> struct DBusFieldSignature<int64_t>
+{
+    using Type = DBusSignature<'x'>;
+};
+
+template <> struct DBusFieldSignature<uint64_t>
+{
+    using Type = DBusSignature<'t'>;
+};
+
+template <> struct DBusFieldSignature<std::string>
+{
+    using Type = DBusSignature<'s'>;
+};
+
+template <typename ValueType> struct DBusFieldSignature<std::vector<ValueType>>
+{
+    using Type = typename DBusSignatureJoin<DBusSignature<'a'>, typename DBusFieldSignature<ValueType>::Type>::Type;
+};
+
+template <typename ValueType, size_t SIZE> struct DBusFieldSignature<std::array<ValueType, SIZE>>
+{
+    using Type = typename DBusSignatureJoin<DBusSignature<'a'>, typename DBusFieldSignature<ValueType>::Type>::Type;
+};
+
+/**
+ * This template describes one field of a struct.
+ *
+ * @tparam StructType  The C++ struct type.
+ * @tparam FieldType   The type of the field.
+ * @tparam kMember     The pointer to the field.
+ */
+template <typename StructType, typename FieldType, FieldType StructType::*kMember> struct DBusStructField
+{
+    using Type = FieldType;
+
+    static const FieldType &Get(const StructType &aValue) { return aValue.*kMember; }
+    static FieldType       &Get(StructType &aValue) { return aValue.*kMember; }
+};
+
+/**
+ * This macro describes the field @p aFieldName of @p aStructType for `DBusStructFieldList`.
+ */
+#define OTBR_DBUS_STRUCT_FIELD(aStructType, aFieldName) \
+    ::otbr::DBus::DBusStructField<aStructType, decltype(aStructType::aFieldName), &aStructType::aFieldName>
+
+/**
+ * This template lists the fields of a struct, and generates its d-bus signature.
+ *
+ * @tparam StructType  The C++ struct type.
+ * @tparam FieldTypes  The `DBusStructField`s of the struct, in their d-bus order.
+ */
+template <typename StructType, typename... FieldTypes> struct DBusStructFieldList
+{
+    using Fields    = DBusStructFieldList;
+    using Signature = typename DBusSignatureJoin<DBusSignature<'('>,
+                                                 typename DBusFieldSignature<typename FieldTypes::Type>::Type...,
+                                                 DBusSignature<')'>>::Type;
+};
+
+template <>
+struct DBusStructFields<IpCounters> : DBusStructFieldList<IpCounters,
+                                                          OTBR_DBUS_STRUCT_FIELD(IpCounters, mTxSuccess),
+                                                          OTBR_DBUS_STRUCT_FIELD(IpCounters, mRxSuccess),
+                                                          OTBR_DBUS_STRUCT_FIELD(IpCounters, mTxFailure),
+                                                          OTBR_DBUS_STRUCT_FIELD(IpCounters, mRxFailure)>
+{
+};
+
+template <>
+struct DBusStructFields<MacCounters> : DBusStructFieldList<MacCounters,
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mTxTotal),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mTxUnicast),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mTxBroadcast),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mTxAckRequested),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mTxAcked),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mTxNoAckRequested),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mTxData),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mTxDataPoll),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mTxBeacon),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mTxBeaconRequest),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mTxOther),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mTxRetry),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mTxErrCca),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mTxErrAbort),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mTxErrBusyChannel),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mRxTotal),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mRxUnicast),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mRxBroadcast),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mRxData),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mRxDataPoll),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mRxBeacon),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mRxBeaconRequest),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mRxOther),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mRxAddressFiltered),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mRxDestAddrFiltered),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mRxDuplicated),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mRxErrNoFrame),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mRxErrUnknownNeighbor),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mRxErrInvalidSrcAddr),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mRxErrSec),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mRxErrFcs),
+                                                           OTBR_DBUS_STRUCT_FIELD(MacCounters, mRxErrOther)>
+{
+};
+
+template <>
+struct DBusStructFields<ChildInfo> : DBusStructFieldList<ChildInfo,
+                                                         OTBR_DBUS_STRUCT_FIELD(ChildInfo, mExtAddress),
+                                                         OTBR_DBUS_STRUCT_FIELD(ChildInfo, mTimeout),
+                                                         OTBR_DBUS_STRUCT_FIELD(ChildInfo, mAge),
+                                                         OTBR_DBUS_STRUCT_FIELD(ChildInfo, mRloc16),
+                                                         OTBR_DBUS_STRUCT_FIELD(ChildInfo, mChildId),
+                                                         OTBR_DBUS_STRUCT_FIELD(ChildInfo, mNetworkDataVersion),
+                                                         OTBR_DBUS_STRUCT_FIELD(ChildInfo, mLinkQualityIn),
+                                                         OTBR_DBUS_STRUCT_FIELD(ChildInfo, mAverageRssi),
+                                                         OTBR_DBUS_STRUCT_FIELD(ChildInfo, mLastRssi),
+                                                         OTBR_DBUS_STRUCT_FIELD(ChildInfo, mFrameErrorRate),
+                                                         OTBR_DBUS_STRUCT_FIELD(ChildInfo, mMessageErrorRate),
+                                                         OTBR_DBUS_STRUCT_FIELD(ChildInfo, mRxOnWhenIdle),
+                                                         OTBR_DBUS_STRUCT_FIELD(ChildInfo, mFullThreadDevice),
+                                                         OTBR_DBUS_STRUCT_FIELD(ChildInfo, mFullNetworkData),
+                                                         OTBR_DBUS_STRUCT_FIELD(ChildInfo, mIsStateRestoring)>
+{
+};
+
+template <>
+struct DBusStructFields<NeighborInfo> : DBusStructFieldList<NeighborInfo,
+                                                            OTBR_DBUS_STRUCT_FIELD(NeighborInfo, mExtAddress),
+                                                            OTBR_DBUS_STRUCT_FIELD(NeighborInfo, mAge),
+                                                            OTBR_DBUS_STRUCT_FIELD(NeighborInfo, mRloc16),
+                                                            OTBR_DBUS_STRUCT_FIELD(NeighborInfo, mLinkFrameCounter),
+                                                            OTBR_DBUS_STRUCT_FIELD(NeighborInfo, mMleFrameCounter),
+                                                            OTBR_DBUS_STRUCT_FIELD(NeighborInfo, mLinkQualityIn),
+                                                            OTBR_DBUS_STRUCT_FIELD(NeighborInfo, mAverageRssi),
+                                                            OTBR_DBUS_STRUCT_FIELD(NeighborInfo, mLastRssi),
+                                                            OTBR_DBUS_STRUCT_FIELD(NeighborInfo, mFrameErrorRate),
+                                                            OTBR_DBUS_STRUCT_FIELD(NeighborInfo, mMessageErrorRate),
+                                                            OTBR_DBUS_STRUCT_FIELD(NeighborInfo, mVersion),
+                                                            OTBR_DBUS_STRUCT_FIELD(NeighborInfo, mRxOnWhenIdle),
+                                                            OTBR_DBUS_STRUCT_FIELD(NeighborInfo, mFullThreadDevice),
+                                                            OTBR_DBUS_STRUCT_FIELD(NeighborInfo, mFullNetworkData),
+                                                            OTBR_DBUS_STRUCT_FIELD(NeighborInfo, mIsChild)>
+{
+};
+
+template <>
+struct DBusStructFields<LeaderData> : DBusStructFieldList<LeaderData,
+                                                          OTBR_DBUS_STRUCT_FIELD(LeaderData, mPartitionId),
+                                                          OTBR_DBUS_STRUCT_FIELD(LeaderData, mWeighting),
+                                                          OTBR_DBUS_STRUCT_FIELD(LeaderData, mDataVersion),
+                                                          OTBR_DBUS_STRUCT_FIELD(LeaderData, mStableDataVersion),
+                                                          OTBR_DBUS_STRUCT_FIELD(LeaderData, mLeaderRouterId)>
+{
+};
+
+template <>
+struct DBusStructFields<ChannelQuality> : DBusStructFieldList<ChannelQuality,
+                                                              OTBR_DBUS_STRUCT_FIELD(ChannelQuality, mChannel),
+                                                              OTBR_DBUS_STRUCT_FIELD(ChannelQuality, mOccupancy)>
+{
+};
+
+template <>
+struct DBusStructFields<TxtEntry> : DBusStructFieldList<TxtEntry,
+                                                        OTBR_DBUS_STRUCT_FIELD(TxtEntry, mKey),
+                                                        OTBR_DBUS_STRUCT_FIELD(TxtEntry, mValue)>
+{
+};
+
+template <>
+struct DBusStructFields<SrpServerInfo::Registration>
+    : DBusStructFieldList<SrpServerInfo::Registration,
+                          OTBR_DBUS_STRUCT_FIELD(SrpServerInfo::Registration, mFreshCount),
+                          OTBR_DBUS_STRUCT_FIELD(SrpServerInfo::Registration, mDeletedCount),
+                          OTBR_DBUS_STRUCT_FIELD(SrpServerInfo::Registration, mLeaseTimeTotal),
+                          OTBR_DBUS_STRUCT_FIELD(SrpServerInfo::Registration, mKeyLeaseTimeTotal),
+                          OTBR_DBUS_STRUCT_FIELD(SrpServerInfo::Registration, mRemainingLeaseTimeTotal),
+                          OTBR_DBUS_STRUCT_FIELD(SrpServerInfo::Registration, mRemainingKeyLeaseTimeTotal)>
+{
+};
+
+template <>
+struct DBusStructFields<SrpServerInfo::ResponseCounters>
+    : DBusStructFieldList<SrpServerInfo::ResponseCounters,
+                          OTBR_DBUS_STRUCT_FIELD(SrpServerInfo::ResponseCounters, mSuccess),
+                          OTBR_DBUS_STRUCT_FIELD(SrpServerInfo::ResponseCounters, mServerFailure),
+                          OTBR_DBUS_STRUCT_FIELD(SrpServerInfo::ResponseCounters, mFormatError),
+                          OTBR_DBUS_STRUCT_FIELD(SrpServerInfo::ResponseCounters, mNameExists),
+                          OTBR_DBUS_STRUCT_FIELD(SrpServerInfo::ResponseCounters, mRefused),
+                          OTBR_DBUS_STRUCT_FIELD(SrpServerInfo::ResponseCounters, mOther)>
+{
+};
+
+template <>
+struct DBusStructFields<TrelInfo::TrelPacketCounters>
+    : DBusStructFieldList<TrelInfo::TrelPacketCounters,
+                          OTBR_DBUS_STRUCT_FIELD(TrelInfo::TrelPacketCounters, mTxPackets),
+                          OTBR_DBUS_STRUCT_FIELD(TrelInfo::TrelPacketCounters, mTxBytes),
+                          OTBR_DBUS_STRUCT_FIELD(TrelInfo::TrelPacketCounters, mTxFailure),
+                          OTBR_DBUS_STRUCT_FIELD(TrelInfo::TrelPacketCounters, mRxPackets),
+                          OTBR_DBUS_STRUCT_FIELD(TrelInfo::TrelPacketCounters, mRxBytes)>
+{
+};
+
+template <>
+struct DBusStructFields<CounterHistoryInfo::Counter>
+    : DBusStructFieldList<CounterHistoryInfo::Counter,
+                          OTBR_DBUS_STRUCT_FIELD(CounterHistoryInfo::Counter, mName),
+                          OTBR_DBUS_STRUCT_FIELD(CounterHistoryInfo::Counter, mValue),
+                          OTBR_DBUS_STRUCT_FIELD(CounterHistoryInfo::Counter, mRatePerMinute),
+                          OTBR_DBUS_STRUCT_FIELD(CounterHistoryInfo::Counter, mDeltas)>
+{
+};
+
+template <>
+struct DBusStructFields<CounterHistoryInfo>
+    : DBusStructFieldList<CounterHistoryInfo,
+                          OTBR_DBUS_STRUCT_FIELD(CounterHistoryInfo, mExtAddress),
+                          OTBR_DBUS_STRUCT_FIELD(CounterHistoryInfo, mIntervals),
+                          OTBR_DBUS_STRUCT_FIELD(CounterHistoryInfo, mCounters)>
+{
+};
+
+template <>
+struct DBusStructFields<SpinelFrameRecord> : DBusStructFieldList<SpinelFrameRecord,
+                                                                 OTBR_DBUS_STRUCT_FIELD(SpinelFrameRecord, mTimestamp),
+                                                                 OTBR_DBUS_STRUCT_FIELD(SpinelFrameRecord, mDirection),
+                                                                 OTBR_DBUS_STRUCT_FIELD(SpinelFrameRecord, mHeader),
+                                                                 OTBR_DBUS_STRUCT_FIELD(SpinelFrameRecord, mCommand),
+                                                                 OTBR_DBUS_STRUCT_FIELD(SpinelFrameRecord, mPropKey),
+                                                                 OTBR_DBUS_STRUCT_FIELD(SpinelFrameRecord, mLength)>
+{
+};
 
 template <typename T> struct DBusTypeTrait;
 
 template <> struct DBusTypeTrait<IpCounters>
 {
-    // struct of 32 bytes
-    static constexpr const char *TYPE_AS_STRING = "(uuuu)";
+    static constexpr const char *TYPE_AS_STRING = DBusFieldSignature<IpCounters>::Type::kValue;
 };
 
 template <> struct DBusTypeTrait<MacCounters>
 {
-    // struct of 32 bytes
-    static constexpr const char *TYPE_AS_STRING = "(uuuuuuuuuuuuuuuuuuuuuuuuuuuuuuuu)";
+    static constexpr const char *TYPE_AS_STRING = DBusFieldSignature<MacCounters>::Type::kValue;
 };
 
 template <> struct DBusTypeTrait<LinkModeConfig>
@@ -184,35 +513,27 @@ template <> struct DBusTypeTrait<std::vector<OnMeshPrefix>>
 
 template <> struct DBusTypeTrait<LeaderData>
 {
-    // struct of { uint32, byte, byte, byte, byte }
-    static constexpr const char *TYPE_AS_STRING = "(uyyyy)";
+    static constexpr const char *TYPE_AS_STRING = DBusFieldSignature<LeaderData>::Type::kValue;
 };
 
 template <> struct DBusTypeTrait<std::vector<ChannelQuality>>
 {
-    // array of struct of { uint8, uint16 }
-    static constexpr const char *TYPE_AS_STRING = "a(yq)";
+    static constexpr const char *TYPE_AS_STRING = DBusFieldSignature<std::vector<ChannelQuality>>::Type::kValue;
 };
 
 template <> struct DBusTypeTrait<NeighborInfo>
 {
-    // struct of { uint64, uint32, uint16, uint32, uint32, uint8,
-    //             uint8, uint8, uint16, uint16, uint16, bool, bool, bool, bool }
-    static constexpr const char *TYPE_AS_STRING = "(tuquuyyyqqqbbbb)";
+    static constexpr const char *TYPE_AS_STRING = DBusFieldSignature<NeighborInfo>::Type::kValue;
 };
 
 template <> struct DBusTypeTrait<std::vector<NeighborInfo>>
 {
-    // array of struct of { uint64, uint32, uint16, uint32, uint32, uint8,
-    //                      uint8, uint8, uint16, uint16, uint16, bool, bool, bool }
-    static constexpr const char *TYPE_AS_STRING = "a(tuquuyyyqqqbbbb)";
+    static constexpr const char *TYPE_AS_STRING = DBusFieldSignature<std::vector<NeighborInfo>>::Type::kValue;
 };
 
 template <> struct DBusTypeTrait<ChildInfo>
 {
-    // struct of { uint64, uint32, uint32, uint16, uint16, uint8, uint8,
-    //             uint8, uint8, uint16, uint16, bool, bool, bool, bool }
-    static constexpr const char *TYPE_AS_STRING = "(tuuqqyyyyqqbbbb)";
+    static constexpr const char *TYPE_AS_STRING = DBusFieldSignature<ChildInfo>::Type::kValue;
 };
 
 template <> struct DBusTypeTrait<ActiveScanResult>
@@ -230,27 +551,22 @@ template <> struct DBusTypeTrait<EnergyScanResult>
 
 template <> struct DBusTypeTrait<ChannelQuality>
 {
-    // struct of { uint8, uint16}
-    static constexpr const char *TYPE_AS_STRING = "(yq)";
+    static constexpr const char *TYPE_AS_STRING = DBusFieldSignature<ChannelQuality>::Type::kValue;
 };
 
 template <> struct DBusTypeTrait<std::vector<ChildInfo>>
 {
-    // array of struct of { uint64, uint32, uint32, uint16, uint16, uint8, uint8,
-    //                      uint8, uint8, uint16, uint16, bool, bool, bool, bool }
-    static constexpr const char *TYPE_AS_STRING = "a(tuuqqyyyyqqbbbb)";
+    static constexpr const char *TYPE_AS_STRING = DBusFieldSignature<std::vector<ChildInfo>>::Type::kValue;
 };
 
 template <> struct DBusTypeTrait<TxtEntry>
 {
-    // struct of { string, array<uint8> }
-    static constexpr const char *TYPE_AS_STRING = "(say)";
+    static constexpr const char *TYPE_AS_STRING = DBusFieldSignature<TxtEntry>::Type::kValue;
 };
 
 template <> struct DBusTypeTrait<std::vector<TxtEntry>>
 {
-    // array of struct of { string, array<uint8> }
-    static constexpr const char *TYPE_AS_STRING = "a(say)";
+    static constexpr const char *TYPE_AS_STRING = DBusFieldSignature<std::vector<TxtEntry>>::Type::kValue;
 };
 
 template <> struct DBusTypeTrait<SrpServerState>
@@ -280,8 +596,11 @@ template <> struct DBusTypeTrait<MdnsTelemetryInfo>
     //              struct of { uint32, uint32, uint32, uint32, uint32, uint32, uint32, uint32 },
     //              struct of { uint32, uint32, uint32, uint32, uint32, uint32, uint32, uint32 },
     //              struct of { uint32, uint32, uint32, uint32, uint32, uint32, uint32, uint32 },
-    //              uint32, uint32, uint32, uint32 }
-    static constexpr const char *TYPE_AS_STRING = "((uuuuuuuu)(uuuuuuuu)(uuuuuuuu)(uuuuuuuu)uuuu)";
+    //              uint32, uint32, uint32, uint32,
+    //              struct of { uint32 * MdnsLatencyHistogram::kNumBuckets } * 5 }
+    static constexpr const char *TYPE_AS_STRING = "((uuuuuuuu)(uuuuuuuu)(uuuuuuuu)(uuuuuuuu)uuuu"
+                                                  "(uuuuuuuuuuuu)(uuuuuuuuuuuu)(uuuuuuuuuuuu)(uuuuuuuuuuuu)(uuuuuuuuuuuu))";
+    static_assert(MdnsLatencyHistogram::kNumBuckets == 12, "TYPE_AS_STRING must be updated with kNumBuckets");
 };
 
 template <> struct DBusTypeTrait<DnssdCounters>
@@ -397,8 +716,32 @@ template <> struct DBusTypeTrait<TrelInfo>
 
 template <> struct DBusTypeTrait<TrelInfo::TrelPacketCounters>
 {
-    // struct of { uint64, uint64, uint64, uint64, uint64 }
-    static constexpr const char *TYPE_AS_STRING = "(ttttt)";
+    static constexpr const char *TYPE_AS_STRING = DBusFieldSignature<TrelInfo::TrelPacketCounters>::Type::kValue;
+};
+
+template <> struct DBusTypeTrait<CounterHistoryInfo::Counter>
+{
+    static constexpr const char *TYPE_AS_STRING = DBusFieldSignature<CounterHistoryInfo::Counter>::Type::kValue;
+};
+
+template <> struct DBusTypeTrait<CounterHistoryInfo>
+{
+    static constexpr const char *TYPE_AS_STRING = DBusFieldSignature<CounterHistoryInfo>::Type::kValue;
+};
+
+template <> struct DBusTypeTrait<std::vector<CounterHistoryInfo>>
+{
+    static constexpr const char *TYPE_AS_STRING = DBusFieldSignature<std::vector<CounterHistoryInfo>>::Type::kValue;
+};
+
+template <> struct DBusTypeTrait<SpinelFrameRecord>
+{
+    static constexpr const char *TYPE_AS_STRING = DBusFieldSignature<SpinelFrameRecord>::Type::kValue;
+};
+
+template <> struct DBusTypeTrait<std::vector<SpinelFrameRecord>>
+{
+    static constexpr const char *TYPE_AS_STRING = DBusFieldSignature<std::vector<SpinelFrameRecord>>::Type::kValue;
 };
 
 template <> struct DBusTypeTrait<InfraLinkInfo>
@@ -652,6 +995,94 @@ exit:
     return error;
 }
 
+template <typename StructType>
+otbrError DBusMessageEncodeFields(DBusMessageIter *aIter, const StructType &aValue, DBusStructFieldList<StructType>)
+{
+    OTBR_UNUSED_VARIABLE(aIter);
+    OTBR_UNUSED_VARIABLE(aValue);
+    return OTBR_ERROR_NONE;
+}
+
+template <typename StructType, typename FieldType, typename... RestFieldTypes>
+otbrError DBusMessageEncodeFields(DBusMessageIter *aIter,
+                                  const StructType &aValue,
+                                  DBusStructFieldList<StructType, FieldType, RestFieldTypes...>)
+{
+    otbrError error = DBusMessageEncode(aIter, FieldType::Get(aValue));
+
+    SuccessOrExit(error);
+    error = DBusMessageEncodeFields(aIter, aValue, DBusStructFieldList<StructType, RestFieldTypes...>());
+
+exit:
+    return error;
+}
+
+template <typename StructType>
+otbrError DBusMessageExtractFields(DBusMessageIter *aIter, StructType &aValue, DBusStructFieldList<StructType>)
+{
+    OTBR_UNUSED_VARIABLE(aIter);
+    OTBR_UNUSED_VARIABLE(aValue);
+    return OTBR_ERROR_NONE;
+}
+
+template <typename StructType, typename FieldType, typename... RestFieldTypes>
+otbrError DBusMessageExtractFields(DBusMessageIter *aIter,
+                                   StructType      &aValue,
+                                   DBusStructFieldList<StructType, FieldType, RestFieldTypes...>)
+{
+    otbrError error = DBusMessageExtract(aIter, FieldType::Get(aValue));
+
+    SuccessOrExit(error);
+    error = DBusMessageExtractFields(aIter, aValue, DBusStructFieldList<StructType, RestFieldTypes...>());
+
+exit:
+    return error;
+}
+
+/**
+ * This function encodes a struct described by `DBusStructFields` to a d-bus struct.
+ *
+ * @param[out] aIter   The message iterator to append the struct to.
+ * @param[in]  aValue  The struct to encode.
+ *
+ * @retval OTBR_ERROR_NONE  Successfully encoded the struct.
+ * @retval OTBR_ERROR_DBUS  Failed to encode the struct.
+ */
+template <typename StructType> otbrError DBusMessageEncodeStruct(DBusMessageIter *aIter, const StructType &aValue)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+    SuccessOrExit(error = DBusMessageEncodeFields(&sub, aValue, typename DBusStructFields<StructType>::Fields()));
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+
+exit:
+    return error;
+}
+
+/**
+ * This function extracts a struct described by `DBusStructFields` from a d-bus struct.
+ *
+ * @param[in]  aIter   The message iterator pointing to the struct.
+ * @param[out] aValue  The struct output.
+ *
+ * @retval OTBR_ERROR_NONE  Successfully extracted the struct.
+ * @retval OTBR_ERROR_DBUS  Failed to extract the struct.
+ */
+template <typename StructType> otbrError DBusMessageExtractStruct(DBusMessageIter *aIter, StructType &aValue)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+    SuccessOrExit(error = DBusMessageExtractFields(&sub, aValue, typename DBusStructFields<StructType>::Fields()));
+    dbus_message_iter_next(aIter);
+
+exit:
+    return error;
+}
+
 template <size_t I, typename... FieldTypes> struct ElementType
 {
     using ValueType         = typename std::tuple_element<I, std::tuple<FieldTypes...>>::type;
@@ -299,276 +299,92 @@ exit:
 
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const MacCounters &aCounters)
 {
-    auto args = std::tie(aCounters.mTxTotal, aCounters.mTxUnicast, aCounters.mTxBroadcast, aCounters.mTxAckRequested,
-                         aCounters.mTxAcked, aCounters.mTxNoAckRequested, aCounters.mTxData, aCounters.mTxDataPoll,
-                         aCounters.mTxBeacon, aCounters.mTxBeaconRequest, aCounters.mTxOther, aCounters.mTxRetry,
-                         aCounters.mTxErrCca, aCounters.mTxErrAbort, aCounters.mTxErrBusyChannel, aCounters.mRxTotal,
-                         aCounters.mRxUnicast, aCounters.mRxBroadcast, aCounters.mRxData, aCounters.mRxDataPoll,
-                         aCounters.mRxBeacon, aCounters.mRxBeaconRequest, aCounters.mRxOther,
-                         aCounters.mRxAddressFiltered, aCounters.mRxDestAddrFiltered, aCounters.mRxDuplicated,
-                         aCounters.mRxErrNoFrame, aCounters.mRxErrUnknownNeighbor, aCounters.mRxErrInvalidSrcAddr,
-                         aCounters.mRxErrSec, aCounters.mRxErrFcs, aCounters.mRxErrOther);
-    DBusMessageIter sub;
-    otbrError       error = OTBR_ERROR_NONE;
-
-    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
-    SuccessOrExit(error = ConvertToDBusMessage(&sub, args));
-    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub) == true, error = OTBR_ERROR_DBUS);
-exit:
-    return error;
+    return DBusMessageEncodeStruct(aIter, aCounters);
 }
 
 otbrError DBusMessageExtract(DBusMessageIter *aIter, MacCounters &aCounters)
 {
-    auto args = std::tie(aCounters.mTxTotal, aCounters.mTxUnicast, aCounters.mTxBroadcast, aCounters.mTxAckRequested,
-                         aCounters.mTxAcked, aCounters.mTxNoAckRequested, aCounters.mTxData, aCounters.mTxDataPoll,
-                         aCounters.mTxBeacon, aCounters.mTxBeaconRequest, aCounters.mTxOther, aCounters.mTxRetry,
-                         aCounters.mTxErrCca, aCounters.mTxErrAbort, aCounters.mTxErrBusyChannel, aCounters.mRxTotal,
-                         aCounters.mRxUnicast, aCounters.mRxBroadcast, aCounters.mRxData, aCounters.mRxDataPoll,
-                         aCounters.mRxBeacon, aCounters.mRxBeaconRequest, aCounters.mRxOther,
-                         aCounters.mRxAddressFiltered, aCounters.mRxDestAddrFiltered, aCounters.mRxDuplicated,
-                         aCounters.mRxErrNoFrame, aCounters.mRxErrUnknownNeighbor, aCounters.mRxErrInvalidSrcAddr,
-                         aCounters.mRxErrSec, aCounters.mRxErrFcs, aCounters.mRxErrOther);
-    DBusMessageIter sub;
-    otbrError       error = OTBR_ERROR_NONE;
-
-    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
-    SuccessOrExit(error = ConvertToTuple(&sub, args));
-    dbus_message_iter_next(aIter);
-exit:
-    return error;
+    return DBusMessageExtractStruct(aIter, aCounters);
 }
 
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const IpCounters &aCounters)
 {
-    DBusMessageIter sub;
-    otbrError       error = OTBR_ERROR_NONE;
-    auto args = std::tie(aCounters.mTxSuccess, aCounters.mRxSuccess, aCounters.mTxFailure, aCounters.mRxFailure);
-
-    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
-    SuccessOrExit(error = ConvertToDBusMessage(&sub, args));
-    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub) == true, error = OTBR_ERROR_DBUS);
-exit:
-    return error;
+    return DBusMessageEncodeStruct(aIter, aCounters);
 }
 
 otbrError DBusMessageExtract(DBusMessageIter *aIter, IpCounters &aCounters)
 {
-    DBusMessageIter sub;
-    otbrError       error = OTBR_ERROR_NONE;
-    auto args = std::tie(aCounters.mTxSuccess, aCounters.mRxSuccess, aCounters.mTxFailure, aCounters.mRxFailure);
-
-    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
-    SuccessOrExit(error = ConvertToTuple(&sub, args));
-    dbus_message_iter_next(aIter);
-exit:
-    return error;
+    return DBusMessageExtractStruct(aIter, aCounters);
 }
 
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const ChildInfo &aChildInfo)
 {
-    DBusMessageIter sub;
-    otbrError       error = OTBR_ERROR_NONE;
-    auto            args  = std::tie(aChildInfo.mExtAddress, aChildInfo.mTimeout, aChildInfo.mAge, aChildInfo.mRloc16,
-                                     aChildInfo.mChildId, aChildInfo.mNetworkDataVersion, aChildInfo.mLinkQualityIn,
-                                     aChildInfo.mAverageRssi, aChildInfo.mLastRssi, aChildInfo.mFrameErrorRate,
-                                     aChildInfo.mMessageErrorRate, aChildInfo.mRxOnWhenIdle, aChildInfo.mFullThreadDevice,
-                                     aChildInfo.mFullNetworkData, aChildInfo.mIsStateRestoring);
-
-    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
-    SuccessOrExit(error = ConvertToDBusMessage(&sub, args));
-    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub) == true, error = OTBR_ERROR_DBUS);
-exit:
-    return error;
+    return DBusMessageEncodeStruct(aIter, aChildInfo);
 }
 
 otbrError DBusMessageExtract(DBusMessageIter *aIter, ChildInfo &aChildInfo)
 {
-    DBusMessageIter sub;
-    otbrError       error = OTBR_ERROR_NONE;
-    auto            args  = std::tie(aChildInfo.mExtAddress, aChildInfo.mTimeout, aChildInfo.mAge, aChildInfo.mRloc16,
-                                     aChildInfo.mChildId, aChildInfo.mNetworkDataVersion, aChildInfo.mLinkQualityIn,
-                                     aChildInfo.mAverageRssi, aChildInfo.mLastRssi, aChildInfo.mFrameErrorRate,
-                                     aChildInfo.mMessageErrorRate, aChildInfo.mRxOnWhenIdle, aChildInfo.mFullThreadDevice,
-                                     aChildInfo.mFullNetworkData, aChildInfo.mIsStateRestoring);
-
-    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
-    SuccessOrExit(error = ConvertToTuple(&sub, args));
-    dbus_message_iter_next(aIter);
-exit:
-    return error;
+    return DBusMessageExtractStruct(aIter, aChildInfo);
 }
 
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const NeighborInfo &aNeighborInfo)
 {
-    DBusMessageIter sub;
-    otbrError       error = OTBR_ERROR_NONE;
-    auto            args  = std::tie(aNeighborInfo.mExtAddress, aNeighborInfo.mAge, aNeighborInfo.mRloc16,
-                                     aNeighborInfo.mLinkFrameCounter, aNeighborInfo.mMleFrameCounter, aNeighborInfo.mLinkQualityIn,
-                                     aNeighborInfo.mAverageRssi, aNeighborInfo.mLastRssi, aNeighborInfo.mFrameErrorRate,
-                                     aNeighborInfo.mMessageErrorRate, aNeighborInfo.mVersion, aNeighborInfo.mRxOnWhenIdle,
-                                     aNeighborInfo.mFullThreadDevice, aNeighborInfo.mFullNetworkData, aNeighborInfo.mIsChild);
-
-    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
-    SuccessOrExit(error = ConvertToDBusMessage(&sub, args));
-    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub) == true, error = OTBR_ERROR_DBUS);
-exit:
-    return error;
+    return DBusMessageEncodeStruct(aIter, aNeighborInfo);
 }
 
 otbrError DBusMessageExtract(DBusMessageIter *aIter, NeighborInfo &aNeighborInfo)
 {
-    DBusMessageIter sub;
-    otbrError       error = OTBR_ERROR_NONE;
-    auto            args  = std::tie(aNeighborInfo.mExtAddress, aNeighborInfo.mAge, aNeighborInfo.mRloc16,
-                                     aNeighborInfo.mLinkFrameCounter, aNeighborInfo.mMleFrameCounter, aNeighborInfo.mLinkQualityIn,
-                                     aNeighborInfo.mAverageRssi, aNeighborInfo.mLastRssi, aNeighborInfo.mFrameErrorRate,
-                                     aNeighborInfo.mMessageErrorRate, aNeighborInfo.mVersion, aNeighborInfo.mRxOnWhenIdle,
-                                     aNeighborInfo.mFullThreadDevice, aNeighborInfo.mFullNetworkData, aNeighborInfo.mIsChild);
-
-    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
-    SuccessOrExit(error = ConvertToTuple(&sub, args));
-    dbus_message_iter_next(aIter);
-exit:
-    return error;
+    return DBusMessageExtractStruct(aIter, aNeighborInfo);
 }
 
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const LeaderData &aLeaderData)
 {
-    DBusMessageIter sub;
-    otbrError       error = OTBR_ERROR_NONE;
-    auto            args  = std::tie(aLeaderData.mPartitionId, aLeaderData.mWeighting, aLeaderData.mDataVersion,
-                                     aLeaderData.mStableDataVersion, aLeaderData.mLeaderRouterId);
-
-    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
-    SuccessOrExit(error = ConvertToDBusMessage(&sub, args));
-    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub) == true, error = OTBR_ERROR_DBUS);
-exit:
-    return error;
+    return DBusMessageEncodeStruct(aIter, aLeaderData);
 }
 
 otbrError DBusMessageExtract(DBusMessageIter *aIter, LeaderData &aLeaderData)
 {
-    DBusMessageIter sub;
-    otbrError       error = OTBR_ERROR_NONE;
-    auto            args  = std::tie(aLeaderData.mPartitionId, aLeaderData.mWeighting, aLeaderData.mDataVersion,
-                                     aLeaderData.mStableDataVersion, aLeaderData.mLeaderRouterId);
-
-    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
-    SuccessOrExit(error = ConvertToTuple(&sub, args));
-    dbus_message_iter_next(aIter);
-exit:
-    return error;
+    return DBusMessageExtractStruct(aIter, aLeaderData);
 }
 
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const ChannelQuality &aQuality)
 {
-    DBusMessageIter sub;
-    otbrError       error = OTBR_ERROR_NONE;
-    auto            args  = std::tie(aQuality.mChannel, aQuality.mOccupancy);
-
-    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub));
-    SuccessOrExit(error = ConvertToDBusMessage(&sub, args));
-    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub) == true, error = OTBR_ERROR_DBUS);
-exit:
-    return error;
+    return DBusMessageEncodeStruct(aIter, aQuality);
 }
 
 otbrError DBusMessageExtract(DBusMessageIter *aIter, ChannelQuality &aQuality)
 {
-    DBusMessageIter sub;
-    otbrError       error = OTBR_ERROR_NONE;
-    auto            args  = std::tie(aQuality.mChannel, aQuality.mOccupancy);
-
-    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
-    SuccessOrExit(error = ConvertToTuple(&sub, args));
-    dbus_message_iter_next(aIter);
-exit:
-    return error;
+    return DBusMessageExtractStruct(aIter, aQuality);
 }
 
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const TxtEntry &aTxtEntry)
 {
-    DBusMessageIter sub;
-    otbrError       error = OTBR_ERROR_NONE;
-    auto            args  = std::tie(aTxtEntry.mKey, aTxtEntry.mValue);
-
-    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub));
-    SuccessOrExit(error = ConvertToDBusMessage(&sub, args));
-    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub) == true, error = OTBR_ERROR_DBUS);
-exit:
-    return error;
+    return DBusMessageEncodeStruct(aIter, aTxtEntry);
 }
 
 otbrError DBusMessageExtract(DBusMessageIter *aIter, TxtEntry &aTxtEntry)
 {
-    DBusMessageIter sub;
-    otbrError       error = OTBR_ERROR_NONE;
-    auto            args  = std::tie(aTxtEntry.mKey, aTxtEntry.mValue);
-
-    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
-    SuccessOrExit(error = ConvertToTuple(&sub, args));
-    dbus_message_iter_next(aIter);
-exit:
-    return error;
+    return DBusMessageExtractStruct(aIter, aTxtEntry);
 }
 
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const SrpServerInfo::Registration &aRegistration)
 {
-    DBusMessageIter sub;
-    otbrError       error = OTBR_ERROR_NONE;
-    auto args = std::tie(aRegistration.mFreshCount, aRegistration.mDeletedCount, aRegistration.mLeaseTimeTotal,
-                         aRegistration.mKeyLeaseTimeTotal, aRegistration.mRemainingLeaseTimeTotal,
-                         aRegistration.mRemainingKeyLeaseTimeTotal);
-
-    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
-    SuccessOrExit(error = ConvertToDBusMessage(&sub, args));
-    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub) == true, error = OTBR_ERROR_DBUS);
-exit:
-    return error;
+    return DBusMessageEncodeStruct(aIter, aRegistration);
 }
 
 otbrError DBusMessageExtract(DBusMessageIter *aIter, SrpServerInfo::Registration &aRegistration)
 {
-    DBusMessageIter sub;
-    otbrError       error = OTBR_ERROR_NONE;
-    auto args = std::tie(aRegistration.mFreshCount, aRegistration.mDeletedCount, aRegistration.mLeaseTimeTotal,
-                         aRegistration.mKeyLeaseTimeTotal, aRegistration.mRemainingLeaseTimeTotal,
-                         aRegistration.mRemainingKeyLeaseTimeTotal);
-
-    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
-    SuccessOrExit(error = ConvertToTuple(&sub, args));
-    dbus_message_iter_next(aIter);
-exit:
-    return error;
+    return DBusMessageExtractStruct(aIter, aRegistration);
 }
 
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const SrpServerInfo::ResponseCounters &aResponseCounters)
 {
-    DBusMessageIter sub;
-    otbrError       error = OTBR_ERROR_NONE;
-    auto args = std::tie(aResponseCounters.mSuccess, aResponseCounters.mServerFailure, aResponseCounters.mFormatError,
-                         aResponseCounters.mNameExists, aResponseCounters.mRefused, aResponseCounters.mOther);
-
-    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
-    SuccessOrExit(error = ConvertToDBusMessage(&sub, args));
-    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub) == true, error = OTBR_ERROR_DBUS);
-exit:
-    return error;
+    return DBusMessageEncodeStruct(aIter, aResponseCounters);
 }
 
 otbrError DBusMessageExtract(DBusMessageIter *aIter, SrpServerInfo::ResponseCounters &aResponseCounters)
 {
-    DBusMessageIter sub;
-    otbrError       error = OTBR_ERROR_NONE;
-    auto args = std::tie(aResponseCounters.mSuccess, aResponseCounters.mServerFailure, aResponseCounters.mFormatError,
-                         aResponseCounters.mNameExists, aResponseCounters.mRefused, aResponseCounters.mOther);
-
-    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
-    SuccessOrExit(error = ConvertToTuple(&sub, args));
-    dbus_message_iter_next(aIter);
-exit:
-    return error;
+    return DBusMessageExtractStruct(aIter, aResponseCounters);
 }
 
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const SrpServerInfo &aSrpServerInfo)
@@ -692,6 +508,40 @@ exit:
     return error;
 }
 
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsLatencyHistogram &aMdnsLatencyHistogram)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    for (uint32_t bucket : aMdnsLatencyHistogram.mBuckets)
+    {
+        SuccessOrExit(error = DBusMessageEncode(&sub, bucket));
+    }
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsLatencyHistogram &aMdnsLatencyHistogram)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+
+    for (uint32_t &bucket : aMdnsLatencyHistogram.mBuckets)
+    {
+        SuccessOrExit(error = DBusMessageExtract(&sub, bucket));
+    }
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsTelemetryInfo &aMdnsTelemetryInfo)
 {
     DBusMessageIter sub;
@@ -709,6 +559,12 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsTelemetryInfo &aMd
     SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsTelemetryInfo.mHostResolutionEmaLatency));
     SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsTelemetryInfo.mServiceResolutionEmaLatency));
 
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsTelemetryInfo.mHostRegistrationLatency));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsTelemetryInfo.mKeyRegistrationLatency));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsTelemetryInfo.mServiceRegistrationLatency));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsTelemetryInfo.mHostResolutionLatency));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsTelemetryInfo.mServiceResolutionLatency));
+
     VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
 exit:
     return error;
@@ -731,6 +587,12 @@ otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsTelemetryInfo &aMdnsTel
     SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsTelemetryInfo.mHostResolutionEmaLatency));
     SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsTelemetryInfo.mServiceResolutionEmaLatency));
 
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsTelemetryInfo.mHostRegistrationLatency));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsTelemetryInfo.mKeyRegistrationLatency));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsTelemetryInfo.mServiceRegistrationLatency));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsTelemetryInfo.mHostResolutionLatency));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsTelemetryInfo.mServiceResolutionLatency));
+
     dbus_message_iter_next(aIter);
 exit:
     return error;
@@ -1228,34 +1090,42 @@ exit:
 
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const TrelInfo::TrelPacketCounters &aTrelCounters)
 {
-    DBusMessageIter sub;
-    otbrError       error = OTBR_ERROR_NONE;
-    auto            args  = std::tie(aTrelCounters.mTxPackets, aTrelCounters.mTxBytes, aTrelCounters.mTxFailure,
-                                     aTrelCounters.mRxPackets, aTrelCounters.mRxBytes);
-
-    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
-    SuccessOrExit(error = ConvertToDBusMessage(&sub, args));
-    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub) == true, error = OTBR_ERROR_DBUS);
-exit:
-    return error;
+    return DBusMessageEncodeStruct(aIter, aTrelCounters);
 }
 
 otbrError DBusMessageExtract(DBusMessageIter *aIter, TrelInfo::TrelPacketCounters &aTrelCounters)
 {
-    DBusMessageIter sub;
-    otbrError       error = OTBR_ERROR_NONE;
+    return DBusMessageExtractStruct(aIter, aTrelCounters);
+}
 
-    dbus_message_iter_recurse(aIter, &sub);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const CounterHistoryInfo &aHistory)
+{
+    return DBusMessageEncodeStruct(aIter, aHistory);
+}
 
-    SuccessOrExit(error = DBusMessageExtract(&sub, aTrelCounters.mTxPackets));
-    SuccessOrExit(error = DBusMessageExtract(&sub, aTrelCounters.mTxBytes));
-    SuccessOrExit(error = DBusMessageExtract(&sub, aTrelCounters.mTxFailure));
-    SuccessOrExit(error = DBusMessageExtract(&sub, aTrelCounters.mRxPackets));
-    SuccessOrExit(error = DBusMessageExtract(&sub, aTrelCounters.mRxBytes));
+otbrError DBusMessageExtract(DBusMessageIter *aIter, CounterHistoryInfo &aHistory)
+{
+    return DBusMessageExtractStruct(aIter, aHistory);
+}
 
-    dbus_message_iter_next(aIter);
-exit:
-    return error;
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const CounterHistoryInfo::Counter &aCounter)
+{
+    return DBusMessageEncodeStruct(aIter, aCounter);
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, CounterHistoryInfo::Counter &aCounter)
+{
+    return DBusMessageExtractStruct(aIter, aCounter);
+}
+
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const SpinelFrameRecord &aRecord)
+{
+    return DBusMessageEncodeStruct(aIter, aRecord);
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, SpinelFrameRecord &aRecord)
+{
+    return DBusMessageExtractStruct(aIter, aRecord);
 }
 
 } // namespace DBus
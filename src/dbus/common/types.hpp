@@ -684,6 +684,31 @@ struct TrelInfo
     TrelPacketCounters mTrelCounters; ///< The TREL counters.
 };
 
+struct CounterHistoryInfo
+{
+    struct Counter
+    {
+        std::string           mName;          ///< The name of the counter.
+        uint64_t              mValue;         ///< The value of the counter in the latest sample.
+        uint64_t              mRatePerMinute; ///< The average increment per minute over the history.
+        std::vector<uint32_t> mDeltas;        ///< The increment in each interval, oldest first.
+    };
+
+    uint64_t              mExtAddress; ///< The extended address of the neighbor, or 0 for the Thread interface.
+    std::vector<uint32_t> mIntervals;  ///< The duration of each interval in milliseconds, oldest first.
+    std::vector<Counter>  mCounters;   ///< The counters.
+};
+
+struct SpinelFrameRecord
+{
+    uint64_t mTimestamp; ///< The time the frame was handled, in microseconds of the host monotonic clock.
+    uint8_t  mDirection; ///< 0 if the frame was sent to the co-processor, 1 if it was received from it.
+    uint8_t  mHeader;    ///< The spinel header, including the IID and the TID.
+    uint32_t mCommand;   ///< The spinel command.
+    uint32_t mPropKey;   ///< The spinel property key.
+    uint16_t mLength;    ///< The length of the frame in bytes.
+};
+
 } // namespace DBus
 } // namespace otbr
 
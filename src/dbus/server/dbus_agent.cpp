@@ -35,8 +35,11 @@
 #include <unistd.h>
 
 #include "common/logging.hpp"
+#include "common/mainloop_manager.hpp"
 #include "dbus/common/constants.hpp"
+#if OTBR_ENABLE_NCP_HOST
 #include "dbus/server/dbus_thread_object_ncp.hpp"
+#endif
 #include "dbus/server/dbus_thread_object_rcp.hpp"
 #include "mdns/mdns.hpp"
 
@@ -45,39 +48,71 @@ namespace DBus {
 
 const struct timeval           DBusAgent::kPollTimeout = {0, 0};
 constexpr std::chrono::seconds DBusAgent::kDBusWaitAllowance;
+constexpr uint32_t             DBusAgent::kMaxDispatchPerIteration;
 
 DBusAgent::DBusAgent(otbr::Ncp::ThreadHost &aHost, Mdns::Publisher &aPublisher)
-    : mInterfaceName(aHost.GetInterfaceName())
+    : MainloopProcessor(kPriorityManagement)
+    , mInterfaceName(aHost.GetInterfaceName())
+    , mTaskRunner(TaskRunner::DelayedTaskQueue::kTimerWheel, kPriorityManagement)
     , mHost(aHost)
     , mPublisher(aPublisher)
 {
 }
 
-void DBusAgent::Init(otbr::BorderAgent &aBorderAgent)
+DBusAgent::~DBusAgent(void)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    // The shared bus connection may outlive the agent without removing its watches.
+    for (const WatchState &state : mWatches)
+    {
+        if (state.mFd >= 0)
+        {
+            MainloopManager::GetInstance().RemoveFd(state.mFd);
+        }
+    }
+    mWatches.clear();
+}
 
-    auto connection_deadline = Clock::now() + kDBusWaitAllowance;
+void DBusAgent::Init(otbr::BorderAgent                         &aBorderAgent,
+                     const TrelDnssdTelemetryInfo              *aTrelDnssdInfo,
+                     const BackboneRouter::BackboneRouterStats *aBackboneRouterStats)
+{
+    otbrError error = OTBR_ERROR_NONE;
 
-    while ((mConnection = PrepareDBusConnection()) == nullptr && Clock::now() < connection_deadline)
+    if (!mConnectionFuture.valid())
     {
-        otbrLogWarning("Failed to setup DBus connection, will retry after 1 second");
-        std::this_thread::sleep_for(std::chrono::seconds(1));
+        ConnectAsync();
     }
 
+    mConnection = mConnectionFuture.get();
     VerifyOrDie(mConnection != nullptr, "Failed to get DBus connection");
 
-    switch (mHost.GetCoprocessorType())
+    // The watch and timeout functions update the mainloop state, so they are set on the mainloop thread.
+    VerifyOrDie(dbus_connection_set_watch_functions(mConnection.get(), AddDBusWatch, RemoveDBusWatch, ToggleDBusWatch,
+                                                    this, nullptr),
+                "Failed to set DBus watch functions");
+    VerifyOrDie(dbus_connection_set_timeout_functions(mConnection.get(), AddDBusTimeout, RemoveDBusTimeout,
+                                                      ToggleDBusTimeout, this, nullptr),
+                "Failed to set DBus timeout functions");
+
+    switch (Ncp::GetCoprocessorType(mHost))
     {
     case OT_COPROCESSOR_RCP:
-        mThreadObject = MakeUnique<DBusThreadObjectRcp>(*mConnection, mInterfaceName,
-                                                        static_cast<Ncp::RcpHost &>(mHost), &mPublisher, aBorderAgent);
+    {
+        auto threadObject = MakeUnique<DBusThreadObjectRcp>(*mConnection, mInterfaceName,
+                                                            static_cast<Ncp::RcpHost &>(mHost), &mPublisher,
+                                                            aBorderAgent, aTrelDnssdInfo, aBackboneRouterStats);
+
+        threadObject->SetConfigReloadHandler(mConfigReloadHandler);
+        mThreadObject = std::move(threadObject);
         break;
+    }
 
+#if OTBR_ENABLE_NCP_HOST
     case OT_COPROCESSOR_NCP:
         mThreadObject =
             MakeUnique<DBusThreadObjectNcp>(*mConnection, mInterfaceName, static_cast<Ncp::NcpHost &>(mHost));
         break;
+#endif
 
     default:
         DieNow("Unknown coprocessor type!");
@@ -88,6 +123,25 @@ void DBusAgent::Init(otbr::BorderAgent &aBorderAgent)
     VerifyOrDie(error == OTBR_ERROR_NONE, "Failed to initialize DBus Agent");
 }
 
+void DBusAgent::ConnectAsync(void)
+{
+    mConnectionFuture = std::async(std::launch::async, [this]() { return ConnectWithRetry(); });
+}
+
+DBusAgent::UniqueDBusConnection DBusAgent::ConnectWithRetry(void)
+{
+    UniqueDBusConnection connection;
+    auto                 connectionDeadline = Clock::now() + kDBusWaitAllowance;
+
+    while ((connection = PrepareDBusConnection()) == nullptr && Clock::now() < connectionDeadline)
+    {
+        otbrLogWarning("Failed to setup DBus connection, will retry after 1 second");
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+    }
+
+    return connection;
+}
+
 DBusAgent::UniqueDBusConnection DBusAgent::PrepareDBusConnection(void)
 {
     DBusError            dbusError;
@@ -114,9 +168,6 @@ DBusAgent::UniqueDBusConnection DBusAgent::PrepareDBusConnection(void)
                      otbrLogWarning("Failed to request DBus name: %s: %s", dbusError.name, dbusError.message);
                      uniqueConn = nullptr;
                  });
-    VerifyOrExit(
-        dbus_connection_set_watch_functions(uniqueConn.get(), AddDBusWatch, RemoveDBusWatch, nullptr, this, nullptr),
-        uniqueConn = nullptr);
 
 exit:
     dbus_error_free(&dbusError);
@@ -126,95 +177,250 @@ exit:
 
 dbus_bool_t DBusAgent::AddDBusWatch(struct DBusWatch *aWatch, void *aContext)
 {
-    static_cast<DBusAgent *>(aContext)->mWatches.insert(aWatch);
+    DBusAgent *agent = static_cast<DBusAgent *>(aContext);
+
+    agent->mWatches.push_back({aWatch, -1, 0, false});
+    agent->UpdateWatchState(aWatch);
+
     return TRUE;
 }
 
 void DBusAgent::RemoveDBusWatch(struct DBusWatch *aWatch, void *aContext)
 {
-    static_cast<DBusAgent *>(aContext)->mWatches.erase(aWatch);
+    DBusAgent *agent = static_cast<DBusAgent *>(aContext);
+
+    for (auto it = agent->mWatches.begin(); it != agent->mWatches.end(); ++it)
+    {
+        if (it->mWatch == aWatch)
+        {
+            int fd = it->mFd;
+
+            agent->mWatches.erase(it);
+            agent->UpdateFdEvents(fd);
+            break;
+        }
+    }
+}
+
+void DBusAgent::ToggleDBusWatch(struct DBusWatch *aWatch, void *aContext)
+{
+    static_cast<DBusAgent *>(aContext)->UpdateWatchState(aWatch);
 }
 
-void DBusAgent::Update(MainloopContext &aMainloop)
+DBusAgent::WatchState *DBusAgent::FindWatchState(DBusWatch *aWatch)
 {
-    unsigned int flags;
-    int          fd;
-    uint8_t      fdSetMask = MainloopContext::kErrorFdSet;
+    WatchState *found = nullptr;
 
-    if (dbus_connection_get_dispatch_status(mConnection.get()) == DBUS_DISPATCH_DATA_REMAINS)
+    for (WatchState &state : mWatches)
     {
-        aMainloop.mTimeout = {0, 0};
+        if (state.mWatch == aWatch)
+        {
+            found = &state;
+            break;
+        }
     }
 
-    for (const auto &watch : mWatches)
+    return found;
+}
+
+void DBusAgent::UpdateWatchState(DBusWatch *aWatch)
+{
+    WatchState *state = FindWatchState(aWatch);
+    int         oldFd;
+
+    VerifyOrExit(state != nullptr);
+    oldFd           = state->mFd;
+    state->mEnabled = dbus_watch_get_enabled(aWatch);
+    state->mFlags   = dbus_watch_get_flags(aWatch);
+    state->mFd      = dbus_watch_get_unix_fd(aWatch);
+
+    if (oldFd != state->mFd)
     {
-        if (!dbus_watch_get_enabled(watch))
+        UpdateFdEvents(oldFd);
+    }
+    UpdateFdEvents(state->mFd);
+
+exit:
+    return;
+}
+
+void DBusAgent::UpdateFdEvents(int aFd)
+{
+    uint8_t events  = 0;
+    bool    watched = false;
+
+    VerifyOrExit(aFd >= 0);
+
+    for (const WatchState &state : mWatches)
+    {
+        if (state.mFd != aFd)
         {
             continue;
         }
 
-        flags = dbus_watch_get_flags(watch);
-        fd    = dbus_watch_get_unix_fd(watch);
-
-        if (fd < 0)
+        watched = true;
+        if (!state.mEnabled)
         {
             continue;
         }
 
-        if (flags & DBUS_WATCH_READABLE)
+        events |= MainloopContext::kErrorFdSet;
+        if (state.mFlags & DBUS_WATCH_READABLE)
         {
-            fdSetMask |= MainloopContext::kReadFdSet;
+            events |= MainloopContext::kReadFdSet;
         }
-
-        if ((flags & DBUS_WATCH_WRITABLE))
+        if (state.mFlags & DBUS_WATCH_WRITABLE)
         {
-            fdSetMask |= MainloopContext::kWriteFdSet;
+            events |= MainloopContext::kWriteFdSet;
         }
+    }
+
+    if (!watched)
+    {
+        MainloopManager::GetInstance().RemoveFd(aFd);
+    }
+    else if (MainloopManager::GetInstance().UpdateFd(aFd, events) == OTBR_ERROR_NOT_FOUND)
+    {
+        MainloopManager::GetInstance().AddFd(aFd, events,
+                                             [this, aFd](uint8_t aEvents) { HandleFdEvents(aFd, aEvents); });
+    }
+
+exit:
+    return;
+}
+
+dbus_bool_t DBusAgent::AddDBusTimeout(DBusTimeout *aTimeout, void *aContext)
+{
+    DBusAgent *agent = static_cast<DBusAgent *>(aContext);
+
+    if (dbus_timeout_get_enabled(aTimeout))
+    {
+        agent->ScheduleDBusTimeout(aTimeout);
+    }
+
+    return TRUE;
+}
+
+void DBusAgent::RemoveDBusTimeout(DBusTimeout *aTimeout, void *aContext)
+{
+    static_cast<DBusAgent *>(aContext)->CancelDBusTimeout(aTimeout);
+}
+
+void DBusAgent::ToggleDBusTimeout(DBusTimeout *aTimeout, void *aContext)
+{
+    DBusAgent *agent = static_cast<DBusAgent *>(aContext);
+
+    // The interval restarts whenever a timeout is toggled.
+    agent->CancelDBusTimeout(aTimeout);
+
+    if (dbus_timeout_get_enabled(aTimeout))
+    {
+        agent->ScheduleDBusTimeout(aTimeout);
+    }
+}
+
+void DBusAgent::ScheduleDBusTimeout(DBusTimeout *aTimeout)
+{
+    Milliseconds interval(dbus_timeout_get_interval(aTimeout));
+
+    mTimeouts[aTimeout] = mTaskRunner.Post(interval, [this, aTimeout]() { HandleDBusTimeout(aTimeout); });
+}
+
+void DBusAgent::CancelDBusTimeout(DBusTimeout *aTimeout)
+{
+    auto it = mTimeouts.find(aTimeout);
+
+    VerifyOrExit(it != mTimeouts.end());
+    mTaskRunner.Cancel(it->second);
+    mTimeouts.erase(it);
+
+exit:
+    return;
+}
+
+void DBusAgent::HandleDBusTimeout(DBusTimeout *aTimeout)
+{
+    // A DBusTimeout fires periodically until it's disabled or removed, which may happen in the handler below.
+    mTimeouts.erase(aTimeout);
+    ScheduleDBusTimeout(aTimeout);
+
+    dbus_timeout_handle(aTimeout);
+}
+
+void DBusAgent::Update(MainloopContext &aMainloop)
+{
+    // Property changes made by the processors since the previous iteration go out as one signal per interface.
+    mThreadObject->FlushPropertyChanges();
 
-        aMainloop.AddFdToSet(fd, fdSetMask);
+    if (dbus_connection_get_dispatch_status(mConnection.get()) == DBUS_DISPATCH_DATA_REMAINS)
+    {
+        aMainloop.mTimeout = {0, 0};
     }
 }
 
 void DBusAgent::Process(const MainloopContext &aMainloop)
 {
-    unsigned int flags;
-    int          fd;
+    OTBR_UNUSED_VARIABLE(aMainloop);
+
+    // Dispatch the messages left over by the previous iteration, the watches are handled once their fd is ready.
+    DispatchMessages();
+}
+
+void DBusAgent::HandleFdEvents(int aFd, uint8_t aEvents)
+{
+    mReadyWatches.clear();
 
-    for (const auto &watch : mWatches)
+    // Handling a watch may add, remove or toggle watches, so collect the ready ones first.
+    for (const WatchState &state : mWatches)
     {
-        if (!dbus_watch_get_enabled(watch))
+        unsigned int flags = 0;
+
+        if (state.mFd != aFd || !state.mEnabled)
         {
             continue;
         }
 
-        flags = dbus_watch_get_flags(watch);
-        fd    = dbus_watch_get_unix_fd(watch);
-
-        if (fd < 0)
+        if ((state.mFlags & DBUS_WATCH_READABLE) && (aEvents & MainloopContext::kReadFdSet))
         {
-            continue;
+            flags |= DBUS_WATCH_READABLE;
         }
 
-        if ((flags & DBUS_WATCH_READABLE) && !FD_ISSET(fd, &aMainloop.mReadFdSet))
+        if ((state.mFlags & DBUS_WATCH_WRITABLE) && (aEvents & MainloopContext::kWriteFdSet))
         {
-            flags &= static_cast<unsigned int>(~DBUS_WATCH_READABLE);
+            flags |= DBUS_WATCH_WRITABLE;
         }
 
-        if ((flags & DBUS_WATCH_WRITABLE) && !FD_ISSET(fd, &aMainloop.mWriteFdSet))
+        if (aEvents & MainloopContext::kErrorFdSet)
         {
-            flags &= static_cast<unsigned int>(~DBUS_WATCH_WRITABLE);
+            flags |= DBUS_WATCH_ERROR;
         }
 
-        if (FD_ISSET(fd, &aMainloop.mErrorFdSet))
+        if (flags != 0)
         {
-            flags |= DBUS_WATCH_ERROR;
+            mReadyWatches.emplace_back(state.mWatch, flags);
         }
+    }
 
-        dbus_watch_handle(watch, flags);
+    for (const auto &ready : mReadyWatches)
+    {
+        if (FindWatchState(ready.first) != nullptr)
+        {
+            dbus_watch_handle(ready.first, ready.second);
+        }
     }
 
-    while (DBUS_DISPATCH_DATA_REMAINS == dbus_connection_dispatch(mConnection.get()))
-        ;
+    DispatchMessages();
+}
+
+void DBusAgent::DispatchMessages(void)
+{
+    uint32_t dispatchCount = 0;
+
+    while (dispatchCount < kMaxDispatchPerIteration &&
+           dbus_connection_dispatch(mConnection.get()) == DBUS_DISPATCH_DATA_REMAINS)
+    {
+        dispatchCount++;
+    }
 }
 
 } // namespace DBus
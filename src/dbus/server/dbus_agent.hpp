@@ -37,12 +37,15 @@
 #include "openthread-br/config.h"
 
 #include <functional>
-#include <set>
+#include <future>
+#include <map>
 #include <string>
+#include <vector>
 #include <sys/select.h>
 
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/task_runner.hpp"
 #include "dbus/common/dbus_message_helper.hpp"
 #include "dbus/common/dbus_resources.hpp"
 #include "dbus/server/dbus_object.hpp"
@@ -64,13 +67,45 @@ public:
      */
     DBusAgent(otbr::Ncp::ThreadHost &aHost, Mdns::Publisher &aPublisher);
 
+    /**
+     * The destructor of dbus agent.
+     */
+    ~DBusAgent(void) override;
+
+    /**
+     * This method starts connecting to the system bus and requesting the D-Bus name on a background thread.
+     *
+     * Both only wait on the D-Bus daemon, which may still be starting at boot, so they can overlap the
+     * initialization of the other subsystems. `Init()` waits for the connection, and starts connecting itself if this
+     * method wasn't called.
+     */
+    void ConnectAsync(void);
+
     /**
      * This method initializes the dbus agent.
+     *
+     * @param[in] aBorderAgent          A reference to the Border Agent.
+     * @param[in] aTrelDnssdInfo        A pointer to the TREL DNS-SD telemetry, or `nullptr` if TREL is not enabled.
+     * @param[in] aBackboneRouterStats  A pointer to the Backbone Router statistics, or `nullptr` if the Backbone
+     *                                  Router is not enabled.
+     */
+    void Init(otbr::BorderAgent                         &aBorderAgent,
+              const TrelDnssdTelemetryInfo              *aTrelDnssdInfo,
+              const BackboneRouter::BackboneRouterStats *aBackboneRouterStats);
+
+    /**
+     * This method sets the handler of the `ReloadConfig` D-Bus method, to be called before `Init()`.
+     *
+     * @param[in] aHandler  The handler reloading the configuration of otbr-agent.
      */
-    void Init(otbr::BorderAgent &aBorderAgent);
+    void SetConfigReloadHandler(std::function<otbrError(void)> aHandler)
+    {
+        mConfigReloadHandler = std::move(aHandler);
+    }
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "DBusAgent"; }
+    void        Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
 
 private:
     using Clock                                              = std::chrono::steady_clock;
@@ -78,22 +113,68 @@ private:
 
     using UniqueDBusConnection = std::unique_ptr<DBusConnection, std::function<void(DBusConnection *)>>;
 
+    /**
+     * The maximum number of incoming messages dispatched in one mainloop iteration.
+     *
+     * Remaining messages are dispatched in the following iterations, so a burst of requests can't starve the other
+     * mainloop processors.
+     */
+    static constexpr uint32_t kMaxDispatchPerIteration = 16;
+
+    /**
+     * This structure caches the state of a DBusWatch, which is refreshed only when libdbus adds or toggles it.
+     *
+     * The fd of the watches is registered persistently to the mainloop manager, with the events of all enabled
+     * watches of the fd, since libdbus may watch the same fd for reading and for writing separately.
+     */
+    struct WatchState
+    {
+        DBusWatch   *mWatch;
+        int          mFd;
+        unsigned int mFlags;
+        bool         mEnabled;
+    };
+
     static dbus_bool_t   AddDBusWatch(struct DBusWatch *aWatch, void *aContext);
     static void          RemoveDBusWatch(struct DBusWatch *aWatch, void *aContext);
+    static void          ToggleDBusWatch(struct DBusWatch *aWatch, void *aContext);
+    static dbus_bool_t   AddDBusTimeout(DBusTimeout *aTimeout, void *aContext);
+    static void          RemoveDBusTimeout(DBusTimeout *aTimeout, void *aContext);
+    static void          ToggleDBusTimeout(DBusTimeout *aTimeout, void *aContext);
+    WatchState          *FindWatchState(DBusWatch *aWatch);
+    void                 UpdateWatchState(DBusWatch *aWatch);
+    void                 UpdateFdEvents(int aFd);
+    void                 HandleFdEvents(int aFd, uint8_t aEvents);
+    void                 DispatchMessages(void);
+    void                 ScheduleDBusTimeout(DBusTimeout *aTimeout);
+    void                 CancelDBusTimeout(DBusTimeout *aTimeout);
+    void                 HandleDBusTimeout(DBusTimeout *aTimeout);
     UniqueDBusConnection PrepareDBusConnection(void);
+    UniqueDBusConnection ConnectWithRetry(void);
 
     static const struct timeval kPollTimeout;
 
     std::string                 mInterfaceName;
     std::unique_ptr<DBusObject> mThreadObject;
-    UniqueDBusConnection        mConnection;
-    otbr::Ncp::ThreadHost      &mHost;
-    Mdns::Publisher            &mPublisher;
+    /**
+     * This vector is used to track DBusWatch-es.
+     */
+    std::vector<WatchState>                           mWatches;
+    std::vector<std::pair<DBusWatch *, unsigned int>> mReadyWatches;
 
     /**
-     * This map is used to track DBusWatch-es.
+     * This map is used to track the delayed tasks of enabled DBusTimeout-s.
      */
-    std::set<DBusWatch *> mWatches;
+    std::map<DBusTimeout *, TaskRunner::TaskId> mTimeouts;
+    TaskRunner                                  mTaskRunner;
+
+    // The connection is declared after the watch and timeout states, so they outlive the callbacks which libdbus
+    // may invoke while the connection is released.
+    UniqueDBusConnection              mConnection;
+    std::future<UniqueDBusConnection> mConnectionFuture;
+    otbr::Ncp::ThreadHost            &mHost;
+    Mdns::Publisher                  &mPublisher;
+    std::function<otbrError(void)>    mConfigReloadHandler;
 };
 
 } // namespace DBus
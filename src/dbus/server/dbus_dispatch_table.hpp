@@ -0,0 +1,190 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions for the d-bus member dispatch table.
+ */
+
+#ifndef OTBR_DBUS_DBUS_DISPATCH_TABLE_HPP_
+#define OTBR_DBUS_DBUS_DISPATCH_TABLE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <string.h>
+
+#include <openthread/error.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace DBus {
+
+/**
+ * This class implements a table of handlers keyed by a d-bus interface name and a member name.
+ *
+ * The entries are kept sorted in a flat vector at registration, so that a lookup is a binary search comparing the
+ * names of an incoming message in place, without building or hashing any string.
+ *
+ * @tparam HandlerType  The type of the handlers.
+ */
+template <typename HandlerType> class DBusDispatchTable
+{
+public:
+    /**
+     * This method adds a handler.
+     *
+     * @param[in] aInterfaceName  The interface name.
+     * @param[in] aMemberName     The member name.
+     * @param[in] aHandler        The handler.
+     *
+     * @retval TRUE   Successfully added the handler.
+     * @retval FALSE  A handler of the same member already exists, it is kept.
+     */
+    bool Add(const std::string &aInterfaceName, const std::string &aMemberName, const HandlerType &aHandler)
+    {
+        Key  key{aInterfaceName.c_str(), aMemberName.c_str()};
+        auto iter  = std::lower_bound(mEntries.begin(), mEntries.end(), key, EntryLess);
+        bool added = false;
+
+        VerifyOrExit(iter == mEntries.end() || Compare(*iter, aInterfaceName.c_str(), aMemberName.c_str()) != 0);
+        mEntries.insert(iter, Entry{aInterfaceName, aMemberName, aHandler});
+        added = true;
+
+    exit:
+        return added;
+    }
+
+    /**
+     * This method finds the handler of a member.
+     *
+     * @param[in] aInterfaceName  The interface name.
+     * @param[in] aMemberName     The member name.
+     *
+     * @returns A pointer to the handler, or `nullptr` if there is no such member.
+     */
+    const HandlerType *Find(const char *aInterfaceName, const char *aMemberName) const
+    {
+        Key                key{aInterfaceName, aMemberName};
+        auto               iter    = std::lower_bound(mEntries.begin(), mEntries.end(), key, EntryLess);
+        const HandlerType *handler = nullptr;
+
+        if (iter != mEntries.end() && Compare(*iter, aInterfaceName, aMemberName) == 0)
+        {
+            handler = &iter->mHandler;
+        }
+
+        return handler;
+    }
+
+    /**
+     * This method indicates whether the table has any member of an interface.
+     *
+     * @param[in] aInterfaceName  The interface name.
+     *
+     * @returns Whether the table has any member of @p aInterfaceName.
+     */
+    bool HasInterface(const char *aInterfaceName) const
+    {
+        auto iter = LowerBound(aInterfaceName);
+
+        return iter != mEntries.end() && iter->mInterfaceName == aInterfaceName;
+    }
+
+    /**
+     * This method invokes a function on every member of an interface, in the order of the member names.
+     *
+     * The iteration stops at the first invocation returning an error.
+     *
+     * @param[in] aInterfaceName  The interface name.
+     * @param[in] aFunction       The function, invoked with the member name and the handler, returning an `otError`.
+     *
+     * @returns The error returned by @p aFunction, or `OT_ERROR_NONE`.
+     */
+    template <typename Function> otError ForEachInInterface(const char *aInterfaceName, Function aFunction) const
+    {
+        otError error = OT_ERROR_NONE;
+
+        for (auto iter = LowerBound(aInterfaceName); iter != mEntries.end() && iter->mInterfaceName == aInterfaceName;
+             ++iter)
+        {
+            SuccessOrExit(error = aFunction(iter->mMemberName, iter->mHandler));
+        }
+
+    exit:
+        return error;
+    }
+
+private:
+    struct Entry
+    {
+        std::string mInterfaceName;
+        std::string mMemberName;
+        HandlerType mHandler;
+    };
+
+    struct Key
+    {
+        const char *mInterfaceName;
+        const char *mMemberName;
+    };
+
+    static int Compare(const Entry &aEntry, const char *aInterfaceName, const char *aMemberName)
+    {
+        int result = strcmp(aEntry.mInterfaceName.c_str(), aInterfaceName);
+
+        if (result == 0)
+        {
+            result = strcmp(aEntry.mMemberName.c_str(), aMemberName);
+        }
+
+        return result;
+    }
+
+    static bool EntryLess(const Entry &aEntry, const Key &aKey)
+    {
+        return Compare(aEntry, aKey.mInterfaceName, aKey.mMemberName) < 0;
+    }
+
+    typename std::vector<Entry>::const_iterator LowerBound(const char *aInterfaceName) const
+    {
+        // The empty member name sorts before every member of the interface.
+        return std::lower_bound(mEntries.begin(), mEntries.end(), Key{aInterfaceName, ""}, EntryLess);
+    }
+
+    std::vector<Entry> mEntries;
+};
+
+} // namespace DBus
+} // namespace otbr
+
+#endif // OTBR_DBUS_DBUS_DISPATCH_TABLE_HPP_
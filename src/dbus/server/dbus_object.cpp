@@ -38,15 +38,43 @@
 #include "dbus/common/dbus_message_dump.hpp"
 #include "dbus/server/dbus_object.hpp"
 
+/**
+ * @def OTBR_CONFIG_DBUS_SIGNAL_SUBSCRIPTION_REQUIRED
+ *
+ * Define to 1 to send the signals of a D-Bus object only while a client subscribed to them with the
+ * `SubscribeSignals` method, saving the building of signals on gateways without D-Bus clients.
+ */
+#ifndef OTBR_CONFIG_DBUS_SIGNAL_SUBSCRIPTION_REQUIRED
+#define OTBR_CONFIG_DBUS_SIGNAL_SUBSCRIPTION_REQUIRED 0
+#endif
+
 using std::placeholders::_1;
 
 namespace otbr {
 namespace DBus {
 
+namespace {
+
+// Matches the NameOwnerChanged signal sent when the client owning the unique name @p aName disconnects.
+std::string MakeNameOwnerChangedMatchRule(const std::string &aName)
+{
+    return "type='signal',sender='" DBUS_SERVICE_DBUS "',interface='" DBUS_INTERFACE_DBUS
+           "',member='NameOwnerChanged',arg0='" +
+           aName + "'";
+}
+
+} // namespace
+
 DBusObject::DBusObject(DBusConnection *aConnection, const std::string &aObjectPath)
     : mConnection(aConnection)
     , mObjectPath(aObjectPath)
+    , mIsNameOwnerChangedFilterAdded(false)
+    , mEmittedSignalsMetric(&Metrics::Registry::Get().AddCounter("otbr_dbus_signals_emitted",
+                                                                 "The D-Bus signals sent."))
+    , mSuppressedSignalsMetric(&Metrics::Registry::Get().AddCounter(
+          "otbr_dbus_signals_suppressed", "The D-Bus signals and property changes not built as no client listened."))
 {
+    MemoryUsageRegistry::Get().Add(this, "dbus_property_cache", [this]() { return GetPropertyCacheMemoryUsage(); });
 }
 
 otbrError DBusObject::Init(void)
@@ -66,6 +94,16 @@ otbrError DBusObject::Initialize(bool aIsAsyncPropertyHandler)
     VerifyOrExit(dbus_connection_register_object_path(mConnection, mObjectPath.c_str(), &vTable, this),
                  error = OTBR_ERROR_DBUS);
 
+    // The subscribers are dropped when their names are released, see `SubscribeSignalsMethodHandler()`.
+    VerifyOrExit(dbus_connection_add_filter(mConnection, DBusObject::sNameOwnerChangedFilter, this, nullptr),
+                 error = OTBR_ERROR_DBUS);
+    mIsNameOwnerChangedFilterAdded = true;
+
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SUBSCRIBE_SIGNALS_METHOD,
+                   std::bind(&DBusObject::SubscribeSignalsMethodHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_UNSUBSCRIBE_SIGNALS_METHOD,
+                   std::bind(&DBusObject::UnsubscribeSignalsMethodHandler, this, _1));
+
     if (aIsAsyncPropertyHandler)
     {
         RegisterMethod(DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTY_GET_METHOD,
@@ -89,34 +127,175 @@ void DBusObject::RegisterMethod(const std::string       &aInterfaceName,
                                 const std::string       &aMethodName,
                                 const MethodHandlerType &aHandler)
 {
-    std::string fullPath = aInterfaceName + "." + aMethodName;
+    bool added = mMethodHandlers.Add(aInterfaceName, aMethodName, aHandler);
 
-    assert(mMethodHandlers.find(fullPath) == mMethodHandlers.end());
-    mMethodHandlers.emplace(fullPath, aHandler);
+    assert(added);
+    OTBR_UNUSED_VARIABLE(added);
 }
 
 void DBusObject::RegisterGetPropertyHandler(const std::string         &aInterfaceName,
                                             const std::string         &aPropertyName,
                                             const PropertyHandlerType &aHandler)
 {
-    mGetPropertyHandlers[aInterfaceName].emplace(aPropertyName, aHandler);
+    mGetPropertyHandlers.Add(aInterfaceName, aPropertyName, aHandler);
 }
 
 void DBusObject::RegisterSetPropertyHandler(const std::string         &aInterfaceName,
                                             const std::string         &aPropertyName,
                                             const PropertyHandlerType &aHandler)
 {
-    std::string fullPath = aInterfaceName + "." + aPropertyName;
+    bool added = mSetPropertyHandlers.Add(aInterfaceName, aPropertyName, aHandler);
 
-    assert(mSetPropertyHandlers.find(fullPath) == mSetPropertyHandlers.end());
-    mSetPropertyHandlers.emplace(fullPath, aHandler);
+    assert(added);
+    OTBR_UNUSED_VARIABLE(added);
 }
 
 void DBusObject::RegisterAsyncGetPropertyHandler(const std::string              &aInterfaceName,
                                                  const std::string              &aPropertyName,
                                                  const AsyncPropertyHandlerType &aHandler)
 {
-    mAsyncGetPropertyHandlers[aInterfaceName].emplace(aPropertyName, aHandler);
+    mAsyncGetPropertyHandlers.Add(aInterfaceName, aPropertyName, aHandler);
+}
+
+DBusObject::PropertyHandlerType DBusObject::MakeCachedPropertyHandler(uint32_t                   aInvalidatingFlags,
+                                                                      Milliseconds               aMaxAge,
+                                                                      const PropertyHandlerType &aHandler)
+{
+    PropertyCacheEntry *entry;
+
+    mPropertyCache.push_back(PropertyCacheEntry{aInvalidatingFlags, aMaxAge, Timepoint(), nullptr});
+    entry = &mPropertyCache.back();
+
+    return [entry, aHandler](DBusMessageIter &aIter) { return GetCachedProperty(*entry, aHandler, aIter); };
+}
+
+void DBusObject::InvalidatePropertyCache(uint32_t aFlags)
+{
+    for (PropertyCacheEntry &entry : mPropertyCache)
+    {
+        if (entry.mInvalidatingFlags & aFlags)
+        {
+            entry.mValue = nullptr;
+        }
+    }
+}
+
+void DBusObject::ClearPropertyCache(void)
+{
+    for (PropertyCacheEntry &entry : mPropertyCache)
+    {
+        entry.mValue = nullptr;
+    }
+}
+
+MemoryUsage DBusObject::GetPropertyCacheMemoryUsage(void) const
+{
+    MemoryUsage usage{0, 0};
+
+    for (const PropertyCacheEntry &entry : mPropertyCache)
+    {
+        char *marshalled;
+        int   length;
+
+        // libdbus doesn't tell the size of a message, so it's measured by marshalling the cached value.
+        if (entry.mValue == nullptr || !dbus_message_marshal(entry.mValue.get(), &marshalled, &length))
+        {
+            continue;
+        }
+
+        usage.mEntries++;
+        usage.mBytes += static_cast<uint64_t>(length);
+        dbus_free(marshalled);
+    }
+
+    return usage;
+}
+
+otError DBusObject::GetCachedProperty(PropertyCacheEntry        &aEntry,
+                                      const PropertyHandlerType &aHandler,
+                                      DBusMessageIter           &aIter)
+{
+    otError         error = OT_ERROR_NONE;
+    Timepoint       now   = Clock::now();
+    DBusMessageIter iter;
+
+    if (aEntry.mValue == nullptr || now - aEntry.mUpdateTime >= aEntry.mMaxAge)
+    {
+        // The encoded value is kept in the body of a scratch message which is never sent.
+        UniqueDBusMessage value{dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN)};
+
+        aEntry.mValue = nullptr;
+        VerifyOrExit(value != nullptr, error = OT_ERROR_NO_BUFS);
+        dbus_message_iter_init_append(value.get(), &iter);
+        SuccessOrExit(error = aHandler(iter));
+
+        aEntry.mValue      = std::move(value);
+        aEntry.mUpdateTime = now;
+    }
+
+    VerifyOrExit(dbus_message_iter_init(aEntry.mValue.get(), &iter), error = OT_ERROR_FAILED);
+    VerifyOrExit(CopyDBusValue(iter, aIter) == OTBR_ERROR_NONE, error = OT_ERROR_FAILED);
+
+exit:
+    return error;
+}
+
+otbrError DBusObject::CopyDBusValue(DBusMessageIter &aFrom, DBusMessageIter &aTo)
+{
+    otbrError       error = OTBR_ERROR_NONE;
+    int             type  = dbus_message_iter_get_arg_type(&aFrom);
+    DBusMessageIter fromSubIter;
+    DBusMessageIter toSubIter;
+    char           *signature = nullptr;
+
+    if (dbus_type_is_basic(type))
+    {
+        DBusBasicValue value;
+
+        dbus_message_iter_get_basic(&aFrom, &value);
+        VerifyOrExit(dbus_message_iter_append_basic(&aTo, type, &value), error = OTBR_ERROR_DBUS);
+        ExitNow();
+    }
+
+    VerifyOrExit(dbus_type_is_container(type), error = OTBR_ERROR_DBUS);
+    dbus_message_iter_recurse(&aFrom, &fromSubIter);
+
+    // Only arrays and variants carry the signature of their content.
+    if (type == DBUS_TYPE_ARRAY || type == DBUS_TYPE_VARIANT)
+    {
+        signature = dbus_message_iter_get_signature(&fromSubIter);
+        VerifyOrExit(signature != nullptr, error = OTBR_ERROR_DBUS);
+    }
+
+    VerifyOrExit(dbus_message_iter_open_container(&aTo, type, signature, &toSubIter), error = OTBR_ERROR_DBUS);
+
+    if (type == DBUS_TYPE_ARRAY && dbus_type_is_fixed(dbus_message_iter_get_element_type(&aFrom)))
+    {
+        const void *elements;
+        int         count;
+
+        dbus_message_iter_get_fixed_array(&fromSubIter, &elements, &count);
+        VerifyOrExit(dbus_message_iter_append_fixed_array(&toSubIter, dbus_message_iter_get_element_type(&aFrom),
+                                                          &elements, count),
+                     error = OTBR_ERROR_DBUS);
+    }
+    else
+    {
+        while (dbus_message_iter_get_arg_type(&fromSubIter) != DBUS_TYPE_INVALID)
+        {
+            SuccessOrExit(error = CopyDBusValue(fromSubIter, toSubIter));
+            dbus_message_iter_next(&fromSubIter);
+        }
+    }
+
+    VerifyOrExit(dbus_message_iter_close_container(&aTo, &toSubIter), error = OTBR_ERROR_DBUS);
+
+exit:
+    if (signature != nullptr)
+    {
+        dbus_free(signature);
+    }
+    return error;
 }
 
 DBusHandlerResult DBusObject::sMessageHandler(DBusConnection *aConnection, DBusMessage *aMessage, void *aData)
@@ -128,23 +307,30 @@ DBusHandlerResult DBusObject::sMessageHandler(DBusConnection *aConnection, DBusM
 
 DBusHandlerResult DBusObject::MessageHandler(DBusConnection *aConnection, DBusMessage *aMessage)
 {
-    DBusHandlerResult handled = DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
-    DBusRequest       request(aConnection, aMessage);
-    std::string       interface  = dbus_message_get_interface(aMessage);
-    std::string       memberName = interface + "." + dbus_message_get_member(aMessage);
-    auto              iter       = mMethodHandlers.find(memberName);
+    DBusHandlerResult        handled       = DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+    const char              *interfaceName = dbus_message_get_interface(aMessage);
+    const char              *memberName    = dbus_message_get_member(aMessage);
+    const MethodHandlerType *handler       = nullptr;
+
+    VerifyOrExit(dbus_message_get_type(aMessage) == DBUS_MESSAGE_TYPE_METHOD_CALL);
+    VerifyOrExit(interfaceName != nullptr && memberName != nullptr);
+    handler = mMethodHandlers.Find(interfaceName, memberName);
+    VerifyOrExit(handler != nullptr);
+
+    otbrLogDebug("Handling method %s.%s", interfaceName, memberName);
+    if (otbrLogIsEnabled(OTBR_LOG_DEBUG))
+    {
+        DumpDBusMessage(*aMessage);
+    }
 
-    if (dbus_message_get_type(aMessage) == DBUS_MESSAGE_TYPE_METHOD_CALL && iter != mMethodHandlers.end())
     {
-        otbrLogDebug("Handling method %s", memberName.c_str());
-        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
-        {
-            DumpDBusMessage(*aMessage);
-        }
-        (iter->second)(request);
-        handled = DBUS_HANDLER_RESULT_HANDLED;
+        DBusRequest request(aConnection, aMessage);
+
+        (*handler)(request);
     }
+    handled = DBUS_HANDLER_RESULT_HANDLED;
 
+exit:
     return handled;
 }
 
@@ -163,30 +349,24 @@ void DBusObject::GetPropertyMethodHandler(DBusRequest &aRequest)
     VerifyOrExit(DBusMessageExtract(&iter, interfaceName) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
     VerifyOrExit(DBusMessageExtract(&iter, propertyName) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
     {
-        auto propertyIter = mGetPropertyHandlers.find(interfaceName);
+        const PropertyHandlerType *handler = mGetPropertyHandlers.Find(interfaceName.c_str(), propertyName.c_str());
+        DBusMessageIter            replyIter;
 
         otbrLogDebug("GetProperty %s.%s", interfaceName.c_str(), propertyName.c_str());
-        VerifyOrExit(propertyIter != mGetPropertyHandlers.end(), error = OT_ERROR_NOT_FOUND);
-        {
-            DBusMessageIter replyIter;
-            auto           &interfaceHandlers = propertyIter->second;
-            auto            interfaceIter     = interfaceHandlers.find(propertyName);
-
-            VerifyOrExit(interfaceIter != interfaceHandlers.end(), error = OT_ERROR_NOT_FOUND);
-            dbus_message_iter_init_append(reply.get(), &replyIter);
-            SuccessOrExit(replyError = interfaceIter->second(replyIter));
-        }
+        VerifyOrExit(handler != nullptr, error = OT_ERROR_NOT_FOUND);
+        dbus_message_iter_init_append(reply.get(), &replyIter);
+        SuccessOrExit(replyError = (*handler)(replyIter));
     }
 exit:
     if (error == OT_ERROR_NONE && replyError == OT_ERROR_NONE)
     {
-        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
+        if (otbrLogIsEnabled(OTBR_LOG_DEBUG))
         {
             otbrLogDebug("GetProperty %s.%s reply:", interfaceName.c_str(), propertyName.c_str());
             DumpDBusMessage(*reply);
         }
 
-        dbus_connection_send(aRequest.GetConnection(), reply.get(), nullptr);
+        aRequest.Send(*reply);
     }
     else if (error == OT_ERROR_NONE)
     {
@@ -212,29 +392,35 @@ void DBusObject::GetAllPropertiesMethodHandler(DBusRequest &aRequest)
 
     VerifyOrExit(reply != nullptr, error = OT_ERROR_NO_BUFS);
     VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
-    VerifyOrExit(mGetPropertyHandlers.find(interfaceName) != mGetPropertyHandlers.end(), error = OT_ERROR_NOT_FOUND);
+    VerifyOrExit(mGetPropertyHandlers.HasInterface(interfaceName.c_str()), error = OT_ERROR_NOT_FOUND);
     dbus_message_iter_init_append(reply.get(), &iter);
 
-    for (auto &p : mGetPropertyHandlers.at(interfaceName))
-    {
-        VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
-                                                      "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
-                                                      &subIter),
-                     error = OT_ERROR_FAILED);
-        VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
-                     error = OT_ERROR_FAILED);
-        VerifyOrExit(DBusMessageEncode(&dictEntryIter, p.first) == OTBR_ERROR_NONE, error = OT_ERROR_FAILED);
+    error = mGetPropertyHandlers.ForEachInInterface(
+        interfaceName.c_str(), [&](const std::string &aPropertyName, const PropertyHandlerType &aHandler) {
+            otError appendError = OT_ERROR_NONE;
 
-        SuccessOrExit(error = p.second(dictEntryIter));
+            VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
+                                                          "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
+                                                          &subIter),
+                         appendError = OT_ERROR_FAILED);
+            VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
+                         appendError = OT_ERROR_FAILED);
+            VerifyOrExit(DBusMessageEncode(&dictEntryIter, aPropertyName) == OTBR_ERROR_NONE,
+                         appendError = OT_ERROR_FAILED);
 
-        VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OT_ERROR_FAILED);
-        VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter));
-    }
+            SuccessOrExit(appendError = aHandler(dictEntryIter));
+
+            VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), appendError = OT_ERROR_FAILED);
+            VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter), appendError = OT_ERROR_FAILED);
+
+        exit:
+            return appendError;
+        });
 
 exit:
     if (error == OT_ERROR_NONE)
     {
-        dbus_connection_send(aRequest.GetConnection(), reply.get(), nullptr);
+        aRequest.Send(*reply);
     }
     else
     {
@@ -247,22 +433,23 @@ void DBusObject::SetPropertyMethodHandler(DBusRequest &aRequest)
     DBusMessageIter iter;
     std::string     interfaceName;
     std::string     propertyName;
-    std::string     propertyFullPath;
     otError         error = OT_ERROR_NONE;
 
     VerifyOrExit(dbus_message_iter_init(aRequest.GetMessage(), &iter), error = OT_ERROR_FAILED);
     VerifyOrExit(DBusMessageExtract(&iter, interfaceName) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
     VerifyOrExit(DBusMessageExtract(&iter, propertyName) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
 
-    propertyFullPath = interfaceName + "." + propertyName;
-    otbrLogInfo("SetProperty %s", propertyFullPath.c_str());
+    otbrLogInfo("SetProperty %s.%s", interfaceName.c_str(), propertyName.c_str());
     {
-        auto handlerIter = mSetPropertyHandlers.find(propertyFullPath);
+        const PropertyHandlerType *handler = mSetPropertyHandlers.Find(interfaceName.c_str(), propertyName.c_str());
 
-        VerifyOrExit(handlerIter != mSetPropertyHandlers.end(), error = OT_ERROR_NOT_FOUND);
-        error = handlerIter->second(iter);
+        VerifyOrExit(handler != nullptr, error = OT_ERROR_NOT_FOUND);
+        SuccessOrExit(error = (*handler)(iter));
     }
 
+    // A property set may change other properties without any `otChangedFlags` being reported.
+    ClearPropertyCache();
+
 exit:
     if (error != OT_ERROR_NONE)
     {
@@ -285,17 +472,12 @@ void DBusObject::AsyncGetPropertyMethodHandler(DBusRequest &aRequest)
     SuccessOrExit(error = OtbrErrorToOtError(DBusMessageExtract(&iter, propertyName)));
 
     {
-        auto propertyIter = mAsyncGetPropertyHandlers.find(interfaceName);
+        const AsyncPropertyHandlerType *handler =
+            mAsyncGetPropertyHandlers.Find(interfaceName.c_str(), propertyName.c_str());
 
         otbrLogDebug("AsyncGetProperty %s.%s", interfaceName.c_str(), propertyName.c_str());
-        VerifyOrExit(propertyIter != mAsyncGetPropertyHandlers.end(), error = OT_ERROR_NOT_FOUND);
-        {
-            auto &interfaceHandlers = propertyIter->second;
-            auto  interfaceIter     = interfaceHandlers.find(propertyName);
-
-            VerifyOrExit(interfaceIter != interfaceHandlers.end(), error = OT_ERROR_NOT_FOUND);
-            (interfaceIter->second)(aRequest);
-        }
+        VerifyOrExit(handler != nullptr, error = OT_ERROR_NOT_FOUND);
+        (*handler)(aRequest);
     }
 
 exit:
@@ -307,8 +489,89 @@ exit:
     }
 }
 
+bool DBusObject::HasSignalSubscribers(void) const
+{
+    return !OTBR_CONFIG_DBUS_SIGNAL_SUBSCRIPTION_REQUIRED || !mSignalSubscribers.empty();
+}
+
+void DBusObject::SubscribeSignalsMethodHandler(DBusRequest &aRequest)
+{
+    const char *sender = dbus_message_get_sender(aRequest.GetMessage());
+    otError     error  = OT_ERROR_NONE;
+
+    VerifyOrExit(sender != nullptr, error = OT_ERROR_INVALID_ARGS);
+
+    if (mSignalSubscribers.insert(sender).second)
+    {
+        // The match is added without waiting for the bus daemon, a subscriber leaving before is kept and only
+        // costs the signals sent to it.
+        dbus_bus_add_match(mConnection, MakeNameOwnerChangedMatchRule(sender).c_str(), nullptr);
+        otbrLogInfo("Signal subscriber %s added, %zu subscribers", sender, mSignalSubscribers.size());
+    }
+
+exit:
+    aRequest.ReplyOtResult(error);
+}
+
+void DBusObject::UnsubscribeSignalsMethodHandler(DBusRequest &aRequest)
+{
+    const char *sender = dbus_message_get_sender(aRequest.GetMessage());
+    otError     error  = OT_ERROR_NONE;
+
+    VerifyOrExit(sender != nullptr, error = OT_ERROR_INVALID_ARGS);
+    RemoveSignalSubscriber(sender);
+
+exit:
+    aRequest.ReplyOtResult(error);
+}
+
+void DBusObject::RemoveSignalSubscriber(const std::string &aName)
+{
+    VerifyOrExit(mSignalSubscribers.erase(aName) > 0);
+
+    dbus_bus_remove_match(mConnection, MakeNameOwnerChangedMatchRule(aName).c_str(), nullptr);
+    otbrLogInfo("Signal subscriber %s removed, %zu subscribers", aName.c_str(), mSignalSubscribers.size());
+
+exit:
+    return;
+}
+
+DBusHandlerResult DBusObject::sNameOwnerChangedFilter(DBusConnection *aConnection, DBusMessage *aMessage, void *aData)
+{
+    OTBR_UNUSED_VARIABLE(aConnection);
+
+    return static_cast<DBusObject *>(aData)->NameOwnerChangedFilter(aMessage);
+}
+
+DBusHandlerResult DBusObject::NameOwnerChangedFilter(DBusMessage *aMessage)
+{
+    const char *name;
+    const char *oldOwner;
+    const char *newOwner;
+
+    VerifyOrExit(dbus_message_is_signal(aMessage, DBUS_INTERFACE_DBUS, "NameOwnerChanged"));
+    VerifyOrExit(dbus_message_get_args(aMessage, nullptr, DBUS_TYPE_STRING, &name, DBUS_TYPE_STRING, &oldOwner,
+                                       DBUS_TYPE_STRING, &newOwner, DBUS_TYPE_INVALID));
+
+    // A unique name which lost its owner belongs to a disconnected client.
+    if (newOwner[0] == '\0')
+    {
+        RemoveSignalSubscriber(name);
+    }
+
+exit:
+    // Other objects and the bus library may handle the signal too.
+    return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+}
+
 DBusObject::~DBusObject(void)
 {
+    if (mIsNameOwnerChangedFilterAdded)
+    {
+        dbus_connection_remove_filter(mConnection, DBusObject::sNameOwnerChangedFilter, this);
+    }
+
+    MemoryUsageRegistry::Get().Remove(this);
 }
 
 UniqueDBusMessage DBusObject::NewSignalMessage(const std::string &aInterfaceName, const std::string &aSignalName)
@@ -316,8 +579,81 @@ UniqueDBusMessage DBusObject::NewSignalMessage(const std::string &aInterfaceName
     return UniqueDBusMessage(dbus_message_new_signal(mObjectPath.c_str(), aInterfaceName.c_str(), aSignalName.c_str()));
 }
 
+void DBusObject::FlushPropertyChanges(void)
+{
+    for (const auto &interfaceChanges : mPendingPropertyChanges)
+    {
+        if (SendPropertiesChanged(interfaceChanges.first, interfaceChanges.second) != OTBR_ERROR_NONE)
+        {
+            otbrLogWarning("Failed to signal property changes of %s", interfaceChanges.first.c_str());
+        }
+    }
+
+    mPendingPropertyChanges.clear();
+}
+
+otbrError DBusObject::SendPropertiesChanged(const std::string                                &aInterfaceName,
+                                            const std::map<std::string, PropertyEncoderType> &aChanges)
+{
+    UniqueDBusMessage signalMsg = NewSignalMessage(DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL);
+    DBusMessageIter   iter, subIter, dictEntryIter;
+    otbrError         error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
+    dbus_message_iter_init_append(signalMsg.get(), &iter);
+
+    // interface_name
+    VerifyOrExit(DBusMessageEncode(&iter, aInterfaceName) == OTBR_ERROR_NONE, error = OTBR_ERROR_DBUS);
+
+    // changed_properties
+    VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
+                                                  "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
+                                                  &subIter),
+                 error = OTBR_ERROR_DBUS);
+
+    for (const auto &change : aChanges)
+    {
+        VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
+                     error = OTBR_ERROR_DBUS);
+
+        SuccessOrExit(error = DBusMessageEncode(&dictEntryIter, change.first));
+        SuccessOrExit(error = change.second(dictEntryIter));
+
+        VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OTBR_ERROR_DBUS);
+        otbrLogDebug("Signal %s.%s", aInterfaceName.c_str(), change.first.c_str());
+    }
+
+    VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter), error = OTBR_ERROR_DBUS);
+
+    // invalidated_properties
+    SuccessOrExit(error = DBusMessageEncode(&iter, std::vector<std::string>()));
+
+    if (otbrLogIsEnabled(OTBR_LOG_DEBUG))
+    {
+        DumpDBusMessage(*signalMsg);
+    }
+
+    error = SendSignal(*signalMsg);
+
+exit:
+    return error;
+}
+
+otbrError DBusObject::SendSignal(DBusMessage &aSignal)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    DBusMessageTracer::Get().TraceSignal(aSignal);
+    VerifyOrExit(dbus_connection_send(mConnection, &aSignal, nullptr), error = OTBR_ERROR_DBUS);
+    mEmittedSignalsMetric->Increment();
+
+exit:
+    return error;
+}
+
 void DBusObject::Flush(void)
 {
+    FlushPropertyChanges();
     dbus_connection_flush(mConnection);
 }
 
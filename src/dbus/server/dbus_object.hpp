@@ -41,18 +41,25 @@
 #endif
 
 #include <functional>
+#include <list>
+#include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <unordered_map>
 
 #include <dbus/dbus.h>
 
 #include "common/code_utils.hpp"
+#include "common/memory_usage.hpp"
+#include "common/metrics.hpp"
+#include "common/time.hpp"
 #include "common/types.hpp"
 #include "dbus/common/constants.hpp"
 #include "dbus/common/dbus_message_dump.hpp"
 #include "dbus/common/dbus_message_helper.hpp"
 #include "dbus/common/dbus_resources.hpp"
+#include "dbus/server/dbus_dispatch_table.hpp"
 #include "dbus/server/dbus_request.hpp"
 
 namespace otbr {
@@ -133,115 +140,197 @@ public:
     /**
      * This method sends a signal.
      *
+     * The signal isn't built when no client listens, see `HasSignalSubscribers()`.
+     *
      * @param[in] aInterfaceName  The interface name.
      * @param[in] aSignalName     The signal name.
      * @param[in] aArgs           The tuple to be encoded into the signal.
      *
-     * @retval OTBR_ERROR_NONE  Signal successfully sent.
+     * @retval OTBR_ERROR_NONE  Signal successfully sent or suppressed.
      * @retval OTBR_ERROR_DBUS  Failed to send the signal.
      */
     template <typename... FieldTypes>
     otbrError Signal(const std::string               &aInterfaceName,
                      const std::string               &aSignalName,
                      const std::tuple<FieldTypes...> &aArgs)
+    {
+        otbrError error = OTBR_ERROR_NONE;
+
+        VerifyOrExit(HasSignalSubscribers(), mSuppressedSignalsMetric->Increment());
+        error = BroadcastSignal(aInterfaceName, aSignalName, aArgs);
+
+    exit:
+        return error;
+    }
+
+    /**
+     * This method sends a signal whether or not any client subscribed to signals.
+     *
+     * This is meant for the signals sent before a client could subscribe, like the one announcing the object is ready.
+     *
+     * @param[in] aInterfaceName  The interface name.
+     * @param[in] aSignalName     The signal name.
+     * @param[in] aArgs           The tuple to be encoded into the signal.
+     *
+     * @retval OTBR_ERROR_NONE  Signal successfully sent.
+     * @retval OTBR_ERROR_DBUS  Failed to send the signal.
+     */
+    template <typename... FieldTypes>
+    otbrError BroadcastSignal(const std::string               &aInterfaceName,
+                              const std::string               &aSignalName,
+                              const std::tuple<FieldTypes...> &aArgs)
     {
         UniqueDBusMessage signalMsg = NewSignalMessage(aInterfaceName, aSignalName);
         otbrError         error     = OTBR_ERROR_NONE;
 
         VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
         SuccessOrExit(error = otbr::DBus::TupleToDBusMessage(*signalMsg, aArgs));
-
-        VerifyOrExit(dbus_connection_send(mConnection, signalMsg.get(), nullptr), error = OTBR_ERROR_DBUS);
+        error = SendSignal(*signalMsg);
 
     exit:
         return error;
     }
 
     /**
-     * This method sends a property changed signal.
+     * This method queues a property changed signal.
+     *
+     * The changes queued until the next `FlushPropertyChanges()` are sent in one PropertiesChanged
+     * signal per interface, a property changed several times is sent once with its latest value.
      *
      * @param[in] aInterfaceName  The interface name.
      * @param[in] aPropertyName   The property name.
      * @param[in] aValue          New value of the property.
      *
-     * @retval OTBR_ERROR_NONE  Signal successfully sent.
-     * @retval OTBR_ERROR_DBUS  Failed to send the signal.
+     * @retval OTBR_ERROR_NONE  Signal successfully queued or suppressed.
      */
     template <typename ValueType>
     otbrError SignalPropertyChanged(const std::string &aInterfaceName,
                                     const std::string &aPropertyName,
                                     const ValueType   &aValue)
     {
-        UniqueDBusMessage signalMsg = NewSignalMessage(DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL);
-        DBusMessageIter   iter, subIter, dictEntryIter;
-        otbrError         error = OTBR_ERROR_NONE;
-
-        VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
-        dbus_message_iter_init_append(signalMsg.get(), &iter);
-
-        // interface_name
-        VerifyOrExit(DBusMessageEncode(&iter, aInterfaceName) == OTBR_ERROR_NONE, error = OTBR_ERROR_DBUS);
-
-        // changed_properties
-        VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
-                                                      "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
-                                                      &subIter),
-                     error = OTBR_ERROR_DBUS);
-        VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
-                     error = OTBR_ERROR_DBUS);
-
-        SuccessOrExit(error = DBusMessageEncode(&dictEntryIter, aPropertyName));
-        SuccessOrExit(error = DBusMessageEncodeToVariant(&dictEntryIter, aValue));
-
-        VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OTBR_ERROR_DBUS);
-        VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter), error = OTBR_ERROR_DBUS);
-
-        // invalidated_properties
-        SuccessOrExit(error = DBusMessageEncode(&iter, std::vector<std::string>()));
-
-        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
-        {
-            otbrLogDebug("Signal %s.%s", aInterfaceName.c_str(), aPropertyName.c_str());
-            DumpDBusMessage(*signalMsg);
-        }
-
-        VerifyOrExit(dbus_connection_send(mConnection, signalMsg.get(), nullptr), error = OTBR_ERROR_DBUS);
+        VerifyOrExit(HasSignalSubscribers(), mSuppressedSignalsMetric->Increment());
+        mPendingPropertyChanges[aInterfaceName][aPropertyName] = [aValue](DBusMessageIter &aIter) {
+            return DBusMessageEncodeToVariant(&aIter, aValue);
+        };
 
     exit:
-        return error;
+        return OTBR_ERROR_NONE;
     }
 
+    /**
+     * This method tells whether any client listens to the signals of this object.
+     *
+     * Unless `OTBR_CONFIG_DBUS_SIGNAL_SUBSCRIPTION_REQUIRED` is enabled, every client is assumed to listen. Otherwise
+     * a client listens from its `SubscribeSignals` call until its `UnsubscribeSignals` call or its disconnection.
+     *
+     * @retval TRUE   Signals are to be sent.
+     * @retval FALSE  Nobody listens, signals are to be suppressed.
+     */
+    bool HasSignalSubscribers(void) const;
+
+    /**
+     * This method sends the property changed signals queued by `SignalPropertyChanged()`.
+     *
+     * This method is expected to be called once per mainloop iteration.
+     */
+    void FlushPropertyChanges(void);
+
     /**
      * The destructor of a d-bus object.
      */
     virtual ~DBusObject(void);
 
     /**
-     * Sends all outgoing messages, blocks until the message queue is empty.
+     * Sends all outgoing messages, including the queued property changes, blocks until the message queue is empty.
      */
     void Flush(void);
 
 protected:
     otbrError Initialize(bool aIsAsyncPropertyHandler);
 
+    /**
+     * This method wraps a get property handler so that the encoded property value is cached.
+     *
+     * The cached encoding is copied into later replies until it is older than @p aMaxAge, or until a change in
+     * @p aInvalidatingFlags is reported with `InvalidatePropertyCache()`.
+     *
+     * @param[in] aInvalidatingFlags  The `otChangedFlags` which invalidate the cached value.
+     * @param[in] aMaxAge             The maximum age of the cached value.
+     * @param[in] aHandler            The get property handler.
+     *
+     * @returns The caching get property handler.
+     */
+    PropertyHandlerType MakeCachedPropertyHandler(uint32_t                   aInvalidatingFlags,
+                                                  Milliseconds               aMaxAge,
+                                                  const PropertyHandlerType &aHandler);
+
+    /**
+     * This method invalidates the cached property values depending on any of @p aFlags.
+     *
+     * @param[in] aFlags  The changed `otChangedFlags`.
+     */
+    void InvalidatePropertyCache(uint32_t aFlags);
+
+    /**
+     * This method invalidates all cached property values.
+     */
+    void ClearPropertyCache(void);
+
 private:
+    struct PropertyCacheEntry
+    {
+        uint32_t          mInvalidatingFlags;
+        Milliseconds      mMaxAge;
+        Timepoint         mUpdateTime;
+        UniqueDBusMessage mValue;
+    };
+
+    static otError   GetCachedProperty(PropertyCacheEntry        &aEntry,
+                                       const PropertyHandlerType &aHandler,
+                                       DBusMessageIter           &aIter);
+    static otbrError CopyDBusValue(DBusMessageIter &aFrom, DBusMessageIter &aTo);
+
+    MemoryUsage GetPropertyCacheMemoryUsage(void) const;
+
     void GetAllPropertiesMethodHandler(DBusRequest &aRequest);
     void GetPropertyMethodHandler(DBusRequest &aRequest);
     void SetPropertyMethodHandler(DBusRequest &aRequest);
     void AsyncGetPropertyMethodHandler(DBusRequest &aRequest);
+    void SubscribeSignalsMethodHandler(DBusRequest &aRequest);
+    void UnsubscribeSignalsMethodHandler(DBusRequest &aRequest);
+    void RemoveSignalSubscriber(const std::string &aName);
+
+    static DBusHandlerResult sNameOwnerChangedFilter(DBusConnection *aConnection, DBusMessage *aMessage, void *aData);
+    DBusHandlerResult        NameOwnerChangedFilter(DBusMessage *aMessage);
 
     static DBusHandlerResult sMessageHandler(DBusConnection *aConnection, DBusMessage *aMessage, void *aData);
     DBusHandlerResult        MessageHandler(DBusConnection *aConnection, DBusMessage *aMessage);
 
-    UniqueDBusMessage NewSignalMessage(const std::string &aInterfaceName, const std::string &aSignalName);
+    using PropertyEncoderType = std::function<otbrError(DBusMessageIter &)>;
 
-    std::unordered_map<std::string, MethodHandlerType>                                    mMethodHandlers;
-    std::unordered_map<std::string, std::unordered_map<std::string, PropertyHandlerType>> mGetPropertyHandlers;
-    std::unordered_map<std::string, std::unordered_map<std::string, AsyncPropertyHandlerType>>
-                                                         mAsyncGetPropertyHandlers;
-    std::unordered_map<std::string, PropertyHandlerType> mSetPropertyHandlers;
-    DBusConnection                                      *mConnection;
-    std::string                                          mObjectPath;
+    UniqueDBusMessage NewSignalMessage(const std::string &aInterfaceName, const std::string &aSignalName);
+    otbrError         SendSignal(DBusMessage &aSignal);
+    otbrError         SendPropertiesChanged(const std::string                                &aInterfaceName,
+                                            const std::map<std::string, PropertyEncoderType> &aChanges);
+
+    DBusDispatchTable<MethodHandlerType>        mMethodHandlers;
+    DBusDispatchTable<PropertyHandlerType>      mGetPropertyHandlers;
+    DBusDispatchTable<AsyncPropertyHandlerType> mAsyncGetPropertyHandlers;
+    DBusDispatchTable<PropertyHandlerType>      mSetPropertyHandlers;
+    DBusConnection                             *mConnection;
+    std::string                                 mObjectPath;
+
+    // The property changes queued since the last flush, ordered for a stable signal content.
+    std::map<std::string, std::map<std::string, PropertyEncoderType>> mPendingPropertyChanges;
+
+    // A list keeps the entries at stable addresses for the handlers referring to them.
+    std::list<PropertyCacheEntry> mPropertyCache;
+
+    // The unique bus names of the clients which subscribed to signals.
+    std::set<std::string> mSignalSubscribers;
+    bool                  mIsNameOwnerChangedFilterAdded;
+    Metrics::Counter     *mEmittedSignalsMetric;
+    Metrics::Counter     *mSuppressedSignalsMetric;
 };
 
 } // namespace DBus
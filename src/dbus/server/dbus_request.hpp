@@ -66,6 +66,7 @@ public:
     DBusRequest(DBusConnection *aConnection, DBusMessage *aMessage)
         : mConnection(aConnection)
         , mMessage(aMessage)
+        , mReceiveTime(DBusMessageTracer::Get().IsEnabled() ? Clock::now() : Timepoint())
     {
         dbus_message_ref(aMessage);
         dbus_connection_ref(aConnection);
@@ -79,6 +80,7 @@ public:
     DBusRequest(const DBusRequest &aOther)
         : mConnection(nullptr)
         , mMessage(nullptr)
+        , mReceiveTime()
     {
         CopyFrom(aOther);
     }
@@ -108,6 +110,17 @@ public:
      */
     DBusConnection *GetConnection(void) { return mConnection; }
 
+    /**
+     * This method sends a reply message to the d-bus method call.
+     *
+     * @param[in] aReply  The reply message.
+     */
+    void Send(DBusMessage &aReply)
+    {
+        DBusMessageTracer::Get().TraceReply(*mMessage, aReply, mReceiveTime);
+        dbus_connection_send(mConnection, &aReply, nullptr);
+    }
+
     /**
      * This method replies to the d-bus method call.
      *
@@ -120,12 +133,12 @@ public:
         VerifyOrExit(reply != nullptr);
         VerifyOrExit(otbr::DBus::TupleToDBusMessage(*reply, aReply) == OTBR_ERROR_NONE);
 
-        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
+        if (otbrLogIsEnabled(OTBR_LOG_DEBUG))
         {
             otbrLogDebug("Replied to %s.%s :", dbus_message_get_interface(mMessage), dbus_message_get_member(mMessage));
             DumpDBusMessage(*reply);
         }
-        dbus_connection_send(mConnection, reply.get(), nullptr);
+        Send(*reply);
 
     exit:
         return;
@@ -173,7 +186,7 @@ public:
             VerifyOrDie(error == OTBR_ERROR_NONE, "Failed to encode result");
         }
 
-        dbus_connection_send(mConnection, reply.get(), nullptr);
+        Send(*reply);
     }
 
     /**
@@ -202,14 +215,16 @@ private:
         {
             dbus_connection_unref(mConnection);
         }
-        mConnection = aOther.mConnection;
-        mMessage    = aOther.mMessage;
+        mConnection  = aOther.mConnection;
+        mMessage     = aOther.mMessage;
+        mReceiveTime = aOther.mReceiveTime;
         dbus_message_ref(mMessage);
         dbus_connection_ref(mConnection);
     }
 
     DBusConnection *mConnection;
     DBusMessage    *mMessage;
+    Timepoint       mReceiveTime;
 };
 
 } // namespace DBus
@@ -0,0 +1,197 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions for the versioned snapshots of tables served as deltas over d-bus.
+ */
+
+#ifndef OTBR_DBUS_DBUS_TABLE_DELTA_HPP_
+#define OTBR_DBUS_DBUS_TABLE_DELTA_HPP_
+
+#include "openthread-br/config.h"
+
+#include <deque>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <stdint.h>
+
+namespace otbr {
+namespace DBus {
+
+/**
+ * This class keeps the latest snapshot of a table with the version at which each entry last changed, so that a
+ * client polling the table only receives the entries which changed since its previous poll.
+ *
+ * A version token combines a random epoch of the table with a counter incremented by each update changing the
+ * table. A client passes 0, a token of another epoch (e.g. of a restarted agent), or a token older than the
+ * removals still remembered, receives the full table instead of a delta.
+ *
+ * @tparam KeyType    The type of the keys identifying the entries, which must be ordered.
+ * @tparam EntryType  The type of the entries.
+ */
+template <typename KeyType, typename EntryType> class DBusTableDelta
+{
+public:
+    enum
+    {
+        kMaxRemovedEntries = 256, ///< The number of removed entries remembered for the deltas.
+    };
+
+    /**
+     * This structure represents the changes of the table since a version.
+     */
+    struct Delta
+    {
+        uint64_t               mVersion; ///< The version of the table, to pass to the next poll.
+        bool                   mFull;    ///< Whether @p mChanged is the full table, replacing the client's copy.
+        std::vector<EntryType> mChanged; ///< The entries added or changed since the version.
+        std::vector<EntryType> mRemoved; ///< The last values of the entries removed since the version.
+    };
+
+    /**
+     * This constructor initializes an empty table with a random epoch.
+     */
+    DBusTableDelta(void)
+        : mEpoch(std::random_device()())
+        , mCounter(1)
+        , mRemovedFloor(1)
+    {
+    }
+
+    /**
+     * This method replaces the snapshot of the table with its current entries.
+     *
+     * @param[in] aEntries  The current entries with their keys.
+     * @param[in] aIsSame   The function comparing a current entry with its previous value, invoked as
+     *                      `aIsSame(const EntryType &, const EntryType &)`. It ignores the fields which change
+     *                      constantly, like ages and RSSI, so that only meaningful changes make an entry change.
+     */
+    template <typename IsSame> void Update(std::vector<std::pair<KeyType, EntryType>> &&aEntries, IsSame aIsSame)
+    {
+        std::map<KeyType, Record> entries;
+        bool                      changed = false;
+        uint32_t                  next    = mCounter + 1;
+
+        for (auto &entry : aEntries)
+        {
+            auto     iter    = mEntries.find(entry.first);
+            uint32_t version = next;
+
+            if (iter != mEntries.end() && aIsSame(iter->second.mEntry, entry.second))
+            {
+                version = iter->second.mVersion;
+            }
+            else
+            {
+                changed = true;
+            }
+
+            entries[entry.first] = Record{std::move(entry.second), version};
+        }
+
+        for (auto &entry : mEntries)
+        {
+            if (entries.find(entry.first) == entries.end())
+            {
+                mRemoved.push_back(Record{std::move(entry.second.mEntry), next});
+                changed = true;
+            }
+        }
+
+        while (mRemoved.size() > kMaxRemovedEntries)
+        {
+            // A client older than the forgotten removal can't learn about it anymore.
+            mRemovedFloor = mRemoved.front().mVersion;
+            mRemoved.pop_front();
+        }
+
+        mEntries = std::move(entries);
+
+        if (changed)
+        {
+            mCounter = next;
+        }
+    }
+
+    /**
+     * This method gets the changes of the table since a version.
+     *
+     * A client applies the removed entries before the changed ones, an entry which was removed and then added back
+     * is reported in both.
+     *
+     * @param[in]  aVersion  The version returned by the previous poll of the client, 0 for the first poll.
+     * @param[out] aDelta    The changes since @p aVersion.
+     */
+    void GetDelta(uint64_t aVersion, Delta &aDelta) const
+    {
+        uint32_t since = static_cast<uint32_t>(aVersion);
+
+        aDelta.mVersion = (static_cast<uint64_t>(mEpoch) << 32) | mCounter;
+        aDelta.mFull    = (aVersion >> 32) != mEpoch || since < mRemovedFloor || since > mCounter;
+        aDelta.mChanged.clear();
+        aDelta.mRemoved.clear();
+
+        for (const auto &entry : mEntries)
+        {
+            if (aDelta.mFull || entry.second.mVersion > since)
+            {
+                aDelta.mChanged.push_back(entry.second.mEntry);
+            }
+        }
+
+        for (const Record &removed : mRemoved)
+        {
+            if (!aDelta.mFull && removed.mVersion > since)
+            {
+                aDelta.mRemoved.push_back(removed.mEntry);
+            }
+        }
+    }
+
+private:
+    struct Record
+    {
+        EntryType mEntry;
+        uint32_t  mVersion;
+    };
+
+    uint32_t                  mEpoch;
+    uint32_t                  mCounter;
+    uint32_t                  mRemovedFloor;
+    std::map<KeyType, Record> mEntries;
+    std::deque<Record>        mRemoved;
+};
+
+} // namespace DBus
+} // namespace otbr
+
+#endif // OTBR_DBUS_DBUS_TABLE_DELTA_HPP_
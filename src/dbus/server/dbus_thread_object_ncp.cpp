@@ -57,6 +57,12 @@ otbrError DBusThreadObjectNcp::Init(void)
 
     RegisterAsyncGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE,
                                     std::bind(&DBusThreadObjectNcp::AsyncGetDeviceRoleHandler, this, _1));
+    RegisterAsyncGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_ACTIVE_DATASET_TLVS,
+                                    std::bind(&DBusThreadObjectNcp::AsyncGetActiveDatasetTlvsHandler, this, _1));
+    RegisterAsyncGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_IP6_COUNTERS,
+                                    std::bind(&DBusThreadObjectNcp::AsyncGetIp6CountersHandler, this, _1));
+    RegisterAsyncGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_SPINEL_FRAME_TRACE,
+                                    std::bind(&DBusThreadObjectNcp::AsyncGetSpinelFrameTraceHandler, this, _1));
 
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_JOIN_METHOD,
                    std::bind(&DBusThreadObjectNcp::JoinHandler, this, _1));
@@ -65,7 +71,7 @@ otbrError DBusThreadObjectNcp::Init(void)
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SCHEDULE_MIGRATION_METHOD,
                    std::bind(&DBusThreadObjectNcp::ScheduleMigrationHandler, this, _1));
 
-    SuccessOrExit(error = Signal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SIGNAL_READY, std::make_tuple()));
+    SuccessOrExit(error = BroadcastSignal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SIGNAL_READY, std::make_tuple()));
 exit:
     return error;
 }
@@ -77,7 +83,73 @@ void DBusThreadObjectNcp::AsyncGetDeviceRoleHandler(DBusRequest &aRequest)
     ReplyAsyncGetProperty(aRequest, GetDeviceRoleName(role));
 }
 
-void DBusThreadObjectNcp::ReplyAsyncGetProperty(DBusRequest &aRequest, const std::string &aContent)
+void DBusThreadObjectNcp::AsyncGetActiveDatasetTlvsHandler(DBusRequest &aRequest)
+{
+    mHost.GetDatasetActiveTlvs([this, aRequest](otError aError, const otOperationalDatasetTlvs &aDatasetTlvs) mutable {
+        if (aError == OT_ERROR_NONE && aDatasetTlvs.mLength == 0)
+        {
+            aError = OT_ERROR_NOT_FOUND;
+        }
+
+        if (aError == OT_ERROR_NONE)
+        {
+            std::vector<uint8_t> data(aDatasetTlvs.mTlvs, aDatasetTlvs.mTlvs + aDatasetTlvs.mLength);
+
+            ReplyAsyncGetProperty(aRequest, data);
+        }
+        else
+        {
+            aRequest.ReplyOtResult(aError);
+        }
+    });
+}
+
+void DBusThreadObjectNcp::AsyncGetIp6CountersHandler(DBusRequest &aRequest)
+{
+    mHost.GetIp6Counters([this, aRequest](otError aError, const otIpCounters &aCounters) mutable {
+        if (aError == OT_ERROR_NONE)
+        {
+            IpCounters counters;
+
+            counters.mTxSuccess = aCounters.mTxSuccess;
+            counters.mRxSuccess = aCounters.mRxSuccess;
+            counters.mTxFailure = aCounters.mTxFailure;
+            counters.mRxFailure = aCounters.mRxFailure;
+            ReplyAsyncGetProperty(aRequest, counters);
+        }
+        else
+        {
+            aRequest.ReplyOtResult(aError);
+        }
+    });
+}
+
+void DBusThreadObjectNcp::AsyncGetSpinelFrameTraceHandler(DBusRequest &aRequest)
+{
+    std::vector<Ncp::SpinelFrameTrace::Record> records;
+    std::vector<SpinelFrameRecord>             trace;
+
+    mHost.GetSpinelFrameTrace().GetRecords(records);
+    trace.reserve(records.size());
+
+    for (const Ncp::SpinelFrameTrace::Record &record : records)
+    {
+        SpinelFrameRecord frameRecord;
+
+        frameRecord.mTimestamp = record.mTimestamp;
+        frameRecord.mDirection = record.mDirection;
+        frameRecord.mHeader    = record.mHeader;
+        frameRecord.mCommand   = record.mCommand;
+        frameRecord.mPropKey   = record.mPropKey;
+        frameRecord.mLength    = record.mLength;
+        trace.push_back(frameRecord);
+    }
+
+    ReplyAsyncGetProperty(aRequest, trace);
+}
+
+template <typename ValueType>
+void DBusThreadObjectNcp::ReplyAsyncGetProperty(DBusRequest &aRequest, const ValueType &aContent)
 {
     UniqueDBusMessage reply{dbus_message_new_method_return(aRequest.GetMessage())};
     DBusMessageIter   replyIter;
@@ -89,7 +161,7 @@ void DBusThreadObjectNcp::ReplyAsyncGetProperty(DBusRequest &aRequest, const std
 exit:
     if (error == OT_ERROR_NONE)
     {
-        dbus_connection_send(aRequest.GetConnection(), reply.get(), nullptr);
+        aRequest.Send(*reply);
     }
     else
     {
@@ -79,7 +79,10 @@ public:
 
 private:
     void AsyncGetDeviceRoleHandler(DBusRequest &aRequest);
-    void ReplyAsyncGetProperty(DBusRequest &aRequest, const std::string &aContent);
+    void AsyncGetActiveDatasetTlvsHandler(DBusRequest &aRequest);
+    void AsyncGetIp6CountersHandler(DBusRequest &aRequest);
+    void AsyncGetSpinelFrameTraceHandler(DBusRequest &aRequest);
+    template <typename ValueType> void ReplyAsyncGetProperty(DBusRequest &aRequest, const ValueType &aContent);
 
     void JoinHandler(DBusRequest &aRequest);
     void LeaveHandler(DBusRequest &aRequest);
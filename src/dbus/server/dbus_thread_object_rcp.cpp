@@ -49,6 +49,7 @@
 #include "common/api_strings.hpp"
 #include "common/byteswap.hpp"
 #include "common/code_utils.hpp"
+#include "common/counter_series.hpp"
 #include "dbus/common/constants.hpp"
 #include "dbus/server/dbus_agent.hpp"
 #include "dbus/server/dbus_thread_object_rcp.hpp"
@@ -70,9 +71,60 @@
 #define OTBR_CONFIG_BORDER_AGENT_MESHCOP_E_UDP_PORT 0
 #endif
 
+/**
+ * @def OTBR_CONFIG_TELEMETRY_ARENA_BLOCK_SIZE
+ *
+ * Specifies the size in bytes of the first memory block of the protobuf arena which holds the telemetry data.
+ * The following blocks grow up to 4 times this size.
+ */
+#ifndef OTBR_CONFIG_TELEMETRY_ARENA_BLOCK_SIZE
+#define OTBR_CONFIG_TELEMETRY_ARENA_BLOCK_SIZE 8192
+#endif
+
 using std::placeholders::_1;
 using std::placeholders::_2;
 
+/**
+ * This structure describes how long the encoded value of a property may be reused.
+ */
+struct PropertyCachePolicy
+{
+    const char *mPropertyName;
+    uint32_t    mInvalidatingFlags; ///< The `otChangedFlags` which invalidate the cached value.
+    uint32_t    mMaxAgeMs;          ///< The maximum age of the cached value, in milliseconds.
+};
+
+// Counters and tables change without any `otChangedFlags`, they are cached briefly to serve bursts of GetAll.
+static constexpr uint32_t kShortPropertyMaxAgeMs = 1000;
+static constexpr uint32_t kLongPropertyMaxAgeMs  = 10000;
+
+static const PropertyCachePolicy kPropertyCachePolicies[] = {
+    {OTBR_DBUS_PROPERTY_LINK_COUNTERS, 0, kShortPropertyMaxAgeMs},
+    {OTBR_DBUS_PROPERTY_IP6_COUNTERS, 0, kShortPropertyMaxAgeMs},
+    {OTBR_DBUS_PROPERTY_COUNTER_HISTORY, 0, kLongPropertyMaxAgeMs},
+    {OTBR_DBUS_PROPERTY_BORDER_ROUTING_COUNTERS, 0, kShortPropertyMaxAgeMs},
+    {OTBR_DBUS_PROPERTY_DNSSD_COUNTERS, 0, kShortPropertyMaxAgeMs},
+    {OTBR_DBUS_PROPERTY_NAT64_PROTOCOL_COUNTERS, 0, kShortPropertyMaxAgeMs},
+    {OTBR_DBUS_PROPERTY_NAT64_ERROR_COUNTERS, 0, kShortPropertyMaxAgeMs},
+    {OTBR_DBUS_PROPERTY_NAT64_MAPPINGS, 0, kShortPropertyMaxAgeMs},
+    {OTBR_DBUS_PROPERTY_SRP_SERVER_INFO, 0, kShortPropertyMaxAgeMs},
+    {OTBR_DBUS_PROPERTY_CHILD_TABLE,
+     OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_CHILD_ADDED | OT_CHANGED_THREAD_CHILD_REMOVED, kShortPropertyMaxAgeMs},
+    {OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_PROEPRTY,
+     OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_CHILD_ADDED | OT_CHANGED_THREAD_CHILD_REMOVED, kShortPropertyMaxAgeMs},
+    {OTBR_DBUS_PROPERTY_PENDING_DATASET_TLVS, OT_CHANGED_PENDING_DATASET, kShortPropertyMaxAgeMs},
+    {OTBR_DBUS_PROPERTY_TELEMETRY_DATA, UINT32_MAX, kShortPropertyMaxAgeMs},
+    {OTBR_DBUS_PROPERTY_ACTIVE_DATASET_TLVS, OT_CHANGED_ACTIVE_DATASET, kLongPropertyMaxAgeMs},
+    {OTBR_DBUS_PROPERTY_LEADER_DATA,
+     OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID | OT_CHANGED_THREAD_NETDATA, kLongPropertyMaxAgeMs},
+    {OTBR_DBUS_PROPERTY_NETWORK_DATA_PRPOERTY, OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_NETDATA,
+     kLongPropertyMaxAgeMs},
+    {OTBR_DBUS_PROPERTY_STABLE_NETWORK_DATA_PRPOERTY, OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_NETDATA,
+     kLongPropertyMaxAgeMs},
+    {OTBR_DBUS_PROPERTY_ON_MESH_PREFIXES, OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_NETDATA, kLongPropertyMaxAgeMs},
+    {OTBR_DBUS_PROPERTY_EXTERNAL_ROUTES, OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_NETDATA, kLongPropertyMaxAgeMs},
+};
+
 #if OTBR_ENABLE_NAT64
 static std::string GetNat64StateName(otNat64State aState)
 {
@@ -101,15 +153,24 @@ static std::string GetNat64StateName(otNat64State aState)
 namespace otbr {
 namespace DBus {
 
-DBusThreadObjectRcp::DBusThreadObjectRcp(DBusConnection     &aConnection,
-                                         const std::string  &aInterfaceName,
-                                         otbr::Ncp::RcpHost &aHost,
-                                         Mdns::Publisher    *aPublisher,
-                                         otbr::BorderAgent  &aBorderAgent)
+constexpr Milliseconds DBusThreadObjectRcp::kScanResultCacheTime;
+
+DBusThreadObjectRcp::DBusThreadObjectRcp(DBusConnection                            &aConnection,
+                                         const std::string                         &aInterfaceName,
+                                         otbr::Ncp::RcpHost                        &aHost,
+                                         Mdns::Publisher                           *aPublisher,
+                                         otbr::BorderAgent                         &aBorderAgent,
+                                         const TrelDnssdTelemetryInfo              *aTrelDnssdInfo,
+                                         const BackboneRouter::BackboneRouterStats *aBackboneRouterStats)
     : DBusObject(&aConnection, OTBR_DBUS_OBJECT_PREFIX + aInterfaceName)
     , mHost(aHost)
     , mPublisher(aPublisher)
     , mBorderAgent(aBorderAgent)
+    , mTrelDnssdInfo(aTrelDnssdInfo)
+    , mBackboneRouterStats(aBackboneRouterStats)
+    , mScanResultValid(false)
+    , mEnergyScanResultValid(false)
+    , mEnergyScanResultDuration(0)
 {
 }
 
@@ -125,12 +186,18 @@ otbrError DBusThreadObjectRcp::Init(void)
     threadHelper->SetDhcp6PdStateCallback(std::bind(&DBusThreadObjectRcp::Dhcp6PdStateHandler, this, _1));
 #endif
     threadHelper->AddActiveDatasetChangeHandler(std::bind(&DBusThreadObjectRcp::ActiveDatasetChangeHandler, this, _1));
+    AddScanResultHandlers();
     mHost.RegisterResetHandler(std::bind(&DBusThreadObjectRcp::NcpResetHandler, this));
+    mHost.AddThreadStateChangedCallback(UINT32_MAX, [this](const Ncp::ThreadStateSnapshot &aSnapshot) {
+        InvalidatePropertyCache(aSnapshot.mFlags);
+    });
 
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SCAN_METHOD,
                    std::bind(&DBusThreadObjectRcp::ScanHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_ENERGY_SCAN_METHOD,
                    std::bind(&DBusThreadObjectRcp::EnergyScanHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SURVEY_SCAN_METHOD,
+                   std::bind(&DBusThreadObjectRcp::SurveyScanHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_ATTACH_METHOD,
                    std::bind(&DBusThreadObjectRcp::AttachHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_DETACH_METHOD,
@@ -167,6 +234,20 @@ otbrError DBusThreadObjectRcp::Init(void)
                    std::bind(&DBusThreadObjectRcp::ActivateEphemeralKeyModeHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_DEACTIVATE_EPHEMERAL_KEY_MODE_METHOD,
                    std::bind(&DBusThreadObjectRcp::DeactivateEphemeralKeyModeHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_TELEMETRY_DATA_METHOD,
+                   std::bind(&DBusThreadObjectRcp::GetTelemetryDataMethodHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_TELEMETRY_DATA_PAGE_METHOD,
+                   std::bind(&DBusThreadObjectRcp::GetTelemetryDataPageMethodHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_CHILD_TABLE_DELTA_METHOD,
+                   std::bind(&DBusThreadObjectRcp::GetChildTableDeltaHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_NEIGHBOR_TABLE_DELTA_METHOD,
+                   std::bind(&DBusThreadObjectRcp::GetNeighborTableDeltaHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_EXTERNAL_ROUTES_DELTA_METHOD,
+                   std::bind(&DBusThreadObjectRcp::GetExternalRoutesDeltaHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SET_LOG_TAG_LEVEL_METHOD,
+                   std::bind(&DBusThreadObjectRcp::SetLogTagLevelHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_RELOAD_CONFIG_METHOD,
+                   std::bind(&DBusThreadObjectRcp::ReloadConfigHandler, this, _1));
 
     RegisterMethod(DBUS_INTERFACE_INTROSPECTABLE, DBUS_INTROSPECT_METHOD,
                    std::bind(&DBusThreadObjectRcp::IntrospectHandler, this, _1));
@@ -211,6 +292,8 @@ otbrError DBusThreadObjectRcp::Init(void)
                                std::bind(&DBusThreadObjectRcp::GetLinkCountersHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_IP6_COUNTERS,
                                std::bind(&DBusThreadObjectRcp::GetIp6CountersHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_COUNTER_HISTORY,
+                               std::bind(&DBusThreadObjectRcp::GetCounterHistoryHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_SUPPORTED_CHANNEL_MASK,
                                std::bind(&DBusThreadObjectRcp::GetSupportedChannelMaskHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_PREFERRED_CHANNEL_MASK,
@@ -235,6 +318,10 @@ otbrError DBusThreadObjectRcp::Init(void)
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_ALL_CHANNEL_QUALITIES,
                                std::bind(&DBusThreadObjectRcp::GetChannelMonitorAllChannelQualities, this, _1));
 #endif
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CHANNEL_OCCUPANCY,
+                               std::bind(&DBusThreadObjectRcp::GetChannelOccupancyHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_RECOMMENDED_CHANNEL,
+                               std::bind(&DBusThreadObjectRcp::GetRecommendedChannelHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CHILD_TABLE,
                                std::bind(&DBusThreadObjectRcp::GetChildTableHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_PROEPRTY,
@@ -304,7 +391,7 @@ otbrError DBusThreadObjectRcp::Init(void)
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CAPABILITIES,
                                std::bind(&DBusThreadObjectRcp::GetCapabilitiesHandler, this, _1));
 
-    SuccessOrExit(error = Signal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SIGNAL_READY, std::make_tuple()));
+    SuccessOrExit(error = BroadcastSignal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SIGNAL_READY, std::make_tuple()));
 
 exit:
     return error;
@@ -325,59 +412,92 @@ void DBusThreadObjectRcp::Dhcp6PdStateHandler(otBorderRoutingDhcp6PdState aDhcp6
 
 void DBusThreadObjectRcp::NcpResetHandler(void)
 {
+    ClearPropertyCache();
+    AbortScanRequests();
     mHost.GetThreadHelper()->AddDeviceRoleHandler(std::bind(&DBusThreadObjectRcp::DeviceRoleHandler, this, _1));
     mHost.GetThreadHelper()->AddActiveDatasetChangeHandler(
         std::bind(&DBusThreadObjectRcp::ActiveDatasetChangeHandler, this, _1));
+    AddScanResultHandlers();
     SignalPropertyChanged(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE,
                           GetDeviceRoleName(OT_DEVICE_ROLE_DISABLED));
 }
 
 void DBusThreadObjectRcp::ScanHandler(DBusRequest &aRequest)
 {
-    auto threadHelper = mHost.GetThreadHelper();
-    threadHelper->Scan(std::bind(&DBusThreadObjectRcp::ReplyScanResult, this, aRequest, _1, _2));
+    // Requests arriving while a scan is in flight share its result, and a result younger than
+    // kScanResultCacheTime is reused, so concurrent clients don't each occupy the radio for a full scan.
+    if (!mScanRequests.empty())
+    {
+        mScanRequests.push_back(aRequest);
+    }
+    else if (mScanResultValid && Clock::now() - mScanResultTime < kScanResultCacheTime)
+    {
+        aRequest.Reply(std::tie(mScanResult));
+    }
+    else
+    {
+        mScanRequests.push_back(aRequest);
+        mHost.GetThreadHelper()->Scan(std::bind(&DBusThreadObjectRcp::ReplyScanResult, this, _1, _2));
+    }
 }
 
-void DBusThreadObjectRcp::ReplyScanResult(DBusRequest                           &aRequest,
-                                          otError                                aError,
-                                          const std::vector<otActiveScanResult> &aResult)
+void DBusThreadObjectRcp::ReplyScanResult(otError aError, const std::vector<otActiveScanResult> &aResult)
 {
-    std::vector<ActiveScanResult> results;
+    std::vector<DBusRequest> requests;
 
-    if (aError != OT_ERROR_NONE)
-    {
-        aRequest.ReplyOtResult(aError);
-    }
-    else
+    requests.swap(mScanRequests);
+    mScanResultValid = false;
+    mScanResult.clear();
+
+    if (aError == OT_ERROR_NONE)
     {
         for (const auto &r : aResult)
         {
-            ActiveScanResult result = {};
+            mScanResult.emplace_back(ConvertScanResult(r));
+        }
 
-            result.mExtAddress = ConvertOpenThreadUint64(r.mExtAddress.m8);
-            result.mPanId      = r.mPanId;
-            result.mChannel    = r.mChannel;
-            result.mRssi       = r.mRssi;
-            result.mLqi        = r.mLqi;
+        mScanResultValid = true;
+        mScanResultTime  = Clock::now();
+    }
 
-            results.emplace_back(result);
+    for (DBusRequest &request : requests)
+    {
+        if (aError != OT_ERROR_NONE)
+        {
+            request.ReplyOtResult(aError);
+        }
+        else
+        {
+            request.Reply(std::tie(mScanResult));
         }
-
-        aRequest.Reply(std::tie(results));
     }
 }
 
 void DBusThreadObjectRcp::EnergyScanHandler(DBusRequest &aRequest)
 {
-    otError  error        = OT_ERROR_NONE;
-    auto     threadHelper = mHost.GetThreadHelper();
+    otError  error = OT_ERROR_NONE;
     uint32_t scanDuration;
 
     auto args = std::tie(scanDuration);
 
     VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
-    threadHelper->EnergyScan(scanDuration,
-                             std::bind(&DBusThreadObjectRcp::ReplyEnergyScanResult, this, aRequest, _1, _2));
+
+    // Only requests with the same duration are compatible. The others wait for the scan in flight, since the
+    // Thread helper runs one energy scan at a time.
+    if (mEnergyScanResultValid && mEnergyScanResultDuration == scanDuration &&
+        Clock::now() - mEnergyScanResultTime < kScanResultCacheTime && mEnergyScanRequests.empty())
+    {
+        aRequest.Reply(std::tie(mEnergyScanResult));
+    }
+    else
+    {
+        mEnergyScanRequests.emplace_back(scanDuration, aRequest);
+
+        if (mEnergyScanRequests.size() == 1)
+        {
+            StartEnergyScan();
+        }
+    }
 
 exit:
     if (error != OT_ERROR_NONE)
@@ -386,29 +506,176 @@ exit:
     }
 }
 
-void DBusThreadObjectRcp::ReplyEnergyScanResult(DBusRequest                           &aRequest,
+void DBusThreadObjectRcp::StartEnergyScan(void)
+{
+    uint32_t scanDuration = mEnergyScanRequests.front().first;
+
+    mHost.GetThreadHelper()->EnergyScan(
+        scanDuration, std::bind(&DBusThreadObjectRcp::ReplyEnergyScanResult, this, scanDuration, _1, _2));
+}
+
+void DBusThreadObjectRcp::ReplyEnergyScanResult(uint32_t                               aScanDuration,
                                                 otError                                aError,
                                                 const std::vector<otEnergyScanResult> &aResult)
 {
-    std::vector<EnergyScanResult> results;
+    std::vector<std::pair<uint32_t, DBusRequest>> remaining;
 
-    if (aError != OT_ERROR_NONE)
+    mEnergyScanResultValid = false;
+    mEnergyScanResult.clear();
+
+    if (aError == OT_ERROR_NONE)
     {
-        aRequest.ReplyOtResult(aError);
+        for (const auto &r : aResult)
+        {
+            mEnergyScanResult.emplace_back(ConvertScanResult(r));
+        }
+
+        mEnergyScanResultValid    = true;
+        mEnergyScanResultDuration = aScanDuration;
+        mEnergyScanResultTime     = Clock::now();
     }
-    else
+
+    // Requests for other durations are kept for the next scan.
+    remaining.swap(mEnergyScanRequests);
+
+    for (auto &request : remaining)
     {
-        for (const auto &r : aResult)
+        if (request.first != aScanDuration)
+        {
+            mEnergyScanRequests.push_back(request);
+        }
+        else if (aError != OT_ERROR_NONE)
+        {
+            request.second.ReplyOtResult(aError);
+        }
+        else
         {
-            EnergyScanResult result;
+            request.second.Reply(std::tie(mEnergyScanResult));
+        }
+    }
+
+    if (!mEnergyScanRequests.empty())
+    {
+        StartEnergyScan();
+    }
+}
+
+void DBusThreadObjectRcp::SurveyScanHandler(DBusRequest &aRequest)
+{
+    otError  error = OT_ERROR_NONE;
+    uint32_t channelMask;
+    uint32_t scanDuration;
+
+    auto args = std::tie(channelMask, scanDuration);
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(mSurveyScanRequests.empty(), error = OT_ERROR_BUSY);
+
+    mSurveyScanRequests.push_back(aRequest);
+    mHost.GetThreadHelper()->SurveyScan(channelMask, scanDuration,
+                                        std::bind(&DBusThreadObjectRcp::ReplySurveyScanResult, this, _1, _2, _3));
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        aRequest.ReplyOtResult(error);
+    }
+}
+
+void DBusThreadObjectRcp::ReplySurveyScanResult(otError                                aError,
+                                                const std::vector<otActiveScanResult> &aActiveScanResult,
+                                                const std::vector<otEnergyScanResult> &aEnergyScanResult)
+{
+    std::vector<DBusRequest>      requests;
+    std::vector<ActiveScanResult> scanResult;
+    std::vector<EnergyScanResult> energyScanResult;
+
+    requests.swap(mSurveyScanRequests);
+
+    for (const auto &r : aActiveScanResult)
+    {
+        scanResult.emplace_back(ConvertScanResult(r));
+    }
 
-            result.mChannel = r.mChannel;
-            result.mMaxRssi = r.mMaxRssi;
+    for (const auto &r : aEnergyScanResult)
+    {
+        energyScanResult.emplace_back(ConvertScanResult(r));
+    }
 
-            results.emplace_back(result);
+    for (DBusRequest &request : requests)
+    {
+        if (aError != OT_ERROR_NONE)
+        {
+            request.ReplyOtResult(aError);
         }
+        else
+        {
+            request.Reply(std::tie(scanResult, energyScanResult));
+        }
+    }
+}
+
+void DBusThreadObjectRcp::AddScanResultHandlers(void)
+{
+    mHost.GetThreadHelper()->AddScanResultHandlers(
+        [this](const otActiveScanResult &aResult) {
+            Signal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SIGNAL_SCAN_RESULT,
+                   std::make_tuple(ConvertScanResult(aResult)));
+        },
+        [this](const otEnergyScanResult &aResult) {
+            Signal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SIGNAL_ENERGY_SCAN_RESULT,
+                   std::make_tuple(ConvertScanResult(aResult)));
+        });
+}
+
+ActiveScanResult DBusThreadObjectRcp::ConvertScanResult(const otActiveScanResult &aResult)
+{
+    ActiveScanResult result = {};
+
+    result.mExtAddress = ConvertOpenThreadUint64(aResult.mExtAddress.m8);
+    result.mPanId      = aResult.mPanId;
+    result.mChannel    = aResult.mChannel;
+    result.mRssi       = aResult.mRssi;
+    result.mLqi        = aResult.mLqi;
+
+    return result;
+}
+
+EnergyScanResult DBusThreadObjectRcp::ConvertScanResult(const otEnergyScanResult &aResult)
+{
+    EnergyScanResult result;
 
-        aRequest.Reply(std::tie(results));
+    result.mChannel = aResult.mChannel;
+    result.mMaxRssi = aResult.mMaxRssi;
+
+    return result;
+}
+
+void DBusThreadObjectRcp::AbortScanRequests(void)
+{
+    std::vector<DBusRequest>                      scanRequests;
+    std::vector<std::pair<uint32_t, DBusRequest>> energyScanRequests;
+    std::vector<DBusRequest>                      surveyScanRequests;
+
+    scanRequests.swap(mScanRequests);
+    energyScanRequests.swap(mEnergyScanRequests);
+    surveyScanRequests.swap(mSurveyScanRequests);
+    mScanResultValid       = false;
+    mEnergyScanResultValid = false;
+
+    for (DBusRequest &request : scanRequests)
+    {
+        request.ReplyOtResult(OT_ERROR_ABORT);
+    }
+
+    for (auto &request : energyScanRequests)
+    {
+        request.second.ReplyOtResult(OT_ERROR_ABORT);
+    }
+
+    for (DBusRequest &request : surveyScanRequests)
+    {
+        request.ReplyOtResult(OT_ERROR_ABORT);
     }
 }
 
@@ -845,6 +1112,59 @@ exit:
     return error;
 }
 
+static CounterHistoryInfo ToCounterHistoryInfo(uint64_t             aExtAddress,
+                                               const CounterSeries &aSeries,
+                                               const char *(*aCounterToString)(uint8_t))
+{
+    CounterHistoryInfo info;
+
+    info.mExtAddress = aExtAddress;
+
+    for (uint16_t i = 0; i < aSeries.GetNumIntervals(); i++)
+    {
+        info.mIntervals.push_back(aSeries.GetIntervalDuration(i));
+    }
+
+    for (uint8_t counter = 0; counter < aSeries.GetNumCounters(); counter++)
+    {
+        CounterHistoryInfo::Counter entry;
+
+        entry.mName          = aCounterToString(counter);
+        entry.mValue         = aSeries.GetValue(counter);
+        entry.mRatePerMinute = aSeries.GetRatePerMinute(counter);
+
+        for (uint16_t i = 0; i < aSeries.GetNumIntervals(); i++)
+        {
+            entry.mDeltas.push_back(aSeries.GetDelta(i, counter));
+        }
+
+        info.mCounters.push_back(std::move(entry));
+    }
+
+    return info;
+}
+
+otError DBusThreadObjectRcp::GetCounterHistoryHandler(DBusMessageIter &aIter)
+{
+    const agent::CounterHistory    &history = mHost.GetThreadHelper()->GetCounterHistory();
+    std::vector<CounterHistoryInfo> infos;
+    otError                         error = OT_ERROR_NONE;
+
+    infos.push_back(
+        ToCounterHistoryInfo(0, history.GetInterfaceSeries(), agent::CounterHistory::InterfaceCounterToString));
+
+    for (const agent::CounterHistory::Neighbor &neighbor : history.GetNeighbors())
+    {
+        infos.push_back(ToCounterHistoryInfo(neighbor.mExtAddress, neighbor.mSeries,
+                                             agent::CounterHistory::NeighborCounterToString));
+    }
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, infos) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
 otError DBusThreadObjectRcp::GetSupportedChannelMaskHandler(DBusMessageIter &aIter)
 {
     auto     threadHelper = mHost.GetThreadHelper();
@@ -1020,10 +1340,52 @@ exit:
 #endif // OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
 }
 
-otError DBusThreadObjectRcp::GetChildTableHandler(DBusMessageIter &aIter)
+otError DBusThreadObjectRcp::GetChannelOccupancyHandler(DBusMessageIter &aIter)
+{
+#if OTBR_ENABLE_CHANNEL_SAMPLING
+    auto                        threadHelper = mHost.GetThreadHelper();
+    otError                     error        = OT_ERROR_NONE;
+    uint32_t                    channelMask  = otLinkGetSupportedChannelMask(threadHelper->GetInstance());
+    std::vector<ChannelQuality> quality;
+
+    for (const ChannelOccupancy::Quality &entry : threadHelper->GetChannelOccupancy().GetQualities(channelMask))
+    {
+        quality.emplace_back(ChannelQuality{entry.mChannel, entry.mOccupancy});
+    }
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, quality) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+#else  // OTBR_ENABLE_CHANNEL_SAMPLING
+    OTBR_UNUSED_VARIABLE(aIter);
+    return OT_ERROR_NOT_IMPLEMENTED;
+#endif // OTBR_ENABLE_CHANNEL_SAMPLING
+}
+
+otError DBusThreadObjectRcp::GetRecommendedChannelHandler(DBusMessageIter &aIter)
+{
+#if OTBR_ENABLE_CHANNEL_SAMPLING
+    auto     threadHelper = mHost.GetThreadHelper();
+    otError  error        = OT_ERROR_NONE;
+    uint32_t channelMask  = otPlatRadioGetPreferredChannelMask(threadHelper->GetInstance());
+    uint8_t  channel;
+
+    // Not all preferred channels are sampled enough yet to compare them.
+    VerifyOrExit(threadHelper->GetChannelOccupancy().Recommend(channelMask, channel), error = OT_ERROR_INVALID_STATE);
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, channel) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+#else  // OTBR_ENABLE_CHANNEL_SAMPLING
+    OTBR_UNUSED_VARIABLE(aIter);
+    return OT_ERROR_NOT_IMPLEMENTED;
+#endif // OTBR_ENABLE_CHANNEL_SAMPLING
+}
+
+std::vector<ChildInfo> DBusThreadObjectRcp::ReadChildTable(void)
 {
     auto                   threadHelper = mHost.GetThreadHelper();
-    otError                error        = OT_ERROR_NONE;
     uint16_t               childIndex   = 0;
     otChildInfo            childInfo;
     std::vector<ChildInfo> childTable;
@@ -1050,16 +1412,23 @@ otError DBusThreadObjectRcp::GetChildTableHandler(DBusMessageIter &aIter)
         childIndex++;
     }
 
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, childTable) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    return childTable;
+}
+
+otError DBusThreadObjectRcp::GetChildTableHandler(DBusMessageIter &aIter)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, ReadChildTable()) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
 
 exit:
     return error;
 }
 
-otError DBusThreadObjectRcp::GetNeighborTableHandler(DBusMessageIter &aIter)
+std::vector<NeighborInfo> DBusThreadObjectRcp::ReadNeighborTable(void)
 {
     auto                      threadHelper = mHost.GetThreadHelper();
-    otError                   error        = OT_ERROR_NONE;
     otNeighborInfoIterator    iter         = OT_NEIGHBOR_INFO_ITERATOR_INIT;
     otNeighborInfo            neighborInfo;
     std::vector<NeighborInfo> neighborTable;
@@ -1086,7 +1455,15 @@ otError DBusThreadObjectRcp::GetNeighborTableHandler(DBusMessageIter &aIter)
         neighborTable.push_back(info);
     }
 
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, neighborTable) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    return neighborTable;
+}
+
+otError DBusThreadObjectRcp::GetNeighborTableHandler(DBusMessageIter &aIter)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, ReadNeighborTable()) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
 
 exit:
     return error;
@@ -1130,10 +1507,9 @@ exit:
     return error;
 }
 
-otError DBusThreadObjectRcp::GetExternalRoutesHandler(DBusMessageIter &aIter)
+std::vector<ExternalRoute> DBusThreadObjectRcp::ReadExternalRoutes(void)
 {
     auto                       threadHelper = mHost.GetThreadHelper();
-    otError                    error        = OT_ERROR_NONE;
     otNetworkDataIterator      iter         = OT_NETWORK_DATA_ITERATOR_INIT;
     otExternalRouteConfig      config;
     std::vector<ExternalRoute> externalRouteTable;
@@ -1152,13 +1528,104 @@ otError DBusThreadObjectRcp::GetExternalRoutesHandler(DBusMessageIter &aIter)
         externalRouteTable.push_back(route);
     }
 
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, externalRouteTable) == OTBR_ERROR_NONE,
+    return externalRouteTable;
+}
+
+otError DBusThreadObjectRcp::GetExternalRoutesHandler(DBusMessageIter &aIter)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, ReadExternalRoutes()) == OTBR_ERROR_NONE,
                  error = OT_ERROR_INVALID_ARGS);
 
 exit:
     return error;
 }
 
+// The ages, RSSI, error rates and frame counters change all the time, only the other fields make an entry change.
+static bool IsSameChild(const ChildInfo &aLhs, const ChildInfo &aRhs)
+{
+    return aLhs.mTimeout == aRhs.mTimeout && aLhs.mChildId == aRhs.mChildId &&
+           aLhs.mNetworkDataVersion == aRhs.mNetworkDataVersion && aLhs.mLinkQualityIn == aRhs.mLinkQualityIn &&
+           aLhs.mRxOnWhenIdle == aRhs.mRxOnWhenIdle && aLhs.mFullThreadDevice == aRhs.mFullThreadDevice &&
+           aLhs.mFullNetworkData == aRhs.mFullNetworkData && aLhs.mIsStateRestoring == aRhs.mIsStateRestoring;
+}
+
+static bool IsSameNeighbor(const NeighborInfo &aLhs, const NeighborInfo &aRhs)
+{
+    return aLhs.mRloc16 == aRhs.mRloc16 && aLhs.mLinkQualityIn == aRhs.mLinkQualityIn &&
+           aLhs.mVersion == aRhs.mVersion && aLhs.mRxOnWhenIdle == aRhs.mRxOnWhenIdle &&
+           aLhs.mFullThreadDevice == aRhs.mFullThreadDevice && aLhs.mFullNetworkData == aRhs.mFullNetworkData &&
+           aLhs.mIsChild == aRhs.mIsChild;
+}
+
+static bool IsSameExternalRoute(const ExternalRoute &aLhs, const ExternalRoute &aRhs)
+{
+    return aLhs.mPreference == aRhs.mPreference && aLhs.mStable == aRhs.mStable &&
+           aLhs.mNextHopIsThisDevice == aRhs.mNextHopIsThisDevice;
+}
+
+template <typename KeyType, typename EntryType>
+void DBusThreadObjectRcp::ReplyTableDelta(DBusRequest &aRequest, const DBusTableDelta<KeyType, EntryType> &aTable)
+{
+    otError                                            error = OT_ERROR_NONE;
+    uint64_t                                           version;
+    auto                                               args = std::tie(version);
+    typename DBusTableDelta<KeyType, EntryType>::Delta delta;
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+    aTable.GetDelta(version, delta);
+    aRequest.Reply(std::tie(delta.mVersion, delta.mFull, delta.mChanged, delta.mRemoved));
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        aRequest.ReplyOtResult(error);
+    }
+}
+
+void DBusThreadObjectRcp::GetChildTableDeltaHandler(DBusRequest &aRequest)
+{
+    std::vector<std::pair<uint64_t, ChildInfo>> entries;
+
+    for (ChildInfo &info : ReadChildTable())
+    {
+        entries.emplace_back(info.mExtAddress, std::move(info));
+    }
+
+    mChildTableDelta.Update(std::move(entries), IsSameChild);
+    ReplyTableDelta(aRequest, mChildTableDelta);
+}
+
+void DBusThreadObjectRcp::GetNeighborTableDeltaHandler(DBusRequest &aRequest)
+{
+    std::vector<std::pair<uint64_t, NeighborInfo>> entries;
+
+    for (NeighborInfo &info : ReadNeighborTable())
+    {
+        entries.emplace_back(info.mExtAddress, std::move(info));
+    }
+
+    mNeighborTableDelta.Update(std::move(entries), IsSameNeighbor);
+    ReplyTableDelta(aRequest, mNeighborTableDelta);
+}
+
+void DBusThreadObjectRcp::GetExternalRoutesDeltaHandler(DBusRequest &aRequest)
+{
+    std::vector<std::pair<ExternalRouteKey, ExternalRoute>> entries;
+
+    for (ExternalRoute &route : ReadExternalRoutes())
+    {
+        ExternalRouteKey key{route.mPrefix.mPrefix, route.mPrefix.mLength, route.mRloc16};
+
+        entries.emplace_back(std::move(key), std::move(route));
+    }
+
+    mExternalRoutesDelta.Update(std::move(entries), IsSameExternalRoute);
+    ReplyTableDelta(aRequest, mExternalRoutesDelta);
+}
+
 otError DBusThreadObjectRcp::GetOnMeshPrefixesHandler(DBusMessageIter &aIter)
 {
     auto                      threadHelper = mHost.GetThreadHelper();
@@ -1474,14 +1941,31 @@ exit:
 #endif // OTBR_ENABLE_TREL
 }
 
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+static google::protobuf::ArenaOptions GetTelemetryArenaOptions(void)
+{
+    google::protobuf::ArenaOptions options;
+
+    // The telemetry data is made of many small messages and strings, which are allocated from a few large blocks
+    // and released at once with the arena.
+    options.start_block_size = OTBR_CONFIG_TELEMETRY_ARENA_BLOCK_SIZE;
+    options.max_block_size   = 4 * OTBR_CONFIG_TELEMETRY_ARENA_BLOCK_SIZE;
+
+    return options;
+}
+#endif
+
 otError DBusThreadObjectRcp::GetTelemetryDataHandler(DBusMessageIter &aIter)
 {
 #if OTBR_ENABLE_TELEMETRY_DATA_API
-    otError                      error = OT_ERROR_NONE;
-    threadnetwork::TelemetryData telemetryData;
-    auto                         threadHelper = mHost.GetThreadHelper();
-
-    if (threadHelper->RetrieveTelemetryData(mPublisher, telemetryData) != OT_ERROR_NONE)
+    otError                       error = OT_ERROR_NONE;
+    google::protobuf::Arena       arena(GetTelemetryArenaOptions());
+    threadnetwork::TelemetryData &telemetryData =
+        *google::protobuf::Arena::CreateMessage<threadnetwork::TelemetryData>(&arena);
+    auto                          threadHelper = mHost.GetThreadHelper();
+
+    if (threadHelper->RetrieveTelemetryData(mPublisher, mTrelDnssdInfo, mBackboneRouterStats, telemetryData) !=
+        OT_ERROR_NONE)
     {
         otbrLogWarning("Some metrics were not populated in RetrieveTelemetryData");
     }
@@ -1501,6 +1985,130 @@ exit:
 #endif
 }
 
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+struct DBusThreadObjectRcp::TelemetryCollection
+{
+    TelemetryCollection(const DBusRequest                           &aRequest,
+                        uint32_t                                     aSections,
+                        const agent::ThreadHelper::TelemetryOptions &aOptions)
+        : mRequest(aRequest)
+        , mPendingSections(aSections)
+        , mOptions(aOptions)
+        , mError(OT_ERROR_NONE)
+        , mArena(GetTelemetryArenaOptions())
+        , mTelemetryData(*google::protobuf::Arena::CreateMessage<threadnetwork::TelemetryData>(&mArena))
+    {
+    }
+
+    DBusRequest                           mRequest;
+    uint32_t                              mPendingSections;
+    agent::ThreadHelper::TelemetryOptions mOptions;
+    otError                               mError;
+    google::protobuf::Arena               mArena;
+    threadnetwork::TelemetryData         &mTelemetryData; // Owned by `mArena`.
+};
+
+void DBusThreadObjectRcp::StartTelemetryCollection(DBusRequest                                 &aRequest,
+                                                   uint32_t                                     aSections,
+                                                   const agent::ThreadHelper::TelemetryOptions &aOptions)
+{
+    aSections &= agent::ThreadHelper::kTelemetrySectionsAll;
+    if (aSections == 0)
+    {
+        aSections = agent::ThreadHelper::kTelemetrySectionsAll;
+    }
+
+    CollectTelemetrySection(std::make_shared<TelemetryCollection>(aRequest, aSections, aOptions));
+}
+
+void DBusThreadObjectRcp::CollectTelemetrySection(const std::shared_ptr<TelemetryCollection> &aCollection)
+{
+    // Collect the lowest pending section only, and yield to the mainloop before the next one so
+    // that a full telemetry request doesn't block other processing for its whole duration.
+    uint32_t section = aCollection->mPendingSections & (~aCollection->mPendingSections + 1);
+
+    aCollection->mPendingSections &= ~section;
+
+    if (mHost.GetThreadHelper()->RetrieveTelemetryData(mPublisher, mTrelDnssdInfo, mBackboneRouterStats, section,
+                                                       aCollection->mOptions,
+                                                       aCollection->mTelemetryData) != OT_ERROR_NONE)
+    {
+        aCollection->mError = OT_ERROR_FAILED;
+    }
+
+    if (aCollection->mPendingSections != 0)
+    {
+        mHost.PostTimerTask(Milliseconds(0), [this, aCollection]() { CollectTelemetrySection(aCollection); });
+    }
+    else
+    {
+        // The collection is not accessed by the mainloop anymore, so it is serialized on a worker thread.
+        mWorkerPool.Post<std::vector<uint8_t>>(
+            [aCollection]() {
+                const std::string telemetryDataBytes = aCollection->mTelemetryData.SerializeAsString();
+
+                return std::vector<uint8_t>(telemetryDataBytes.begin(), telemetryDataBytes.end());
+            },
+            mHost.GetTaskRunner(),
+            [aCollection](std::vector<uint8_t> aData) {
+                if (aCollection->mError != OT_ERROR_NONE)
+                {
+                    otbrLogWarning("Some metrics were not populated in RetrieveTelemetryData");
+                }
+
+                aCollection->mRequest.Reply(std::tie(aData));
+            });
+    }
+}
+#endif // OTBR_ENABLE_TELEMETRY_DATA_API
+
+void DBusThreadObjectRcp::GetTelemetryDataMethodHandler(DBusRequest &aRequest)
+{
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    otError  error = OT_ERROR_NONE;
+    uint32_t sections;
+    auto     args = std::tie(sections);
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+    StartTelemetryCollection(aRequest, sections, agent::ThreadHelper::TelemetryOptions());
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        aRequest.ReplyOtResult(error);
+    }
+#else
+    aRequest.ReplyOtResult(OT_ERROR_NOT_IMPLEMENTED);
+#endif
+}
+
+void DBusThreadObjectRcp::GetTelemetryDataPageMethodHandler(DBusRequest &aRequest)
+{
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    otError                               error = OT_ERROR_NONE;
+    uint32_t                              sections;
+    uint8_t                               order;
+    agent::ThreadHelper::TelemetryOptions options;
+    auto                                  args = std::tie(sections, options.mMaxNat64Mappings,
+                                                          options.mNat64MappingCursor, order);
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(order <= agent::ThreadHelper::kNat64MappingOrderByIdleTime, error = OT_ERROR_INVALID_ARGS);
+
+    options.mNat64MappingOrder = static_cast<agent::ThreadHelper::Nat64MappingOrder>(order);
+    StartTelemetryCollection(aRequest, sections, options);
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        aRequest.ReplyOtResult(error);
+    }
+#else
+    aRequest.ReplyOtResult(OT_ERROR_NOT_IMPLEMENTED);
+#endif
+}
+
 otError DBusThreadObjectRcp::GetCapabilitiesHandler(DBusMessageIter &aIter)
 {
     otError            error = OT_ERROR_NONE;
@@ -1553,7 +2161,7 @@ void DBusThreadObjectRcp::GetPropertiesHandler(DBusRequest &aRequest)
 exit:
     if (error == OT_ERROR_NONE)
     {
-        dbus_connection_send(aRequest.GetConnection(), reply.get(), nullptr);
+        aRequest.Send(*reply);
     }
     else
     {
@@ -1565,8 +2173,19 @@ void DBusThreadObjectRcp::RegisterGetPropertyHandler(const std::string         &
                                                      const std::string         &aPropertyName,
                                                      const PropertyHandlerType &aHandler)
 {
-    DBusObject::RegisterGetPropertyHandler(aInterfaceName, aPropertyName, aHandler);
-    mGetPropertyHandlers[aPropertyName] = aHandler;
+    PropertyHandlerType handler = aHandler;
+
+    for (const PropertyCachePolicy &policy : kPropertyCachePolicies)
+    {
+        if (aPropertyName == policy.mPropertyName)
+        {
+            handler = MakeCachedPropertyHandler(policy.mInvalidatingFlags, Milliseconds(policy.mMaxAgeMs), aHandler);
+            break;
+        }
+    }
+
+    DBusObject::RegisterGetPropertyHandler(aInterfaceName, aPropertyName, handler);
+    mGetPropertyHandlers[aPropertyName] = handler;
 }
 
 otError DBusThreadObjectRcp::GetOtbrVersionHandler(DBusMessageIter &aIter)
@@ -1779,6 +2398,45 @@ void DBusThreadObjectRcp::LeaveNetworkHandler(DBusRequest &aRequest)
     });
 }
 
+void DBusThreadObjectRcp::SetLogTagLevelHandler(DBusRequest &aRequest)
+{
+    otError     error = OT_ERROR_NONE;
+    otbrError   result;
+    std::string tag;
+    int32_t     level;
+    auto        args = std::tie(tag, level);
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(level <= OTBR_LOG_DEBUG, error = OT_ERROR_INVALID_ARGS);
+
+    if (level < 0)
+    {
+        result = otbrLogClearTagLevel(tag.c_str());
+    }
+    else
+    {
+        result = otbrLogSetTagLevel(tag.c_str(), static_cast<otbrLogLevel>(level));
+    }
+
+    VerifyOrExit(result != OTBR_ERROR_ERRNO, error = OT_ERROR_NO_BUFS);
+    SuccessOrExit(error = OtbrErrorToOtError(result));
+    otbrLogNotice("Log level of %s is %d", tag.c_str(), otbrLogGetTagLevel(tag.c_str()));
+
+exit:
+    aRequest.ReplyOtResult(error);
+}
+
+void DBusThreadObjectRcp::ReloadConfigHandler(DBusRequest &aRequest)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mConfigReloadHandler != nullptr, error = OT_ERROR_NOT_IMPLEMENTED);
+    error = OtbrErrorToOtError(mConfigReloadHandler());
+
+exit:
+    aRequest.ReplyOtResult(error);
+}
+
 #if OTBR_ENABLE_NAT64
 void DBusThreadObjectRcp::SetNat64Enabled(DBusRequest &aRequest)
 {
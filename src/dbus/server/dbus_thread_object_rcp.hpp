@@ -36,12 +36,20 @@
 
 #include "openthread-br/config.h"
 
+#include <functional>
+#include <memory>
 #include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #include <openthread/link.h>
 
+#include "backbone_router/backbone_stats.hpp"
 #include "border_agent/border_agent.hpp"
+#include "common/worker_pool.hpp"
 #include "dbus/server/dbus_object.hpp"
+#include "dbus/server/dbus_table_delta.hpp"
 #include "mdns/mdns.hpp"
 #include "ncp/rcp_host.hpp"
 
@@ -63,20 +71,36 @@ public:
     /**
      * This constructor of dbus thread object.
      *
-     * @param[in] aConnection     The dbus connection.
-     * @param[in] aInterfaceName  The dbus interface name.
-     * @param[in] aHost           The Thread controller
-     * @param[in] aPublisher      The Mdns::Publisher
-     * @param[in] aBorderAgent    The Border Agent
+     * @param[in] aConnection           The dbus connection.
+     * @param[in] aInterfaceName        The dbus interface name.
+     * @param[in] aHost                 The Thread controller
+     * @param[in] aPublisher            The Mdns::Publisher
+     * @param[in] aBorderAgent          The Border Agent
+     * @param[in] aTrelDnssdInfo        The TREL DNS-SD telemetry, or `nullptr` if TREL is not enabled
+     * @param[in] aBackboneRouterStats  The Backbone Router statistics, or `nullptr` if BBR is not enabled
      */
-    DBusThreadObjectRcp(DBusConnection     &aConnection,
-                        const std::string  &aInterfaceName,
-                        otbr::Ncp::RcpHost &aHost,
-                        Mdns::Publisher    *aPublisher,
-                        otbr::BorderAgent  &aBorderAgent);
+    DBusThreadObjectRcp(DBusConnection                            &aConnection,
+                        const std::string                         &aInterfaceName,
+                        otbr::Ncp::RcpHost                        &aHost,
+                        Mdns::Publisher                           *aPublisher,
+                        otbr::BorderAgent                         &aBorderAgent,
+                        const TrelDnssdTelemetryInfo              *aTrelDnssdInfo,
+                        const BackboneRouter::BackboneRouterStats *aBackboneRouterStats);
+
+    /**
+     * The handler reloading the configuration of otbr-agent.
+     */
+    using ConfigReloadHandler = std::function<otbrError(void)>;
 
     otbrError Init(void) override;
 
+    /**
+     * This method sets the handler of the `ReloadConfig` method.
+     *
+     * @param[in] aHandler  The handler, or `nullptr` to reply that reloading is not supported.
+     */
+    void SetConfigReloadHandler(ConfigReloadHandler aHandler) { mConfigReloadHandler = std::move(aHandler); }
+
     void RegisterGetPropertyHandler(const std::string         &aInterfaceName,
                                     const std::string         &aPropertyName,
                                     const PropertyHandlerType &aHandler) override;
@@ -89,6 +113,7 @@ private:
 
     void ScanHandler(DBusRequest &aRequest);
     void EnergyScanHandler(DBusRequest &aRequest);
+    void SurveyScanHandler(DBusRequest &aRequest);
     void AttachHandler(DBusRequest &aRequest);
     void AttachAllNodesToHandler(DBusRequest &aRequest);
     void DetachHandler(DBusRequest &aRequest);
@@ -106,6 +131,13 @@ private:
     void GetPropertiesHandler(DBusRequest &aRequest);
     void LeaveNetworkHandler(DBusRequest &aRequest);
     void SetNat64Enabled(DBusRequest &aRequest);
+    void SetLogTagLevelHandler(DBusRequest &aRequest);
+    void ReloadConfigHandler(DBusRequest &aRequest);
+    void GetTelemetryDataMethodHandler(DBusRequest &aRequest);
+    void GetChildTableDeltaHandler(DBusRequest &aRequest);
+    void GetNeighborTableDeltaHandler(DBusRequest &aRequest);
+    void GetExternalRoutesDeltaHandler(DBusRequest &aRequest);
+    void GetTelemetryDataPageMethodHandler(DBusRequest &aRequest);
     void ActivateEphemeralKeyModeHandler(DBusRequest &aRequest);
     void DeactivateEphemeralKeyModeHandler(DBusRequest &aRequest);
 
@@ -132,6 +164,7 @@ private:
     otError GetCcaFailureRateHandler(DBusMessageIter &aIter);
     otError GetLinkCountersHandler(DBusMessageIter &aIter);
     otError GetIp6CountersHandler(DBusMessageIter &aIter);
+    otError GetCounterHistoryHandler(DBusMessageIter &aIter);
     otError GetSupportedChannelMaskHandler(DBusMessageIter &aIter);
     otError GetPreferredChannelMaskHandler(DBusMessageIter &aIter);
     otError GetRloc16Handler(DBusMessageIter &aIter);
@@ -143,6 +176,8 @@ private:
     otError GetLocalLeaderWeightHandler(DBusMessageIter &aIter);
     otError GetChannelMonitorSampleCountHandler(DBusMessageIter &aIter);
     otError GetChannelMonitorAllChannelQualities(DBusMessageIter &aIter);
+    otError GetChannelOccupancyHandler(DBusMessageIter &aIter);
+    otError GetRecommendedChannelHandler(DBusMessageIter &aIter);
     otError GetChildTableHandler(DBusMessageIter &aIter);
     otError GetNeighborTableHandler(DBusMessageIter &aIter);
     otError GetPartitionIDHandler(DBusMessageIter &aIter);
@@ -178,13 +213,70 @@ private:
     otError GetTelemetryDataHandler(DBusMessageIter &aIter);
     otError GetCapabilitiesHandler(DBusMessageIter &aIter);
 
-    void ReplyScanResult(DBusRequest &aRequest, otError aError, const std::vector<otActiveScanResult> &aResult);
-    void ReplyEnergyScanResult(DBusRequest &aRequest, otError aError, const std::vector<otEnergyScanResult> &aResult);
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    struct TelemetryCollection;
+
+    void StartTelemetryCollection(DBusRequest                                 &aRequest,
+                                  uint32_t                                     aSections,
+                                  const agent::ThreadHelper::TelemetryOptions &aOptions);
+    void CollectTelemetrySection(const std::shared_ptr<TelemetryCollection> &aCollection);
+#endif
+
+    void ReplyScanResult(otError aError, const std::vector<otActiveScanResult> &aResult);
+    void StartEnergyScan(void);
+    void ReplyEnergyScanResult(uint32_t                               aScanDuration,
+                               otError                                aError,
+                               const std::vector<otEnergyScanResult> &aResult);
+    void ReplySurveyScanResult(otError                                aError,
+                               const std::vector<otActiveScanResult> &aActiveScanResult,
+                               const std::vector<otEnergyScanResult> &aEnergyScanResult);
+    void AbortScanRequests(void);
+    void AddScanResultHandlers(void);
+
+    static ActiveScanResult ConvertScanResult(const otActiveScanResult &aResult);
+    static EnergyScanResult ConvertScanResult(const otEnergyScanResult &aResult);
+
+    std::vector<ChildInfo>     ReadChildTable(void);
+    std::vector<NeighborInfo>  ReadNeighborTable(void);
+    std::vector<ExternalRoute> ReadExternalRoutes(void);
+
+    template <typename KeyType, typename EntryType>
+    static void ReplyTableDelta(DBusRequest &aRequest, const DBusTableDelta<KeyType, EntryType> &aTable);
+
+    /**
+     * How long a scan result is reused for later requests.
+     */
+    static constexpr Milliseconds kScanResultCacheTime = Milliseconds(2000);
 
     otbr::Ncp::RcpHost                                  &mHost;
     std::unordered_map<std::string, PropertyHandlerType> mGetPropertyHandlers;
     otbr::Mdns::Publisher                               *mPublisher;
     otbr::BorderAgent                                   &mBorderAgent;
+    const TrelDnssdTelemetryInfo                        *mTrelDnssdInfo;
+    const BackboneRouter::BackboneRouterStats           *mBackboneRouterStats;
+    ConfigReloadHandler                                  mConfigReloadHandler;
+
+    std::vector<DBusRequest>                      mScanRequests;
+    std::vector<ActiveScanResult>                 mScanResult;
+    bool                                          mScanResultValid;
+    Timepoint                                     mScanResultTime;
+    std::vector<std::pair<uint32_t, DBusRequest>> mEnergyScanRequests;
+    std::vector<EnergyScanResult>                 mEnergyScanResult;
+    bool                                          mEnergyScanResultValid;
+    uint32_t                                      mEnergyScanResultDuration;
+    Timepoint                                     mEnergyScanResultTime;
+    std::vector<DBusRequest>                      mSurveyScanRequests;
+
+    // The snapshots of the tables served as deltas to the clients polling them. An external route is keyed by its
+    // prefix, prefix length and RLOC16.
+    using ExternalRouteKey = std::tuple<std::vector<uint8_t>, uint8_t, uint16_t>;
+
+    DBusTableDelta<uint64_t, ChildInfo>             mChildTableDelta;
+    DBusTableDelta<uint64_t, NeighborInfo>          mNeighborTableDelta;
+    DBusTableDelta<ExternalRouteKey, ExternalRoute> mExternalRoutesDelta;
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    WorkerPool mWorkerPool{1}; // Serializes the telemetry data off the mainloop.
+#endif
 };
 
 /**
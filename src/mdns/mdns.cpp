@@ -38,17 +38,98 @@
 #if OTBR_ENABLE_MDNS
 
 #include <assert.h>
+#include <ctype.h>
+#include <inttypes.h>
 
 #include <algorithm>
 #include <functional>
 
+#include "common/block_pool.hpp"
 #include "common/code_utils.hpp"
+#include "common/trace.hpp"
 #include "utils/dns_utils.hpp"
+#include "utils/string_utils.hpp"
 
 namespace otbr {
 
 namespace Mdns {
 
+Publisher::Publisher(void)
+{
+    InitOperationStats();
+    MemoryUsageRegistry::Get().Add(this, "mdns_registrations", [this]() { return GetRegistrationMemoryUsage(); });
+    MemoryUsageRegistry::Get().Add(this, "mdns_cache", [this]() { return GetCacheMemoryUsage(); });
+}
+
+Publisher::~Publisher(void)
+{
+    MemoryUsageRegistry::Get().Remove(this);
+}
+
+MemoryUsage Publisher::GetRegistrationMemoryUsage(void) const
+{
+    MemoryUsage usage;
+
+    usage.mEntries =
+        static_cast<uint32_t>(mServiceRegistrations.size() + mHostRegistrations.size() + mKeyRegistrations.size());
+    usage.mBytes   = EstimateHeapBytes(mServiceRegistrations) + EstimateHeapBytes(mHostRegistrations) +
+                   EstimateHeapBytes(mKeyRegistrations);
+
+    for (const auto &entry : mServiceRegistrations)
+    {
+        const ServiceRegistration &serviceReg = *entry.second;
+
+        usage.mBytes += sizeof(serviceReg) + EstimateHeapBytes(serviceReg.mHostName) +
+                        EstimateHeapBytes(serviceReg.mName) + EstimateHeapBytes(serviceReg.mType) +
+                        EstimateHeapBytes(serviceReg.mSubTypeList) + EstimateHeapBytes(serviceReg.mTxtData);
+    }
+
+    for (const auto &entry : mHostRegistrations)
+    {
+        const HostRegistration &hostReg = *entry.second;
+
+        usage.mBytes += sizeof(hostReg) + EstimateHeapBytes(hostReg.mName) + EstimateHeapBytes(hostReg.mAddresses);
+    }
+
+    for (const auto &entry : mKeyRegistrations)
+    {
+        const KeyRegistration &keyReg = *entry.second;
+
+        usage.mBytes += sizeof(keyReg) + EstimateHeapBytes(keyReg.mName) + EstimateHeapBytes(keyReg.mKeyData);
+    }
+
+    return usage;
+}
+
+MemoryUsage Publisher::GetCacheMemoryUsage(void) const
+{
+    MemoryUsage usage;
+
+    usage.mEntries = static_cast<uint32_t>(mInstanceCache.size() + mHostCache.size() + mServiceSubscriptions.size() +
+                                           mHostSubscriptions.size());
+    usage.mBytes   = EstimateHeapBytes(mInstanceCache) + EstimateHeapBytes(mHostCache) +
+                   EstimateHeapBytes(mServiceSubscriptions) + EstimateHeapBytes(mHostSubscriptions);
+
+    for (const auto &entry : mInstanceCache)
+    {
+        const DiscoveredInstanceInfo &info = entry.second.mInstanceInfo;
+
+        usage.mBytes += EstimateHeapBytes(entry.second.mType) + EstimateHeapBytes(info.mName) +
+                        EstimateHeapBytes(info.mHostName) + EstimateHeapBytes(info.mAddresses) +
+                        EstimateHeapBytes(info.mTxtData);
+    }
+
+    for (const auto &entry : mHostCache)
+    {
+        const DiscoveredHostInfo &info = entry.second.mHostInfo;
+
+        usage.mBytes += EstimateHeapBytes(entry.second.mHostName) + EstimateHeapBytes(info.mHostName) +
+                        EstimateHeapBytes(info.mAddresses);
+    }
+
+    return usage;
+}
+
 void Publisher::PublishService(const std::string &aHostName,
                                const std::string &aName,
                                const std::string &aType,
@@ -57,62 +138,426 @@ void Publisher::PublishService(const std::string &aHostName,
                                const TxtData     &aTxtData,
                                ResultCallback   &&aCallback)
 {
-    otbrError error;
-
-    mServiceRegistrationBeginTime[std::make_pair(aName, aType)] = Clock::now();
+    ServiceRegistration *serviceReg = FindServiceRegistration(aName, aType);
+    std::string          key        = "s:" + MakeRegistrationKey(aName, aType);
 
-    error = PublishServiceImpl(aHostName, aName, aType, aSubTypeList, aPort, aTxtData, std::move(aCallback));
-    if (error != OTBR_ERROR_NONE)
+    // Re-publishing an unchanged service which has been published doesn't reach
+    // the mDNS backend at all, unless it is being changed by a queued request.
+    if (serviceReg != nullptr && serviceReg->IsCompleted() && mPendingPublishIndex.count(key) == 0 &&
+        serviceReg->mTxtDataHash == HashTxtData(aTxtData) &&
+        !serviceReg->IsOutdated(aHostName, aName, aType, SortSubTypeList(aSubTypeList), aPort, aTxtData))
     {
-        UpdateMdnsResponseCounters(mTelemetryInfo.mServiceRegistrations, error);
+        std::move(aCallback)(OTBR_ERROR_NONE);
+        ExitNow();
     }
+
+    mServiceRegistrationBeginTime[std::make_pair(aName, aType)] = CoarseClock::Now();
+    OTBR_TRACE_ASYNC_BEGIN("mdns.publish.service", Trace::MakeCookie(aName + "." + aType));
+
+    SchedulePublish(
+        std::move(key), IsPrioritizedServiceType(aType),
+        [this, aHostName, aName, aType, aSubTypeList, aPort, aTxtData](ResultCallback &&aResultCallback) {
+            otbrError error =
+                PublishServiceImpl(aHostName, aName, aType, aSubTypeList, aPort, aTxtData, std::move(aResultCallback));
+
+            if (error != OTBR_ERROR_NONE)
+            {
+                UpdateMdnsResponseCounters(kOperationServiceRegistration, error);
+            }
+
+            return error;
+        },
+        std::move(aCallback));
+
+exit:
+    return;
+}
+
+void Publisher::UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback)
+{
+    CancelPendingPublish("s:" + MakeRegistrationKey(aName, aType));
+    UnpublishServiceImpl(aName, aType, std::move(aCallback));
 }
 
 void Publisher::PublishHost(const std::string &aName, const AddressList &aAddresses, ResultCallback &&aCallback)
 {
-    otbrError error;
+    ClaimHost(aName);
+    mHostRegistrationBeginTime[aName] = CoarseClock::Now();
+    OTBR_TRACE_ASYNC_BEGIN("mdns.publish.host", Trace::MakeCookie(aName));
+
+    SchedulePublish(
+        "h:" + MakeRegistrationKey(aName), /* aIsPrioritized */ false,
+        [this, aName, aAddresses](ResultCallback &&aResultCallback) {
+            otbrError error = PublishHostImpl(aName, aAddresses, std::move(aResultCallback));
+
+            if (error != OTBR_ERROR_NONE)
+            {
+                UpdateMdnsResponseCounters(kOperationHostRegistration, error);
+            }
+
+            return error;
+        },
+        std::move(aCallback));
+}
+
+void Publisher::UnpublishHost(const std::string &aName, ResultCallback &&aCallback)
+{
+    ClaimHost(aName);
+    CancelPendingPublish("h:" + MakeRegistrationKey(aName));
+    UnpublishHostImpl(aName, std::move(aCallback));
+}
 
-    mHostRegistrationBeginTime[aName] = Clock::now();
+void Publisher::PublishHostAndServices(const std::string       &aHostName,
+                                       const AddressList       &aAddresses,
+                                       const HostedServiceList &aServices,
+                                       ResultCallback         &&aCallback)
+{
+    Timepoint now = CoarseClock::Now();
+
+    ClaimHost(aHostName);
+    mHostRegistrationBeginTime[aHostName] = now;
+    OTBR_TRACE_ASYNC_BEGIN("mdns.publish.host", Trace::MakeCookie(aHostName));
+    for (const HostedService &service : aServices)
+    {
+        mServiceRegistrationBeginTime[std::make_pair(service.mName, service.mType)] = now;
+        OTBR_TRACE_ASYNC_BEGIN("mdns.publish.service", Trace::MakeCookie(service.mName + "." + service.mType));
+    }
+
+    // A host published with its services replaces a queued request for the host alone, and vice versa.
+    SchedulePublish(
+        "h:" + MakeRegistrationKey(aHostName), /* aIsPrioritized */ false,
+        [this, aHostName, aAddresses, aServices](ResultCallback &&aResultCallback) {
+            otbrError error = PublishHostAndServicesImpl(aHostName, aAddresses, aServices, std::move(aResultCallback));
+
+            if (error != OTBR_ERROR_NONE)
+            {
+                UpdateMdnsResponseCounters(kOperationHostRegistration, error);
+            }
+
+            return error;
+        },
+        std::move(aCallback));
+}
+
+otbrError Publisher::PublishHostAndServicesImpl(const std::string       &aHostName,
+                                                const AddressList       &aAddresses,
+                                                const HostedServiceList &aServices,
+                                                ResultCallback         &&aCallback)
+{
+    otbrError                   error     = OTBR_ERROR_NONE;
+    std::vector<ResultCallback> callbacks = SplitResultCallback(std::move(aCallback), aServices.size() + 1);
+
+    SuccessOrExit(error = PublishHostImpl(aHostName, aAddresses, std::move(callbacks[0])));
+
+    for (size_t i = 0; i < aServices.size(); i++)
+    {
+        const HostedService &service = aServices[i];
+
+        SuccessOrExit(error = PublishServiceImpl(aHostName, service.mName, service.mType, service.mSubTypeList,
+                                                 service.mPort, service.mTxtData, std::move(callbacks[i + 1])));
+    }
+
+exit:
+    return error;
+}
+
+void Publisher::UnpublishHostAndServices(const std::string &aHostName, ResultCallback &&aCallback)
+{
+    std::vector<std::pair<std::string, std::string>> services;
+    std::vector<ResultCallback>                      callbacks;
+
+    for (const auto &kv : mServiceRegistrations)
+    {
+        if (kv.second->mHostName == aHostName)
+        {
+            services.emplace_back(kv.second->mName, kv.second->mType);
+        }
+    }
+
+    callbacks = SplitResultCallback(std::move(aCallback), services.size() + 1);
+
+    for (size_t i = 0; i < services.size(); i++)
+    {
+        UnpublishService(services[i].first, services[i].second, std::move(callbacks[i]));
+    }
+
+    UnpublishHost(aHostName, std::move(callbacks.back()));
+}
+
+Publisher::PublishedHostList Publisher::GetPublishedHosts(void) const
+{
+    PublishedHostList                                        hosts;
+    std::unordered_map<DnsNameKey, size_t, DnsNameKey::Hash> hostIndex;
 
-    error = PublishHostImpl(aName, aAddresses, std::move(aCallback));
-    if (error != OTBR_ERROR_NONE)
+    for (const auto &kv : mHostRegistrations)
     {
-        UpdateMdnsResponseCounters(mTelemetryInfo.mHostRegistrations, error);
+        PublishedHost host;
+
+        host.mName          = kv.second->mName;
+        host.mAddresses     = kv.second->mAddresses;
+        hostIndex[kv.first] = hosts.size();
+        hosts.push_back(std::move(host));
     }
+
+    for (const auto &kv : mServiceRegistrations)
+    {
+        const ServiceRegistration &serviceReg = *kv.second;
+        HostedService              service;
+
+        if (serviceReg.mHostName.empty())
+        {
+            continue;
+        }
+
+        auto it = hostIndex.find(DnsNameKey::Find(serviceReg.mHostName));
+
+        if (it == hostIndex.end())
+        {
+            continue;
+        }
+
+        service.mName        = serviceReg.mName;
+        service.mType        = serviceReg.mType;
+        service.mSubTypeList = serviceReg.mSubTypeList;
+        service.mPort        = serviceReg.mPort;
+        service.mTxtData     = serviceReg.mTxtData;
+        hosts[it->second].mServices.push_back(std::move(service));
+    }
+
+    return hosts;
+}
+
+void Publisher::AdoptHosts(const PublishedHostList &aHosts, Milliseconds aLease)
+{
+    VerifyOrExit(!aHosts.empty());
+
+    for (const PublishedHost &host : aHosts)
+    {
+        std::string name = host.mName;
+
+        PublishHostAndServices(name, host.mAddresses, host.mServices, [name](otbrError aError) {
+            otbrLogResult(aError, "Publish adopted host %s", name.c_str());
+        });
+        mAdoptedHosts[DnsNameKey::Intern(name)] = name;
+    }
+
+    otbrLogInfo("Adopted %zu hosts, waiting %" PRId64 " ms for them to be claimed", aHosts.size(),
+                static_cast<int64_t>(aLease.count()));
+    mTaskRunner.Post(aLease, [this]() { UnpublishUnclaimedHosts(); });
+
+exit:
+    return;
+}
+
+void Publisher::UnpublishUnclaimedHosts(void)
+{
+    std::vector<std::string> names;
+
+    for (const auto &kv : mAdoptedHosts)
+    {
+        names.push_back(kv.second);
+    }
+
+    for (const std::string &name : names)
+    {
+        otbrLogInfo("Adopted host %s has not been claimed, un-publishing it", name.c_str());
+        UnpublishHostAndServices(name, [](otbrError) {});
+    }
+
+    mAdoptedHosts.clear();
 }
 
 void Publisher::PublishKey(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback)
 {
-    otbrError error;
+    mKeyRegistrationBeginTime[aName] = CoarseClock::Now();
+    OTBR_TRACE_ASYNC_BEGIN("mdns.publish.key", Trace::MakeCookie(aName));
+
+    SchedulePublish(
+        "k:" + MakeRegistrationKey(aName), /* aIsPrioritized */ false,
+        [this, aName, aKeyData](ResultCallback &&aResultCallback) {
+            otbrError error = PublishKeyImpl(aName, aKeyData, std::move(aResultCallback));
+
+            if (error != OTBR_ERROR_NONE)
+            {
+                UpdateMdnsResponseCounters(kOperationKeyRegistration, error);
+            }
+
+            return error;
+        },
+        std::move(aCallback));
+}
+
+void Publisher::UnpublishKey(const std::string &aName, ResultCallback &&aCallback)
+{
+    CancelPendingPublish("k:" + MakeRegistrationKey(aName));
+    UnpublishKeyImpl(aName, std::move(aCallback));
+}
+
+bool Publisher::IsPrioritizedServiceType(const std::string &aType)
+{
+    // The meshcop and TREL services are what Thread devices and commissioners look for first.
+    return StringUtils::EqualCaseInsensitive(aType, "_meshcop._udp") ||
+           StringUtils::EqualCaseInsensitive(aType, "_meshcop-e._udp") ||
+           StringUtils::EqualCaseInsensitive(aType, "_trel._udp");
+}
+
+void Publisher::SchedulePublish(std::string      aKey,
+                                bool             aIsPrioritized,
+                                PublishTask    &&aPublish,
+                                ResultCallback &&aCallback)
+{
+    auto it = mPendingPublishIndex.find(aKey);
+
+    if (it != mPendingPublishIndex.end())
+    {
+        PendingPublish &pending  = *it->second;
+        ResultCallback  callback = std::move(pending.mCallback);
+
+        otbrLogInfo("Replacing queued publishing of %s", aKey.c_str());
+
+        pending.mPublish  = std::move(aPublish);
+        pending.mCallback = std::move(aCallback);
+        std::move(callback)(OTBR_ERROR_ABORTED);
+    }
+    else
+    {
+        PendingPublishList &list = aIsPrioritized ? mPrioritizedPublishes : mPendingPublishes;
+
+        list.emplace_back();
+        list.back().mKey           = aKey;
+        list.back().mIsPrioritized = aIsPrioritized;
+        list.back().mPublish       = std::move(aPublish);
+        list.back().mCallback      = std::move(aCallback);
+        mPendingPublishIndex.emplace(std::move(aKey), std::prev(list.end()));
 
-    mKeyRegistrationBeginTime[aName] = Clock::now();
+        ProcessPublishQueue();
+    }
+}
+
+void Publisher::CancelPendingPublish(const std::string &aKey)
+{
+    auto           it = mPendingPublishIndex.find(aKey);
+    ResultCallback callback(nullptr);
+
+    VerifyOrExit(it != mPendingPublishIndex.end());
+
+    callback = std::move(it->second->mCallback);
+    (it->second->mIsPrioritized ? mPrioritizedPublishes : mPendingPublishes).erase(it->second);
+    mPendingPublishIndex.erase(it);
+
+    std::move(callback)(OTBR_ERROR_ABORTED);
+
+exit:
+    return;
+}
+
+void Publisher::ProcessPublishQueue(void)
+{
+    // Publishing may invoke callbacks which publish again, the outer call keeps on
+    // processing the queue.
+    VerifyOrExit(!mIsProcessingPublishQueue);
+    mIsProcessingPublishQueue = true;
 
-    error = PublishKeyImpl(aName, aKeyData, std::move(aCallback));
-    if (error != OTBR_ERROR_NONE)
+    while (!mPrioritizedPublishes.empty() || !mPendingPublishes.empty())
     {
-        UpdateMdnsResponseCounters(mTelemetryInfo.mKeyRegistrations, error);
+        PendingPublishList &list = !mPrioritizedPublishes.empty() ? mPrioritizedPublishes : mPendingPublishes;
+        PendingPublish      pending;
+
+        RefillPublishTokens();
+
+        if (mPublishTokens == 0)
+        {
+            if (!mIsPublishTaskPosted)
+            {
+                Milliseconds elapsed = std::chrono::duration_cast<Milliseconds>(Clock::now() - mPublishTokenRefillTime);
+
+                mIsPublishTaskPosted = true;
+                mTaskRunner.Post(Milliseconds(kPublishTokenIntervalMs) - elapsed, [this]() {
+                    mIsPublishTaskPosted = false;
+                    ProcessPublishQueue();
+                });
+            }
+
+            break;
+        }
+
+        pending = std::move(list.front());
+        list.pop_front();
+        mPendingPublishIndex.erase(pending.mKey);
+
+        // A request which fails right away (e.g. while the publisher isn't ready) doesn't
+        // reach the mDNS daemon and so doesn't cost a token.
+        if (pending.mPublish(std::move(pending.mCallback)) == OTBR_ERROR_NONE)
+        {
+            mPublishTokens--;
+        }
+    }
+
+    mIsProcessingPublishQueue = false;
+
+exit:
+    return;
+}
+
+void Publisher::RefillPublishTokens(void)
+{
+    Timepoint now    = Clock::now();
+    uint64_t  tokens = static_cast<uint64_t>(
+        std::chrono::duration_cast<Milliseconds>(now - mPublishTokenRefillTime).count() / kPublishTokenIntervalMs);
+
+    if (mPublishTokens + tokens >= kPublishTokenBucketSize)
+    {
+        mPublishTokens          = kPublishTokenBucketSize;
+        mPublishTokenRefillTime = now;
+    }
+    else
+    {
+        mPublishTokens += static_cast<uint32_t>(tokens);
+        mPublishTokenRefillTime += Milliseconds(tokens * kPublishTokenIntervalMs);
     }
 }
 
 void Publisher::OnServiceResolveFailed(std::string aType, std::string aInstanceName, int32_t aErrorCode)
 {
-    UpdateMdnsResponseCounters(mTelemetryInfo.mServiceResolutions, DnsErrorToOtbrError(aErrorCode));
+    UpdateMdnsResponseCounters(kOperationServiceResolution, DnsErrorToOtbrError(aErrorCode));
     UpdateServiceInstanceResolutionEmaLatency(aInstanceName, aType, DnsErrorToOtbrError(aErrorCode));
     OnServiceResolveFailedImpl(aType, aInstanceName, aErrorCode);
 }
 
 void Publisher::OnHostResolveFailed(std::string aHostName, int32_t aErrorCode)
 {
-    UpdateMdnsResponseCounters(mTelemetryInfo.mHostResolutions, DnsErrorToOtbrError(aErrorCode));
+    UpdateMdnsResponseCounters(kOperationHostResolution, DnsErrorToOtbrError(aErrorCode));
     UpdateHostResolutionEmaLatency(aHostName, DnsErrorToOtbrError(aErrorCode));
     OnHostResolveFailedImpl(aHostName, aErrorCode);
 }
 
 otbrError Publisher::EncodeTxtData(const TxtList &aTxtList, std::vector<uint8_t> &aTxtData)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    otbrError error;
+    size_t    length = 0;
+
+    for (const TxtEntry &txtEntry : aTxtList)
+    {
+        length += sizeof(uint8_t) + txtEntry.mKey.length();
 
-    aTxtData.clear();
+        if (!txtEntry.mIsBooleanAttribute)
+        {
+            length += txtEntry.mValue.size() + sizeof(uint8_t); // for `=` char.
+        }
+    }
+
+    aTxtData.resize(std::max(length, sizeof(uint8_t)));
+    error = EncodeTxtData(aTxtList, aTxtData.data(), aTxtData.size(), length);
+    aTxtData.resize(error == OTBR_ERROR_NONE ? length : 0);
+
+    return error;
+}
+
+otbrError Publisher::EncodeTxtData(const TxtList &aTxtList, uint8_t *aBuffer, size_t aBufferSize, size_t &aLength)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    uint8_t  *cur   = aBuffer;
+    uint8_t  *end   = aBuffer + aBufferSize;
 
     for (const TxtEntry &txtEntry : aTxtList)
     {
@@ -124,107 +569,452 @@ otbrError Publisher::EncodeTxtData(const TxtList &aTxtList, std::vector<uint8_t>
         }
 
         VerifyOrExit(entryLength <= kMaxTextEntrySize, error = OTBR_ERROR_INVALID_ARGS);
+        VerifyOrExit(entryLength < static_cast<size_t>(end - cur), error = OTBR_ERROR_INVALID_ARGS);
 
-        aTxtData.push_back(static_cast<uint8_t>(entryLength));
-        aTxtData.insert(aTxtData.end(), txtEntry.mKey.begin(), txtEntry.mKey.end());
+        *cur++ = static_cast<uint8_t>(entryLength);
+        cur    = std::copy(txtEntry.mKey.begin(), txtEntry.mKey.end(), cur);
 
         if (!txtEntry.mIsBooleanAttribute)
         {
-            aTxtData.push_back('=');
-            aTxtData.insert(aTxtData.end(), txtEntry.mValue.begin(), txtEntry.mValue.end());
+            *cur++ = '=';
+            cur    = std::copy(txtEntry.mValue.begin(), txtEntry.mValue.end(), cur);
         }
     }
 
-    if (aTxtData.empty())
+    if (cur == aBuffer)
     {
-        aTxtData.push_back(0);
+        // An empty TXT data is represented by a single empty string.
+        VerifyOrExit(cur != end, error = OTBR_ERROR_INVALID_ARGS);
+        *cur++ = 0;
     }
 
+    aLength = static_cast<size_t>(cur - aBuffer);
+
 exit:
     return error;
 }
 
 otbrError Publisher::DecodeTxtData(Publisher::TxtList &aTxtList, const uint8_t *aTxtData, uint16_t aTxtLength)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    TxtReader        reader(aTxtData, aTxtLength);
+    TxtReader::Entry entry;
+    otbrError        error;
 
     aTxtList.clear();
 
-    for (uint16_t r = 0; r < aTxtLength;)
+    while ((error = reader.ReadNext(entry)) == OTBR_ERROR_NONE)
     {
-        uint16_t entrySize = aTxtData[r];
-        uint16_t keyStart  = r + 1;
-        uint16_t entryEnd  = keyStart + entrySize;
-        uint16_t keyEnd    = keyStart;
+        if (entry.mIsBooleanAttribute)
+        {
+            aTxtList.emplace_back(entry.mKey.Data(), entry.mKey.Size());
+        }
+        else
+        {
+            aTxtList.emplace_back(entry.mKey.Data(), entry.mKey.Size(), entry.mValue, entry.mValueLength);
+        }
+    }
 
-        VerifyOrExit(entryEnd <= aTxtLength, error = OTBR_ERROR_PARSE);
+    if (error == OTBR_ERROR_NOT_FOUND)
+    {
+        error = OTBR_ERROR_NONE;
+    }
+
+    return error;
+}
+
+void Publisher::RemoveSubscriptionCallbacks(uint64_t aSubscriberId)
+{
+    auto it = mDiscoverCallbacks.find(aSubscriberId);
+
+    VerifyOrExit(it != mDiscoverCallbacks.end());
+
+    if (it->second.mServiceCallback != nullptr)
+    {
+        RemoveFromDiscoverCallbackIndex(mServiceCallbackIndex, it->second.mServiceTypeKey, aSubscriberId);
+    }
+    if (it->second.mHostCallback != nullptr)
+    {
+        RemoveFromDiscoverCallbackIndex(mHostCallbackIndex, it->second.mHostNameKey, aSubscriberId);
+    }
+    mDiscoverCallbacks.erase(it);
+
+exit:
+    return;
+}
+
+uint64_t Publisher::AddSubscriptionCallbacks(Publisher::DiscoveredServiceInstanceCallback aInstanceCallback,
+                                             Publisher::DiscoveredHostCallback            aHostCallback,
+                                             const std::string                           &aServiceType,
+                                             const std::string                           &aHostName)
+{
+    uint64_t          id       = mNextSubscriberId++;
+    DiscoverCallback &callback = mDiscoverCallbacks[id];
+
+    assert(id > 0);
 
-        while (keyEnd < entryEnd && aTxtData[keyEnd] != '=')
+    callback.mServiceCallback = std::move(aInstanceCallback);
+    callback.mHostCallback    = std::move(aHostCallback);
+    callback.mServiceTypeKey  = MakeRegistrationKey(aServiceType);
+    callback.mHostNameKey     = MakeRegistrationKey(aHostName);
+
+    if (callback.mServiceCallback != nullptr)
+    {
+        AddToDiscoverCallbackIndex(mServiceCallbackIndex, callback.mServiceTypeKey, id);
+    }
+    if (callback.mHostCallback != nullptr)
+    {
+        AddToDiscoverCallbackIndex(mHostCallbackIndex, callback.mHostNameKey, id);
+    }
+
+    return id;
+}
+
+void Publisher::AddToDiscoverCallbackIndex(DiscoverCallbackIndex &aIndex, const std::string &aKey, uint64_t aId)
+{
+    // The IDs are increasing, so appending keeps the subscribers in the order they were added.
+    aIndex[aKey].push_back(aId);
+}
+
+void Publisher::RemoveFromDiscoverCallbackIndex(DiscoverCallbackIndex &aIndex, const std::string &aKey, uint64_t aId)
+{
+    auto it = aIndex.find(aKey);
+
+    VerifyOrExit(it != aIndex.end());
+
+    it->second.erase(std::remove(it->second.begin(), it->second.end(), aId), it->second.end());
+    if (it->second.empty())
+    {
+        aIndex.erase(it);
+    }
+
+exit:
+    return;
+}
+
+std::vector<uint64_t> Publisher::FindDiscoverCallbacks(const DiscoverCallbackIndex &aIndex, const std::string &aName)
+{
+    static const std::vector<uint64_t> kNoIds;
+
+    auto                         anyIt   = aIndex.find("");
+    auto                         nameIt  = aIndex.find(MakeRegistrationKey(aName));
+    const std::vector<uint64_t> &anyIds  = (anyIt != aIndex.end()) ? anyIt->second : kNoIds;
+    const std::vector<uint64_t> &nameIds = (nameIt != aIndex.end()) ? nameIt->second : kNoIds;
+    std::vector<uint64_t>        ids(anyIds.size() + nameIds.size());
+
+    std::merge(anyIds.begin(), anyIds.end(), nameIds.begin(), nameIds.end(), ids.begin());
+
+    return ids;
+}
+
+void Publisher::SubscribeService(const std::string &aType, const std::string &aInstanceName)
+{
+    ServiceSubscriptionEntry *browse = aInstanceName.empty() ? nullptr : FindServiceSubscription(aType, "");
+    ServiceSubscriptionEntry *entry  = FindServiceSubscription(aType, aInstanceName);
+
+    if (entry != nullptr)
+    {
+        entry->mRefCount++;
+        otbrLogInfo("Subscribe service %s.%s (references %" PRIu32 ")", aInstanceName.c_str(), aType.c_str(),
+                    entry->mRefCount);
+    }
+    else
+    {
+        ServiceSubscriptionEntry newEntry;
+
+        newEntry.mType         = aType;
+        newEntry.mInstanceName = aInstanceName;
+        newEntry.mRefCount     = 1;
+        newEntry.mIsActive     = (browse == nullptr);
+
+        // A service instance is resolved by the browse of its service as well.
+        if (newEntry.mIsActive)
         {
-            keyEnd++;
+            SuccessOrExit(SubscribeServiceImpl(aType, aInstanceName));
         }
 
-        if (keyEnd == entryEnd)
+        mServiceSubscriptions.emplace(MakeRegistrationKey(aInstanceName, aType), std::move(newEntry));
+
+        if (aInstanceName.empty())
         {
-            if (keyEnd > keyStart)
-            {
-                // No `=`, treat as a boolean attribute.
-                aTxtList.emplace_back(reinterpret_cast<const char *>(&aTxtData[keyStart]), keyEnd - keyStart);
-            }
+            UpdateCoveredServiceSubscriptions(aType, /* aIsBrowsing */ true);
+        }
+    }
+
+    mTaskRunner.Post([this, aType, aInstanceName](void) { AnswerServiceSubscriptionFromCache(aType, aInstanceName); });
+
+exit:
+    return;
+}
+
+void Publisher::UnsubscribeService(const std::string &aType, const std::string &aInstanceName)
+{
+    ServiceSubscriptionEntry *entry = FindServiceSubscription(aType, aInstanceName);
+
+    VerifyOrExit(entry != nullptr);
+    VerifyOrExit(--entry->mRefCount == 0);
+
+    // The implementation knows the subscription by the names it was subscribed with.
+    if (entry->mIsActive)
+    {
+        UnsubscribeServiceImpl(entry->mType, entry->mInstanceName);
+    }
+
+    mServiceSubscriptions.erase(MakeRegistrationKey(aInstanceName, aType));
+
+    if (aInstanceName.empty())
+    {
+        UpdateCoveredServiceSubscriptions(aType, /* aIsBrowsing */ false);
+    }
+
+exit:
+    return;
+}
+
+void Publisher::SubscribeHost(const std::string &aHostName)
+{
+    auto it = mHostSubscriptions.find(MakeRegistrationKey(aHostName));
+
+    if (it != mHostSubscriptions.end())
+    {
+        it->second.mRefCount++;
+        otbrLogInfo("Subscribe host %s (references %" PRIu32 ")", aHostName.c_str(), it->second.mRefCount);
+    }
+    else
+    {
+        HostSubscriptionEntry newEntry;
+
+        SuccessOrExit(SubscribeHostImpl(aHostName));
+
+        newEntry.mHostName = aHostName;
+        newEntry.mRefCount = 1;
+        mHostSubscriptions.emplace(MakeRegistrationKey(aHostName), std::move(newEntry));
+    }
+
+    mTaskRunner.Post([this, aHostName](void) { AnswerHostSubscriptionFromCache(aHostName); });
+
+exit:
+    return;
+}
+
+void Publisher::UnsubscribeHost(const std::string &aHostName)
+{
+    auto it = mHostSubscriptions.find(MakeRegistrationKey(aHostName));
+
+    VerifyOrExit(it != mHostSubscriptions.end());
+    VerifyOrExit(--it->second.mRefCount == 0);
+
+    UnsubscribeHostImpl(it->second.mHostName);
+    mHostSubscriptions.erase(it);
+
+exit:
+    return;
+}
+
+void Publisher::ClearDiscoveryCache(void)
+{
+    mServiceSubscriptions.clear();
+    mHostSubscriptions.clear();
+    mInstanceCache.clear();
+    mHostCache.clear();
+}
+
+Publisher::ServiceSubscriptionEntry *Publisher::FindServiceSubscription(const std::string &aType,
+                                                                        const std::string &aInstanceName)
+{
+    auto it = mServiceSubscriptions.find(MakeRegistrationKey(aInstanceName, aType));
+
+    return (it == mServiceSubscriptions.end()) ? nullptr : &it->second;
+}
+
+void Publisher::UpdateCoveredServiceSubscriptions(const std::string &aType, bool aIsBrowsing)
+{
+    // While a service is browsed, the subscribed instances of the service are not
+    // resolved on their own. They are resolved again once the browse is stopped.
+    for (auto it = mServiceSubscriptions.begin(); it != mServiceSubscriptions.end();)
+    {
+        ServiceSubscriptionEntry &entry = it->second;
+
+        if (entry.mInstanceName.empty() || entry.mIsActive != aIsBrowsing ||
+            !StringUtils::EqualCaseInsensitive(entry.mType, aType))
+        {
+            ++it;
+        }
+        else if (aIsBrowsing)
+        {
+            UnsubscribeServiceImpl(entry.mType, entry.mInstanceName);
+            entry.mIsActive = false;
+            ++it;
+        }
+        else if (SubscribeServiceImpl(entry.mType, entry.mInstanceName) == OTBR_ERROR_NONE)
+        {
+            entry.mIsActive = true;
+            ++it;
         }
         else
         {
-            uint16_t valStart = keyEnd + 1; // To skip over `=`
+            it = mServiceSubscriptions.erase(it);
+        }
+    }
+}
+
+void Publisher::AnswerServiceSubscriptionFromCache(const std::string &aType, const std::string &aInstanceName)
+{
+    std::vector<CachedInstance> answers;
+
+    // The subscription may have been removed before the answer is due.
+    VerifyOrExit(FindServiceSubscription(aType, aInstanceName) != nullptr);
+
+    EvictExpiredCache();
+
+    if (aInstanceName.empty())
+    {
+        for (const auto &kv : mInstanceCache)
+        {
+            const CachedInstance &cached = kv.second;
+
+            if (StringUtils::EqualCaseInsensitive(cached.mType, aType) &&
+                IsCacheFresh(cached.mReceivedTime, cached.mInstanceInfo.mTtl))
+            {
+                answers.push_back(cached);
+            }
+        }
+    }
+    else
+    {
+        auto it = mInstanceCache.find(MakeRegistrationKey(aInstanceName, aType));
 
-            aTxtList.emplace_back(reinterpret_cast<const char *>(&aTxtData[keyStart]), keyEnd - keyStart,
-                                  &aTxtData[valStart], entryEnd - valStart);
+        if (it != mInstanceCache.end() && IsCacheFresh(it->second.mReceivedTime, it->second.mInstanceInfo.mTtl))
+        {
+            answers.push_back(it->second);
         }
+    }
 
-        r += entrySize + 1;
+    for (const CachedInstance &cached : answers)
+    {
+        otbrLogInfo("Service %s.%s is answered from cache", cached.mInstanceInfo.mName.c_str(), cached.mType.c_str());
+        NotifyServiceInstanceDiscovered(cached.mType, cached.mInstanceInfo);
     }
 
 exit:
-    return error;
+    return;
 }
 
-void Publisher::RemoveSubscriptionCallbacks(uint64_t aSubscriberId)
+void Publisher::AnswerHostSubscriptionFromCache(const std::string &aHostName)
 {
-    mDiscoverCallbacks.remove_if(
-        [aSubscriberId](const DiscoverCallback &aCallback) { return (aCallback.mId == aSubscriberId); });
+    std::unordered_map<std::string, CachedHost>::const_iterator it;
+    CachedHost                                                  answer;
+
+    VerifyOrExit(mHostSubscriptions.find(MakeRegistrationKey(aHostName)) != mHostSubscriptions.end());
+
+    EvictExpiredCache();
+
+    it = mHostCache.find(MakeRegistrationKey(aHostName));
+    VerifyOrExit(it != mHostCache.end() && IsCacheFresh(it->second.mReceivedTime, it->second.mHostInfo.mTtl));
+
+    // Copy since the callbacks are free to update the cache.
+    answer = it->second;
+    otbrLogInfo("Host %s is answered from cache", answer.mHostName.c_str());
+    NotifyHostDiscovered(answer.mHostName, answer.mHostInfo);
+
+exit:
+    return;
 }
 
-uint64_t Publisher::AddSubscriptionCallbacks(Publisher::DiscoveredServiceInstanceCallback aInstanceCallback,
-                                             Publisher::DiscoveredHostCallback            aHostCallback)
+void Publisher::UpdateInstanceCache(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo)
 {
-    uint64_t id = mNextSubscriberId++;
+    const std::string &key = MakeRegistrationKey(aInstanceInfo.mName, aType);
 
-    assert(id > 0);
-    mDiscoverCallbacks.emplace_back(id, aInstanceCallback, aHostCallback);
+    if (aInstanceInfo.mRemoved)
+    {
+        mInstanceCache.erase(key);
+    }
+    else
+    {
+        CachedInstance &cached = mInstanceCache[key];
 
-    return id;
+        cached.mType         = aType;
+        cached.mInstanceInfo = aInstanceInfo;
+        cached.mReceivedTime = CoarseClock::Now();
+    }
 }
 
-void Publisher::OnServiceResolved(std::string aType, DiscoveredInstanceInfo aInstanceInfo)
+void Publisher::UpdateHostCache(const std::string &aHostName, const DiscoveredHostInfo &aHostInfo)
+{
+    const std::string &key = MakeRegistrationKey(aHostName);
+
+    if (aHostInfo.mAddresses.empty())
+    {
+        mHostCache.erase(key);
+    }
+    else
+    {
+        CachedHost &cached = mHostCache[key];
+
+        cached.mHostName     = aHostName;
+        cached.mHostInfo     = aHostInfo;
+        cached.mReceivedTime = CoarseClock::Now();
+    }
+}
+
+void Publisher::EvictExpiredCache(void)
+{
+    for (auto it = mInstanceCache.begin(); it != mInstanceCache.end();)
+    {
+        if (IsCacheExpired(it->second.mReceivedTime, it->second.mInstanceInfo.mTtl))
+        {
+            it = mInstanceCache.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    for (auto it = mHostCache.begin(); it != mHostCache.end();)
+    {
+        if (IsCacheExpired(it->second.mReceivedTime, it->second.mHostInfo.mTtl))
+        {
+            it = mHostCache.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+bool Publisher::IsCacheFresh(Timepoint aReceivedTime, uint32_t aTtl)
+{
+    Milliseconds freshTime = Milliseconds(static_cast<uint64_t>(aTtl) * 1000 * kCacheFreshPercentage / 100);
+
+    return CoarseClock::Now() < aReceivedTime + freshTime;
+}
+
+bool Publisher::IsCacheExpired(Timepoint aReceivedTime, uint32_t aTtl)
 {
-    bool checkToInvoke = false;
+    return CoarseClock::Now() >= aReceivedTime + Seconds(aTtl);
+}
 
+void Publisher::OnServiceResolved(std::string aType, DiscoveredInstanceInfo aInstanceInfo)
+{
     otbrLogInfo("Service %s is resolved successfully: %s %s host %s addresses %zu", aType.c_str(),
                 aInstanceInfo.mRemoved ? "remove" : "add", aInstanceInfo.mName.c_str(), aInstanceInfo.mHostName.c_str(),
                 aInstanceInfo.mAddresses.size());
 
-    if (!aInstanceInfo.mRemoved)
+    if (!aInstanceInfo.mRemoved && otbrLogIsEnabled(OTBR_LOG_DEBUG))
     {
         std::string addressesString;
 
         for (const auto &address : aInstanceInfo.mAddresses)
         {
-            addressesString += address.ToString() + ",";
+            address.AppendTo(addressesString);
+            addressesString += ',';
         }
         if (addressesString.size())
         {
             addressesString.pop_back();
         }
-        otbrLogInfo("addresses: [ %s ]", addressesString.c_str());
+        otbrLogDebug("addresses: [ %s ]", addressesString.c_str());
     }
 
     DnsUtils::CheckServiceNameSanity(aType);
@@ -236,37 +1026,25 @@ void Publisher::OnServiceResolved(std::string aType, DiscoveredInstanceInfo aIns
         DnsUtils::CheckHostnameSanity(aInstanceInfo.mHostName);
     }
 
-    UpdateMdnsResponseCounters(mTelemetryInfo.mServiceResolutions, OTBR_ERROR_NONE);
+    UpdateMdnsResponseCounters(kOperationServiceResolution, OTBR_ERROR_NONE);
     UpdateServiceInstanceResolutionEmaLatency(aInstanceInfo.mName, aType, OTBR_ERROR_NONE);
 
-    // The `mDiscoverCallbacks` list can get updated as the callbacks
-    // are invoked. We first mark `mShouldInvoke` on all non-null
-    // service callbacks. We clear it before invoking the callback
-    // and restart the iteration over the `mDiscoverCallbacks` list
-    // to find the next one to signal, since the list may have changed.
-
-    for (DiscoverCallback &callback : mDiscoverCallbacks)
-    {
-        if (callback.mServiceCallback != nullptr)
-        {
-            callback.mShouldInvoke = true;
-            checkToInvoke          = true;
-        }
-    }
+    UpdateInstanceCache(aType, aInstanceInfo);
+    NotifyServiceInstanceDiscovered(aType, aInstanceInfo);
+}
 
-    while (checkToInvoke)
+void Publisher::NotifyServiceInstanceDiscovered(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo)
+{
+    // The callbacks can be added and removed as the callbacks are invoked, so the
+    // interested subscribers are collected first, and each is looked up again before
+    // it's invoked. A subscriber added meanwhile isn't invoked for this discovery.
+    for (uint64_t id : FindDiscoverCallbacks(mServiceCallbackIndex, aType))
     {
-        checkToInvoke = false;
+        auto it = mDiscoverCallbacks.find(id);
 
-        for (DiscoverCallback &callback : mDiscoverCallbacks)
+        if (it != mDiscoverCallbacks.end())
         {
-            if (callback.mShouldInvoke)
-            {
-                callback.mShouldInvoke = false;
-                checkToInvoke          = true;
-                callback.mServiceCallback(aType, aInstanceInfo);
-                break;
-            }
+            it->second.mServiceCallback(aType, aInstanceInfo);
         }
     }
 }
@@ -279,15 +1057,13 @@ void Publisher::OnServiceRemoved(uint32_t aNetifIndex, std::string aType, std::s
 
     instanceInfo.mRemoved    = true;
     instanceInfo.mNetifIndex = aNetifIndex;
-    instanceInfo.mName       = aInstanceName;
+    instanceInfo.mName       = std::move(aInstanceName);
 
-    OnServiceResolved(aType, instanceInfo);
+    OnServiceResolved(std::move(aType), std::move(instanceInfo));
 }
 
 void Publisher::OnHostResolved(std::string aHostName, Publisher::DiscoveredHostInfo aHostInfo)
 {
-    bool checkToInvoke = false;
-
     otbrLogInfo("Host %s is resolved successfully: host %s addresses %zu ttl %u", aHostName.c_str(),
                 aHostInfo.mHostName.c_str(), aHostInfo.mAddresses.size(), aHostInfo.mTtl);
 
@@ -296,39 +1072,64 @@ void Publisher::OnHostResolved(std::string aHostName, Publisher::DiscoveredHostI
         DnsUtils::CheckHostnameSanity(aHostInfo.mHostName);
     }
 
-    UpdateMdnsResponseCounters(mTelemetryInfo.mHostResolutions, OTBR_ERROR_NONE);
+    UpdateMdnsResponseCounters(kOperationHostResolution, OTBR_ERROR_NONE);
     UpdateHostResolutionEmaLatency(aHostName, OTBR_ERROR_NONE);
 
-    // The `mDiscoverCallbacks` list can get updated as the callbacks
-    // are invoked. We first mark `mShouldInvoke` on all non-null
-    // host callbacks. We clear it before invoking the callback
-    // and restart the iteration over the `mDiscoverCallbacks` list
-    // to find the next one to signal, since the list may have changed.
+    UpdateHostCache(aHostName, aHostInfo);
+    NotifyHostDiscovered(aHostName, aHostInfo);
+}
 
-    for (DiscoverCallback &callback : mDiscoverCallbacks)
+void Publisher::NotifyHostDiscovered(const std::string &aHostName, const DiscoveredHostInfo &aHostInfo)
+{
+    // See `NotifyServiceInstanceDiscovered` for why the subscribers are collected first.
+    for (uint64_t id : FindDiscoverCallbacks(mHostCallbackIndex, aHostName))
     {
-        if (callback.mHostCallback != nullptr)
+        auto it = mDiscoverCallbacks.find(id);
+
+        if (it != mDiscoverCallbacks.end())
         {
-            callback.mShouldInvoke = true;
-            checkToInvoke          = true;
+            it->second.mHostCallback(aHostName, aHostInfo);
         }
     }
+}
 
-    while (checkToInvoke)
+std::vector<Publisher::ResultCallback> Publisher::SplitResultCallback(ResultCallback &&aCallback, size_t aCount)
+{
+    struct SharedResult
     {
-        checkToInvoke = false;
+        ResultCallback mCallback;
+        size_t         mPendingCount;
+    };
 
-        for (DiscoverCallback &callback : mDiscoverCallbacks)
-        {
-            if (callback.mShouldInvoke)
+    std::shared_ptr<SharedResult> result(new SharedResult{std::move(aCallback), aCount});
+    std::vector<ResultCallback>   callbacks;
+
+    callbacks.reserve(aCount);
+
+    for (size_t i = 0; i < aCount; i++)
+    {
+        callbacks.emplace_back([result](otbrError aError) {
+            // The result has already been reported if an earlier callback failed.
+            if (!result->mCallback.IsNull() && (aError != OTBR_ERROR_NONE || --result->mPendingCount == 0))
             {
-                callback.mShouldInvoke = false;
-                checkToInvoke          = true;
-                callback.mHostCallback(aHostName, aHostInfo);
-                break;
+                std::move(result->mCallback)(aError);
             }
-        }
+        });
+    }
+
+    return callbacks;
+}
+
+uint32_t Publisher::HashTxtData(const TxtData &aTxtData)
+{
+    uint32_t hash = 2166136261u;
+
+    for (uint8_t byte : aTxtData)
+    {
+        hash = (hash ^ byte) * 16777619u;
     }
+
+    return hash;
 }
 
 Publisher::SubTypeList Publisher::SortSubTypeList(SubTypeList aSubTypeList)
@@ -353,14 +1154,42 @@ std::string Publisher::MakeFullName(const std::string &aName)
     return aName + ".local";
 }
 
+static void AppendLowercase(std::string &aString, const std::string &aName)
+{
+    for (char c : aName)
+    {
+        aString.push_back(static_cast<char>(tolower(static_cast<unsigned char>(c))));
+    }
+}
+
+const std::string &Publisher::MakeRegistrationKey(const std::string &aName)
+{
+    mRegistrationKey.clear();
+    AppendLowercase(mRegistrationKey, aName);
+
+    return mRegistrationKey;
+}
+
+const std::string &Publisher::MakeRegistrationKey(const std::string &aName, const std::string &aType)
+{
+    mRegistrationKey.clear();
+    AppendLowercase(mRegistrationKey, aName);
+    mRegistrationKey.push_back('.');
+    AppendLowercase(mRegistrationKey, aType);
+
+    return mRegistrationKey;
+}
+
 void Publisher::AddServiceRegistration(ServiceRegistrationPtr &&aServiceReg)
 {
-    mServiceRegistrations.emplace(MakeFullServiceName(aServiceReg->mName, aServiceReg->mType), std::move(aServiceReg));
+    DnsNameKey key = DnsNameKey::Intern(aServiceReg->mName, aServiceReg->mType);
+
+    mServiceRegistrations.emplace(std::move(key), std::move(aServiceReg));
 }
 
 void Publisher::RemoveServiceRegistration(const std::string &aName, const std::string &aType, otbrError aError)
 {
-    auto                   it = mServiceRegistrations.find(MakeFullServiceName(aName, aType));
+    auto                   it = mServiceRegistrations.find(DnsNameKey::Find(aName, aType));
     ServiceRegistrationPtr serviceReg;
 
     otbrLogInfo("Removing service %s.%s", aName.c_str(), aType.c_str());
@@ -379,14 +1208,14 @@ exit:
 
 Publisher::ServiceRegistration *Publisher::FindServiceRegistration(const std::string &aName, const std::string &aType)
 {
-    auto it = mServiceRegistrations.find(MakeFullServiceName(aName, aType));
+    auto it = mServiceRegistrations.find(DnsNameKey::Find(aName, aType));
 
     return it != mServiceRegistrations.end() ? it->second.get() : nullptr;
 }
 
 Publisher::ServiceRegistration *Publisher::FindServiceRegistration(const std::string &aNameAndType)
 {
-    auto it = mServiceRegistrations.find(MakeFullName(aNameAndType));
+    auto it = mServiceRegistrations.find(DnsNameKey::Find(aNameAndType));
 
     return it != mServiceRegistrations.end() ? it->second.get() : nullptr;
 }
@@ -471,12 +1300,14 @@ exit:
 
 void Publisher::AddHostRegistration(HostRegistrationPtr &&aHostReg)
 {
-    mHostRegistrations.emplace(MakeFullHostName(aHostReg->mName), std::move(aHostReg));
+    DnsNameKey key = DnsNameKey::Intern(aHostReg->mName);
+
+    mHostRegistrations.emplace(std::move(key), std::move(aHostReg));
 }
 
 void Publisher::RemoveHostRegistration(const std::string &aName, otbrError aError)
 {
-    auto                it = mHostRegistrations.find(MakeFullHostName(aName));
+    auto                it = mHostRegistrations.find(DnsNameKey::Find(aName));
     HostRegistrationPtr hostReg;
 
     otbrLogInfo("Removing host %s", aName.c_str());
@@ -496,7 +1327,7 @@ exit:
 
 Publisher::HostRegistration *Publisher::FindHostRegistration(const std::string &aName)
 {
-    auto it = mHostRegistrations.find(MakeFullHostName(aName));
+    auto it = mHostRegistrations.find(DnsNameKey::Find(aName));
 
     return it != mHostRegistrations.end() ? it->second.get() : nullptr;
 }
@@ -540,12 +1371,14 @@ exit:
 
 void Publisher::AddKeyRegistration(KeyRegistrationPtr &&aKeyReg)
 {
-    mKeyRegistrations.emplace(MakeFullKeyName(aKeyReg->mName), std::move(aKeyReg));
+    DnsNameKey key = DnsNameKey::Intern(aKeyReg->mName);
+
+    mKeyRegistrations.emplace(std::move(key), std::move(aKeyReg));
 }
 
 void Publisher::RemoveKeyRegistration(const std::string &aName, otbrError aError)
 {
-    auto               it = mKeyRegistrations.find(MakeFullKeyName(aName));
+    auto               it = mKeyRegistrations.find(DnsNameKey::Find(aName));
     KeyRegistrationPtr keyReg;
 
     otbrLogInfo("Removing key %s", aName.c_str());
@@ -565,14 +1398,14 @@ exit:
 
 Publisher::KeyRegistration *Publisher::FindKeyRegistration(const std::string &aName)
 {
-    auto it = mKeyRegistrations.find(MakeFullKeyName(aName));
+    auto it = mKeyRegistrations.find(DnsNameKey::Find(aName));
 
     return it != mKeyRegistrations.end() ? it->second.get() : nullptr;
 }
 
 Publisher::KeyRegistration *Publisher::FindKeyRegistration(const std::string &aName, const std::string &aType)
 {
-    auto it = mKeyRegistrations.find(MakeFullServiceName(aName, aType));
+    auto it = mKeyRegistrations.find(DnsNameKey::Find(aName, aType));
 
     return it != mKeyRegistrations.end() ? it->second.get() : nullptr;
 }
@@ -582,6 +1415,25 @@ Publisher::Registration::~Registration(void)
     TriggerCompleteCallback(OTBR_ERROR_ABORTED);
 }
 
+static BlockPool &GetRegistrationPool(void)
+{
+    static constexpr size_t kRegistrationsPerChunk = 16;
+
+    static BlockPool sPool(kRegistrationsPerChunk);
+
+    return sPool;
+}
+
+void *Publisher::Registration::operator new(size_t aSize)
+{
+    return GetRegistrationPool().Allocate(aSize);
+}
+
+void Publisher::Registration::operator delete(void *aBlock, size_t aSize)
+{
+    GetRegistrationPool().Free(aBlock, aSize);
+}
+
 bool Publisher::ServiceRegistration::IsOutdated(const std::string &aHostName,
                                                 const std::string &aName,
                                                 const std::string &aType,
@@ -593,6 +1445,16 @@ bool Publisher::ServiceRegistration::IsOutdated(const std::string &aHostName,
              mPort == aPort && mTxtData == aTxtData);
 }
 
+bool Publisher::ServiceRegistration::IsTxtDataOutdatedOnly(const std::string &aHostName,
+                                                           const std::string &aName,
+                                                           const std::string &aType,
+                                                           const SubTypeList &aSubTypeList,
+                                                           uint16_t           aPort,
+                                                           const TxtData     &aTxtData) const
+{
+    return mTxtData != aTxtData && !IsOutdated(aHostName, aName, aType, aSubTypeList, aPort, mTxtData);
+}
+
 void Publisher::ServiceRegistration::Complete(otbrError aError)
 {
     OnComplete(aError);
@@ -603,7 +1465,7 @@ void Publisher::ServiceRegistration::OnComplete(otbrError aError)
 {
     if (!IsCompleted())
     {
-        mPublisher->UpdateMdnsResponseCounters(mPublisher->mTelemetryInfo.mServiceRegistrations, aError);
+        mPublisher->UpdateMdnsResponseCounters(kOperationServiceRegistration, aError);
         mPublisher->UpdateServiceRegistrationEmaLatency(mName, mType, aError);
     }
 }
@@ -623,7 +1485,7 @@ void Publisher::HostRegistration::OnComplete(otbrError aError)
 {
     if (!IsCompleted())
     {
-        mPublisher->UpdateMdnsResponseCounters(mPublisher->mTelemetryInfo.mHostRegistrations, aError);
+        mPublisher->UpdateMdnsResponseCounters(kOperationHostRegistration, aError);
         mPublisher->UpdateHostRegistrationEmaLatency(mName, aError);
     }
 }
@@ -643,43 +1505,114 @@ void Publisher::KeyRegistration::OnComplete(otbrError aError)
 {
     if (!IsCompleted())
     {
-        mPublisher->UpdateMdnsResponseCounters(mPublisher->mTelemetryInfo.mKeyRegistrations, aError);
+        mPublisher->UpdateMdnsResponseCounters(kOperationKeyRegistration, aError);
         mPublisher->UpdateKeyRegistrationEmaLatency(mName, aError);
     }
 }
 
-void Publisher::UpdateMdnsResponseCounters(otbr::MdnsResponseCounters &aCounters, otbrError aError)
+void Publisher::InitOperationStats(void)
 {
+    static const char *const kOperationNames[kNumOperations] = {
+        "service_registration", // kOperationServiceRegistration
+        "host_registration",    // kOperationHostRegistration
+        "key_registration",     // kOperationKeyRegistration
+        "service_resolution",   // kOperationServiceResolution
+        "host_resolution",      // kOperationHostResolution
+    };
+    static constexpr char kResponsesName[] = "otbr_mdns_responses";
+    static constexpr char kResponsesHelp[] = "The responses of the mDNS operations.";
+
+    Metrics::Registry    &registry = Metrics::Registry::Get();
+    std::vector<uint64_t> latencyBounds(std::begin(MdnsLatencyHistogram::kBucketUpperBounds),
+                                        std::end(MdnsLatencyHistogram::kBucketUpperBounds));
+
+    mOperationStats[kOperationServiceRegistration].mResponses  = &mTelemetryInfo.mServiceRegistrations;
+    mOperationStats[kOperationServiceRegistration].mEmaLatency = &mTelemetryInfo.mServiceRegistrationEmaLatency;
+    mOperationStats[kOperationServiceRegistration].mLatency    = &mTelemetryInfo.mServiceRegistrationLatency;
+    mOperationStats[kOperationHostRegistration].mResponses     = &mTelemetryInfo.mHostRegistrations;
+    mOperationStats[kOperationHostRegistration].mEmaLatency    = &mTelemetryInfo.mHostRegistrationEmaLatency;
+    mOperationStats[kOperationHostRegistration].mLatency       = &mTelemetryInfo.mHostRegistrationLatency;
+    mOperationStats[kOperationKeyRegistration].mResponses      = &mTelemetryInfo.mKeyRegistrations;
+    mOperationStats[kOperationKeyRegistration].mEmaLatency     = &mTelemetryInfo.mKeyRegistrationEmaLatency;
+    mOperationStats[kOperationKeyRegistration].mLatency        = &mTelemetryInfo.mKeyRegistrationLatency;
+    mOperationStats[kOperationServiceResolution].mResponses    = &mTelemetryInfo.mServiceResolutions;
+    mOperationStats[kOperationServiceResolution].mEmaLatency   = &mTelemetryInfo.mServiceResolutionEmaLatency;
+    mOperationStats[kOperationServiceResolution].mLatency      = &mTelemetryInfo.mServiceResolutionLatency;
+    mOperationStats[kOperationHostResolution].mResponses       = &mTelemetryInfo.mHostResolutions;
+    mOperationStats[kOperationHostResolution].mEmaLatency      = &mTelemetryInfo.mHostResolutionEmaLatency;
+    mOperationStats[kOperationHostResolution].mLatency         = &mTelemetryInfo.mHostResolutionLatency;
+
+    for (uint8_t i = 0; i < kNumOperations; i++)
+    {
+        std::string     label = std::string("op=\"") + kOperationNames[i] + "\"";
+        OperationStats &stats = mOperationStats[i];
+
+        stats.mSuccessMetric =
+            &registry.AddCounter(kResponsesName, kResponsesHelp, (label + ",result=\"success\"").c_str());
+        stats.mFailureMetric =
+            &registry.AddCounter(kResponsesName, kResponsesHelp, (label + ",result=\"failure\"").c_str());
+        stats.mLatencyMetric = &registry.AddHistogram("otbr_mdns_latency_ms", "The latencies of the mDNS operations.",
+                                                      latencyBounds, label.c_str());
+    }
+}
+
+void Publisher::UpdateMdnsResponseCounters(Operation aOperation, otbrError aError)
+{
+    MdnsResponseCounters &counters = *mOperationStats[aOperation].mResponses;
+
+    if (aError == OTBR_ERROR_NONE)
+    {
+        mOperationStats[aOperation].mSuccessMetric->Increment();
+    }
+    else
+    {
+        mOperationStats[aOperation].mFailureMetric->Increment();
+    }
+
     switch (aError)
     {
     case OTBR_ERROR_NONE:
-        ++aCounters.mSuccess;
+        ++counters.mSuccess;
         break;
     case OTBR_ERROR_NOT_FOUND:
-        ++aCounters.mNotFound;
+        ++counters.mNotFound;
         break;
     case OTBR_ERROR_INVALID_ARGS:
-        ++aCounters.mInvalidArgs;
+        ++counters.mInvalidArgs;
         break;
     case OTBR_ERROR_DUPLICATED:
-        ++aCounters.mDuplicated;
+        ++counters.mDuplicated;
         break;
     case OTBR_ERROR_NOT_IMPLEMENTED:
-        ++aCounters.mNotImplemented;
+        ++counters.mNotImplemented;
         break;
     case OTBR_ERROR_ABORTED:
-        ++aCounters.mAborted;
+        ++counters.mAborted;
         break;
     case OTBR_ERROR_INVALID_STATE:
-        ++aCounters.mInvalidState;
+        ++counters.mInvalidState;
         break;
     case OTBR_ERROR_MDNS:
     default:
-        ++aCounters.mUnknownError;
+        ++counters.mUnknownError;
         break;
     }
 }
 
+void Publisher::UpdateLatency(Operation aOperation, uint32_t aLatency, otbrError aError)
+{
+    OperationStats &stats = mOperationStats[aOperation];
+
+    VerifyOrExit(aError != OTBR_ERROR_ABORTED);
+
+    UpdateEmaLatency(*stats.mEmaLatency, aLatency, aError);
+    stats.mLatency->Record(aLatency);
+    stats.mLatencyMetric->Observe(aLatency);
+
+exit:
+    return;
+}
+
 void Publisher::UpdateEmaLatency(uint32_t &aEmaLatency, uint32_t aLatency, otbrError aError)
 {
     VerifyOrExit(aError != OTBR_ERROR_ABORTED);
@@ -708,9 +1641,10 @@ void Publisher::UpdateServiceRegistrationEmaLatency(const std::string &aInstance
 
     if (it != mServiceRegistrationBeginTime.end())
     {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
-        UpdateEmaLatency(mTelemetryInfo.mServiceRegistrationEmaLatency, latency, aError);
+        uint32_t latency = std::chrono::duration_cast<Milliseconds>(CoarseClock::Now() - it->second).count();
+        UpdateLatency(kOperationServiceRegistration, latency, aError);
         mServiceRegistrationBeginTime.erase(it);
+        OTBR_TRACE_ASYNC_END("mdns.publish.service", Trace::MakeCookie(aInstanceName + "." + aType));
     }
 }
 
@@ -720,9 +1654,10 @@ void Publisher::UpdateHostRegistrationEmaLatency(const std::string &aHostName, o
 
     if (it != mHostRegistrationBeginTime.end())
     {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
-        UpdateEmaLatency(mTelemetryInfo.mHostRegistrationEmaLatency, latency, aError);
+        uint32_t latency = std::chrono::duration_cast<Milliseconds>(CoarseClock::Now() - it->second).count();
+        UpdateLatency(kOperationHostRegistration, latency, aError);
         mHostRegistrationBeginTime.erase(it);
+        OTBR_TRACE_ASYNC_END("mdns.publish.host", Trace::MakeCookie(aHostName));
     }
 }
 
@@ -732,9 +1667,10 @@ void Publisher::UpdateKeyRegistrationEmaLatency(const std::string &aKeyName, otb
 
     if (it != mKeyRegistrationBeginTime.end())
     {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
-        UpdateEmaLatency(mTelemetryInfo.mKeyRegistrationEmaLatency, latency, aError);
+        uint32_t latency = std::chrono::duration_cast<Milliseconds>(CoarseClock::Now() - it->second).count();
+        UpdateLatency(kOperationKeyRegistration, latency, aError);
         mKeyRegistrationBeginTime.erase(it);
+        OTBR_TRACE_ASYNC_END("mdns.publish.key", Trace::MakeCookie(aKeyName));
     }
 }
 
@@ -746,8 +1682,8 @@ void Publisher::UpdateServiceInstanceResolutionEmaLatency(const std::string &aIn
 
     if (it != mServiceInstanceResolutionBeginTime.end())
     {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
-        UpdateEmaLatency(mTelemetryInfo.mServiceResolutionEmaLatency, latency, aError);
+        uint32_t latency = std::chrono::duration_cast<Milliseconds>(CoarseClock::Now() - it->second).count();
+        UpdateLatency(kOperationServiceResolution, latency, aError);
         mServiceInstanceResolutionBeginTime.erase(it);
     }
 }
@@ -758,8 +1694,8 @@ void Publisher::UpdateHostResolutionEmaLatency(const std::string &aHostName, otb
 
     if (it != mHostResolutionBeginTime.end())
     {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
-        UpdateEmaLatency(mTelemetryInfo.mHostResolutionEmaLatency, latency, aError);
+        uint32_t latency = std::chrono::duration_cast<Milliseconds>(CoarseClock::Now() - it->second).count();
+        UpdateLatency(kOperationHostResolution, latency, aError);
         mHostResolutionBeginTime.erase(it);
     }
 }
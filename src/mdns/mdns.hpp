@@ -45,13 +45,19 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <sys/select.h>
 
 #include "common/callback.hpp"
 #include "common/code_utils.hpp"
+#include "common/dns_name_key.hpp"
+#include "common/memory_usage.hpp"
+#include "common/metrics.hpp"
+#include "common/task_runner.hpp"
 #include "common/time.hpp"
+#include "common/txt_reader.hpp"
 #include "common/types.hpp"
 
 namespace otbr {
@@ -157,6 +163,32 @@ public:
         void RemoveAddress(const Ip6Address &aAddress) { Publisher::RemoveAddress(mAddresses, aAddress); }
     };
 
+    /**
+     * This structure represents a service published together with its host by `PublishHostAndServices`.
+     */
+    struct HostedService
+    {
+        std::string mName;        ///< The service instance name (MUST NOT be empty).
+        std::string mType;        ///< The service type, e.g., "_srv._udp" (MUST NOT end with dot).
+        SubTypeList mSubTypeList; ///< The service subtypes.
+        uint16_t    mPort = 0;    ///< The port number.
+        TxtData     mTxtData;     ///< The encoded TXT data.
+    };
+
+    typedef std::vector<HostedService> HostedServiceList;
+
+    /**
+     * This structure represents a host published by this publisher together with the services residing on it.
+     */
+    struct PublishedHost
+    {
+        std::string       mName;      ///< The host name.
+        AddressList       mAddresses; ///< The IPv6 addresses.
+        HostedServiceList mServices;  ///< The services residing on the host.
+    };
+
+    typedef std::vector<PublishedHost> PublishedHostList;
+
     /**
      * This function is called to notify a discovered service instance.
      */
@@ -208,6 +240,9 @@ public:
     /**
      * This method publishes or updates a service.
      *
+     * Requests are paced by a token bucket and may be queued; a queued request which is superseded by a newer
+     * request for the same service, or by un-publishing it, completes with `OTBR_ERROR_ABORTED`.
+     *
      * @param[in] aHostName     The name of the host which this service resides on. If an empty string is
      *                          provided, this service resides on local host and it is the implementation
      *                          to provide specific host name. Otherwise, the caller MUST publish the host
@@ -239,7 +274,7 @@ public:
      * @param[in] aType      The type of this service, e.g., "_srv._udp" (MUST NOT end with dot).
      * @param[in] aCallback  The callback for receiving the publishing result.
      */
-    virtual void UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback) = 0;
+    void UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback);
 
     /**
      * This method publishes or updates a host.
@@ -257,13 +292,62 @@ public:
      */
     void PublishHost(const std::string &aName, const AddressList &aAddresses, ResultCallback &&aCallback);
 
+    /**
+     * This method publishes or updates a host and the services residing on it as one transaction.
+     *
+     * The publisher is free to advertise the host and its services as a single set of records, so that they are
+     * probed and announced together. @p aCallback is invoked once, either with `OTBR_ERROR_NONE` after the host and
+     * all the services are published, or with the first error. Services which no longer reside on the host should be
+     * un-published with `UnpublishService`.
+     *
+     * @param[in] aHostName   The name of the host.
+     * @param[in] aAddresses  The addresses of the host.
+     * @param[in] aServices   The services residing on the host.
+     * @param[in] aCallback   The callback for receiving the publishing result. `OTBR_ERROR_DUPLICATED` indicates
+     *                        that the host name or one of the service names has already been published.
+     */
+    void PublishHostAndServices(const std::string       &aHostName,
+                                const AddressList       &aAddresses,
+                                const HostedServiceList &aServices,
+                                ResultCallback         &&aCallback);
+
+    /**
+     * This method un-publishes a host and all the services residing on it.
+     *
+     * @param[in] aHostName  A host name (MUST not end with dot).
+     * @param[in] aCallback  The callback for receiving the result, invoked once for the whole host.
+     */
+    virtual void UnpublishHostAndServices(const std::string &aHostName, ResultCallback &&aCallback);
+
     /**
      * This method un-publishes a host.
      *
      * @param[in] aName      A host name (MUST not end with dot).
      * @param[in] aCallback  The callback for receiving the publishing result.
      */
-    virtual void UnpublishHost(const std::string &aName, ResultCallback &&aCallback) = 0;
+    void UnpublishHost(const std::string &aName, ResultCallback &&aCallback);
+
+    /**
+     * This method returns the hosts published by this publisher, with the services residing on them.
+     *
+     * Services residing on the local host are not included.
+     *
+     * @returns The published hosts.
+     */
+    PublishedHostList GetPublishedHosts(void) const;
+
+    /**
+     * This method publishes hosts which another publisher has published before, e.g. the one of the agent process
+     * this one is taking over from.
+     *
+     * An adopted host is claimed once it is published or un-published again, which the SRP server does as the
+     * hosts re-register. Hosts which are still unclaimed after @p aLease are un-published, as their registrations
+     * are known to no one.
+     *
+     * @param[in] aHosts  The hosts to publish.
+     * @param[in] aLease  The time to wait for the hosts to be claimed.
+     */
+    void AdoptHosts(const PublishedHostList &aHosts, Milliseconds aLease);
 
     /**
      * This method publishes or updates a key record for a name.
@@ -284,7 +368,7 @@ public:
      * @param[in] aName      The name associated with key record.
      * @param[in] aCallback  The callback for receiving the publishing result.
      */
-    virtual void UnpublishKey(const std::string &aName, ResultCallback &&aCallback) = 0;
+    void UnpublishKey(const std::string &aName, ResultCallback &&aCallback);
 
     /**
      * This method subscribes a given service or service instance.
@@ -293,57 +377,73 @@ public:
      * the service. mDNS implementations should use the `DiscoveredServiceInstanceCallback` function to notify
      * discovered service instances.
      *
+     * Subscriptions are shared by all users of the publisher: subscribing a service or service instance which is
+     * already subscribed only adds a reference, and a service instance is not queried on its own while its service is
+     * subscribed. Cached service instances which are not close to expiring are reported right away.
+     *
      * @note Discovery Proxy implementation guarantees no duplicate subscriptions for the same service or service
      * instance.
      *
      * @param[in] aType          The service type, e.g., "_srv._udp" (MUST NOT end with dot).
      * @param[in] aInstanceName  The service instance to subscribe, or empty to subscribe the service.
      */
-    virtual void SubscribeService(const std::string &aType, const std::string &aInstanceName) = 0;
+    void SubscribeService(const std::string &aType, const std::string &aInstanceName);
 
     /**
      * This method unsubscribes a given service or service instance.
      *
      * If @p aInstanceName is not empty, this method unsubscribes the service instance. Otherwise, this method
-     * unsubscribes the service.
+     * unsubscribes the service. The subscription is stopped once every reference added by `SubscribeService` is
+     * released.
      *
      * @note Discovery Proxy implementation guarantees no redundant unsubscription for a service or service instance.
      *
      * @param[in] aType          The service type, e.g., "_srv._udp" (MUST NOT end with dot).
      * @param[in] aInstanceName  The service instance to unsubscribe, or empty to unsubscribe the service.
      */
-    virtual void UnsubscribeService(const std::string &aType, const std::string &aInstanceName) = 0;
+    void UnsubscribeService(const std::string &aType, const std::string &aInstanceName);
 
     /**
      * This method subscribes a given host.
      *
      * mDNS implementations should use the `DiscoveredHostCallback` function to notify discovered hosts.
      *
+     * Like service subscriptions, host subscriptions are shared and a cached host is reported right away.
+     *
      * @note Discovery Proxy implementation guarantees no duplicate subscriptions for the same host.
      *
      * @param[in] aHostName  The host name (without domain).
      */
-    virtual void SubscribeHost(const std::string &aHostName) = 0;
+    void SubscribeHost(const std::string &aHostName);
 
     /**
      * This method unsubscribes a given host.
      *
+     * The subscription is stopped once every reference added by `SubscribeHost` is released.
+     *
      * @note Discovery Proxy implementation guarantees no redundant unsubscription for a host.
      *
      * @param[in] aHostName  The host name (without domain).
      */
-    virtual void UnsubscribeHost(const std::string &aHostName) = 0;
+    void UnsubscribeHost(const std::string &aHostName);
 
     /**
      * This method sets the callbacks for subscriptions.
      *
+     * The callbacks can be limited to a service type and a host name, so that only the subscribers interested in a
+     * discovery are invoked for it.
+     *
      * @param[in] aInstanceCallback  The callback function to receive discovered service instances.
      * @param[in] aHostCallback      The callback function to receive discovered hosts.
+     * @param[in] aServiceType       The service type (e.g. "_trel._udp") to receive instances of, all types if empty.
+     * @param[in] aHostName          The host name (without domain) to receive, all hosts if empty.
      *
      * @returns  The Subscriber ID for the callbacks.
      */
     uint64_t AddSubscriptionCallbacks(DiscoveredServiceInstanceCallback aInstanceCallback,
-                                      DiscoveredHostCallback            aHostCallback);
+                                      DiscoveredHostCallback            aHostCallback,
+                                      const std::string                &aServiceType = "",
+                                      const std::string                &aHostName    = "");
 
     /**
      * This method cancels callbacks for subscriptions.
@@ -359,7 +459,7 @@ public:
      */
     const MdnsTelemetryInfo &GetMdnsTelemetryInfo(void) const { return mTelemetryInfo; }
 
-    virtual ~Publisher(void) = default;
+    virtual ~Publisher(void);
 
     /**
      * This function creates a mDNS publisher.
@@ -394,12 +494,32 @@ public:
      */
     static otbrError EncodeTxtData(const TxtList &aTxtList, TxtData &aTxtData);
 
+    /**
+     * This function writes the TXT entry list to a caller-provided buffer in a single pass.
+     *
+     * The output data is in standard DNS-SD TXT data format.
+     * See RFC 6763 for details: https://tools.ietf.org/html/rfc6763#section-6.
+     *
+     * @param[in]  aTxtList     A TXT entry list.
+     * @param[out] aBuffer      A pointer to the output buffer.
+     * @param[in]  aBufferSize  The size of @p aBuffer in bytes.
+     * @param[out] aLength      The length of the written TXT data.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully write the TXT entry list.
+     * @retval OTBR_ERROR_INVALID_ARGS  The @p aTxtList includes invalid TXT entry, or @p aBuffer is too small.
+     *
+     * @sa DecodeTxtData
+     */
+    static otbrError EncodeTxtData(const TxtList &aTxtList, uint8_t *aBuffer, size_t aBufferSize, size_t &aLength);
+
     /**
      * This function decodes a TXT entry list from a TXT data buffer.
      *
      * The input data should be in standard DNS-SD TXT data format.
      * See RFC 6763 for details: https://tools.ietf.org/html/rfc6763#section-6.
      *
+     * Each entry copies its key and value, a consumer only looking for some keys should use `TxtReader` instead.
+     *
      * @param[out]  aTxtList    A TXT entry list.
      * @param[in]   aTxtData    A pointer to TXT data.
      * @param[in]   aTxtLength  The TXT data length.
@@ -408,12 +528,15 @@ public:
      * @retval OTBR_ERROR_INVALID_ARGS  The @p aTxtdata has invalid TXT format.
      *
      * @sa EncodeTxtData
+     * @sa TxtReader
      */
     static otbrError DecodeTxtData(TxtList &aTxtList, const uint8_t *aTxtData, uint16_t aTxtLength);
 
 protected:
     static constexpr uint8_t kMaxTextEntrySize = 255;
 
+    Publisher(void);
+
     class Registration
     {
     public:
@@ -427,6 +550,11 @@ protected:
         }
         virtual ~Registration(void);
 
+        // Registrations of all backends are allocated from a pool shared by the publishers, as they are freed and
+        // allocated again at a steady population with the SRP lease renewals.
+        static void *operator new(size_t aSize);
+        static void  operator delete(void *aBlock, size_t aSize);
+
         // Tells whether the service registration has been completed (typically by calling
         // `ServiceRegistration::Complete`).
         bool IsCompleted() const { return mCallback.IsNull(); }
@@ -452,6 +580,7 @@ protected:
         SubTypeList mSubTypeList;
         uint16_t    mPort;
         TxtData     mTxtData;
+        uint32_t    mTxtDataHash; // The fingerprint of `mTxtData`, see `HashTxtData`.
 
         ServiceRegistration(std::string      aHostName,
                             std::string      aName,
@@ -468,12 +597,19 @@ protected:
             , mSubTypeList(SortSubTypeList(std::move(aSubTypeList)))
             , mPort(aPort)
             , mTxtData(std::move(aTxtData))
+            , mTxtDataHash(HashTxtData(mTxtData))
         {
         }
         ~ServiceRegistration(void) override { OnComplete(OTBR_ERROR_ABORTED); }
 
         void Complete(otbrError aError);
 
+        void SetTxtData(const TxtData &aTxtData)
+        {
+            mTxtData     = aTxtData;
+            mTxtDataHash = HashTxtData(mTxtData);
+        }
+
         // Tells whether this `ServiceRegistration` object is outdated comparing to the given parameters.
         bool IsOutdated(const std::string &aHostName,
                         const std::string &aName,
@@ -482,6 +618,15 @@ protected:
                         uint16_t           aPort,
                         const TxtData     &aTxtData) const;
 
+        // Tells whether this `ServiceRegistration` object differs from the given parameters only in its TXT data,
+        // which can be updated in place.
+        bool IsTxtDataOutdatedOnly(const std::string &aHostName,
+                                   const std::string &aName,
+                                   const std::string &aType,
+                                   const SubTypeList &aSubTypeList,
+                                   uint16_t           aPort,
+                                   const TxtData     &aTxtData) const;
+
     private:
         void OnComplete(otbrError aError);
     };
@@ -534,13 +679,45 @@ protected:
         void OnComplete(otbrError aError);
     };
 
+    // The registrations are indexed by the interned "<name>" or "<name>.<type>" key, which
+    // is shared with the SRP and DNS-SD proxies keying the same names.
     using ServiceRegistrationPtr = std::unique_ptr<ServiceRegistration>;
-    using ServiceRegistrationMap = std::map<std::string, ServiceRegistrationPtr>;
+    using ServiceRegistrationMap = std::unordered_map<DnsNameKey, ServiceRegistrationPtr, DnsNameKey::Hash>;
     using HostRegistrationPtr    = std::unique_ptr<HostRegistration>;
-    using HostRegistrationMap    = std::map<std::string, HostRegistrationPtr>;
+    using HostRegistrationMap    = std::unordered_map<DnsNameKey, HostRegistrationPtr, DnsNameKey::Hash>;
     using KeyRegistrationPtr     = std::unique_ptr<KeyRegistration>;
-    using KeyRegistrationMap     = std::map<std::string, KeyRegistrationPtr>;
+    using KeyRegistrationMap     = std::unordered_map<DnsNameKey, KeyRegistrationPtr, DnsNameKey::Hash>;
 
+    // The operations whose responses and latencies are recorded.
+    enum Operation : uint8_t
+    {
+        kOperationServiceRegistration,
+        kOperationHostRegistration,
+        kOperationKeyRegistration,
+        kOperationServiceResolution,
+        kOperationHostResolution,
+        kNumOperations,
+    };
+
+    // Where the responses and latencies of an operation are recorded, both in the
+    // telemetry info and in the metrics registry.
+    struct OperationStats
+    {
+        MdnsResponseCounters *mResponses;
+        uint32_t             *mEmaLatency;
+        MdnsLatencyHistogram *mLatency;
+        Metrics::Counter     *mSuccessMetric;
+        Metrics::Counter     *mFailureMetric;
+        Metrics::Histogram   *mLatencyMetric;
+    };
+
+    // Splits `aCallback` into `aCount` callbacks. `aCallback` is invoked once all of them have succeeded,
+    // or as soon as one of them fails.
+    static std::vector<ResultCallback> SplitResultCallback(ResultCallback &&aCallback, size_t aCount);
+
+    // Returns the FNV-1a hash of `aTxtData`, which lets an unchanged TXT data be recognized
+    // without comparing it byte by byte in most cases.
+    static uint32_t    HashTxtData(const TxtData &aTxtData);
     static SubTypeList SortSubTypeList(SubTypeList aSubTypeList);
     static AddressList SortAddressList(AddressList aAddressList);
     static std::string MakeFullName(const std::string &aName);
@@ -548,6 +725,11 @@ protected:
     static std::string MakeFullHostName(const std::string &aName) { return MakeFullName(aName); }
     static std::string MakeFullKeyName(const std::string &aName) { return MakeFullName(aName); }
 
+    // Builds the key of a registration in `mRegistrationKey`, which is reused
+    // so that lookups don't allocate. The returned key is only valid until the next call.
+    const std::string &MakeRegistrationKey(const std::string &aName);
+    const std::string &MakeRegistrationKey(const std::string &aName, const std::string &aType);
+
     virtual otbrError PublishServiceImpl(const std::string &aHostName,
                                          const std::string &aName,
                                          const std::string &aType,
@@ -562,6 +744,27 @@ protected:
 
     virtual otbrError PublishKeyImpl(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback) = 0;
 
+    virtual void UnpublishServiceImpl(const std::string &aName,
+                                      const std::string &aType,
+                                      ResultCallback   &&aCallback)                      = 0;
+    virtual void UnpublishHostImpl(const std::string &aName, ResultCallback &&aCallback) = 0;
+    virtual void UnpublishKeyImpl(const std::string &aName, ResultCallback &&aCallback)  = 0;
+
+    // Publishes the host and each of its services as separate registrations sharing one result callback.
+    virtual otbrError PublishHostAndServicesImpl(const std::string       &aHostName,
+                                                 const AddressList       &aAddresses,
+                                                 const HostedServiceList &aServices,
+                                                 ResultCallback         &&aCallback);
+
+    virtual otbrError SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) = 0;
+    virtual void      UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) = 0;
+    virtual otbrError SubscribeHostImpl(const std::string &aHostName)                                    = 0;
+    virtual void      UnsubscribeHostImpl(const std::string &aHostName)                                  = 0;
+
+    // Forgets all subscriptions and cached results. Implementations call this when they drop their
+    // browsers and resolvers, so that later subscriptions start them again.
+    void ClearDiscoveryCache(void);
+
     virtual void OnServiceResolveFailedImpl(const std::string &aType,
                                             const std::string &aInstanceName,
                                             int32_t            aErrorCode) = 0;
@@ -575,11 +778,15 @@ protected:
     ServiceRegistration *FindServiceRegistration(const std::string &aName, const std::string &aType);
     ServiceRegistration *FindServiceRegistration(const std::string &aNameAndType);
 
+    // The discovered info is taken by value, as it may belong to a subscription object which the
+    // callbacks free. Callers which don't need it afterwards should move it in.
     void OnServiceResolved(std::string aType, DiscoveredInstanceInfo aInstanceInfo);
     void OnServiceResolveFailed(std::string aType, std::string aInstanceName, int32_t aErrorCode);
     void OnServiceRemoved(uint32_t aNetifIndex, std::string aType, std::string aInstanceName);
     void OnHostResolved(std::string aHostName, DiscoveredHostInfo aHostInfo);
     void OnHostResolveFailed(std::string aHostName, int32_t aErrorCode);
+    void NotifyServiceInstanceDiscovered(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo);
+    void NotifyHostDiscovered(const std::string &aHostName, const DiscoveredHostInfo &aHostInfo);
 
     // Handles the cases that there is already a registration for the same service.
     // If the returned callback is completed, current registration should be considered
@@ -609,7 +816,9 @@ protected:
     KeyRegistration *FindKeyRegistration(const std::string &aName);
     KeyRegistration *FindKeyRegistration(const std::string &aName, const std::string &aType);
 
-    static void UpdateMdnsResponseCounters(MdnsResponseCounters &aCounters, otbrError aError);
+    void        InitOperationStats(void);
+    void        UpdateMdnsResponseCounters(Operation aOperation, otbrError aError);
+    void        UpdateLatency(Operation aOperation, uint32_t aLatency, otbrError aError);
     static void UpdateEmaLatency(uint32_t &aEmaLatency, uint32_t aLatency, otbrError aError);
 
     void UpdateServiceRegistrationEmaLatency(const std::string &aInstanceName,
@@ -625,31 +834,130 @@ protected:
     static void AddAddress(AddressList &aAddressList, const Ip6Address &aAddress);
     static void RemoveAddress(AddressList &aAddressList, const Ip6Address &aAddress);
 
+    // Publishing requests are paced by a token bucket, so that re-publishing everything at once
+    // (e.g. after the mDNS daemon restarts) doesn't flood the link and the daemon. Requests which
+    // can't be published right away are queued with the meshcop and TREL services ahead of the
+    // others, and a queued request is replaced by a newer request for the same name.
+    static constexpr uint32_t kPublishTokenBucketSize = 16;
+    static constexpr uint32_t kPublishTokenIntervalMs = 50; // A token is added every 50 ms.
+
+    using PublishTask = UniqueFunction<otbrError(ResultCallback &&)>;
+
+    struct PendingPublish
+    {
+        std::string    mKey; // The kind of the request followed by its registration key.
+        bool           mIsPrioritized = false;
+        PublishTask    mPublish;
+        ResultCallback mCallback{nullptr};
+    };
+
+    using PendingPublishList = std::list<PendingPublish>;
+
+    static bool IsPrioritizedServiceType(const std::string &aType);
+
+    void SchedulePublish(std::string aKey, bool aIsPrioritized, PublishTask &&aPublish, ResultCallback &&aCallback);
+    void CancelPendingPublish(const std::string &aKey);
+    void ProcessPublishQueue(void);
+    void RefillPublishTokens(void);
+
+    PendingPublishList                                            mPrioritizedPublishes;
+    PendingPublishList                                            mPendingPublishes;
+    std::unordered_map<std::string, PendingPublishList::iterator> mPendingPublishIndex;
+    uint32_t                                                      mPublishTokens            = kPublishTokenBucketSize;
+    Timepoint                                                     mPublishTokenRefillTime   = Clock::now();
+    bool                                                          mIsPublishTaskPosted      = false;
+    bool                                                          mIsProcessingPublishQueue = false;
+
     ServiceRegistrationMap mServiceRegistrations;
     HostRegistrationMap    mHostRegistrations;
     KeyRegistrationMap     mKeyRegistrations;
+    std::string            mRegistrationKey;
+
+    // The names of the hosts published by `AdoptHosts` which haven't been claimed yet.
+    std::unordered_map<DnsNameKey, std::string, DnsNameKey::Hash> mAdoptedHosts;
+
+    void ClaimHost(const std::string &aName) { mAdoptedHosts.erase(DnsNameKey::Find(aName)); }
+    void UnpublishUnclaimedHosts(void);
 
     struct DiscoverCallback
     {
-        DiscoverCallback(uint64_t                          aId,
-                         DiscoveredServiceInstanceCallback aServiceCallback,
-                         DiscoveredHostCallback            aHostCallback)
-            : mId(aId)
-            , mServiceCallback(std::move(aServiceCallback))
-            , mHostCallback(std::move(aHostCallback))
-            , mShouldInvoke(false)
-        {
-        }
-
-        uint64_t                          mId;
         DiscoveredServiceInstanceCallback mServiceCallback;
         DiscoveredHostCallback            mHostCallback;
-        bool                              mShouldInvoke;
+        std::string                       mServiceTypeKey; // The lowercase service type filter, empty for all.
+        std::string                       mHostNameKey;    // The lowercase host name filter, empty for all.
     };
 
+    // The Subscriber IDs of the callbacks, in ascending order, indexed by their lowercase filter
+    // with an empty key for the callbacks without a filter.
+    using DiscoverCallbackIndex = std::unordered_map<std::string, std::vector<uint64_t>>;
+
+    static void AddToDiscoverCallbackIndex(DiscoverCallbackIndex &aIndex, const std::string &aKey, uint64_t aId);
+    static void RemoveFromDiscoverCallbackIndex(DiscoverCallbackIndex &aIndex, const std::string &aKey, uint64_t aId);
+    std::vector<uint64_t> FindDiscoverCallbacks(const DiscoverCallbackIndex &aIndex, const std::string &aName);
+
     uint64_t mNextSubscriberId = 1;
 
-    std::list<DiscoverCallback> mDiscoverCallbacks;
+    std::unordered_map<uint64_t, DiscoverCallback> mDiscoverCallbacks;
+    DiscoverCallbackIndex                          mServiceCallbackIndex;
+    DiscoverCallbackIndex                          mHostCallbackIndex;
+
+    struct ServiceSubscriptionEntry
+    {
+        std::string mType;
+        std::string mInstanceName;
+        uint32_t    mRefCount = 0;
+        bool        mIsActive = false; // Whether the implementation resolves the instance, not a browse of its service.
+    };
+
+    struct HostSubscriptionEntry
+    {
+        std::string mHostName;
+        uint32_t    mRefCount = 0;
+    };
+
+    struct CachedInstance
+    {
+        std::string            mType;
+        DiscoveredInstanceInfo mInstanceInfo;
+        Timepoint              mReceivedTime;
+    };
+
+    struct CachedHost
+    {
+        std::string        mHostName;
+        DiscoveredHostInfo mHostInfo;
+        Timepoint          mReceivedTime;
+    };
+
+    // Cached records are answered from the cache until this percentage of their TTL has elapsed, after
+    // which the refresh queries of the underlying mDNS implementation are awaited instead (RFC 6762, 5.2).
+    static constexpr uint32_t kCacheFreshPercentage = 80;
+
+    static bool IsCacheFresh(Timepoint aReceivedTime, uint32_t aTtl);
+    static bool IsCacheExpired(Timepoint aReceivedTime, uint32_t aTtl);
+
+    ServiceSubscriptionEntry *FindServiceSubscription(const std::string &aType, const std::string &aInstanceName);
+
+    MemoryUsage GetRegistrationMemoryUsage(void) const;
+    MemoryUsage GetCacheMemoryUsage(void) const;
+
+    void UpdateCoveredServiceSubscriptions(const std::string &aType, bool aIsBrowsing);
+    void AnswerServiceSubscriptionFromCache(const std::string &aType, const std::string &aInstanceName);
+    void AnswerHostSubscriptionFromCache(const std::string &aHostName);
+    void UpdateInstanceCache(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo);
+    void UpdateHostCache(const std::string &aHostName, const DiscoveredHostInfo &aHostInfo);
+    void EvictExpiredCache(void);
+
+    // The subscriptions are keyed as the registrations, see `MakeRegistrationKey`. A service
+    // browse uses an empty instance name.
+    std::unordered_map<std::string, ServiceSubscriptionEntry> mServiceSubscriptions;
+    std::unordered_map<std::string, HostSubscriptionEntry>    mHostSubscriptions;
+    std::unordered_map<std::string, CachedInstance>           mInstanceCache;
+    std::unordered_map<std::string, CachedHost>               mHostCache;
+
+    // Answers from the cache are deferred to the mainloop, as subscribers may not expect
+    // callbacks while subscribing.
+    TaskRunner mTaskRunner;
 
     // {instance name, service type} -> the timepoint to begin service registration
     std::map<std::pair<std::string, std::string>, Timepoint> mServiceRegistrationBeginTime;
@@ -663,6 +971,7 @@ protected:
     std::map<std::string, Timepoint> mHostResolutionBeginTime;
 
     MdnsTelemetryInfo mTelemetryInfo{};
+    OperationStats    mOperationStats[kNumOperations];
 };
 
 /**
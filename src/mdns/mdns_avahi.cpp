@@ -44,6 +44,7 @@
 #include <avahi-common/timeval.h>
 #include <errno.h>
 #include <inttypes.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -71,6 +72,7 @@ struct AvahiWatch
     AvahiWatchCallback mCallback;     ///< The function to be called to report events happened on `mFd`.
     void              *mContext;      ///< A pointer to application-specific context to use with `mCallback`.
     bool               mShouldReport; ///< Whether or not we need to report events (invoking callback).
+    size_t             mIndex;        ///< The index of this watch in the poller's watch list.
     AvahiPoller       &mPoller;       ///< The poller owning this watch.
 
     /**
@@ -88,6 +90,7 @@ struct AvahiWatch
         , mCallback(aCallback)
         , mContext(aContext)
         , mShouldReport(false)
+        , mIndex(0)
         , mPoller(aPoller)
     {
     }
@@ -100,34 +103,30 @@ struct AvahiTimeout
 {
     typedef otbr::Mdns::AvahiPoller AvahiPoller;
 
+    static constexpr size_t kNotScheduled = SIZE_MAX; ///< The `mHeapIndex` of a disabled timer.
+
     otbr::Timepoint      mTimeout;      ///< Absolute time when this timer timeout.
     AvahiTimeoutCallback mCallback;     ///< The function to be called when timeout.
     void                *mContext;      ///< The pointer to application-specific context.
     bool                 mShouldReport; ///< Whether or not timeout occurred and need to reported (invoking callback).
+    size_t               mHeapIndex;    ///< The index of this timer in the poller's timer heap.
     AvahiPoller         &mPoller;       ///< The poller created this timer.
 
     /**
-     * The constructor to initialize an AvahiTimeout.
+     * The constructor to initialize a disabled AvahiTimeout.
      *
-     * @param[in] aTimeout   A pointer to the time after which the callback should be called.
      * @param[in] aCallback  The function to be called after timeout.
      * @param[in] aContext   A pointer to application-specific context.
      * @param[in] aPoller    The AvahiPoller this timeout belongs to.
      */
-    AvahiTimeout(const struct timeval *aTimeout, AvahiTimeoutCallback aCallback, void *aContext, AvahiPoller &aPoller)
-        : mCallback(aCallback)
+    AvahiTimeout(AvahiTimeoutCallback aCallback, void *aContext, AvahiPoller &aPoller)
+        : mTimeout(otbr::Timepoint::min())
+        , mCallback(aCallback)
         , mContext(aContext)
         , mShouldReport(false)
+        , mHeapIndex(kNotScheduled)
         , mPoller(aPoller)
     {
-        if (aTimeout)
-        {
-            mTimeout = otbr::Clock::now() + otbr::FromTimeval<otbr::Microseconds>(*aTimeout);
-        }
-        else
-        {
-            mTimeout = otbr::Timepoint::min();
-        }
     }
 };
 
@@ -178,12 +177,16 @@ public:
 
     // Implementation of MainloopProcessor.
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "AvahiPoller"; }
+    void        Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
 
     const AvahiPoll *GetAvahiPoll(void) const { return &mAvahiPoll; }
 
 private:
+    // Each watch keeps its index in `mWatches` and each scheduled timer its index
+    // in `mTimers`, a binary min-heap ordered by timeout, so that adding, updating
+    // and freeing them doesn't need to search the whole list.
     typedef std::vector<AvahiWatch *>   Watches;
     typedef std::vector<AvahiTimeout *> Timers;
 
@@ -205,9 +208,15 @@ private:
     static void            TimeoutUpdate(AvahiTimeout *aTimer, const struct timeval *aTimeout);
     static void            TimeoutFree(AvahiTimeout *aTimer);
     void                   TimeoutFree(AvahiTimeout &aTimer);
+    void                   SetTimeout(AvahiTimeout &aTimer, const struct timeval *aTimeout);
+    void                   UnscheduleTimer(AvahiTimeout &aTimer);
+    void                   SiftTimer(size_t aIndex);
+    void                   SwapTimers(size_t aIndex1, size_t aIndex2);
 
     Watches   mWatches;
     Timers    mTimers;
+    Watches   mWatchesToReport;
+    Timers    mTimersToReport;
     AvahiPoll mAvahiPoll;
 };
 
@@ -238,6 +247,7 @@ AvahiWatch *AvahiPoller::WatchNew(int aFd, AvahiWatchEvent aEvent, AvahiWatchCal
     assert(aEvent && aCallback && aFd >= 0);
 
     mWatches.push_back(new AvahiWatch(aFd, aEvent, aCallback, aContext, *this));
+    mWatches.back()->mIndex = mWatches.size() - 1;
 
     return mWatches.back();
 }
@@ -259,15 +269,18 @@ void AvahiPoller::WatchFree(AvahiWatch *aWatch)
 
 void AvahiPoller::WatchFree(AvahiWatch &aWatch)
 {
-    for (Watches::iterator it = mWatches.begin(); it != mWatches.end(); ++it)
+    assert(aWatch.mIndex < mWatches.size() && mWatches[aWatch.mIndex] == &aWatch);
+
+    mWatches[aWatch.mIndex]         = mWatches.back();
+    mWatches[aWatch.mIndex]->mIndex = aWatch.mIndex;
+    mWatches.pop_back();
+
+    if (aWatch.mShouldReport)
     {
-        if (*it == &aWatch)
-        {
-            mWatches.erase(it);
-            delete &aWatch;
-            break;
-        }
+        std::replace(mWatchesToReport.begin(), mWatchesToReport.end(), &aWatch, static_cast<AvahiWatch *>(nullptr));
     }
+
+    delete &aWatch;
 }
 
 AvahiTimeout *AvahiPoller::TimeoutNew(const AvahiPoll      *aPoll,
@@ -281,40 +294,119 @@ AvahiTimeout *AvahiPoller::TimeoutNew(const AvahiPoll      *aPoll,
 
 AvahiTimeout *AvahiPoller::TimeoutNew(const struct timeval *aTimeout, AvahiTimeoutCallback aCallback, void *aContext)
 {
-    mTimers.push_back(new AvahiTimeout(aTimeout, aCallback, aContext, *this));
-    return mTimers.back();
+    AvahiTimeout *timer = new AvahiTimeout(aCallback, aContext, *this);
+
+    SetTimeout(*timer, aTimeout);
+
+    return timer;
 }
 
 void AvahiPoller::TimeoutUpdate(AvahiTimeout *aTimer, const struct timeval *aTimeout)
 {
+    aTimer->mPoller.SetTimeout(*aTimer, aTimeout);
+}
+
+void AvahiPoller::TimeoutFree(AvahiTimeout *aTimer)
+{
+    aTimer->mPoller.TimeoutFree(*aTimer);
+}
+
+void AvahiPoller::TimeoutFree(AvahiTimeout &aTimer)
+{
+    UnscheduleTimer(aTimer);
+
+    if (aTimer.mShouldReport)
+    {
+        std::replace(mTimersToReport.begin(), mTimersToReport.end(), &aTimer, static_cast<AvahiTimeout *>(nullptr));
+    }
+
+    delete &aTimer;
+}
+
+void AvahiPoller::SetTimeout(AvahiTimeout &aTimer, const struct timeval *aTimeout)
+{
+    // A timer which is updated before its pending report is not reported.
+    aTimer.mShouldReport = false;
+
     if (aTimeout == nullptr)
     {
-        aTimer->mTimeout = Timepoint::min();
+        aTimer.mTimeout = Timepoint::min();
+        UnscheduleTimer(aTimer);
     }
     else
     {
-        aTimer->mTimeout = Clock::now() + FromTimeval<Microseconds>(*aTimeout);
+        aTimer.mTimeout = Clock::now() + FromTimeval<Microseconds>(*aTimeout);
+
+        if (aTimer.mHeapIndex == AvahiTimeout::kNotScheduled)
+        {
+            aTimer.mHeapIndex = mTimers.size();
+            mTimers.push_back(&aTimer);
+        }
+
+        SiftTimer(aTimer.mHeapIndex);
     }
 }
 
-void AvahiPoller::TimeoutFree(AvahiTimeout *aTimer)
+void AvahiPoller::UnscheduleTimer(AvahiTimeout &aTimer)
 {
-    aTimer->mPoller.TimeoutFree(*aTimer);
+    size_t index = aTimer.mHeapIndex;
+
+    VerifyOrExit(index != AvahiTimeout::kNotScheduled);
+
+    SwapTimers(index, mTimers.size() - 1);
+    mTimers.pop_back();
+    aTimer.mHeapIndex = AvahiTimeout::kNotScheduled;
+
+    if (index < mTimers.size())
+    {
+        SiftTimer(index);
+    }
+
+exit:
+    return;
 }
 
-void AvahiPoller::TimeoutFree(AvahiTimeout &aTimer)
+void AvahiPoller::SiftTimer(size_t aIndex)
 {
-    for (Timers::iterator it = mTimers.begin(); it != mTimers.end(); ++it)
+    while (aIndex > 0 && mTimers[aIndex]->mTimeout < mTimers[(aIndex - 1) / 2]->mTimeout)
+    {
+        SwapTimers(aIndex, (aIndex - 1) / 2);
+        aIndex = (aIndex - 1) / 2;
+    }
+
+    while (true)
     {
-        if (*it == &aTimer)
+        size_t earliest = aIndex;
+        size_t left     = 2 * aIndex + 1;
+        size_t right    = left + 1;
+
+        if (left < mTimers.size() && mTimers[left]->mTimeout < mTimers[earliest]->mTimeout)
+        {
+            earliest = left;
+        }
+
+        if (right < mTimers.size() && mTimers[right]->mTimeout < mTimers[earliest]->mTimeout)
+        {
+            earliest = right;
+        }
+
+        if (earliest == aIndex)
         {
-            mTimers.erase(it);
-            delete &aTimer;
             break;
         }
+
+        SwapTimers(aIndex, earliest);
+        aIndex = earliest;
     }
 }
 
+void AvahiPoller::SwapTimers(size_t aIndex1, size_t aIndex2)
+{
+    std::swap(mTimers[aIndex1], mTimers[aIndex2]);
+    mTimers[aIndex1]->mHeapIndex = aIndex1;
+    mTimers[aIndex2]->mHeapIndex = aIndex2;
+}
+
 void AvahiPoller::Update(MainloopContext &aMainloop)
 {
     Timepoint now = Clock::now();
@@ -349,19 +441,13 @@ void AvahiPoller::Update(MainloopContext &aMainloop)
         watch->mHappened = 0;
     }
 
-    for (AvahiTimeout *timer : mTimers)
+    if (!mTimers.empty())
     {
-        Timepoint timeout = timer->mTimeout;
-
-        if (timeout == Timepoint::min())
-        {
-            continue;
-        }
+        Timepoint timeout = mTimers.front()->mTimeout;
 
         if (timeout <= now)
         {
             aMainloop.mTimeout = ToTimeval(Microseconds::zero());
-            break;
         }
         else
         {
@@ -377,8 +463,7 @@ void AvahiPoller::Update(MainloopContext &aMainloop)
 
 void AvahiPoller::Process(const MainloopContext &aMainloop)
 {
-    Timepoint now          = Clock::now();
-    bool      shouldReport = false;
+    Timepoint now = Clock::now();
 
     for (AvahiWatch *watch : mWatches)
     {
@@ -405,7 +490,7 @@ void AvahiPoller::Process(const MainloopContext &aMainloop)
         if (watch->mHappened != 0)
         {
             watch->mShouldReport = true;
-            shouldReport         = true;
+            mWatchesToReport.push_back(watch);
         }
     }
 
@@ -413,57 +498,43 @@ void AvahiPoller::Process(const MainloopContext &aMainloop)
     // the Avahi module can call any of `mAvahiPoll` APIs we provided to
     // it. For example, it can update or free any of `AvahiWatch/Timeout`
     // entries, which in turn, modifies our `mWatches` or `mTimers` list.
-    // So, before invoking the callback, we update the entry's state and
-    // then restart the iteration over the `mWacthes` list to find the
-    // next entry to report, as the list may have changed.
+    // So, the entries to report are collected first. An entry which is
+    // freed before it is reported is cleared from the collected ones.
 
-    while (shouldReport)
+    for (AvahiWatch *watch : mWatchesToReport)
     {
-        shouldReport = false;
-
-        for (AvahiWatch *watch : mWatches)
+        if (watch != nullptr && watch->mShouldReport)
         {
-            if (watch->mShouldReport)
-            {
-                shouldReport         = true;
-                watch->mShouldReport = false;
-                watch->mCallback(watch, watch->mFd, WatchGetEvents(watch), watch->mContext);
-
-                break;
-            }
+            watch->mShouldReport = false;
+            watch->mCallback(watch, watch->mFd, WatchGetEvents(watch), watch->mContext);
         }
     }
 
-    for (AvahiTimeout *timer : mTimers)
+    mWatchesToReport.clear();
+
+    // An expired timer is disabled before it is reported, like it is
+    // done by the Avahi simple poll, until the callback updates it.
+
+    while (!mTimers.empty() && mTimers.front()->mTimeout <= now)
     {
-        if (timer->mTimeout == Timepoint::min())
-        {
-            continue;
-        }
+        AvahiTimeout *timer = mTimers.front();
 
-        if (timer->mTimeout <= now)
-        {
-            timer->mShouldReport = true;
-            shouldReport         = true;
-        }
+        UnscheduleTimer(*timer);
+        timer->mTimeout      = Timepoint::min();
+        timer->mShouldReport = true;
+        mTimersToReport.push_back(timer);
     }
 
-    while (shouldReport)
+    for (AvahiTimeout *timer : mTimersToReport)
     {
-        shouldReport = false;
-
-        for (AvahiTimeout *timer : mTimers)
+        if (timer != nullptr && timer->mShouldReport)
         {
-            if (timer->mShouldReport)
-            {
-                shouldReport         = true;
-                timer->mShouldReport = false;
-                timer->mCallback(timer, timer->mContext);
-
-                break;
-            }
+            timer->mShouldReport = false;
+            timer->mCallback(timer, timer->mContext);
         }
     }
+
+    mTimersToReport.clear();
 }
 
 PublisherAvahi::PublisherAvahi(StateCallback aStateCallback)
@@ -479,21 +550,6 @@ PublisherAvahi::~PublisherAvahi(void)
     Stop();
 }
 
-PublisherAvahi::AvahiServiceRegistration::~AvahiServiceRegistration(void)
-{
-    ReleaseGroup(mEntryGroup);
-}
-
-PublisherAvahi::AvahiHostRegistration::~AvahiHostRegistration(void)
-{
-    ReleaseGroup(mEntryGroup);
-}
-
-PublisherAvahi::AvahiKeyRegistration::~AvahiKeyRegistration(void)
-{
-    ReleaseGroup(mEntryGroup);
-}
-
 otbrError PublisherAvahi::Start(void)
 {
     otbrError error      = OTBR_ERROR_NONE;
@@ -521,9 +577,11 @@ void PublisherAvahi::Stop(void)
 {
     mServiceRegistrations.clear();
     mHostRegistrations.clear();
+    mKeyRegistrations.clear();
 
     mSubscribedServices.clear();
     mSubscribedHosts.clear();
+    ClearDiscoveryCache();
 
     if (mClient)
     {
@@ -572,47 +630,161 @@ void PublisherAvahi::HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupSt
 
 void PublisherAvahi::CallHostOrServiceCallback(AvahiEntryGroup *aGroup, otbrError aError)
 {
+    KeyRegistration     *keyReg;
     ServiceRegistration *serviceReg;
     HostRegistration    *hostReg;
-    KeyRegistration     *keyReg;
+    bool                 found = true;
 
-    if ((serviceReg = FindServiceRegistration(aGroup)) != nullptr)
+    if ((keyReg = FindKeyRegistration(aGroup)) != nullptr)
     {
         if (aError == OTBR_ERROR_NONE)
         {
-            serviceReg->Complete(aError);
+            keyReg->Complete(aError);
         }
         else
         {
-            RemoveServiceRegistration(serviceReg->mName, serviceReg->mType, aError);
+            RemoveKeyRegistration(keyReg->mName, aError);
         }
     }
-    else if ((hostReg = FindHostRegistration(aGroup)) != nullptr)
+    else if (aError == OTBR_ERROR_NONE)
     {
-        if (aError == OTBR_ERROR_NONE)
+        // A host and its services may share the group. Look up the next service
+        // each time since the callbacks are free to update the registrations.
+        found = (mEntryGroupMembers.find(aGroup) != mEntryGroupMembers.end());
+
+        while ((serviceReg = FindIncompleteServiceRegistration(aGroup)) != nullptr)
         {
-            hostReg->Complete(aError);
+            serviceReg->Complete(aError);
         }
-        else
+
+        if ((hostReg = FindHostRegistration(aGroup)) != nullptr)
         {
-            RemoveHostRegistration(hostReg->mName, aError);
+            hostReg->Complete(aError);
         }
     }
-    else if ((keyReg = FindKeyRegistration(aGroup)) != nullptr)
+    else
     {
-        if (aError == OTBR_ERROR_NONE)
+        found = RemoveGroupRegistrations(aGroup, aError);
+    }
+
+    if (!found)
+    {
+        otbrLogWarning("No registered service or host matches avahi group @%p", aGroup);
+    }
+}
+
+bool PublisherAvahi::RemoveGroupRegistrations(const AvahiEntryGroup *aEntryGroup, otbrError aError)
+{
+    ServiceRegistration *serviceReg;
+    HostRegistration    *hostReg;
+    bool                 found = false;
+
+    while ((serviceReg = FindServiceRegistration(aEntryGroup)) != nullptr)
+    {
+        found = true;
+        RemoveServiceRegistration(serviceReg->mName, serviceReg->mType, aError);
+    }
+
+    while ((hostReg = FindHostRegistration(aEntryGroup)) != nullptr)
+    {
+        found = true;
+        RemoveHostRegistration(hostReg->mName, aError);
+    }
+
+    return found;
+}
+
+void PublisherAvahi::WithdrawServiceRegistration(const std::string &aName, const std::string &aType, otbrError aError)
+{
+    ServiceRegistration *serviceReg = FindServiceRegistration(aName, aType);
+    EntryGroupPtr        group;
+
+    if (serviceReg != nullptr)
+    {
+        group = static_cast<AvahiServiceRegistration *>(serviceReg)->GetSharedEntryGroup();
+    }
+
+    RemoveServiceRegistration(aName, aType, aError);
+    RepublishGroup(std::move(group));
+}
+
+void PublisherAvahi::WithdrawHostRegistration(const std::string &aName, otbrError aError)
+{
+    HostRegistration *hostReg = FindHostRegistration(aName);
+    EntryGroupPtr     group;
+
+    if (hostReg != nullptr)
+    {
+        group = static_cast<AvahiHostRegistration *>(hostReg)->GetSharedEntryGroup();
+    }
+
+    RemoveHostRegistration(aName, aError);
+    RepublishGroup(std::move(group));
+}
+
+void PublisherAvahi::RepublishGroup(EntryGroupPtr aEntryGroup)
+{
+    // Avahi can only withdraw an entry group as a whole. The registrations which
+    // are left in the group are published again, each in an entry group of its own.
+    std::vector<ServiceRegistrationPtr> serviceRegs;
+    std::vector<HostRegistrationPtr>    hostRegs;
+    EntryGroupMembers                   members;
+
+    VerifyOrExit(aEntryGroup != nullptr && aEntryGroup.use_count() > 1);
+
+    VerifyOrExit(mEntryGroupMembers.count(aEntryGroup.get()) > 0);
+
+    // Copy since releasing the entry group updates the index.
+    members = mEntryGroupMembers[aEntryGroup.get()];
+
+    for (AvahiServiceRegistration *serviceReg : members.mServiceRegs)
+    {
+        auto it = mServiceRegistrations.find(DnsNameKey::Find(serviceReg->mName, serviceReg->mType));
+
+        serviceReg->ReleaseEntryGroup();
+
+        if (it != mServiceRegistrations.end() && it->second.get() == serviceReg)
         {
-            keyReg->Complete(aError);
+            serviceRegs.push_back(std::move(it->second));
+            mServiceRegistrations.erase(it);
         }
-        else
+    }
+
+    if (members.mHostReg != nullptr)
+    {
+        auto it = mHostRegistrations.find(DnsNameKey::Find(members.mHostReg->mName));
+
+        members.mHostReg->ReleaseEntryGroup();
+
+        if (it != mHostRegistrations.end() && it->second.get() == members.mHostReg)
         {
-            RemoveKeyRegistration(keyReg->mName, aError);
+            hostRegs.push_back(std::move(it->second));
+            mHostRegistrations.erase(it);
         }
     }
-    else
+
+    // The old records must be gone before they are added again, or they would conflict with themselves.
+    aEntryGroup.reset();
+
+    for (HostRegistrationPtr &hostReg : hostRegs)
     {
-        otbrLogWarning("No registered service or host matches avahi group @%p", aGroup);
+        ResultCallback callback =
+            hostReg->IsCompleted() ? ResultCallback([](otbrError) {}) : std::move(hostReg->mCallback);
+
+        PublishHostImpl(hostReg->mName, hostReg->mAddresses, std::move(callback));
     }
+
+    for (ServiceRegistrationPtr &serviceReg : serviceRegs)
+    {
+        ResultCallback callback =
+            serviceReg->IsCompleted() ? ResultCallback([](otbrError) {}) : std::move(serviceReg->mCallback);
+
+        PublishServiceImpl(serviceReg->mHostName, serviceReg->mName, serviceReg->mType, serviceReg->mSubTypeList,
+                           serviceReg->mPort, serviceReg->mTxtData, std::move(callback));
+    }
+
+exit:
+    return;
 }
 
 AvahiEntryGroup *PublisherAvahi::CreateGroup(AvahiClient *aClient)
@@ -703,10 +875,11 @@ otbrError PublisherAvahi::PublishServiceImpl(const std::string &aHostName,
     otbrError         error             = OTBR_ERROR_NONE;
     int               avahiError        = AVAHI_OK;
     SubTypeList       sortedSubTypeList = SortSubTypeList(aSubTypeList);
-    const std::string logHostName       = !aHostName.empty() ? aHostName : "localhost";
-    std::string       fullHostName;
-    std::string       serviceName = aName;
-    AvahiEntryGroup  *group       = nullptr;
+    const std::string    logHostName       = !aHostName.empty() ? aHostName : "localhost";
+    std::string          fullHostName;
+    std::string          serviceName = aName;
+    AvahiEntryGroup     *group       = nullptr;
+    ServiceRegistration *serviceReg;
 
     // Aligned with AvahiStringList
     AvahiStringList  txtBuffer[(kMaxSizeOfTxtRecord - 1) / sizeof(AvahiStringList) + 1];
@@ -724,6 +897,25 @@ otbrError PublisherAvahi::PublishServiceImpl(const std::string &aHostName,
         serviceName = avahi_client_get_host_name(mClient);
     }
 
+    serviceReg = FindServiceRegistration(serviceName, aType);
+
+    // A published service whose TXT data alone changed is updated in place,
+    // which neither re-probes its name nor withdraws its records.
+    if (serviceReg != nullptr && serviceReg->IsCompleted() &&
+        serviceReg->IsTxtDataOutdatedOnly(aHostName, serviceName, aType, sortedSubTypeList, aPort, aTxtData) &&
+        UpdateServiceTxtData(*static_cast<AvahiServiceRegistration *>(serviceReg), aTxtData) == OTBR_ERROR_NONE)
+    {
+        std::move(aCallback)(OTBR_ERROR_NONE);
+        ExitNow();
+    }
+
+    if (serviceReg != nullptr &&
+        serviceReg->IsOutdated(aHostName, serviceName, aType, sortedSubTypeList, aPort, aTxtData))
+    {
+        otbrLogInfo("Removing existing service %s.%s: outdated", serviceName.c_str(), aType.c_str());
+        WithdrawServiceRegistration(serviceName, aType, OTBR_ERROR_ABORTED);
+    }
+
     aCallback = HandleDuplicateServiceRegistration(aHostName, serviceName, aType, sortedSubTypeList, aPort, aTxtData,
                                                    std::move(aCallback));
     VerifyOrExit(!aCallback.IsNull());
@@ -749,8 +941,9 @@ otbrError PublisherAvahi::PublishServiceImpl(const std::string &aHostName,
     avahiError = avahi_entry_group_commit(group);
     VerifyOrExit(avahiError == AVAHI_OK);
 
-    AddServiceRegistration(std::unique_ptr<AvahiServiceRegistration>(new AvahiServiceRegistration(
-        aHostName, serviceName, aType, sortedSubTypeList, aPort, aTxtData, std::move(aCallback), group, this)));
+    AddServiceRegistration(std::unique_ptr<AvahiServiceRegistration>(
+        new AvahiServiceRegistration(aHostName, serviceName, aType, sortedSubTypeList, aPort, aTxtData,
+                                     std::move(aCallback), EntryGroupPtr(group, ReleaseGroup), this)));
 
 exit:
     if (avahiError != AVAHI_OK || error != OTBR_ERROR_NONE)
@@ -770,12 +963,37 @@ exit:
     return error;
 }
 
-void PublisherAvahi::UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback)
+otbrError PublisherAvahi::UpdateServiceTxtData(AvahiServiceRegistration &aServiceReg, const TxtData &aTxtData)
+{
+    otbrError error      = OTBR_ERROR_NONE;
+    int       avahiError = AVAHI_OK;
+
+    // Aligned with AvahiStringList
+    AvahiStringList  txtBuffer[(kMaxSizeOfTxtRecord - 1) / sizeof(AvahiStringList) + 1];
+    AvahiStringList *txtHead = nullptr;
+
+    SuccessOrExit(error = TxtDataToAvahiStringList(aTxtData, txtBuffer, sizeof(txtBuffer), txtHead));
+    avahiError = avahi_entry_group_update_service_txt_strlst(
+        aServiceReg.GetSharedEntryGroup().get(), AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, AvahiPublishFlags{},
+        aServiceReg.mName.c_str(), aServiceReg.mType.c_str(), /* domain */ nullptr, txtHead);
+    VerifyOrExit(avahiError == AVAHI_OK, error = OTBR_ERROR_MDNS);
+
+    aServiceReg.SetTxtData(aTxtData);
+
+exit:
+    otbrLogResult(error, "Update TXT data of service %s.%s: %s", aServiceReg.mName.c_str(), aServiceReg.mType.c_str(),
+                  avahi_strerror(avahiError));
+    return error;
+}
+
+void PublisherAvahi::UnpublishServiceImpl(const std::string &aName,
+                                          const std::string &aType,
+                                          ResultCallback   &&aCallback)
 {
     otbrError error = OTBR_ERROR_NONE;
 
     VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
-    RemoveServiceRegistration(aName, aType, OTBR_ERROR_ABORTED);
+    WithdrawServiceRegistration(aName, aType, OTBR_ERROR_ABORTED);
 
 exit:
     std::move(aCallback)(error);
@@ -785,14 +1003,21 @@ otbrError PublisherAvahi::PublishHostImpl(const std::string &aName,
                                           const AddressList &aAddresses,
                                           ResultCallback   &&aCallback)
 {
-    otbrError        error      = OTBR_ERROR_NONE;
-    int              avahiError = AVAHI_OK;
-    std::string      fullHostName;
-    AvahiEntryGroup *group = nullptr;
+    otbrError         error      = OTBR_ERROR_NONE;
+    int               avahiError = AVAHI_OK;
+    std::string       fullHostName;
+    AvahiEntryGroup  *group = nullptr;
+    HostRegistration *hostReg;
 
     VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
     VerifyOrExit(mClient != nullptr, error = OTBR_ERROR_INVALID_STATE);
 
+    if ((hostReg = FindHostRegistration(aName)) != nullptr && hostReg->IsOutdated(aName, aAddresses))
+    {
+        otbrLogInfo("Removing existing host %s: outdated", aName.c_str());
+        WithdrawHostRegistration(aName, OTBR_ERROR_ABORTED);
+    }
+
     aCallback = HandleDuplicateHostRegistration(aName, aAddresses, std::move(aCallback));
     VerifyOrExit(!aCallback.IsNull());
     VerifyOrExit(!aAddresses.empty(), std::move(aCallback)(OTBR_ERROR_NONE));
@@ -816,7 +1041,7 @@ otbrError PublisherAvahi::PublishHostImpl(const std::string &aName,
     VerifyOrExit(avahiError == AVAHI_OK);
 
     AddHostRegistration(std::unique_ptr<AvahiHostRegistration>(
-        new AvahiHostRegistration(aName, aAddresses, std::move(aCallback), group, this)));
+        new AvahiHostRegistration(aName, aAddresses, std::move(aCallback), EntryGroupPtr(group, ReleaseGroup), this)));
 
 exit:
     if (avahiError != AVAHI_OK || error != OTBR_ERROR_NONE)
@@ -836,17 +1061,169 @@ exit:
     return error;
 }
 
-void PublisherAvahi::UnpublishHost(const std::string &aName, ResultCallback &&aCallback)
+void PublisherAvahi::UnpublishHostImpl(const std::string &aName, ResultCallback &&aCallback)
 {
     otbrError error = OTBR_ERROR_NONE;
 
     VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
-    RemoveHostRegistration(aName, OTBR_ERROR_ABORTED);
+    WithdrawHostRegistration(aName, OTBR_ERROR_ABORTED);
 
 exit:
     std::move(aCallback)(error);
 }
 
+otbrError PublisherAvahi::PublishHostAndServicesImpl(const std::string       &aHostName,
+                                                     const AddressList       &aAddresses,
+                                                     const HostedServiceList &aServices,
+                                                     ResultCallback         &&aCallback)
+{
+    otbrError                   error      = OTBR_ERROR_NONE;
+    int                         avahiError = AVAHI_OK;
+    std::string                 fullHostName;
+    AvahiEntryGroup            *group = nullptr;
+    HostRegistration           *hostReg;
+    EntryGroupPtr               sharedGroup;
+    std::vector<ResultCallback> callbacks;
+
+    // Aligned with AvahiStringList
+    AvahiStringList  txtBuffer[(kMaxSizeOfTxtRecord - 1) / sizeof(AvahiStringList) + 1];
+    AvahiStringList *txtHead = nullptr;
+
+    VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
+    VerifyOrExit(mClient != nullptr, error = OTBR_ERROR_INVALID_STATE);
+
+    // A host without addresses isn't advertised, and an unchanged transaction only
+    // has to wait for (or report) the result of the published one.
+    VerifyOrExit(!aAddresses.empty() && !IsHostAndServicesPublished(aHostName, aAddresses, aServices),
+                 error = Publisher::PublishHostAndServicesImpl(aHostName, aAddresses, aServices, std::move(aCallback)));
+
+    // The records of the host and all its services are replaced together.
+    if ((hostReg = FindHostRegistration(aHostName)) != nullptr)
+    {
+        otbrLogInfo("Removing existing host %s and its services: outdated", aHostName.c_str());
+        RemoveGroupRegistrations(static_cast<AvahiHostRegistration *>(hostReg)->GetEntryGroup(), OTBR_ERROR_ABORTED);
+    }
+
+    for (const HostedService &service : aServices)
+    {
+        WithdrawServiceRegistration(service.mName, service.mType, OTBR_ERROR_ABORTED);
+    }
+
+    VerifyOrExit((group = CreateGroup(mClient)) != nullptr, error = OTBR_ERROR_MDNS);
+
+    fullHostName = MakeFullHostName(aHostName);
+    for (const auto &address : aAddresses)
+    {
+        AvahiAddress avahiAddress;
+
+        avahiAddress.proto = AVAHI_PROTO_INET6;
+        memcpy(avahiAddress.data.ipv6.address, address.m8, sizeof(address.m8));
+        avahiError = avahi_entry_group_add_address(group, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, AVAHI_PUBLISH_NO_REVERSE,
+                                                   fullHostName.c_str(), &avahiAddress);
+        VerifyOrExit(avahiError == AVAHI_OK);
+    }
+
+    for (const HostedService &service : aServices)
+    {
+        SuccessOrExit(error = TxtDataToAvahiStringList(service.mTxtData, txtBuffer, sizeof(txtBuffer), txtHead));
+        avahiError = avahi_entry_group_add_service_strlst(group, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC,
+                                                          AvahiPublishFlags{}, service.mName.c_str(),
+                                                          service.mType.c_str(), /* domain */ nullptr,
+                                                          fullHostName.c_str(), service.mPort, txtHead);
+        VerifyOrExit(avahiError == AVAHI_OK);
+
+        for (const std::string &subType : service.mSubTypeList)
+        {
+            std::string fullSubType = subType + "._sub." + service.mType;
+
+            avahiError = avahi_entry_group_add_service_subtype(group, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC,
+                                                               AvahiPublishFlags{}, service.mName.c_str(),
+                                                               service.mType.c_str(), /* domain */ nullptr,
+                                                               fullSubType.c_str());
+            VerifyOrExit(avahiError == AVAHI_OK);
+        }
+    }
+
+    otbrLogInfo("Commit avahi host %s with %zu services", aHostName.c_str(), aServices.size());
+    avahiError = avahi_entry_group_commit(group);
+    VerifyOrExit(avahiError == AVAHI_OK);
+
+    sharedGroup = EntryGroupPtr(group, ReleaseGroup);
+    callbacks   = SplitResultCallback(std::move(aCallback), aServices.size() + 1);
+
+    AddHostRegistration(std::unique_ptr<AvahiHostRegistration>(
+        new AvahiHostRegistration(aHostName, aAddresses, std::move(callbacks[0]), sharedGroup, this)));
+
+    for (size_t i = 0; i < aServices.size(); i++)
+    {
+        const HostedService &service = aServices[i];
+
+        AddServiceRegistration(std::unique_ptr<AvahiServiceRegistration>(new AvahiServiceRegistration(
+            aHostName, service.mName, service.mType, SortSubTypeList(service.mSubTypeList), service.mPort,
+            service.mTxtData, std::move(callbacks[i + 1]), sharedGroup, this)));
+    }
+
+exit:
+    if ((avahiError != AVAHI_OK || error != OTBR_ERROR_NONE) && !aCallback.IsNull())
+    {
+        if (avahiError != AVAHI_OK)
+        {
+            error = OTBR_ERROR_MDNS;
+            otbrLogErr("Failed to publish host and services for avahi error: %s!", avahi_strerror(avahiError));
+        }
+
+        if (group != nullptr)
+        {
+            ReleaseGroup(group);
+        }
+        std::move(aCallback)(error);
+    }
+    return error;
+}
+
+void PublisherAvahi::UnpublishHostAndServices(const std::string &aHostName, ResultCallback &&aCallback)
+{
+    HostRegistration *hostReg;
+
+    // Withdraw the host together with the services sharing its entry group, so
+    // that they don't have to be published again one by one.
+    if (mState == Publisher::State::kReady && (hostReg = FindHostRegistration(aHostName)) != nullptr)
+    {
+        RemoveGroupRegistrations(static_cast<AvahiHostRegistration *>(hostReg)->GetEntryGroup(), OTBR_ERROR_ABORTED);
+    }
+
+    Publisher::UnpublishHostAndServices(aHostName, std::move(aCallback));
+}
+
+bool PublisherAvahi::IsHostAndServicesPublished(const std::string       &aHostName,
+                                                const AddressList       &aAddresses,
+                                                const HostedServiceList &aServices)
+{
+    bool                   published = false;
+    HostRegistration      *hostReg   = FindHostRegistration(aHostName);
+    const AvahiEntryGroup *group;
+
+    VerifyOrExit(hostReg != nullptr && !hostReg->IsOutdated(aHostName, aAddresses));
+    group = static_cast<AvahiHostRegistration *>(hostReg)->GetEntryGroup();
+
+    for (const HostedService &service : aServices)
+    {
+        ServiceRegistration *serviceReg = FindServiceRegistration(service.mName, service.mType);
+
+        VerifyOrExit(serviceReg != nullptr &&
+                     static_cast<AvahiServiceRegistration *>(serviceReg)->GetEntryGroup() == group);
+        VerifyOrExit(!serviceReg->IsOutdated(aHostName, service.mName, service.mType,
+                                             SortSubTypeList(service.mSubTypeList), service.mPort, service.mTxtData));
+    }
+
+    // The group must not hold any service which has been dropped from the host.
+    published = static_cast<AvahiHostRegistration *>(hostReg)->GetSharedEntryGroup().use_count() ==
+                static_cast<long>(aServices.size() + 1);
+
+exit:
+    return published;
+}
+
 otbrError PublisherAvahi::PublishKeyImpl(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback)
 {
     otbrError        error      = OTBR_ERROR_NONE;
@@ -874,7 +1251,7 @@ otbrError PublisherAvahi::PublishKeyImpl(const std::string &aName, const KeyData
     VerifyOrExit(avahiError == AVAHI_OK);
 
     AddKeyRegistration(std::unique_ptr<AvahiKeyRegistration>(
-        new AvahiKeyRegistration(aName, aKeyData, std::move(aCallback), group, this)));
+        new AvahiKeyRegistration(aName, aKeyData, std::move(aCallback), EntryGroupPtr(group, ReleaseGroup), this)));
 
 exit:
     if (avahiError != AVAHI_OK || error != OTBR_ERROR_NONE)
@@ -894,7 +1271,7 @@ exit:
     return error;
 }
 
-void PublisherAvahi::UnpublishKey(const std::string &aName, ResultCallback &&aCallback)
+void PublisherAvahi::UnpublishKeyImpl(const std::string &aName, ResultCallback &&aCallback)
 {
     otbrError error = OTBR_ERROR_NONE;
 
@@ -952,62 +1329,147 @@ exit:
     return error;
 }
 
-Publisher::ServiceRegistration *PublisherAvahi::FindServiceRegistration(const AvahiEntryGroup *aEntryGroup)
+void PublisherAvahi::AvahiServiceRegistration::ReleaseEntryGroup(void)
 {
-    ServiceRegistration *result = nullptr;
+    VerifyOrExit(mEntryGroup != nullptr);
+    static_cast<PublisherAvahi *>(mPublisher)->RemoveEntryGroupMember(*this);
+    mEntryGroup.reset();
 
-    for (const auto &kv : mServiceRegistrations)
-    {
-        const auto &serviceReg = static_cast<const AvahiServiceRegistration &>(*kv.second);
-        if (serviceReg.GetEntryGroup() == aEntryGroup)
-        {
-            result = kv.second.get();
-            break;
-        }
-    }
+exit:
+    return;
+}
 
-    return result;
+void PublisherAvahi::AvahiHostRegistration::ReleaseEntryGroup(void)
+{
+    VerifyOrExit(mEntryGroup != nullptr);
+    static_cast<PublisherAvahi *>(mPublisher)->RemoveEntryGroupMember(*this);
+    mEntryGroup.reset();
+
+exit:
+    return;
 }
 
-Publisher::HostRegistration *PublisherAvahi::FindHostRegistration(const AvahiEntryGroup *aEntryGroup)
+void PublisherAvahi::AvahiKeyRegistration::ReleaseEntryGroup(void)
+{
+    VerifyOrExit(mEntryGroup != nullptr);
+    static_cast<PublisherAvahi *>(mPublisher)->RemoveEntryGroupMember(*this);
+    mEntryGroup.reset();
+
+exit:
+    return;
+}
+
+void PublisherAvahi::AddEntryGroupMember(AvahiServiceRegistration &aServiceReg)
+{
+    mEntryGroupMembers[aServiceReg.GetEntryGroup()].mServiceRegs.push_back(&aServiceReg);
+}
+
+void PublisherAvahi::AddEntryGroupMember(AvahiHostRegistration &aHostReg)
+{
+    mEntryGroupMembers[aHostReg.GetEntryGroup()].mHostReg = &aHostReg;
+}
+
+void PublisherAvahi::AddEntryGroupMember(AvahiKeyRegistration &aKeyReg)
+{
+    mEntryGroupMembers[aKeyReg.GetEntryGroup()].mKeyReg = &aKeyReg;
+}
+
+void PublisherAvahi::RemoveEntryGroupMember(AvahiServiceRegistration &aServiceReg)
+{
+    auto it = mEntryGroupMembers.find(aServiceReg.GetEntryGroup());
+
+    VerifyOrExit(it != mEntryGroupMembers.end());
+    it->second.mServiceRegs.erase(
+        std::remove(it->second.mServiceRegs.begin(), it->second.mServiceRegs.end(), &aServiceReg),
+        it->second.mServiceRegs.end());
+    EraseEntryGroupMembersIfEmpty(aServiceReg.GetEntryGroup());
+
+exit:
+    return;
+}
+
+void PublisherAvahi::RemoveEntryGroupMember(AvahiHostRegistration &aHostReg)
 {
-    HostRegistration *result = nullptr;
+    auto it = mEntryGroupMembers.find(aHostReg.GetEntryGroup());
 
-    for (const auto &kv : mHostRegistrations)
+    VerifyOrExit(it != mEntryGroupMembers.end() && it->second.mHostReg == &aHostReg);
+    it->second.mHostReg = nullptr;
+    EraseEntryGroupMembersIfEmpty(aHostReg.GetEntryGroup());
+
+exit:
+    return;
+}
+
+void PublisherAvahi::RemoveEntryGroupMember(AvahiKeyRegistration &aKeyReg)
+{
+    auto it = mEntryGroupMembers.find(aKeyReg.GetEntryGroup());
+
+    VerifyOrExit(it != mEntryGroupMembers.end() && it->second.mKeyReg == &aKeyReg);
+    it->second.mKeyReg = nullptr;
+    EraseEntryGroupMembersIfEmpty(aKeyReg.GetEntryGroup());
+
+exit:
+    return;
+}
+
+void PublisherAvahi::EraseEntryGroupMembersIfEmpty(const AvahiEntryGroup *aEntryGroup)
+{
+    auto it = mEntryGroupMembers.find(aEntryGroup);
+
+    if (it != mEntryGroupMembers.end() && it->second.IsEmpty())
     {
-        const auto &hostReg = static_cast<const AvahiHostRegistration &>(*kv.second);
-        if (hostReg.GetEntryGroup() == aEntryGroup)
-        {
-            result = kv.second.get();
-            break;
-        }
+        mEntryGroupMembers.erase(it);
     }
+}
 
-    return result;
+Publisher::ServiceRegistration *PublisherAvahi::FindServiceRegistration(const AvahiEntryGroup *aEntryGroup)
+{
+    auto it = mEntryGroupMembers.find(aEntryGroup);
+
+    return (it == mEntryGroupMembers.end() || it->second.mServiceRegs.empty()) ? nullptr
+                                                                                : it->second.mServiceRegs.front();
 }
 
-Publisher::KeyRegistration *PublisherAvahi::FindKeyRegistration(const AvahiEntryGroup *aEntryGroup)
+Publisher::ServiceRegistration *PublisherAvahi::FindIncompleteServiceRegistration(const AvahiEntryGroup *aEntryGroup)
 {
-    KeyRegistration *result = nullptr;
+    ServiceRegistration *result = nullptr;
+    auto                 it     = mEntryGroupMembers.find(aEntryGroup);
+
+    VerifyOrExit(it != mEntryGroupMembers.end());
 
-    for (const auto &entry : mKeyRegistrations)
+    for (AvahiServiceRegistration *serviceReg : it->second.mServiceRegs)
     {
-        const auto &keyReg = static_cast<const AvahiKeyRegistration &>(*entry.second);
-        if (keyReg.GetEntryGroup() == aEntryGroup)
+        if (!serviceReg->IsCompleted())
         {
-            result = entry.second.get();
+            result = serviceReg;
             break;
         }
     }
 
+exit:
     return result;
 }
 
-void PublisherAvahi::SubscribeService(const std::string &aType, const std::string &aInstanceName)
+Publisher::HostRegistration *PublisherAvahi::FindHostRegistration(const AvahiEntryGroup *aEntryGroup)
 {
-    auto service = MakeUnique<ServiceSubscription>(*this, aType, aInstanceName);
+    auto it = mEntryGroupMembers.find(aEntryGroup);
 
-    VerifyOrExit(mState == Publisher::State::kReady);
+    return (it == mEntryGroupMembers.end()) ? nullptr : it->second.mHostReg;
+}
+
+Publisher::KeyRegistration *PublisherAvahi::FindKeyRegistration(const AvahiEntryGroup *aEntryGroup)
+{
+    auto it = mEntryGroupMembers.find(aEntryGroup);
+
+    return (it == mEntryGroupMembers.end()) ? nullptr : it->second.mKeyReg;
+}
+
+otbrError PublisherAvahi::SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName)
+{
+    otbrError error   = OTBR_ERROR_NONE;
+    auto      service = MakeUnique<ServiceSubscription>(*this, aType, aInstanceName);
+
+    VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
     mSubscribedServices.push_back(std::move(service));
 
     otbrLogInfo("Subscribe service %s.%s (total %zu)", aInstanceName.c_str(), aType.c_str(),
@@ -1023,10 +1485,10 @@ void PublisherAvahi::SubscribeService(const std::string &aType, const std::strin
     }
 
 exit:
-    return;
+    return error;
 }
 
-void PublisherAvahi::UnsubscribeService(const std::string &aType, const std::string &aInstanceName)
+void PublisherAvahi::UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName)
 {
     ServiceSubscriptionList::iterator it;
 
@@ -1070,11 +1532,12 @@ otbrError PublisherAvahi::DnsErrorToOtbrError(int32_t aErrorCode)
     return otbr::Mdns::DnsErrorToOtbrError(aErrorCode);
 }
 
-void PublisherAvahi::SubscribeHost(const std::string &aHostName)
+otbrError PublisherAvahi::SubscribeHostImpl(const std::string &aHostName)
 {
-    auto host = MakeUnique<HostSubscription>(*this, aHostName);
+    otbrError error = OTBR_ERROR_NONE;
+    auto      host  = MakeUnique<HostSubscription>(*this, aHostName);
 
-    VerifyOrExit(mState == Publisher::State::kReady);
+    VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
 
     mSubscribedHosts.push_back(std::move(host));
 
@@ -1083,10 +1546,10 @@ void PublisherAvahi::SubscribeHost(const std::string &aHostName)
     mSubscribedHosts.back()->Resolve();
 
 exit:
-    return;
+    return error;
 }
 
-void PublisherAvahi::UnsubscribeHost(const std::string &aHostName)
+void PublisherAvahi::UnsubscribeHostImpl(const std::string &aHostName)
 {
     HostSubscriptionList::iterator it;
 
@@ -1213,7 +1676,7 @@ void PublisherAvahi::ServiceSubscription::Resolve(uint32_t           aInterfaceI
 {
     auto serviceResolver = MakeUnique<ServiceResolver>();
 
-    mPublisherAvahi->mServiceInstanceResolutionBeginTime[std::make_pair(aInstanceName, aType)] = Clock::now();
+    mPublisherAvahi->mServiceInstanceResolutionBeginTime[std::make_pair(aInstanceName, aType)] = CoarseClock::Now();
 
     otbrLogInfo("Resolve service %s.%s inf %" PRIu32, aInstanceName.c_str(), aType.c_str(), aInterfaceIndex);
 
@@ -1391,7 +1854,7 @@ void PublisherAvahi::ServiceResolver::HandleResolveHostResult(AvahiRecordBrowser
     VerifyOrExit(!address.IsLinkLocal() && !address.IsMulticast() && !address.IsLoopback() && !address.IsUnspecified(),
                  avahiError = AVAHI_ERR_INVALID_ADDRESS);
     otbrLogInfo("Resolved host address: %s %s", aEvent == AVAHI_BROWSER_NEW ? "add" : "remove",
-                address.ToString().c_str());
+                address.ToInfoString().AsCString());
     if (aEvent == AVAHI_BROWSER_NEW)
     {
         mInstanceInfo.AddAddress(address);
@@ -1456,7 +1919,7 @@ void PublisherAvahi::HostSubscription::Resolve(void)
 {
     std::string fullHostName = MakeFullHostName(mHostName);
 
-    mPublisherAvahi->mHostResolutionBeginTime[mHostName] = Clock::now();
+    mPublisherAvahi->mHostResolutionBeginTime[mHostName] = CoarseClock::Now();
 
     otbrLogInfo("Resolve host %s inf %d", fullHostName.c_str(), static_cast<int>(AVAHI_IF_UNSPEC));
     mRecordBrowser = avahi_record_browser_new(mPublisherAvahi->mClient, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC,
@@ -1522,7 +1985,7 @@ void PublisherAvahi::HostSubscription::HandleResolveResult(AvahiRecordBrowser
     VerifyOrExit(!address.IsLinkLocal() && !address.IsMulticast() && !address.IsLoopback() && !address.IsUnspecified(),
                  avahiError = AVAHI_ERR_INVALID_ADDRESS);
     otbrLogInfo("Resolved host address: %s %s", aEvent == AVAHI_BROWSER_NEW ? "add" : "remove",
-                address.ToString().c_str());
+                address.ToInfoString().AsCString());
 
     mHostInfo.mHostName = std::string(aName) + ".";
     if (aEvent == AVAHI_BROWSER_NEW)
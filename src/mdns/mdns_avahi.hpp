@@ -38,6 +38,7 @@
 
 #include <memory>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 #include <avahi-client/client.h>
@@ -69,19 +70,13 @@ class AvahiPoller;
 /**
  * This class implements mDNS publisher with avahi.
  */
-class PublisherAvahi : public Publisher
+class PublisherAvahi final : public Publisher
 {
 public:
     PublisherAvahi(StateCallback aStateCallback);
     ~PublisherAvahi(void) override;
 
-    void      UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback) override;
-    void      UnpublishHost(const std::string &aName, ResultCallback &&aCallback) override;
-    void      UnpublishKey(const std::string &aName, ResultCallback &&aCallback) override;
-    void      SubscribeService(const std::string &aType, const std::string &aInstanceName) override;
-    void      UnsubscribeService(const std::string &aType, const std::string &aInstanceName) override;
-    void      SubscribeHost(const std::string &aHostName) override;
-    void      UnsubscribeHost(const std::string &aHostName) override;
+    void      UnpublishHostAndServices(const std::string &aHostName, ResultCallback &&aCallback) override;
     otbrError Start(void) override;
     bool      IsStarted(void) const override;
     void      Stop(void) override;
@@ -98,6 +93,19 @@ protected:
                               const AddressList &aAddresses,
                               ResultCallback   &&aCallback) override;
     otbrError PublishKeyImpl(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback) override;
+    void      UnpublishServiceImpl(const std::string &aName,
+                                   const std::string &aType,
+                                   ResultCallback   &&aCallback) override;
+    void      UnpublishHostImpl(const std::string &aName, ResultCallback &&aCallback) override;
+    void      UnpublishKeyImpl(const std::string &aName, ResultCallback &&aCallback) override;
+    otbrError SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override;
+    void      UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override;
+    otbrError SubscribeHostImpl(const std::string &aHostName) override;
+    void      UnsubscribeHostImpl(const std::string &aHostName) override;
+    otbrError PublishHostAndServicesImpl(const std::string       &aHostName,
+                                         const AddressList       &aAddresses,
+                                         const HostedServiceList &aServices,
+                                         ResultCallback         &&aCallback) override;
     void      OnServiceResolveFailedImpl(const std::string &aType,
                                          const std::string &aInstanceName,
                                          int32_t            aErrorCode) override;
@@ -109,6 +117,10 @@ private:
     static constexpr uint32_t kDefaultTtl         = 10; // In seconds.
     static constexpr uint16_t kDnsKeyRecordType   = 25;
 
+    // A host and its services published in one transaction share the same entry group,
+    // which is released when the last of their registrations goes away.
+    using EntryGroupPtr = std::shared_ptr<AvahiEntryGroup>;
+
     class AvahiServiceRegistration : public ServiceRegistration
     {
     public:
@@ -119,7 +131,7 @@ private:
                                  uint16_t           aPort,
                                  const TxtData     &aTxtData,
                                  ResultCallback   &&aCallback,
-                                 AvahiEntryGroup   *aEntryGroup,
+                                 EntryGroupPtr      aEntryGroup,
                                  PublisherAvahi    *aPublisher)
             : ServiceRegistration(aHostName,
                                   aName,
@@ -129,15 +141,19 @@ private:
                                   aTxtData,
                                   std::move(aCallback),
                                   aPublisher)
-            , mEntryGroup(aEntryGroup)
+            , mEntryGroup(std::move(aEntryGroup))
         {
+            aPublisher->AddEntryGroupMember(*this);
         }
 
-        ~AvahiServiceRegistration(void) override;
-        const AvahiEntryGroup *GetEntryGroup(void) const { return mEntryGroup; }
+        ~AvahiServiceRegistration(void) override { ReleaseEntryGroup(); }
+
+        const AvahiEntryGroup *GetEntryGroup(void) const { return mEntryGroup.get(); }
+        const EntryGroupPtr   &GetSharedEntryGroup(void) const { return mEntryGroup; }
+        void                   ReleaseEntryGroup(void);
 
     private:
-        AvahiEntryGroup *mEntryGroup;
+        EntryGroupPtr mEntryGroup;
     };
 
     class AvahiHostRegistration : public HostRegistration
@@ -146,18 +162,22 @@ private:
         AvahiHostRegistration(const std::string &aName,
                               const AddressList &aAddresses,
                               ResultCallback   &&aCallback,
-                              AvahiEntryGroup   *aEntryGroup,
+                              EntryGroupPtr      aEntryGroup,
                               PublisherAvahi    *aPublisher)
             : HostRegistration(aName, aAddresses, std::move(aCallback), aPublisher)
-            , mEntryGroup(aEntryGroup)
+            , mEntryGroup(std::move(aEntryGroup))
         {
+            aPublisher->AddEntryGroupMember(*this);
         }
 
-        ~AvahiHostRegistration(void) override;
-        const AvahiEntryGroup *GetEntryGroup(void) const { return mEntryGroup; }
+        ~AvahiHostRegistration(void) override { ReleaseEntryGroup(); }
+
+        const AvahiEntryGroup *GetEntryGroup(void) const { return mEntryGroup.get(); }
+        const EntryGroupPtr   &GetSharedEntryGroup(void) const { return mEntryGroup; }
+        void                   ReleaseEntryGroup(void);
 
     private:
-        AvahiEntryGroup *mEntryGroup;
+        EntryGroupPtr mEntryGroup;
     };
 
     class AvahiKeyRegistration : public KeyRegistration
@@ -166,18 +186,32 @@ private:
         AvahiKeyRegistration(const std::string &aName,
                              const KeyData     &aKeyData,
                              ResultCallback   &&aCallback,
-                             AvahiEntryGroup   *aEntryGroup,
+                             EntryGroupPtr      aEntryGroup,
                              PublisherAvahi    *aPublisher)
             : KeyRegistration(aName, aKeyData, std::move(aCallback), aPublisher)
-            , mEntryGroup(aEntryGroup)
+            , mEntryGroup(std::move(aEntryGroup))
         {
+            aPublisher->AddEntryGroupMember(*this);
         }
 
-        ~AvahiKeyRegistration(void) override;
-        const AvahiEntryGroup *GetEntryGroup(void) const { return mEntryGroup; }
+        ~AvahiKeyRegistration(void) override { ReleaseEntryGroup(); }
+
+        const AvahiEntryGroup *GetEntryGroup(void) const { return mEntryGroup.get(); }
+        void                   ReleaseEntryGroup(void);
 
     private:
-        AvahiEntryGroup *mEntryGroup;
+        EntryGroupPtr mEntryGroup;
+    };
+
+    // Reverse index from an entry group to the registrations sharing it, so that
+    // the entry group callbacks don't need to scan all the registrations.
+    struct EntryGroupMembers
+    {
+        std::vector<AvahiServiceRegistration *> mServiceRegs;
+        AvahiHostRegistration                  *mHostReg = nullptr;
+        AvahiKeyRegistration                   *mKeyReg  = nullptr;
+
+        bool IsEmpty(void) const { return mServiceRegs.empty() && mHostReg == nullptr && mKeyReg == nullptr; }
     };
 
     struct Subscription : private ::NonCopyable
@@ -367,7 +401,28 @@ private:
                                               size_t            aBufferSize,
                                               AvahiStringList *&aHead);
 
+    bool IsHostAndServicesPublished(const std::string       &aHostName,
+                                    const AddressList       &aAddresses,
+                                    const HostedServiceList &aServices);
+    bool RemoveGroupRegistrations(const AvahiEntryGroup *aEntryGroup, otbrError aError);
+    otbrError UpdateServiceTxtData(AvahiServiceRegistration &aServiceReg, const TxtData &aTxtData);
+    void WithdrawServiceRegistration(const std::string &aName, const std::string &aType, otbrError aError);
+    void WithdrawHostRegistration(const std::string &aName, otbrError aError);
+    void RepublishGroup(EntryGroupPtr aEntryGroup);
+
+    using Publisher::FindHostRegistration;
+    using Publisher::FindServiceRegistration;
+
+    void AddEntryGroupMember(AvahiServiceRegistration &aServiceReg);
+    void AddEntryGroupMember(AvahiHostRegistration &aHostReg);
+    void AddEntryGroupMember(AvahiKeyRegistration &aKeyReg);
+    void RemoveEntryGroupMember(AvahiServiceRegistration &aServiceReg);
+    void RemoveEntryGroupMember(AvahiHostRegistration &aHostReg);
+    void RemoveEntryGroupMember(AvahiKeyRegistration &aKeyReg);
+    void EraseEntryGroupMembersIfEmpty(const AvahiEntryGroup *aEntryGroup);
+
     ServiceRegistration *FindServiceRegistration(const AvahiEntryGroup *aEntryGroup);
+    ServiceRegistration *FindIncompleteServiceRegistration(const AvahiEntryGroup *aEntryGroup);
     HostRegistration    *FindHostRegistration(const AvahiEntryGroup *aEntryGroup);
     KeyRegistration     *FindKeyRegistration(const AvahiEntryGroup *aEntryGroup);
 
@@ -378,6 +433,8 @@ private:
 
     ServiceSubscriptionList mSubscribedServices;
     HostSubscriptionList    mSubscribedHosts;
+
+    std::unordered_map<const AvahiEntryGroup *, EntryGroupMembers> mEntryGroupMembers;
 };
 
 } // namespace Mdns
@@ -49,6 +49,7 @@
 #include "common/code_utils.hpp"
 #include "common/dns_utils.hpp"
 #include "common/logging.hpp"
+#include "common/mainloop_manager.hpp"
 #include "common/time.hpp"
 
 namespace otbr {
@@ -214,7 +215,7 @@ static const char *DNSErrorToString(DNSServiceErrorType aError)
 }
 
 PublisherMDnsSd::PublisherMDnsSd(StateCallback aCallback)
-    : mHostsRef(nullptr)
+    : mSharedRef(nullptr)
     , mState(State::kIdle)
     , mStateCallback(std::move(aCallback))
 {
@@ -243,9 +244,10 @@ void PublisherMDnsSd::Stop(StopMode aStopMode)
 
     // If we get a `kDNSServiceErr_ServiceNotRunning` and need to
     // restart the `Publisher`, we should immediately de-allocate
-    // all `ServiceRef`. Otherwise, we first clear the `Registrations`
-    // list so that `DnssdHostRegisteration` destructor gets the chance
-    // to update registered records if needed.
+    // the shared connection, which frees all `ServiceRef` along with
+    // it. Otherwise, we first clear the `Registrations` list so that
+    // `DnssdHostRegisteration` destructor gets the chance to update
+    // registered records if needed.
 
     switch (aStopMode)
     {
@@ -253,17 +255,19 @@ void PublisherMDnsSd::Stop(StopMode aStopMode)
         break;
 
     case kStopOnServiceNotRunningError:
-        DeallocateHostsRef();
+        DeallocateSharedRef();
         break;
     }
 
     mServiceRegistrations.clear();
     mHostRegistrations.clear();
     mKeyRegistrations.clear();
-    DeallocateHostsRef();
 
     mSubscribedServices.clear();
     mSubscribedHosts.clear();
+    ClearDiscoveryCache();
+
+    DeallocateSharedRef();
 
     mState = State::kIdle;
 
@@ -271,170 +275,77 @@ exit:
     return;
 }
 
-DNSServiceErrorType PublisherMDnsSd::CreateSharedHostsRef(void)
+DNSServiceErrorType PublisherMDnsSd::CreateSharedRef(void)
 {
     DNSServiceErrorType dnsError = kDNSServiceErr_NoError;
 
-    VerifyOrExit(mHostsRef == nullptr);
+    VerifyOrExit(mSharedRef == nullptr);
 
-    dnsError = DNSServiceCreateConnection(&mHostsRef);
-    otbrLogDebug("Created new shared DNSServiceRef: %p", mHostsRef);
+    dnsError = DNSServiceCreateConnection(&mSharedRef);
+    otbrLogDebug("Created new shared DNSServiceRef: %p", mSharedRef);
+    VerifyOrExit(dnsError == kDNSServiceErr_NoError);
+
+    // All operations share one connection to the daemon, so there is a
+    // single socket to watch however many services are advertised.
+    if (MainloopManager::GetInstance().AddFd(DNSServiceRefSockFD(mSharedRef), MainloopContext::kReadFdSet,
+                                             [this](uint8_t) { ProcessResult(); }) != OTBR_ERROR_NONE)
+    {
+        DNSServiceRefDeallocate(mSharedRef);
+        mSharedRef = nullptr;
+        dnsError   = kDNSServiceErr_Unknown;
+    }
 
 exit:
     return dnsError;
 }
 
-void PublisherMDnsSd::DeallocateHostsRef(void)
+void PublisherMDnsSd::DeallocateSharedRef(void)
 {
-    VerifyOrExit(mHostsRef != nullptr);
+    VerifyOrExit(mSharedRef != nullptr);
 
-    HandleServiceRefDeallocating(mHostsRef);
-    DNSServiceRefDeallocate(mHostsRef);
-    otbrLogDebug("Deallocated DNSServiceRef for hosts: %p", mHostsRef);
-    mHostsRef = nullptr;
+    MainloopManager::GetInstance().RemoveFd(DNSServiceRefSockFD(mSharedRef));
+    DNSServiceRefDeallocate(mSharedRef);
+    otbrLogDebug("Deallocated shared DNSServiceRef: %p", mSharedRef);
+    mSharedRef = nullptr;
 
 exit:
     return;
 }
 
-void PublisherMDnsSd::Update(MainloopContext &aMainloop)
+void PublisherMDnsSd::DeallocateSubordinateRef(DNSServiceRef &aServiceRef)
 {
-    for (auto &kv : mServiceRegistrations)
+    // The subordinate `DNSServiceRef`s are freed together with the
+    // shared connection, they must not be de-allocated afterwards.
+    if (aServiceRef != nullptr && mSharedRef != nullptr)
     {
-        auto &serviceReg = static_cast<DnssdServiceRegistration &>(*kv.second);
-
-        serviceReg.Update(aMainloop);
+        DNSServiceRefDeallocate(aServiceRef);
     }
 
-    if (mHostsRef != nullptr)
-    {
-        int fd = DNSServiceRefSockFD(mHostsRef);
-
-        assert(fd != -1);
-
-        aMainloop.AddFdToReadSet(fd);
-    }
-
-    for (const auto &service : mSubscribedServices)
-    {
-        service->UpdateAll(aMainloop);
-    }
-
-    for (const auto &host : mSubscribedHosts)
-    {
-        host->Update(aMainloop);
-    }
+    aServiceRef = nullptr;
 }
 
-void PublisherMDnsSd::Process(const MainloopContext &aMainloop)
+void PublisherMDnsSd::ProcessResult(void)
 {
-    mServiceRefsToProcess.clear();
+    DNSServiceErrorType error;
 
-    for (auto &kv : mServiceRegistrations)
-    {
-        auto &serviceReg = static_cast<DnssdServiceRegistration &>(*kv.second);
+    VerifyOrExit(mSharedRef != nullptr);
 
-        serviceReg.Process(aMainloop, mServiceRefsToProcess);
-    }
+    // The results of all subordinate `DNSServiceRef`s are dispatched
+    // to their callbacks from the shared connection.
+    error = DNSServiceProcessResult(mSharedRef);
 
-    if (mHostsRef != nullptr)
+    if (error != kDNSServiceErr_NoError)
     {
-        int fd = DNSServiceRefSockFD(mHostsRef);
-
-        if (FD_ISSET(fd, &aMainloop.mReadFdSet))
-        {
-            mServiceRefsToProcess.push_back(mHostsRef);
-        }
-    }
-
-    for (const auto &service : mSubscribedServices)
-    {
-        service->ProcessAll(aMainloop, mServiceRefsToProcess);
-    }
-
-    for (const auto &host : mSubscribedHosts)
-    {
-        host->Process(aMainloop, mServiceRefsToProcess);
-    }
-
-    for (DNSServiceRef serviceRef : mServiceRefsToProcess)
-    {
-        DNSServiceErrorType error;
-
-        // As we go through the list of `mServiceRefsToProcess` the call
-        // to `DNSServiceProcessResult()` can itself invoke callbacks
-        // into `PublisherMDnsSd` and OT, which in turn, may change the
-        // state of `Publisher` and potentially trigger a previously
-        // valid `ServiceRef` in the list to be deallocated. We use
-        // `HandleServiceRefDeallocating()` which is called whenever a
-        // `ServiceRef` is being deallocated and from this we update
-        // the entry in `mServiceRefsToProcess` list to `nullptr` so to
-        // avoid calling `DNSServiceProcessResult()` on an already
-        // freed `ServiceRef`.
-
-        if (serviceRef == nullptr)
-        {
-            continue;
-        }
-
-        error = DNSServiceProcessResult(serviceRef);
-
-        if (error != kDNSServiceErr_NoError)
-        {
-            otbrLogLevel logLevel = (error == kDNSServiceErr_BadReference) ? OTBR_LOG_INFO : OTBR_LOG_WARNING;
-            otbrLog(logLevel, OTBR_LOG_TAG, "DNSServiceProcessResult failed: %s (serviceRef = %p)",
-                    DNSErrorToString(error), serviceRef);
-        }
-        if (error == kDNSServiceErr_ServiceNotRunning)
-        {
-            otbrLogWarning("Need to reconnect to mdnsd");
-            Stop(kStopOnServiceNotRunningError);
-            Start();
-            ExitNow();
-        }
+        otbrLogLevel logLevel = (error == kDNSServiceErr_BadReference) ? OTBR_LOG_INFO : OTBR_LOG_WARNING;
+        otbrLog(logLevel, OTBR_LOG_TAG, "DNSServiceProcessResult failed: %s (serviceRef = %p)",
+                DNSErrorToString(error), mSharedRef);
     }
-exit:
-    return;
-}
-
-void PublisherMDnsSd::HandleServiceRefDeallocating(const DNSServiceRef &aServiceRef)
-{
-    for (DNSServiceRef &entry : mServiceRefsToProcess)
+    if (error == kDNSServiceErr_ServiceNotRunning)
     {
-        if (entry == aServiceRef)
-        {
-            entry = nullptr;
-        }
+        otbrLogWarning("Need to reconnect to mdnsd");
+        Stop(kStopOnServiceNotRunningError);
+        Start();
     }
-}
-
-void PublisherMDnsSd::DnssdServiceRegistration::Update(MainloopContext &aMainloop) const
-{
-    int fd;
-
-    VerifyOrExit(mServiceRef != nullptr);
-
-    fd = DNSServiceRefSockFD(mServiceRef);
-    VerifyOrExit(fd != -1);
-
-    aMainloop.AddFdToReadSet(fd);
-
-exit:
-    return;
-}
-
-void PublisherMDnsSd::DnssdServiceRegistration::Process(const MainloopContext      &aMainloop,
-                                                        std::vector<DNSServiceRef> &aReadyServices) const
-{
-    int fd;
-
-    VerifyOrExit(mServiceRef != nullptr);
-
-    fd = DNSServiceRefSockFD(mServiceRef);
-    VerifyOrExit(fd != -1);
-
-    VerifyOrExit(FD_ISSET(fd, &aMainloop.mReadFdSet));
-    aReadyServices.push_back(mServiceRef);
 
 exit:
     return;
@@ -469,10 +380,22 @@ otbrError PublisherMDnsSd::DnssdServiceRegistration::Register(void)
 
     otbrLogInfo("Registering service %s.%s", mName.c_str(), regType.c_str());
 
-    dnsError = DNSServiceRegister(&mServiceRef, kDNSServiceFlagsNoAutoRename, kDNSServiceInterfaceIndexAny,
-                                  serviceNameCString, regType.c_str(),
-                                  /* domain */ nullptr, hostNameCString, htons(mPort), mTxtData.size(), mTxtData.data(),
-                                  HandleRegisterResult, this);
+    dnsError = GetPublisher().CreateSharedRef();
+
+    if (dnsError == kDNSServiceErr_NoError)
+    {
+        DNSServiceRef serviceRef = GetPublisher().mSharedRef;
+
+        dnsError = DNSServiceRegister(&serviceRef, kDNSServiceFlagsShareConnection | kDNSServiceFlagsNoAutoRename,
+                                      kDNSServiceInterfaceIndexAny, serviceNameCString, regType.c_str(),
+                                      /* domain */ nullptr, hostNameCString, htons(mPort), mTxtData.size(),
+                                      mTxtData.data(), HandleRegisterResult, this);
+
+        if (dnsError == kDNSServiceErr_NoError)
+        {
+            mServiceRef = serviceRef;
+        }
+    }
 
     if (dnsError != kDNSServiceErr_NoError)
     {
@@ -487,6 +410,25 @@ otbrError PublisherMDnsSd::DnssdServiceRegistration::Register(void)
     return GetPublisher().DnsErrorToOtbrError(dnsError);
 }
 
+otbrError PublisherMDnsSd::DnssdServiceRegistration::UpdateTxtData(const TxtData &aTxtData)
+{
+    DNSServiceErrorType dnsError = kDNSServiceErr_BadReference;
+
+    VerifyOrExit(mServiceRef != nullptr);
+
+    // A null record reference refers to the TXT record of the service.
+    dnsError = DNSServiceUpdateRecord(mServiceRef, /* aRecordRef */ nullptr, /* flags */ 0, aTxtData.size(),
+                                      aTxtData.data(), /* ttl */ 0);
+    VerifyOrExit(dnsError == kDNSServiceErr_NoError);
+
+    SetTxtData(aTxtData);
+
+exit:
+    otbrLogResult(DNSErrorToOtbrError(dnsError), "Update TXT data of service %s.%s: %s", mName.c_str(), mType.c_str(),
+                  DNSErrorToString(dnsError));
+    return DNSErrorToOtbrError(dnsError);
+}
+
 void PublisherMDnsSd::DnssdServiceRegistration::Unregister(void)
 {
     DnssdKeyRegistration *keyReg = mRelatedKeyReg;
@@ -506,9 +448,7 @@ void PublisherMDnsSd::DnssdServiceRegistration::Unregister(void)
         keyReg->Unregister();
     }
 
-    GetPublisher().HandleServiceRefDeallocating(mServiceRef);
-    DNSServiceRefDeallocate(mServiceRef);
-    mServiceRef = nullptr;
+    GetPublisher().DeallocateSubordinateRef(mServiceRef);
 
     if (keyReg != nullptr)
     {
@@ -564,13 +504,7 @@ otbrError PublisherMDnsSd::DnssdHostRegistration::Register(void)
     {
         DNSRecordRef recordRef = nullptr;
 
-        dnsError = GetPublisher().CreateSharedHostsRef();
-        VerifyOrExit(dnsError == kDNSServiceErr_NoError);
-
-        dnsError = DNSServiceRegisterRecord(GetPublisher().mHostsRef, &recordRef, kDNSServiceFlagsShared,
-                                            kDNSServiceInterfaceIndexAny, MakeFullHostName(mName).c_str(),
-                                            kDNSServiceType_AAAA, kDNSServiceClass_IN, sizeof(address.m8), address.m8,
-                                            /* ttl */ 0, HandleRegisterResult, this);
+        dnsError = RegisterAddressRecord(address, recordRef);
         VerifyOrExit(dnsError == kDNSServiceErr_NoError);
 
         mAddrRecordRefs.push_back(recordRef);
@@ -588,37 +522,110 @@ exit:
 
 void PublisherMDnsSd::DnssdHostRegistration::Unregister(void)
 {
-    DNSServiceErrorType dnsError;
+    for (size_t index = 0; index < mAddrRecordRefs.size(); index++)
+    {
+        RemoveAddressRecord(index);
+    }
 
-    VerifyOrExit(GetPublisher().mHostsRef != nullptr);
+    mAddrRegistered.clear();
+    mAddrRecordRefs.clear();
+}
 
-    for (size_t index = 0; index < mAddrRecordRefs.size(); index++)
+otbrError PublisherMDnsSd::DnssdHostRegistration::UpdateAddresses(const AddressList &aAddresses)
+{
+    AddressList               addresses = SortAddressList(aAddresses);
+    std::vector<DNSRecordRef> recordRefs(addresses.size(), nullptr);
+    std::vector<bool>         registered(addresses.size(), false);
+    DNSServiceErrorType       dnsError = kDNSServiceErr_NoError;
+    otbrError                 error;
+
+    otbrLogInfo("Updating addresses of host %s", mName.c_str());
+
+    // The records of the addresses which are kept are moved over to their new
+    // positions, and only the records of the removed addresses are removed.
+    for (size_t index = 0; index < mAddresses.size(); index++)
     {
-        const Ip6Address &address = mAddresses[index];
+        auto it = std::find(addresses.begin(), addresses.end(), mAddresses[index]);
 
-        if (mAddrRegistered[index])
+        if (it == addresses.end())
+        {
+            RemoveAddressRecord(index);
+        }
+        else
         {
-            // The Bonjour mDNSResponder somehow doesn't send goodbye message for the AAAA record when it is
-            // removed by `DNSServiceRemoveRecord`. Per RFC 6762, a goodbye message of a record sets its TTL
-            // to zero but the receiver should record the TTL of 1 and flushes the cache 1 second later. Here
-            // we remove the AAAA record after updating its TTL to 1 second. This has the same effect as
-            // sending a goodbye message.
-            // TODO: resolve the goodbye issue with Bonjour mDNSResponder.
-            dnsError = DNSServiceUpdateRecord(GetPublisher().mHostsRef, mAddrRecordRefs[index], kDNSServiceFlagsUnique,
-                                              sizeof(address.m8), address.m8, /* ttl */ 1);
-            otbrLogResult(DNSErrorToOtbrError(dnsError), "Send goodbye message for host %s address %s: %s",
-                          MakeFullHostName(mName).c_str(), address.ToString().c_str(), DNSErrorToString(dnsError));
+            recordRefs[it - addresses.begin()] = mAddrRecordRefs[index];
+            registered[it - addresses.begin()] = mAddrRegistered[index];
         }
+    }
 
-        dnsError = DNSServiceRemoveRecord(GetPublisher().mHostsRef, mAddrRecordRefs[index], /* flags */ 0);
+    mAddresses      = std::move(addresses);
+    mAddrRecordRefs = std::move(recordRefs);
+    mAddrRegistered = std::move(registered);
 
-        otbrLogResult(DNSErrorToOtbrError(dnsError), "Remove record for host %s address %s: %s",
-                      MakeFullHostName(mName).c_str(), address.ToString().c_str(), DNSErrorToString(dnsError));
+    for (size_t index = 0; index < mAddresses.size(); index++)
+    {
+        if (mAddrRecordRefs[index] == nullptr)
+        {
+            dnsError = RegisterAddressRecord(mAddresses[index], mAddrRecordRefs[index]);
+            VerifyOrExit(dnsError == kDNSServiceErr_NoError);
+        }
     }
 
 exit:
-    mAddrRegistered.clear();
-    mAddrRecordRefs.clear();
+    error = DNSErrorToOtbrError(dnsError);
+
+    // This completes the registration right away if no address is added, and
+    // may free this object on failure.
+    HandleRegisterResult(/* aRecordRef */ nullptr, dnsError);
+
+    return error;
+}
+
+DNSServiceErrorType PublisherMDnsSd::DnssdHostRegistration::RegisterAddressRecord(const Ip6Address &aAddress,
+                                                                                  DNSRecordRef     &aRecordRef)
+{
+    DNSServiceErrorType dnsError;
+
+    dnsError = GetPublisher().CreateSharedRef();
+    VerifyOrExit(dnsError == kDNSServiceErr_NoError);
+
+    dnsError = DNSServiceRegisterRecord(GetPublisher().mSharedRef, &aRecordRef, kDNSServiceFlagsShared,
+                                        kDNSServiceInterfaceIndexAny, MakeFullHostName(mName).c_str(),
+                                        kDNSServiceType_AAAA, kDNSServiceClass_IN, sizeof(aAddress.m8), aAddress.m8,
+                                        /* ttl */ 0, HandleRegisterResult, this);
+
+exit:
+    return dnsError;
+}
+
+void PublisherMDnsSd::DnssdHostRegistration::RemoveAddressRecord(size_t aIndex)
+{
+    const Ip6Address   &address = mAddresses[aIndex];
+    DNSServiceErrorType dnsError;
+
+    VerifyOrExit(GetPublisher().mSharedRef != nullptr && mAddrRecordRefs[aIndex] != nullptr);
+
+    if (mAddrRegistered[aIndex])
+    {
+        // The Bonjour mDNSResponder somehow doesn't send goodbye message for the AAAA record when it is
+        // removed by `DNSServiceRemoveRecord`. Per RFC 6762, a goodbye message of a record sets its TTL
+        // to zero but the receiver should record the TTL of 1 and flushes the cache 1 second later. Here
+        // we remove the AAAA record after updating its TTL to 1 second. This has the same effect as
+        // sending a goodbye message.
+        // TODO: resolve the goodbye issue with Bonjour mDNSResponder.
+        dnsError = DNSServiceUpdateRecord(GetPublisher().mSharedRef, mAddrRecordRefs[aIndex], kDNSServiceFlagsUnique,
+                                          sizeof(address.m8), address.m8, /* ttl */ 1);
+        otbrLogResult(DNSErrorToOtbrError(dnsError), "Send goodbye message for host %s address %s: %s",
+                      MakeFullHostName(mName).c_str(), address.ToInfoString().AsCString(), DNSErrorToString(dnsError));
+    }
+
+    dnsError = DNSServiceRemoveRecord(GetPublisher().mSharedRef, mAddrRecordRefs[aIndex], /* flags */ 0);
+
+    otbrLogResult(DNSErrorToOtbrError(dnsError), "Remove record for host %s address %s: %s",
+                  MakeFullHostName(mName).c_str(), address.ToInfoString().AsCString(), DNSErrorToString(dnsError));
+
+exit:
+    return;
 }
 
 void PublisherMDnsSd::DnssdHostRegistration::HandleRegisterResult(DNSServiceRef       aServiceRef,
@@ -650,7 +657,7 @@ void PublisherMDnsSd::DnssdHostRegistration::HandleRegisterResult(DNSRecordRef a
             {
                 mAddrRegistered[index] = true;
                 otbrLogInfo("Successfully registered host %s address %s", mName.c_str(),
-                            mAddresses[index].ToString().c_str());
+                            mAddresses[index].ToInfoString().AsCString());
             }
 
             if (!mAddrRegistered[index])
@@ -701,10 +708,10 @@ otbrError PublisherMDnsSd::DnssdKeyRegistration::Register(void)
     {
         otbrLogInfo("Key %s is being registered individually", mName.c_str());
 
-        dnsError = GetPublisher().CreateSharedHostsRef();
+        dnsError = GetPublisher().CreateSharedRef();
         VerifyOrExit(dnsError == kDNSServiceErr_NoError);
 
-        dnsError = DNSServiceRegisterRecord(GetPublisher().mHostsRef, &mRecordRef, kDNSServiceFlagsUnique,
+        dnsError = DNSServiceRegisterRecord(GetPublisher().mSharedRef, &mRecordRef, kDNSServiceFlagsUnique,
                                             kDNSServiceInterfaceIndexAny, MakeFullKeyName(mName).c_str(),
                                             kDNSServiceType_KEY, kDNSServiceClass_IN, mKeyData.size(), mKeyData.data(),
                                             /* ttl */ 0, HandleRegisterResult, this);
@@ -738,12 +745,12 @@ void PublisherMDnsSd::DnssdKeyRegistration::Unregister(void)
     }
     else
     {
-        serviceRef = GetPublisher().mHostsRef;
+        serviceRef = GetPublisher().mSharedRef;
 
         otbrLogInfo("Unregistering key %s (was registered individually)", mName.c_str());
     }
 
-    VerifyOrExit(serviceRef != nullptr);
+    VerifyOrExit(serviceRef != nullptr && GetPublisher().mSharedRef != nullptr);
 
     dnsError = DNSServiceRemoveRecord(serviceRef, mRecordRef, /* flags */ 0);
 
@@ -800,6 +807,18 @@ otbrError PublisherMDnsSd::PublishServiceImpl(const std::string &aHostName,
         ExitNow();
     }
 
+    serviceReg = static_cast<DnssdServiceRegistration *>(FindServiceRegistration(aName, aType));
+
+    // A published service whose TXT data alone changed is updated in place,
+    // which neither re-probes its name nor withdraws its records.
+    if (serviceReg != nullptr && serviceReg->IsCompleted() &&
+        serviceReg->IsTxtDataOutdatedOnly(aHostName, aName, aType, sortedSubTypeList, aPort, aTxtData) &&
+        serviceReg->UpdateTxtData(aTxtData) == OTBR_ERROR_NONE)
+    {
+        std::move(aCallback)(OTBR_ERROR_NONE);
+        ExitNow();
+    }
+
     aCallback = HandleDuplicateServiceRegistration(aHostName, aName, aType, sortedSubTypeList, aPort, aTxtData,
                                                    std::move(aCallback));
     VerifyOrExit(!aCallback.IsNull());
@@ -814,7 +833,9 @@ exit:
     return error;
 }
 
-void PublisherMDnsSd::UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback)
+void PublisherMDnsSd::UnpublishServiceImpl(const std::string &aName,
+                                           const std::string &aType,
+                                           ResultCallback   &&aCallback)
 {
     otbrError error = OTBR_ERROR_NONE;
 
@@ -839,6 +860,17 @@ otbrError PublisherMDnsSd::PublishHostImpl(const std::string &aName,
         ExitNow();
     }
 
+    hostReg = static_cast<DnssdHostRegistration *>(FindHostRegistration(aName));
+
+    // The address records of a published host are added and removed individually,
+    // so the addresses which are kept are neither re-probed nor withdrawn.
+    if (hostReg != nullptr && hostReg->IsCompleted() && hostReg->mName == aName &&
+        hostReg->IsOutdated(aName, aAddresses))
+    {
+        hostReg->mCallback = std::move(aCallback);
+        ExitNow(error = hostReg->UpdateAddresses(aAddresses));
+    }
+
     aCallback = HandleDuplicateHostRegistration(aName, aAddresses, std::move(aCallback));
     VerifyOrExit(!aCallback.IsNull());
 
@@ -851,7 +883,7 @@ exit:
     return error;
 }
 
-void PublisherMDnsSd::UnpublishHost(const std::string &aName, ResultCallback &&aCallback)
+void PublisherMDnsSd::UnpublishHostImpl(const std::string &aName, ResultCallback &&aCallback)
 {
     otbrError error = OTBR_ERROR_NONE;
 
@@ -889,7 +921,7 @@ exit:
     return error;
 }
 
-void PublisherMDnsSd::UnpublishKey(const std::string &aName, ResultCallback &&aCallback)
+void PublisherMDnsSd::UnpublishKeyImpl(const std::string &aName, ResultCallback &&aCallback)
 {
     otbrError error = OTBR_ERROR_NONE;
 
@@ -915,9 +947,11 @@ std::string PublisherMDnsSd::MakeRegType(const std::string &aType, SubTypeList a
     return regType;
 }
 
-void PublisherMDnsSd::SubscribeService(const std::string &aType, const std::string &aInstanceName)
+otbrError PublisherMDnsSd::SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName)
 {
-    VerifyOrExit(mState == Publisher::State::kReady);
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
     mSubscribedServices.push_back(MakeUnique<ServiceSubscription>(*this, aType, aInstanceName));
 
     otbrLogInfo("Subscribe service %s.%s (total %zu)", aInstanceName.c_str(), aType.c_str(),
@@ -933,10 +967,10 @@ void PublisherMDnsSd::SubscribeService(const std::string &aType, const std::stri
     }
 
 exit:
-    return;
+    return error;
 }
 
-void PublisherMDnsSd::UnsubscribeService(const std::string &aType, const std::string &aInstanceName)
+void PublisherMDnsSd::UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName)
 {
     ServiceSubscriptionList::iterator it;
 
@@ -973,9 +1007,11 @@ otbrError PublisherMDnsSd::DnsErrorToOtbrError(int32_t aErrorCode)
     return otbr::Mdns::DNSErrorToOtbrError(aErrorCode);
 }
 
-void PublisherMDnsSd::SubscribeHost(const std::string &aHostName)
+otbrError PublisherMDnsSd::SubscribeHostImpl(const std::string &aHostName)
 {
-    VerifyOrExit(mState == State::kReady);
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
     mSubscribedHosts.push_back(MakeUnique<HostSubscription>(*this, aHostName));
 
     otbrLogInfo("Subscribe host %s (total %zu)", aHostName.c_str(), mSubscribedHosts.size());
@@ -983,10 +1019,10 @@ void PublisherMDnsSd::SubscribeHost(const std::string &aHostName)
     mSubscribedHosts.back()->Resolve();
 
 exit:
-    return;
+    return error;
 }
 
-void PublisherMDnsSd::UnsubscribeHost(const std::string &aHostName)
+void PublisherMDnsSd::UnsubscribeHostImpl(const std::string &aHostName)
 {
     HostSubscriptionList ::iterator it;
 
@@ -1022,51 +1058,51 @@ void PublisherMDnsSd::ServiceRef::Release(void)
 
 void PublisherMDnsSd::ServiceRef::DeallocateServiceRef(void)
 {
-    if (mServiceRef != nullptr)
-    {
-        mPublisher.HandleServiceRefDeallocating(mServiceRef);
-        DNSServiceRefDeallocate(mServiceRef);
-        mServiceRef = nullptr;
-    }
+    mPublisher.DeallocateSubordinateRef(mServiceRef);
 }
 
-void PublisherMDnsSd::ServiceRef::Update(MainloopContext &aMainloop) const
+DNSServiceErrorType PublisherMDnsSd::ServiceRef::PrepareServiceRef(void)
 {
-    int fd;
+    DNSServiceErrorType dnsError;
 
-    VerifyOrExit(mServiceRef != nullptr);
+    assert(mServiceRef == nullptr);
 
-    fd = DNSServiceRefSockFD(mServiceRef);
-    assert(fd != -1);
-    aMainloop.AddFdToReadSet(fd);
-exit:
-    return;
-}
+    // The operation is started on a copy of the shared connection and
+    // `mServiceRef` becomes its subordinate `DNSServiceRef`.
+    dnsError = mPublisher.CreateSharedRef();
 
-void PublisherMDnsSd::ServiceRef::Process(const MainloopContext      &aMainloop,
-                                          std::vector<DNSServiceRef> &aReadyServices) const
-{
-    int fd;
+    if (dnsError == kDNSServiceErr_NoError)
+    {
+        mServiceRef = mPublisher.mSharedRef;
+    }
 
-    VerifyOrExit(mServiceRef != nullptr);
+    return dnsError;
+}
 
-    fd = DNSServiceRefSockFD(mServiceRef);
-    assert(fd != -1);
-    if (FD_ISSET(fd, &aMainloop.mReadFdSet))
+void PublisherMDnsSd::ServiceRef::CheckServiceRef(DNSServiceErrorType aError)
+{
+    if (aError != kDNSServiceErr_NoError)
     {
-        aReadyServices.push_back(mServiceRef);
+        mServiceRef = nullptr;
     }
-exit:
-    return;
 }
 
 void PublisherMDnsSd::ServiceSubscription::Browse(void)
 {
-    assert(mServiceRef == nullptr);
+    DNSServiceErrorType dnsError;
 
     otbrLogInfo("DNSServiceBrowse %s", mType.c_str());
-    DNSServiceBrowse(&mServiceRef, /* flags */ 0, kDNSServiceInterfaceIndexAny, mType.c_str(),
-                     /* domain */ nullptr, HandleBrowseResult, this);
+
+    SuccessOrExit(dnsError = PrepareServiceRef());
+    dnsError = DNSServiceBrowse(&mServiceRef, kDNSServiceFlagsShareConnection, kDNSServiceInterfaceIndexAny,
+                                mType.c_str(), /* domain */ nullptr, HandleBrowseResult, this);
+    CheckServiceRef(dnsError);
+
+exit:
+    if (dnsError != kDNSServiceErr_NoError)
+    {
+        otbrLogWarning("DNSServiceBrowse failed: %s", DNSErrorToString(dnsError));
+    }
 }
 
 void PublisherMDnsSd::ServiceSubscription::HandleBrowseResult(DNSServiceRef       aServiceRef,
@@ -1126,38 +1162,26 @@ void PublisherMDnsSd::ServiceSubscription::Resolve(uint32_t           aInterface
     mResolvingInstances.back()->Resolve();
 }
 
-void PublisherMDnsSd::ServiceSubscription::UpdateAll(MainloopContext &aMainloop) const
+void PublisherMDnsSd::ServiceInstanceResolution::Resolve(void)
 {
-    Update(aMainloop);
+    DNSServiceErrorType dnsError;
 
-    for (const auto &instance : mResolvingInstances)
-    {
-        instance->Update(aMainloop);
-    }
-}
+    mSubscription->mPublisher.mServiceInstanceResolutionBeginTime[std::make_pair(mInstanceName, mType)] = CoarseClock::Now();
 
-void PublisherMDnsSd::ServiceSubscription::ProcessAll(const MainloopContext      &aMainloop,
-                                                      std::vector<DNSServiceRef> &aReadyServices) const
-{
-    Process(aMainloop, aReadyServices);
+    otbrLogInfo("DNSServiceResolve %s %s inf %u", mInstanceName.c_str(), mType.c_str(), mNetifIndex);
 
-    for (const auto &instance : mResolvingInstances)
+    SuccessOrExit(dnsError = PrepareServiceRef());
+    dnsError = DNSServiceResolve(&mServiceRef, kDNSServiceFlagsShareConnection | kDNSServiceFlagsTimeout, mNetifIndex,
+                                 mInstanceName.c_str(), mType.c_str(), mDomain.c_str(), HandleResolveResult, this);
+    CheckServiceRef(dnsError);
+
+exit:
+    if (dnsError != kDNSServiceErr_NoError)
     {
-        instance->Process(aMainloop, aReadyServices);
+        otbrLogWarning("DNSServiceResolve failed: %s", DNSErrorToString(dnsError));
     }
 }
 
-void PublisherMDnsSd::ServiceInstanceResolution::Resolve(void)
-{
-    assert(mServiceRef == nullptr);
-
-    mSubscription->mPublisher.mServiceInstanceResolutionBeginTime[std::make_pair(mInstanceName, mType)] = Clock::now();
-
-    otbrLogInfo("DNSServiceResolve %s %s inf %u", mInstanceName.c_str(), mType.c_str(), mNetifIndex);
-    DNSServiceResolve(&mServiceRef, /* flags */ kDNSServiceFlagsTimeout, mNetifIndex, mInstanceName.c_str(),
-                      mType.c_str(), mDomain.c_str(), HandleResolveResult, this);
-}
-
 void PublisherMDnsSd::ServiceInstanceResolution::HandleResolveResult(DNSServiceRef        aServiceRef,
                                                                      DNSServiceFlags      aFlags,
                                                                      uint32_t             aInterfaceIndex,
@@ -1185,18 +1209,20 @@ void PublisherMDnsSd::ServiceInstanceResolution::HandleResolveResult(DNSServiceR
 {
     OTBR_UNUSED_VARIABLE(aServiceRef);
 
-    std::string instanceName, type, domain;
-    otbrError   error = OTBR_ERROR_NONE;
+    StringView instanceName;
+    StringView type;
+    StringView domain;
+    otbrError  error = OTBR_ERROR_NONE;
 
     otbrLogInfo("DNSServiceResolve reply: %s host %s:%d, TXT=%dB inf %u, flags=%u", aFullName, aHostTarget, aPort,
                 aTxtLen, aInterfaceIndex, aFlags);
 
     VerifyOrExit(aErrorCode == kDNSServiceErr_NoError);
 
-    SuccessOrExit(error = SplitFullServiceInstanceName(aFullName, instanceName, type, domain));
+    SuccessOrExit(error = SplitFullServiceInstanceName(StringView(aFullName), instanceName, type, domain));
 
     mInstanceInfo.mNetifIndex = aInterfaceIndex;
-    mInstanceInfo.mName       = instanceName;
+    mInstanceInfo.mName       = instanceName.ToString();
     mInstanceInfo.mHostName   = aHostTarget;
     mInstanceInfo.mPort       = ntohs(aPort);
     mInstanceInfo.mTxtData.assign(aTxtRecord, aTxtRecord + aTxtLen);
@@ -1204,8 +1230,9 @@ void PublisherMDnsSd::ServiceInstanceResolution::HandleResolveResult(DNSServiceR
     mInstanceInfo.mPriority = 0;
     mInstanceInfo.mWeight   = 0;
 
+    // The address lookup is attached as soon as the host is known and is shared by all the instances on the host.
     DeallocateServiceRef();
-    error = GetAddrInfo(aInterfaceIndex);
+    error = mSubscription->mPublisher.AttachHostAddressResolver(*this);
 
 exit:
     if (error != OTBR_ERROR_NONE)
@@ -1220,18 +1247,93 @@ exit:
     }
 }
 
-otbrError PublisherMDnsSd::ServiceInstanceResolution::GetAddrInfo(uint32_t aInterfaceIndex)
+PublisherMDnsSd::ServiceInstanceResolution::~ServiceInstanceResolution(void)
 {
-    DNSServiceErrorType dnsError;
+    if (mHostAddressResolver != nullptr)
+    {
+        mPublisher.DetachHostAddressResolver(*this);
+    }
+}
 
-    assert(mServiceRef == nullptr);
+void PublisherMDnsSd::ServiceInstanceResolution::HandleHostAddresses(const DiscoveredHostInfo &aHostInfo)
+{
+    mInstanceInfo.mAddresses = aHostInfo.mAddresses;
+    mInstanceInfo.mTtl       = aHostInfo.mTtl;
+
+    FinishResolution();
+}
+
+otbrError PublisherMDnsSd::AttachHostAddressResolver(ServiceInstanceResolution &aResolution)
+{
+    otbrError            error      = OTBR_ERROR_NONE;
+    const std::string   &hostName   = aResolution.mInstanceInfo.mHostName;
+    uint32_t             netifIndex = aResolution.mInstanceInfo.mNetifIndex;
+    DnsNameKey           key        = DnsNameKey::Intern(hostName, std::to_string(netifIndex), '%');
+    auto                 it         = mHostAddressResolvers.find(key);
+    HostAddressResolver *resolver;
+
+    if (it == mHostAddressResolvers.end())
+    {
+        std::unique_ptr<HostAddressResolver> newResolver =
+            MakeUnique<HostAddressResolver>(*this, key, hostName, netifIndex);
+
+        SuccessOrExit(error = newResolver->Resolve());
+        resolver = newResolver.get();
+        mHostAddressResolvers.emplace(key, std::move(newResolver));
+    }
+    else
+    {
+        resolver = it->second.get();
+        otbrLogInfo("DNSServiceGetAddrInfo %s inf %u is shared by %zu instances", hostName.c_str(), netifIndex,
+                    resolver->mResolutions.size() + 1);
+    }
+
+    resolver->mResolutions.push_back(&aResolution);
+    aResolution.mHostAddressResolver = resolver;
+
+    // The addresses which are already known are answered without waiting for the daemon.
+    if (!resolver->mHostInfo.mAddresses.empty())
+    {
+        // NOTE: `aResolution` may be freed in `HandleHostAddresses`.
+        aResolution.HandleHostAddresses(resolver->mHostInfo);
+    }
+
+exit:
+    return error;
+}
+
+void PublisherMDnsSd::DetachHostAddressResolver(ServiceInstanceResolution &aResolution)
+{
+    HostAddressResolver                      &resolver    = *aResolution.mHostAddressResolver;
+    std::vector<ServiceInstanceResolution *> &resolutions = resolver.mResolutions;
+    DnsNameKey                                key;
+
+    aResolution.mHostAddressResolver = nullptr;
+    resolutions.erase(std::remove(resolutions.begin(), resolutions.end(), &aResolution), resolutions.end());
+
+    // A resolver which is notifying its resolutions is released by itself once it is done.
+    VerifyOrExit(resolutions.empty() && !resolver.mIsNotifying);
+
+    key = resolver.mKey;
+    mHostAddressResolvers.erase(key);
+
+exit:
+    return;
+}
+
+otbrError PublisherMDnsSd::HostAddressResolver::Resolve(void)
+{
+    DNSServiceErrorType dnsError;
 
-    otbrLogInfo("DNSServiceGetAddrInfo %s inf %d", mInstanceInfo.mHostName.c_str(), aInterfaceIndex);
+    otbrLogInfo("DNSServiceGetAddrInfo %s inf %" PRIu32, mHostInfo.mHostName.c_str(), mHostInfo.mNetifIndex);
 
-    dnsError = DNSServiceGetAddrInfo(&mServiceRef, /* flags */ 0, aInterfaceIndex,
-                                     kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4,
-                                     mInstanceInfo.mHostName.c_str(), HandleGetAddrInfoResult, this);
+    SuccessOrExit(dnsError = PrepareServiceRef());
+    dnsError = DNSServiceGetAddrInfo(&mServiceRef, kDNSServiceFlagsShareConnection, mHostInfo.mNetifIndex,
+                                     kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4, mHostInfo.mHostName.c_str(),
+                                     HandleGetAddrInfoResult, this);
+    CheckServiceRef(dnsError);
 
+exit:
     if (dnsError != kDNSServiceErr_NoError)
     {
         otbrLogWarning("DNSServiceGetAddrInfo failed: %s", DNSErrorToString(dnsError));
@@ -1240,26 +1342,26 @@ otbrError PublisherMDnsSd::ServiceInstanceResolution::GetAddrInfo(uint32_t aInte
     return dnsError == kDNSServiceErr_NoError ? OTBR_ERROR_NONE : OTBR_ERROR_MDNS;
 }
 
-void PublisherMDnsSd::ServiceInstanceResolution::HandleGetAddrInfoResult(DNSServiceRef          aServiceRef,
-                                                                         DNSServiceFlags        aFlags,
-                                                                         uint32_t               aInterfaceIndex,
-                                                                         DNSServiceErrorType    aErrorCode,
-                                                                         const char            *aHostName,
-                                                                         const struct sockaddr *aAddress,
-                                                                         uint32_t               aTtl,
-                                                                         void                  *aContext)
+void PublisherMDnsSd::HostAddressResolver::HandleGetAddrInfoResult(DNSServiceRef          aServiceRef,
+                                                                   DNSServiceFlags        aFlags,
+                                                                   uint32_t               aInterfaceIndex,
+                                                                   DNSServiceErrorType    aErrorCode,
+                                                                   const char            *aHostName,
+                                                                   const struct sockaddr *aAddress,
+                                                                   uint32_t               aTtl,
+                                                                   void                  *aContext)
 {
-    static_cast<ServiceInstanceResolution *>(aContext)->HandleGetAddrInfoResult(aServiceRef, aFlags, aInterfaceIndex,
-                                                                                aErrorCode, aHostName, aAddress, aTtl);
+    static_cast<HostAddressResolver *>(aContext)->HandleGetAddrInfoResult(aServiceRef, aFlags, aInterfaceIndex,
+                                                                          aErrorCode, aHostName, aAddress, aTtl);
 }
 
-void PublisherMDnsSd::ServiceInstanceResolution::HandleGetAddrInfoResult(DNSServiceRef          aServiceRef,
-                                                                         DNSServiceFlags        aFlags,
-                                                                         uint32_t               aInterfaceIndex,
-                                                                         DNSServiceErrorType    aErrorCode,
-                                                                         const char            *aHostName,
-                                                                         const struct sockaddr *aAddress,
-                                                                         uint32_t               aTtl)
+void PublisherMDnsSd::HostAddressResolver::HandleGetAddrInfoResult(DNSServiceRef          aServiceRef,
+                                                                   DNSServiceFlags        aFlags,
+                                                                   uint32_t               aInterfaceIndex,
+                                                                   DNSServiceErrorType    aErrorCode,
+                                                                   const char            *aHostName,
+                                                                   const struct sockaddr *aAddress,
+                                                                   uint32_t               aTtl)
 {
     OTBR_UNUSED_VARIABLE(aServiceRef);
     OTBR_UNUSED_VARIABLE(aInterfaceIndex);
@@ -1276,25 +1378,61 @@ void PublisherMDnsSd::ServiceInstanceResolution::HandleGetAddrInfoResult(DNSServ
 
     address.CopyFrom(*reinterpret_cast<const struct sockaddr_in6 *>(aAddress));
     VerifyOrExit(!address.IsUnspecified() && !address.IsLinkLocal() && !address.IsMulticast() && !address.IsLoopback(),
-                 otbrLogDebug("DNSServiceGetAddrInfo ignores address %s", address.ToString().c_str()));
+                 otbrLogDebug("DNSServiceGetAddrInfo ignores address %s", address.ToInfoString().AsCString()));
 
     otbrLogInfo("DNSServiceGetAddrInfo reply: %s address=%s, ttl=%" PRIu32, isAdd ? "add" : "remove",
-                address.ToString().c_str(), aTtl);
+                address.ToInfoString().AsCString(), aTtl);
 
     if (isAdd)
     {
-        mInstanceInfo.AddAddress(address);
+        mHostInfo.AddAddress(address);
     }
     else
     {
-        mInstanceInfo.RemoveAddress(address);
+        mHostInfo.RemoveAddress(address);
     }
-    mInstanceInfo.mTtl = aTtl;
+    mHostInfo.mTtl = aTtl;
 
 exit:
-    if (!mInstanceInfo.mAddresses.empty() || aErrorCode != kDNSServiceErr_NoError)
+    if (!mHostInfo.mAddresses.empty() || aErrorCode != kDNSServiceErr_NoError)
     {
-        FinishResolution();
+        // NOTE: This object may be freed in `NotifyResolutions`.
+        NotifyResolutions(aErrorCode);
+    }
+}
+
+void PublisherMDnsSd::HostAddressResolver::NotifyResolutions(DNSServiceErrorType aErrorCode)
+{
+    std::vector<ServiceInstanceResolution *> resolutions = mResolutions;
+    PublisherMDnsSd                         &publisher   = mPublisher;
+    DnsNameKey                               key         = mKey;
+
+    mIsNotifying = true;
+
+    for (ServiceInstanceResolution *resolution : resolutions)
+    {
+        // A resolution may be freed along with its subscription by the answer to a previous one.
+        if (std::find(mResolutions.begin(), mResolutions.end(), resolution) != mResolutions.end())
+        {
+            resolution->HandleHostAddresses(mHostInfo);
+        }
+    }
+
+    mIsNotifying = false;
+
+    if (aErrorCode != kDNSServiceErr_NoError)
+    {
+        // The failed lookup is dropped so that the next resolution of the host starts a new one.
+        for (ServiceInstanceResolution *resolution : mResolutions)
+        {
+            resolution->mHostAddressResolver = nullptr;
+        }
+        mResolutions.clear();
+    }
+
+    if (mResolutions.empty())
+    {
+        publisher.mHostAddressResolvers.erase(key);
     }
 }
 
@@ -1305,22 +1443,29 @@ void PublisherMDnsSd::ServiceInstanceResolution::FinishResolution(void)
     DiscoveredInstanceInfo instanceInfo = mInstanceInfo;
 
     // NOTE: The `ServiceSubscription` object may be freed in `OnServiceResolved`.
-    subscription->mPublisher.OnServiceResolved(serviceName, instanceInfo);
+    subscription->mPublisher.OnServiceResolved(std::move(serviceName), std::move(instanceInfo));
 }
 
 void PublisherMDnsSd::HostSubscription::Resolve(void)
 {
-    std::string fullHostName = MakeFullHostName(mHostName);
-
-    assert(mServiceRef == nullptr);
+    std::string         fullHostName = MakeFullHostName(mHostName);
+    DNSServiceErrorType dnsError;
 
-    mPublisher.mHostResolutionBeginTime[mHostName] = Clock::now();
+    mPublisher.mHostResolutionBeginTime[mHostName] = CoarseClock::Now();
 
     otbrLogInfo("DNSServiceGetAddrInfo %s inf %d", fullHostName.c_str(), kDNSServiceInterfaceIndexAny);
 
-    DNSServiceGetAddrInfo(&mServiceRef, /* flags */ 0, kDNSServiceInterfaceIndexAny,
-                          kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4, fullHostName.c_str(),
-                          HandleResolveResult, this);
+    SuccessOrExit(dnsError = PrepareServiceRef());
+    dnsError = DNSServiceGetAddrInfo(&mServiceRef, kDNSServiceFlagsShareConnection, kDNSServiceInterfaceIndexAny,
+                                     kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4, fullHostName.c_str(),
+                                     HandleResolveResult, this);
+    CheckServiceRef(dnsError);
+
+exit:
+    if (dnsError != kDNSServiceErr_NoError)
+    {
+        otbrLogWarning("DNSServiceGetAddrInfo failed: %s", DNSErrorToString(dnsError));
+    }
 }
 
 void PublisherMDnsSd::HostSubscription::HandleResolveResult(DNSServiceRef          aServiceRef,
@@ -1357,11 +1502,11 @@ void PublisherMDnsSd::HostSubscription::HandleResolveResult(DNSServiceRef
     VerifyOrExit(aAddress->sa_family == AF_INET6);
 
     address.CopyFrom(*reinterpret_cast<const struct sockaddr_in6 *>(aAddress));
-    VerifyOrExit(!address.IsLinkLocal(),
-                 otbrLogDebug("DNSServiceGetAddrInfo ignore link-local address %s", address.ToString().c_str()));
+    VerifyOrExit(!address.IsLinkLocal(), otbrLogDebug("DNSServiceGetAddrInfo ignore link-local address %s",
+                                                      address.ToInfoString().AsCString()));
 
     otbrLogInfo("DNSServiceGetAddrInfo reply: %s address=%s, ttl=%" PRIu32, isAdd ? "add" : "remove",
-                address.ToString().c_str(), aTtl);
+                address.ToInfoString().AsCString(), aTtl);
 
     if (isAdd)
     {
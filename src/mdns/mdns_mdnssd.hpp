@@ -39,6 +39,7 @@
 #include <array>
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -46,7 +47,7 @@
 #include <dns_sd.h>
 
 #include "common/code_utils.hpp"
-#include "common/mainloop.hpp"
+#include "common/dns_name_key.hpp"
 #include "common/types.hpp"
 #include "mdns/mdns.hpp"
 
@@ -57,7 +58,7 @@ namespace Mdns {
 /**
  * This class implements mDNS publisher with mDNSResponder.
  */
-class PublisherMDnsSd : public MainloopProcessor, public Publisher
+class PublisherMDnsSd final : public Publisher
 {
 public:
     explicit PublisherMDnsSd(StateCallback aCallback);
@@ -66,23 +67,10 @@ public:
 
     // Implementation of Mdns::Publisher.
 
-    void UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback) override;
-
-    void      UnpublishHost(const std::string &aName, ResultCallback &&aCallback) override;
-    void      UnpublishKey(const std::string &aName, ResultCallback &&aCallback) override;
-    void      SubscribeService(const std::string &aType, const std::string &aInstanceName) override;
-    void      UnsubscribeService(const std::string &aType, const std::string &aInstanceName) override;
-    void      SubscribeHost(const std::string &aHostName) override;
-    void      UnsubscribeHost(const std::string &aHostName) override;
     otbrError Start(void) override;
     bool      IsStarted(void) const override;
     void      Stop(void) override { Stop(kNormalStop); }
 
-    // Implementation of MainloopProcessor.
-
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
-
 protected:
     otbrError PublishServiceImpl(const std::string &aHostName,
                                  const std::string &aName,
@@ -95,6 +83,15 @@ protected:
                               const AddressList &aAddress,
                               ResultCallback   &&aCallback) override;
     otbrError PublishKeyImpl(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback) override;
+    void      UnpublishServiceImpl(const std::string &aName,
+                                   const std::string &aType,
+                                   ResultCallback   &&aCallback) override;
+    void      UnpublishHostImpl(const std::string &aName, ResultCallback &&aCallback) override;
+    void      UnpublishKeyImpl(const std::string &aName, ResultCallback &&aCallback) override;
+    otbrError SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override;
+    void      UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override;
+    otbrError SubscribeHostImpl(const std::string &aHostName) override;
+    void      UnsubscribeHostImpl(const std::string &aHostName) override;
     void      OnServiceResolveFailedImpl(const std::string &aType,
                                          const std::string &aInstanceName,
                                          int32_t            aErrorCode) override;
@@ -121,9 +118,8 @@ private:
 
         ~DnssdServiceRegistration(void) override { Unregister(); }
 
-        void      Update(MainloopContext &aMainloop) const;
-        void      Process(const MainloopContext &aMainloop, std::vector<DNSServiceRef> &aReadyServices) const;
         otbrError Register(void);
+        otbrError UpdateTxtData(const TxtData &aTxtData);
 
     private:
         void             Unregister(void);
@@ -149,17 +145,21 @@ private:
         ~DnssdHostRegistration(void) override { Unregister(); }
 
         otbrError Register(void);
+        otbrError UpdateAddresses(const AddressList &aAddresses);
 
     private:
-        void             Unregister(void);
-        PublisherMDnsSd &GetPublisher(void) { return *static_cast<PublisherMDnsSd *>(mPublisher); }
-        void             HandleRegisterResult(DNSRecordRef aRecordRef, DNSServiceErrorType aError);
-        static void      HandleRegisterResult(DNSServiceRef       aServiceRef,
-                                              DNSRecordRef        aRecordRef,
-                                              DNSServiceFlags     aFlags,
-                                              DNSServiceErrorType aErrorCode,
-                                              void               *aContext);
-
+        void                Unregister(void);
+        DNSServiceErrorType RegisterAddressRecord(const Ip6Address &aAddress, DNSRecordRef &aRecordRef);
+        void                RemoveAddressRecord(size_t aIndex);
+        PublisherMDnsSd    &GetPublisher(void) { return *static_cast<PublisherMDnsSd *>(mPublisher); }
+        void                HandleRegisterResult(DNSRecordRef aRecordRef, DNSServiceErrorType aError);
+        static void         HandleRegisterResult(DNSServiceRef       aServiceRef,
+                                                 DNSRecordRef        aRecordRef,
+                                                 DNSServiceFlags     aFlags,
+                                                 DNSServiceErrorType aErrorCode,
+                                                 void               *aContext);
+
+        // Indexed the same as `mAddresses`.
         std::vector<DNSRecordRef> mAddrRecordRefs;
         std::vector<bool>         mAddrRegistered;
     };
@@ -202,13 +202,14 @@ private:
 
         ~ServiceRef() { Release(); }
 
-        void Update(MainloopContext &aMainloop) const;
-        void Process(const MainloopContext &aMainloop, std::vector<DNSServiceRef> &aReadyServices) const;
-        void Release(void);
-        void DeallocateServiceRef(void);
+        DNSServiceErrorType PrepareServiceRef(void);
+        void                CheckServiceRef(DNSServiceErrorType aError);
+        void                Release(void);
+        void                DeallocateServiceRef(void);
     };
 
     struct ServiceSubscription;
+    struct HostAddressResolver;
 
     struct ServiceInstanceResolution : public ServiceRef
     {
@@ -223,12 +224,15 @@ private:
             , mType(std::move(aType))
             , mDomain(std::move(aDomain))
             , mNetifIndex(aNetifIndex)
+            , mHostAddressResolver(nullptr)
         {
         }
 
-        void      Resolve(void);
-        otbrError GetAddrInfo(uint32_t aInterfaceIndex);
-        void      FinishResolution(void);
+        ~ServiceInstanceResolution(void);
+
+        void Resolve(void);
+        void HandleHostAddresses(const DiscoveredHostInfo &aHostInfo);
+        void FinishResolution(void);
 
         static void HandleResolveResult(DNSServiceRef        aServiceRef,
                                         DNSServiceFlags      aFlags,
@@ -249,6 +253,34 @@ private:
                                         uint16_t             aPort, // In network byte order.
                                         uint16_t             aTxtLen,
                                         const unsigned char *aTxtRecord);
+
+        ServiceSubscription   *mSubscription;
+        std::string            mInstanceName;
+        std::string            mType;
+        std::string            mDomain;
+        uint32_t               mNetifIndex;
+        HostAddressResolver   *mHostAddressResolver;
+        DiscoveredInstanceInfo mInstanceInfo;
+    };
+
+    // Looks up the addresses of a host on a network interface with a single `DNSServiceGetAddrInfo` whose answers are
+    // fanned out to all the service instance resolutions targeting the host.
+    struct HostAddressResolver : public ServiceRef
+    {
+        explicit HostAddressResolver(PublisherMDnsSd &aPublisher,
+                                     DnsNameKey       aKey,
+                                     std::string      aHostName,
+                                     uint32_t         aNetifIndex)
+            : ServiceRef(aPublisher)
+            , mKey(std::move(aKey))
+            , mIsNotifying(false)
+        {
+            mHostInfo.mHostName   = std::move(aHostName);
+            mHostInfo.mNetifIndex = aNetifIndex;
+        }
+
+        otbrError   Resolve(void);
+        void        NotifyResolutions(DNSServiceErrorType aErrorCode);
         static void HandleGetAddrInfoResult(DNSServiceRef          aServiceRef,
                                             DNSServiceFlags        aFlags,
                                             uint32_t               aInterfaceIndex,
@@ -265,12 +297,10 @@ private:
                                             const struct sockaddr *aAddress,
                                             uint32_t               aTtl);
 
-        ServiceSubscription   *mSubscription;
-        std::string            mInstanceName;
-        std::string            mType;
-        std::string            mDomain;
-        uint32_t               mNetifIndex;
-        DiscoveredInstanceInfo mInstanceInfo;
+        DnsNameKey                               mKey;
+        DiscoveredHostInfo                       mHostInfo;
+        bool                                     mIsNotifying;
+        std::vector<ServiceInstanceResolution *> mResolutions;
     };
 
     struct ServiceSubscription : public ServiceRef
@@ -287,8 +317,6 @@ private:
                      const std::string &aInstanceName,
                      const std::string &aType,
                      const std::string &aDomain);
-        void UpdateAll(MainloopContext &aMainloop) const;
-        void ProcessAll(const MainloopContext &aMainloop, std::vector<DNSServiceRef> &aReadyServices) const;
 
         static void HandleBrowseResult(DNSServiceRef       aServiceRef,
                                        DNSServiceFlags     aFlags,
@@ -343,22 +371,28 @@ private:
 
     using ServiceSubscriptionList = std::vector<std::unique_ptr<ServiceSubscription>>;
     using HostSubscriptionList    = std::vector<std::unique_ptr<HostSubscription>>;
+    using HostAddressResolverMap =
+        std::unordered_map<DnsNameKey, std::unique_ptr<HostAddressResolver>, DnsNameKey::Hash>;
 
     static std::string MakeRegType(const std::string &aType, SubTypeList aSubTypeList);
 
     void                Stop(StopMode aStopMode);
-    DNSServiceErrorType CreateSharedHostsRef(void);
-    void                DeallocateHostsRef(void);
-    void                HandleServiceRefDeallocating(const DNSServiceRef &aServiceRef);
-
-    DNSServiceRef mHostsRef;
+    DNSServiceErrorType CreateSharedRef(void);
+    void                DeallocateSharedRef(void);
+    void                ProcessResult(void);
+    void                DeallocateSubordinateRef(DNSServiceRef &aServiceRef);
+    otbrError           AttachHostAddressResolver(ServiceInstanceResolution &aResolution);
+    void                DetachHostAddressResolver(ServiceInstanceResolution &aResolution);
+
+    // The connection to the daemon shared by all operations, see `kDNSServiceFlagsShareConnection`. Its socket is
+    // registered persistently to the mainloop manager while the connection exists.
+    DNSServiceRef mSharedRef;
     State         mState;
     StateCallback mStateCallback;
 
     ServiceSubscriptionList mSubscribedServices;
     HostSubscriptionList    mSubscribedHosts;
-
-    std::vector<DNSServiceRef> mServiceRefsToProcess;
+    HostAddressResolverMap  mHostAddressResolvers;
 };
 
 /**
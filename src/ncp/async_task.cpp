@@ -36,19 +36,19 @@
 namespace otbr {
 namespace Ncp {
 
+constexpr size_t AsyncTask::kExpectedSteps;
+
 AsyncTask::AsyncTask(const ResultHandler &aResultHandler)
-    : mResultHandler(aResultHandler)
+    : mNextStep(0)
+    , mResultHandler(aResultHandler)
 {
 }
 
 AsyncTask::~AsyncTask()
 {
-    if (!mNext)
+    if (mResultHandler)
     {
-        if (mResultHandler)
-        {
-            mResultHandler(OT_ERROR_FAILED, "AsyncTask ends without setting any result.");
-        }
+        mResultHandler(OT_ERROR_FAILED, "AsyncTask ends without setting any result.");
     }
 }
 
@@ -59,40 +59,42 @@ void AsyncTask::Run(void)
 
 void AsyncTask::SetResult(otError aError, const std::string &aErrorInfo)
 {
-    if (mNext)
+    VerifyOrExit(mResultHandler != nullptr);
+
+    if (aError == OT_ERROR_NONE && mNextStep < mSteps.size())
     {
-        if (aError == OT_ERROR_NONE)
-        {
-            mThen(std::move(mNext));
-        }
-        else
-        {
-            mNext->SetResult(aError, aErrorInfo);
-        }
-        mThen = nullptr;
+        // Move the step out as it may add steps to the chain.
+        ThenHandler step = std::move(mSteps[mNextStep++]);
+
+        step(shared_from_this());
     }
     else
     {
-        mResultHandler(aError, aErrorInfo);
+        ResultHandler resultHandler = std::move(mResultHandler);
+
         mResultHandler = nullptr;
+        mSteps.clear();
+        resultHandler(aError, aErrorInfo);
     }
+
+exit:
+    return;
 }
 
-AsyncTaskPtr &AsyncTask::First(const ThenHandler &aFirst)
+AsyncTask &AsyncTask::First(ThenHandler aFirst)
 {
-    assert(mNext == nullptr);
+    assert(mSteps.empty());
+
+    mSteps.reserve(kExpectedSteps);
 
-    return Then(aFirst);
+    return Then(std::move(aFirst));
 }
 
-AsyncTaskPtr &AsyncTask::Then(const ThenHandler &aThen)
+AsyncTask &AsyncTask::Then(ThenHandler aThen)
 {
-    assert(mNext == nullptr);
-
-    mNext = std::make_shared<AsyncTask>(mResultHandler);
-    mThen = aThen;
+    mSteps.push_back(std::move(aThen));
 
-    return mNext;
+    return *this;
 }
 
 } // namespace Ncp
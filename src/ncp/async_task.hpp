@@ -37,19 +37,29 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include <openthread/error.h>
 
+#include "common/callback.hpp"
+
 namespace otbr {
 namespace Ncp {
 
 class AsyncTask;
 using AsyncTaskPtr = std::shared_ptr<AsyncTask>;
 
-class AsyncTask
+/**
+ * This class implements chained async operations.
+ *
+ * All steps of a chain are held by a single `AsyncTask` which is passed to each step in turn, so composing
+ * a chain only allocates the task itself and its step list. An `AsyncTask` must be created by `std::make_shared`.
+ */
+class AsyncTask : public std::enable_shared_from_this<AsyncTask>
 {
 public:
-    using ThenHandler   = std::function<void(AsyncTaskPtr)>;
+    // Each step is only invoked once and can capture move-only state.
+    using ThenHandler   = UniqueFunction<void(AsyncTaskPtr)>;
     using ResultHandler = std::function<void(otError, const std::string &)>;
 
     /**
@@ -74,7 +84,7 @@ public:
     /**
      * Set the result of the previous async operation.
      *
-     * This method should be called when the result of the previous async operation is ready.
+     * This method should be called exactly once by each step when the result of its async operation is ready.
      * This method will pass the result to next operation.
      *
      * @param[in] aError  The result for the previous async operation.
@@ -84,28 +94,27 @@ public:
     /**
      * Set the initial operation of the chained async operations.
      *
-     * @param[in] aFirst  A reference to a function object for the initial action.
+     * @param[in] aFirst  A function object for the initial action.
      *
-     * @returns  A shared pointer to a AsyncTask object created in this method.
+     * @returns  A reference to this AsyncTask object.
      */
-    AsyncTaskPtr &First(const ThenHandler &aFirst);
+    AsyncTask &First(ThenHandler aFirst);
 
     /**
      * Set the next operation of the chained async operations.
      *
-     * @param[in] aThen  A reference to a function object for the next action.
+     * @param[in] aThen  A function object for the next action.
      *
-     * @returns A shared pointer to a AsyncTask object created in this method.
+     * @returns  A reference to this AsyncTask object.
      */
-    AsyncTaskPtr &Then(const ThenHandler &aThen);
+    AsyncTask &Then(ThenHandler aThen);
 
 private:
-    union
-    {
-        ThenHandler   mThen;          // Only valid when `mNext` is not nullptr
-        ResultHandler mResultHandler; // Only valid when `mNext` is nullptr
-    };
-    AsyncTaskPtr mNext;
+    static constexpr size_t kExpectedSteps = 4;
+
+    std::vector<ThenHandler> mSteps;
+    size_t                   mNextStep;
+    ResultHandler            mResultHandler; // Cleared once the result is reported.
 };
 
 } // namespace Ncp
@@ -41,6 +41,15 @@
 
 #include "ncp/async_task.hpp"
 
+#ifndef OTBR_CONFIG_NCP_COUNTERS_CACHE_TIMEOUT
+/**
+ * @def OTBR_CONFIG_NCP_COUNTERS_CACHE_TIMEOUT
+ *
+ * The time in milliseconds for which the counters fetched from the NCP are answered from the cache.
+ */
+#define OTBR_CONFIG_NCP_COUNTERS_CACHE_TIMEOUT 1000
+#endif
+
 namespace otbr {
 namespace Ncp {
 
@@ -48,7 +57,10 @@ namespace Ncp {
 
 NcpNetworkProperties::NcpNetworkProperties(void)
     : mDeviceRole(OT_DEVICE_ROLE_DISABLED)
+    , mDatasetActiveTlvsValid(false)
 {
+    memset(&mDatasetActiveTlvs, 0, sizeof(mDatasetActiveTlvs));
+    memset(&mIp6Counters, 0, sizeof(mIp6Counters));
 }
 
 otDeviceRole NcpNetworkProperties::GetDeviceRole(void) const
@@ -56,15 +68,50 @@ otDeviceRole NcpNetworkProperties::GetDeviceRole(void) const
     return mDeviceRole;
 }
 
+bool NcpNetworkProperties::GetCachedDatasetActiveTlvs(otOperationalDatasetTlvs &aActiveOpDatasetTlvs) const
+{
+    if (mDatasetActiveTlvsValid)
+    {
+        aActiveOpDatasetTlvs = mDatasetActiveTlvs;
+    }
+
+    return mDatasetActiveTlvsValid;
+}
+
+bool NcpNetworkProperties::GetCachedIp6Counters(otIpCounters &aCounters, Milliseconds aMaxAge) const
+{
+    bool isFresh = mIp6CountersUpdateTime != Timepoint() && Clock::now() - mIp6CountersUpdateTime <= aMaxAge;
+
+    if (isFresh)
+    {
+        aCounters = mIp6Counters;
+    }
+
+    return isFresh;
+}
+
 void NcpNetworkProperties::SetDeviceRole(otDeviceRole aRole)
 {
     mDeviceRole = aRole;
 }
 
+void NcpNetworkProperties::SetDatasetActiveTlvs(const otOperationalDatasetTlvs &aActiveOpDatasetTlvs)
+{
+    mDatasetActiveTlvs      = aActiveOpDatasetTlvs;
+    mDatasetActiveTlvsValid = true;
+}
+
+void NcpNetworkProperties::SetIp6Counters(const otIpCounters &aCounters)
+{
+    mIp6Counters           = aCounters;
+    mIp6CountersUpdateTime = Clock::now();
+}
+
 // ===================================== NcpHost ======================================
 
 NcpHost::NcpHost(const char *aInterfaceName, bool aDryRun)
-    : mSpinelDriver(*static_cast<ot::Spinel::SpinelDriver *>(otSysGetSpinelDriver()))
+    : MainloopProcessor(kPriorityRadio)
+    , mSpinelDriver(*static_cast<ot::Spinel::SpinelDriver *>(otSysGetSpinelDriver()))
     , mNetif(mNcpSpinel)
 {
     memset(&mConfig, 0, sizeof(mConfig));
@@ -100,6 +147,76 @@ void NcpHost::Deinit(void)
     otSysDeinit();
 }
 
+void NcpHost::GetDatasetActiveTlvs(const DatasetActiveTlvsReceiver &aReceiver)
+{
+    otOperationalDatasetTlvs datasetTlvs;
+
+    if (GetCachedDatasetActiveTlvs(datasetTlvs))
+    {
+        aReceiver(OT_ERROR_NONE, datasetTlvs);
+        ExitNow();
+    }
+
+    mDatasetActiveTlvsReceivers.push_back(aReceiver);
+    VerifyOrExit(mDatasetActiveTlvsReceivers.size() == 1);
+
+    mNcpSpinel.DatasetGetActiveTlvs(std::make_shared<AsyncTask>([this](otError aError, const std::string &) {
+        std::vector<DatasetActiveTlvsReceiver> receivers;
+        otOperationalDatasetTlvs               tlvs;
+
+        receivers.swap(mDatasetActiveTlvsReceivers);
+        memset(&tlvs, 0, sizeof(tlvs));
+        if (aError == OT_ERROR_NONE && !GetCachedDatasetActiveTlvs(tlvs))
+        {
+            aError = OT_ERROR_FAILED;
+        }
+
+        for (const DatasetActiveTlvsReceiver &receiver : receivers)
+        {
+            receiver(aError, tlvs);
+        }
+    }));
+
+exit:
+    return;
+}
+
+void NcpHost::GetIp6Counters(const Ip6CountersReceiver &aReceiver)
+{
+    static constexpr Milliseconds kMaxAge(OTBR_CONFIG_NCP_COUNTERS_CACHE_TIMEOUT);
+
+    otIpCounters counters;
+
+    if (GetCachedIp6Counters(counters, kMaxAge))
+    {
+        aReceiver(OT_ERROR_NONE, counters);
+        ExitNow();
+    }
+
+    mIp6CountersReceivers.push_back(aReceiver);
+    VerifyOrExit(mIp6CountersReceivers.size() == 1);
+
+    mNcpSpinel.Ip6GetCounters(std::make_shared<AsyncTask>([this](otError aError, const std::string &) {
+        std::vector<Ip6CountersReceiver> receivers;
+        otIpCounters                     ip6Counters;
+
+        receivers.swap(mIp6CountersReceivers);
+        memset(&ip6Counters, 0, sizeof(ip6Counters));
+        if (aError == OT_ERROR_NONE && !GetCachedIp6Counters(ip6Counters, kMaxAge))
+        {
+            aError = OT_ERROR_FAILED;
+        }
+
+        for (const Ip6CountersReceiver &receiver : receivers)
+        {
+            receiver(aError, ip6Counters);
+        }
+    }));
+
+exit:
+    return;
+}
+
 void NcpHost::Join(const otOperationalDatasetTlvs &aActiveOpDatasetTlvs, const AsyncResultReceiver &aReceiver)
 {
     AsyncTaskPtr task;
@@ -109,8 +226,8 @@ void NcpHost::Join(const otOperationalDatasetTlvs &aActiveOpDatasetTlvs, const A
     task->First([this, aActiveOpDatasetTlvs](AsyncTaskPtr aNext) {
             mNcpSpinel.DatasetSetActiveTlvs(aActiveOpDatasetTlvs, std::move(aNext));
         })
-        ->Then([this](AsyncTaskPtr aNext) { mNcpSpinel.Ip6SetEnabled(true, std::move(aNext)); })
-        ->Then([this](AsyncTaskPtr aNext) { mNcpSpinel.ThreadSetEnabled(true, std::move(aNext)); });
+        .Then([this](AsyncTaskPtr aNext) { mNcpSpinel.Ip6SetEnabled(true, std::move(aNext)); })
+        .Then([this](AsyncTaskPtr aNext) { mNcpSpinel.ThreadSetEnabled(true, std::move(aNext)); });
     task->Run();
 }
 
@@ -121,7 +238,7 @@ void NcpHost::Leave(const AsyncResultReceiver &aReceiver)
 
     task = std::make_shared<AsyncTask>(errorHandler);
     task->First([this](AsyncTaskPtr aNext) { mNcpSpinel.ThreadDetachGracefully(std::move(aNext)); })
-        ->Then([this](AsyncTaskPtr aNext) { mNcpSpinel.ThreadErasePersistentInfo(std::move(aNext)); });
+        .Then([this](AsyncTaskPtr aNext) { mNcpSpinel.ThreadErasePersistentInfo(std::move(aNext)); });
     task->Run();
 }
 
@@ -37,7 +37,10 @@
 #include "lib/spinel/coprocessor_type.h"
 #include "lib/spinel/spinel_driver.hpp"
 
+#include <vector>
+
 #include "common/mainloop.hpp"
+#include "common/time.hpp"
 #include "ncp/ncp_spinel.hpp"
 #include "ncp/thread_host.hpp"
 #include "posix/netif.hpp"
@@ -47,6 +50,8 @@ namespace Ncp {
 
 /**
  * This class implements the NetworkProperties under NCP mode.
+ *
+ * The properties are cached from the values the NCP reports, so they can be read without a round trip to the NCP.
  */
 class NcpNetworkProperties : virtual public NetworkProperties, public PropsObserver
 {
@@ -59,16 +64,46 @@ public:
     // NetworkProperties methods
     otDeviceRole GetDeviceRole(void) const override;
 
+    /**
+     * Returns the cached active operational dataset.
+     *
+     * @param[out] aActiveOpDatasetTlvs  The active operational dataset, of zero length if there is none.
+     *
+     * @retval TRUE   The dataset is returned.
+     * @retval FALSE  The NCP hasn't reported the dataset yet.
+     */
+    bool GetCachedDatasetActiveTlvs(otOperationalDatasetTlvs &aActiveOpDatasetTlvs) const;
+
+    /**
+     * Returns the cached IPv6 counters.
+     *
+     * @param[out] aCounters  The IPv6 counters.
+     * @param[in]  aMaxAge    The maximum time since the counters were reported by the NCP.
+     *
+     * @retval TRUE   The counters are returned.
+     * @retval FALSE  The NCP hasn't reported the counters within @p aMaxAge.
+     */
+    bool GetCachedIp6Counters(otIpCounters &aCounters, Milliseconds aMaxAge) const;
+
 private:
     // PropsObserver methods
     void SetDeviceRole(otDeviceRole aRole) override;
-
-    otDeviceRole mDeviceRole;
+    void SetDatasetActiveTlvs(const otOperationalDatasetTlvs &aActiveOpDatasetTlvs) override;
+    void SetIp6Counters(const otIpCounters &aCounters) override;
+
+    otDeviceRole             mDeviceRole;
+    bool                     mDatasetActiveTlvsValid;
+    otOperationalDatasetTlvs mDatasetActiveTlvs;
+    otIpCounters             mIp6Counters;
+    Timepoint                mIp6CountersUpdateTime; ///< When `mIp6Counters` were reported, default if never.
 };
 
-class NcpHost : public MainloopProcessor, public ThreadHost, public NcpNetworkProperties
+class NcpHost final : public MainloopProcessor, public ThreadHost, public NcpNetworkProperties
 {
 public:
+    using DatasetActiveTlvsReceiver = std::function<void(otError, const otOperationalDatasetTlvs &)>;
+    using Ip6CountersReceiver       = std::function<void(otError, const otIpCounters &)>;
+
     /**
      * Constructor.
      *
@@ -90,12 +125,48 @@ public:
     CoprocessorType GetCoprocessorType(void) override { return OT_COPROCESSOR_NCP; }
     const char     *GetCoprocessorVersion(void) override;
     const char     *GetInterfaceName(void) const override { return mConfig.mInterfaceName; }
+    TaskRunner     &GetTaskRunner(void) override { return mTaskRunner; }
     void            Init(void) override;
     void            Deinit(void) override;
 
+    /**
+     * Gets the active operational dataset.
+     *
+     * The dataset is answered from the cache, which the NCP keeps up to date, and only fetched from the NCP when it
+     * hasn't been reported yet.
+     *
+     * @param[in] aReceiver  The receiver of the dataset, which may be invoked before this method returns.
+     */
+    void GetDatasetActiveTlvs(const DatasetActiveTlvsReceiver &aReceiver);
+
+    /**
+     * Gets the IPv6 counters.
+     *
+     * The NCP doesn't report the counters as they change, so they are fetched from the NCP when the cached ones are
+     * older than `OTBR_CONFIG_NCP_COUNTERS_CACHE_TIMEOUT`.
+     *
+     * @param[in] aReceiver  The receiver of the counters, which may be invoked before this method returns.
+     */
+    void GetIp6Counters(const Ip6CountersReceiver &aReceiver);
+
+    /**
+     * Returns the trace of the recent spinel frames exchanged with the NCP.
+     *
+     * @returns The spinel frame trace.
+     */
+    const SpinelFrameTrace &GetSpinelFrameTrace(void) const { return mNcpSpinel.GetFrameTrace(); }
+
+    /**
+     * Returns the network interface of the Thread network.
+     *
+     * @returns The network interface.
+     */
+    Netif &GetNetif(void) { return mNetif; }
+
     // MainloopProcessor methods
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "NcpHost"; }
+    void        Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
 
 private:
     ot::Spinel::SpinelDriver &mSpinelDriver;
@@ -103,6 +174,10 @@ private:
     NcpSpinel                 mNcpSpinel;
     TaskRunner                mTaskRunner;
     Netif                     mNetif;
+
+    // Getters arriving while a value is fetched from the NCP wait for the same response.
+    std::vector<DatasetActiveTlvsReceiver> mDatasetActiveTlvsReceivers;
+    std::vector<Ip6CountersReceiver>       mIp6CountersReceivers;
 };
 
 } // namespace Ncp
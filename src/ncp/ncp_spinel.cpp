@@ -39,11 +39,22 @@
 
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/trace.hpp"
 #include "lib/spinel/spinel.h"
 #include "lib/spinel/spinel_decoder.hpp"
 #include "lib/spinel/spinel_driver.hpp"
 #include "lib/spinel/spinel_helper.hpp"
 
+#ifndef OTBR_CONFIG_NCP_SPINEL_RESPONSE_TIMEOUT
+/**
+ * @def OTBR_CONFIG_NCP_SPINEL_RESPONSE_TIMEOUT
+ *
+ * The time in milliseconds to wait for the response to a spinel command before its transaction id is released and
+ * the operation fails with OT_ERROR_RESPONSE_TIMEOUT.
+ */
+#define OTBR_CONFIG_NCP_SPINEL_RESPONSE_TIMEOUT 2000
+#endif
+
 namespace otbr {
 namespace Ncp {
 
@@ -58,8 +69,31 @@ NcpSpinel::NcpSpinel(void)
     , mIid(SPINEL_HEADER_INVALID_IID)
     , mPropsObserver(nullptr)
 {
+    static const struct
+    {
+        spinel_command_t mCmd;
+        const char      *mLabel;
+    } kLatencyCommands[kNumLatencyMetrics] = {
+        {SPINEL_CMD_PROP_VALUE_GET, "cmd=\"get\""},       {SPINEL_CMD_PROP_VALUE_SET, "cmd=\"set\""},
+        {SPINEL_CMD_PROP_VALUE_INSERT, "cmd=\"insert\""}, {SPINEL_CMD_PROP_VALUE_REMOVE, "cmd=\"remove\""},
+        {SPINEL_CMD_NET_CLEAR, "cmd=\"clear\""},
+    };
+    const std::vector<uint64_t> latencyBounds = {1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000};
+    Metrics::Registry          &registry      = Metrics::Registry::Get();
+
     std::fill_n(mWaitingKeyTable, SPINEL_PROP_LAST_STATUS, sizeof(mWaitingKeyTable));
     memset(mCmdTable, 0, sizeof(mCmdTable));
+    memset(mCmdTimeoutTable, 0, sizeof(mCmdTimeoutTable));
+
+    for (uint8_t i = 0; i < kNumLatencyMetrics; i++)
+    {
+        mLatencyMetrics[i].mCmd       = kLatencyCommands[i].mCmd;
+        mLatencyMetrics[i].mHistogram = &registry.AddHistogram(
+            "otbr_ncp_spinel_latency_ms", "The round-trip latencies of the spinel commands sent to the NCP.",
+            latencyBounds, kLatencyCommands[i].mLabel);
+    }
+    mTimeoutMetric =
+        &registry.AddCounter("otbr_ncp_spinel_timeouts", "The spinel commands the NCP didn't respond to in time.");
 }
 
 void NcpSpinel::Init(ot::Spinel::SpinelDriver &aSpinelDriver, PropsObserver &aObserver)
@@ -72,6 +106,18 @@ void NcpSpinel::Init(ot::Spinel::SpinelDriver &aSpinelDriver, PropsObserver &aOb
 
 void NcpSpinel::Deinit(void)
 {
+    for (TaskRunner::TaskId &timeoutTaskId : mCmdTimeoutTable)
+    {
+        if (timeoutTaskId != 0)
+        {
+            mTaskRunner.Cancel(timeoutTaskId);
+            timeoutTaskId = 0;
+        }
+    }
+    mPendingCommands.clear();
+    mPendingMulticastSubscriptions.clear();
+    mIp6AddressTable.clear();
+    mIp6MulticastAddressTable.clear();
     mSpinelDriver              = nullptr;
     mIp6AddressTableCallback   = nullptr;
     mNetifStateChangedCallback = nullptr;
@@ -112,6 +158,22 @@ exit:
     }
 }
 
+void NcpSpinel::DatasetGetActiveTlvs(AsyncTaskPtr aAsyncTask)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mDatasetGetActiveTask == nullptr, error = OT_ERROR_BUSY);
+
+    SuccessOrExit(error = GetProperty(SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS));
+    mDatasetGetActiveTask = aAsyncTask;
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        mTaskRunner.Post([aAsyncTask, error](void) { aAsyncTask->SetResult(error, "Failed to get active dataset!"); });
+    }
+}
+
 void NcpSpinel::DatasetMgmtSetPending(std::shared_ptr<otOperationalDatasetTlvs> aPendingOpDatasetTlvsPtr,
                                       AsyncTaskPtr                              aAsyncTask)
 {
@@ -153,15 +215,41 @@ exit:
 
 otbrError NcpSpinel::Ip6Send(const uint8_t *aData, uint16_t aLength)
 {
-    otbrError    error        = OTBR_ERROR_NONE;
-    EncodingFunc encodingFunc = [this, aData, aLength] { return mEncoder.WriteDataWithLen(aData, aLength); };
+    otbrError    error = OTBR_ERROR_NONE;
+    spinel_tid_t tid   = mPendingCommands.empty() ? GetNextTid() : 0;
 
-    SuccessOrExit(SetProperty(SPINEL_PROP_STREAM_NET, encodingFunc), error = OTBR_ERROR_OPENTHREAD);
+    if (tid != 0)
+    {
+        SuccessOrExit(SendIp6StreamFrame(tid, aData, aLength), error = OTBR_ERROR_OPENTHREAD);
+    }
+    else
+    {
+        // No TID is free now, go through `SetProperty()` which queues the command.
+        EncodingFunc encodingFunc = [this, aData, aLength] { return mEncoder.WriteDataWithLen(aData, aLength); };
+
+        SuccessOrExit(SetProperty(SPINEL_PROP_STREAM_NET, encodingFunc), error = OTBR_ERROR_OPENTHREAD);
+    }
 
 exit:
     return error;
 }
 
+void NcpSpinel::Ip6GetCounters(AsyncTaskPtr aAsyncTask)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mIp6GetCountersTask == nullptr, error = OT_ERROR_BUSY);
+
+    SuccessOrExit(error = GetProperty(SPINEL_PROP_CNTR_ALL_IP_COUNTERS));
+    mIp6GetCountersTask = aAsyncTask;
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        mTaskRunner.Post([aAsyncTask, error](void) { aAsyncTask->SetResult(error, "Failed to get IPv6 counters!"); });
+    }
+}
+
 void NcpSpinel::ThreadSetEnabled(bool aEnable, AsyncTaskPtr aAsyncTask)
 {
     otError      error        = OT_ERROR_NONE;
@@ -201,21 +289,17 @@ exit:
 
 void NcpSpinel::ThreadErasePersistentInfo(AsyncTaskPtr aAsyncTask)
 {
-    otError      error = OT_ERROR_NONE;
-    spinel_tid_t tid   = GetNextTid();
+    otError      error        = OT_ERROR_NONE;
+    EncodingFunc encodingFunc = [] { return OT_ERROR_NONE; };
 
     VerifyOrExit(mThreadErasePersistentInfoTask == nullptr, error = OT_ERROR_BUSY);
 
-    SuccessOrExit(error = mSpinelDriver->SendCommand(SPINEL_CMD_NET_CLEAR, SPINEL_PROP_LAST_STATUS, tid));
-
-    mWaitingKeyTable[tid]          = SPINEL_PROP_LAST_STATUS;
-    mCmdTable[tid]                 = SPINEL_CMD_NET_CLEAR;
+    SuccessOrExit(error = SendCommand(SPINEL_CMD_NET_CLEAR, SPINEL_PROP_LAST_STATUS, encodingFunc));
     mThreadErasePersistentInfoTask = aAsyncTask;
 
 exit:
     if (error != OT_ERROR_NONE)
     {
-        FreeTidTableItem(tid);
         mTaskRunner.Post(
             [aAsyncTask, error](void) { aAsyncTask->SetResult(error, "Failed to erase persistent info!"); });
     }
@@ -232,8 +316,12 @@ void NcpSpinel::HandleReceivedFrame(const uint8_t *aFrame,
 
 void NcpSpinel::HandleReceivedFrame(const uint8_t *aFrame, uint16_t aLength, uint8_t aHeader, bool &aShouldSaveFrame)
 {
+    OTBR_TRACE_SCOPE("spinel.rx");
+
     spinel_tid_t tid = SPINEL_HEADER_GET_TID(aHeader);
 
+    TraceFrame(SpinelFrameTrace::kDirectionRx, aFrame, aLength);
+
     if (tid == 0)
     {
         HandleNotification(aFrame, aLength);
@@ -290,6 +378,11 @@ void NcpSpinel::HandleResponse(spinel_tid_t aTid, const uint8_t *aFrame, uint16_
 
     switch (mCmdTable[aTid])
     {
+    case SPINEL_CMD_PROP_VALUE_GET:
+    {
+        error = HandleResponseForPropGet(aTid, cmd, key, data, len);
+        break;
+    }
     case SPINEL_CMD_PROP_VALUE_SET:
     {
         error = HandleResponseForPropSet(aTid, key, data, len);
@@ -310,6 +403,10 @@ void NcpSpinel::HandleResponse(spinel_tid_t aTid, const uint8_t *aFrame, uint16_
         spinel_status_t status = SPINEL_STATUS_OK;
 
         SuccessOrExit(error = SpinelDataUnpack(data, len, SPINEL_DATATYPE_UINT_PACKED_S, &status));
+        if (status == SPINEL_STATUS_OK)
+        {
+            mPropsObserver->SetDatasetActiveTlvs(otOperationalDatasetTlvs{});
+        }
         CallAndClear(mThreadErasePersistentInfoTask, ot::Spinel::SpinelStatusToOtError(status));
         break;
     }
@@ -327,7 +424,9 @@ exit:
     {
         otbrLogCrit("Error parsing response with tid:%u", aTid);
     }
+    RecordCommandLatency(aTid);
     FreeTidTableItem(aTid);
+    SendPendingCommands();
 }
 
 void NcpSpinel::HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength)
@@ -366,6 +465,26 @@ void NcpSpinel::HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, ui
         break;
     }
 
+    case SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS:
+    {
+        otOperationalDatasetTlvs datasetTlvs;
+
+        VerifyOrExit(aLength <= sizeof(datasetTlvs.mTlvs), error = OTBR_ERROR_PARSE);
+        std::copy(aBuffer, aBuffer + aLength, datasetTlvs.mTlvs);
+        datasetTlvs.mLength = static_cast<uint8_t>(aLength);
+        mPropsObserver->SetDatasetActiveTlvs(datasetTlvs);
+        break;
+    }
+
+    case SPINEL_PROP_CNTR_ALL_IP_COUNTERS:
+    {
+        otIpCounters counters;
+
+        VerifyOrExit(ParseIp6Counters(aBuffer, aLength, counters) == OT_ERROR_NONE, error = OTBR_ERROR_PARSE);
+        mPropsObserver->SetIp6Counters(counters);
+        break;
+    }
+
     case SPINEL_PROP_THREAD_MGMT_SET_PENDING_DATASET_TLVS:
     {
         spinel_status_t status = SPINEL_STATUS_OK;
@@ -377,21 +496,25 @@ void NcpSpinel::HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, ui
 
     case SPINEL_PROP_IPV6_ADDRESS_TABLE:
     {
-        std::vector<Ip6AddressInfo> addressInfoTable;
-
-        VerifyOrExit(ParseIp6AddressTable(aBuffer, aLength, addressInfoTable) == OT_ERROR_NONE,
+        mIp6AddressTableScratch.clear();
+        VerifyOrExit(ParseIp6AddressTable(aBuffer, aLength, mIp6AddressTableScratch) == OT_ERROR_NONE,
                      error = OTBR_ERROR_PARSE);
-        SafeInvoke(mIp6AddressTableCallback, addressInfoTable);
+        VerifyOrExit(mIp6AddressTableScratch != mIp6AddressTable);
+
+        mIp6AddressTable.swap(mIp6AddressTableScratch);
+        SafeInvoke(mIp6AddressTableCallback, mIp6AddressTable);
         break;
     }
 
     case SPINEL_PROP_IPV6_MULTICAST_ADDRESS_TABLE:
     {
-        std::vector<Ip6Address> addressTable;
-
-        VerifyOrExit(ParseIp6MulticastAddresses(aBuffer, aLength, addressTable) == OT_ERROR_NONE,
+        mIp6MulticastAddressTableScratch.clear();
+        VerifyOrExit(ParseIp6MulticastAddresses(aBuffer, aLength, mIp6MulticastAddressTableScratch) == OT_ERROR_NONE,
                      error = OTBR_ERROR_PARSE);
-        SafeInvoke(mIp6MulticastAddressTableCallback, addressTable);
+        VerifyOrExit(mIp6MulticastAddressTableScratch != mIp6MulticastAddressTable);
+
+        mIp6MulticastAddressTable.swap(mIp6MulticastAddressTableScratch);
+        SafeInvoke(mIp6MulticastAddressTableCallback, mIp6MulticastAddressTable);
         break;
     }
 
@@ -423,6 +546,36 @@ exit:
     return;
 }
 
+otbrError NcpSpinel::HandleResponseForPropGet(spinel_tid_t      aTid,
+                                              spinel_command_t  aCmd,
+                                              spinel_prop_key_t aKey,
+                                              const uint8_t    *aData,
+                                              uint16_t          aLength)
+{
+    otbrError error  = OTBR_ERROR_NONE;
+    otError   result = OT_ERROR_NONE;
+
+    VerifyOrExit(aCmd == SPINEL_CMD_PROP_VALUE_IS, error = OTBR_ERROR_INVALID_STATE);
+
+    if (aKey == SPINEL_PROP_LAST_STATUS)
+    {
+        spinel_status_t status = SPINEL_STATUS_OK;
+
+        SuccessOrExit(error = SpinelDataUnpack(aData, aLength, SPINEL_DATATYPE_UINT_PACKED_S, &status));
+        result = ot::Spinel::SpinelStatusToOtError(status);
+    }
+    else
+    {
+        VerifyOrExit(aKey == mWaitingKeyTable[aTid], error = OTBR_ERROR_INVALID_STATE);
+        // The value is handled like a notification so that it updates the `PropsObserver`.
+        HandleValueIs(aKey, aData, aLength);
+    }
+
+exit:
+    HandleGetResult(mWaitingKeyTable[aTid], error == OTBR_ERROR_NONE ? result : OT_ERROR_FAILED);
+    return error;
+}
+
 otbrError NcpSpinel::HandleResponseForPropSet(spinel_tid_t      aTid,
                                               spinel_prop_key_t aKey,
                                               const uint8_t    *aData,
@@ -437,6 +590,7 @@ otbrError NcpSpinel::HandleResponseForPropSet(spinel_tid_t      aTid,
     {
     case SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS:
         VerifyOrExit(aKey == SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS, error = OTBR_ERROR_INVALID_STATE);
+        HandleValueIs(aKey, aData, aLength);
         CallAndClear(mDatasetSetActiveTask, OT_ERROR_NONE);
         break;
 
@@ -549,22 +703,50 @@ exit:
 
 otbrError NcpSpinel::Ip6MulAddrUpdateSubscription(const otIp6Address &aAddress, bool aIsAdded)
 {
-    otbrError    error        = OTBR_ERROR_NONE;
-    EncodingFunc encodingFunc = [this, aAddress] { return mEncoder.WriteIp6Address(aAddress); };
-
-    if (aIsAdded)
+    // Subscription changes are coalesced and sent once per mainloop iteration, so that a burst of
+    // MLD reports for the same groups (e.g. at startup) results in one command per address.
+    if (mPendingMulticastSubscriptions.empty())
     {
-        SuccessOrExit(InsertProperty(SPINEL_PROP_IPV6_MULTICAST_ADDRESS_TABLE, encodingFunc),
-                      error = OTBR_ERROR_OPENTHREAD);
+        mTaskRunner.Post([this](void) { UpdatePendingMulticastSubscriptions(); });
     }
-    else
+
+    mPendingMulticastSubscriptions[Ip6Address(aAddress)] = aIsAdded;
+
+    return OTBR_ERROR_NONE;
+}
+
+void NcpSpinel::UpdatePendingMulticastSubscriptions(void)
+{
+    std::map<Ip6Address, bool> subscriptions;
+
+    subscriptions.swap(mPendingMulticastSubscriptions);
+    VerifyOrExit(mSpinelDriver != nullptr);
+
+    for (const auto &subscription : subscriptions)
     {
-        SuccessOrExit(RemoveProperty(SPINEL_PROP_IPV6_MULTICAST_ADDRESS_TABLE, encodingFunc),
-                      error = OTBR_ERROR_OPENTHREAD);
+        const Ip6Address &address      = subscription.first;
+        EncodingFunc      encodingFunc = [this, &address] { return mEncoder.WriteIp6Address(address.m8); };
+        otError           error;
+
+        if (subscription.second)
+        {
+            error = InsertProperty(SPINEL_PROP_IPV6_MULTICAST_ADDRESS_TABLE, encodingFunc);
+        }
+        else
+        {
+            error = RemoveProperty(SPINEL_PROP_IPV6_MULTICAST_ADDRESS_TABLE, encodingFunc);
+        }
+
+        if (error != OT_ERROR_NONE)
+        {
+            otbrLogWarning("Failed to %s multicast address %s on NCP: %s",
+                           subscription.second ? "subscribe" : "unsubscribe", address.ToInfoString().AsCString(),
+                           otThreadErrorToString(error));
+        }
     }
 
 exit:
-    return error;
+    return;
 }
 
 spinel_tid_t NcpSpinel::GetNextTid(void)
@@ -597,30 +779,98 @@ void NcpSpinel::FreeTidTableItem(spinel_tid_t aTid)
 
     mCmdTable[aTid]        = SPINEL_CMD_NOOP;
     mWaitingKeyTable[aTid] = SPINEL_PROP_LAST_STATUS;
+
+    if (mCmdTimeoutTable[aTid] != 0)
+    {
+        mTaskRunner.Cancel(mCmdTimeoutTable[aTid]);
+        mCmdTimeoutTable[aTid] = 0;
+    }
+}
+
+void NcpSpinel::StartCommandTimer(spinel_tid_t aTid)
+{
+    mCmdSendTimeTable[aTid] = Clock::now();
+    mCmdTimeoutTable[aTid]  = mTaskRunner.Post(Milliseconds(OTBR_CONFIG_NCP_SPINEL_RESPONSE_TIMEOUT),
+                                               [this, aTid](void) { HandleCommandTimeout(aTid); });
+}
+
+void NcpSpinel::HandleCommandTimeout(spinel_tid_t aTid)
+{
+    spinel_command_t  cmd = mCmdTable[aTid];
+    spinel_prop_key_t key = mWaitingKeyTable[aTid];
+
+    // The task has run, so it must not be canceled when the TID is freed.
+    mCmdTimeoutTable[aTid] = 0;
+
+    otbrLogWarning("No response to (cmd:%u, key:%u) for tid:%u from the NCP", cmd, key, aTid);
+    mTimeoutMetric->Increment();
+
+    FreeTidTableItem(aTid);
+    HandleSendFailure(cmd, key, OT_ERROR_RESPONSE_TIMEOUT);
+    SendPendingCommands();
+}
+
+void NcpSpinel::RecordCommandLatency(spinel_tid_t aTid)
+{
+    // A response arriving after the timeout has no command waiting for it anymore. IPv6 frames are not tracked, so
+    // that they don't mask the latencies of the control commands.
+    VerifyOrExit(mCmdTimeoutTable[aTid] != 0 && mWaitingKeyTable[aTid] != SPINEL_PROP_STREAM_NET);
+
+    for (LatencyMetric &metric : mLatencyMetrics)
+    {
+        if (metric.mCmd == mCmdTable[aTid])
+        {
+            metric.mHistogram->Observe(static_cast<uint64_t>(
+                std::chrono::duration_cast<Milliseconds>(Clock::now() - mCmdSendTimeTable[aTid]).count()));
+            break;
+        }
+    }
+
+exit:
+    return;
 }
 
 otError NcpSpinel::SendCommand(spinel_command_t aCmd, spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc)
 {
-    otError      error  = OT_ERROR_NONE;
-    spinel_tid_t tid    = GetNextTid();
-    uint8_t      header = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID(mIid) | tid;
+    otError      error = OT_ERROR_NONE;
+    spinel_tid_t tid   = 0;
+    uint8_t      header;
+
+    // Commands already waiting for a TID keep their order, later commands queue behind them.
+    if (mPendingCommands.empty())
+    {
+        tid = GetNextTid();
+    }
+
+    header = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID(mIid) | tid;
 
-    VerifyOrExit(tid != 0, error = OT_ERROR_BUSY);
     SuccessOrExit(error = mEncoder.BeginFrame(header, aCmd, aKey));
     SuccessOrExit(error = aEncodingFunc());
     SuccessOrExit(error = mEncoder.EndFrame());
+
+    if (tid == 0)
+    {
+        ExitNow(error = QueueEncodedFrame(aCmd, aKey));
+    }
+
     SuccessOrExit(error = SendEncodedFrame());
 
     mCmdTable[tid]        = aCmd;
     mWaitingKeyTable[tid] = aKey;
+    StartCommandTimer(tid);
 exit:
-    if (error != OT_ERROR_NONE)
+    if (error != OT_ERROR_NONE && tid != 0)
     {
         FreeTidTableItem(tid);
     }
     return error;
 }
 
+otError NcpSpinel::GetProperty(spinel_prop_key_t aKey)
+{
+    return SendCommand(SPINEL_CMD_PROP_VALUE_GET, aKey, [] { return OT_ERROR_NONE; });
+}
+
 otError NcpSpinel::SetProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc)
 {
     return SendCommand(SPINEL_CMD_PROP_VALUE_SET, aKey, aEncodingFunc);
@@ -638,6 +888,8 @@ otError NcpSpinel::RemoveProperty(spinel_prop_key_t aKey, const EncodingFunc &aE
 
 otError NcpSpinel::SendEncodedFrame(void)
 {
+    OTBR_TRACE_SCOPE("spinel.tx");
+
     otError  error = OT_ERROR_NONE;
     uint8_t  frame[kTxBufferSize];
     uint16_t frameLength;
@@ -646,12 +898,174 @@ otError NcpSpinel::SendEncodedFrame(void)
     frameLength = mNcpBuffer.OutFrameGetLength();
     VerifyOrExit(mNcpBuffer.OutFrameRead(frameLength, frame) == frameLength, error = OT_ERROR_FAILED);
     SuccessOrExit(error = mSpinelDriver->GetSpinelInterface()->SendFrame(frame, frameLength));
+    TraceFrame(SpinelFrameTrace::kDirectionTx, frame, frameLength);
 
 exit:
     error = mNcpBuffer.OutFrameRemove();
     return error;
 }
 
+otError NcpSpinel::SendIp6StreamFrame(spinel_tid_t aTid, const uint8_t *aData, uint16_t aLength)
+{
+    // IPv6 datagrams are the bulk of the traffic to the NCP. Packing the frame directly into
+    // a contiguous buffer avoids encoding into `mNcpBuffer` and copying the frame out again.
+    OTBR_TRACE_SCOPE("spinel.tx.ip6");
+
+    otError        error  = OT_ERROR_NONE;
+    uint8_t        header = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID(mIid) | aTid;
+    spinel_ssize_t packed;
+
+    packed = spinel_datatype_pack(mStreamFrame, sizeof(mStreamFrame),
+                                  SPINEL_DATATYPE_COMMAND_PROP_S SPINEL_DATATYPE_DATA_WLEN_S, header,
+                                  SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_STREAM_NET, aData,
+                                  static_cast<unsigned int>(aLength));
+    VerifyOrExit(packed > 0 && static_cast<size_t>(packed) <= sizeof(mStreamFrame), error = OT_ERROR_NO_BUFS);
+    SuccessOrExit(error = mSpinelDriver->GetSpinelInterface()->SendFrame(mStreamFrame, static_cast<uint16_t>(packed)));
+    mFrameTrace.Add(SpinelFrameTrace::kDirectionTx, header, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_STREAM_NET,
+                    static_cast<uint16_t>(packed));
+
+    mCmdTable[aTid]        = SPINEL_CMD_PROP_VALUE_SET;
+    mWaitingKeyTable[aTid] = SPINEL_PROP_STREAM_NET;
+    StartCommandTimer(aTid);
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        FreeTidTableItem(aTid);
+    }
+    return error;
+}
+
+void NcpSpinel::TraceFrame(SpinelFrameTrace::Direction aDirection, const uint8_t *aFrame, uint16_t aLength)
+{
+    // Only the header, the command and the property key are decoded, so tracing doesn't slow down the frames.
+    unsigned int   cmd    = SPINEL_CMD_NOOP;
+    unsigned int   key    = SPINEL_PROP_LAST_STATUS;
+    spinel_size_t  offset = 1;
+    spinel_ssize_t decoded;
+
+    VerifyOrExit(aLength > offset);
+    decoded = spinel_packed_uint_decode(aFrame + offset, aLength - offset, &cmd);
+    VerifyOrExit(decoded > 0);
+    offset += static_cast<spinel_size_t>(decoded);
+    spinel_packed_uint_decode(aFrame + offset, aLength - offset, &key);
+
+exit:
+    mFrameTrace.Add(aDirection, aLength > 0 ? aFrame[0] : 0, cmd, key, aLength);
+}
+
+otError NcpSpinel::QueueEncodedFrame(spinel_command_t aCmd, spinel_prop_key_t aKey)
+{
+    otError        error = OT_ERROR_NONE;
+    PendingCommand command;
+    uint16_t       frameLength;
+
+    SuccessOrExit(error = mNcpBuffer.OutFrameBegin());
+    VerifyOrExit(mPendingCommands.size() < kMaxPendingCommands, error = OT_ERROR_BUSY);
+
+    frameLength  = mNcpBuffer.OutFrameGetLength();
+    command.mCmd = aCmd;
+    command.mKey = aKey;
+    command.mFrame.resize(frameLength);
+    VerifyOrExit(mNcpBuffer.OutFrameRead(frameLength, command.mFrame.data()) == frameLength, error = OT_ERROR_FAILED);
+
+    mPendingCommands.push_back(std::move(command));
+
+exit:
+    mNcpBuffer.OutFrameRemove();
+    return error;
+}
+
+void NcpSpinel::SendPendingCommands(void)
+{
+    while (!mPendingCommands.empty() && mSpinelDriver != nullptr)
+    {
+        PendingCommand &command     = mPendingCommands.front();
+        spinel_tid_t    tid         = GetNextTid();
+        uint16_t        frameLength = static_cast<uint16_t>(command.mFrame.size());
+        otError         error;
+
+        VerifyOrExit(tid != 0);
+
+        command.mFrame[0] = (command.mFrame[0] & ~SPINEL_HEADER_TID_MASK) | tid;
+        error             = mSpinelDriver->GetSpinelInterface()->SendFrame(command.mFrame.data(), frameLength);
+
+        if (error == OT_ERROR_NONE)
+        {
+            TraceFrame(SpinelFrameTrace::kDirectionTx, command.mFrame.data(), frameLength);
+            mCmdTable[tid]        = command.mCmd;
+            mWaitingKeyTable[tid] = command.mKey;
+            StartCommandTimer(tid);
+        }
+        else
+        {
+            FreeTidTableItem(tid);
+            otbrLogWarning("Failed to send queued command (cmd:%u, key:%u): %s", command.mCmd, command.mKey,
+                           otThreadErrorToString(error));
+            HandleSendFailure(command.mCmd, command.mKey, error);
+        }
+
+        mPendingCommands.pop_front();
+    }
+
+exit:
+    return;
+}
+
+void NcpSpinel::HandleSendFailure(spinel_command_t aCmd, spinel_prop_key_t aKey, otError aError)
+{
+    if (aCmd == SPINEL_CMD_PROP_VALUE_GET)
+    {
+        HandleGetResult(aKey, aError);
+        ExitNow();
+    }
+
+    if (aCmd == SPINEL_CMD_NET_CLEAR)
+    {
+        CallAndClear(mThreadErasePersistentInfoTask, aError, "Failed to erase persistent info!");
+        ExitNow();
+    }
+
+    switch (aKey)
+    {
+    case SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS:
+        CallAndClear(mDatasetSetActiveTask, aError, "Failed to set active dataset!");
+        break;
+    case SPINEL_PROP_THREAD_MGMT_SET_PENDING_DATASET_TLVS:
+        CallAndClear(mDatasetMgmtSetPendingTask, aError, "Failed to set pending dataset!");
+        break;
+    case SPINEL_PROP_NET_IF_UP:
+        CallAndClear(mIp6SetEnabledTask, aError, "Failed to enable the network interface!");
+        break;
+    case SPINEL_PROP_NET_STACK_UP:
+        CallAndClear(mThreadSetEnabledTask, aError, "Failed to enable the Thread network!");
+        break;
+    case SPINEL_PROP_NET_LEAVE_GRACEFULLY:
+        CallAndClear(mThreadDetachGracefullyTask, aError, "Failed to detach gracefully!");
+        break;
+    default:
+        break;
+    }
+
+exit:
+    return;
+}
+
+void NcpSpinel::HandleGetResult(spinel_prop_key_t aKey, otError aError)
+{
+    switch (aKey)
+    {
+    case SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS:
+        CallAndClear(mDatasetGetActiveTask, aError, aError == OT_ERROR_NONE ? "" : "Failed to get active dataset!");
+        break;
+    case SPINEL_PROP_CNTR_ALL_IP_COUNTERS:
+        CallAndClear(mIp6GetCountersTask, aError, aError == OT_ERROR_NONE ? "" : "Failed to get IPv6 counters!");
+        break;
+    default:
+        break;
+    }
+}
+
 otError NcpSpinel::ParseIp6AddressTable(const uint8_t               *aBuf,
                                         uint16_t                     aLength,
                                         std::vector<Ip6AddressInfo> &aAddressTable)
@@ -688,7 +1102,7 @@ exit:
     return error;
 }
 
-otError NcpSpinel::ParseIp6MulticastAddresses(const uint8_t *aBuf, uint8_t aLen, std::vector<Ip6Address> &aAddressList)
+otError NcpSpinel::ParseIp6MulticastAddresses(const uint8_t *aBuf, uint16_t aLen, std::vector<Ip6Address> &aAddressList)
 {
     otError             error = OT_ERROR_NONE;
     ot::Spinel::Decoder decoder;
@@ -711,7 +1125,31 @@ exit:
     return error;
 }
 
-otError NcpSpinel::ParseIp6StreamNet(const uint8_t *aBuf, uint8_t aLen, const uint8_t *&aData, uint16_t &aDataLen)
+otError NcpSpinel::ParseIp6Counters(const uint8_t *aBuf, uint16_t aLen, otIpCounters &aCounters)
+{
+    otError             error = OT_ERROR_NONE;
+    ot::Spinel::Decoder decoder;
+
+    VerifyOrExit(aBuf != nullptr, error = OT_ERROR_INVALID_ARGS);
+
+    memset(&aCounters, 0, sizeof(aCounters));
+    decoder.Init(aBuf, aLen);
+
+    SuccessOrExit(error = decoder.OpenStruct());
+    SuccessOrExit(error = decoder.ReadUint32(aCounters.mTxSuccess));
+    SuccessOrExit(error = decoder.ReadUint32(aCounters.mTxFailure));
+    SuccessOrExit(error = decoder.CloseStruct());
+
+    SuccessOrExit(error = decoder.OpenStruct());
+    SuccessOrExit(error = decoder.ReadUint32(aCounters.mRxSuccess));
+    SuccessOrExit(error = decoder.ReadUint32(aCounters.mRxFailure));
+    SuccessOrExit(error = decoder.CloseStruct());
+
+exit:
+    return error;
+}
+
+otError NcpSpinel::ParseIp6StreamNet(const uint8_t *aBuf, uint16_t aLen, const uint8_t *&aData, uint16_t &aDataLen)
 {
     otError             error = OT_ERROR_NONE;
     ot::Spinel::Decoder decoder;
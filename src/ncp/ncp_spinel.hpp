@@ -34,8 +34,11 @@
 #ifndef OTBR_AGENT_NCP_SPINEL_HPP_
 #define OTBR_AGENT_NCP_SPINEL_HPP_
 
+#include <deque>
 #include <functional>
+#include <map>
 #include <memory>
+#include <vector>
 
 #include <openthread/dataset.h>
 #include <openthread/error.h>
@@ -47,9 +50,12 @@
 #include "lib/spinel/spinel_driver.hpp"
 #include "lib/spinel/spinel_encoder.hpp"
 
+#include "common/metrics.hpp"
 #include "common/task_runner.hpp"
+#include "common/time.hpp"
 #include "common/types.hpp"
 #include "ncp/async_task.hpp"
+#include "ncp/spinel_frame_trace.hpp"
 #include "ncp/posix/netif.hpp"
 
 namespace otbr {
@@ -68,6 +74,20 @@ public:
      */
     virtual void SetDeviceRole(otDeviceRole aRole) = 0;
 
+    /**
+     * Updates the active operational dataset.
+     *
+     * @param[in] aActiveOpDatasetTlvs  The active operational dataset, of zero length if there is none.
+     */
+    virtual void SetDatasetActiveTlvs(const otOperationalDatasetTlvs &aActiveOpDatasetTlvs) = 0;
+
+    /**
+     * Updates the IPv6 counters.
+     *
+     * @param[in] aCounters  The IPv6 counters.
+     */
+    virtual void SetIp6Counters(const otIpCounters &aCounters) = 0;
+
     /**
      * The destructor.
      */
@@ -108,6 +128,11 @@ public:
      */
     const char *GetCoprocessorVersion(void) { return mSpinelDriver->GetVersion(); }
 
+    /**
+     * Returns the trace of the recent spinel frames exchanged with the NCP.
+     */
+    const SpinelFrameTrace &GetFrameTrace(void) const { return mFrameTrace; }
+
     /**
      * This method sets the active dataset on the NCP.
      *
@@ -119,6 +144,18 @@ public:
      */
     void DatasetSetActiveTlvs(const otOperationalDatasetTlvs &aActiveOpDatasetTlvs, AsyncTaskPtr aAsyncTask);
 
+    /**
+     * This method fetches the active dataset from the NCP.
+     *
+     * The dataset is reported to the `PropsObserver` before @p aAsyncTask is set the result.
+     *
+     * If this method is called again before the previous call completed, no action will be taken.
+     * The new receiver @p aAsyncTask will be set a result OT_ERROR_BUSY.
+     *
+     * @param[in] aAsyncTask  A pointer to an async result to receive the result of this operation.
+     */
+    void DatasetGetActiveTlvs(AsyncTaskPtr aAsyncTask);
+
     /**
      * This method instructs the NCP to send a MGMT_SET to set Thread Pending Operational Dataset.
      *
@@ -185,6 +222,18 @@ public:
      */
     otbrError Ip6Send(const uint8_t *aData, uint16_t aLength) override;
 
+    /**
+     * This method fetches the IPv6 counters from the NCP.
+     *
+     * The counters are reported to the `PropsObserver` before @p aAsyncTask is set the result.
+     *
+     * If this method is called again before the previous call completed, no action will be taken.
+     * The new receiver @p aAsyncTask will be set a result OT_ERROR_BUSY.
+     *
+     * @param[in] aAsyncTask  A pointer to an async result to receive the result of this operation.
+     */
+    void Ip6GetCounters(AsyncTaskPtr aAsyncTask);
+
     /**
      * This method enableds/disables the Thread network on the NCP.
      *
@@ -229,7 +278,27 @@ public:
 private:
     using FailureHandler = std::function<void(otError)>;
 
-    static constexpr uint8_t kMaxTids = 16;
+    static constexpr uint8_t  kMaxTids            = 16;
+    static constexpr uint16_t kMaxPendingCommands = 64; ///< Max commands waiting for a free TID.
+    static constexpr uint8_t  kNumLatencyMetrics  = 5;  ///< The command types whose latencies are tracked.
+
+    struct LatencyMetric
+    {
+        spinel_command_t    mCmd;
+        Metrics::Histogram *mHistogram;
+    };
+
+    /**
+     * A command which has been encoded while all TIDs were in use.
+     *
+     * The TID in the spinel header of `mFrame` is filled in when the command is sent.
+     */
+    struct PendingCommand
+    {
+        spinel_command_t     mCmd;
+        spinel_prop_key_t    mKey;
+        std::vector<uint8_t> mFrame;
+    };
 
     template <typename Function, typename... Args> static void SafeInvoke(Function &aFunc, Args &&...aArgs)
     {
@@ -263,6 +332,11 @@ private:
     void      HandleNotification(const uint8_t *aFrame, uint16_t aLength);
     void      HandleResponse(spinel_tid_t aTid, const uint8_t *aFrame, uint16_t aLength);
     void      HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
+    otbrError HandleResponseForPropGet(spinel_tid_t      aTid,
+                                       spinel_command_t  aCmd,
+                                       spinel_prop_key_t aKey,
+                                       const uint8_t    *aData,
+                                       uint16_t          aLength);
     otbrError HandleResponseForPropSet(spinel_tid_t      aTid,
                                        spinel_prop_key_t aKey,
                                        const uint8_t    *aData,
@@ -285,15 +359,27 @@ private:
 
     using EncodingFunc = std::function<otError(void)>;
     otError SendCommand(spinel_command_t aCmd, spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc);
+    otError GetProperty(spinel_prop_key_t aKey);
     otError SetProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc);
     otError InsertProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc);
     otError RemoveProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc);
 
     otError SendEncodedFrame(void);
+    otError SendIp6StreamFrame(spinel_tid_t aTid, const uint8_t *aData, uint16_t aLength);
+    otError QueueEncodedFrame(spinel_command_t aCmd, spinel_prop_key_t aKey);
+    void    TraceFrame(SpinelFrameTrace::Direction aDirection, const uint8_t *aFrame, uint16_t aLength);
+    void    SendPendingCommands(void);
+    void    StartCommandTimer(spinel_tid_t aTid);
+    void    HandleCommandTimeout(spinel_tid_t aTid);
+    void    RecordCommandLatency(spinel_tid_t aTid);
+    void    HandleSendFailure(spinel_command_t aCmd, spinel_prop_key_t aKey, otError aError);
+    void    HandleGetResult(spinel_prop_key_t aKey, otError aError);
+    void    UpdatePendingMulticastSubscriptions(void);
 
     otError ParseIp6AddressTable(const uint8_t *aBuf, uint16_t aLength, std::vector<Ip6AddressInfo> &aAddressTable);
-    otError ParseIp6MulticastAddresses(const uint8_t *aBuf, uint8_t aLen, std::vector<Ip6Address> &aAddressList);
-    otError ParseIp6StreamNet(const uint8_t *aBuf, uint8_t aLen, const uint8_t *&aData, uint16_t &aDataLen);
+    otError ParseIp6MulticastAddresses(const uint8_t *aBuf, uint16_t aLen, std::vector<Ip6Address> &aAddressList);
+    otError ParseIp6Counters(const uint8_t *aBuf, uint16_t aLen, otIpCounters &aCounters);
+    otError ParseIp6StreamNet(const uint8_t *aBuf, uint16_t aLen, const uint8_t *&aData, uint16_t &aDataLen);
 
     ot::Spinel::SpinelDriver *mSpinelDriver;
     uint16_t                  mCmdTidsInUse; ///< Used transaction ids.
@@ -303,19 +389,37 @@ private:
     spinel_command_t  mCmdTable[kMaxTids];        ///< The mapping of spinel command and tids when the response
                                                   ///< is LAST_STATUS.
 
+    TaskRunner::TaskId mCmdTimeoutTable[kMaxTids];  ///< The response timeout tasks of ongoing transactions.
+    Timepoint          mCmdSendTimeTable[kMaxTids]; ///< When the commands of ongoing transactions were sent.
+    LatencyMetric      mLatencyMetrics[kNumLatencyMetrics];
+    Metrics::Counter  *mTimeoutMetric;
+
+    // The address tables are decoded into reused buffers and only reported when they change.
+    std::vector<Ip6AddressInfo> mIp6AddressTable;
+    std::vector<Ip6AddressInfo> mIp6AddressTableScratch;
+    std::vector<Ip6Address>     mIp6MulticastAddressTable;
+    std::vector<Ip6Address>     mIp6MulticastAddressTableScratch;
+
+    std::deque<PendingCommand> mPendingCommands; ///< Commands waiting for a free TID, in order.
+    std::map<Ip6Address, bool> mPendingMulticastSubscriptions; ///< Latest subscription change per address.
+
     static constexpr uint16_t kTxBufferSize = 2048;
     uint8_t                   mTxBuffer[kTxBufferSize];
+    uint8_t                   mStreamFrame[kTxBufferSize]; ///< IPv6 frames are packed here and sent as is.
     ot::Spinel::Buffer        mNcpBuffer;
     ot::Spinel::Encoder       mEncoder;
     spinel_iid_t              mIid; /// < Interface Id used to in Spinel header
+    SpinelFrameTrace          mFrameTrace;
 
     TaskRunner mTaskRunner;
 
     PropsObserver *mPropsObserver;
 
     AsyncTaskPtr mDatasetSetActiveTask;
+    AsyncTaskPtr mDatasetGetActiveTask;
     AsyncTaskPtr mDatasetMgmtSetPendingTask;
     AsyncTaskPtr mIp6SetEnabledTask;
+    AsyncTaskPtr mIp6GetCountersTask;
     AsyncTaskPtr mThreadSetEnabledTask;
     AsyncTaskPtr mThreadDetachGracefullyTask;
     AsyncTaskPtr mThreadErasePersistentInfoTask;
@@ -30,7 +30,9 @@
 
 #include "infra_if.hpp"
 
+#include <fcntl.h>
 #include <ifaddrs.h>
+#include <unistd.h>
 #ifdef __linux__
 #include <linux/netlink.h>
 #include <linux/rtnetlink.h>
@@ -38,6 +40,8 @@
 #include <netinet/icmp6.h>
 #include <sys/ioctl.h>
 
+#include <algorithm>
+
 #include "utils/socket_utils.hpp"
 
 namespace otbr {
@@ -56,42 +60,100 @@ otbrError InfraIf::Dependencies::SetInfraIf(unsigned int                   aInfr
 InfraIf::InfraIf(Dependencies &aDependencies)
     : mDeps(aDependencies)
     , mInfraIfIndex(0)
+    , mNetlinkFd(-1)
+    , mFlags(0)
+    , mStateGeneration(0)
+    , mNotifiedGeneration(0)
 {
 }
 
 void InfraIf::Init(void)
 {
+#ifdef __linux__
+    mNetlinkFd = CreateNetLinkRouteSocket(RTMGRP_LINK | RTMGRP_IPV6_IFADDR);
+    if (mNetlinkFd == -1)
+    {
+        otbrLogWarning("Failed to create netlink socket: %s", strerror(errno));
+    }
+    else
+    {
+        VerifyOrDie(fcntl(mNetlinkFd, F_SETFL, fcntl(mNetlinkFd, F_GETFL) | O_NONBLOCK) == 0, strerror(errno));
+    }
+#endif
 }
 
 void InfraIf::Deinit(void)
 {
+    if (mNetlinkFd != -1)
+    {
+        close(mNetlinkFd);
+        mNetlinkFd = -1;
+    }
+
     mInfraIfIndex = 0;
+    mFlags        = 0;
+    mAddresses.clear();
+}
+
+void InfraIf::Process(const MainloopContext *aContext)
+{
+    if (mNetlinkFd != -1 && FD_ISSET(mNetlinkFd, &aContext->mReadFdSet))
+    {
+        ReceiveNetlinkMessage();
+    }
+}
+
+void InfraIf::UpdateFdSet(MainloopContext *aContext)
+{
+    if (mNetlinkFd != -1)
+    {
+        aContext->AddFdToSet(mNetlinkFd, MainloopContext::kReadFdSet);
+    }
 }
 
 otbrError InfraIf::SetInfraIf(const char *aIfName)
 {
-    otbrError               error = OTBR_ERROR_NONE;
-    std::vector<Ip6Address> addresses;
+    otbrError error = OTBR_ERROR_NONE;
 
     VerifyOrExit(aIfName != nullptr && strlen(aIfName) > 0, error = OTBR_ERROR_INVALID_ARGS);
     VerifyOrExit(strnlen(aIfName, IFNAMSIZ) < IFNAMSIZ, error = OTBR_ERROR_INVALID_ARGS);
-    strcpy(mInfraIfName, aIfName);
 
-    mInfraIfIndex = if_nametoindex(aIfName);
-    VerifyOrExit(mInfraIfIndex != 0, error = OTBR_ERROR_INVALID_STATE);
+    // Without netlink events the state may be outdated, so it's only reused while they maintain it.
+    if (mNetlinkFd == -1 || mInfraIfIndex == 0 || strcmp(mInfraIfName, aIfName) != 0)
+    {
+        strcpy(mInfraIfName, aIfName);
+
+        mInfraIfIndex = if_nametoindex(aIfName);
+        VerifyOrExit(mInfraIfIndex != 0, error = OTBR_ERROR_INVALID_STATE);
+
+        mFlags     = GetFlags();
+        mAddresses = GetAddresses();
+        mStateGeneration++;
+    }
 
-    addresses = GetAddresses();
+    error = NotifyState();
 
-    SuccessOrExit(mDeps.SetInfraIf(mInfraIfIndex, IsRunning(addresses), addresses), error = OTBR_ERROR_OPENTHREAD);
 exit:
     otbrLogResult(error, "SetInfraIf");
 
     return error;
 }
 
-bool InfraIf::IsRunning(const std::vector<Ip6Address> &aAddrs) const
+otbrError InfraIf::NotifyState(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mNotifiedGeneration != mStateGeneration);
+    SuccessOrExit(mDeps.SetInfraIf(mInfraIfIndex, IsRunning(), mAddresses), error = OTBR_ERROR_OPENTHREAD);
+    mNotifiedGeneration = mStateGeneration;
+
+exit:
+    return error;
+}
+
+bool InfraIf::IsRunning(void) const
 {
-    return mInfraIfIndex ? ((GetFlags() & IFF_RUNNING) && HasLinkLocalAddress(aAddrs)) : false;
+    return mInfraIfIndex ? ((mFlags & IFF_RUNNING) && HasLinkLocalAddress(mAddresses)) : false;
 }
 
 short InfraIf::GetFlags(void) const
@@ -147,6 +209,110 @@ exit:
     return addrs;
 }
 
+void InfraIf::HandleAddressChange(const Ip6Address &aAddress, bool aIsAdded)
+{
+    auto iter = std::find(mAddresses.begin(), mAddresses.end(), aAddress);
+
+    if (aIsAdded && iter == mAddresses.end())
+    {
+        mAddresses.push_back(aAddress);
+        mStateGeneration++;
+    }
+    else if (!aIsAdded && iter != mAddresses.end())
+    {
+        mAddresses.erase(iter);
+        mStateGeneration++;
+    }
+}
+
+void InfraIf::HandleFlagsChange(short aFlags)
+{
+    if (mFlags != aFlags)
+    {
+        mFlags = aFlags;
+        mStateGeneration++;
+    }
+}
+
+void InfraIf::ReceiveNetlinkMessage(void)
+{
+#ifdef __linux__
+    constexpr uint16_t kMaxReadsPerProcess = 16;
+    char               buffer[8192];
+
+    for (uint16_t i = 0; i < kMaxReadsPerProcess; i++)
+    {
+        ssize_t length = recv(mNetlinkFd, buffer, sizeof(buffer), 0);
+
+        if (length < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            break;
+        }
+
+        if (length <= 0)
+        {
+            otbrLogWarning("Failed to receive netlink events: %s", strerror(errno));
+            break;
+        }
+
+        for (nlmsghdr *msg = reinterpret_cast<nlmsghdr *>(buffer); NLMSG_OK(msg, static_cast<unsigned int>(length));
+             msg           = NLMSG_NEXT(msg, length))
+        {
+            switch (msg->nlmsg_type)
+            {
+            case RTM_NEWADDR:
+            case RTM_DELADDR:
+            {
+                const ifaddrmsg  *ifa       = reinterpret_cast<const ifaddrmsg *>(NLMSG_DATA(msg));
+                int               rtaLength = static_cast<int>(IFA_PAYLOAD(msg));
+                const Ip6Address *address   = nullptr;
+
+                if (ifa->ifa_family != AF_INET6 || ifa->ifa_index != mInfraIfIndex)
+                {
+                    break;
+                }
+
+                for (const rtattr *rta = IFA_RTA(ifa); RTA_OK(rta, rtaLength); rta = RTA_NEXT(rta, rtaLength))
+                {
+                    if ((rta->rta_type == IFA_LOCAL || (rta->rta_type == IFA_ADDRESS && address == nullptr)) &&
+                        RTA_PAYLOAD(rta) == sizeof(Ip6Address))
+                    {
+                        address = reinterpret_cast<const Ip6Address *>(RTA_DATA(rta));
+                    }
+                }
+
+                if (address != nullptr)
+                {
+                    HandleAddressChange(*address, msg->nlmsg_type == RTM_NEWADDR);
+                }
+                break;
+            }
+
+            case RTM_NEWLINK:
+            case RTM_DELLINK:
+            {
+                const ifinfomsg *ifi = reinterpret_cast<const ifinfomsg *>(NLMSG_DATA(msg));
+
+                if (static_cast<unsigned int>(ifi->ifi_index) == mInfraIfIndex)
+                {
+                    HandleFlagsChange(msg->nlmsg_type == RTM_NEWLINK ? static_cast<short>(ifi->ifi_flags) : 0);
+                }
+                break;
+            }
+
+            default:
+                break;
+            }
+        }
+    }
+
+    if (mInfraIfIndex != 0)
+    {
+        NotifyState();
+    }
+#endif
+}
+
 bool InfraIf::HasLinkLocalAddress(const std::vector<Ip6Address> &aAddrs)
 {
     bool hasLla = false;
@@ -40,6 +40,7 @@
 
 #include <openthread/ip6.h>
 
+#include "common/mainloop.hpp"
 #include "common/types.hpp"
 
 namespace otbr {
@@ -65,17 +66,39 @@ public:
 
     void      Init(void);
     void      Deinit(void);
+    void      Process(const MainloopContext *aContext);
+    void      UpdateFdSet(MainloopContext *aContext);
     otbrError SetInfraIf(const char *aIfName);
 
+    /**
+     * This method returns the generation of the infrastructure interface state, which is incremented whenever the
+     * flags or the IPv6 addresses of the interface change.
+     *
+     * @returns The generation of the infrastructure interface state.
+     */
+    uint32_t GetStateGeneration(void) const { return mStateGeneration; }
+
 private:
-    bool                    IsRunning(const std::vector<Ip6Address> &aAddrs) const;
+    bool                    IsRunning(void) const;
     short                   GetFlags(void) const;
     std::vector<Ip6Address> GetAddresses(void);
     static bool             HasLinkLocalAddress(const std::vector<Ip6Address> &aAddrs);
+    void                    ReceiveNetlinkMessage(void);
+    void                    HandleAddressChange(const Ip6Address &aAddress, bool aIsAdded);
+    void                    HandleFlagsChange(short aFlags);
+    otbrError               NotifyState(void);
 
     Dependencies &mDeps;
     char          mInfraIfName[IFNAMSIZ];
     unsigned int  mInfraIfIndex;
+    int           mNetlinkFd; ///< Used to receive the link and address events which keep the state below up to date.
+
+    // The state of the infrastructure interface, taken once by `SetInfraIf()` and then maintained from netlink
+    // events, so that it isn't queried again when nothing changed.
+    short                   mFlags;
+    std::vector<Ip6Address> mAddresses;
+    uint32_t                mStateGeneration;
+    uint32_t                mNotifiedGeneration; ///< The generation last passed to `Dependencies::SetInfraIf()`.
 };
 
 } // namespace otbr
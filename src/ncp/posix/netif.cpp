@@ -44,6 +44,7 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <iterator>
 
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
@@ -96,6 +97,9 @@ enum
     kIcmpv6Mldv2RecordChangeToExcludeType = 4,
 };
 
+constexpr uint32_t Netif::kTunCountersLogIntervalMs;
+constexpr uint32_t Netif::kMldCoalesceWindowMs;
+
 Netif::Netif(Dependencies &aDependencies)
     : mTunFd(-1)
     , mIpFd(-1)
@@ -103,6 +107,12 @@ Netif::Netif(Dependencies &aDependencies)
     , mMldFd(-1)
     , mNetlinkSequence(0)
     , mNetifIndex(0)
+    , mTunWriteQueue(kMaxPendingTunWrites)
+    , mTunWriteHead(0)
+    , mTunWriteCount(0)
+    , mTunCounters()
+    , mIsLinkUp(false)
+    , mHandoverTunFd(-1)
     , mDeps(aDependencies)
 {
 }
@@ -114,7 +124,17 @@ otbrError Netif::Init(const std::string &aInterfaceName)
     mIpFd = SocketWithCloseExec(AF_INET6, SOCK_DGRAM, IPPROTO_IP, kSocketNonBlock);
     VerifyOrExit(mIpFd >= 0, error = OTBR_ERROR_ERRNO);
 
-    SuccessOrExit(error = CreateTunDevice(aInterfaceName));
+    if (mHandoverTunFd != -1)
+    {
+        int tunFd = mHandoverTunFd;
+
+        mHandoverTunFd = -1;
+        SuccessOrExit(error = AdoptTunDevice(tunFd));
+    }
+    else
+    {
+        SuccessOrExit(error = CreateTunDevice(aInterfaceName));
+    }
     SuccessOrExit(error = InitNetlink());
 
     mNetifIndex = if_nametoindex(mNetifName.c_str());
@@ -124,6 +144,21 @@ otbrError Netif::Init(const std::string &aInterfaceName)
 
     PlatformSpecificInit();
 
+    // The addresses added by the previous owner of a handed over TUN device are still there, the snapshot lets the
+    // first update from the NCP only add and remove the changed ones.
+    mIp6UnicastAddresses.swap(mHandoverAddresses);
+    mHandoverAddresses.clear();
+
+#if OTBR_ENABLE_NETIF_IO_URING
+    // Keep the read/write data path if io_uring is not available.
+    if (mTunIoUring.Init(
+            mTunFd, [this](const uint8_t *aData, uint16_t aLength) { HandleTunRead(aData, aLength); },
+            [this](uint16_t aLength, int aResult) { HandleTunWriteResult(aLength, aResult); }) != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Fall back to read/write on the Tun Fd");
+    }
+#endif
+
 exit:
     if (error != OTBR_ERROR_NONE)
     {
@@ -151,15 +186,40 @@ void Netif::Process(const MainloopContext *aContext)
         DieNow("Error on MLD Fd!");
     }
 
-    if (FD_ISSET(mTunFd, &aContext->mReadFdSet))
+#if OTBR_ENABLE_NETIF_IO_URING
+    if (mTunIoUring.IsInitialized())
     {
-        ProcessIp6Send();
+        if (FD_ISSET(mTunIoUring.GetFd(), &aContext->mReadFdSet))
+        {
+            mTunIoUring.ProcessCompletions();
+        }
+    }
+    else
+#endif
+    {
+        if (FD_ISSET(mTunFd, &aContext->mReadFdSet))
+        {
+            ProcessIp6Send();
+        }
+
+        // Packets from the NCP are queued by `Ip6Receive()` while the spinel
+        // driver processes a burst, and written out here in one pass.
+        FlushTunWrites(kMaxTunWritesPerProcess);
     }
 
     if (FD_ISSET(mMldFd, &aContext->mReadFdSet))
     {
         ProcessMldEvent();
     }
+
+    FlushMldChanges();
+
+    if (mNetlinkFd >= 0 && FD_ISSET(mNetlinkFd, &aContext->mReadFdSet))
+    {
+        ProcessNetlinkEvent();
+    }
+
+    LogTunCounters();
 }
 
 void Netif::UpdateFdSet(MainloopContext *aContext)
@@ -169,72 +229,201 @@ void Netif::UpdateFdSet(MainloopContext *aContext)
     assert(mIpFd >= 0);
     assert(mMldFd >= 0);
 
-    aContext->AddFdToSet(mTunFd, MainloopContext::kErrorFdSet | MainloopContext::kReadFdSet);
+#if OTBR_ENABLE_NETIF_IO_URING
+    if (mTunIoUring.IsInitialized())
+    {
+        // Writes queued since the last iteration go out in a single submission.
+        mTunIoUring.Submit();
+        aContext->AddFdToSet(mTunFd, MainloopContext::kErrorFdSet);
+        aContext->AddFdToSet(mTunIoUring.GetFd(), MainloopContext::kReadFdSet);
+    }
+    else
+#endif
+    {
+        aContext->AddFdToSet(mTunFd, MainloopContext::kErrorFdSet | MainloopContext::kReadFdSet);
+
+        if (mTunWriteCount > 0)
+        {
+            aContext->AddFdToSet(mTunFd, MainloopContext::kWriteFdSet);
+        }
+    }
+
     aContext->AddFdToSet(mMldFd, MainloopContext::kErrorFdSet | MainloopContext::kReadFdSet);
+
+    if (mNetlinkFd >= 0)
+    {
+        aContext->AddFdToSet(mNetlinkFd, MainloopContext::kReadFdSet);
+    }
+
+    if (!mPendingMldChanges.empty())
+    {
+        Timepoint    now   = CoarseClock::Now();
+        Microseconds delay = Microseconds::zero();
+
+        if (mMldFlushTime > now)
+        {
+            delay = std::chrono::duration_cast<Microseconds>(mMldFlushTime - now);
+        }
+
+        if (delay < FromTimeval<Microseconds>(aContext->mTimeout))
+        {
+            aContext->mTimeout = ToTimeval(delay);
+        }
+    }
+}
+
+static bool CompareIp6AddressInfo(const Ip6AddressInfo &aLhs, const Ip6AddressInfo &aRhs)
+{
+    // Consistent with `Ip6AddressInfo::operator==`.
+    return memcmp(&aLhs, &aRhs, sizeof(Ip6AddressInfo)) < 0;
+}
+
+void Netif::SetHandoverTunDevice(int aTunFd, const std::vector<Ip6AddressInfo> &aAddrInfos)
+{
+    if (mHandoverTunFd != -1)
+    {
+        close(mHandoverTunFd);
+    }
+
+    mHandoverTunFd     = aTunFd;
+    mHandoverAddresses = aAddrInfos;
+    std::sort(mHandoverAddresses.begin(), mHandoverAddresses.end(), CompareIp6AddressInfo);
 }
 
 void Netif::UpdateIp6UnicastAddresses(const std::vector<Ip6AddressInfo> &aAddrInfos)
 {
-    // Remove stale addresses
-    for (const Ip6AddressInfo &addrInfo : mIp6UnicastAddresses)
+    std::vector<Ip6AddressInfo> removedAddrInfos;
+    std::vector<Ip6AddressInfo> addedAddrInfos;
+
+    mIp6UnicastAddressesScratch.assign(aAddrInfos.begin(), aAddrInfos.end());
+    std::sort(mIp6UnicastAddressesScratch.begin(), mIp6UnicastAddressesScratch.end(), CompareIp6AddressInfo);
+
+    std::set_difference(mIp6UnicastAddresses.begin(), mIp6UnicastAddresses.end(),
+                        mIp6UnicastAddressesScratch.begin(), mIp6UnicastAddressesScratch.end(),
+                        std::back_inserter(removedAddrInfos), CompareIp6AddressInfo);
+    std::set_difference(mIp6UnicastAddressesScratch.begin(), mIp6UnicastAddressesScratch.end(),
+                        mIp6UnicastAddresses.begin(), mIp6UnicastAddresses.end(), std::back_inserter(addedAddrInfos),
+                        CompareIp6AddressInfo);
+
+    for (const Ip6AddressInfo &addrInfo : removedAddrInfos)
     {
-        if (std::find(aAddrInfos.begin(), aAddrInfos.end(), addrInfo) == aAddrInfos.end())
-        {
-            otbrLogInfo("Remove address: %s", Ip6Address(addrInfo.mAddress).ToString().c_str());
-            // TODO: Verify success of the addition or deletion in Netlink response.
-            ProcessUnicastAddressChange(addrInfo, false);
-        }
+        otbrLogInfo("Remove address: %s", Ip6Address(addrInfo.mAddress).ToInfoString().AsCString());
     }
 
-    // Add new addresses
-    for (const Ip6AddressInfo &addrInfo : aAddrInfos)
+    for (const Ip6AddressInfo &addrInfo : addedAddrInfos)
     {
-        if (std::find(mIp6UnicastAddresses.begin(), mIp6UnicastAddresses.end(), addrInfo) == mIp6UnicastAddresses.end())
-        {
-            otbrLogInfo("Add address: %s", Ip6Address(addrInfo.mAddress).ToString().c_str());
-            // TODO: Verify success of the addition or deletion in Netlink response.
-            ProcessUnicastAddressChange(addrInfo, true);
-        }
+        otbrLogInfo("Add address: %s", Ip6Address(addrInfo.mAddress).ToInfoString().AsCString());
+    }
+
+    if (!removedAddrInfos.empty() || !addedAddrInfos.empty())
+    {
+        // TODO: Verify success of the addition or deletion in Netlink response.
+        ProcessUnicastAddressChanges(removedAddrInfos, addedAddrInfos);
     }
 
-    mIp6UnicastAddresses.assign(aAddrInfos.begin(), aAddrInfos.end());
+    mIp6UnicastAddresses.swap(mIp6UnicastAddressesScratch);
 }
 
 otbrError Netif::UpdateIp6MulticastAddresses(const std::vector<Ip6Address> &aAddrs)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    otbrError               error = OTBR_ERROR_NONE;
+    std::vector<Ip6Address> removedAddrs;
+    std::vector<Ip6Address> addedAddrs;
+
+    mIp6MulticastAddressesScratch.Assign(aAddrs.begin(), aAddrs.end());
+
+    std::set_difference(mIp6MulticastAddresses.begin(), mIp6MulticastAddresses.end(),
+                        mIp6MulticastAddressesScratch.begin(), mIp6MulticastAddressesScratch.end(),
+                        std::back_inserter(removedAddrs));
+    std::set_difference(mIp6MulticastAddressesScratch.begin(), mIp6MulticastAddressesScratch.end(),
+                        mIp6MulticastAddresses.begin(), mIp6MulticastAddresses.end(), std::back_inserter(addedAddrs));
 
-    // Remove stale addresses
-    for (const Ip6Address &address : mIp6MulticastAddresses)
+    for (const Ip6Address &address : removedAddrs)
     {
-        if (std::find(aAddrs.begin(), aAddrs.end(), address) == aAddrs.end())
-        {
-            otbrLogInfo("Remove address: %s", Ip6Address(address).ToString().c_str());
-            SuccessOrExit(error = ProcessMulticastAddressChange(address, /* aIsAdded */ false));
-        }
+        otbrLogInfo("Remove address: %s", address.ToInfoString().AsCString());
+        SuccessOrExit(error = ProcessMulticastAddressChange(address, /* aIsAdded */ false));
     }
 
-    // Add new addresses
-    for (const Ip6Address &address : aAddrs)
+    for (const Ip6Address &address : addedAddrs)
     {
-        if (std::find(mIp6MulticastAddresses.begin(), mIp6MulticastAddresses.end(), address) ==
-            mIp6MulticastAddresses.end())
-        {
-            otbrLogInfo("Add address: %s", Ip6Address(address).ToString().c_str());
-            SuccessOrExit(error = ProcessMulticastAddressChange(address, /* aIsAdded */ true));
-        }
+        otbrLogInfo("Add address: %s", address.ToInfoString().AsCString());
+        SuccessOrExit(error = ProcessMulticastAddressChange(address, /* aIsAdded */ true));
     }
 
-    mIp6MulticastAddresses.assign(aAddrs.begin(), aAddrs.end());
+    mIp6MulticastAddresses.Swap(mIp6MulticastAddressesScratch);
 
 exit:
     if (error != OTBR_ERROR_NONE)
     {
-        mIp6MulticastAddresses.clear();
+        mIp6MulticastAddresses.Clear();
     }
     return error;
 }
 
+void Netif::HandleKernelAddressChange(const Ip6Address &aAddress, bool aIsAdded)
+{
+    std::vector<Ip6AddressInfo>::const_iterator addrInfo;
+
+    // Only addresses configured from the NCP are maintained, other changes belong to their owners.
+    addrInfo = std::find_if(
+        mIp6UnicastAddresses.begin(), mIp6UnicastAddresses.end(),
+        [&aAddress](const Ip6AddressInfo &aAddrInfo) { return Ip6Address(aAddrInfo.mAddress) == aAddress; });
+    VerifyOrExit(addrInfo != mIp6UnicastAddresses.end());
+
+    if (aIsAdded)
+    {
+        mIp6UnicastAddressesToRestore.erase(std::remove(mIp6UnicastAddressesToRestore.begin(),
+                                                        mIp6UnicastAddressesToRestore.end(), *addrInfo),
+                                            mIp6UnicastAddressesToRestore.end());
+        ExitNow();
+    }
+
+    if (mIsLinkUp)
+    {
+        otbrLogInfo("Address %s was removed externally, restore it", aAddress.ToInfoString().AsCString());
+        ProcessUnicastAddressChanges({}, {*addrInfo});
+    }
+    else
+    {
+        otbrLogInfo("Address %s was removed while the link is down", aAddress.ToInfoString().AsCString());
+        mIp6UnicastAddressesToRestore.push_back(*addrInfo);
+    }
+
+exit:
+    return;
+}
+
+void Netif::HandleKernelLinkStateChange(bool aIsUp)
+{
+    std::vector<Ip6AddressInfo> addrInfos;
+
+    VerifyOrExit(aIsUp != mIsLinkUp);
+    mIsLinkUp = aIsUp;
+    otbrLogInfo("Link %s is %s", mNetifName.c_str(), aIsUp ? "up" : "down");
+
+    VerifyOrExit(aIsUp && !mIp6UnicastAddressesToRestore.empty());
+
+    // Restore only the addresses which are still wanted by the NCP.
+    for (const Ip6AddressInfo &addrInfo : mIp6UnicastAddressesToRestore)
+    {
+        if (std::binary_search(mIp6UnicastAddresses.begin(), mIp6UnicastAddresses.end(), addrInfo,
+                               CompareIp6AddressInfo))
+        {
+            addrInfos.push_back(addrInfo);
+        }
+    }
+
+    mIp6UnicastAddressesToRestore.clear();
+
+    if (!addrInfos.empty())
+    {
+        ProcessUnicastAddressChanges({}, addrInfos);
+    }
+
+exit:
+    return;
+}
+
 otbrError Netif::ProcessMulticastAddressChange(const Ip6Address &aAddress, bool aIsAdded)
 {
     struct ipv6_mreq mreq;
@@ -253,7 +442,8 @@ otbrError Netif::ProcessMulticastAddressChange(const Ip6Address &aAddress, bool
         ExitNow(error = OTBR_ERROR_ERRNO);
     }
 
-    otbrLogInfo("%s multicast address %s", aIsAdded ? "Added" : "Removed", Ip6Address(aAddress).ToString().c_str());
+    otbrLogInfo("%s multicast address %s", aIsAdded ? "Added" : "Removed",
+                Ip6Address(aAddress).ToInfoString().AsCString());
 
 exit:
     return error;
@@ -290,48 +480,152 @@ exit:
 
 void Netif::Ip6Receive(const uint8_t *aBuf, uint16_t aLen)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    otbrError  error = OTBR_ERROR_NONE;
+    TunPacket *packet;
 
     VerifyOrExit(aLen <= kIp6Mtu, error = OTBR_ERROR_DROPPED);
     VerifyOrExit(mTunFd > 0, error = OTBR_ERROR_INVALID_STATE);
 
-    otbrLogInfo("Packet from NCP (%u bytes)", aLen);
-    VerifyOrExit(write(mTunFd, aBuf, aLen) == aLen, error = OTBR_ERROR_ERRNO);
+#if OTBR_ENABLE_NETIF_IO_URING
+    if (mTunIoUring.IsInitialized())
+    {
+        ExitNow(error = mTunIoUring.QueueWrite(aBuf, aLen));
+    }
+#endif
+
+    if (mTunWriteCount == kMaxPendingTunWrites)
+    {
+        FlushTunWrites(kMaxPendingTunWrites);
+        VerifyOrExit(mTunWriteCount < kMaxPendingTunWrites, error = OTBR_ERROR_DROPPED);
+    }
+
+    packet          = &mTunWriteQueue[(mTunWriteHead + mTunWriteCount) % kMaxPendingTunWrites];
+    packet->mLength = aLen;
+    memcpy(packet->mData, aBuf, aLen);
+    mTunWriteCount++;
 
 exit:
     if (error != OTBR_ERROR_NONE)
     {
-        otbrLogWarning("Failed to receive, error:%s", otbrErrorString(error));
+        mTunCounters.mRxDropped++;
+        otbrLogRateLimited(OTBR_LOG_WARNING, kTunCountersLogIntervalMs, "Failed to receive, error:%s",
+                           otbrErrorString(error));
+    }
+}
+
+void Netif::FlushTunWrites(uint16_t aMaxWrites)
+{
+    uint16_t written = 0;
+
+    while (mTunWriteCount > 0 && written < aMaxWrites)
+    {
+        const TunPacket &packet = mTunWriteQueue[mTunWriteHead];
+        ssize_t          rval   = write(mTunFd, packet.mData, packet.mLength);
+
+        if (rval < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            // The TUN queue is full, retry once the fd becomes writable.
+            break;
+        }
+
+        HandleTunWriteResult(packet.mLength, rval < 0 ? -errno : static_cast<int>(rval));
+
+        mTunWriteHead = (mTunWriteHead + 1) % kMaxPendingTunWrites;
+        mTunWriteCount--;
+        written++;
     }
 }
 
 void Netif::ProcessIp6Send(void)
 {
-    ssize_t   rval;
     uint8_t   packet[kIp6Mtu];
     otbrError error = OTBR_ERROR_NONE;
 
-    rval = read(mTunFd, packet, sizeof(packet));
-    VerifyOrExit(rval > 0, error = OTBR_ERROR_ERRNO);
+    // Drain a bounded number of packets per readiness event so that bulk
+    // traffic does not take one mainloop round-trip per packet, while other
+    // mainloop processors still get their turn.
+    for (uint16_t i = 0; i < kMaxTunReadsPerProcess; i++)
+    {
+        ssize_t rval = read(mTunFd, packet, sizeof(packet));
+
+        if (rval < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            break;
+        }
+
+        VerifyOrExit(rval > 0, error = OTBR_ERROR_ERRNO);
 
-    otbrLogInfo("Send packet (%hu bytes)", static_cast<uint16_t>(rval));
+        SuccessOrExit(error = HandleTunRead(packet, static_cast<uint16_t>(rval)));
+    }
 
-    error = mDeps.Ip6Send(packet, rval);
 exit:
     if (error == OTBR_ERROR_ERRNO)
     {
-        otbrLogInfo("Error reading from Tun Fd: %s", strerror(errno));
+        otbrLogRateLimited(OTBR_LOG_INFO, kTunCountersLogIntervalMs, "Error reading from Tun Fd: %s", strerror(errno));
+    }
+}
+
+otbrError Netif::HandleTunRead(const uint8_t *aData, uint16_t aLength)
+{
+    otbrError error;
+
+    SuccessOrExit(error = mDeps.Ip6Send(aData, aLength));
+
+    mTunCounters.mTxPackets++;
+    mTunCounters.mTxBytes += aLength;
+
+exit:
+    return error;
+}
+
+void Netif::HandleTunWriteResult(uint16_t aLength, int aResult)
+{
+    if (aResult == aLength)
+    {
+        mTunCounters.mRxPackets++;
+        mTunCounters.mRxBytes += aLength;
+    }
+    else
+    {
+        mTunCounters.mRxDropped++;
+        otbrLogRateLimited(OTBR_LOG_WARNING, kTunCountersLogIntervalMs, "Failed to write packet to Tun Fd: %s",
+                           aResult < 0 ? strerror(-aResult) : "short write");
     }
 }
 
+void Netif::LogTunCounters(void)
+{
+    Timepoint now = CoarseClock::Now();
+
+    VerifyOrExit(now - mTunCountersLogTime >= Milliseconds(kTunCountersLogIntervalMs));
+    VerifyOrExit(mTunCounters.mTxPackets > 0 || mTunCounters.mRxPackets > 0 || mTunCounters.mRxDropped > 0);
+
+    otbrLogInfo("Sent %u packets (%u bytes) to NCP, received %u packets (%u bytes) from NCP, dropped %u",
+                mTunCounters.mTxPackets, mTunCounters.mTxBytes, mTunCounters.mRxPackets, mTunCounters.mRxBytes,
+                mTunCounters.mRxDropped);
+
+    mTunCounters        = TunCounters();
+    mTunCountersLogTime = now;
+
+exit:
+    return;
+}
+
 void Netif::Clear(void)
 {
+#if OTBR_ENABLE_NETIF_IO_URING
+    mTunIoUring.Deinit();
+#endif
+
     if (mTunFd != -1)
     {
         close(mTunFd);
         mTunFd = -1;
     }
 
+    mTunWriteHead  = 0;
+    mTunWriteCount = 0;
+
     if (mIpFd != -1)
     {
         close(mIpFd);
@@ -352,7 +646,10 @@ void Netif::Clear(void)
 
     mNetifIndex = 0;
     mIp6UnicastAddresses.clear();
-    mIp6MulticastAddresses.clear();
+    mIp6MulticastAddresses.Clear();
+    mIp6UnicastAddressesToRestore.clear();
+    mPendingMldChanges.clear();
+    mIsLinkUp = false;
 }
 
 static const otIp6Address kMldv2MulticastAddress = {
@@ -445,7 +742,7 @@ void Netif::ProcessMldEvent(void)
                 continue;
             }
 
-            inet_ntop(AF_INET6, &record->mMulticastAddress, addressString, sizeof(addressString));
+            Ip6Address(address).ToChars(addressString);
 
             switch (record->mRecordType)
             {
@@ -453,32 +750,16 @@ void Netif::ProcessMldEvent(void)
             case kIcmpv6Mldv2ModeIsExcludeType:
                 error = OTBR_ERROR_NONE;
                 break;
-            ///< Only update subscription on NCP when the target multicast address is not in `mIp6MulticastAddresses`.
-            ///< This indicates that this is the first time the multicast address subscription needs to be updated.
             case kIcmpv6Mldv2RecordChangeToIncludeType:
                 if (record->mNumSources == 0)
                 {
-                    if (std::find(mIp6MulticastAddresses.begin(), mIp6MulticastAddresses.end(), Ip6Address(address)) !=
-                        mIp6MulticastAddresses.end())
-                    {
-                        error = mDeps.Ip6MulAddrUpdateSubscription(address, /* isAdd */ false);
-                    }
-                    else
-                    {
-                        error = OTBR_ERROR_NONE;
-                    }
+                    QueueMldChange(Ip6Address(address), /* aIsAdded */ false);
+                    error = OTBR_ERROR_NONE;
                 }
                 break;
             case kIcmpv6Mldv2RecordChangeToExcludeType:
-                if (std::find(mIp6MulticastAddresses.begin(), mIp6MulticastAddresses.end(), Ip6Address(address)) ==
-                    mIp6MulticastAddresses.end())
-                {
-                    error = mDeps.Ip6MulAddrUpdateSubscription(address, /* isAdd */ true);
-                }
-                else
-                {
-                    error = OTBR_ERROR_NONE;
-                }
+                QueueMldChange(Ip6Address(address), /* aIsAdded */ true);
+                error = OTBR_ERROR_NONE;
                 break;
             }
 
@@ -498,4 +779,49 @@ exit:
     }
 }
 
+void Netif::QueueMldChange(const Ip6Address &aAddress, bool aIsAdded)
+{
+    // Applications joining groups at once, e.g. at boot, send a burst of reports. The window starts with the first
+    // change so that a steady stream of reports can't postpone the update forever.
+    if (mPendingMldChanges.empty())
+    {
+        mMldFlushTime = CoarseClock::Now() + Milliseconds(kMldCoalesceWindowMs);
+    }
+
+    mPendingMldChanges[aAddress] = aIsAdded;
+}
+
+void Netif::FlushMldChanges(void)
+{
+    VerifyOrExit(!mPendingMldChanges.empty() && CoarseClock::Now() >= mMldFlushTime);
+
+    // The changes of the window are sent back to back, so that the NCP link pipelines them instead of waiting for a
+    // mainloop iteration per report.
+    for (const auto &change : mPendingMldChanges)
+    {
+        otIp6Address address;
+        otbrError    error;
+
+        // Only update the subscription on the NCP when it's not in the wanted state yet, e.g. the first time the group
+        // is joined. This also drops a group joined and left within the window.
+        if (change.second == mIp6MulticastAddresses.Contains(change.first))
+        {
+            continue;
+        }
+
+        memcpy(&address, change.first.m8, sizeof(address));
+        error = mDeps.Ip6MulAddrUpdateSubscription(address, change.second);
+
+        if (error != OTBR_ERROR_NONE)
+        {
+            otbrLogWarning("Failed to Update multicast subscription: %s", otbrErrorString(error));
+        }
+    }
+
+    mPendingMldChanges.clear();
+
+exit:
+    return;
+}
+
 } // namespace otbr
@@ -37,12 +37,16 @@
 #include <net/if.h>
 
 #include <functional>
+#include <map>
 #include <vector>
 
 #include <openthread/ip6.h>
 
+#include "common/flat_set.hpp"
 #include "common/mainloop.hpp"
+#include "common/time.hpp"
 #include "common/types.hpp"
+#include "ncp/posix/tun_io_uring.hpp"
 
 namespace otbr {
 
@@ -71,22 +75,69 @@ public:
 
     void Ip6Receive(const uint8_t *aBuf, uint16_t aLen);
 
+    /**
+     * This method makes the next `Init()` adopt a TUN device handed over by another process instead of creating one.
+     *
+     * @param[in] aTunFd      The file descriptor of the TUN device, which is owned by this object from now on.
+     * @param[in] aAddrInfos  The unicast addresses which the previous owner has added to the network interface.
+     */
+    void SetHandoverTunDevice(int aTunFd, const std::vector<Ip6AddressInfo> &aAddrInfos);
+
+    int                                GetTunFd(void) const { return mTunFd; }
+    const std::vector<Ip6AddressInfo> &GetIp6UnicastAddresses(void) const { return mIp6UnicastAddresses; }
+
 private:
     // TODO: Retrieve the Maximum Ip6 size from the coprocessor.
     static constexpr size_t kIp6Mtu = 1280;
 
+    static constexpr uint16_t kMaxTunReadsPerProcess  = 32; ///< Max packets read from TUN per readiness event.
+    static constexpr uint16_t kMaxTunWritesPerProcess = 64; ///< Max queued packets written to TUN per `Process`.
+    static constexpr uint16_t kMaxPendingTunWrites    = 64; ///< Capacity of the TUN write queue.
+
+    static constexpr uint32_t kTunCountersLogIntervalMs = 1000; ///< Interval of the data path counters log.
+    static constexpr uint32_t kMldCoalesceWindowMs      = 50;   ///< Window over which MLD reports are coalesced.
+
+    struct TunPacket
+    {
+        uint16_t mLength;
+        uint8_t  mData[kIp6Mtu];
+    };
+
+    /**
+     * Data path counters, logged once per `kTunCountersLogIntervalMs` instead of one log per packet.
+     */
+    struct TunCounters
+    {
+        uint32_t mTxPackets; ///< Packets read from TUN and sent to the NCP.
+        uint32_t mTxBytes;
+        uint32_t mRxPackets; ///< Packets from the NCP written to TUN.
+        uint32_t mRxBytes;
+        uint32_t mRxDropped; ///< Packets from the NCP which could not be written to TUN.
+    };
+
     void Clear(void);
 
     otbrError CreateTunDevice(const std::string &aInterfaceName);
+    otbrError AdoptTunDevice(int aTunFd);
     otbrError InitNetlink(void);
     otbrError InitMldListener(void);
 
     void      PlatformSpecificInit(void);
     void      SetAddrGenModeToNone(void);
-    void      ProcessUnicastAddressChange(const Ip6AddressInfo &aAddressInfo, bool aIsAdded);
+    void      ProcessUnicastAddressChanges(const std::vector<Ip6AddressInfo> &aRemovedAddrInfos,
+                                           const std::vector<Ip6AddressInfo> &aAddedAddrInfos);
     otbrError ProcessMulticastAddressChange(const Ip6Address &aAddress, bool aIsAdded);
     void      ProcessIp6Send(void);
+    void      ProcessNetlinkEvent(void);
+    void      HandleKernelAddressChange(const Ip6Address &aAddress, bool aIsAdded);
+    void      HandleKernelLinkStateChange(bool aIsUp);
+    otbrError HandleTunRead(const uint8_t *aData, uint16_t aLength);
+    void      HandleTunWriteResult(uint16_t aLength, int aResult);
+    void      FlushTunWrites(uint16_t aMaxWrites);
+    void      LogTunCounters(void);
     void      ProcessMldEvent(void);
+    void      QueueMldChange(const Ip6Address &aAddress, bool aIsAdded);
+    void      FlushMldChanges(void);
 
     int      mTunFd;           ///< Used to exchange IPv6 packets.
     int      mIpFd;            ///< Used to manage IPv6 stack on the network interface.
@@ -97,8 +148,25 @@ private:
     unsigned int mNetifIndex;
     std::string  mNetifName;
 
+    // The address snapshots are kept sorted so that updates are applied as set differences.
     std::vector<Ip6AddressInfo> mIp6UnicastAddresses;
-    std::vector<Ip6Address>     mIp6MulticastAddresses;
+    std::vector<Ip6AddressInfo> mIp6UnicastAddressesScratch;
+    FlatSet<Ip6Address>         mIp6MulticastAddresses;
+    FlatSet<Ip6Address>         mIp6MulticastAddressesScratch;
+    std::vector<Ip6AddressInfo> mIp6UnicastAddressesToRestore; ///< Removed by the kernel while the link was down.
+    std::vector<TunPacket>      mTunWriteQueue; ///< Ring buffer of packets from the NCP awaiting a TUN write.
+    uint16_t                    mTunWriteHead;
+    uint16_t                    mTunWriteCount;
+    TunCounters                 mTunCounters;
+    Timepoint                   mTunCountersLogTime;
+    bool                        mIsLinkUp;      ///< The link state last reported by the kernel.
+    int                         mHandoverTunFd; ///< The TUN device to be adopted by `Init()`, or -1.
+    std::vector<Ip6AddressInfo> mHandoverAddresses;
+    std::map<Ip6Address, bool>  mPendingMldChanges; ///< Latest subscription reported by MLD per group.
+    Timepoint                   mMldFlushTime;      ///< The end of the window of `mPendingMldChanges`.
+#if OTBR_ENABLE_NETIF_IO_URING
+    TunIoUring mTunIoUring; ///< Replaces the read/write data path on `mTunFd` when initialized.
+#endif
     Dependencies               &mDeps;
 };
 
@@ -43,9 +43,12 @@
 #include <sys/ioctl.h>
 #include <unistd.h>
 
+#include <vector>
+
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 #include "common/types.hpp"
+#include "utils/netlink_route.hpp"
 #include "utils/socket_utils.hpp"
 
 #ifndef OTBR_POSIX_TUN_DEVICE
@@ -54,25 +57,7 @@
 
 namespace otbr {
 
-static struct rtattr *AddRtAttr(nlmsghdr *aHeader, uint32_t aMaxLen, uint8_t aType, const void *aData, uint8_t aLen)
-{
-    uint8_t len = RTA_LENGTH(aLen);
-    rtattr *rta;
-
-    assert(NLMSG_ALIGN(aHeader->nlmsg_len) + RTA_ALIGN(len) <= aMaxLen);
-    OTBR_UNUSED_VARIABLE(aMaxLen);
-
-    rta           = reinterpret_cast<rtattr *>(reinterpret_cast<char *>(aHeader) + NLMSG_ALIGN((aHeader)->nlmsg_len));
-    rta->rta_type = aType;
-    rta->rta_len  = len;
-    if (aLen)
-    {
-        memcpy(RTA_DATA(rta), aData, aLen);
-    }
-    aHeader->nlmsg_len = NLMSG_ALIGN(aHeader->nlmsg_len) + RTA_ALIGN(len);
-
-    return rta;
-}
+using Utils::AddRtAttr;
 
 otbrError Netif::CreateTunDevice(const std::string &aInterfaceName)
 {
@@ -109,6 +94,28 @@ exit:
     return error;
 }
 
+otbrError Netif::AdoptTunDevice(int aTunFd)
+{
+    ifreq     ifr;
+    otbrError error = OTBR_ERROR_NONE;
+    int       flags;
+
+    mTunFd = aTunFd;
+
+    memset(&ifr, 0, sizeof(ifr));
+    VerifyOrExit(ioctl(mTunFd, TUNGETIFF, &ifr) == 0, error = OTBR_ERROR_ERRNO);
+
+    flags = fcntl(mTunFd, F_GETFL);
+    VerifyOrExit(flags != -1 && fcntl(mTunFd, F_SETFL, flags | O_NONBLOCK) == 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(fcntl(mTunFd, F_SETFD, FD_CLOEXEC) == 0, error = OTBR_ERROR_ERRNO);
+
+    mNetifName.assign(ifr.ifr_name, strlen(ifr.ifr_name));
+    otbrLogInfo("Netif name: %s (handed over)", mNetifName.c_str());
+
+exit:
+    return error;
+}
+
 otbrError Netif::InitNetlink(void)
 {
     otbrError error = OTBR_ERROR_NONE;
@@ -195,7 +202,11 @@ void Netif::SetAddrGenModeToNone(void)
     }
 }
 
-void Netif::ProcessUnicastAddressChange(const Ip6AddressInfo &aAddressInfo, bool aIsAdded)
+static void AppendUnicastAddressRequest(std::vector<uint8_t> &aBatch,
+                                        const Ip6AddressInfo &aAddressInfo,
+                                        bool                  aIsAdded,
+                                        uint32_t              aIfIndex,
+                                        uint32_t              aSequence)
 {
     struct
     {
@@ -204,20 +215,19 @@ void Netif::ProcessUnicastAddressChange(const Ip6AddressInfo &aAddressInfo, bool
         char      buf[512];
     } req;
 
-    assert(mIpFd >= 0);
     memset(&req, 0, sizeof(req));
 
     req.nh.nlmsg_len   = NLMSG_LENGTH(sizeof(ifaddrmsg));
     req.nh.nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK | (aIsAdded ? (NLM_F_CREATE | NLM_F_EXCL) : 0);
     req.nh.nlmsg_type  = aIsAdded ? RTM_NEWADDR : RTM_DELADDR;
     req.nh.nlmsg_pid   = 0;
-    req.nh.nlmsg_seq   = ++mNetlinkSequence;
+    req.nh.nlmsg_seq   = aSequence;
 
     req.ifa.ifa_family    = AF_INET6;
     req.ifa.ifa_prefixlen = aAddressInfo.mPrefixLength;
     req.ifa.ifa_flags     = IFA_F_NODAD;
     req.ifa.ifa_scope     = aAddressInfo.mScope;
-    req.ifa.ifa_index     = mNetifIndex;
+    req.ifa.ifa_index     = aIfIndex;
 
     AddRtAttr(&req.nh, sizeof(req), IFA_LOCAL, &aAddressInfo.mAddress, sizeof(aAddressInfo.mAddress));
 
@@ -231,15 +241,141 @@ void Netif::ProcessUnicastAddressChange(const Ip6AddressInfo &aAddressInfo, bool
         AddRtAttr(&req.nh, sizeof(req), IFA_CACHEINFO, &cacheinfo, sizeof(cacheinfo));
     }
 
-    if (send(mNetlinkFd, &req, req.nh.nlmsg_len, 0) != -1)
+    aBatch.insert(aBatch.end(), reinterpret_cast<const uint8_t *>(&req),
+                  reinterpret_cast<const uint8_t *>(&req) + NLMSG_ALIGN(req.nh.nlmsg_len));
+
+    otbrLogInfo("Queued request#%u to %s %s/%u", aSequence, (aIsAdded ? "add" : "remove"),
+                Ip6Address(aAddressInfo.mAddress).ToInfoString().AsCString(), aAddressInfo.mPrefixLength);
+}
+
+void Netif::ProcessUnicastAddressChanges(const std::vector<Ip6AddressInfo> &aRemovedAddrInfos,
+                                         const std::vector<Ip6AddressInfo> &aAddedAddrInfos)
+{
+    // All requests go to the kernel in one datagram, rtnetlink processes them in order and
+    // acknowledges each of them separately.
+    std::vector<uint8_t> batch;
+    uint32_t             firstSequence = mNetlinkSequence + 1;
+
+    assert(mIpFd >= 0);
+
+    for (const Ip6AddressInfo &addrInfo : aRemovedAddrInfos)
+    {
+        AppendUnicastAddressRequest(batch, addrInfo, /* aIsAdded */ false, mNetifIndex, ++mNetlinkSequence);
+    }
+
+    for (const Ip6AddressInfo &addrInfo : aAddedAddrInfos)
+    {
+        AppendUnicastAddressRequest(batch, addrInfo, /* aIsAdded */ true, mNetifIndex, ++mNetlinkSequence);
+    }
+
+    VerifyOrExit(!batch.empty());
+
+    if (send(mNetlinkFd, batch.data(), batch.size(), 0) != -1)
+    {
+        otbrLogInfo("Sent requests#%u-#%u to the kernel", firstSequence, mNetlinkSequence);
+    }
+    else
+    {
+        otbrLogWarning("Failed to send requests#%u-#%u: %s", firstSequence, mNetlinkSequence, strerror(errno));
+    }
+
+exit:
+    return;
+}
+
+static void HandleNetlinkAck(const nlmsghdr &aMessage)
+{
+    const nlmsgerr *ack = reinterpret_cast<const nlmsgerr *>(NLMSG_DATA(&aMessage));
+
+    VerifyOrExit(aMessage.nlmsg_len >= NLMSG_LENGTH(sizeof(nlmsgerr)));
+
+    if (ack->error == 0)
     {
-        otbrLogInfo("Sent request#%u to %s %s/%u", mNetlinkSequence, (aIsAdded ? "add" : "remove"),
-                    Ip6Address(aAddressInfo.mAddress).ToString().c_str(), aAddressInfo.mPrefixLength);
+        otbrLogDebug("Request#%u succeeded", ack->msg.nlmsg_seq);
     }
     else
     {
-        otbrLogWarning("Failed to send request#%u to %s %s/%u", mNetlinkSequence, (aIsAdded ? "add" : "remove"),
-                       Ip6Address(aAddressInfo.mAddress).ToString().c_str(), aAddressInfo.mPrefixLength);
+        otbrLogWarning("Request#%u failed: %s", ack->msg.nlmsg_seq, strerror(-ack->error));
+    }
+
+exit:
+    return;
+}
+
+void Netif::ProcessNetlinkEvent(void)
+{
+    // The netlink socket is subscribed to link and IPv6 address events, and receives the acks of
+    // the address requests sent on it. Drain a bounded number of datagrams per readiness event.
+    constexpr uint16_t kMaxReadsPerProcess = 16;
+    char               buffer[8192];
+
+    for (uint16_t i = 0; i < kMaxReadsPerProcess; i++)
+    {
+        ssize_t length = recv(mNetlinkFd, buffer, sizeof(buffer), 0);
+
+        if (length < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            break;
+        }
+
+        if (length <= 0)
+        {
+            otbrLogWarning("Failed to receive netlink events: %s", strerror(errno));
+            break;
+        }
+
+        for (nlmsghdr *msg = reinterpret_cast<nlmsghdr *>(buffer); NLMSG_OK(msg, static_cast<unsigned int>(length));
+             msg           = NLMSG_NEXT(msg, length))
+        {
+            switch (msg->nlmsg_type)
+            {
+            case RTM_NEWADDR:
+            case RTM_DELADDR:
+            {
+                const ifaddrmsg *ifa       = reinterpret_cast<const ifaddrmsg *>(NLMSG_DATA(msg));
+                int              rtaLength = static_cast<int>(IFA_PAYLOAD(msg));
+                const Ip6Address *address  = nullptr;
+
+                if (ifa->ifa_family != AF_INET6 || ifa->ifa_index != mNetifIndex)
+                {
+                    break;
+                }
+
+                for (const rtattr *rta = IFA_RTA(ifa); RTA_OK(rta, rtaLength); rta = RTA_NEXT(rta, rtaLength))
+                {
+                    if ((rta->rta_type == IFA_LOCAL || (rta->rta_type == IFA_ADDRESS && address == nullptr)) &&
+                        RTA_PAYLOAD(rta) == sizeof(Ip6Address))
+                    {
+                        address = reinterpret_cast<const Ip6Address *>(RTA_DATA(rta));
+                    }
+                }
+
+                if (address != nullptr)
+                {
+                    HandleKernelAddressChange(*address, msg->nlmsg_type == RTM_NEWADDR);
+                }
+                break;
+            }
+
+            case RTM_NEWLINK:
+            {
+                const ifinfomsg *ifi = reinterpret_cast<const ifinfomsg *>(NLMSG_DATA(msg));
+
+                if (static_cast<unsigned int>(ifi->ifi_index) == mNetifIndex)
+                {
+                    HandleKernelLinkStateChange((ifi->ifi_flags & IFF_UP) != 0);
+                }
+                break;
+            }
+
+            case NLMSG_ERROR:
+                HandleNetlinkAck(*msg);
+                break;
+
+            default:
+                break;
+            }
+        }
     }
 }
 
@@ -48,6 +48,13 @@ otbrError Netif::CreateTunDevice(const std::string &aInterfaceName)
     return OTBR_ERROR_NONE;
 }
 
+otbrError Netif::AdoptTunDevice(int aTunFd)
+{
+    OTBR_UNUSED_VARIABLE(aTunFd);
+    DieNow("OTBR posix not supported on this platform");
+    return OTBR_ERROR_NONE;
+}
+
 otbrError Netif::InitNetlink(void)
 {
     return OTBR_ERROR_NONE;
@@ -58,10 +65,16 @@ void Netif::PlatformSpecificInit(void)
     /* Empty */
 }
 
-void Netif::ProcessUnicastAddressChange(const Ip6AddressInfo &aAddressInfo, bool aIsAdded)
+void Netif::ProcessUnicastAddressChanges(const std::vector<Ip6AddressInfo> &aRemovedAddrInfos,
+                                         const std::vector<Ip6AddressInfo> &aAddedAddrInfos)
 {
-    OTBR_UNUSED_VARIABLE(aAddressInfo);
-    OTBR_UNUSED_VARIABLE(aIsAdded);
+    OTBR_UNUSED_VARIABLE(aRemovedAddrInfos);
+    OTBR_UNUSED_VARIABLE(aAddedAddrInfos);
+}
+
+void Netif::ProcessNetlinkEvent(void)
+{
+    /* Empty */
 }
 
 } // namespace otbr
@@ -0,0 +1,415 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the io_uring based TUN data path of otbr-agent.
+ */
+
+#define OTBR_LOG_TAG "NETIF"
+
+#include "tun_io_uring.hpp"
+
+#if OTBR_ENABLE_NETIF_IO_URING
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+#include "common/logging.hpp"
+
+namespace otbr {
+
+constexpr uint16_t TunIoUring::kPacketSize;
+constexpr uint16_t TunIoUring::kNumReads;
+constexpr uint16_t TunIoUring::kNumWrites;
+
+// The submission queue is sized so that every buffer can be in flight at once, hence it never overflows.
+static constexpr uint32_t kRingEntries = 128;
+
+static constexpr uint32_t kLogIntervalMs  = 1000;
+static constexpr uint64_t kCancelUserData = UINT64_MAX;
+
+static_assert(TunIoUring::kNumReads + TunIoUring::kNumWrites <= kRingEntries, "kRingEntries is too small");
+
+static int IoUringSetup(uint32_t aEntries, io_uring_params *aParams)
+{
+    return static_cast<int>(syscall(__NR_io_uring_setup, aEntries, aParams));
+}
+
+static int IoUringEnter(int aRingFd, uint32_t aToSubmit, uint32_t aMinComplete, uint32_t aFlags)
+{
+    return static_cast<int>(syscall(__NR_io_uring_enter, aRingFd, aToSubmit, aMinComplete, aFlags, nullptr, 0));
+}
+
+static int IoUringRegister(int aRingFd, uint32_t aOpcode, const void *aArg, uint32_t aNumArgs)
+{
+    return static_cast<int>(syscall(__NR_io_uring_register, aRingFd, aOpcode, aArg, aNumArgs));
+}
+
+TunIoUring::TunIoUring(void)
+    : mRingFd(-1)
+    , mTunFd(-1)
+    , mSq()
+    , mCq()
+    , mSqArray(nullptr)
+    , mSqes(nullptr)
+    , mSqesSize(0)
+    , mCqes(nullptr)
+    , mSqPending(0)
+    , mSqUnsubmitted(0)
+    , mInFlight(0)
+    , mInFlightUserData()
+{
+}
+
+TunIoUring::~TunIoUring(void)
+{
+    Deinit();
+}
+
+otbrError TunIoUring::Init(int aTunFd, ReadHandler aReadHandler, WriteHandler aWriteHandler)
+{
+    otbrError                 error = OTBR_ERROR_NONE;
+    io_uring_params           params;
+    uint8_t                  *sqMem;
+    uint8_t                  *cqMem;
+    std::vector<struct iovec> iovecs;
+    int                       flags;
+
+    VerifyOrExit(!IsInitialized(), error = OTBR_ERROR_INVALID_STATE);
+
+    memset(&params, 0, sizeof(params));
+    mRingFd = IoUringSetup(kRingEntries, &params);
+    VerifyOrExit(mRingFd >= 0, error = OTBR_ERROR_ERRNO);
+
+    mSq.mSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    mCq.mSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        mSq.mSize = std::max(mSq.mSize, mCq.mSize);
+    }
+
+    mSq.mMem = mmap(nullptr, mSq.mSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mRingFd, IORING_OFF_SQ_RING);
+    VerifyOrExit(mSq.mMem != MAP_FAILED, mSq.mMem = nullptr, error = OTBR_ERROR_ERRNO);
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        mCq.mMem  = nullptr;
+        mCq.mSize = 0;
+        cqMem     = static_cast<uint8_t *>(mSq.mMem);
+    }
+    else
+    {
+        mCq.mMem =
+            mmap(nullptr, mCq.mSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mRingFd, IORING_OFF_CQ_RING);
+        VerifyOrExit(mCq.mMem != MAP_FAILED, mCq.mMem = nullptr, error = OTBR_ERROR_ERRNO);
+        cqMem = static_cast<uint8_t *>(mCq.mMem);
+    }
+
+    mSqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    mSqes     = static_cast<io_uring_sqe *>(
+        mmap(nullptr, mSqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mRingFd, IORING_OFF_SQES));
+    VerifyOrExit(mSqes != MAP_FAILED, mSqes = nullptr, error = OTBR_ERROR_ERRNO);
+
+    sqMem     = static_cast<uint8_t *>(mSq.mMem);
+    mSq.mHead = reinterpret_cast<uint32_t *>(sqMem + params.sq_off.head);
+    mSq.mTail = reinterpret_cast<uint32_t *>(sqMem + params.sq_off.tail);
+    mSq.mMask = *reinterpret_cast<uint32_t *>(sqMem + params.sq_off.ring_mask);
+    mSqArray  = reinterpret_cast<uint32_t *>(sqMem + params.sq_off.array);
+    mCq.mHead = reinterpret_cast<uint32_t *>(cqMem + params.cq_off.head);
+    mCq.mTail = reinterpret_cast<uint32_t *>(cqMem + params.cq_off.tail);
+    mCq.mMask = *reinterpret_cast<uint32_t *>(cqMem + params.cq_off.ring_mask);
+    mCqes     = reinterpret_cast<io_uring_cqe *>(cqMem + params.cq_off.cqes);
+
+    // Registered buffers save the kernel from mapping the user pages on every request.
+    mBuffers.assign(static_cast<size_t>(kNumReads + kNumWrites) * kPacketSize, 0);
+    iovecs.resize(kNumReads + kNumWrites);
+    for (uint16_t slot = 0; slot < kNumReads + kNumWrites; slot++)
+    {
+        iovecs[slot].iov_base = GetBuffer(slot);
+        iovecs[slot].iov_len  = kPacketSize;
+    }
+    VerifyOrExit(IoUringRegister(mRingFd, IORING_REGISTER_BUFFERS, iovecs.data(), iovecs.size()) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+    // io_uring returns -EAGAIN right away for non-blocking files instead of waiting for them to be ready.
+    flags = fcntl(aTunFd, F_GETFL);
+    VerifyOrExit(flags != -1 && fcntl(aTunFd, F_SETFL, flags & ~O_NONBLOCK) == 0, error = OTBR_ERROR_ERRNO);
+
+    mTunFd        = aTunFd;
+    mReadHandler  = std::move(aReadHandler);
+    mWriteHandler = std::move(aWriteHandler);
+
+    mFreeWriteSlots.clear();
+    for (uint16_t slot = kNumReads + kNumWrites; slot > kNumReads; slot--)
+    {
+        mFreeWriteSlots.push_back(slot - 1);
+    }
+
+    for (uint16_t slot = 0; slot < kNumReads; slot++)
+    {
+        PrepareRead(slot);
+    }
+    Submit();
+
+    otbrLogInfo("Using io_uring for the Tun Fd, %u reads posted", kNumReads);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to set up io_uring: %s", strerror(errno));
+        Deinit();
+    }
+    return error;
+}
+
+void TunIoUring::Deinit(void)
+{
+    CancelAll();
+
+    if (mSqes != nullptr)
+    {
+        munmap(mSqes, mSqesSize);
+        mSqes = nullptr;
+    }
+
+    if (mCq.mMem != nullptr)
+    {
+        munmap(mCq.mMem, mCq.mSize);
+        mCq.mMem = nullptr;
+    }
+
+    if (mSq.mMem != nullptr)
+    {
+        munmap(mSq.mMem, mSq.mSize);
+        mSq.mMem = nullptr;
+    }
+
+    // Closing the ring cancels the in-flight requests.
+    if (mRingFd >= 0)
+    {
+        close(mRingFd);
+        mRingFd = -1;
+    }
+
+    mTunFd     = -1;
+    mSqPending     = 0;
+    mSqUnsubmitted = 0;
+    mInFlight      = 0;
+    mBuffers.clear();
+    mFreeWriteSlots.clear();
+    mReadHandler  = nullptr;
+    mWriteHandler = nullptr;
+}
+
+otbrError TunIoUring::QueueWrite(const uint8_t *aData, uint16_t aLength)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    uint16_t  slot;
+
+    VerifyOrExit(IsInitialized(), error = OTBR_ERROR_INVALID_STATE);
+    VerifyOrExit(aLength <= kPacketSize && !mFreeWriteSlots.empty(), error = OTBR_ERROR_DROPPED);
+
+    slot = mFreeWriteSlots.back();
+    mFreeWriteSlots.pop_back();
+    memcpy(GetBuffer(slot), aData, aLength);
+    PrepareFixed(IORING_OP_WRITE_FIXED, slot, aLength);
+
+exit:
+    return error;
+}
+
+void TunIoUring::Submit(void)
+{
+    int rval;
+
+    VerifyOrExit(IsInitialized() && (mSqPending > 0 || mSqUnsubmitted > 0));
+
+    // Publish the prepared entries to the kernel before entering.
+    __atomic_store_n(mSq.mTail, *mSq.mTail + mSqPending, __ATOMIC_RELEASE);
+    mSqUnsubmitted += mSqPending;
+    mSqPending = 0;
+
+    rval = IoUringEnter(mRingFd, mSqUnsubmitted, 0, 0);
+    if (rval < 0)
+    {
+        // The entries stay in the ring and are picked up by the next successful enter.
+        otbrLogRateLimited(OTBR_LOG_WARNING, kLogIntervalMs, "Failed to submit io_uring requests: %s",
+                           strerror(errno));
+        ExitNow();
+    }
+
+    mSqUnsubmitted -= static_cast<uint32_t>(rval);
+
+exit:
+    return;
+}
+
+void TunIoUring::ProcessCompletions(void)
+{
+    uint32_t head;
+    uint32_t tail;
+
+    VerifyOrExit(IsInitialized());
+
+    head = *mCq.mHead;
+    tail = __atomic_load_n(mCq.mTail, __ATOMIC_ACQUIRE);
+
+    for (; head != tail; head++)
+    {
+        const io_uring_cqe &cqe  = mCqes[head & mCq.mMask];
+        uint16_t            slot = static_cast<uint16_t>(cqe.user_data);
+
+        mInFlight--;
+
+        if (slot < kNumReads)
+        {
+            if (cqe.res > 0)
+            {
+                mReadHandler(GetBuffer(slot), static_cast<uint16_t>(cqe.res));
+            }
+            else if (cqe.res < 0)
+            {
+                otbrLogRateLimited(OTBR_LOG_INFO, kLogIntervalMs, "Error reading from Tun Fd: %s",
+                                   strerror(-cqe.res));
+            }
+
+            PrepareRead(slot);
+        }
+        else
+        {
+            mWriteHandler(static_cast<uint16_t>(cqe.user_data >> 16), cqe.res);
+            mFreeWriteSlots.push_back(slot);
+        }
+    }
+
+    __atomic_store_n(mCq.mHead, head, __ATOMIC_RELEASE);
+
+    // The re-armed reads are submitted together with the writes queued during this iteration.
+    Submit();
+
+exit:
+    return;
+}
+
+void TunIoUring::CancelAll(void)
+{
+    // In-flight reads hold a reference to the TUN device, and the ring is torn down asynchronously
+    // once closed. Cancel and reap them here so that the device is released when `Deinit()` returns.
+    VerifyOrExit(IsInitialized() && mTunFd >= 0);
+
+    for (uint16_t slot = 0; slot < kNumReads + kNumWrites; slot++)
+    {
+        if (slot >= kNumReads &&
+            std::find(mFreeWriteSlots.begin(), mFreeWriteSlots.end(), slot) != mFreeWriteSlots.end())
+        {
+            continue;
+        }
+
+        io_uring_sqe *sqe = GetSqe();
+
+        sqe->opcode    = IORING_OP_ASYNC_CANCEL;
+        sqe->fd        = -1;
+        sqe->addr      = mInFlightUserData[slot];
+        sqe->user_data = kCancelUserData;
+    }
+
+    Submit();
+
+    while (mInFlight > 0)
+    {
+        uint32_t head = *mCq.mHead;
+        uint32_t tail = __atomic_load_n(mCq.mTail, __ATOMIC_ACQUIRE);
+
+        if (head == tail)
+        {
+            VerifyOrExit(IoUringEnter(mRingFd, 0, 1, IORING_ENTER_GETEVENTS) >= 0 || errno == EINTR,
+                         otbrLogWarning("Failed to wait for cancelled io_uring requests: %s", strerror(errno)));
+            continue;
+        }
+
+        for (; head != tail; head++)
+        {
+            if (mCqes[head & mCq.mMask].user_data != kCancelUserData)
+            {
+                mInFlight--;
+            }
+        }
+
+        __atomic_store_n(mCq.mHead, head, __ATOMIC_RELEASE);
+    }
+
+exit:
+    return;
+}
+
+io_uring_sqe *TunIoUring::GetSqe(void)
+{
+    uint32_t      index = (*mSq.mTail + mSqPending) & mSq.mMask;
+    io_uring_sqe *sqe   = &mSqes[index];
+
+    mSqArray[index] = index;
+    mSqPending++;
+    memset(sqe, 0, sizeof(*sqe));
+
+    return sqe;
+}
+
+void TunIoUring::PrepareRead(uint16_t aSlot)
+{
+    PrepareFixed(IORING_OP_READ_FIXED, aSlot, kPacketSize);
+}
+
+void TunIoUring::PrepareFixed(uint8_t aOpcode, uint16_t aSlot, uint32_t aLength)
+{
+    io_uring_sqe *sqe = GetSqe();
+
+    sqe->opcode    = aOpcode;
+    sqe->fd        = mTunFd;
+    sqe->addr      = reinterpret_cast<uintptr_t>(GetBuffer(aSlot));
+    sqe->len       = aLength;
+    sqe->buf_index = aSlot;
+    // The slot is kept in the low 16 bits and the length of writes in the next 16 bits.
+    sqe->user_data = (static_cast<uint64_t>(aLength) << 16) | aSlot;
+
+    mInFlightUserData[aSlot] = sqe->user_data;
+    mInFlight++;
+}
+
+} // namespace otbr
+
+#endif // OTBR_ENABLE_NETIF_IO_URING
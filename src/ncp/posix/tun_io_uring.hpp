@@ -0,0 +1,166 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of the io_uring based TUN data path of otbr-agent.
+ */
+
+#ifndef OTBR_AGENT_POSIX_TUN_IO_URING_HPP_
+#define OTBR_AGENT_POSIX_TUN_IO_URING_HPP_
+
+#if OTBR_ENABLE_NETIF_IO_URING
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <functional>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/types.hpp"
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace otbr {
+
+/**
+ * This class implements the TUN data path on top of an io_uring instance.
+ *
+ * A fixed set of reads is kept posted on the TUN device and re-armed as they complete, and
+ * writes are queued into registered buffers. All queued requests are submitted with a single
+ * `io_uring_enter()` per mainloop iteration, and completions are signaled through the ring fd.
+ */
+class TunIoUring : private NonCopyable
+{
+public:
+    static constexpr uint16_t kPacketSize = 1280; ///< Size of each registered buffer.
+    static constexpr uint16_t kNumReads   = 16;   ///< Number of reads kept posted on the TUN device.
+    static constexpr uint16_t kNumWrites  = 64;   ///< Number of writes which can be in flight.
+
+    /**
+     * This function pointer is called with each packet read from the TUN device.
+     */
+    using ReadHandler = std::function<void(const uint8_t *aData, uint16_t aLength)>;
+
+    /**
+     * This function pointer is called with the result of each write to the TUN device,
+     * `aResult` is the number of bytes written or a negative errno.
+     */
+    using WriteHandler = std::function<void(uint16_t aLength, int aResult)>;
+
+    TunIoUring(void);
+    ~TunIoUring(void);
+
+    /**
+     * This method sets up the ring, registers the buffers and posts the reads on @p aTunFd.
+     *
+     * @param[in] aTunFd         The TUN device fd, it is switched to blocking mode.
+     * @param[in] aReadHandler   The handler of read packets.
+     * @param[in] aWriteHandler  The handler of write results.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully set up the ring.
+     * @retval OTBR_ERROR_ERRNO  Failed to set up the ring, io_uring may not be supported by the kernel.
+     */
+    otbrError Init(int aTunFd, ReadHandler aReadHandler, WriteHandler aWriteHandler);
+
+    /**
+     * This method releases the ring, in-flight requests are cancelled.
+     */
+    void Deinit(void);
+
+    /**
+     * This method indicates whether the ring is set up.
+     */
+    bool IsInitialized(void) const { return mRingFd >= 0; }
+
+    /**
+     * This method returns the ring fd, which is readable when completions are available.
+     */
+    int GetFd(void) const { return mRingFd; }
+
+    /**
+     * This method queues a write of a packet to the TUN device.
+     *
+     * The write is submitted on the next call to `Submit()`.
+     *
+     * @retval OTBR_ERROR_NONE     Successfully queued the write.
+     * @retval OTBR_ERROR_DROPPED  All write buffers are in flight.
+     */
+    otbrError QueueWrite(const uint8_t *aData, uint16_t aLength);
+
+    /**
+     * This method submits all queued requests.
+     */
+    void Submit(void);
+
+    /**
+     * This method processes all available completions and re-arms the completed reads.
+     */
+    void ProcessCompletions(void);
+
+private:
+    struct Ring
+    {
+        void     *mMem;
+        size_t    mSize;
+        uint32_t *mHead;
+        uint32_t *mTail;
+        uint32_t  mMask;
+    };
+
+    void          CancelAll(void);
+    io_uring_sqe *GetSqe(void);
+    void          PrepareRead(uint16_t aSlot);
+    void          PrepareFixed(uint8_t aOpcode, uint16_t aSlot, uint32_t aLength);
+    uint8_t      *GetBuffer(uint16_t aSlot) { return &mBuffers[static_cast<size_t>(aSlot) * kPacketSize]; }
+
+    int                   mRingFd;
+    int                   mTunFd;
+    Ring                  mSq;
+    Ring                  mCq;
+    uint32_t             *mSqArray;
+    io_uring_sqe         *mSqes;
+    size_t                mSqesSize;
+    io_uring_cqe         *mCqes;
+    uint32_t              mSqPending;     ///< Number of prepared requests not yet published to the kernel.
+    uint32_t              mSqUnsubmitted; ///< Number of published requests not yet consumed by the kernel.
+    std::vector<uint8_t>  mBuffers;   ///< `kNumReads` read buffers followed by `kNumWrites` write buffers.
+    std::vector<uint16_t> mFreeWriteSlots;
+    uint32_t              mInFlight; ///< Number of reads and writes awaiting their completion.
+    uint64_t              mInFlightUserData[kNumReads + kNumWrites];
+    ReadHandler           mReadHandler;
+    WriteHandler          mWriteHandler;
+};
+
+} // namespace otbr
+
+#endif // OTBR_ENABLE_NETIF_IO_URING
+
+#endif // OTBR_AGENT_POSIX_TUN_IO_URING_HPP_
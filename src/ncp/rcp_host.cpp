@@ -34,18 +34,23 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <vector>
+
 #include <openthread/backbone_router_ftd.h>
 #include <openthread/border_routing.h>
 #include <openthread/dataset.h>
 #include <openthread/dnssd_server.h>
 #include <openthread/link_metrics.h>
 #include <openthread/logging.h>
+#include <openthread/message.h>
 #include <openthread/nat64.h>
 #include <openthread/srp_server.h>
 #include <openthread/tasklet.h>
 #include <openthread/thread.h>
 #include <openthread/thread_ftd.h>
 #include <openthread/trel.h>
+#include <openthread/udp.h>
+#include <openthread/platform/dns.h>
 #include <openthread/platform/logging.h>
 #include <openthread/platform/misc.h>
 #include <openthread/platform/radio.h>
@@ -53,7 +58,9 @@
 
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/time.hpp"
 #include "common/types.hpp"
+#include "utils/dns_upstream_cache.hpp"
 #if OTBR_ENABLE_FEATURE_FLAGS
 #include "proto/feature_flag.pb.h"
 #endif
@@ -66,6 +73,11 @@ static const uint16_t kThreadVersion12 = 3; ///< Thread Version 1.2
 static const uint16_t kThreadVersion13 = 4; ///< Thread Version 1.3
 static const uint16_t kThreadVersion14 = 5; ///< Thread Version 1.4
 
+// The budget of executing tasks in one mainloop iteration, so that a burst of
+// management tasks doesn't delay processing the radio.
+static constexpr uint32_t kMaxTasksPerIteration    = 64;
+static constexpr uint32_t kMaxTaskTimePerIteration = 10; ///< In milliseconds.
+
 // =============================== OtNetworkProperties ===============================
 
 OtNetworkProperties::OtNetworkProperties(void)
@@ -90,7 +102,9 @@ RcpHost::RcpHost(const char                      *aInterfaceName,
                  const char                      *aBackboneInterfaceName,
                  bool                             aDryRun,
                  bool                             aEnableAutoAttach)
-    : mInstance(nullptr)
+    : MainloopProcessor(kPriorityRadio)
+    , mInstance(nullptr)
+    , mTaskRunner(TaskRunner::DelayedTaskQueue::kTimerWheel, kPriorityManagement)
     , mEnableAutoAttach(aEnableAutoAttach)
 {
     VerifyOrDie(aRadioUrls.size() <= OT_PLATFORM_CONFIG_MAX_RADIO_URLS, "Too many Radio URLs!");
@@ -106,6 +120,8 @@ RcpHost::RcpHost(const char                      *aInterfaceName,
         mConfig.mCoprocessorUrls.mUrls[mConfig.mCoprocessorUrls.mNum++] = url;
     }
     mConfig.mSpeedUpFactor = 1;
+
+    mTaskRunner.SetProcessBudget(kMaxTasksPerIteration, Milliseconds(kMaxTaskTimePerIteration));
 }
 
 RcpHost::~RcpHost(void)
@@ -181,6 +197,24 @@ otbrLogLevel ConvertProtoToOtbrLogLevel(ProtoLogLevel aProtoLogLevel)
 
     return otbrLogLevel;
 }
+
+FeatureFlags::FeatureFlags(const FeatureFlagList &aFeatureFlagList)
+    : mFlags(0)
+    , mLogLevel(otbrLogGetDefaultLevel())
+{
+    mFlags |= aFeatureFlagList.enable_nat64() ? kNat64 : 0;
+    mFlags |= aFeatureFlagList.enable_detailed_logging() ? kDetailedLogging : 0;
+    mFlags |= aFeatureFlagList.enable_trel() ? kTrel : 0;
+    mFlags |= aFeatureFlagList.enable_dns_upstream_query() ? kDnsUpstreamQuery : 0;
+    mFlags |= aFeatureFlagList.enable_dhcp6_pd() ? kDhcp6Pd : 0;
+    mFlags |= aFeatureFlagList.enable_link_metrics_manager() ? kLinkMetricsManager : 0;
+    mFlags |= aFeatureFlagList.enable_ephemeralkey() ? kEphemeralKey : 0;
+
+    if (IsEnabled(kDetailedLogging))
+    {
+        mLogLevel = ConvertProtoToOtbrLogLevel(aFeatureFlagList.detailed_logging_level());
+    }
+}
 #endif
 
 otError RcpHost::SetOtbrAndOtLogLevel(otbrLogLevel aLevel)
@@ -243,6 +277,7 @@ void RcpHost::Init(void)
     mThreadHelper = MakeUnique<otbr::agent::ThreadHelper>(mInstance, this);
 
     OtNetworkProperties::SetInstance(mInstance);
+    UpdateNetworkState();
 
 exit:
     SuccessOrDie(error, "Failed to initialize the RCP Host!");
@@ -251,36 +286,59 @@ exit:
 #if OTBR_ENABLE_FEATURE_FLAGS
 otError RcpHost::ApplyFeatureFlagList(const FeatureFlagList &aFeatureFlagList)
 {
-    otError error = OT_ERROR_NONE;
+    otError      error = OT_ERROR_NONE;
+    FeatureFlags featureFlags(aFeatureFlagList);
+    uint16_t     changed = FeatureFlags::kAllFlags;
+
     // Save a cached copy of feature flags for debugging purpose.
     mAppliedFeatureFlagListBytes = aFeatureFlagList.SerializeAsString();
 
-#if OTBR_ENABLE_NAT64
-    otNat64SetEnabled(mInstance, aFeatureFlagList.enable_nat64());
-#endif
+    if (mFeatureFlagsApplied)
+    {
+        changed = featureFlags.GetChangedFlags(mFeatureFlags);
+    }
 
-    if (aFeatureFlagList.enable_detailed_logging())
+#if OTBR_ENABLE_NAT64
+    if (changed & FeatureFlags::kNat64)
     {
-        error = SetOtbrAndOtLogLevel(ConvertProtoToOtbrLogLevel(aFeatureFlagList.detailed_logging_level()));
+        otNat64SetEnabled(mInstance, featureFlags.IsEnabled(FeatureFlags::kNat64));
     }
-    else
+#endif
+
+    if (!mFeatureFlagsApplied || featureFlags.GetLogLevel() != mFeatureFlags.GetLogLevel())
     {
-        error = SetOtbrAndOtLogLevel(otbrLogGetDefaultLevel());
+        error = SetOtbrAndOtLogLevel(featureFlags.GetLogLevel());
     }
 
 #if OTBR_ENABLE_TREL
-    otTrelSetEnabled(mInstance, aFeatureFlagList.enable_trel());
+    if (changed & FeatureFlags::kTrel)
+    {
+        otTrelSetEnabled(mInstance, featureFlags.IsEnabled(FeatureFlags::kTrel));
+    }
 #endif
 #if OTBR_ENABLE_DNS_UPSTREAM_QUERY
-    otDnssdUpstreamQuerySetEnabled(mInstance, aFeatureFlagList.enable_dns_upstream_query());
+    if (changed & FeatureFlags::kDnsUpstreamQuery)
+    {
+        otDnssdUpstreamQuerySetEnabled(mInstance, featureFlags.IsEnabled(FeatureFlags::kDnsUpstreamQuery));
+    }
 #endif
 #if OTBR_ENABLE_DHCP6_PD
-    otBorderRoutingDhcp6PdSetEnabled(mInstance, aFeatureFlagList.enable_dhcp6_pd());
+    if (changed & FeatureFlags::kDhcp6Pd)
+    {
+        otBorderRoutingDhcp6PdSetEnabled(mInstance, featureFlags.IsEnabled(FeatureFlags::kDhcp6Pd));
+    }
 #endif
 #if OTBR_ENABLE_LINK_METRICS_TELEMETRY
-    otLinkMetricsManagerSetEnabled(mInstance, aFeatureFlagList.enable_link_metrics_manager());
+    if (changed & FeatureFlags::kLinkMetricsManager)
+    {
+        otLinkMetricsManagerSetEnabled(mInstance, featureFlags.IsEnabled(FeatureFlags::kLinkMetricsManager));
+    }
 #endif
 
+    mFeatureFlags = featureFlags;
+    // Apply all the flags again with the next list if the log level could not be set.
+    mFeatureFlagsApplied = (error == OT_ERROR_NONE);
+
     return error;
 }
 #endif
@@ -293,20 +351,78 @@ void RcpHost::Deinit(void)
     mInstance = nullptr;
 
     OtNetworkProperties::SetInstance(nullptr);
-    mThreadStateChangedCallbacks.clear();
+    mThreadStateChangedSubscribers.clear();
+    mPendingThreadStateChangedFlags = 0;
     mResetHandlers.clear();
+#if OTBR_ENABLE_FEATURE_FLAGS
+    mFeatureFlagsApplied = false;
+#endif
+    UpdateNetworkState();
 }
 
 void RcpHost::HandleStateChanged(otChangedFlags aFlags)
 {
-    for (auto &stateCallback : mThreadStateChangedCallbacks)
+    if (mPendingThreadStateChangedFlags == 0 && !mThreadStateChangedSubscribers.empty())
     {
-        stateCallback(aFlags);
+        mTaskRunner.Post([this]() { NotifyThreadStateChanged(); });
     }
 
+    mPendingThreadStateChangedFlags |= aFlags;
+
+    // The state is published right away, readers on other threads don't wait for the coalesced notification.
+    UpdateNetworkState();
+
     mThreadHelper->StateChangedCallback(aFlags);
 }
 
+void RcpHost::UpdateNetworkState(void)
+{
+    NetworkStateSnapshot state;
+
+    memset(&state, 0, sizeof(state));
+
+    if (mInstance != nullptr)
+    {
+        state.mDeviceRole = otThreadGetDeviceRole(mInstance);
+        state.mRloc16     = otThreadGetRloc16(mInstance);
+        state.mExtAddress = *otLinkGetExtendedAddress(mInstance);
+        strncpy(state.mNetworkName, otThreadGetNetworkName(mInstance), sizeof(state.mNetworkName) - 1);
+        state.mPanId           = otLinkGetPanId(mInstance);
+        state.mExtPanId        = *otThreadGetExtendedPanId(mInstance);
+        state.mChannel         = otLinkGetChannel(mInstance);
+        state.mPartitionId     = otThreadGetPartitionId(mInstance);
+        state.mLeaderDataError = otThreadGetLeaderData(mInstance, &state.mLeaderData);
+    }
+
+    mNetworkState.Store(state);
+}
+
+void RcpHost::NotifyThreadStateChanged(void)
+{
+    ThreadStateSnapshot snapshot;
+
+    VerifyOrExit(mInstance != nullptr && mPendingThreadStateChangedFlags != 0);
+
+    snapshot.mFlags       = mPendingThreadStateChangedFlags;
+    snapshot.mDeviceRole  = otThreadGetDeviceRole(mInstance);
+    snapshot.mPartitionId = otThreadGetPartitionId(mInstance);
+#if OTBR_ENABLE_BACKBONE_ROUTER
+    snapshot.mBackboneRouterState = otBackboneRouterGetState(mInstance);
+#endif
+    mPendingThreadStateChangedFlags = 0;
+
+    for (const ThreadStateSubscriber &subscriber : mThreadStateChangedSubscribers)
+    {
+        if (snapshot.mFlags & subscriber.mFlagsMask)
+        {
+            subscriber.mCallback(snapshot);
+        }
+    }
+
+exit:
+    return;
+}
+
 void RcpHost::Update(MainloopContext &aMainloop)
 {
     if (otTaskletsArePending(mInstance))
@@ -339,9 +455,14 @@ void RcpHost::DisableAutoAttach(void)
     mEnableAutoAttach = false;
 }
 
-void RcpHost::PostTimerTask(Milliseconds aDelay, TaskRunner::Task<void> aTask)
+TaskRunner::TaskId RcpHost::PostTimerTask(Milliseconds aDelay, TaskRunner::Task<void> aTask)
 {
-    mTaskRunner.Post(std::move(aDelay), std::move(aTask));
+    return mTaskRunner.Post(std::move(aDelay), std::move(aTask));
+}
+
+void RcpHost::CancelTimerTask(TaskRunner::TaskId aTaskId)
+{
+    mTaskRunner.Cancel(aTaskId);
 }
 
 void RcpHost::RegisterResetHandler(std::function<void(void)> aHandler)
@@ -349,9 +470,9 @@ void RcpHost::RegisterResetHandler(std::function<void(void)> aHandler)
     mResetHandlers.emplace_back(std::move(aHandler));
 }
 
-void RcpHost::AddThreadStateChangedCallback(ThreadStateChangedCallback aCallback)
+void RcpHost::AddThreadStateChangedCallback(otChangedFlags aFlagsMask, ThreadStateChangedCallback aCallback)
 {
-    mThreadStateChangedCallbacks.emplace_back(std::move(aCallback));
+    mThreadStateChangedSubscribers.push_back({aFlagsMask, std::move(aCallback)});
 }
 
 void RcpHost::Reset(void)
@@ -438,5 +559,71 @@ extern "C" void otPlatLogHandleLevelChanged(otLogLevel aLogLevel)
     otbrLogInfo("OpenThread log level changed to %d", aLogLevel);
 }
 
+#if OTBR_ENABLE_DNS_UPSTREAM_QUERY
+/*
+ * The upstream DNS queries of the OpenThread DNS server are answered from the cache of upstream responses when
+ * possible. The platform resolver is wrapped at link time with `-Wl,--wrap`, see the CMakeLists.txt.
+ */
+extern "C" void __real_otPlatDnsStartUpstreamQuery(otInstance             *aInstance,
+                                                   otPlatDnsUpstreamQuery *aTxn,
+                                                   const otMessage        *aQuery);
+extern "C" void __real_otPlatDnsUpstreamQueryDone(otInstance             *aInstance,
+                                                  otPlatDnsUpstreamQuery *aTxn,
+                                                  otMessage              *aResponse);
+
+static void ReadMessage(const otMessage *aMessage, std::vector<uint8_t> &aBuffer)
+{
+    aBuffer.resize(otMessageGetLength(aMessage));
+    aBuffer.resize(otMessageRead(aMessage, 0, aBuffer.data(), static_cast<uint16_t>(aBuffer.size())));
+}
+
+extern "C" void __wrap_otPlatDnsStartUpstreamQuery(otInstance             *aInstance,
+                                                   otPlatDnsUpstreamQuery *aTxn,
+                                                   const otMessage        *aQuery)
+{
+    std::vector<uint8_t> query;
+    std::vector<uint8_t> response;
+    otMessage           *message = nullptr;
+
+    ReadMessage(aQuery, query);
+    VerifyOrExit(DnsUpstreamCache::Get().Lookup(query.data(), query.size(), CoarseClock::Now(), response));
+
+    message = otUdpNewMessage(aInstance, nullptr);
+    VerifyOrExit(message != nullptr);
+
+    if (otMessageAppend(message, response.data(), static_cast<uint16_t>(response.size())) != OT_ERROR_NONE)
+    {
+        otMessageFree(message);
+        message = nullptr;
+    }
+
+exit:
+    if (message != nullptr)
+    {
+        otbrLogDebug("Answered upstream DNS query from the cache");
+        __real_otPlatDnsUpstreamQueryDone(aInstance, aTxn, message);
+    }
+    else
+    {
+        __real_otPlatDnsStartUpstreamQuery(aInstance, aTxn, aQuery);
+    }
+}
+
+extern "C" void __wrap_otPlatDnsUpstreamQueryDone(otInstance             *aInstance,
+                                                  otPlatDnsUpstreamQuery *aTxn,
+                                                  otMessage              *aResponse)
+{
+    std::vector<uint8_t> response;
+
+    if (aResponse != nullptr)
+    {
+        ReadMessage(aResponse, response);
+        DnsUpstreamCache::Get().Store(response.data(), response.size(), CoarseClock::Now());
+    }
+
+    __real_otPlatDnsUpstreamQueryDone(aInstance, aTxn, aResponse);
+}
+#endif // OTBR_ENABLE_DNS_UPSTREAM_QUERY
+
 } // namespace Ncp
 } // namespace otbr
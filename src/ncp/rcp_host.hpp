@@ -45,8 +45,11 @@
 #include <openthread/cli.h>
 #include <openthread/instance.h>
 #include <openthread/openthread-system.h>
+#include <openthread/thread.h>
 
+#include "common/logging.hpp"
 #include "common/mainloop.hpp"
+#include "common/seqlock.hpp"
 #include "common/task_runner.hpp"
 #include "common/types.hpp"
 #include "ncp/thread_host.hpp"
@@ -81,13 +84,120 @@ private:
     otInstance *mInstance;
 };
 
+/**
+ * This structure represents the Thread state delivered to the Thread state changed subscribers.
+ *
+ * It is read from OpenThread once per coalesced notification and shared by all subscribers.
+ */
+struct ThreadStateSnapshot
+{
+    otChangedFlags mFlags;       ///< The flags changed since the previous notification.
+    otDeviceRole   mDeviceRole;  ///< The device role.
+    uint32_t       mPartitionId; ///< The partition ID.
+#if OTBR_ENABLE_BACKBONE_ROUTER
+    otBackboneRouterState mBackboneRouterState; ///< The Backbone Router state.
+#endif
+};
+
+/**
+ * This structure represents the basic Thread network state, which may be read from any thread.
+ *
+ * It is refreshed on the mainloop whenever OpenThread reports a state change.
+ */
+struct NetworkStateSnapshot
+{
+    otDeviceRole    mDeviceRole;                                ///< The device role.
+    uint16_t        mRloc16;                                    ///< The RLOC16.
+    otExtAddress    mExtAddress;                                ///< The extended address.
+    char            mNetworkName[OT_NETWORK_NAME_MAX_SIZE + 1]; ///< The network name.
+    otPanId         mPanId;                                     ///< The PAN ID.
+    otExtendedPanId mExtPanId;                                  ///< The extended PAN ID.
+    uint8_t         mChannel;                                   ///< The channel.
+    uint32_t        mPartitionId;                               ///< The partition ID.
+    otError         mLeaderDataError;                           ///< The error reading the leader data, e.g. detached.
+    otLeaderData    mLeaderData;                                ///< The leader data, unless `mLeaderDataError` is set.
+};
+
+#if OTBR_ENABLE_FEATURE_FLAGS
+/**
+ * This class represents the feature flags applied to OpenThread.
+ *
+ * It is compiled from a `FeatureFlagList`, so that a flag is checked with a bit test and a new list is compared with
+ * the applied one without parsing the protobuf again.
+ */
+class FeatureFlags
+{
+public:
+    /**
+     * This enumeration represents the boolean feature flags.
+     */
+    enum Flag : uint16_t
+    {
+        kNat64              = 1 << 0, ///< NAT64.
+        kDetailedLogging    = 1 << 1, ///< Detailed logging.
+        kTrel               = 1 << 2, ///< TREL.
+        kDnsUpstreamQuery   = 1 << 3, ///< Upstream DNS query.
+        kDhcp6Pd            = 1 << 4, ///< DHCPv6 prefix delegation.
+        kLinkMetricsManager = 1 << 5, ///< Link metrics manager.
+        kEphemeralKey       = 1 << 6, ///< Ephemeral key (ePSKc).
+    };
+
+    static constexpr uint16_t kAllFlags = (kEphemeralKey << 1) - 1;
+
+    /**
+     * This constructor initializes the feature flags with all features disabled.
+     */
+    FeatureFlags(void)
+        : mFlags(0)
+        , mLogLevel(otbrLogGetDefaultLevel())
+    {
+    }
+
+    /**
+     * This constructor compiles the feature flags from a feature flag list.
+     *
+     * @param[in] aFeatureFlagList  The feature flag list.
+     */
+    explicit FeatureFlags(const FeatureFlagList &aFeatureFlagList);
+
+    /**
+     * This method indicates whether a feature is enabled.
+     *
+     * @param[in] aFlag  The feature flag.
+     *
+     * @returns Whether the feature is enabled.
+     */
+    bool IsEnabled(Flag aFlag) const { return (mFlags & aFlag) != 0; }
+
+    /**
+     * This method returns the flags which differ from other feature flags.
+     *
+     * @param[in] aOther  The other feature flags.
+     *
+     * @returns The bitwise OR of the `Flag` values which differ.
+     */
+    uint16_t GetChangedFlags(const FeatureFlags &aOther) const { return mFlags ^ aOther.mFlags; }
+
+    /**
+     * This method returns the log level, which is the default log level unless detailed logging is enabled.
+     *
+     * @returns The log level.
+     */
+    otbrLogLevel GetLogLevel(void) const { return mLogLevel; }
+
+private:
+    uint16_t     mFlags;
+    otbrLogLevel mLogLevel;
+};
+#endif // OTBR_ENABLE_FEATURE_FLAGS
+
 /**
  * This interface defines OpenThread Controller under RCP mode.
  */
-class RcpHost : public MainloopProcessor, public ThreadHost, public OtNetworkProperties
+class RcpHost final : public MainloopProcessor, public ThreadHost, public OtNetworkProperties
 {
 public:
-    using ThreadStateChangedCallback = std::function<void(otChangedFlags aFlags)>;
+    using ThreadStateChangedCallback = std::function<void(const ThreadStateSnapshot &aSnapshot)>;
 
     /**
      * This constructor initializes this object.
@@ -133,16 +243,35 @@ public:
         return mThreadHelper.get();
     }
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "RcpHost"; }
+    void        Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
 
     /**
      * This method posts a task to the timer
      *
      * @param[in] aDelay  The delay in milliseconds before executing the task.
      * @param[in] aTask   The task function.
+     *
+     * @returns The unique ID of the task, which can be passed to `CancelTimerTask()`.
+     */
+    TaskRunner::TaskId PostTimerTask(Milliseconds aDelay, TaskRunner::Task<void> aTask);
+
+    /**
+     * This method cancels a task posted with `PostTimerTask()`.
+     *
+     * @param[in] aTaskId  The unique ID of the task.
      */
-    void PostTimerTask(Milliseconds aDelay, TaskRunner::Task<void> aTask);
+    void CancelTimerTask(TaskRunner::TaskId aTaskId);
+
+    /**
+     * This method returns the task runner of the mainloop.
+     *
+     * The task runner is thread-safe, e.g. work run by a `WorkerPool` can continue on the mainloop with it.
+     *
+     * @returns The task runner.
+     */
+    TaskRunner &GetTaskRunner(void) override { return mTaskRunner; }
 
     /**
      * This method registers a reset handler.
@@ -154,9 +283,23 @@ public:
     /**
      * This method adds a event listener for Thread state changes.
      *
-     * @param[in] aCallback  The callback to receive Thread state changed events.
+     * The notifications raised by OpenThread are coalesced and delivered from the task runner, so a
+     * burst of changes, e.g. while attaching, results in a single call with all the flags.
+     *
+     * @param[in] aFlagsMask  The flags of interest, @p aCallback is only called if any of them changed.
+     * @param[in] aCallback   The callback to receive Thread state changed events.
+     */
+    void AddThreadStateChangedCallback(otChangedFlags aFlagsMask, ThreadStateChangedCallback aCallback);
+
+    /**
+     * This method returns the basic Thread network state.
+     *
+     * This method is thread-safe and never blocks, it returns a copy of the state published by the mainloop when
+     * OpenThread last reported a state change. It's all zeros while the host is not initialized.
+     *
+     * @returns The network state.
      */
-    void AddThreadStateChangedCallback(ThreadStateChangedCallback aCallback);
+    NetworkStateSnapshot GetNetworkState(void) const { return mNetworkState.Load(); }
 
     /**
      * This method resets the OpenThread instance.
@@ -183,12 +326,21 @@ public:
     /**
      * Apply the feature flag values to OpenThread through OpenThread APIs.
      *
+     * Only the flags which differ from the applied ones are applied.
+     *
      * @param[in] aFeatureFlagList  The feature flag list to be applied to OpenThread.
      *
      * @returns The error value of underlying OpenThread API calls.
      */
     otError ApplyFeatureFlagList(const FeatureFlagList &aFeatureFlagList);
 
+    /**
+     * This method returns the feature flags applied in ApplyFeatureFlagList call.
+     *
+     * @returns The applied feature flags.
+     */
+    const FeatureFlags &GetFeatureFlags(void) const { return mFeatureFlags; }
+
     /**
      * This method returns the applied FeatureFlagList in ApplyFeatureFlagList call.
      *
@@ -224,6 +376,8 @@ private:
         static_cast<RcpHost *>(aContext)->HandleStateChanged(aFlags);
     }
     void HandleStateChanged(otChangedFlags aFlags);
+    void NotifyThreadStateChanged(void);
+    void UpdateNetworkState(void);
 
     static void HandleBackboneRouterDomainPrefixEvent(void                             *aContext,
                                                       otBackboneRouterDomainPrefixEvent aEvent,
@@ -243,18 +397,28 @@ private:
 
     otError SetOtbrAndOtLogLevel(otbrLogLevel aLevel);
 
+    struct ThreadStateSubscriber
+    {
+        otChangedFlags             mFlagsMask;
+        ThreadStateChangedCallback mCallback;
+    };
+
     otInstance *mInstance;
 
     otPlatformConfig                           mConfig;
+    TaskRunner                                 mTaskRunner; // Declared before `mThreadHelper` which cancels tasks.
     std::unique_ptr<otbr::agent::ThreadHelper> mThreadHelper;
     std::vector<std::function<void(void)>>     mResetHandlers;
-    TaskRunner                                 mTaskRunner;
-    std::vector<ThreadStateChangedCallback>    mThreadStateChangedCallbacks;
+    std::vector<ThreadStateSubscriber>         mThreadStateChangedSubscribers;
+    otChangedFlags                             mPendingThreadStateChangedFlags = 0;
     bool                                       mEnableAutoAttach = false;
+    SeqLock<NetworkStateSnapshot>              mNetworkState;
 
 #if OTBR_ENABLE_FEATURE_FLAGS
     // The applied FeatureFlagList in ApplyFeatureFlagList call, used for debugging purpose.
-    std::string mAppliedFeatureFlagListBytes;
+    std::string  mAppliedFeatureFlagListBytes;
+    FeatureFlags mFeatureFlags;
+    bool         mFeatureFlagsApplied = false; // Whether `mFeatureFlags` are applied to the current instance.
 #endif
 };
 
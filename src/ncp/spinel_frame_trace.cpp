@@ -0,0 +1,58 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "ncp/spinel_frame_trace.hpp"
+
+#include <string.h>
+
+namespace otbr {
+namespace Ncp {
+
+constexpr uint16_t SpinelFrameTrace::kNumRecords;
+
+SpinelFrameTrace::SpinelFrameTrace(void)
+    : mNumAdded(0)
+{
+    memset(mRecords, 0, sizeof(mRecords));
+}
+
+void SpinelFrameTrace::GetRecords(std::vector<Record> &aRecords) const
+{
+    uint64_t first = mNumAdded > kNumRecords ? mNumAdded - kNumRecords : 0;
+
+    aRecords.clear();
+    aRecords.reserve(mNumAdded - first);
+
+    for (uint64_t i = first; i < mNumAdded; i++)
+    {
+        aRecords.push_back(mRecords[i & (kNumRecords - 1)]);
+    }
+}
+
+} // namespace Ncp
+} // namespace otbr
@@ -0,0 +1,129 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the trace of the spinel frames exchanged with the co-processor.
+ */
+
+#ifndef OTBR_AGENT_SPINEL_FRAME_TRACE_HPP_
+#define OTBR_AGENT_SPINEL_FRAME_TRACE_HPP_
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/time.hpp"
+
+namespace otbr {
+namespace Ncp {
+
+/**
+ * This class implements a ring of the most recent spinel frames exchanged with the co-processor.
+ *
+ * Only the metadata of a frame is recorded, so adding a frame costs a clock read and a few stores and the trace can
+ * stay enabled. The oldest record is overwritten when the ring is full. The trace must only be used from the
+ * mainloop thread.
+ */
+class SpinelFrameTrace : private NonCopyable
+{
+public:
+    static constexpr uint16_t kNumRecords = 256; ///< The number of frames the ring holds, must be a power of two.
+
+    enum Direction : uint8_t
+    {
+        kDirectionTx = 0, ///< The frame is sent to the co-processor.
+        kDirectionRx = 1, ///< The frame is received from the co-processor.
+    };
+
+    /**
+     * This structure represents the record of a frame.
+     */
+    struct Record
+    {
+        uint64_t mTimestamp; ///< The time the frame was handled, in microseconds of the monotonic clock.
+        uint32_t mCommand;   ///< The spinel command.
+        uint32_t mPropKey;   ///< The spinel property key.
+        uint16_t mLength;    ///< The length of the frame in bytes.
+        uint8_t  mHeader;    ///< The spinel header, including the IID and the TID.
+        uint8_t  mDirection; ///< The direction, a `Direction` value.
+    };
+
+    /**
+     * This constructor initializes an empty trace.
+     */
+    SpinelFrameTrace(void);
+
+    /**
+     * This method records a frame.
+     *
+     * @param[in] aDirection  The direction of the frame.
+     * @param[in] aHeader     The spinel header.
+     * @param[in] aCommand    The spinel command.
+     * @param[in] aPropKey    The spinel property key.
+     * @param[in] aLength     The length of the frame in bytes.
+     */
+    void Add(Direction aDirection, uint8_t aHeader, uint32_t aCommand, uint32_t aPropKey, uint16_t aLength)
+    {
+        Record &record = mRecords[mNumAdded++ & (kNumRecords - 1)];
+
+        record.mTimestamp = static_cast<uint64_t>(
+            std::chrono::duration_cast<Microseconds>(Clock::now().time_since_epoch()).count());
+        record.mCommand   = aCommand;
+        record.mPropKey   = aPropKey;
+        record.mLength    = aLength;
+        record.mHeader    = aHeader;
+        record.mDirection = aDirection;
+    }
+
+    /**
+     * This method returns the records in the trace.
+     *
+     * @param[out] aRecords  The records, oldest first.
+     */
+    void GetRecords(std::vector<Record> &aRecords) const;
+
+    /**
+     * This method returns the number of frames recorded since the trace was created, including the overwritten ones.
+     *
+     * @returns The number of recorded frames.
+     */
+    uint64_t GetNumAdded(void) const { return mNumAdded; }
+
+private:
+    static_assert((kNumRecords & (kNumRecords - 1)) == 0, "kNumRecords must be a power of two");
+
+    Record   mRecords[kNumRecords];
+    uint64_t mNumAdded;
+};
+
+} // namespace Ncp
+} // namespace otbr
+
+#endif // OTBR_AGENT_SPINEL_FRAME_TRACE_HPP_
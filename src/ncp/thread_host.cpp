@@ -35,7 +35,9 @@
 
 #include "lib/spinel/coprocessor_type.h"
 
+#if OTBR_ENABLE_NCP_HOST
 #include "ncp_host.hpp"
+#endif
 #include "rcp_host.hpp"
 
 namespace otbr {
@@ -66,16 +68,20 @@ std::unique_ptr<ThreadHost> ThreadHost::Create(const char                      *
 
     switch (coprocessorType)
     {
+#if OTBR_ENABLE_RCP_HOST
     case OT_COPROCESSOR_RCP:
         host = MakeUnique<RcpHost>(aInterfaceName, aRadioUrls, aBackboneInterfaceName, aDryRun, aEnableAutoAttach);
         break;
+#endif
 
+#if OTBR_ENABLE_NCP_HOST
     case OT_COPROCESSOR_NCP:
         host = MakeUnique<NcpHost>(aInterfaceName, aDryRun);
         break;
+#endif
 
     default:
-        DieNow("Unknown coprocessor type!");
+        DieNow("Unknown or unsupported coprocessor type!");
         break;
     }
 
@@ -43,7 +43,21 @@
 
 #include "lib/spinel/coprocessor_type.h"
 
+#include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/task_runner.hpp"
+
+#ifndef OTBR_ENABLE_RCP_HOST
+#define OTBR_ENABLE_RCP_HOST 1
+#endif
+
+#ifndef OTBR_ENABLE_NCP_HOST
+#define OTBR_ENABLE_NCP_HOST 1
+#endif
+
+#if !OTBR_ENABLE_RCP_HOST && !OTBR_ENABLE_NCP_HOST
+#error "At least one of OTBR_ENABLE_RCP_HOST and OTBR_ENABLE_NCP_HOST must be enabled"
+#endif
 
 namespace otbr {
 namespace Ncp {
@@ -153,6 +167,15 @@ public:
      */
     virtual const char *GetInterfaceName(void) const = 0;
 
+    /**
+     * This method returns the task runner of the mainloop.
+     *
+     * The task runner is thread-safe, so work started on another thread can continue on the mainloop with it.
+     *
+     * @returns The task runner.
+     */
+    virtual TaskRunner &GetTaskRunner(void) = 0;
+
     /**
      * Initializes the Thread controller.
      */
@@ -172,6 +195,29 @@ protected:
     static otLogLevel ConvertToOtLogLevel(otbrLogLevel aLevel);
 };
 
+/**
+ * This function returns the co-processor type of a Thread host.
+ *
+ * The type is a constant when the agent is built for only one co-processor type (`OTBR_COPROCESSOR`), so that the
+ * code for the other type is eliminated from the callers.
+ *
+ * @param[in] aHost  The Thread host.
+ *
+ * @returns The co-processor type.
+ */
+inline CoprocessorType GetCoprocessorType(ThreadHost &aHost)
+{
+#if !OTBR_ENABLE_NCP_HOST
+    OTBR_UNUSED_VARIABLE(aHost);
+    return OT_COPROCESSOR_RCP;
+#elif !OTBR_ENABLE_RCP_HOST
+    OTBR_UNUSED_VARIABLE(aHost);
+    return OT_COPROCESSOR_NCP;
+#else
+    return aHost.GetCoprocessorType();
+#endif
+}
+
 } // namespace Ncp
 } // namespace otbr
 
@@ -243,12 +243,13 @@ function thread_state()
 	luci.http.prepare_content("application/json")
 
 	local result = {}
-	result.state = threadget("state").State
+	local status = threadgetmany({ "state", "panid", "channel", "networkname" })
+	result.state = status.State
 
 	if(result.state ~= "disabled") then
-		result.panid = threadget("panid").PanId
-		result.channel = threadget("channel").Channel
-		result.networkname = threadget("networkname").NetworkName
+		result.panid = status.PanId
+		result.channel = status.Channel
+		result.networkname = status.NetworkName
 	end
 	luci.http.write_json(result)
 end
@@ -263,15 +264,16 @@ function thread_neighbors()
 	luci.http.prepare_content("application/json")
 
 	local result = {}
-	local neighbor = neighborlist()
+	local status = threadgetmany({ "state", "neighbor", "parent", "joinernum" })
+	local neighbor = neighborlist(status)
 
 	result.neighbor = neighbor.neighborlist
 
-	local joiner = joinerlist()
+	local joiner = joinerlist(status)
 	result.joinernum = joiner.joinernum
 	result.joinerlist = joiner.joinerlist
 
-	result.state = threadget("state").State
+	result.state = status.State
 
 	luci.http.write_json(result)
 end
@@ -287,20 +289,22 @@ function networkdata()
 		l[#l+1] = v
 	end
 
+	local status = threadgetmany({ "state", "rloc16", "joinernum", "leaderdata" })
+
 	data.connect = l
-	data.state = threadget("state").State
-	data.rloc16 = threadget("rloc16").rloc16
-	data.joinernum = threadget("joinernum").joinernum
-	data.leader = threadget("leaderdata").leaderdata.LeaderRouterId
+	data.state = status.State
+	data.rloc16 = status.rloc16
+	data.joinernum = status.joinernum
+	data.leader = status.leaderdata and status.leaderdata.LeaderRouterId
 	return data
 end
 
-function joinerlist()
+function joinerlist(status)
 	local k, v, result
 	local l = { }
 	local data = { }
 
-	result = connect_ubus("joinernum")
+	result = status or connect_ubus("joinernum")
 	data.joinernum = result.joinernum
 
 	if result.Joinernum ~= 0 then
@@ -313,22 +317,20 @@ function joinerlist()
 	return data
 end
 
-function neighborlist()
-	local k, v, result, tmpResult
+function neighborlist(status)
+	local k, v, result
 	local l = { }
 	local data = { }
 
-	local state = threadget("state").State
+	status = status or threadgetmany({ "state", "neighbor", "parent" })
 
-	if state == 'child' then
-		tmpResult = connect_ubus("parent")
-		result = tmpResult.parent_list
+	if status.State == 'child' then
+		result = status.parent_list
 	else
-		tmpResult = connect_ubus("neighbor")
-		result = tmpResult.neighbor_list
+		result = status.neighbor_list
 	end
 
-	for k, v in pairs(result) do
+	for k, v in pairs(result or { }) do
 		l[#l+1] = v
 	end
 
@@ -355,3 +357,17 @@ function threadget(action)
 
 	return result
 end
+
+function threadgetmany(fields)
+	local ubus = require "ubus"
+	local result
+	local conn = ubus.connect()
+
+	if not conn then
+		error("Failed to connect to ubusd")
+	end
+
+	result = conn:call("otbr", "getmany", { fields = fields })
+
+	return result
+end
@@ -34,9 +34,12 @@
 
 #include "openwrt/ubus/otubus.hpp"
 
-#include <mutex>
+#include <vector>
 
 #include <arpa/inet.h>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
 #include <sys/eventfd.h>
 
 #include <openthread/commissioner.h>
@@ -50,7 +53,6 @@ namespace otbr {
 namespace ubus {
 
 static UbusServer *sUbusServerInstance = nullptr;
-static int         sUbusEfd            = -1;
 static void       *sJsonUri            = nullptr;
 static int         sBufNum;
 
@@ -58,19 +60,49 @@ const static int PANID_LENGTH      = 10;
 const static int XPANID_LENGTH     = 64;
 const static int NETWORKKEY_LENGTH = 64;
 
-UbusServer::UbusServer(Ncp::RcpHost *aHost, std::mutex *aMutex)
-    : mIfFinishScan(false)
+UbusServer::UbusServer(Ncp::RcpHost *aHost, TaskRunner *aTaskRunner)
+    : mScanInProgress(false)
+    , mScanList(nullptr)
     , mContext(nullptr)
     , mSockPath(nullptr)
     , mHost(aHost)
-    , mHostMutex(aMutex)
+    , mTaskRunner(aTaskRunner)
     , mSecond(0)
+    , mMainloopWaitTime(0)
+    , mMainloopTimedOut(false)
 {
+    memset(&mScanRequest, 0, sizeof(mScanRequest));
+    memset(&mScanBuf, 0, sizeof(mScanBuf));
+    memset(&mScanDoneFd, 0, sizeof(mScanDoneFd));
+    memset(&mEventFd, 0, sizeof(mEventFd));
     memset(&mNetworkdataBuf, 0, sizeof(mNetworkdataBuf));
+    memset(&mEventBuf, 0, sizeof(mEventBuf));
     memset(&mBuf, 0, sizeof(mBuf));
 
+    mScanDoneFd.fd = -1;
+    mScanDoneFd.cb = HandleScanDone;
+    mEventFd.fd    = -1;
+    mEventFd.cb    = HandleEvents;
+
+    blob_buf_init(&mScanBuf, 0);
     blob_buf_init(&mBuf, 0);
     blob_buf_init(&mNetworkdataBuf, 0);
+    blob_buf_init(&mEventBuf, 0);
+
+    // Reply buffers are reused across requests, growing them once avoids reallocating on every poll.
+    blob_buf_grow(&mBuf, kReplyBufferSize);
+
+    for (ReplyCache &cache : mReplyCaches)
+    {
+        memset(&cache.mBuf, 0, sizeof(cache.mBuf));
+        blob_buf_init(&cache.mBuf, 0);
+        blob_buf_grow(&cache.mBuf, kReplyBufferSize);
+        cache.mError = OT_ERROR_NONE;
+        cache.mValid = false;
+    }
+
+    mStaleReplies  = 0;
+    mPendingEvents = 0;
 }
 
 UbusServer &UbusServer::GetInstance(void)
@@ -78,9 +110,157 @@ UbusServer &UbusServer::GetInstance(void)
     return *sUbusServerInstance;
 }
 
-void UbusServer::Initialize(Ncp::RcpHost *aHost, std::mutex *aMutex)
+void UbusServer::Initialize(Ncp::RcpHost *aHost, TaskRunner *aTaskRunner)
+{
+    sUbusServerInstance = new UbusServer(aHost, aTaskRunner);
+
+    aHost->AddThreadStateChangedCallback(
+        OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID | OT_CHANGED_THREAD_CHILD_ADDED |
+            OT_CHANGED_THREAD_CHILD_REMOVED | OT_CHANGED_PARENT_LINK_QUALITY | OT_CHANGED_THREAD_NETDATA,
+        [](const Ncp::ThreadStateSnapshot &aSnapshot) { sUbusServerInstance->HandleThreadStateChanged(aSnapshot); });
+}
+
+void UbusServer::HandleThreadStateChanged(const Ncp::ThreadStateSnapshot &aSnapshot)
+{
+    static constexpr otChangedFlags kRoleFlags     = OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID;
+    static constexpr otChangedFlags kNeighborFlags = OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID |
+                                                     OT_CHANGED_THREAD_CHILD_ADDED | OT_CHANGED_THREAD_CHILD_REMOVED;
+    static constexpr otChangedFlags kParentFlags =
+        OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID | OT_CHANGED_PARENT_LINK_QUALITY;
+
+    otChangedFlags flags = aSnapshot.mFlags;
+    uint32_t       stale = 0;
+    Event          event;
+
+    if (flags & kNeighborFlags)
+    {
+        stale |= 1u << kCachedReplyNeighbor;
+    }
+
+    if (flags & kParentFlags)
+    {
+        stale |= 1u << kCachedReplyParent;
+    }
+
+    mStaleReplies |= stale;
+
+    memset(&event, 0, sizeof(event));
+
+    if (flags & kRoleFlags)
+    {
+        event.mType        = kEventRole;
+        event.mRole        = aSnapshot.mDeviceRole;
+        event.mPartitionId = aSnapshot.mPartitionId;
+        QueueEvent(event);
+    }
+
+    if (flags & OT_CHANGED_THREAD_NETDATA)
+    {
+        event.mType = kEventNetworkData;
+        QueueEvent(event);
+    }
+
+    if (flags & kNeighborFlags)
+    {
+        event.mType = kEventNeighbor;
+        QueueEvent(event);
+    }
+}
+
+void UbusServer::QueueEvent(const Event &aEvent)
+{
+    uint64_t eventNum = 1;
+    uint32_t mask     = 1u << aEvent.mType;
+
+    // The subscribers read the network data and the neighbor table again, so one queued event is enough.
+    if (aEvent.mType == kEventNetworkData || aEvent.mType == kEventNeighbor)
+    {
+        VerifyOrExit(!(mPendingEvents.fetch_or(mask) & mask));
+    }
+
+    mEvents.Push(aEvent);
+
+    // The ubus context is not thread-safe, so the events are emitted on the ubus thread.
+    if (mEventFd.fd != -1 && write(mEventFd.fd, &eventNum, sizeof(eventNum)) != sizeof(eventNum))
+    {
+        otbrLogWarning("Failed to signal ubus events: %s", strerror(errno));
+    }
+
+exit:
+    return;
+}
+
+void UbusServer::HandleEvents(struct uloop_fd *aFd, unsigned int aEvents)
+{
+    OT_UNUSED_VARIABLE(aFd);
+    OT_UNUSED_VARIABLE(aEvents);
+
+    GetInstance().HandleEventsDetail();
+}
+
+void UbusServer::HandleEventsDetail(void)
+{
+    uint64_t eventNum;
+    Event    event;
+
+    VerifyOrExit(read(mEventFd.fd, &eventNum, sizeof(eventNum)) == sizeof(eventNum));
+
+    while (mEvents.Pop(event))
+    {
+        mPendingEvents.fetch_and(~(1u << event.mType));
+        SendEvent(event);
+    }
+
+exit:
+    return;
+}
+
+bool UbusServer::SendCachedReply(CachedReply               aReply,
+                                 struct ubus_context      *aContext,
+                                 struct ubus_request_data *aRequest,
+                                 otError                  &aError)
+{
+    ReplyCache &cache = mReplyCaches[aReply];
+    uint32_t    mask  = 1u << aReply;
+    bool        sent  = false;
+
+    if (mStaleReplies.fetch_and(~mask) & mask)
+    {
+        cache.mValid = false;
+    }
+
+    VerifyOrExit(cache.mValid && Clock::now() - cache.mUpdateTime < Seconds(kReplyCacheMaxAge));
+
+    ubus_send_reply(aContext, aRequest, cache.mBuf.head);
+    aError = cache.mError;
+    sent   = true;
+
+exit:
+    return sent;
+}
+
+struct blob_buf *UbusServer::BeginCachedReply(CachedReply aReply)
+{
+    mReplyCaches[aReply].mValid = false;
+    blob_buf_init(&mReplyCaches[aReply].mBuf, 0);
+
+    return &mReplyCaches[aReply].mBuf;
+}
+
+void UbusServer::SendCachedReply(CachedReply               aReply,
+                                 otError                   aError,
+                                 struct ubus_context      *aContext,
+                                 struct ubus_request_data *aRequest)
 {
-    sUbusServerInstance = new UbusServer(aHost, aMutex);
+    ReplyCache &cache = mReplyCaches[aReply];
+
+    blobmsg_add_u16(&cache.mBuf, "Error", aError);
+    ubus_send_reply(aContext, aRequest, cache.mBuf.head);
+
+    // A request which timed out waiting for the mainloop is retried by the next one.
+    cache.mError      = aError;
+    cache.mValid      = (aError != OT_ERROR_RESPONSE_TIMEOUT);
+    cache.mUpdateTime = Clock::now();
 }
 
 enum
@@ -96,6 +276,12 @@ enum
     ADD_JOINER_MAX,
 };
 
+enum
+{
+    FIELDS,
+    GET_MANY_MAX,
+};
+
 enum
 {
     NETWORKKEY,
@@ -156,6 +342,10 @@ static const struct blobmsg_policy addJoinerPolicy[ADD_JOINER_MAX] = {
     [EUI64] = {.name = "eui64", .type = BLOBMSG_TYPE_STRING},
 };
 
+static const struct blobmsg_policy getManyPolicy[GET_MANY_MAX] = {
+    [FIELDS] = {.name = "fields", .type = BLOBMSG_TYPE_ARRAY},
+};
+
 static const struct blobmsg_policy mgmtsetPolicy[MGMTSET_MAX] = {
     [NETWORKKEY]  = {.name = "networkkey", .type = BLOBMSG_TYPE_STRING},
     [NETWORKNAME] = {.name = "networkname", .type = BLOBMSG_TYPE_STRING},
@@ -165,48 +355,54 @@ static const struct blobmsg_policy mgmtsetPolicy[MGMTSET_MAX] = {
     [PSKC]        = {.name = "pskc", .type = BLOBMSG_TYPE_STRING},
 };
 
+// Every method records its request count and latencies, see `UbusServer::RecordRequest()`.
+#define OTBR_UBUS_HANDLER(aHandler) &UbusServer::MeasuredHandler<&UbusServer::aHandler>
+
 static const struct ubus_method otbrMethods[] = {
-    {"scan", &UbusServer::UbusScanHandler, 0, 0, nullptr, 0},
-    {"channel", &UbusServer::UbusChannelHandler, 0, 0, nullptr, 0},
-    {"setchannel", &UbusServer::UbusSetChannelHandler, 0, 0, setChannelPolicy, ARRAY_SIZE(setChannelPolicy)},
-    {"networkname", &UbusServer::UbusNetworknameHandler, 0, 0, nullptr, 0},
-    {"setnetworkname", &UbusServer::UbusSetNetworknameHandler, 0, 0, setNetworknamePolicy,
+    {"scan", OTBR_UBUS_HANDLER(UbusScanHandler), 0, 0, nullptr, 0},
+    {"channel", OTBR_UBUS_HANDLER(UbusChannelHandler), 0, 0, nullptr, 0},
+    {"setchannel", OTBR_UBUS_HANDLER(UbusSetChannelHandler), 0, 0, setChannelPolicy, ARRAY_SIZE(setChannelPolicy)},
+    {"networkname", OTBR_UBUS_HANDLER(UbusNetworknameHandler), 0, 0, nullptr, 0},
+    {"setnetworkname", OTBR_UBUS_HANDLER(UbusSetNetworknameHandler), 0, 0, setNetworknamePolicy,
      ARRAY_SIZE(setNetworknamePolicy)},
-    {"state", &UbusServer::UbusStateHandler, 0, 0, nullptr, 0},
-    {"panid", &UbusServer::UbusPanIdHandler, 0, 0, nullptr, 0},
-    {"setpanid", &UbusServer::UbusSetPanIdHandler, 0, 0, setPanIdPolicy, ARRAY_SIZE(setPanIdPolicy)},
-    {"rloc16", &UbusServer::UbusRloc16Handler, 0, 0, nullptr, 0},
-    {"extpanid", &UbusServer::UbusExtPanIdHandler, 0, 0, nullptr, 0},
-    {"setextpanid", &UbusServer::UbusSetExtPanIdHandler, 0, 0, setExtPanIdPolicy, ARRAY_SIZE(setExtPanIdPolicy)},
-    {"networkkey", &UbusServer::UbusNetworkkeyHandler, 0, 0, nullptr, 0},
-    {"setnetworkkey", &UbusServer::UbusSetNetworkkeyHandler, 0, 0, setNetworkkeyPolicy,
+    {"state", OTBR_UBUS_HANDLER(UbusStateHandler), 0, 0, nullptr, 0},
+    {"panid", OTBR_UBUS_HANDLER(UbusPanIdHandler), 0, 0, nullptr, 0},
+    {"setpanid", OTBR_UBUS_HANDLER(UbusSetPanIdHandler), 0, 0, setPanIdPolicy, ARRAY_SIZE(setPanIdPolicy)},
+    {"rloc16", OTBR_UBUS_HANDLER(UbusRloc16Handler), 0, 0, nullptr, 0},
+    {"extpanid", OTBR_UBUS_HANDLER(UbusExtPanIdHandler), 0, 0, nullptr, 0},
+    {"setextpanid", OTBR_UBUS_HANDLER(UbusSetExtPanIdHandler), 0, 0, setExtPanIdPolicy, ARRAY_SIZE(setExtPanIdPolicy)},
+    {"networkkey", OTBR_UBUS_HANDLER(UbusNetworkkeyHandler), 0, 0, nullptr, 0},
+    {"setnetworkkey", OTBR_UBUS_HANDLER(UbusSetNetworkkeyHandler), 0, 0, setNetworkkeyPolicy,
      ARRAY_SIZE(setNetworkkeyPolicy)},
-    {"pskc", &UbusServer::UbusPskcHandler, 0, 0, nullptr, 0},
-    {"setpskc", &UbusServer::UbusSetPskcHandler, 0, 0, setPskcPolicy, ARRAY_SIZE(setPskcPolicy)},
-    {"threadstart", &UbusServer::UbusThreadStartHandler, 0, 0, nullptr, 0},
-    {"threadstop", &UbusServer::UbusThreadStopHandler, 0, 0, nullptr, 0},
-    {"neighbor", &UbusServer::UbusNeighborHandler, 0, 0, nullptr, 0},
-    {"parent", &UbusServer::UbusParentHandler, 0, 0, nullptr, 0},
-    {"mode", &UbusServer::UbusModeHandler, 0, 0, nullptr, 0},
-    {"setmode", &UbusServer::UbusSetModeHandler, 0, 0, setModePolicy, ARRAY_SIZE(setModePolicy)},
-    {"partitionid", &UbusServer::UbusPartitionIdHandler, 0, 0, nullptr, 0},
-    {"leave", &UbusServer::UbusLeaveHandler, 0, 0, nullptr, 0},
-    {"leaderdata", &UbusServer::UbusLeaderdataHandler, 0, 0, nullptr, 0},
-    {"networkdata", &UbusServer::UbusNetworkdataHandler, 0, 0, nullptr, 0},
-    {"commissionerstart", &UbusServer::UbusCommissionerStartHandler, 0, 0, nullptr, 0},
-    {"joinernum", &UbusServer::UbusJoinerNumHandler, 0, 0, nullptr, 0},
-    {"joinerremove", &UbusServer::UbusJoinerRemoveHandler, 0, 0, nullptr, 0},
-    {"macfiltersetstate", &UbusServer::UbusMacfilterSetStateHandler, 0, 0, macfilterSetStatePolicy,
+    {"pskc", OTBR_UBUS_HANDLER(UbusPskcHandler), 0, 0, nullptr, 0},
+    {"setpskc", OTBR_UBUS_HANDLER(UbusSetPskcHandler), 0, 0, setPskcPolicy, ARRAY_SIZE(setPskcPolicy)},
+    {"threadstart", OTBR_UBUS_HANDLER(UbusThreadStartHandler), 0, 0, nullptr, 0},
+    {"threadstop", OTBR_UBUS_HANDLER(UbusThreadStopHandler), 0, 0, nullptr, 0},
+    {"neighbor", OTBR_UBUS_HANDLER(UbusNeighborHandler), 0, 0, nullptr, 0},
+    {"parent", OTBR_UBUS_HANDLER(UbusParentHandler), 0, 0, nullptr, 0},
+    {"mode", OTBR_UBUS_HANDLER(UbusModeHandler), 0, 0, nullptr, 0},
+    {"setmode", OTBR_UBUS_HANDLER(UbusSetModeHandler), 0, 0, setModePolicy, ARRAY_SIZE(setModePolicy)},
+    {"partitionid", OTBR_UBUS_HANDLER(UbusPartitionIdHandler), 0, 0, nullptr, 0},
+    {"leave", OTBR_UBUS_HANDLER(UbusLeaveHandler), 0, 0, nullptr, 0},
+    {"leaderdata", OTBR_UBUS_HANDLER(UbusLeaderdataHandler), 0, 0, nullptr, 0},
+    {"networkdata", OTBR_UBUS_HANDLER(UbusNetworkdataHandler), 0, 0, nullptr, 0},
+    {"commissionerstart", OTBR_UBUS_HANDLER(UbusCommissionerStartHandler), 0, 0, nullptr, 0},
+    {"joinernum", OTBR_UBUS_HANDLER(UbusJoinerNumHandler), 0, 0, nullptr, 0},
+    {"joinerremove", OTBR_UBUS_HANDLER(UbusJoinerRemoveHandler), 0, 0, nullptr, 0},
+    {"macfiltersetstate", OTBR_UBUS_HANDLER(UbusMacfilterSetStateHandler), 0, 0, macfilterSetStatePolicy,
      ARRAY_SIZE(macfilterSetStatePolicy)},
-    {"macfilteradd", &UbusServer::UbusMacfilterAddHandler, 0, 0, macfilterAddPolicy, ARRAY_SIZE(macfilterAddPolicy)},
-    {"macfilterremove", &UbusServer::UbusMacfilterRemoveHandler, 0, 0, macfilterRemovePolicy,
+    {"macfilteradd", OTBR_UBUS_HANDLER(UbusMacfilterAddHandler), 0, 0, macfilterAddPolicy,
+     ARRAY_SIZE(macfilterAddPolicy)},
+    {"macfilterremove", OTBR_UBUS_HANDLER(UbusMacfilterRemoveHandler), 0, 0, macfilterRemovePolicy,
      ARRAY_SIZE(macfilterRemovePolicy)},
-    {"macfilterclear", &UbusServer::UbusMacfilterClearHandler, 0, 0, nullptr, 0},
-    {"macfilterstate", &UbusServer::UbusMacfilterStateHandler, 0, 0, nullptr, 0},
-    {"macfilteraddr", &UbusServer::UbusMacfilterAddrHandler, 0, 0, nullptr, 0},
-    {"joineradd", &UbusServer::UbusJoinerAddHandler, 0, 0, addJoinerPolicy, ARRAY_SIZE(addJoinerPolicy)},
-    {"mgmtset", &UbusServer::UbusMgmtsetHandler, 0, 0, mgmtsetPolicy, ARRAY_SIZE(mgmtsetPolicy)},
-    {"interfacename", &UbusServer::UbusInterfaceNameHandler, 0, 0, nullptr, 0},
+    {"macfilterclear", OTBR_UBUS_HANDLER(UbusMacfilterClearHandler), 0, 0, nullptr, 0},
+    {"macfilterstate", OTBR_UBUS_HANDLER(UbusMacfilterStateHandler), 0, 0, nullptr, 0},
+    {"macfilteraddr", OTBR_UBUS_HANDLER(UbusMacfilterAddrHandler), 0, 0, nullptr, 0},
+    {"joineradd", OTBR_UBUS_HANDLER(UbusJoinerAddHandler), 0, 0, addJoinerPolicy, ARRAY_SIZE(addJoinerPolicy)},
+    {"mgmtset", OTBR_UBUS_HANDLER(UbusMgmtsetHandler), 0, 0, mgmtsetPolicy, ARRAY_SIZE(mgmtsetPolicy)},
+    {"interfacename", OTBR_UBUS_HANDLER(UbusInterfaceNameHandler), 0, 0, nullptr, 0},
+    {"getmany", OTBR_UBUS_HANDLER(UbusGetManyHandler), 0, 0, getManyPolicy, ARRAY_SIZE(getManyPolicy)},
+    {"statistics", OTBR_UBUS_HANDLER(UbusStatisticsHandler), 0, 0, nullptr, 0},
 };
 
 static struct ubus_object_type otbrObjType = {"otbr_prog", 0, otbrMethods, ARRAY_SIZE(otbrMethods)};
@@ -223,20 +419,191 @@ static struct ubus_object otbr = {
     n_methods : ARRAY_SIZE(otbrMethods),
 };
 
-void UbusServer::ProcessScan(void)
+void UbusServer::SendEvent(const Event &aEvent)
 {
-    otError  error        = OT_ERROR_NONE;
-    uint32_t scanChannels = 0;
-    uint16_t scanDuration = 0;
+    const char *name = nullptr;
+    char        eventName[32];
+    char        state[16];
+    char        joinerId[XPANID_LENGTH];
+
+    blob_buf_init(&mEventBuf, 0);
+
+    switch (aEvent.mType)
+    {
+    case kEventRole:
+        name = "role";
+        GetState(aEvent.mRole, state);
+        blobmsg_add_string(&mEventBuf, "State", state);
+        blobmsg_add_u32(&mEventBuf, "PartitionId", aEvent.mPartitionId);
+        break;
+
+    case kEventNetworkData:
+        name = "networkdata";
+        break;
+
+    case kEventNeighbor:
+        name = "neighbor";
+        break;
+
+    case kEventJoiner:
+        name = "joiner";
+
+        switch (aEvent.mJoinerEvent)
+        {
+        case OT_COMMISSIONER_JOINER_START:
+            blobmsg_add_string(&mEventBuf, "Event", "start");
+            break;
+        case OT_COMMISSIONER_JOINER_CONNECTED:
+            blobmsg_add_string(&mEventBuf, "Event", "connected");
+            break;
+        case OT_COMMISSIONER_JOINER_FINALIZE:
+            blobmsg_add_string(&mEventBuf, "Event", "finalize");
+            break;
+        case OT_COMMISSIONER_JOINER_END:
+            blobmsg_add_string(&mEventBuf, "Event", "end");
+            break;
+        case OT_COMMISSIONER_JOINER_REMOVED:
+            blobmsg_add_string(&mEventBuf, "Event", "removed");
+            break;
+        }
+
+        if (aEvent.mHasJoinerId)
+        {
+            OutputBytes(aEvent.mJoinerId.m8, sizeof(aEvent.mJoinerId.m8), joinerId);
+            blobmsg_add_string(&mEventBuf, "JoinerId", joinerId);
+        }
+        break;
+    }
+
+    VerifyOrExit(name != nullptr);
+
+    // Subscribers of the object are notified, and listeners of "otbr.*" events get the event without subscribing.
+    if (otbr.has_subscribers)
+    {
+        ubus_notify(mContext, &otbr, name, mEventBuf.head, -1);
+    }
+
+    snprintf(eventName, sizeof(eventName), "otbr.%s", name);
+    ubus_send_event(mContext, eventName, mEventBuf.head);
 
-    mHostMutex->lock();
-    SuccessOrExit(error = otLinkActiveScan(mHost->GetInstance(), scanChannels, scanDuration,
-                                           &UbusServer::HandleActiveScanResult, this));
 exit:
-    mHostMutex->unlock();
     return;
 }
 
+otError UbusServer::RunOnMainloop(const TaskRunner::Task<otError> &aTask)
+{
+    Timepoint postTime = Clock::now();
+    otError   error    = OT_ERROR_NONE;
+    otbrError waitError;
+
+    waitError = mTaskRunner->PostAndWaitFor<otError>(
+        Milliseconds(kMainloopTimeout),
+        [&](void) {
+            mMainloopWaitTime += std::chrono::duration_cast<Microseconds>(Clock::now() - postTime);
+            return aTask();
+        },
+        error);
+    VerifyOrExit(waitError != OTBR_ERROR_NONE);
+
+    otbrLogWarning("The mainloop didn't pick up a request within %d ms: %s", kMainloopTimeout,
+                   otbrErrorString(waitError));
+    mMainloopTimedOut = true;
+    error             = OT_ERROR_RESPONSE_TIMEOUT;
+
+exit:
+    return error;
+}
+
+void UbusServer::RecordRequest(const char *aMethod, Timepoint aStartTime)
+{
+    Microseconds latency = std::chrono::duration_cast<Microseconds>(Clock::now() - aStartTime);
+    MethodStats &stats   = mMethodStats[aMethod];
+
+    stats.mRequestCount++;
+    stats.mLatency.Record(latency);
+    stats.mMainloopWaitTime.Record(mMainloopWaitTime);
+
+    if (latency >= Milliseconds(kSlowRequestThreshold))
+    {
+        otbrLogWarning("Method %s took %lld ms, waited %lld ms for the mainloop", aMethod,
+                       static_cast<long long>(latency.count() / 1000),
+                       static_cast<long long>(mMainloopWaitTime.count() / 1000));
+    }
+}
+
+static void AppendHistogram(struct blob_buf *aBuf, const char *aName, const Histogram &aHistogram)
+{
+    void *table = blobmsg_open_table(aBuf, aName);
+    void *array;
+
+    blobmsg_add_u64(aBuf, "count", aHistogram.GetCount());
+    blobmsg_add_u64(aBuf, "sum", aHistogram.GetSum());
+    blobmsg_add_u32(aBuf, "max", aHistogram.GetMax());
+
+    array = blobmsg_open_array(aBuf, "upperBounds");
+    for (uint8_t i = 0; i < Histogram::kNumBuckets - 1; i++)
+    {
+        blobmsg_add_u32(aBuf, nullptr, aHistogram.GetUpperBound(i));
+    }
+    blobmsg_close_array(aBuf, array);
+
+    array = blobmsg_open_array(aBuf, "counts");
+    for (uint8_t i = 0; i < Histogram::kNumBuckets; i++)
+    {
+        blobmsg_add_u32(aBuf, nullptr, aHistogram.GetBucketCount(i));
+    }
+    blobmsg_close_array(aBuf, array);
+
+    blobmsg_close_table(aBuf, table);
+}
+
+int UbusServer::UbusStatisticsHandler(struct ubus_context      *aContext,
+                                      struct ubus_object       *aObj,
+                                      struct ubus_request_data *aRequest,
+                                      const char               *aMethod,
+                                      struct blob_attr         *aMsg)
+{
+    OT_UNUSED_VARIABLE(aObj);
+    OT_UNUSED_VARIABLE(aMethod);
+    OT_UNUSED_VARIABLE(aMsg);
+
+    return GetInstance().UbusStatisticsHandlerDetail(aContext, aRequest);
+}
+
+int UbusServer::UbusStatisticsHandlerDetail(struct ubus_context *aContext, struct ubus_request_data *aRequest)
+{
+    void *methods;
+
+    blob_buf_init(&mBuf, 0);
+
+    methods = blobmsg_open_table(&mBuf, "methods");
+    for (const auto &entry : mMethodStats)
+    {
+        void *method = blobmsg_open_table(&mBuf, entry.first.c_str());
+
+        blobmsg_add_u64(&mBuf, "requests", entry.second.mRequestCount);
+        AppendHistogram(&mBuf, "latencyUs", entry.second.mLatency);
+        AppendHistogram(&mBuf, "mainloopWaitUs", entry.second.mMainloopWaitTime);
+
+        blobmsg_close_table(&mBuf, method);
+    }
+    blobmsg_close_table(&mBuf, methods);
+
+    AppendResult(OT_ERROR_NONE, aContext, aRequest);
+    return 0;
+}
+
+otError UbusServer::ProcessScan(void)
+{
+    return RunOnMainloop([this](void) {
+        uint32_t scanChannels = 0;
+        uint16_t scanDuration = 0;
+
+        return otLinkActiveScan(mHost->GetInstance(), scanChannels, scanDuration, &UbusServer::HandleActiveScanResult,
+                                this);
+    });
+}
+
 void UbusServer::HandleActiveScanResult(otActiveScanResult *aResult, void *aContext)
 {
     static_cast<UbusServer *>(aContext)->HandleActiveScanResultDetail(aResult);
@@ -260,35 +627,65 @@ void UbusServer::AppendResult(otError aError, struct ubus_context *aContext, str
 
 void UbusServer::HandleActiveScanResultDetail(otActiveScanResult *aResult)
 {
-    void *jsonList = nullptr;
+    void    *jsonList = nullptr;
+    uint64_t eventNum = 1;
 
     char panidstring[PANID_LENGTH];
     char xpanidstring[XPANID_LENGTH] = "";
 
     if (aResult == nullptr)
     {
-        blobmsg_close_array(&mBuf, sJsonUri);
-        mIfFinishScan = true;
+        blobmsg_close_array(&mScanBuf, mScanList);
+
+        // The ubus context is not thread-safe, so the deferred request is completed on the ubus thread.
+        if (write(mScanDoneFd.fd, &eventNum, sizeof(eventNum)) != sizeof(eventNum))
+        {
+            otbrLogWarning("Failed to signal scan completion: %s", strerror(errno));
+        }
         goto exit;
     }
 
-    jsonList = blobmsg_open_table(&mBuf, nullptr);
+    jsonList = blobmsg_open_table(&mScanBuf, nullptr);
 
-    blobmsg_add_string(&mBuf, "NetworkName", aResult->mNetworkName.m8);
+    blobmsg_add_string(&mScanBuf, "NetworkName", aResult->mNetworkName.m8);
 
     OutputBytes(aResult->mExtendedPanId.m8, OT_EXT_PAN_ID_SIZE, xpanidstring);
-    blobmsg_add_string(&mBuf, "ExtendedPanId", xpanidstring);
+    blobmsg_add_string(&mScanBuf, "ExtendedPanId", xpanidstring);
 
     sprintf(panidstring, "0x%04x", aResult->mPanId);
-    blobmsg_add_string(&mBuf, "PanId", panidstring);
+    blobmsg_add_string(&mScanBuf, "PanId", panidstring);
+
+    blobmsg_add_u32(&mScanBuf, "Channel", aResult->mChannel);
+
+    blobmsg_add_u32(&mScanBuf, "Rssi", aResult->mRssi);
+
+    blobmsg_add_u32(&mScanBuf, "Lqi", aResult->mLqi);
+
+    blobmsg_close_table(&mScanBuf, jsonList);
+
+exit:
+    return;
+}
+
+void UbusServer::HandleScanDone(struct uloop_fd *aFd, unsigned int aEvents)
+{
+    OT_UNUSED_VARIABLE(aFd);
+    OT_UNUSED_VARIABLE(aEvents);
 
-    blobmsg_add_u32(&mBuf, "Channel", aResult->mChannel);
+    GetInstance().HandleScanDoneDetail();
+}
 
-    blobmsg_add_u32(&mBuf, "Rssi", aResult->mRssi);
+void UbusServer::HandleScanDoneDetail(void)
+{
+    uint64_t eventNum;
 
-    blobmsg_add_u32(&mBuf, "Lqi", aResult->mLqi);
+    VerifyOrExit(read(mScanDoneFd.fd, &eventNum, sizeof(eventNum)) == sizeof(eventNum));
+    VerifyOrExit(mScanInProgress);
 
-    blobmsg_close_table(&mBuf, jsonList);
+    blobmsg_add_u16(&mScanBuf, "Error", OT_ERROR_NONE);
+    ubus_send_reply(mContext, &mScanRequest, mScanBuf.head);
+    ubus_complete_deferred_request(mContext, &mScanRequest, UBUS_STATUS_OK);
+    mScanInProgress = false;
 
 exit:
     return;
@@ -313,31 +710,25 @@ int UbusServer::UbusScanHandlerDetail(struct ubus_context      *aContext,
     OT_UNUSED_VARIABLE(aMethod);
     OT_UNUSED_VARIABLE(aMsg);
 
-    otError  error = OT_ERROR_NONE;
-    uint64_t eventNum;
-    ssize_t  retval;
+    otError error = OT_ERROR_NONE;
 
-    blob_buf_init(&mBuf, 0);
-    sJsonUri = blobmsg_open_array(&mBuf, "scan_list");
+    VerifyOrExit(!mScanInProgress, error = OT_ERROR_BUSY);
 
-    mIfFinishScan = 0;
-    sUbusServerInstance->ProcessScan();
+    blob_buf_init(&mScanBuf, 0);
+    mScanList = blobmsg_open_array(&mScanBuf, "scan_list");
 
-    eventNum = 1;
-    retval   = write(sUbusEfd, &eventNum, sizeof(uint64_t));
-    if (retval != sizeof(uint64_t))
-    {
-        error = OT_ERROR_FAILED;
-        goto exit;
-    }
+    SuccessOrExit(error = ProcessScan());
 
-    while (!mIfFinishScan)
-    {
-        sleep(1);
-    }
+    // The reply is sent by HandleScanDoneDetail() once the mainloop reports the end of the scan.
+    ubus_defer_request(aContext, aRequest, &mScanRequest);
+    mScanInProgress = true;
 
 exit:
-    AppendResult(error, aContext, aRequest);
+    if (error != OT_ERROR_NONE)
+    {
+        blob_buf_init(&mBuf, 0);
+        AppendResult(error, aContext, aRequest);
+    }
     return 0;
 }
 
@@ -602,6 +993,15 @@ int UbusServer::UbusInterfaceNameHandler(struct ubus_context      *aContext,
     return GetInstance().UbusGetInformation(aContext, aObj, aRequest, aMethod, aMsg, "interfacename");
 }
 
+int UbusServer::UbusGetManyHandler(struct ubus_context      *aContext,
+                                   struct ubus_object       *aObj,
+                                   struct ubus_request_data *aRequest,
+                                   const char               *aMethod,
+                                   struct blob_attr         *aMsg)
+{
+    return GetInstance().UbusGetManyHandlerDetail(aContext, aObj, aRequest, aMethod, aMsg);
+}
+
 int UbusServer::UbusJoinerAddHandler(struct ubus_context      *aContext,
                                      struct ubus_object       *aObj,
                                      struct ubus_request_data *aRequest,
@@ -675,25 +1075,14 @@ int UbusServer::UbusLeaveHandlerDetail(struct ubus_context      *aContext,
     OT_UNUSED_VARIABLE(aMethod);
     OT_UNUSED_VARIABLE(aMsg);
 
-    otError  error = OT_ERROR_NONE;
-    uint64_t eventNum;
-    ssize_t  retval;
-
-    mHostMutex->lock();
-    otInstanceFactoryReset(mHost->GetInstance());
+    otError error;
 
-    eventNum = 1;
-    retval   = write(sUbusEfd, &eventNum, sizeof(uint64_t));
-    if (retval != sizeof(uint64_t))
-    {
-        error = OT_ERROR_FAILED;
-        goto exit;
-    }
+    error = RunOnMainloop([this](void) {
+        otInstanceFactoryReset(mHost->GetInstance());
+        return OT_ERROR_NONE;
+    });
 
     blob_buf_init(&mBuf, 0);
-
-exit:
-    mHostMutex->unlock();
     AppendResult(error, aContext, aRequest);
     return 0;
 }
@@ -712,21 +1101,22 @@ int UbusServer::UbusThreadHandler(struct ubus_context      *aContext,
 
     blob_buf_init(&mBuf, 0);
 
-    if (!strcmp(aAction, "start"))
-    {
-        mHostMutex->lock();
-        SuccessOrExit(error = otIp6SetEnabled(mHost->GetInstance(), true));
-        SuccessOrExit(error = otThreadSetEnabled(mHost->GetInstance(), true));
-    }
-    else if (!strcmp(aAction, "stop"))
-    {
-        mHostMutex->lock();
-        SuccessOrExit(error = otThreadSetEnabled(mHost->GetInstance(), false));
-        SuccessOrExit(error = otIp6SetEnabled(mHost->GetInstance(), false));
-    }
+    error = RunOnMainloop([&](void) {
+        if (!strcmp(aAction, "start"))
+        {
+            SuccessOrExit(error = otIp6SetEnabled(mHost->GetInstance(), true));
+            SuccessOrExit(error = otThreadSetEnabled(mHost->GetInstance(), true));
+        }
+        else if (!strcmp(aAction, "stop"))
+        {
+            SuccessOrExit(error = otThreadSetEnabled(mHost->GetInstance(), false));
+            SuccessOrExit(error = otIp6SetEnabled(mHost->GetInstance(), false));
+        }
+
+    exit:
+        return error;
+    });
 
-exit:
-    mHostMutex->unlock();
     AppendResult(error, aContext, aRequest);
     return 0;
 }
@@ -741,6 +1131,22 @@ int UbusServer::UbusParentHandlerDetail(struct ubus_context      *aContext,
     OT_UNUSED_VARIABLE(aMethod);
     OT_UNUSED_VARIABLE(aMsg);
 
+    otError          error = OT_ERROR_NONE;
+    struct blob_buf *buf;
+
+    VerifyOrExit(!SendCachedReply(kCachedReplyParent, aContext, aRequest, error));
+
+    buf   = BeginCachedReply(kCachedReplyParent);
+    error = RunOnMainloop([&](void) { return AppendParentInfo(buf); });
+
+    SendCachedReply(kCachedReplyParent, error, aContext, aRequest);
+
+exit:
+    return error;
+}
+
+otError UbusServer::AppendParentInfo(struct blob_buf *aBuf)
+{
     otError      error = OT_ERROR_NONE;
     otRouterInfo parentInfo;
     char         extAddress[XPANID_LENGTH] = "";
@@ -748,32 +1154,27 @@ int UbusServer::UbusParentHandlerDetail(struct ubus_context      *aContext,
     void        *jsonList                  = nullptr;
     void        *jsonArray                 = nullptr;
 
-    blob_buf_init(&mBuf, 0);
-
-    mHostMutex->lock();
     SuccessOrExit(error = otThreadGetParentInfo(mHost->GetInstance(), &parentInfo));
 
-    jsonArray = blobmsg_open_array(&mBuf, "parent_list");
-    jsonList  = blobmsg_open_table(&mBuf, "parent");
-    blobmsg_add_string(&mBuf, "Role", "R");
+    jsonArray = blobmsg_open_array(aBuf, "parent_list");
+    jsonList  = blobmsg_open_table(aBuf, "parent");
+    blobmsg_add_string(aBuf, "Role", "R");
 
     sprintf(transfer, "0x%04x", parentInfo.mRloc16);
-    blobmsg_add_string(&mBuf, "Rloc16", transfer);
+    blobmsg_add_string(aBuf, "Rloc16", transfer);
 
     sprintf(transfer, "%3d", parentInfo.mAge);
-    blobmsg_add_string(&mBuf, "Age", transfer);
+    blobmsg_add_string(aBuf, "Age", transfer);
 
     OutputBytes(parentInfo.mExtAddress.m8, sizeof(parentInfo.mExtAddress.m8), extAddress);
-    blobmsg_add_string(&mBuf, "ExtAddress", extAddress);
+    blobmsg_add_string(aBuf, "ExtAddress", extAddress);
 
-    blobmsg_add_u16(&mBuf, "LinkQualityIn", parentInfo.mLinkQualityIn);
+    blobmsg_add_u16(aBuf, "LinkQualityIn", parentInfo.mLinkQualityIn);
 
-    blobmsg_close_table(&mBuf, jsonList);
-    blobmsg_close_array(&mBuf, jsonArray);
+    blobmsg_close_table(aBuf, jsonList);
+    blobmsg_close_array(aBuf, jsonArray);
 
 exit:
-    mHostMutex->unlock();
-    AppendResult(error, aContext, aRequest);
     return error;
 }
 
@@ -787,7 +1188,25 @@ int UbusServer::UbusNeighborHandlerDetail(struct ubus_context      *aContext,
     OT_UNUSED_VARIABLE(aMethod);
     OT_UNUSED_VARIABLE(aMsg);
 
-    otError                error = OT_ERROR_NONE;
+    otError          error = OT_ERROR_NONE;
+    struct blob_buf *buf;
+
+    VerifyOrExit(!SendCachedReply(kCachedReplyNeighbor, aContext, aRequest, error));
+
+    buf   = BeginCachedReply(kCachedReplyNeighbor);
+    error = RunOnMainloop([&](void) {
+        AppendNeighborList(buf);
+        return OT_ERROR_NONE;
+    });
+
+    SendCachedReply(kCachedReplyNeighbor, error, aContext, aRequest);
+
+exit:
+    return 0;
+}
+
+void UbusServer::AppendNeighborList(struct blob_buf *aBuf)
+{
     otNeighborInfo         neighborInfo;
     otNeighborInfoIterator iterator                  = OT_NEIGHBOR_INFO_ITERATOR_INIT;
     char                   transfer[XPANID_LENGTH]   = "";
@@ -795,28 +1214,25 @@ int UbusServer::UbusNeighborHandlerDetail(struct ubus_context      *aContext,
     char                   mode[5]                   = "";
     char                   extAddress[XPANID_LENGTH] = "";
 
-    blob_buf_init(&mBuf, 0);
-
-    sJsonUri = blobmsg_open_array(&mBuf, "neighbor_list");
+    sJsonUri = blobmsg_open_array(aBuf, "neighbor_list");
 
-    mHostMutex->lock();
     while (otThreadGetNextNeighborInfo(mHost->GetInstance(), &iterator, &neighborInfo) == OT_ERROR_NONE)
     {
-        jsonList = blobmsg_open_table(&mBuf, nullptr);
+        jsonList = blobmsg_open_table(aBuf, nullptr);
 
-        blobmsg_add_string(&mBuf, "Role", neighborInfo.mIsChild ? "C" : "R");
+        blobmsg_add_string(aBuf, "Role", neighborInfo.mIsChild ? "C" : "R");
 
         sprintf(transfer, "0x%04x", neighborInfo.mRloc16);
-        blobmsg_add_string(&mBuf, "Rloc16", transfer);
+        blobmsg_add_string(aBuf, "Rloc16", transfer);
 
         sprintf(transfer, "%3d", neighborInfo.mAge);
-        blobmsg_add_string(&mBuf, "Age", transfer);
+        blobmsg_add_string(aBuf, "Age", transfer);
 
         sprintf(transfer, "%8d", neighborInfo.mAverageRssi);
-        blobmsg_add_string(&mBuf, "AvgRssi", transfer);
+        blobmsg_add_string(aBuf, "AvgRssi", transfer);
 
         sprintf(transfer, "%9d", neighborInfo.mLastRssi);
-        blobmsg_add_string(&mBuf, "LastRssi", transfer);
+        blobmsg_add_string(aBuf, "LastRssi", transfer);
 
         if (neighborInfo.mRxOnWhenIdle)
         {
@@ -832,25 +1248,20 @@ int UbusServer::UbusNeighborHandlerDetail(struct ubus_context      *aContext,
         {
             strcat(mode, "n");
         }
-        blobmsg_add_string(&mBuf, "Mode", mode);
+        blobmsg_add_string(aBuf, "Mode", mode);
 
         OutputBytes(neighborInfo.mExtAddress.m8, sizeof(neighborInfo.mExtAddress.m8), extAddress);
-        blobmsg_add_string(&mBuf, "ExtAddress", extAddress);
+        blobmsg_add_string(aBuf, "ExtAddress", extAddress);
 
-        blobmsg_add_u16(&mBuf, "LinkQualityIn", neighborInfo.mLinkQualityIn);
+        blobmsg_add_u16(aBuf, "LinkQualityIn", neighborInfo.mLinkQualityIn);
 
-        blobmsg_close_table(&mBuf, jsonList);
+        blobmsg_close_table(aBuf, jsonList);
 
         memset(mode, 0, sizeof(mode));
         memset(extAddress, 0, sizeof(extAddress));
     }
 
-    blobmsg_close_array(&mBuf, sJsonUri);
-
-    mHostMutex->unlock();
-
-    AppendResult(error, aContext, aRequest);
-    return 0;
+    blobmsg_close_array(aBuf, sJsonUri);
 }
 
 int UbusServer::UbusMgmtset(struct ubus_context      *aContext,
@@ -870,7 +1281,7 @@ int UbusServer::UbusMgmtset(struct ubus_context      *aContext,
     long                 value;
     int                  length = 0;
 
-    SuccessOrExit(error = otDatasetGetActive(mHost->GetInstance(), &dataset));
+    SuccessOrExit(error = RunOnMainloop([&](void) { return otDatasetGetActive(mHost->GetInstance(), &dataset); }));
 
     blobmsg_parse(mgmtsetPolicy, MGMTSET_MAX, tb, blob_data(aMsg), blob_len(aMsg));
     if (tb[NETWORKKEY] != nullptr)
@@ -919,13 +1330,15 @@ int UbusServer::UbusMgmtset(struct ubus_context      *aContext,
         length = 0;
     }
     dataset.mActiveTimestamp.mSeconds++;
-    if (otCommissionerGetState(mHost->GetInstance()) == OT_COMMISSIONER_STATE_DISABLED)
-    {
-        otCommissionerStop(mHost->GetInstance());
-    }
-    SuccessOrExit(error = otDatasetSendMgmtActiveSet(mHost->GetInstance(), &dataset, tlvs, static_cast<uint8_t>(length),
-                                                     /* aCallback */ nullptr,
-                                                     /* aContext */ nullptr));
+    error = RunOnMainloop([&](void) {
+        if (otCommissionerGetState(mHost->GetInstance()) == OT_COMMISSIONER_STATE_DISABLED)
+        {
+            otCommissionerStop(mHost->GetInstance());
+        }
+        return otDatasetSendMgmtActiveSet(mHost->GetInstance(), &dataset, tlvs, static_cast<uint8_t>(length),
+                                          /* aCallback */ nullptr,
+                                          /* aContext */ nullptr);
+    });
 exit:
     AppendResult(error, aContext, aRequest);
     return 0;
@@ -944,73 +1357,74 @@ int UbusServer::UbusCommissioner(struct ubus_context      *aContext,
 
     otError error = OT_ERROR_NONE;
 
-    mHostMutex->lock();
-
-    if (!strcmp(aAction, "start"))
-    {
-        if (otCommissionerGetState(mHost->GetInstance()) == OT_COMMISSIONER_STATE_DISABLED)
+    error = RunOnMainloop([&](void) {
+        if (!strcmp(aAction, "start"))
         {
-            error = otCommissionerStart(mHost->GetInstance(), &UbusServer::HandleStateChanged,
-                                        &UbusServer::HandleJoinerEvent, this);
+            if (otCommissionerGetState(mHost->GetInstance()) == OT_COMMISSIONER_STATE_DISABLED)
+            {
+                error = otCommissionerStart(mHost->GetInstance(), &UbusServer::HandleStateChanged,
+                                            &UbusServer::HandleJoinerEvent, this);
+            }
         }
-    }
-    else if (!strcmp(aAction, "joineradd"))
-    {
-        struct blob_attr   *tb[ADD_JOINER_MAX];
-        otExtAddress        addr;
-        const otExtAddress *addrPtr = nullptr;
-        char               *pskd    = nullptr;
-
-        blobmsg_parse(addJoinerPolicy, ADD_JOINER_MAX, tb, blob_data(aMsg), blob_len(aMsg));
-        if (tb[PSKD] != nullptr)
+        else if (!strcmp(aAction, "joineradd"))
         {
-            pskd = blobmsg_get_string(tb[PSKD]);
-        }
-        if (tb[EUI64] != nullptr)
-        {
-            if (!strcmp(blobmsg_get_string(tb[EUI64]), "*"))
+            struct blob_attr   *tb[ADD_JOINER_MAX];
+            otExtAddress        addr;
+            const otExtAddress *addrPtr = nullptr;
+            char               *pskd    = nullptr;
+
+            blobmsg_parse(addJoinerPolicy, ADD_JOINER_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+            if (tb[PSKD] != nullptr)
             {
-                addrPtr = nullptr;
-                memset(&addr, 0, sizeof(addr));
+                pskd = blobmsg_get_string(tb[PSKD]);
             }
-            else
+            if (tb[EUI64] != nullptr)
             {
-                VerifyOrExit(Hex2Bin(blobmsg_get_string(tb[EUI64]), addr.m8, sizeof(addr)) == sizeof(addr),
-                             error = OT_ERROR_PARSE);
-                addrPtr = &addr;
+                if (!strcmp(blobmsg_get_string(tb[EUI64]), "*"))
+                {
+                    addrPtr = nullptr;
+                    memset(&addr, 0, sizeof(addr));
+                }
+                else
+                {
+                    VerifyOrExit(Hex2Bin(blobmsg_get_string(tb[EUI64]), addr.m8, sizeof(addr)) == sizeof(addr),
+                                 error = OT_ERROR_PARSE);
+                    addrPtr = &addr;
+                }
             }
-        }
 
-        unsigned long timeout = kDefaultJoinerTimeout;
-        SuccessOrExit(error =
-                          otCommissionerAddJoiner(mHost->GetInstance(), addrPtr, pskd, static_cast<uint32_t>(timeout)));
-    }
-    else if (!strcmp(aAction, "joinerremove"))
-    {
-        struct blob_attr   *tb[SET_NETWORK_MAX];
-        otExtAddress        addr;
-        const otExtAddress *addrPtr = nullptr;
-
-        blobmsg_parse(removeJoinerPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
-        if (tb[SETNETWORK] != nullptr)
+            unsigned long timeout = kDefaultJoinerTimeout;
+            SuccessOrExit(error = otCommissionerAddJoiner(mHost->GetInstance(), addrPtr, pskd,
+                                                          static_cast<uint32_t>(timeout)));
+        }
+        else if (!strcmp(aAction, "joinerremove"))
         {
-            if (strcmp(blobmsg_get_string(tb[SETNETWORK]), "*") == 0)
-            {
-                addrPtr = nullptr;
-            }
-            else
+            struct blob_attr   *tb[SET_NETWORK_MAX];
+            otExtAddress        addr;
+            const otExtAddress *addrPtr = nullptr;
+
+            blobmsg_parse(removeJoinerPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+            if (tb[SETNETWORK] != nullptr)
             {
-                VerifyOrExit(Hex2Bin(blobmsg_get_string(tb[SETNETWORK]), addr.m8, sizeof(addr)) == sizeof(addr),
-                             error = OT_ERROR_PARSE);
-                addrPtr = &addr;
+                if (strcmp(blobmsg_get_string(tb[SETNETWORK]), "*") == 0)
+                {
+                    addrPtr = nullptr;
+                }
+                else
+                {
+                    VerifyOrExit(Hex2Bin(blobmsg_get_string(tb[SETNETWORK]), addr.m8, sizeof(addr)) == sizeof(addr),
+                                 error = OT_ERROR_PARSE);
+                    addrPtr = &addr;
+                }
             }
+
+            SuccessOrExit(error = otCommissionerRemoveJoiner(mHost->GetInstance(), addrPtr));
         }
 
-        SuccessOrExit(error = otCommissionerRemoveJoiner(mHost->GetInstance(), addrPtr));
-    }
+    exit:
+        return error;
+    });
 
-exit:
-    mHostMutex->unlock();
     blob_buf_init(&mBuf, 0);
     AppendResult(error, aContext, aRequest);
     return 0;
@@ -1050,7 +1464,20 @@ void UbusServer::HandleJoinerEvent(otCommissionerJoinerEvent aEvent,
                                    const otExtAddress       *aJoinerId)
 {
     OT_UNUSED_VARIABLE(aJoinerInfo);
-    OT_UNUSED_VARIABLE(aJoinerId);
+
+    Event event;
+
+    memset(&event, 0, sizeof(event));
+    event.mType        = kEventJoiner;
+    event.mJoinerEvent = aEvent;
+    event.mHasJoinerId = (aJoinerId != nullptr);
+
+    if (aJoinerId != nullptr)
+    {
+        event.mJoinerId = *aJoinerId;
+    }
+
+    QueueEvent(event);
 
     switch (aEvent)
     {
@@ -1072,238 +1499,374 @@ void UbusServer::HandleJoinerEvent(otCommissionerJoinerEvent aEvent,
     }
 }
 
-int UbusServer::UbusGetInformation(struct ubus_context      *aContext,
-                                   struct ubus_object       *aObj,
-                                   struct ubus_request_data *aRequest,
-                                   const char               *aMethod,
-                                   struct blob_attr         *aMsg,
-                                   const char               *aAction)
+bool UbusServer::AppendSnapshotInformation(struct blob_buf                 *aBuf,
+                                           const Ncp::NetworkStateSnapshot &aSnapshot,
+                                           const char                      *aAction,
+                                           otError                         &aError)
 {
-    OT_UNUSED_VARIABLE(aObj);
-    OT_UNUSED_VARIABLE(aMethod);
-    OT_UNUSED_VARIABLE(aMsg);
-
-    otError error = OT_ERROR_NONE;
-
-    blob_buf_init(&mBuf, 0);
+    bool found = true;
 
-    mHostMutex->lock();
     if (!strcmp(aAction, "networkname"))
-        blobmsg_add_string(&mBuf, "NetworkName", otThreadGetNetworkName(mHost->GetInstance()));
+        blobmsg_add_string(aBuf, "NetworkName", aSnapshot.mNetworkName);
     else if (!strcmp(aAction, "interfacename"))
     {
-        blobmsg_add_string(&mBuf, "InterfaceName", mHost->GetInterfaceName());
+        blobmsg_add_string(aBuf, "InterfaceName", mHost->GetInterfaceName());
     }
     else if (!strcmp(aAction, "state"))
     {
         char state[10];
-        GetState(mHost->GetInstance(), state);
-        blobmsg_add_string(&mBuf, "State", state);
+        GetState(aSnapshot.mDeviceRole, state);
+        blobmsg_add_string(aBuf, "State", state);
     }
     else if (!strcmp(aAction, "channel"))
-        blobmsg_add_u32(&mBuf, "Channel", otLinkGetChannel(mHost->GetInstance()));
+        blobmsg_add_u32(aBuf, "Channel", aSnapshot.mChannel);
     else if (!strcmp(aAction, "panid"))
     {
         char panIdString[PANID_LENGTH];
-        sprintf(panIdString, "0x%04x", otLinkGetPanId(mHost->GetInstance()));
-        blobmsg_add_string(&mBuf, "PanId", panIdString);
+        sprintf(panIdString, "0x%04x", aSnapshot.mPanId);
+        blobmsg_add_string(aBuf, "PanId", panIdString);
     }
     else if (!strcmp(aAction, "rloc16"))
     {
         char rloc[PANID_LENGTH];
-        sprintf(rloc, "0x%04x", otThreadGetRloc16(mHost->GetInstance()));
-        blobmsg_add_string(&mBuf, "rloc16", rloc);
+        sprintf(rloc, "0x%04x", aSnapshot.mRloc16);
+        blobmsg_add_string(aBuf, "rloc16", rloc);
     }
-    else if (!strcmp(aAction, "networkkey"))
+    else if (!strcmp(aAction, "extpanid"))
     {
-        char         outputKey[NETWORKKEY_LENGTH] = "";
-        otNetworkKey key;
-
-        otThreadGetNetworkKey(mHost->GetInstance(), &key);
-        OutputBytes(key.m8, OT_NETWORK_KEY_SIZE, outputKey);
-        blobmsg_add_string(&mBuf, "Networkkey", outputKey);
+        char outputExtPanId[XPANID_LENGTH] = "";
+        OutputBytes(aSnapshot.mExtPanId.m8, OT_EXT_PAN_ID_SIZE, outputExtPanId);
+        blobmsg_add_string(aBuf, "ExtPanId", outputExtPanId);
     }
-    else if (!strcmp(aAction, "pskc"))
+    else if (!strcmp(aAction, "partitionid"))
     {
-        char   outputPskc[NETWORKKEY_LENGTH] = "";
-        otPskc pskc;
-
-        otThreadGetPskc(mHost->GetInstance(), &pskc);
-        OutputBytes(pskc.m8, OT_PSKC_MAX_SIZE, outputPskc);
-        blobmsg_add_string(&mBuf, "pskc", outputPskc);
+        blobmsg_add_u32(aBuf, "Partitionid", aSnapshot.mPartitionId);
     }
-    else if (!strcmp(aAction, "extpanid"))
+    else if (!strcmp(aAction, "leaderdata"))
     {
-        char           outputExtPanId[XPANID_LENGTH] = "";
-        const uint8_t *extPanId = reinterpret_cast<const uint8_t *>(otThreadGetExtendedPanId(mHost->GetInstance()));
-        OutputBytes(extPanId, OT_EXT_PAN_ID_SIZE, outputExtPanId);
-        blobmsg_add_string(&mBuf, "ExtPanId", outputExtPanId);
+        const otLeaderData &leaderData = aSnapshot.mLeaderData;
+
+        SuccessOrExit(aError = aSnapshot.mLeaderDataError);
+
+        sJsonUri = blobmsg_open_table(aBuf, "leaderdata");
+
+        blobmsg_add_u32(aBuf, "PartitionId", leaderData.mPartitionId);
+        blobmsg_add_u32(aBuf, "Weighting", leaderData.mWeighting);
+        blobmsg_add_u32(aBuf, "DataVersion", leaderData.mDataVersion);
+        blobmsg_add_u32(aBuf, "StableDataVersion", leaderData.mStableDataVersion);
+        blobmsg_add_u32(aBuf, "LeaderRouterId", leaderData.mLeaderRouterId);
+
+        blobmsg_close_table(aBuf, sJsonUri);
     }
-    else if (!strcmp(aAction, "mode"))
+    else
     {
-        otLinkModeConfig linkMode;
-        char             mode[5] = "";
+        found = false;
+    }
 
-        memset(&linkMode, 0, sizeof(otLinkModeConfig));
+exit:
+    return found;
+}
 
-        linkMode = otThreadGetLinkMode(mHost->GetInstance());
+void UbusServer::AppendMode(struct blob_buf *aBuf)
+{
+    otLinkModeConfig linkMode;
+    char             mode[5] = "";
 
-        if (linkMode.mRxOnWhenIdle)
-        {
-            strcat(mode, "r");
-        }
+    memset(&linkMode, 0, sizeof(otLinkModeConfig));
 
-        if (linkMode.mDeviceType)
-        {
-            strcat(mode, "d");
-        }
+    linkMode = otThreadGetLinkMode(mHost->GetInstance());
 
-        if (linkMode.mNetworkData)
-        {
-            strcat(mode, "n");
-        }
-        blobmsg_add_string(&mBuf, "Mode", mode);
+    if (linkMode.mRxOnWhenIdle)
+    {
+        strcat(mode, "r");
     }
-    else if (!strcmp(aAction, "partitionid"))
+
+    if (linkMode.mDeviceType)
     {
-        blobmsg_add_u32(&mBuf, "Partitionid", otThreadGetPartitionId(mHost->GetInstance()));
+        strcat(mode, "d");
     }
-    else if (!strcmp(aAction, "leaderdata"))
+
+    if (linkMode.mNetworkData)
     {
-        otLeaderData leaderData;
+        strcat(mode, "n");
+    }
+    blobmsg_add_string(aBuf, "Mode", mode);
+}
+
+void UbusServer::AppendJoinerList(struct blob_buf *aBuf)
+{
+    void        *jsonTable = nullptr;
+    void        *jsonArray = nullptr;
+    otJoinerInfo joinerInfo;
+    uint16_t     iterator        = 0;
+    int          joinerNum       = 0;
+    char         eui64[EXTPANID] = "";
 
-        SuccessOrExit(error = otThreadGetLeaderData(mHost->GetInstance(), &leaderData));
+    jsonArray = blobmsg_open_array(aBuf, "joinerList");
+    while (otCommissionerGetNextJoinerInfo(mHost->GetInstance(), &iterator, &joinerInfo) == OT_ERROR_NONE)
+    {
+        memset(eui64, 0, sizeof(eui64));
 
-        sJsonUri = blobmsg_open_table(&mBuf, "leaderdata");
+        jsonTable = blobmsg_open_table(aBuf, nullptr);
 
-        blobmsg_add_u32(&mBuf, "PartitionId", leaderData.mPartitionId);
-        blobmsg_add_u32(&mBuf, "Weighting", leaderData.mWeighting);
-        blobmsg_add_u32(&mBuf, "DataVersion", leaderData.mDataVersion);
-        blobmsg_add_u32(&mBuf, "StableDataVersion", leaderData.mStableDataVersion);
-        blobmsg_add_u32(&mBuf, "LeaderRouterId", leaderData.mLeaderRouterId);
+        blobmsg_add_string(aBuf, "pskd", joinerInfo.mPskd.m8);
 
-        blobmsg_close_table(&mBuf, sJsonUri);
-    }
-    else if (!strcmp(aAction, "networkdata"))
-    {
-        ubus_send_reply(aContext, aRequest, mNetworkdataBuf.head);
-        if (time(nullptr) - mSecond > 10)
+        switch (joinerInfo.mType)
         {
-            static constexpr uint16_t kMaxTlvs = 35;
+        case OT_JOINER_INFO_TYPE_ANY:
+            blobmsg_add_u16(aBuf, "isAny", 1);
+            break;
+        case OT_JOINER_INFO_TYPE_EUI64:
+            blobmsg_add_u16(aBuf, "isAny", 0);
+            OutputBytes(joinerInfo.mSharedId.mEui64.m8, sizeof(joinerInfo.mSharedId.mEui64.m8), eui64);
+            blobmsg_add_string(aBuf, "eui64", eui64);
+            break;
+        case OT_JOINER_INFO_TYPE_DISCERNER:
+            blobmsg_add_u16(aBuf, "isAny", 0);
+            blobmsg_add_u64(aBuf, "discernerValue", joinerInfo.mSharedId.mDiscerner.mValue);
+            blobmsg_add_u16(aBuf, "discernerLength", joinerInfo.mSharedId.mDiscerner.mLength);
+            break;
+        }
+
+        blobmsg_close_table(aBuf, jsonTable);
 
-            struct otIp6Address address;
-            uint8_t             tlvTypes[kMaxTlvs];
-            uint8_t             count             = 0;
-            char                multicastAddr[10] = "ff03::2";
+        joinerNum++;
+    }
+    blobmsg_close_array(aBuf, jsonArray);
 
-            blob_buf_init(&mNetworkdataBuf, 0);
+    blobmsg_add_u32(aBuf, "joinernum", joinerNum);
+}
 
-            SuccessOrExit(error = otIp6AddressFromString(multicastAddr, &address));
+static bool IsMainloopField(const char *aField)
+{
+    static const char *const kMainloopFields[] = {"mode", "joinernum", "neighbor", "parent"};
 
-            tlvTypes[count++] = static_cast<uint8_t>(OT_NETWORK_DIAGNOSTIC_TLV_ROUTE);
-            tlvTypes[count++] = static_cast<uint8_t>(OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE);
+    bool found = false;
 
-            sBufNum = 0;
-            otThreadSendDiagnosticGet(mHost->GetInstance(), &address, tlvTypes, count,
-                                      &UbusServer::HandleDiagnosticGetResponse, this);
-            mSecond = time(nullptr);
+    for (const char *field : kMainloopFields)
+    {
+        if (!strcmp(aField, field))
+        {
+            found = true;
+            break;
         }
-        goto exit;
     }
-    else if (!strcmp(aAction, "joinernum"))
-    {
-        void        *jsonTable = nullptr;
-        void        *jsonArray = nullptr;
-        otJoinerInfo joinerInfo;
-        uint16_t     iterator        = 0;
-        int          joinerNum       = 0;
-        char         eui64[EXTPANID] = "";
 
-        blob_buf_init(&mBuf, 0);
+    return found;
+}
 
-        jsonArray = blobmsg_open_array(&mBuf, "joinerList");
-        while (otCommissionerGetNextJoinerInfo(mHost->GetInstance(), &iterator, &joinerInfo) == OT_ERROR_NONE)
-        {
-            memset(eui64, 0, sizeof(eui64));
+int UbusServer::UbusGetManyHandlerDetail(struct ubus_context      *aContext,
+                                         struct ubus_object       *aObj,
+                                         struct ubus_request_data *aRequest,
+                                         const char               *aMethod,
+                                         struct blob_attr         *aMsg)
+{
+    OT_UNUSED_VARIABLE(aObj);
+    OT_UNUSED_VARIABLE(aMethod);
 
-            jsonTable = blobmsg_open_table(&mBuf, nullptr);
+    static const char *const kDefaultFields[] = {"networkname", "interfacename", "state",       "channel",   "panid",
+                                                 "rloc16",      "extpanid",      "partitionid", "leaderdata"};
 
-            blobmsg_add_string(&mBuf, "pskd", joinerInfo.mPskd.m8);
+    otError                   error = OT_ERROR_NONE;
+    otError                   fieldError;
+    struct blob_attr         *tb[GET_MANY_MAX];
+    struct blob_attr         *field;
+    Ncp::NetworkStateSnapshot snapshot = mHost->GetNetworkState();
+    std::vector<const char *> mainloopFields;
+    int                       rem;
 
-            switch (joinerInfo.mType)
-            {
-            case OT_JOINER_INFO_TYPE_ANY:
-                blobmsg_add_u16(&mBuf, "isAny", 1);
-                break;
-            case OT_JOINER_INFO_TYPE_EUI64:
-                blobmsg_add_u16(&mBuf, "isAny", 0);
-                OutputBytes(joinerInfo.mSharedId.mEui64.m8, sizeof(joinerInfo.mSharedId.mEui64.m8), eui64);
-                blobmsg_add_string(&mBuf, "eui64", eui64);
-                break;
-            case OT_JOINER_INFO_TYPE_DISCERNER:
-                blobmsg_add_u16(&mBuf, "isAny", 0);
-                blobmsg_add_u64(&mBuf, "discernerValue", joinerInfo.mSharedId.mDiscerner.mValue);
-                blobmsg_add_u16(&mBuf, "discernerLength", joinerInfo.mSharedId.mDiscerner.mLength);
-                break;
-            }
+    blob_buf_init(&mBuf, 0);
 
-            blobmsg_close_table(&mBuf, jsonTable);
+    blobmsg_parse(getManyPolicy, GET_MANY_MAX, tb, blob_data(aMsg), blob_len(aMsg));
 
-            joinerNum++;
+    // Fields which are unavailable in the current state, e.g. leaderdata while detached, are left out of the reply.
+    if (tb[FIELDS] == nullptr)
+    {
+        for (const char *name : kDefaultFields)
+        {
+            AppendSnapshotInformation(&mBuf, snapshot, name, fieldError);
         }
-        blobmsg_close_array(&mBuf, jsonArray);
-
-        blobmsg_add_u32(&mBuf, "joinernum", joinerNum);
+        ExitNow();
     }
-    else if (!strcmp(aAction, "macfilterstate"))
+
+    blobmsg_for_each_attr(field, tb[FIELDS], rem)
     {
-        otMacFilterAddressMode mode = otLinkFilterGetAddressMode(mHost->GetInstance());
+        const char *name;
 
-        blob_buf_init(&mBuf, 0);
+        VerifyOrExit(blobmsg_type(field) == BLOBMSG_TYPE_STRING, error = OT_ERROR_INVALID_ARGS);
+        name = blobmsg_get_string(field);
 
-        if (mode == OT_MAC_FILTER_ADDRESS_MODE_DISABLED)
-        {
-            blobmsg_add_string(&mBuf, "state", "disable");
-        }
-        else if (mode == OT_MAC_FILTER_ADDRESS_MODE_ALLOWLIST)
+        if (!AppendSnapshotInformation(&mBuf, snapshot, name, fieldError))
         {
-            blobmsg_add_string(&mBuf, "state", "allowlist");
-        }
-        else if (mode == OT_MAC_FILTER_ADDRESS_MODE_DENYLIST)
-        {
-            blobmsg_add_string(&mBuf, "state", "denylist");
-        }
-        else
-        {
-            blobmsg_add_string(&mBuf, "state", "error");
+            VerifyOrExit(IsMainloopField(name), error = OT_ERROR_INVALID_ARGS);
+            mainloopFields.push_back(name);
         }
     }
-    else if (!strcmp(aAction, "macfilteraddr"))
-    {
-        otMacFilterEntry    entry;
-        otMacFilterIterator iterator = OT_MAC_FILTER_ITERATOR_INIT;
-
-        blob_buf_init(&mBuf, 0);
 
-        sJsonUri = blobmsg_open_array(&mBuf, "addrlist");
+    VerifyOrExit(!mainloopFields.empty());
 
-        while (otLinkFilterGetNextAddress(mHost->GetInstance(), &iterator, &entry) == OT_ERROR_NONE)
+    // All fields reading the OpenThread instance share a single mainloop round trip.
+    error = RunOnMainloop([&](void) {
+        for (const char *name : mainloopFields)
         {
-            char extAddress[XPANID_LENGTH] = "";
-            OutputBytes(entry.mExtAddress.m8, sizeof(entry.mExtAddress.m8), extAddress);
-            blobmsg_add_string(&mBuf, "addr", extAddress);
+            if (!strcmp(name, "mode"))
+            {
+                AppendMode(&mBuf);
+            }
+            else if (!strcmp(name, "joinernum"))
+            {
+                AppendJoinerList(&mBuf);
+            }
+            else if (!strcmp(name, "neighbor"))
+            {
+                AppendNeighborList(&mBuf);
+            }
+            else if (!strcmp(name, "parent"))
+            {
+                fieldError = AppendParentInfo(&mBuf);
+            }
         }
 
-        blobmsg_close_array(&mBuf, sJsonUri);
-    }
-    else
+        return OT_ERROR_NONE;
+    });
+
+exit:
+    AppendResult(error, aContext, aRequest);
+    return 0;
+}
+
+int UbusServer::UbusGetInformation(struct ubus_context      *aContext,
+                                   struct ubus_object       *aObj,
+                                   struct ubus_request_data *aRequest,
+                                   const char               *aMethod,
+                                   struct blob_attr         *aMsg,
+                                   const char               *aAction)
+{
+    OT_UNUSED_VARIABLE(aObj);
+    OT_UNUSED_VARIABLE(aMethod);
+    OT_UNUSED_VARIABLE(aMsg);
+
+    otError                   error    = OT_ERROR_NONE;
+    bool                      replied  = false;
+    Ncp::NetworkStateSnapshot snapshot = mHost->GetNetworkState();
+
+    blob_buf_init(&mBuf, 0);
+
+    // Status queries are answered from the snapshot, the others run on the mainloop.
+    if (!AppendSnapshotInformation(&mBuf, snapshot, aAction, error))
     {
-        perror("invalid argument in get information ubus\n");
+        error = RunOnMainloop([&](void) {
+            if (!strcmp(aAction, "networkkey"))
+            {
+                char         outputKey[NETWORKKEY_LENGTH] = "";
+                otNetworkKey key;
+
+                otThreadGetNetworkKey(mHost->GetInstance(), &key);
+                OutputBytes(key.m8, OT_NETWORK_KEY_SIZE, outputKey);
+                blobmsg_add_string(&mBuf, "Networkkey", outputKey);
+            }
+            else if (!strcmp(aAction, "pskc"))
+            {
+                char   outputPskc[NETWORKKEY_LENGTH] = "";
+                otPskc pskc;
+
+                otThreadGetPskc(mHost->GetInstance(), &pskc);
+                OutputBytes(pskc.m8, OT_PSKC_MAX_SIZE, outputPskc);
+                blobmsg_add_string(&mBuf, "pskc", outputPskc);
+            }
+            else if (!strcmp(aAction, "mode"))
+            {
+                AppendMode(&mBuf);
+            }
+            else if (!strcmp(aAction, "networkdata"))
+            {
+                // Sent from the mainloop because the diagnostic responses fill the buffer on the mainloop, the
+                // ubus thread is blocked meanwhile.
+                ubus_send_reply(aContext, aRequest, mNetworkdataBuf.head);
+                replied = true;
+                if (time(nullptr) - mSecond > 10)
+                {
+                    static constexpr uint16_t kMaxTlvs = 35;
+
+                    struct otIp6Address address;
+                    uint8_t             tlvTypes[kMaxTlvs];
+                    uint8_t             count             = 0;
+                    char                multicastAddr[10] = "ff03::2";
+
+                    blob_buf_init(&mNetworkdataBuf, 0);
+
+                    SuccessOrExit(error = otIp6AddressFromString(multicastAddr, &address));
+
+                    tlvTypes[count++] = static_cast<uint8_t>(OT_NETWORK_DIAGNOSTIC_TLV_ROUTE);
+                    tlvTypes[count++] = static_cast<uint8_t>(OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE);
+
+                    sBufNum = 0;
+                    otThreadSendDiagnosticGet(mHost->GetInstance(), &address, tlvTypes, count,
+                                              &UbusServer::HandleDiagnosticGetResponse, this);
+                    mSecond = time(nullptr);
+                }
+            }
+            else if (!strcmp(aAction, "joinernum"))
+            {
+                blob_buf_init(&mBuf, 0);
+                AppendJoinerList(&mBuf);
+            }
+            else if (!strcmp(aAction, "macfilterstate"))
+            {
+                otMacFilterAddressMode mode = otLinkFilterGetAddressMode(mHost->GetInstance());
+
+                blob_buf_init(&mBuf, 0);
+
+                if (mode == OT_MAC_FILTER_ADDRESS_MODE_DISABLED)
+                {
+                    blobmsg_add_string(&mBuf, "state", "disable");
+                }
+                else if (mode == OT_MAC_FILTER_ADDRESS_MODE_ALLOWLIST)
+                {
+                    blobmsg_add_string(&mBuf, "state", "allowlist");
+                }
+                else if (mode == OT_MAC_FILTER_ADDRESS_MODE_DENYLIST)
+                {
+                    blobmsg_add_string(&mBuf, "state", "denylist");
+                }
+                else
+                {
+                    blobmsg_add_string(&mBuf, "state", "error");
+                }
+            }
+            else if (!strcmp(aAction, "macfilteraddr"))
+            {
+                otMacFilterEntry    entry;
+                otMacFilterIterator iterator = OT_MAC_FILTER_ITERATOR_INIT;
+
+                blob_buf_init(&mBuf, 0);
+
+                sJsonUri = blobmsg_open_array(&mBuf, "addrlist");
+
+                while (otLinkFilterGetNextAddress(mHost->GetInstance(), &iterator, &entry) == OT_ERROR_NONE)
+                {
+                    char extAddress[XPANID_LENGTH] = "";
+                    OutputBytes(entry.mExtAddress.m8, sizeof(entry.mExtAddress.m8), extAddress);
+                    blobmsg_add_string(&mBuf, "addr", extAddress);
+                }
+
+                blobmsg_close_array(&mBuf, sJsonUri);
+            }
+            else
+            {
+                perror("invalid argument in get information ubus\n");
+            }
+
+        exit:
+            return error;
+        });
     }
 
-    AppendResult(error, aContext, aRequest);
 exit:
-    mHostMutex->unlock();
+    if (!replied)
+    {
+        AppendResult(error, aContext, aRequest);
+    }
     return 0;
 }
 
@@ -1439,188 +2002,193 @@ int UbusServer::UbusSetInformation(struct ubus_context      *aContext,
 
     blob_buf_init(&mBuf, 0);
 
-    mHostMutex->lock();
-    if (!strcmp(aAction, "networkname"))
-    {
-        struct blob_attr *tb[SET_NETWORK_MAX];
-
-        blobmsg_parse(setNetworknamePolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
-        if (tb[SETNETWORK] != nullptr)
+    error = RunOnMainloop([&](void) {
+        if (!strcmp(aAction, "networkname"))
         {
-            char *newName = blobmsg_get_string(tb[SETNETWORK]);
-            SuccessOrExit(error = otThreadSetNetworkName(mHost->GetInstance(), newName));
-        }
-    }
-    else if (!strcmp(aAction, "channel"))
-    {
-        struct blob_attr *tb[SET_NETWORK_MAX];
+            struct blob_attr *tb[SET_NETWORK_MAX];
 
-        blobmsg_parse(setChannelPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
-        if (tb[SETNETWORK] != nullptr)
-        {
-            uint32_t channel = blobmsg_get_u32(tb[SETNETWORK]);
-            SuccessOrExit(error = otLinkSetChannel(mHost->GetInstance(), static_cast<uint8_t>(channel)));
+            blobmsg_parse(setNetworknamePolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+            if (tb[SETNETWORK] != nullptr)
+            {
+                char *newName = blobmsg_get_string(tb[SETNETWORK]);
+                SuccessOrExit(error = otThreadSetNetworkName(mHost->GetInstance(), newName));
+            }
         }
-    }
-    else if (!strcmp(aAction, "panid"))
-    {
-        struct blob_attr *tb[SET_NETWORK_MAX];
-
-        blobmsg_parse(setPanIdPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
-        if (tb[SETNETWORK] != nullptr)
+        else if (!strcmp(aAction, "channel"))
         {
-            long  value;
-            char *panid = blobmsg_get_string(tb[SETNETWORK]);
-            SuccessOrExit(error = ParseLong(panid, value));
-            error = otLinkSetPanId(mHost->GetInstance(), static_cast<otPanId>(value));
-        }
-    }
-    else if (!strcmp(aAction, "networkkey"))
-    {
-        struct blob_attr *tb[SET_NETWORK_MAX];
+            struct blob_attr *tb[SET_NETWORK_MAX];
 
-        blobmsg_parse(setNetworkkeyPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
-        if (tb[SETNETWORK] != nullptr)
+            blobmsg_parse(setChannelPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+            if (tb[SETNETWORK] != nullptr)
+            {
+                uint32_t channel = blobmsg_get_u32(tb[SETNETWORK]);
+                SuccessOrExit(error = otLinkSetChannel(mHost->GetInstance(), static_cast<uint8_t>(channel)));
+            }
+        }
+        else if (!strcmp(aAction, "panid"))
         {
-            otNetworkKey key;
-            char        *networkkey = blobmsg_get_string(tb[SETNETWORK]);
+            struct blob_attr *tb[SET_NETWORK_MAX];
 
-            VerifyOrExit(Hex2Bin(networkkey, key.m8, sizeof(key.m8)) == OT_NETWORK_KEY_SIZE, error = OT_ERROR_PARSE);
-            SuccessOrExit(error = otThreadSetNetworkKey(mHost->GetInstance(), &key));
+            blobmsg_parse(setPanIdPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+            if (tb[SETNETWORK] != nullptr)
+            {
+                long  value;
+                char *panid = blobmsg_get_string(tb[SETNETWORK]);
+                SuccessOrExit(error = ParseLong(panid, value));
+                error = otLinkSetPanId(mHost->GetInstance(), static_cast<otPanId>(value));
+            }
         }
-    }
-    else if (!strcmp(aAction, "pskc"))
-    {
-        struct blob_attr *tb[SET_NETWORK_MAX];
-
-        blobmsg_parse(setPskcPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
-        if (tb[SETNETWORK] != nullptr)
+        else if (!strcmp(aAction, "networkkey"))
         {
-            otPskc pskc;
+            struct blob_attr *tb[SET_NETWORK_MAX];
 
-            VerifyOrExit(Hex2Bin(blobmsg_get_string(tb[SETNETWORK]), pskc.m8, sizeof(pskc)) == OT_PSKC_MAX_SIZE,
-                         error = OT_ERROR_PARSE);
-            SuccessOrExit(error = otThreadSetPskc(mHost->GetInstance(), &pskc));
-        }
-    }
-    else if (!strcmp(aAction, "extpanid"))
-    {
-        struct blob_attr *tb[SET_NETWORK_MAX];
+            blobmsg_parse(setNetworkkeyPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+            if (tb[SETNETWORK] != nullptr)
+            {
+                otNetworkKey key;
+                char        *networkkey = blobmsg_get_string(tb[SETNETWORK]);
 
-        blobmsg_parse(setExtPanIdPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
-        if (tb[SETNETWORK] != nullptr)
-        {
-            otExtendedPanId extPanId;
-            char           *input = blobmsg_get_string(tb[SETNETWORK]);
-            VerifyOrExit(Hex2Bin(input, extPanId.m8, sizeof(extPanId)) >= 0, error = OT_ERROR_PARSE);
-            error = otThreadSetExtendedPanId(mHost->GetInstance(), &extPanId);
+                VerifyOrExit(Hex2Bin(networkkey, key.m8, sizeof(key.m8)) == OT_NETWORK_KEY_SIZE,
+                             error = OT_ERROR_PARSE);
+                SuccessOrExit(error = otThreadSetNetworkKey(mHost->GetInstance(), &key));
+            }
         }
-    }
-    else if (!strcmp(aAction, "mode"))
-    {
-        otLinkModeConfig  linkMode;
-        struct blob_attr *tb[SET_NETWORK_MAX];
-
-        blobmsg_parse(setModePolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
-        if (tb[SETNETWORK] != nullptr)
+        else if (!strcmp(aAction, "pskc"))
         {
-            char *inputMode = blobmsg_get_string(tb[SETNETWORK]);
-            for (char *ch = inputMode; *ch != '\0'; ch++)
+            struct blob_attr *tb[SET_NETWORK_MAX];
+
+            blobmsg_parse(setPskcPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+            if (tb[SETNETWORK] != nullptr)
             {
-                switch (*ch)
-                {
-                case 'r':
-                    linkMode.mRxOnWhenIdle = 1;
-                    break;
+                otPskc pskc;
 
-                case 'd':
-                    linkMode.mDeviceType = 1;
-                    break;
+                VerifyOrExit(Hex2Bin(blobmsg_get_string(tb[SETNETWORK]), pskc.m8, sizeof(pskc)) == OT_PSKC_MAX_SIZE,
+                             error = OT_ERROR_PARSE);
+                SuccessOrExit(error = otThreadSetPskc(mHost->GetInstance(), &pskc));
+            }
+        }
+        else if (!strcmp(aAction, "extpanid"))
+        {
+            struct blob_attr *tb[SET_NETWORK_MAX];
 
-                case 'n':
-                    linkMode.mNetworkData = 1;
-                    break;
+            blobmsg_parse(setExtPanIdPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+            if (tb[SETNETWORK] != nullptr)
+            {
+                otExtendedPanId extPanId;
+                char           *input = blobmsg_get_string(tb[SETNETWORK]);
+                VerifyOrExit(Hex2Bin(input, extPanId.m8, sizeof(extPanId)) >= 0, error = OT_ERROR_PARSE);
+                error = otThreadSetExtendedPanId(mHost->GetInstance(), &extPanId);
+            }
+        }
+        else if (!strcmp(aAction, "mode"))
+        {
+            otLinkModeConfig  linkMode;
+            struct blob_attr *tb[SET_NETWORK_MAX];
 
-                default:
-                    ExitNow(error = OT_ERROR_PARSE);
+            blobmsg_parse(setModePolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+            if (tb[SETNETWORK] != nullptr)
+            {
+                char *inputMode = blobmsg_get_string(tb[SETNETWORK]);
+                for (char *ch = inputMode; *ch != '\0'; ch++)
+                {
+                    switch (*ch)
+                    {
+                    case 'r':
+                        linkMode.mRxOnWhenIdle = 1;
+                        break;
+
+                    case 'd':
+                        linkMode.mDeviceType = 1;
+                        break;
+
+                    case 'n':
+                        linkMode.mNetworkData = 1;
+                        break;
+
+                    default:
+                        ExitNow(error = OT_ERROR_PARSE);
+                    }
                 }
-            }
 
-            SuccessOrExit(error = otThreadSetLinkMode(mHost->GetInstance(), linkMode));
+                SuccessOrExit(error = otThreadSetLinkMode(mHost->GetInstance(), linkMode));
+            }
         }
-    }
-    else if (!strcmp(aAction, "macfilteradd"))
-    {
-        struct blob_attr *tb[SET_NETWORK_MAX];
-        otExtAddress      extAddr;
-
-        blobmsg_parse(macfilterAddPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
-        if (tb[SETNETWORK] != nullptr)
+        else if (!strcmp(aAction, "macfilteradd"))
         {
-            char *addr = blobmsg_get_string(tb[SETNETWORK]);
+            struct blob_attr *tb[SET_NETWORK_MAX];
+            otExtAddress      extAddr;
 
-            VerifyOrExit(Hex2Bin(addr, extAddr.m8, OT_EXT_ADDRESS_SIZE) == OT_EXT_ADDRESS_SIZE, error = OT_ERROR_PARSE);
-
-            error = otLinkFilterAddAddress(mHost->GetInstance(), &extAddr);
+            blobmsg_parse(macfilterAddPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+            if (tb[SETNETWORK] != nullptr)
+            {
+                char *addr = blobmsg_get_string(tb[SETNETWORK]);
 
-            VerifyOrExit(error == OT_ERROR_NONE || error == OT_ERROR_ALREADY);
-        }
-    }
-    else if (!strcmp(aAction, "macfilterremove"))
-    {
-        struct blob_attr *tb[SET_NETWORK_MAX];
-        otExtAddress      extAddr;
+                VerifyOrExit(Hex2Bin(addr, extAddr.m8, OT_EXT_ADDRESS_SIZE) == OT_EXT_ADDRESS_SIZE,
+                             error = OT_ERROR_PARSE);
 
-        blobmsg_parse(macfilterRemovePolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
-        if (tb[SETNETWORK] != nullptr)
-        {
-            char *addr = blobmsg_get_string(tb[SETNETWORK]);
-            VerifyOrExit(Hex2Bin(addr, extAddr.m8, OT_EXT_ADDRESS_SIZE) == OT_EXT_ADDRESS_SIZE, error = OT_ERROR_PARSE);
+                error = otLinkFilterAddAddress(mHost->GetInstance(), &extAddr);
 
-            otLinkFilterRemoveAddress(mHost->GetInstance(), &extAddr);
+                VerifyOrExit(error == OT_ERROR_NONE || error == OT_ERROR_ALREADY);
+            }
         }
-    }
-    else if (!strcmp(aAction, "macfiltersetstate"))
-    {
-        struct blob_attr *tb[SET_NETWORK_MAX];
-
-        blobmsg_parse(macfilterSetStatePolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
-        if (tb[SETNETWORK] != nullptr)
+        else if (!strcmp(aAction, "macfilterremove"))
         {
-            char *state = blobmsg_get_string(tb[SETNETWORK]);
+            struct blob_attr *tb[SET_NETWORK_MAX];
+            otExtAddress      extAddr;
 
-            if (strcmp(state, "disable") == 0)
-            {
-                otLinkFilterSetAddressMode(mHost->GetInstance(), OT_MAC_FILTER_ADDRESS_MODE_DISABLED);
-            }
-            else if (strcmp(state, "allowlist") == 0)
+            blobmsg_parse(macfilterRemovePolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+            if (tb[SETNETWORK] != nullptr)
             {
-                otLinkFilterSetAddressMode(mHost->GetInstance(), OT_MAC_FILTER_ADDRESS_MODE_ALLOWLIST);
+                char *addr = blobmsg_get_string(tb[SETNETWORK]);
+                VerifyOrExit(Hex2Bin(addr, extAddr.m8, OT_EXT_ADDRESS_SIZE) == OT_EXT_ADDRESS_SIZE,
+                             error = OT_ERROR_PARSE);
+
+                otLinkFilterRemoveAddress(mHost->GetInstance(), &extAddr);
             }
-            else if (strcmp(state, "denylist") == 0)
+        }
+        else if (!strcmp(aAction, "macfiltersetstate"))
+        {
+            struct blob_attr *tb[SET_NETWORK_MAX];
+
+            blobmsg_parse(macfilterSetStatePolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+            if (tb[SETNETWORK] != nullptr)
             {
-                otLinkFilterSetAddressMode(mHost->GetInstance(), OT_MAC_FILTER_ADDRESS_MODE_DENYLIST);
+                char *state = blobmsg_get_string(tb[SETNETWORK]);
+
+                if (strcmp(state, "disable") == 0)
+                {
+                    otLinkFilterSetAddressMode(mHost->GetInstance(), OT_MAC_FILTER_ADDRESS_MODE_DISABLED);
+                }
+                else if (strcmp(state, "allowlist") == 0)
+                {
+                    otLinkFilterSetAddressMode(mHost->GetInstance(), OT_MAC_FILTER_ADDRESS_MODE_ALLOWLIST);
+                }
+                else if (strcmp(state, "denylist") == 0)
+                {
+                    otLinkFilterSetAddressMode(mHost->GetInstance(), OT_MAC_FILTER_ADDRESS_MODE_DENYLIST);
+                }
             }
         }
-    }
-    else if (!strcmp(aAction, "macfilterclear"))
-    {
-        otLinkFilterClearAddresses(mHost->GetInstance());
-    }
-    else
-    {
-        perror("invalid argument in get information ubus\n");
-    }
+        else if (!strcmp(aAction, "macfilterclear"))
+        {
+            otLinkFilterClearAddresses(mHost->GetInstance());
+        }
+        else
+        {
+            perror("invalid argument in get information ubus\n");
+        }
+
+    exit:
+        return error;
+    });
 
-exit:
-    mHostMutex->unlock();
     AppendResult(error, aContext, aRequest);
     return 0;
 }
 
-void UbusServer::GetState(otInstance *aInstance, char *aState)
+void UbusServer::GetState(otDeviceRole aRole, char *aState)
 {
-    switch (otThreadGetDeviceRole(aInstance))
+    switch (aRole)
     {
     case OT_DEVICE_ROLE_DISABLED:
         strcpy(aState, "disabled");
@@ -1710,6 +2278,20 @@ int UbusServer::DisplayUbusInit(const char *aPath)
     /* file description */
     UbusAddFd();
 
+    mScanDoneFd.fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (mScanDoneFd.fd == -1 || uloop_fd_add(&mScanDoneFd, ULOOP_READ) != 0)
+    {
+        otbrLogErr("Ubus add scan fd failed");
+        return -1;
+    }
+
+    mEventFd.fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (mEventFd.fd == -1 || uloop_fd_add(&mEventFd, ULOOP_READ) != 0)
+    {
+        otbrLogErr("Ubus add event fd failed");
+        return -1;
+    }
+
     /* Add a object */
     if (ubus_add_object(mContext, &otbr) != 0)
     {
@@ -1722,6 +2304,20 @@ int UbusServer::DisplayUbusInit(const char *aPath)
 
 void UbusServer::DisplayUbusDone(void)
 {
+    if (mScanDoneFd.fd != -1)
+    {
+        uloop_fd_delete(&mScanDoneFd);
+        close(mScanDoneFd.fd);
+        mScanDoneFd.fd = -1;
+    }
+
+    if (mEventFd.fd != -1)
+    {
+        uloop_fd_delete(&mEventFd);
+        close(mEventFd.fd);
+        mEventFd.fd = -1;
+    }
+
     if (mContext)
     {
         ubus_free(mContext);
@@ -1807,51 +2403,10 @@ exit:
 
 void UBusAgent::Init(void)
 {
-    otbr::ubus::sUbusEfd = eventfd(0, 0);
-
-    otbr::ubus::UbusServer::Initialize(&mHost, &mThreadMutex);
-
-    if (otbr::ubus::sUbusEfd == -1)
-    {
-        perror("Failed to create eventfd for ubus");
-        exit(EXIT_FAILURE);
-    }
+    otbr::ubus::UbusServer::Initialize(&mHost, &mTaskRunner);
 
     std::thread(UbusServerRun).detach();
 }
 
-void UBusAgent::Update(MainloopContext &aMainloop)
-{
-    VerifyOrExit(otbr::ubus::sUbusEfd != -1);
-
-    aMainloop.AddFdToReadSet(otbr::ubus::sUbusEfd);
-exit:
-    mThreadMutex.unlock();
-    return;
-}
-
-void UBusAgent::Process(const MainloopContext &aMainloop)
-{
-    ssize_t  retval;
-    uint64_t num;
-
-    mThreadMutex.lock();
-
-    VerifyOrExit(otbr::ubus::sUbusEfd != -1);
-
-    if (FD_ISSET(otbr::ubus::sUbusEfd, &aMainloop.mReadFdSet))
-    {
-        retval = read(otbr::ubus::sUbusEfd, &num, sizeof(uint64_t));
-        if (retval != sizeof(uint64_t))
-        {
-            perror("read ubus eventfd failed\n");
-            exit(EXIT_FAILURE);
-        }
-    }
-
-exit:
-    return;
-}
-
 } // namespace ubus
 } // namespace otbr
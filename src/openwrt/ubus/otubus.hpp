@@ -36,16 +36,26 @@
 
 #include "openthread-br/config.h"
 
+#include <atomic>
+#include <map>
+#include <string>
+
 #include <stdarg.h>
 #include <time.h>
 
 #include <openthread/ip6.h>
 #include <openthread/link.h>
 #include <openthread/netdiag.h>
+#include <openthread/thread.h>
 #include <openthread/udp.h>
 
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/mainloop_stats.hpp"
+#include "common/mpsc_queue.hpp"
+#include "common/task_runner.hpp"
+#include "common/thread_scheduling.hpp"
+#include "common/time.hpp"
 #include "ncp/rcp_host.hpp"
 
 extern "C" {
@@ -76,10 +86,13 @@ public:
     /**
      * Constructor
      *
-     * @param[in] aHost  A pointer to OpenThread Controller structure.
-     * @param[in] aMutex       A pointer to mutex.
+     * OpenThread APIs are only called on the mainloop: requests are posted to @p aTaskRunner, and read-only
+     * status queries are served from a snapshot refreshed on Thread state changes.
+     *
+     * @param[in] aHost        A pointer to OpenThread Controller structure.
+     * @param[in] aTaskRunner  A pointer to the task runner of the mainloop.
      */
-    static void Initialize(Ncp::RcpHost *aHost, std::mutex *aMutex);
+    static void Initialize(Ncp::RcpHost *aHost, TaskRunner *aTaskRunner);
 
     /**
      * This method return the instance of the global UbusServer.
@@ -722,6 +735,78 @@ public:
                                         const char               *aMethod,
                                         struct blob_attr         *aMsg);
 
+    /**
+     * This method handle ubus getmany function request.
+     *
+     * The optional "fields" array selects the fields to return, using the names of the single-field methods (e.g.
+     * "state", "channel", "leaderdata", "neighbor"). All snapshot fields are returned when it is omitted.
+     *
+     * @param[in] aContext  A pointer to the ubus context.
+     * @param[in] aObj      A pointer to the ubus object.
+     * @param[in] aRequest  A pointer to the ubus request.
+     * @param[in] aMethod   A pointer to the ubus method.
+     * @param[in] aMsg      A pointer to the ubus message.
+     *
+     * @retval 0  Successfully handler the request.
+     */
+    static int UbusGetManyHandler(struct ubus_context      *aContext,
+                                  struct ubus_object       *aObj,
+                                  struct ubus_request_data *aRequest,
+                                  const char               *aMethod,
+                                  struct blob_attr         *aMsg);
+
+    /**
+     * This method handle ubus statistics function request.
+     *
+     * @param[in] aContext  A pointer to the ubus context.
+     * @param[in] aObj      A pointer to the ubus object.
+     * @param[in] aRequest  A pointer to the ubus request.
+     * @param[in] aMethod   A pointer to the ubus method.
+     * @param[in] aMsg      A pointer to the ubus message.
+     *
+     * @retval 0  Successfully handler the request.
+     */
+    static int UbusStatisticsHandler(struct ubus_context      *aContext,
+                                     struct ubus_object       *aObj,
+                                     struct ubus_request_data *aRequest,
+                                     const char               *aMethod,
+                                     struct blob_attr         *aMsg);
+
+    /**
+     * This method handles a ubus request with @p aHandler and records its latency.
+     *
+     * @param[in] aContext  A pointer to the ubus context.
+     * @param[in] aObj      A pointer to the ubus object.
+     * @param[in] aRequest  A pointer to the ubus request.
+     * @param[in] aMethod   A pointer to the ubus method.
+     * @param[in] aMsg      A pointer to the ubus message.
+     *
+     * @returns The value returned by @p aHandler, or `UBUS_STATUS_TIMEOUT` if the mainloop didn't pick up a task of
+     *          the request in time.
+     */
+    template <ubus_handler_t aHandler>
+    static int MeasuredHandler(struct ubus_context      *aContext,
+                               struct ubus_object       *aObj,
+                               struct ubus_request_data *aRequest,
+                               const char               *aMethod,
+                               struct blob_attr         *aMsg)
+    {
+        Timepoint startTime = Clock::now();
+        int       rval;
+
+        GetInstance().mMainloopWaitTime = Microseconds::zero();
+        GetInstance().mMainloopTimedOut = false;
+        rval = aHandler(aContext, aObj, aRequest, aMethod, aMsg);
+        GetInstance().RecordRequest(aMethod, startTime);
+
+        if (GetInstance().mMainloopTimedOut)
+        {
+            rval = UBUS_STATUS_TIMEOUT;
+        }
+
+        return rval;
+    }
+
     /**
      * This method handle initial diagnostic get response.
      *
@@ -745,31 +830,214 @@ public:
     void HandleDiagnosticGetResponse(otError aError, otMessage *aMessage, const otMessageInfo *aMessageInfo);
 
 private:
-    bool                 mIfFinishScan;
-    struct ubus_context *mContext;
-    const char          *mSockPath;
-    struct blob_buf      mBuf;
-    struct blob_buf      mNetworkdataBuf;
-    Ncp::RcpHost        *mHost;
-    std::mutex          *mHostMutex;
-    time_t               mSecond;
+    bool                     mScanInProgress;
+    struct ubus_request_data mScanRequest; ///< The deferred scan request, valid while a scan is in progress.
+    struct blob_buf          mScanBuf;     ///< Filled by scan results on the mainloop thread.
+    void                    *mScanList;
+    struct uloop_fd          mScanDoneFd;  ///< Signaled by the mainloop thread when a scan completes.
+    struct uloop_fd          mEventFd;     ///< Signaled by the mainloop thread when events are queued.
+    struct ubus_context     *mContext;
+    const char              *mSockPath;
+    struct blob_buf          mBuf;
+    struct blob_buf          mNetworkdataBuf;
+    struct blob_buf          mEventBuf;
+    Ncp::RcpHost            *mHost;
+    TaskRunner              *mTaskRunner;
+    time_t                   mSecond;
     enum
     {
         kDefaultJoinerTimeout = 120,
     };
 
+    enum
+    {
+        kReplyBufferSize  = 2048, ///< Initial capacity of reply buffers, enough for typical neighbor tables.
+        kReplyCacheMaxAge = 5,    ///< Seconds a cached reply is reused, bounds the staleness of ages and RSSIs.
+    };
+
+    /**
+     * This enumeration represents the replies whose encoding is cached between requests.
+     */
+    enum CachedReply : uint8_t
+    {
+        kCachedReplyNeighbor,
+        kCachedReplyParent,
+        kNumCachedReplies,
+    };
+
+    /**
+     * This structure holds an encoded reply, reused until a relevant state change or expiry.
+     */
+    struct ReplyCache
+    {
+        struct blob_buf mBuf;
+        otError         mError;
+        bool            mValid;
+        Timepoint       mUpdateTime;
+    };
+
+    ReplyCache            mReplyCaches[kNumCachedReplies];
+    std::atomic<uint32_t> mStaleReplies; ///< Bit N is set when a state change invalidated cached reply N.
+
+    /**
+     * This enumeration represents the events emitted on the `otbr` ubus object.
+     */
+    enum EventType : uint8_t
+    {
+        kEventRole,        ///< The device role or partition changed.
+        kEventNetworkData, ///< The network data changed.
+        kEventNeighbor,    ///< The neighbor table changed.
+        kEventJoiner,      ///< A joiner event of the commissioner.
+    };
+
+    /**
+     * This structure represents an event queued by the mainloop thread to be emitted on the ubus thread.
+     */
+    struct Event
+    {
+        EventType                 mType;
+        otDeviceRole              mRole;        ///< The device role, for `kEventRole`.
+        uint32_t                  mPartitionId; ///< The partition ID, for `kEventRole`.
+        otCommissionerJoinerEvent mJoinerEvent; ///< The joiner event, for `kEventJoiner`.
+        bool                      mHasJoinerId; ///< Whether `mJoinerId` is known, for `kEventJoiner`.
+        otExtAddress              mJoinerId;    ///< The joiner ID, for `kEventJoiner`.
+    };
+
+    MpscQueue<Event>      mEvents;
+    std::atomic<uint32_t> mPendingEvents; ///< Bit N is set while an event of type N without payload is queued.
+
+    enum
+    {
+        kSlowRequestThreshold = 100,  ///< Requests taking longer than this many milliseconds are logged.
+        kMainloopTimeout      = 5000, ///< Requests give up waiting this many milliseconds for the mainloop.
+    };
+
+    /**
+     * This structure represents the counters and latencies of a ubus method.
+     */
+    struct MethodStats
+    {
+        MethodStats(void)
+            : mRequestCount(0)
+        {
+        }
+
+        uint64_t          mRequestCount;     ///< The number of handled requests.
+        DurationHistogram mLatency;          ///< The time spent handling a request.
+        DurationHistogram mMainloopWaitTime; ///< The time a request waited for the mainloop to pick up its tasks.
+    };
+
+    // Only accessed on the ubus thread.
+    std::map<std::string, MethodStats> mMethodStats;
+    Microseconds                       mMainloopWaitTime; ///< Accumulated by the request being handled.
+    bool                               mMainloopTimedOut; ///< Whether the request being handled timed out.
+
     /**
      * Constructor
      *
-     * @param[in] aHost    The pointer to OpenThread Controller structure.
-     * @param[in] aMutex   A pointer to mutex.
+     * @param[in] aHost        The pointer to OpenThread Controller structure.
+     * @param[in] aTaskRunner  A pointer to the task runner of the mainloop.
+     */
+    UbusServer(Ncp::RcpHost *aHost, TaskRunner *aTaskRunner);
+
+    /**
+     * This method handles Thread state changes, it must be called on the mainloop.
+     *
+     * @param[in] aSnapshot  The Thread state and the flags changed.
+     */
+    void HandleThreadStateChanged(const Ncp::ThreadStateSnapshot &aSnapshot);
+
+    /**
+     * This method queues an event to be emitted on the ubus thread, it must be called on the mainloop.
+     *
+     * Events without payload are coalesced with the one already queued.
+     *
+     * @param[in] aEvent  The event.
      */
-    UbusServer(Ncp::RcpHost *aHost, std::mutex *aMutex);
+    void QueueEvent(const Event &aEvent);
+
+    /**
+     * This method emits an event to the subscribers of the `otbr` object and as the ubus event "otbr.<name>".
+     *
+     * @param[in] aEvent  The event.
+     */
+    void SendEvent(const Event &aEvent);
+
+    /**
+     * This method records the latency of a handled request.
+     *
+     * @param[in] aMethod     The name of the ubus method.
+     * @param[in] aStartTime  The time the request was received.
+     */
+    void RecordRequest(const char *aMethod, Timepoint aStartTime);
+
+    /**
+     * This method detailly handler statistics request.
+     *
+     * @param[in] aContext  A pointer to the ubus context.
+     * @param[in] aRequest  A pointer to the ubus request.
+     *
+     * @retval 0  Successfully handler the request.
+     */
+    int UbusStatisticsHandlerDetail(struct ubus_context *aContext, struct ubus_request_data *aRequest);
+
+    /**
+     * This method sends a cached reply if it is still valid.
+     *
+     * @param[in] aReply    The cached reply.
+     * @param[in] aContext  A pointer to the ubus context.
+     * @param[in] aRequest  A pointer to the ubus request.
+     * @param[out] aError   The error of the cached reply.
+     *
+     * @retval TRUE   The cached reply was sent.
+     * @retval FALSE  The reply must be rebuilt with `BeginCachedReply()` and `SendCachedReply()`.
+     */
+    bool SendCachedReply(CachedReply               aReply,
+                         struct ubus_context      *aContext,
+                         struct ubus_request_data *aRequest,
+                         otError                  &aError);
+
+    /**
+     * This method starts rebuilding a cached reply, reusing its buffer.
+     *
+     * @param[in] aReply  The cached reply.
+     *
+     * @returns A pointer to the buffer to encode the reply into.
+     */
+    struct blob_buf *BeginCachedReply(CachedReply aReply);
+
+    /**
+     * This method completes a rebuilt reply, sends it and keeps it for later requests.
+     *
+     * @param[in] aReply    The cached reply.
+     * @param[in] aError    The error of the reply.
+     * @param[in] aContext  A pointer to the ubus context.
+     * @param[in] aRequest  A pointer to the ubus request.
+     */
+    void SendCachedReply(CachedReply               aReply,
+                         otError                   aError,
+                         struct ubus_context      *aContext,
+                         struct ubus_request_data *aRequest);
+
+    /**
+     * This method runs a task on the mainloop and waits for its result.
+     *
+     * The task is canceled if the mainloop doesn't pick it up within `kMainloopTimeout`, so a stalled mainloop doesn't
+     * block the ubus thread forever.
+     *
+     * @param[in] aTask  The task to run.
+     *
+     * @returns The error returned by @p aTask, or OT_ERROR_RESPONSE_TIMEOUT if the task is canceled.
+     */
+    otError RunOnMainloop(const TaskRunner::Task<otError> &aTask);
 
     /**
      * This method start scan.
+     *
+     * @retval OT_ERROR_NONE  Successfully started the scan.
+     * @retval ...            Failed to start the scan.
      */
-    void ProcessScan(void);
+    otError ProcessScan(void);
 
     /**
      * This method detailly start scan.
@@ -803,6 +1071,32 @@ private:
      */
     void HandleActiveScanResultDetail(otActiveScanResult *aResult);
 
+    /**
+     * This method handles the scan completion signaled by the mainloop (callback function).
+     *
+     * @param[in] aFd      A pointer to the uloop fd.
+     * @param[in] aEvents  The uloop events.
+     */
+    static void HandleScanDone(struct uloop_fd *aFd, unsigned int aEvents);
+
+    /**
+     * This method detailly handles the scan completion, replying to the deferred scan request.
+     */
+    void HandleScanDoneDetail(void);
+
+    /**
+     * This method handles the events queued by the mainloop (callback function).
+     *
+     * @param[in] aFd      A pointer to the uloop fd.
+     * @param[in] aEvents  The uloop events.
+     */
+    static void HandleEvents(struct uloop_fd *aFd, unsigned int aEvents);
+
+    /**
+     * This method detailly handles the events queued by the mainloop, emitting them.
+     */
+    void HandleEventsDetail(void);
+
     /**
      * This method detailly handler get neighbor information.
      *
@@ -837,6 +1131,69 @@ private:
                                 const char               *aMethod,
                                 struct blob_attr         *aMsg);
 
+    /**
+     * This method detailly handler getmany request.
+     *
+     * @param[in] aContext  A pointer to the ubus context.
+     * @param[in] aObj      A pointer to the ubus object.
+     * @param[in] aRequest  A pointer to the ubus request.
+     * @param[in] aMethod   A pointer to the ubus method.
+     * @param[in] aMsg      A pointer to the ubus message.
+     *
+     * @retval 0  Successfully handler the request.
+     */
+    int UbusGetManyHandlerDetail(struct ubus_context      *aContext,
+                                 struct ubus_object       *aObj,
+                                 struct ubus_request_data *aRequest,
+                                 const char               *aMethod,
+                                 struct blob_attr         *aMsg);
+
+    /**
+     * This method appends a field answered from the network state snapshot of the host.
+     *
+     * @param[in]  aBuf       A pointer to the buffer to append to.
+     * @param[in]  aSnapshot  The network state snapshot.
+     * @param[in]  aAction    The name of the field.
+     * @param[out] aError     Set when the field is unavailable.
+     *
+     * @retval TRUE   The field is a snapshot field.
+     * @retval FALSE  The field is not a snapshot field and nothing was appended.
+     */
+    bool AppendSnapshotInformation(struct blob_buf                 *aBuf,
+                                   const Ncp::NetworkStateSnapshot &aSnapshot,
+                                   const char                      *aAction,
+                                   otError                         &aError);
+
+    /**
+     * This method appends the link mode, it must be called on the mainloop.
+     *
+     * @param[in] aBuf  A pointer to the buffer to append to.
+     */
+    void AppendMode(struct blob_buf *aBuf);
+
+    /**
+     * This method appends the commissioner joiner list, it must be called on the mainloop.
+     *
+     * @param[in] aBuf  A pointer to the buffer to append to.
+     */
+    void AppendJoinerList(struct blob_buf *aBuf);
+
+    /**
+     * This method appends the neighbor list, it must be called on the mainloop.
+     *
+     * @param[in] aBuf  A pointer to the buffer to append to.
+     */
+    void AppendNeighborList(struct blob_buf *aBuf);
+
+    /**
+     * This method appends the parent information, it must be called on the mainloop.
+     *
+     * @param[in] aBuf  A pointer to the buffer to append to.
+     *
+     * @returns The error of reading the parent information.
+     */
+    otError AppendParentInfo(struct blob_buf *aBuf);
+
     /**
      * This method handle mgmtset request.
      *
@@ -989,10 +1346,10 @@ private:
     /**
      * This method convert thread network state to string.
      *
-     * @param[in]  aInstance  A pointer to the instance.
-     * @param[out] aState     A pointer to the string address.
+     * @param[in]  aRole   The device role.
+     * @param[out] aState  A pointer to the string address.
      */
-    void GetState(otInstance *aInstance, char *aState);
+    void GetState(otDeviceRole aRole, char *aState);
 
     /**
      * This method add fd of ubus object.
@@ -1075,7 +1432,7 @@ private:
     void AppendResult(otError aError, struct ubus_context *aContext, struct ubus_request_data *aRequest);
 };
 
-class UBusAgent : public MainloopProcessor
+class UBusAgent
 {
 public:
     /**
@@ -1085,7 +1442,7 @@ public:
      */
     UBusAgent(otbr::Ncp::RcpHost &aHost)
         : mHost(aHost)
-        , mThreadMutex()
+        , mTaskRunner(TaskRunner::DelayedTaskQueue::kHeap, MainloopProcessor::kPriorityManagement)
     {
     }
 
@@ -1094,14 +1451,15 @@ public:
      */
     void Init(void);
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
-
 private:
-    static void UbusServerRun(void) { otbr::ubus::UbusServer::GetInstance().InstallUbusObject(); }
+    static void UbusServerRun(void)
+    {
+        ThreadScheduling::Get().ApplyToManagementThread();
+        otbr::ubus::UbusServer::GetInstance().InstallUbusObject();
+    }
 
     otbr::Ncp::RcpHost &mHost;
-    std::mutex          mThreadMutex;
+    TaskRunner          mTaskRunner;
 };
 } // namespace ubus
 } // namespace otbr
@@ -0,0 +1,94 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the parsing of batch requests of the RESTful HTTP server.
+ */
+
+#include "rest/batch.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+#include "common/code_utils.hpp"
+#include "rest/types.hpp"
+
+namespace otbr {
+namespace rest {
+
+// The resources which may be read by a batch request, their GET handlers respond right away with a Json body
+static const char *const kBatchPaths[] = {
+    OT_REST_RESOURCE_PATH_NODE,
+    OT_REST_RESOURCE_PATH_NODE_BAID,
+    OT_REST_RESOURCE_PATH_NODE_COUNTERS,
+    OT_REST_RESOURCE_PATH_NODE_STATE,
+    OT_REST_RESOURCE_PATH_NODE_EXTADDRESS,
+    OT_REST_RESOURCE_PATH_NODE_NETWORKNAME,
+    OT_REST_RESOURCE_PATH_NODE_RLOC16,
+    OT_REST_RESOURCE_PATH_NODE_LEADERDATA,
+    OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER,
+    OT_REST_RESOURCE_PATH_NODE_EXTPANID,
+    OT_REST_RESOURCE_PATH_NODE_RLOC,
+    OT_REST_RESOURCE_PATH_NODE_DATASET_ACTIVE,
+    OT_REST_RESOURCE_PATH_NODE_DATASET_PENDING,
+};
+
+otbrError ParseBatchPaths(const StringView &aValue, std::vector<std::string> &aPaths)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    size_t    start = 0;
+
+    aPaths.clear();
+    VerifyOrExit(!aValue.IsEmpty(), error = OTBR_ERROR_INVALID_ARGS);
+
+    while (start <= aValue.Size())
+    {
+        size_t     end  = aValue.Find(',', start);
+        StringView path = aValue.Substr(start, end == std::string::npos ? end : end - start);
+
+        VerifyOrExit(std::find_if(std::begin(kBatchPaths), std::end(kBatchPaths),
+                                  [&path](const char *aPath) { return path == aPath; }) != std::end(kBatchPaths),
+                     error = OTBR_ERROR_INVALID_ARGS);
+        VerifyOrExit(aPaths.size() < kBatchMaxPaths, error = OTBR_ERROR_INVALID_ARGS);
+        aPaths.push_back(path.ToString());
+
+        start = (end == std::string::npos) ? aValue.Size() + 1 : end + 1;
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        aPaths.clear();
+    }
+
+    return error;
+}
+
+} // namespace rest
+} // namespace otbr
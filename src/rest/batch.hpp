@@ -0,0 +1,70 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the parsing of batch requests of the RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_BATCH_HPP_
+#define OTBR_REST_BATCH_HPP_
+
+#include "openthread-br/config.h"
+
+#include <string>
+#include <vector>
+
+#include "common/string_view.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * The maximum number of resources read by a batch request.
+ */
+constexpr size_t kBatchMaxPaths = 16;
+
+/**
+ * This function parses the resources read by a batch request.
+ *
+ * Only resources whose GET handlers respond right away with a Json body may be read by a batch request.
+ *
+ * @param[in]  aValue  The value of the `path` query parameter, a comma separated list of paths.
+ * @param[out] aPaths  The paths in the order of the list.
+ *
+ * @retval OTBR_ERROR_NONE          Successfully parsed the paths.
+ * @retval OTBR_ERROR_INVALID_ARGS  The list is empty, longer than `kBatchMaxPaths`, or has a path which may not be
+ *                                  read by a batch request.
+ */
+otbrError ParseBatchPaths(const StringView &aValue, std::vector<std::string> &aPaths);
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_BATCH_HPP_
@@ -0,0 +1,181 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements streaming CBOR writer for RESTful HTTP server.
+ */
+
+#include "rest/cbor_writer.hpp"
+
+#include <string.h>
+
+namespace otbr {
+namespace rest {
+
+// The major types and simple values of CBOR
+static constexpr uint8_t kMajorTypeUnsigned = 0;
+static constexpr uint8_t kMajorTypeNegative = 1;
+static constexpr uint8_t kMajorTypeBytes    = 2;
+static constexpr uint8_t kMajorTypeText     = 3;
+static constexpr uint8_t kIndefiniteArray   = 0x9f;
+static constexpr uint8_t kIndefiniteMap     = 0xbf;
+static constexpr uint8_t kFalse             = 0xf4;
+static constexpr uint8_t kTrue              = 0xf5;
+static constexpr uint8_t kNull              = 0xf6;
+static constexpr uint8_t kBreak             = 0xff;
+
+CborWriter::CborWriter(std::string &aOutput)
+    : mOutput(aOutput)
+{
+}
+
+void CborWriter::WriteHead(uint8_t aMajorType, uint64_t aValue)
+{
+    uint8_t initial = static_cast<uint8_t>(aMajorType << 5);
+    uint8_t length;
+
+    // The argument follows the initial byte in the fewest bytes which hold it, in network byte order.
+    if (aValue < 24)
+    {
+        mOutput.push_back(static_cast<char>(initial | aValue));
+        length = 0;
+    }
+    else if (aValue <= UINT8_MAX)
+    {
+        mOutput.push_back(static_cast<char>(initial | 24));
+        length = 1;
+    }
+    else if (aValue <= UINT16_MAX)
+    {
+        mOutput.push_back(static_cast<char>(initial | 25));
+        length = 2;
+    }
+    else if (aValue <= UINT32_MAX)
+    {
+        mOutput.push_back(static_cast<char>(initial | 26));
+        length = 4;
+    }
+    else
+    {
+        mOutput.push_back(static_cast<char>(initial | 27));
+        length = 8;
+    }
+
+    while (length > 0)
+    {
+        --length;
+        mOutput.push_back(static_cast<char>((aValue >> (length * 8)) & 0xff));
+    }
+}
+
+CborWriter &CborWriter::BeginObject(void)
+{
+    mOutput.push_back(static_cast<char>(kIndefiniteMap));
+
+    return *this;
+}
+
+CborWriter &CborWriter::EndObject(void)
+{
+    mOutput.push_back(static_cast<char>(kBreak));
+
+    return *this;
+}
+
+CborWriter &CborWriter::BeginArray(void)
+{
+    mOutput.push_back(static_cast<char>(kIndefiniteArray));
+
+    return *this;
+}
+
+CborWriter &CborWriter::EndArray(void)
+{
+    mOutput.push_back(static_cast<char>(kBreak));
+
+    return *this;
+}
+
+CborWriter &CborWriter::Key(const char *aKey)
+{
+    return String(aKey);
+}
+
+CborWriter &CborWriter::String(const char *aString)
+{
+    return String(aString, strlen(aString));
+}
+
+CborWriter &CborWriter::String(const char *aString, size_t aLength)
+{
+    WriteHead(kMajorTypeText, aLength);
+    mOutput.append(aString, aLength);
+
+    return *this;
+}
+
+CborWriter &CborWriter::HexString(const uint8_t *aBytes, uint16_t aLength)
+{
+    WriteHead(kMajorTypeBytes, aLength);
+    mOutput.append(reinterpret_cast<const char *>(aBytes), aLength);
+
+    return *this;
+}
+
+CborWriter &CborWriter::Number(int64_t aNumber)
+{
+    // A negative integer n is encoded as -1 - n, which never overflows.
+    if (aNumber < 0)
+    {
+        WriteHead(kMajorTypeNegative, static_cast<uint64_t>(-1 - aNumber));
+    }
+    else
+    {
+        WriteHead(kMajorTypeUnsigned, static_cast<uint64_t>(aNumber));
+    }
+
+    return *this;
+}
+
+CborWriter &CborWriter::Bool(bool aValue)
+{
+    mOutput.push_back(static_cast<char>(aValue ? kTrue : kFalse));
+
+    return *this;
+}
+
+CborWriter &CborWriter::Null(void)
+{
+    mOutput.push_back(static_cast<char>(kNull));
+
+    return *this;
+}
+
+} // namespace rest
+} // namespace otbr
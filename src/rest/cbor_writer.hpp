@@ -0,0 +1,163 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes streaming CBOR writer definition for RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_CBOR_WRITER_HPP_
+#define OTBR_REST_CBOR_WRITER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class implements a streaming CBOR (RFC 8949) writer.
+ *
+ * It has the interface of `JsonWriter`, so the same serialization code writes either representation. Maps and
+ * arrays are written with indefinite lengths, so nothing is buffered, and bytes are written as byte strings instead
+ * of hex text.
+ */
+class CborWriter
+{
+public:
+    /**
+     * The constructor of a CBOR writer.
+     *
+     * @param[in] aOutput  A string the CBOR bytes are appended to.
+     */
+    explicit CborWriter(std::string &aOutput);
+
+    /**
+     * This method begins a CBOR map.
+     *
+     * @returns A reference to this writer.
+     */
+    CborWriter &BeginObject(void);
+
+    /**
+     * This method ends the current CBOR map.
+     *
+     * @returns A reference to this writer.
+     */
+    CborWriter &EndObject(void);
+
+    /**
+     * This method begins a CBOR array.
+     *
+     * @returns A reference to this writer.
+     */
+    CborWriter &BeginArray(void);
+
+    /**
+     * This method ends the current CBOR array.
+     *
+     * @returns A reference to this writer.
+     */
+    CborWriter &EndArray(void);
+
+    /**
+     * This method writes the key of the next entry of the current map as a text string.
+     *
+     * @param[in] aKey  A C string of the key.
+     *
+     * @returns A reference to this writer.
+     */
+    CborWriter &Key(const char *aKey);
+
+    /**
+     * This method writes a CBOR text string.
+     *
+     * @param[in] aString  A C string.
+     *
+     * @returns A reference to this writer.
+     */
+    CborWriter &String(const char *aString);
+
+    /**
+     * This method writes a CBOR text string.
+     *
+     * @param[in] aString  A pointer to the characters.
+     * @param[in] aLength  The number of characters.
+     *
+     * @returns A reference to this writer.
+     */
+    CborWriter &String(const char *aString, size_t aLength);
+
+    /**
+     * This method writes a CBOR byte string, which `JsonWriter` writes as hex text.
+     *
+     * @param[in] aBytes   A pointer to the bytes.
+     * @param[in] aLength  The number of bytes.
+     *
+     * @returns A reference to this writer.
+     */
+    CborWriter &HexString(const uint8_t *aBytes, uint16_t aLength);
+
+    /**
+     * This method writes a CBOR integer.
+     *
+     * @param[in] aNumber  An integer.
+     *
+     * @returns A reference to this writer.
+     */
+    CborWriter &Number(int64_t aNumber);
+
+    /**
+     * This method writes a CBOR boolean.
+     *
+     * @param[in] aValue  A boolean value.
+     *
+     * @returns A reference to this writer.
+     */
+    CborWriter &Bool(bool aValue);
+
+    /**
+     * This method writes a CBOR null.
+     *
+     * @returns A reference to this writer.
+     */
+    CborWriter &Null(void);
+
+private:
+    void WriteHead(uint8_t aMajorType, uint64_t aValue);
+
+    std::string &mOutput;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_CBOR_WRITER_HPP_
@@ -26,15 +26,25 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#define OTBR_LOG_TAG "REST"
+
 #include "rest/connection.hpp"
 
 #include <cerrno>
 
+#include <algorithm>
+
 #include <assert.h>
+#include <string.h>
 
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <sys/time.h>
 
+#include "common/mainloop_manager.hpp"
+#include "common/time.hpp"
+#include "common/trace.hpp"
+
 using std::chrono::duration_cast;
 using std::chrono::microseconds;
 using std::chrono::seconds;
@@ -52,174 +62,324 @@ static const uint32_t kCallbackCheckInterval = 500000;
 // The timeout (in microseconds) since a connection is in wait write state
 static const uint32_t kWriteTimeout = 10000000;
 
+// The maximum number of bytes read from the socket at a time
+static const size_t kReadSize = 2048;
+
+// The maximum size of a request, including the pipelined requests read along with it
+static const size_t kMaxRequestSize = 16384;
+
 // The timeout (in microseconds) since a connection is in wait read state
 static const uint32_t kReadTimeout = 1000000;
 
-Connection::Connection(steady_clock::time_point aStartTime, Resource *aResource, int aFd)
-    : mTimeStamp(aStartTime)
-    , mFd(aFd)
-    , mState(ConnectionState::kInit)
+// The timeout (in microseconds) since a persistent connection waits for the next request
+static const uint32_t kKeepAliveTimeout = 5000000;
+
+// The maximum number of requests served on a persistent connection
+static const uint32_t kMaxRequestsPerConnection = 100;
+
+// The interval (in microseconds) of writing a comment to an idle event stream to detect a closed client
+static const uint32_t kEventHeartbeatInterval = 15000000;
+
+// The maximum size of the events not yet written to an event stream before the client is disconnected
+static const size_t kMaxEventBufferSize = 65536;
+
+Connection::Connection(Resource         *aResource,
+                       ReadBufferPool   &aReadBufferPool,
+                       TaskRunner       &aTaskRunner,
+                       CompletionHandler aCompletionHandler)
+    : mFd(-1)
+    , mState(ConnectionState::kFree)
+    , mParsedLength(0)
+    , mRequest(mReadBuffer)
     , mParser(&mRequest)
     , mResource(aResource)
+    , mReadBufferPool(aReadBufferPool)
+    , mWriteOffset(0)
+    , mRequestCount(0)
+    , mKeepAlive(false)
+    , mIdle(false)
+    , mEventOverflow(false)
+    , mEventStream(nullptr)
+    , mEventStreamEnded(false)
+    , mTaskRunner(aTaskRunner)
+    , mTimer(0)
+    , mCompletionHandler(std::move(aCompletionHandler))
 {
+    memset(&mClientAddress, 0, sizeof(mClientAddress));
 }
 
 Connection::~Connection(void)
 {
+    // The server destroying its connections doesn't need to be told.
+    mCompletionHandler = nullptr;
     Disconnect();
 }
 
-void Connection::Init(void)
+void Connection::Init(steady_clock::time_point aStartTime, int aFd, const in6_addr &aClientAddress)
 {
+    mTimeStamp        = aStartTime;
+    mFd               = aFd;
+    mClientAddress    = aClientAddress;
+    mState            = ConnectionState::kInit;
+    mResponse         = Response();
+    mParsedLength     = 0;
+    mWriteOffset      = 0;
+    mRequestCount     = 0;
+    mKeepAlive        = false;
+    mIdle             = false;
+    mEventOverflow    = false;
+    mEventStreamEnded = false;
+    mRequest.Reset();
+    mWriteHeader.clear();
+    mEventBuffer.clear();
     mParser.Init();
+    SetTimer(kReadTimeout);
+
+    if (MainloopManager::GetInstance().AddFd(mFd, GetFdEvents(),
+                                             [this](uint8_t aEvents) { HandleFdEvents(aEvents); }) != OTBR_ERROR_NONE)
+    {
+        Disconnect();
+    }
 }
 
-void Connection::UpdateReadFdSet(fd_set &aReadFdSet, int &aMaxFd) const
+void Connection::Release(void)
 {
+    Disconnect();
+
+    // The capacity of the write buffers is kept for the next client, the body of the last response is freed.
+    mResponse = Response();
+    mState    = ConnectionState::kFree;
+}
+
+uint8_t Connection::GetFdEvents(void) const
+{
+    uint8_t events = 0;
+
     if (mState == ConnectionState::kReadWait || mState == ConnectionState::kInit)
     {
-        FD_SET(mFd, &aReadFdSet);
-        aMaxFd = aMaxFd < mFd ? mFd : aMaxFd;
+        events |= MainloopContext::kReadFdSet;
     }
+
+    if (mState == ConnectionState::kWriteWait || (mState == ConnectionState::kEventStream && !mEventBuffer.empty()))
+    {
+        events |= MainloopContext::kWriteFdSet;
+    }
+
+    return events;
 }
 
-void Connection::UpdateWriteFdSet(fd_set &aWriteFdSet, int &aMaxFd) const
+void Connection::UpdateFdEvents(void)
 {
-    if (mState == ConnectionState::kWriteWait)
+    // The socket is only given to the kernel again when the state changes what the connection waits for.
+    VerifyOrExit(mFd != -1);
+
+    if (MainloopManager::GetInstance().UpdateFd(mFd, GetFdEvents()) != OTBR_ERROR_NONE)
     {
-        FD_SET(mFd, &aWriteFdSet);
-        aMaxFd = aMaxFd < mFd ? mFd : aMaxFd;
+        otbrLogWarning("Failed to update the events of connection fd %d: %s", mFd, strerror(errno));
+        Disconnect();
     }
+
+exit:
+    return;
 }
 
-void Connection::UpdateTimeout(timeval &aTimeout) const
+void Connection::SetTimer(uint32_t aTimeout)
 {
-    struct timeval timeout;
-    uint32_t       timeoutLen = kReadTimeout;
-    auto           duration   = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+    StopTimer();
+
+    // The timer never fires early, a timeout is rounded up to the next millisecond.
+    mTimer = mTaskRunner.Post(Milliseconds((aTimeout + 999) / 1000), [this]() {
+        mTimer = 0;
+        HandleTimer();
+    });
+}
 
+void Connection::StopTimer(void)
+{
+    if (mTimer != 0)
+    {
+        mTaskRunner.Cancel(mTimer);
+        mTimer = 0;
+    }
+}
+
+void Connection::HandleTimer(void)
+{
     switch (mState)
     {
+    case ConnectionState::kInit:
     case ConnectionState::kReadWait:
-        timeoutLen = kReadTimeout;
+        if (mParsedLength < mReadBuffer.size())
+        {
+            // Handle the pipelined requests in the read buffer, which are read in time from here on.
+            SetTimer(kReadTimeout);
+            ProcessWaitRead(/* aReadable */ false);
+        }
+        else if (mIdle)
+        {
+            // The client doesn't send the next request in time, close the persistent connection silently.
+            Disconnect();
+        }
+        else
+        {
+            // Reach a read timeout, send a response about this timeout.
+            mKeepAlive = false;
+            mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusRequestTimeout);
+            Write();
+        }
         break;
     case ConnectionState::kCallbackWait:
-        timeoutLen = kCallbackCheckInterval;
+        ProcessWaitCallback();
         break;
     case ConnectionState::kWriteWait:
-        timeoutLen = kWriteTimeout;
+        Disconnect();
         break;
-    case ConnectionState::kComplete:
-        timeoutLen = 0;
+    case ConnectionState::kEventStream:
+        VerifyOrExit(!mEventOverflow, otbrLogWarning("Event stream client is too slow, disconnect it"), Disconnect());
+
+        // The connection of an ended stream is closed once the rest of the stream is written.
+        VerifyOrExit(!mEventStreamEnded || !mEventBuffer.empty(), Disconnect());
+
+        // A heartbeat keeps an idle stream open through proxies, and writing it detects a closed client.
+        if (mEventBuffer.empty())
+        {
+            mEventBuffer.append(mResponse.GetEventStream()->GetHeartbeat());
+        }
+        SetTimer(kEventHeartbeatInterval);
+        WriteEvents();
         break;
     default:
         break;
     }
 
-    if (duration <= timeoutLen)
-    {
-        timeout.tv_sec  = 0;
-        timeout.tv_usec = timeoutLen - duration;
-    }
-    else
+exit:
+    UpdateFdEvents();
+}
+
+void Connection::Disconnect(void)
+{
+    bool wasActive = mState != ConnectionState::kComplete && mState != ConnectionState::kFree;
+
+    if (mEventStream != nullptr)
     {
-        timeout.tv_sec  = 0;
-        timeout.tv_usec = 0;
+        mEventStream->Unsubscribe(*this);
+        mEventStream = nullptr;
     }
 
-    if (timercmp(&timeout, &aTimeout, <))
+    StopTimer();
+
+    if (wasActive && mCompletionHandler != nullptr)
     {
-        aTimeout = timeout;
+        mCompletionHandler(mFd);
     }
-}
 
-void Connection::Update(MainloopContext &aMainloop)
-{
-    UpdateTimeout(aMainloop.mTimeout);
-    UpdateReadFdSet(aMainloop.mReadFdSet, aMainloop.mMaxFd);
-    UpdateWriteFdSet(aMainloop.mWriteFdSet, aMainloop.mMaxFd);
-}
-
-void Connection::Disconnect(void)
-{
     mState = ConnectionState::kComplete;
+    mRequest.Reset();
+    mReadBufferPool.Release(mReadBuffer);
+    mParsedLength = 0;
 
     if (mFd != -1)
     {
+        MainloopManager::GetInstance().RemoveFd(mFd);
         close(mFd);
         mFd = -1;
     }
 }
 
-void Connection::Process(const MainloopContext &aMainloop)
+void Connection::HandleFdEvents(uint8_t aEvents)
 {
-    otbrError error = OTBR_ERROR_NONE;
-
     switch (mState)
     {
-    // Initial state, directly read for the first time.
     case ConnectionState::kInit:
     case ConnectionState::kReadWait:
-        ProcessWaitRead(aMainloop.mReadFdSet);
-        break;
-    case ConnectionState::kCallbackWait:
-        //  Wait for Callback process.
-        ProcessWaitCallback();
+        ProcessWaitRead(aEvents & MainloopContext::kReadFdSet);
         break;
     case ConnectionState::kWriteWait:
-        ProcessWaitWrite(aMainloop.mWriteFdSet);
+        ProcessWaitWrite(aEvents & MainloopContext::kWriteFdSet);
+        break;
+    case ConnectionState::kEventStream:
+        ProcessEventStream(aEvents & MainloopContext::kWriteFdSet);
+        break;
+    case ConnectionState::kCallbackWait:
+        // The callback is polled by the timer.
+    case ConnectionState::kComplete:
+    case ConnectionState::kFree:
         break;
     default:
         assert(false);
     }
 
-    if (error != OTBR_ERROR_NONE)
-    {
-        Disconnect();
-    }
+    UpdateFdEvents();
 }
 
-void Connection::ProcessWaitRead(const fd_set &aReadFdSet)
+void Connection::ProcessWaitRead(bool aReadable)
 {
     otbrError error    = OTBR_ERROR_NONE;
-    int32_t   received = 0, err;
-    char      buf[2048];
-    auto      duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+    int32_t   received = 0, err = 0;
 
-    // Reach a read timeout, will send response about this timeout later.
-    VerifyOrExit(duration <= kReadTimeout, error = OTBR_ERROR_REST);
-
-    // It will succeed either fd is set or it is in kInit state.
-    VerifyOrExit(FD_ISSET(mFd, &aReadFdSet) || mState == ConnectionState::kInit);
+    // Handle the pipelined requests which have been read first.
+    if (mParsedLength < mReadBuffer.size())
+    {
+        SuccessOrExit(error = Parse(mParsedLength, mReadBuffer.size() - mParsedLength));
+    }
 
-    do
+    if (!mRequest.IsComplete())
     {
-        mState   = ConnectionState::kReadWait;
-        received = read(mFd, buf, sizeof(buf));
-        err      = errno;
-        if (received > 0)
+        // It will succeed either fd is readable or it is in kInit state.
+        VerifyOrExit(aReadable || mState == ConnectionState::kInit);
+
+        if (mReadBuffer.capacity() == 0)
         {
-            mParser.Process(buf, received);
+            mReadBufferPool.Acquire(mReadBuffer);
         }
-    } while ((received > 0 && !mRequest.IsComplete()) || err == EINTR);
+
+        do
+        {
+            size_t length = mReadBuffer.size();
+
+            // The request is read into the buffer it's parsed from, which is limited to the maximum request size.
+            VerifyOrExit(length < kMaxRequestSize, error = OTBR_ERROR_PARSE);
+
+            mState = ConnectionState::kReadWait;
+            mReadBuffer.resize(length + std::min(kReadSize, kMaxRequestSize - length));
+            received = read(mFd, &mReadBuffer[length], mReadBuffer.size() - length);
+            err      = errno;
+            mReadBuffer.resize(length + static_cast<size_t>(received > 0 ? received : 0));
+            if (received > 0)
+            {
+                SuccessOrExit(error = Parse(length, static_cast<size_t>(received)));
+            }
+        } while ((received > 0 && !mRequest.IsComplete()) || (received == -1 && err == EINTR));
+
+        // The client closes the persistent connection between requests.
+        VerifyOrExit(received != 0 || !mIdle, Disconnect());
+
+        // Check first failure situation: received == 0 (indicate another side at least has closes its write side )
+        // and at the same time, the request has not been parsed completely.
+        VerifyOrExit(received != 0 || mRequest.IsComplete(), error = OTBR_ERROR_REST);
+
+        // Check second  failure situation : received = -1 error(indicates that our system call read raise an error )
+        // then try to send back a response that there is an internal error.
+        VerifyOrExit(received > 0 || (received == -1 && (err == EAGAIN || err == EWOULDBLOCK)),
+                     error = OTBR_ERROR_REST);
+    }
 
     if (mRequest.IsComplete())
     {
         Handle();
     }
 
-    // Check first failure situation: received == 0 (indicate another side at least has closes its write side )
-    // and at the same time, the request has not been parsed completely.
-    VerifyOrExit(received != 0 || mRequest.IsComplete(), error = OTBR_ERROR_REST);
-
-    // Check second  failure situation : received = -1 error(indicates that our system call read raise an error )
-    // then try to send back a response that there is an internal error.
-    VerifyOrExit(received > 0 || (received == -1 && (err == EAGAIN || err == EWOULDBLOCK)), error = OTBR_ERROR_REST);
-
 exit:
     if (error != OTBR_ERROR_NONE)
     {
-        if (received < 0)
+        mKeepAlive = false;
+
+        if (error == OTBR_ERROR_PARSE)
+        {
+            mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusBadRequest);
+            Write();
+        }
+        else if (received < 0)
         {
             mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
             Write();
@@ -232,20 +392,54 @@ exit:
     }
 }
 
+otbrError Connection::Parse(size_t aOffset, size_t aLength)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    size_t    parsed;
+
+    if (mIdle)
+    {
+        // The read timeout of the next request starts from its first byte.
+        mIdle      = false;
+        mTimeStamp = CoarseClock::Now();
+        SetTimer(kReadTimeout);
+    }
+
+    parsed = mParser.Process(mReadBuffer.data() + aOffset, aLength);
+    VerifyOrExit(parsed == aLength || mRequest.IsComplete(), error = OTBR_ERROR_PARSE);
+
+    // The pipelined requests following the complete request are kept in the buffer.
+    mParsedLength = aOffset + parsed;
+
+exit:
+    return error;
+}
+
 void Connection::Handle(void)
 {
     otbrError error = OTBR_ERROR_NONE;
 
-    // Try to close server read side here, because we have started to handle the request and no longler read from
-    // socket.
-    VerifyOrExit((shutdown(mFd, SHUT_RD) == 0), error = OTBR_ERROR_REST);
+    // One request is in flight per connection, the slice lasts until its response is written.
+    OTBR_TRACE_ASYNC_BEGIN("rest.request", reinterpret_cast<uintptr_t>(this));
 
-    mResource->Handle(mRequest, mResponse);
+    mRequestCount++;
+    mKeepAlive = mRequest.IsKeepAlive() && mRequestCount < kMaxRequestsPerConnection;
+
+    // Try to close server read side here if the connection is closed after this request, because we no longer read
+    // from socket.
+    VerifyOrExit(mKeepAlive || (shutdown(mFd, SHUT_RD) == 0), error = OTBR_ERROR_REST);
+
+    {
+        OTBR_TRACE_SCOPE("rest.handle");
+
+        mResource->Handle(mClientAddress, mRequest, mResponse);
+    }
 
     if (mResponse.NeedCallback())
     {
         mState     = ConnectionState::kCallbackWait;
-        mTimeStamp = steady_clock::now();
+        mTimeStamp = CoarseClock::Now();
+        SetTimer(kCallbackCheckInterval);
     }
     else
     {
@@ -257,83 +451,243 @@ exit:
 
     if (error != OTBR_ERROR_NONE)
     {
+        mKeepAlive = false;
         mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
         Write();
     }
 }
 
-void Connection::ProcessWaitCallback(void)
+void Connection::WaitNextRequest(void)
 {
-    auto duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+    mRequest.Reset();
+    mResponse = Response();
+    mWriteHeader.clear();
+    mWriteOffset = 0;
+    mParser.Resume();
+
+    // Drop the handled request, an idle connection returns its read buffer until the next request arrives.
+    mReadBuffer.erase(mReadBuffer.begin(), mReadBuffer.begin() + mParsedLength);
+    mParsedLength = 0;
+    if (mReadBuffer.empty())
+    {
+        mReadBufferPool.Release(mReadBuffer);
+    }
 
-    mResource->HandleCallback(mRequest, mResponse);
+    mState     = ConnectionState::kReadWait;
+    mTimeStamp = CoarseClock::Now();
+    mIdle      = mReadBuffer.empty();
 
-    if (mResponse.IsComplete())
+    // The pipelined requests already read are handled right away.
+    SetTimer(mIdle ? kKeepAliveTimeout : 0);
+}
+
+void Connection::StartEventStream(void)
+{
+    mState       = ConnectionState::kEventStream;
+    mTimeStamp   = CoarseClock::Now();
+    mWriteOffset = 0;
+    SetTimer(mEventStreamEnded ? 0 : kEventHeartbeatInterval);
+
+    // An event stream no longer reads requests.
+    mRequest.Reset();
+    mReadBufferPool.Release(mReadBuffer);
+    mParsedLength = 0;
+}
+
+void Connection::HandleEvent(const std::string &aEvent)
+{
+    VerifyOrExit(!mEventOverflow);
+
+    // The client is disconnected later by the timer, it can't unsubscribe while the event is being published.
+    VerifyOrExit(mEventBuffer.size() + aEvent.size() <= kMaxEventBufferSize, mEventOverflow = true, SetTimer(0));
+
+    // The first buffered event is written by the timer, which waits for the socket to be writable if it's full.
+    if (mEventBuffer.empty() && mState == ConnectionState::kEventStream)
     {
-        Write();
+        SetTimer(0);
     }
-    else
+    mEventBuffer.append(aEvent);
+
+exit:
+    return;
+}
+
+void Connection::HandleEventStreamEnd(void)
+{
+    mEventStream      = nullptr;
+    mEventStreamEnded = true;
+
+    // Before the stream starts, the end is handled once the response is written.
+    if (mState == ConnectionState::kEventStream)
     {
-        if (duration >= kCallbackTimeout)
-        {
-            mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
-            Write();
-        }
+        SetTimer(0);
     }
 }
 
-void Connection::ProcessWaitWrite(const fd_set &aWriteFdSet)
+void Connection::ProcessEventStream(bool aWritable)
 {
-    auto duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+    if (!mEventOverflow && !mEventBuffer.empty() && aWritable)
+    {
+        WriteEvents();
+    }
+}
+
+void Connection::WriteEvents(void)
+{
+    ssize_t sendLength;
+
+    do
+    {
+        sendLength = send(mFd, mEventBuffer.data() + mWriteOffset, mEventBuffer.size() - mWriteOffset, MSG_NOSIGNAL);
+    } while (sendLength < 0 && errno == EINTR);
 
-    if (duration <= kWriteTimeout)
+    if (sendLength > 0)
     {
-        if (FD_ISSET(mFd, &aWriteFdSet))
+        mWriteOffset += static_cast<size_t>(sendLength);
+
+        // The heartbeat interval starts from the last write.
+        mTimeStamp = CoarseClock::Now();
+        SetTimer(kEventHeartbeatInterval);
+
+        if (mWriteOffset == mEventBuffer.size())
         {
-            Write();
+            mEventBuffer.clear();
+            mWriteOffset = 0;
+
+            // The connection of an ended stream is closed once the rest of the stream is written.
+            if (mEventStreamEnded)
+            {
+                Disconnect();
+            }
         }
     }
-    else
+    else if (sendLength < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
     {
         Disconnect();
     }
 }
 
+void Connection::ProcessWaitCallback(void)
+{
+    auto duration = duration_cast<microseconds>(CoarseClock::Now() - mTimeStamp).count();
+
+    mResource->HandleCallback(mRequest, mResponse);
+
+    if (mResponse.IsComplete())
+    {
+        Write();
+    }
+    else if (duration >= kCallbackTimeout)
+    {
+        mKeepAlive = false;
+        mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
+        Write();
+    }
+    else
+    {
+        SetTimer(kCallbackCheckInterval);
+    }
+}
+
+void Connection::ProcessWaitWrite(bool aWritable)
+{
+    if (aWritable)
+    {
+        Write();
+    }
+}
+
 void Connection::Write(void)
 {
-    otbrError   error = OTBR_ERROR_NONE;
-    std::string errorCode;
-    int32_t     sendLength;
-    int32_t     err;
+    otbrError     error = OTBR_ERROR_NONE;
+    const char   *body;
+    size_t        bodyLength;
+    size_t        totalLength;
+    size_t        headerLength;
+    struct iovec  iov[2];
+    struct msghdr msg;
+    ssize_t       sendLength;
+    int           err;
 
     if (mState != ConnectionState::kWriteWait)
     {
         // Change its state when try write for the first time.
-        mState        = ConnectionState::kWriteWait;
-        mTimeStamp    = steady_clock::now();
-        mWriteContent = mResponse.Serialize();
+        mState     = ConnectionState::kWriteWait;
+        mTimeStamp = CoarseClock::Now();
+        SetTimer(kWriteTimeout);
+
+        // The events published while the response is written are buffered, so that none of them is missed.
+        if (mResponse.IsEventStream())
+        {
+            mKeepAlive   = false;
+            mEventStream = mResponse.GetEventStream();
+            mEventStream->Subscribe(*this);
+        }
+        mResponse.SetKeepAlive(mKeepAlive);
+#if OTBR_ENABLE_REST_COMPRESSION
+        mResponse.Compress(mRequest.GetHeaderValue(OT_REST_ACCEPT_ENCODING_HEADER));
+#endif
+        mResponse.SerializeHeaders(mWriteHeader);
+        mWriteOffset = 0;
     }
 
+    body         = mResponse.GetBody().data();
+    bodyLength   = mResponse.GetBody().size();
+    headerLength = mWriteHeader.size();
+    totalLength  = headerLength + bodyLength;
+
     // Check we do have something to write.
-    VerifyOrExit(mWriteContent.size() > 0, error = OTBR_ERROR_REST);
+    VerifyOrExit(mWriteOffset < totalLength, error = OTBR_ERROR_REST);
+
+    // Send the rest of the headers and the body in one call, so the body is never copied.
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = iov;
+    if (mWriteOffset < headerLength)
+    {
+        iov[msg.msg_iovlen].iov_base = const_cast<char *>(mWriteHeader.data() + mWriteOffset);
+        iov[msg.msg_iovlen].iov_len  = headerLength - mWriteOffset;
+        ++msg.msg_iovlen;
+    }
+    if (bodyLength > 0)
+    {
+        size_t bodyOffset = mWriteOffset > headerLength ? mWriteOffset - headerLength : 0;
+
+        iov[msg.msg_iovlen].iov_base = const_cast<char *>(body + bodyOffset);
+        iov[msg.msg_iovlen].iov_len  = bodyLength - bodyOffset;
+        ++msg.msg_iovlen;
+    }
 
-    sendLength = write(mFd, mWriteContent.c_str(), mWriteContent.size());
+    // MSG_NOSIGNAL keeps a peer closing the socket from raising SIGPIPE.
+    sendLength = sendmsg(mFd, &msg, MSG_NOSIGNAL);
     err        = errno;
 
-    // Write successfully
-    if (sendLength == static_cast<int32_t>(mWriteContent.size()))
+    if (sendLength > 0)
     {
-        // Normal Exit
-        Disconnect();
+        mWriteOffset += static_cast<size_t>(sendLength);
     }
-    else if (sendLength > 0)
+
+    // Write successfully
+    if (mWriteOffset == totalLength)
     {
-        // Partly write
-        mWriteContent = mWriteContent.substr(sendLength);
+        OTBR_TRACE_ASYNC_END("rest.request", reinterpret_cast<uintptr_t>(this));
+
+        // Normal Exit
+        if (mResponse.IsEventStream())
+        {
+            StartEventStream();
+        }
+        else if (mKeepAlive)
+        {
+            WaitNextRequest();
+        }
+        else
+        {
+            Disconnect();
+        }
     }
-    else
+    else if (sendLength < 0)
     {
-        if (errno == EINTR)
+        if (err == EINTR)
         {
             // Try again
             Write();
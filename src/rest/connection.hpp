@@ -39,8 +39,14 @@
 #include <string.h>
 #include <unistd.h>
 
-#include "common/mainloop.hpp"
+#include <netinet/in.h>
+
+#include <functional>
+
+#include "common/task_runner.hpp"
+#include "rest/event_stream.hpp"
 #include "rest/parser.hpp"
+#include "rest/read_buffer_pool.hpp"
 #include "rest/resource.hpp"
 
 using std::chrono::steady_clock;
@@ -50,34 +56,60 @@ namespace rest {
 
 /**
  * This class implements a Connection class of each socket connection.
+ *
+ * The socket is registered persistently to the mainloop manager, the timeout of the current state is a timer of the
+ * server's task runner, and the completion is reported to the server, so an idle connection costs nothing until one
+ * of its events happens.
  */
-class Connection : public MainloopProcessor
+class Connection : private EventStream::Subscriber
 {
 public:
     /**
-     * The constructor is to initialize a socket connection instance.
+     * This function is called when a connection completes, with the file descriptor it had, before it's closed.
+     */
+    using CompletionHandler = std::function<void(int aFd)>;
+
+    /**
+     * The constructor is to initialize a socket connection instance, which is free until it's initialized.
      *
-     * @param[in] aStartTime  The reference start time of a connection which
-     *                        is set when created for the first time and maybe
-     *                        reset when transfer to wait callback or wait write
-     *                        state.
-     * @param[in] aResource   A pointer to the resource handler.
-     * @param[in] aFd         The file descriptor for the connection.
+     * @param[in] aResource           A pointer to the resource handler.
+     * @param[in] aReadBufferPool     A reference to the pool of read buffers.
+     * @param[in] aTaskRunner         A reference to the task runner of the timeouts.
+     * @param[in] aCompletionHandler  The handler called when the connection completes.
      */
-    Connection(steady_clock::time_point aStartTime, Resource *aResource, int aFd);
+    Connection(Resource         *aResource,
+               ReadBufferPool   &aReadBufferPool,
+               TaskRunner       &aTaskRunner,
+               CompletionHandler aCompletionHandler);
 
     /**
      * The desctructor destroys the connection instance.
      */
-    ~Connection(void) override;
+    ~Connection(void);
 
     /**
-     * This method initializes the connection.
+     * This method initializes the connection for a client.
+     *
+     * @param[in] aStartTime      The reference start time of a connection which
+     *                            is set when created for the first time and maybe
+     *                            reset when transfer to wait callback or wait write
+     *                            state.
+     * @param[in] aFd             The file descriptor for the connection.
+     * @param[in] aClientAddress  The address of the client.
      */
-    void Init(void);
+    void Init(steady_clock::time_point aStartTime, int aFd, const in6_addr &aClientAddress);
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    /**
+     * This method releases the connection, which is no longer processed until it's initialized for another client.
+     */
+    void Release(void);
+
+    /**
+     * This method returns the address of the client.
+     *
+     * @returns The address of the client, which is IPv4-mapped for an IPv4 client.
+     */
+    const in6_addr &GetClientAddress(void) const { return mClientAddress; }
 
     /**
      * This method indicates whether this connection no longer need to be processed.
@@ -88,15 +120,25 @@ public:
     bool IsComplete(void) const;
 
 private:
-    void UpdateReadFdSet(fd_set &aReadFdSet, int &aMaxFd) const;
-    void UpdateWriteFdSet(fd_set &aWriteFdSet, int &aMaxFd) const;
-    void UpdateTimeout(timeval &aTimeout) const;
-    void ProcessWaitRead(const fd_set &aReadFdSet);
-    void ProcessWaitCallback(void);
-    void ProcessWaitWrite(const fd_set &aWriteFdSet);
-    void Write(void);
-    void Handle(void);
-    void Disconnect(void);
+    uint8_t   GetFdEvents(void) const;
+    void      UpdateFdEvents(void);
+    void      HandleFdEvents(uint8_t aEvents);
+    void      SetTimer(uint32_t aTimeout);
+    void      StopTimer(void);
+    void      HandleTimer(void);
+    void      ProcessWaitRead(bool aReadable);
+    void      ProcessWaitCallback(void);
+    void      ProcessWaitWrite(bool aWritable);
+    otbrError Parse(size_t aOffset, size_t aLength);
+    void      Write(void);
+    void      Handle(void);
+    void      WaitNextRequest(void);
+    void      StartEventStream(void);
+    void      ProcessEventStream(bool aWritable);
+    void      WriteEvents(void);
+    void      HandleEvent(const std::string &aEvent) override;
+    void      HandleEventStreamEnd(void) override;
+    void      Disconnect(void);
 
     // Timestamp used for each check point of a connection
     steady_clock::time_point mTimeStamp;
@@ -104,13 +146,22 @@ private:
     // File descriptor for this connection
     int mFd;
 
+    // Address of the client of this connection
+    in6_addr mClientAddress;
+
     // Enum indicates the state of this connection
     ConnectionState mState;
 
     // Response instance binded to this connection
     Response mResponse;
 
-    // Request instance binded to this connection
+    // Read buffer of the request being parsed or handled, followed by the pipelined requests
+    std::vector<char> mReadBuffer;
+
+    // Number of bytes of the read buffer already parsed
+    size_t mParsedLength;
+
+    // Request instance binded to this connection, which refers to the read buffer
     Request mRequest;
 
     // HTTP parser instance
@@ -119,8 +170,39 @@ private:
     // Resource handler instance
     Resource *mResource;
 
-    // Write buffer in case write multiple times
-    std::string mWriteContent;
+    // Pool which the read buffer is acquired from and released to
+    ReadBufferPool &mReadBufferPool;
+
+    // Status line and headers of the response being written, the body is written from the response directly
+    std::string mWriteHeader;
+
+    // Number of bytes of the headers and body already written
+    size_t mWriteOffset;
+
+    // Number of requests handled on this connection
+    uint32_t mRequestCount;
+
+    // Whether this connection is kept alive after the current response
+    bool mKeepAlive;
+
+    // Whether this persistent connection is waiting for the first byte of the next request
+    bool mIdle;
+
+    // Events not yet written to an event stream, mWriteOffset bytes of which have been written
+    std::string mEventBuffer;
+
+    // Whether the client of an event stream doesn't read the events fast enough
+    bool mEventOverflow;
+
+    // The stream subscribed since the response starting it is written, and whether the stream has ended
+    EventStream *mEventStream;
+    bool         mEventStreamEnded;
+
+    // Task runner of the timer of the current state, and the ID of the timer or 0 if not set
+    TaskRunner        &mTaskRunner;
+    TaskRunner::TaskId mTimer;
+    // Handler notified when the connection completes
+    CompletionHandler mCompletionHandler;
 };
 
 } // namespace rest
@@ -0,0 +1,210 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the compact store of network diagnostics for RESTful HTTP server.
+ */
+
+#include "rest/diag_store.hpp"
+
+#include <assert.h>
+#include <string.h>
+
+#include "rest/json.hpp"
+
+namespace otbr {
+namespace rest {
+
+const DiagStore::Node &DiagStore::Update(const std::string                   &aKey,
+                                         const std::vector<otNetworkDiagTlv> &aTlvs,
+                                         Timepoint                            aNow)
+{
+    Node                         &node = mNodes[aKey];
+    std::vector<otNetworkDiagTlv> tlvs;
+
+    GetTlvs(node, tlvs);
+
+    // A response to a selective query only carries some TLVs, so the others received before are kept.
+    for (const otNetworkDiagTlv &diagTlv : aTlvs)
+    {
+        auto it = tlvs.begin();
+
+        while (it != tlvs.end() && it->mType != diagTlv.mType)
+        {
+            ++it;
+        }
+
+        if (it != tlvs.end())
+        {
+            *it = diagTlv;
+        }
+        else
+        {
+            tlvs.push_back(diagTlv);
+        }
+    }
+
+    node.mPacked.clear();
+    for (const otNetworkDiagTlv &diagTlv : tlvs)
+    {
+        Pack(diagTlv, node.mPacked);
+    }
+    node.mPacked.shrink_to_fit();
+    node.mUpdateTime = aNow;
+    node.mJson       = Json::DiagTlvs2JsonString(tlvs);
+
+    mExpiryQueue.emplace_back(aNow, aKey);
+    if (mExpiryQueue.size() > 2 * mNodes.size())
+    {
+        CompactExpiryQueue();
+    }
+
+    return node;
+}
+
+uint32_t DiagStore::RemoveExpired(Timepoint aDeadline)
+{
+    uint32_t removed = 0;
+
+    while (!mExpiryQueue.empty() && mExpiryQueue.front().first <= aDeadline)
+    {
+        auto it = mNodes.find(mExpiryQueue.front().second);
+
+        // The node may have been updated after this entry was queued.
+        if (it != mNodes.end() && it->second.mUpdateTime <= aDeadline)
+        {
+            mNodes.erase(it);
+            ++removed;
+        }
+
+        mExpiryQueue.pop_front();
+    }
+
+    return removed;
+}
+
+void DiagStore::CompactExpiryQueue(void)
+{
+    std::deque<std::pair<Timepoint, std::string>> queue;
+
+    for (auto &entry : mExpiryQueue)
+    {
+        auto it = mNodes.find(entry.second);
+
+        if (it != mNodes.end() && it->second.mUpdateTime == entry.first)
+        {
+            queue.push_back(std::move(entry));
+        }
+    }
+
+    mExpiryQueue.swap(queue);
+}
+
+void DiagStore::GetTlvs(const Node &aNode, std::vector<otNetworkDiagTlv> &aTlvs)
+{
+    size_t offset = 0;
+
+    aTlvs.clear();
+    while (offset < aNode.mPacked.size())
+    {
+        aTlvs.emplace_back();
+        Unpack(aNode.mPacked, offset, aTlvs.back());
+    }
+}
+
+MemoryUsage DiagStore::GetMemoryUsage(void) const
+{
+    MemoryUsage usage;
+
+    usage.mEntries = static_cast<uint32_t>(mNodes.size());
+    usage.mBytes   = EstimateHeapBytes(mNodes) + mExpiryQueue.size() * sizeof(mExpiryQueue.front());
+
+    for (const auto &node : mNodes)
+    {
+        usage.mBytes += EstimateHeapBytes(node.second.mPacked) + EstimateHeapBytes(node.second.mJson);
+    }
+
+    return usage;
+}
+
+void DiagStore::Pack(const otNetworkDiagTlv &aTlv, std::vector<uint8_t> &aPacked)
+{
+    // Each zero byte is followed by the number of zero bytes in its run, other bytes are copied as they are.
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&aTlv);
+    size_t         index = 0;
+
+    while (index < sizeof(aTlv))
+    {
+        if (bytes[index] != 0)
+        {
+            aPacked.push_back(bytes[index++]);
+        }
+        else
+        {
+            uint8_t run = 0;
+
+            while (index < sizeof(aTlv) && bytes[index] == 0 && run < UINT8_MAX)
+            {
+                ++index;
+                ++run;
+            }
+
+            aPacked.push_back(0);
+            aPacked.push_back(run);
+        }
+    }
+}
+
+void DiagStore::Unpack(const std::vector<uint8_t> &aPacked, size_t &aOffset, otNetworkDiagTlv &aTlv)
+{
+    uint8_t *bytes = reinterpret_cast<uint8_t *>(&aTlv);
+    size_t   index = 0;
+
+    while (index < sizeof(aTlv))
+    {
+        assert(aOffset < aPacked.size());
+
+        if (aPacked[aOffset] != 0)
+        {
+            bytes[index++] = aPacked[aOffset++];
+        }
+        else
+        {
+            uint8_t run = aPacked[aOffset + 1];
+
+            assert(index + run <= sizeof(aTlv));
+            memset(bytes + index, 0, run);
+            index += run;
+            aOffset += 2;
+        }
+    }
+}
+
+} // namespace rest
+} // namespace otbr
@@ -0,0 +1,138 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the compact store of network diagnostics for RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_DIAG_STORE_HPP_
+#define OTBR_REST_DIAG_STORE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <stdint.h>
+
+#include <openthread/netdiag.h>
+
+#include "common/memory_usage.hpp"
+#include "common/time.hpp"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class stores the latest diagnostic TLVs of each node.
+ *
+ * `otNetworkDiagTlv` is a union sized for its largest list, while most TLVs only use a few bytes of it. The TLVs of a
+ * node are packed in one byte buffer, in which runs of zero bytes are encoded by their length, and are unpacked only
+ * when they are read. Nodes are evicted in the order of their last update from an expiry queue, so a sweep only
+ * visits the expired nodes.
+ */
+class DiagStore
+{
+public:
+    /**
+     * This structure represents the diagnostics of a node.
+     */
+    struct Node
+    {
+        Timepoint            mUpdateTime; ///< The time of the last update.
+        std::vector<uint8_t> mPacked;     ///< The packed TLVs.
+        std::string          mJson;       ///< The TLVs serialized as a Json object.
+    };
+
+    /**
+     * This method merges diagnostic TLVs into the TLVs of a node, replacing the TLVs of the same types.
+     *
+     * @param[in] aKey   The key of the node.
+     * @param[in] aTlvs  The received TLVs.
+     * @param[in] aNow   The current time, which never decreases between calls.
+     *
+     * @returns The updated node.
+     */
+    const Node &Update(const std::string &aKey, const std::vector<otNetworkDiagTlv> &aTlvs, Timepoint aNow);
+
+    /**
+     * This method removes the nodes not updated after a deadline.
+     *
+     * @param[in] aDeadline  The time up to which the nodes are expired.
+     *
+     * @returns The number of removed nodes.
+     */
+    uint32_t RemoveExpired(Timepoint aDeadline);
+
+    /**
+     * This method unpacks the TLVs of a node.
+     *
+     * @param[in]  aNode  The node.
+     * @param[out] aTlvs  The TLVs of the node.
+     */
+    static void GetTlvs(const Node &aNode, std::vector<otNetworkDiagTlv> &aTlvs);
+
+    /**
+     * This method calls a function with the key and the node of each stored node.
+     *
+     * @param[in] aFunc  The function, called as `aFunc(const std::string &, const Node &)`.
+     */
+    template <typename Func> void ForEach(Func &&aFunc) const
+    {
+        for (const auto &entry : mNodes)
+        {
+            aFunc(entry.first, entry.second);
+        }
+    }
+
+    /**
+     * This method returns the memory used by the stored nodes.
+     *
+     * @returns The number of nodes and their estimated heap bytes.
+     */
+    MemoryUsage GetMemoryUsage(void) const;
+
+private:
+    static void Pack(const otNetworkDiagTlv &aTlv, std::vector<uint8_t> &aPacked);
+    static void Unpack(const std::vector<uint8_t> &aPacked, size_t &aOffset, otNetworkDiagTlv &aTlv);
+
+    void CompactExpiryQueue(void);
+
+    std::unordered_map<std::string, Node> mNodes;
+    // The update time and key of the nodes in the order of updates, entries older than the node are skipped.
+    std::deque<std::pair<Timepoint, std::string>> mExpiryQueue;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_DIAG_STORE_HPP_
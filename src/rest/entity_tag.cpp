@@ -0,0 +1,121 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the entity tags validating cached response bodies of the RESTful HTTP server.
+ */
+
+#include "rest/entity_tag.hpp"
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace rest {
+namespace EntityTag {
+
+// Returns the opaque tag of an entity tag, which is the same for its weak and strong forms.
+static StringView GetOpaqueTag(const StringView &aEntityTag)
+{
+    bool weak = aEntityTag.Size() >= 2 && aEntityTag[0] == 'W' && aEntityTag[1] == '/';
+
+    return weak ? aEntityTag.Substr(2) : aEntityTag;
+}
+
+std::string Generate(const std::string &aBody)
+{
+    // The FNV-1a hash of the body
+    uint64_t hash = 14695981039346656037ull;
+    char     tag[sizeof("\"0123456789abcdef\"")];
+
+    for (char c : aBody)
+    {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 1099511628211ull;
+    }
+
+    snprintf(tag, sizeof(tag), "\"%016llx\"", static_cast<unsigned long long>(hash));
+
+    return tag;
+}
+
+bool Matches(const StringView &aIfNoneMatch, const std::string &aEntityTag)
+{
+    bool       matched = false;
+    StringView opaque  = GetOpaqueTag(aEntityTag);
+    size_t     start   = 0;
+
+    VerifyOrExit(!opaque.IsEmpty());
+    VerifyOrExit(aIfNoneMatch.TrimSpaces() != "*", matched = true);
+
+    while (!matched && start < aIfNoneMatch.Size())
+    {
+        size_t end = aIfNoneMatch.Find(',', start);
+
+        if (end == std::string::npos)
+        {
+            end = aIfNoneMatch.Size();
+        }
+
+        matched = GetOpaqueTag(aIfNoneMatch.Substr(start, end - start).TrimSpaces()) == opaque;
+        start   = end + 1;
+    }
+
+exit:
+    return matched;
+}
+
+void Respond(const StringView  &aIfNoneMatch,
+             const std::string &aEntityTag,
+             const std::string &aBody,
+             Response          &aResponse)
+{
+    std::string body;
+    std::string code;
+
+    aResponse.SetHeader(OT_REST_ETAG_HEADER, aEntityTag);
+
+    if (Matches(aIfNoneMatch, aEntityTag))
+    {
+        code = OT_REST_HTTP_STATUS_304;
+    }
+    else
+    {
+        body = aBody;
+        code = OT_REST_HTTP_STATUS_200;
+    }
+
+    aResponse.SetBody(body);
+    aResponse.SetResponsCode(code);
+}
+
+} // namespace EntityTag
+} // namespace rest
+} // namespace otbr
@@ -0,0 +1,90 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the entity tags validating cached response bodies of the RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_ENTITY_TAG_HPP_
+#define OTBR_REST_ENTITY_TAG_HPP_
+
+#include "openthread-br/config.h"
+
+#include <string>
+
+#include "common/string_view.hpp"
+#include "rest/response.hpp"
+
+namespace otbr {
+namespace rest {
+namespace EntityTag {
+
+/**
+ * This function generates the strong entity tag of a body.
+ *
+ * The tag is a hash of the body, so it only changes with the body and stays the same across restarts.
+ *
+ * @param[in] aBody  The body.
+ *
+ * @returns The quoted entity tag.
+ */
+std::string Generate(const std::string &aBody);
+
+/**
+ * This function indicates whether an If-None-Match header matches an entity tag.
+ *
+ * The header is `*` or a list of entity tags, which are compared to @p aEntityTag with the weak comparison, so a weak
+ * tag, e.g. of a compressed body, matches its strong tag.
+ *
+ * @param[in] aIfNoneMatch  The value of the If-None-Match header, empty if it's absent.
+ * @param[in] aEntityTag    The entity tag of the current body.
+ *
+ * @retval TRUE   The header matches, the client has the current body.
+ * @retval FALSE  The header doesn't match or is absent.
+ */
+bool Matches(const StringView &aIfNoneMatch, const std::string &aEntityTag);
+
+/**
+ * This function sets a body and its entity tag to a response, or 304 Not Modified if the client has the body.
+ *
+ * @param[in]     aIfNoneMatch  The value of the If-None-Match header of the request.
+ * @param[in]     aEntityTag    The entity tag of @p aBody.
+ * @param[in]     aBody         The body.
+ * @param[in,out] aResponse     The response.
+ */
+void Respond(const StringView  &aIfNoneMatch,
+             const std::string &aEntityTag,
+             const std::string &aBody,
+             Response          &aResponse);
+
+} // namespace EntityTag
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_ENTITY_TAG_HPP_
@@ -0,0 +1,87 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rest/event_stream.hpp"
+
+#include <algorithm>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace rest {
+
+void EventStream::Subscribe(Subscriber &aSubscriber)
+{
+    mSubscribers.push_back(&aSubscriber);
+}
+
+void EventStream::Unsubscribe(Subscriber &aSubscriber)
+{
+    mSubscribers.erase(std::remove(mSubscribers.begin(), mSubscribers.end(), &aSubscriber), mSubscribers.end());
+}
+
+void EventStream::Publish(const char *aName, const std::string &aData)
+{
+    VerifyOrExit(!mSubscribers.empty());
+
+    // The buffer is kept across events, so publishing doesn't allocate once it's large enough.
+    mEvent.clear();
+    Format(mEvent, aName, aData);
+    PublishText(mEvent);
+
+exit:
+    return;
+}
+
+void EventStream::PublishText(const std::string &aText)
+{
+    for (Subscriber *subscriber : mSubscribers)
+    {
+        subscriber->HandleEvent(aText);
+    }
+}
+
+void EventStream::End(void)
+{
+    std::vector<Subscriber *> subscribers;
+
+    // The subscribers are removed first, so that none of them is notified twice.
+    subscribers.swap(mSubscribers);
+    for (Subscriber *subscriber : subscribers)
+    {
+        subscriber->HandleEventStreamEnd();
+    }
+}
+
+void EventStream::Format(std::string &aOutput, const char *aName, const std::string &aData)
+{
+    aOutput.append("event: ").append(aName).append("\ndata: ").append(aData).append("\n\n");
+}
+
+} // namespace rest
+} // namespace otbr
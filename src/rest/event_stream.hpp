@@ -0,0 +1,159 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes Server-Sent Events stream definition for RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_EVENT_STREAM_HPP_
+#define OTBR_REST_EVENT_STREAM_HPP_
+
+#include "openthread-br/config.h"
+
+#include <string>
+#include <vector>
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class implements a stream of Server-Sent Events which are published to all subscribers.
+ *
+ * A stream may also carry other streamed bodies, such as chunked NDJSON, published as they are and ended by the
+ * publisher.
+ */
+class EventStream
+{
+public:
+    /**
+     * This class represents a subscriber of events.
+     */
+    class Subscriber
+    {
+    public:
+        virtual ~Subscriber(void) = default;
+
+        /**
+         * This method handles an event.
+         *
+         * The subscriber must not subscribe or unsubscribe within this method.
+         *
+         * @param[in] aEvent  The event formatted as Server-Sent Events text.
+         */
+        virtual void HandleEvent(const std::string &aEvent) = 0;
+
+        /**
+         * This method handles the end of the stream, the subscriber is already removed from the stream.
+         *
+         * The subscriber must not subscribe or unsubscribe within this method.
+         */
+        virtual void HandleEventStreamEnd(void) = 0;
+    };
+
+    /**
+     * This constructor initializes the stream.
+     *
+     * @param[in] aHeartbeat  The text written to an idle subscriber to keep its connection open, which must not
+     *                        change the meaning of the stream.
+     */
+    explicit EventStream(const char *aHeartbeat = ":\n\n")
+        : mHeartbeat(aHeartbeat)
+    {
+    }
+
+    /**
+     * This method returns the heartbeat text of the stream.
+     *
+     * @returns The heartbeat text.
+     */
+    const char *GetHeartbeat(void) const { return mHeartbeat; }
+
+    /**
+     * This method adds a subscriber.
+     *
+     * @param[in] aSubscriber  The subscriber, which must be unsubscribed before it's destroyed.
+     */
+    void Subscribe(Subscriber &aSubscriber);
+
+    /**
+     * This method removes a subscriber.
+     *
+     * @param[in] aSubscriber  The subscriber.
+     */
+    void Unsubscribe(Subscriber &aSubscriber);
+
+    /**
+     * This method indicates whether there is any subscriber.
+     *
+     * Publishers could check this first to skip serializing the data of an event.
+     *
+     * @retval TRUE   There is at least one subscriber.
+     * @retval FALSE  There is no subscriber.
+     */
+    bool HasSubscribers(void) const { return !mSubscribers.empty(); }
+
+    /**
+     * This method publishes an event to all subscribers.
+     *
+     * @param[in] aName  The name of the event.
+     * @param[in] aData  The data of the event, which must be a single line such as serialized Json.
+     */
+    void Publish(const char *aName, const std::string &aData);
+
+    /**
+     * This method publishes text to all subscribers as it is.
+     *
+     * @param[in] aText  The text, which must be a complete unit of the stream, e.g. a chunk.
+     */
+    void PublishText(const std::string &aText);
+
+    /**
+     * This method ends the stream, all subscribers are notified and removed.
+     */
+    void End(void);
+
+    /**
+     * This method formats an event as Server-Sent Events text.
+     *
+     * @param[out] aOutput  A string the event is appended to.
+     * @param[in]  aName    The name of the event.
+     * @param[in]  aData    The data of the event, which must be a single line such as serialized Json.
+     */
+    static void Format(std::string &aOutput, const char *aName, const std::string &aData);
+
+private:
+    const char               *mHeartbeat;
+    std::vector<Subscriber *> mSubscribers;
+    std::string               mEvent;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_EVENT_STREAM_HPP_
@@ -27,10 +27,17 @@
  */
 
 #include "rest/json.hpp"
-#include <sstream>
+
+#include <limits>
+
+#include <stdio.h>
+#include <string.h>
 
 #include "common/code_utils.hpp"
 #include "common/types.hpp"
+#include "rest/cbor_writer.hpp"
+#include "rest/json_reader.hpp"
+#include "rest/json_writer.hpp"
 
 extern "C" {
 #include <cJSON.h>
@@ -40,889 +47,1132 @@ namespace otbr {
 namespace rest {
 namespace Json {
 
-static cJSON *Bytes2HexJson(const uint8_t *aBytes, uint8_t aLength)
-{
-    char hex[2 * aLength + 1];
-
-    otbr::Utils::Bytes2Hex(aBytes, aLength, hex);
-    hex[2 * aLength] = '\0';
-
-    return cJSON_CreateString(hex);
-}
+using Token = JsonReader::Token;
 
 std::string String2JsonString(const std::string &aString)
 {
     std::string ret;
-    cJSON      *json    = nullptr;
-    char       *jsonOut = nullptr;
 
     VerifyOrExit(aString.size() > 0);
-
-    json    = cJSON_CreateString(aString.c_str());
-    jsonOut = cJSON_Print(json);
-    ret     = jsonOut;
-    if (jsonOut != nullptr)
-    {
-        cJSON_free(jsonOut);
-        jsonOut = nullptr;
-    }
-
-    cJSON_Delete(json);
+    JsonWriter(ret).String(aString.c_str(), aString.size());
 
 exit:
     return ret;
 }
 
-bool JsonString2String(const std::string &aJsonString, std::string &aString)
+bool JsonString2String(const StringView &aJsonString, std::string &aString)
 {
-    cJSON *jsonString;
-    bool   ret = true;
-
-    VerifyOrExit((jsonString = cJSON_Parse(aJsonString.c_str())) != nullptr, ret = false);
-    VerifyOrExit(cJSON_IsString(jsonString), ret = false);
+    JsonReader reader(aJsonString);
+    bool       ret = false;
 
-    aString = std::string(jsonString->valuestring);
+    VerifyOrExit(reader.Next() == Token::kString);
+    aString.assign(reader.GetString(), reader.GetStringLength());
+    VerifyOrExit(reader.Next() == Token::kEnd);
+    ret = true;
 
 exit:
-    cJSON_Delete(jsonString);
-
     return ret;
 }
 
-std::string Json2String(const cJSON *aJson)
+template <typename Writer> static void IpAddr2Json(Writer &aWriter, const otIp6Address &aAddress)
 {
-    std::string ret;
-    char       *jsonOut = nullptr;
-
-    VerifyOrExit(aJson != nullptr);
+    aWriter.String(Ip6Address(aAddress).ToInfoString().AsCString());
+}
 
-    jsonOut = cJSON_Print(aJson);
-    ret     = jsonOut;
-    if (jsonOut != nullptr)
-    {
-        cJSON_free(jsonOut);
-        jsonOut = nullptr;
-    }
+static void IpPrefix2Json(JsonWriter &aWriter, const otIp6NetworkPrefix &aAddress)
+{
+    Ip6Prefix prefix;
 
-exit:
-    return ret;
+    memcpy(prefix.mPrefix.m8, aAddress.m8, sizeof(aAddress.m8));
+    prefix.mLength = OT_IP6_PREFIX_BITSIZE;
+    aWriter.String(prefix.ToInfoString().AsCString());
 }
 
-static cJSON *CString2Json(const char *aString)
+template <typename Writer> static void Mode2Json(Writer &aWriter, const otLinkModeConfig &aMode)
 {
-    return cJSON_CreateString(aString);
+    aWriter.BeginObject();
+    aWriter.Key("RxOnWhenIdle").Number(aMode.mRxOnWhenIdle);
+    aWriter.Key("DeviceType").Number(aMode.mDeviceType);
+    aWriter.Key("NetworkData").Number(aMode.mNetworkData);
+    aWriter.EndObject();
 }
 
-static cJSON *Mode2Json(const otLinkModeConfig &aMode)
+static void Timestamp2Json(JsonWriter &aWriter, const otTimestamp &aTimestamp)
 {
-    cJSON *mode = cJSON_CreateObject();
+    aWriter.BeginObject();
+    aWriter.Key("Seconds").Number(static_cast<int64_t>(aTimestamp.mSeconds));
+    aWriter.Key("Ticks").Number(aTimestamp.mTicks);
+    aWriter.Key("Authoritative").Bool(aTimestamp.mAuthoritative);
+    aWriter.EndObject();
+}
 
-    cJSON_AddItemToObject(mode, "RxOnWhenIdle", cJSON_CreateNumber(aMode.mRxOnWhenIdle));
-    cJSON_AddItemToObject(mode, "DeviceType", cJSON_CreateNumber(aMode.mDeviceType));
-    cJSON_AddItemToObject(mode, "NetworkData", cJSON_CreateNumber(aMode.mNetworkData));
+static void SecurityPolicy2Json(JsonWriter &aWriter, const otSecurityPolicy &aSecurityPolicy)
+{
+    aWriter.BeginObject();
+    aWriter.Key("RotationTime").Number(aSecurityPolicy.mRotationTime);
+    aWriter.Key("ObtainNetworkKey").Bool(aSecurityPolicy.mObtainNetworkKeyEnabled);
+    aWriter.Key("NativeCommissioning").Bool(aSecurityPolicy.mNativeCommissioningEnabled);
+    aWriter.Key("Routers").Bool(aSecurityPolicy.mRoutersEnabled);
+    aWriter.Key("ExternalCommissioning").Bool(aSecurityPolicy.mExternalCommissioningEnabled);
+    aWriter.Key("CommercialCommissioning").Bool(aSecurityPolicy.mCommercialCommissioningEnabled);
+    aWriter.Key("AutonomousEnrollment").Bool(aSecurityPolicy.mAutonomousEnrollmentEnabled);
+    aWriter.Key("NetworkKeyProvisioning").Bool(aSecurityPolicy.mNetworkKeyProvisioningEnabled);
+    aWriter.Key("TobleLink").Bool(aSecurityPolicy.mTobleLinkEnabled);
+    aWriter.Key("NonCcmRouters").Bool(aSecurityPolicy.mNonCcmRoutersEnabled);
+    aWriter.EndObject();
+}
 
-    return mode;
+template <typename Writer> static void ChildTableEntry2Json(Writer &aWriter, const otNetworkDiagChildEntry &aChildEntry)
+{
+    aWriter.BeginObject();
+    aWriter.Key("ChildId").Number(aChildEntry.mChildId);
+    aWriter.Key("Timeout").Number(aChildEntry.mTimeout);
+    aWriter.Key("Mode");
+    Mode2Json(aWriter, aChildEntry.mMode);
+    aWriter.EndObject();
 }
 
-static cJSON *IpAddr2Json(const otIp6Address &aAddress)
+template <typename Writer> static void MacCounters2Json(Writer &aWriter, const otNetworkDiagMacCounters &aMacCounters)
 {
-    Ip6Address addr(aAddress.mFields.m8);
+    aWriter.BeginObject();
+    aWriter.Key("IfInUnknownProtos").Number(aMacCounters.mIfInUnknownProtos);
+    aWriter.Key("IfInErrors").Number(aMacCounters.mIfInErrors);
+    aWriter.Key("IfOutErrors").Number(aMacCounters.mIfOutErrors);
+    aWriter.Key("IfInUcastPkts").Number(aMacCounters.mIfInUcastPkts);
+    aWriter.Key("IfInBroadcastPkts").Number(aMacCounters.mIfInBroadcastPkts);
+    aWriter.Key("IfInDiscards").Number(aMacCounters.mIfInDiscards);
+    aWriter.Key("IfOutUcastPkts").Number(aMacCounters.mIfOutUcastPkts);
+    aWriter.Key("IfOutBroadcastPkts").Number(aMacCounters.mIfOutBroadcastPkts);
+    aWriter.Key("IfOutDiscards").Number(aMacCounters.mIfOutDiscards);
+    aWriter.EndObject();
+}
 
-    return cJSON_CreateString(addr.ToString().c_str());
+template <typename Writer>
+static void Connectivity2Json(Writer &aWriter, const otNetworkDiagConnectivity &aConnectivity)
+{
+    aWriter.BeginObject();
+    aWriter.Key("ParentPriority").Number(aConnectivity.mParentPriority);
+    aWriter.Key("LinkQuality3").Number(aConnectivity.mLinkQuality3);
+    aWriter.Key("LinkQuality2").Number(aConnectivity.mLinkQuality2);
+    aWriter.Key("LinkQuality1").Number(aConnectivity.mLinkQuality1);
+    aWriter.Key("LeaderCost").Number(aConnectivity.mLeaderCost);
+    aWriter.Key("IdSequence").Number(aConnectivity.mIdSequence);
+    aWriter.Key("ActiveRouters").Number(aConnectivity.mActiveRouters);
+    aWriter.Key("SedBufferSize").Number(aConnectivity.mSedBufferSize);
+    aWriter.Key("SedDatagramCount").Number(aConnectivity.mSedDatagramCount);
+    aWriter.EndObject();
 }
 
-static cJSON *IpPrefix2Json(const otIp6NetworkPrefix &aAddress)
+template <typename Writer> static void RouteData2Json(Writer &aWriter, const otNetworkDiagRouteData &aRouteData)
 {
-    std::stringstream ss;
-    otIp6Address      address = {};
+    aWriter.BeginObject();
+    aWriter.Key("RouteId").Number(aRouteData.mRouterId);
+    aWriter.Key("LinkQualityOut").Number(aRouteData.mLinkQualityOut);
+    aWriter.Key("LinkQualityIn").Number(aRouteData.mLinkQualityIn);
+    aWriter.Key("RouteCost").Number(aRouteData.mRouteCost);
+    aWriter.EndObject();
+}
 
-    address.mFields.mComponents.mNetworkPrefix = aAddress;
-    Ip6Address addr(address.mFields.m8);
+template <typename Writer> static void Route2Json(Writer &aWriter, const otNetworkDiagRoute &aRoute)
+{
+    aWriter.BeginObject();
+    aWriter.Key("IdSequence").Number(aRoute.mIdSequence);
 
-    ss << addr.ToString() << "/" << OT_IP6_PREFIX_BITSIZE;
+    aWriter.Key("RouteData").BeginArray();
+    for (uint16_t i = 0; i < aRoute.mRouteCount; ++i)
+    {
+        RouteData2Json(aWriter, aRoute.mRouteData[i]);
+    }
+    aWriter.EndArray();
 
-    return cJSON_CreateString(ss.str().c_str());
+    aWriter.EndObject();
 }
 
-otbrError Json2IpPrefix(const cJSON *aJson, otIp6NetworkPrefix &aIpPrefix)
+template <typename Writer> static void LeaderData2Json(Writer &aWriter, const otLeaderData &aLeaderData)
 {
-    otbrError          error = OTBR_ERROR_NONE;
-    std::istringstream ipPrefixStr(std::string(aJson->valuestring));
-    std::string        tmp;
-    Ip6Address         addr;
-
-    VerifyOrExit(std::getline(ipPrefixStr, tmp, '/'), error = OTBR_ERROR_INVALID_ARGS);
-    VerifyOrExit((error = addr.FromString(tmp.c_str(), addr)) == OTBR_ERROR_NONE);
-
-    memcpy(aIpPrefix.m8, addr.m8, OT_IP6_PREFIX_SIZE);
-exit:
-    return error;
+    aWriter.BeginObject();
+    aWriter.Key("PartitionId").Number(aLeaderData.mPartitionId);
+    aWriter.Key("Weighting").Number(aLeaderData.mWeighting);
+    aWriter.Key("DataVersion").Number(aLeaderData.mDataVersion);
+    aWriter.Key("StableDataVersion").Number(aLeaderData.mStableDataVersion);
+    aWriter.Key("LeaderRouterId").Number(aLeaderData.mLeaderRouterId);
+    aWriter.EndObject();
 }
 
-static cJSON *Timestamp2Json(const otTimestamp &aTimestamp)
+std::string IpAddr2JsonString(const otIp6Address &aAddress)
 {
-    cJSON *timestamp = cJSON_CreateObject();
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_AddItemToObject(timestamp, "Seconds", cJSON_CreateNumber(aTimestamp.mSeconds));
-    cJSON_AddItemToObject(timestamp, "Ticks", cJSON_CreateNumber(aTimestamp.mTicks));
-    cJSON_AddItemToObject(timestamp, "Authoritative", cJSON_CreateBool(aTimestamp.mAuthoritative));
+    IpAddr2Json(writer, aAddress);
 
-    return timestamp;
+    return ret;
 }
 
-bool Json2Timestamp(const cJSON *jsonTimestamp, otTimestamp &aTimestamp)
+std::string Node2JsonString(const NodeInfo &aNode)
 {
-    cJSON *value;
+    std::string ret;
+    JsonWriter  writer(ret);
+
+    writer.BeginObject();
+    writer.Key("BaId").HexString(aNode.mBaId.mId, sizeof(aNode.mBaId));
+    writer.Key("State").String(aNode.mRole.c_str(), aNode.mRole.size());
+    writer.Key("NumOfRouter").Number(aNode.mNumOfRouter);
+    writer.Key("RlocAddress");
+    IpAddr2Json(writer, aNode.mRlocAddress);
+    writer.Key("ExtAddress").HexString(aNode.mExtAddress, OT_EXT_ADDRESS_SIZE);
+    writer.Key("NetworkName").String(aNode.mNetworkName.c_str(), aNode.mNetworkName.size());
+    writer.Key("Rloc16").Number(aNode.mRloc16);
+    writer.Key("LeaderData");
+    LeaderData2Json(writer, aNode.mLeaderData);
+    writer.Key("ExtPanId").HexString(aNode.mExtPanId, OT_EXT_PAN_ID_SIZE);
+    writer.EndObject();
 
-    value = cJSON_GetObjectItemCaseSensitive(jsonTimestamp, "Seconds");
-    if (cJSON_IsNumber(value))
-    {
-        aTimestamp.mSeconds = static_cast<uint64_t>(value->valuedouble);
-    }
-    else if (value != nullptr)
-    {
-        return false;
-    }
+    return ret;
+}
 
-    value = cJSON_GetObjectItemCaseSensitive(jsonTimestamp, "Ticks");
-    if (cJSON_IsNumber(value))
-    {
-        aTimestamp.mTicks = static_cast<uint16_t>(value->valueint);
-    }
-    else if (value != nullptr)
+template <typename Writer> static void DiagTlv2Json(Writer &aWriter, const otNetworkDiagTlv &aDiagTlv)
+{
+    switch (aDiagTlv.mType)
     {
-        return false;
-    }
+    case OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS:
 
-    value                     = cJSON_GetObjectItemCaseSensitive(jsonTimestamp, "Authoritative");
-    aTimestamp.mAuthoritative = cJSON_IsTrue(value);
+        aWriter.Key("ExtAddress").HexString(aDiagTlv.mData.mExtAddress.m8, OT_EXT_ADDRESS_SIZE);
 
-    return true;
-}
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS:
 
-static cJSON *SecurityPolicy2Json(const otSecurityPolicy &aSecurityPolicy)
-{
-    cJSON *securityPolicy = cJSON_CreateObject();
+        aWriter.Key("Rloc16").Number(aDiagTlv.mData.mAddr16);
 
-    cJSON_AddItemToObject(securityPolicy, "RotationTime", cJSON_CreateNumber(aSecurityPolicy.mRotationTime));
-    cJSON_AddItemToObject(securityPolicy, "ObtainNetworkKey",
-                          cJSON_CreateBool(aSecurityPolicy.mObtainNetworkKeyEnabled));
-    cJSON_AddItemToObject(securityPolicy, "NativeCommissioning",
-                          cJSON_CreateBool(aSecurityPolicy.mNativeCommissioningEnabled));
-    cJSON_AddItemToObject(securityPolicy, "Routers", cJSON_CreateBool(aSecurityPolicy.mRoutersEnabled));
-    cJSON_AddItemToObject(securityPolicy, "ExternalCommissioning",
-                          cJSON_CreateBool(aSecurityPolicy.mExternalCommissioningEnabled));
-    cJSON_AddItemToObject(securityPolicy, "CommercialCommissioning",
-                          cJSON_CreateBool(aSecurityPolicy.mCommercialCommissioningEnabled));
-    cJSON_AddItemToObject(securityPolicy, "AutonomousEnrollment",
-                          cJSON_CreateBool(aSecurityPolicy.mAutonomousEnrollmentEnabled));
-    cJSON_AddItemToObject(securityPolicy, "NetworkKeyProvisioning",
-                          cJSON_CreateBool(aSecurityPolicy.mNetworkKeyProvisioningEnabled));
-    cJSON_AddItemToObject(securityPolicy, "TobleLink", cJSON_CreateBool(aSecurityPolicy.mTobleLinkEnabled));
-    cJSON_AddItemToObject(securityPolicy, "NonCcmRouters", cJSON_CreateBool(aSecurityPolicy.mNonCcmRoutersEnabled));
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_MODE:
 
-    return securityPolicy;
-}
+        aWriter.Key("Mode");
+        Mode2Json(aWriter, aDiagTlv.mData.mMode);
 
-bool Json2SecurityPolicy(const cJSON *jsonSecurityPolicy, otSecurityPolicy &aSecurityPolicy)
-{
-    cJSON *value;
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT:
 
-    value = cJSON_GetObjectItemCaseSensitive(jsonSecurityPolicy, "RotationTime");
-    if (cJSON_IsNumber(value))
-    {
-        aSecurityPolicy.mRotationTime = static_cast<uint16_t>(value->valueint);
-    }
+        aWriter.Key("Timeout").Number(aDiagTlv.mData.mTimeout);
 
-    value                                    = cJSON_GetObjectItemCaseSensitive(jsonSecurityPolicy, "ObtainNetworkKey");
-    aSecurityPolicy.mObtainNetworkKeyEnabled = cJSON_IsTrue(value);
-    value = cJSON_GetObjectItemCaseSensitive(jsonSecurityPolicy, "NativeCommissioning");
-    aSecurityPolicy.mNativeCommissioningEnabled = cJSON_IsTrue(value);
-    value                                       = cJSON_GetObjectItemCaseSensitive(jsonSecurityPolicy, "Routers");
-    aSecurityPolicy.mRoutersEnabled             = cJSON_IsTrue(value);
-    value = cJSON_GetObjectItemCaseSensitive(jsonSecurityPolicy, "ExternalCommissioning");
-    aSecurityPolicy.mExternalCommissioningEnabled = cJSON_IsTrue(value);
-    value = cJSON_GetObjectItemCaseSensitive(jsonSecurityPolicy, "CommercialCommissioning");
-    aSecurityPolicy.mCommercialCommissioningEnabled = cJSON_IsTrue(value);
-    value = cJSON_GetObjectItemCaseSensitive(jsonSecurityPolicy, "AutonomousEnrollment");
-    aSecurityPolicy.mAutonomousEnrollmentEnabled = cJSON_IsTrue(value);
-    value = cJSON_GetObjectItemCaseSensitive(jsonSecurityPolicy, "NetworkKeyProvisioning");
-    aSecurityPolicy.mNetworkKeyProvisioningEnabled = cJSON_IsTrue(value);
-    value                                          = cJSON_GetObjectItemCaseSensitive(jsonSecurityPolicy, "TobleLink");
-    aSecurityPolicy.mTobleLinkEnabled              = cJSON_IsTrue(value);
-    value                                 = cJSON_GetObjectItemCaseSensitive(jsonSecurityPolicy, "NonCcmRouters");
-    aSecurityPolicy.mNonCcmRoutersEnabled = cJSON_IsTrue(value);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY:
 
-    return true;
-}
+        aWriter.Key("Connectivity");
+        Connectivity2Json(aWriter, aDiagTlv.mData.mConnectivity);
 
-static cJSON *ChildTableEntry2Json(const otNetworkDiagChildEntry &aChildEntry)
-{
-    cJSON *childEntry = cJSON_CreateObject();
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
 
-    cJSON_AddItemToObject(childEntry, "ChildId", cJSON_CreateNumber(aChildEntry.mChildId));
-    cJSON_AddItemToObject(childEntry, "Timeout", cJSON_CreateNumber(aChildEntry.mTimeout));
+        aWriter.Key("Route");
+        Route2Json(aWriter, aDiagTlv.mData.mRoute);
 
-    cJSON *mode = Mode2Json(aChildEntry.mMode);
-    cJSON_AddItemToObject(childEntry, "Mode", mode);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA:
 
-    return childEntry;
-}
+        aWriter.Key("LeaderData");
+        LeaderData2Json(aWriter, aDiagTlv.mData.mLeaderData);
 
-static cJSON *MacCounters2Json(const otNetworkDiagMacCounters &aMacCounters)
-{
-    cJSON *macCounters = cJSON_CreateObject();
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA:
 
-    cJSON_AddItemToObject(macCounters, "IfInUnknownProtos", cJSON_CreateNumber(aMacCounters.mIfInUnknownProtos));
-    cJSON_AddItemToObject(macCounters, "IfInErrors", cJSON_CreateNumber(aMacCounters.mIfInErrors));
-    cJSON_AddItemToObject(macCounters, "IfOutErrors", cJSON_CreateNumber(aMacCounters.mIfOutErrors));
-    cJSON_AddItemToObject(macCounters, "IfInUcastPkts", cJSON_CreateNumber(aMacCounters.mIfInUcastPkts));
-    cJSON_AddItemToObject(macCounters, "IfInBroadcastPkts", cJSON_CreateNumber(aMacCounters.mIfInBroadcastPkts));
-    cJSON_AddItemToObject(macCounters, "IfInDiscards", cJSON_CreateNumber(aMacCounters.mIfInDiscards));
-    cJSON_AddItemToObject(macCounters, "IfOutUcastPkts", cJSON_CreateNumber(aMacCounters.mIfOutUcastPkts));
-    cJSON_AddItemToObject(macCounters, "IfOutBroadcastPkts", cJSON_CreateNumber(aMacCounters.mIfOutBroadcastPkts));
-    cJSON_AddItemToObject(macCounters, "IfOutDiscards", cJSON_CreateNumber(aMacCounters.mIfOutDiscards));
+        aWriter.Key("NetworkData").HexString(aDiagTlv.mData.mNetworkData.m8, aDiagTlv.mData.mNetworkData.mCount);
 
-    return macCounters;
-}
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST:
 
-static cJSON *Connectivity2Json(const otNetworkDiagConnectivity &aConnectivity)
-{
-    cJSON *connectivity = cJSON_CreateObject();
+        aWriter.Key("IP6AddressList").BeginArray();
+        for (uint16_t i = 0; i < aDiagTlv.mData.mIp6AddrList.mCount; ++i)
+        {
+            IpAddr2Json(aWriter, aDiagTlv.mData.mIp6AddrList.mList[i]);
+        }
+        aWriter.EndArray();
 
-    cJSON_AddItemToObject(connectivity, "ParentPriority", cJSON_CreateNumber(aConnectivity.mParentPriority));
-    cJSON_AddItemToObject(connectivity, "LinkQuality3", cJSON_CreateNumber(aConnectivity.mLinkQuality3));
-    cJSON_AddItemToObject(connectivity, "LinkQuality2", cJSON_CreateNumber(aConnectivity.mLinkQuality2));
-    cJSON_AddItemToObject(connectivity, "LinkQuality1", cJSON_CreateNumber(aConnectivity.mLinkQuality1));
-    cJSON_AddItemToObject(connectivity, "LeaderCost", cJSON_CreateNumber(aConnectivity.mLeaderCost));
-    cJSON_AddItemToObject(connectivity, "IdSequence", cJSON_CreateNumber(aConnectivity.mIdSequence));
-    cJSON_AddItemToObject(connectivity, "ActiveRouters", cJSON_CreateNumber(aConnectivity.mActiveRouters));
-    cJSON_AddItemToObject(connectivity, "SedBufferSize", cJSON_CreateNumber(aConnectivity.mSedBufferSize));
-    cJSON_AddItemToObject(connectivity, "SedDatagramCount", cJSON_CreateNumber(aConnectivity.mSedDatagramCount));
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS:
 
-    return connectivity;
-}
+        aWriter.Key("MACCounters");
+        MacCounters2Json(aWriter, aDiagTlv.mData.mMacCounters);
 
-static cJSON *RouteData2Json(const otNetworkDiagRouteData &aRouteData)
-{
-    cJSON *routeData = cJSON_CreateObject();
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL:
 
-    cJSON_AddItemToObject(routeData, "RouteId", cJSON_CreateNumber(aRouteData.mRouterId));
-    cJSON_AddItemToObject(routeData, "LinkQualityOut", cJSON_CreateNumber(aRouteData.mLinkQualityOut));
-    cJSON_AddItemToObject(routeData, "LinkQualityIn", cJSON_CreateNumber(aRouteData.mLinkQualityIn));
-    cJSON_AddItemToObject(routeData, "RouteCost", cJSON_CreateNumber(aRouteData.mRouteCost));
+        aWriter.Key("BatteryLevel").Number(aDiagTlv.mData.mBatteryLevel);
 
-    return routeData;
-}
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE:
 
-static cJSON *Route2Json(const otNetworkDiagRoute &aRoute)
-{
-    cJSON *route = cJSON_CreateObject();
+        aWriter.Key("SupplyVoltage").Number(aDiagTlv.mData.mSupplyVoltage);
 
-    cJSON_AddItemToObject(route, "IdSequence", cJSON_CreateNumber(aRoute.mIdSequence));
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
 
-    cJSON *RouteData = cJSON_CreateArray();
-    for (uint16_t i = 0; i < aRoute.mRouteCount; ++i)
-    {
-        cJSON *RouteDatavalue = RouteData2Json(aRoute.mRouteData[i]);
-        cJSON_AddItemToArray(RouteData, RouteDatavalue);
-    }
+        aWriter.Key("ChildTable").BeginArray();
+        for (uint16_t i = 0; i < aDiagTlv.mData.mChildTable.mCount; ++i)
+        {
+            ChildTableEntry2Json(aWriter, aDiagTlv.mData.mChildTable.mTable[i]);
+        }
+        aWriter.EndArray();
 
-    cJSON_AddItemToObject(route, "RouteData", RouteData);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES:
 
-    return route;
-}
+        aWriter.Key("ChannelPages").HexString(aDiagTlv.mData.mChannelPages.m8, aDiagTlv.mData.mChannelPages.mCount);
 
-static cJSON *LeaderData2Json(const otLeaderData &aLeaderData)
-{
-    cJSON *leaderData = cJSON_CreateObject();
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT:
 
-    cJSON_AddItemToObject(leaderData, "PartitionId", cJSON_CreateNumber(aLeaderData.mPartitionId));
-    cJSON_AddItemToObject(leaderData, "Weighting", cJSON_CreateNumber(aLeaderData.mWeighting));
-    cJSON_AddItemToObject(leaderData, "DataVersion", cJSON_CreateNumber(aLeaderData.mDataVersion));
-    cJSON_AddItemToObject(leaderData, "StableDataVersion", cJSON_CreateNumber(aLeaderData.mStableDataVersion));
-    cJSON_AddItemToObject(leaderData, "LeaderRouterId", cJSON_CreateNumber(aLeaderData.mLeaderRouterId));
+        aWriter.Key("MaxChildTimeout").Number(aDiagTlv.mData.mMaxChildTimeout);
 
-    return leaderData;
+        break;
+    default:
+        break;
+    }
 }
 
-std::string IpAddr2JsonString(const otIp6Address &aAddress)
+std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet)
 {
     std::string ret;
-    cJSON      *ipAddr = IpAddr2Json(aAddress);
+    JsonWriter  writer(ret);
 
-    ret = Json2String(ipAddr);
-    cJSON_Delete(ipAddr);
+    writer.BeginArray();
+    for (const auto &diagItem : aDiagSet)
+    {
+        writer.BeginObject();
+        for (const auto &diagTlv : diagItem)
+        {
+            DiagTlv2Json(writer, diagTlv);
+        }
+        writer.EndObject();
+    }
+    writer.EndArray();
 
     return ret;
 }
 
-std::string Node2JsonString(const NodeInfo &aNode)
+std::string Diag2CborString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet)
 {
-    cJSON      *node = cJSON_CreateObject();
     std::string ret;
+    CborWriter  writer(ret);
 
-    cJSON_AddItemToObject(node, "BaId", Bytes2HexJson(aNode.mBaId.mId, sizeof(aNode.mBaId)));
-    cJSON_AddItemToObject(node, "State", cJSON_CreateString(aNode.mRole.c_str()));
-    cJSON_AddItemToObject(node, "NumOfRouter", cJSON_CreateNumber(aNode.mNumOfRouter));
-    cJSON_AddItemToObject(node, "RlocAddress", IpAddr2Json(aNode.mRlocAddress));
-    cJSON_AddItemToObject(node, "ExtAddress", Bytes2HexJson(aNode.mExtAddress, OT_EXT_ADDRESS_SIZE));
-    cJSON_AddItemToObject(node, "NetworkName", cJSON_CreateString(aNode.mNetworkName.c_str()));
-    cJSON_AddItemToObject(node, "Rloc16", cJSON_CreateNumber(aNode.mRloc16));
-    cJSON_AddItemToObject(node, "LeaderData", LeaderData2Json(aNode.mLeaderData));
-    cJSON_AddItemToObject(node, "ExtPanId", Bytes2HexJson(aNode.mExtPanId, OT_EXT_PAN_ID_SIZE));
-
-    ret = Json2String(node);
-    cJSON_Delete(node);
+    writer.BeginArray();
+    for (const auto &diagItem : aDiagSet)
+    {
+        writer.BeginObject();
+        for (const auto &diagTlv : diagItem)
+        {
+            DiagTlv2Json(writer, diagTlv);
+        }
+        writer.EndObject();
+    }
+    writer.EndArray();
 
     return ret;
 }
 
-std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet)
+std::string TopologyLinks2JsonString(const std::vector<TopologyGraph::Link> &aLinks)
 {
-    cJSON      *diagInfo          = cJSON_CreateArray();
-    cJSON      *diagInfoOfOneNode = nullptr;
-    cJSON      *addrList          = nullptr;
-    cJSON      *tableList         = nullptr;
     std::string ret;
-    uint64_t    timeout;
+    JsonWriter  writer(ret);
 
-    for (auto diagItem : aDiagSet)
+    writer.BeginArray();
+    for (const TopologyGraph::Link &link : aLinks)
     {
-        diagInfoOfOneNode = cJSON_CreateObject();
-        for (auto diagTlv : diagItem)
+        writer.BeginObject();
+        writer.Key("Rloc16").Number(link.mNeighbor);
+        writer.Key("IsChild").Bool(link.mIsChild);
+        if (!link.mIsChild)
         {
-            switch (diagTlv.mType)
-            {
-            case OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "ExtAddress",
-                                      Bytes2HexJson(diagTlv.mData.mExtAddress.m8, OT_EXT_ADDRESS_SIZE));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Rloc16", cJSON_CreateNumber(diagTlv.mData.mAddr16));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MODE:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Mode", Mode2Json(diagTlv.mData.mMode));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT:
-
-                timeout = static_cast<uint64_t>(diagTlv.mData.mTimeout);
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Timeout", cJSON_CreateNumber(timeout));
+            writer.Key("LinkQualityIn").Number(link.mLinkQualityIn);
+            writer.Key("LinkQualityOut").Number(link.mLinkQualityOut);
+        }
+        writer.EndObject();
+    }
+    writer.EndArray();
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY:
+    return ret;
+}
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Connectivity",
-                                      Connectivity2Json(diagTlv.mData.mConnectivity));
+std::string TopologyPath2JsonString(const TopologyGraph::Path &aPath)
+{
+    std::string ret;
+    JsonWriter  writer(ret);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
+    writer.BeginObject();
+    writer.Key("Cost").Number(aPath.mCost);
+    writer.Key("Path").BeginArray();
+    for (uint16_t rloc16 : aPath.mNodes)
+    {
+        writer.Number(rloc16);
+    }
+    writer.EndArray();
+    writer.EndObject();
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Route", Route2Json(diagTlv.mData.mRoute));
+    return ret;
+}
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA:
+std::string TopologyPartitions2JsonString(const std::vector<std::vector<uint16_t>> &aPartitions)
+{
+    std::string ret;
+    JsonWriter  writer(ret);
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "LeaderData", LeaderData2Json(diagTlv.mData.mLeaderData));
+    writer.BeginArray();
+    for (const std::vector<uint16_t> &partition : aPartitions)
+    {
+        writer.BeginArray();
+        for (uint16_t rloc16 : partition)
+        {
+            writer.Number(rloc16);
+        }
+        writer.EndArray();
+    }
+    writer.EndArray();
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA:
+    return ret;
+}
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "NetworkData",
-                                      Bytes2HexJson(diagTlv.mData.mNetworkData.m8, diagTlv.mData.mNetworkData.mCount));
+std::string DiagTlvs2JsonString(const std::vector<otNetworkDiagTlv> &aDiagTlvs)
+{
+    std::string ret;
+    JsonWriter  writer(ret);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST:
+    writer.BeginObject();
+    for (const auto &diagTlv : aDiagTlvs)
+    {
+        DiagTlv2Json(writer, diagTlv);
+    }
+    writer.EndObject();
 
-                addrList = cJSON_CreateArray();
+    return ret;
+}
 
-                for (uint16_t i = 0; i < diagTlv.mData.mIp6AddrList.mCount; ++i)
-                {
-                    cJSON_AddItemToArray(addrList, IpAddr2Json(diagTlv.mData.mIp6AddrList.mList[i]));
-                }
-                cJSON_AddItemToObject(diagInfoOfOneNode, "IP6AddressList", addrList);
+std::string Bytes2HexJsonString(const uint8_t *aBytes, uint8_t aLength)
+{
+    std::string ret;
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS:
+    JsonWriter(ret).HexString(aBytes, aLength);
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "MACCounters", MacCounters2Json(diagTlv.mData.mMacCounters));
+    return ret;
+}
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL:
+int Hex2BytesJsonString(const std::string &aHexString, uint8_t *aBytes, uint8_t aMaxLength)
+{
+    return otbr::Utils::Hex2Bytes(aHexString.c_str(), aBytes, aMaxLength);
+}
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "BatteryLevel",
-                                      cJSON_CreateNumber(diagTlv.mData.mBatteryLevel));
+std::string Number2JsonString(const uint32_t &aNumber)
+{
+    std::string ret;
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE:
+    JsonWriter(ret).Number(aNumber);
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "SupplyVoltage",
-                                      cJSON_CreateNumber(diagTlv.mData.mSupplyVoltage));
+    return ret;
+}
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
+std::string Mode2JsonString(const otLinkModeConfig &aMode)
+{
+    std::string ret;
+    JsonWriter  writer(ret);
 
-                tableList = cJSON_CreateArray();
+    Mode2Json(writer, aMode);
 
-                for (uint16_t i = 0; i < diagTlv.mData.mChildTable.mCount; ++i)
-                {
-                    cJSON_AddItemToArray(tableList, ChildTableEntry2Json(diagTlv.mData.mChildTable.mTable[i]));
-                }
+    return ret;
+}
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "ChildTable", tableList);
+std::string Connectivity2JsonString(const otNetworkDiagConnectivity &aConnectivity)
+{
+    std::string ret;
+    JsonWriter  writer(ret);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES:
+    Connectivity2Json(writer, aConnectivity);
 
-                cJSON_AddItemToObject(
-                    diagInfoOfOneNode, "ChannelPages",
-                    Bytes2HexJson(diagTlv.mData.mChannelPages.m8, diagTlv.mData.mChannelPages.mCount));
+    return ret;
+}
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT:
+std::string RouteData2JsonString(const otNetworkDiagRouteData &aRouteData)
+{
+    std::string ret;
+    JsonWriter  writer(ret);
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "MaxChildTimeout",
-                                      cJSON_CreateNumber(diagTlv.mData.mMaxChildTimeout));
+    RouteData2Json(writer, aRouteData);
 
-                break;
-            default:
-                break;
-            }
-        }
-        cJSON_AddItemToArray(diagInfo, diagInfoOfOneNode);
-    }
+    return ret;
+}
 
-    ret = Json2String(diagInfo);
+std::string Route2JsonString(const otNetworkDiagRoute &aRoute)
+{
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(diagInfo);
+    Route2Json(writer, aRoute);
 
     return ret;
 }
 
-std::string Bytes2HexJsonString(const uint8_t *aBytes, uint8_t aLength)
+std::string LeaderData2JsonString(const otLeaderData &aLeaderData)
 {
-    cJSON      *hex = Bytes2HexJson(aBytes, aLength);
-    std::string ret = Json2String(hex);
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(hex);
+    LeaderData2Json(writer, aLeaderData);
 
     return ret;
 }
 
-int Hex2BytesJsonString(const std::string &aHexString, uint8_t *aBytes, uint8_t aMaxLength)
+std::string ActiveScanResult2JsonString(const otActiveScanResult &aResult)
 {
-    return otbr::Utils::Hex2Bytes(aHexString.c_str(), aBytes, aMaxLength);
+    std::string ret;
+    JsonWriter  writer(ret);
+
+    writer.BeginObject();
+    writer.Key("ExtAddress").HexString(aResult.mExtAddress.m8, sizeof(aResult.mExtAddress));
+    writer.Key("NetworkName").String(aResult.mNetworkName.m8);
+    writer.Key("ExtPanId").HexString(aResult.mExtendedPanId.m8, sizeof(aResult.mExtendedPanId));
+    writer.Key("PanId").Number(aResult.mPanId);
+    writer.Key("Channel").Number(aResult.mChannel);
+    writer.Key("Rssi").Number(aResult.mRssi);
+    writer.Key("Lqi").Number(aResult.mLqi);
+    writer.Key("Version").Number(aResult.mVersion);
+    writer.Key("IsJoinable").Bool(aResult.mIsJoinable);
+    writer.EndObject();
+
+    return ret;
 }
 
-std::string Number2JsonString(const uint32_t &aNumber)
+std::string EnergyScanResult2JsonString(const otEnergyScanResult &aResult)
 {
-    cJSON      *number = cJSON_CreateNumber(aNumber);
-    std::string ret    = Json2String(number);
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(number);
+    writer.BeginObject();
+    writer.Key("Channel").Number(aResult.mChannel);
+    writer.Key("MaxRssi").Number(aResult.mMaxRssi);
+    writer.EndObject();
 
     return ret;
 }
 
-std::string Mode2JsonString(const otLinkModeConfig &aMode)
+bool JsonScanRequestString2Params(const std::string &aJsonScanRequest, uint32_t &aChannelMask, uint32_t &aScanDuration)
 {
-    cJSON      *mode = Mode2Json(aMode);
-    std::string ret  = Json2String(mode);
+    cJSON *jsonRequest;
+    cJSON *value;
+    bool   ret = true;
+
+    aChannelMask  = 0;
+    aScanDuration = 0;
+
+    VerifyOrExit((jsonRequest = cJSON_Parse(aJsonScanRequest.c_str())) != nullptr, ret = false);
+    VerifyOrExit(cJSON_IsObject(jsonRequest), ret = false);
 
-    cJSON_Delete(mode);
+    value = cJSON_GetObjectItemCaseSensitive(jsonRequest, "ChannelMask");
+    if (value != nullptr)
+    {
+        VerifyOrExit(cJSON_IsNumber(value) && value->valuedouble >= 0 && value->valuedouble <= UINT32_MAX,
+                     ret = false);
+        aChannelMask = static_cast<uint32_t>(value->valuedouble);
+    }
+
+    value = cJSON_GetObjectItemCaseSensitive(jsonRequest, "ScanDuration");
+    if (value != nullptr)
+    {
+        VerifyOrExit(cJSON_IsNumber(value) && value->valuedouble >= 0 && value->valuedouble < UINT16_MAX,
+                     ret = false);
+        aScanDuration = static_cast<uint32_t>(value->valuedouble);
+    }
+
+exit:
+    cJSON_Delete(jsonRequest);
 
     return ret;
 }
 
-std::string Connectivity2JsonString(const otNetworkDiagConnectivity &aConnectivity)
+std::string MacCounters2JsonString(const otNetworkDiagMacCounters &aMacCounters)
 {
-    cJSON      *connectivity = Connectivity2Json(aConnectivity);
-    std::string ret          = Json2String(connectivity);
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(connectivity);
+    MacCounters2Json(writer, aMacCounters);
 
     return ret;
 }
 
-std::string RouteData2JsonString(const otNetworkDiagRouteData &aRouteData)
+static void CounterSeries2Json(JsonWriter          &aWriter,
+                               const CounterSeries &aSeries,
+                               const char *(*aCounterToString)(uint8_t))
 {
-    cJSON      *routeData = RouteData2Json(aRouteData);
-    std::string ret       = Json2String(routeData);
-
-    cJSON_Delete(routeData);
+    aWriter.Key("Intervals").BeginArray();
+    for (uint16_t i = 0; i < aSeries.GetNumIntervals(); i++)
+    {
+        aWriter.Number(aSeries.GetIntervalDuration(i));
+    }
+    aWriter.EndArray();
 
-    return ret;
+    aWriter.Key("Counters").BeginObject();
+    for (uint8_t counter = 0; counter < aSeries.GetNumCounters(); counter++)
+    {
+        aWriter.Key(aCounterToString(counter)).BeginObject();
+        aWriter.Key("Value").Number(static_cast<int64_t>(aSeries.GetValue(counter)));
+        aWriter.Key("RatePerMinute").Number(static_cast<int64_t>(aSeries.GetRatePerMinute(counter)));
+        aWriter.Key("Deltas").BeginArray();
+        for (uint16_t i = 0; i < aSeries.GetNumIntervals(); i++)
+        {
+            aWriter.Number(aSeries.GetDelta(i, counter));
+        }
+        aWriter.EndArray();
+        aWriter.EndObject();
+    }
+    aWriter.EndObject();
 }
 
-std::string Route2JsonString(const otNetworkDiagRoute &aRoute)
+std::string Batch2JsonString(const std::vector<std::pair<std::string, std::string>> &aBodies)
 {
-    cJSON      *route = Route2Json(aRoute);
-    std::string ret   = Json2String(route);
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(route);
+    writer.BeginObject();
+    for (const auto &body : aBodies)
+    {
+        writer.Key(body.first.c_str());
+        if (body.second.empty())
+        {
+            writer.Null();
+        }
+        else
+        {
+            writer.Raw(body.second.c_str());
+        }
+    }
+    writer.EndObject();
 
     return ret;
 }
 
-std::string LeaderData2JsonString(const otLeaderData &aLeaderData)
+std::string CounterHistory2JsonString(const agent::CounterHistory &aHistory)
 {
-    cJSON      *leaderData = LeaderData2Json(aLeaderData);
-    std::string ret        = Json2String(leaderData);
+    std::string ret;
+    JsonWriter  writer(ret);
+
+    writer.BeginObject();
+
+    writer.Key("Interface").BeginObject();
+    CounterSeries2Json(writer, aHistory.GetInterfaceSeries(), agent::CounterHistory::InterfaceCounterToString);
+    writer.EndObject();
+
+    writer.Key("Neighbors").BeginArray();
+    for (const agent::CounterHistory::Neighbor &neighbor : aHistory.GetNeighbors())
+    {
+        uint8_t extAddress[OT_EXT_ADDRESS_SIZE];
 
-    cJSON_Delete(leaderData);
+        for (uint8_t i = 0; i < OT_EXT_ADDRESS_SIZE; i++)
+        {
+            extAddress[i] = static_cast<uint8_t>(neighbor.mExtAddress >> (8 * (OT_EXT_ADDRESS_SIZE - 1 - i)));
+        }
+
+        writer.BeginObject();
+        writer.Key("ExtAddress").HexString(extAddress, sizeof(extAddress));
+        CounterSeries2Json(writer, neighbor.mSeries, agent::CounterHistory::NeighborCounterToString);
+        writer.EndObject();
+    }
+    writer.EndArray();
+
+    writer.EndObject();
 
     return ret;
 }
 
-std::string MacCounters2JsonString(const otNetworkDiagMacCounters &aMacCounters)
+std::string ChannelOccupancy2JsonString(const ChannelOccupancy &aOccupancy,
+                                        uint32_t                aSupportedChannelMask,
+                                        uint32_t                aPreferredChannelMask)
 {
-    cJSON      *macCounters = MacCounters2Json(aMacCounters);
-    std::string ret         = Json2String(macCounters);
+    std::string ret;
+    JsonWriter  writer(ret);
+    uint8_t     channel;
+
+    writer.BeginObject();
+
+    writer.Key("RecommendedChannel");
+    if (aOccupancy.Recommend(aPreferredChannelMask, channel))
+    {
+        writer.Number(channel);
+    }
+    else
+    {
+        writer.Null();
+    }
+
+    writer.Key("Channels").BeginArray();
+    for (const ChannelOccupancy::Quality &quality : aOccupancy.GetQualities(aSupportedChannelMask))
+    {
+        writer.BeginObject();
+        writer.Key("Channel").Number(quality.mChannel);
+        writer.Key("OccupancyPercent")
+            .Number((quality.mOccupancy * 100 + ChannelOccupancy::kMaxOccupancy / 2) / ChannelOccupancy::kMaxOccupancy);
+        writer.Key("AverageRssi").Number(quality.mAverageRssi);
+        writer.Key("SampleCount").Number(quality.mSampleCount);
+        writer.EndObject();
+    }
+    writer.EndArray();
 
-    cJSON_Delete(macCounters);
+    writer.EndObject();
 
     return ret;
 }
 
 std::string ChildTableEntry2JsonString(const otNetworkDiagChildEntry &aChildEntry)
 {
-    cJSON      *childEntry = ChildTableEntry2Json(aChildEntry);
-    std::string ret        = Json2String(childEntry);
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(childEntry);
+    ChildTableEntry2Json(writer, aChildEntry);
 
     return ret;
 }
 
 std::string CString2JsonString(const char *aCString)
 {
-    cJSON      *cString = CString2Json(aCString);
-    std::string ret     = Json2String(cString);
+    std::string ret;
 
-    cJSON_Delete(cString);
+    VerifyOrExit(aCString != nullptr);
+    JsonWriter(ret).String(aCString);
 
+exit:
     return ret;
 }
 
 std::string Error2JsonString(HttpStatusCode aErrorCode, std::string aErrorMessage)
 {
     std::string ret;
-    cJSON      *error = cJSON_CreateObject();
-
-    cJSON_AddItemToObject(error, "ErrorCode", cJSON_CreateNumber(static_cast<int16_t>(aErrorCode)));
-    cJSON_AddItemToObject(error, "ErrorMessage", cJSON_CreateString(aErrorMessage.c_str()));
+    JsonWriter  writer(ret);
 
-    ret = Json2String(error);
-
-    cJSON_Delete(error);
+    writer.BeginObject();
+    writer.Key("ErrorCode").Number(static_cast<int16_t>(aErrorCode));
+    writer.Key("ErrorMessage").String(aErrorMessage.c_str(), aErrorMessage.size());
+    writer.EndObject();
 
     return ret;
 }
 
-cJSON *ActiveDataset2Json(const otOperationalDataset &aActiveDataset)
+static void ActiveDataset2Json(JsonWriter &aWriter, const otOperationalDataset &aActiveDataset)
 {
-    cJSON *node = cJSON_CreateObject();
+    aWriter.BeginObject();
 
     if (aActiveDataset.mComponents.mIsActiveTimestampPresent)
     {
-        cJSON_AddItemToObject(node, "ActiveTimestamp", Timestamp2Json(aActiveDataset.mActiveTimestamp));
+        aWriter.Key("ActiveTimestamp");
+        Timestamp2Json(aWriter, aActiveDataset.mActiveTimestamp);
     }
     if (aActiveDataset.mComponents.mIsNetworkKeyPresent)
     {
-        cJSON_AddItemToObject(node, "NetworkKey", Bytes2HexJson(aActiveDataset.mNetworkKey.m8, OT_NETWORK_KEY_SIZE));
+        aWriter.Key("NetworkKey").HexString(aActiveDataset.mNetworkKey.m8, OT_NETWORK_KEY_SIZE);
     }
     if (aActiveDataset.mComponents.mIsNetworkNamePresent)
     {
-        cJSON_AddItemToObject(node, "NetworkName", cJSON_CreateString(aActiveDataset.mNetworkName.m8));
+        aWriter.Key("NetworkName").String(aActiveDataset.mNetworkName.m8);
     }
     if (aActiveDataset.mComponents.mIsExtendedPanIdPresent)
     {
-        cJSON_AddItemToObject(node, "ExtPanId", Bytes2HexJson(aActiveDataset.mExtendedPanId.m8, OT_EXT_PAN_ID_SIZE));
+        aWriter.Key("ExtPanId").HexString(aActiveDataset.mExtendedPanId.m8, OT_EXT_PAN_ID_SIZE);
     }
     if (aActiveDataset.mComponents.mIsMeshLocalPrefixPresent)
     {
-        cJSON_AddItemToObject(node, "MeshLocalPrefix", IpPrefix2Json(aActiveDataset.mMeshLocalPrefix));
+        aWriter.Key("MeshLocalPrefix");
+        IpPrefix2Json(aWriter, aActiveDataset.mMeshLocalPrefix);
     }
     if (aActiveDataset.mComponents.mIsPanIdPresent)
     {
-        cJSON_AddItemToObject(node, "PanId", cJSON_CreateNumber(aActiveDataset.mPanId));
+        aWriter.Key("PanId").Number(aActiveDataset.mPanId);
     }
     if (aActiveDataset.mComponents.mIsChannelPresent)
     {
-        cJSON_AddItemToObject(node, "Channel", cJSON_CreateNumber(aActiveDataset.mChannel));
+        aWriter.Key("Channel").Number(aActiveDataset.mChannel);
     }
     if (aActiveDataset.mComponents.mIsPskcPresent)
     {
-        cJSON_AddItemToObject(node, "PSKc", Bytes2HexJson(aActiveDataset.mPskc.m8, OT_PSKC_MAX_SIZE));
+        aWriter.Key("PSKc").HexString(aActiveDataset.mPskc.m8, OT_PSKC_MAX_SIZE);
     }
     if (aActiveDataset.mComponents.mIsSecurityPolicyPresent)
     {
-        cJSON_AddItemToObject(node, "SecurityPolicy", SecurityPolicy2Json(aActiveDataset.mSecurityPolicy));
+        aWriter.Key("SecurityPolicy");
+        SecurityPolicy2Json(aWriter, aActiveDataset.mSecurityPolicy);
     }
     if (aActiveDataset.mComponents.mIsChannelMaskPresent)
     {
-        cJSON_AddItemToObject(node, "ChannelMask", cJSON_CreateNumber(aActiveDataset.mChannelMask));
+        aWriter.Key("ChannelMask").Number(aActiveDataset.mChannelMask);
     }
 
-    return node;
+    aWriter.EndObject();
 }
 
 std::string ActiveDataset2JsonString(const otOperationalDataset &aActiveDataset)
 {
-    cJSON      *node;
     std::string ret;
+    JsonWriter  writer(ret);
 
-    node = ActiveDataset2Json(aActiveDataset);
-    ret  = Json2String(node);
-    cJSON_Delete(node);
+    ActiveDataset2Json(writer, aActiveDataset);
 
     return ret;
 }
 
 std::string PendingDataset2JsonString(const otOperationalDataset &aPendingDataset)
 {
-    cJSON      *nodeActiveDataset;
-    cJSON      *node = cJSON_CreateObject();
     std::string ret;
+    JsonWriter  writer(ret);
 
-    nodeActiveDataset = ActiveDataset2Json(aPendingDataset);
-    cJSON_AddItemToObject(node, "ActiveDataset", nodeActiveDataset);
+    writer.BeginObject();
+    writer.Key("ActiveDataset");
+    ActiveDataset2Json(writer, aPendingDataset);
     if (aPendingDataset.mComponents.mIsPendingTimestampPresent)
     {
-        cJSON_AddItemToObject(node, "PendingTimestamp", Timestamp2Json(aPendingDataset.mPendingTimestamp));
+        writer.Key("PendingTimestamp");
+        Timestamp2Json(writer, aPendingDataset.mPendingTimestamp);
     }
     if (aPendingDataset.mComponents.mIsDelayPresent)
     {
-        cJSON_AddItemToObject(node, "Delay", cJSON_CreateNumber(aPendingDataset.mDelay));
+        writer.Key("Delay").Number(aPendingDataset.mDelay);
     }
-
-    ret = Json2String(node);
-    cJSON_Delete(node);
+    writer.EndObject();
 
     return ret;
 }
 
-bool JsonActiveDataset2Dataset(const cJSON *jsonActiveDataset, otOperationalDataset &aDataset)
+template <typename UintType> static bool ParseUint(const JsonReader &aReader, Token aToken, UintType &aValue)
 {
-    cJSON      *value;
-    otTimestamp timestamp;
-    bool        ret = true;
+    uint64_t value;
+    bool     ret =
+        (aToken == Token::kNumber && aReader.GetUint(value) && value <= std::numeric_limits<UintType>::max());
 
-    value = cJSON_GetObjectItemCaseSensitive(jsonActiveDataset, "ActiveTimestamp");
-    if (cJSON_IsObject(value))
-    {
-        VerifyOrExit(Json2Timestamp(value, timestamp), ret = false);
-        aDataset.mActiveTimestamp                      = timestamp;
-        aDataset.mComponents.mIsActiveTimestampPresent = true;
-    }
-    else if (cJSON_IsNull(value))
-    {
-        aDataset.mComponents.mIsActiveTimestampPresent = false;
-    }
-    else if (value != nullptr)
+    if (ret)
     {
-        ExitNow(ret = false);
+        aValue = static_cast<UintType>(value);
     }
 
-    value = cJSON_GetObjectItemCaseSensitive(jsonActiveDataset, "NetworkKey");
-    if (cJSON_IsString(value))
-    {
-        VerifyOrExit(value->valuestring != nullptr, ret = false);
-        VerifyOrExit(Hex2BytesJsonString(std::string(value->valuestring), aDataset.mNetworkKey.m8,
-                                         OT_NETWORK_KEY_SIZE) == OT_NETWORK_KEY_SIZE,
-                     ret = false);
-        aDataset.mComponents.mIsNetworkKeyPresent = true;
-    }
-    else if (cJSON_IsNull(value))
-    {
-        aDataset.mComponents.mIsNetworkKeyPresent = false;
-    }
+    return ret;
+}
 
-    value = cJSON_GetObjectItemCaseSensitive(jsonActiveDataset, "NetworkName");
-    if (cJSON_IsString(value))
-    {
-        VerifyOrExit(value->valuestring != nullptr, ret = false);
-        VerifyOrExit(strlen(value->valuestring) <= OT_NETWORK_NAME_MAX_SIZE, ret = false);
-        strncpy(aDataset.mNetworkName.m8, value->valuestring, OT_NETWORK_NAME_MAX_SIZE);
-        aDataset.mComponents.mIsNetworkNamePresent = true;
-    }
-    else if (cJSON_IsNull(value))
-    {
-        aDataset.mComponents.mIsNetworkNamePresent = false;
-    }
+static bool ParseBool(Token aToken, bool &aValue)
+{
+    aValue = (aToken == Token::kTrue);
 
-    value = cJSON_GetObjectItemCaseSensitive(jsonActiveDataset, "ExtPanId");
-    if (cJSON_IsString(value))
-    {
-        VerifyOrExit(value->valuestring != nullptr, ret = false);
-        VerifyOrExit(Hex2BytesJsonString(std::string(value->valuestring), aDataset.mExtendedPanId.m8,
-                                         OT_EXT_PAN_ID_SIZE) == OT_EXT_PAN_ID_SIZE,
-                     ret = false);
-        aDataset.mComponents.mIsExtendedPanIdPresent = true;
-    }
-    else if (cJSON_IsNull(value))
-    {
-        aDataset.mComponents.mIsExtendedPanIdPresent = false;
-    }
+    return aToken == Token::kTrue || aToken == Token::kFalse;
+}
 
-    value = cJSON_GetObjectItemCaseSensitive(jsonActiveDataset, "MeshLocalPrefix");
-    if (cJSON_IsString(value))
-    {
-        VerifyOrExit(value->valuestring != nullptr, ret = false);
-        VerifyOrExit(Json2IpPrefix(value, aDataset.mMeshLocalPrefix) == OTBR_ERROR_NONE, ret = false);
-        aDataset.mComponents.mIsMeshLocalPrefixPresent = true;
-    }
-    else if (cJSON_IsNull(value))
-    {
-        aDataset.mComponents.mIsMeshLocalPrefixPresent = false;
-    }
+static bool ParseHex(const JsonReader &aReader, Token aToken, uint8_t *aBytes, uint16_t aLength)
+{
+    return aToken == Token::kString && Utils::Hex2Bytes(aReader.GetString(), aBytes, aLength) == aLength;
+}
 
-    value = cJSON_GetObjectItemCaseSensitive(jsonActiveDataset, "PanId");
-    if (cJSON_IsNumber(value))
-    {
-        aDataset.mPanId                      = static_cast<otPanId>(value->valueint);
-        aDataset.mComponents.mIsPanIdPresent = true;
-    }
-    else if (cJSON_IsNull(value))
-    {
-        aDataset.mComponents.mIsPanIdPresent = false;
-    }
+static bool ParseNetworkName(const JsonReader &aReader, Token aToken, otNetworkName &aNetworkName)
+{
+    bool ret = (aToken == Token::kString && aReader.GetStringLength() <= OT_NETWORK_NAME_MAX_SIZE);
 
-    value = cJSON_GetObjectItemCaseSensitive(jsonActiveDataset, "Channel");
-    if (cJSON_IsNumber(value))
-    {
-        aDataset.mChannel                      = static_cast<uint16_t>(value->valueint);
-        aDataset.mComponents.mIsChannelPresent = true;
-    }
-    else if (cJSON_IsNull(value))
+    if (ret)
     {
-        aDataset.mComponents.mIsChannelPresent = false;
+        memcpy(aNetworkName.m8, aReader.GetString(), aReader.GetStringLength() + 1);
     }
 
-    value = cJSON_GetObjectItemCaseSensitive(jsonActiveDataset, "PSKc");
-    if (cJSON_IsString(value))
-    {
-        VerifyOrExit(value->valuestring != nullptr, ret = false);
-        VerifyOrExit(Hex2BytesJsonString(std::string(value->valuestring), aDataset.mPskc.m8, OT_PSKC_MAX_SIZE) ==
-                         OT_PSKC_MAX_SIZE,
-                     ret = false);
-        aDataset.mComponents.mIsPskcPresent = true;
-    }
-    else if (cJSON_IsNull(value))
-    {
-        aDataset.mComponents.mIsPskcPresent = false;
-    }
+    return ret;
+}
 
-    value = cJSON_GetObjectItemCaseSensitive(jsonActiveDataset, "SecurityPolicy");
-    if (cJSON_IsObject(value))
-    {
-        VerifyOrExit(Json2SecurityPolicy(value, aDataset.mSecurityPolicy), ret = false);
-        aDataset.mComponents.mIsSecurityPolicyPresent = true;
-    }
-    else if (cJSON_IsNull(value))
-    {
-        aDataset.mComponents.mIsSecurityPolicyPresent = false;
-    }
+static bool ParseMeshLocalPrefix(const JsonReader &aReader, Token aToken, otIp6NetworkPrefix &aPrefix)
+{
+    bool        ret = false;
+    char        address[INET6_ADDRSTRLEN];
+    const char *slash;
+    size_t      length;
+    Ip6Address  addr;
 
-    value = cJSON_GetObjectItemCaseSensitive(jsonActiveDataset, "ChannelMask");
-    if (cJSON_IsNumber(value))
-    {
-        aDataset.mChannelMask                      = value->valueint;
-        aDataset.mComponents.mIsChannelMaskPresent = true;
-    }
-    else if (cJSON_IsNull(value))
-    {
-        aDataset.mComponents.mIsChannelMaskPresent = false;
-    }
+    VerifyOrExit(aToken == Token::kString);
+
+    // The prefix length is ignored, a Mesh Local Prefix is always 64 bits.
+    slash  = strchr(aReader.GetString(), '/');
+    length = (slash != nullptr) ? static_cast<size_t>(slash - aReader.GetString()) : aReader.GetStringLength();
+    VerifyOrExit(length < sizeof(address));
+    memcpy(address, aReader.GetString(), length);
+    address[length] = '\0';
+
+    VerifyOrExit(Ip6Address::FromString(address, addr) == OTBR_ERROR_NONE);
+    memcpy(aPrefix.m8, addr.m8, OT_IP6_PREFIX_SIZE);
+    ret = true;
 
 exit:
     return ret;
 }
 
-bool JsonActiveDatasetString2Dataset(const std::string &aJsonActiveDataset, otOperationalDataset &aDataset)
+static bool ReadTimestamp(JsonReader &aReader, Token aToken, otTimestamp &aTimestamp)
 {
-    cJSON *jsonActiveDataset;
-    bool   ret = true;
+    Token token = aToken;
+    bool  ret   = false;
 
-    VerifyOrExit((jsonActiveDataset = cJSON_Parse(aJsonActiveDataset.c_str())) != nullptr, ret = false);
-    VerifyOrExit(cJSON_IsObject(jsonActiveDataset), ret = false);
+    VerifyOrExit(token == Token::kBeginObject);
 
-    ret = JsonActiveDataset2Dataset(jsonActiveDataset, aDataset);
+    aTimestamp.mAuthoritative = false;
+    while ((token = aReader.Next()) == Token::kKey)
+    {
+        if (aReader.IsString("Seconds"))
+        {
+            VerifyOrExit(ParseUint(aReader, aReader.Next(), aTimestamp.mSeconds));
+        }
+        else if (aReader.IsString("Ticks"))
+        {
+            VerifyOrExit(ParseUint(aReader, aReader.Next(), aTimestamp.mTicks));
+        }
+        else if (aReader.IsString("Authoritative"))
+        {
+            VerifyOrExit(ParseBool(aReader.Next(), aTimestamp.mAuthoritative));
+        }
+        else
+        {
+            VerifyOrExit(aReader.SkipValue());
+        }
+    }
+
+    ret = (token == Token::kEndObject);
 
 exit:
-    cJSON_Delete(jsonActiveDataset);
+    return ret;
+}
 
+static bool ReadSecurityPolicy(JsonReader &aReader, Token aToken, otSecurityPolicy &aSecurityPolicy)
+{
+    Token token = aToken;
+    bool  ret   = false;
+    bool  value;
+
+    VerifyOrExit(token == Token::kBeginObject);
+
+    // The flags which are not given are disabled.
+    aSecurityPolicy.mObtainNetworkKeyEnabled        = false;
+    aSecurityPolicy.mNativeCommissioningEnabled     = false;
+    aSecurityPolicy.mRoutersEnabled                 = false;
+    aSecurityPolicy.mExternalCommissioningEnabled   = false;
+    aSecurityPolicy.mCommercialCommissioningEnabled = false;
+    aSecurityPolicy.mAutonomousEnrollmentEnabled    = false;
+    aSecurityPolicy.mNetworkKeyProvisioningEnabled  = false;
+    aSecurityPolicy.mTobleLinkEnabled               = false;
+    aSecurityPolicy.mNonCcmRoutersEnabled           = false;
+
+    while ((token = aReader.Next()) == Token::kKey)
+    {
+        if (aReader.IsString("RotationTime"))
+        {
+            VerifyOrExit(ParseUint(aReader, aReader.Next(), aSecurityPolicy.mRotationTime));
+        }
+        else if (aReader.IsString("ObtainNetworkKey"))
+        {
+            VerifyOrExit(ParseBool(aReader.Next(), value));
+            aSecurityPolicy.mObtainNetworkKeyEnabled = value;
+        }
+        else if (aReader.IsString("NativeCommissioning"))
+        {
+            VerifyOrExit(ParseBool(aReader.Next(), value));
+            aSecurityPolicy.mNativeCommissioningEnabled = value;
+        }
+        else if (aReader.IsString("Routers"))
+        {
+            VerifyOrExit(ParseBool(aReader.Next(), value));
+            aSecurityPolicy.mRoutersEnabled = value;
+        }
+        else if (aReader.IsString("ExternalCommissioning"))
+        {
+            VerifyOrExit(ParseBool(aReader.Next(), value));
+            aSecurityPolicy.mExternalCommissioningEnabled = value;
+        }
+        else if (aReader.IsString("CommercialCommissioning"))
+        {
+            VerifyOrExit(ParseBool(aReader.Next(), value));
+            aSecurityPolicy.mCommercialCommissioningEnabled = value;
+        }
+        else if (aReader.IsString("AutonomousEnrollment"))
+        {
+            VerifyOrExit(ParseBool(aReader.Next(), value));
+            aSecurityPolicy.mAutonomousEnrollmentEnabled = value;
+        }
+        else if (aReader.IsString("NetworkKeyProvisioning"))
+        {
+            VerifyOrExit(ParseBool(aReader.Next(), value));
+            aSecurityPolicy.mNetworkKeyProvisioningEnabled = value;
+        }
+        else if (aReader.IsString("TobleLink"))
+        {
+            VerifyOrExit(ParseBool(aReader.Next(), value));
+            aSecurityPolicy.mTobleLinkEnabled = value;
+        }
+        else if (aReader.IsString("NonCcmRouters"))
+        {
+            VerifyOrExit(ParseBool(aReader.Next(), value));
+            aSecurityPolicy.mNonCcmRoutersEnabled = value;
+        }
+        else
+        {
+            VerifyOrExit(aReader.SkipValue());
+        }
+    }
+
+    ret = (token == Token::kEndObject);
+
+exit:
     return ret;
 }
 
-bool JsonPendingDatasetString2Dataset(const std::string &aJsonPendingDataset, otOperationalDataset &aDataset)
+// Fields set to null are cleared (set to not present), the other fields are left as is.
+static bool ReadActiveDataset(JsonReader &aReader, Token aToken, otOperationalDataset &aDataset)
 {
-    cJSON      *value;
-    cJSON      *jsonDataset;
-    otTimestamp timestamp;
-    bool        ret = true;
+    Token token = aToken;
+    bool  ret   = false;
 
-    VerifyOrExit((jsonDataset = cJSON_Parse(aJsonPendingDataset.c_str())) != nullptr, ret = false);
-    VerifyOrExit(cJSON_IsObject(jsonDataset), ret = false);
+    VerifyOrExit(token == Token::kBeginObject);
 
-    value = cJSON_GetObjectItemCaseSensitive(jsonDataset, "ActiveDataset");
-    if (cJSON_IsObject(value))
+    while ((token = aReader.Next()) == Token::kKey)
     {
-        VerifyOrExit(JsonActiveDataset2Dataset(value, aDataset), ret = false);
+        if (aReader.IsString("ActiveTimestamp"))
+        {
+            token = aReader.Next();
+            VerifyOrExit(token == Token::kNull || ReadTimestamp(aReader, token, aDataset.mActiveTimestamp));
+            aDataset.mComponents.mIsActiveTimestampPresent = (token != Token::kNull);
+        }
+        else if (aReader.IsString("NetworkKey"))
+        {
+            token = aReader.Next();
+            VerifyOrExit(token == Token::kNull ||
+                         ParseHex(aReader, token, aDataset.mNetworkKey.m8, OT_NETWORK_KEY_SIZE));
+            aDataset.mComponents.mIsNetworkKeyPresent = (token != Token::kNull);
+        }
+        else if (aReader.IsString("NetworkName"))
+        {
+            token = aReader.Next();
+            VerifyOrExit(token == Token::kNull || ParseNetworkName(aReader, token, aDataset.mNetworkName));
+            aDataset.mComponents.mIsNetworkNamePresent = (token != Token::kNull);
+        }
+        else if (aReader.IsString("ExtPanId"))
+        {
+            token = aReader.Next();
+            VerifyOrExit(token == Token::kNull ||
+                         ParseHex(aReader, token, aDataset.mExtendedPanId.m8, OT_EXT_PAN_ID_SIZE));
+            aDataset.mComponents.mIsExtendedPanIdPresent = (token != Token::kNull);
+        }
+        else if (aReader.IsString("MeshLocalPrefix"))
+        {
+            token = aReader.Next();
+            VerifyOrExit(token == Token::kNull || ParseMeshLocalPrefix(aReader, token, aDataset.mMeshLocalPrefix));
+            aDataset.mComponents.mIsMeshLocalPrefixPresent = (token != Token::kNull);
+        }
+        else if (aReader.IsString("PanId"))
+        {
+            token = aReader.Next();
+            VerifyOrExit(token == Token::kNull || ParseUint(aReader, token, aDataset.mPanId));
+            aDataset.mComponents.mIsPanIdPresent = (token != Token::kNull);
+        }
+        else if (aReader.IsString("Channel"))
+        {
+            token = aReader.Next();
+            VerifyOrExit(token == Token::kNull || ParseUint(aReader, token, aDataset.mChannel));
+            aDataset.mComponents.mIsChannelPresent = (token != Token::kNull);
+        }
+        else if (aReader.IsString("PSKc"))
+        {
+            token = aReader.Next();
+            VerifyOrExit(token == Token::kNull || ParseHex(aReader, token, aDataset.mPskc.m8, OT_PSKC_MAX_SIZE));
+            aDataset.mComponents.mIsPskcPresent = (token != Token::kNull);
+        }
+        else if (aReader.IsString("SecurityPolicy"))
+        {
+            token = aReader.Next();
+            VerifyOrExit(token == Token::kNull || ReadSecurityPolicy(aReader, token, aDataset.mSecurityPolicy));
+            aDataset.mComponents.mIsSecurityPolicyPresent = (token != Token::kNull);
+        }
+        else if (aReader.IsString("ChannelMask"))
+        {
+            token = aReader.Next();
+            VerifyOrExit(token == Token::kNull || ParseUint(aReader, token, aDataset.mChannelMask));
+            aDataset.mComponents.mIsChannelMaskPresent = (token != Token::kNull);
+        }
+        else
+        {
+            VerifyOrExit(aReader.SkipValue());
+        }
     }
-    else if (cJSON_IsString(value))
-    {
-        otOperationalDatasetTlvs datasetTlvs;
-        int                      len;
 
-        len =
-            Hex2BytesJsonString(std::string(value->valuestring), datasetTlvs.mTlvs, OT_OPERATIONAL_DATASET_MAX_LENGTH);
-        VerifyOrExit(len > 0, ret = false);
-        datasetTlvs.mLength = len;
+    ret = (token == Token::kEndObject);
 
-        VerifyOrExit(otDatasetParseTlvs(&datasetTlvs, &aDataset) == OT_ERROR_NONE, ret = false);
-    }
-    else
-    {
-        ExitNow(ret = false);
-    }
+exit:
+    return ret;
+}
 
-    value = cJSON_GetObjectItemCaseSensitive(jsonDataset, "PendingTimestamp");
-    if (cJSON_IsObject(value))
-    {
-        VerifyOrExit(Json2Timestamp(value, timestamp), ret = false);
-        aDataset.mPendingTimestamp                      = timestamp;
-        aDataset.mComponents.mIsPendingTimestampPresent = true;
-    }
-    else if (cJSON_IsNull(value))
-    {
-        aDataset.mComponents.mIsPendingTimestampPresent = false;
-    }
-    else if (value != nullptr)
+bool JsonActiveDatasetString2Dataset(const StringView &aJsonActiveDataset, otOperationalDataset &aDataset)
+{
+    JsonReader reader(aJsonActiveDataset);
+
+    return ReadActiveDataset(reader, reader.Next(), aDataset) && reader.Next() == Token::kEnd;
+}
+
+bool JsonPendingDatasetString2Dataset(const StringView &aJsonPendingDataset, otOperationalDataset &aDataset)
+{
+    JsonReader               reader(aJsonPendingDataset);
+    Token                    token;
+    otOperationalDataset     pendingDataset      = {};
+    otOperationalDatasetTlvs datasetTlvs;
+    int                      length;
+    bool                     hasActiveDataset    = false;
+    bool                     hasPendingTimestamp = false;
+    bool                     hasDelay            = false;
+    bool                     ret                 = false;
+
+    VerifyOrExit(reader.Next() == Token::kBeginObject);
+
+    // The pending fields are applied once the object is read, as the Active Dataset TLVs replace the whole dataset.
+    while ((token = reader.Next()) == Token::kKey)
     {
-        ExitNow(ret = false);
+        if (reader.IsString("ActiveDataset"))
+        {
+            token = reader.Next();
+            if (token == Token::kString)
+            {
+                length = Utils::Hex2Bytes(reader.GetString(), datasetTlvs.mTlvs, OT_OPERATIONAL_DATASET_MAX_LENGTH);
+                VerifyOrExit(length > 0);
+                datasetTlvs.mLength = static_cast<uint8_t>(length);
+                VerifyOrExit(otDatasetParseTlvs(&datasetTlvs, &aDataset) == OT_ERROR_NONE);
+            }
+            else
+            {
+                VerifyOrExit(ReadActiveDataset(reader, token, aDataset));
+            }
+            hasActiveDataset = true;
+        }
+        else if (reader.IsString("PendingTimestamp"))
+        {
+            token = reader.Next();
+            VerifyOrExit(token == Token::kNull || ReadTimestamp(reader, token, pendingDataset.mPendingTimestamp));
+            pendingDataset.mComponents.mIsPendingTimestampPresent = (token != Token::kNull);
+            hasPendingTimestamp                                   = true;
+        }
+        else if (reader.IsString("Delay"))
+        {
+            token = reader.Next();
+            VerifyOrExit(token == Token::kNull || ParseUint(reader, token, pendingDataset.mDelay));
+            pendingDataset.mComponents.mIsDelayPresent = (token != Token::kNull);
+            hasDelay                                   = true;
+        }
+        else
+        {
+            VerifyOrExit(reader.SkipValue());
+        }
     }
 
-    value = cJSON_GetObjectItemCaseSensitive(jsonDataset, "Delay");
-    if (cJSON_IsNumber(value))
+    VerifyOrExit(token == Token::kEndObject && reader.Next() == Token::kEnd && hasActiveDataset);
+
+    if (hasPendingTimestamp)
     {
-        aDataset.mDelay                      = value->valueint;
-        aDataset.mComponents.mIsDelayPresent = true;
+        aDataset.mPendingTimestamp                      = pendingDataset.mPendingTimestamp;
+        aDataset.mComponents.mIsPendingTimestampPresent = pendingDataset.mComponents.mIsPendingTimestampPresent;
     }
-    else if (cJSON_IsNull(value))
+    if (hasDelay)
     {
-        aDataset.mComponents.mIsDelayPresent = false;
+        aDataset.mDelay                      = pendingDataset.mDelay;
+        aDataset.mComponents.mIsDelayPresent = pendingDataset.mComponents.mIsDelayPresent;
     }
+    ret = true;
 
 exit:
-    cJSON_Delete(jsonDataset);
-
     return ret;
 }
 
@@ -36,11 +36,19 @@
 
 #include "openthread-br/config.h"
 
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "openthread/dataset.h"
 #include "openthread/link.h"
 #include "openthread/thread_ftd.h"
 
+#include "common/string_view.hpp"
+#include "rest/topology_graph.hpp"
 #include "rest/types.hpp"
+#include "utils/channel_occupancy.hpp"
+#include "utils/counter_history.hpp"
 #include "utils/hex.hpp"
 
 namespace otbr {
@@ -107,7 +115,7 @@ std::string String2JsonString(const std::string &aString);
  *
  * @returns A boolean indicating whether the Json string was indeed a string.
  */
-bool JsonString2String(const std::string &aJsonString, std::string &aString);
+bool JsonString2String(const StringView &aJsonString, std::string &aString);
 
 /**
  * This method formats a Node object to a Json object and serialize it to a string.
@@ -127,6 +135,53 @@ std::string Node2JsonString(const NodeInfo &aNode);
  */
 std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet);
 
+/**
+ * This method formats a vector of diagnostic objects to a CBOR array of the same structure as the Json array.
+ *
+ * Bytes such as the extended address are CBOR byte strings instead of hex strings.
+ *
+ * @param[in] aDiagSet  A vector of diagnostic objects.
+ *
+ * @returns A string of the CBOR bytes.
+ */
+std::string Diag2CborString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet);
+
+/**
+ * This method formats the links of a node in the topology graph to a Json array and serialize it to a string.
+ *
+ * @param[in] aLinks  The links of the node.
+ *
+ * @returns A string of serialized Json array.
+ */
+std::string TopologyLinks2JsonString(const std::vector<TopologyGraph::Link> &aLinks);
+
+/**
+ * This method formats a path in the topology graph to a Json object and serialize it to a string.
+ *
+ * @param[in] aPath  The path.
+ *
+ * @returns A string of serialized Json object.
+ */
+std::string TopologyPath2JsonString(const TopologyGraph::Path &aPath);
+
+/**
+ * This method formats the partitions of the topology graph to a Json array and serialize it to a string.
+ *
+ * @param[in] aPartitions  The RLOC16s of the nodes of each partition.
+ *
+ * @returns A string of serialized Json array.
+ */
+std::string TopologyPartitions2JsonString(const std::vector<std::vector<uint16_t>> &aPartitions);
+
+/**
+ * This method formats the diagnostic TLVs of one node to a Json object and serialize it to a string.
+ *
+ * @param[in] aDiagTlvs  A vector of diagnostic TLVs of a node.
+ *
+ * @returns A string of serialized Json object.
+ */
+std::string DiagTlvs2JsonString(const std::vector<otNetworkDiagTlv> &aDiagTlvs);
+
 /**
  * This method formats an Ipv6Address to a Json string and serialize it to a string.
  *
@@ -181,6 +236,35 @@ std::string RouteData2JsonString(const otNetworkDiagRouteData &aRouteData);
  */
 std::string LeaderData2JsonString(const otLeaderData &aLeaderData);
 
+/**
+ * This method formats an active scan result to a Json object and serialize it to a string.
+ *
+ * @param[in] aResult  An active scan result.
+ *
+ * @returns A string of serialized Json object.
+ */
+std::string ActiveScanResult2JsonString(const otActiveScanResult &aResult);
+
+/**
+ * This method formats an energy scan result to a Json object and serialize it to a string.
+ *
+ * @param[in] aResult  An energy scan result.
+ *
+ * @returns A string of serialized Json object.
+ */
+std::string EnergyScanResult2JsonString(const otEnergyScanResult &aResult);
+
+/**
+ * This method parses the Json object of a scan request.
+ *
+ * @param[in]  aJsonScanRequest  The Json string of a scan request.
+ * @param[out] aChannelMask      The channel mask, 0 when absent.
+ * @param[out] aScanDuration     The scan duration of each channel in milliseconds, 0 when absent.
+ *
+ * @returns true if the Json string has been successfully parsed, otherwise false.
+ */
+bool JsonScanRequestString2Params(const std::string &aJsonScanRequest, uint32_t &aChannelMask, uint32_t &aScanDuration);
+
 /**
  * This method formats a MacCounters object to a Json object and serialize it to a string.
  *
@@ -199,6 +283,40 @@ std::string MacCounters2JsonString(const otNetworkDiagMacCounters &aMacCounters)
  */
 std::string ChildTableEntry2JsonString(const otNetworkDiagChildEntry &aChildEntry);
 
+/**
+ * This method formats the counter history of the Thread interface and of the neighbors to a Json object and
+ * serialize it to a string.
+ *
+ * @param[in] aHistory  The counter history.
+ *
+ * @returns A string of serialized Json object.
+ */
+std::string CounterHistory2JsonString(const agent::CounterHistory &aHistory);
+
+/**
+ * This method formats the occupancy of the sampled channels and the least occupied channel to a Json object and
+ * serialize it to a string.
+ *
+ * @param[in] aOccupancy              The channel occupancy statistics.
+ * @param[in] aSupportedChannelMask   The channels to format.
+ * @param[in] aPreferredChannelMask   The channels to recommend one from.
+ *
+ * @returns A string of serialized Json object.
+ */
+std::string ChannelOccupancy2JsonString(const ChannelOccupancy &aOccupancy,
+                                        uint32_t                aSupportedChannelMask,
+                                        uint32_t                aPreferredChannelMask);
+
+/**
+ * This method formats the bodies of several resources to a Json object keyed by their paths and serialize it to a
+ * string.
+ *
+ * @param[in] aBodies  The paths and the Json bodies of the resources, an empty body is formatted as null.
+ *
+ * @returns A string of serialized Json object.
+ */
+std::string Batch2JsonString(const std::vector<std::pair<std::string, std::string>> &aBodies);
+
 /**
  * This method formats an error code and an error message to a Json object and serialize it to a string.
  *
@@ -232,12 +350,15 @@ std::string PendingDataset2JsonString(const otOperationalDataset &aPendingDatase
  * set to null are cleared (set to not present). Non-present fields are left
  * as is.
  *
+ * The Json string is read in a single pass without building a tree, a malformed
+ * string or a field of the wrong type or size is rejected as soon as it is read.
+ *
  * @param[in] aJsonActiveDataset  The Json string to be parsed.
  * @param[in] aDataset            The dataset struct to be filled.
  *
  * @returns If the Json string has been successfully parsed.
  */
-bool JsonActiveDatasetString2Dataset(const std::string &aJsonActiveDataset, otOperationalDataset &aDataset);
+bool JsonActiveDatasetString2Dataset(const StringView &aJsonActiveDataset, otOperationalDataset &aDataset);
 
 /**
  * This method parses a Json string and fills the provided dataset. Fields
@@ -249,7 +370,7 @@ bool JsonActiveDatasetString2Dataset(const std::string &aJsonActiveDataset, otOp
  *
  * @returns If the Json string has been successfully parsed.
  */
-bool JsonPendingDatasetString2Dataset(const std::string &aJsonPendingDataset, otOperationalDataset &aDataset);
+bool JsonPendingDatasetString2Dataset(const StringView &aJsonPendingDataset, otOperationalDataset &aDataset);
 
 }; // namespace Json
 
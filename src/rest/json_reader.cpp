@@ -0,0 +1,451 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rest/json_reader.hpp"
+
+#include <string.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace rest {
+
+static bool IsDigit(char aChar)
+{
+    return aChar >= '0' && aChar <= '9';
+}
+
+JsonReader::JsonReader(const StringView &aJson)
+    : mCur(aJson.Data())
+    , mEnd(aJson.Data() + aJson.Size())
+    , mExpect(Expect::kValue)
+    , mError(false)
+    , mDepth(0)
+    , mObjects(0)
+    , mIsUint(false)
+    , mUint(0)
+    , mStringLength(0)
+{
+    mString[0] = '\0';
+}
+
+JsonReader::Token JsonReader::Next(void)
+{
+    Token token = Token::kError;
+
+    VerifyOrExit(!mError);
+    SkipWhitespace();
+
+    if (mExpect == Expect::kSeparator && mCur < mEnd && *mCur == ',')
+    {
+        mCur++;
+        mExpect = IsInObject() ? Expect::kKey : Expect::kValue;
+        SkipWhitespace();
+    }
+
+    if (mCur == mEnd)
+    {
+        token = (mExpect == Expect::kDone) ? Token::kEnd : Fail();
+    }
+    else if (mExpect == Expect::kSeparator || (mExpect == Expect::kFirstValue && *mCur == ']') ||
+             (mExpect == Expect::kFirstKey && *mCur == '}'))
+    {
+        VerifyOrExit(*mCur == (IsInObject() ? '}' : ']'), token = Fail());
+        token = EndContainer();
+    }
+    else if (mExpect == Expect::kValue || mExpect == Expect::kFirstValue)
+    {
+        token = ReadValue();
+    }
+    else if (mExpect == Expect::kKey || mExpect == Expect::kFirstKey)
+    {
+        VerifyOrExit(*mCur == '"' && ReadString(), token = Fail());
+        SkipWhitespace();
+        VerifyOrExit(mCur < mEnd && *mCur == ':', token = Fail());
+        mCur++;
+        mExpect = Expect::kValue;
+        token   = Token::kKey;
+    }
+    else
+    {
+        // Only whitespace may follow the top-level value.
+        token = Fail();
+    }
+
+exit:
+    return token;
+}
+
+bool JsonReader::Skip(Token aToken)
+{
+    uint8_t depth = mDepth;
+
+    if (aToken == Token::kBeginObject || aToken == Token::kBeginArray)
+    {
+        while (!mError && mDepth >= depth)
+        {
+            Next();
+        }
+    }
+
+    return !mError;
+}
+
+bool JsonReader::IsString(const char *aString) const
+{
+    return strcmp(mString, aString) == 0;
+}
+
+bool JsonReader::GetUint(uint64_t &aValue) const
+{
+    if (mIsUint)
+    {
+        aValue = mUint;
+    }
+
+    return mIsUint;
+}
+
+JsonReader::Token JsonReader::Fail(void)
+{
+    mError = true;
+
+    return Token::kError;
+}
+
+JsonReader::Token JsonReader::BeginContainer(bool aIsObject)
+{
+    Token token = aIsObject ? Token::kBeginObject : Token::kBeginArray;
+
+    VerifyOrExit(mDepth < kMaxDepth, token = Fail());
+
+    mCur++;
+    mObjects = static_cast<uint8_t>((mObjects & ~(1u << mDepth)) | (static_cast<unsigned>(aIsObject) << mDepth));
+    mDepth++;
+    mExpect = aIsObject ? Expect::kFirstKey : Expect::kFirstValue;
+
+exit:
+    return token;
+}
+
+JsonReader::Token JsonReader::EndContainer(void)
+{
+    Token token = IsInObject() ? Token::kEndObject : Token::kEndArray;
+
+    mCur++;
+    mDepth--;
+
+    return EndValue(token);
+}
+
+JsonReader::Token JsonReader::EndValue(Token aToken)
+{
+    mExpect = (mDepth == 0) ? Expect::kDone : Expect::kSeparator;
+
+    return aToken;
+}
+
+JsonReader::Token JsonReader::ReadValue(void)
+{
+    Token token;
+
+    switch (*mCur)
+    {
+    case '{':
+        token = BeginContainer(/* aIsObject */ true);
+        break;
+    case '[':
+        token = BeginContainer(/* aIsObject */ false);
+        break;
+    case '"':
+        token = ReadString() ? EndValue(Token::kString) : Fail();
+        break;
+    case 't':
+        token = ReadLiteral("true", Token::kTrue);
+        break;
+    case 'f':
+        token = ReadLiteral("false", Token::kFalse);
+        break;
+    case 'n':
+        token = ReadLiteral("null", Token::kNull);
+        break;
+    default:
+        token = ReadNumber();
+        break;
+    }
+
+    return token;
+}
+
+JsonReader::Token JsonReader::ReadLiteral(const char *aLiteral, Token aToken)
+{
+    Token  token  = aToken;
+    size_t length = strlen(aLiteral);
+
+    VerifyOrExit(static_cast<size_t>(mEnd - mCur) >= length && memcmp(mCur, aLiteral, length) == 0, token = Fail());
+    mCur += length;
+    token = EndValue(aToken);
+
+exit:
+    return token;
+}
+
+JsonReader::Token JsonReader::ReadNumber(void)
+{
+    Token token = Token::kError;
+
+    mIsUint = true;
+    mUint   = 0;
+
+    if (mCur < mEnd && *mCur == '-')
+    {
+        mIsUint = false;
+        mCur++;
+    }
+
+    VerifyOrExit(mCur < mEnd && IsDigit(*mCur), token = Fail());
+
+    // A leading zero is an integer part on its own, the digits following it are rejected as the next token.
+    if (*mCur == '0')
+    {
+        mCur++;
+    }
+    else
+    {
+        while (mCur < mEnd && IsDigit(*mCur))
+        {
+            uint8_t digit = static_cast<uint8_t>(*mCur - '0');
+
+            if (mUint > (UINT64_MAX - digit) / 10)
+            {
+                mIsUint = false;
+            }
+            mUint = mUint * 10 + digit;
+            mCur++;
+        }
+    }
+
+    if (mCur < mEnd && *mCur == '.')
+    {
+        mIsUint = false;
+        mCur++;
+        VerifyOrExit(mCur < mEnd && IsDigit(*mCur), token = Fail());
+        while (mCur < mEnd && IsDigit(*mCur))
+        {
+            mCur++;
+        }
+    }
+
+    if (mCur < mEnd && (*mCur == 'e' || *mCur == 'E'))
+    {
+        mIsUint = false;
+        mCur++;
+        if (mCur < mEnd && (*mCur == '+' || *mCur == '-'))
+        {
+            mCur++;
+        }
+        VerifyOrExit(mCur < mEnd && IsDigit(*mCur), token = Fail());
+        while (mCur < mEnd && IsDigit(*mCur))
+        {
+            mCur++;
+        }
+    }
+
+    token = EndValue(Token::kNumber);
+
+exit:
+    return token;
+}
+
+bool JsonReader::ReadString(void)
+{
+    bool ret = false;
+
+    // Skip the opening quote.
+    mCur++;
+    mStringLength = 0;
+
+    while (true)
+    {
+        uint8_t  c;
+        uint32_t codePoint;
+        uint32_t lowSurrogate;
+
+        VerifyOrExit(mCur < mEnd);
+        c = static_cast<uint8_t>(*mCur++);
+
+        if (c == '"')
+        {
+            break;
+        }
+
+        VerifyOrExit(c >= 0x20);
+
+        if (c == '\\')
+        {
+            VerifyOrExit(mCur < mEnd);
+            c = static_cast<uint8_t>(*mCur++);
+
+            switch (c)
+            {
+            case '"':
+            case '\\':
+            case '/':
+                break;
+            case 'b':
+                c = '\b';
+                break;
+            case 'f':
+                c = '\f';
+                break;
+            case 'n':
+                c = '\n';
+                break;
+            case 'r':
+                c = '\r';
+                break;
+            case 't':
+                c = '\t';
+                break;
+            case 'u':
+                VerifyOrExit(ReadHex4(codePoint));
+                if (codePoint >= 0xd800 && codePoint <= 0xdbff)
+                {
+                    VerifyOrExit(mEnd - mCur >= 2 && mCur[0] == '\\' && mCur[1] == 'u');
+                    mCur += 2;
+                    VerifyOrExit(ReadHex4(lowSurrogate) && lowSurrogate >= 0xdc00 && lowSurrogate <= 0xdfff);
+                    codePoint = 0x10000 + ((codePoint - 0xd800) << 10) + (lowSurrogate - 0xdc00);
+                }
+                else
+                {
+                    VerifyOrExit(codePoint < 0xdc00 || codePoint > 0xdfff);
+                }
+                VerifyOrExit(AppendCodePoint(codePoint));
+                continue;
+            default:
+                ExitNow();
+            }
+        }
+
+        VerifyOrExit(mStringLength < kMaxStringLength);
+        mString[mStringLength++] = static_cast<char>(c);
+    }
+
+    ret = true;
+
+exit:
+    mString[mStringLength] = '\0';
+
+    return ret;
+}
+
+bool JsonReader::AppendCodePoint(uint32_t aCodePoint)
+{
+    bool    ret = false;
+    uint8_t length;
+
+    // The decoded string is a C string, an escaped null character would truncate it.
+    VerifyOrExit(aCodePoint != 0);
+
+    length = (aCodePoint < 0x80) ? 1 : (aCodePoint < 0x800) ? 2 : (aCodePoint < 0x10000) ? 3 : 4;
+    VerifyOrExit(mStringLength + length <= kMaxStringLength);
+
+    switch (length)
+    {
+    case 1:
+        mString[mStringLength++] = static_cast<char>(aCodePoint);
+        break;
+    case 2:
+        mString[mStringLength++] = static_cast<char>(0xc0 | (aCodePoint >> 6));
+        mString[mStringLength++] = static_cast<char>(0x80 | (aCodePoint & 0x3f));
+        break;
+    case 3:
+        mString[mStringLength++] = static_cast<char>(0xe0 | (aCodePoint >> 12));
+        mString[mStringLength++] = static_cast<char>(0x80 | ((aCodePoint >> 6) & 0x3f));
+        mString[mStringLength++] = static_cast<char>(0x80 | (aCodePoint & 0x3f));
+        break;
+    default:
+        mString[mStringLength++] = static_cast<char>(0xf0 | (aCodePoint >> 18));
+        mString[mStringLength++] = static_cast<char>(0x80 | ((aCodePoint >> 12) & 0x3f));
+        mString[mStringLength++] = static_cast<char>(0x80 | ((aCodePoint >> 6) & 0x3f));
+        mString[mStringLength++] = static_cast<char>(0x80 | (aCodePoint & 0x3f));
+        break;
+    }
+
+    ret = true;
+
+exit:
+    return ret;
+}
+
+bool JsonReader::ReadHex4(uint32_t &aValue)
+{
+    bool ret = false;
+
+    VerifyOrExit(mEnd - mCur >= 4);
+
+    aValue = 0;
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        char c = *mCur++;
+
+        aValue <<= 4;
+        if (IsDigit(c))
+        {
+            aValue |= static_cast<uint32_t>(c - '0');
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            aValue |= static_cast<uint32_t>(c - 'a' + 10);
+        }
+        else if (c >= 'A' && c <= 'F')
+        {
+            aValue |= static_cast<uint32_t>(c - 'A' + 10);
+        }
+        else
+        {
+            ExitNow();
+        }
+    }
+
+    ret = true;
+
+exit:
+    return ret;
+}
+
+void JsonReader::SkipWhitespace(void)
+{
+    while (mCur < mEnd && (*mCur == ' ' || *mCur == '\t' || *mCur == '\n' || *mCur == '\r'))
+    {
+        mCur++;
+    }
+}
+
+} // namespace rest
+} // namespace otbr
@@ -0,0 +1,184 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes streaming JSON reader definition for RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_JSON_READER_HPP_
+#define OTBR_REST_JSON_READER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/string_view.hpp"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class implements a validating streaming JSON reader.
+ *
+ * The JSON text is read one token at a time, without building an intermediate tree, and the grammar is checked as
+ * the tokens are read. The memory used is fixed: a key or string longer than `kMaxStringLength` or a nesting deeper
+ * than `kMaxDepth` is rejected as soon as it is reached. Once an error is found, all following tokens are errors.
+ */
+class JsonReader
+{
+public:
+    static constexpr uint8_t  kMaxDepth        = 8;   ///< The maximum nesting of objects and arrays.
+    static constexpr uint16_t kMaxStringLength = 512; ///< The maximum length of a decoded key or string.
+
+    /**
+     * This enumeration represents the tokens of a JSON text.
+     */
+    enum class Token : uint8_t
+    {
+        kError,       ///< The JSON text is invalid or exceeds the limits.
+        kEnd,         ///< The JSON text ends after a complete value.
+        kBeginObject, ///< `{`
+        kEndObject,   ///< `}`
+        kBeginArray,  ///< `[`
+        kEndArray,    ///< `]`
+        kKey,         ///< The key of an object member, available with `GetString()`.
+        kString,      ///< A string, available with `GetString()`.
+        kNumber,      ///< A number, available with `GetUint()` if it's an unsigned integer.
+        kTrue,        ///< `true`
+        kFalse,       ///< `false`
+        kNull,        ///< `null`
+    };
+
+    /**
+     * The constructor of a JSON reader.
+     *
+     * @param[in] aJson  The JSON text, which must not be modified while it is read.
+     */
+    explicit JsonReader(const StringView &aJson);
+
+    /**
+     * This method reads the next token.
+     *
+     * @returns The token read.
+     */
+    Token Next(void);
+
+    /**
+     * This method skips the rest of a value whose first token was just read.
+     *
+     * @param[in] aToken  The first token of the value.
+     *
+     * @retval TRUE   The value was skipped.
+     * @retval FALSE  The value is invalid.
+     */
+    bool Skip(Token aToken);
+
+    /**
+     * This method reads the next value and skips it.
+     *
+     * @retval TRUE   The value was skipped.
+     * @retval FALSE  The value is invalid.
+     */
+    bool SkipValue(void) { return Skip(Next()); }
+
+    /**
+     * This method returns the decoded key or string of the last token.
+     *
+     * @returns A null-terminated C string.
+     */
+    const char *GetString(void) const { return mString; }
+
+    /**
+     * This method returns the length of the decoded key or string of the last token.
+     *
+     * @returns The length in bytes.
+     */
+    uint16_t GetStringLength(void) const { return mStringLength; }
+
+    /**
+     * This method indicates whether the decoded key or string of the last token equals a C string.
+     *
+     * @param[in] aString  A C string.
+     *
+     * @retval TRUE   The key or string equals @p aString.
+     * @retval FALSE  The key or string doesn't equal @p aString.
+     */
+    bool IsString(const char *aString) const;
+
+    /**
+     * This method returns the number of the last token as an unsigned integer.
+     *
+     * @param[out] aValue  The unsigned integer.
+     *
+     * @retval TRUE   The number is an unsigned integer which fits in 64 bits, @p aValue is set.
+     * @retval FALSE  The number is negative, has a fraction or an exponent, or is too large.
+     */
+    bool GetUint(uint64_t &aValue) const;
+
+private:
+    enum class Expect : uint8_t
+    {
+        kValue,      // A value, after `:` or `,` in an array or at the start.
+        kFirstValue, // A value or `]`, after `[`.
+        kKey,        // A key, after `,` in an object.
+        kFirstKey,   // A key or `}`, after `{`.
+        kSeparator,  // A `,` or the end of the current object or array, after a value.
+        kDone,       // Nothing, after the top-level value.
+    };
+
+    Token Fail(void);
+    Token BeginContainer(bool aIsObject);
+    Token EndContainer(void);
+    Token EndValue(Token aToken);
+    Token ReadValue(void);
+    Token ReadLiteral(const char *aLiteral, Token aToken);
+    Token ReadNumber(void);
+    bool  ReadString(void);
+    bool  AppendCodePoint(uint32_t aCodePoint);
+    bool  ReadHex4(uint32_t &aValue);
+    void  SkipWhitespace(void);
+    bool  IsInObject(void) const { return (mObjects >> (mDepth - 1)) & 1; }
+
+    const char *mCur;
+    const char *mEnd;
+    Expect      mExpect;
+    bool        mError;
+    uint8_t     mDepth;
+    uint8_t     mObjects; // Bit `n` is set when the container at depth `n + 1` is an object.
+    bool        mIsUint;
+    uint64_t    mUint;
+    uint16_t    mStringLength;
+    char        mString[kMaxStringLength + 1];
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_JSON_READER_HPP_
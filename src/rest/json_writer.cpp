@@ -0,0 +1,216 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rest/json_writer.hpp"
+
+#include <string.h>
+
+namespace otbr {
+namespace rest {
+
+static const char kHexDigits[] = "0123456789ABCDEF";
+
+JsonWriter::JsonWriter(std::string &aOutput)
+    : mOutput(aOutput)
+    , mNeedComma(false)
+{
+}
+
+void JsonWriter::BeginValue(void)
+{
+    if (mNeedComma)
+    {
+        mOutput.push_back(',');
+    }
+    mNeedComma = true;
+}
+
+JsonWriter &JsonWriter::BeginObject(void)
+{
+    BeginValue();
+    mOutput.push_back('{');
+    mNeedComma = false;
+
+    return *this;
+}
+
+JsonWriter &JsonWriter::EndObject(void)
+{
+    mOutput.push_back('}');
+    mNeedComma = true;
+
+    return *this;
+}
+
+JsonWriter &JsonWriter::BeginArray(void)
+{
+    BeginValue();
+    mOutput.push_back('[');
+    mNeedComma = false;
+
+    return *this;
+}
+
+JsonWriter &JsonWriter::EndArray(void)
+{
+    mOutput.push_back(']');
+    mNeedComma = true;
+
+    return *this;
+}
+
+JsonWriter &JsonWriter::Key(const char *aKey)
+{
+    BeginValue();
+    mOutput.push_back('"');
+    mOutput.append(aKey);
+    mOutput.append("\":");
+    mNeedComma = false;
+
+    return *this;
+}
+
+JsonWriter &JsonWriter::String(const char *aString)
+{
+    return String(aString, strlen(aString));
+}
+
+JsonWriter &JsonWriter::String(const char *aString, size_t aLength)
+{
+    BeginValue();
+    mOutput.push_back('"');
+
+    for (size_t i = 0; i < aLength; ++i)
+    {
+        unsigned char c = static_cast<unsigned char>(aString[i]);
+
+        switch (c)
+        {
+        case '"':
+            mOutput.append("\\\"");
+            break;
+        case '\\':
+            mOutput.append("\\\\");
+            break;
+        case '\b':
+            mOutput.append("\\b");
+            break;
+        case '\f':
+            mOutput.append("\\f");
+            break;
+        case '\n':
+            mOutput.append("\\n");
+            break;
+        case '\r':
+            mOutput.append("\\r");
+            break;
+        case '\t':
+            mOutput.append("\\t");
+            break;
+        default:
+            if (c < 0x20)
+            {
+                mOutput.append("\\u00");
+                mOutput.push_back(kHexDigits[c >> 4]);
+                mOutput.push_back(kHexDigits[c & 0x0f]);
+            }
+            else
+            {
+                mOutput.push_back(static_cast<char>(c));
+            }
+            break;
+        }
+    }
+
+    mOutput.push_back('"');
+
+    return *this;
+}
+
+JsonWriter &JsonWriter::HexString(const uint8_t *aBytes, uint16_t aLength)
+{
+    BeginValue();
+    mOutput.push_back('"');
+
+    for (uint16_t i = 0; i < aLength; ++i)
+    {
+        mOutput.push_back(kHexDigits[aBytes[i] >> 4]);
+        mOutput.push_back(kHexDigits[aBytes[i] & 0x0f]);
+    }
+
+    mOutput.push_back('"');
+
+    return *this;
+}
+
+JsonWriter &JsonWriter::Number(int64_t aNumber)
+{
+    // Large enough for the 19 digits and the sign of an int64_t.
+    char     digits[20];
+    char    *cur = digits + sizeof(digits);
+    uint64_t value;
+
+    BeginValue();
+
+    value = aNumber < 0 ? 0 - static_cast<uint64_t>(aNumber) : static_cast<uint64_t>(aNumber);
+    do
+    {
+        *--cur = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    if (aNumber < 0)
+    {
+        *--cur = '-';
+    }
+
+    mOutput.append(cur, static_cast<size_t>(digits + sizeof(digits) - cur));
+
+    return *this;
+}
+
+JsonWriter &JsonWriter::Bool(bool aValue)
+{
+    return Raw(aValue ? "true" : "false");
+}
+
+JsonWriter &JsonWriter::Null(void)
+{
+    return Raw("null");
+}
+
+JsonWriter &JsonWriter::Raw(const char *aJson)
+{
+    BeginValue();
+    mOutput.append(aJson);
+
+    return *this;
+}
+
+} // namespace rest
+} // namespace otbr
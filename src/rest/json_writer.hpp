@@ -0,0 +1,173 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes streaming JSON writer definition for RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_JSON_WRITER_HPP_
+#define OTBR_REST_JSON_WRITER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class implements a streaming JSON writer.
+ *
+ * Values are appended to the output string as they are written, without building an intermediate tree, so
+ * serializing a response only grows the output buffer. The writer inserts the separators between keys and values,
+ * the caller is responsible for balancing objects and arrays.
+ */
+class JsonWriter
+{
+public:
+    /**
+     * The constructor of a JSON writer.
+     *
+     * @param[in] aOutput  A string the JSON text is appended to.
+     */
+    explicit JsonWriter(std::string &aOutput);
+
+    /**
+     * This method begins a JSON object.
+     *
+     * @returns A reference to this writer.
+     */
+    JsonWriter &BeginObject(void);
+
+    /**
+     * This method ends the current JSON object.
+     *
+     * @returns A reference to this writer.
+     */
+    JsonWriter &EndObject(void);
+
+    /**
+     * This method begins a JSON array.
+     *
+     * @returns A reference to this writer.
+     */
+    JsonWriter &BeginArray(void);
+
+    /**
+     * This method ends the current JSON array.
+     *
+     * @returns A reference to this writer.
+     */
+    JsonWriter &EndArray(void);
+
+    /**
+     * This method writes the key of the next member of the current object.
+     *
+     * @param[in] aKey  A C string of the key, which is written without escaping.
+     *
+     * @returns A reference to this writer.
+     */
+    JsonWriter &Key(const char *aKey);
+
+    /**
+     * This method writes a JSON string.
+     *
+     * @param[in] aString  A C string to be escaped and written.
+     *
+     * @returns A reference to this writer.
+     */
+    JsonWriter &String(const char *aString);
+
+    /**
+     * This method writes a JSON string.
+     *
+     * @param[in] aString  A pointer to the characters to be escaped and written.
+     * @param[in] aLength  The number of characters.
+     *
+     * @returns A reference to this writer.
+     */
+    JsonWriter &String(const char *aString, size_t aLength);
+
+    /**
+     * This method writes a JSON string of bytes in upper case hex.
+     *
+     * @param[in] aBytes   A pointer to the bytes.
+     * @param[in] aLength  The number of bytes.
+     *
+     * @returns A reference to this writer.
+     */
+    JsonWriter &HexString(const uint8_t *aBytes, uint16_t aLength);
+
+    /**
+     * This method writes a JSON number.
+     *
+     * @param[in] aNumber  An integer.
+     *
+     * @returns A reference to this writer.
+     */
+    JsonWriter &Number(int64_t aNumber);
+
+    /**
+     * This method writes a JSON boolean.
+     *
+     * @param[in] aValue  A boolean value.
+     *
+     * @returns A reference to this writer.
+     */
+    JsonWriter &Bool(bool aValue);
+
+    /**
+     * This method writes a JSON null.
+     *
+     * @returns A reference to this writer.
+     */
+    JsonWriter &Null(void);
+
+    /**
+     * This method writes a pre-serialized JSON value without any check or escaping.
+     *
+     * @param[in] aJson  A C string of a serialized JSON value.
+     *
+     * @returns A reference to this writer.
+     */
+    JsonWriter &Raw(const char *aJson);
+
+private:
+    void BeginValue(void);
+
+    std::string &mOutput;
+    bool         mNeedComma;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_JSON_WRITER_HPP_
@@ -28,12 +28,19 @@
 
 #include "rest/parser.hpp"
 
+#include <limits.h>
+
 #include <string>
 #include <vector>
 
+#include "common/code_utils.hpp"
+
 namespace otbr {
 namespace rest {
 
+// The maximum size of a request body, a larger one is rejected as soon as its headers are parsed.
+static const uint64_t kMaxBodySize = 16384;
+
 static int OnUrl(http_parser *parser, const char *at, size_t len)
 {
     Request *request = reinterpret_cast<Request *>(parser->data);
@@ -64,6 +71,9 @@ static int OnMessageComplete(http_parser *parser)
 
     request->SetReadComplete();
 
+    // Stop parsing after a complete request, the following pipelined requests are parsed after this one is handled.
+    http_parser_pause(parser, 1);
+
     return 0;
 }
 
@@ -78,8 +88,21 @@ static int OnMessageBegin(http_parser *parser)
 static int OnHeaderComplete(http_parser *parser)
 {
     Request *request = reinterpret_cast<Request *>(parser->data);
+    int      ret     = 0;
+
     request->SetMethod(parser->method);
-    return 0;
+    request->SetKeepAlive(http_should_keep_alive(parser) != 0);
+
+    // The content length is all ones when the header is absent.
+    if (parser->content_length != ULLONG_MAX)
+    {
+        // A non-zero value other than 1 or 2 fails the parsing, before the body is read.
+        VerifyOrExit(parser->content_length <= kMaxBodySize, ret = -1);
+        request->SetContentLength(static_cast<size_t>(parser->content_length));
+    }
+
+exit:
+    return ret;
 }
 
 static int OnHandlerData(http_parser *, const char *, size_t)
@@ -129,9 +152,14 @@ void Parser::Init(void)
     http_parser_init(&mParser, HTTP_REQUEST);
 }
 
-void Parser::Process(const char *aBuf, size_t aLength)
+size_t Parser::Process(const char *aBuf, size_t aLength)
+{
+    return http_parser_execute(&mParser, &mSettings, aBuf, aLength);
+}
+
+void Parser::Resume(void)
 {
-    http_parser_execute(&mParser, &mSettings, aBuf, aLength);
+    http_parser_pause(&mParser, 0);
 }
 
 } // namespace rest
@@ -70,10 +70,20 @@ public:
     /**
      * This method performs a parse process.
      *
+     * The parser pauses after a complete request, the remaining data should be processed again
+     * after calling `Resume()`.
+     *
      * @param[in] aBuf     A pointer pointing to read buffer.
      * @param[in] aLength  An integer indicates how much data is to be processed by parser.
+     *
+     * @returns The number of bytes parsed, which is less than @p aLength if a request completes or an error occurs.
+     */
+    size_t Process(const char *aBuf, size_t aLength);
+
+    /**
+     * This method resumes the parser to parse the next request.
      */
-    void Process(const char *aBuf, size_t aLength);
+    void Resume(void);
 
 private:
     http_parser          mParser;
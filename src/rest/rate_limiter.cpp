@@ -0,0 +1,134 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the request rate limiter for RESTful HTTP server.
+ */
+
+#include "rest/rate_limiter.hpp"
+
+#include <string.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace rest {
+
+bool RateLimiter::Key::operator==(const Key &aOther) const
+{
+    return mResource == aOther.mResource && memcmp(&mClientAddress, &aOther.mClientAddress, sizeof(in6_addr)) == 0;
+}
+
+size_t RateLimiter::KeyHash::operator()(const Key &aKey) const
+{
+    size_t hash = std::hash<const void *>()(aKey.mResource);
+
+    for (uint8_t byte : aKey.mClientAddress.s6_addr)
+    {
+        hash = hash * 31 + byte;
+    }
+
+    return hash;
+}
+
+RateLimiter::RateLimiter(uint32_t aBurst, Milliseconds aInterval, size_t aMaxBuckets)
+    : mBurst(aBurst > 0 ? aBurst : 1)
+    , mInterval(aInterval)
+    , mMaxBuckets(aMaxBuckets)
+{
+}
+
+Milliseconds RateLimiter::Consume(const in6_addr &aClientAddress, const void *aResource, Timepoint aNow)
+{
+    Milliseconds                                       wait(0);
+    Key                                                key = {aClientAddress, aResource};
+    std::unordered_map<Key, Bucket, KeyHash>::iterator it  = mBuckets.find(key);
+
+    if (it == mBuckets.end())
+    {
+        if (mBuckets.size() >= mMaxBuckets)
+        {
+            RemoveFullBuckets(aNow);
+        }
+        VerifyOrExit(mBuckets.size() < mMaxBuckets);
+
+        it = mBuckets.emplace(key, Bucket{mBurst, aNow}).first;
+    }
+
+    Refill(it->second, aNow);
+
+    if (it->second.mTokens == 0)
+    {
+        wait = mInterval - std::chrono::duration_cast<Milliseconds>(aNow - it->second.mRefillTime);
+        ExitNow();
+    }
+
+    it->second.mTokens--;
+
+exit:
+    return wait;
+}
+
+void RateLimiter::Refill(Bucket &aBucket, Timepoint aNow) const
+{
+    uint64_t tokens = static_cast<uint64_t>(
+        mInterval.count() > 0 ? std::chrono::duration_cast<Milliseconds>(aNow - aBucket.mRefillTime) / mInterval
+                              : mBurst);
+
+    if (aBucket.mTokens + tokens >= mBurst)
+    {
+        aBucket.mTokens     = mBurst;
+        aBucket.mRefillTime = aNow;
+    }
+    else
+    {
+        aBucket.mTokens += static_cast<uint32_t>(tokens);
+        aBucket.mRefillTime += mInterval * static_cast<Milliseconds::rep>(tokens);
+    }
+}
+
+void RateLimiter::RemoveFullBuckets(Timepoint aNow)
+{
+    for (auto it = mBuckets.begin(); it != mBuckets.end();)
+    {
+        Refill(it->second, aNow);
+
+        if (it->second.mTokens == mBurst)
+        {
+            it = mBuckets.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+} // namespace rest
+} // namespace otbr
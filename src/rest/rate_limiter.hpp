@@ -0,0 +1,114 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the request rate limiter for RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_RATE_LIMITER_HPP_
+#define OTBR_REST_RATE_LIMITER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <unordered_map>
+
+#include <netinet/in.h>
+#include <stdint.h>
+
+#include "common/time.hpp"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class limits the rate of requests with a token bucket per client and resource.
+ *
+ * A bucket holds up to a burst of tokens and gains a token every interval. A request takes a token from the bucket of
+ * its client and resource, and is refused while the bucket is empty. A full bucket is the same as no bucket, so full
+ * buckets are dropped when the number of buckets reaches its limit.
+ */
+class RateLimiter
+{
+public:
+    /**
+     * The constructor initializes the rate limiter.
+     *
+     * @param[in] aBurst       The number of requests a client may send at once.
+     * @param[in] aInterval    The interval at which a client may send a request in the long run.
+     * @param[in] aMaxBuckets  The maximum number of buckets.
+     */
+    RateLimiter(uint32_t aBurst, Milliseconds aInterval, size_t aMaxBuckets);
+
+    /**
+     * This method takes a token for a request from a client to a resource.
+     *
+     * A request is allowed when all buckets are in use by other clients sending requests, so that they can't lock
+     * a client out.
+     *
+     * @param[in] aClientAddress  The address of the client.
+     * @param[in] aResource       The identifier of the resource.
+     * @param[in] aNow            The current time.
+     *
+     * @returns Zero if the request is allowed, or the time until the client may send the request.
+     */
+    Milliseconds Consume(const in6_addr &aClientAddress, const void *aResource, Timepoint aNow);
+
+private:
+    struct Key
+    {
+        in6_addr    mClientAddress;
+        const void *mResource;
+
+        bool operator==(const Key &aOther) const;
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key &aKey) const;
+    };
+
+    struct Bucket
+    {
+        uint32_t  mTokens;
+        Timepoint mRefillTime; // When the last token was added
+    };
+
+    void Refill(Bucket &aBucket, Timepoint aNow) const;
+    void RemoveFullBuckets(Timepoint aNow);
+
+    uint32_t                                 mBurst;
+    Milliseconds                             mInterval;
+    size_t                                   mMaxBuckets;
+    std::unordered_map<Key, Bucket, KeyHash> mBuckets;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_RATE_LIMITER_HPP_
@@ -0,0 +1,69 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rest/read_buffer_pool.hpp"
+
+#include <utility>
+
+namespace otbr {
+namespace rest {
+
+ReadBufferPool::ReadBufferPool(size_t aMaxBuffers, size_t aBufferSize)
+    : mMaxBuffers(aMaxBuffers)
+    , mBufferSize(aBufferSize)
+{
+}
+
+void ReadBufferPool::Acquire(std::vector<char> &aBuffer)
+{
+    if (!mBuffers.empty())
+    {
+        aBuffer.swap(mBuffers.back());
+        mBuffers.pop_back();
+    }
+
+    aBuffer.clear();
+    aBuffer.reserve(mBufferSize);
+}
+
+void ReadBufferPool::Release(std::vector<char> &aBuffer)
+{
+    std::vector<char> buffer;
+
+    buffer.swap(aBuffer);
+    VerifyOrExit(buffer.capacity() > 0 && buffer.capacity() <= mBufferSize && mBuffers.size() < mMaxBuffers);
+
+    buffer.clear();
+    mBuffers.push_back(std::move(buffer));
+
+exit:
+    return;
+}
+
+} // namespace rest
+} // namespace otbr
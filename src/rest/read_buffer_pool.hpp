@@ -0,0 +1,87 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the read buffer pool definition for RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_READ_BUFFER_POOL_HPP_
+#define OTBR_REST_READ_BUFFER_POOL_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stddef.h>
+#include <vector>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class implements a pool of the read buffers of connections.
+ *
+ * A connection holds a read buffer only while it reads or handles a request, so the buffers of idle persistent
+ * connections and event streams are reused by other connections instead of being kept or reallocated.
+ */
+class ReadBufferPool : private NonCopyable
+{
+public:
+    /**
+     * The constructor initializes the read buffer pool.
+     *
+     * @param[in] aMaxBuffers  The maximum number of buffers kept in the pool.
+     * @param[in] aBufferSize  The capacity of the buffers, larger buffers are freed instead of being kept.
+     */
+    ReadBufferPool(size_t aMaxBuffers, size_t aBufferSize);
+
+    /**
+     * This method provides an empty buffer with a capacity of at least the buffer size.
+     *
+     * @param[out] aBuffer  The buffer to provide, which should be empty and have no capacity.
+     */
+    void Acquire(std::vector<char> &aBuffer);
+
+    /**
+     * This method takes back a buffer, which becomes empty and has no capacity.
+     *
+     * @param[in,out] aBuffer  The buffer to take back.
+     */
+    void Release(std::vector<char> &aBuffer);
+
+private:
+    size_t                         mMaxBuffers;
+    size_t                         mBufferSize;
+    std::vector<std::vector<char>> mBuffers;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_READ_BUFFER_POOL_HPP_
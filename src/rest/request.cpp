@@ -27,24 +27,62 @@
  */
 
 #include "rest/request.hpp"
-#include "utils/string_utils.hpp"
+
+#include <string.h>
 
 namespace otbr {
 namespace rest {
 
-Request::Request(void)
-    : mComplete(false)
+Request::Request(std::vector<char> &aBuffer)
+    : mBuffer(aBuffer)
+{
+    Reset();
+}
+
+void Request::Reset(void)
+{
+    mMethod        = 0;
+    mContentLength = 0;
+    mUrl           = {0, 0};
+    mPath          = {0, 0};
+    mBody          = {0, 0};
+    mComplete      = false;
+    mKeepAlive     = false;
+    mHeaders.clear();
+    mPathParameters.clear();
+}
+
+void Request::Append(Span &aSpan, const char *aString, size_t aLength)
+{
+    char *end = mBuffer.data() + aSpan.mOffset + aSpan.mLength;
+
+    if (aSpan.mLength == 0)
+    {
+        aSpan.mOffset = static_cast<size_t>(aString - mBuffer.data());
+    }
+    else if (aString != end)
+    {
+        // The parser skips the framing between the chunks of a chunked body, which have been parsed, so the chunk
+        // is moved right after the previous one to keep the body contiguous.
+        memmove(end, aString, aLength);
+    }
+
+    aSpan.mLength += aLength;
+}
+
+StringView Request::ToStringView(const Span &aSpan) const
 {
+    return StringView(mBuffer.data() + aSpan.mOffset, aSpan.mLength);
 }
 
 void Request::SetUrl(const char *aString, size_t aLength)
 {
-    mUrl += std::string(aString, aLength);
+    Append(mUrl, aString, aLength);
 }
 
 void Request::SetBody(const char *aString, size_t aLength)
 {
-    mBody += std::string(aString, aLength);
+    Append(mBody, aString, aLength);
 }
 
 void Request::SetContentLength(size_t aContentLength)
@@ -59,12 +97,24 @@ void Request::SetMethod(int32_t aMethod)
 
 void Request::SetNextHeaderField(const char *aString, size_t aLength)
 {
-    mNextHeaderField = StringUtils::ToLowercase(std::string(aString, aLength));
+    // The parser splits a header field only at the end of the data read so far, so the pieces of a field are
+    // adjacent in the read buffer, while a new field follows the value of the previous header.
+    if (mHeaders.empty() ||
+        mBuffer.data() + mHeaders.back().mField.mOffset + mHeaders.back().mField.mLength != aString)
+    {
+        mHeaders.push_back({{0, 0}, {0, 0}});
+    }
+
+    Append(mHeaders.back().mField, aString, aLength);
 }
 
 void Request::SetHeaderValue(const char *aString, size_t aLength)
 {
-    mHeaders[mNextHeaderField] = std::string(aString, aLength);
+    VerifyOrExit(!mHeaders.empty());
+    Append(mHeaders.back().mValue, aString, aLength);
+
+exit:
+    return;
 }
 
 HttpMethod Request::GetMethod() const
@@ -72,41 +122,100 @@ HttpMethod Request::GetMethod() const
     return static_cast<HttpMethod>(mMethod);
 }
 
-std::string Request::GetBody() const
+StringView Request::GetBody() const
+{
+    return ToStringView(mBody);
+}
+
+StringView Request::GetUrl(void) const
 {
-    return mBody;
+    return mPath.mLength > 0 ? ToStringView(mPath) : StringView("/");
 }
 
-std::string Request::GetUrl(void) const
+void Request::SetPathParameter(const StringView &aName, const StringView &aValue)
 {
-    std::string url = mUrl;
+    mPathParameters.emplace_back(aName, aValue);
+}
 
-    size_t urlEnd = url.find("?");
+StringView Request::GetPathParameter(const StringView &aName) const
+{
+    StringView value;
 
-    if (urlEnd != std::string::npos)
+    for (const auto &parameter : mPathParameters)
     {
-        url = url.substr(0, urlEnd);
+        if (parameter.first == aName)
+        {
+            ExitNow(value = parameter.second);
+        }
     }
-    while (!url.empty() && url[url.size() - 1] == '/')
+
+exit:
+    return value;
+}
+
+bool Request::GetQueryParameter(const StringView &aName, StringView &aValue) const
+{
+    bool       found = false;
+    StringView url   = ToStringView(mUrl);
+    size_t     begin = url.Find('?');
+
+    while (begin != std::string::npos)
     {
-        url.pop_back();
+        size_t end   = url.Find('&', begin + 1);
+        size_t equal = url.Find('=', begin + 1);
+        size_t next  = (end == std::string::npos) ? url.Size() : end;
+
+        if (equal > next)
+        {
+            equal = next;
+        }
+
+        if (url.Substr(begin + 1, equal - begin - 1) == aName)
+        {
+            aValue = (equal < next) ? url.Substr(equal + 1, next - equal - 1) : StringView();
+            ExitNow(found = true);
+        }
+
+        begin = end;
     }
 
-    VerifyOrExit(url.size() > 0, url = "/");
-
 exit:
-    return url;
+    return found;
 }
 
-std::string Request::GetHeaderValue(const std::string aHeaderField) const
+StringView Request::GetHeaderValue(const StringView &aHeaderField) const
 {
-    auto it = mHeaders.find(StringUtils::ToLowercase(aHeaderField));
+    StringView value;
+
+    for (const Header &header : mHeaders)
+    {
+        if (ToStringView(header.mField).EqualsIgnoreCase(aHeaderField))
+        {
+            ExitNow(value = ToStringView(header.mValue));
+        }
+    }
 
-    return (it == mHeaders.end()) ? "" : it->second;
+exit:
+    return value;
+}
+
+void Request::SetKeepAlive(bool aKeepAlive)
+{
+    mKeepAlive = aKeepAlive;
 }
 
 void Request::SetReadComplete(void)
 {
+    StringView url   = ToStringView(mUrl);
+    size_t     query = url.Find('?');
+
+    mPath = {mUrl.mOffset, query != std::string::npos ? query : url.Size()};
+
+    while (mPath.mLength > 0 && mBuffer[mPath.mOffset + mPath.mLength - 1] == '/')
+    {
+        mPath.mLength--;
+    }
+
     mComplete = true;
 }
 
@@ -120,5 +229,10 @@ bool Request::IsComplete(void) const
     return mComplete;
 }
 
+bool Request::IsKeepAlive(void) const
+{
+    return mKeepAlive;
+}
+
 } // namespace rest
 } // namespace otbr
@@ -36,10 +36,11 @@
 
 #include "openthread-br/config.h"
 
-#include <map>
-#include <string>
+#include <utility>
+#include <vector>
 
 #include "common/code_utils.hpp"
+#include "common/string_view.hpp"
 #include "rest/types.hpp"
 
 namespace otbr {
@@ -47,14 +48,25 @@ namespace rest {
 
 /**
  * This class implements an instance to host services used by border router.
+ *
+ * The url, headers and body of a request refer to the read buffer of the connection, which holds the request
+ * while it's parsed and handled, so they are accessed without copying.
  */
 class Request
 {
 public:
     /**
      * The constructor is to initialize Request instance.
+     *
+     * @param[in] aBuffer  A reference to the read buffer which the request is parsed from. The fields set by the
+     *                     parser must point into this buffer.
      */
-    Request(void);
+    explicit Request(std::vector<char> &aBuffer);
+
+    /**
+     * This method resets the request so that it no longer refers to the read buffer.
+     */
+    void Reset(void);
 
     /**
      * This method sets the Url field of a request.
@@ -102,6 +114,13 @@ public:
      */
     void SetHeaderValue(const char *aString, size_t aLength);
 
+    /**
+     * This method sets whether the connection should be kept alive after this request.
+     *
+     * @param[in] aKeepAlive  Whether the client requests a persistent connection.
+     */
+    void SetKeepAlive(bool aKeepAlive);
+
     /**
      * This method labels the request as complete which means it no longer need to be parsed one more time .
      */
@@ -120,40 +139,94 @@ public:
     HttpMethod GetMethod() const;
 
     /**
-     * This method returns the HTTP method of this request.
+     * This method returns the body of this request.
      *
-     * @returns A HttpMethod enum representing HTTP method of this request.
+     * @returns A view of the body of this request.
      */
-    std::string GetBody() const;
+    StringView GetBody() const;
 
     /**
      * This method returns the url for this request.
      *
-     * @returns A string contains the url of this request.
+     * The url is the path of the request target without the query and the trailing slashes.
+     *
+     * @returns A view of the url of this request.
+     */
+    StringView GetUrl(void) const;
+
+    /**
+     * This method sets a path parameter of this request.
+     *
+     * @param[in] aName   The name of the path parameter, which must outlive the request.
+     * @param[in] aValue  The value of the path parameter, which must outlive the request.
+     */
+    void SetPathParameter(const StringView &aName, const StringView &aValue);
+
+    /**
+     * This method returns a path parameter of this request.
+     *
+     * @param[in] aName  The name of the path parameter.
+     *
+     * @returns A view of the value of the path parameter, which is empty if it is absent.
+     */
+    StringView GetPathParameter(const StringView &aName) const;
+
+    /**
+     * This method returns the value of a query parameter of the url for this request.
+     *
+     * @param[in]  aName   The name of the query parameter.
+     * @param[out] aValue  The value of the first query parameter named @p aName, without percent-decoding.
+     *
+     * @retval TRUE   The query parameter is present.
+     * @retval FALSE  The query parameter is absent.
      */
-    std::string GetUrl(void) const;
+    bool GetQueryParameter(const StringView &aName, StringView &aValue) const;
 
     /**
      * This method returns the specified header field for this request.
      *
-     * @param[in] aHeaderField  A header field.
-     * @returns A string contains the header value of this request.
+     * @param[in] aHeaderField  A header field, which is matched ignoring case.
+     * @returns A view of the header value of this request, which is empty if the header is absent.
      */
-    std::string GetHeaderValue(const std::string aHeaderField) const;
+    StringView GetHeaderValue(const StringView &aHeaderField) const;
 
     /**
      * This method indicates whether this request is parsed completely.
      */
     bool IsComplete(void) const;
 
+    /**
+     * This method indicates whether the connection should be kept alive after this request.
+     */
+    bool IsKeepAlive(void) const;
+
 private:
-    int32_t                            mMethod;
-    size_t                             mContentLength;
-    std::string                        mUrl;
-    std::string                        mBody;
-    std::string                        mNextHeaderField;
-    std::map<std::string, std::string> mHeaders;
-    bool                               mComplete;
+    // A part of the read buffer, referred by offset as the buffer may grow while the request is parsed
+    struct Span
+    {
+        size_t mOffset;
+        size_t mLength;
+    };
+
+    struct Header
+    {
+        Span mField;
+        Span mValue;
+    };
+
+    void       Append(Span &aSpan, const char *aString, size_t aLength);
+    StringView ToStringView(const Span &aSpan) const;
+
+    std::vector<char>                             &mBuffer;
+    int32_t                                        mMethod;
+    size_t                                         mContentLength;
+    Span                                           mUrl;
+    Span                                           mPath;
+    Span                                           mBody;
+    std::vector<Header>                            mHeaders;
+    std::vector<std::pair<StringView, StringView>> mPathParameters;
+    bool                                           mComplete;
+    bool                                           mKeepAlive;
 };
 
 } // namespace rest
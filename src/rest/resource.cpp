@@ -30,40 +30,28 @@
 
 #include "rest/resource.hpp"
 
+#include <algorithm>
+#include <sstream>
+
+#include <string.h>
+
+#include <openthread/platform/radio.h>
+
+extern "C" {
+#include <http_parser.h>
+}
+
+#include "common/time.hpp"
+#include "rest/batch.hpp"
+#include "rest/entity_tag.hpp"
+#include "utils/string_utils.hpp"
+
 #define OT_PSKC_MAX_LENGTH 16
 #define OT_EXTENDED_PANID_LENGTH 8
 
-#define OT_REST_RESOURCE_PATH_DIAGNOSTICS "/diagnostics"
-#define OT_REST_RESOURCE_PATH_NODE "/node"
-#define OT_REST_RESOURCE_PATH_NODE_BAID "/node/ba-id"
-#define OT_REST_RESOURCE_PATH_NODE_RLOC "/node/rloc"
-#define OT_REST_RESOURCE_PATH_NODE_RLOC16 "/node/rloc16"
-#define OT_REST_RESOURCE_PATH_NODE_EXTADDRESS "/node/ext-address"
-#define OT_REST_RESOURCE_PATH_NODE_STATE "/node/state"
-#define OT_REST_RESOURCE_PATH_NODE_NETWORKNAME "/node/network-name"
-#define OT_REST_RESOURCE_PATH_NODE_LEADERDATA "/node/leader-data"
-#define OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER "/node/num-of-router"
-#define OT_REST_RESOURCE_PATH_NODE_EXTPANID "/node/ext-panid"
-#define OT_REST_RESOURCE_PATH_NODE_DATASET_ACTIVE "/node/dataset/active"
-#define OT_REST_RESOURCE_PATH_NODE_DATASET_PENDING "/node/dataset/pending"
-#define OT_REST_RESOURCE_PATH_NETWORK "/networks"
-#define OT_REST_RESOURCE_PATH_NETWORK_CURRENT "/networks/current"
-#define OT_REST_RESOURCE_PATH_NETWORK_CURRENT_COMMISSION "/networks/commission"
-#define OT_REST_RESOURCE_PATH_NETWORK_CURRENT_PREFIX "/networks/current/prefix"
-
-#define OT_REST_HTTP_STATUS_200 "200 OK"
-#define OT_REST_HTTP_STATUS_201 "201 Created"
-#define OT_REST_HTTP_STATUS_204 "204 No Content"
-#define OT_REST_HTTP_STATUS_400 "400 Bad Request"
-#define OT_REST_HTTP_STATUS_404 "404 Not Found"
-#define OT_REST_HTTP_STATUS_405 "405 Method Not Allowed"
-#define OT_REST_HTTP_STATUS_408 "408 Request Timeout"
-#define OT_REST_HTTP_STATUS_409 "409 Conflict"
-#define OT_REST_HTTP_STATUS_500 "500 Internal Server Error"
-
 using std::chrono::duration_cast;
 using std::chrono::microseconds;
-using std::chrono::steady_clock;
+using std::chrono::seconds;
 
 using std::placeholders::_1;
 using std::placeholders::_2;
@@ -77,12 +65,95 @@ static const char *kMulticastAddrAllRouters = "ff03::2";
 // Default TlvTypes for Diagnostic inforamtion
 static const uint8_t kAllTlvTypes[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 14, 15, 16, 17, 19};
 
+// Names of the TLV types which could be selected by the "tlv" query parameter of diagnostics, in lower case
+static const struct
+{
+    const char *mName;
+    uint8_t     mType;
+} kDiagTlvNames[] = {
+    {"extaddress", OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS},
+    {"rloc16", OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS},
+    {"mode", OT_NETWORK_DIAGNOSTIC_TLV_MODE},
+    {"timeout", OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT},
+    {"connectivity", OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY},
+    {"route", OT_NETWORK_DIAGNOSTIC_TLV_ROUTE},
+    {"leaderdata", OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA},
+    {"networkdata", OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA},
+    {"ip6addresslist", OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST},
+    {"maccounters", OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS},
+    {"batterylevel", OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL},
+    {"supplyvoltage", OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE},
+    {"childtable", OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE},
+    {"channelpages", OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES},
+    {"maxchildtimeout", OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT},
+};
+
+// Maximum number of nodes selected by the "node" query parameter of diagnostics
+static const size_t kDiagMaxQueryNodes = 16;
+
+// Names of the events published to the event stream
+static const char kEventState[]          = "state";
+static const char kEventLeaderData[]     = "leaderData";
+static const char kEventActiveDataset[]  = "datasetActive";
+static const char kEventPendingDataset[] = "datasetPending";
+static const char kEventDiagnostic[]     = "diagnostic";
+static const char kEventScanResult[]     = "scanResult";
+static const char kEventEnergyScan[]     = "energyScanResult";
+static const char kEventScanComplete[]   = "scanComplete";
+
 // Timeout (in Microseconds) for deleting outdated diagnostics
 static const uint32_t kDiagResetTimeout = 3000000;
 
 // Timeout (in Microseconds) for collecting diagnostics
 static const uint32_t kDiagCollectTimeout = 2000000;
 
+// Age (in Microseconds) until which collected diagnostics are served without collecting again
+static const uint32_t kDiagFreshTimeout = 5000000;
+
+// Age (in Microseconds) until which collected diagnostics are served while collecting again
+static const uint32_t kDiagStaleTimeout = 60000000;
+
+// A streamed collection of diagnostics is idle with an empty line, and ends with the last chunk
+static const char kDiagStreamHeartbeat[] = "1\r\n\n\r\n";
+static const char kDiagStreamLastChunk[] = "0\r\n\r\n";
+
+// Age (in Microseconds) until which a cached body is served, some values like the number of routers or the delay
+// timer of the pending dataset change without any state change notification
+static const uint32_t kCachedBodyMaxAge = 2000000;
+
+// A client may send this many rate limited requests to a resource at once, and then one every interval
+static const uint32_t kRateLimitBurst      = 5;
+static const uint32_t kRateLimitIntervalMs = 1000;
+static const size_t   kRateLimitMaxBuckets = 64;
+
+// Appends a line of NDJSON as a chunk of the chunked transfer coding.
+static void AppendNdjsonChunk(std::string &aOutput, const std::string &aJson)
+{
+    char size[sizeof(size_t) * 2 + 1];
+
+    snprintf(size, sizeof(size), "%zx", aJson.size() + 1);
+    aOutput.append(size).append("\r\n").append(aJson).append("\n\r\n");
+}
+
+// Parses an RLOC16 query parameter, OTBR_ERROR_NOT_FOUND is returned if it's absent.
+static otbrError ParseRloc16Parameter(const Request &aRequest, const char *aName, uint16_t &aRloc16)
+{
+    otbrError     error = OTBR_ERROR_NONE;
+    StringView    value;
+    std::string   token;
+    char         *end;
+    unsigned long rloc16;
+
+    VerifyOrExit(aRequest.GetQueryParameter(aName, value), error = OTBR_ERROR_NOT_FOUND);
+    token  = value.ToString();
+    rloc16 = strtoul(token.c_str(), &end, 0);
+    VerifyOrExit(!token.empty() && *end == '\0' && rloc16 <= UINT16_MAX, error = OTBR_ERROR_INVALID_ARGS);
+    aRloc16 = static_cast<uint16_t>(rloc16);
+
+exit:
+    return error;
+}
+
 static std::string GetHttpStatus(HttpStatusCode aErrorCode)
 {
     std::string httpStatus;
@@ -98,6 +169,9 @@ static std::string GetHttpStatus(HttpStatusCode aErrorCode)
     case HttpStatusCode::kStatusNoContent:
         httpStatus = OT_REST_HTTP_STATUS_204;
         break;
+    case HttpStatusCode::kStatusNotModified:
+        httpStatus = OT_REST_HTTP_STATUS_304;
+        break;
     case HttpStatusCode::kStatusBadRequest:
         httpStatus = OT_REST_HTTP_STATUS_400;
         break;
@@ -113,6 +187,9 @@ static std::string GetHttpStatus(HttpStatusCode aErrorCode)
     case HttpStatusCode::kStatusConflict:
         httpStatus = OT_REST_HTTP_STATUS_409;
         break;
+    case HttpStatusCode::kStatusTooManyRequests:
+        httpStatus = OT_REST_HTTP_STATUS_429;
+        break;
     case HttpStatusCode::kStatusInternalServerError:
         httpStatus = OT_REST_HTTP_STATUS_500;
         break;
@@ -121,85 +198,223 @@ static std::string GetHttpStatus(HttpStatusCode aErrorCode)
     return httpStatus;
 }
 
-Resource::Resource(RcpHost *aHost)
+Resource::Resource(RcpHost *aHost, TaskRunner &aTaskRunner)
     : mInstance(nullptr)
     , mHost(aHost)
+    , mTaskRunner(aTaskRunner)
+    , mStateVersion(0)
+    , mDiagVersion(0)
+    , mDiagSnapshot("[]")
+    , mDiagSnapshotVersion(0)
+    , mDiagCollecting(false)
+    , mDiagCollectTimer(0)
+    , mDiagStream(kDiagStreamHeartbeat)
+    , mDiagCollected(false)
+    , mScanning(false)
+    , mScanStarting(false)
+    , mScanStartError(OT_ERROR_NONE)
+    , mRateLimiter(kRateLimitBurst, Milliseconds(kRateLimitIntervalMs), kRateLimitMaxBuckets)
+    , mRequestsMetric(&Metrics::Registry::Get().AddCounter("otbr_rest_requests", "The handled REST requests."))
+    , mRateLimitedRequestsMetric(&Metrics::Registry::Get().AddCounter("otbr_rest_rate_limited_requests",
+                                                                       "The REST requests refused by rate limiting."))
 {
     // Resource Handler
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_DIAGNOSTICS, &Resource::Diagnostic);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE, &Resource::NodeInfo);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_BAID, &Resource::BaId);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_STATE, &Resource::State);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_EXTADDRESS, &Resource::ExtendedAddr);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_NETWORKNAME, &Resource::NetworkName);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_RLOC16, &Resource::Rloc16);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_LEADERDATA, &Resource::LeaderData);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER, &Resource::NumOfRoute);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_EXTPANID, &Resource::ExtendedPanId);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_RLOC, &Resource::Rloc);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_DATASET_ACTIVE, &Resource::DatasetActive);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_DATASET_PENDING, &Resource::DatasetPending);
+    AddRoute(OT_REST_RESOURCE_PATH_BATCH, HttpMethod::kGet, &Resource::Batch);
+    AddRoute(OT_REST_RESOURCE_PATH_DIAGNOSTICS, HttpMethod::kGet, &Resource::Diagnostic, /* aRateLimited */ true);
+    AddRoute(OT_REST_RESOURCE_PATH_DIAGNOSTICS_NEIGHBORS, HttpMethod::kGet, &Resource::GetTopologyNeighbors);
+    AddRoute(OT_REST_RESOURCE_PATH_DIAGNOSTICS_PATH, HttpMethod::kGet, &Resource::GetTopologyPath);
+    AddRoute(OT_REST_RESOURCE_PATH_DIAGNOSTICS_PARTITIONS, HttpMethod::kGet, &Resource::GetTopologyPartitions);
+    AddRoute(OT_REST_RESOURCE_PATH_EVENTS, HttpMethod::kGet, &Resource::Events);
+    AddRoute(OT_REST_RESOURCE_PATH_METRICS, HttpMethod::kGet, &Resource::GetMetrics);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE, HttpMethod::kGet, &Resource::GetNodeInfo);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE, HttpMethod::kDelete, &Resource::DeleteNodeInfo, /* aRateLimited */ true);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_BAID, HttpMethod::kGet, &Resource::GetDataBaId);
+#if OTBR_ENABLE_CHANNEL_SAMPLING
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_CHANNELS, HttpMethod::kGet, &Resource::GetChannelOccupancy);
+#endif
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_COUNTERS, HttpMethod::kGet, &Resource::GetCounterHistory);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_STATE, HttpMethod::kGet, &Resource::GetDataState);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_STATE, HttpMethod::kPut, &Resource::SetDataState, /* aRateLimited */ true);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_STATE, HttpMethod::kOptions, &Resource::Options);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_EXTADDRESS, HttpMethod::kGet, &Resource::GetDataExtendedAddr);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_NETWORKNAME, HttpMethod::kGet, &Resource::GetDataNetworkName);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_RLOC16, HttpMethod::kGet, &Resource::GetDataRloc16);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_LEADERDATA, HttpMethod::kGet, &Resource::GetDataLeaderData);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER, HttpMethod::kGet, &Resource::GetDataNumOfRoute);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_EXTPANID, HttpMethod::kGet, &Resource::GetDataExtendedPanId);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_RLOC, HttpMethod::kGet, &Resource::GetDataRloc);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_DATASET_ACTIVE, HttpMethod::kGet, &Resource::GetDatasetActive);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_DATASET_ACTIVE, HttpMethod::kPut, &Resource::SetDatasetActive,
+             /* aRateLimited */ true);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_DATASET_ACTIVE, HttpMethod::kOptions, &Resource::Options);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_DATASET_PENDING, HttpMethod::kGet, &Resource::GetDatasetPending);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_DATASET_PENDING, HttpMethod::kPut, &Resource::SetDatasetPending,
+             /* aRateLimited */ true);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_DATASET_PENDING, HttpMethod::kOptions, &Resource::Options);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_SCAN, HttpMethod::kPost, &Resource::StartScan, /* aRateLimited */ true);
+    AddRoute(OT_REST_RESOURCE_PATH_NODE_SCAN, HttpMethod::kOptions, &Resource::Options);
 
     // Resource callback handler
-    mResourceCallbackMap.emplace(OT_REST_RESOURCE_PATH_DIAGNOSTICS, &Resource::HandleDiagnosticCallback);
+    mRouter.Add(OT_REST_RESOURCE_PATH_DIAGNOSTICS).mCallbackHandler = &Resource::HandleDiagnosticCallback;
+}
+
+Resource::~Resource(void)
+{
+    if (mDiagCollectTimer != 0)
+    {
+        mTaskRunner.Cancel(mDiagCollectTimer);
+    }
+}
+
+void Resource::AddRoute(const char *aPath, HttpMethod aMethod, ResourceHandler aHandler, bool aRateLimited)
+{
+    Route &route = mRouter.Add(aPath);
+
+    route.mHandlers[static_cast<uint8_t>(aMethod)]    = aHandler;
+    route.mRateLimited[static_cast<uint8_t>(aMethod)] = aRateLimited;
+}
+
+MemoryUsage Resource::GetDiagMemoryUsage(void) const
+{
+    MemoryUsage usage = mDiagStore.GetMemoryUsage();
+
+    usage.mBytes += EstimateHeapBytes(mDiagSnapshot);
+
+    return usage;
 }
 
 void Resource::Init(void)
 {
     mInstance = mHost->GetThreadHelper()->GetInstance();
+    mHost->AddThreadStateChangedCallback(
+        OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID | OT_CHANGED_THREAD_NETDATA | OT_CHANGED_ACTIVE_DATASET |
+            OT_CHANGED_PENDING_DATASET,
+        [this](const otbr::Ncp::ThreadStateSnapshot &aSnapshot) { HandleThreadStateChanged(aSnapshot); });
+    mHost->AddThreadStateChangedCallback(static_cast<otChangedFlags>(~0u),
+                                         [this](const otbr::Ncp::ThreadStateSnapshot &) { ++mStateVersion; });
+    AddScanResultHandlers();
+    mHost->RegisterResetHandler([this]() {
+        mInstance = mHost->GetThreadHelper()->GetInstance();
+        mScanning = false;
+        ++mStateVersion;
+        AddScanResultHandlers();
+    });
+}
+
+void Resource::AddScanResultHandlers(void)
+{
+    mHost->GetThreadHelper()->AddScanResultHandlers(
+        [this](const otActiveScanResult &aResult) {
+            if (mEventStream.HasSubscribers())
+            {
+                mEventStream.Publish(kEventScanResult, Json::ActiveScanResult2JsonString(aResult));
+            }
+        },
+        [this](const otEnergyScanResult &aResult) {
+            if (mEventStream.HasSubscribers())
+            {
+                mEventStream.Publish(kEventEnergyScan, Json::EnergyScanResult2JsonString(aResult));
+            }
+        });
 }
 
-void Resource::Handle(Request &aRequest, Response &aResponse) const
+void Resource::HandleThreadStateChanged(const otbr::Ncp::ThreadStateSnapshot &aSnapshot)
 {
-    std::string url = aRequest.GetUrl();
-    auto        it  = mResourceMap.find(url);
+    otChangedFlags       flags  = aSnapshot.mFlags;
+    otLeaderData         leaderData;
+    otOperationalDataset dataset;
 
-    if (it != mResourceMap.end())
+    VerifyOrExit(mEventStream.HasSubscribers());
+
+    if (flags & OT_CHANGED_THREAD_ROLE)
     {
-        ResourceHandler resourceHandler = it->second;
-        (this->*resourceHandler)(aRequest, aResponse);
+        mEventStream.Publish(kEventState, Json::String2JsonString(GetDeviceRoleName(aSnapshot.mDeviceRole)));
     }
-    else
+    if ((flags & (OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID | OT_CHANGED_THREAD_NETDATA)) &&
+        otThreadGetLeaderData(mInstance, &leaderData) == OT_ERROR_NONE)
     {
-        ErrorHandler(aResponse, HttpStatusCode::kStatusResourceNotFound);
+        mEventStream.Publish(kEventLeaderData, Json::LeaderData2JsonString(leaderData));
+    }
+    if ((flags & OT_CHANGED_ACTIVE_DATASET) && otDatasetGetActive(mInstance, &dataset) == OT_ERROR_NONE)
+    {
+        mEventStream.Publish(kEventActiveDataset, Json::ActiveDataset2JsonString(dataset));
+    }
+    if ((flags & OT_CHANGED_PENDING_DATASET) && otDatasetGetPending(mInstance, &dataset) == OT_ERROR_NONE)
+    {
+        mEventStream.Publish(kEventPendingDataset, Json::PendingDataset2JsonString(dataset));
+    }
+
+exit:
+    return;
+}
+
+void Resource::Handle(const in6_addr &aClientAddress, Request &aRequest, Response &aResponse)
+{
+    const Route    *route  = mRouter.Find(aRequest.GetUrl(), aRequest);
+    uint32_t        method = static_cast<uint32_t>(aRequest.GetMethod());
+    ResourceHandler resourceHandler;
+
+    mRequestsMetric->Increment();
+
+    VerifyOrExit(route != nullptr, ErrorHandler(aResponse, HttpStatusCode::kStatusResourceNotFound));
+    VerifyOrExit(method < kNumHttpMethods && (resourceHandler = route->mHandlers[method]) != nullptr,
+                 MethodNotAllowedHandler(*route, aResponse));
+
+    if (route->mRateLimited[method])
+    {
+        // The handler identifies the resource and method, the client waits for the next token.
+        Milliseconds wait = mRateLimiter.Consume(aClientAddress, &route->mHandlers[method], CoarseClock::Now());
+
+        if (wait.count() > 0)
+        {
+            mRateLimitedRequestsMetric->Increment();
+            ErrorHandler(aResponse, HttpStatusCode::kStatusTooManyRequests);
+            aResponse.SetHeader(OT_REST_RETRY_AFTER_HEADER, std::to_string((wait.count() + 999) / 1000));
+            ExitNow();
+        }
     }
+
+    (this->*resourceHandler)(aRequest, aResponse);
+
+exit:
+    return;
 }
 
 void Resource::HandleCallback(Request &aRequest, Response &aResponse)
 {
-    std::string url = aRequest.GetUrl();
-    auto        it  = mResourceCallbackMap.find(url);
+    const Route *route = mRouter.Find(aRequest.GetUrl(), aRequest);
 
-    if (it != mResourceCallbackMap.end())
+    if (route != nullptr && route->mCallbackHandler != nullptr)
     {
-        ResourceCallbackHandler resourceHandler = it->second;
-        (this->*resourceHandler)(aRequest, aResponse);
+        (this->*route->mCallbackHandler)(aRequest, aResponse);
     }
 }
 
 void Resource::HandleDiagnosticCallback(const Request &aRequest, Response &aResponse)
 {
-    OT_UNUSED_VARIABLE(aRequest);
-    std::vector<std::vector<otNetworkDiagTlv>> diagContentSet;
-    std::string                                body;
-    std::string                                errorCode;
+    DiagQuery query;
 
-    auto duration = duration_cast<microseconds>(steady_clock::now() - aResponse.GetStartTime()).count();
-    if (duration >= kDiagCollectTimeout)
-    {
-        DeleteOutDatedDiagnostic();
+    UpdateDiagnosticCollection();
 
-        for (auto it = mDiagSet.begin(); it != mDiagSet.end(); ++it)
+    // The query was checked when the request was handled.
+    ParseDiagnosticQuery(aRequest, query);
+    if (query.IsSelective())
+    {
+        if (duration_cast<microseconds>(CoarseClock::Now() - aResponse.GetStartTime()).count() >= kDiagCollectTimeout)
         {
-            diagContentSet.push_back(it->second.mDiagContent);
+            RespondDiagnosticQuery(query, aResponse);
         }
+        ExitNow();
+    }
 
-        body      = Json::Diag2JsonString(diagContentSet);
-        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
-        aResponse.SetResponsCode(errorCode);
-        aResponse.SetBody(body);
-        aResponse.SetComplete();
+    // Respond once a collection has completed after this request arrived.
+    if (mDiagCollected && mDiagCollectedTime >= aResponse.GetStartTime())
+    {
+        RespondDiagnostic(query, aResponse);
     }
+
+exit:
+    return;
 }
 
 void Resource::ErrorHandler(Response &aResponse, HttpStatusCode aErrorCode) const
@@ -212,17 +427,38 @@ void Resource::ErrorHandler(Response &aResponse, HttpStatusCode aErrorCode) cons
     aResponse.SetComplete();
 }
 
-void Resource::GetNodeInfo(Response &aResponse) const
+void Resource::MethodNotAllowedHandler(const Route &aRoute, Response &aResponse) const
 {
-    otbrError       error = OTBR_ERROR_NONE;
-    struct NodeInfo node  = {};
-    otRouterInfo    routerInfo;
-    uint8_t         maxRouterId;
-    std::string     body;
-    std::string     errorCode;
+    std::string allow;
+
+    ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+
+    // HttpMethod shares its values with http_parser's methods.
+    for (uint8_t method = 0; method < kNumHttpMethods; method++)
+    {
+        if (aRoute.mHandlers[method] != nullptr)
+        {
+            allow += allow.empty() ? "" : ", ";
+            allow += http_method_str(static_cast<http_method>(method));
+        }
+    }
+
+    aResponse.SetHeader(OT_REST_ALLOW_HEADER, allow);
+}
+
+otbrError Resource::GenerateNodeInfo(std::string &aBody) const
+{
+    otbrError                 error = OTBR_ERROR_NONE;
+    struct NodeInfo           node  = {};
+    Ncp::NetworkStateSnapshot state = mHost->GetNetworkState();
+    otRouterInfo              routerInfo;
+    uint8_t                   maxRouterId;
 
     VerifyOrExit(otBorderAgentGetId(mInstance, &node.mBaId) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
-    (void)otThreadGetLeaderData(mInstance, &node.mLeaderData);
+    if (state.mLeaderDataError == OT_ERROR_NONE)
+    {
+        node.mLeaderData = state.mLeaderData;
+    }
 
     node.mNumOfRouter = 0;
     maxRouterId       = otThreadGetMaxRouterId(mInstance);
@@ -235,21 +471,58 @@ void Resource::GetNodeInfo(Response &aResponse) const
         ++node.mNumOfRouter;
     }
 
-    node.mRole        = GetDeviceRoleName(otThreadGetDeviceRole(mInstance));
-    node.mExtAddress  = reinterpret_cast<const uint8_t *>(otLinkGetExtendedAddress(mInstance));
-    node.mNetworkName = otThreadGetNetworkName(mInstance);
-    node.mRloc16      = otThreadGetRloc16(mInstance);
-    node.mExtPanId    = reinterpret_cast<const uint8_t *>(otThreadGetExtendedPanId(mInstance));
+    node.mRole        = GetDeviceRoleName(state.mDeviceRole);
+    node.mExtAddress  = state.mExtAddress.m8;
+    node.mNetworkName = state.mNetworkName;
+    node.mRloc16      = state.mRloc16;
+    node.mExtPanId    = state.mExtPanId.m8;
     node.mRlocAddress = *otThreadGetRloc(mInstance);
 
-    body = Json::Node2JsonString(node);
-    aResponse.SetBody(body);
+    aBody = Json::Node2JsonString(node);
+
+exit:
+    return error;
+}
+
+otbrError Resource::RefreshCachedBody(CachedBody &aCache, const BodyGenerator &aGenerator)
+{
+    otbrError   error = OTBR_ERROR_NONE;
+    Timepoint   now   = CoarseClock::Now();
+    std::string body;
+
+    VerifyOrExit(!aCache.mValid || aCache.mStateVersion != mStateVersion ||
+                 duration_cast<microseconds>(now - aCache.mGeneratedTime).count() >= kCachedBodyMaxAge);
+
+    aCache.mValid = false;
+    SuccessOrExit(error = aGenerator(body));
+
+    // The entity tag only changes with the body, so a client is answered 304 as long as the body is the same.
+    if (aCache.mETag.empty() || body != aCache.mBody)
+    {
+        aCache.mETag = EntityTag::Generate(body);
+        aCache.mBody = std::move(body);
+    }
+    aCache.mValid         = true;
+    aCache.mStateVersion  = mStateVersion;
+    aCache.mGeneratedTime = now;
 
 exit:
+    return error;
+}
+
+void Resource::RespondCachedBody(const CachedBody &aCache, const Request &aRequest, Response &aResponse) const
+{
+    EntityTag::Respond(aRequest.GetHeaderValue(OT_REST_IF_NONE_MATCH_HEADER), aCache.mETag, aCache.mBody, aResponse);
+}
+
+void Resource::GetNodeInfo(const Request &aRequest, Response &aResponse)
+{
+    otbrError error;
+
+    error = RefreshCachedBody(mNodeInfoBody, [this](std::string &aBody) { return GenerateNodeInfo(aBody); });
     if (error == OTBR_ERROR_NONE)
     {
-        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
-        aResponse.SetResponsCode(errorCode);
+        RespondCachedBody(mNodeInfoBody, aRequest, aResponse);
     }
     else
     {
@@ -257,11 +530,13 @@ exit:
     }
 }
 
-void Resource::DeleteNodeInfo(Response &aResponse) const
+void Resource::DeleteNodeInfo(const Request &aRequest, Response &aResponse)
 {
     otbrError   error = OTBR_ERROR_NONE;
     std::string errorCode;
 
+    OT_UNUSED_VARIABLE(aRequest);
+
     VerifyOrExit(mHost->GetThreadHelper()->Detach() == OT_ERROR_NONE, error = OTBR_ERROR_INVALID_STATE);
     VerifyOrExit(otInstanceErasePersistentInfo(mInstance) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
     mHost->Reset();
@@ -282,31 +557,15 @@ exit:
     }
 }
 
-void Resource::NodeInfo(const Request &aRequest, Response &aResponse) const
-{
-    std::string errorCode;
-
-    switch (aRequest.GetMethod())
-    {
-    case HttpMethod::kGet:
-        GetNodeInfo(aResponse);
-        break;
-    case HttpMethod::kDelete:
-        DeleteNodeInfo(aResponse);
-        break;
-    default:
-        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
-        break;
-    }
-}
-
-void Resource::GetDataBaId(Response &aResponse) const
+void Resource::GetDataBaId(const Request &aRequest, Response &aResponse)
 {
     otbrError       error = OTBR_ERROR_NONE;
     otBorderAgentId id;
     std::string     body;
     std::string     errorCode;
 
+    OT_UNUSED_VARIABLE(aRequest);
+
     VerifyOrExit(otBorderAgentGetId(mInstance, &id) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
 
     body = Json::Bytes2HexJsonString(id.mId, sizeof(id));
@@ -324,59 +583,35 @@ exit:
     }
 }
 
-void Resource::BaId(const Request &aRequest, Response &aResponse) const
+void Resource::GetDataExtendedAddr(const Request &aRequest, Response &aResponse)
 {
-    std::string errorCode;
+    Ncp::NetworkStateSnapshot state = mHost->GetNetworkState();
+    std::string               errorCode;
+    std::string               body = Json::Bytes2HexJsonString(state.mExtAddress.m8, OT_EXT_ADDRESS_SIZE);
 
-    if (aRequest.GetMethod() == HttpMethod::kGet)
-    {
-        GetDataBaId(aResponse);
-    }
-    else
-    {
-        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
-    }
-}
-
-void Resource::GetDataExtendedAddr(Response &aResponse) const
-{
-    const uint8_t *extAddress = reinterpret_cast<const uint8_t *>(otLinkGetExtendedAddress(mInstance));
-    std::string    errorCode;
-    std::string    body = Json::Bytes2HexJsonString(extAddress, OT_EXT_ADDRESS_SIZE);
+    OT_UNUSED_VARIABLE(aRequest);
 
     aResponse.SetBody(body);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
     aResponse.SetResponsCode(errorCode);
 }
 
-void Resource::ExtendedAddr(const Request &aRequest, Response &aResponse) const
-{
-    std::string errorCode;
-
-    if (aRequest.GetMethod() == HttpMethod::kGet)
-    {
-        GetDataExtendedAddr(aResponse);
-    }
-    else
-    {
-        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
-    }
-}
-
-void Resource::GetDataState(Response &aResponse) const
+void Resource::GetDataState(const Request &aRequest, Response &aResponse)
 {
     std::string  state;
     std::string  errorCode;
     otDeviceRole role;
 
-    role  = otThreadGetDeviceRole(mInstance);
+    OT_UNUSED_VARIABLE(aRequest);
+
+    role  = mHost->GetNetworkState().mDeviceRole;
     state = Json::String2JsonString(GetDeviceRoleName(role));
     aResponse.SetBody(state);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
     aResponse.SetResponsCode(errorCode);
 }
 
-void Resource::SetDataState(const Request &aRequest, Response &aResponse) const
+void Resource::SetDataState(const Request &aRequest, Response &aResponse)
 {
     otbrError   error = OTBR_ERROR_NONE;
     std::string errorCode;
@@ -419,35 +654,63 @@ exit:
     }
 }
 
-void Resource::State(const Request &aRequest, Response &aResponse) const
+void Resource::StartScan(const Request &aRequest, Response &aResponse)
 {
-    std::string errorCode;
+    // The results are only published to the event stream, so the request completes once the scan is started.
+    otError  error;
+    uint32_t channelMask;
+    uint32_t scanDuration;
+
+    VerifyOrExit(Json::JsonScanRequestString2Params(aRequest.GetBody().ToString(), channelMask, scanDuration),
+                 ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest));
+    VerifyOrExit(!mScanning, ErrorHandler(aResponse, HttpStatusCode::kStatusConflict));
+
+    mScanning       = true;
+    mScanStarting   = true;
+    mScanStartError = OT_ERROR_NONE;
+    mHost->GetThreadHelper()->SurveyScan(
+        channelMask, scanDuration,
+        [this](otError aError, const std::vector<otActiveScanResult> &, const std::vector<otEnergyScanResult> &) {
+            HandleScanComplete(aError);
+        });
+    mScanStarting = false;
+
+    error = mScanStartError;
+    VerifyOrExit(error == OT_ERROR_NONE,
+                 ErrorHandler(aResponse, error == OT_ERROR_BUSY ? HttpStatusCode::kStatusConflict
+                                                                : HttpStatusCode::kStatusInternalServerError));
+
+    aResponse.SetResponsCode(GetHttpStatus(HttpStatusCode::kStatusOk));
+
+exit:
+    return;
+}
+
+void Resource::HandleScanComplete(otError aError)
+{
+    mScanning = false;
 
-    switch (aRequest.GetMethod())
+    if (mScanStarting)
     {
-    case HttpMethod::kGet:
-        GetDataState(aResponse);
-        break;
-    case HttpMethod::kPut:
-        SetDataState(aRequest, aResponse);
-        break;
-    case HttpMethod::kOptions:
-        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
-        aResponse.SetResponsCode(errorCode);
-        aResponse.SetComplete();
-        break;
-    default:
-        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
-        break;
+        mScanStartError = aError;
+        ExitNow();
     }
+
+    VerifyOrExit(mEventStream.HasSubscribers());
+    mEventStream.Publish(kEventScanComplete, Json::String2JsonString(otThreadErrorToString(aError)));
+
+exit:
+    return;
 }
 
-void Resource::GetDataNetworkName(Response &aResponse) const
+void Resource::GetDataNetworkName(const Request &aRequest, Response &aResponse)
 {
     std::string networkName;
     std::string errorCode;
 
-    networkName = otThreadGetNetworkName(mInstance);
+    OT_UNUSED_VARIABLE(aRequest);
+
+    networkName = mHost->GetNetworkState().mNetworkName;
     networkName = Json::String2JsonString(networkName);
 
     aResponse.SetBody(networkName);
@@ -455,30 +718,18 @@ void Resource::GetDataNetworkName(Response &aResponse) const
     aResponse.SetResponsCode(errorCode);
 }
 
-void Resource::NetworkName(const Request &aRequest, Response &aResponse) const
+void Resource::GetDataLeaderData(const Request &aRequest, Response &aResponse)
 {
-    std::string errorCode;
-
-    if (aRequest.GetMethod() == HttpMethod::kGet)
-    {
-        GetDataNetworkName(aResponse);
-    }
-    else
-    {
-        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
-    }
-}
+    otbrError                 error = OTBR_ERROR_NONE;
+    Ncp::NetworkStateSnapshot state = mHost->GetNetworkState();
+    std::string               body;
+    std::string               errorCode;
 
-void Resource::GetDataLeaderData(Response &aResponse) const
-{
-    otbrError    error = OTBR_ERROR_NONE;
-    otLeaderData leaderData;
-    std::string  body;
-    std::string  errorCode;
+    OT_UNUSED_VARIABLE(aRequest);
 
-    VerifyOrExit(otThreadGetLeaderData(mInstance, &leaderData) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
+    VerifyOrExit(state.mLeaderDataError == OT_ERROR_NONE, error = OTBR_ERROR_REST);
 
-    body = Json::LeaderData2JsonString(leaderData);
+    body = Json::LeaderData2JsonString(state.mLeaderData);
 
     aResponse.SetBody(body);
 
@@ -494,20 +745,7 @@ exit:
     }
 }
 
-void Resource::LeaderData(const Request &aRequest, Response &aResponse) const
-{
-    std::string errorCode;
-    if (aRequest.GetMethod() == HttpMethod::kGet)
-    {
-        GetDataLeaderData(aResponse);
-    }
-    else
-    {
-        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
-    }
-}
-
-void Resource::GetDataNumOfRoute(Response &aResponse) const
+void Resource::GetDataNumOfRoute(const Request &aRequest, Response &aResponse)
 {
     uint8_t      count = 0;
     uint8_t      maxRouterId;
@@ -516,6 +754,8 @@ void Resource::GetDataNumOfRoute(Response &aResponse) const
     std::string body;
     std::string errorCode;
 
+    OT_UNUSED_VARIABLE(aRequest);
+
     for (uint8_t i = 0; i <= maxRouterId; ++i)
     {
         if (otThreadGetRouterInfo(mInstance, i, &routerInfo) != OT_ERROR_NONE)
@@ -532,78 +772,76 @@ void Resource::GetDataNumOfRoute(Response &aResponse) const
     aResponse.SetResponsCode(errorCode);
 }
 
-void Resource::NumOfRoute(const Request &aRequest, Response &aResponse) const
+void Resource::GetDataRloc16(const Request &aRequest, Response &aResponse)
 {
+    uint16_t    rloc16 = mHost->GetNetworkState().mRloc16;
+    std::string body;
     std::string errorCode;
 
-    if (aRequest.GetMethod() == HttpMethod::kGet)
-    {
-        GetDataNumOfRoute(aResponse);
-    }
-    else
-    {
-        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
-    }
+    OT_UNUSED_VARIABLE(aRequest);
+
+    body = Json::Number2JsonString(rloc16);
+
+    aResponse.SetBody(body);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
 }
 
-void Resource::GetDataRloc16(Response &aResponse) const
+void Resource::GetCounterHistory(const Request &aRequest, Response &aResponse)
 {
-    uint16_t    rloc16 = otThreadGetRloc16(mInstance);
     std::string body;
     std::string errorCode;
 
-    body = Json::Number2JsonString(rloc16);
+    OT_UNUSED_VARIABLE(aRequest);
+
+    // The counters are sampled periodically in the background, a request only formats their history.
+    body = Json::CounterHistory2JsonString(mHost->GetThreadHelper()->GetCounterHistory());
 
     aResponse.SetBody(body);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
     aResponse.SetResponsCode(errorCode);
 }
 
-void Resource::Rloc16(const Request &aRequest, Response &aResponse) const
+#if OTBR_ENABLE_CHANNEL_SAMPLING
+void Resource::GetChannelOccupancy(const Request &aRequest, Response &aResponse)
 {
+    std::string body;
     std::string errorCode;
 
-    if (aRequest.GetMethod() == HttpMethod::kGet)
-    {
-        GetDataRloc16(aResponse);
-    }
-    else
-    {
-        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
-    }
-}
+    OT_UNUSED_VARIABLE(aRequest);
 
-void Resource::GetDataExtendedPanId(Response &aResponse) const
-{
-    const uint8_t *extPanId = reinterpret_cast<const uint8_t *>(otThreadGetExtendedPanId(mInstance));
-    std::string    body     = Json::Bytes2HexJsonString(extPanId, OT_EXT_PAN_ID_SIZE);
-    std::string    errorCode;
+    // The channels are sampled periodically in the background, a request only formats their statistics.
+    body = Json::ChannelOccupancy2JsonString(mHost->GetThreadHelper()->GetChannelOccupancy(),
+                                             otLinkGetSupportedChannelMask(mInstance),
+                                             otPlatRadioGetPreferredChannelMask(mInstance));
 
     aResponse.SetBody(body);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
     aResponse.SetResponsCode(errorCode);
 }
+#endif
 
-void Resource::ExtendedPanId(const Request &aRequest, Response &aResponse) const
+void Resource::GetDataExtendedPanId(const Request &aRequest, Response &aResponse)
 {
-    std::string errorCode;
+    Ncp::NetworkStateSnapshot state = mHost->GetNetworkState();
+    std::string               body  = Json::Bytes2HexJsonString(state.mExtPanId.m8, OT_EXT_PAN_ID_SIZE);
+    std::string               errorCode;
 
-    if (aRequest.GetMethod() == HttpMethod::kGet)
-    {
-        GetDataExtendedPanId(aResponse);
-    }
-    else
-    {
-        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
-    }
+    OT_UNUSED_VARIABLE(aRequest);
+
+    aResponse.SetBody(body);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
 }
 
-void Resource::GetDataRloc(Response &aResponse) const
+void Resource::GetDataRloc(const Request &aRequest, Response &aResponse)
 {
     otIp6Address rlocAddress = *otThreadGetRloc(mInstance);
     std::string  body;
     std::string  errorCode;
 
+    OT_UNUSED_VARIABLE(aRequest);
+
     body = Json::IpAddr2JsonString(rlocAddress);
 
     aResponse.SetBody(body);
@@ -611,30 +849,13 @@ void Resource::GetDataRloc(Response &aResponse) const
     aResponse.SetResponsCode(errorCode);
 }
 
-void Resource::Rloc(const Request &aRequest, Response &aResponse) const
-{
-    std::string errorCode;
-
-    if (aRequest.GetMethod() == HttpMethod::kGet)
-    {
-        GetDataRloc(aResponse);
-    }
-    else
-    {
-        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
-    }
-}
-
-void Resource::GetDataset(DatasetType aDatasetType, const Request &aRequest, Response &aResponse) const
+otbrError Resource::GenerateDataset(DatasetType aDatasetType, DatasetFormat aFormat, std::string &aBody) const
 {
     otbrError                error = OTBR_ERROR_NONE;
-    struct NodeInfo          node;
-    std::string              body;
-    std::string              errorCode;
     otOperationalDataset     dataset;
     otOperationalDatasetTlvs datasetTlvs;
 
-    if (aRequest.GetHeaderValue(OT_REST_ACCEPT_HEADER) == OT_REST_CONTENT_TYPE_PLAIN)
+    if (aFormat != DatasetFormat::kJson)
     {
         if (aDatasetType == DatasetType::kActive)
         {
@@ -647,37 +868,72 @@ void Resource::GetDataset(DatasetType aDatasetType, const Request &aRequest, Res
                          error = OTBR_ERROR_NOT_FOUND);
         }
 
-        aResponse.SetContentType(OT_REST_CONTENT_TYPE_PLAIN);
-        body = Utils::Bytes2Hex(datasetTlvs.mTlvs, datasetTlvs.mLength);
+        if (aFormat == DatasetFormat::kTlvs)
+        {
+            aBody.assign(reinterpret_cast<const char *>(datasetTlvs.mTlvs), datasetTlvs.mLength);
+        }
+        else
+        {
+            aBody = Utils::Bytes2Hex(datasetTlvs.mTlvs, datasetTlvs.mLength);
+        }
     }
     else
     {
         if (aDatasetType == DatasetType::kActive)
         {
             VerifyOrExit(otDatasetGetActive(mInstance, &dataset) == OT_ERROR_NONE, error = OTBR_ERROR_NOT_FOUND);
-            body = Json::ActiveDataset2JsonString(dataset);
+            aBody = Json::ActiveDataset2JsonString(dataset);
         }
         else if (aDatasetType == DatasetType::kPending)
         {
             VerifyOrExit(otDatasetGetPending(mInstance, &dataset) == OT_ERROR_NONE, error = OTBR_ERROR_NOT_FOUND);
-            body = Json::PendingDataset2JsonString(dataset);
+            aBody = Json::PendingDataset2JsonString(dataset);
         }
     }
 
-    aResponse.SetBody(body);
-
 exit:
-    if (error == OTBR_ERROR_NONE)
+    return error;
+}
+
+void Resource::GetDataset(DatasetType aDatasetType, const Request &aRequest, Response &aResponse)
+{
+    otbrError     error  = OTBR_ERROR_NONE;
+    StringView    accept = aRequest.GetHeaderValue(OT_REST_ACCEPT_HEADER);
+    DatasetFormat format = DatasetFormat::kJson;
+    std::string   errorCode;
+
+    if (accept == OT_REST_CONTENT_TYPE_PLAIN)
     {
-        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
-        aResponse.SetResponsCode(errorCode);
+        format = DatasetFormat::kHexTlvs;
     }
-    else if (error == OTBR_ERROR_NOT_FOUND)
+    else if (accept == OT_REST_CONTENT_TYPE_OCTET_STREAM)
     {
-        errorCode = GetHttpStatus(HttpStatusCode::kStatusNoContent);
+        format = DatasetFormat::kTlvs;
+    }
+
+    SuccessOrExit(error = RefreshCachedBody(
+                      mDatasetBodies[static_cast<uint8_t>(format)][static_cast<uint8_t>(aDatasetType)],
+                      [this, aDatasetType, format](std::string &aBody) {
+                          return GenerateDataset(aDatasetType, format, aBody);
+                      }));
+
+    if (format == DatasetFormat::kHexTlvs)
+    {
+        aResponse.SetContentType(OT_REST_CONTENT_TYPE_PLAIN);
+    }
+    else if (format == DatasetFormat::kTlvs)
+    {
+        aResponse.SetContentType(OT_REST_CONTENT_TYPE_OCTET_STREAM);
+    }
+    RespondCachedBody(cache, aRequest, aResponse);
+
+exit:
+    if (error == OTBR_ERROR_NOT_FOUND)
+    {
+        errorCode = GetHttpStatus(HttpStatusCode::kStatusNoContent);
         aResponse.SetResponsCode(errorCode);
     }
-    else
+    else if (error != OTBR_ERROR_NONE)
     {
         ErrorHandler(aResponse, HttpStatusCode::kStatusInternalServerError);
     }
@@ -694,7 +950,7 @@ void Resource::SetDataset(DatasetType aDatasetType, const Request &aRequest, Res
     otOperationalDatasetTlvs datasetTlvs;
     otOperationalDatasetTlvs datasetUpdateTlvs;
     int                      ret;
-    bool                     isTlv;
+    StringView               contentType = aRequest.GetHeaderValue(OT_REST_CONTENT_TYPE_HEADER);
 
     if (aDatasetType == DatasetType::kActive)
     {
@@ -714,13 +970,22 @@ void Resource::SetDataset(DatasetType aDatasetType, const Request &aRequest, Res
         errorCode = GetHttpStatus(HttpStatusCode::kStatusCreated);
     }
 
-    isTlv = aRequest.GetHeaderValue(OT_REST_CONTENT_TYPE_HEADER) == OT_REST_CONTENT_TYPE_PLAIN;
-
-    if (isTlv)
+    if (contentType == OT_REST_CONTENT_TYPE_PLAIN || contentType == OT_REST_CONTENT_TYPE_OCTET_STREAM)
     {
-        ret = Json::Hex2BytesJsonString(aRequest.GetBody(), datasetUpdateTlvs.mTlvs, OT_OPERATIONAL_DATASET_MAX_LENGTH);
-        VerifyOrExit(ret >= 0, error = OTBR_ERROR_INVALID_ARGS);
-        datasetUpdateTlvs.mLength = ret;
+        if (contentType == OT_REST_CONTENT_TYPE_OCTET_STREAM)
+        {
+            VerifyOrExit(aRequest.GetBody().Size() <= OT_OPERATIONAL_DATASET_MAX_LENGTH,
+                         error = OTBR_ERROR_INVALID_ARGS);
+            memcpy(datasetUpdateTlvs.mTlvs, aRequest.GetBody().Data(), aRequest.GetBody().Size());
+            datasetUpdateTlvs.mLength = static_cast<uint8_t>(aRequest.GetBody().Size());
+        }
+        else
+        {
+            ret = Json::Hex2BytesJsonString(aRequest.GetBody().ToString(), datasetUpdateTlvs.mTlvs,
+                                            OT_OPERATIONAL_DATASET_MAX_LENGTH);
+            VerifyOrExit(ret >= 0, error = OTBR_ERROR_INVALID_ARGS);
+            datasetUpdateTlvs.mLength = ret;
+        }
 
         VerifyOrExit(otDatasetParseTlvs(&datasetUpdateTlvs, &dataset) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
         VerifyOrExit(otDatasetUpdateTlvs(&dataset, &datasetTlvs) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
@@ -767,93 +1032,590 @@ exit:
     }
 }
 
-void Resource::Dataset(DatasetType aDatasetType, const Request &aRequest, Response &aResponse) const
+void Resource::GetDatasetActive(const Request &aRequest, Response &aResponse)
 {
-    std::string errorCode;
+    GetDataset(DatasetType::kActive, aRequest, aResponse);
+}
+
+void Resource::SetDatasetActive(const Request &aRequest, Response &aResponse)
+{
+    SetDataset(DatasetType::kActive, aRequest, aResponse);
+}
+
+void Resource::GetDatasetPending(const Request &aRequest, Response &aResponse)
+{
+    GetDataset(DatasetType::kPending, aRequest, aResponse);
+}
+
+void Resource::SetDatasetPending(const Request &aRequest, Response &aResponse)
+{
+    SetDataset(DatasetType::kPending, aRequest, aResponse);
+}
+
+void Resource::Options(const Request &aRequest, Response &aResponse)
+{
+    std::string errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+
+    OT_UNUSED_VARIABLE(aRequest);
 
-    switch (aRequest.GetMethod())
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetComplete();
+}
+
+void Resource::Events(const Request &aRequest, Response &aResponse)
+{
+    std::string  body;
+    std::string  errorCode;
+    otLeaderData leaderData;
+
+    OT_UNUSED_VARIABLE(aRequest);
+
+    // The current state comes first, then the connection streams the events of the changes.
+    EventStream::Format(body, kEventState,
+                        Json::String2JsonString(GetDeviceRoleName(otThreadGetDeviceRole(mInstance))));
+    if (otThreadGetLeaderData(mInstance, &leaderData) == OT_ERROR_NONE)
     {
-    case HttpMethod::kGet:
-        GetDataset(aDatasetType, aRequest, aResponse);
-        break;
-    case HttpMethod::kPut:
-        SetDataset(aDatasetType, aRequest, aResponse);
-        break;
-    case HttpMethod::kOptions:
-        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
-        aResponse.SetResponsCode(errorCode);
-        aResponse.SetComplete();
-        break;
-    default:
-        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
-        break;
+        EventStream::Format(body, kEventLeaderData, Json::LeaderData2JsonString(leaderData));
     }
+
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetContentType(OT_REST_CONTENT_TYPE_EVENT_STREAM);
+    aResponse.SetHeader("Cache-Control", "no-cache");
+    aResponse.SetEventStream(mEventStream);
+    aResponse.SetBody(body);
+}
+
+void Resource::GetMetrics(const Request &aRequest, Response &aResponse)
+{
+    std::string body;
+    std::string errorCode;
+
+    OT_UNUSED_VARIABLE(aRequest);
+
+    // Metrics are updated in place by the modules, so a scrape only formats their current values.
+    Metrics::Registry::Get().WriteOpenMetrics(body);
+
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetContentType(OT_REST_CONTENT_TYPE_OPENMETRICS);
+    aResponse.SetBody(body);
 }
 
-void Resource::DatasetActive(const Request &aRequest, Response &aResponse) const
+void Resource::GetTopologyNeighbors(const Request &aRequest, Response &aResponse)
 {
-    Dataset(DatasetType::kActive, aRequest, aResponse);
+    otbrError                        error  = OTBR_ERROR_NONE;
+    uint16_t                         rloc16 = 0;
+    std::vector<TopologyGraph::Link> links;
+    std::string                      body;
+    std::string                      errorCode;
+
+    error = ParseRloc16Parameter(aRequest, "node", rloc16);
+    VerifyOrExit(error != OTBR_ERROR_NOT_FOUND, error = OTBR_ERROR_INVALID_ARGS);
+    SuccessOrExit(error);
+    VerifyOrExit(mTopologyGraph.Contains(rloc16), error = OTBR_ERROR_NOT_FOUND);
+
+    mTopologyGraph.GetNeighbors(rloc16, links);
+    body      = Json::TopologyLinks2JsonString(links);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetBody(body);
+
+exit:
+    RespondTopologyError(error, aResponse);
 }
 
-void Resource::DatasetPending(const Request &aRequest, Response &aResponse) const
+void Resource::GetTopologyPath(const Request &aRequest, Response &aResponse)
 {
-    Dataset(DatasetType::kPending, aRequest, aResponse);
+    otbrError           error = OTBR_ERROR_NONE;
+    uint16_t            from  = mHost->GetNetworkState().mRloc16;
+    uint16_t            to    = 0;
+    TopologyGraph::Path path;
+    std::string         body;
+    std::string         errorCode;
+
+    // The path starts from this border router unless another source is given.
+    error = ParseRloc16Parameter(aRequest, "from", from);
+    VerifyOrExit(error == OTBR_ERROR_NONE || error == OTBR_ERROR_NOT_FOUND);
+    error = ParseRloc16Parameter(aRequest, "to", to);
+    VerifyOrExit(error != OTBR_ERROR_NOT_FOUND, error = OTBR_ERROR_INVALID_ARGS);
+    SuccessOrExit(error);
+    VerifyOrExit(mTopologyGraph.FindPath(from, to, path), error = OTBR_ERROR_NOT_FOUND);
+
+    body      = Json::TopologyPath2JsonString(path);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetBody(body);
+
+exit:
+    RespondTopologyError(error, aResponse);
 }
 
-void Resource::DeleteOutDatedDiagnostic(void)
+void Resource::GetTopologyPartitions(const Request &aRequest, Response &aResponse)
 {
-    auto eraseIt = mDiagSet.begin();
-    for (eraseIt = mDiagSet.begin(); eraseIt != mDiagSet.end();)
+    std::vector<std::vector<uint16_t>> partitions;
+    std::string                        body;
+    std::string                        errorCode;
+
+    OT_UNUSED_VARIABLE(aRequest);
+
+    mTopologyGraph.GetPartitions(partitions);
+    body      = Json::TopologyPartitions2JsonString(partitions);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetBody(body);
+}
+
+void Resource::RespondTopologyError(otbrError aError, Response &aResponse) const
+{
+    if (aError == OTBR_ERROR_INVALID_ARGS)
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest);
+    }
+    else if (aError == OTBR_ERROR_NOT_FOUND)
     {
-        auto diagInfo = eraseIt->second;
-        auto duration = duration_cast<microseconds>(steady_clock::now() - diagInfo.mStartTime).count();
+        ErrorHandler(aResponse, HttpStatusCode::kStatusResourceNotFound);
+    }
+}
 
-        if (duration >= kDiagResetTimeout)
+void Resource::Batch(const Request &aRequest, Response &aResponse)
+{
+    otbrError                                        error = OTBR_ERROR_NONE;
+    StringView                                       value;
+    std::vector<std::string>                         paths;
+    std::vector<std::pair<std::string, std::string>> bodies;
+    std::string                                      body;
+    std::string                                      errorCode;
+
+    VerifyOrExit(aRequest.GetQueryParameter("path", value), error = OTBR_ERROR_INVALID_ARGS);
+    SuccessOrExit(error = ParseBatchPaths(value, paths));
+
+    // All the resources are read in this call, so they are consistent with each other.
+    for (const std::string &path : paths)
+    {
+        // The request of a resource only has the path, the headers of the batch request would change the response,
+        // e.g. If-None-Match would turn it into a 304 without a body.
+        std::vector<char> buffer(path.begin(), path.end());
+        Request           request(buffer);
+        Response          response;
+        const Route      *route;
+        ResourceHandler   handler;
+
+        request.SetUrl(buffer.data(), buffer.size());
+        request.SetMethod(HTTP_GET);
+        request.SetReadComplete();
+
+        route = mRouter.Find(request.GetUrl(), request);
+        VerifyOrExit(route != nullptr, error = OTBR_ERROR_INVALID_ARGS);
+        handler = route->mHandlers[static_cast<uint8_t>(HttpMethod::kGet)];
+        VerifyOrExit(handler != nullptr, error = OTBR_ERROR_INVALID_ARGS);
+        (this->*handler)(request, response);
+
+        // A resource which is absent or failed is null, a resource which isn't Json is a Json string.
+        if (response.GetResponseCode() != GetHttpStatus(HttpStatusCode::kStatusOk))
+        {
+            bodies.emplace_back(path, std::string());
+        }
+        else if (response.GetContentType() != OT_REST_CONTENT_TYPE_JSON)
         {
-            eraseIt = mDiagSet.erase(eraseIt);
+            bodies.emplace_back(path, Json::String2JsonString(response.GetBody()));
         }
         else
         {
-            eraseIt++;
+            bodies.emplace_back(path, response.GetBody());
         }
     }
+
+    body      = Json::Batch2JsonString(bodies);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetBody(body);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest);
+    }
 }
 
-void Resource::UpdateDiag(std::string aKey, std::vector<otNetworkDiagTlv> &aDiag)
+void Resource::DeleteOutDatedDiagnostic(void)
 {
-    DiagInfo value;
+    // The age is measured at the nominal end of the collection, so a late completion doesn't drop fresh entries.
+    steady_clock::time_point collectEndTime = mDiagCollectStartTime + microseconds(kDiagCollectTimeout);
 
-    value.mStartTime = steady_clock::now();
-    value.mDiagContent.assign(aDiag.begin(), aDiag.end());
-    mDiagSet[aKey] = value;
+    mDiagVersion += mDiagStore.RemoveExpired(collectEndTime - microseconds(kDiagResetTimeout));
+    mTopologyGraph.RemoveExpired(collectEndTime - microseconds(kDiagResetTimeout));
 }
 
-void Resource::Diagnostic(const Request &aRequest, Response &aResponse) const
+void Resource::UpdateDiag(const std::string &aKey, const std::vector<otNetworkDiagTlv> &aDiag)
+{
+    const DiagStore::Node &node = mDiagStore.Update(aKey, aDiag, CoarseClock::Now());
+
+    ++mDiagVersion;
+    mTopologyGraph.Update(aDiag, node.mUpdateTime);
+
+    if (mDiagCollecting && mDiagStream.HasSubscribers())
+    {
+        std::string chunk;
+
+        AppendNdjsonChunk(chunk, node.mJson);
+        mDiagStream.PublishText(chunk);
+    }
+
+    mEventStream.Publish(kEventDiagnostic, node.mJson);
+}
+
+otbrError Resource::ParseDiagnosticQuery(const Request &aRequest, DiagQuery &aQuery) const
+{
+    otbrError          error = OTBR_ERROR_NONE;
+    StringView         value;
+    std::istringstream tokens;
+    std::string        token;
+
+    aQuery.mCbor = (aRequest.GetHeaderValue(OT_REST_ACCEPT_HEADER) == OT_REST_CONTENT_TYPE_CBOR);
+
+    if (aRequest.GetQueryParameter("tlv", value))
+    {
+        tokens.str(value.ToString());
+        while (std::getline(tokens, token, ','))
+        {
+            const auto *name = std::begin(kDiagTlvNames);
+
+            token = StringUtils::ToLowercase(token);
+            while (name != std::end(kDiagTlvNames) && token != name->mName)
+            {
+                ++name;
+            }
+            VerifyOrExit(name != std::end(kDiagTlvNames), error = OTBR_ERROR_INVALID_ARGS);
+            aQuery.mTlvTypes.push_back(name->mType);
+        }
+        VerifyOrExit(!aQuery.mTlvTypes.empty(), error = OTBR_ERROR_INVALID_ARGS);
+    }
+
+    if (aRequest.GetQueryParameter("node", value))
+    {
+        tokens.clear();
+        tokens.str(value.ToString());
+        while (std::getline(tokens, token, ','))
+        {
+            char         *end;
+            unsigned long rloc16 = strtoul(token.c_str(), &end, 0);
+
+            VerifyOrExit(!token.empty() && *end == '\0' && rloc16 <= UINT16_MAX, error = OTBR_ERROR_INVALID_ARGS);
+            aQuery.mNodes.push_back(static_cast<uint16_t>(rloc16));
+        }
+        VerifyOrExit(!aQuery.mNodes.empty() && aQuery.mNodes.size() <= kDiagMaxQueryNodes,
+                     error = OTBR_ERROR_INVALID_ARGS);
+    }
+
+exit:
+    return error;
+}
+
+otbrError Resource::SendDiagnosticQuery(const DiagQuery &aQuery)
+{
+    otbrError            error   = OTBR_ERROR_NONE;
+    otIp6Address         address = *otThreadGetRloc(mInstance);
+    std::vector<uint8_t> tlvTypes;
+
+    if (aQuery.mTlvTypes.empty())
+    {
+        tlvTypes.assign(std::begin(kAllTlvTypes), std::end(kAllTlvTypes));
+    }
+    else
+    {
+        // The RLOC16 identifies the node sending a response.
+        tlvTypes.push_back(OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS);
+        tlvTypes.insert(tlvTypes.end(), aQuery.mTlvTypes.begin(), aQuery.mTlvTypes.end());
+    }
+
+    if (aQuery.mNodes.empty())
+    {
+        VerifyOrExit(otThreadSendDiagnosticGet(mInstance, &address, tlvTypes.data(),
+                                               static_cast<uint8_t>(tlvTypes.size()),
+                                               &Resource::DiagnosticResponseHandler, this) == OT_ERROR_NONE,
+                     error = OTBR_ERROR_REST);
+        VerifyOrExit(otIp6AddressFromString(kMulticastAddrAllRouters, &address) == OT_ERROR_NONE,
+                     error = OTBR_ERROR_REST);
+        VerifyOrExit(otThreadSendDiagnosticGet(mInstance, &address, tlvTypes.data(),
+                                               static_cast<uint8_t>(tlvTypes.size()),
+                                               &Resource::DiagnosticResponseHandler, this) == OT_ERROR_NONE,
+                     error = OTBR_ERROR_REST);
+    }
+
+    // The RLOC of a node is the mesh local prefix and IID 0000:00ff:fe00:RLOC16, as the RLOC of this node.
+    for (uint16_t rloc16 : aQuery.mNodes)
+    {
+        address.mFields.m8[OT_IP6_ADDRESS_SIZE - 2] = static_cast<uint8_t>(rloc16 >> 8);
+        address.mFields.m8[OT_IP6_ADDRESS_SIZE - 1] = static_cast<uint8_t>(rloc16 & 0xff);
+        VerifyOrExit(otThreadSendDiagnosticGet(mInstance, &address, tlvTypes.data(),
+                                               static_cast<uint8_t>(tlvTypes.size()),
+                                               &Resource::DiagnosticResponseHandler, this) == OT_ERROR_NONE,
+                     error = OTBR_ERROR_REST);
+    }
+
+exit:
+    return error;
+}
+
+void Resource::RespondDiagnosticQuery(const DiagQuery &aQuery, Response &aResponse) const
+{
+    std::vector<std::vector<otNetworkDiagTlv>> diagContentSet;
+    std::string                                body;
+    std::string                                errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+
+    std::vector<otNetworkDiagTlv>              diagTlvs;
+
+    mDiagStore.ForEach([&](const std::string &, const DiagStore::Node &aNode) {
+        std::vector<otNetworkDiagTlv> diagContent;
+        uint16_t                      rloc16    = 0;
+        bool                          hasRloc16 = false;
+
+        // Only the nodes which responded to this query.
+        if (aNode.mUpdateTime < aResponse.GetStartTime())
+        {
+            return;
+        }
+
+        DiagStore::GetTlvs(aNode, diagTlvs);
+        for (const otNetworkDiagTlv &diagTlv : diagTlvs)
+        {
+            if (diagTlv.mType == OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS)
+            {
+                rloc16    = diagTlv.mData.mAddr16;
+                hasRloc16 = true;
+            }
+            if (aQuery.mTlvTypes.empty() || std::find(aQuery.mTlvTypes.begin(), aQuery.mTlvTypes.end(),
+                                                      diagTlv.mType) != aQuery.mTlvTypes.end())
+            {
+                diagContent.push_back(diagTlv);
+            }
+        }
+
+        if (!aQuery.mNodes.empty() &&
+            (!hasRloc16 || std::find(aQuery.mNodes.begin(), aQuery.mNodes.end(), rloc16) == aQuery.mNodes.end()))
+        {
+            return;
+        }
+
+        diagContentSet.push_back(std::move(diagContent));
+    });
+
+    if (aQuery.mCbor)
+    {
+        body = Json::Diag2CborString(diagContentSet);
+        aResponse.SetContentType(OT_REST_CONTENT_TYPE_CBOR);
+    }
+    else
+    {
+        body = Json::Diag2JsonString(diagContentSet);
+    }
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetBody(body);
+    aResponse.SetComplete();
+}
+
+otbrError Resource::CollectDiagnostic(void)
 {
     otbrError error = OTBR_ERROR_NONE;
-    OT_UNUSED_VARIABLE(aRequest);
-    struct otIp6Address rloc16address = *otThreadGetRloc(mInstance);
-    struct otIp6Address multicastAddress;
-
-    VerifyOrExit(otThreadSendDiagnosticGet(mInstance, &rloc16address, kAllTlvTypes, sizeof(kAllTlvTypes),
-                                           &Resource::DiagnosticResponseHandler,
-                                           const_cast<Resource *>(this)) == OT_ERROR_NONE,
-                 error = OTBR_ERROR_REST);
-    VerifyOrExit(otIp6AddressFromString(kMulticastAddrAllRouters, &multicastAddress) == OT_ERROR_NONE,
-                 error = OTBR_ERROR_REST);
-    VerifyOrExit(otThreadSendDiagnosticGet(mInstance, &multicastAddress, kAllTlvTypes, sizeof(kAllTlvTypes),
-                                           &Resource::DiagnosticResponseHandler,
-                                           const_cast<Resource *>(this)) == OT_ERROR_NONE,
-                 error = OTBR_ERROR_REST);
+
+    // Concurrent requests share the collection in flight.
+    VerifyOrExit(!mDiagCollecting);
+
+    SuccessOrExit(error = SendDiagnosticQuery(DiagQuery()));
+
+    mDiagCollecting       = true;
+    mDiagCollectStartTime = CoarseClock::Now();
+
+    // The collection completes on time even if no request checks it, which ends its streams.
+    mDiagCollectTimer = mTaskRunner.Post(Milliseconds(kDiagCollectTimeout / 1000), [this]() {
+        mDiagCollectTimer = 0;
+        FinishDiagnosticCollection();
+    });
 
 exit:
+    return error;
+}
 
-    if (error == OTBR_ERROR_NONE)
+void Resource::UpdateDiagnosticCollection(void)
+{
+    VerifyOrExit(mDiagCollecting);
+    VerifyOrExit(duration_cast<microseconds>(CoarseClock::Now() - mDiagCollectStartTime).count() >=
+                 kDiagCollectTimeout);
+
+    FinishDiagnosticCollection();
+
+exit:
+    return;
+}
+
+void Resource::FinishDiagnosticCollection(void)
+{
+    if (mDiagCollectTimer != 0)
     {
-        aResponse.SetStartTime(steady_clock::now());
-        aResponse.SetCallback();
+        mTaskRunner.Cancel(mDiagCollectTimer);
+        mDiagCollectTimer = 0;
+    }
+
+    DeleteOutDatedDiagnostic();
+    mDiagCollecting    = false;
+    mDiagCollected     = true;
+    mDiagCollectedTime = CoarseClock::Now();
+
+    if (mDiagStream.HasSubscribers())
+    {
+        mDiagStream.PublishText(kDiagStreamLastChunk);
+    }
+    mDiagStream.End();
+}
+
+const std::string &Resource::GetDiagnosticSnapshot(void)
+{
+    VerifyOrExit(mDiagSnapshotVersion != mDiagVersion);
+
+    // Only the entries updated since the last snapshot were serialized again, the snapshot just joins them.
+    mDiagSnapshot.clear();
+    mDiagSnapshot.push_back('[');
+    mDiagStore.ForEach([this](const std::string &, const DiagStore::Node &aNode) {
+        if (mDiagSnapshot.size() > 1)
+        {
+            mDiagSnapshot.push_back(',');
+        }
+        mDiagSnapshot.append(aNode.mJson);
+    });
+    mDiagSnapshot.push_back(']');
+    mDiagSnapshotVersion = mDiagVersion;
+
+exit:
+    return mDiagSnapshot;
+}
+
+void Resource::RespondDiagnostic(const DiagQuery &aQuery, Response &aResponse)
+{
+    std::string body;
+    std::string errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    auto        age       = duration_cast<seconds>(CoarseClock::Now() - mDiagCollectedTime).count();
+
+    // The CBOR body is encoded from the stored TLVs, while the Json one reuses the snapshot.
+    if (aQuery.mCbor)
+    {
+        std::vector<std::vector<otNetworkDiagTlv>> diagContentSet;
+
+        mDiagStore.ForEach([&diagContentSet](const std::string &, const DiagStore::Node &aNode) {
+            diagContentSet.emplace_back();
+            DiagStore::GetTlvs(aNode, diagContentSet.back());
+        });
+        body = Json::Diag2CborString(diagContentSet);
+        aResponse.SetContentType(OT_REST_CONTENT_TYPE_CBOR);
     }
     else
+    {
+        body = GetDiagnosticSnapshot();
+    }
+
+    aResponse.SetHeader("Age", std::to_string(age));
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetBody(body);
+    aResponse.SetComplete();
+}
+
+void Resource::RespondDiagnosticNdjson(Response &aResponse)
+{
+    std::string body;
+    std::string errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    auto        age       = duration_cast<seconds>(CoarseClock::Now() - mDiagCollectedTime).count();
+
+    mDiagStore.ForEach([&body](const std::string &, const DiagStore::Node &aNode) {
+        body.append(aNode.mJson).push_back('\n');
+    });
+
+    aResponse.SetHeader("Age", std::to_string(age));
+    aResponse.SetContentType(OT_REST_CONTENT_TYPE_NDJSON);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetBody(body);
+    aResponse.SetComplete();
+}
+
+void Resource::StartDiagnosticStream(Response &aResponse)
+{
+    std::string body;
+    std::string errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+
+    // The nodes which already responded to the collection in flight come first, then each one as it responds.
+    mDiagStore.ForEach([this, &body](const std::string &, const DiagStore::Node &aNode) {
+        if (aNode.mUpdateTime >= mDiagCollectStartTime)
+        {
+            AppendNdjsonChunk(body, aNode.mJson);
+        }
+    });
+
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetContentType(OT_REST_CONTENT_TYPE_NDJSON);
+    aResponse.SetHeader("Cache-Control", "no-cache");
+    aResponse.SetHeader("Transfer-Encoding", "chunked");
+    aResponse.SetEventStream(mDiagStream);
+    aResponse.SetBody(body);
+}
+
+void Resource::Diagnostic(const Request &aRequest, Response &aResponse)
+{
+    otbrError error  = OTBR_ERROR_NONE;
+    bool      ndjson = (aRequest.GetHeaderValue(OT_REST_ACCEPT_HEADER) == OT_REST_CONTENT_TYPE_NDJSON);
+    DiagQuery query;
+
+    UpdateDiagnosticCollection();
+
+    SuccessOrExit(error = ParseDiagnosticQuery(aRequest, query));
+
+    // A selective query is sent on its own, only the requested TLVs of the requested nodes are collected.
+    if (query.IsSelective())
+    {
+        SuccessOrExit(error = SendDiagnosticQuery(query));
+        aResponse.SetStartTime(CoarseClock::Now());
+        aResponse.SetCallback();
+        ExitNow();
+    }
+
+    if (mDiagCollected)
+    {
+        auto age = duration_cast<microseconds>(CoarseClock::Now() - mDiagCollectedTime).count();
+
+        if (age < kDiagStaleTimeout)
+        {
+            // Serve the collected diagnostics right away and refresh them in the background once they get stale.
+            if (age >= kDiagFreshTimeout && CollectDiagnostic() != OTBR_ERROR_NONE)
+            {
+                otbrLogWarning("Failed to refresh diagnostics");
+            }
+            if (ndjson)
+            {
+                RespondDiagnosticNdjson(aResponse);
+            }
+            else
+            {
+                RespondDiagnostic(query, aResponse);
+            }
+            ExitNow();
+        }
+    }
+
+    SuccessOrExit(error = CollectDiagnostic());
+
+    // A client accepting NDJSON is streamed each node as it responds, instead of waiting for the whole collection.
+    if (ndjson)
+    {
+        StartDiagnosticStream(aResponse);
+        ExitNow();
+    }
+    aResponse.SetStartTime(CoarseClock::Now());
+    aResponse.SetCallback();
+
+exit:
+    if (error == OTBR_ERROR_INVALID_ARGS)
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest);
+    }
+    else if (error != OTBR_ERROR_NONE)
     {
         ErrorHandler(aResponse, HttpStatusCode::kStatusInternalServerError);
     }
@@ -880,6 +1642,8 @@ void Resource::DiagnosticResponseHandler(otError aError, const otMessage *aMessa
 
     OTBR_UNUSED_VARIABLE(aMessageInfo);
 
+    // The unused bytes of each TLV are cleared, so that they are compacted in the diagnostic store.
+    memset(&diagTlv, 0, sizeof(diagTlv));
     while ((error = otThreadGetNextDiagnosticTlv(aMessage, &iterator, &diagTlv)) == OT_ERROR_NONE)
     {
         if (diagTlv.mType == OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS)
@@ -888,6 +1652,7 @@ void Resource::DiagnosticResponseHandler(otError aError, const otMessage *aMessa
             keyRloc = Json::CString2JsonString(rloc);
         }
         diagSet.push_back(diagTlv);
+        memset(&diagTlv, 0, sizeof(diagTlv));
     }
     UpdateDiag(keyRloc, diagSet);
 
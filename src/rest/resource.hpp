@@ -36,18 +36,28 @@
 
 #include "openthread-br/config.h"
 
+#include <functional>
 #include <unordered_map>
 
 #include <openthread/border_agent.h>
 #include <openthread/border_router.h>
 
 #include "common/api_strings.hpp"
+#include "common/memory_usage.hpp"
+#include "common/metrics.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
 #include "ncp/rcp_host.hpp"
 #include "openthread/dataset.h"
 #include "openthread/dataset_ftd.h"
+#include "rest/diag_store.hpp"
+#include "rest/event_stream.hpp"
 #include "rest/json.hpp"
+#include "rest/rate_limiter.hpp"
 #include "rest/request.hpp"
 #include "rest/response.hpp"
+#include "rest/router.hpp"
+#include "rest/topology_graph.hpp"
 #include "utils/thread_helper.hpp"
 
 using otbr::Ncp::RcpHost;
@@ -65,9 +75,15 @@ public:
     /**
      * The constructor initializes the resource handler instance.
      *
-     * @param[in] aHost  A pointer to the Thread controller.
+     * @param[in] aHost        A pointer to the Thread controller.
+     * @param[in] aTaskRunner  A reference to the task runner of the timers, which must outlive the handler.
      */
-    Resource(RcpHost *aHost);
+    Resource(RcpHost *aHost, TaskRunner &aTaskRunner);
+
+    /**
+     * The destructor destroys the resource handler instance.
+     */
+    ~Resource(void);
 
     /**
      * This method initialize the Resource handler.
@@ -78,10 +94,14 @@ public:
      * This method is the main entry of resource handler, which find corresponding handler according to request url
      * find the resource and set the content of response.
      *
-     * @param[in]     aRequest  A request instance referred by the Resource handler.
-     * @param[in,out] aResponse  A response instance will be set by the Resource handler.
+     * Requests to the resources which send messages to the mesh or change the network are rate limited per client,
+     * the response is 429 with a Retry-After header when a client sends them too often.
+     *
+     * @param[in]     aClientAddress  The address of the client which sent the request.
+     * @param[in]     aRequest        A request instance referred by the Resource handler.
+     * @param[in,out] aResponse       A response instance will be set by the Resource handler.
      */
-    void Handle(Request &aRequest, Response &aResponse) const;
+    void Handle(const in6_addr &aClientAddress, Request &aRequest, Response &aResponse);
 
     /**
      * This method distributes a callback handler for each connection needs a callback.
@@ -100,6 +120,20 @@ public:
      */
     void ErrorHandler(Response &aResponse, HttpStatusCode aErrorCode) const;
 
+    /**
+     * This method returns the stream of events about changes of the Thread network.
+     *
+     * @returns A reference to the event stream.
+     */
+    EventStream &GetEventStream(void) { return mEventStream; }
+
+    /**
+     * This method returns the memory used by the collected diagnostics.
+     *
+     * @returns The number of diagnostic entries and their estimated heap bytes.
+     */
+    MemoryUsage GetDiagMemoryUsage(void) const;
+
 private:
     /**
      * This enumeration represents the Dataset type (active or pending).
@@ -110,55 +144,189 @@ private:
         kPending, ///< Pending Dataset
     };
 
-    typedef void (Resource::*ResourceHandler)(const Request &aRequest, Response &aResponse) const;
+    /**
+     * This enumeration represents the representation of a Dataset in a request or response body.
+     */
+    enum class DatasetFormat : uint8_t
+    {
+        kJson,    ///< Json object
+        kHexTlvs, ///< TLVs as a hex string
+        kTlvs,    ///< TLVs as raw bytes
+    };
+
+    /**
+     * This structure represents the selection of a diagnostic query.
+     */
+    struct DiagQuery
+    {
+        DiagQuery(void)
+            : mCbor(false)
+        {
+        }
+
+        std::vector<uint8_t>  mTlvTypes; ///< The TLV types requested, all types when empty.
+        std::vector<uint16_t> mNodes;    ///< The RLOC16s of the nodes requested, all nodes when empty.
+        bool                  mCbor;     ///< Whether the response is CBOR instead of Json.
+
+        bool IsSelective(void) const { return !mTlvTypes.empty() || !mNodes.empty(); }
+    };
+
+    /**
+     * This structure represents the cached body of a resource, validated with an entity tag.
+     */
+    struct CachedBody
+    {
+        CachedBody(void)
+            : mValid(false)
+            , mStateVersion(0)
+        {
+        }
+
+        bool        mValid;         ///< Whether the body was generated successfully.
+        uint32_t    mStateVersion;  ///< The value of `mStateVersion` when the body was generated.
+        Timepoint   mGeneratedTime; ///< When the body was generated.
+        std::string mBody;          ///< The body.
+        std::string mETag;          ///< The entity tag of the body.
+    };
+
+    typedef std::function<otbrError(std::string &aBody)> BodyGenerator;
+
+    // The number of HttpMethod values, which index the handlers of a route
+    static constexpr uint8_t kNumHttpMethods = static_cast<uint8_t>(HttpMethod::kOptions) + 1;
+
+    typedef void (Resource::*ResourceHandler)(const Request &aRequest, Response &aResponse);
     typedef void (Resource::*ResourceCallbackHandler)(const Request &aRequest, Response &aResponse);
-    void NodeInfo(const Request &aRequest, Response &aResponse) const;
-    void BaId(const Request &aRequest, Response &aResponse) const;
-    void ExtendedAddr(const Request &aRequest, Response &aResponse) const;
-    void State(const Request &aRequest, Response &aResponse) const;
-    void NetworkName(const Request &aRequest, Response &aResponse) const;
-    void LeaderData(const Request &aRequest, Response &aResponse) const;
-    void NumOfRoute(const Request &aRequest, Response &aResponse) const;
-    void Rloc16(const Request &aRequest, Response &aResponse) const;
-    void ExtendedPanId(const Request &aRequest, Response &aResponse) const;
-    void Rloc(const Request &aRequest, Response &aResponse) const;
-    void Dataset(DatasetType aDatasetType, const Request &aRequest, Response &aResponse) const;
-    void DatasetActive(const Request &aRequest, Response &aResponse) const;
-    void DatasetPending(const Request &aRequest, Response &aResponse) const;
-    void Diagnostic(const Request &aRequest, Response &aResponse) const;
+
+    /**
+     * This structure represents the handlers of a resource.
+     */
+    struct Route
+    {
+        Route(void)
+            : mHandlers()
+            , mRateLimited()
+            , mCallbackHandler(nullptr)
+        {
+        }
+
+        ResourceHandler         mHandlers[kNumHttpMethods];    ///< The handlers by HttpMethod, nullptr if absent.
+        bool                    mRateLimited[kNumHttpMethods]; ///< Whether the handlers are rate limited per client.
+        ResourceCallbackHandler mCallbackHandler;              ///< The callback handler, nullptr if absent.
+    };
+
+    void AddRoute(const char *aPath, HttpMethod aMethod, ResourceHandler aHandler, bool aRateLimited = false);
+    void MethodNotAllowedHandler(const Route &aRoute, Response &aResponse) const;
+
+    void Options(const Request &aRequest, Response &aResponse);
+    void Batch(const Request &aRequest, Response &aResponse);
+    void Diagnostic(const Request &aRequest, Response &aResponse);
     void HandleDiagnosticCallback(const Request &aRequest, Response &aResponse);
+    void Events(const Request &aRequest, Response &aResponse);
+    void GetTopologyNeighbors(const Request &aRequest, Response &aResponse);
+    void GetTopologyPath(const Request &aRequest, Response &aResponse);
+    void GetTopologyPartitions(const Request &aRequest, Response &aResponse);
+    void RespondTopologyError(otbrError aError, Response &aResponse) const;
+    void GetMetrics(const Request &aRequest, Response &aResponse);
 
-    void GetNodeInfo(Response &aResponse) const;
-    void DeleteNodeInfo(Response &aResponse) const;
-    void GetDataBaId(Response &aResponse) const;
-    void GetDataExtendedAddr(Response &aResponse) const;
-    void GetDataState(Response &aResponse) const;
-    void SetDataState(const Request &aRequest, Response &aResponse) const;
-    void GetDataNetworkName(Response &aResponse) const;
-    void GetDataLeaderData(Response &aResponse) const;
-    void GetDataNumOfRoute(Response &aResponse) const;
-    void GetDataRloc16(Response &aResponse) const;
-    void GetDataExtendedPanId(Response &aResponse) const;
-    void GetDataRloc(Response &aResponse) const;
-    void GetDataset(DatasetType aDatasetType, const Request &aRequest, Response &aResponse) const;
+    void GetNodeInfo(const Request &aRequest, Response &aResponse);
+    void DeleteNodeInfo(const Request &aRequest, Response &aResponse);
+    void GetDataBaId(const Request &aRequest, Response &aResponse);
+    void GetDataExtendedAddr(const Request &aRequest, Response &aResponse);
+    void GetDataState(const Request &aRequest, Response &aResponse);
+    void SetDataState(const Request &aRequest, Response &aResponse);
+    void GetDataNetworkName(const Request &aRequest, Response &aResponse);
+    void GetDataLeaderData(const Request &aRequest, Response &aResponse);
+    void GetDataNumOfRoute(const Request &aRequest, Response &aResponse);
+    void GetDataRloc16(const Request &aRequest, Response &aResponse);
+    void GetCounterHistory(const Request &aRequest, Response &aResponse);
+#if OTBR_ENABLE_CHANNEL_SAMPLING
+    void GetChannelOccupancy(const Request &aRequest, Response &aResponse);
+#endif
+    void GetDataExtendedPanId(const Request &aRequest, Response &aResponse);
+    void GetDataRloc(const Request &aRequest, Response &aResponse);
+    void GetDataset(DatasetType aDatasetType, const Request &aRequest, Response &aResponse);
     void SetDataset(DatasetType aDatasetType, const Request &aRequest, Response &aResponse) const;
+    void GetDatasetActive(const Request &aRequest, Response &aResponse);
+    void SetDatasetActive(const Request &aRequest, Response &aResponse);
+    void GetDatasetPending(const Request &aRequest, Response &aResponse);
+    void SetDatasetPending(const Request &aRequest, Response &aResponse);
+    void StartScan(const Request &aRequest, Response &aResponse);
+
+    otbrError GenerateNodeInfo(std::string &aBody) const;
+    otbrError GenerateDataset(DatasetType aDatasetType, DatasetFormat aFormat, std::string &aBody) const;
+    otbrError RefreshCachedBody(CachedBody &aCache, const BodyGenerator &aGenerator);
+    void      RespondCachedBody(const CachedBody &aCache, const Request &aRequest, Response &aResponse) const;
 
-    void DeleteOutDatedDiagnostic(void);
-    void UpdateDiag(std::string aKey, std::vector<otNetworkDiagTlv> &aDiag);
+    otbrError          ParseDiagnosticQuery(const Request &aRequest, DiagQuery &aQuery) const;
+    otbrError          SendDiagnosticQuery(const DiagQuery &aQuery);
+    void               RespondDiagnosticQuery(const DiagQuery &aQuery, Response &aResponse) const;
+    otbrError          CollectDiagnostic(void);
+    void               UpdateDiagnosticCollection(void);
+    void               FinishDiagnosticCollection(void);
+    void               RespondDiagnostic(const DiagQuery &aQuery, Response &aResponse);
+    void               RespondDiagnosticNdjson(Response &aResponse);
+    void               StartDiagnosticStream(Response &aResponse);
+    const std::string &GetDiagnosticSnapshot(void);
+    void               DeleteOutDatedDiagnostic(void);
+    void               UpdateDiag(const std::string &aKey, const std::vector<otNetworkDiagTlv> &aDiag);
 
     static void DiagnosticResponseHandler(otError              aError,
                                           otMessage           *aMessage,
                                           const otMessageInfo *aMessageInfo,
                                           void                *aContext);
     void        DiagnosticResponseHandler(otError aError, const otMessage *aMessage, const otMessageInfo *aMessageInfo);
+    void        HandleThreadStateChanged(const otbr::Ncp::ThreadStateSnapshot &aSnapshot);
+    void        AddScanResultHandlers(void);
+    void        HandleScanComplete(otError aError);
 
     otInstance *mInstance;
     RcpHost    *mHost;
+    TaskRunner &mTaskRunner;
+
+    Router<Route> mRouter;
+
+    // Incremented whenever the Thread state changes, which invalidates the cached bodies
+    uint32_t   mStateVersion;
+    CachedBody mNodeInfoBody;
+    CachedBody mDatasetBodies[3][2]; // Indexed by DatasetFormat and DatasetType
+
+    DiagStore mDiagStore;
+
+    // The mesh topology merged from the Route and Child Table TLVs of mDiagStore
+    TopologyGraph mTopologyGraph;
+
+    // Incremented whenever an entry of mDiagStore is added, updated or removed
+    uint32_t mDiagVersion;
+
+    // Json array of all entries of mDiagStore, valid when mDiagSnapshotVersion equals mDiagVersion
+    std::string mDiagSnapshot;
+    uint32_t    mDiagSnapshotVersion;
+
+    // The collection shared by all requests started while it's in flight
+    bool                     mDiagCollecting;
+    steady_clock::time_point mDiagCollectStartTime;
+    TaskRunner::TaskId       mDiagCollectTimer;
+
+    // Streams the diagnostics of the nodes in chunked NDJSON as they respond to the collection in flight
+    EventStream mDiagStream;
+
+    // When the last collection completed, only valid when mDiagCollected is true
+    bool                     mDiagCollected;
+    steady_clock::time_point mDiagCollectedTime;
+
+    // Whether a scan started by StartScan is in progress, and the error of a scan which failed to start
+    bool    mScanning;
+    bool    mScanStarting;
+    otError mScanStartError;
+
+    EventStream mEventStream;
 
-    std::unordered_map<std::string, ResourceHandler>         mResourceMap;
-    std::unordered_map<std::string, ResourceCallbackHandler> mResourceCallbackMap;
+    // Buckets of the rate limited requests per client and handler
+    RateLimiter mRateLimiter;
 
-    std::unordered_map<std::string, DiagInfo> mDiagSet;
+    // The number of requests handled, updated in place and exposed by GetMetrics
+    Metrics::Counter *mRequestsMetric;
+    Metrics::Counter *mRateLimitedRequestsMetric;
 };
 
 } // namespace rest
@@ -29,13 +29,42 @@
 #include "rest/response.hpp"
 
 #include <stdio.h>
+#include <string.h>
+
+#if OTBR_ENABLE_REST_COMPRESSION
+#include <zlib.h>
+#endif
+
+#include "common/code_utils.hpp"
 
 #define OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_ORIGIN "*"
 #define OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_HEADERS                                                              \
     "Access-Control-Allow-Headers, Origin,Accept, X-Requested-With, Content-Type, Access-Control-Request-Method, " \
-    "Access-Control-Request-Headers"
+    "Access-Control-Request-Headers, If-None-Match"
 #define OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_METHOD "DELETE, GET, OPTIONS, PUT"
 #define OT_REST_RESPONSE_CONNECTION "close"
+#define OT_REST_RESPONSE_CONNECTION_KEEP_ALIVE "keep-alive"
+
+#if OTBR_ENABLE_REST_COMPRESSION
+/**
+ * @def OTBR_CONFIG_REST_COMPRESSION_MIN_SIZE
+ *
+ * Specifies the minimum size in bytes of a response body to be compressed. Smaller bodies aren't worth the time, and
+ * their compressed form might be larger.
+ */
+#ifndef OTBR_CONFIG_REST_COMPRESSION_MIN_SIZE
+#define OTBR_CONFIG_REST_COMPRESSION_MIN_SIZE 1024
+#endif
+
+/**
+ * @def OTBR_CONFIG_REST_COMPRESSION_LEVEL
+ *
+ * Specifies the zlib compression level of response bodies, from 1 (fastest) to 9 (smallest).
+ */
+#ifndef OTBR_CONFIG_REST_COMPRESSION_LEVEL
+#define OTBR_CONFIG_REST_COMPRESSION_LEVEL 6
+#endif
+#endif // OTBR_ENABLE_REST_COMPRESSION
 
 namespace otbr {
 namespace rest {
@@ -43,6 +72,7 @@ namespace rest {
 Response::Response(void)
     : mCallback(false)
     , mComplete(false)
+    , mEventStream(nullptr)
 {
     // HTTP protocol
     mProtocol = "HTTP/1.1";
@@ -80,11 +110,43 @@ void Response::SetResponsCode(std::string &aCode)
     mCode = aCode;
 }
 
+const std::string &Response::GetResponseCode(void) const
+{
+    return mCode;
+}
+
 void Response::SetContentType(const std::string &aContentType)
 {
     mHeaders[OT_REST_CONTENT_TYPE_HEADER] = aContentType;
 }
 
+std::string Response::GetContentType(void) const
+{
+    auto it = mHeaders.find(OT_REST_CONTENT_TYPE_HEADER);
+
+    return it != mHeaders.end() ? it->second : std::string();
+}
+
+void Response::SetHeader(const std::string &aName, const std::string &aValue)
+{
+    mHeaders[aName] = aValue;
+}
+
+void Response::SetKeepAlive(bool aKeepAlive)
+{
+    mHeaders["Connection"] = aKeepAlive ? OT_REST_RESPONSE_CONNECTION_KEEP_ALIVE : OT_REST_RESPONSE_CONNECTION;
+}
+
+void Response::SetEventStream(EventStream &aStream)
+{
+    mEventStream = &aStream;
+}
+
+bool Response::IsEventStream(void) const
+{
+    return mEventStream != nullptr;
+}
+
 void Response::SetCallback(void)
 {
     mCallback = true;
@@ -92,10 +154,10 @@ void Response::SetCallback(void)
 
 void Response::SetBody(std::string &aBody)
 {
-    mBody = aBody;
+    mBody = std::move(aBody);
 }
 
-std::string Response::GetBody(void) const
+const std::string &Response::GetBody(void) const
 {
     return mBody;
 }
@@ -107,18 +169,175 @@ bool Response::NeedCallback(void)
 
 std::string Response::Serialize(void) const
 {
-    std::string spacer = "\r\n";
-    std::string ret(mProtocol + " " + mCode);
+    std::string ret;
+
+    SerializeHeaders(ret);
+    ret += mBody;
+
+    return ret;
+}
+
+void Response::SerializeHeaders(std::string &aBuffer) const
+{
+    static const char kSpacer[] = "\r\n";
+
+    aBuffer.clear();
+    aBuffer.append(mProtocol).append(" ").append(mCode);
 
     for (const auto &header : mHeaders)
     {
-        ret += (spacer + header.first + ": " + header.second);
+        aBuffer.append(kSpacer).append(header.first).append(": ").append(header.second);
     }
-    ret += spacer + "Content-Length: " + std::to_string(mBody.size());
-    ret += (spacer + spacer + mBody);
+    // The length of an event stream is unknown, it ends when the connection is closed or by its own framing.
+    if (mEventStream == nullptr)
+    {
+        aBuffer.append(kSpacer).append("Content-Length: ").append(std::to_string(mBody.size()));
+    }
+    aBuffer.append(kSpacer).append(kSpacer);
+}
 
-    return ret;
+#if OTBR_ENABLE_REST_COMPRESSION
+// The quality value of a content coding in thousandths, 1000 is the most preferred and 0 is "not acceptable".
+static constexpr uint16_t kMaxQuality = 1000;
+
+// Sets the quality value of a parameter of a content coding which is a valid weight, e.g. "q=0.5".
+static void ParseQuality(const StringView &aParameter, uint16_t &aQuality)
+{
+    uint16_t quality = 0;
+    uint16_t scale   = kMaxQuality;
+
+    VerifyOrExit(aParameter.Size() >= 3 && (aParameter[0] == 'q' || aParameter[0] == 'Q') && aParameter[1] == '=');
+    VerifyOrExit(aParameter[2] == '0' || aParameter[2] == '1');
+    quality = (aParameter[2] == '1') ? kMaxQuality : 0;
+
+    if (aParameter.Size() > 3)
+    {
+        VerifyOrExit(aParameter[3] == '.' && aParameter.Size() <= 7);
+        for (char c : aParameter.Substr(4))
+        {
+            VerifyOrExit(c >= '0' && c <= '9');
+            scale /= 10;
+            quality += static_cast<uint16_t>(c - '0') * scale;
+        }
+    }
+
+    VerifyOrExit(quality <= kMaxQuality);
+    aQuality = quality;
+
+exit:
+    return;
+}
+
+// Returns the quality value an Accept-Encoding header gives to a content coding.
+//
+// A coding absent from the header gets the value of "*" if present. Otherwise it's not acceptable, except "identity"
+// which is acceptable but less preferred than any listed coding.
+static uint16_t GetCodingQuality(const StringView &aAcceptEncoding, const StringView &aCoding)
+{
+    bool     found           = false;
+    bool     foundWildcard   = false;
+    uint16_t quality         = aCoding.EqualsIgnoreCase("identity") ? 1 : 0;
+    uint16_t wildcardQuality = 0;
+    size_t   start           = 0;
+
+    while (!found && start < aAcceptEncoding.Size())
+    {
+        size_t     end         = aAcceptEncoding.Find(',', start);
+        StringView item        = aAcceptEncoding.Substr(start, end == std::string::npos ? end : end - start);
+        size_t     semicolon   = item.Find(';');
+        StringView coding      = item.Substr(0, semicolon).TrimSpaces();
+        uint16_t   itemQuality = kMaxQuality;
+
+        // Parameters other than the weight, and invalid weights, are ignored.
+        while (semicolon != std::string::npos)
+        {
+            size_t     next      = item.Find(';', semicolon + 1);
+            StringView parameter = item.Substr(semicolon + 1, next == std::string::npos ? next : next - semicolon - 1);
+
+            ParseQuality(parameter.TrimSpaces(), itemQuality);
+            semicolon = next;
+        }
+
+        if (coding.EqualsIgnoreCase(aCoding))
+        {
+            found   = true;
+            quality = itemQuality;
+        }
+        else if (coding == "*")
+        {
+            foundWildcard   = true;
+            wildcardQuality = itemQuality;
+        }
+
+        start = (end == std::string::npos) ? aAcceptEncoding.Size() : end + 1;
+    }
+
+    if (!found && foundWildcard)
+    {
+        quality = wildcardQuality;
+    }
+
+    return quality;
+}
+
+void Response::Compress(const StringView &aAcceptEncoding)
+{
+    uint16_t    gzipQuality;
+    uint16_t    deflateQuality;
+    bool        gzip;
+    z_stream    stream;
+    std::string compressed;
+    int         ret;
+
+    VerifyOrExit(mEventStream == nullptr && mBody.size() >= OTBR_CONFIG_REST_COMPRESSION_MIN_SIZE);
+    VerifyOrExit(mHeaders.find(OT_REST_CONTENT_ENCODING_HEADER) == mHeaders.end());
+
+    // The body sent depends on Accept-Encoding, caches must not serve it to clients accepting other codings.
+    mHeaders["Vary"] = OT_REST_ACCEPT_ENCODING_HEADER;
+
+    // The coding the client prefers the most is used, gzip and then deflate when they're as good as the others.
+    gzipQuality    = GetCodingQuality(aAcceptEncoding, "gzip");
+    deflateQuality = GetCodingQuality(aAcceptEncoding, "deflate");
+    gzip           = gzipQuality >= deflateQuality;
+    VerifyOrExit((gzip ? gzipQuality : deflateQuality) > 0);
+    VerifyOrExit((gzip ? gzipQuality : deflateQuality) >= GetCodingQuality(aAcceptEncoding, "identity"));
+
+    // The whole body is at hand, so it's deflated in a single call into a buffer of the worst case size. The
+    // connection then writes the headers and this buffer with one sendmsg() as it does for any body.
+    memset(&stream, 0, sizeof(stream));
+    // Adding 16 to the window bits selects the gzip wrapper instead of the zlib one, which is the "deflate" coding.
+    VerifyOrExit(deflateInit2(&stream, OTBR_CONFIG_REST_COMPRESSION_LEVEL, Z_DEFLATED,
+                              gzip ? MAX_WBITS + 16 : MAX_WBITS, MAX_MEM_LEVEL - 1, Z_DEFAULT_STRATEGY) == Z_OK);
+
+    compressed.resize(deflateBound(&stream, static_cast<uLong>(mBody.size())));
+    stream.next_in   = reinterpret_cast<Bytef *>(&mBody[0]);
+    stream.avail_in  = static_cast<uInt>(mBody.size());
+    stream.next_out  = reinterpret_cast<Bytef *>(&compressed[0]);
+    stream.avail_out = static_cast<uInt>(compressed.size());
+    ret              = deflate(&stream, Z_FINISH);
+    compressed.resize(stream.total_out);
+    deflateEnd(&stream);
+
+    VerifyOrExit(ret == Z_STREAM_END && compressed.size() < mBody.size());
+
+    mBody.swap(compressed);
+    mHeaders[OT_REST_CONTENT_ENCODING_HEADER] = gzip ? "gzip" : "deflate";
+
+    {
+        // The encoded body is not byte-identical to the one the strong ETag was computed from. A weak ETag still
+        // validates it, as If-None-Match uses the weak comparison.
+        auto etag = mHeaders.find(OT_REST_ETAG_HEADER);
+
+        if (etag != mHeaders.end() && etag->second.compare(0, 2, "W/") != 0)
+        {
+            etag->second.insert(0, "W/");
+        }
+    }
+
+exit:
+    return;
 }
+#endif // OTBR_ENABLE_REST_COMPRESSION
 
 } // namespace rest
 } // namespace otbr
@@ -40,6 +40,8 @@
 #include <map>
 #include <string>
 
+#include "common/string_view.hpp"
+#include "rest/event_stream.hpp"
 #include "rest/types.hpp"
 
 using std::chrono::duration_cast;
@@ -65,6 +67,8 @@ public:
     /**
      * This method set the response body.
      *
+     * The content of @p aBody is moved into the response without copying.
+     *
      * @param[in] aBody  A string to be set as response body.
      */
     void SetBody(std::string &aBody);
@@ -72,9 +76,9 @@ public:
     /**
      * This method return a string contains the body field of this response.
      *
-     * @returns A string containing the body field.
+     * @returns A reference to the string containing the body field.
      */
-    std::string GetBody(void) const;
+    const std::string &GetBody(void) const;
 
     /**
      * This method set the response code.
@@ -83,6 +87,13 @@ public:
      */
     void SetResponsCode(std::string &aCode);
 
+    /**
+     * This method returns the response code.
+     *
+     * @returns A reference to the string representing the response code.
+     */
+    const std::string &GetResponseCode(void) const;
+
     /**
      * This method sets the content type.
      *
@@ -90,6 +101,53 @@ public:
      */
     void SetContentType(const std::string &aContentType);
 
+    /**
+     * This method returns the content type.
+     *
+     * @returns The content type of the response.
+     */
+    std::string GetContentType(void) const;
+
+    /**
+     * This method sets a header of the response, replacing any existing value.
+     *
+     * @param[in] aName   The name of the header.
+     * @param[in] aValue  The value of the header.
+     */
+    void SetHeader(const std::string &aName, const std::string &aValue);
+
+    /**
+     * This method sets whether the connection is kept alive after this response.
+     *
+     * @param[in] aKeepAlive  Whether the connection is kept alive.
+     */
+    void SetKeepAlive(bool aKeepAlive);
+
+    /**
+     * This method labels the response as the start of an event stream.
+     *
+     * The response is sent without a Content-Length, and the connection keeps streaming the events of @p aStream
+     * after the body until the stream ends.
+     *
+     * @param[in] aStream  The stream of the events.
+     */
+    void SetEventStream(EventStream &aStream);
+
+    /**
+     * This method indicates whether the response starts an event stream.
+     *
+     * @retval TRUE   The response starts an event stream.
+     * @retval FALSE  The response doesn't start an event stream.
+     */
+    bool IsEventStream(void) const;
+
+    /**
+     * This method returns the stream the response starts.
+     *
+     * @returns A pointer to the stream, or nullptr if the response doesn't start an event stream.
+     */
+    EventStream *GetEventStream(void) const { return mEventStream; }
+
     /**
      * This method labels the response as need callback.
      */
@@ -136,6 +194,29 @@ public:
      */
     std::string Serialize(void) const;
 
+    /**
+     * This method serializes the status line and headers of a response, which are followed by the body.
+     *
+     * @param[out] aBuffer  A string to hold the status line and headers. It's cleared first and its capacity is kept,
+     *                      so a buffer could be reused for many responses.
+     */
+    void SerializeHeaders(std::string &aBuffer) const;
+
+#if OTBR_ENABLE_REST_COMPRESSION
+    /**
+     * This method compresses the body with a content coding the client accepts.
+     *
+     * The coding with the highest quality value in @p aAcceptEncoding is used, `*` stands for the codings which
+     * aren't listed and a zero quality value refuses a coding. gzip is preferred over deflate, and both over
+     * identity, when their quality values are the same. The body is kept as it is if it's shorter than
+     * `OTBR_CONFIG_REST_COMPRESSION_MIN_SIZE`, the response starts an event stream, or the compressed body isn't
+     * smaller. A strong ETag of the response is turned into a weak one, which still matches If-None-Match.
+     *
+     * @param[in] aAcceptEncoding  The value of the Accept-Encoding header of the request.
+     */
+    void Compress(const StringView &aAcceptEncoding);
+#endif
+
 private:
     bool                               mCallback;
     std::map<std::string, std::string> mHeaders;
@@ -143,6 +224,7 @@ private:
     std::string                        mProtocol;
     std::string                        mBody;
     bool                               mComplete;
+    EventStream                       *mEventStream;
     steady_clock::time_point           mStartTime;
 };
 
@@ -34,22 +34,51 @@
 #include <cerrno>
 
 #include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
 
+#ifdef HAVE_LIBSYSTEMD
+#include <systemd/sd-daemon.h>
+#endif
+
+#include "common/time.hpp"
 #include "utils/socket_utils.hpp"
 
 using std::chrono::duration_cast;
 using std::chrono::microseconds;
-using std::chrono::steady_clock;
 
 namespace otbr {
 namespace rest {
 
-// Maximum number of connection a server support at the same time.
-static const uint32_t kMaxServeNum = 500;
+// Maximum number of released connections kept for reuse.
+static const size_t kMaxFreeConnections = 16;
+
+// Maximum number of read buffers kept for reuse by connections.
+static const size_t kMaxPooledReadBuffers = 16;
 
-RestWebServer::RestWebServer(RcpHost &aHost, const std::string &aRestListenAddress, int aRestListenPort)
-    : mResource(Resource(&aHost))
+// Capacity of the read buffers, which fits most requests.
+static const size_t kReadBufferSize = 4096;
+
+RestWebServer::RestWebServer(RcpHost           &aHost,
+                             const std::string &aRestListenAddress,
+                             int                aRestListenPort,
+                             uint32_t           aMaxConnections,
+                             const std::string &aUnixSocketPath)
+    : MainloopProcessor(kPriorityManagement)
+    , mTaskRunner(TaskRunner::DelayedTaskQueue::kTimerWheel, kPriorityManagement)
+    , mResource(&aHost, mTaskRunner)
+    , mResourceInitialized(false)
     , mListenFd(-1)
+    , mUnixSocketPath(aUnixSocketPath)
+    , mUnixListenFd(-1)
+    , mReadBufferPool(kMaxPooledReadBuffers, kReadBufferSize)
+    , mMaxConnections(aMaxConnections > 0 ? aMaxConnections : 1)
+    , mMaxConnectionsPerClient((mMaxConnections + kClientShareOfConnections - 1) / kClientShareOfConnections)
+    , mConnectionsMetric(&Metrics::Registry::Get().AddGauge("otbr_rest_connections", "The open REST connections."))
+    , mAcceptedConnectionsMetric(
+          &Metrics::Registry::Get().AddCounter("otbr_rest_accepted_connections", "The accepted REST connections."))
 {
     mAddress.sin6_family = AF_INET6;
     mAddress.sin6_addr   = in6addr_any;
@@ -61,27 +90,58 @@ RestWebServer::RestWebServer(RcpHost &aHost, const std::string &aRestListenAddre
             otbrLogWarning("Failed to parse REST listen address %s, listening on any address.",
                            aRestListenAddress.c_str());
     }
+
+    MemoryUsageRegistry::Get().Add(this, "rest_diagnostics", [this]() { return mResource.GetDiagMemoryUsage(); });
+    MemoryUsageRegistry::Get().Add(this, "rest_connections", [this]() { return GetConnectionMemoryUsage(); });
 }
 
 RestWebServer::~RestWebServer(void)
 {
+    MemoryUsageRegistry::Get().Remove(this);
+
     if (mListenFd != -1)
     {
         close(mListenFd);
     }
+
+    if (mUnixListenFd != -1)
+    {
+        close(mUnixListenFd);
+        unlink(mUnixSocketPath.c_str());
+    }
 }
 
 void RestWebServer::Init(void)
 {
-    mResource.Init();
-    InitializeListenFd();
+    if (!AdoptActivatedListenFd())
+    {
+        InitializeListenFd();
+    }
+
+    if (!mUnixSocketPath.empty())
+    {
+        InitializeUnixListenFd();
+    }
 }
 
 void RestWebServer::Update(MainloopContext &aMainloop)
 {
-    aMainloop.AddFdToReadSet(mListenFd);
+    // Reap the completed connections right away to free their slots.
+    if (!mCompletedConnectionFds.empty())
+    {
+        aMainloop.mTimeout = {0, 0};
+    }
+
+    // Stop accepting while all connections are in use, the pending clients wait in the listen backlog.
+    if (mConnectionSet.size() < mMaxConnections)
+    {
+        aMainloop.AddFdToReadSet(mListenFd);
 
-    return;
+        if (mUnixListenFd != -1)
+        {
+            aMainloop.AddFdToReadSet(mUnixListenFd);
+        }
+    }
 }
 
 void RestWebServer::Process(const MainloopContext &aMainloop)
@@ -91,34 +151,45 @@ void RestWebServer::Process(const MainloopContext &aMainloop)
 
 void RestWebServer::UpdateConnections(const fd_set &aReadFdSet)
 {
-    otbrError error   = OTBR_ERROR_NONE;
-    auto      eraseIt = mConnectionSet.begin();
+    otbrError error = OTBR_ERROR_NONE;
 
-    // Erase useless connections
-    for (eraseIt = mConnectionSet.begin(); eraseIt != mConnectionSet.end();)
+    // Erase the connections reported complete, the others aren't scanned.
+    for (int32_t fd : mCompletedConnectionFds)
     {
-        Connection *connection = eraseIt->second.get();
+        auto it = mConnectionSet.find(fd);
 
-        if (connection->IsComplete())
+        if (it == mConnectionSet.end() || !it->second->IsComplete())
         {
-            eraseIt = mConnectionSet.erase(eraseIt);
+            continue;
         }
-        else
+
+        if (mFreeConnections.size() < kMaxFreeConnections)
         {
-            eraseIt++;
+            it->second->Release();
+            mFreeConnections.push_back(std::move(it->second));
         }
+        mConnectionSet.erase(it);
     }
+    mCompletedConnectionFds.clear();
 
     // Create new connection if listenfd is set
-    if (FD_ISSET(mListenFd, &aReadFdSet) && mConnectionSet.size() < kMaxServeNum)
+    if (FD_ISSET(mListenFd, &aReadFdSet) && mConnectionSet.size() < mMaxConnections)
     {
         error = Accept(mListenFd);
     }
 
+    if (error == OTBR_ERROR_NONE && mUnixListenFd != -1 && FD_ISSET(mUnixListenFd, &aReadFdSet) &&
+        mConnectionSet.size() < mMaxConnections)
+    {
+        error = Accept(mUnixListenFd);
+    }
+
     if (error != OTBR_ERROR_NONE)
     {
         otbrLogWarning("Failed to accept new connection: %s", otbrErrorString(error));
     }
+
+    mConnectionsMetric->Set(static_cast<int64_t>(mConnectionSet.size()));
 }
 
 bool RestWebServer::ParseListenAddress(const std::string listenAddress, struct in6_addr *sin6_addr)
@@ -139,7 +210,72 @@ bool RestWebServer::ParseListenAddress(const std::string listenAddress, struct i
     return false;
 }
 
+bool RestWebServer::AdoptActivatedListenFd(void)
+{
+#ifdef HAVE_LIBSYSTEMD
+    int count = sd_listen_fds(/* unset_environment */ 1);
+
+    for (int fd = SD_LISTEN_FDS_START; fd < SD_LISTEN_FDS_START + count; fd++)
+    {
+        if (sd_is_socket(fd, AF_UNSPEC, SOCK_STREAM, /* listening */ 1) <= 0)
+        {
+            continue;
+        }
+
+        if (!SetFdNonblocking(fd) || fcntl(fd, F_SETFD, FD_CLOEXEC) == -1)
+        {
+            otbrLogWarning("Failed to configure the socket-activated listen fd %d: %s", fd, strerror(errno));
+            continue;
+        }
+
+        otbrLogInfo("Using the socket-activated listen fd %d", fd);
+        mListenFd = fd;
+        break;
+    }
+#endif
+
+    return mListenFd != -1;
+}
+
 void RestWebServer::InitializeListenFd(void)
+{
+    VerifyOrDie(OpenListenFd(mAddress, mListenFd) == OTBR_ERROR_NONE, "otbr rest server init error");
+}
+
+otbrError RestWebServer::SetListenAddress(const std::string &aRestListenAddress, int aRestListenPort)
+{
+    otbrError    error   = OTBR_ERROR_NONE;
+    sockaddr_in6 address = mAddress;
+    int32_t      listenFd;
+
+    address.sin6_addr = in6addr_any;
+    address.sin6_port = htons(aRestListenPort);
+    VerifyOrExit(aRestListenAddress.empty() || ParseListenAddress(aRestListenAddress, &address.sin6_addr),
+                 error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(address.sin6_port != mAddress.sin6_port ||
+                 memcmp(&address.sin6_addr, &mAddress.sin6_addr, sizeof(address.sin6_addr)) != 0);
+
+    // The socket is closed first as a wildcard address would conflict with a specific one on the same port.
+    close(mListenFd);
+    mListenFd = -1;
+
+    error = OpenListenFd(address, listenFd);
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to move REST server to port %d, keeping the previous address", aRestListenPort);
+        InitializeListenFd();
+        ExitNow();
+    }
+
+    mListenFd = listenFd;
+    mAddress  = address;
+    otbrLogNotice("REST server listening on port %d", aRestListenPort);
+
+exit:
+    return error;
+}
+
+otbrError RestWebServer::OpenListenFd(const sockaddr_in6 &aAddress, int32_t &aListenFd)
 {
     otbrError   error = OTBR_ERROR_NONE;
     std::string errorMessage;
@@ -148,19 +284,19 @@ void RestWebServer::InitializeListenFd(void)
     int32_t     yes = 1;
     int32_t     no  = 0;
 
-    mListenFd = SocketWithCloseExec(AF_INET6, SOCK_STREAM, 0, kSocketNonBlock);
-    VerifyOrExit(mListenFd != -1, err = errno, error = OTBR_ERROR_REST, errorMessage = "socket");
+    aListenFd = SocketWithCloseExec(AF_INET6, SOCK_STREAM, 0, kSocketNonBlock);
+    VerifyOrExit(aListenFd != -1, err = errno, error = OTBR_ERROR_REST, errorMessage = "socket");
 
-    ret = setsockopt(mListenFd, IPPROTO_IPV6, IPV6_V6ONLY, reinterpret_cast<char *>(&no), sizeof(no));
+    ret = setsockopt(aListenFd, IPPROTO_IPV6, IPV6_V6ONLY, reinterpret_cast<char *>(&no), sizeof(no));
     VerifyOrExit(ret == 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "sock opt v6only");
 
-    ret = setsockopt(mListenFd, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<char *>(&yes), sizeof(yes));
+    ret = setsockopt(aListenFd, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<char *>(&yes), sizeof(yes));
     VerifyOrExit(ret == 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "sock opt reuseaddr");
 
-    ret = bind(mListenFd, reinterpret_cast<struct sockaddr *>(&mAddress), sizeof(mAddress));
+    ret = bind(aListenFd, reinterpret_cast<const struct sockaddr *>(&aAddress), sizeof(aAddress));
     VerifyOrExit(ret == 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "bind");
 
-    ret = listen(mListenFd, 5);
+    ret = listen(aListenFd, 5);
     VerifyOrExit(ret >= 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "listen");
 
 exit:
@@ -168,28 +304,96 @@ exit:
     if (error != OTBR_ERROR_NONE)
     {
         otbrLogErr("InitializeListenFd error %s : %s", errorMessage.c_str(), strerror(err));
+
+        if (aListenFd != -1)
+        {
+            close(aListenFd);
+            aListenFd = -1;
+        }
     }
 
-    VerifyOrDie(error == OTBR_ERROR_NONE, "otbr rest server init error");
+    return error;
 }
 
-otbrError RestWebServer::Accept(int aListenFd)
+void RestWebServer::InitializeUnixListenFd(void)
 {
-    std::string errorMessage;
     otbrError   error = OTBR_ERROR_NONE;
-    int32_t     err;
-    int32_t     fd;
-    sockaddr_in tmp;
-    socklen_t   addrlen = sizeof(tmp);
+    std::string errorMessage;
+    int32_t     ret;
+    int32_t     err = errno;
+    sockaddr_un address;
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    VerifyOrExit(mUnixSocketPath.size() < sizeof(address.sun_path), err = ENAMETOOLONG, error = OTBR_ERROR_REST,
+                 errorMessage = "path");
+    memcpy(address.sun_path, mUnixSocketPath.c_str(), mUnixSocketPath.size());
+
+    mUnixListenFd = SocketWithCloseExec(AF_UNIX, SOCK_STREAM, 0, kSocketNonBlock);
+    VerifyOrExit(mUnixListenFd != -1, err = errno, error = OTBR_ERROR_REST, errorMessage = "unix socket");
+
+    // The socket file of a previous run is left behind if it didn't exit cleanly, and makes bind() fail.
+    unlink(mUnixSocketPath.c_str());
+
+    ret = bind(mUnixListenFd, reinterpret_cast<struct sockaddr *>(&address), sizeof(address));
+    VerifyOrExit(ret == 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "unix bind");
+
+    // Only processes of the same user or group may connect.
+    ret = chmod(mUnixSocketPath.c_str(), S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
+    VerifyOrExit(ret == 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "unix chmod");
+
+    ret = listen(mUnixListenFd, 5);
+    VerifyOrExit(ret >= 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "unix listen");
 
-    fd  = accept(aListenFd, reinterpret_cast<struct sockaddr *>(&mAddress), &addrlen);
+    otbrLogInfo("Listening on the UNIX domain socket %s", mUnixSocketPath.c_str());
+
+exit:
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogErr("InitializeUnixListenFd error %s : %s", errorMessage.c_str(), strerror(err));
+    }
+
+    VerifyOrDie(error == OTBR_ERROR_NONE, "otbr rest server init error");
+}
+
+otbrError RestWebServer::Accept(int aListenFd)
+{
+    std::string  errorMessage;
+    otbrError    error = OTBR_ERROR_NONE;
+    int32_t      err;
+    int32_t      fd;
+    sockaddr_in6 clientAddress;
+    socklen_t    addrlen = sizeof(clientAddress);
+
+    memset(&clientAddress, 0, sizeof(clientAddress));
+    fd  = accept(aListenFd, reinterpret_cast<struct sockaddr *>(&clientAddress), &addrlen);
     err = errno;
 
     VerifyOrExit(fd >= 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "accept");
 
+    if (aListenFd == mUnixListenFd)
+    {
+        // Local clients have no IPv6 address, they are trusted and not limited to a share of the connections.
+        clientAddress.sin6_addr = in6addr_any;
+    }
+    // Keep a single client from taking all connections, the connection is closed without a response.
+    else if (GetClientConnectionCount(clientAddress.sin6_addr) >= mMaxConnectionsPerClient)
+    {
+        otbrLogInfo("Too many connections from the same client, closing the new one");
+        close(fd);
+        ExitNow();
+    }
+
     VerifyOrExit(SetFdNonblocking(fd), err = errno, error = OTBR_ERROR_REST; errorMessage = "set nonblock");
 
-    CreateNewConnection(fd);
+    if (!mResourceInitialized)
+    {
+        mResource.Init();
+        mResourceInitialized = true;
+    }
+
+    CreateNewConnection(fd, clientAddress.sin6_addr);
 
 exit:
     if (error != OTBR_ERROR_NONE)
@@ -205,15 +409,53 @@ exit:
     return error;
 }
 
-void RestWebServer::CreateNewConnection(int &aFd)
+MemoryUsage RestWebServer::GetConnectionMemoryUsage(void) const
 {
-    auto it =
-        mConnectionSet.emplace(aFd, std::unique_ptr<Connection>(new Connection(steady_clock::now(), &mResource, aFd)));
+    MemoryUsage usage;
+
+    // The released connections kept for reuse are counted too, only the active ones hold a read buffer.
+    usage.mEntries = static_cast<uint32_t>(mConnectionSet.size() + mFreeConnections.size());
+    usage.mBytes   = usage.mEntries * sizeof(Connection) + mConnectionSet.size() * kReadBufferSize +
+                   EstimateHeapBytes(mFreeConnections);
+
+    return usage;
+}
+
+uint32_t RestWebServer::GetClientConnectionCount(const in6_addr &aClientAddress) const
+{
+    uint32_t count = 0;
+
+    for (const auto &entry : mConnectionSet)
+    {
+        if (memcmp(&entry.second->GetClientAddress(), &aClientAddress, sizeof(aClientAddress)) == 0)
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+void RestWebServer::CreateNewConnection(int32_t &aFd, const in6_addr &aClientAddress)
+{
+    auto it = mConnectionSet.emplace(aFd, nullptr);
 
     if (it.second == true)
     {
-        Connection *connection = it.first->second.get();
-        connection->Init();
+        // Reuse a released connection along with its buffers if any.
+        if (!mFreeConnections.empty())
+        {
+            it.first->second = std::move(mFreeConnections.back());
+            mFreeConnections.pop_back();
+        }
+        else
+        {
+            it.first->second = std::unique_ptr<Connection>(new Connection(
+                &mResource, mReadBufferPool, mTaskRunner, [this](int aFd) { mCompletedConnectionFds.push_back(aFd); }));
+        }
+
+        it.first->second->Init(CoarseClock::Now(), aFd, aClientAddress);
+        mAcceptedConnectionsMetric->Increment();
     }
     else
     {
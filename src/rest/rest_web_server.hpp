@@ -40,7 +40,14 @@
 #include <netinet/ip.h>
 #include <sys/socket.h>
 
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
 #include "common/mainloop.hpp"
+#include "common/memory_usage.hpp"
+#include "common/metrics.hpp"
+#include "common/task_runner.hpp"
 #include "rest/connection.hpp"
 
 using otbr::Ncp::RcpHost;
@@ -58,9 +65,17 @@ public:
     /**
      * The constructor to initialize a REST server.
      *
-     * @param[in] aHost  A reference to the Thread controller.
+     * @param[in] aHost               A reference to the Thread controller.
+     * @param[in] aRestListenAddress  The address to listen on, any address if empty.
+     * @param[in] aRestListenPort     The port to listen on.
+     * @param[in] aMaxConnections     The maximum number of connections served at the same time.
+     * @param[in] aUnixSocketPath     The path of a UNIX domain socket to listen on as well, none if empty.
      */
-    RestWebServer(RcpHost &aHost, const std::string &aRestListenAddress, int aRestListenPort);
+    RestWebServer(RcpHost           &aHost,
+                  const std::string &aRestListenAddress,
+                  int                aRestListenPort,
+                  uint32_t           aMaxConnections,
+                  const std::string &aUnixSocketPath);
 
     /**
      * The destructor destroys the server instance.
@@ -69,28 +84,75 @@ public:
 
     /**
      * This method initializes the REST server.
+     *
+     * The server listens on the socket passed by systemd socket activation if there is one, and otherwise binds its
+     * own. The resources are only initialized when the first client connects. Local clients may connect to the
+     * UNIX domain socket, if any, in addition, and are served the same way.
      */
     void Init(void);
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    /**
+     * This method moves the REST server to another listen address, like on a configuration reload.
+     *
+     * The open connections are kept. The server keeps listening on the previous address if the new one can't be
+     * bound.
+     *
+     * @param[in] aRestListenAddress  The address to listen on, any address if empty.
+     * @param[in] aRestListenPort     The port to listen on.
+     *
+     * @retval OTBR_ERROR_NONE          Listening on the address.
+     * @retval OTBR_ERROR_INVALID_ARGS  The address is not valid.
+     * @retval OTBR_ERROR_REST          Failed to listen on the address.
+     */
+    otbrError SetListenAddress(const std::string &aRestListenAddress, int aRestListenPort);
+
+    const char *GetName(void) const override { return "RestWebServer"; }
+    void        Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
 
 private:
-    void      UpdateConnections(const fd_set &aReadFdSet);
-    void      CreateNewConnection(int32_t &aFd);
-    otbrError Accept(int32_t aListenFd);
-    bool      ParseListenAddress(const std::string listenAddress, struct in6_addr *sin6_addr);
-    void      InitializeListenFd(void);
-    bool      SetFdNonblocking(int32_t fd);
+    // A client may use up to this share (1/N) of the connections
+    static constexpr uint32_t kClientShareOfConnections = 4;
+
+    void        UpdateConnections(const fd_set &aReadFdSet);
+    void        CreateNewConnection(int32_t &aFd, const in6_addr &aClientAddress);
+    otbrError   Accept(int32_t aListenFd);
+    uint32_t    GetClientConnectionCount(const in6_addr &aClientAddress) const;
+    MemoryUsage GetConnectionMemoryUsage(void) const;
+    bool        ParseListenAddress(const std::string listenAddress, struct in6_addr *sin6_addr);
+    void        InitializeListenFd(void);
+    otbrError   OpenListenFd(const sockaddr_in6 &aAddress, int32_t &aListenFd);
+    void        InitializeUnixListenFd(void);
+    bool        AdoptActivatedListenFd(void);
+    bool        SetFdNonblocking(int32_t fd);
 
+    // Timers of the resource handler and the connections, declared before them to outlive them
+    TaskRunner mTaskRunner;
     // Resource handler
     Resource mResource;
+    // Whether the resource handler is initialized, which is deferred to the first connection
+    bool mResourceInitialized;
     // Struct for server configuration
     sockaddr_in6 mAddress;
     // File descriptor for listening
     int32_t mListenFd;
+    // Path of and file descriptor for listening on the UNIX domain socket
+    std::string mUnixSocketPath;
+    int32_t     mUnixListenFd;
+    // Pool of the read buffers of connections
+    ReadBufferPool mReadBufferPool;
+    // Maximum number of connections served at the same time, in total and from the same client
+    uint32_t mMaxConnections;
+    uint32_t mMaxConnectionsPerClient;
     // Connection List
     std::unordered_map<int32_t, std::unique_ptr<Connection>> mConnectionSet;
+    // Released connections kept for reuse
+    std::vector<std::unique_ptr<Connection>> mFreeConnections;
+    // Connections completed since the last reap, by file descriptor
+    std::vector<int32_t> mCompletedConnectionFds;
+    // Metrics of the connections
+    Metrics::Gauge   *mConnectionsMetric;
+    Metrics::Counter *mAcceptedConnectionsMetric;
 };
 
 } // namespace rest
@@ -0,0 +1,191 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the router definition for RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_ROUTER_HPP_
+#define OTBR_REST_ROUTER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <string>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/string_view.hpp"
+#include "rest/request.hpp"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class implements a router which maps the path of a request to a value.
+ *
+ * The routes are kept in a trie of path segments, so finding a route compares the segments of the path in place
+ * without hashing or copying it. A segment written as `{name}` matches any segment, and the matched segment is
+ * set as path parameter `name` of the request. Literal segments take precedence over parameters.
+ *
+ * @tparam Value  The type of the values, which must be default constructible.
+ */
+template <typename Value> class Router
+{
+public:
+    /**
+     * This method adds a route.
+     *
+     * @param[in] aPath  The path of the route, such as "/node/{field}".
+     *
+     * @returns A reference to the value of the route, which is default constructed when the route is new.
+     */
+    Value &Add(const char *aPath)
+    {
+        Node      *node = &mRoot;
+        StringView path(aPath);
+        StringView segment;
+
+        while (NextSegment(path, segment))
+        {
+            Node *matched = nullptr;
+
+            for (Node &child : node->mChildren)
+            {
+                if (StringView(child.mSegment) == segment)
+                {
+                    matched = &child;
+                    break;
+                }
+            }
+
+            if (matched == nullptr)
+            {
+                node->mChildren.emplace_back();
+                matched               = &node->mChildren.back();
+                matched->mSegment     = segment.ToString();
+                matched->mIsParameter = segment.Size() >= 2 && segment[0] == '{' && segment[segment.Size() - 1] == '}';
+            }
+
+            node = matched;
+        }
+
+        node->mHasValue = true;
+
+        return node->mValue;
+    }
+
+    /**
+     * This method finds the route of a path.
+     *
+     * @param[in]     aPath     The path, without the query and the trailing slashes.
+     * @param[in,out] aRequest  The request whose path parameters are set by the route found.
+     *
+     * @returns A pointer to the value of the route, or nullptr if no route matches @p aPath.
+     */
+    const Value *Find(const StringView &aPath, Request &aRequest) const
+    {
+        const Node *node = Match(mRoot, aPath, aRequest);
+
+        return node != nullptr ? &node->mValue : nullptr;
+    }
+
+private:
+    struct Node
+    {
+        Node(void)
+            : mIsParameter(false)
+            , mHasValue(false)
+            , mValue()
+        {
+        }
+
+        std::string       mSegment;
+        bool              mIsParameter;
+        std::vector<Node> mChildren;
+        bool              mHasValue;
+        Value             mValue;
+    };
+
+    // Moves the first segment of aPath to aSegment, returns false if there are no more segments.
+    static bool NextSegment(StringView &aPath, StringView &aSegment)
+    {
+        size_t start = 0;
+        size_t end;
+
+        while (start < aPath.Size() && aPath[start] == '/')
+        {
+            start++;
+        }
+
+        end      = aPath.Find('/', start);
+        end      = (end == std::string::npos) ? aPath.Size() : end;
+        aSegment = aPath.Substr(start, end - start);
+        aPath    = aPath.Substr(end);
+
+        return !aSegment.IsEmpty();
+    }
+
+    static const Node *Match(const Node &aNode, StringView aPath, Request &aRequest)
+    {
+        const Node *matched = nullptr;
+        StringView  segment;
+
+        if (!NextSegment(aPath, segment))
+        {
+            ExitNow(matched = aNode.mHasValue ? &aNode : nullptr);
+        }
+
+        for (const Node &child : aNode.mChildren)
+        {
+            if (!child.mIsParameter && StringView(child.mSegment) == segment)
+            {
+                VerifyOrExit((matched = Match(child, aPath, aRequest)) == nullptr);
+            }
+        }
+
+        for (const Node &child : aNode.mChildren)
+        {
+            if (child.mIsParameter && (matched = Match(child, aPath, aRequest)) != nullptr)
+            {
+                aRequest.SetPathParameter(StringView(child.mSegment).Substr(1, child.mSegment.size() - 2), segment);
+                ExitNow();
+            }
+        }
+
+    exit:
+        return matched;
+    }
+
+    Node mRoot;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_ROUTER_HPP_
@@ -0,0 +1,335 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the mesh topology graph built from network diagnostics for RESTful HTTP server.
+ */
+
+#include "rest/topology_graph.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <set>
+#include <utility>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace rest {
+
+// The RLOC16 of a router is its router ID in the upper bits, the RLOC16 of a child adds its child ID
+static constexpr uint8_t  kRouterIdOffset = 10;
+static constexpr uint16_t kRouterMask     = 0xfc00;
+
+// Returns the cost of a link of a link quality as Thread does, or 0 if the link can't be used.
+static uint8_t GetLinkCost(uint8_t aLinkQuality)
+{
+    static const uint8_t kLinkCosts[] = {0, 4, 2, 1};
+
+    return aLinkQuality < sizeof(kLinkCosts) ? kLinkCosts[aLinkQuality] : 0;
+}
+
+void TopologyGraph::Update(const std::vector<otNetworkDiagTlv> &aTlvs, Timepoint aNow)
+{
+    const otNetworkDiagTlv *route      = nullptr;
+    const otNetworkDiagTlv *childTable = nullptr;
+    bool                    hasRloc16  = false;
+    uint16_t                rloc16     = 0;
+
+    for (const otNetworkDiagTlv &tlv : aTlvs)
+    {
+        switch (tlv.mType)
+        {
+        case OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS:
+            rloc16    = tlv.mData.mAddr16;
+            hasRloc16 = true;
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
+            route = &tlv;
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
+            childTable = &tlv;
+            break;
+        default:
+            break;
+        }
+    }
+
+    VerifyOrExit(hasRloc16);
+
+    {
+        Node &node = mNodes[rloc16];
+
+        node.mReported   = true;
+        node.mUpdateTime = aNow;
+
+        if (route != nullptr)
+        {
+            RemoveReports(rloc16, node, /* aIsChild */ false);
+            for (uint16_t i = 0; i < route->mData.mRoute.mRouteCount; ++i)
+            {
+                const otNetworkDiagRouteData &data = route->mData.mRoute.mRouteData[i];
+                uint16_t neighbor = static_cast<uint16_t>(data.mRouterId << kRouterIdOffset);
+
+                // The route set includes the node itself and the routers it only reaches through others.
+                if (neighbor == (rloc16 & kRouterMask) || (data.mLinkQualityIn == 0 && data.mLinkQualityOut == 0))
+                {
+                    continue;
+                }
+                AddReport(rloc16, node, neighbor, {data.mLinkQualityIn, data.mLinkQualityOut, false});
+            }
+        }
+
+        if (childTable != nullptr)
+        {
+            RemoveReports(rloc16, node, /* aIsChild */ true);
+            for (uint16_t i = 0; i < childTable->mData.mChildTable.mCount; ++i)
+            {
+                uint16_t child = (rloc16 & kRouterMask) | childTable->mData.mChildTable.mTable[i].mChildId;
+
+                AddReport(rloc16, node, child, {0, 0, true});
+            }
+        }
+    }
+
+exit:
+    return;
+}
+
+uint32_t TopologyGraph::RemoveExpired(Timepoint aDeadline)
+{
+    std::vector<uint16_t> expired;
+
+    for (const auto &entry : mNodes)
+    {
+        if (entry.second.mReported && entry.second.mUpdateTime <= aDeadline)
+        {
+            expired.push_back(entry.first);
+        }
+    }
+
+    for (uint16_t rloc16 : expired)
+    {
+        Node &node = mNodes[rloc16];
+
+        RemoveReports(rloc16, node, /* aIsChild */ false);
+        RemoveReports(rloc16, node, /* aIsChild */ true);
+        node.mReported = false;
+        RemoveIfUnused(rloc16);
+    }
+
+    return static_cast<uint32_t>(expired.size());
+}
+
+bool TopologyGraph::Contains(uint16_t aRloc16) const
+{
+    return mNodes.find(aRloc16) != mNodes.end();
+}
+
+void TopologyGraph::GetNeighbors(uint16_t aRloc16, std::vector<Link> &aLinks) const
+{
+    auto it = mNodes.find(aRloc16);
+
+    aLinks.clear();
+    VerifyOrExit(it != mNodes.end());
+
+    for (const auto &report : it->second.mReports)
+    {
+        aLinks.push_back({report.first, report.second.mIsChild, report.second.mLinkQualityIn,
+                          report.second.mLinkQualityOut});
+    }
+
+    for (uint16_t reporter : it->second.mReportedBy)
+    {
+        const Report *report;
+
+        if (it->second.mReports.count(reporter) != 0)
+        {
+            continue;
+        }
+
+        // The link qualities reported by the neighbor are in its direction.
+        report = &mNodes.at(reporter).mReports.at(aRloc16);
+        aLinks.push_back({reporter, report->mIsChild, report->mLinkQualityOut, report->mLinkQualityIn});
+    }
+
+    std::sort(aLinks.begin(), aLinks.end(),
+              [](const Link &aFirst, const Link &aSecond) { return aFirst.mNeighbor < aSecond.mNeighbor; });
+
+exit:
+    return;
+}
+
+bool TopologyGraph::FindPath(uint16_t aFrom, uint16_t aTo, Path &aPath) const
+{
+    using Entry = std::pair<uint32_t, uint16_t>;
+    using Queue = std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>>;
+
+    std::map<uint16_t, uint32_t> costs;
+    std::map<uint16_t, uint16_t> previous;
+    Queue                        queue;
+    std::vector<Link>            links;
+    bool                         found = false;
+
+    aPath.mCost = 0;
+    aPath.mNodes.clear();
+    VerifyOrExit(Contains(aFrom) && Contains(aTo));
+
+    costs[aFrom] = 0;
+    queue.push({0, aFrom});
+    while (!queue.empty())
+    {
+        Entry entry = queue.top();
+
+        queue.pop();
+        if (entry.first > costs[entry.second])
+        {
+            continue;
+        }
+        if (entry.second == aTo)
+        {
+            found = true;
+            break;
+        }
+
+        GetNeighbors(entry.second, links);
+        for (const Link &link : links)
+        {
+            uint8_t  costIn  = link.mIsChild ? 1 : GetLinkCost(link.mLinkQualityIn);
+            uint8_t  costOut = link.mIsChild ? 1 : GetLinkCost(link.mLinkQualityOut);
+            uint32_t cost    = entry.first + std::max(costIn, costOut);
+            auto     it      = costs.find(link.mNeighbor);
+
+            // A router link is only used if its link quality is known in both directions.
+            if (costIn == 0 || costOut == 0)
+            {
+                continue;
+            }
+            if (it == costs.end() || cost < it->second)
+            {
+                costs[link.mNeighbor]    = cost;
+                previous[link.mNeighbor] = entry.second;
+                queue.push({cost, link.mNeighbor});
+            }
+        }
+    }
+
+    VerifyOrExit(found);
+
+    aPath.mCost = costs[aTo];
+    for (uint16_t rloc16 = aTo; rloc16 != aFrom; rloc16 = previous[rloc16])
+    {
+        aPath.mNodes.push_back(rloc16);
+    }
+    aPath.mNodes.push_back(aFrom);
+    std::reverse(aPath.mNodes.begin(), aPath.mNodes.end());
+
+exit:
+    return found;
+}
+
+void TopologyGraph::GetPartitions(std::vector<std::vector<uint16_t>> &aPartitions) const
+{
+    std::set<uint16_t> visited;
+    std::vector<Link>  links;
+
+    aPartitions.clear();
+
+    for (const auto &entry : mNodes)
+    {
+        std::vector<uint16_t> partition;
+
+        if (!visited.insert(entry.first).second)
+        {
+            continue;
+        }
+
+        // The partition is searched breadth first, the nodes found are appended to it.
+        partition.push_back(entry.first);
+        for (size_t i = 0; i < partition.size(); ++i)
+        {
+            GetNeighbors(partition[i], links);
+            for (const Link &link : links)
+            {
+                if (visited.insert(link.mNeighbor).second)
+                {
+                    partition.push_back(link.mNeighbor);
+                }
+            }
+        }
+
+        std::sort(partition.begin(), partition.end());
+        aPartitions.push_back(std::move(partition));
+    }
+}
+
+void TopologyGraph::RemoveReports(uint16_t aRloc16, Node &aNode, bool aIsChild)
+{
+    for (auto it = aNode.mReports.begin(); it != aNode.mReports.end();)
+    {
+        uint16_t neighbor = it->first;
+        Node    &other    = mNodes[neighbor];
+
+        if (it->second.mIsChild != aIsChild)
+        {
+            ++it;
+            continue;
+        }
+
+        other.mReportedBy.erase(std::remove(other.mReportedBy.begin(), other.mReportedBy.end(), aRloc16),
+                                other.mReportedBy.end());
+        it = aNode.mReports.erase(it);
+        RemoveIfUnused(neighbor);
+    }
+}
+
+void TopologyGraph::AddReport(uint16_t aRloc16, Node &aNode, uint16_t aNeighbor, const Report &aReport)
+{
+    Node &other = mNodes[aNeighbor];
+
+    aNode.mReports[aNeighbor] = aReport;
+    if (std::find(other.mReportedBy.begin(), other.mReportedBy.end(), aRloc16) == other.mReportedBy.end())
+    {
+        other.mReportedBy.push_back(aRloc16);
+    }
+}
+
+void TopologyGraph::RemoveIfUnused(uint16_t aRloc16)
+{
+    auto it = mNodes.find(aRloc16);
+
+    if (it != mNodes.end() && !it->second.mReported && it->second.mReports.empty() && it->second.mReportedBy.empty())
+    {
+        mNodes.erase(it);
+    }
+}
+
+} // namespace rest
+} // namespace otbr
@@ -0,0 +1,181 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the mesh topology graph built from network diagnostics for RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_TOPOLOGY_GRAPH_HPP_
+#define OTBR_REST_TOPOLOGY_GRAPH_HPP_
+
+#include "openthread-br/config.h"
+
+#include <map>
+#include <vector>
+
+#include <stdint.h>
+
+#include <openthread/netdiag.h>
+
+#include "common/time.hpp"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class maintains the mesh topology graph merged from the Route and Child Table TLVs of the nodes.
+ *
+ * Each node owns the links it reported, a diagnostic response only replaces the links of the TLVs it carries, so the
+ * graph is updated incrementally as the nodes respond. A link reported by either end connects both nodes.
+ */
+class TopologyGraph
+{
+public:
+    /**
+     * This structure represents a link of a node to a neighbor.
+     */
+    struct Link
+    {
+        uint16_t mNeighbor;       ///< The RLOC16 of the neighbor.
+        bool     mIsChild;        ///< Whether the link connects a child to its parent.
+        uint8_t  mLinkQualityIn;  ///< The link quality from the neighbor, 0 if unknown.
+        uint8_t  mLinkQualityOut; ///< The link quality to the neighbor, 0 if unknown.
+    };
+
+    /**
+     * This structure represents a path between two nodes.
+     */
+    struct Path
+    {
+        uint32_t              mCost;  ///< The sum of the link costs.
+        std::vector<uint16_t> mNodes; ///< The RLOC16s of the nodes from the source to the destination.
+    };
+
+    /**
+     * This method merges the diagnostic TLVs of a node into the graph.
+     *
+     * The TLVs are ignored if they don't include the Short Address TLV of the node.
+     *
+     * @param[in] aTlvs  The received TLVs.
+     * @param[in] aNow   The current time, which never decreases between calls.
+     */
+    void Update(const std::vector<otNetworkDiagTlv> &aTlvs, Timepoint aNow);
+
+    /**
+     * This method removes the links reported by the nodes not updated after a deadline.
+     *
+     * @param[in] aDeadline  The time up to which the reports are expired.
+     *
+     * @returns The number of nodes whose reports were removed.
+     */
+    uint32_t RemoveExpired(Timepoint aDeadline);
+
+    /**
+     * This method indicates whether a node is in the graph.
+     *
+     * @param[in] aRloc16  The RLOC16 of the node.
+     *
+     * @retval TRUE   The node reported or was reported by another node.
+     * @retval FALSE  The node is unknown.
+     */
+    bool Contains(uint16_t aRloc16) const;
+
+    /**
+     * This method gets the links of a node to its neighbors.
+     *
+     * The link qualities reported by the node itself are preferred over the ones reported by its neighbor.
+     *
+     * @param[in]  aRloc16  The RLOC16 of the node.
+     * @param[out] aLinks   The links, ordered by the RLOC16 of the neighbor.
+     */
+    void GetNeighbors(uint16_t aRloc16, std::vector<Link> &aLinks) const;
+
+    /**
+     * This method finds the path of the least cost between two nodes.
+     *
+     * A router link costs as Thread does by its worse link quality, a link without a link quality in one direction
+     * is not used. A link between a child and its parent costs 1.
+     *
+     * @param[in]  aFrom  The RLOC16 of the source.
+     * @param[in]  aTo    The RLOC16 of the destination.
+     * @param[out] aPath  The path.
+     *
+     * @retval TRUE   The path is found.
+     * @retval FALSE  The destination can't be reached from the source.
+     */
+    bool FindPath(uint16_t aFrom, uint16_t aTo, Path &aPath) const;
+
+    /**
+     * This method gets the connected partitions of the graph.
+     *
+     * @param[out] aPartitions  The RLOC16s of the nodes of each partition, both ordered by RLOC16.
+     */
+    void GetPartitions(std::vector<std::vector<uint16_t>> &aPartitions) const;
+
+    /**
+     * This method returns the number of nodes in the graph.
+     *
+     * @returns The number of nodes.
+     */
+    size_t GetNodeCount(void) const { return mNodes.size(); }
+
+private:
+    struct Report
+    {
+        uint8_t mLinkQualityIn;
+        uint8_t mLinkQualityOut;
+        bool    mIsChild;
+    };
+
+    struct Node
+    {
+        Node(void)
+            : mReported(false)
+        {
+        }
+
+        // The links this node reported, by neighbor, and when it last reported them
+        std::map<uint16_t, Report> mReports;
+        bool                       mReported;
+        Timepoint                  mUpdateTime;
+        // The nodes which reported a link to this node
+        std::vector<uint16_t> mReportedBy;
+    };
+
+    void RemoveReports(uint16_t aRloc16, Node &aNode, bool aIsChild);
+    void AddReport(uint16_t aRloc16, Node &aNode, uint16_t aNeighbor, const Report &aReport);
+    void RemoveIfUnused(uint16_t aRloc16);
+
+    std::map<uint16_t, Node> mNodes;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_TOPOLOGY_GRAPH_HPP_
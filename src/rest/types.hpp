@@ -45,10 +45,60 @@
 #include "openthread/netdiag.h"
 
 #define OT_REST_ACCEPT_HEADER "Accept"
+#define OT_REST_ALLOW_HEADER "Allow"
+#define OT_REST_ACCEPT_ENCODING_HEADER "Accept-Encoding"
+#define OT_REST_CONTENT_ENCODING_HEADER "Content-Encoding"
 #define OT_REST_CONTENT_TYPE_HEADER "Content-Type"
+#define OT_REST_ETAG_HEADER "ETag"
+#define OT_REST_IF_NONE_MATCH_HEADER "If-None-Match"
+#define OT_REST_RETRY_AFTER_HEADER "Retry-After"
 
 #define OT_REST_CONTENT_TYPE_JSON "application/json"
 #define OT_REST_CONTENT_TYPE_PLAIN "text/plain"
+#define OT_REST_CONTENT_TYPE_EVENT_STREAM "text/event-stream"
+#define OT_REST_CONTENT_TYPE_NDJSON "application/x-ndjson"
+#define OT_REST_CONTENT_TYPE_OCTET_STREAM "application/octet-stream"
+#define OT_REST_CONTENT_TYPE_CBOR "application/cbor"
+#define OT_REST_CONTENT_TYPE_OPENMETRICS "application/openmetrics-text; version=1.0.0; charset=utf-8"
+
+#define OT_REST_RESOURCE_PATH_BATCH "/batch"
+#define OT_REST_RESOURCE_PATH_DIAGNOSTICS "/diagnostics"
+#define OT_REST_RESOURCE_PATH_DIAGNOSTICS_NEIGHBORS "/diagnostics/topology/neighbors"
+#define OT_REST_RESOURCE_PATH_DIAGNOSTICS_PATH "/diagnostics/topology/path"
+#define OT_REST_RESOURCE_PATH_DIAGNOSTICS_PARTITIONS "/diagnostics/topology/partitions"
+#define OT_REST_RESOURCE_PATH_EVENTS "/events"
+#define OT_REST_RESOURCE_PATH_METRICS "/metrics"
+#define OT_REST_RESOURCE_PATH_NODE "/node"
+#define OT_REST_RESOURCE_PATH_NODE_BAID "/node/ba-id"
+#define OT_REST_RESOURCE_PATH_NODE_CHANNELS "/node/channels"
+#define OT_REST_RESOURCE_PATH_NODE_COUNTERS "/node/counters"
+#define OT_REST_RESOURCE_PATH_NODE_RLOC "/node/rloc"
+#define OT_REST_RESOURCE_PATH_NODE_RLOC16 "/node/rloc16"
+#define OT_REST_RESOURCE_PATH_NODE_EXTADDRESS "/node/ext-address"
+#define OT_REST_RESOURCE_PATH_NODE_STATE "/node/state"
+#define OT_REST_RESOURCE_PATH_NODE_NETWORKNAME "/node/network-name"
+#define OT_REST_RESOURCE_PATH_NODE_LEADERDATA "/node/leader-data"
+#define OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER "/node/num-of-router"
+#define OT_REST_RESOURCE_PATH_NODE_EXTPANID "/node/ext-panid"
+#define OT_REST_RESOURCE_PATH_NODE_DATASET_ACTIVE "/node/dataset/active"
+#define OT_REST_RESOURCE_PATH_NODE_DATASET_PENDING "/node/dataset/pending"
+#define OT_REST_RESOURCE_PATH_NODE_SCAN "/node/scan"
+#define OT_REST_RESOURCE_PATH_NETWORK "/networks"
+#define OT_REST_RESOURCE_PATH_NETWORK_CURRENT "/networks/current"
+#define OT_REST_RESOURCE_PATH_NETWORK_CURRENT_COMMISSION "/networks/commission"
+#define OT_REST_RESOURCE_PATH_NETWORK_CURRENT_PREFIX "/networks/current/prefix"
+
+#define OT_REST_HTTP_STATUS_200 "200 OK"
+#define OT_REST_HTTP_STATUS_201 "201 Created"
+#define OT_REST_HTTP_STATUS_204 "204 No Content"
+#define OT_REST_HTTP_STATUS_304 "304 Not Modified"
+#define OT_REST_HTTP_STATUS_400 "400 Bad Request"
+#define OT_REST_HTTP_STATUS_404 "404 Not Found"
+#define OT_REST_HTTP_STATUS_405 "405 Method Not Allowed"
+#define OT_REST_HTTP_STATUS_408 "408 Request Timeout"
+#define OT_REST_HTTP_STATUS_409 "409 Conflict"
+#define OT_REST_HTTP_STATUS_429 "429 Too Many Requests"
+#define OT_REST_HTTP_STATUS_500 "500 Internal Server Error"
 
 using std::chrono::steady_clock;
 
@@ -71,11 +121,13 @@ enum class HttpStatusCode : std::uint16_t
     kStatusOk                  = 200,
     kStatusCreated             = 201,
     kStatusNoContent           = 204,
+    kStatusNotModified         = 304,
     kStatusBadRequest          = 400,
     kStatusResourceNotFound    = 404,
     kStatusMethodNotAllowed    = 405,
     kStatusRequestTimeout      = 408,
     kStatusConflict            = 409,
+    kStatusTooManyRequests     = 429,
     kStatusInternalServerError = 500,
 };
 
@@ -96,6 +148,8 @@ enum class ConnectionState : std::uint8_t
     kWriteTimeout  = 5, ///< Reach write timeout
     kInternalError = 6, ///< Occur internal call error
     kComplete      = 7, ///< No longer need to be processed
+    kEventStream   = 8, ///< Stream events to the client
+    kFree          = 9, ///< Released for reuse by another client
 
 };
 struct NodeInfo
@@ -111,12 +165,6 @@ struct NodeInfo
     std::string     mNetworkName;
 };
 
-struct DiagInfo
-{
-    steady_clock::time_point      mStartTime;
-    std::vector<otNetworkDiagTlv> mDiagContent;
-};
-
 } // namespace rest
 } // namespace otbr
 
@@ -41,23 +41,57 @@
 #error "The Advertising Proxy requires OTBR_ENABLE_MDNS_AVAHI, OTBR_ENABLE_MDNS_MDNSSD or OTBR_ENABLE_MDNS_MOJO"
 #endif
 
+#include <algorithm>
+#include <chrono>
 #include <string>
 
 #include <assert.h>
+#include <string.h>
 
 #include "common/code_utils.hpp"
 #include "common/dns_utils.hpp"
 #include "common/logging.hpp"
+#include "common/trace.hpp"
+
+#ifndef OTBR_CONFIG_SRP_SNAPSHOT_DIR
+/**
+ * @def OTBR_CONFIG_SRP_SNAPSHOT_DIR
+ *
+ * The directory of the snapshot of the advertised SRP hosts, no snapshot is kept if empty.
+ */
+#define OTBR_CONFIG_SRP_SNAPSHOT_DIR "/var/lib/thread"
+#endif
+
+#ifndef OTBR_CONFIG_SRP_SNAPSHOT_INTERVAL
+/**
+ * @def OTBR_CONFIG_SRP_SNAPSHOT_INTERVAL
+ *
+ * The interval in seconds of writing the snapshot of the advertised SRP hosts, when they have changed.
+ */
+#define OTBR_CONFIG_SRP_SNAPSHOT_INTERVAL 60
+#endif
 
 namespace otbr {
 
-AdvertisingProxy::AdvertisingProxy(Ncp::RcpHost &aHost, Mdns::Publisher &aPublisher)
+AdvertisingProxy::AdvertisingProxy(Ncp::RcpHost &aHost, Mdns::PublisherImpl &aPublisher)
     : mHost(aHost)
     , mPublisher(aPublisher)
     , mIsEnabled(false)
+    , mIsMeshLocalEidValid(false)
 {
-    mHost.RegisterResetHandler(
-        [this]() { otSrpServerSetServiceUpdateHandler(GetInstance(), AdvertisingHandler, this); });
+    if (strlen(OTBR_CONFIG_SRP_SNAPSHOT_DIR) != 0)
+    {
+        // Agents of different Thread interfaces keep their own snapshots.
+        mSnapshotPath =
+            std::string(OTBR_CONFIG_SRP_SNAPSHOT_DIR) + "/otbr-srp-" + mHost.GetInterfaceName() + ".snapshot";
+    }
+
+    mHost.RegisterResetHandler([this]() {
+        mIsMeshLocalEidValid = false;
+        otSrpServerSetServiceUpdateHandler(GetInstance(), AdvertisingHandler, this);
+    });
+    mHost.AddThreadStateChangedCallback(OT_CHANGED_THREAD_ML_ADDR | OT_CHANGED_ACTIVE_DATASET,
+                                        [this](const Ncp::ThreadStateSnapshot &) { mIsMeshLocalEidValid = false; });
 }
 
 void AdvertisingProxy::SetEnabled(bool aIsEnabled)
@@ -81,6 +115,13 @@ void AdvertisingProxy::Start(void)
 {
     otSrpServerSetServiceUpdateHandler(GetInstance(), AdvertisingHandler, this);
 
+    if (!mSnapshotPath.empty())
+    {
+        RestoreSnapshot();
+        mSnapshotTaskId = mHost.PostTimerTask(std::chrono::seconds(OTBR_CONFIG_SRP_SNAPSHOT_INTERVAL),
+                                              [this]() { HandleSnapshotTimer(); });
+    }
+
     otbrLogInfo("Started");
 }
 
@@ -93,8 +134,20 @@ void AdvertisingProxy::Stop(void)
     if (GetInstance() != nullptr)
     {
         otSrpServerSetServiceUpdateHandler(GetInstance(), nullptr, nullptr);
+
+        // The snapshot is written on a graceful shutdown, for the next start to resume from.
+        WriteSnapshot();
     }
 
+    mHost.CancelTimerTask(mSnapshotTaskId);
+    mHost.CancelTimerTask(mRestoredExpiryTaskId);
+    mSnapshotTaskId       = 0;
+    mRestoredExpiryTaskId = 0;
+
+    mAdvertisedHosts.clear();
+    mRepublishedHosts.clear();
+    mRestoredHosts.clear();
+
     otbrLogInfo("Stopped");
 }
 
@@ -110,23 +163,29 @@ void AdvertisingProxy::AdvertisingHandler(otSrpServerServiceUpdateId aId,
                                           const otSrpServerHost     *aHost,
                                           uint32_t                   aTimeout)
 {
-    OTBR_UNUSED_VARIABLE(aTimeout);
+    OTBR_TRACE_SCOPE("srp.advertise");
 
-    OutstandingUpdate *update = nullptr;
-    otbrError          error  = OTBR_ERROR_NONE;
+    OutstandingUpdateMap::iterator update;
+    otbrError                      error = OTBR_ERROR_NONE;
 
     VerifyOrExit(IsEnabled());
 
-    mOutstandingUpdates.emplace_back();
-    update      = &mOutstandingUpdates.back();
-    update->mId = aId;
+    RemoveExpiredUpdates();
+
+    update                     = mOutstandingUpdates.emplace(aId, OutstandingUpdate()).first;
+    update->second.mId         = aId;
+    update->second.mExpiration = mUpdateExpirations.emplace(Clock::now() + Milliseconds(aTimeout), aId);
+    OTBR_TRACE_ASYNC_BEGIN("srp.update", aId);
 
-    error = PublishHostAndItsServices(aHost, update);
+    error = PublishHostAndItsServices(aHost, &update->second);
 
-    if (error != OTBR_ERROR_NONE || update->mCallbackCount == 0)
+    // The update may have been completed by a callback invoked synchronously.
+    update = mOutstandingUpdates.find(aId);
+    VerifyOrExit(update != mOutstandingUpdates.end());
+
+    if (error != OTBR_ERROR_NONE || update->second.mCallbackCount == 0)
     {
-        mOutstandingUpdates.pop_back();
-        otSrpServerHandleServiceUpdateResult(GetInstance(), aId, OtbrErrorToOtError(error));
+        CompleteUpdate(update, error);
     }
 
 exit:
@@ -135,42 +194,94 @@ exit:
 
 void AdvertisingProxy::OnMdnsPublishResult(otSrpServerServiceUpdateId aUpdateId, otbrError aError)
 {
-    for (auto update = mOutstandingUpdates.begin(); update != mOutstandingUpdates.end(); ++update)
+    OutstandingUpdateMap::iterator update;
+
+    RemoveExpiredUpdates();
+
+    update = mOutstandingUpdates.find(aUpdateId);
+    VerifyOrExit(update != mOutstandingUpdates.end());
+
+    if (aError == OTBR_ERROR_ABORTED && IsSuperseded(update->second))
     {
-        if (update->mId != aUpdateId)
-        {
-            continue;
-        }
+        // The mDNS publisher dropped this request in favor of a newer update
+        // of the same host, which carries the full state of the host.
+        otbrLogInfo("SRP service update (id = %u) is superseded", aUpdateId);
+        aError = OTBR_ERROR_NONE;
+    }
 
-        if (aError != OTBR_ERROR_NONE || update->mCallbackCount == 1)
-        {
-            // Erase before notifying OpenThread, because there are chances that new
-            // elements may be added to `otSrpServerHandleServiceUpdateResult` and
-            // the iterator will be invalidated.
-            mOutstandingUpdates.erase(update);
-            otSrpServerHandleServiceUpdateResult(GetInstance(), aUpdateId, OtbrErrorToOtError(aError));
-        }
-        else
-        {
-            --update->mCallbackCount;
-            otbrLogInfo("Waiting for more publishing callbacks %d", update->mCallbackCount);
-        }
-        break;
+    if (aError != OTBR_ERROR_NONE || update->second.mCallbackCount == 1)
+    {
+        CompleteUpdate(update, aError);
+    }
+    else
+    {
+        --update->second.mCallbackCount;
+        otbrLogInfo("Waiting for more publishing callbacks %d", update->second.mCallbackCount);
     }
+
+exit:
+    return;
+}
+
+bool AdvertisingProxy::IsSuperseded(const OutstandingUpdate &aUpdate) const
+{
+    auto latest = mLatestUpdateIds.find(aUpdate.mHostKey);
+
+    return latest != mLatestUpdateIds.end() && latest->second != aUpdate.mId;
+}
+
+void AdvertisingProxy::CompleteUpdate(OutstandingUpdateMap::iterator aUpdate, otbrError aError)
+{
+    otSrpServerServiceUpdateId id = aUpdate->first;
+
+    // Remove before notifying OpenThread, because new updates may be
+    // added by `otSrpServerHandleServiceUpdateResult`.
+    RemoveUpdate(aUpdate);
+    otSrpServerHandleServiceUpdateResult(GetInstance(), id, OtbrErrorToOtError(aError));
 }
 
-std::vector<Ip6Address> AdvertisingProxy::GetEligibleAddresses(const otIp6Address *aHostAddresses,
-                                                               uint8_t             aHostAddressNum)
+void AdvertisingProxy::RemoveUpdate(OutstandingUpdateMap::iterator aUpdate)
 {
-    std::vector<Ip6Address> addresses;
-    const otIp6Address     *meshLocalEid = otThreadGetMeshLocalEid(GetInstance());
+    auto latest = mLatestUpdateIds.find(aUpdate->second.mHostKey);
 
-    addresses.reserve(aHostAddressNum);
+    if (latest != mLatestUpdateIds.end() && latest->second == aUpdate->first)
+    {
+        mLatestUpdateIds.erase(latest);
+    }
+
+    OTBR_TRACE_ASYNC_END("srp.update", aUpdate->first);
+
+    mUpdateExpirations.erase(aUpdate->second.mExpiration);
+    mOutstandingUpdates.erase(aUpdate);
+}
+
+void AdvertisingProxy::RemoveExpiredUpdates(void)
+{
+    Timepoint now = Clock::now();
+
+    // The SRP server has already failed these updates by itself, so their
+    // results are not reported any more.
+    while (!mUpdateExpirations.empty() && mUpdateExpirations.begin()->first <= now)
+    {
+        otbrLogInfo("SRP service update (id = %u) timed out", mUpdateExpirations.begin()->second);
+        RemoveUpdate(mOutstandingUpdates.find(mUpdateExpirations.begin()->second));
+    }
+}
+
+void AdvertisingProxy::GetEligibleAddresses(const otIp6Address           *aHostAddresses,
+                                            uint8_t                       aHostAddressNum,
+                                            Mdns::Publisher::AddressList &aAddresses)
+{
+    const Ip6Address &meshLocalEid = GetMeshLocalEid();
+
+    aAddresses.clear();
+    aAddresses.reserve(aHostAddressNum);
     for (size_t i = 0; i < aHostAddressNum; ++i)
     {
         Ip6Address address(aHostAddresses[i].mFields.m8);
 
-        if (otIp6PrefixMatch(meshLocalEid, &aHostAddresses[i]) >= OT_IP6_PREFIX_BITSIZE)
+        // Equivalent to a 64-bit prefix match against the mesh-local EID.
+        if (address.m64[0] == meshLocalEid.m64[0])
         {
             continue;
         }
@@ -178,10 +289,19 @@ std::vector<Ip6Address> AdvertisingProxy::GetEligibleAddresses(const otIp6Addres
         {
             continue;
         }
-        addresses.push_back(address);
+        aAddresses.push_back(address);
     }
+}
 
-    return addresses;
+const Ip6Address &AdvertisingProxy::GetMeshLocalEid(void)
+{
+    if (!mIsMeshLocalEidValid)
+    {
+        mMeshLocalEid        = Ip6Address(*otThreadGetMeshLocalEid(GetInstance()));
+        mIsMeshLocalEidValid = true;
+    }
+
+    return mMeshLocalEid;
 }
 
 void AdvertisingProxy::HandleMdnsState(Mdns::Publisher::State aState)
@@ -195,17 +315,117 @@ exit:
     return;
 }
 
-void AdvertisingProxy::PublishAllHostsAndServices(void)
+void AdvertisingProxy::FindServiceInstances(const std::string                                    &aType,
+                                            const std::string                                    &aInstanceName,
+                                            std::vector<Mdns::Publisher::DiscoveredInstanceInfo> &aInstances) const
 {
-    const otSrpServerHost *host = nullptr;
+    for (const auto &host : mAdvertisedHosts)
+    {
+        for (const auto &entry : host.second.mServices)
+        {
+            const Mdns::Publisher::HostedService &service = entry.second;
+
+            if (!DnsLabelsEqual(service.mType, aType) ||
+                (!aInstanceName.empty() && !DnsLabelsEqual(service.mName, aInstanceName)))
+            {
+                continue;
+            }
+
+            aInstances.emplace_back();
+            aInstances.back().mName      = service.mName;
+            aInstances.back().mHostName  = host.first + ".local.";
+            aInstances.back().mAddresses = host.second.mAddresses;
+            aInstances.back().mPort      = service.mPort;
+            aInstances.back().mTxtData   = service.mTxtData;
+        }
+    }
+}
+
+bool AdvertisingProxy::FindHost(const std::string &aHostName, Mdns::Publisher::DiscoveredHostInfo &aHostInfo) const
+{
+    auto host = std::find_if(mAdvertisedHosts.begin(), mAdvertisedHosts.end(),
+                             [&aHostName](const std::pair<const std::string, AdvertisedHost> &aEntry) {
+                                 return DnsLabelsEqual(aEntry.first, aHostName);
+                             });
 
+    if (host != mAdvertisedHosts.end())
+    {
+        aHostInfo.mHostName  = host->first + ".local.";
+        aHostInfo.mAddresses = host->second.mAddresses;
+    }
+
+    return host != mAdvertisedHosts.end();
+}
+
+void AdvertisingProxy::PublishAllHostsAndServices(void)
+{
     VerifyOrExit(IsEnabled());
     VerifyOrExit(mPublisher.IsStarted());
 
     otbrLogInfo("Publish all hosts and services");
+    mAdvertisedHosts.clear();
+    mRepublishedHosts.clear();
+    mRepublishStartTime = Clock::now();
+
+    PublishRestoredHosts();
+
+    if (!mIsRepublishTaskPosted)
+    {
+        PublishNextHosts();
+    }
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::PublishNextHosts(void)
+{
+    const otSrpServerHost *host      = nullptr;
+    uint32_t               numHosts  = 0;
+    uint32_t               published = 0;
+    bool                   hasMore   = false;
+
+    mIsRepublishTaskPosted = false;
+
+    VerifyOrExit(IsEnabled());
+    VerifyOrExit(mPublisher.IsStarted());
+
+    // The SRP server may add or remove hosts between two batches, so the hosts
+    // are walked from the start each time, skipping those already published.
     while ((host = otSrpServerGetNextHost(GetInstance(), host)))
     {
+        std::string fullHostName = otSrpServerHostGetFullName(host);
+
+        numHosts++;
+
+        if (mRepublishedHosts.count(DnsNameKey::Find(fullHostName)) != 0)
+        {
+            continue;
+        }
+
+        if (published == kRepublishBatchSize)
+        {
+            hasMore = true;
+            continue;
+        }
+
+        mRepublishedHosts.insert(DnsNameKey::Intern(fullHostName));
         PublishHostAndItsServices(host, nullptr);
+        published++;
+    }
+
+    if (hasMore)
+    {
+        otbrLogInfo("Published %zu of %u SRP hosts", mRepublishedHosts.size(), numHosts);
+        mIsRepublishTaskPosted = true;
+        mHost.PostTimerTask(Milliseconds(0), [this]() { PublishNextHosts(); });
+    }
+    else
+    {
+        otbrLogInfo("Published all %u SRP hosts in %lld ms", numHosts,
+                    static_cast<long long>(
+                        std::chrono::duration_cast<Milliseconds>(Clock::now() - mRepublishStartTime).count()));
+        mRepublishedHosts.clear();
     }
 
 exit:
@@ -214,16 +434,22 @@ exit:
 
 otbrError AdvertisingProxy::PublishHostAndItsServices(const otSrpServerHost *aHost, OutstandingUpdate *aUpdate)
 {
-    otbrError                  error = OTBR_ERROR_NONE;
-    std::string                hostName;
-    std::string                hostDomain;
-    const otIp6Address        *hostAddresses;
-    uint8_t                    hostAddressNum;
-    bool                       hostDeleted;
-    const otSrpServerService  *service;
-    otSrpServerServiceUpdateId updateId     = 0;
-    bool                       hasUpdate    = false;
-    std::string                fullHostName = otSrpServerHostGetFullName(aHost);
+    otbrError                           error = OTBR_ERROR_NONE;
+    std::string                         hostName;
+    std::string                         hostDomain;
+    const otIp6Address                 *hostAddresses;
+    uint8_t                             hostAddressNum;
+    bool                                hostDeleted;
+    const otSrpServerService           *service;
+    AdvertisedHost                      advertisedHost;
+    const AdvertisedHost               *lastAdvertisedHost = nullptr;
+    const Mdns::Publisher::AddressList *addresses;
+    Mdns::Publisher::HostedServiceList  changedServices;
+    std::vector<ServiceKey>             deletedServices;
+    bool                                addressesChanged;
+    otSrpServerServiceUpdateId          updateId     = 0;
+    bool                                hasUpdate    = false;
+    std::string                         fullHostName = otSrpServerHostGetFullName(aHost);
 
     otbrLogInfo("Advertise SRP service updates: host=%s", fullHostName.c_str());
 
@@ -231,91 +457,176 @@ otbrError AdvertisingProxy::PublishHostAndItsServices(const otSrpServerHost *aHo
     hostAddresses = otSrpServerHostGetAddresses(aHost, &hostAddressNum);
     hostDeleted   = otSrpServerHostIsDeleted(aHost);
 
+    // A restored host registered again is taken over by the SRP server, what's advertised for it is updated as
+    // for any other host.
+    mRestoredHosts.erase(hostName);
+    mIsSnapshotDirty = true;
+
     if (aUpdate)
     {
         hasUpdate = true;
         updateId  = aUpdate->mId;
-        aUpdate->mCallbackCount++;
-        aUpdate->mHostName = hostName;
-        service            = nullptr;
-        while ((service = otSrpServerHostGetNextService(aHost, service)) != nullptr)
+
+        // Recorded before publishing, because the publisher may abort the
+        // requests of an older update of this host synchronously.
+        aUpdate->mHostKey                   = DnsNameKey::Intern(hostName);
+        mLatestUpdateIds[aUpdate->mHostKey] = updateId;
+    }
+
+    if (hostDeleted)
+    {
+        // The services of a deleted host are un-published together with it.
+        mAdvertisedHosts.erase(hostName);
+
+        if (aUpdate)
         {
             aUpdate->mCallbackCount++;
         }
+
+        otbrLogDebug("Unpublish SRP host '%s' and its services", fullHostName.c_str());
+        mPublisher.UnpublishHostAndServices(
+            hostName, [this, hasUpdate, updateId, hostName, fullHostName](otbrError aError) {
+                // Treat `NOT_FOUND` as success when unpublishing host.
+                aError = (aError == OTBR_ERROR_NOT_FOUND) ? OTBR_ERROR_NONE : aError;
+                otbrLogResult(aError, "Handle unpublish SRP host '%s' and its services", fullHostName.c_str());
+                HandlePublishResult(hostName, hasUpdate, updateId, aError);
+            });
+        ExitNow();
+    }
+
+    {
+        auto lastAdvertised = mAdvertisedHosts.find(hostName);
+
+        if (lastAdvertised != mAdvertisedHosts.end())
+        {
+            lastAdvertisedHost = &lastAdvertised->second;
+        }
     }
 
+    // TODO: select a preferred address or advertise all addresses from SRP client.
+    GetEligibleAddresses(hostAddresses, hostAddressNum, advertisedHost.mAddresses);
+
     service = nullptr;
     while ((service = otSrpServerHostGetNextService(aHost, service)) != nullptr)
     {
-        std::string fullServiceName = otSrpServerServiceGetInstanceName(service);
+        const char *fullServiceName = otSrpServerServiceGetInstanceName(service);
+        StringView  instanceName;
+        StringView  instanceType;
+        StringView  instanceDomain;
         std::string serviceName;
         std::string serviceType;
-        std::string serviceDomain;
 
-        SuccessOrExit(error = SplitFullServiceInstanceName(fullServiceName, serviceName, serviceType, serviceDomain));
+        SuccessOrExit(error = SplitFullServiceInstanceName(StringView(fullServiceName), instanceName, instanceType,
+                                                           instanceDomain));
+        serviceName = instanceName.ToString();
+        serviceType = instanceType.ToString();
+
+        if (!otSrpServerServiceIsDeleted(service))
+        {
+            Mdns::Publisher::HostedService &hostedService =
+                advertisedHost.mServices[ServiceKey(serviceName, serviceType)];
+
+            hostedService.mName        = serviceName;
+            hostedService.mType        = serviceType;
+            hostedService.mSubTypeList = MakeSubTypeList(service);
+            hostedService.mPort        = otSrpServerServiceGetPort(service);
+            hostedService.mTxtData     = MakeTxtData(service);
 
-        if (!hostDeleted && !otSrpServerServiceIsDeleted(service))
+            if (lastAdvertisedHost == nullptr || IsServiceChanged(*lastAdvertisedHost, hostedService))
+            {
+                otbrLogDebug("Publish SRP service '%s'", fullServiceName);
+                changedServices.push_back(hostedService);
+            }
+        }
+        else if (lastAdvertisedHost == nullptr)
         {
-            Mdns::Publisher::TxtData     txtData     = MakeTxtData(service);
-            Mdns::Publisher::SubTypeList subTypeList = MakeSubTypeList(service);
-
-            otbrLogDebug("Publish SRP service '%s'", fullServiceName.c_str());
-            mPublisher.PublishService(
-                hostName, serviceName, serviceType, subTypeList, otSrpServerServiceGetPort(service), txtData,
-                [this, hasUpdate, updateId, fullServiceName](otbrError aError) {
-                    otbrLogResult(aError, "Handle publish SRP service '%s'", fullServiceName.c_str());
-                    if (hasUpdate)
-                    {
-                        OnMdnsPublishResult(updateId, aError);
-                    }
-                });
+            deletedServices.emplace_back(serviceName, serviceType);
         }
-        else
+    }
+
+    // Once the host has been advertised, the deleted services which the SRP server retains
+    // until their key leases expire have already been un-published.
+    if (lastAdvertisedHost != nullptr)
+    {
+        for (const auto &lastService : lastAdvertisedHost->mServices)
         {
-            otbrLogDebug("Unpublish SRP service '%s'", fullServiceName.c_str());
-            mPublisher.UnpublishService(
-                serviceName, serviceType, [this, hasUpdate, updateId, fullServiceName](otbrError aError) {
-                    // Treat `NOT_FOUND` as success when unpublishing service
-                    aError = (aError == OTBR_ERROR_NOT_FOUND) ? OTBR_ERROR_NONE : aError;
-                    otbrLogResult(aError, "Handle unpublish SRP service '%s'", fullServiceName.c_str());
-                    if (hasUpdate)
-                    {
-                        OnMdnsPublishResult(updateId, aError);
-                    }
-                });
+            if (advertisedHost.mServices.find(lastService.first) == advertisedHost.mServices.end())
+            {
+                deletedServices.push_back(lastService.first);
+            }
         }
     }
 
-    if (!hostDeleted)
+    addressesChanged = lastAdvertisedHost == nullptr || lastAdvertisedHost->mAddresses != advertisedHost.mAddresses;
+
+    if (aUpdate)
     {
-        std::vector<Ip6Address> addresses;
+        aUpdate->mCallbackCount += (addressesChanged ? 1 : 0) + static_cast<uint32_t>(deletedServices.size());
+        if (lastAdvertisedHost != nullptr)
+        {
+            aUpdate->mCallbackCount += static_cast<uint32_t>(changedServices.size());
+        }
+    }
 
-        // TODO: select a preferred address or advertise all addresses from SRP client.
-        otbrLogDebug("Publish SRP host '%s'", fullHostName.c_str());
+    // Recorded before publishing, because a failure reported synchronously discards it. The
+    // addresses are copied by the first publishing call, before any callback can run.
+    addresses = &(mAdvertisedHosts[hostName] = std::move(advertisedHost)).mAddresses;
 
-        addresses = GetEligibleAddresses(hostAddresses, hostAddressNum);
-        mPublisher.PublishHost(
-            hostName, addresses,
-            Mdns::Publisher::ResultCallback([this, hasUpdate, updateId, fullHostName](otbrError aError) {
-                otbrLogResult(aError, "Handle publish SRP host '%s'", fullHostName.c_str());
-                if (hasUpdate)
-                {
-                    OnMdnsPublishResult(updateId, aError);
-                }
-            }));
+    if (lastAdvertisedHost == nullptr)
+    {
+        otbrLogDebug("Publish SRP host '%s' with %zu services", fullHostName.c_str(), changedServices.size());
+
+        // The host and its services are published in one transaction, so that they
+        // are probed and announced together and reported with a single callback.
+        mPublisher.PublishHostAndServices(
+            hostName, *addresses, changedServices,
+            [this, hasUpdate, updateId, hostName, fullHostName](otbrError aError) {
+                otbrLogResult(aError, "Handle publish SRP host '%s' and its services", fullHostName.c_str());
+                HandlePublishResult(hostName, hasUpdate, updateId, aError);
+            });
     }
     else
     {
-        otbrLogDebug("Unpublish SRP host '%s'", fullHostName.c_str());
-        mPublisher.UnpublishHost(hostName, [this, hasUpdate, updateId, fullHostName](otbrError aError) {
-            // Treat `NOT_FOUND` as success when unpublishing host.
-            aError = (aError == OTBR_ERROR_NOT_FOUND) ? OTBR_ERROR_NONE : aError;
-            otbrLogResult(aError, "Handle unpublish SRP host '%s'", fullHostName.c_str());
-            if (hasUpdate)
-            {
-                OnMdnsPublishResult(updateId, aError);
-            }
-        });
+        otbrLogDebug("Update SRP host '%s': addresses %s, %zu services changed, %zu services deleted",
+                     fullHostName.c_str(), addressesChanged ? "changed" : "unchanged", changedServices.size(),
+                     deletedServices.size());
+
+        if (addressesChanged)
+        {
+            mPublisher.PublishHost(hostName, *addresses,
+                                   [this, hasUpdate, updateId, hostName, fullHostName](otbrError aError) {
+                                       otbrLogResult(aError, "Handle publish SRP host '%s'", fullHostName.c_str());
+                                       HandlePublishResult(hostName, hasUpdate, updateId, aError);
+                                   });
+        }
+
+        for (const Mdns::Publisher::HostedService &changedService : changedServices)
+        {
+            std::string fullServiceName = changedService.mName + "." + changedService.mType;
+
+            mPublisher.PublishService(hostName, changedService.mName, changedService.mType, changedService.mSubTypeList,
+                                      changedService.mPort, changedService.mTxtData,
+                                      [this, hasUpdate, updateId, hostName, fullServiceName](otbrError aError) {
+                                          otbrLogResult(aError, "Handle publish SRP service '%s'",
+                                                        fullServiceName.c_str());
+                                          HandlePublishResult(hostName, hasUpdate, updateId, aError);
+                                      });
+        }
+    }
+
+    for (const ServiceKey &deletedService : deletedServices)
+    {
+        std::string fullServiceName = deletedService.first + "." + deletedService.second;
+
+        otbrLogDebug("Unpublish SRP service '%s'", fullServiceName.c_str());
+        mPublisher.UnpublishService(deletedService.first, deletedService.second,
+                                    [this, hasUpdate, updateId, hostName, fullServiceName](otbrError aError) {
+                                        // Treat `NOT_FOUND` as success when unpublishing service
+                                        aError = (aError == OTBR_ERROR_NOT_FOUND) ? OTBR_ERROR_NONE : aError;
+                                        otbrLogResult(aError, "Handle unpublish SRP service '%s'",
+                                                      fullServiceName.c_str());
+                                        HandlePublishResult(hostName, hasUpdate, updateId, aError);
+                                    });
     }
 
 exit:
@@ -329,6 +640,196 @@ exit:
     return error;
 }
 
+void AdvertisingProxy::HandlePublishResult(const std::string         &aHostName,
+                                           bool                       aHasUpdate,
+                                           otSrpServerServiceUpdateId aUpdateId,
+                                           otbrError                  aError)
+{
+    if (aError != OTBR_ERROR_NONE && aError != OTBR_ERROR_ABORTED)
+    {
+        // What is advertised for the host is unknown now, so it is published in full again.
+        mAdvertisedHosts.erase(aHostName);
+    }
+
+    if (aHasUpdate)
+    {
+        OnMdnsPublishResult(aUpdateId, aError);
+    }
+}
+
+bool AdvertisingProxy::IsServiceChanged(const AdvertisedHost &aHost, const Mdns::Publisher::HostedService &aService)
+{
+    auto lastService = aHost.mServices.find(ServiceKey(aService.mName, aService.mType));
+
+    return lastService == aHost.mServices.end() || lastService->second.mPort != aService.mPort ||
+           lastService->second.mSubTypeList != aService.mSubTypeList ||
+           lastService->second.mTxtData != aService.mTxtData;
+}
+
+int64_t AdvertisingProxy::GetWallClockSeconds(void)
+{
+    // The snapshot outlives the process, so the leases are kept in the wall clock instead of the steady clock.
+    return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+void AdvertisingProxy::RestoreSnapshot(void)
+{
+    otbrError             error;
+    SrpSnapshot::HostList hosts;
+    int64_t               now = GetWallClockSeconds();
+
+    mRestoredHosts.clear();
+
+    error = SrpSnapshot::Read(mSnapshotPath, hosts);
+    VerifyOrExit(error != OTBR_ERROR_NOT_FOUND, error = OTBR_ERROR_NONE);
+    SuccessOrExit(error);
+
+    for (SrpSnapshot::Host &host : hosts)
+    {
+        if (host.mExpireTime > now)
+        {
+            std::string name = host.mName;
+
+            mRestoredHosts.emplace(std::move(name), std::move(host));
+        }
+    }
+
+    otbrLogInfo("Restored %zu of %zu SRP hosts from snapshot", mRestoredHosts.size(), hosts.size());
+
+    if (mPublisher.IsStarted())
+    {
+        PublishRestoredHosts();
+    }
+
+    ExpireRestoredHosts();
+
+exit:
+    otbrLogResult(error, "Restore SRP snapshot %s", mSnapshotPath.c_str());
+}
+
+void AdvertisingProxy::PublishRestoredHosts(void)
+{
+    for (const auto &entry : mRestoredHosts)
+    {
+        const SrpSnapshot::Host &host = entry.second;
+        AdvertisedHost           advertisedHost;
+        std::string              hostName = host.mName;
+
+        advertisedHost.mAddresses = host.mAddresses;
+        for (const Mdns::Publisher::HostedService &service : host.mServices)
+        {
+            advertisedHost.mServices[ServiceKey(service.mName, service.mType)] = service;
+        }
+
+        // Recorded as advertised, so that only the changes are published when the SRP client registers again.
+        mAdvertisedHosts[hostName] = std::move(advertisedHost);
+
+        otbrLogDebug("Publish restored SRP host '%s' with %zu services", hostName.c_str(), host.mServices.size());
+        mPublisher.PublishHostAndServices(hostName, host.mAddresses, host.mServices,
+                                          [this, hostName](otbrError aError) {
+                                              otbrLogResult(aError, "Handle publish restored SRP host '%s'",
+                                                            hostName.c_str());
+                                              HandlePublishResult(hostName, /* aHasUpdate */ false, 0, aError);
+                                          });
+    }
+}
+
+void AdvertisingProxy::ExpireRestoredHosts(void)
+{
+    int64_t now        = GetWallClockSeconds();
+    int64_t nextExpiry = INT64_MAX;
+
+    mRestoredExpiryTaskId = 0;
+
+    for (auto it = mRestoredHosts.begin(); it != mRestoredHosts.end();)
+    {
+        if (it->second.mExpireTime > now)
+        {
+            nextExpiry = std::min(nextExpiry, it->second.mExpireTime);
+            ++it;
+            continue;
+        }
+
+        otbrLogInfo("Restored SRP host '%s' expired without registering again", it->first.c_str());
+        mAdvertisedHosts.erase(it->first);
+        if (mPublisher.IsStarted())
+        {
+            mPublisher.UnpublishHostAndServices(it->first, [](otbrError aError) { OTBR_UNUSED_VARIABLE(aError); });
+        }
+        it               = mRestoredHosts.erase(it);
+        mIsSnapshotDirty = true;
+    }
+
+    if (nextExpiry != INT64_MAX)
+    {
+        mRestoredExpiryTaskId =
+            mHost.PostTimerTask(std::chrono::seconds(nextExpiry - now), [this]() { ExpireRestoredHosts(); });
+    }
+}
+
+void AdvertisingProxy::WriteSnapshot(void)
+{
+    const otSrpServerHost *host = nullptr;
+    int64_t                now  = GetWallClockSeconds();
+    SrpSnapshot::HostList  hosts;
+
+    VerifyOrExit(!mSnapshotPath.empty() && mIsSnapshotDirty);
+
+    while ((host = otSrpServerGetNextHost(GetInstance(), host)))
+    {
+        std::string          hostName;
+        std::string          hostDomain;
+        otSrpServerLeaseInfo leaseInfo;
+        SrpSnapshot::Host    snapshotHost;
+
+        if (otSrpServerHostIsDeleted(host) ||
+            SplitFullHostName(otSrpServerHostGetFullName(host), hostName, hostDomain) != OTBR_ERROR_NONE)
+        {
+            continue;
+        }
+
+        // Only what has been advertised is restored.
+        auto advertisedHost = mAdvertisedHosts.find(hostName);
+
+        if (advertisedHost == mAdvertisedHosts.end())
+        {
+            continue;
+        }
+
+        otSrpServerHostGetLeaseInfo(host, &leaseInfo);
+
+        snapshotHost.mName       = hostName;
+        snapshotHost.mAddresses  = advertisedHost->second.mAddresses;
+        snapshotHost.mExpireTime = now + leaseInfo.mRemainingLease / 1000;
+        for (const auto &service : advertisedHost->second.mServices)
+        {
+            snapshotHost.mServices.push_back(service.second);
+        }
+        hosts.push_back(std::move(snapshotHost));
+    }
+
+    // The restored hosts which haven't registered again are kept until their leases expire.
+    for (const auto &entry : mRestoredHosts)
+    {
+        hosts.push_back(entry.second);
+    }
+
+    SuccessOrExit(SrpSnapshot::Write(mSnapshotPath, hosts));
+    mIsSnapshotDirty = false;
+    otbrLogDebug("Wrote %zu SRP hosts to snapshot", hosts.size());
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::HandleSnapshotTimer(void)
+{
+    WriteSnapshot();
+    mSnapshotTaskId = mHost.PostTimerTask(std::chrono::seconds(OTBR_CONFIG_SRP_SNAPSHOT_INTERVAL),
+                                          [this]() { HandleSnapshotTimer(); });
+}
+
 Mdns::Publisher::TxtData AdvertisingProxy::MakeTxtData(const otSrpServerService *aSrpService)
 {
     const uint8_t *data;
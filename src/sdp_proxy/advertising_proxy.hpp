@@ -40,17 +40,29 @@
 
 #include <stdint.h>
 
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
 #include <openthread/instance.h>
 #include <openthread/srp_server.h>
 
 #include "common/code_utils.hpp"
-#include "mdns/mdns.hpp"
+#include "common/dns_name_key.hpp"
+#include "common/time.hpp"
+#include "mdns/publisher_impl.hpp"
 #include "ncp/rcp_host.hpp"
+#include "sdp_proxy/srp_snapshot.hpp"
 
 namespace otbr {
 
 /**
  * This class implements the Advertising Proxy.
+ *
+ * The advertised hosts are saved to a snapshot periodically. After a restart, the hosts in the snapshot are
+ * advertised again until their SRP clients register again or their leases expire, so that the services don't
+ * disappear from the infrastructure link until every client has re-registered.
  */
 class AdvertisingProxy : private NonCopyable
 {
@@ -61,7 +73,7 @@ public:
      * @param[in] aHost       A reference to the NCP controller.
      * @param[in] aPublisher  A reference to the mDNS publisher.
      */
-    explicit AdvertisingProxy(Ncp::RcpHost &aHost, Mdns::Publisher &aPublisher);
+    explicit AdvertisingProxy(Ncp::RcpHost &aHost, Mdns::PublisherImpl &aPublisher);
 
     /**
      * This method enables/disables the Advertising Proxy.
@@ -72,6 +84,9 @@ public:
 
     /**
      * This method publishes all registered hosts and services.
+     *
+     * The hosts are published in batches, one batch per mainloop iteration, so that a large number of
+     * SRP hosts doesn't stall the mainloop. Calling this method again restarts the walk.
      */
     void PublishAllHostsAndServices(void);
 
@@ -82,12 +97,56 @@ public:
      */
     void HandleMdnsState(Mdns::Publisher::State aState);
 
+    /**
+     * This method finds the advertised instances of a service type, as they are discovered on mDNS.
+     *
+     * The instances are looked up in what was last advertised for the SRP hosts, including the hosts restored from
+     * the snapshot, without querying the mDNS publisher. The TTL of the instances is not set.
+     *
+     * @param[in]  aType          The service type, e.g. "_srv._udp".
+     * @param[in]  aInstanceName  The instance name, or empty for all the instances of @p aType.
+     * @param[out] aInstances     The instances found are appended to it.
+     */
+    void FindServiceInstances(const std::string                                    &aType,
+                              const std::string                                    &aInstanceName,
+                              std::vector<Mdns::Publisher::DiscoveredInstanceInfo> &aInstances) const;
+
+    /**
+     * This method finds an advertised host, as it is discovered on mDNS.
+     *
+     * The TTL of the host is not set.
+     *
+     * @param[in]  aHostName  The host name, without the domain.
+     * @param[out] aHostInfo  The host found.
+     *
+     * @retval TRUE   The host is advertised, @p aHostInfo is set.
+     * @retval FALSE  The host is not advertised.
+     */
+    bool FindHost(const std::string &aHostName, Mdns::Publisher::DiscoveredHostInfo &aHostInfo) const;
+
 private:
+    static constexpr uint32_t kRepublishBatchSize = 32; // The number of hosts published per mainloop iteration.
+
+    using ExpirationQueue = std::multimap<Timepoint, otSrpServerServiceUpdateId>;
+
     struct OutstandingUpdate
     {
         otSrpServerServiceUpdateId mId;                // The ID of the SRP service update transaction.
-        std::string                mHostName;          // The host name.
+        DnsNameKey                 mHostKey;           // The host name.
         uint32_t                   mCallbackCount = 0; // The number of callbacks which we are waiting for.
+        ExpirationQueue::iterator  mExpiration;        // The entry in `mUpdateExpirations`.
+    };
+
+    using OutstandingUpdateMap = std::unordered_map<otSrpServerServiceUpdateId, OutstandingUpdate>;
+
+    // The instance name and the type of a service.
+    using ServiceKey = std::pair<std::string, std::string>;
+
+    // What was last requested to be advertised for an SRP host.
+    struct AdvertisedHost
+    {
+        std::vector<Ip6Address>                              mAddresses; // The eligible addresses.
+        std::map<ServiceKey, Mdns::Publisher::HostedService> mServices;  // The services which are not deleted.
     };
 
     static void AdvertisingHandler(otSrpServerServiceUpdateId aId,
@@ -100,7 +159,31 @@ private:
     static Mdns::Publisher::SubTypeList MakeSubTypeList(const otSrpServerService *aSrpService);
     void                                OnMdnsPublishResult(otSrpServerServiceUpdateId aUpdateId, otbrError aError);
 
-    std::vector<Ip6Address> GetEligibleAddresses(const otIp6Address *aHostAddresses, uint8_t aHostAddressNum);
+    bool IsSuperseded(const OutstandingUpdate &aUpdate) const;
+    void CompleteUpdate(OutstandingUpdateMap::iterator aUpdate, otbrError aError);
+    void RemoveUpdate(OutstandingUpdateMap::iterator aUpdate);
+    void RemoveExpiredUpdates(void);
+    void HandlePublishResult(const std::string         &aHostName,
+                             bool                       aHasUpdate,
+                             otSrpServerServiceUpdateId aUpdateId,
+                             otbrError                  aError);
+
+    static bool IsServiceChanged(const AdvertisedHost &aHost, const Mdns::Publisher::HostedService &aService);
+
+    void              GetEligibleAddresses(const otIp6Address           *aHostAddresses,
+                                           uint8_t                       aHostAddressNum,
+                                           Mdns::Publisher::AddressList &aAddresses);
+    const Ip6Address &GetMeshLocalEid(void);
+
+    void PublishNextHosts(void);
+
+    static int64_t GetWallClockSeconds(void);
+
+    void RestoreSnapshot(void);
+    void PublishRestoredHosts(void);
+    void ExpireRestoredHosts(void);
+    void WriteSnapshot(void);
+    void HandleSnapshotTimer(void);
 
     void Start(void);
     void Stop(void);
@@ -109,7 +192,8 @@ private:
     /**
      * This method publishes a specified host and its services.
      *
-     * It also makes a OutstandingUpdate object when needed.
+     * Once the host has been advertised, only the changes since then are published, so that a lease
+     * renewal doesn't cause any mDNS operation. It also makes a OutstandingUpdate object when needed.
      *
      * @param[in]  aHost         A pointer to the host.
      * @param[in]  aUpdate       A pointer to the output OutstandingUpdate object. When it's not null, the method will
@@ -126,12 +210,42 @@ private:
     Ncp::RcpHost &mHost;
 
     // A reference to the mDNS publisher, has no ownership.
-    Mdns::Publisher &mPublisher;
+    Mdns::PublisherImpl &mPublisher;
 
     bool mIsEnabled;
 
-    // A vector that tracks outstanding updates.
-    std::vector<OutstandingUpdate> mOutstandingUpdates;
+    // The mesh-local EID, cached until the mesh-local prefix may have changed.
+    Ip6Address mMeshLocalEid;
+    bool       mIsMeshLocalEidValid;
+
+    // The outstanding updates indexed by their IDs.
+    OutstandingUpdateMap mOutstandingUpdates;
+
+    // The IDs of outstanding updates ordered by the time the SRP server gives up on them.
+    ExpirationQueue mUpdateExpirations;
+
+    // The ID of the latest outstanding update of each host.
+    std::unordered_map<DnsNameKey, otSrpServerServiceUpdateId, DnsNameKey::Hash> mLatestUpdateIds;
+
+    // What was last advertised for each host, to publish only the changes of later updates.
+    std::unordered_map<std::string, AdvertisedHost> mAdvertisedHosts;
+
+    // The full names of the hosts which have been published by the ongoing `PublishAllHostsAndServices`.
+    std::unordered_set<DnsNameKey, DnsNameKey::Hash> mRepublishedHosts;
+    Timepoint                                        mRepublishStartTime;
+    bool                                             mIsRepublishTaskPosted = false;
+
+    // The path of the snapshot of the advertised hosts, empty if no snapshot is kept.
+    std::string mSnapshotPath;
+
+    // Whether the advertised hosts have changed since the snapshot was written.
+    bool mIsSnapshotDirty = false;
+
+    // The hosts restored from the snapshot which haven't been registered again, indexed by their names.
+    std::unordered_map<std::string, SrpSnapshot::Host> mRestoredHosts;
+
+    TaskRunner::TaskId mSnapshotTaskId       = 0;
+    TaskRunner::TaskId mRestoredExpiryTaskId = 0;
 };
 
 } // namespace otbr
@@ -48,17 +48,11 @@
 #include "common/dns_utils.hpp"
 #include "common/logging.hpp"
 #include "utils/dns_utils.hpp"
-#include "utils/string_utils.hpp"
 
 namespace otbr {
 namespace Dnssd {
 
-static inline bool DnsLabelsEqual(const std::string &aLabel1, const std::string &aLabel2)
-{
-    return StringUtils::EqualCaseInsensitive(aLabel1, aLabel2);
-}
-
-DiscoveryProxy::DiscoveryProxy(Ncp::RcpHost &aHost, Mdns::Publisher &aPublisher)
+DiscoveryProxy::DiscoveryProxy(Ncp::RcpHost &aHost, Mdns::PublisherImpl &aPublisher)
     : mHost(aHost)
     , mMdnsPublisher(aPublisher)
     , mIsEnabled(false)
@@ -98,6 +92,10 @@ void DiscoveryProxy::Start(void)
             {
                 OnServiceDiscovered(aType, aInstanceInfo);
             }
+            else
+            {
+                RemoveCachedInstance(aType, DnsUtils::UnescapeInstanceName(aInstanceInfo.mName));
+            }
         },
 
         [this](const std::string &aHostName, const Mdns::Publisher::DiscoveredHostInfo &aHostInfo) {
@@ -117,6 +115,17 @@ void DiscoveryProxy::Stop(void)
         mSubscriberId = 0;
     }
 
+    for (const auto &subscription : mSubscriptions)
+    {
+        if (subscription.second.mIsMdnsSubscribed)
+        {
+            UnsubscribeMdns(subscription.second.mNameInfo);
+        }
+    }
+
+    mSubscriptions.clear();
+    mAnswerCache.clear();
+
     otbrLogInfo("Stopped");
 }
 
@@ -127,22 +136,57 @@ void DiscoveryProxy::OnDiscoveryProxySubscribe(void *aContext, const char *aFull
 
 void DiscoveryProxy::OnDiscoveryProxySubscribe(const char *aFullName)
 {
-    std::string fullName(aFullName);
-    DnsNameInfo nameInfo = SplitFullDnsName(fullName);
+    std::string   fullName(aFullName);
+    DnsNameInfo   nameInfo     = SplitFullDnsName(fullName);
+    DnsNameKey    queryKey     = DnsNameKey::Find(fullName);
+    Subscription &subscription = mSubscriptions[MakeSubscriptionKey(nameInfo)];
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    std::vector<Mdns::Publisher::DiscoveredInstanceInfo> localInstances;
+    Mdns::Publisher::DiscoveredHostInfo                  localHostInfo;
+#endif
 
     otbrLogInfo("Subscribe: %s", fullName.c_str());
 
-    if (GetServiceSubscriptionCount(nameInfo) == 1)
+    subscription.mQueryCount++;
+    subscription.mNameInfo = nameInfo;
+    subscription.mLingerId = 0;
+
+    RemoveExpiredAnswers();
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    if (FindLocalAnswer(nameInfo, localInstances, localHostInfo))
     {
-        if (nameInfo.mHostName.empty())
-        {
-            mMdnsPublisher.SubscribeService(nameInfo.mServiceName, nameInfo.mInstanceName);
-        }
-        else
-        {
-            mMdnsPublisher.SubscribeHost(nameInfo.mHostName);
-        }
+        // Answered once OpenThread is done with setting up the query, without a round trip through the mDNS daemon.
+        otbrLogInfo("Answer %s from the SRP registrations", fullName.c_str());
+        mHost.PostTimerTask(Milliseconds(0), [this, nameInfo]() { ServeLocalAnswer(nameInfo); });
+
+        // Other instances of a browsed service may be on the infrastructure link.
+        VerifyOrExit(nameInfo.IsService());
+    }
+#endif
+
+    if (mAnswerCache.find(queryKey) != mAnswerCache.end())
+    {
+        // Answered once OpenThread is done with setting up the query.
+        otbrLogInfo("Answer %s from the cache", fullName.c_str());
+        mHost.PostTimerTask(Milliseconds(0), [this, queryKey]() { ServeCachedAnswer(queryKey); });
+        ExitNow();
+    }
+
+    VerifyOrExit(!subscription.mIsMdnsSubscribed);
+    subscription.mIsMdnsSubscribed = true;
+
+    if (nameInfo.mHostName.empty())
+    {
+        mMdnsPublisher.SubscribeService(nameInfo.mServiceName, nameInfo.mInstanceName);
     }
+    else
+    {
+        mMdnsPublisher.SubscribeHost(nameInfo.mHostName);
+    }
+
+exit:
+    return;
 }
 
 void DiscoveryProxy::OnDiscoveryProxyUnsubscribe(void *aContext, const char *aFullName)
@@ -153,20 +197,48 @@ void DiscoveryProxy::OnDiscoveryProxyUnsubscribe(void *aContext, const char *aFu
 void DiscoveryProxy::OnDiscoveryProxyUnsubscribe(const char *aFullName)
 {
     std::string fullName(aFullName);
-    DnsNameInfo nameInfo = SplitFullDnsName(fullName);
+    DnsNameKey  key          = MakeSubscriptionKey(SplitFullDnsName(fullName));
+    auto        subscription = mSubscriptions.find(key);
+    uint64_t    lingerId;
 
     otbrLogInfo("Unsubscribe: %s", fullName.c_str());
 
-    if (GetServiceSubscriptionCount(nameInfo) == 1)
+    VerifyOrExit(subscription != mSubscriptions.end() && subscription->second.mQueryCount > 0);
+    VerifyOrExit(--subscription->second.mQueryCount == 0);
+
+    if (!subscription->second.mIsMdnsSubscribed)
     {
-        if (nameInfo.mHostName.empty())
-        {
-            mMdnsPublisher.UnsubscribeService(nameInfo.mServiceName, nameInfo.mInstanceName);
-        }
-        else
+        // All the queries have been answered from the cache.
+        mSubscriptions.erase(subscription);
+        ExitNow();
+    }
+
+    // The mDNS subscription lingers, so that repeated short-lived queries don't restart it.
+    lingerId                       = ++mLastLingerId;
+    subscription->second.mLingerId = lingerId;
+    mHost.PostTimerTask(Milliseconds(kSubscriptionLingerTime), [this, key, lingerId]() {
+        auto lingering = mSubscriptions.find(key);
+
+        if (lingering != mSubscriptions.end() && lingering->second.mLingerId == lingerId)
         {
-            mMdnsPublisher.UnsubscribeHost(nameInfo.mHostName);
+            UnsubscribeMdns(lingering->second.mNameInfo);
+            mSubscriptions.erase(lingering);
         }
+    });
+
+exit:
+    return;
+}
+
+void DiscoveryProxy::UnsubscribeMdns(const DnsNameInfo &aNameInfo)
+{
+    if (aNameInfo.mHostName.empty())
+    {
+        mMdnsPublisher.UnsubscribeService(aNameInfo.mServiceName, aNameInfo.mInstanceName);
+    }
+    else
+    {
+        mMdnsPublisher.UnsubscribeHost(aNameInfo.mHostName);
     }
 }
 
@@ -202,10 +274,9 @@ void DiscoveryProxy::OnServiceDiscovered(const std::string
 
     while ((query = otDnssdGetNextQuery(mHost.GetInstance(), query)) != nullptr)
     {
-        std::string      instanceName;
-        std::string      serviceName;
-        std::string      hostName;
-        std::string      domain;
+        StringView       instanceName;
+        StringView       serviceName;
+        StringView       domain;
         char             queryName[OT_DNS_MAX_NAME_SIZE];
         otDnssdQueryType type = otDnssdGetQueryTypeAndName(query, &queryName);
         otbrError        splitError;
@@ -213,10 +284,10 @@ void DiscoveryProxy::OnServiceDiscovered(const std::string
         switch (type)
         {
         case OT_DNSSD_QUERY_TYPE_BROWSE:
-            splitError = SplitFullServiceName(queryName, serviceName, domain);
+            splitError = SplitFullServiceName(StringView(queryName), serviceName, domain);
             break;
         case OT_DNSSD_QUERY_TYPE_RESOLVE:
-            splitError = SplitFullServiceInstanceName(queryName, instanceName, serviceName, domain);
+            splitError = SplitFullServiceInstanceName(StringView(queryName), instanceName, serviceName, domain);
             break;
         default:
             splitError = OTBR_ERROR_NOT_FOUND;
@@ -229,11 +300,24 @@ void DiscoveryProxy::OnServiceDiscovered(const std::string
         }
 
         if (DnsLabelsEqual(serviceName, aType) &&
-            (instanceName.empty() || DnsLabelsEqual(instanceName, unescapedInstanceName)))
+            (instanceName.IsEmpty() || DnsLabelsEqual(instanceName, unescapedInstanceName)))
         {
-            std::string serviceFullName    = aType + "." + domain;
-            std::string translatedHostName = TranslateDomain(aInstanceInfo.mHostName, domain);
-            std::string instanceFullName   = unescapedInstanceName + "." + serviceFullName;
+            std::string   serviceFullName    = aType + "." + domain.ToString() + ".";
+            std::string   translatedHostName = TranslateDomain(aInstanceInfo.mHostName, domain);
+            std::string   instanceFullName   = unescapedInstanceName + "." + serviceFullName;
+            CachedAnswer &answer             = mAnswerCache[DnsNameKey::Intern(queryName)];
+            CachedRecord &record             = FindOrAddRecord(answer, instanceFullName);
+
+            answer.mServiceType     = aType;
+            answer.mServiceFullName = serviceFullName;
+            record.mInstanceName    = unescapedInstanceName;
+            record.mHostName        = translatedHostName;
+            record.mAddresses       = aInstanceInfo.mAddresses;
+            record.mPort            = aInstanceInfo.mPort;
+            record.mPriority        = aInstanceInfo.mPriority;
+            record.mWeight          = aInstanceInfo.mWeight;
+            record.mTxtData         = aInstanceInfo.mTxtData;
+            record.mExpireTime      = Clock::now() + std::chrono::seconds(instanceInfo.mTtl);
 
             instanceInfo.mFullName = instanceFullName.c_str();
             instanceInfo.mHostName = translatedHostName.c_str();
@@ -272,7 +356,8 @@ void DiscoveryProxy::OnHostDiscovered(const std::string
 
     while ((query = otDnssdGetNextQuery(mHost.GetInstance(), query)) != nullptr)
     {
-        std::string      hostName, domain;
+        StringView       hostName;
+        StringView       domain;
         char             queryName[OT_DNS_MAX_NAME_SIZE];
         otDnssdQueryType type = otDnssdGetQueryTypeAndName(query, &queryName);
         otbrError        splitError;
@@ -284,7 +369,7 @@ void DiscoveryProxy::OnHostDiscovered(const std::string
             continue;
         }
 
-        splitError = SplitFullHostName(queryName, hostName, domain);
+        splitError = SplitFullHostName(StringView(queryName), hostName, domain);
 
         if (splitError != OTBR_ERROR_NONE)
         {
@@ -293,54 +378,225 @@ void DiscoveryProxy::OnHostDiscovered(const std::string
 
         if (DnsLabelsEqual(hostName, aHostName))
         {
-            std::string hostFullName = TranslateDomain(resolvedHostName, domain);
+            std::string   hostFullName = TranslateDomain(resolvedHostName, domain);
+            CachedAnswer &answer       = mAnswerCache[DnsNameKey::Intern(queryName)];
+            CachedRecord &record       = FindOrAddRecord(answer, hostFullName);
+
+            record.mAddresses  = aHostInfo.mAddresses;
+            record.mExpireTime = Clock::now() + std::chrono::seconds(hostInfo.mTtl);
 
             otDnssdQueryHandleDiscoveredHost(mHost.GetInstance(), hostFullName.c_str(), &hostInfo);
         }
     }
 }
 
-std::string DiscoveryProxy::TranslateDomain(const std::string &aName, const std::string &aTargetDomain)
+std::string DiscoveryProxy::TranslateDomain(const std::string &aName, StringView aTargetDomain)
 {
     std::string targetName;
-    std::string hostName;
-    std::string domain;
+    StringView  hostName;
+    StringView  domain;
 
-    VerifyOrExit(OTBR_ERROR_NONE == SplitFullHostName(aName, hostName, domain), targetName = aName);
-    VerifyOrExit(DnsLabelsEqual(domain, "local."), targetName = aName);
+    VerifyOrExit(OTBR_ERROR_NONE == SplitFullHostName(StringView(aName), hostName, domain), targetName = aName);
+    VerifyOrExit(DnsNamesEqual(domain, "local"), targetName = aName);
 
-    targetName = hostName + "." + aTargetDomain;
+    targetName.reserve(hostName.Size() + aTargetDomain.Size() + 2);
+    targetName.append(hostName.Data(), hostName.Size());
+    targetName += '.';
+    targetName.append(aTargetDomain.Data(), aTargetDomain.Size());
+    if (!aTargetDomain.EndsWith('.'))
+    {
+        targetName += '.';
+    }
 
 exit:
     otbrLogDebug("Translate domain: %s => %s", aName.c_str(), targetName.c_str());
     return targetName;
 }
 
-int DiscoveryProxy::GetServiceSubscriptionCount(const DnsNameInfo &aNameInfo) const
+uint32_t DiscoveryProxy::CapTtl(uint32_t aTtl)
 {
-    const otDnssdQuery *query = nullptr;
-    int                 count = 0;
+    return std::min(aTtl, static_cast<uint32_t>(kServiceTtlCapLimit));
+}
 
-    while ((query = otDnssdGetNextQuery(mHost.GetInstance(), query)) != nullptr)
+DnsNameKey DiscoveryProxy::MakeSubscriptionKey(const DnsNameInfo &aNameInfo)
+{
+    return DnsNameKey::Intern(aNameInfo.mHostName + "|" + aNameInfo.mInstanceName, aNameInfo.mServiceName, '|');
+}
+
+DiscoveryProxy::CachedRecord &DiscoveryProxy::FindOrAddRecord(CachedAnswer &aAnswer, const std::string &aFullName)
+{
+    auto record = std::find_if(
+        aAnswer.mRecords.begin(), aAnswer.mRecords.end(),
+        [&aFullName](const CachedRecord &aRecord) { return DnsLabelsEqual(aRecord.mFullName, aFullName); });
+
+    if (record == aAnswer.mRecords.end())
     {
-        char        queryName[OT_DNS_MAX_NAME_SIZE];
-        DnsNameInfo queryInfo;
+        aAnswer.mRecords.emplace_back();
+        record            = std::prev(aAnswer.mRecords.end());
+        record->mFullName = aFullName;
+    }
+
+    return *record;
+}
 
-        otDnssdGetQueryTypeAndName(query, &queryName);
-        queryInfo = SplitFullDnsName(queryName);
+void DiscoveryProxy::RemoveCachedInstance(const std::string &aType, const std::string &aInstanceName)
+{
+    for (auto &entry : mAnswerCache)
+    {
+        std::vector<CachedRecord> &records = entry.second.mRecords;
 
-        count += (DnsLabelsEqual(aNameInfo.mInstanceName, queryInfo.mInstanceName) &&
-                  DnsLabelsEqual(aNameInfo.mServiceName, queryInfo.mServiceName) &&
-                  DnsLabelsEqual(aNameInfo.mHostName, queryInfo.mHostName));
+        if (!DnsLabelsEqual(entry.second.mServiceType, aType))
+        {
+            continue;
+        }
+
+        records.erase(std::remove_if(records.begin(), records.end(),
+                                     [&aInstanceName](const CachedRecord &aRecord) {
+                                         return DnsLabelsEqual(aRecord.mInstanceName, aInstanceName);
+                                     }),
+                      records.end());
     }
 
-    return count;
+    RemoveExpiredAnswers();
 }
 
-uint32_t DiscoveryProxy::CapTtl(uint32_t aTtl)
+void DiscoveryProxy::RemoveExpiredAnswers(void)
 {
-    return std::min(aTtl, static_cast<uint32_t>(kServiceTtlCapLimit));
+    Timepoint now = Clock::now();
+
+    for (auto entry = mAnswerCache.begin(); entry != mAnswerCache.end();)
+    {
+        std::vector<CachedRecord> &records = entry->second.mRecords;
+
+        records.erase(std::remove_if(records.begin(), records.end(),
+                                     [now](const CachedRecord &aRecord) { return aRecord.mExpireTime <= now; }),
+                      records.end());
+
+        if (records.empty())
+        {
+            entry = mAnswerCache.erase(entry);
+        }
+        else
+        {
+            ++entry;
+        }
+    }
+}
+
+void DiscoveryProxy::ServeCachedAnswer(const DnsNameKey &aQueryKey)
+{
+    auto         entry = mAnswerCache.find(aQueryKey);
+    Timepoint    now   = Clock::now();
+    CachedAnswer answer;
+
+    VerifyOrExit(IsEnabled() && entry != mAnswerCache.end());
+
+    // Copied because answering may end queries and so modify the cache.
+    answer = entry->second;
+
+    for (const CachedRecord &record : answer.mRecords)
+    {
+        const otIp6Address *addresses = record.mAddresses.empty()
+                                            ? nullptr
+                                            : reinterpret_cast<const otIp6Address *>(&record.mAddresses[0]);
+        uint32_t            ttl;
+
+        if (record.mExpireTime <= now)
+        {
+            continue;
+        }
+
+        // The remaining TTL is rounded up, so that a valid answer never has a zero TTL.
+        ttl = static_cast<uint32_t>((std::chrono::duration_cast<Milliseconds>(record.mExpireTime - now).count() + 999) /
+                                    1000);
+
+        if (answer.mServiceType.empty())
+        {
+            otDnssdHostInfo hostInfo;
+
+            hostInfo.mAddressNum = record.mAddresses.size();
+            hostInfo.mAddresses  = addresses;
+            hostInfo.mTtl        = ttl;
+
+            otDnssdQueryHandleDiscoveredHost(mHost.GetInstance(), record.mFullName.c_str(), &hostInfo);
+        }
+        else
+        {
+            otDnssdServiceInstanceInfo instanceInfo;
+
+            instanceInfo.mFullName   = record.mFullName.c_str();
+            instanceInfo.mHostName   = record.mHostName.c_str();
+            instanceInfo.mAddressNum = record.mAddresses.size();
+            instanceInfo.mAddresses  = addresses;
+            instanceInfo.mPort       = record.mPort;
+            instanceInfo.mPriority   = record.mPriority;
+            instanceInfo.mWeight     = record.mWeight;
+            instanceInfo.mTxtLength  = static_cast<uint16_t>(record.mTxtData.size());
+            instanceInfo.mTxtData    = record.mTxtData.data();
+            instanceInfo.mTtl        = ttl;
+
+            otDnssdQueryHandleDiscoveredServiceInstance(mHost.GetInstance(), answer.mServiceFullName.c_str(),
+                                                        &instanceInfo);
+        }
+    }
+
+exit:
+    return;
+}
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+bool DiscoveryProxy::FindLocalAnswer(const DnsNameInfo                                    &aNameInfo,
+                                     std::vector<Mdns::Publisher::DiscoveredInstanceInfo> &aInstances,
+                                     Mdns::Publisher::DiscoveredHostInfo                  &aHostInfo) const
+{
+    bool found = false;
+
+    VerifyOrExit(mAdvertisingProxy != nullptr);
+
+    if (aNameInfo.mHostName.empty())
+    {
+        mAdvertisingProxy->FindServiceInstances(aNameInfo.mServiceName, aNameInfo.mInstanceName, aInstances);
+        for (Mdns::Publisher::DiscoveredInstanceInfo &instance : aInstances)
+        {
+            instance.mTtl = kServiceTtlCapLimit;
+        }
+        found = !aInstances.empty();
+    }
+    else
+    {
+        found          = mAdvertisingProxy->FindHost(aNameInfo.mHostName, aHostInfo);
+        aHostInfo.mTtl = kServiceTtlCapLimit;
+    }
+
+exit:
+    return found;
+}
+
+void DiscoveryProxy::ServeLocalAnswer(const DnsNameInfo &aNameInfo)
+{
+    std::vector<Mdns::Publisher::DiscoveredInstanceInfo> instances;
+    Mdns::Publisher::DiscoveredHostInfo                  hostInfo;
+
+    // Looked up again, as the SRP registrations may have changed since the query was subscribed.
+    VerifyOrExit(IsEnabled() && FindLocalAnswer(aNameInfo, instances, hostInfo));
+
+    // Answered as if discovered on mDNS, so that the answers are translated and cached the same way.
+    if (aNameInfo.mHostName.empty())
+    {
+        for (const Mdns::Publisher::DiscoveredInstanceInfo &instance : instances)
+        {
+            OnServiceDiscovered(aNameInfo.mServiceName, instance);
+        }
+    }
+    else
+    {
+        OnHostDiscovered(aNameInfo.mHostName, hostInfo);
+    }
+
+exit:
+    return;
 }
+#endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
 
 } // namespace Dnssd
 } // namespace otbr
@@ -39,16 +39,24 @@
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
 
 #include <set>
+#include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <stdint.h>
 
 #include <openthread/dnssd_server.h>
 #include <openthread/instance.h>
 
+#include "common/dns_name_key.hpp"
 #include "common/dns_utils.hpp"
-#include "mdns/mdns.hpp"
+#include "common/time.hpp"
+#include "mdns/publisher_impl.hpp"
 #include "ncp/rcp_host.hpp"
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+#include "sdp_proxy/advertising_proxy.hpp"
+#endif
 
 namespace otbr {
 namespace Dnssd {
@@ -65,7 +73,7 @@ public:
      * @param[in] aHost       A reference to the OpenThread Controller instance.
      * @param[in] aPublisher  A reference to the mDNS Publisher.
      */
-    explicit DiscoveryProxy(Ncp::RcpHost &aHost, Mdns::Publisher &aPublisher);
+    explicit DiscoveryProxy(Ncp::RcpHost &aHost, Mdns::PublisherImpl &aPublisher);
 
     /**
      * This method enables/disables the Discovery Proxy.
@@ -74,6 +82,19 @@ public:
      */
     void SetEnabled(bool aIsEnabled);
 
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    /**
+     * This method sets the Advertising Proxy whose SRP hosts and services are answered locally.
+     *
+     * A query for a host or a service instance advertised by the Advertising Proxy is answered from it, without
+     * subscribing to the mDNS publisher. A query for a service type is answered from it too, and still subscribed
+     * for the instances on the infrastructure link.
+     *
+     * @param[in] aAdvertisingProxy  A pointer to the Advertising Proxy, or nullptr to only answer from mDNS.
+     */
+    void SetAdvertisingProxy(const AdvertisingProxy *aAdvertisingProxy) { mAdvertisingProxy = aAdvertisingProxy; }
+#endif
+
     /**
      * This method handles mDNS publisher's state changes.
      *
@@ -90,28 +111,85 @@ public:
 private:
     enum : uint32_t
     {
-        kServiceTtlCapLimit = 10, // TTL cap limit for Discovery Proxy (in seconds).
+        kServiceTtlCapLimit     = 10,   // TTL cap limit for Discovery Proxy (in seconds).
+        kSubscriptionLingerTime = 5000, // How long an mDNS subscription outlives its last query (in milliseconds).
+    };
+
+    // The Thread-side queries of a service, an instance or a host.
+    struct Subscription
+    {
+        DnsNameInfo mNameInfo;
+        uint32_t    mQueryCount       = 0;     // The number of OpenThread queries.
+        bool        mIsMdnsSubscribed = false; // Whether the mDNS publisher is subscribed.
+        uint64_t    mLingerId         = 0;     // Identifies the pending un-subscription, 0 if none.
+    };
+
+    // A translated answer to a Thread-side query, i.e. a service instance or a host.
+    struct CachedRecord
+    {
+        std::string             mInstanceName; // The unescaped mDNS instance name, empty for a host.
+        std::string             mFullName;     // The translated full name of the instance or host.
+        std::string             mHostName;     // The translated host name of the instance.
+        std::vector<Ip6Address> mAddresses;
+        uint16_t                mPort     = 0;
+        uint16_t                mPriority = 0;
+        uint16_t                mWeight   = 0;
+        std::vector<uint8_t>    mTxtData;
+        Timepoint               mExpireTime;
+    };
+
+    // The cached answers to a Thread-side query name.
+    struct CachedAnswer
+    {
+        std::string               mServiceType;     // The mDNS service type, empty for a host query.
+        std::string               mServiceFullName; // The translated service full name.
+        std::vector<CachedRecord> mRecords;
     };
 
     static void        OnDiscoveryProxySubscribe(void *aContext, const char *aFullName);
     void               OnDiscoveryProxySubscribe(const char *aSubscription);
     static void        OnDiscoveryProxyUnsubscribe(void *aContext, const char *aFullName);
     void               OnDiscoveryProxyUnsubscribe(const char *aSubscription);
-    int                GetServiceSubscriptionCount(const DnsNameInfo &aNameInfo) const;
-    static std::string TranslateDomain(const std::string &aName, const std::string &aTargetDomain);
+    void               UnsubscribeMdns(const DnsNameInfo &aNameInfo);
+    static std::string TranslateDomain(const std::string &aName, StringView aTargetDomain);
     void               OnServiceDiscovered(const std::string                             &aSubscription,
                                            const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo);
     void OnHostDiscovered(const std::string &aHostName, const Mdns::Publisher::DiscoveredHostInfo &aHostInfo);
     static uint32_t CapTtl(uint32_t aTtl);
 
+    static DnsNameKey    MakeSubscriptionKey(const DnsNameInfo &aNameInfo);
+    static CachedRecord &FindOrAddRecord(CachedAnswer &aAnswer, const std::string &aFullName);
+    void                 RemoveCachedInstance(const std::string &aType, const std::string &aInstanceName);
+    void                 RemoveExpiredAnswers(void);
+    void                 ServeCachedAnswer(const DnsNameKey &aQueryKey);
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    bool FindLocalAnswer(const DnsNameInfo                                    &aNameInfo,
+                         std::vector<Mdns::Publisher::DiscoveredInstanceInfo> &aInstances,
+                         Mdns::Publisher::DiscoveredHostInfo                  &aHostInfo) const;
+    void ServeLocalAnswer(const DnsNameInfo &aNameInfo);
+#endif
+
     void Start(void);
     void Stop(void);
     bool IsEnabled(void) const { return mIsEnabled; }
 
-    Ncp::RcpHost    &mHost;
-    Mdns::Publisher &mMdnsPublisher;
-    bool             mIsEnabled;
-    uint64_t         mSubscriberId = 0;
+    Ncp::RcpHost        &mHost;
+    Mdns::PublisherImpl &mMdnsPublisher;
+    bool                 mIsEnabled;
+    uint64_t             mSubscriberId = 0;
+
+    // The subscriptions keyed by `MakeSubscriptionKey`.
+    std::unordered_map<DnsNameKey, Subscription, DnsNameKey::Hash> mSubscriptions;
+    uint64_t                                                       mLastLingerId = 0;
+
+    // The translated answers keyed by the query name, each valid for its capped TTL.
+    std::unordered_map<DnsNameKey, CachedAnswer, DnsNameKey::Hash> mAnswerCache;
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    // The Advertising Proxy answering the queries of the local SRP hosts and services, has no ownership.
+    const AdvertisingProxy *mAdvertisingProxy = nullptr;
+#endif
 };
 
 } // namespace Dnssd
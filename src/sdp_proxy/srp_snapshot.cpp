@@ -0,0 +1,315 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the snapshot of the SRP hosts advertised by the Advertising Proxy.
+ */
+
+#define OTBR_LOG_TAG "ADPROXY"
+
+#include "sdp_proxy/srp_snapshot.hpp"
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+namespace {
+
+// The file starts with the magic, which is changed with the format.
+constexpr char kMagic[] = "OTBRSRP1";
+
+class Encoder
+{
+public:
+    void AppendUint8(uint8_t aValue) { mBuffer.push_back(aValue); }
+
+    void AppendUint16(uint16_t aValue)
+    {
+        AppendUint8(static_cast<uint8_t>(aValue >> 8));
+        AppendUint8(static_cast<uint8_t>(aValue & 0xff));
+    }
+
+    void AppendUint64(uint64_t aValue)
+    {
+        for (int shift = 56; shift >= 0; shift -= 8)
+        {
+            AppendUint8(static_cast<uint8_t>(aValue >> shift));
+        }
+    }
+
+    void AppendBytes(const uint8_t *aBytes, size_t aLength) { mBuffer.insert(mBuffer.end(), aBytes, aBytes + aLength); }
+
+    // Values longer than 64KiB can't be in a DNS message, so they can't be registered either.
+    void AppendString(const std::string &aString)
+    {
+        AppendUint16(static_cast<uint16_t>(aString.size()));
+        AppendBytes(reinterpret_cast<const uint8_t *>(aString.data()), aString.size());
+    }
+
+    const std::vector<uint8_t> &GetBuffer(void) const { return mBuffer; }
+
+private:
+    std::vector<uint8_t> mBuffer;
+};
+
+class Decoder
+{
+public:
+    explicit Decoder(const std::vector<uint8_t> &aBuffer)
+        : mBuffer(aBuffer)
+        , mOffset(0)
+    {
+    }
+
+    bool ReadUint8(uint8_t &aValue) { return ReadBytes(&aValue, sizeof(aValue)); }
+
+    bool ReadUint16(uint16_t &aValue)
+    {
+        uint8_t bytes[2];
+        bool    succeeded = ReadBytes(bytes, sizeof(bytes));
+
+        aValue = static_cast<uint16_t>(bytes[0] << 8 | bytes[1]);
+        return succeeded;
+    }
+
+    bool ReadUint64(uint64_t &aValue)
+    {
+        uint8_t bytes[8];
+        bool    succeeded = ReadBytes(bytes, sizeof(bytes));
+
+        aValue = 0;
+        for (uint8_t byte : bytes)
+        {
+            aValue = (aValue << 8) | byte;
+        }
+        return succeeded;
+    }
+
+    bool ReadBytes(uint8_t *aBytes, size_t aLength)
+    {
+        bool succeeded = (mBuffer.size() - mOffset >= aLength);
+
+        if (succeeded)
+        {
+            memcpy(aBytes, mBuffer.data() + mOffset, aLength);
+            mOffset += aLength;
+        }
+        else
+        {
+            memset(aBytes, 0, aLength);
+        }
+        return succeeded;
+    }
+
+    bool ReadString(std::string &aString)
+    {
+        uint16_t length;
+        bool     succeeded = ReadUint16(length) && mBuffer.size() - mOffset >= length;
+
+        if (succeeded)
+        {
+            aString.assign(reinterpret_cast<const char *>(mBuffer.data() + mOffset), length);
+            mOffset += length;
+        }
+        return succeeded;
+    }
+
+    bool IsDone(void) const { return mOffset == mBuffer.size(); }
+
+private:
+    const std::vector<uint8_t> &mBuffer;
+    size_t                      mOffset;
+};
+
+void EncodeHost(Encoder &aEncoder, const SrpSnapshot::Host &aHost)
+{
+    aEncoder.AppendString(aHost.mName);
+    aEncoder.AppendUint64(static_cast<uint64_t>(aHost.mExpireTime));
+
+    aEncoder.AppendUint8(static_cast<uint8_t>(aHost.mAddresses.size()));
+    for (const Ip6Address &address : aHost.mAddresses)
+    {
+        aEncoder.AppendBytes(address.m8, sizeof(address.m8));
+    }
+
+    aEncoder.AppendUint16(static_cast<uint16_t>(aHost.mServices.size()));
+    for (const Mdns::Publisher::HostedService &service : aHost.mServices)
+    {
+        aEncoder.AppendString(service.mName);
+        aEncoder.AppendString(service.mType);
+        aEncoder.AppendUint8(static_cast<uint8_t>(service.mSubTypeList.size()));
+        for (const std::string &subType : service.mSubTypeList)
+        {
+            aEncoder.AppendString(subType);
+        }
+        aEncoder.AppendUint16(service.mPort);
+        aEncoder.AppendUint16(static_cast<uint16_t>(service.mTxtData.size()));
+        aEncoder.AppendBytes(service.mTxtData.data(), service.mTxtData.size());
+    }
+}
+
+otbrError DecodeHost(Decoder &aDecoder, SrpSnapshot::Host &aHost)
+{
+    otbrError error = OTBR_ERROR_PARSE;
+    uint64_t  expireTime;
+    uint8_t   numAddresses;
+    uint16_t  numServices;
+
+    VerifyOrExit(aDecoder.ReadString(aHost.mName));
+    VerifyOrExit(aDecoder.ReadUint64(expireTime));
+    aHost.mExpireTime = static_cast<int64_t>(expireTime);
+
+    VerifyOrExit(aDecoder.ReadUint8(numAddresses));
+    aHost.mAddresses.resize(numAddresses);
+    for (Ip6Address &address : aHost.mAddresses)
+    {
+        VerifyOrExit(aDecoder.ReadBytes(address.m8, sizeof(address.m8)));
+    }
+
+    VerifyOrExit(aDecoder.ReadUint16(numServices));
+    aHost.mServices.resize(numServices);
+    for (Mdns::Publisher::HostedService &service : aHost.mServices)
+    {
+        uint8_t  numSubTypes;
+        uint16_t txtLength;
+
+        VerifyOrExit(aDecoder.ReadString(service.mName));
+        VerifyOrExit(aDecoder.ReadString(service.mType));
+        VerifyOrExit(aDecoder.ReadUint8(numSubTypes));
+        service.mSubTypeList.resize(numSubTypes);
+        for (std::string &subType : service.mSubTypeList)
+        {
+            VerifyOrExit(aDecoder.ReadString(subType));
+        }
+        VerifyOrExit(aDecoder.ReadUint16(service.mPort));
+        VerifyOrExit(aDecoder.ReadUint16(txtLength));
+        service.mTxtData.resize(txtLength);
+        VerifyOrExit(aDecoder.ReadBytes(service.mTxtData.data(), txtLength));
+    }
+
+    error = OTBR_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+} // namespace
+
+otbrError SrpSnapshot::Write(const std::string &aPath, const HostList &aHosts)
+{
+    otbrError   error   = OTBR_ERROR_NONE;
+    std::string tmpPath = aPath + ".tmp";
+    FILE       *file    = nullptr;
+    Encoder     encoder;
+
+    encoder.AppendBytes(reinterpret_cast<const uint8_t *>(kMagic), sizeof(kMagic) - 1);
+    encoder.AppendUint16(static_cast<uint16_t>(aHosts.size()));
+    for (const Host &host : aHosts)
+    {
+        EncodeHost(encoder, host);
+    }
+
+    // Written to a temporary file renamed over the snapshot, so that a crash leaves either snapshot intact.
+    file = fopen(tmpPath.c_str(), "wb");
+    VerifyOrExit(file != nullptr, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(fwrite(encoder.GetBuffer().data(), 1, encoder.GetBuffer().size(), file) == encoder.GetBuffer().size(),
+                 error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(fflush(file) == 0 && fsync(fileno(file)) == 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(fclose(file) == 0, file = nullptr, error = OTBR_ERROR_ERRNO);
+    file = nullptr;
+    VerifyOrExit(rename(tmpPath.c_str(), aPath.c_str()) == 0, error = OTBR_ERROR_ERRNO);
+
+exit:
+    if (file != nullptr)
+    {
+        fclose(file);
+    }
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to write SRP snapshot %s: %s", aPath.c_str(), strerror(errno));
+        unlink(tmpPath.c_str());
+    }
+    return error;
+}
+
+otbrError SrpSnapshot::Read(const std::string &aPath, HostList &aHosts)
+{
+    otbrError            error = OTBR_ERROR_NONE;
+    FILE                *file  = fopen(aPath.c_str(), "rb");
+    std::vector<uint8_t> buffer;
+    uint8_t              chunk[1024];
+    size_t               length;
+    uint8_t              magic[sizeof(kMagic) - 1];
+    uint16_t             numHosts;
+
+    aHosts.clear();
+
+    VerifyOrExit(file != nullptr, error = (errno == ENOENT) ? OTBR_ERROR_NOT_FOUND : OTBR_ERROR_ERRNO);
+    while ((length = fread(chunk, 1, sizeof(chunk), file)) > 0)
+    {
+        buffer.insert(buffer.end(), chunk, chunk + length);
+    }
+    VerifyOrExit(!ferror(file), error = OTBR_ERROR_ERRNO);
+
+    {
+        Decoder decoder(buffer);
+
+        VerifyOrExit(decoder.ReadBytes(magic, sizeof(magic)) && memcmp(magic, kMagic, sizeof(magic)) == 0,
+                     error = OTBR_ERROR_PARSE);
+        VerifyOrExit(decoder.ReadUint16(numHosts), error = OTBR_ERROR_PARSE);
+        aHosts.resize(numHosts);
+        for (Host &host : aHosts)
+        {
+            SuccessOrExit(error = DecodeHost(decoder, host));
+        }
+        VerifyOrExit(decoder.IsDone(), error = OTBR_ERROR_PARSE);
+    }
+
+exit:
+    if (file != nullptr)
+    {
+        fclose(file);
+    }
+    if (error != OTBR_ERROR_NONE)
+    {
+        aHosts.clear();
+    }
+    return error;
+}
+
+} // namespace otbr
+
+#endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
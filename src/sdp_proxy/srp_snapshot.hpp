@@ -0,0 +1,103 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of the snapshot of the SRP hosts advertised by the Advertising Proxy.
+ */
+
+#ifndef OTBR_SRP_SNAPSHOT_HPP_
+#define OTBR_SRP_SNAPSHOT_HPP_
+
+#include "openthread-br/config.h"
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "common/types.hpp"
+#include "mdns/mdns.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements the snapshot of the SRP hosts advertised by the Advertising Proxy.
+ *
+ * The snapshot is kept on disk, so that a restarted agent resumes the advertisements right away instead of waiting
+ * for the SRP clients to register again. The snapshot is replaced atomically, a partially written snapshot is never
+ * read.
+ */
+class SrpSnapshot
+{
+public:
+    /**
+     * This structure represents an advertised SRP host.
+     */
+    struct Host
+    {
+        std::string                        mName;       ///< The host name, without the domain.
+        Mdns::Publisher::AddressList       mAddresses;  ///< The advertised addresses.
+        Mdns::Publisher::HostedServiceList mServices;   ///< The advertised services.
+        int64_t                            mExpireTime; ///< The time the lease expires, in seconds since the epoch.
+    };
+
+    typedef std::vector<Host> HostList;
+
+    /**
+     * This function writes a snapshot.
+     *
+     * @param[in] aPath   The path of the snapshot file.
+     * @param[in] aHosts  The hosts to write.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully wrote the snapshot.
+     * @retval OTBR_ERROR_ERRNO  Failed to write the snapshot file.
+     */
+    static otbrError Write(const std::string &aPath, const HostList &aHosts);
+
+    /**
+     * This function reads a snapshot.
+     *
+     * @param[in]  aPath   The path of the snapshot file.
+     * @param[out] aHosts  The hosts read from the snapshot.
+     *
+     * @retval OTBR_ERROR_NONE       Successfully read the snapshot.
+     * @retval OTBR_ERROR_NOT_FOUND  There is no snapshot.
+     * @retval OTBR_ERROR_ERRNO      Failed to read the snapshot file.
+     * @retval OTBR_ERROR_PARSE      The snapshot is malformed or of another version.
+     */
+    static otbrError Read(const std::string &aPath, HostList &aHosts);
+};
+
+} // namespace otbr
+
+#endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
+
+#endif // OTBR_SRP_SNAPSHOT_HPP_
@@ -37,17 +37,50 @@
 
 #include "trel_dnssd/trel_dnssd.hpp"
 
+#include <errno.h>
 #include <inttypes.h>
 #include <net/if.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
 
 #include <openthread/instance.h>
 #include <openthread/link.h>
 #include <openthread/platform/trel.h>
 
 #include "common/code_utils.hpp"
+#include "common/txt_reader.hpp"
 #include "utils/hex.hpp"
 #include "utils/string_utils.hpp"
 
+#ifndef OTBR_CONFIG_TREL_PEER_CACHE_DIR
+/**
+ * @def OTBR_CONFIG_TREL_PEER_CACHE_DIR
+ *
+ * The directory of the cache of the discovered TREL peers, no cache is kept if empty.
+ */
+#define OTBR_CONFIG_TREL_PEER_CACHE_DIR "/var/lib/thread"
+#endif
+
+#ifndef OTBR_CONFIG_TREL_PEER_CACHE_MAX_AGE
+/**
+ * @def OTBR_CONFIG_TREL_PEER_CACHE_MAX_AGE
+ *
+ * The maximum time in seconds since a cached TREL peer was last resolved for it to be restored.
+ */
+#define OTBR_CONFIG_TREL_PEER_CACHE_MAX_AGE 3600
+#endif
+
+#ifndef OTBR_CONFIG_TREL_PEER_REVALIDATION_TIMEOUT
+/**
+ * @def OTBR_CONFIG_TREL_PEER_REVALIDATION_TIMEOUT
+ *
+ * The time in milliseconds after browsing starts, by which mDNS must resolve a restored TREL peer again for it to
+ * be kept.
+ */
+#define OTBR_CONFIG_TREL_PEER_REVALIDATION_TIMEOUT 30000
+#endif
+
 static const char kTrelServiceName[] = "_trel._udp";
 
 static otbr::TrelDnssd::TrelDnssd *sTrelDnssd = nullptr;
@@ -81,7 +114,7 @@ namespace otbr {
 
 namespace TrelDnssd {
 
-TrelDnssd::TrelDnssd(Ncp::RcpHost &aHost, Mdns::Publisher &aPublisher)
+TrelDnssd::TrelDnssd(Ncp::RcpHost &aHost, Mdns::PublisherImpl &aPublisher)
     : mPublisher(aPublisher)
     , mHost(aHost)
 {
@@ -95,6 +128,14 @@ void TrelDnssd::Initialize(std::string aTrelNetif)
     if (IsInitialized())
     {
         otbrLogDebug("Initialized on netif \"%s\"", mTrelNetif.c_str());
+
+        if (strlen(OTBR_CONFIG_TREL_PEER_CACHE_DIR) != 0)
+        {
+            mPeerCachePath = std::string(OTBR_CONFIG_TREL_PEER_CACHE_DIR) + "/otbr-trel-peers-" +
+                             mHost.GetInterfaceName() + ".cache";
+            LoadPeerCache();
+        }
+
         CheckTrelNetifReady();
     }
     else
@@ -114,11 +155,11 @@ void TrelDnssd::StartBrowse(void)
         [this](const std::string &aType, const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo) {
             OnTrelServiceInstanceResolved(aType, aInstanceInfo);
         },
-        /* aHostCallback */ nullptr);
+        /* aHostCallback */ nullptr, kTrelServiceName);
 
     if (IsReady())
     {
-        mPublisher.SubscribeService(kTrelServiceName, /* aInstanceName */ "");
+        SubscribeTrelService();
     }
 
 exit:
@@ -157,6 +198,7 @@ void TrelDnssd::RegisterService(uint16_t aPort, const uint8_t *aTxtData, uint8_t
     if (mRegisterInfo.IsValid() && IsReady())
     {
         UnpublishTrelService();
+        mTelemetryInfo.mServiceRepublications++;
     }
 
     mRegisterInfo.Assign(aPort, aTxtData, aTxtLength);
@@ -194,12 +236,20 @@ void TrelDnssd::HandleMdnsState(Mdns::Publisher::State aState)
     VerifyOrExit(aState == Mdns::Publisher::State::kReady);
 
     otbrLogDebug("mDNS Publisher is Ready");
+
+    // Peers can only be discovered once the publisher is ready, so the peers restored from the cache are kept until
+    // browsing revalidates them. The peers known before the publisher restarted may be gone in the meantime.
+    if (mMdnsPublisherReady)
+    {
+        RemoveAllPeers();
+    }
+
     mMdnsPublisherReady = true;
-    RemoveAllPeers();
 
     if (mRegisterInfo.IsPublished())
     {
         mRegisterInfo.mInstanceName = "";
+        mTelemetryInfo.mServiceRepublications++;
     }
 
     OnBecomeReady();
@@ -216,6 +266,7 @@ void TrelDnssd::OnTrelServiceInstanceResolved(const std::string
 
     if (aInstanceInfo.mRemoved)
     {
+        mTelemetryInfo.mPeerRemovals++;
         OnTrelServiceInstanceRemoved(aInstanceInfo.mName);
     }
     else
@@ -282,12 +333,10 @@ void TrelDnssd::HandleUnpublishTrelServiceError(otbrError aError)
 
 void TrelDnssd::OnTrelServiceInstanceAdded(const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo)
 {
-    std::string        instanceName = StringUtils::ToLowercase(aInstanceInfo.mName);
-    Ip6Address         selectedAddress;
-    otPlatTrelPeerInfo peerInfo;
-
-    // Remove any existing TREL service instance before adding
-    OnTrelServiceInstanceRemoved(instanceName);
+    std::string instanceName = StringUtils::ToLowercase(aInstanceInfo.mName);
+    Ip6Address  selectedAddress;
+    otSockAddr  sockAddr;
+    auto        it = mPeers.end();
 
     otbrLogDebug("Peer discovered: %s hostname %s addresses %zu port %d priority %d "
                  "weight %d",
@@ -296,7 +345,7 @@ void TrelDnssd::OnTrelServiceInstanceAdded(const Mdns::Publisher::DiscoveredInst
 
     for (const auto &addr : aInstanceInfo.mAddresses)
     {
-        otbrLogDebug("Peer address: %s", addr.ToString().c_str());
+        otbrLogDebug("Peer address: %s", addr.ToInfoString().AsCString());
 
         // Skip anycast (Refer to https://datatracker.ietf.org/doc/html/rfc2373#section-2.6.1)
         if (addr.m64[1] == 0)
@@ -316,35 +365,81 @@ void TrelDnssd::OnTrelServiceInstanceAdded(const Mdns::Publisher::DiscoveredInst
 
     if (aInstanceInfo.mAddresses.empty())
     {
+        // Remove any existing TREL service instance as it's no longer reachable
+        OnTrelServiceInstanceRemoved(instanceName);
         otbrLogWarning("Peer %s does not have any IPv6 address, ignored", aInstanceInfo.mName.c_str());
         ExitNow();
     }
 
-    peerInfo.mRemoved = false;
-    memcpy(&peerInfo.mSockAddr.mAddress, &selectedAddress, sizeof(peerInfo.mSockAddr.mAddress));
-    peerInfo.mSockAddr.mPort = aInstanceInfo.mPort;
-    peerInfo.mTxtData        = aInstanceInfo.mTxtData.data();
-    peerInfo.mTxtLength      = aInstanceInfo.mTxtData.size();
+    memcpy(&sockAddr.mAddress, &selectedAddress, sizeof(sockAddr.mAddress));
+    sockAddr.mPort = aInstanceInfo.mPort;
 
+    // The same instance is commonly resolved again without any change (e.g. on cache refresh or when its
+    // host addresses are re-announced), only refresh its discovery time which doesn't require OpenThread to
+    // be notified nor the TXT data to be parsed again.
+    it = mPeers.find(instanceName);
+    if (it != mPeers.end() && it->second.mTxtData == aInstanceInfo.mTxtData &&
+        it->second.mSockAddr.mPort == sockAddr.mPort &&
+        memcmp(&it->second.mSockAddr.mAddress, &sockAddr.mAddress, sizeof(sockAddr.mAddress)) == 0)
     {
-        Peer peer(aInstanceInfo.mTxtData, peerInfo.mSockAddr);
+        otbrLogDebug("Peer %s is not changed", instanceName.c_str());
+        mTelemetryInfo.mUnchangedResolutions++;
+        it->second.mDiscoverTime = Clock::now();
+        it->second.mRestored     = false;
+        mPeerLru.splice(mPeerLru.end(), mPeerLru, it->second.mLruEntry);
+        SchedulePeerCacheSave();
+        ExitNow();
+    }
 
-        VerifyOrExit(peer.mValid, otbrLogWarning("Peer %s is invalid", aInstanceInfo.mName.c_str()));
+    if (it == mPeers.end())
+    {
+        mTelemetryInfo.mPeerDiscoveries++;
 
-        otPlatTrelHandleDiscoveredPeerInfo(mHost.GetInstance(), &peerInfo);
+        if (mDiscoveredInstanceNames.insert(instanceName).second)
+        {
+            mTelemetryInfo.mDiscoveryLatency.Record(
+                std::chrono::duration_cast<Milliseconds>(otbr::Clock::now() - mBrowseStartTime).count());
+        }
+    }
 
-        mPeers.emplace(instanceName, peer);
-        CheckPeersNumLimit();
+    // Remove any existing TREL service instance before adding
+    OnTrelServiceInstanceRemoved(instanceName);
+
+    {
+        Peer peer(aInstanceInfo.mTxtData, sockAddr);
+
+        VerifyOrExit(peer.mValid, {
+            mTelemetryInfo.mInvalidPeers++;
+            otbrLogWarning("Peer %s is invalid", aInstanceInfo.mName.c_str());
+        });
+
+        AddPeer(instanceName, std::move(peer));
     }
 
 exit:
     return;
 }
 
+void TrelDnssd::AddPeer(const std::string &aInstanceName, Peer &&aPeer)
+{
+    QueuePeerNotification(aPeer, /* aRemoved */ false);
+
+    if (mPeerInstanceCounts[aPeer.GetAddressKey()]++ > 0)
+    {
+        mTelemetryInfo.mDuplicatePeers++;
+    }
+
+    aPeer.mLruEntry = mPeerLru.insert(mPeerLru.end(), aInstanceName);
+    mPeers.emplace(aInstanceName, std::move(aPeer));
+    CheckPeersNumLimit();
+    SchedulePeerCacheSave();
+}
+
 void TrelDnssd::OnTrelServiceInstanceRemoved(const std::string &aInstanceName)
 {
     std::string instanceName = StringUtils::ToLowercase(aInstanceName);
     auto        it           = mPeers.find(instanceName);
+    auto        count        = mPeerInstanceCounts.end();
 
     VerifyOrExit(it != mPeers.end());
 
@@ -352,12 +447,18 @@ void TrelDnssd::OnTrelServiceInstanceRemoved(const std::string &aInstanceName)
 
     // Remove the peer only when all instances are removed because one peer can have multiple instances if expired
     // instances were not properly removed by mDNS.
-    if (CountDuplicatePeers(it->second) == 0)
+    count = mPeerInstanceCounts.find(it->second.GetAddressKey());
+    assert(count != mPeerInstanceCounts.end());
+
+    if (--count->second == 0)
     {
-        NotifyRemovePeer(it->second);
+        mPeerInstanceCounts.erase(count);
+        QueuePeerNotification(it->second, /* aRemoved */ true);
     }
 
+    mPeerLru.erase(it->second.mLruEntry);
     mPeers.erase(it);
+    SchedulePeerCacheSave();
 
 exit:
     return;
@@ -365,44 +466,229 @@ exit:
 
 void TrelDnssd::CheckPeersNumLimit(void)
 {
-    const PeerMap::value_type *oldestPeer = nullptr;
-
     VerifyOrExit(mPeers.size() >= kPeerCacheSize);
 
+    // Peers are re-added when re-discovered, so the least recently discovered one is at the front.
+    mTelemetryInfo.mPeerEvictions++;
+    OnTrelServiceInstanceRemoved(std::string(mPeerLru.front()));
+
+exit:
+    return;
+}
+
+void TrelDnssd::QueuePeerNotification(const Peer &aPeer, bool aRemoved)
+{
+    PeerNotification &notification = mPendingPeerNotifications[aPeer.GetAddressKey()];
+
+    // A later change of the same peer overrides the pending one, so that a peer which is removed and added
+    // again (e.g. its TXT data is updated) within the window is reported only once.
+    notification.mRemoved  = aRemoved;
+    notification.mTxtData  = aPeer.mTxtData;
+    notification.mSockAddr = aPeer.mSockAddr;
+
+    VerifyOrExit(!mIsPeerNotifyTaskPosted);
+
+    mIsPeerNotifyTaskPosted = true;
+    mTaskRunner.Post(Milliseconds(kPeerNotifyDelayMs), [this]() { NotifyPendingPeers(); });
+
+exit:
+    return;
+}
+
+void TrelDnssd::NotifyPendingPeers(void)
+{
+    PeerNotificationMap notifications;
+
+    mIsPeerNotifyTaskPosted = false;
+    std::swap(notifications, mPendingPeerNotifications);
+
+    otbrLogDebug("Notify %zu peer changes", notifications.size());
+    mTelemetryInfo.mPeerNotifications += notifications.size();
+
+    for (const auto &entry : notifications)
+    {
+        const PeerNotification &notification = entry.second;
+        otPlatTrelPeerInfo      peerInfo;
+
+        peerInfo.mRemoved   = notification.mRemoved;
+        peerInfo.mTxtData   = notification.mTxtData.data();
+        peerInfo.mTxtLength = notification.mTxtData.size();
+        peerInfo.mSockAddr  = notification.mSockAddr;
+
+        otPlatTrelHandleDiscoveredPeerInfo(mHost.GetInstance(), &peerInfo);
+    }
+}
+
+void TrelDnssd::RemoveAllPeers(void)
+{
     for (const auto &entry : mPeers)
     {
-        if (oldestPeer == nullptr || entry.second.mDiscoverTime < oldestPeer->second.mDiscoverTime)
-        {
-            oldestPeer = &entry;
-        }
+        QueuePeerNotification(entry.second, /* aRemoved */ true);
     }
 
-    OnTrelServiceInstanceRemoved(oldestPeer->first);
+    mPeers.clear();
+    mPeerLru.clear();
+    mPeerInstanceCounts.clear();
+}
+
+void TrelDnssd::LoadPeerCache(void)
+{
+    otbrError         error    = OTBR_ERROR_NONE;
+    FILE             *file     = nullptr;
+    char             *line     = nullptr;
+    size_t            lineSize = 0;
+    size_t            numPeers = mPeers.size();
+    Clock::time_point now      = Clock::now();
+
+    // The cache is loaded once, the peers known since then are more recent.
+    VerifyOrExit(mPeers.empty());
+
+    file = fopen(mPeerCachePath.c_str(), "r");
+    VerifyOrExit(file != nullptr, error = (errno == ENOENT) ? OTBR_ERROR_NONE : OTBR_ERROR_ERRNO);
+
+    // The peers are saved from the least recently discovered, so the order of `mPeerLru` is kept.
+    while (getline(&line, &lineSize, file) > 0)
+    {
+        LoadPeerCacheEntry(line, now);
+    }
+
+    mTelemetryInfo.mRestoredPeers += mPeers.size() - numPeers;
+    otbrLogInfo("Restored %zu peers from %s", mPeers.size() - numPeers, mPeerCachePath.c_str());
+
+exit:
+    free(line);
+    if (file != nullptr)
+    {
+        fclose(file);
+    }
+    otbrLogResult(error, "Load peer cache %s", mPeerCachePath.c_str());
+}
+
+void TrelDnssd::LoadPeerCacheEntry(char *aLine, Clock::time_point aNow)
+{
+    long long            discoverTime;
+    char                 address[INET6_ADDRSTRLEN];
+    unsigned int         port;
+    std::vector<char>    txtHex(strlen(aLine) + 1);
+    int                  nameOffset = 0;
+    std::string          instanceName;
+    std::vector<uint8_t> txtData(txtHex.size() / 2);
+    int                  txtLength;
+    Ip6Address           ip6Address;
+    otSockAddr           sockAddr;
+
+    // Each line is `<discover time> <address> <port> <TXT in hex> <instance name>`, the instance name is the last
+    // because it may contain spaces.
+    VerifyOrExit(sscanf(aLine, "%lld %45s %u %s %n", &discoverTime, address, &port, txtHex.data(), &nameOffset) == 4 &&
+                 nameOffset > 0);
+    instanceName = aLine + nameOffset;
+    if (!instanceName.empty() && instanceName.back() == '\n')
+    {
+        instanceName.pop_back();
+    }
+
+    VerifyOrExit(!instanceName.empty() && port <= UINT16_MAX && mPeers.find(instanceName) == mPeers.end());
+    VerifyOrExit(aNow - Clock::time_point(std::chrono::seconds(discoverTime)) <=
+                 std::chrono::seconds(OTBR_CONFIG_TREL_PEER_CACHE_MAX_AGE));
+    VerifyOrExit(Ip6Address::FromString(address, ip6Address) == OTBR_ERROR_NONE);
+    txtLength = Utils::Hex2Bytes(txtHex.data(), txtData.data(), static_cast<uint16_t>(txtData.size()));
+    VerifyOrExit(txtLength > 0);
+    txtData.resize(static_cast<size_t>(txtLength));
+
+    memcpy(&sockAddr.mAddress, ip6Address.m8, sizeof(sockAddr.mAddress));
+    sockAddr.mPort = static_cast<uint16_t>(port);
+
+    {
+        Peer peer(std::move(txtData), sockAddr);
+
+        VerifyOrExit(peer.mValid);
+        peer.mDiscoverTime = Clock::time_point(std::chrono::seconds(discoverTime));
+        peer.mRestored     = true;
+
+        otbrLogDebug("Restored peer %s", instanceName.c_str());
+        AddPeer(instanceName, std::move(peer));
+    }
 
 exit:
     return;
 }
 
-void TrelDnssd::NotifyRemovePeer(const Peer &aPeer)
+void TrelDnssd::SchedulePeerCacheSave(void)
 {
-    otPlatTrelPeerInfo peerInfo;
+    VerifyOrExit(!mPeerCachePath.empty() && !mIsPeerCacheSaveTaskPosted);
 
-    peerInfo.mRemoved   = true;
-    peerInfo.mTxtData   = aPeer.mTxtData.data();
-    peerInfo.mTxtLength = aPeer.mTxtData.size();
-    peerInfo.mSockAddr  = aPeer.mSockAddr;
+    // Changes are batched, peers are resolved again on every mDNS cache refresh.
+    mIsPeerCacheSaveTaskPosted = true;
+    mTaskRunner.Post(Milliseconds(kPeerCacheSaveDelayMs), [this]() { SavePeerCache(); });
 
-    otPlatTrelHandleDiscoveredPeerInfo(mHost.GetInstance(), &peerInfo);
+exit:
+    return;
 }
 
-void TrelDnssd::RemoveAllPeers(void)
+void TrelDnssd::SavePeerCache(void)
+{
+    otbrError   error   = OTBR_ERROR_NONE;
+    std::string tmpPath = mPeerCachePath + ".tmp";
+    FILE       *file    = nullptr;
+
+    mIsPeerCacheSaveTaskPosted = false;
+
+    file = fopen(tmpPath.c_str(), "w");
+    VerifyOrExit(file != nullptr, error = OTBR_ERROR_ERRNO);
+
+    for (const std::string &instanceName : mPeerLru)
+    {
+        const Peer &peer = mPeers.at(instanceName);
+
+        if (instanceName.find('\n') != std::string::npos || peer.mTxtData.empty())
+        {
+            continue;
+        }
+
+        fprintf(file, "%lld %s %u %s %s\n",
+                static_cast<long long>(
+                    std::chrono::duration_cast<std::chrono::seconds>(peer.mDiscoverTime.time_since_epoch()).count()),
+                Ip6Address(peer.mSockAddr.mAddress).ToString().c_str(), peer.mSockAddr.mPort,
+                Utils::Bytes2Hex(peer.mTxtData.data(), static_cast<uint16_t>(peer.mTxtData.size())).c_str(),
+                instanceName.c_str());
+    }
+
+    // Written to a temporary file renamed over the cache, so that a crash leaves either cache intact.
+    VerifyOrExit(fflush(file) == 0 && !ferror(file) && fsync(fileno(file)) == 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(fclose(file) == 0, file = nullptr, error = OTBR_ERROR_ERRNO);
+    file = nullptr;
+    VerifyOrExit(rename(tmpPath.c_str(), mPeerCachePath.c_str()) == 0, error = OTBR_ERROR_ERRNO);
+
+exit:
+    if (file != nullptr)
+    {
+        fclose(file);
+    }
+    if (error != OTBR_ERROR_NONE)
+    {
+        unlink(tmpPath.c_str());
+    }
+    otbrLogResult(error, "Save %zu peers to %s", mPeers.size(), mPeerCachePath.c_str());
+}
+
+void TrelDnssd::RemoveUnresolvedRestoredPeers(void)
 {
+    std::vector<std::string> unresolved;
+
     for (const auto &entry : mPeers)
     {
-        NotifyRemovePeer(entry.second);
+        if (entry.second.mRestored)
+        {
+            unresolved.push_back(entry.first);
+        }
     }
 
-    mPeers.clear();
+    for (const std::string &instanceName : unresolved)
+    {
+        otbrLogInfo("Restored peer %s is not resolved again, removed", instanceName.c_str());
+        mTelemetryInfo.mUnresolvedPeers++;
+        OnTrelServiceInstanceRemoved(instanceName);
+    }
 }
 
 void TrelDnssd::CheckTrelNetifReady(void)
@@ -445,7 +731,7 @@ void TrelDnssd::OnBecomeReady(void)
 
         if (mSubscriberId > 0)
         {
-            mPublisher.SubscribeService(kTrelServiceName, /* aInstanceName */ "");
+            SubscribeTrelService();
         }
 
         if (mRegisterInfo.IsValid())
@@ -455,25 +741,15 @@ void TrelDnssd::OnBecomeReady(void)
     }
 }
 
-uint16_t TrelDnssd::CountDuplicatePeers(const TrelDnssd::Peer &aPeer)
+void TrelDnssd::SubscribeTrelService(void)
 {
-    uint16_t count = 0;
-
-    for (const auto &entry : mPeers)
-    {
-        if (&entry.second == &aPeer)
-        {
-            continue;
-        }
-
-        if (!memcmp(&entry.second.mSockAddr, &aPeer.mSockAddr, sizeof(otSockAddr)) &&
-            !memcmp(&entry.second.mExtAddr, &aPeer.mExtAddr, sizeof(otExtAddress)))
-        {
-            count++;
-        }
-    }
+    mBrowseStartTime = otbr::Clock::now();
+    mDiscoveredInstanceNames.clear();
+    mPublisher.SubscribeService(kTrelServiceName, /* aInstanceName */ "");
 
-    return count;
+    // The restored peers which still exist are resolved again by browsing.
+    mTaskRunner.Post(Milliseconds(OTBR_CONFIG_TREL_PEER_REVALIDATION_TIMEOUT),
+                     [this]() { RemoveUnresolvedRestoredPeers(); });
 }
 
 void TrelDnssd::RegisterInfo::Assign(uint16_t aPort, const uint8_t *aTxtData, uint8_t aTxtLength)
@@ -497,28 +773,16 @@ const char TrelDnssd::Peer::kTxtRecordExtAddressKey[] = "xa";
 
 void TrelDnssd::Peer::ReadExtAddrFromTxtData(void)
 {
-    std::vector<Mdns::Publisher::TxtEntry> txtEntries;
+    TxtReader::Entry txtEntry;
 
     memset(&mExtAddr, 0, sizeof(mExtAddr));
 
-    SuccessOrExit(Mdns::Publisher::DecodeTxtData(txtEntries, mTxtData.data(), mTxtData.size()));
+    // The peers are discovered all the time, the TXT data is read in place rather than decoded to a list.
+    SuccessOrExit(TxtReader(mTxtData).Find(kTxtRecordExtAddressKey, txtEntry));
+    VerifyOrExit(!txtEntry.mIsBooleanAttribute && txtEntry.mValueLength == sizeof(mExtAddr));
 
-    for (const auto &txtEntry : txtEntries)
-    {
-        if (txtEntry.mIsBooleanAttribute)
-        {
-            continue;
-        }
-
-        if (StringUtils::EqualCaseInsensitive(txtEntry.mKey, kTxtRecordExtAddressKey))
-        {
-            VerifyOrExit(txtEntry.mValue.size() == sizeof(mExtAddr));
-
-            memcpy(mExtAddr.m8, txtEntry.mValue.data(), sizeof(mExtAddr));
-            mValid = true;
-            break;
-        }
-    }
+    memcpy(mExtAddr.m8, txtEntry.mValue, sizeof(mExtAddr));
+    mValid = true;
 
 exit:
 
@@ -530,6 +794,16 @@ exit:
     return;
 }
 
+std::string TrelDnssd::Peer::GetAddressKey(void) const
+{
+    std::string key(reinterpret_cast<const char *>(mSockAddr.mAddress.mFields.m8), sizeof(mSockAddr.mAddress));
+
+    key.append(reinterpret_cast<const char *>(&mSockAddr.mPort), sizeof(mSockAddr.mPort));
+    key.append(reinterpret_cast<const char *>(mExtAddr.m8), sizeof(mExtAddr.m8));
+
+    return key;
+}
+
 } // namespace TrelDnssd
 
 } // namespace otbr
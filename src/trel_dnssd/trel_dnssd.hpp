@@ -39,12 +39,17 @@
 #if OTBR_ENABLE_TREL
 
 #include <assert.h>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 #include <openthread/instance.h>
 
+#include "common/time.hpp"
 #include "common/types.hpp"
-#include "mdns/mdns.hpp"
+#include "mdns/publisher_impl.hpp"
 #include "ncp/rcp_host.hpp"
 
 namespace otbr {
@@ -69,7 +74,7 @@ public:
      * @param[in] aHost       A reference to the OpenThread Controller instance.
      * @param[in] aPublisher  A reference to the mDNS Publisher.
      */
-    explicit TrelDnssd(Ncp::RcpHost &aHost, Mdns::Publisher &aPublisher);
+    explicit TrelDnssd(Ncp::RcpHost &aHost, Mdns::PublisherImpl &aPublisher);
 
     /**
      * This method initializes the TrelDnssd instance.
@@ -109,9 +114,18 @@ public:
      */
     void HandleMdnsState(Mdns::Publisher::State aState);
 
+    /**
+     * This method returns the telemetry information of TREL DNS-SD.
+     *
+     * @returns The telemetry information.
+     */
+    const TrelDnssdTelemetryInfo &GetTelemetryInfo(void) const { return mTelemetryInfo; }
+
 private:
     static constexpr size_t   kPeerCacheSize             = 256;
     static constexpr uint16_t kCheckNetifReadyIntervalMs = 5000;
+    static constexpr uint16_t kPeerNotifyDelayMs         = 100;
+    static constexpr uint16_t kPeerCacheSaveDelayMs      = 30000;
 
     struct RegisterInfo
     {
@@ -125,7 +139,8 @@ private:
         void Clear(void);
     };
 
-    using Clock = std::chrono::system_clock;
+    using Clock   = std::chrono::system_clock;
+    using PeerLru = std::list<std::string>;
 
     struct Peer
     {
@@ -139,21 +154,35 @@ private:
             ReadExtAddrFromTxtData();
         }
 
-        void ReadExtAddrFromTxtData(void);
+        void        ReadExtAddrFromTxtData(void);
+        std::string GetAddressKey(void) const;
 
         Clock::time_point    mDiscoverTime;
         std::vector<uint8_t> mTxtData;
         otSockAddr           mSockAddr;
         otExtAddress         mExtAddr;
-        bool                 mValid = false;
+        bool                 mValid    = false;
+        bool                 mRestored = false; // Restored from the peer cache and not resolved since.
+        PeerLru::iterator    mLruEntry;         // The entry in `mPeerLru`.
+    };
+
+    using PeerMap = std::unordered_map<std::string, Peer>;
+
+    struct PeerNotification
+    {
+        bool                 mRemoved;
+        std::vector<uint8_t> mTxtData;
+        otSockAddr           mSockAddr;
     };
 
-    using PeerMap = std::map<std::string, Peer>;
+    // The pending notifications keyed by `Peer::GetAddressKey`, only the latest one of each peer is kept.
+    using PeerNotificationMap = std::unordered_map<std::string, PeerNotification>;
 
     bool        IsInitialized(void) const { return !mTrelNetif.empty(); }
     bool        IsReady(void) const;
     void        OnBecomeReady(void);
     void        CheckTrelNetifReady(void);
+    void        SubscribeTrelService(void);
     std::string GetTrelInstanceName(void);
     void        PublishTrelService(void);
     void        UnpublishTrelService(void);
@@ -164,20 +193,50 @@ private:
     void        OnTrelServiceInstanceAdded(const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo);
     void        OnTrelServiceInstanceRemoved(const std::string &aInstanceName);
 
-    void     NotifyRemovePeer(const Peer &aPeer);
-    void     CheckPeersNumLimit(void);
-    void     RemoveAllPeers(void);
-    uint16_t CountDuplicatePeers(const Peer &aPeer);
-
-    Mdns::Publisher &mPublisher;
-    Ncp::RcpHost    &mHost;
-    TaskRunner       mTaskRunner;
-    std::string      mTrelNetif;
-    uint32_t         mTrelNetifIndex = 0;
-    uint64_t         mSubscriberId   = 0;
-    RegisterInfo     mRegisterInfo;
-    PeerMap          mPeers;
-    bool             mMdnsPublisherReady = false;
+    void AddPeer(const std::string &aInstanceName, Peer &&aPeer);
+    void QueuePeerNotification(const Peer &aPeer, bool aRemoved);
+    void NotifyPendingPeers(void);
+    void CheckPeersNumLimit(void);
+    void RemoveAllPeers(void);
+
+    void LoadPeerCache(void);
+    void LoadPeerCacheEntry(char *aLine, Clock::time_point aNow);
+    void SchedulePeerCacheSave(void);
+    void SavePeerCache(void);
+    void RemoveUnresolvedRestoredPeers(void);
+
+    Mdns::PublisherImpl &mPublisher;
+    Ncp::RcpHost        &mHost;
+    TaskRunner           mTaskRunner;
+    std::string          mTrelNetif;
+    uint32_t             mTrelNetifIndex = 0;
+    uint64_t             mSubscriberId   = 0;
+    RegisterInfo         mRegisterInfo;
+    bool                 mMdnsPublisherReady = false;
+
+    // The peers keyed by their lowercase instance names.
+    PeerMap mPeers;
+
+    // The instance names of the peers, from the earliest discovered to the latest.
+    PeerLru mPeerLru;
+
+    // The number of instances of each peer (see `Peer::GetAddressKey`), which can be more than one
+    // if expired instances were not properly removed by mDNS.
+    std::unordered_map<std::string, uint16_t> mPeerInstanceCounts;
+
+    // The peer changes not yet delivered to OpenThread, see `kPeerNotifyDelayMs`.
+    PeerNotificationMap mPendingPeerNotifications;
+    bool                mIsPeerNotifyTaskPosted = false;
+
+    // The file the peers are saved to, so that they are reachable right after a restart, see `LoadPeerCache()`.
+    std::string mPeerCachePath;
+    bool        mIsPeerCacheSaveTaskPosted = false;
+
+    // The time when browsing started and the instances discovered since then, for measuring discovery latencies.
+    Timepoint                       mBrowseStartTime;
+    std::unordered_set<std::string> mDiscoveredInstanceNames;
+
+    TrelDnssdTelemetryInfo mTelemetryInfo{};
 };
 
 /**
@@ -0,0 +1,140 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the per-channel occupancy statistics of background energy samples.
+ */
+
+#include "utils/channel_occupancy.hpp"
+
+#include <algorithm>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+constexpr int8_t   ChannelOccupancy::kRssiThreshold;
+constexpr int8_t   ChannelOccupancy::kInvalidRssi;
+constexpr uint16_t ChannelOccupancy::kMaxOccupancy;
+
+void ChannelOccupancy::Record(uint8_t aChannel, int8_t aRssi)
+{
+    Entry   *entry;
+    uint32_t weight;
+    uint32_t sample = (aRssi > kRssiThreshold) ? kMaxOccupancy : 0;
+
+    VerifyOrExit(aChannel < kNumChannels && aRssi != kInvalidRssi);
+
+    entry = &mChannels[aChannel];
+    entry->mSampleCount++;
+
+    // The first samples are averaged evenly, so that the statistics don't lean towards the initial zeros.
+    weight = std::min<uint32_t>(entry->mSampleCount, kSampleWindow);
+
+    entry->mOccupancy   = static_cast<uint16_t>((entry->mOccupancy * (weight - 1) + sample) / weight);
+    entry->mAverageRssi = (entry->mAverageRssi * static_cast<int32_t>(weight - 1) + aRssi * 256) /
+                          static_cast<int32_t>(weight);
+
+exit:
+    return;
+}
+
+void ChannelOccupancy::Clear(void)
+{
+    for (Entry &entry : mChannels)
+    {
+        entry.mOccupancy   = 0;
+        entry.mAverageRssi = 0;
+        entry.mSampleCount = 0;
+    }
+}
+
+std::vector<ChannelOccupancy::Quality> ChannelOccupancy::GetQualities(uint32_t aChannelMask) const
+{
+    std::vector<Quality> qualities;
+
+    for (uint8_t channel = 0; channel < kNumChannels; channel++)
+    {
+        if ((aChannelMask & (1U << channel)) && mChannels[channel].mSampleCount > 0)
+        {
+            qualities.push_back(GetQuality(channel));
+        }
+    }
+
+    return qualities;
+}
+
+bool ChannelOccupancy::Recommend(uint32_t aChannelMask, uint8_t &aChannel) const
+{
+    bool    found = false;
+    Quality best  = {};
+
+    for (uint8_t channel = 0; channel < kNumChannels; channel++)
+    {
+        Quality quality;
+
+        if (!(aChannelMask & (1U << channel)))
+        {
+            continue;
+        }
+
+        quality = GetQuality(channel);
+        VerifyOrExit(quality.mSampleCount >= kMinSampleCount, found = false);
+
+        if (!found || quality.mOccupancy < best.mOccupancy ||
+            (quality.mOccupancy == best.mOccupancy && quality.mAverageRssi < best.mAverageRssi))
+        {
+            best  = quality;
+            found = true;
+        }
+    }
+
+    if (found)
+    {
+        aChannel = best.mChannel;
+    }
+
+exit:
+    return found;
+}
+
+ChannelOccupancy::Quality ChannelOccupancy::GetQuality(uint8_t aChannel) const
+{
+    const Entry &entry = mChannels[aChannel];
+    Quality      quality;
+
+    quality.mChannel     = aChannel;
+    quality.mOccupancy   = entry.mOccupancy;
+    quality.mAverageRssi = static_cast<int8_t>(entry.mAverageRssi / 256);
+    quality.mSampleCount = entry.mSampleCount;
+
+    return quality;
+}
+
+} // namespace otbr
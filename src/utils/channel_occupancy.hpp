@@ -0,0 +1,132 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file defines the per-channel occupancy statistics of background energy samples.
+ */
+
+#ifndef OTBR_UTILS_CHANNEL_OCCUPANCY_HPP_
+#define OTBR_UTILS_CHANNEL_OCCUPANCY_HPP_
+
+#include "openthread-br/config.h"
+
+#include <vector>
+
+#include <stdint.h>
+
+namespace otbr {
+
+/**
+ * This class keeps the occupancy statistics of each channel from the energy samples of the channels.
+ *
+ * The occupancy of a channel is the fraction of its samples whose RSSI is above `kRssiThreshold`, averaged over
+ * the last `kSampleWindow` samples with an exponentially weighted moving average, like the OpenThread channel
+ * monitor. This class is not thread-safe and must only be used on the mainloop.
+ */
+class ChannelOccupancy
+{
+public:
+    enum
+    {
+        kNumChannels    = 32, ///< The number of channels of a channel mask.
+        kSampleWindow   = 16, ///< The number of samples averaged by the occupancy of a channel.
+        kMinSampleCount = 4,  ///< The number of samples of each channel needed to recommend a channel.
+    };
+
+    static constexpr int8_t   kRssiThreshold = -75;    ///< A sample above this RSSI in dBm occupies the channel.
+    static constexpr int8_t   kInvalidRssi   = 127;    ///< The RSSI of a failed sample, which is ignored.
+    static constexpr uint16_t kMaxOccupancy  = 0xffff; ///< The occupancy of a channel which is always busy.
+
+    /**
+     * This structure represents the statistics of a channel.
+     */
+    struct Quality
+    {
+        uint8_t  mChannel;     ///< The channel.
+        uint16_t mOccupancy;   ///< The occupancy, from 0 for an idle channel to `kMaxOccupancy`.
+        int8_t   mAverageRssi; ///< The average of the sampled RSSI in dBm.
+        uint32_t mSampleCount; ///< The number of samples of the channel.
+    };
+
+    /**
+     * This constructor initializes the statistics without any sample.
+     */
+    ChannelOccupancy(void) { Clear(); }
+
+    /**
+     * This method records an energy sample of a channel.
+     *
+     * @param[in] aChannel  The channel, samples of channels out of a channel mask are ignored.
+     * @param[in] aRssi     The maximum RSSI of the sample in dBm, `kInvalidRssi` is ignored.
+     */
+    void Record(uint8_t aChannel, int8_t aRssi);
+
+    /**
+     * This method removes all samples.
+     */
+    void Clear(void);
+
+    /**
+     * This method returns the statistics of the sampled channels in a channel mask, in the order of the channels.
+     *
+     * @param[in] aChannelMask  The channel mask.
+     *
+     * @returns The statistics of the channels of @p aChannelMask with at least one sample.
+     */
+    std::vector<Quality> GetQualities(uint32_t aChannelMask) const;
+
+    /**
+     * This method recommends the least occupied channel of a channel mask.
+     *
+     * A lower average RSSI breaks a tie of the occupancies, and then a lower channel.
+     *
+     * @param[in]  aChannelMask  The channel mask.
+     * @param[out] aChannel      The recommended channel.
+     *
+     * @retval TRUE   @p aChannel is the least occupied channel.
+     * @retval FALSE  A channel of @p aChannelMask doesn't have `kMinSampleCount` samples yet, or the mask is empty.
+     */
+    bool Recommend(uint32_t aChannelMask, uint8_t &aChannel) const;
+
+private:
+    struct Entry
+    {
+        uint16_t mOccupancy;
+        int32_t  mAverageRssi; // In 1/256 dBm.
+        uint32_t mSampleCount;
+    };
+
+    Quality GetQuality(uint8_t aChannel) const;
+
+    Entry mChannels[kNumChannels];
+};
+
+} // namespace otbr
+
+#endif // OTBR_UTILS_CHANNEL_OCCUPANCY_HPP_
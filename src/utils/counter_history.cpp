@@ -0,0 +1,201 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the periodic sampler of the MAC, IPv6 and neighbor counters.
+ */
+
+#include "utils/counter_history.hpp"
+
+#include <algorithm>
+
+#include <openthread/link.h>
+#include <openthread/thread.h>
+
+#include "ncp/rcp_host.hpp"
+
+/**
+ * @def OTBR_CONFIG_COUNTER_HISTORY_SAMPLE_INTERVAL
+ *
+ * Specifies the interval in milliseconds between two samples of the counters.
+ */
+#ifndef OTBR_CONFIG_COUNTER_HISTORY_SAMPLE_INTERVAL
+#define OTBR_CONFIG_COUNTER_HISTORY_SAMPLE_INTERVAL 60000
+#endif
+
+/**
+ * @def OTBR_CONFIG_COUNTER_HISTORY_LENGTH
+ *
+ * Specifies the number of intervals kept in the history of each interface and neighbor.
+ */
+#ifndef OTBR_CONFIG_COUNTER_HISTORY_LENGTH
+#define OTBR_CONFIG_COUNTER_HISTORY_LENGTH 60
+#endif
+
+namespace otbr {
+namespace agent {
+
+static constexpr uint16_t kHistoryLength = OTBR_CONFIG_COUNTER_HISTORY_LENGTH;
+
+CounterHistory::CounterHistory(otInstance *aInstance, Ncp::RcpHost &aHost)
+    : mInstance(aInstance)
+    , mHost(aHost)
+    , mSamplingTaskId(0)
+    , mInterfaceSeries(kNumInterfaceCounters, kHistoryLength)
+{
+    mNeighbors.reserve(kMaxNeighbors);
+    ScheduleSampling();
+}
+
+CounterHistory::~CounterHistory(void)
+{
+    if (mSamplingTaskId != 0)
+    {
+        mHost.CancelTimerTask(mSamplingTaskId);
+    }
+}
+
+const char *CounterHistory::InterfaceCounterToString(uint8_t aCounter)
+{
+    static const char *const kNames[] = {
+        "Ip6TxSuccess",        // kIp6TxSuccess
+        "Ip6RxSuccess",        // kIp6RxSuccess
+        "Ip6TxFailure",        // kIp6TxFailure
+        "Ip6RxFailure",        // kIp6RxFailure
+        "MacTxTotal",          // kMacTxTotal
+        "MacTxUnicast",        // kMacTxUnicast
+        "MacTxBroadcast",      // kMacTxBroadcast
+        "MacTxRetry",          // kMacTxRetry
+        "MacTxErrCca",         // kMacTxErrCca
+        "MacTxErrAbort",       // kMacTxErrAbort
+        "MacTxErrBusyChannel", // kMacTxErrBusyChannel
+        "MacRxTotal",          // kMacRxTotal
+        "MacRxUnicast",        // kMacRxUnicast
+        "MacRxBroadcast",      // kMacRxBroadcast
+        "MacRxDuplicated",     // kMacRxDuplicated
+        "MacRxErrors",         // kMacRxErrors
+    };
+
+    static_assert(sizeof(kNames) / sizeof(kNames[0]) == kNumInterfaceCounters, "kNames is out of sync");
+
+    return kNames[aCounter];
+}
+
+const char *CounterHistory::NeighborCounterToString(uint8_t aCounter)
+{
+    static const char *const kNames[] = {"LinkFrames", "MleFrames"};
+
+    static_assert(sizeof(kNames) / sizeof(kNames[0]) == kNumNeighborCounters, "kNames is out of sync");
+
+    return kNames[aCounter];
+}
+
+void CounterHistory::ScheduleSampling(void)
+{
+    mSamplingTaskId = mHost.PostTimerTask(Milliseconds(OTBR_CONFIG_COUNTER_HISTORY_SAMPLE_INTERVAL), [this]() {
+        mSamplingTaskId = 0;
+
+        // The instance is gone once the host is deinitialized, the sampling stops until a new history is created.
+        if (mHost.GetInstance() == mInstance)
+        {
+            Sample();
+            ScheduleSampling();
+        }
+    });
+}
+
+void CounterHistory::Sample(void)
+{
+    const otMacCounters   *mac = otLinkGetCounters(mInstance);
+    const otIpCounters    *ip  = otThreadGetIp6Counters(mInstance);
+    uint64_t               values[kNumInterfaceCounters];
+    otNeighborInfoIterator iter = OT_NEIGHBOR_INFO_ITERATOR_INIT;
+    otNeighborInfo         info;
+    Timepoint              now = Clock::now();
+
+    values[kIp6TxSuccess]        = ip->mTxSuccess;
+    values[kIp6RxSuccess]        = ip->mRxSuccess;
+    values[kIp6TxFailure]        = ip->mTxFailure;
+    values[kIp6RxFailure]        = ip->mRxFailure;
+    values[kMacTxTotal]          = mac->mTxTotal;
+    values[kMacTxUnicast]        = mac->mTxUnicast;
+    values[kMacTxBroadcast]      = mac->mTxBroadcast;
+    values[kMacTxRetry]          = mac->mTxRetry;
+    values[kMacTxErrCca]         = mac->mTxErrCca;
+    values[kMacTxErrAbort]       = mac->mTxErrAbort;
+    values[kMacTxErrBusyChannel] = mac->mTxErrBusyChannel;
+    values[kMacRxTotal]          = mac->mRxTotal;
+    values[kMacRxUnicast]        = mac->mRxUnicast;
+    values[kMacRxBroadcast]      = mac->mRxBroadcast;
+    values[kMacRxDuplicated]     = mac->mRxDuplicated;
+    values[kMacRxErrors]         = static_cast<uint64_t>(mac->mRxErrNoFrame) + mac->mRxErrUnknownNeighbor;
+    values[kMacRxErrors] += static_cast<uint64_t>(mac->mRxErrInvalidSrcAddr) + mac->mRxErrSec + mac->mRxErrFcs;
+    values[kMacRxErrors] += mac->mRxErrOther;
+    mInterfaceSeries.Record(now, values);
+
+    while (otThreadGetNextNeighborInfo(mInstance, &iter, &info) == OT_ERROR_NONE)
+    {
+        uint64_t extAddress                           = ConvertOpenThreadUint64(info.mExtAddress.m8);
+        uint64_t neighborValues[kNumNeighborCounters] = {info.mLinkFrameCounter, info.mMleFrameCounter};
+        auto     it                                   = mNeighbors.begin();
+
+        while (it != mNeighbors.end() && it->mExtAddress != extAddress)
+        {
+            ++it;
+        }
+
+        if (it == mNeighbors.end())
+        {
+            // The neighbors beyond the limit are not tracked, so that the memory stays bounded.
+            if (mNeighbors.size() == kMaxNeighbors)
+            {
+                continue;
+            }
+
+            mNeighbors.push_back({extAddress, now, CounterSeries(kNumNeighborCounters, kHistoryLength)});
+            it = mNeighbors.end() - 1;
+        }
+
+        it->mSeries.Record(now, neighborValues);
+        it->mLastSampleTime = now;
+    }
+
+    // The history of a neighbor is dropped as soon as it leaves the neighbor table.
+    mNeighbors.erase(std::remove_if(mNeighbors.begin(), mNeighbors.end(),
+                                    [now](const Neighbor &aNeighbor) { return aNeighbor.mLastSampleTime != now; }),
+                     mNeighbors.end());
+
+    for (const SampledCallback &callback : mSampledCallbacks)
+    {
+        callback(*this);
+    }
+}
+
+} // namespace agent
+} // namespace otbr
@@ -0,0 +1,190 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file defines the periodic sampler of the MAC, IPv6 and neighbor counters.
+ */
+
+#ifndef OTBR_UTILS_COUNTER_HISTORY_HPP_
+#define OTBR_UTILS_COUNTER_HISTORY_HPP_
+
+#include "openthread-br/config.h"
+
+#include <functional>
+#include <vector>
+
+#include <stdint.h>
+
+#include <openthread/instance.h>
+
+#include "common/code_utils.hpp"
+#include "common/counter_series.hpp"
+#include "common/task_runner.hpp"
+
+namespace otbr {
+namespace Ncp {
+class RcpHost;
+}
+} // namespace otbr
+
+namespace otbr {
+namespace agent {
+
+/**
+ * This class periodically samples the counters of the Thread interface and of each neighbor, and keeps their recent
+ * history in fixed-size `CounterSeries`.
+ *
+ * Clients can read the rates and the history of the counters without polling the counters at a high frequency.
+ */
+class CounterHistory : private NonCopyable
+{
+public:
+    /**
+     * The counters of the Thread interface.
+     */
+    enum InterfaceCounter : uint8_t
+    {
+        kIp6TxSuccess,         ///< IPv6 packets successfully transmitted.
+        kIp6RxSuccess,         ///< IPv6 packets successfully received.
+        kIp6TxFailure,         ///< IPv6 packets failed to transmit.
+        kIp6RxFailure,         ///< IPv6 packets failed to receive.
+        kMacTxTotal,           ///< MAC frames transmitted.
+        kMacTxUnicast,         ///< MAC unicast frames transmitted.
+        kMacTxBroadcast,       ///< MAC broadcast frames transmitted.
+        kMacTxRetry,           ///< MAC retransmissions.
+        kMacTxErrCca,          ///< MAC frames failed to transmit due to CCA failure.
+        kMacTxErrAbort,        ///< MAC frames whose transmission was aborted.
+        kMacTxErrBusyChannel,  ///< MAC frames failed to transmit due to a busy channel.
+        kMacRxTotal,           ///< MAC frames received.
+        kMacRxUnicast,         ///< MAC unicast frames received.
+        kMacRxBroadcast,       ///< MAC broadcast frames received.
+        kMacRxDuplicated,      ///< MAC duplicated frames received.
+        kMacRxErrors,          ///< MAC frames dropped due to any receive error.
+        kNumInterfaceCounters, ///< The number of counters of the Thread interface.
+    };
+
+    /**
+     * The counters of a neighbor.
+     */
+    enum NeighborCounter : uint8_t
+    {
+        kNeighborLinkFrames,  ///< The link frame counter of the neighbor, i.e. the secured frames it transmitted.
+        kNeighborMleFrames,   ///< The MLE frame counter of the neighbor.
+        kNumNeighborCounters, ///< The number of counters of a neighbor.
+    };
+
+    /**
+     * This structure represents the history of the counters of a neighbor.
+     */
+    struct Neighbor
+    {
+        uint64_t      mExtAddress;     ///< The extended address of the neighbor.
+        Timepoint     mLastSampleTime; ///< The time the neighbor was last sampled.
+        CounterSeries mSeries;         ///< The history of the `NeighborCounter`s.
+    };
+
+    /**
+     * This function is called on the mainloop after each sample of the counters.
+     *
+     * @param[in] aHistory  The history, which is only valid during the call.
+     */
+    using SampledCallback = std::function<void(const CounterHistory &aHistory)>;
+
+    /**
+     * This constructor initializes the history and starts the periodic sampling.
+     *
+     * @param[in] aInstance  The OpenThread instance.
+     * @param[in] aHost      The host which runs the sampling task.
+     */
+    CounterHistory(otInstance *aInstance, Ncp::RcpHost &aHost);
+
+    /**
+     * This destructor stops the periodic sampling.
+     */
+    ~CounterHistory(void);
+
+    /**
+     * This method returns the history of the counters of the Thread interface.
+     *
+     * @returns The history of the `InterfaceCounter`s.
+     */
+    const CounterSeries &GetInterfaceSeries(void) const { return mInterfaceSeries; }
+
+    /**
+     * This method returns the history of the counters of the current neighbors.
+     *
+     * @returns The neighbors, at most `kMaxNeighbors`.
+     */
+    const std::vector<Neighbor> &GetNeighbors(void) const { return mNeighbors; }
+
+    /**
+     * This method adds a callback called after each sample of the counters.
+     *
+     * The callback reads the history in place, so consumers of the counters don't sample or copy them on their own.
+     *
+     * @param[in] aCallback  The callback.
+     */
+    void AddSampledCallback(SampledCallback aCallback) { mSampledCallbacks.push_back(std::move(aCallback)); }
+
+    /**
+     * This method returns the name of a counter of the Thread interface.
+     *
+     * @param[in] aCounter  The counter.
+     *
+     * @returns The name of the counter.
+     */
+    static const char *InterfaceCounterToString(uint8_t aCounter);
+
+    /**
+     * This method returns the name of a counter of a neighbor.
+     *
+     * @param[in] aCounter  The counter.
+     *
+     * @returns The name of the counter.
+     */
+    static const char *NeighborCounterToString(uint8_t aCounter);
+
+private:
+    static constexpr size_t kMaxNeighbors = 64;
+
+    void ScheduleSampling(void);
+    void Sample(void);
+
+    otInstance                  *mInstance;
+    Ncp::RcpHost                &mHost;
+    TaskRunner::TaskId           mSamplingTaskId;
+    CounterSeries                mInterfaceSeries;
+    std::vector<Neighbor>        mNeighbors;
+    std::vector<SampledCallback> mSampledCallbacks;
+};
+
+} // namespace agent
+} // namespace otbr
+
+#endif // OTBR_UTILS_COUNTER_HISTORY_HPP_
@@ -35,30 +35,65 @@
 
 namespace otbr {
 
+constexpr uint8_t Crc16::kNumSlices;
+
 Crc16::Crc16(Polynomial aPolynomial)
+    : mTables(GetTables(aPolynomial))
 {
-    mPolynomial = static_cast<uint16_t>(aPolynomial);
     Init();
 }
 
-void Crc16::Update(uint8_t aByte)
+const Crc16::Tables &Crc16::GetTables(Polynomial aPolynomial)
 {
-    uint8_t i;
+    static const PolynomialTables sCcittTables(kCcitt);
+    static const PolynomialTables sAnsiTables(kAnsi);
 
-    mCrc = mCrc ^ static_cast<uint16_t>(aByte << 8);
-    i    = 8;
+    return (aPolynomial == kCcitt) ? sCcittTables.mTables : sAnsiTables.mTables;
+}
 
-    do
+Crc16::PolynomialTables::PolynomialTables(uint16_t aPolynomial)
+{
+    for (uint16_t byte = 0; byte < 256; byte++)
     {
-        if (mCrc & 0x8000)
+        uint16_t crc = static_cast<uint16_t>(byte << 8);
+
+        for (uint8_t i = 0; i < 8; i++)
         {
-            mCrc = static_cast<uint16_t>(mCrc << 1) ^ mPolynomial;
+            crc = (crc & 0x8000) ? static_cast<uint16_t>(crc << 1) ^ aPolynomial : static_cast<uint16_t>(crc << 1);
         }
-        else
+
+        mTables[0][byte] = crc;
+    }
+
+    for (uint8_t k = 1; k < kNumSlices; k++)
+    {
+        for (uint16_t byte = 0; byte < 256; byte++)
         {
-            mCrc = static_cast<uint16_t>(mCrc << 1);
+            uint16_t crc = mTables[k - 1][byte];
+
+            mTables[k][byte] = static_cast<uint16_t>(crc << 8) ^ mTables[0][crc >> 8];
         }
-    } while (--i);
+    }
+}
+
+void Crc16::Update(uint8_t aByte)
+{
+    mCrc = static_cast<uint16_t>(mCrc << 8) ^ mTables[0][(mCrc >> 8) ^ aByte];
+}
+
+void Crc16::Update(const uint8_t *aBuf, size_t aLength)
+{
+    for (; aLength >= kNumSlices; aBuf += kNumSlices, aLength -= kNumSlices)
+    {
+        mCrc = mTables[7][aBuf[0] ^ (mCrc >> 8)] ^ mTables[6][aBuf[1] ^ (mCrc & 0xff)] ^ mTables[5][aBuf[2]] ^
+               mTables[4][aBuf[3]] ^ mTables[3][aBuf[4]] ^ mTables[2][aBuf[5]] ^ mTables[1][aBuf[6]] ^
+               mTables[0][aBuf[7]];
+    }
+
+    for (; aLength > 0; aBuf++, aLength--)
+    {
+        Update(*aBuf);
+    }
 }
 
 } // namespace otbr
@@ -36,6 +36,7 @@
 
 #include "openthread-br/config.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace otbr {
@@ -71,6 +72,17 @@ public:
      */
     void Update(uint8_t aByte);
 
+    /**
+     * This method feeds bytes into the CRC16 computation.
+     *
+     * Eight bytes at a time are folded in with one lookup per byte into independent tables (slice-by-8), which
+     * is faster than feeding the bytes one by one.
+     *
+     * @param[in] aBuf     A pointer to the bytes.
+     * @param[in] aLength  The number of bytes.
+     */
+    void Update(const uint8_t *aBuf, size_t aLength);
+
     /**
      * This method gets the current CRC16 value.
      *
@@ -79,8 +91,22 @@ public:
     uint16_t Get(void) const { return mCrc; }
 
 private:
-    uint16_t mPolynomial;
-    uint16_t mCrc;
+    static constexpr uint8_t kNumSlices = 8;
+
+    // `mTables[k][b]` is the CRC of byte `b` followed by `k` zero bytes.
+    typedef uint16_t Tables[kNumSlices][256];
+
+    struct PolynomialTables
+    {
+        explicit PolynomialTables(uint16_t aPolynomial);
+
+        Tables mTables;
+    };
+
+    static const Tables &GetTables(Polynomial aPolynomial);
+
+    const Tables &mTables;
+    uint16_t      mCrc;
 };
 
 } // namespace otbr
@@ -0,0 +1,322 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the cache of upstream DNS responses.
+ */
+
+#include "utils/dns_upstream_cache.hpp"
+
+#include <ctype.h>
+
+#include <algorithm>
+#include <iterator>
+
+namespace otbr {
+
+constexpr size_t   DnsUpstreamCache::kMaxEntries;
+constexpr uint32_t DnsUpstreamCache::kMaxTtl;
+constexpr uint32_t DnsUpstreamCache::kMaxNegativeTtl;
+
+static constexpr size_t   kHeaderSize             = 12;
+static constexpr size_t   kFlagsOffset            = 2;
+static constexpr size_t   kQuestionCountOffset    = 4;
+static constexpr size_t   kAnswerCountOffset      = 6;
+static constexpr size_t   kAuthorityCountOffset   = 8;
+static constexpr size_t   kAdditionalCountOffset  = 10;
+static constexpr size_t   kQuestionTypeClassSize  = 4;
+static constexpr size_t   kRecordTtlOffset        = 4;
+static constexpr size_t   kRecordDataLengthOffset = 8;
+static constexpr size_t   kRecordHeaderSize       = 10;
+static constexpr size_t   kSoaMinimumSize         = 4;
+static constexpr uint16_t kFlagResponse           = 0x8000;
+static constexpr uint16_t kFlagTruncated          = 0x0200;
+static constexpr uint16_t kOpcodeMask             = 0x7800;
+static constexpr uint16_t kRcodeMask              = 0x000f;
+static constexpr uint16_t kRcodeNoError           = 0;
+static constexpr uint16_t kRcodeNameError         = 3;
+static constexpr uint16_t kTypeSoa                = 6;
+static constexpr uint16_t kTypeOpt                = 41;
+static constexpr uint8_t  kLabelTypeMask          = 0xc0;
+
+static uint16_t ReadUint16(const uint8_t *aBuffer)
+{
+    return static_cast<uint16_t>((aBuffer[0] << 8) | aBuffer[1]);
+}
+
+static uint32_t ReadUint32(const uint8_t *aBuffer)
+{
+    return (static_cast<uint32_t>(ReadUint16(aBuffer)) << 16) | ReadUint16(aBuffer + 2);
+}
+
+static void WriteUint32(uint8_t *aBuffer, uint32_t aValue)
+{
+    aBuffer[0] = static_cast<uint8_t>(aValue >> 24);
+    aBuffer[1] = static_cast<uint8_t>(aValue >> 16);
+    aBuffer[2] = static_cast<uint8_t>(aValue >> 8);
+    aBuffer[3] = static_cast<uint8_t>(aValue);
+}
+
+static bool SkipName(const uint8_t *aMessage, size_t aLength, size_t &aOffset)
+{
+    bool    skipped = false;
+    uint8_t labelLength;
+
+    while (aOffset < aLength)
+    {
+        labelLength = aMessage[aOffset];
+
+        if ((labelLength & kLabelTypeMask) == kLabelTypeMask)
+        {
+            // A compression pointer ends the name.
+            aOffset += 2;
+            ExitNow(skipped = (aOffset <= aLength));
+        }
+
+        VerifyOrExit((labelLength & kLabelTypeMask) == 0);
+        aOffset += 1 + labelLength;
+
+        if (labelLength == 0)
+        {
+            ExitNow(skipped = true);
+        }
+    }
+
+exit:
+    return skipped;
+}
+
+DnsUpstreamCache::DnsUpstreamCache(void)
+    : mCounters()
+{
+}
+
+DnsUpstreamCache &DnsUpstreamCache::Get(void)
+{
+    static DnsUpstreamCache sCache;
+
+    return sCache;
+}
+
+bool DnsUpstreamCache::ReadQuestion(const uint8_t *aMessage, size_t aLength, std::string &aKey, size_t &aOffset)
+{
+    bool    read = false;
+    uint8_t labelLength;
+
+    VerifyOrExit(aLength >= kHeaderSize && ReadUint16(aMessage + kQuestionCountOffset) == 1);
+
+    aKey.clear();
+    aOffset = kHeaderSize;
+
+    do
+    {
+        VerifyOrExit(aOffset < aLength);
+        labelLength = aMessage[aOffset++];
+
+        // The name of the question is the first name of the message, so it isn't compressed.
+        VerifyOrExit((labelLength & kLabelTypeMask) == 0 && aOffset + labelLength <= aLength);
+
+        aKey.push_back(static_cast<char>(labelLength));
+        for (size_t i = 0; i < labelLength; i++)
+        {
+            aKey.push_back(static_cast<char>(tolower(aMessage[aOffset + i])));
+        }
+        aOffset += labelLength;
+    } while (labelLength != 0);
+
+    VerifyOrExit(aOffset + kQuestionTypeClassSize <= aLength);
+    aKey.append(reinterpret_cast<const char *>(aMessage + aOffset), kQuestionTypeClassSize);
+    aOffset += kQuestionTypeClassSize;
+    read = true;
+
+exit:
+    return read;
+}
+
+bool DnsUpstreamCache::Lookup(const uint8_t *aQuery, size_t aLength, Timepoint aNow, std::vector<uint8_t> &aResponse)
+{
+    bool        found = false;
+    std::string key;
+    size_t      offset;
+    uint32_t    elapsed;
+    uint32_t    ttl;
+
+    VerifyOrExit(ReadQuestion(aQuery, aLength, key, offset));
+    VerifyOrExit((ReadUint16(aQuery + kFlagsOffset) & (kFlagResponse | kOpcodeMask)) == 0);
+
+    {
+        auto it = mEntries.find(key);
+
+        VerifyOrExit(it != mEntries.end());
+
+        if (it->second.mExpireTime <= aNow)
+        {
+            mEntries.erase(it);
+            ExitNow();
+        }
+
+        elapsed   = static_cast<uint32_t>(std::chrono::duration_cast<Seconds>(aNow - it->second.mStoreTime).count());
+        aResponse = it->second.mResponse;
+
+        for (uint16_t ttlOffset : it->second.mTtlOffsets)
+        {
+            ttl = ReadUint32(&aResponse[ttlOffset]);
+            WriteUint32(&aResponse[ttlOffset], ttl > elapsed ? ttl - elapsed : 0);
+        }
+    }
+
+    // The response takes the ID of the query.
+    aResponse[0] = aQuery[0];
+    aResponse[1] = aQuery[1];
+    found        = true;
+
+exit:
+    if (found)
+    {
+        mCounters.mHits++;
+    }
+    else
+    {
+        mCounters.mMisses++;
+    }
+
+    return found;
+}
+
+void DnsUpstreamCache::Store(const uint8_t *aResponse, size_t aLength, Timepoint aNow)
+{
+    std::string key;
+    size_t      offset;
+    uint16_t    flags;
+    uint16_t    answerCount;
+    uint16_t    authorityCount;
+    uint32_t    recordCount;
+    uint32_t    answerTtl   = kMaxTtl;
+    uint32_t    negativeTtl = 0;
+    bool        hasSoa      = false;
+    uint32_t    ttl;
+    Entry       entry;
+
+    // The TTL offsets are stored in 16 bits.
+    VerifyOrExit(aLength <= UINT16_MAX);
+    VerifyOrExit(ReadQuestion(aResponse, aLength, key, offset));
+
+    flags = ReadUint16(aResponse + kFlagsOffset);
+    VerifyOrExit((flags & (kFlagResponse | kOpcodeMask | kFlagTruncated)) == kFlagResponse);
+    VerifyOrExit((flags & kRcodeMask) == kRcodeNoError || (flags & kRcodeMask) == kRcodeNameError);
+
+    answerCount    = ReadUint16(aResponse + kAnswerCountOffset);
+    authorityCount = ReadUint16(aResponse + kAuthorityCountOffset);
+    recordCount    = answerCount + authorityCount + ReadUint16(aResponse + kAdditionalCountOffset);
+
+    for (uint32_t i = 0; i < recordCount; i++)
+    {
+        uint16_t type;
+        uint32_t recordTtl;
+        uint16_t dataLength;
+
+        VerifyOrExit(SkipName(aResponse, aLength, offset) && offset + kRecordHeaderSize <= aLength);
+
+        type       = ReadUint16(aResponse + offset);
+        recordTtl  = ReadUint32(aResponse + offset + kRecordTtlOffset);
+        dataLength = ReadUint16(aResponse + offset + kRecordDataLengthOffset);
+        VerifyOrExit(offset + kRecordHeaderSize + dataLength <= aLength);
+
+        // The TTL field of the OPT pseudo-record holds the extended flags.
+        if (type != kTypeOpt)
+        {
+            entry.mTtlOffsets.push_back(static_cast<uint16_t>(offset + kRecordTtlOffset));
+        }
+
+        if (i < answerCount)
+        {
+            answerTtl = std::min(answerTtl, recordTtl);
+        }
+        else if (i < answerCount + authorityCount && type == kTypeSoa && dataLength >= kSoaMinimumSize)
+        {
+            // The negative TTL is the smaller of the TTL and the MINIMUM field of the SOA record, see RFC 2308.
+            negativeTtl = std::min(
+                recordTtl, ReadUint32(aResponse + offset + kRecordHeaderSize + dataLength - kSoaMinimumSize));
+            hasSoa = true;
+        }
+
+        offset += kRecordHeaderSize + dataLength;
+    }
+
+    if ((flags & kRcodeMask) == kRcodeNoError && answerCount > 0)
+    {
+        ttl = answerTtl;
+    }
+    else
+    {
+        VerifyOrExit(hasSoa);
+        ttl = std::min(negativeTtl, kMaxNegativeTtl);
+    }
+
+    VerifyOrExit(ttl > 0);
+
+    entry.mResponse.assign(aResponse, aResponse + aLength);
+    entry.mStoreTime  = aNow;
+    entry.mExpireTime = aNow + Seconds(ttl);
+
+    if (mEntries.find(key) == mEntries.end())
+    {
+        MakeRoom(aNow);
+    }
+
+    mEntries[key] = std::move(entry);
+
+exit:
+    return;
+}
+
+void DnsUpstreamCache::MakeRoom(Timepoint aNow)
+{
+    VerifyOrExit(mEntries.size() >= kMaxEntries);
+
+    for (auto it = mEntries.begin(); it != mEntries.end();)
+    {
+        it = (it->second.mExpireTime <= aNow) ? mEntries.erase(it) : std::next(it);
+    }
+
+    if (mEntries.size() >= kMaxEntries)
+    {
+        // The response which expires the soonest is evicted.
+        mEntries.erase(std::min_element(mEntries.begin(), mEntries.end(),
+                                        [](const std::pair<const std::string, Entry> &aFirst,
+                                           const std::pair<const std::string, Entry> &aSecond) {
+                                            return aFirst.second.mExpireTime < aSecond.second.mExpireTime;
+                                        }));
+    }
+
+exit:
+    return;
+}
+
+} // namespace otbr
@@ -0,0 +1,148 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definition for the cache of upstream DNS responses.
+ */
+
+#ifndef OTBR_UTILS_DNS_UPSTREAM_CACHE_HPP_
+#define OTBR_UTILS_DNS_UPSTREAM_CACHE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/time.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a cache of the responses of the upstream DNS resolver.
+ *
+ * Responses with answers are cached for the smallest TTL of their answers, and name errors and responses without
+ * answers for the negative TTL given by the SOA record of their authority section (RFC 2308). Responses which are
+ * truncated, fail otherwise or carry no SOA record to bound their negative TTL are not cached. A cached response is
+ * answered with the ID of the query and with its TTLs decreased by the time it has been cached.
+ *
+ * Entries are keyed by the question of the query, whose name is compared without regard to ASCII case.
+ */
+class DnsUpstreamCache : private NonCopyable
+{
+public:
+    static constexpr size_t   kMaxEntries     = 256;  ///< The maximum number of cached responses.
+    static constexpr uint32_t kMaxTtl         = 3600; ///< The maximum TTL of positive responses in seconds.
+    static constexpr uint32_t kMaxNegativeTtl = 300;  ///< The maximum TTL of negative responses in seconds.
+
+    /**
+     * This structure represents the counters of the cache.
+     */
+    struct Counters
+    {
+        uint32_t mHits;   ///< The number of queries answered from the cache.
+        uint32_t mMisses; ///< The number of queries forwarded to the upstream resolver.
+    };
+
+    /**
+     * This constructor initializes an empty cache.
+     */
+    DnsUpstreamCache(void);
+
+    /**
+     * This method returns the cache of the upstream DNS responses of the agent.
+     *
+     * @returns The cache of the agent.
+     */
+    static DnsUpstreamCache &Get(void);
+
+    /**
+     * This method looks up the response to a query.
+     *
+     * @param[in]  aQuery     A pointer to the DNS query message.
+     * @param[in]  aLength    The length of the query message.
+     * @param[in]  aNow       The current time.
+     * @param[out] aResponse  The cached response to answer the query with.
+     *
+     * @retval TRUE   The query is answered by @p aResponse.
+     * @retval FALSE  The query should be forwarded to the upstream resolver.
+     */
+    bool Lookup(const uint8_t *aQuery, size_t aLength, Timepoint aNow, std::vector<uint8_t> &aResponse);
+
+    /**
+     * This method caches a response of the upstream resolver if it is cacheable.
+     *
+     * @param[in] aResponse  A pointer to the DNS response message.
+     * @param[in] aLength    The length of the response message.
+     * @param[in] aNow       The current time.
+     */
+    void Store(const uint8_t *aResponse, size_t aLength, Timepoint aNow);
+
+    /**
+     * This method removes all cached responses, the counters are kept.
+     */
+    void Clear(void) { mEntries.clear(); }
+
+    /**
+     * This method returns the number of cached responses.
+     *
+     * @returns The number of cached responses, including the expired ones not removed yet.
+     */
+    size_t GetSize(void) const { return mEntries.size(); }
+
+    /**
+     * This method returns the counters of the cache.
+     *
+     * @returns The counters.
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
+private:
+    struct Entry
+    {
+        std::vector<uint8_t>  mResponse;
+        std::vector<uint16_t> mTtlOffsets; // The offsets of the TTLs of the records in `mResponse`.
+        Timepoint             mStoreTime;
+        Timepoint             mExpireTime;
+    };
+
+    static bool ReadQuestion(const uint8_t *aMessage, size_t aLength, std::string &aKey, size_t &aOffset);
+    void        MakeRoom(Timepoint aNow);
+
+    std::unordered_map<std::string, Entry> mEntries;
+    Counters                               mCounters;
+};
+
+} // namespace otbr
+
+#endif // OTBR_UTILS_DNS_UPSTREAM_CACHE_HPP_
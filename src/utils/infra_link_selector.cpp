@@ -39,7 +39,7 @@
 
 #include <linux/rtnetlink.h>
 #include <net/if.h>
-#include <sys/ioctl.h>
+#include <string.h>
 #include <sys/socket.h>
 #include <unistd.h>
 
@@ -72,15 +72,18 @@ exit:
 InfraLinkSelector::InfraLinkSelector(std::vector<const char *> aInfraLinkNames)
     : mInfraLinkNames(std::move(aInfraLinkNames))
 {
+    // The link states are only learned from netlink messages: a dump of all links at start, then the changes.
     if (mInfraLinkNames.size() >= 2)
     {
         mNetlinkSocket = CreateNetLinkRouteSocket(RTMGRP_LINK);
         VerifyOrDie(mNetlinkSocket != -1, "Failed to create netlink socket");
-    }
 
-    for (const char *name : mInfraLinkNames)
-    {
-        mInfraLinkInfos[name].Update(QueryInfraLinkState(name));
+        for (const char *name : mInfraLinkNames)
+        {
+            mInfraLinkInfos[name];
+        }
+
+        RequestLinkDump();
     }
 }
 
@@ -93,6 +96,57 @@ InfraLinkSelector::~InfraLinkSelector(void)
     }
 }
 
+void InfraLinkSelector::SetInfraLinkNames(const std::vector<std::string> &aInfraLinkNames)
+{
+    const char *prevInfraLink = mCurrentInfraLink;
+
+    mInfraLinkNames.clear();
+    mInfraLinkInfos.clear();
+    mInfraLinkIndexes.clear();
+    mCurrentInfraLink = nullptr;
+    mRequireReselect  = true;
+
+    for (const std::string &name : aInfraLinkNames)
+    {
+        const char *storedName = mInfraLinkNameStorage.insert(name).first->c_str();
+
+        mInfraLinkNames.push_back(storedName);
+
+        if (prevInfraLink != nullptr && name == prevInfraLink)
+        {
+            mCurrentInfraLink = storedName;
+        }
+    }
+
+    otbrLogInfo("Infra link candidates updated, %zu netifs", mInfraLinkNames.size());
+
+    if (mInfraLinkNames.size() < 2)
+    {
+        if (mNetlinkSocket != -1)
+        {
+            close(mNetlinkSocket);
+            mNetlinkSocket = -1;
+        }
+        ExitNow();
+    }
+
+    if (mNetlinkSocket == -1)
+    {
+        mNetlinkSocket = CreateNetLinkRouteSocket(RTMGRP_LINK);
+        VerifyOrDie(mNetlinkSocket != -1, "Failed to create netlink socket");
+    }
+
+    for (const char *name : mInfraLinkNames)
+    {
+        mInfraLinkInfos[name];
+    }
+
+    RequestLinkDump();
+
+exit:
+    return;
+}
+
 const char *InfraLinkSelector::Select(void)
 {
     const char *sel;
@@ -206,31 +260,6 @@ exit:
     return mCurrentInfraLink;
 }
 
-InfraLinkSelector::LinkState InfraLinkSelector::QueryInfraLinkState(const char *aInfraLinkName)
-{
-    int                          sock = 0;
-    struct ifreq                 ifReq;
-    InfraLinkSelector::LinkState state = kInvalid;
-
-    sock = SocketWithCloseExec(AF_INET6, SOCK_DGRAM, IPPROTO_IP, kSocketBlock);
-    VerifyOrDie(sock != -1, "Failed to create AF_INET6 socket.");
-
-    memset(&ifReq, 0, sizeof(ifReq));
-    strncpy(ifReq.ifr_name, aInfraLinkName, sizeof(ifReq.ifr_name) - 1);
-
-    VerifyOrExit(ioctl(sock, SIOCGIFFLAGS, &ifReq) != -1);
-
-    state = (ifReq.ifr_flags & IFF_UP) ? ((ifReq.ifr_flags & IFF_RUNNING) ? kUpAndRunning : kUp) : kDown;
-
-exit:
-    if (sock != 0)
-    {
-        close(sock);
-    }
-
-    return state;
-}
-
 void InfraLinkSelector::Update(MainloopContext &aMainloop)
 {
     if (mNetlinkSocket != -1)
@@ -249,10 +278,33 @@ void InfraLinkSelector::Process(const MainloopContext &aMainloop)
     }
 }
 
-void InfraLinkSelector::ReceiveNetLinkMessage(void)
+void InfraLinkSelector::RequestLinkDump(void)
+{
+    struct
+    {
+        nlmsghdr  mHeader;
+        ifinfomsg mInfo;
+    } request;
+
+    memset(&request, 0, sizeof(request));
+    request.mHeader.nlmsg_len   = NLMSG_LENGTH(sizeof(request.mInfo));
+    request.mHeader.nlmsg_type  = RTM_GETLINK;
+    request.mHeader.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+    request.mInfo.ifi_family    = AF_UNSPEC;
+
+    VerifyOrDie(send(mNetlinkSocket, &request, request.mHeader.nlmsg_len, 0) != -1, "Failed to request netlink links");
+
+    // The socket is blocking, so the initial states are known before the first selection.
+    while (!ReceiveNetLinkMessage())
+    {
+    }
+}
+
+bool InfraLinkSelector::ReceiveNetLinkMessage(void)
 {
     const size_t kMaxNetLinkBufSize = 8192;
     ssize_t      len;
+    bool         done = false;
     union
     {
         nlmsghdr mHeader;
@@ -263,26 +315,27 @@ void InfraLinkSelector::ReceiveNetLinkMessage(void)
     if (len < 0)
     {
         otbrLogWarning("Failed to receive netlink message: %s", strerror(errno));
-        ExitNow();
+        ExitNow(done = true);
     }
 
     for (struct nlmsghdr *header = &msgBuffer.mHeader; NLMSG_OK(header, static_cast<size_t>(len));
          header                  = NLMSG_NEXT(header, len))
     {
-        struct ifinfomsg *ifinfo;
-
         switch (header->nlmsg_type)
         {
         case RTM_NEWLINK:
         case RTM_DELLINK:
-            ifinfo = reinterpret_cast<struct ifinfomsg *>(NLMSG_DATA(header));
-            HandleInfraLinkStateChange(ifinfo->ifi_index);
+            HandleLinkMessage(*header);
+            break;
+        case NLMSG_DONE:
+            done = true;
             break;
         case NLMSG_ERROR:
         {
             struct nlmsgerr *errMsg = reinterpret_cast<struct nlmsgerr *>(NLMSG_DATA(header));
 
             otbrLogWarning("netlink NLMSG_ERROR response: seq=%u, error=%d", header->nlmsg_seq, errMsg->error);
+            done = true;
             break;
         }
         default:
@@ -290,38 +343,80 @@ void InfraLinkSelector::ReceiveNetLinkMessage(void)
         }
     }
 
+exit:
+    return done;
+}
+
+void InfraLinkSelector::HandleLinkMessage(const struct nlmsghdr &aHeader)
+{
+    const struct ifinfomsg *ifinfo        = reinterpret_cast<const struct ifinfomsg *>(NLMSG_DATA(&aHeader));
+    uint32_t                index         = static_cast<uint32_t>(ifinfo->ifi_index);
+    const char             *infraLinkName = nullptr;
+    LinkState               state         = kInvalid;
+    int                     attrLen       = IFLA_PAYLOAD(&aHeader);
+    auto                    knownIndex    = mInfraLinkIndexes.find(index);
+
+    for (const struct rtattr *attr = IFLA_RTA(ifinfo); RTA_OK(attr, attrLen); attr = RTA_NEXT(attr, attrLen))
+    {
+        if (attr->rta_type == IFLA_IFNAME)
+        {
+            infraLinkName = FindInfraLinkName(reinterpret_cast<const char *>(RTA_DATA(attr)));
+            break;
+        }
+    }
+
+    // An infra link which is renamed no longer exists.
+    if (knownIndex != mInfraLinkIndexes.end() && knownIndex->second != infraLinkName)
+    {
+        UpdateInfraLinkState(knownIndex->second, index, kInvalid);
+        mInfraLinkIndexes.erase(knownIndex);
+    }
+
+    VerifyOrExit(infraLinkName != nullptr);
+
+    if (aHeader.nlmsg_type == RTM_DELLINK)
+    {
+        mInfraLinkIndexes.erase(index);
+    }
+    else
+    {
+        mInfraLinkIndexes[index] = infraLinkName;
+        state = (ifinfo->ifi_flags & IFF_UP) ? ((ifinfo->ifi_flags & IFF_RUNNING) ? kUpAndRunning : kUp) : kDown;
+    }
+
+    UpdateInfraLinkState(infraLinkName, index, state);
+
 exit:
     return;
 }
 
-void InfraLinkSelector::HandleInfraLinkStateChange(uint32_t aInfraLinkIndex)
+const char *InfraLinkSelector::FindInfraLinkName(const char *aName) const
 {
     const char *infraLinkName = nullptr;
 
     for (const char *name : mInfraLinkNames)
     {
-        if (aInfraLinkIndex == if_nametoindex(name))
+        if (strcmp(name, aName) == 0)
         {
             infraLinkName = name;
             break;
         }
     }
 
-    VerifyOrExit(infraLinkName != nullptr);
+    return infraLinkName;
+}
 
-    {
-        LinkInfo &linkInfo  = mInfraLinkInfos[infraLinkName];
-        LinkState prevState = linkInfo.mState;
+void InfraLinkSelector::UpdateInfraLinkState(const char *aInfraLinkName, uint32_t aInfraLinkIndex, LinkState aState)
+{
+    LinkInfo &linkInfo  = mInfraLinkInfos[aInfraLinkName];
+    LinkState prevState = linkInfo.mState;
 
-        if (linkInfo.Update(QueryInfraLinkState(infraLinkName)))
-        {
-            otbrLogInfo("Infra link name %s index %lu state changed: %s -> %s", infraLinkName, aInfraLinkIndex,
-                        LinkStateToString(prevState), LinkStateToString(linkInfo.mState));
-            mRequireReselect = true;
-        }
+    if (linkInfo.Update(aState))
+    {
+        otbrLogInfo("Infra link name %s index %u state changed: %s -> %s", aInfraLinkName, aInfraLinkIndex,
+                    LinkStateToString(prevState), LinkStateToString(linkInfo.mState));
+        mRequireReselect = true;
     }
-exit:
-    return;
 }
 
 const char *InfraLinkSelector::LinkStateToString(LinkState aState)
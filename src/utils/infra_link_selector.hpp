@@ -40,9 +40,13 @@
 
 #include <assert.h>
 #include <map>
+#include <set>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include <linux/netlink.h>
+
 #include <openthread/backbone_router_ftd.h>
 
 #include "common/code_utils.hpp"
@@ -97,6 +101,16 @@ public:
      */
     const char *Select(void);
 
+    /**
+     * This method replaces the infrastructure link candidates, like on a configuration reload.
+     *
+     * The current infrastructure link stays selected if it's still a candidate. The names are copied and kept for
+     * the lifetime of the selector, so the names returned by `Select()` stay valid.
+     *
+     * @param[in]  aInfraLinkNames  A list of infrastructure link candidates to select from.
+     */
+    void SetInfraLinkNames(const std::vector<std::string> &aInfraLinkNames);
+
 private:
     /**
      * This enumeration infrastructure link states.
@@ -125,18 +139,25 @@ private:
     const char *SelectGeneric(void);
 
     static const char *LinkStateToString(LinkState aState);
-    static LinkState   QueryInfraLinkState(const char *aInfraLinkName);
+    const char        *GetName(void) const override { return "InfraLinkSelector"; }
     void               Update(MainloopContext &aMainloop) override;
     void               Process(const MainloopContext &aMainloop) override;
-    void               ReceiveNetLinkMessage(void);
-    void               HandleInfraLinkStateChange(uint32_t aInfraLinkIndex);
+    void               RequestLinkDump(void);
+    bool               ReceiveNetLinkMessage(void);
+    void               HandleLinkMessage(const struct nlmsghdr &aHeader);
+    const char        *FindInfraLinkName(const char *aName) const;
+    void               UpdateInfraLinkState(const char *aInfraLinkName, uint32_t aInfraLinkIndex, LinkState aState);
 
     std::vector<const char *>        mInfraLinkNames;
     std::map<const char *, LinkInfo> mInfraLinkInfos;
+    // The interface index of each infra link which exists, learned from netlink messages
+    std::map<uint32_t, const char *> mInfraLinkIndexes;
     int                              mNetlinkSocket    = -1;
     const char                      *mCurrentInfraLink = nullptr;
     TaskRunner                       mTaskRunner;
     bool                             mRequireReselect = true;
+    // The candidates set by `SetInfraLinkNames()`, whose nodes stay at stable addresses
+    std::set<std::string> mInfraLinkNameStorage;
 };
 
 } // namespace Utils
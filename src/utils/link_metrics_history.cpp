@@ -0,0 +1,120 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the per-neighbor history of sampled link metrics.
+ */
+
+#include "utils/link_metrics_history.hpp"
+
+#include <algorithm>
+
+namespace otbr {
+
+void LinkMetricsHistory::Record(uint64_t aExtAddress, const Sample &aSample, Timepoint aNow)
+{
+    auto  result = mNeighbors.emplace(aExtAddress, Ring());
+    Ring &ring   = result.first->second;
+
+    if (result.second)
+    {
+        ring.mNext          = 0;
+        ring.mCount         = 0;
+        ring.mLinkMarginSum = 0;
+        ring.mRssiSum       = 0;
+    }
+
+    if (ring.mCount == kMaxSamples)
+    {
+        ring.mLinkMarginSum -= ring.mSamples[ring.mNext].mLinkMargin;
+        ring.mRssiSum -= ring.mSamples[ring.mNext].mRssi;
+    }
+    else
+    {
+        ring.mCount++;
+    }
+
+    ring.mLinkMarginSum += aSample.mLinkMargin;
+    ring.mRssiSum += aSample.mRssi;
+
+    ring.mSamples[ring.mNext] = aSample;
+    ring.mNext                = (ring.mNext + 1) % kMaxSamples;
+    ring.mLastSampleTime      = aNow;
+}
+
+void LinkMetricsHistory::RemoveStale(Timepoint aOldest)
+{
+    for (auto it = mNeighbors.begin(); it != mNeighbors.end();)
+    {
+        if (it->second.mLastSampleTime < aOldest)
+        {
+            it = mNeighbors.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+bool LinkMetricsHistory::GetSummary(uint64_t aExtAddress, Summary &aSummary) const
+{
+    auto it    = mNeighbors.find(aExtAddress);
+    bool found = (it != mNeighbors.end());
+
+    if (found)
+    {
+        aSummary = it->second.GetSummary();
+    }
+
+    return found;
+}
+
+LinkMetricsHistory::Summary LinkMetricsHistory::Ring::GetSummary(void) const
+{
+    Summary summary;
+
+    summary.mLatest            = mSamples[(mNext + kMaxSamples - 1) % kMaxSamples];
+    summary.mSampleCount       = mCount;
+    summary.mMinLinkMargin     = summary.mLatest.mLinkMargin;
+    summary.mMinRssi           = summary.mLatest.mRssi;
+    summary.mAverageLinkMargin = static_cast<uint8_t>(mLinkMarginSum / mCount);
+    summary.mAverageRssi       = static_cast<int8_t>(mRssiSum / mCount);
+    summary.mLastSampleTime    = mLastSampleTime;
+
+    for (uint8_t i = 0; i < mCount; i++)
+    {
+        summary.mMinLinkMargin = std::min(summary.mMinLinkMargin, mSamples[i].mLinkMargin);
+        summary.mMinRssi       = std::min(summary.mMinRssi, mSamples[i].mRssi);
+    }
+
+    return summary;
+}
+
+} // namespace otbr
@@ -0,0 +1,156 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file defines the per-neighbor history of sampled link metrics.
+ */
+
+#ifndef OTBR_UTILS_LINK_METRICS_HISTORY_HPP_
+#define OTBR_UTILS_LINK_METRICS_HISTORY_HPP_
+
+#include "openthread-br/config.h"
+
+#include <unordered_map>
+
+#include <stdint.h>
+
+#include "common/time.hpp"
+
+namespace otbr {
+
+/**
+ * This class keeps a bounded history of link metrics samples for each neighbor.
+ *
+ * Each neighbor keeps its latest `kMaxSamples` samples in a ring, along with running sums so that the summary of a
+ * neighbor is computed in constant time. This class is not thread-safe and must only be used on the mainloop.
+ */
+class LinkMetricsHistory
+{
+public:
+    enum
+    {
+        kMaxSamples = 16, ///< The number of samples kept for each neighbor.
+    };
+
+    /**
+     * This structure represents a link metrics sample.
+     */
+    struct Sample
+    {
+        uint8_t mLinkMargin; ///< The link margin in dB.
+        int8_t  mRssi;       ///< The RSSI in dBm.
+    };
+
+    /**
+     * This structure represents the summary of the samples of a neighbor.
+     */
+    struct Summary
+    {
+        Sample    mLatest;            ///< The latest sample.
+        uint8_t   mSampleCount;       ///< The number of samples in the history.
+        uint8_t   mMinLinkMargin;     ///< The minimum link margin in the history.
+        int8_t    mMinRssi;           ///< The minimum RSSI in the history.
+        uint8_t   mAverageLinkMargin; ///< The average link margin in the history.
+        int8_t    mAverageRssi;       ///< The average RSSI in the history.
+        Timepoint mLastSampleTime;    ///< The time of the latest sample.
+    };
+
+    /**
+     * This method records a sample for a neighbor.
+     *
+     * The oldest sample of the neighbor is dropped when its history is full.
+     *
+     * @param[in] aExtAddress  The extended address of the neighbor.
+     * @param[in] aSample      The sample.
+     * @param[in] aNow         The time of the sample.
+     */
+    void Record(uint64_t aExtAddress, const Sample &aSample, Timepoint aNow);
+
+    /**
+     * This method removes the neighbors which have no sample since @p aOldest.
+     *
+     * @param[in] aOldest  The time of the oldest sample to keep.
+     */
+    void RemoveStale(Timepoint aOldest);
+
+    /**
+     * This method removes all neighbors.
+     */
+    void Clear(void) { mNeighbors.clear(); }
+
+    /**
+     * This method returns the number of neighbors with samples.
+     *
+     * @returns The number of neighbors.
+     */
+    size_t GetNeighborCount(void) const { return mNeighbors.size(); }
+
+    /**
+     * This method gets the summary of a neighbor.
+     *
+     * @param[in]  aExtAddress  The extended address of the neighbor.
+     * @param[out] aSummary     The summary of the neighbor.
+     *
+     * @retval TRUE   The neighbor has samples and @p aSummary is filled.
+     * @retval FALSE  The neighbor has no sample.
+     */
+    bool GetSummary(uint64_t aExtAddress, Summary &aSummary) const;
+
+    /**
+     * This method calls @p aHandler with the extended address and the summary of each neighbor.
+     *
+     * @param[in] aHandler  The handler, invoked as `aHandler(uint64_t, const Summary &)`.
+     */
+    template <typename Handler> void ForEach(Handler &&aHandler) const
+    {
+        for (const auto &neighbor : mNeighbors)
+        {
+            aHandler(neighbor.first, neighbor.second.GetSummary());
+        }
+    }
+
+private:
+    struct Ring
+    {
+        Summary GetSummary(void) const;
+
+        Sample    mSamples[kMaxSamples];
+        uint8_t   mNext;
+        uint8_t   mCount;
+        uint16_t  mLinkMarginSum;
+        int16_t   mRssiSum;
+        Timepoint mLastSampleTime;
+    };
+
+    std::unordered_map<uint64_t, Ring> mNeighbors;
+};
+
+} // namespace otbr
+
+#endif // OTBR_UTILS_LINK_METRICS_HISTORY_HPP_
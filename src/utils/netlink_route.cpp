@@ -0,0 +1,341 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements programming IPv6 routes and policy rules through rtnetlink.
+ */
+
+#define OTBR_LOG_TAG "UTILS"
+
+#include "utils/netlink_route.hpp"
+
+#ifdef __linux__
+
+#include <assert.h>
+#include <errno.h>
+#include <net/if.h>
+#include <poll.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <linux/fib_rules.h>
+#include <linux/neighbour.h>
+
+#include "common/logging.hpp"
+#include "utils/socket_utils.hpp"
+
+namespace otbr {
+namespace Utils {
+
+rtattr *AddRtAttr(nlmsghdr *aHeader, uint32_t aMaxLen, uint16_t aType, const void *aData, uint16_t aLen)
+{
+    uint16_t len = RTA_LENGTH(aLen);
+    rtattr  *rta;
+
+    assert(NLMSG_ALIGN(aHeader->nlmsg_len) + RTA_ALIGN(len) <= aMaxLen);
+    OTBR_UNUSED_VARIABLE(aMaxLen);
+
+    rta           = reinterpret_cast<rtattr *>(reinterpret_cast<char *>(aHeader) + NLMSG_ALIGN((aHeader)->nlmsg_len));
+    rta->rta_type = aType;
+    rta->rta_len  = len;
+    if (aLen)
+    {
+        memcpy(RTA_DATA(rta), aData, aLen);
+    }
+    aHeader->nlmsg_len = NLMSG_ALIGN(aHeader->nlmsg_len) + RTA_ALIGN(len);
+
+    return rta;
+}
+
+constexpr int    NetlinkRouteSocket::kAckTimeoutMs;
+constexpr size_t NetlinkRouteSocket::kMaxDatagramSize;
+
+NetlinkRouteSocket::NetlinkRouteSocket(void)
+    : mFd(-1)
+    , mSequence(0)
+{
+}
+
+NetlinkRouteSocket::~NetlinkRouteSocket(void)
+{
+    if (mFd >= 0)
+    {
+        close(mFd);
+    }
+}
+
+otbrError NetlinkRouteSocket::Open(void)
+{
+    otbrError   error = OTBR_ERROR_NONE;
+    sockaddr_nl sa;
+
+    VerifyOrExit(mFd < 0);
+
+    mFd = SocketWithCloseExec(AF_NETLINK, SOCK_RAW, NETLINK_ROUTE, kSocketNonBlock);
+    VerifyOrExit(mFd >= 0, error = OTBR_ERROR_ERRNO);
+
+    memset(&sa, 0, sizeof(sa));
+    sa.nl_family = AF_NETLINK;
+
+    if (bind(mFd, reinterpret_cast<sockaddr *>(&sa), sizeof(sa)) != 0)
+    {
+        error = OTBR_ERROR_ERRNO;
+        close(mFd);
+        mFd = -1;
+    }
+
+exit:
+    return error;
+}
+
+void NetlinkRouteSocket::Queue(const nlmsghdr &aHeader)
+{
+    const uint8_t *begin = reinterpret_cast<const uint8_t *>(&aHeader);
+
+    mBatch.insert(mBatch.end(), begin, begin + NLMSG_ALIGN(aHeader.nlmsg_len));
+}
+
+void NetlinkRouteSocket::QueueRoute(bool               aIsAdd,
+                                    const Ip6Prefix   &aPrefix,
+                                    const std::string &aIfName,
+                                    uint32_t           aTable,
+                                    uint32_t           aMetric)
+{
+    struct
+    {
+        nlmsghdr nh;
+        rtmsg    rt;
+        char     buf[128];
+    } req;
+    uint32_t ifIndex = if_nametoindex(aIfName.c_str());
+
+    memset(&req, 0, sizeof(req));
+
+    req.nh.nlmsg_len   = NLMSG_LENGTH(sizeof(rtmsg));
+    req.nh.nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK | (aIsAdd ? (NLM_F_CREATE | NLM_F_EXCL) : 0);
+    req.nh.nlmsg_type  = aIsAdd ? RTM_NEWROUTE : RTM_DELROUTE;
+    req.nh.nlmsg_seq   = ++mSequence;
+
+    req.rt.rtm_family   = AF_INET6;
+    req.rt.rtm_dst_len  = aPrefix.mLength;
+    req.rt.rtm_table    = aTable < 256 ? static_cast<uint8_t>(aTable) : static_cast<uint8_t>(RT_TABLE_UNSPEC);
+    req.rt.rtm_protocol = RTPROT_STATIC;
+    req.rt.rtm_scope    = RT_SCOPE_UNIVERSE;
+    req.rt.rtm_type     = RTN_UNICAST;
+
+    AddRtAttr(&req.nh, sizeof(req), RTA_DST, aPrefix.mPrefix.m8, sizeof(aPrefix.mPrefix.m8));
+    AddRtAttr(&req.nh, sizeof(req), RTA_OIF, &ifIndex, sizeof(ifIndex));
+    AddRtAttr(&req.nh, sizeof(req), RTA_TABLE, &aTable, sizeof(aTable));
+    if (aMetric != 0)
+    {
+        AddRtAttr(&req.nh, sizeof(req), RTA_PRIORITY, &aMetric, sizeof(aMetric));
+    }
+
+    Queue(req.nh);
+
+    otbrLogInfo("Queued request#%u to %s route %s dev %s table %u", mSequence, aIsAdd ? "add" : "delete",
+                aPrefix.ToInfoString().AsCString(), aIfName.c_str(), aTable);
+}
+
+void NetlinkRouteSocket::QueueRule(bool aIsAdd, const std::string &aIifName, uint32_t aTable)
+{
+    struct
+    {
+        nlmsghdr     nh;
+        fib_rule_hdr frh;
+        char         buf[128];
+    } req;
+
+    assert(aIifName.size() < IFNAMSIZ);
+    memset(&req, 0, sizeof(req));
+
+    req.nh.nlmsg_len   = NLMSG_LENGTH(sizeof(fib_rule_hdr));
+    req.nh.nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK | (aIsAdd ? (NLM_F_CREATE | NLM_F_EXCL) : 0);
+    req.nh.nlmsg_type  = aIsAdd ? RTM_NEWRULE : RTM_DELRULE;
+    req.nh.nlmsg_seq   = ++mSequence;
+
+    req.frh.family = AF_INET6;
+    req.frh.table  = aTable < 256 ? static_cast<uint8_t>(aTable) : static_cast<uint8_t>(RT_TABLE_UNSPEC);
+    req.frh.action = FR_ACT_TO_TBL;
+
+    AddRtAttr(&req.nh, sizeof(req), FRA_IIFNAME, aIifName.c_str(), static_cast<uint16_t>(aIifName.size() + 1));
+    AddRtAttr(&req.nh, sizeof(req), FRA_TABLE, &aTable, sizeof(aTable));
+
+    Queue(req.nh);
+
+    otbrLogInfo("Queued request#%u to %s rule iif %s table %u", mSequence, aIsAdd ? "add" : "delete",
+                aIifName.c_str(), aTable);
+}
+
+void NetlinkRouteSocket::QueueProxyNeighbor(bool aIsAdd, const Ip6Address &aAddress, const std::string &aIfName)
+{
+    struct
+    {
+        nlmsghdr nh;
+        ndmsg    nd;
+        char     buf[64];
+    } req;
+
+    memset(&req, 0, sizeof(req));
+
+    req.nh.nlmsg_len   = NLMSG_LENGTH(sizeof(ndmsg));
+    req.nh.nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK | (aIsAdd ? (NLM_F_CREATE | NLM_F_REPLACE) : 0);
+    req.nh.nlmsg_type  = aIsAdd ? RTM_NEWNEIGH : RTM_DELNEIGH;
+    req.nh.nlmsg_seq   = ++mSequence;
+
+    req.nd.ndm_family  = AF_INET6;
+    req.nd.ndm_ifindex = static_cast<int>(if_nametoindex(aIfName.c_str()));
+    req.nd.ndm_flags   = NTF_PROXY;
+    req.nd.ndm_state   = NUD_PERMANENT;
+
+    AddRtAttr(&req.nh, sizeof(req), NDA_DST, aAddress.m8, sizeof(aAddress.m8));
+
+    Queue(req.nh);
+
+    otbrLogDebug("Queued request#%u to %s proxy neighbor %s dev %s", mSequence, aIsAdd ? "add" : "delete",
+                 aAddress.ToInfoString().AsCString(), aIfName.c_str());
+}
+
+otbrError NetlinkRouteSocket::Commit(void)
+{
+    otbrError error  = OTBR_ERROR_NONE;
+    size_t    offset = 0;
+
+    VerifyOrExit(!mBatch.empty());
+    SuccessOrExit(error = Open());
+
+    // Requests go to the kernel in as few datagrams as possible, rtnetlink processes them in order and
+    // acknowledges each of them separately. Datagrams are bounded so that large batches fit the socket buffer.
+    while (offset < mBatch.size())
+    {
+        size_t    length = 0;
+        uint32_t  firstSequence;
+        uint32_t  lastSequence;
+        otbrError chunkError;
+
+        firstSequence = reinterpret_cast<const nlmsghdr *>(&mBatch[offset])->nlmsg_seq;
+        lastSequence  = firstSequence;
+
+        while (offset + length < mBatch.size())
+        {
+            const nlmsghdr *msg       = reinterpret_cast<const nlmsghdr *>(&mBatch[offset + length]);
+            size_t          msgLength = NLMSG_ALIGN(msg->nlmsg_len);
+
+            if (length != 0 && length + msgLength > kMaxDatagramSize)
+            {
+                break;
+            }
+
+            lastSequence = msg->nlmsg_seq;
+            length += msgLength;
+        }
+
+        if (send(mFd, &mBatch[offset], length, 0) == -1)
+        {
+            otbrLogWarning("Failed to send requests#%u-#%u: %s", firstSequence, lastSequence, strerror(errno));
+            ExitNow(error = OTBR_ERROR_ERRNO);
+        }
+
+        chunkError = WaitForAcks(firstSequence, lastSequence);
+        if (chunkError != OTBR_ERROR_NONE)
+        {
+            error = chunkError;
+        }
+
+        offset += length;
+    }
+
+exit:
+    mBatch.clear();
+    return error;
+}
+
+otbrError NetlinkRouteSocket::WaitForAcks(uint32_t aFirstSequence, uint32_t aLastSequence)
+{
+    otbrError error    = OTBR_ERROR_NONE;
+    uint32_t  numAcked = 0;
+    uint32_t  numTotal = aLastSequence - aFirstSequence + 1;
+
+    while (numAcked < numTotal)
+    {
+        alignas(nlmsghdr) char buffer[8192];
+        pollfd                 pfd = {mFd, POLLIN, 0};
+        ssize_t                length;
+
+        if (poll(&pfd, 1, kAckTimeoutMs) <= 0)
+        {
+            otbrLogWarning("Timed out waiting for the acks of requests#%u-#%u", aFirstSequence, aLastSequence);
+            ExitNow(error = OTBR_ERROR_ERRNO);
+        }
+
+        length = recv(mFd, buffer, sizeof(buffer), 0);
+        if (length < 0)
+        {
+            VerifyOrExit(errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR, error = OTBR_ERROR_ERRNO);
+            continue;
+        }
+
+        for (nlmsghdr *msg = reinterpret_cast<nlmsghdr *>(buffer); NLMSG_OK(msg, static_cast<unsigned int>(length));
+             msg       = NLMSG_NEXT(msg, length))
+        {
+            const nlmsgerr *ack;
+            bool            isAdd;
+
+            if (msg->nlmsg_type != NLMSG_ERROR || msg->nlmsg_seq < aFirstSequence || msg->nlmsg_seq > aLastSequence ||
+                msg->nlmsg_len < NLMSG_LENGTH(sizeof(nlmsgerr)))
+            {
+                continue;
+            }
+
+            ack   = reinterpret_cast<const nlmsgerr *>(NLMSG_DATA(msg));
+            isAdd = (ack->msg.nlmsg_type == RTM_NEWROUTE || ack->msg.nlmsg_type == RTM_NEWRULE ||
+                     ack->msg.nlmsg_type == RTM_NEWNEIGH);
+            numAcked++;
+
+            if (ack->error == 0 || (isAdd && ack->error == -EEXIST) ||
+                (!isAdd && (ack->error == -ENOENT || ack->error == -ESRCH)))
+            {
+                otbrLogDebug("Request#%u succeeded", msg->nlmsg_seq);
+            }
+            else
+            {
+                otbrLogWarning("Request#%u failed: %s", msg->nlmsg_seq, strerror(-ack->error));
+                error = OTBR_ERROR_ERRNO;
+            }
+        }
+    }
+
+exit:
+    return error;
+}
+
+} // namespace Utils
+} // namespace otbr
+
+#endif // __linux__
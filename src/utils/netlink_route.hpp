@@ -0,0 +1,151 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for programming IPv6 routes and policy rules through rtnetlink.
+ */
+
+#ifndef OTBR_UTILS_NETLINK_ROUTE_HPP_
+#define OTBR_UTILS_NETLINK_ROUTE_HPP_
+
+#include "openthread-br/config.h"
+
+#ifdef __linux__
+
+#include <string>
+#include <vector>
+
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+
+#include "common/code_utils.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+namespace Utils {
+
+/**
+ * This function appends an attribute to a netlink message.
+ *
+ * @param[in] aHeader  A pointer to the netlink message header.
+ * @param[in] aMaxLen  The size of the buffer holding the netlink message.
+ * @param[in] aType    The attribute type.
+ * @param[in] aData    A pointer to the attribute value.
+ * @param[in] aLen     The length of the attribute value.
+ *
+ * @returns A pointer to the appended attribute.
+ */
+rtattr *AddRtAttr(nlmsghdr *aHeader, uint32_t aMaxLen, uint16_t aType, const void *aData, uint16_t aLen);
+
+/**
+ * This class programs IPv6 routes, policy rules and proxy neighbor entries through a NETLINK_ROUTE socket.
+ *
+ * Requests are queued and sent to the kernel in as few datagrams as possible by `Commit()`, which then waits for the
+ * kernel to acknowledge each of them. This replaces spawning `ip -6 route` and `ip -6 rule` commands.
+ */
+class NetlinkRouteSocket : private NonCopyable
+{
+public:
+    /**
+     * This constructor initializes the netlink route socket, without opening it.
+     */
+    NetlinkRouteSocket(void);
+
+    /**
+     * This destructor closes the netlink route socket.
+     */
+    ~NetlinkRouteSocket(void);
+
+    /**
+     * This method queues a request to add or delete a static route.
+     *
+     * @param[in] aIsAdd   Whether to add or to delete the route.
+     * @param[in] aPrefix  The destination prefix.
+     * @param[in] aIfName  The name of the output interface.
+     * @param[in] aTable   The routing table.
+     * @param[in] aMetric  The route metric, 0 to use the kernel default.
+     */
+    void QueueRoute(bool aIsAdd, const Ip6Prefix &aPrefix, const std::string &aIfName, uint32_t aTable, uint32_t aMetric);
+
+    /**
+     * This method queues a request to add or delete a policy rule which looks up @p aTable for packets received on
+     * @p aIifName.
+     *
+     * @param[in] aIsAdd    Whether to add or to delete the rule.
+     * @param[in] aIifName  The name of the input interface.
+     * @param[in] aTable    The routing table.
+     */
+    void QueueRule(bool aIsAdd, const std::string &aIifName, uint32_t aTable);
+
+    /**
+     * This method queues a request to add or delete a proxy neighbor entry, which makes the kernel answer Neighbor
+     * Solicitations for @p aAddress received on @p aIfName when `proxy_ndp` is enabled.
+     *
+     * @param[in] aIsAdd    Whether to add or to delete the entry.
+     * @param[in] aAddress  The proxied address.
+     * @param[in] aIfName   The name of the interface.
+     */
+    void QueueProxyNeighbor(bool aIsAdd, const Ip6Address &aAddress, const std::string &aIfName);
+
+    /**
+     * This method sends all queued requests to the kernel and waits for their acknowledgements.
+     *
+     * Adding an existing route, rule or neighbor entry, and deleting a missing one, are not considered failures.
+     *
+     * @retval OTBR_ERROR_NONE   All requests succeeded.
+     * @retval OTBR_ERROR_ERRNO  Failed to talk to the kernel or at least one request failed.
+     */
+    otbrError Commit(void);
+
+    /**
+     * This method indicates whether there are queued requests which are not committed yet.
+     *
+     * @returns TRUE if there are queued requests, FALSE otherwise.
+     */
+    bool HasPendingRequests(void) const { return !mBatch.empty(); }
+
+private:
+    static constexpr int    kAckTimeoutMs    = 1000;
+    static constexpr size_t kMaxDatagramSize = 32 * 1024;
+
+    otbrError Open(void);
+    void      Queue(const nlmsghdr &aHeader);
+    otbrError WaitForAcks(uint32_t aFirstSequence, uint32_t aLastSequence);
+
+    int                  mFd;
+    uint32_t             mSequence;
+    std::vector<uint8_t> mBatch;
+};
+
+} // namespace Utils
+} // namespace otbr
+
+#endif // __linux__
+
+#endif // OTBR_UTILS_NETLINK_ROUTE_HPP_
@@ -33,12 +33,47 @@
 
 #include "utils/pskc.hpp"
 
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include <mbedtls/aes.h>
+#include <mbedtls/sha256.h>
+
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 
 namespace otbr {
 namespace Psk {
 
+namespace {
+
+constexpr size_t kMaxCachedPskcs     = 8;
+constexpr size_t kPassphraseHashSize = 32; // SHA-256
+
+struct CachedPskc
+{
+    std::vector<uint8_t> mSalt;
+    uint8_t              mPassphraseHash[kPassphraseHashSize];
+    uint8_t              mPskc[OT_PSKC_LENGTH];
+};
+
+std::mutex             sCacheMutex;
+std::deque<CachedPskc> sCache; // Most recently used first.
+
+void HashPassphrase(const char *aPassphrase, size_t aLength, uint8_t (&aHash)[kPassphraseHashSize])
+{
+    mbedtls_sha256_context sha256;
+
+    mbedtls_sha256_init(&sha256);
+    mbedtls_sha256_starts(&sha256, 0);
+    mbedtls_sha256_update(&sha256, reinterpret_cast<const uint8_t *>(aPassphrase), aLength);
+    mbedtls_sha256_finish(&sha256, aHash);
+    mbedtls_sha256_free(&sha256);
+}
+
+} // namespace
+
 void Pskc::SetSalt(const uint8_t *aExtPanId, const char *aNetworkName)
 {
     const char *saltPrefix     = "Thread";
@@ -81,17 +116,90 @@ exit:
 
 const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase)
 {
-    uint32_t blockCounter = 0;
-    uint16_t useLen       = 0;
-    uint16_t prfBlockLen  = MBEDTLS_CIPHER_BLKSIZE_MAX;
-    uint8_t  prfInput[OT_PBKDF2_SALT_MAX_LENGTH + 4];
-    uint8_t  prfOutput[MBEDTLS_CIPHER_BLKSIZE_MAX];
-    uint8_t  keyBlock[MBEDTLS_CIPHER_BLKSIZE_MAX];
-    uint16_t keyLen = OT_PSKC_LENGTH;
-    uint8_t *pskc   = mPskc;
+    CachedPskc entry;
 
     SetSalt(aExtPanId, aNetworkName);
 
+    entry.mSalt.assign(mSalt, mSalt + mSaltLen);
+    HashPassphrase(aPassphrase, strlen(aPassphrase), entry.mPassphraseHash);
+
+    {
+        std::lock_guard<std::mutex> _(sCacheMutex);
+
+        for (auto it = sCache.begin(); it != sCache.end(); ++it)
+        {
+            if (it->mSalt == entry.mSalt &&
+                memcmp(it->mPassphraseHash, entry.mPassphraseHash, sizeof(entry.mPassphraseHash)) == 0)
+            {
+                memcpy(mPskc, it->mPskc, sizeof(mPskc));
+                entry = std::move(*it);
+                sCache.erase(it);
+                sCache.push_front(std::move(entry));
+                ExitNow();
+            }
+        }
+    }
+
+    // The derivation runs without the lock, concurrent requests for other credentials aren't blocked.
+    DerivePskc(aPassphrase);
+
+    memcpy(entry.mPskc, mPskc, sizeof(mPskc));
+
+    {
+        std::lock_guard<std::mutex> _(sCacheMutex);
+
+        sCache.push_front(std::move(entry));
+        if (sCache.size() > kMaxCachedPskcs)
+        {
+            sCache.pop_back();
+        }
+    }
+
+exit:
+    return mPskc;
+}
+
+void Pskc::ClearCache(void)
+{
+    std::lock_guard<std::mutex> _(sCacheMutex);
+
+    sCache.clear();
+}
+
+void Pskc::DerivePskc(const char *aPassphrase)
+{
+    const mbedtls_cipher_info_t *cipherInfo    = mbedtls_cipher_info_from_type(MBEDTLS_CIPHER_AES_128_ECB);
+    const size_t                 passphraseLen = strlen(aPassphrase);
+    const uint8_t                zeroKey[MBEDTLS_AES_BLOCK_SIZE] = {};
+    mbedtls_cipher_context_t     cmac;
+    uint8_t                      prfKey[MBEDTLS_AES_BLOCK_SIZE];
+    uint32_t                     blockCounter = 0;
+    uint16_t                     useLen       = 0;
+    uint16_t                     prfBlockLen  = MBEDTLS_AES_BLOCK_SIZE;
+    uint8_t                      prfInput[OT_PBKDF2_SALT_MAX_LENGTH + 4];
+    uint8_t                      prfOutput[MBEDTLS_AES_BLOCK_SIZE];
+    uint8_t                      keyBlock[MBEDTLS_AES_BLOCK_SIZE];
+    uint16_t                     keyLen = OT_PSKC_LENGTH;
+    uint8_t                     *pskc   = mPskc;
+
+    // AES-CMAC-PRF-128 (RFC 4615) uses the passphrase as the key if it's 16 bytes long, and its CMAC
+    // under the zero key otherwise. The key is the same for all iterations, so it's expanded only once
+    // here and each iteration only resets the CMAC state, as `mbedtls_aes_cmac_prf_128()` would set up
+    // the key schedule anew each time.
+    if (passphraseLen == MBEDTLS_AES_BLOCK_SIZE)
+    {
+        memcpy(prfKey, aPassphrase, sizeof(prfKey));
+    }
+    else
+    {
+        mbedtls_cipher_cmac(cipherInfo, zeroKey, 128, reinterpret_cast<const uint8_t *>(aPassphrase), passphraseLen,
+                            prfKey);
+    }
+
+    mbedtls_cipher_init(&cmac);
+    mbedtls_cipher_setup(&cmac, cipherInfo);
+    mbedtls_cipher_cmac_starts(&cmac, prfKey, 128);
+
     while (keyLen)
     {
         memcpy(prfInput, mSalt, mSaltLen);
@@ -102,8 +210,9 @@ const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkN
         prfInput[mSaltLen + 2] = (uint8_t)(blockCounter >> 8);
         prfInput[mSaltLen + 3] = (uint8_t)(blockCounter);
         // Calculate U_1
-        mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase), prfInput,
-                                 mSaltLen + 4, prfOutput);
+        mbedtls_cipher_cmac_reset(&cmac);
+        mbedtls_cipher_cmac_update(&cmac, prfInput, mSaltLen + 4);
+        mbedtls_cipher_cmac_finish(&cmac, prfOutput);
         memcpy(keyBlock, prfOutput, prfBlockLen);
 
         for (uint32_t i = 1; i < OT_ITERATION_COUNTS; i++)
@@ -111,8 +220,9 @@ const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkN
             memcpy(prfInput, prfOutput, prfBlockLen);
 
             // Calculate U_i
-            mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase), prfInput,
-                                     prfBlockLen, prfOutput);
+            mbedtls_cipher_cmac_reset(&cmac);
+            mbedtls_cipher_cmac_update(&cmac, prfInput, prfBlockLen);
+            mbedtls_cipher_cmac_finish(&cmac, prfOutput);
 
             // xor
             for (uint32_t j = 0; j < prfBlockLen; j++)
@@ -126,7 +236,9 @@ const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkN
         pskc += useLen;
         keyLen -= useLen;
     }
-    return mPskc;
+
+    mbedtls_cipher_free(&cmac);
+    memset(prfKey, 0, sizeof(prfKey));
 }
 
 } // namespace Psk
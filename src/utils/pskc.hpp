@@ -62,6 +62,9 @@ public:
     /**
      * This method computes the PSKc.
      *
+     * The PSKc of recently used credentials are cached process-wide, keyed by the salt and a hash of the
+     * passphrase, so that repeating a request doesn't run the PBKDF2 iterations again.
+     *
      * @param[in] aExtPanId     A pointer to extended PAN ID.
      * @param[in] aNetworkName  A pointer to network name.
      * @param[in] aPassphrase   A pointer to passphrase.
@@ -70,8 +73,14 @@ public:
      */
     const uint8_t *ComputePskc(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase);
 
+    /**
+     * This method clears the cached PSKc of all credentials.
+     */
+    static void ClearCache(void);
+
 private:
     void SetSalt(const uint8_t *aExtPanId, const char *aNetworkName);
+    void DerivePskc(const char *aPassphrase);
 
     char     mSalt[OT_PBKDF2_SALT_MAX_LENGTH];
     uint16_t mSaltLen;
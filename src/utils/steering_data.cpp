@@ -55,23 +55,42 @@ void SteeringData::ComputeJoinerId(const uint8_t *aEui64, uint8_t *aJoinerId)
     mbedtls_sha256_starts(&sha256, 0);
     mbedtls_sha256_update(&sha256, aEui64, kSizeEui64);
     mbedtls_sha256_finish(&sha256, hash);
+    mbedtls_sha256_free(&sha256);
 
     memcpy(aJoinerId, hash, kSizeJoinerId);
     aJoinerId[0] |= 2;
 }
 
+void SteeringData::ComputeForJoiners(const uint8_t *aEui64s, size_t aNumJoiners)
+{
+    const size_t           kSizeHashSha256Output = 32;
+    const size_t           kSizeEui64            = 8;
+    uint8_t                hash[kSizeHashSha256Output];
+    mbedtls_sha256_context sha256;
+
+    mbedtls_sha256_init(&sha256);
+
+    for (size_t i = 0; i < aNumJoiners; i++)
+    {
+        mbedtls_sha256_starts(&sha256, 0);
+        mbedtls_sha256_update(&sha256, aEui64s + i * kSizeEui64, kSizeEui64);
+        mbedtls_sha256_finish(&sha256, hash);
+
+        hash[0] |= 2;
+        ComputeBloomFilter(hash);
+    }
+
+    mbedtls_sha256_free(&sha256);
+}
+
 void SteeringData::ComputeBloomFilter(const uint8_t *aJoinerId)
 {
     Crc16          ccitt(Crc16::kCcitt);
     Crc16          ansi(Crc16::kAnsi);
     const uint16_t numBits = mLength * 8;
 
-    for (size_t i = 0; i < kSizeJoinerId; i++)
-    {
-        uint8_t byte = aJoinerId[i];
-        ccitt.Update(byte);
-        ansi.Update(byte);
-    }
+    ccitt.Update(aJoinerId, kSizeJoinerId);
+    ansi.Update(aJoinerId, kSizeJoinerId);
 
     SetBit(static_cast<uint8_t>(ccitt.Get() % numBits));
     SetBit(static_cast<uint8_t>(ansi.Get() % numBits));
@@ -36,6 +36,7 @@
 
 #include "openthread-br/config.h"
 
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -84,6 +85,17 @@ public:
      */
     void ComputeBloomFilter(const uint8_t *aJoinerId);
 
+    /**
+     * This method adds the joiner ids of many EUI64s to the bloom filter.
+     *
+     * This is equivalent to calling `ComputeJoinerId()` and `ComputeBloomFilter()` for each EUI64, but reuses the
+     * hash context across joiners.
+     *
+     * @param[in] aEui64s      A pointer to @p aNumJoiners consecutive EUI64s.
+     * @param[in] aNumJoiners  The number of EUI64s.
+     */
+    void ComputeForJoiners(const uint8_t *aEui64s, size_t aNumJoiners);
+
     /**
      * This method computes joiner id from EUI64.
      *
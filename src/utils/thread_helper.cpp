@@ -35,6 +35,8 @@
 #include <string.h>
 #include <time.h>
 
+#include <algorithm>
+
 #include <openthread/border_agent.h>
 #include <openthread/border_router.h>
 #include <openthread/channel_manager.h>
@@ -68,29 +70,47 @@
 #include "common/byteswap.hpp"
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#if OTBR_ENABLE_TELEMETRY_DATA_API && OTBR_ENABLE_MAINLOOP_STATS
+#include "common/mainloop_manager.hpp"
+#include "common/mainloop_watchdog.hpp"
+#endif
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+#include "common/memory_usage.hpp"
+#include "common/startup_timing.hpp"
+#endif
 #include "common/tlv.hpp"
 #include "ncp/rcp_host.hpp"
+#if OTBR_ENABLE_TELEMETRY_DATA_API && OTBR_ENABLE_DNS_UPSTREAM_QUERY
+#include "utils/dns_upstream_cache.hpp"
+#endif
+
+#if OTBR_ENABLE_TELEMETRY_DATA_API && OTBR_ENABLE_LINK_METRICS_TELEMETRY
+/**
+ * @def OTBR_CONFIG_LINK_METRICS_SAMPLE_INTERVAL
+ *
+ * Specifies the average interval in milliseconds between two samplings of the link metrics of the neighbors.
+ * Each interval is randomized by up to 1/8 of its value so that samplings of nearby border routers don't align.
+ */
+#ifndef OTBR_CONFIG_LINK_METRICS_SAMPLE_INTERVAL
+#define OTBR_CONFIG_LINK_METRICS_SAMPLE_INTERVAL 30000
+#endif
+#endif
+
+#if OTBR_ENABLE_CHANNEL_SAMPLING
+/**
+ * @def OTBR_CONFIG_CHANNEL_SAMPLE_INTERVAL
+ *
+ * Specifies the average interval in milliseconds between two energy samples of the channels in the background.
+ * Each sample measures one channel in turn, so that the radio leaves the operating channel only briefly.
+ */
+#ifndef OTBR_CONFIG_CHANNEL_SAMPLE_INTERVAL
+#define OTBR_CONFIG_CHANNEL_SAMPLE_INTERVAL 10000
+#endif
+#endif
 
 namespace otbr {
 namespace agent {
 namespace {
-const Tlv *FindTlv(uint8_t aTlvType, const uint8_t *aTlvs, int aTlvsSize)
-{
-    const Tlv *result = nullptr;
-
-    for (const Tlv *tlv = reinterpret_cast<const Tlv *>(aTlvs);
-         reinterpret_cast<const uint8_t *>(tlv) + sizeof(Tlv) < aTlvs + aTlvsSize; tlv = tlv->GetNext())
-    {
-        if (tlv->GetType() == aTlvType)
-        {
-            ExitNow(result = tlv);
-        }
-    }
-
-exit:
-    return result;
-}
-
 #if OTBR_ENABLE_TELEMETRY_DATA_API
 static uint32_t TelemetryNodeTypeFromRoleAndLinkMode(const otDeviceRole &aRole, const otLinkModeConfig &aLinkModeCfg)
 {
@@ -188,6 +208,27 @@ void CopyNat64TrafficCounters(const otNat64Counters &from, threadnetwork::Teleme
     to->set_ipv6_to_ipv4_packets(from.m6To4Packets);
     to->set_ipv6_to_ipv4_bytes(from.m6To4Bytes);
 }
+
+void CopyNat64ProtocolCounters(const otNat64ProtocolCounters                     &from,
+                               threadnetwork::TelemetryData_Nat64ProtocolCounters *to)
+{
+    CopyNat64TrafficCounters(from.mTcp, to->mutable_tcp());
+    CopyNat64TrafficCounters(from.mUdp, to->mutable_udp());
+    CopyNat64TrafficCounters(from.mIcmp, to->mutable_icmp());
+}
+
+void AddNat64TrafficCounters(const otNat64Counters &from, otNat64Counters &to)
+{
+    to.m4To6Packets += from.m4To6Packets;
+    to.m4To6Bytes += from.m4To6Bytes;
+    to.m6To4Packets += from.m6To4Packets;
+    to.m6To4Bytes += from.m6To4Bytes;
+}
+
+uint64_t GetNat64MappingBytes(const otNat64AddressMapping &aMapping)
+{
+    return aMapping.mCounters.mTotal.m4To6Bytes + aMapping.mCounters.mTotal.m6To4Bytes;
+}
 #endif // OTBR_ENABLE_NAT64
 
 #if OTBR_ENABLE_DHCP6_PD
@@ -225,12 +266,44 @@ void CopyMdnsResponseCounters(const MdnsResponseCounters &from, threadnetwork::T
     to->set_aborted_count(from.mAborted);
     to->set_invalid_state_count(from.mInvalidState);
 }
+
+void CopyMdnsLatencyHistogram(const MdnsLatencyHistogram                        &from,
+                              threadnetwork::TelemetryData_MdnsLatencyHistogram *to)
+{
+    for (uint32_t upperBound : MdnsLatencyHistogram::kBucketUpperBounds)
+    {
+        to->add_bucket_upper_bounds(upperBound);
+    }
+    for (uint32_t bucket : from.mBuckets)
+    {
+        to->add_bucket_counts(bucket);
+    }
+    to->set_p50_ms(from.GetPercentile(50));
+    to->set_p90_ms(from.GetPercentile(90));
+    to->set_p99_ms(from.GetPercentile(99));
+}
+
+void CopyMainloopHistogram(const Histogram &from, threadnetwork::TelemetryData_MainloopHistogram *to)
+{
+    for (uint8_t i = 0; i < Histogram::kNumBuckets - 1; i++)
+    {
+        to->add_bucket_upper_bounds(from.GetUpperBound(i));
+    }
+    for (uint8_t i = 0; i < Histogram::kNumBuckets; i++)
+    {
+        to->add_bucket_counts(from.GetBucketCount(i));
+    }
+    to->set_count(from.GetCount());
+    to->set_sum(from.GetSum());
+    to->set_max(from.GetMax());
+}
 #endif // OTBR_ENABLE_TELEMETRY_DATA_API
 } // namespace
 
 ThreadHelper::ThreadHelper(otInstance *aInstance, otbr::Ncp::RcpHost *aHost)
     : mInstance(aInstance)
     , mHost(aHost)
+    , mCounterHistory(aInstance, *aHost)
 {
 #if OTBR_ENABLE_TELEMETRY_DATA_API && (OTBR_ENABLE_NAT64 || OTBR_ENABLE_DHCP6_PD)
     otError error;
@@ -243,10 +316,39 @@ exit:
         otbrLogWarning("Error otPlatCryptoRandomGet: %s", otThreadErrorToString(error));
     }
 #endif
+#if OTBR_ENABLE_TELEMETRY_DATA_API && OTBR_ENABLE_LINK_METRICS_TELEMETRY
+    ScheduleLinkMetricsSampling();
+#endif
+#if OTBR_ENABLE_CHANNEL_SAMPLING
+    ScheduleChannelSampling();
+#endif
+}
+
+ThreadHelper::~ThreadHelper(void)
+{
+#if OTBR_ENABLE_TELEMETRY_DATA_API && OTBR_ENABLE_LINK_METRICS_TELEMETRY
+    if (mLinkMetricsSamplingTaskId != 0)
+    {
+        mHost->CancelTimerTask(mLinkMetricsSamplingTaskId);
+    }
+#endif
+#if OTBR_ENABLE_CHANNEL_SAMPLING
+    if (mChannelSamplingTaskId != 0)
+    {
+        mHost->CancelTimerTask(mChannelSamplingTaskId);
+    }
+#endif
 }
 
 void ThreadHelper::StateChangedCallback(otChangedFlags aFlags)
 {
+#if OTBR_ENABLE_TELEMETRY_DATA_API && OTBR_ENABLE_BORDER_ROUTING
+    if (aFlags & (OT_CHANGED_THREAD_NETDATA | OT_CHANGED_THREAD_RLOC_ADDED | OT_CHANGED_THREAD_ROLE))
+    {
+        mExternalRouteInfoValid = false;
+    }
+#endif
+
     if (aFlags & OT_CHANGED_THREAD_ROLE)
     {
         otDeviceRole role = mHost->GetDeviceRole();
@@ -353,6 +455,7 @@ void ThreadHelper::Scan(ScanHandler aHandler)
     otError error = OT_ERROR_NONE;
 
     VerifyOrExit(aHandler != nullptr);
+    VerifyOrExit(mSurveyScanHandler == nullptr, aHandler(OT_ERROR_BUSY, {}));
     mScanHandler = aHandler;
     mScanResults.clear();
 
@@ -376,6 +479,7 @@ void ThreadHelper::EnergyScan(uint32_t aScanDuration, EnergyScanHandler aHandler
     uint32_t preferredChannels = otPlatRadioGetPreferredChannelMask(mInstance);
 
     VerifyOrExit(aHandler != nullptr, error = OT_ERROR_BUSY);
+    VerifyOrExit(mSurveyScanHandler == nullptr, aHandler(OT_ERROR_BUSY, {}));
     VerifyOrExit(aScanDuration < UINT16_MAX, error = OT_ERROR_INVALID_ARGS);
     mEnergyScanHandler = aHandler;
     mEnergyScanResults.clear();
@@ -394,6 +498,75 @@ exit:
     }
 }
 
+void ThreadHelper::SurveyScan(uint32_t aChannelMask, uint32_t aScanDuration, SurveyScanHandler aHandler)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(aHandler != nullptr);
+    VerifyOrExit(mSurveyScanHandler == nullptr && !otLinkIsActiveScanInProgress(mInstance) &&
+                     !otLinkIsEnergyScanInProgress(mInstance),
+                 error = OT_ERROR_BUSY);
+    VerifyOrExit(aScanDuration < UINT16_MAX, error = OT_ERROR_INVALID_ARGS);
+
+    mSurveyScanHandler  = aHandler;
+    mSurveyChannelMask  = (aChannelMask != 0) ? aChannelMask : otPlatRadioGetPreferredChannelMask(mInstance);
+    mSurveyScanDuration = static_cast<uint16_t>(aScanDuration);
+    mScanResults.clear();
+    mEnergyScanResults.clear();
+
+    SurveyNextChannel();
+
+exit:
+    if (error != OT_ERROR_NONE && aHandler != nullptr)
+    {
+        aHandler(error, {}, {});
+    }
+}
+
+void ThreadHelper::SurveyNextChannel(void)
+{
+    otError error = OT_ERROR_NONE;
+    bool    done  = false;
+
+    VerifyOrExit(mSurveyChannelMask != 0, done = true);
+
+    mSurveyChannel = static_cast<uint8_t>(__builtin_ctz(mSurveyChannelMask));
+    mSurveyChannelMask &= ~(1u << mSurveyChannel);
+
+    error = otLinkActiveScan(mInstance, 1u << mSurveyChannel, mSurveyScanDuration, &ThreadHelper::ActiveScanHandler,
+                             this);
+
+exit:
+    if (done || error != OT_ERROR_NONE)
+    {
+        FinishSurveyScan(error);
+    }
+}
+
+void ThreadHelper::FinishSurveyScan(otError aError)
+{
+    SurveyScanHandler handler = std::move(mSurveyScanHandler);
+
+    mSurveyScanHandler = nullptr;
+    mSurveyChannelMask = 0;
+
+    if (aError != OT_ERROR_NONE)
+    {
+        handler(aError, {}, {});
+    }
+    else
+    {
+        handler(aError, mScanResults, mEnergyScanResults);
+    }
+}
+
+void ThreadHelper::AddScanResultHandlers(ActiveScanResultHandler aActiveScanResultHandler,
+                                         EnergyScanResultHandler aEnergyScanResultHandler)
+{
+    mActiveScanResultHandlers.emplace_back(std::move(aActiveScanResultHandler));
+    mEnergyScanResultHandlers.emplace_back(std::move(aEnergyScanResultHandler));
+}
+
 void ThreadHelper::RandomFill(void *aBuf, size_t size)
 {
     std::uniform_int_distribution<> dist(0, UINT8_MAX);
@@ -416,13 +589,30 @@ void ThreadHelper::ActiveScanHandler(otActiveScanResult *aResult)
 {
     if (aResult == nullptr)
     {
-        if (mScanHandler != nullptr)
+        if (mSurveyScanHandler != nullptr)
+        {
+            // The scan which just completed can't be followed by another one from within its callback.
+            mHost->PostTimerTask(Milliseconds(0), [this]() {
+                otError error = otLinkEnergyScan(mInstance, 1u << mSurveyChannel, mSurveyScanDuration,
+                                                 &ThreadHelper::EnergyScanCallback, this);
+
+                if (error != OT_ERROR_NONE)
+                {
+                    FinishSurveyScan(error);
+                }
+            });
+        }
+        else if (mScanHandler != nullptr)
         {
             mScanHandler(OT_ERROR_NONE, mScanResults);
         }
     }
     else
     {
+        for (const ActiveScanResultHandler &handler : mActiveScanResultHandlers)
+        {
+            handler(*aResult);
+        }
         mScanResults.push_back(*aResult);
     }
 }
@@ -461,13 +651,21 @@ void ThreadHelper::EnergyScanCallback(otEnergyScanResult *aResult)
 {
     if (aResult == nullptr)
     {
-        if (mEnergyScanHandler != nullptr)
+        if (mSurveyScanHandler != nullptr)
+        {
+            mHost->PostTimerTask(Milliseconds(0), [this]() { SurveyNextChannel(); });
+        }
+        else if (mEnergyScanHandler != nullptr)
         {
             mEnergyScanHandler(OT_ERROR_NONE, mEnergyScanResults);
         }
     }
     else
     {
+        for (const EnergyScanResultHandler &handler : mEnergyScanResultHandlers)
+        {
+            handler(*aResult);
+        }
         mEnergyScanResults.push_back(*aResult);
     }
 }
@@ -490,6 +688,88 @@ uint8_t ThreadHelper::RandomChannelFromChannelMask(uint32_t aChannelMask)
     return channels[std::uniform_int_distribution<unsigned int>(0, numValidChannels - 1)(mRandomDevice)];
 }
 
+uint8_t ThreadHelper::SelectChannelFromChannelMask(uint32_t aChannelMask)
+{
+    uint8_t channel;
+
+#if OTBR_ENABLE_CHANNEL_SAMPLING
+    if (mChannelOccupancy.Recommend(aChannelMask, channel))
+    {
+        otbrLogInfo("Select the least occupied channel %u", channel);
+    }
+    else
+#endif
+    {
+        channel = RandomChannelFromChannelMask(aChannelMask);
+    }
+
+    return channel;
+}
+
+#if OTBR_ENABLE_CHANNEL_SAMPLING
+void ThreadHelper::ScheduleChannelSampling(void)
+{
+    static constexpr uint32_t kInterval = OTBR_CONFIG_CHANNEL_SAMPLE_INTERVAL;
+
+    uint32_t jitter = std::uniform_int_distribution<uint32_t>(0, kInterval / 4)(mRandomDevice);
+
+    mChannelSamplingTaskId = mHost->PostTimerTask(Milliseconds(kInterval - kInterval / 8 + jitter), [this]() {
+        mChannelSamplingTaskId = 0;
+
+        // The instance is gone once the host is deinitialized, the sampling stops until a new helper is created.
+        if (mHost->GetInstance() == mInstance)
+        {
+            SampleNextChannel();
+            ScheduleChannelSampling();
+        }
+    });
+}
+
+void ThreadHelper::SampleNextChannel(void)
+{
+    // A short scan of a single channel, so that the radio misses few frames of the operating channel.
+    static constexpr uint16_t kSampleDuration = 8;
+
+    uint32_t channelMask = otLinkGetSupportedChannelMask(mInstance);
+    otError  error;
+
+    // Scans requested by users take precedence, a sample is simply skipped while they are in progress.
+    VerifyOrExit(mSurveyScanHandler == nullptr);
+    VerifyOrExit(!otLinkIsActiveScanInProgress(mInstance) && !otLinkIsEnergyScanInProgress(mInstance));
+    VerifyOrExit(channelMask != 0);
+
+    do
+    {
+        mSampledChannel = (mSampledChannel + 1) % ChannelOccupancy::kNumChannels;
+    } while (!(channelMask & (1U << mSampledChannel)));
+
+    error = otLinkEnergyScan(mInstance, 1U << mSampledChannel, kSampleDuration, &ThreadHelper::ChannelSampleCallback,
+                             this);
+    if (error != OT_ERROR_NONE)
+    {
+        otbrLogDebug("Failed to sample channel %u: %s", mSampledChannel, otThreadErrorToString(error));
+    }
+
+exit:
+    return;
+}
+
+void ThreadHelper::ChannelSampleCallback(otEnergyScanResult *aResult, void *aThreadHelper)
+{
+    ThreadHelper *helper = static_cast<ThreadHelper *>(aThreadHelper);
+
+    helper->ChannelSampleCallback(aResult);
+}
+
+void ThreadHelper::ChannelSampleCallback(otEnergyScanResult *aResult)
+{
+    if (aResult != nullptr)
+    {
+        mChannelOccupancy.Record(aResult->mChannel, aResult->mMaxRssi);
+    }
+}
+#endif // OTBR_ENABLE_CHANNEL_SAMPLING
+
 static otExtendedPanId ToOtExtendedPanId(uint64_t aExtPanId)
 {
     otExtendedPanId extPanId;
@@ -549,7 +829,7 @@ void ThreadHelper::Attach(const std::string          &aNetworkName,
     dataset.mChannelMask &= aChannelMask;
     VerifyOrExit(dataset.mChannelMask != 0, otbrLogWarning("Invalid channel mask"), error = OT_ERROR_INVALID_ARGS);
 
-    dataset.mChannel = RandomChannelFromChannelMask(dataset.mChannelMask);
+    dataset.mChannel = SelectChannelFromChannelMask(dataset.mChannelMask);
 
     SuccessOrExit(error = otDatasetSetActive(mInstance, &dataset));
 
@@ -707,36 +987,39 @@ void ThreadHelper::AttachAllNodesTo(const std::vector<uint8_t> &aDatasetTlvs, At
 
     otError                  error = OT_ERROR_NONE;
     otOperationalDatasetTlvs datasetTlvs;
-    otOperationalDataset     dataset;
-    otOperationalDataset     emptyDataset{};
-    otDeviceRole             role = mHost->GetDeviceRole();
 
     if (aHandler == nullptr)
     {
         otbrLogWarning("Attach Handler is nullptr");
         ExitNow(error = OT_ERROR_INVALID_ARGS);
     }
-    VerifyOrExit(mAttachHandler == nullptr && mJoinerHandler == nullptr, error = OT_ERROR_BUSY);
 
-    VerifyOrExit(aDatasetTlvs.size() <= sizeof(datasetTlvs.mTlvs), error = OT_ERROR_INVALID_ARGS);
-    std::copy(aDatasetTlvs.begin(), aDatasetTlvs.end(), datasetTlvs.mTlvs);
-    datasetTlvs.mLength = aDatasetTlvs.size();
+    SuccessOrExit(error = PrepareDatasetForMigration(aDatasetTlvs, GetPendingTimestamp(), kDelayTimerMilliseconds,
+                                                     datasetTlvs));
+    AttachAllNodesTo(datasetTlvs, kDelayTimerMilliseconds, aHandler);
 
-    SuccessOrExit(error = otDatasetParseTlvs(&datasetTlvs, &dataset));
-    VerifyOrExit(dataset.mComponents.mIsActiveTimestampPresent, error = OT_ERROR_INVALID_ARGS);
-    VerifyOrExit(dataset.mComponents.mIsNetworkKeyPresent, error = OT_ERROR_INVALID_ARGS);
-    VerifyOrExit(dataset.mComponents.mIsNetworkNamePresent, error = OT_ERROR_INVALID_ARGS);
-    VerifyOrExit(dataset.mComponents.mIsExtendedPanIdPresent, error = OT_ERROR_INVALID_ARGS);
-    VerifyOrExit(dataset.mComponents.mIsMeshLocalPrefixPresent, error = OT_ERROR_INVALID_ARGS);
-    VerifyOrExit(dataset.mComponents.mIsPanIdPresent, error = OT_ERROR_INVALID_ARGS);
-    VerifyOrExit(dataset.mComponents.mIsChannelPresent, error = OT_ERROR_INVALID_ARGS);
-    VerifyOrExit(dataset.mComponents.mIsPskcPresent, error = OT_ERROR_INVALID_ARGS);
-    VerifyOrExit(dataset.mComponents.mIsSecurityPolicyPresent, error = OT_ERROR_INVALID_ARGS);
-    VerifyOrExit(dataset.mComponents.mIsChannelMaskPresent, error = OT_ERROR_INVALID_ARGS);
+exit:
+    if (error != OT_ERROR_NONE && aHandler != nullptr)
+    {
+        aHandler(error, 0);
+    }
+}
 
-    SuccessOrExit(error = ProcessDatasetForMigration(datasetTlvs, kDelayTimerMilliseconds));
+void ThreadHelper::AttachAllNodesTo(const otOperationalDatasetTlvs &aPreparedTlvs,
+                                    uint32_t                        aDelayMilli,
+                                    AttachHandler                   aHandler)
+{
+    otError              error = OT_ERROR_NONE;
+    otOperationalDataset emptyDataset{};
+    otDeviceRole         role = mHost->GetDeviceRole();
 
-    assert(datasetTlvs.mLength > 0);
+    if (aHandler == nullptr)
+    {
+        otbrLogWarning("Attach Handler is nullptr");
+        ExitNow(error = OT_ERROR_INVALID_ARGS);
+    }
+    VerifyOrExit(mAttachHandler == nullptr && mJoinerHandler == nullptr, error = OT_ERROR_BUSY);
+    VerifyOrExit(aPreparedTlvs.mLength > 0, error = OT_ERROR_INVALID_ARGS);
 
     if (role == OT_DEVICE_ROLE_DISABLED || role == OT_DEVICE_ROLE_DETACHED)
     {
@@ -750,7 +1033,7 @@ void ThreadHelper::AttachAllNodesTo(const std::vector<uint8_t> &aDatasetTlvs, At
 
         if (!hasActiveDataset)
         {
-            SuccessOrExit(error = otDatasetSetActiveTlvs(mInstance, &datasetTlvs));
+            SuccessOrExit(error = otDatasetSetActiveTlvs(mInstance, &aPreparedTlvs));
         }
 
         if (!otIp6IsEnabled(mInstance))
@@ -761,8 +1044,8 @@ void ThreadHelper::AttachAllNodesTo(const std::vector<uint8_t> &aDatasetTlvs, At
 
         if (hasActiveDataset)
         {
-            mAttachDelayMs            = kDelayTimerMilliseconds;
-            mAttachPendingDatasetTlvs = datasetTlvs;
+            mAttachDelayMs            = aDelayMilli;
+            mAttachPendingDatasetTlvs = aPreparedTlvs;
         }
         else
         {
@@ -774,14 +1057,14 @@ void ThreadHelper::AttachAllNodesTo(const std::vector<uint8_t> &aDatasetTlvs, At
         ExitNow();
     }
 
-    SuccessOrExit(error = otDatasetSendMgmtPendingSet(mInstance, &emptyDataset, datasetTlvs.mTlvs, datasetTlvs.mLength,
-                                                      MgmtSetResponseHandler, this));
-    mAttachDelayMs          = kDelayTimerMilliseconds;
+    SuccessOrExit(error = otDatasetSendMgmtPendingSet(mInstance, &emptyDataset, aPreparedTlvs.mTlvs,
+                                                      aPreparedTlvs.mLength, MgmtSetResponseHandler, this));
+    mAttachDelayMs          = aDelayMilli;
     mAttachHandler          = aHandler;
     mWaitingMgmtSetResponse = true;
 
 exit:
-    if (error != OT_ERROR_NONE)
+    if (error != OT_ERROR_NONE && aHandler != nullptr)
     {
         aHandler(error, 0);
     }
@@ -967,6 +1250,8 @@ void ThreadHelper::RetrieveExternalRouteInfo(threadnetwork::TelemetryData::Exter
     otNetworkDataIterator iterator = OT_NETWORK_DATA_ITERATOR_INIT;
     otExternalRouteConfig config;
 
+    VerifyOrExit(!mExternalRouteInfoValid);
+
     while (otNetDataGetNextRoute(mInstance, &iterator, &config) == OT_ERROR_NONE)
     {
         if (!config.mStable || config.mRloc16 != rloc16)
@@ -989,9 +1274,13 @@ void ThreadHelper::RetrieveExternalRouteInfo(threadnetwork::TelemetryData::Exter
         }
     }
 
-    aExternalRouteInfo.set_has_default_route_added(isDefaultRouteAdded);
-    aExternalRouteInfo.set_has_ula_route_added(isUlaRouteAdded);
-    aExternalRouteInfo.set_has_others_route_added(isOthersRouteAdded);
+    mExternalRouteInfo.set_has_default_route_added(isDefaultRouteAdded);
+    mExternalRouteInfo.set_has_ula_route_added(isUlaRouteAdded);
+    mExternalRouteInfo.set_has_others_route_added(isOthersRouteAdded);
+    mExternalRouteInfoValid = true;
+
+exit:
+    aExternalRouteInfo.CopyFrom(mExternalRouteInfo);
 }
 #endif // OTBR_ENABLE_BORDER_ROUTING
 
@@ -1020,6 +1309,11 @@ void ThreadHelper::RetrieveHashedPdPrefix(std::string *aHashedPdPrefix)
     SuccessOrExit(otBorderRoutingGetPdOmrPrefix(mInstance, &aPrefixInfo));
     prefixAddr = aPrefixInfo.mPrefix.mPrefix.mFields.m8;
 
+    // The hash only changes with the prefix, which is mostly stable.
+    VerifyOrExit(mHashedPdPrefix.empty() || memcmp(&mHashedPdPrefixSource, &aPrefixInfo.mPrefix,
+                                                   sizeof(mHashedPdPrefixSource)) != 0,
+                 aHashedPdPrefix->append(mHashedPdPrefix));
+
     // TODO: Put below steps into a reusable function.
     sha256.Start();
     sha256.Update(prefixAddr, kHashPrefixLength);
@@ -1040,7 +1334,9 @@ void ThreadHelper::RetrieveHashedPdPrefix(std::string *aHashedPdPrefix)
     // Append hashedPdTailer
     hashedPdPrefix.insert(hashedPdPrefix.end(), hashedPdTailer.begin(), hashedPdTailer.end());
 
-    aHashedPdPrefix->append(reinterpret_cast<const char *>(hashedPdPrefix.data()), hashedPdPrefix.size());
+    mHashedPdPrefixSource = aPrefixInfo.mPrefix;
+    mHashedPdPrefix.assign(reinterpret_cast<const char *>(hashedPdPrefix.data()), hashedPdPrefix.size());
+    aHashedPdPrefix->append(mHashedPdPrefix);
 
 exit:
     return;
@@ -1087,13 +1383,106 @@ void ThreadHelper::RetrieveBorderAgentInfo(threadnetwork::TelemetryData::BorderA
 }
 #endif
 
-otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadnetwork::TelemetryData &telemetryData)
+otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher                           *aPublisher,
+                                            const TrelDnssdTelemetryInfo              *aTrelDnssdInfo,
+                                            const BackboneRouter::BackboneRouterStats *aBackboneRouterStats,
+                                            threadnetwork::TelemetryData              &telemetryData)
 {
-    otError                     error = OT_ERROR_NONE;
-    std::vector<otNeighborInfo> neighborTable;
+    return RetrieveTelemetryData(aPublisher, aTrelDnssdInfo, aBackboneRouterStats, kTelemetrySectionsAll,
+                                 telemetryData);
+}
+
+otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher                           *aPublisher,
+                                            const TrelDnssdTelemetryInfo              *aTrelDnssdInfo,
+                                            const BackboneRouter::BackboneRouterStats *aBackboneRouterStats,
+                                            uint32_t                                   aSections,
+                                            threadnetwork::TelemetryData              &aTelemetryData)
+{
+    return RetrieveTelemetryData(aPublisher, aTrelDnssdInfo, aBackboneRouterStats, aSections, TelemetryOptions(),
+                                 aTelemetryData);
+}
+
+otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher                           *aPublisher,
+                                            const TrelDnssdTelemetryInfo              *aTrelDnssdInfo,
+                                            const BackboneRouter::BackboneRouterStats *aBackboneRouterStats,
+                                            uint32_t                                   aSections,
+                                            const TelemetryOptions                    &aOptions,
+                                            threadnetwork::TelemetryData              &aTelemetryData)
+{
+    otError error = OT_ERROR_NONE;
+
+    if ((aSections & kTelemetrySectionWpanStats) && RetrieveWpanStats(aTelemetryData) != OT_ERROR_NONE)
+    {
+        error = OT_ERROR_FAILED;
+    }
+
+    if ((aSections & kTelemetrySectionWpanTopoFull) && RetrieveWpanTopoFull(aTelemetryData) != OT_ERROR_NONE)
+    {
+        error = OT_ERROR_FAILED;
+    }
+
+    if (aSections & kTelemetrySectionWpanBorderRouter)
+    {
+        RetrieveWpanBorderRouter(aPublisher, aTrelDnssdInfo, aTelemetryData);
+    }
+
+    if (aSections & kTelemetrySectionWpanRcp)
+    {
+        RetrieveWpanRcp(aTelemetryData);
+    }
+
+    if ((aSections & kTelemetrySectionCoexMetrics) && RetrieveCoexMetrics(aTelemetryData) != OT_ERROR_NONE)
+    {
+        error = OT_ERROR_FAILED;
+    }
+
+#if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+    if (aSections & kTelemetrySectionLowPowerMetrics)
+    {
+        RetrieveLowPowerMetrics(aTelemetryData);
+    }
+#endif
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+    if (aSections & kTelemetrySectionMainloopMetrics)
+    {
+        RetrieveMainloopMetrics(aTelemetryData);
+    }
+#endif
+
+    if ((aSections & kTelemetrySectionBackboneRouter) && aBackboneRouterStats != nullptr)
+    {
+        RetrieveBackboneRouterMetrics(*aBackboneRouterStats, aTelemetryData);
+    }
+
+    if (aSections & kTelemetrySectionStartup)
+    {
+        RetrieveStartupMetrics(aTelemetryData);
+    }
+
+    if (aSections & kTelemetrySectionMemory)
+    {
+        RetrieveMemoryMetrics(aTelemetryData);
+    }
+
+#if OTBR_ENABLE_NAT64
+    if (aSections & kTelemetrySectionNat64Mappings)
+    {
+        RetrieveNat64Mappings(aOptions, aTelemetryData);
+    }
+#else
+    OTBR_UNUSED_VARIABLE(aOptions);
+#endif
+
+    return error;
+}
+
+otError ThreadHelper::RetrieveWpanStats(threadnetwork::TelemetryData &aTelemetryData)
+{
+    otError error = OT_ERROR_NONE;
 
     // Begin of WpanStats section.
-    auto wpanStats = telemetryData.mutable_wpan_stats();
+    auto wpanStats = aTelemetryData.mutable_wpan_stats();
 
     {
         otDeviceRole     role  = mHost->GetDeviceRole();
@@ -1167,549 +1556,884 @@ otError ThreadHelper::RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadn
     }
     // End of WpanStats section.
 
-    {
-        // Begin of WpanTopoFull section.
-        auto     wpanTopoFull = telemetryData.mutable_wpan_topo_full();
-        uint16_t rloc16       = otThreadGetRloc16(mInstance);
+    return error;
+}
 
-        wpanTopoFull->set_rloc16(rloc16);
+otError ThreadHelper::RetrieveWpanTopoFull(threadnetwork::TelemetryData &aTelemetryData)
+{
+    otError                     error = OT_ERROR_NONE;
+    std::vector<otNeighborInfo> neighborTable;
 
-        {
-            otRouterInfo info;
+    // Begin of WpanTopoFull section.
+    auto     wpanTopoFull = aTelemetryData.mutable_wpan_topo_full();
+    uint16_t rloc16       = otThreadGetRloc16(mInstance);
 
-            if (otThreadGetRouterInfo(mInstance, rloc16, &info) == OT_ERROR_NONE)
-            {
-                wpanTopoFull->set_router_id(info.mRouterId);
-            }
-            else
-            {
-                error = OT_ERROR_FAILED;
-            }
-        }
+    wpanTopoFull->set_rloc16(rloc16);
 
-        otNeighborInfoIterator iter = OT_NEIGHBOR_INFO_ITERATOR_INIT;
-        otNeighborInfo         neighborInfo;
+    {
+        otRouterInfo info;
 
-        while (otThreadGetNextNeighborInfo(mInstance, &iter, &neighborInfo) == OT_ERROR_NONE)
+        if (otThreadGetRouterInfo(mInstance, rloc16, &info) == OT_ERROR_NONE)
         {
-            neighborTable.push_back(neighborInfo);
+            wpanTopoFull->set_router_id(info.mRouterId);
         }
-        wpanTopoFull->set_neighbor_table_size(neighborTable.size());
-
-        uint16_t                 childIndex = 0;
-        otChildInfo              childInfo;
-        std::vector<otChildInfo> childTable;
-
-        while (otThreadGetChildInfoByIndex(mInstance, childIndex, &childInfo) == OT_ERROR_NONE)
+        else
         {
-            childTable.push_back(childInfo);
-            childIndex++;
+            error = OT_ERROR_FAILED;
         }
-        wpanTopoFull->set_child_table_size(childTable.size());
+    }
 
-        {
-            struct otLeaderData leaderData;
+    otNeighborInfoIterator iter = OT_NEIGHBOR_INFO_ITERATOR_INIT;
+    otNeighborInfo         neighborInfo;
 
-            if (otThreadGetLeaderData(mInstance, &leaderData) == OT_ERROR_NONE)
-            {
-                wpanTopoFull->set_leader_router_id(leaderData.mLeaderRouterId);
-                wpanTopoFull->set_leader_weight(leaderData.mWeighting);
-                wpanTopoFull->set_network_data_version(leaderData.mDataVersion);
-                wpanTopoFull->set_stable_network_data_version(leaderData.mStableDataVersion);
-            }
-            else
-            {
-                error = OT_ERROR_FAILED;
-            }
+    while (otThreadGetNextNeighborInfo(mInstance, &iter, &neighborInfo) == OT_ERROR_NONE)
+    {
+        neighborTable.push_back(neighborInfo);
+    }
+    wpanTopoFull->set_neighbor_table_size(neighborTable.size());
+
+    uint16_t                 childIndex = 0;
+    otChildInfo              childInfo;
+    std::vector<otChildInfo> childTable;
+
+    while (otThreadGetChildInfoByIndex(mInstance, childIndex, &childInfo) == OT_ERROR_NONE)
+    {
+        childTable.push_back(childInfo);
+        childIndex++;
+    }
+    wpanTopoFull->set_child_table_size(childTable.size());
+
+    {
+        struct otLeaderData leaderData;
+
+        if (otThreadGetLeaderData(mInstance, &leaderData) == OT_ERROR_NONE)
+        {
+            wpanTopoFull->set_leader_router_id(leaderData.mLeaderRouterId);
+            wpanTopoFull->set_leader_weight(leaderData.mWeighting);
+            wpanTopoFull->set_network_data_version(leaderData.mDataVersion);
+            wpanTopoFull->set_stable_network_data_version(leaderData.mStableDataVersion);
         }
+        else
+        {
+            error = OT_ERROR_FAILED;
+        }
+    }
 
-        uint8_t weight = otThreadGetLocalLeaderWeight(mInstance);
+    uint8_t weight = otThreadGetLocalLeaderWeight(mInstance);
 
-        wpanTopoFull->set_leader_local_weight(weight);
+    wpanTopoFull->set_leader_local_weight(weight);
 
-        uint32_t partitionId = otThreadGetPartitionId(mInstance);
+    uint32_t partitionId = otThreadGetPartitionId(mInstance);
 
-        wpanTopoFull->set_partition_id(partitionId);
+    wpanTopoFull->set_partition_id(partitionId);
 
-        static constexpr size_t kNetworkDataMaxSize = 255;
-        {
-            uint8_t              data[kNetworkDataMaxSize];
-            uint8_t              len = sizeof(data);
-            std::vector<uint8_t> networkData;
+    static constexpr size_t kNetworkDataMaxSize = 255;
+    {
+        uint8_t              data[kNetworkDataMaxSize];
+        uint8_t              len = sizeof(data);
+        std::vector<uint8_t> networkData;
 
-            if (otNetDataGet(mInstance, /*stable=*/false, data, &len) == OT_ERROR_NONE)
-            {
-                networkData = std::vector<uint8_t>(&data[0], &data[len]);
-                wpanTopoFull->set_network_data(std::string(networkData.begin(), networkData.end()));
-            }
-            else
-            {
-                error = OT_ERROR_FAILED;
-            }
+        if (otNetDataGet(mInstance, /*stable=*/false, data, &len) == OT_ERROR_NONE)
+        {
+            networkData = std::vector<uint8_t>(&data[0], &data[len]);
+            wpanTopoFull->set_network_data(std::string(networkData.begin(), networkData.end()));
         }
-
+        else
         {
-            uint8_t              data[kNetworkDataMaxSize];
-            uint8_t              len = sizeof(data);
-            std::vector<uint8_t> networkData;
+            error = OT_ERROR_FAILED;
+        }
+    }
 
-            if (otNetDataGet(mInstance, /*stable=*/true, data, &len) == OT_ERROR_NONE)
-            {
-                networkData = std::vector<uint8_t>(&data[0], &data[len]);
-                wpanTopoFull->set_stable_network_data(std::string(networkData.begin(), networkData.end()));
-            }
-            else
-            {
-                error = OT_ERROR_FAILED;
-            }
+    {
+        uint8_t              data[kNetworkDataMaxSize];
+        uint8_t              len = sizeof(data);
+        std::vector<uint8_t> networkData;
+
+        if (otNetDataGet(mInstance, /*stable=*/true, data, &len) == OT_ERROR_NONE)
+        {
+            networkData = std::vector<uint8_t>(&data[0], &data[len]);
+            wpanTopoFull->set_stable_network_data(std::string(networkData.begin(), networkData.end()));
+        }
+        else
+        {
+            error = OT_ERROR_FAILED;
         }
+    }
 
-        int8_t rssi = otPlatRadioGetRssi(mInstance);
+    int8_t rssi = otPlatRadioGetRssi(mInstance);
 
-        wpanTopoFull->set_instant_rssi(rssi);
+    wpanTopoFull->set_instant_rssi(rssi);
 
-        const otExtendedPanId *extPanId = otThreadGetExtendedPanId(mInstance);
-        uint64_t               extPanIdVal;
+    const otExtendedPanId *extPanId = otThreadGetExtendedPanId(mInstance);
+    uint64_t               extPanIdVal;
 
-        extPanIdVal = ConvertOpenThreadUint64(extPanId->m8);
-        wpanTopoFull->set_extended_pan_id(extPanIdVal);
+    extPanIdVal = ConvertOpenThreadUint64(extPanId->m8);
+    wpanTopoFull->set_extended_pan_id(extPanIdVal);
 #if OTBR_ENABLE_BORDER_ROUTING
-        wpanTopoFull->set_peer_br_count(otBorderRoutingCountPeerBrs(mInstance, /*minAge=*/nullptr));
+    wpanTopoFull->set_peer_br_count(otBorderRoutingCountPeerBrs(mInstance, /*minAge=*/nullptr));
 #endif
-        // End of WpanTopoFull section.
+    // End of WpanTopoFull section.
 
-        // Begin of TopoEntry section.
-        std::map<uint16_t, const otChildInfo *> childMap;
+    // Begin of TopoEntry section.
+    std::map<uint16_t, const otChildInfo *> childMap;
 
-        for (const otChildInfo &childInfo : childTable)
+    for (const otChildInfo &childInfo : childTable)
+    {
+        auto pair = childMap.insert({childInfo.mRloc16, &childInfo});
+        if (!pair.second)
         {
-            auto pair = childMap.insert({childInfo.mRloc16, &childInfo});
-            if (!pair.second)
-            {
-                // This shouldn't happen, so log an error. It doesn't matter which
-                // duplicate is kept.
-                otbrLogErr("Children with duplicate RLOC16 found: 0x%04x", static_cast<int>(childInfo.mRloc16));
-            }
+            // This shouldn't happen, so log an error. It doesn't matter which
+            // duplicate is kept.
+            otbrLogErr("Children with duplicate RLOC16 found: 0x%04x", static_cast<int>(childInfo.mRloc16));
         }
+    }
 
-        for (const otNeighborInfo &neighborInfo : neighborTable)
+    for (const otNeighborInfo &neighborInfo : neighborTable)
+    {
+        auto topoEntry = aTelemetryData.add_topo_entries();
+        topoEntry->set_rloc16(neighborInfo.mRloc16);
+        topoEntry->mutable_age()->set_seconds(neighborInfo.mAge);
+        topoEntry->set_link_quality_in(neighborInfo.mLinkQualityIn);
+        topoEntry->set_average_rssi(neighborInfo.mAverageRssi);
+        topoEntry->set_last_rssi(neighborInfo.mLastRssi);
+        topoEntry->set_link_frame_counter(neighborInfo.mLinkFrameCounter);
+        topoEntry->set_mle_frame_counter(neighborInfo.mMleFrameCounter);
+        topoEntry->set_rx_on_when_idle(neighborInfo.mRxOnWhenIdle);
+        topoEntry->set_secure_data_request(true);
+        topoEntry->set_full_function(neighborInfo.mFullThreadDevice);
+        topoEntry->set_full_network_data(neighborInfo.mFullNetworkData);
+        topoEntry->set_mac_frame_error_rate(static_cast<float>(neighborInfo.mFrameErrorRate) / 0xffff);
+        topoEntry->set_ip_message_error_rate(static_cast<float>(neighborInfo.mMessageErrorRate) / 0xffff);
+        topoEntry->set_version(neighborInfo.mVersion);
+
+        if (!neighborInfo.mIsChild)
         {
-            auto topoEntry = telemetryData.add_topo_entries();
-            topoEntry->set_rloc16(neighborInfo.mRloc16);
-            topoEntry->mutable_age()->set_seconds(neighborInfo.mAge);
-            topoEntry->set_link_quality_in(neighborInfo.mLinkQualityIn);
-            topoEntry->set_average_rssi(neighborInfo.mAverageRssi);
-            topoEntry->set_last_rssi(neighborInfo.mLastRssi);
-            topoEntry->set_link_frame_counter(neighborInfo.mLinkFrameCounter);
-            topoEntry->set_mle_frame_counter(neighborInfo.mMleFrameCounter);
-            topoEntry->set_rx_on_when_idle(neighborInfo.mRxOnWhenIdle);
-            topoEntry->set_secure_data_request(true);
-            topoEntry->set_full_function(neighborInfo.mFullThreadDevice);
-            topoEntry->set_full_network_data(neighborInfo.mFullNetworkData);
-            topoEntry->set_mac_frame_error_rate(static_cast<float>(neighborInfo.mFrameErrorRate) / 0xffff);
-            topoEntry->set_ip_message_error_rate(static_cast<float>(neighborInfo.mMessageErrorRate) / 0xffff);
-            topoEntry->set_version(neighborInfo.mVersion);
-
-            if (!neighborInfo.mIsChild)
-            {
-                continue;
-            }
-
-            auto it = childMap.find(neighborInfo.mRloc16);
-            if (it == childMap.end())
-            {
-                otbrLogErr("Neighbor 0x%04x not found in child table", static_cast<int>(neighborInfo.mRloc16));
-                continue;
-            }
-            const otChildInfo *childInfo = it->second;
-            topoEntry->set_is_child(true);
-            topoEntry->mutable_timeout()->set_seconds(childInfo->mTimeout);
-            topoEntry->set_network_data_version(childInfo->mNetworkDataVersion);
+            continue;
         }
-        // End of TopoEntry section.
-    }
-
-    {
-        // Begin of WpanBorderRouter section.
-        auto wpanBorderRouter = telemetryData.mutable_wpan_border_router();
-        // Begin of BorderRoutingCounters section.
-        auto                           borderRoutingCouters    = wpanBorderRouter->mutable_border_routing_counters();
-        const otBorderRoutingCounters *otBorderRoutingCounters = otIp6GetBorderRoutingCounters(mInstance);
-
-        borderRoutingCouters->mutable_inbound_unicast()->set_packet_count(
-            otBorderRoutingCounters->mInboundUnicast.mPackets);
-        borderRoutingCouters->mutable_inbound_unicast()->set_byte_count(
-            otBorderRoutingCounters->mInboundUnicast.mBytes);
-        borderRoutingCouters->mutable_inbound_multicast()->set_packet_count(
-            otBorderRoutingCounters->mInboundMulticast.mPackets);
-        borderRoutingCouters->mutable_inbound_multicast()->set_byte_count(
-            otBorderRoutingCounters->mInboundMulticast.mBytes);
-        borderRoutingCouters->mutable_outbound_unicast()->set_packet_count(
-            otBorderRoutingCounters->mOutboundUnicast.mPackets);
-        borderRoutingCouters->mutable_outbound_unicast()->set_byte_count(
-            otBorderRoutingCounters->mOutboundUnicast.mBytes);
-        borderRoutingCouters->mutable_outbound_multicast()->set_packet_count(
-            otBorderRoutingCounters->mOutboundMulticast.mPackets);
-        borderRoutingCouters->mutable_outbound_multicast()->set_byte_count(
-            otBorderRoutingCounters->mOutboundMulticast.mBytes);
-        borderRoutingCouters->set_ra_rx(otBorderRoutingCounters->mRaRx);
-        borderRoutingCouters->set_ra_tx_success(otBorderRoutingCounters->mRaTxSuccess);
-        borderRoutingCouters->set_ra_tx_failure(otBorderRoutingCounters->mRaTxFailure);
-        borderRoutingCouters->set_rs_rx(otBorderRoutingCounters->mRsRx);
-        borderRoutingCouters->set_rs_tx_success(otBorderRoutingCounters->mRsTxSuccess);
-        borderRoutingCouters->set_rs_tx_failure(otBorderRoutingCounters->mRsTxFailure);
-        borderRoutingCouters->mutable_inbound_internet()->set_packet_count(
-            otBorderRoutingCounters->mInboundInternet.mPackets);
-        borderRoutingCouters->mutable_inbound_internet()->set_byte_count(
-            otBorderRoutingCounters->mInboundInternet.mBytes);
-        borderRoutingCouters->mutable_outbound_internet()->set_packet_count(
-            otBorderRoutingCounters->mOutboundInternet.mPackets);
-        borderRoutingCouters->mutable_outbound_internet()->set_byte_count(
-            otBorderRoutingCounters->mOutboundInternet.mBytes);
 
-#if OTBR_ENABLE_NAT64
+        auto it = childMap.find(neighborInfo.mRloc16);
+        if (it == childMap.end())
         {
-            auto nat64IcmpCounters = borderRoutingCouters->mutable_nat64_protocol_counters()->mutable_icmp();
-            auto nat64UdpCounters  = borderRoutingCouters->mutable_nat64_protocol_counters()->mutable_udp();
-            auto nat64TcpCounters  = borderRoutingCouters->mutable_nat64_protocol_counters()->mutable_tcp();
-            otNat64ProtocolCounters otCounters;
-
-            otNat64GetCounters(mInstance, &otCounters);
-            nat64IcmpCounters->set_ipv4_to_ipv6_packets(otCounters.mIcmp.m4To6Packets);
-            nat64IcmpCounters->set_ipv4_to_ipv6_bytes(otCounters.mIcmp.m4To6Bytes);
-            nat64IcmpCounters->set_ipv6_to_ipv4_packets(otCounters.mIcmp.m6To4Packets);
-            nat64IcmpCounters->set_ipv6_to_ipv4_bytes(otCounters.mIcmp.m6To4Bytes);
-            nat64UdpCounters->set_ipv4_to_ipv6_packets(otCounters.mUdp.m4To6Packets);
-            nat64UdpCounters->set_ipv4_to_ipv6_bytes(otCounters.mUdp.m4To6Bytes);
-            nat64UdpCounters->set_ipv6_to_ipv4_packets(otCounters.mUdp.m6To4Packets);
-            nat64UdpCounters->set_ipv6_to_ipv4_bytes(otCounters.mUdp.m6To4Bytes);
-            nat64TcpCounters->set_ipv4_to_ipv6_packets(otCounters.mTcp.m4To6Packets);
-            nat64TcpCounters->set_ipv4_to_ipv6_bytes(otCounters.mTcp.m4To6Bytes);
-            nat64TcpCounters->set_ipv6_to_ipv4_packets(otCounters.mTcp.m6To4Packets);
-            nat64TcpCounters->set_ipv6_to_ipv4_bytes(otCounters.mTcp.m6To4Bytes);
+            otbrLogErr("Neighbor 0x%04x not found in child table", static_cast<int>(neighborInfo.mRloc16));
+            continue;
         }
+        const otChildInfo *childInfo = it->second;
+        topoEntry->set_is_child(true);
+        topoEntry->mutable_timeout()->set_seconds(childInfo->mTimeout);
+        topoEntry->set_network_data_version(childInfo->mNetworkDataVersion);
+    }
+    // End of TopoEntry section.
 
-        {
-            auto                 errorCounters = borderRoutingCouters->mutable_nat64_error_counters();
-            otNat64ErrorCounters otCounters;
-            otNat64GetErrorCounters(mInstance, &otCounters);
-
-            errorCounters->mutable_unknown()->set_ipv4_to_ipv6_packets(
-                otCounters.mCount4To6[OT_NAT64_DROP_REASON_UNKNOWN]);
-            errorCounters->mutable_unknown()->set_ipv6_to_ipv4_packets(
-                otCounters.mCount6To4[OT_NAT64_DROP_REASON_UNKNOWN]);
-            errorCounters->mutable_illegal_packet()->set_ipv4_to_ipv6_packets(
-                otCounters.mCount4To6[OT_NAT64_DROP_REASON_ILLEGAL_PACKET]);
-            errorCounters->mutable_illegal_packet()->set_ipv6_to_ipv4_packets(
-                otCounters.mCount6To4[OT_NAT64_DROP_REASON_ILLEGAL_PACKET]);
-            errorCounters->mutable_unsupported_protocol()->set_ipv4_to_ipv6_packets(
-                otCounters.mCount4To6[OT_NAT64_DROP_REASON_UNSUPPORTED_PROTO]);
-            errorCounters->mutable_unsupported_protocol()->set_ipv6_to_ipv4_packets(
-                otCounters.mCount6To4[OT_NAT64_DROP_REASON_UNSUPPORTED_PROTO]);
-            errorCounters->mutable_no_mapping()->set_ipv4_to_ipv6_packets(
-                otCounters.mCount4To6[OT_NAT64_DROP_REASON_NO_MAPPING]);
-            errorCounters->mutable_no_mapping()->set_ipv6_to_ipv4_packets(
-                otCounters.mCount6To4[OT_NAT64_DROP_REASON_NO_MAPPING]);
-        }
+    return error;
+}
+
+void ThreadHelper::RetrieveWpanBorderRouter(Mdns::Publisher              *aPublisher,
+                                            const TrelDnssdTelemetryInfo *aTrelDnssdInfo,
+                                            threadnetwork::TelemetryData &aTelemetryData)
+{
+    // Begin of WpanBorderRouter section.
+    auto wpanBorderRouter = aTelemetryData.mutable_wpan_border_router();
+    // Begin of BorderRoutingCounters section.
+    auto                           borderRoutingCouters    = wpanBorderRouter->mutable_border_routing_counters();
+    const otBorderRoutingCounters *otBorderRoutingCounters = otIp6GetBorderRoutingCounters(mInstance);
+
+    borderRoutingCouters->mutable_inbound_unicast()->set_packet_count(
+        otBorderRoutingCounters->mInboundUnicast.mPackets);
+    borderRoutingCouters->mutable_inbound_unicast()->set_byte_count(
+        otBorderRoutingCounters->mInboundUnicast.mBytes);
+    borderRoutingCouters->mutable_inbound_multicast()->set_packet_count(
+        otBorderRoutingCounters->mInboundMulticast.mPackets);
+    borderRoutingCouters->mutable_inbound_multicast()->set_byte_count(
+        otBorderRoutingCounters->mInboundMulticast.mBytes);
+    borderRoutingCouters->mutable_outbound_unicast()->set_packet_count(
+        otBorderRoutingCounters->mOutboundUnicast.mPackets);
+    borderRoutingCouters->mutable_outbound_unicast()->set_byte_count(
+        otBorderRoutingCounters->mOutboundUnicast.mBytes);
+    borderRoutingCouters->mutable_outbound_multicast()->set_packet_count(
+        otBorderRoutingCounters->mOutboundMulticast.mPackets);
+    borderRoutingCouters->mutable_outbound_multicast()->set_byte_count(
+        otBorderRoutingCounters->mOutboundMulticast.mBytes);
+    borderRoutingCouters->set_ra_rx(otBorderRoutingCounters->mRaRx);
+    borderRoutingCouters->set_ra_tx_success(otBorderRoutingCounters->mRaTxSuccess);
+    borderRoutingCouters->set_ra_tx_failure(otBorderRoutingCounters->mRaTxFailure);
+    borderRoutingCouters->set_rs_rx(otBorderRoutingCounters->mRsRx);
+    borderRoutingCouters->set_rs_tx_success(otBorderRoutingCounters->mRsTxSuccess);
+    borderRoutingCouters->set_rs_tx_failure(otBorderRoutingCounters->mRsTxFailure);
+    borderRoutingCouters->mutable_inbound_internet()->set_packet_count(
+        otBorderRoutingCounters->mInboundInternet.mPackets);
+    borderRoutingCouters->mutable_inbound_internet()->set_byte_count(
+        otBorderRoutingCounters->mInboundInternet.mBytes);
+    borderRoutingCouters->mutable_outbound_internet()->set_packet_count(
+        otBorderRoutingCounters->mOutboundInternet.mPackets);
+    borderRoutingCouters->mutable_outbound_internet()->set_byte_count(
+        otBorderRoutingCounters->mOutboundInternet.mBytes);
+
+#if OTBR_ENABLE_NAT64
+    {
+        auto nat64IcmpCounters = borderRoutingCouters->mutable_nat64_protocol_counters()->mutable_icmp();
+        auto nat64UdpCounters  = borderRoutingCouters->mutable_nat64_protocol_counters()->mutable_udp();
+        auto nat64TcpCounters  = borderRoutingCouters->mutable_nat64_protocol_counters()->mutable_tcp();
+        otNat64ProtocolCounters otCounters;
+
+        otNat64GetCounters(mInstance, &otCounters);
+        nat64IcmpCounters->set_ipv4_to_ipv6_packets(otCounters.mIcmp.m4To6Packets);
+        nat64IcmpCounters->set_ipv4_to_ipv6_bytes(otCounters.mIcmp.m4To6Bytes);
+        nat64IcmpCounters->set_ipv6_to_ipv4_packets(otCounters.mIcmp.m6To4Packets);
+        nat64IcmpCounters->set_ipv6_to_ipv4_bytes(otCounters.mIcmp.m6To4Bytes);
+        nat64UdpCounters->set_ipv4_to_ipv6_packets(otCounters.mUdp.m4To6Packets);
+        nat64UdpCounters->set_ipv4_to_ipv6_bytes(otCounters.mUdp.m4To6Bytes);
+        nat64UdpCounters->set_ipv6_to_ipv4_packets(otCounters.mUdp.m6To4Packets);
+        nat64UdpCounters->set_ipv6_to_ipv4_bytes(otCounters.mUdp.m6To4Bytes);
+        nat64TcpCounters->set_ipv4_to_ipv6_packets(otCounters.mTcp.m4To6Packets);
+        nat64TcpCounters->set_ipv4_to_ipv6_bytes(otCounters.mTcp.m4To6Bytes);
+        nat64TcpCounters->set_ipv6_to_ipv4_packets(otCounters.mTcp.m6To4Packets);
+        nat64TcpCounters->set_ipv6_to_ipv4_bytes(otCounters.mTcp.m6To4Bytes);
+    }
+
+    {
+        auto                 errorCounters = borderRoutingCouters->mutable_nat64_error_counters();
+        otNat64ErrorCounters otCounters;
+        otNat64GetErrorCounters(mInstance, &otCounters);
+
+        errorCounters->mutable_unknown()->set_ipv4_to_ipv6_packets(
+            otCounters.mCount4To6[OT_NAT64_DROP_REASON_UNKNOWN]);
+        errorCounters->mutable_unknown()->set_ipv6_to_ipv4_packets(
+            otCounters.mCount6To4[OT_NAT64_DROP_REASON_UNKNOWN]);
+        errorCounters->mutable_illegal_packet()->set_ipv4_to_ipv6_packets(
+            otCounters.mCount4To6[OT_NAT64_DROP_REASON_ILLEGAL_PACKET]);
+        errorCounters->mutable_illegal_packet()->set_ipv6_to_ipv4_packets(
+            otCounters.mCount6To4[OT_NAT64_DROP_REASON_ILLEGAL_PACKET]);
+        errorCounters->mutable_unsupported_protocol()->set_ipv4_to_ipv6_packets(
+            otCounters.mCount4To6[OT_NAT64_DROP_REASON_UNSUPPORTED_PROTO]);
+        errorCounters->mutable_unsupported_protocol()->set_ipv6_to_ipv4_packets(
+            otCounters.mCount6To4[OT_NAT64_DROP_REASON_UNSUPPORTED_PROTO]);
+        errorCounters->mutable_no_mapping()->set_ipv4_to_ipv6_packets(
+            otCounters.mCount4To6[OT_NAT64_DROP_REASON_NO_MAPPING]);
+        errorCounters->mutable_no_mapping()->set_ipv6_to_ipv4_packets(
+            otCounters.mCount6To4[OT_NAT64_DROP_REASON_NO_MAPPING]);
+    }
 #endif // OTBR_ENABLE_NAT64
-       // End of BorderRoutingCounters section.
+   // End of BorderRoutingCounters section.
 
 #if OTBR_ENABLE_TREL
-        // Begin of TrelInfo section.
+    // Begin of TrelInfo section.
+    {
+        auto trelInfo       = wpanBorderRouter->mutable_trel_info();
+        auto otTrelCounters = otTrelGetCounters(mInstance);
+        auto trelCounters   = trelInfo->mutable_counters();
+
+        trelInfo->set_is_trel_enabled(otTrelIsEnabled(mInstance));
+        trelInfo->set_num_trel_peers(otTrelGetNumberOfPeers(mInstance));
+
+        trelCounters->set_trel_tx_packets(otTrelCounters->mTxPackets);
+        trelCounters->set_trel_tx_bytes(otTrelCounters->mTxBytes);
+        trelCounters->set_trel_tx_packets_failed(otTrelCounters->mTxFailure);
+        trelCounters->set_tre_rx_packets(otTrelCounters->mRxPackets);
+        trelCounters->set_trel_rx_bytes(otTrelCounters->mRxBytes);
+
+        if (aTrelDnssdInfo != nullptr)
         {
-            auto trelInfo       = wpanBorderRouter->mutable_trel_info();
-            auto otTrelCounters = otTrelGetCounters(mInstance);
-            auto trelCounters   = trelInfo->mutable_counters();
-
-            trelInfo->set_is_trel_enabled(otTrelIsEnabled(mInstance));
-            trelInfo->set_num_trel_peers(otTrelGetNumberOfPeers(mInstance));
-
-            trelCounters->set_trel_tx_packets(otTrelCounters->mTxPackets);
-            trelCounters->set_trel_tx_bytes(otTrelCounters->mTxBytes);
-            trelCounters->set_trel_tx_packets_failed(otTrelCounters->mTxFailure);
-            trelCounters->set_tre_rx_packets(otTrelCounters->mRxPackets);
-            trelCounters->set_trel_rx_bytes(otTrelCounters->mRxBytes);
+            auto peerDiscovery = trelInfo->mutable_peer_discovery();
+
+            peerDiscovery->set_peer_discoveries(aTrelDnssdInfo->mPeerDiscoveries);
+            peerDiscovery->set_peer_removals(aTrelDnssdInfo->mPeerRemovals);
+            peerDiscovery->set_peer_evictions(aTrelDnssdInfo->mPeerEvictions);
+            peerDiscovery->set_duplicate_peers(aTrelDnssdInfo->mDuplicatePeers);
+            peerDiscovery->set_invalid_peers(aTrelDnssdInfo->mInvalidPeers);
+            peerDiscovery->set_unchanged_resolutions(aTrelDnssdInfo->mUnchangedResolutions);
+            peerDiscovery->set_peer_notifications(aTrelDnssdInfo->mPeerNotifications);
+            peerDiscovery->set_service_republications(aTrelDnssdInfo->mServiceRepublications);
+            peerDiscovery->set_restored_peers(aTrelDnssdInfo->mRestoredPeers);
+            peerDiscovery->set_unresolved_peers(aTrelDnssdInfo->mUnresolvedPeers);
+            CopyMdnsLatencyHistogram(aTrelDnssdInfo->mDiscoveryLatency, peerDiscovery->mutable_discovery_latency());
         }
-        // End of TrelInfo section.
+    }
+    // End of TrelInfo section.
+#else
+    OTBR_UNUSED_VARIABLE(aTrelDnssdInfo);
 #endif // OTBR_ENABLE_TREL
 
 #if OTBR_ENABLE_BORDER_ROUTING
-        RetrieveInfraLinkInfo(*wpanBorderRouter->mutable_infra_link_info());
-        RetrieveExternalRouteInfo(*wpanBorderRouter->mutable_external_route_info());
+    RetrieveInfraLinkInfo(*wpanBorderRouter->mutable_infra_link_info());
+    RetrieveExternalRouteInfo(*wpanBorderRouter->mutable_external_route_info());
 #endif
 
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
-        // Begin of SrpServerInfo section.
-        {
-            auto                               srpServer = wpanBorderRouter->mutable_srp_server();
-            otSrpServerLeaseInfo               leaseInfo;
-            const otSrpServerHost             *host             = nullptr;
-            const otSrpServerResponseCounters *responseCounters = otSrpServerGetResponseCounters(mInstance);
+    // Begin of SrpServerInfo section.
+    {
+        auto                               srpServer = wpanBorderRouter->mutable_srp_server();
+        otSrpServerLeaseInfo               leaseInfo;
+        const otSrpServerHost             *host             = nullptr;
+        const otSrpServerResponseCounters *responseCounters = otSrpServerGetResponseCounters(mInstance);
 
-            srpServer->set_state(SrpServerStateFromOtSrpServerState(otSrpServerGetState(mInstance)));
-            srpServer->set_port(otSrpServerGetPort(mInstance));
-            srpServer->set_address_mode(
-                SrpServerAddressModeFromOtSrpServerAddressMode(otSrpServerGetAddressMode(mInstance)));
+        srpServer->set_state(SrpServerStateFromOtSrpServerState(otSrpServerGetState(mInstance)));
+        srpServer->set_port(otSrpServerGetPort(mInstance));
+        srpServer->set_address_mode(
+            SrpServerAddressModeFromOtSrpServerAddressMode(otSrpServerGetAddressMode(mInstance)));
 
-            auto srpServerHosts            = srpServer->mutable_hosts();
-            auto srpServerServices         = srpServer->mutable_services();
-            auto srpServerResponseCounters = srpServer->mutable_response_counters();
+        auto srpServerHosts            = srpServer->mutable_hosts();
+        auto srpServerServices         = srpServer->mutable_services();
+        auto srpServerResponseCounters = srpServer->mutable_response_counters();
+
+        while ((host = otSrpServerGetNextHost(mInstance, host)))
+        {
+            const otSrpServerService *service = nullptr;
 
-            while ((host = otSrpServerGetNextHost(mInstance, host)))
+            if (otSrpServerHostIsDeleted(host))
             {
-                const otSrpServerService *service = nullptr;
+                srpServerHosts->set_deleted_count(srpServerHosts->deleted_count() + 1);
+            }
+            else
+            {
+                srpServerHosts->set_fresh_count(srpServerHosts->fresh_count() + 1);
+                otSrpServerHostGetLeaseInfo(host, &leaseInfo);
+                srpServerHosts->set_lease_time_total_ms(srpServerHosts->lease_time_total_ms() + leaseInfo.mLease);
+                srpServerHosts->set_key_lease_time_total_ms(srpServerHosts->key_lease_time_total_ms() +
+                                                            leaseInfo.mKeyLease);
+                srpServerHosts->set_remaining_lease_time_total_ms(srpServerHosts->remaining_lease_time_total_ms() +
+                                                                  leaseInfo.mRemainingLease);
+                srpServerHosts->set_remaining_key_lease_time_total_ms(
+                    srpServerHosts->remaining_key_lease_time_total_ms() + leaseInfo.mRemainingKeyLease);
+            }
 
-                if (otSrpServerHostIsDeleted(host))
+            while ((service = otSrpServerHostGetNextService(host, service)))
+            {
+                if (otSrpServerServiceIsDeleted(service))
                 {
-                    srpServerHosts->set_deleted_count(srpServerHosts->deleted_count() + 1);
+                    srpServerServices->set_deleted_count(srpServerServices->deleted_count() + 1);
                 }
                 else
                 {
-                    srpServerHosts->set_fresh_count(srpServerHosts->fresh_count() + 1);
-                    otSrpServerHostGetLeaseInfo(host, &leaseInfo);
-                    srpServerHosts->set_lease_time_total_ms(srpServerHosts->lease_time_total_ms() + leaseInfo.mLease);
-                    srpServerHosts->set_key_lease_time_total_ms(srpServerHosts->key_lease_time_total_ms() +
-                                                                leaseInfo.mKeyLease);
-                    srpServerHosts->set_remaining_lease_time_total_ms(srpServerHosts->remaining_lease_time_total_ms() +
-                                                                      leaseInfo.mRemainingLease);
-                    srpServerHosts->set_remaining_key_lease_time_total_ms(
-                        srpServerHosts->remaining_key_lease_time_total_ms() + leaseInfo.mRemainingKeyLease);
-                }
-
-                while ((service = otSrpServerHostGetNextService(host, service)))
-                {
-                    if (otSrpServerServiceIsDeleted(service))
-                    {
-                        srpServerServices->set_deleted_count(srpServerServices->deleted_count() + 1);
-                    }
-                    else
-                    {
-                        srpServerServices->set_fresh_count(srpServerServices->fresh_count() + 1);
-                        otSrpServerServiceGetLeaseInfo(service, &leaseInfo);
-                        srpServerServices->set_lease_time_total_ms(srpServerServices->lease_time_total_ms() +
-                                                                   leaseInfo.mLease);
-                        srpServerServices->set_key_lease_time_total_ms(srpServerServices->key_lease_time_total_ms() +
-                                                                       leaseInfo.mKeyLease);
-                        srpServerServices->set_remaining_lease_time_total_ms(
-                            srpServerServices->remaining_lease_time_total_ms() + leaseInfo.mRemainingLease);
-                        srpServerServices->set_remaining_key_lease_time_total_ms(
-                            srpServerServices->remaining_key_lease_time_total_ms() + leaseInfo.mRemainingKeyLease);
-                    }
+                    srpServerServices->set_fresh_count(srpServerServices->fresh_count() + 1);
+                    otSrpServerServiceGetLeaseInfo(service, &leaseInfo);
+                    srpServerServices->set_lease_time_total_ms(srpServerServices->lease_time_total_ms() +
+                                                               leaseInfo.mLease);
+                    srpServerServices->set_key_lease_time_total_ms(srpServerServices->key_lease_time_total_ms() +
+                                                                   leaseInfo.mKeyLease);
+                    srpServerServices->set_remaining_lease_time_total_ms(
+                        srpServerServices->remaining_lease_time_total_ms() + leaseInfo.mRemainingLease);
+                    srpServerServices->set_remaining_key_lease_time_total_ms(
+                        srpServerServices->remaining_key_lease_time_total_ms() + leaseInfo.mRemainingKeyLease);
                 }
             }
-
-            srpServerResponseCounters->set_success_count(responseCounters->mSuccess);
-            srpServerResponseCounters->set_server_failure_count(responseCounters->mServerFailure);
-            srpServerResponseCounters->set_format_error_count(responseCounters->mFormatError);
-            srpServerResponseCounters->set_name_exists_count(responseCounters->mNameExists);
-            srpServerResponseCounters->set_refused_count(responseCounters->mRefused);
-            srpServerResponseCounters->set_other_count(responseCounters->mOther);
         }
-        // End of SrpServerInfo section.
+
+        srpServerResponseCounters->set_success_count(responseCounters->mSuccess);
+        srpServerResponseCounters->set_server_failure_count(responseCounters->mServerFailure);
+        srpServerResponseCounters->set_format_error_count(responseCounters->mFormatError);
+        srpServerResponseCounters->set_name_exists_count(responseCounters->mNameExists);
+        srpServerResponseCounters->set_refused_count(responseCounters->mRefused);
+        srpServerResponseCounters->set_other_count(responseCounters->mOther);
+    }
+    // End of SrpServerInfo section.
 #endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
 
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
-        // Begin of DnsServerInfo section.
-        {
-            auto            dnsServer                 = wpanBorderRouter->mutable_dns_server();
-            auto            dnsServerResponseCounters = dnsServer->mutable_response_counters();
-            otDnssdCounters otDnssdCounters           = *otDnssdGetCounters(mInstance);
-
-            dnsServerResponseCounters->set_success_count(otDnssdCounters.mSuccessResponse);
-            dnsServerResponseCounters->set_server_failure_count(otDnssdCounters.mServerFailureResponse);
-            dnsServerResponseCounters->set_format_error_count(otDnssdCounters.mFormatErrorResponse);
-            dnsServerResponseCounters->set_name_error_count(otDnssdCounters.mNameErrorResponse);
-            dnsServerResponseCounters->set_not_implemented_count(otDnssdCounters.mNotImplementedResponse);
-            dnsServerResponseCounters->set_other_count(otDnssdCounters.mOtherResponse);
-            // The counters of queries, responses, failures handled by upstream DNS server.
-            dnsServerResponseCounters->set_upstream_dns_queries(otDnssdCounters.mUpstreamDnsCounters.mQueries);
-            dnsServerResponseCounters->set_upstream_dns_responses(otDnssdCounters.mUpstreamDnsCounters.mResponses);
-            dnsServerResponseCounters->set_upstream_dns_failures(otDnssdCounters.mUpstreamDnsCounters.mFailures);
-
-            dnsServer->set_resolved_by_local_srp_count(otDnssdCounters.mResolvedBySrp);
+    // Begin of DnsServerInfo section.
+    {
+        auto            dnsServer                 = wpanBorderRouter->mutable_dns_server();
+        auto            dnsServerResponseCounters = dnsServer->mutable_response_counters();
+        otDnssdCounters otDnssdCounters           = *otDnssdGetCounters(mInstance);
+
+        dnsServerResponseCounters->set_success_count(otDnssdCounters.mSuccessResponse);
+        dnsServerResponseCounters->set_server_failure_count(otDnssdCounters.mServerFailureResponse);
+        dnsServerResponseCounters->set_format_error_count(otDnssdCounters.mFormatErrorResponse);
+        dnsServerResponseCounters->set_name_error_count(otDnssdCounters.mNameErrorResponse);
+        dnsServerResponseCounters->set_not_implemented_count(otDnssdCounters.mNotImplementedResponse);
+        dnsServerResponseCounters->set_other_count(otDnssdCounters.mOtherResponse);
+        // The counters of queries, responses, failures handled by upstream DNS server.
+        dnsServerResponseCounters->set_upstream_dns_queries(otDnssdCounters.mUpstreamDnsCounters.mQueries);
+        dnsServerResponseCounters->set_upstream_dns_responses(otDnssdCounters.mUpstreamDnsCounters.mResponses);
+        dnsServerResponseCounters->set_upstream_dns_failures(otDnssdCounters.mUpstreamDnsCounters.mFailures);
+
+        dnsServer->set_resolved_by_local_srp_count(otDnssdCounters.mResolvedBySrp);
 
 #if OTBR_ENABLE_DNS_UPSTREAM_QUERY
-            dnsServer->set_upstream_dns_query_state(
-                otDnssdUpstreamQueryIsEnabled(mInstance)
-                    ? threadnetwork::TelemetryData::UPSTREAMDNS_QUERY_STATE_ENABLED
-                    : threadnetwork::TelemetryData::UPSTREAMDNS_QUERY_STATE_DISABLED);
+        dnsServerResponseCounters->set_upstream_dns_cache_hits(DnsUpstreamCache::Get().GetCounters().mHits);
+        dnsServerResponseCounters->set_upstream_dns_cache_misses(DnsUpstreamCache::Get().GetCounters().mMisses);
+        dnsServer->set_upstream_dns_query_state(
+            otDnssdUpstreamQueryIsEnabled(mInstance)
+                ? threadnetwork::TelemetryData::UPSTREAMDNS_QUERY_STATE_ENABLED
+                : threadnetwork::TelemetryData::UPSTREAMDNS_QUERY_STATE_DISABLED);
 #endif // OTBR_ENABLE_DNS_UPSTREAM_QUERY
-        }
-        // End of DnsServerInfo section.
+    }
+    // End of DnsServerInfo section.
 #endif // OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
 
-        // Start of MdnsInfo section.
-        if (aPublisher != nullptr)
-        {
-            auto                     mdns     = wpanBorderRouter->mutable_mdns();
-            const MdnsTelemetryInfo &mdnsInfo = aPublisher->GetMdnsTelemetryInfo();
-
-            CopyMdnsResponseCounters(mdnsInfo.mHostRegistrations, mdns->mutable_host_registration_responses());
-            CopyMdnsResponseCounters(mdnsInfo.mServiceRegistrations, mdns->mutable_service_registration_responses());
-            CopyMdnsResponseCounters(mdnsInfo.mHostResolutions, mdns->mutable_host_resolution_responses());
-            CopyMdnsResponseCounters(mdnsInfo.mServiceResolutions, mdns->mutable_service_resolution_responses());
-
-            mdns->set_host_registration_ema_latency_ms(mdnsInfo.mHostRegistrationEmaLatency);
-            mdns->set_service_registration_ema_latency_ms(mdnsInfo.mServiceRegistrationEmaLatency);
-            mdns->set_host_resolution_ema_latency_ms(mdnsInfo.mHostResolutionEmaLatency);
-            mdns->set_service_resolution_ema_latency_ms(mdnsInfo.mServiceResolutionEmaLatency);
-        }
-        // End of MdnsInfo section.
+    // Start of MdnsInfo section.
+    if (aPublisher != nullptr)
+    {
+        auto                     mdns     = wpanBorderRouter->mutable_mdns();
+        const MdnsTelemetryInfo &mdnsInfo = aPublisher->GetMdnsTelemetryInfo();
+
+        CopyMdnsResponseCounters(mdnsInfo.mHostRegistrations, mdns->mutable_host_registration_responses());
+        CopyMdnsResponseCounters(mdnsInfo.mServiceRegistrations, mdns->mutable_service_registration_responses());
+        CopyMdnsResponseCounters(mdnsInfo.mHostResolutions, mdns->mutable_host_resolution_responses());
+        CopyMdnsResponseCounters(mdnsInfo.mServiceResolutions, mdns->mutable_service_resolution_responses());
+
+        mdns->set_host_registration_ema_latency_ms(mdnsInfo.mHostRegistrationEmaLatency);
+        mdns->set_service_registration_ema_latency_ms(mdnsInfo.mServiceRegistrationEmaLatency);
+        mdns->set_host_resolution_ema_latency_ms(mdnsInfo.mHostResolutionEmaLatency);
+        mdns->set_service_resolution_ema_latency_ms(mdnsInfo.mServiceResolutionEmaLatency);
+
+        CopyMdnsLatencyHistogram(mdnsInfo.mHostRegistrationLatency, mdns->mutable_host_registration_latency());
+        CopyMdnsLatencyHistogram(mdnsInfo.mKeyRegistrationLatency, mdns->mutable_key_registration_latency());
+        CopyMdnsLatencyHistogram(mdnsInfo.mServiceRegistrationLatency,
+                                 mdns->mutable_service_registration_latency());
+        CopyMdnsLatencyHistogram(mdnsInfo.mHostResolutionLatency, mdns->mutable_host_resolution_latency());
+        CopyMdnsLatencyHistogram(mdnsInfo.mServiceResolutionLatency, mdns->mutable_service_resolution_latency());
+    }
+    // End of MdnsInfo section.
 
 #if OTBR_ENABLE_NAT64
-        // Start of BorderRoutingNat64State section.
-        {
-            auto nat64State = wpanBorderRouter->mutable_nat64_state();
-
-            nat64State->set_prefix_manager_state(Nat64StateFromOtNat64State(otNat64GetPrefixManagerState(mInstance)));
-            nat64State->set_translator_state(Nat64StateFromOtNat64State(otNat64GetTranslatorState(mInstance)));
-        }
-        // End of BorderRoutingNat64State section.
-
-        // Start of Nat64Mapping section.
-        {
-            otNat64AddressMappingIterator iterator;
-            otNat64AddressMapping         otMapping;
-            Sha256::Hash                  hash;
-            Sha256                        sha256;
+    // Start of BorderRoutingNat64State section.
+    {
+        auto nat64State = wpanBorderRouter->mutable_nat64_state();
 
-            otNat64InitAddressMappingIterator(mInstance, &iterator);
-            while (otNat64GetNextAddressMapping(mInstance, &iterator, &otMapping) == OT_ERROR_NONE)
-            {
-                auto nat64Mapping         = wpanBorderRouter->add_nat64_mappings();
-                auto nat64MappingCounters = nat64Mapping->mutable_counters();
-
-                nat64Mapping->set_mapping_id(otMapping.mId);
-                CopyNat64TrafficCounters(otMapping.mCounters.mTcp, nat64MappingCounters->mutable_tcp());
-                CopyNat64TrafficCounters(otMapping.mCounters.mUdp, nat64MappingCounters->mutable_udp());
-                CopyNat64TrafficCounters(otMapping.mCounters.mIcmp, nat64MappingCounters->mutable_icmp());
-
-                sha256.Start();
-                sha256.Update(otMapping.mIp6.mFields.m8, sizeof(otMapping.mIp6.mFields.m8));
-                sha256.Update(mNat64PdCommonSalt, sizeof(mNat64PdCommonSalt));
-                sha256.Finish(hash);
-
-                nat64Mapping->mutable_hashed_ipv6_address()->append(reinterpret_cast<const char *>(hash.GetBytes()),
-                                                                    Sha256::Hash::kSize);
-                // Remaining time is not included in the telemetry
-            }
-        }
-        // End of Nat64Mapping section.
+        nat64State->set_prefix_manager_state(Nat64StateFromOtNat64State(otNat64GetPrefixManagerState(mInstance)));
+        nat64State->set_translator_state(Nat64StateFromOtNat64State(otNat64GetTranslatorState(mInstance)));
+    }
+    // End of BorderRoutingNat64State section.
 #endif // OTBR_ENABLE_NAT64
 #if OTBR_ENABLE_DHCP6_PD
-        RetrievePdInfo(wpanBorderRouter);
+    RetrievePdInfo(wpanBorderRouter);
 #endif // OTBR_ENABLE_DHCP6_PD
 #if OTBR_ENABLE_BORDER_AGENT
-        RetrieveBorderAgentInfo(wpanBorderRouter->mutable_border_agent_info());
+    RetrieveBorderAgentInfo(wpanBorderRouter->mutable_border_agent_info());
 #endif // OTBR_ENABLE_BORDER_AGENT
-       // End of WpanBorderRouter section.
+    // End of WpanBorderRouter section.
+}
+
+void ThreadHelper::RetrieveWpanRcp(threadnetwork::TelemetryData &aTelemetryData)
+{
+    auto                        wpanRcp                = aTelemetryData.mutable_wpan_rcp();
+    const otRadioSpinelMetrics *otRadioSpinelMetrics   = otSysGetRadioSpinelMetrics();
+    auto                        rcpStabilityStatistics = wpanRcp->mutable_rcp_stability_statistics();
+
+    if (otRadioSpinelMetrics != nullptr)
+    {
+        rcpStabilityStatistics->set_rcp_timeout_count(otRadioSpinelMetrics->mRcpTimeoutCount);
+        rcpStabilityStatistics->set_rcp_reset_count(otRadioSpinelMetrics->mRcpUnexpectedResetCount);
+        rcpStabilityStatistics->set_rcp_restoration_count(otRadioSpinelMetrics->mRcpRestorationCount);
+        rcpStabilityStatistics->set_spinel_parse_error_count(otRadioSpinelMetrics->mSpinelParseErrorCount);
+    }
+
+    // TODO: provide rcp_firmware_update_count info.
+    rcpStabilityStatistics->set_thread_stack_uptime(otInstanceGetUptime(mInstance));
 
-        // Start of WpanRcp section.
+    const otRcpInterfaceMetrics *otRcpInterfaceMetrics = otSysGetRcpInterfaceMetrics();
+
+    if (otRcpInterfaceMetrics != nullptr)
+    {
+        auto rcpInterfaceStatistics = wpanRcp->mutable_rcp_interface_statistics();
+
+        rcpInterfaceStatistics->set_rcp_interface_type(otRcpInterfaceMetrics->mRcpInterfaceType);
+        rcpInterfaceStatistics->set_transferred_frames_count(otRcpInterfaceMetrics->mTransferredFrameCount);
+        rcpInterfaceStatistics->set_transferred_valid_frames_count(
+            otRcpInterfaceMetrics->mTransferredValidFrameCount);
+        rcpInterfaceStatistics->set_transferred_garbage_frames_count(
+            otRcpInterfaceMetrics->mTransferredGarbageFrameCount);
+        rcpInterfaceStatistics->set_rx_frames_count(otRcpInterfaceMetrics->mRxFrameCount);
+        rcpInterfaceStatistics->set_rx_bytes_count(otRcpInterfaceMetrics->mRxFrameByteCount);
+        rcpInterfaceStatistics->set_tx_frames_count(otRcpInterfaceMetrics->mTxFrameCount);
+        rcpInterfaceStatistics->set_tx_bytes_count(otRcpInterfaceMetrics->mTxFrameByteCount);
+    }
+}
+
+otError ThreadHelper::RetrieveCoexMetrics(threadnetwork::TelemetryData &aTelemetryData)
+{
+    otError error = OT_ERROR_NONE;
+
+    auto               coexMetrics = aTelemetryData.mutable_coex_metrics();
+    otRadioCoexMetrics otRadioCoexMetrics;
+
+    if (otPlatRadioGetCoexMetrics(mInstance, &otRadioCoexMetrics) == OT_ERROR_NONE)
+    {
+        coexMetrics->set_count_tx_request(otRadioCoexMetrics.mNumTxRequest);
+        coexMetrics->set_count_tx_grant_immediate(otRadioCoexMetrics.mNumTxGrantImmediate);
+        coexMetrics->set_count_tx_grant_wait(otRadioCoexMetrics.mNumTxGrantWait);
+        coexMetrics->set_count_tx_grant_wait_activated(otRadioCoexMetrics.mNumTxGrantWaitActivated);
+        coexMetrics->set_count_tx_grant_wait_timeout(otRadioCoexMetrics.mNumTxGrantWaitTimeout);
+        coexMetrics->set_count_tx_grant_deactivated_during_request(
+            otRadioCoexMetrics.mNumTxGrantDeactivatedDuringRequest);
+        coexMetrics->set_tx_average_request_to_grant_time_us(otRadioCoexMetrics.mAvgTxRequestToGrantTime);
+        coexMetrics->set_count_rx_request(otRadioCoexMetrics.mNumRxRequest);
+        coexMetrics->set_count_rx_grant_immediate(otRadioCoexMetrics.mNumRxGrantImmediate);
+        coexMetrics->set_count_rx_grant_wait(otRadioCoexMetrics.mNumRxGrantWait);
+        coexMetrics->set_count_rx_grant_wait_activated(otRadioCoexMetrics.mNumRxGrantWaitActivated);
+        coexMetrics->set_count_rx_grant_wait_timeout(otRadioCoexMetrics.mNumRxGrantWaitTimeout);
+        coexMetrics->set_count_rx_grant_deactivated_during_request(
+            otRadioCoexMetrics.mNumRxGrantDeactivatedDuringRequest);
+        coexMetrics->set_count_rx_grant_none(otRadioCoexMetrics.mNumRxGrantNone);
+        coexMetrics->set_rx_average_request_to_grant_time_us(otRadioCoexMetrics.mAvgRxRequestToGrantTime);
+    }
+    else
+    {
+        error = OT_ERROR_FAILED;
+    }
+
+    return error;
+}
+
+#if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+void ThreadHelper::ScheduleLinkMetricsSampling(void)
+{
+    static constexpr uint32_t kInterval = OTBR_CONFIG_LINK_METRICS_SAMPLE_INTERVAL;
+
+    uint32_t jitter = std::uniform_int_distribution<uint32_t>(0, kInterval / 4)(mRandomDevice);
+
+    mLinkMetricsSamplingTaskId = mHost->PostTimerTask(Milliseconds(kInterval - kInterval / 8 + jitter), [this]() {
+        mLinkMetricsSamplingTaskId = 0;
+
+        // The instance is gone once the host is deinitialized, the sampling stops until a new helper is created.
+        if (mHost->GetInstance() == mInstance)
         {
-            auto                        wpanRcp                = telemetryData.mutable_wpan_rcp();
-            const otRadioSpinelMetrics *otRadioSpinelMetrics   = otSysGetRadioSpinelMetrics();
-            auto                        rcpStabilityStatistics = wpanRcp->mutable_rcp_stability_statistics();
+            SampleLinkMetrics();
+            ScheduleLinkMetricsSampling();
+        }
+    });
+}
 
-            if (otRadioSpinelMetrics != nullptr)
-            {
-                rcpStabilityStatistics->set_rcp_timeout_count(otRadioSpinelMetrics->mRcpTimeoutCount);
-                rcpStabilityStatistics->set_rcp_reset_count(otRadioSpinelMetrics->mRcpUnexpectedResetCount);
-                rcpStabilityStatistics->set_rcp_restoration_count(otRadioSpinelMetrics->mRcpRestorationCount);
-                rcpStabilityStatistics->set_spinel_parse_error_count(otRadioSpinelMetrics->mSpinelParseErrorCount);
-            }
+void ThreadHelper::SampleLinkMetrics(void)
+{
+    // Neighbors which are not sampled successfully within this number of intervals are removed from the history.
+    static constexpr uint32_t kMaxMissedSamples = 4;
 
-            // TODO: provide rcp_firmware_update_count info.
-            rcpStabilityStatistics->set_thread_stack_uptime(otInstanceGetUptime(mInstance));
+    otNeighborInfoIterator iter = OT_NEIGHBOR_INFO_ITERATOR_INIT;
+    otNeighborInfo         info;
+    Timepoint              now = Clock::now();
 
-            const otRcpInterfaceMetrics *otRcpInterfaceMetrics = otSysGetRcpInterfaceMetrics();
+    while (otThreadGetNextNeighborInfo(mInstance, &iter, &info) == OT_ERROR_NONE)
+    {
+        otLinkMetricsValues values;
 
-            if (otRcpInterfaceMetrics != nullptr)
-            {
-                auto rcpInterfaceStatistics = wpanRcp->mutable_rcp_interface_statistics();
-
-                rcpInterfaceStatistics->set_rcp_interface_type(otRcpInterfaceMetrics->mRcpInterfaceType);
-                rcpInterfaceStatistics->set_transferred_frames_count(otRcpInterfaceMetrics->mTransferredFrameCount);
-                rcpInterfaceStatistics->set_transferred_valid_frames_count(
-                    otRcpInterfaceMetrics->mTransferredValidFrameCount);
-                rcpInterfaceStatistics->set_transferred_garbage_frames_count(
-                    otRcpInterfaceMetrics->mTransferredGarbageFrameCount);
-                rcpInterfaceStatistics->set_rx_frames_count(otRcpInterfaceMetrics->mRxFrameCount);
-                rcpInterfaceStatistics->set_rx_bytes_count(otRcpInterfaceMetrics->mRxFrameByteCount);
-                rcpInterfaceStatistics->set_tx_frames_count(otRcpInterfaceMetrics->mTxFrameCount);
-                rcpInterfaceStatistics->set_tx_bytes_count(otRcpInterfaceMetrics->mTxFrameByteCount);
-            }
+        // Some neighbors don't support Link Metrics Subject feature. So it's expected that some other errors
+        // are returned.
+        if (otLinkMetricsManagerGetMetricsValueByExtAddr(mInstance, &info.mExtAddress, &values) == OT_ERROR_NONE)
+        {
+            mLinkMetricsHistory.Record(ConvertOpenThreadUint64(info.mExtAddress.m8),
+                                       {values.mLinkMarginValue, values.mRssiValue}, now);
         }
-        // End of WpanRcp section.
+    }
+
+    mLinkMetricsHistory.RemoveStale(now - Milliseconds(kMaxMissedSamples * OTBR_CONFIG_LINK_METRICS_SAMPLE_INTERVAL));
+}
 
-        // Start of CoexMetrics section.
+void ThreadHelper::RetrieveLowPowerMetrics(threadnetwork::TelemetryData &aTelemetryData)
+{
+    auto      lowPowerMetrics = aTelemetryData.mutable_low_power_metrics();
+    Timepoint now             = Clock::now();
+
+    // Begin of Link Metrics section, read from the history sampled in the background.
+    mLinkMetricsHistory.ForEach([lowPowerMetrics, now](uint64_t, const LinkMetricsHistory::Summary &aSummary) {
+        auto linkMetricsStats = lowPowerMetrics->add_link_metrics_entries();
+
+        linkMetricsStats->set_link_margin(aSummary.mLatest.mLinkMargin);
+        linkMetricsStats->set_rssi(aSummary.mLatest.mRssi);
+        linkMetricsStats->set_sample_count(aSummary.mSampleCount);
+        linkMetricsStats->set_average_link_margin(aSummary.mAverageLinkMargin);
+        linkMetricsStats->set_average_rssi(aSummary.mAverageRssi);
+        linkMetricsStats->set_min_link_margin(aSummary.mMinLinkMargin);
+        linkMetricsStats->set_min_rssi(aSummary.mMinRssi);
+        linkMetricsStats->set_sample_age_ms(
+            std::chrono::duration_cast<Milliseconds>(now - aSummary.mLastSampleTime).count());
+    });
+}
+#endif // OTBR_ENABLE_LINK_METRICS_TELEMETRY
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+void ThreadHelper::RetrieveMainloopMetrics(threadnetwork::TelemetryData &aTelemetryData)
+{
+    // Begin of MainloopMetrics section.
+    auto                 mainloopMetrics = aTelemetryData.mutable_mainloop_metrics();
+    const MainloopStats &stats           = MainloopManager::GetInstance().GetStats();
+
+    mainloopMetrics->set_fd_wakeup_count(stats.mFdWakeupCount);
+    mainloopMetrics->set_timeout_wakeup_count(stats.mTimeoutWakeupCount);
+    CopyMainloopHistogram(stats.mIterationTime, mainloopMetrics->mutable_iteration_time_us());
+    for (const auto &entry : stats.mProcessorStats)
+    {
+        auto processorMetrics = mainloopMetrics->add_processor_metrics();
+
+        processorMetrics->set_name(entry.first);
+        CopyMainloopHistogram(entry.second.mUpdateTime, processorMetrics->mutable_update_time_us());
+        CopyMainloopHistogram(entry.second.mProcessTime, processorMetrics->mutable_process_time_us());
+    }
+    CopyMainloopHistogram(stats.mTaskQueueDepth, mainloopMetrics->mutable_task_queue_depth());
+    mainloopMetrics->set_max_delayed_task_count(stats.mMaxDelayedTasks);
+    mainloopMetrics->set_stall_count(MainloopWatchdog::Get().GetStallCount());
+    CopyMainloopHistogram(stats.mWakeupLatency, mainloopMetrics->mutable_wakeup_latency_us());
+    // End of MainloopMetrics section.
+}
+#endif // OTBR_ENABLE_MAINLOOP_STATS
+
+void ThreadHelper::RetrieveBackboneRouterMetrics(const BackboneRouter::BackboneRouterStats &aStats,
+                                                 threadnetwork::TelemetryData              &aTelemetryData)
+{
+    // Begin of BackboneRouterMetrics section.
+    auto backboneRouterMetrics = aTelemetryData.mutable_backbone_router_metrics();
+
+    backboneRouterMetrics->set_ns_received(aStats.mNsReceived);
+    backboneRouterMetrics->set_ns_answered(aStats.mNsAnswered);
+    backboneRouterMetrics->set_ns_dropped(aStats.mNsDropped);
+    backboneRouterMetrics->set_dua_added_events(aStats.mDuaAddedEvents);
+    backboneRouterMetrics->set_dua_renewed_events(aStats.mDuaRenewedEvents);
+    backboneRouterMetrics->set_dua_removed_events(aStats.mDuaRemovedEvents);
+    backboneRouterMetrics->set_dua_cleared_events(aStats.mDuaClearedEvents);
+    backboneRouterMetrics->set_become_primary_count(aStats.mBecomePrimaryCount);
+    backboneRouterMetrics->set_resign_primary_count(aStats.mResignPrimaryCount);
+    CopyMainloopHistogram(aStats.mNfqVerdictLatency, backboneRouterMetrics->mutable_nfq_verdict_latency_us());
+    CopyMainloopHistogram(aStats.mRouteProgrammingTime, backboneRouterMetrics->mutable_route_programming_time_us());
+    CopyMainloopHistogram(aStats.mBecomePrimaryTime, backboneRouterMetrics->mutable_become_primary_time_us());
+    CopyMainloopHistogram(aStats.mResignPrimaryTime, backboneRouterMetrics->mutable_resign_primary_time_us());
+    // End of BackboneRouterMetrics section.
+}
+
+#if OTBR_ENABLE_NAT64
+void ThreadHelper::RetrieveNat64Mappings(const TelemetryOptions &aOptions, threadnetwork::TelemetryData &aTelemetryData)
+{
+    auto                          wpanBorderRouter = aTelemetryData.mutable_wpan_border_router();
+    auto                          page             = wpanBorderRouter->mutable_nat64_mappings_page();
+    otNat64AddressMappingIterator iterator;
+    otNat64AddressMapping         otMapping;
+    otNat64ProtocolCounters       omittedCounters;
+    uint32_t                      totalCount = 0;
+    size_t                        count;
+    Sha256::Hash                  hash;
+    Sha256                        sha256;
+
+    std::vector<otNat64AddressMapping>                       mappings;
+    std::map<uint64_t, std::pair<otIp6Address, std::string>> hashes;
+
+    otNat64InitAddressMappingIterator(mInstance, &iterator);
+    while (otNat64GetNextAddressMapping(mInstance, &iterator, &otMapping) == OT_ERROR_NONE)
+    {
+        auto cached = mNat64MappingHashes.find(otMapping.mId);
+
+        // The hashes of all live mappings are kept, so that the next pages don't hash them again.
+        if (cached != mNat64MappingHashes.end() &&
+            memcmp(&cached->second.first, &otMapping.mIp6, sizeof(otMapping.mIp6)) == 0)
         {
-            auto               coexMetrics = telemetryData.mutable_coex_metrics();
-            otRadioCoexMetrics otRadioCoexMetrics;
+            hashes.insert(*cached);
+        }
 
-            if (otPlatRadioGetCoexMetrics(mInstance, &otRadioCoexMetrics) == OT_ERROR_NONE)
-            {
-                coexMetrics->set_count_tx_request(otRadioCoexMetrics.mNumTxRequest);
-                coexMetrics->set_count_tx_grant_immediate(otRadioCoexMetrics.mNumTxGrantImmediate);
-                coexMetrics->set_count_tx_grant_wait(otRadioCoexMetrics.mNumTxGrantWait);
-                coexMetrics->set_count_tx_grant_wait_activated(otRadioCoexMetrics.mNumTxGrantWaitActivated);
-                coexMetrics->set_count_tx_grant_wait_timeout(otRadioCoexMetrics.mNumTxGrantWaitTimeout);
-                coexMetrics->set_count_tx_grant_deactivated_during_request(
-                    otRadioCoexMetrics.mNumTxGrantDeactivatedDuringRequest);
-                coexMetrics->set_tx_average_request_to_grant_time_us(otRadioCoexMetrics.mAvgTxRequestToGrantTime);
-                coexMetrics->set_count_rx_request(otRadioCoexMetrics.mNumRxRequest);
-                coexMetrics->set_count_rx_grant_immediate(otRadioCoexMetrics.mNumRxGrantImmediate);
-                coexMetrics->set_count_rx_grant_wait(otRadioCoexMetrics.mNumRxGrantWait);
-                coexMetrics->set_count_rx_grant_wait_activated(otRadioCoexMetrics.mNumRxGrantWaitActivated);
-                coexMetrics->set_count_rx_grant_wait_timeout(otRadioCoexMetrics.mNumRxGrantWaitTimeout);
-                coexMetrics->set_count_rx_grant_deactivated_during_request(
-                    otRadioCoexMetrics.mNumRxGrantDeactivatedDuringRequest);
-                coexMetrics->set_count_rx_grant_none(otRadioCoexMetrics.mNumRxGrantNone);
-                coexMetrics->set_rx_average_request_to_grant_time_us(otRadioCoexMetrics.mAvgRxRequestToGrantTime);
-            }
-            else
-            {
-                error = OT_ERROR_FAILED;
-            }
+        totalCount++;
+
+        if (aOptions.mNat64MappingOrder != kNat64MappingOrderById || otMapping.mId > aOptions.mNat64MappingCursor)
+        {
+            mappings.push_back(otMapping);
         }
-        // End of CoexMetrics section.
     }
 
-#if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+    count = mappings.size();
+    if (aOptions.mMaxNat64Mappings != 0 && aOptions.mMaxNat64Mappings < count)
+    {
+        count = aOptions.mMaxNat64Mappings;
+    }
+
+    // Only the reported mappings are ordered, the others are summarized.
+    std::partial_sort(mappings.begin(), mappings.begin() + count, mappings.end(),
+                      [&aOptions](const otNat64AddressMapping &aFirst, const otNat64AddressMapping &aSecond) {
+                          switch (aOptions.mNat64MappingOrder)
+                          {
+                          case kNat64MappingOrderByTraffic:
+                              return GetNat64MappingBytes(aFirst) > GetNat64MappingBytes(aSecond);
+                          case kNat64MappingOrderByIdleTime:
+                              return aFirst.mRemainingTimeMs < aSecond.mRemainingTimeMs;
+                          case kNat64MappingOrderById:
+                          default:
+                              return aFirst.mId < aSecond.mId;
+                          }
+                      });
+
+    for (size_t i = 0; i < count; i++)
     {
-        auto lowPowerMetrics = telemetryData.mutable_low_power_metrics();
-        // Begin of Link Metrics section.
-        for (const otNeighborInfo &neighborInfo : neighborTable)
+        const otNat64AddressMapping &mapping      = mappings[i];
+        auto                         nat64Mapping = wpanBorderRouter->add_nat64_mappings();
+        auto                         cached       = hashes.find(mapping.mId);
+
+        nat64Mapping->set_mapping_id(mapping.mId);
+        CopyNat64ProtocolCounters(mapping.mCounters, nat64Mapping->mutable_counters());
+
+        // Only the addresses of new mappings are hashed, the others reuse the hash of the previous retrieval.
+        if (cached == hashes.end())
         {
-            otError             query_error;
-            otLinkMetricsValues values;
+            sha256.Start();
+            sha256.Update(mapping.mIp6.mFields.m8, sizeof(mapping.mIp6.mFields.m8));
+            sha256.Update(mNat64PdCommonSalt, sizeof(mNat64PdCommonSalt));
+            sha256.Finish(hash);
 
-            query_error = otLinkMetricsManagerGetMetricsValueByExtAddr(mInstance, &neighborInfo.mExtAddress, &values);
-            // Some neighbors don't support Link Metrics Subject feature. So it's expected that some other errors
-            // are returned.
-            if (query_error == OT_ERROR_NONE)
-            {
-                auto linkMetricsStats = lowPowerMetrics->add_link_metrics_entries();
-                linkMetricsStats->set_link_margin(values.mLinkMarginValue);
-                linkMetricsStats->set_rssi(values.mRssiValue);
-            }
+            cached = hashes.emplace(mapping.mId, std::make_pair(mapping.mIp6, std::string())).first;
+            cached->second.second.assign(reinterpret_cast<const char *>(hash.GetBytes()), Sha256::Hash::kSize);
         }
+
+        nat64Mapping->mutable_hashed_ipv6_address()->append(cached->second.second);
+        // Remaining time is not included in the telemetry
     }
-#endif // OTBR_ENABLE_LINK_METRICS_TELEMETRY
 
-    return error;
+    memset(&omittedCounters, 0, sizeof(omittedCounters));
+    for (size_t i = count; i < mappings.size(); i++)
+    {
+        AddNat64TrafficCounters(mappings[i].mCounters.mTcp, omittedCounters.mTcp);
+        AddNat64TrafficCounters(mappings[i].mCounters.mUdp, omittedCounters.mUdp);
+        AddNat64TrafficCounters(mappings[i].mCounters.mIcmp, omittedCounters.mIcmp);
+    }
+
+    page->set_total_count(totalCount);
+    page->set_omitted_count(static_cast<uint32_t>(mappings.size() - count));
+    CopyNat64ProtocolCounters(omittedCounters, page->mutable_omitted_counters());
+    if (aOptions.mNat64MappingOrder == kNat64MappingOrderById && count > 0 && count < mappings.size())
+    {
+        page->set_next_cursor(mappings[count - 1].mId);
+    }
+
+    // Mappings which expired are dropped.
+    mNat64MappingHashes.swap(hashes);
+}
+#endif // OTBR_ENABLE_NAT64
+
+void ThreadHelper::RetrieveStartupMetrics(threadnetwork::TelemetryData &aTelemetryData)
+{
+    // Begin of StartupMetrics section.
+    auto                 startupMetrics = aTelemetryData.mutable_startup_metrics();
+    const StartupTiming &timing         = StartupTiming::Get();
+
+    startupMetrics->clear_phases();
+    for (uint8_t i = 0; i < StartupTiming::kNumPhases; i++)
+    {
+        StartupTiming::Phase phase = static_cast<StartupTiming::Phase>(i);
+
+        if (!timing.IsMarked(phase))
+        {
+            continue;
+        }
+
+        auto startupPhase = startupMetrics->add_phases();
+
+        startupPhase->set_name(StartupTiming::PhaseToString(phase));
+        startupPhase->set_elapsed_ms(timing.GetElapsedMs(phase));
+    }
+    // End of StartupMetrics section.
+}
+
+void ThreadHelper::RetrieveMemoryMetrics(threadnetwork::TelemetryData &aTelemetryData)
+{
+    // Begin of MemoryMetrics section.
+    auto memoryMetrics = aTelemetryData.mutable_memory_metrics();
+
+    memoryMetrics->clear_entries();
+    MemoryUsageRegistry::Get().ForEach([memoryMetrics](const char *aName, const MemoryUsage &aUsage) {
+        auto entry = memoryMetrics->add_entries();
+
+        entry->set_name(aName);
+        entry->set_entries(aUsage.mEntries);
+        entry->set_bytes(aUsage.mBytes);
+    });
+    // End of MemoryMetrics section.
 }
 #endif // OTBR_ENABLE_TELEMETRY_DATA_API
 
 otError ThreadHelper::ProcessDatasetForMigration(otOperationalDatasetTlvs &aDatasetTlvs, uint32_t aDelayMilli)
 {
-    otError  error = OT_ERROR_NONE;
-    Tlv     *tlv;
+    return AppendMigrationTlvs(aDatasetTlvs, GetPendingTimestamp(), aDelayMilli);
+}
+
+size_t ThreadHelper::PrepareDatasetsForMigration(const std::vector<std::vector<uint8_t>> &aDatasetsTlvs,
+                                                 uint32_t                                 aDelayMilli,
+                                                 std::vector<otOperationalDatasetTlvs>   &aPreparedTlvs,
+                                                 MigrationProgressHandler                 aProgressHandler)
+{
+    uint64_t pendingTimestamp = GetPendingTimestamp();
+    size_t   numValid         = 0;
+
+    aPreparedTlvs.clear();
+    aPreparedTlvs.resize(aDatasetsTlvs.size());
+
+    for (size_t i = 0; i < aDatasetsTlvs.size(); i++)
+    {
+        otError error = PrepareDatasetForMigration(aDatasetsTlvs[i], pendingTimestamp, aDelayMilli, aPreparedTlvs[i]);
+
+        if (error == OT_ERROR_NONE)
+        {
+            numValid++;
+        }
+        else
+        {
+            aPreparedTlvs[i].mLength = 0;
+        }
+
+        if (aProgressHandler != nullptr)
+        {
+            aProgressHandler(i, error);
+        }
+    }
+
+    return numValid;
+}
+
+otError ThreadHelper::PrepareDatasetForMigration(const std::vector<uint8_t> &aDatasetTlvs,
+                                                 uint64_t                    aPendingTimestamp,
+                                                 uint32_t                    aDelayMilli,
+                                                 otOperationalDatasetTlvs   &aPreparedTlvs)
+{
+    otError              error = OT_ERROR_NONE;
+    otOperationalDataset dataset;
+
+    VerifyOrExit(aDatasetTlvs.size() <= sizeof(aPreparedTlvs.mTlvs), error = OT_ERROR_INVALID_ARGS);
+    std::copy(aDatasetTlvs.begin(), aDatasetTlvs.end(), aPreparedTlvs.mTlvs);
+    aPreparedTlvs.mLength = aDatasetTlvs.size();
+
+    SuccessOrExit(error = otDatasetParseTlvs(&aPreparedTlvs, &dataset));
+    VerifyOrExit(dataset.mComponents.mIsActiveTimestampPresent, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(dataset.mComponents.mIsNetworkKeyPresent, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(dataset.mComponents.mIsNetworkNamePresent, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(dataset.mComponents.mIsExtendedPanIdPresent, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(dataset.mComponents.mIsMeshLocalPrefixPresent, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(dataset.mComponents.mIsPanIdPresent, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(dataset.mComponents.mIsChannelPresent, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(dataset.mComponents.mIsPskcPresent, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(dataset.mComponents.mIsSecurityPolicyPresent, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(dataset.mComponents.mIsChannelMaskPresent, error = OT_ERROR_INVALID_ARGS);
+
+    SuccessOrExit(error = AppendMigrationTlvs(aPreparedTlvs, aPendingTimestamp, aDelayMilli));
+
+    assert(aPreparedTlvs.mLength > 0);
+
+exit:
+    return error;
+}
+
+uint64_t ThreadHelper::GetPendingTimestamp(void)
+{
     timespec currentTime;
     uint64_t pendingTimestamp = 0;
 
-    VerifyOrExit(FindTlv(OT_MESHCOP_TLV_PENDINGTIMESTAMP, aDatasetTlvs.mTlvs, aDatasetTlvs.mLength) == nullptr,
-                 error = OT_ERROR_INVALID_ARGS);
-    VerifyOrExit(FindTlv(OT_MESHCOP_TLV_DELAYTIMER, aDatasetTlvs.mTlvs, aDatasetTlvs.mLength) == nullptr,
+    /*
+     * | Timestamp Seconds | Timestamp Ticks | U bit |
+     * |         48        |         15      |   1   |
+     */
+    clock_gettime(CLOCK_REALTIME, &currentTime);
+    pendingTimestamp |= (static_cast<uint64_t>(currentTime.tv_sec) << 16); // Set the 48 bits of Timestamp seconds.
+    pendingTimestamp |= (((static_cast<uint64_t>(currentTime.tv_nsec) * 32768 / 1000000000) & 0x7fff)
+                         << 1); // Set the 15 bits of Timestamp ticks, the fractional Unix Time value in 32.768 kHz
+                                // resolution. Leave the U-bit unset.
+
+    return pendingTimestamp;
+}
+
+otError ThreadHelper::AppendMigrationTlvs(otOperationalDatasetTlvs &aDatasetTlvs,
+                                          uint64_t                  aPendingTimestamp,
+                                          uint32_t                  aDelayMilli)
+{
+    static const uint8_t kMigrationTlvTypes[] = {OT_MESHCOP_TLV_PENDINGTIMESTAMP, OT_MESHCOP_TLV_DELAYTIMER};
+
+    otError    error = OT_ERROR_NONE;
+    TlvView    datasetTlvs(aDatasetTlvs.mTlvs, aDatasetTlvs.mLength);
+    const Tlv *migrationTlvs[sizeof(kMigrationTlvTypes)];
+    Tlv       *tlv;
+
+    VerifyOrExit(datasetTlvs.IsWellFormed(), error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(datasetTlvs.Find(kMigrationTlvTypes, migrationTlvs, sizeof(kMigrationTlvTypes)) == 0,
                  error = OT_ERROR_INVALID_ARGS);
 
     // There must be sufficient space for a Pending Timestamp TLV and a Delay Timer TLV.
@@ -1728,12 +2452,7 @@ otError ThreadHelper::ProcessDatasetForMigration(otOperationalDatasetTlvs &aData
      * |  8   |   8   |         48        |         15      |   1   |
      */
     tlv->SetType(OT_MESHCOP_TLV_PENDINGTIMESTAMP);
-    clock_gettime(CLOCK_REALTIME, &currentTime);
-    pendingTimestamp |= (static_cast<uint64_t>(currentTime.tv_sec) << 16); // Set the 48 bits of Timestamp seconds.
-    pendingTimestamp |= (((static_cast<uint64_t>(currentTime.tv_nsec) * 32768 / 1000000000) & 0x7fff)
-                         << 1); // Set the 15 bits of Timestamp ticks, the fractional Unix Time value in 32.768 kHz
-                                // resolution. Leave the U-bit unset.
-    tlv->SetValue(pendingTimestamp);
+    tlv->SetValue(aPendingTimestamp);
 
     tlv = tlv->GetNext();
     tlv->SetType(OT_MESHCOP_TLV_DELAYTIMER);
@@ -50,10 +50,19 @@
 #include <openthread/joiner.h>
 #include <openthread/netdata.h>
 #include <openthread/thread.h>
+#include "backbone_router/backbone_stats.hpp"
+#include "common/task_runner.hpp"
 #include "mdns/mdns.hpp"
+#if OTBR_ENABLE_CHANNEL_SAMPLING
+#include "utils/channel_occupancy.hpp"
+#endif
+#include "utils/counter_history.hpp"
 #if OTBR_ENABLE_TELEMETRY_DATA_API
 #include "proto/thread_telemetry.pb.h"
 #endif
+#if OTBR_ENABLE_TELEMETRY_DATA_API && OTBR_ENABLE_LINK_METRICS_TELEMETRY
+#include "utils/link_metrics_history.hpp"
+#endif
 
 namespace otbr {
 namespace Ncp {
@@ -70,17 +79,70 @@ namespace agent {
 class ThreadHelper
 {
 public:
-    using DeviceRoleHandler       = std::function<void(otDeviceRole)>;
-    using ScanHandler             = std::function<void(otError, const std::vector<otActiveScanResult> &)>;
-    using EnergyScanHandler       = std::function<void(otError, const std::vector<otEnergyScanResult> &)>;
-    using ResultHandler           = std::function<void(otError)>;
-    using AttachHandler           = std::function<void(otError, int64_t)>;
-    using UpdateMeshCopTxtHandler = std::function<void(std::map<std::string, std::vector<uint8_t>>)>;
-    using DatasetChangeHandler    = std::function<void(const otOperationalDatasetTlvs &)>;
+    using DeviceRoleHandler        = std::function<void(otDeviceRole)>;
+    using ScanHandler              = std::function<void(otError, const std::vector<otActiveScanResult> &)>;
+    using EnergyScanHandler        = std::function<void(otError, const std::vector<otEnergyScanResult> &)>;
+    using SurveyScanHandler        = std::function<
+        void(otError, const std::vector<otActiveScanResult> &, const std::vector<otEnergyScanResult> &)>;
+    using ActiveScanResultHandler  = std::function<void(const otActiveScanResult &)>;
+    using EnergyScanResultHandler  = std::function<void(const otEnergyScanResult &)>;
+    using ResultHandler            = std::function<void(otError)>;
+    using AttachHandler            = std::function<void(otError, int64_t)>;
+    using MigrationProgressHandler = std::function<void(size_t, otError)>;
+    using UpdateMeshCopTxtHandler  = std::function<void(std::map<std::string, std::vector<uint8_t>>)>;
+    using DatasetChangeHandler     = std::function<void(const otOperationalDatasetTlvs &)>;
 #if OTBR_ENABLE_DHCP6_PD
     using Dhcp6PdStateCallback = std::function<void(otBorderRoutingDhcp6PdState)>;
 #endif
 
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    /**
+     * Telemetry data sections which can be retrieved independently.
+     */
+    enum TelemetrySection : uint32_t
+    {
+        kTelemetrySectionWpanStats        = 1 << 0,  ///< `wpan_stats`.
+        kTelemetrySectionWpanTopoFull     = 1 << 1,  ///< `wpan_topo_full` and `topo_entries`.
+        kTelemetrySectionWpanBorderRouter = 1 << 2,  ///< `wpan_border_router` except the NAT64 mappings.
+        kTelemetrySectionWpanRcp          = 1 << 3,  ///< `wpan_rcp`.
+        kTelemetrySectionCoexMetrics      = 1 << 4,  ///< `coex_metrics`.
+        kTelemetrySectionLowPowerMetrics  = 1 << 5,  ///< `low_power_metrics`.
+        kTelemetrySectionMainloopMetrics  = 1 << 6,  ///< `mainloop_metrics`.
+        kTelemetrySectionBackboneRouter   = 1 << 7,  ///< `backbone_router_metrics`.
+        kTelemetrySectionStartup          = 1 << 8,  ///< `startup_metrics`.
+        kTelemetrySectionMemory           = 1 << 9,  ///< `memory_metrics`.
+        kTelemetrySectionNat64Mappings    = 1 << 10, ///< `wpan_border_router.nat64_mappings` and its page info.
+        kTelemetrySectionsAll             = (1 << 11) - 1,
+    };
+
+    /**
+     * The orders in which NAT64 mappings are selected for the telemetry.
+     */
+    enum Nat64MappingOrder : uint8_t
+    {
+        kNat64MappingOrderById       = 0, ///< Ascending mapping ID, pages are resumed with a cursor.
+        kNat64MappingOrderByTraffic  = 1, ///< Descending number of translated bytes.
+        kNat64MappingOrderByIdleTime = 2, ///< Ascending remaining time, the most idle mappings first.
+    };
+
+    /**
+     * This structure bounds the size of the variable-length telemetry sections.
+     */
+    struct TelemetryOptions
+    {
+        TelemetryOptions(void)
+            : mMaxNat64Mappings(0)
+            , mNat64MappingCursor(0)
+            , mNat64MappingOrder(kNat64MappingOrderById)
+        {
+        }
+
+        uint32_t          mMaxNat64Mappings;   ///< The maximum number of NAT64 mappings reported, 0 for no limit.
+        uint64_t          mNat64MappingCursor; ///< Only mappings with a larger ID are reported when ordered by ID.
+        Nat64MappingOrder mNat64MappingOrder;  ///< The order in which the reported NAT64 mappings are selected.
+    };
+#endif
+
     /**
      * The constructor of a Thread helper.
      *
@@ -89,6 +151,11 @@ public:
      */
     ThreadHelper(otInstance *aInstance, otbr::Ncp::RcpHost *aHost);
 
+    /**
+     * The destructor of a Thread helper.
+     */
+    ~ThreadHelper(void);
+
     /**
      * This method adds a callback for device role change.
      *
@@ -137,6 +204,29 @@ public:
      */
     void EnergyScan(uint32_t aScanDuration, EnergyScanHandler aHandler);
 
+    /**
+     * This method performs a Thread network scan and an IEEE 802.15.4 Energy Scan of each channel in turn.
+     *
+     * Both scans of a channel are completed before the next channel is scanned, so the scan result handlers
+     * receive the results channel by channel.
+     *
+     * @param[in] aChannelMask   The channels to scan, 0 for the preferred channels.
+     * @param[in] aScanDuration  The duration of each scan of each channel, in milliseconds.
+     * @param[in] aHandler       The handler of all results, called when all channels are scanned.
+     */
+    void SurveyScan(uint32_t aChannelMask, uint32_t aScanDuration, SurveyScanHandler aHandler);
+
+    /**
+     * This method adds handlers which receive each scan result as soon as it arrives.
+     *
+     * The handlers receive the results of all scans, before the handler of a scan receives all of them.
+     *
+     * @param[in] aActiveScanResultHandler  The handler of Thread network scan results.
+     * @param[in] aEnergyScanResultHandler  The handler of Energy Scan results.
+     */
+    void AddScanResultHandlers(ActiveScanResultHandler aActiveScanResultHandler,
+                               EnergyScanResultHandler aEnergyScanResultHandler);
+
     /**
      * This method attaches the device to the Thread network.
      *
@@ -147,7 +237,8 @@ public:
      * @param[in] aExtPanId     The extended pan id, UINT64_MAX for random.
      * @param[in] aNetworkKey   The network key, empty for random.
      * @param[in] aPSKc         The pre-shared commissioner key, empty for random.
-     * @param[in] aChannelMask  A bitmask for valid channels, will random select one.
+     * @param[in] aChannelMask  A bitmask for valid channels, will select the least occupied one when the channels
+     *                          are sampled in the background, or a random one.
      * @param[in] aHandler      The attach result handler.
      */
     void Attach(const std::string          &aNetworkName,
@@ -183,6 +274,16 @@ public:
      */
     void AttachAllNodesTo(const std::vector<uint8_t> &aDatasetTlvs, AttachHandler aHandler);
 
+    /**
+     * This method makes all nodes in the current network attach to the network specified by a dataset prepared
+     * by `PrepareDatasetsForMigration()`.
+     *
+     * @param[in] aPreparedTlvs  The prepared dataset TLVs.
+     * @param[in] aDelayMilli    The delay time for migration in milliseconds, as given for the preparation.
+     * @param[in] aHandler       The result handler.
+     */
+    void AttachAllNodesTo(const otOperationalDatasetTlvs &aPreparedTlvs, uint32_t aDelayMilli, AttachHandler aHandler);
+
     /**
      * This method resets the OpenThread stack.
      *
@@ -228,6 +329,29 @@ public:
         return mInstance;
     }
 
+    /**
+     * This method returns the history of the counters of the Thread interface and of the neighbors.
+     *
+     * @returns The counter history.
+     */
+    const CounterHistory &GetCounterHistory(void) const { return mCounterHistory; }
+
+    /**
+     * This method returns the history of the counters of the Thread interface and of the neighbors.
+     *
+     * @returns The counter history.
+     */
+    CounterHistory &GetCounterHistory(void) { return mCounterHistory; }
+
+#if OTBR_ENABLE_CHANNEL_SAMPLING
+    /**
+     * This method returns the occupancy of the channels, sampled periodically in the background.
+     *
+     * @returns The channel occupancy statistics.
+     */
+    const ChannelOccupancy &GetChannelOccupancy(void) const { return mChannelOccupancy; }
+#endif
+
     /**
      * This method handles OpenThread state changed notification.
      *
@@ -263,13 +387,60 @@ public:
      * retrieve the remaining telemetries instead of the immediately return. The error code
      * OT_ERRROR_FAILED will be returned if there is one or more error(s) happened in the process.
      *
-     * @param[in] aPublisher     The Mdns::Publisher to provide MDNS telemetry if it is not `nullptr`.
-     * @param[in] telemetryData  The telemetry data to be populated.
+     * @param[in] aPublisher            The Mdns::Publisher to provide MDNS telemetry if it is not `nullptr`.
+     * @param[in] aTrelDnssdInfo        The TREL DNS-SD telemetry to be populated if it is not `nullptr`.
+     * @param[in] aBackboneRouterStats  The Backbone Router statistics to be populated if it is not `nullptr`.
+     * @param[in] telemetryData         The telemetry data to be populated.
+     *
+     * @retval OTBR_ERROR_NONE  There is no error happened in the process.
+     * @retval OT_ERRROR_FAILED There is one or more error(s) happened in the process.
+     */
+    otError RetrieveTelemetryData(Mdns::Publisher                           *aPublisher,
+                                  const TrelDnssdTelemetryInfo              *aTrelDnssdInfo,
+                                  const BackboneRouter::BackboneRouterStats *aBackboneRouterStats,
+                                  threadnetwork::TelemetryData              &telemetryData);
+
+    /**
+     * This method populates the selected sections of the telemetry data with best effort.
+     *
+     * Sections not set in @p aSections are left untouched in @p aTelemetryData, so the caller can collect
+     * the telemetry incrementally by calling this method once per section.
+     *
+     * @param[in] aPublisher            The Mdns::Publisher to provide MDNS telemetry if it is not `nullptr`.
+     * @param[in] aTrelDnssdInfo        The TREL DNS-SD telemetry to be populated if it is not `nullptr`.
+     * @param[in] aBackboneRouterStats  The Backbone Router statistics to be populated if it is not `nullptr`.
+     * @param[in] aSections             A bitmask of `kTelemetrySection*` values to populate.
+     * @param[in] aTelemetryData        The telemetry data to be populated.
+     *
+     * @retval OTBR_ERROR_NONE  There is no error happened in the process.
+     * @retval OT_ERRROR_FAILED There is one or more error(s) happened in the process.
+     */
+    otError RetrieveTelemetryData(Mdns::Publisher                           *aPublisher,
+                                  const TrelDnssdTelemetryInfo              *aTrelDnssdInfo,
+                                  const BackboneRouter::BackboneRouterStats *aBackboneRouterStats,
+                                  uint32_t                                   aSections,
+                                  threadnetwork::TelemetryData              &aTelemetryData);
+
+    /**
+     * This method populates the selected sections of the telemetry data with best effort, bounding the size of the
+     * variable-length sections.
+     *
+     * @param[in] aPublisher            The Mdns::Publisher to provide MDNS telemetry if it is not `nullptr`.
+     * @param[in] aTrelDnssdInfo        The TREL DNS-SD telemetry to be populated if it is not `nullptr`.
+     * @param[in] aBackboneRouterStats  The Backbone Router statistics to be populated if it is not `nullptr`.
+     * @param[in] aSections             A bitmask of `kTelemetrySection*` values to populate.
+     * @param[in] aOptions              The bounds of the variable-length sections.
+     * @param[in] aTelemetryData        The telemetry data to be populated.
      *
      * @retval OTBR_ERROR_NONE  There is no error happened in the process.
      * @retval OT_ERRROR_FAILED There is one or more error(s) happened in the process.
      */
-    otError RetrieveTelemetryData(Mdns::Publisher *aPublisher, threadnetwork::TelemetryData &telemetryData);
+    otError RetrieveTelemetryData(Mdns::Publisher                           *aPublisher,
+                                  const TrelDnssdTelemetryInfo              *aTrelDnssdInfo,
+                                  const BackboneRouter::BackboneRouterStats *aBackboneRouterStats,
+                                  uint32_t                                   aSections,
+                                  const TelemetryOptions                    &aOptions,
+                                  threadnetwork::TelemetryData              &aTelemetryData);
 #endif // OTBR_ENABLE_TELEMETRY_DATA_API
 
     /**
@@ -298,13 +469,46 @@ public:
      */
     static otError ProcessDatasetForMigration(otOperationalDatasetTlvs &aDatasetTlvs, uint32_t aDelayMilli);
 
+    /**
+     * This method validates a batch of datasets for `AttachAllNodesTo()` and processes them for migration.
+     *
+     * Each dataset must be a complete active dataset which is valid for `ProcessDatasetForMigration()`. All
+     * prepared datasets share the same Pending Timestamp, so the TLVs of many networks are built in one pass and
+     * can be scheduled later without further processing.
+     *
+     * @param[in]  aDatasetsTlvs     The datasets in TLVs format.
+     * @param[in]  aDelayMilli       The delay time for migration in milliseconds.
+     * @param[out] aPreparedTlvs     The prepared datasets, in the order of @p aDatasetsTlvs. The length of a dataset
+     *                               which is invalid is 0.
+     * @param[in]  aProgressHandler  The handler called with the index and the result of each dataset, may be
+     *                               nullptr.
+     *
+     * @returns The number of datasets which are valid.
+     */
+    static size_t PrepareDatasetsForMigration(const std::vector<std::vector<uint8_t>> &aDatasetsTlvs,
+                                              uint32_t                                 aDelayMilli,
+                                              std::vector<otOperationalDatasetTlvs>   &aPreparedTlvs,
+                                              MigrationProgressHandler                 aProgressHandler);
+
 private:
+    static otError PrepareDatasetForMigration(const std::vector<uint8_t> &aDatasetTlvs,
+                                              uint64_t                    aPendingTimestamp,
+                                              uint32_t                    aDelayMilli,
+                                              otOperationalDatasetTlvs   &aPreparedTlvs);
+    static otError AppendMigrationTlvs(otOperationalDatasetTlvs &aDatasetTlvs,
+                                       uint64_t                  aPendingTimestamp,
+                                       uint32_t                  aDelayMilli);
+    static uint64_t GetPendingTimestamp(void);
+
     static void ActiveScanHandler(otActiveScanResult *aResult, void *aThreadHelper);
     void        ActiveScanHandler(otActiveScanResult *aResult);
 
     static void EnergyScanCallback(otEnergyScanResult *aResult, void *aThreadHelper);
     void        EnergyScanCallback(otEnergyScanResult *aResult);
 
+    void SurveyNextChannel(void);
+    void FinishSurveyScan(otError aError);
+
     static void JoinerCallback(otError aError, void *aThreadHelper);
     void        JoinerCallback(otError aResult);
 
@@ -316,6 +520,14 @@ private:
 
     void    RandomFill(void *aBuf, size_t size);
     uint8_t RandomChannelFromChannelMask(uint32_t aChannelMask);
+    uint8_t SelectChannelFromChannelMask(uint32_t aChannelMask);
+
+#if OTBR_ENABLE_CHANNEL_SAMPLING
+    void        ScheduleChannelSampling(void);
+    void        SampleNextChannel(void);
+    static void ChannelSampleCallback(otEnergyScanResult *aResult, void *aThreadHelper);
+    void        ChannelSampleCallback(otEnergyScanResult *aResult);
+#endif
 
     void ActiveDatasetChangedCallback(void);
 
@@ -335,6 +547,28 @@ private:
 #endif
 #if OTBR_ENABLE_BORDER_AGENT
     void RetrieveBorderAgentInfo(threadnetwork::TelemetryData::BorderAgentInfo *aBorderAgentInfo);
+#endif
+    otError RetrieveWpanStats(threadnetwork::TelemetryData &aTelemetryData);
+    otError RetrieveWpanTopoFull(threadnetwork::TelemetryData &aTelemetryData);
+    void    RetrieveWpanBorderRouter(Mdns::Publisher              *aPublisher,
+                                     const TrelDnssdTelemetryInfo *aTrelDnssdInfo,
+                                     threadnetwork::TelemetryData &aTelemetryData);
+    void    RetrieveWpanRcp(threadnetwork::TelemetryData &aTelemetryData);
+    otError RetrieveCoexMetrics(threadnetwork::TelemetryData &aTelemetryData);
+#if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+    void ScheduleLinkMetricsSampling(void);
+    void SampleLinkMetrics(void);
+    void RetrieveLowPowerMetrics(threadnetwork::TelemetryData &aTelemetryData);
+#endif
+#if OTBR_ENABLE_MAINLOOP_STATS
+    void RetrieveMainloopMetrics(threadnetwork::TelemetryData &aTelemetryData);
+#endif
+    void RetrieveBackboneRouterMetrics(const BackboneRouter::BackboneRouterStats &aStats,
+                                       threadnetwork::TelemetryData              &aTelemetryData);
+    void RetrieveStartupMetrics(threadnetwork::TelemetryData &aTelemetryData);
+    void RetrieveMemoryMetrics(threadnetwork::TelemetryData &aTelemetryData);
+#if OTBR_ENABLE_NAT64
+    void RetrieveNat64Mappings(const TelemetryOptions &aOptions, threadnetwork::TelemetryData &aTelemetryData);
 #endif
 #endif // OTBR_ENABLE_TELEMETRY_DATA_API
 
@@ -342,11 +576,23 @@ private:
 
     otbr::Ncp::RcpHost *mHost;
 
+    CounterHistory mCounterHistory;
+
     ScanHandler                     mScanHandler;
     std::vector<otActiveScanResult> mScanResults;
     EnergyScanHandler               mEnergyScanHandler;
     std::vector<otEnergyScanResult> mEnergyScanResults;
 
+    // The survey scan in progress, if `mSurveyScanHandler` is set. `mSurveyChannelMask` holds the channels
+    // which are not scanned yet.
+    SurveyScanHandler mSurveyScanHandler;
+    uint32_t          mSurveyChannelMask  = 0;
+    uint16_t          mSurveyScanDuration = 0;
+    uint8_t           mSurveyChannel      = 0;
+
+    std::vector<ActiveScanResultHandler> mActiveScanResultHandlers;
+    std::vector<EnergyScanResultHandler> mEnergyScanResultHandlers;
+
     std::vector<DeviceRoleHandler>    mDeviceRoleHandlers;
     std::vector<DatasetChangeHandler> mActiveDatasetChangeHandlers;
 
@@ -364,6 +610,13 @@ private:
 
     std::random_device mRandomDevice;
 
+#if OTBR_ENABLE_CHANNEL_SAMPLING
+    // The occupancy of the channels, sampled one channel at a time in the background.
+    ChannelOccupancy   mChannelOccupancy;
+    TaskRunner::TaskId mChannelSamplingTaskId = 0;
+    uint8_t            mSampledChannel        = 0;
+#endif
+
 #if OTBR_ENABLE_DHCP6_PD
     Dhcp6PdStateCallback mDhcp6PdCallback;
 #endif
@@ -376,6 +629,29 @@ private:
     static constexpr uint8_t kNat64PdCommonHashSaltLength = 16;
     uint8_t                  mNat64PdCommonSalt[kNat64PdCommonHashSaltLength];
 #endif
+
+#if OTBR_ENABLE_TELEMETRY_DATA_API
+    // Telemetry data which is only recomputed when its inputs change.
+#if OTBR_ENABLE_BORDER_ROUTING
+    // `external_route_info` only depends on the Network Data and the RLOC16.
+    bool                                         mExternalRouteInfoValid = false;
+    threadnetwork::TelemetryData::ExternalRoutes mExternalRouteInfo;
+#endif
+#if OTBR_ENABLE_DHCP6_PD
+    // `hashed_pd_prefix` of the PD prefix `mHashedPdPrefixSource`, empty when not computed yet.
+    otIp6Prefix mHashedPdPrefixSource = {};
+    std::string mHashedPdPrefix;
+#endif
+#if OTBR_ENABLE_NAT64
+    // `hashed_ipv6_address` of each NAT64 mapping, keyed by the mapping ID.
+    std::map<uint64_t, std::pair<otIp6Address, std::string>> mNat64MappingHashes;
+#endif
+#if OTBR_ENABLE_LINK_METRICS_TELEMETRY
+    // Link metrics of the neighbors, sampled periodically in the background.
+    LinkMetricsHistory mLinkMetricsHistory;
+    TaskRunner::TaskId mLinkMetricsSamplingTaskId = 0;
+#endif
+#endif // OTBR_ENABLE_TELEMETRY_DATA_API
 };
 
 } // namespace agent
@@ -48,6 +48,7 @@
 
 static const char kDefaultInterfaceName[] = "wpan0";
 static const char kDefaultListenAddr[]    = "::";
+static const int  kDefaultThreadCount     = 2;
 
 std::unique_ptr<otbr::Web::WebServer> sServer(nullptr);
 
@@ -77,9 +78,11 @@ int main(int argc, char **argv)
     int          ret            = 0;
     int          opt;
     uint16_t     port          = OT_HTTP_PORT;
+    int          threadCount   = kDefaultThreadCount;
+    int          scanInterval  = -1;
     bool         syslogDisable = false;
 
-    while ((opt = getopt(argc, argv, "d:I:p:va:s")) != -1)
+    while ((opt = getopt(argc, argv, "d:I:p:r:t:va:s")) != -1)
     {
         switch (opt)
         {
@@ -99,6 +102,16 @@ int main(int argc, char **argv)
             port = atoi(httpPort);
             break;
 
+        case 'r':
+            scanInterval = atoi(optarg);
+            VerifyOrExit(scanInterval >= 0, fprintf(stderr, "Invalid scan refresh interval: %s\n", optarg); ret = -1);
+            break;
+
+        case 't':
+            threadCount = atoi(optarg);
+            VerifyOrExit(threadCount > 0, fprintf(stderr, "Invalid thread count: %s\n", optarg); ret = -1);
+            break;
+
         case 'v':
             PrintVersion();
             ExitNow();
@@ -109,7 +122,9 @@ int main(int argc, char **argv)
             break;
 
         default:
-            fprintf(stderr, "Usage: %s [-d DEBUG_LEVEL] [-I interfaceName] [-p port] [-a listenAddress] [-v]\n",
+            fprintf(stderr,
+                    "Usage: %s [-d DEBUG_LEVEL] [-I interfaceName] [-p port] [-a listenAddress] [-t threadCount] "
+                    "[-r scanRefreshSeconds] [-v]\n",
                     argv[0]);
             ExitNow(ret = -1);
             break;
@@ -143,7 +158,11 @@ int main(int argc, char **argv)
     signal(SIGINT, HandleSignal);
 
     sServer.reset(new otbr::Web::WebServer());
-    sServer->StartWebServer(interfaceName, httpListenAddr, port);
+    if (scanInterval >= 0)
+    {
+        sServer->SetScanRefreshInterval(otbr::Seconds(scanInterval));
+    }
+    sServer->StartWebServer(interfaceName, httpListenAddr, port, static_cast<size_t>(threadCount));
 
     otbrLogDeinit();
 
@@ -0,0 +1,184 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the in-memory cache of web GUI static assets.
+ */
+
+#define OTBR_LOG_TAG "WEB"
+
+#include "web/web-service/asset_cache.hpp"
+
+#define BOOST_NO_CXX11_SCOPED_ENUMS
+#include <boost/filesystem.hpp>
+#undef BOOST_NO_CXX11_SCOPED_ENUMS
+
+#include <fstream>
+#include <functional>
+#include <sstream>
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace Web {
+
+void AssetCache::Load(const std::string &aRootPath)
+{
+    boost::system::error_code    error;
+    boost::filesystem::path      root = boost::filesystem::canonical(aRootPath, error);
+    std::map<std::string, Asset> assets;
+    size_t                       totalSize = 0;
+
+    VerifyOrExit(!error, otbrLogWarning("Failed to open web root %s: %s", aRootPath.c_str(), error.message().c_str()));
+
+    for (boost::filesystem::recursive_directory_iterator iter(root, error), end; !error && iter != end;
+         iter.increment(error))
+    {
+        const boost::filesystem::path &path      = iter->path();
+        std::string                    extension = path.extension().string();
+        std::string                    key;
+        Asset                          asset;
+        boost::system::error_code      fileError;
+        uintmax_t                      fileSize;
+        time_t                         lastWriteTime;
+
+        if (!boost::filesystem::is_regular_file(path, fileError) || extension == ".gz" || extension == ".br")
+        {
+            continue;
+        }
+
+        fileSize = boost::filesystem::file_size(path, fileError);
+        if (fileError || fileSize > kMaxAssetSize)
+        {
+            continue;
+        }
+
+        lastWriteTime = boost::filesystem::last_write_time(path, fileError);
+        if (fileError || !ReadFile(path.string(), asset.mContent))
+        {
+            continue;
+        }
+
+        // Precompressed variants are optional.
+        ReadFile(path.string() + ".gz", asset.mGzipContent);
+        ReadFile(path.string() + ".br", asset.mBrotliContent);
+
+        asset.mContentType  = GetContentType(extension);
+        asset.mLastModified = FormatHttpDate(lastWriteTime);
+
+        // Pages must be revalidated so a new release is picked up, resources only change together with them.
+        asset.mCacheControl = (extension == ".html") ? "no-cache" : "public, max-age=86400";
+
+        {
+            char etag[sizeof("\"\"") + 16];
+
+            snprintf(etag, sizeof(etag), "\"%016" PRIx64 "\"",
+                     static_cast<uint64_t>(std::hash<std::string>()(asset.mContent)));
+            asset.mEtag = etag;
+        }
+
+        key = path.generic_string().substr(root.generic_string().size());
+        totalSize += asset.mContent.size() + asset.mGzipContent.size() + asset.mBrotliContent.size();
+        assets[key] = std::move(asset);
+    }
+
+    VerifyOrExit(!error, otbrLogWarning("Failed to load web assets: %s", error.message().c_str()));
+
+    mAssets.swap(assets);
+    otbrLogInfo("Cached %zu web assets, %zu bytes", mAssets.size(), totalSize);
+
+exit:
+    return;
+}
+
+const AssetCache::Asset *AssetCache::Find(const std::string &aPath) const
+{
+    std::string path = aPath;
+
+    if (path.empty() || path.back() == '/')
+    {
+        path += "index.html";
+    }
+
+    auto iter = mAssets.find(path);
+
+    return iter == mAssets.end() ? nullptr : &iter->second;
+}
+
+bool AssetCache::ReadFile(const std::string &aPath, std::string &aContent)
+{
+    std::ifstream      file(aPath, std::ios::in | std::ios::binary);
+    std::ostringstream content;
+    bool               success = false;
+
+    VerifyOrExit(file.is_open());
+    content << file.rdbuf();
+    VerifyOrExit(!file.bad());
+
+    aContent = content.str();
+    success  = true;
+
+exit:
+    return success;
+}
+
+std::string AssetCache::GetContentType(const std::string &aExtension)
+{
+    static const std::map<std::string, std::string> kContentTypes = {
+        {".css", "text/css"},
+        {".html", "text/html; charset=utf-8"},
+        {".ico", "image/x-icon"},
+        {".js", "application/javascript"},
+        {".json", "application/json"},
+        {".png", "image/png"},
+        {".svg", "image/svg+xml"},
+    };
+
+    auto iter = kContentTypes.find(aExtension);
+
+    return iter == kContentTypes.end() ? "application/octet-stream" : iter->second;
+}
+
+std::string AssetCache::FormatHttpDate(time_t aTime)
+{
+    char      date[sizeof("Thu, 01 Jan 1970 00:00:00 GMT")];
+    struct tm tm;
+
+    gmtime_r(&aTime, &tm);
+    strftime(date, sizeof(date), "%a, %d %b %Y %H:%M:%S GMT", &tm);
+
+    return date;
+}
+
+} // namespace Web
+} // namespace otbr
@@ -0,0 +1,104 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the in-memory cache of web GUI static assets.
+ */
+
+#ifndef OTBR_WEB_WEB_SERVICE_ASSET_CACHE_HPP_
+#define OTBR_WEB_WEB_SERVICE_ASSET_CACHE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <map>
+#include <string>
+
+#include <time.h>
+
+namespace otbr {
+namespace Web {
+
+/**
+ * This class implements an in-memory cache of the static web GUI assets.
+ *
+ * All assets are read once at startup, so serving a page does not touch the (possibly slow) storage. Precompressed
+ * `.br` and `.gz` variants placed next to an asset are loaded too and served to clients accepting them.
+ */
+class AssetCache
+{
+public:
+    /**
+     * This structure represents a cached asset.
+     */
+    struct Asset
+    {
+        std::string mContent;       ///< The raw content.
+        std::string mGzipContent;   ///< The gzip-compressed content, empty if not available.
+        std::string mBrotliContent; ///< The brotli-compressed content, empty if not available.
+        std::string mContentType;   ///< The Content-Type header value.
+        std::string mCacheControl;  ///< The Cache-Control header value.
+        std::string mEtag;          ///< The entity tag, including the quotes.
+        std::string mLastModified;  ///< The Last-Modified header value in HTTP date format.
+    };
+
+    /**
+     * This method loads all assets under a directory, replacing any previously cached asset.
+     *
+     * @param[in] aRootPath  The web root directory.
+     */
+    void Load(const std::string &aRootPath);
+
+    /**
+     * This method looks up the asset of a request path.
+     *
+     * A path ending with '/' resolves to the `index.html` in that directory.
+     *
+     * @param[in] aPath  The request path.
+     *
+     * @returns A pointer to the asset, or nullptr if the path is not cached.
+     */
+    const Asset *Find(const std::string &aPath) const;
+
+private:
+    enum
+    {
+        kMaxAssetSize = 4 * 1024 * 1024, ///< Larger files are left on disk.
+    };
+
+    static bool        ReadFile(const std::string &aPath, std::string &aContent);
+    static std::string GetContentType(const std::string &aExtension);
+    static std::string FormatHttpDate(time_t aTime);
+
+    std::map<std::string, Asset> mAssets;
+};
+
+} // namespace Web
+} // namespace otbr
+
+#endif // OTBR_WEB_WEB_SERVICE_ASSET_CACHE_HPP_
@@ -0,0 +1,410 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the D-Bus backend of the web service.
+ */
+
+#include "web/web-service/dbus_backend.hpp"
+
+#if OTBR_ENABLE_DBUS_SERVER
+
+#include <algorithm>
+
+#include <arpa/inet.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "dbus/common/constants.hpp"
+#include "dbus/common/dbus_message_helper.hpp"
+
+namespace otbr {
+namespace Web {
+
+namespace {
+
+// MeshCoP TLV types used to compose an Active Operational Dataset.
+enum : uint8_t
+{
+    kChannelTlvType         = 0,
+    kPanIdTlvType           = 1,
+    kNetworkKeyTlvType      = 5,
+    kMeshLocalPrefixTlvType = 7,
+};
+
+constexpr size_t kNetworkKeySize = 16;
+
+template <typename ValueType> bool ExtractNext(DBusMessageIter *aIter, ValueType &aValue)
+{
+    bool extracted = (otbr::DBus::DBusMessageExtractFromVariant(aIter, aValue) == OTBR_ERROR_NONE);
+
+    dbus_message_iter_next(aIter);
+
+    return extracted;
+}
+
+} // namespace
+
+DBusBackend::DBusBackend(const char *aNetifName)
+    : mNetifName(aNetifName)
+{
+}
+
+void DBusBackend::Reset(void)
+{
+    Reset(mQueryChannel);
+    Reset(mOperationChannel);
+}
+
+void DBusBackend::Reset(Channel &aChannel)
+{
+    std::lock_guard<std::mutex> lock(aChannel.mMutex);
+
+    aChannel.mApi.reset();
+    aChannel.mConnection.reset();
+}
+
+DBusBackend::ClientError DBusBackend::Connect(Channel &aChannel)
+{
+    ClientError error = ClientError::ERROR_NONE;
+    DBusError   dbusError;
+
+    dbus_error_init(&dbusError);
+
+    if (aChannel.mConnection != nullptr && !dbus_connection_get_is_connected(aChannel.mConnection.get()))
+    {
+        otbrLogWarning("Lost the D-Bus connection to the border agent, reconnecting");
+        aChannel.mApi.reset();
+        aChannel.mConnection.reset();
+    }
+
+    VerifyOrExit(aChannel.mApi == nullptr);
+
+    aChannel.mConnection = UniqueDBusConnection(dbus_bus_get_private(DBUS_BUS_SYSTEM, &dbusError));
+    VerifyOrExit(aChannel.mConnection != nullptr, error = ClientError::ERROR_DBUS);
+    dbus_connection_set_exit_on_disconnect(aChannel.mConnection.get(), false);
+
+    aChannel.mApi.reset(new otbr::DBus::ThreadApiDBus(aChannel.mConnection.get(), mNetifName));
+
+exit:
+    if (dbus_error_is_set(&dbusError))
+    {
+        otbrLogErr("Failed to connect to the D-Bus system bus: %s", dbusError.message);
+        dbus_error_free(&dbusError);
+    }
+    return error;
+}
+
+DBusBackend::ClientError DBusBackend::WaitForCompletion(Channel &aChannel, ClientError aError, const bool &aDone)
+{
+    // The handler of a sent request is always invoked, by a reply or by the D-Bus timeout, so dispatching until
+    // then never waits longer than the agent takes. Only a dropped connection ends the wait early.
+    VerifyOrExit(aError == ClientError::ERROR_NONE);
+
+    while (!aDone)
+    {
+        VerifyOrExit(dbus_connection_read_write_dispatch(aChannel.mConnection.get(), kDispatchTimeout),
+                     aError = ClientError::ERROR_DBUS);
+    }
+
+exit:
+    return aError;
+}
+
+DBusBackend::ClientError DBusBackend::GetEui64(uint64_t &aEui64)
+{
+    std::lock_guard<std::mutex> lock(mQueryChannel.mMutex);
+    ClientError                 error;
+    ClientError                 result = ClientError::ERROR_NONE;
+    bool                        done   = false;
+
+    SuccessOrExit(error = Connect(mQueryChannel));
+
+    error = mQueryChannel.mApi->GetPropertyAsync<uint64_t>(
+        OTBR_DBUS_PROPERTY_EUI64, [&](ClientError aError, const uint64_t &aValue) {
+            result = aError;
+            aEui64 = aValue;
+            done   = true;
+        });
+    SuccessOrExit(error = WaitForCompletion(mQueryChannel, error, done));
+    error = result;
+
+exit:
+    return error;
+}
+
+DBusBackend::ClientError DBusBackend::GetStatus(Status &aStatus)
+{
+    static const std::vector<std::string> kPropertyNames = {
+        OTBR_DBUS_PROPERTY_DEVICE_ROLE,
+        OTBR_DBUS_PROPERTY_OT_HOST_VERSION,
+        OTBR_DBUS_PROPERTY_OT_RCP_VERSION,
+        OTBR_DBUS_PROPERTY_EUI64,
+        OTBR_DBUS_PROPERTY_CHANNEL,
+        OTBR_DBUS_PROPERTY_RADIO_TX_POWER,
+        OTBR_DBUS_PROPERTY_NETWORK_NAME,
+        OTBR_DBUS_PROPERTY_EXTPANID,
+        OTBR_DBUS_PROPERTY_PANID,
+        OTBR_DBUS_PROPERTY_PARTITION_ID_PROEPRTY,
+        OTBR_DBUS_PROPERTY_ACTIVE_DATASET_TLVS,
+    };
+
+    std::lock_guard<std::mutex> lock(mQueryChannel.mMutex);
+    ClientError                 error;
+    ClientError                 result = ClientError::ERROR_NONE;
+    bool                        done   = false;
+    std::vector<uint8_t>        dataset;
+
+    SuccessOrExit(error = Connect(mQueryChannel));
+
+    error = mQueryChannel.mApi->GetPropertiesAsync(kPropertyNames, [&](ClientError aError, DBusMessageIter *aIter) {
+        result = aError;
+        done   = true;
+
+        if (result == ClientError::ERROR_NONE &&
+            !(ExtractNext(aIter, aStatus.mRole) && ExtractNext(aIter, aStatus.mHostVersion) &&
+              ExtractNext(aIter, aStatus.mRcpVersion) && ExtractNext(aIter, aStatus.mEui64) &&
+              ExtractNext(aIter, aStatus.mChannel) && ExtractNext(aIter, aStatus.mTxPower) &&
+              ExtractNext(aIter, aStatus.mNetworkName) && ExtractNext(aIter, aStatus.mExtPanId) &&
+              ExtractNext(aIter, aStatus.mPanId) && ExtractNext(aIter, aStatus.mPartitionId) &&
+              ExtractNext(aIter, dataset)))
+        {
+            result = ClientError::ERROR_DBUS;
+        }
+    });
+    SuccessOrExit(error = WaitForCompletion(mQueryChannel, error, done));
+    SuccessOrExit(error = result);
+
+    aStatus.mHasMeshLocalPrefix = false;
+
+    for (size_t offset = 0; offset + 2 <= dataset.size(); offset += 2 + dataset[offset + 1])
+    {
+        if (dataset[offset] == kMeshLocalPrefixTlvType && dataset[offset + 1] == aStatus.mMeshLocalPrefix.size() &&
+            offset + 2 + aStatus.mMeshLocalPrefix.size() <= dataset.size())
+        {
+            std::copy(&dataset[offset + 2], &dataset[offset + 2] + aStatus.mMeshLocalPrefix.size(),
+                      aStatus.mMeshLocalPrefix.begin());
+            aStatus.mHasMeshLocalPrefix = true;
+            break;
+        }
+    }
+
+exit:
+    return error;
+}
+
+DBusBackend::ClientError DBusBackend::Scan(std::vector<ActiveScanResult> &aResults)
+{
+    std::lock_guard<std::mutex> lock(mOperationChannel.mMutex);
+    ClientError                 error;
+    bool                        done = false;
+
+    SuccessOrExit(error = Connect(mOperationChannel));
+
+    error = mOperationChannel.mApi->Scan([&](const std::vector<ActiveScanResult> &aScanResults) {
+        aResults = aScanResults;
+        done     = true;
+    });
+    error = WaitForCompletion(mOperationChannel, error, done);
+
+exit:
+    return error;
+}
+
+DBusBackend::ClientError DBusBackend::FactoryReset(void)
+{
+    std::lock_guard<std::mutex> lock(mOperationChannel.mMutex);
+    ClientError                 error;
+    ClientError                 result = ClientError::ERROR_NONE;
+    bool                        done   = false;
+
+    SuccessOrExit(error = Connect(mOperationChannel));
+
+    error = mOperationChannel.mApi->FactoryReset([&](ClientError aError) {
+        result = aError;
+        done   = true;
+    });
+    SuccessOrExit(error = WaitForCompletion(mOperationChannel, error, done));
+    error = result;
+
+exit:
+    return error;
+}
+
+DBusBackend::ClientError DBusBackend::Form(const std::string          &aNetworkName,
+                                           uint16_t                    aPanId,
+                                           uint64_t                    aExtPanId,
+                                           const std::vector<uint8_t> &aNetworkKey,
+                                           const std::vector<uint8_t> &aPskc,
+                                           uint16_t                    aChannel)
+{
+    std::lock_guard<std::mutex> lock(mOperationChannel.mMutex);
+    ClientError                 error;
+    ClientError                 result = ClientError::ERROR_NONE;
+    bool                        done   = false;
+
+    VerifyOrExit(aChannel < 32, error = ClientError::OT_ERROR_INVALID_ARGS);
+    SuccessOrExit(error = Connect(mOperationChannel));
+
+    error = mOperationChannel.mApi->Attach(aNetworkName, aPanId, aExtPanId, aNetworkKey, aPskc, 1u << aChannel,
+                                           [&](ClientError aError) {
+                                               result = aError;
+                                               done   = true;
+                                           });
+    SuccessOrExit(error = WaitForCompletion(mOperationChannel, error, done));
+    error = result;
+
+exit:
+    return error;
+}
+
+DBusBackend::ClientError DBusBackend::Join(const std::vector<uint8_t> &aNetworkKey, uint16_t aChannel, uint16_t aPanId)
+{
+    std::lock_guard<std::mutex> lock(mOperationChannel.mMutex);
+    std::vector<uint8_t>        dataset;
+    ClientError                 error;
+    ClientError                 result = ClientError::ERROR_NONE;
+    bool                        done   = false;
+
+    VerifyOrExit(aNetworkKey.size() == kNetworkKeySize, error = ClientError::OT_ERROR_INVALID_ARGS);
+    SuccessOrExit(error = Connect(mOperationChannel));
+
+    // Same partial dataset as `dataset clear` followed by setting the network key, channel and PAN ID.
+    dataset.push_back(kChannelTlvType);
+    dataset.push_back(3);
+    dataset.push_back(0); // Channel page 0
+    dataset.push_back(static_cast<uint8_t>(aChannel >> 8));
+    dataset.push_back(static_cast<uint8_t>(aChannel & 0xff));
+    dataset.push_back(kPanIdTlvType);
+    dataset.push_back(2);
+    dataset.push_back(static_cast<uint8_t>(aPanId >> 8));
+    dataset.push_back(static_cast<uint8_t>(aPanId & 0xff));
+    dataset.push_back(kNetworkKeyTlvType);
+    dataset.push_back(kNetworkKeySize);
+    dataset.insert(dataset.end(), aNetworkKey.begin(), aNetworkKey.end());
+
+    SuccessOrExit(error = mOperationChannel.mApi->SetActiveDatasetTlvs(dataset));
+
+    error = mOperationChannel.mApi->Attach([&](ClientError aError) {
+        result = aError;
+        done   = true;
+    });
+    SuccessOrExit(error = WaitForCompletion(mOperationChannel, error, done));
+    error = result;
+
+exit:
+    return error;
+}
+
+DBusBackend::ClientError DBusBackend::JoinWithPskd(const std::string &aPskd)
+{
+    std::lock_guard<std::mutex> lock(mOperationChannel.mMutex);
+    ClientError                 error;
+    ClientError                 result = ClientError::ERROR_NONE;
+    bool                        done   = false;
+
+    SuccessOrExit(error = Connect(mOperationChannel));
+
+    error = mOperationChannel.mApi->JoinerStart(aPskd, "", "", "", "", "", [&](ClientError aError) {
+        result = aError;
+        done   = true;
+    });
+    SuccessOrExit(error = WaitForCompletion(mOperationChannel, error, done));
+    error = result;
+
+exit:
+    return error;
+}
+
+DBusBackend::ClientError DBusBackend::AddOnMeshPrefix(const std::string &aPrefix, bool aDefaultRoute)
+{
+    std::lock_guard<std::mutex> lock(mQueryChannel.mMutex);
+    otbr::DBus::OnMeshPrefix    onMeshPrefix = {};
+    ClientError                 error;
+
+    SuccessOrExit(error = ParsePrefix(aPrefix, onMeshPrefix.mPrefix));
+    SuccessOrExit(error = Connect(mQueryChannel));
+
+    // Same flags as the CLI `paso` and `paros`.
+    onMeshPrefix.mPreferred    = true;
+    onMeshPrefix.mSlaac        = true;
+    onMeshPrefix.mDefaultRoute = aDefaultRoute;
+    onMeshPrefix.mOnMesh       = true;
+    onMeshPrefix.mStable       = true;
+
+    error = mQueryChannel.mApi->AddOnMeshPrefix(onMeshPrefix);
+
+exit:
+    return error;
+}
+
+DBusBackend::ClientError DBusBackend::RemoveOnMeshPrefix(const std::string &aPrefix)
+{
+    std::lock_guard<std::mutex> lock(mQueryChannel.mMutex);
+    otbr::DBus::Ip6Prefix       prefix;
+    ClientError                 error;
+
+    SuccessOrExit(error = ParsePrefix(aPrefix, prefix));
+    SuccessOrExit(error = Connect(mQueryChannel));
+
+    error = mQueryChannel.mApi->RemoveOnMeshPrefix(prefix);
+
+exit:
+    return error;
+}
+
+DBusBackend::ClientError DBusBackend::ParsePrefix(const std::string &aPrefix, otbr::DBus::Ip6Prefix &aIp6Prefix)
+{
+    ClientError   error = ClientError::ERROR_NONE;
+    size_t        slash = aPrefix.find('/');
+    unsigned long length;
+    char         *end;
+    uint8_t       address[16];
+
+    VerifyOrExit(slash != std::string::npos, error = ClientError::OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(inet_pton(AF_INET6, aPrefix.substr(0, slash).c_str(), address) == 1,
+                 error = ClientError::OT_ERROR_INVALID_ARGS);
+
+    length = strtoul(aPrefix.c_str() + slash + 1, &end, 10);
+    VerifyOrExit(*end == '\0' && length > 0 && length <= OTBR_IP6_PREFIX_SIZE * 8,
+                 error = ClientError::OT_ERROR_INVALID_ARGS);
+
+    aIp6Prefix.mPrefix.assign(address, address + OTBR_IP6_PREFIX_SIZE);
+    aIp6Prefix.mLength = static_cast<uint8_t>(length);
+
+exit:
+    return error;
+}
+
+} // namespace Web
+} // namespace otbr
+
+#endif // OTBR_ENABLE_DBUS_SERVER
@@ -0,0 +1,239 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions for the D-Bus backend of the web service.
+ */
+
+#ifndef OTBR_WEB_WEB_SERVICE_DBUS_BACKEND_HPP_
+#define OTBR_WEB_WEB_SERVICE_DBUS_BACKEND_HPP_
+
+#include "openthread-br/config.h"
+
+#if OTBR_ENABLE_DBUS_SERVER
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+#include <dbus/dbus.h>
+
+#include "dbus/client/thread_api_dbus.hpp"
+
+namespace otbr {
+namespace Web {
+
+/**
+ * This class implements typed access to the border agent through its D-Bus API.
+ *
+ * Every operation sends an asynchronous D-Bus request and dispatches the connection until the agent replies, so an
+ * operation completes as soon as the agent reports its result instead of after a fixed delay.
+ *
+ * Queries which the agent answers right away and operations which last until the Thread network changes, i.e. scan,
+ * factory reset, form and join, use separate connections, so a slow operation doesn't stall status polling from other
+ * threads.
+ */
+class DBusBackend
+{
+public:
+    using ClientError      = otbr::DBus::ClientError;
+    using ActiveScanResult = otbr::DBus::ActiveScanResult;
+
+    /**
+     * This structure represents the status of the Thread interface.
+     */
+    struct Status
+    {
+        std::string            mRole;               ///< The device role name.
+        std::string            mHostVersion;        ///< The OpenThread host version.
+        std::string            mRcpVersion;         ///< The RCP version.
+        uint64_t               mEui64;              ///< The IEEE EUI-64.
+        uint16_t               mChannel;            ///< The IEEE 802.15.4 channel.
+        int8_t                 mTxPower;            ///< The radio transmit power, in dBm.
+        std::string            mNetworkName;        ///< The Thread network name.
+        uint64_t               mExtPanId;           ///< The extended PAN ID.
+        uint16_t               mPanId;              ///< The PAN ID.
+        uint32_t               mPartitionId;        ///< The partition ID.
+        bool                   mHasMeshLocalPrefix; ///< Whether the active dataset has a Mesh Local Prefix.
+        std::array<uint8_t, 8> mMeshLocalPrefix;    ///< The Mesh Local Prefix.
+    };
+
+    /**
+     * This constructor creates a D-Bus backend.
+     *
+     * @param[in] aNetifName  The Thread network interface name, must outlive the backend.
+     */
+    explicit DBusBackend(const char *aNetifName);
+
+    /**
+     * This method closes the D-Bus connection, e.g. after the Thread network interface name changes.
+     */
+    void Reset(void);
+
+    /**
+     * This method reads the IEEE EUI-64.
+     *
+     * @param[out] aEui64  The IEEE EUI-64.
+     *
+     * @returns The D-Bus client error.
+     */
+    ClientError GetEui64(uint64_t &aEui64);
+
+    /**
+     * This method reads the status of the Thread interface in one round trip.
+     *
+     * @param[out] aStatus  The status.
+     *
+     * @returns The D-Bus client error.
+     */
+    ClientError GetStatus(Status &aStatus);
+
+    /**
+     * This method performs a Thread network scan.
+     *
+     * @param[out] aResults  The scan results.
+     *
+     * @returns The D-Bus client error.
+     */
+    ClientError Scan(std::vector<ActiveScanResult> &aResults);
+
+    /**
+     * This method performs a factory reset and waits until the agent is ready again.
+     *
+     * @returns The D-Bus client error.
+     */
+    ClientError FactoryReset(void);
+
+    /**
+     * This method forms a new Thread network and waits until the device is attached.
+     *
+     * @param[in] aNetworkName  The network name.
+     * @param[in] aPanId        The PAN ID.
+     * @param[in] aExtPanId     The extended PAN ID.
+     * @param[in] aNetworkKey   The network key.
+     * @param[in] aPskc         The PSKc.
+     * @param[in] aChannel      The channel.
+     *
+     * @returns The D-Bus client error.
+     */
+    ClientError Form(const std::string          &aNetworkName,
+                     uint16_t                    aPanId,
+                     uint64_t                    aExtPanId,
+                     const std::vector<uint8_t> &aNetworkKey,
+                     const std::vector<uint8_t> &aPskc,
+                     uint16_t                    aChannel);
+
+    /**
+     * This method joins a Thread network with a known network key and waits until the device is attached.
+     *
+     * @param[in] aNetworkKey  The network key.
+     * @param[in] aChannel     The channel.
+     * @param[in] aPanId       The PAN ID.
+     *
+     * @returns The D-Bus client error.
+     */
+    ClientError Join(const std::vector<uint8_t> &aNetworkKey, uint16_t aChannel, uint16_t aPanId);
+
+    /**
+     * This method joins a Thread network through the joiner and waits until the joiner finishes.
+     *
+     * @param[in] aPskd  The joiner PSKd.
+     *
+     * @retval ERROR_NONE          Successfully joined, the agent starts the Thread network afterwards.
+     * @retval OT_ERROR_NOT_FOUND  No joinable network was found.
+     * @retval OT_ERROR_SECURITY   The PSKd was rejected.
+     * @retval ...                 Other D-Bus client errors.
+     */
+    ClientError JoinWithPskd(const std::string &aPskd);
+
+    /**
+     * This method adds an on-mesh prefix and registers it to the leader.
+     *
+     * @param[in] aPrefix        The prefix in the form of "address/length".
+     * @param[in] aDefaultRoute  Whether the border router is a default route for the prefix.
+     *
+     * @returns The D-Bus client error.
+     */
+    ClientError AddOnMeshPrefix(const std::string &aPrefix, bool aDefaultRoute);
+
+    /**
+     * This method removes an on-mesh prefix and registers the change to the leader.
+     *
+     * @param[in] aPrefix  The prefix in the form of "address/length".
+     *
+     * @returns The D-Bus client error.
+     */
+    ClientError RemoveOnMeshPrefix(const std::string &aPrefix);
+
+private:
+    struct DBusConnectionDeleter
+    {
+        void operator()(DBusConnection *aConnection)
+        {
+            // A private connection must be closed before its last reference is dropped.
+            dbus_connection_close(aConnection);
+            dbus_connection_unref(aConnection);
+        }
+    };
+
+    using UniqueDBusConnection = std::unique_ptr<DBusConnection, DBusConnectionDeleter>;
+
+    // A D-Bus connection to the agent, the requests on one connection are serialized by `mMutex`.
+    struct Channel
+    {
+        std::mutex                                 mMutex;
+        UniqueDBusConnection                       mConnection;
+        std::unique_ptr<otbr::DBus::ThreadApiDBus> mApi;
+    };
+
+    ClientError        Connect(Channel &aChannel);
+    static void        Reset(Channel &aChannel);
+    static ClientError WaitForCompletion(Channel &aChannel, ClientError aError, const bool &aDone);
+    static ClientError ParsePrefix(const std::string &aPrefix, otbr::DBus::Ip6Prefix &aIp6Prefix);
+
+    enum
+    {
+        kDispatchTimeout = 1000, ///< Maximum time(ms) to block in one dispatch of the connection.
+    };
+
+    const char *mNetifName;
+    Channel     mQueryChannel;     ///< For the requests the agent answers right away.
+    Channel     mOperationChannel; ///< For scan, factory reset, form and join.
+};
+
+} // namespace Web
+} // namespace otbr
+
+#endif // OTBR_ENABLE_DBUS_SERVER
+
+#endif // OTBR_WEB_WEB_SERVICE_DBUS_BACKEND_HPP_
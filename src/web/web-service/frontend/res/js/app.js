@@ -33,6 +33,7 @@
         .service('sharedProperties', function() {
             var index = 0;
             var networkInfo;
+            var scanId;
 
             return {
                 getIndex: function() {
@@ -47,6 +48,12 @@
                 setNetworkInfo: function(value) {
                     networkInfo = value
                 },
+                getScanId: function() {
+                    return scanId;
+                },
+                setScanId: function(value) {
+                    scanId = value;
+                },
             };
         });
 
@@ -122,6 +129,23 @@
                 .ok('Okay')
             );
         };
+        // The server scans in the background and reports `scanning` until fresh results are available.
+        $scope.getAvailableNetworks = function() {
+            $http.get('available_network').then(function(response) {
+                if (response.data.error == 0) {
+                    $scope.networksInfo = response.data.result;
+                    sharedProperties.setScanId(response.data.scanId);
+                }
+                if (response.data.scanning) {
+                    $interval($scope.getAvailableNetworks, 1000, 1);
+                    return;
+                }
+                $scope.isLoading = false;
+                if (response.data.error != 0) {
+                    $scope.showScanAlert(event);
+                }
+            });
+        };
         $scope.showPanels = function(index) {
             $scope.headerTitle = $scope.menu[index].title;
             for (var i = 0; i < 7; i++) {
@@ -130,14 +154,7 @@
             $scope.menu[index].show = true;
             if (index == 1) {
                 $scope.isLoading = true;
-                $http.get('available_network').then(function(response) {
-                    $scope.isLoading = false;
-                    if (response.data.error == 0) {
-                        $scope.networksInfo = response.data.result;
-                    } else {
-                        $scope.showScanAlert(event);
-                    }
-                });
+                $scope.getAvailableNetworks();
             }
             if (index == 3) {
                 $http.get('get_properties').then(function(response) {
@@ -254,6 +271,7 @@
                     prefix: $scope.thread.prefix,
                     defaultRoute: $scope.thread.defaultRoute,
                     index: index,
+                    scanId: sharedProperties.getScanId(),
                 };
                 var httpRequest = $http({
                     method: 'POST',
@@ -34,6 +34,7 @@
 
 #include <errno.h>
 #include <inttypes.h>
+#include <poll.h>
 #include <signal.h>
 #include <stdarg.h>
 #include <stdio.h>
@@ -87,6 +88,8 @@ bool OpenThreadClient::Connect(void)
     struct sockaddr_un sockname;
     int                ret;
 
+    Disconnect();
+
     mSocket = socket(AF_UNIX, SOCK_STREAM, 0);
     VerifyOrExit(mSocket != -1, perror("socket"); ret = EXIT_FAILURE);
 
@@ -110,6 +113,33 @@ exit:
     return ret == 0;
 }
 
+bool OpenThreadClient::IsConnected(void) const
+{
+    struct pollfd pollFd;
+    char          byte;
+    bool          rval = false;
+
+    VerifyOrExit(mSocket != -1);
+
+    pollFd.fd      = mSocket;
+    pollFd.events  = POLLIN;
+    pollFd.revents = 0;
+
+    VerifyOrExit(poll(&pollFd, 1, 0) != -1);
+    VerifyOrExit((pollFd.revents & (POLLERR | POLLHUP | POLLNVAL)) == 0);
+
+    if (pollFd.revents & POLLIN)
+    {
+        // Pending output is discarded before the next command, only an end-of-stream means the daemon is gone.
+        VerifyOrExit(recv(mSocket, &byte, sizeof(byte), MSG_PEEK | MSG_DONTWAIT) > 0);
+    }
+
+    rval = true;
+
+exit:
+    return rval;
+}
+
 void OpenThreadClient::DiscardRead(void)
 {
     fd_set  readFdSet;
@@ -165,12 +195,18 @@ char *OpenThreadClient::Execute(const char *aFormat, ...)
     mBuffer[ret + 1] = '\n';
     ret += 2;
 
+#ifdef MSG_NOSIGNAL
+    // The connection is persistent, a daemon restart must not raise SIGPIPE here.
+    count = send(mSocket, mBuffer, ret, MSG_NOSIGNAL);
+#else
     count = write(mSocket, mBuffer, ret);
+#endif
 
     if (count != ret)
     {
         mBuffer[ret] = '\0';
         otbrLogErr("Failed to send command: %s", mBuffer);
+        Disconnect();
         ExitNow();
     }
 
@@ -191,7 +227,7 @@ char *OpenThreadClient::Execute(const char *aFormat, ...)
         }
 
         count = read(mSocket, &mBuffer[rxLength], sizeof(mBuffer) - rxLength);
-        VerifyOrExit(count > 0);
+        VerifyOrExit(count > 0, Disconnect());
         rxLength += count;
 
         mBuffer[rxLength] = '\0';
@@ -224,7 +260,7 @@ char *OpenThreadClient::Read(const char *aResponse, int aTimeout)
     for (int i = 0; i < aTimeout; ++i)
     {
         count = read(mSocket, &mBuffer[rxLength], sizeof(mBuffer) - rxLength);
-        VerifyOrExit(count > 0);
+        VerifyOrExit(count > 0, Disconnect());
         rxLength += count;
 
         mBuffer[rxLength] = '\0';
@@ -286,9 +322,8 @@ int OpenThreadClient::Scan(WpanNetworkInfo *aNetworks, int aLength)
         ++rval;
     }
 
-    mTimeout = kDefaultTimeout;
-
 exit:
+    mTimeout = kDefaultTimeout;
     return rval;
 }
 
@@ -318,5 +353,84 @@ exit:
     return rval;
 }
 
+static thread_local Microseconds sSessionWaitTime{0};
+
+OpenThreadClientPool::OpenThreadClientPool(const char *aNetifName)
+    : mNetifName(aNetifName)
+{
+}
+
+std::unique_lock<std::mutex> OpenThreadClientPool::LockSession(void)
+{
+    Timepoint                    start = Clock::now();
+    std::unique_lock<std::mutex> lock(mSessionMutex);
+
+    sSessionWaitTime += std::chrono::duration_cast<Microseconds>(Clock::now() - start);
+
+    return lock;
+}
+
+Microseconds OpenThreadClientPool::TakeSessionWaitTime(void)
+{
+    Microseconds waitTime = sSessionWaitTime;
+
+    sSessionWaitTime = Microseconds::zero();
+
+    return waitTime;
+}
+
+std::unique_ptr<OpenThreadClient> OpenThreadClientPool::Acquire(void)
+{
+    std::unique_ptr<OpenThreadClient> client;
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        while (!mIdleClients.empty())
+        {
+            client = std::move(mIdleClients.back());
+            mIdleClients.pop_back();
+
+            if (client->IsConnected())
+            {
+                ExitNow();
+            }
+
+            otbrLogInfo("Dropped stale connection to OpenThread daemon");
+            client.reset();
+        }
+    }
+
+    client.reset(new OpenThreadClient(mNetifName));
+
+    if (!client->Connect())
+    {
+        client.reset();
+    }
+
+exit:
+    return client;
+}
+
+void OpenThreadClientPool::Release(std::unique_ptr<OpenThreadClient> aClient)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    VerifyOrExit(aClient != nullptr && aClient->IsConnected());
+    VerifyOrExit(mIdleClients.size() < kMaxIdleClients);
+
+    mIdleClients.push_back(std::move(aClient));
+
+exit:
+    return;
+}
+
+void OpenThreadClientPool::Clear(void)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    mIdleClients.clear();
+}
+
 } // namespace Web
 } // namespace otbr
@@ -36,8 +36,14 @@
 
 #include "openthread-br/config.h"
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include <stdint.h>
 
+#include "common/time.hpp"
+
 namespace otbr {
 namespace Web {
 
@@ -86,6 +92,16 @@ public:
      */
     bool Connect(void);
 
+    /**
+     * This method checks whether the connection to OpenThread daemon is still usable.
+     *
+     * The check does not send any command, it only detects a socket that was closed or reset by the daemon.
+     *
+     * @retval TRUE   The client is connected and the connection is healthy.
+     * @retval FALSE  The client is not connected or the daemon has closed the connection.
+     */
+    bool IsConnected(void) const;
+
     /**
      * This method executes OpenThread CLI.
      *
@@ -137,6 +153,110 @@ private:
     int         mSocket;
 };
 
+/**
+ * This class implements a pool of persistent connections to OpenThread daemon.
+ *
+ * Connections are health-checked before being handed out again, and a stale connection is transparently
+ * replaced by a new one.
+ */
+class OpenThreadClientPool
+{
+public:
+    /**
+     * This class holds a client acquired from the pool and returns it to the pool when destroyed.
+     *
+     * OpenThread daemon serves one CLI session at a time, so leases are exclusive: a lease blocks until the previous
+     * one is released.
+     */
+    class Lease
+    {
+    public:
+        /**
+         * This constructor acquires a connected client from @p aPool.
+         *
+         * @param[in] aPool  A reference to the client pool.
+         */
+        explicit Lease(OpenThreadClientPool &aPool)
+            : mPool(aPool)
+            , mSessionLock(aPool.LockSession())
+            , mClient(aPool.Acquire())
+        {
+        }
+
+        /**
+         * This destructor returns the client to the pool.
+         */
+        ~Lease(void) { mPool.Release(std::move(mClient)); }
+
+        /**
+         * This method indicates whether a connected client was acquired.
+         *
+         * @retval TRUE   A connected client is held by this lease.
+         * @retval FALSE  Failed to connect to OpenThread daemon.
+         */
+        bool IsValid(void) const { return mClient != nullptr; }
+
+        OpenThreadClient *operator->(void) const { return mClient.get(); }
+        OpenThreadClient &operator*(void) const { return *mClient; }
+
+        Lease(const Lease &)            = delete;
+        Lease &operator=(const Lease &) = delete;
+
+    private:
+        OpenThreadClientPool             &mPool;
+        std::unique_lock<std::mutex>      mSessionLock;
+        std::unique_ptr<OpenThreadClient> mClient;
+    };
+
+    /**
+     * This constructor creates an OpenThread client pool.
+     *
+     * @param[in] aNetifName  The Thread network interface name, must outlive the pool.
+     */
+    explicit OpenThreadClientPool(const char *aNetifName);
+
+    /**
+     * This method acquires a connected client, reusing an idle connection when it is still healthy.
+     *
+     * @returns The connected client, or nullptr if failed to connect to OpenThread daemon.
+     */
+    std::unique_ptr<OpenThreadClient> Acquire(void);
+
+    /**
+     * This method returns a client to the pool.
+     *
+     * The client is kept for reuse only if it is still connected and the pool is not full.
+     *
+     * @param[in] aClient  The client to return, may be nullptr.
+     */
+    void Release(std::unique_ptr<OpenThreadClient> aClient);
+
+    /**
+     * This method closes all idle connections, e.g. after the Thread network interface name changes.
+     */
+    void Clear(void);
+
+    /**
+     * This method returns and resets the time the calling thread has spent waiting for CLI sessions.
+     *
+     * @returns The time waited for leases on the calling thread since the previous call.
+     */
+    static Microseconds TakeSessionWaitTime(void);
+
+private:
+    enum
+    {
+        kMaxIdleClients = 2, ///< Maximum number of idle connections kept open.
+    };
+
+    std::unique_lock<std::mutex> LockSession(void);
+
+    const char                                    *mNetifName;
+    std::mutex                                     mMutex;
+    std::mutex                                     mSessionMutex;
+    std::vector<std::unique_ptr<OpenThreadClient>> mIdleClients;
+};
+
 } // namespace Web
 } // namespace otbr
 
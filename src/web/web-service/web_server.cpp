@@ -41,6 +41,10 @@
 
 #include <server_http.hpp>
 
+#include <sstream>
+
+#include <stdlib.h>
+
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 
@@ -53,6 +57,7 @@
 #define OT_GET_QRCODE_PATH "^/get_qrcode$"
 #define OT_SET_NETWORK_PATH "^/settings$"
 #define OT_COMMISSIONER_START_PATH "^/commission$"
+#define OT_GET_STATISTICS_PATH "^/statistics$"
 #define OT_REQUEST_METHOD_GET "GET"
 #define OT_REQUEST_METHOD_POST "POST"
 #define OT_RESPONSE_SUCCESS_STATUS "HTTP/1.1 200 OK\r\n"
@@ -62,6 +67,7 @@
 #define OT_RESPONSE_HEADER_TYPE "Content-Type: application/json\r\n charset=utf-8"
 #define OT_RESPONSE_PLACEHOLD "\r\n\r\n"
 #define OT_RESPONSE_FAILURE_STATUS "HTTP/1.1 400 Bad Request\r\n"
+#define OT_RESPONSE_NOT_MODIFIED_STATUS "HTTP/1.1 304 Not Modified\r\n"
 #define OT_BUFFER_SIZE 1024
 
 namespace otbr {
@@ -100,13 +106,73 @@ static void EscapeHtml(std::string &content)
     output.swap(content);
 }
 
+static bool SendHttpResponse(HttpServer::Response &aResponse, const std::function<std::string(void)> &aHandler)
+{
+    bool succeeded = true;
+
+    try
+    {
+        std::string httpResponse = aHandler();
+
+        aResponse << OT_RESPONSE_SUCCESS_STATUS << OT_RESPONSE_HEADER_LENGTH << httpResponse.length()
+                  << OT_RESPONSE_PLACEHOLD << httpResponse;
+    } catch (std::exception &e)
+    {
+        std::string content = e.what();
+        EscapeHtml(content);
+        aResponse << OT_RESPONSE_FAILURE_STATUS << OT_RESPONSE_HEADER_LENGTH << content.length()
+                  << OT_RESPONSE_PLACEHOLD << content;
+        succeeded = false;
+    }
+
+    return succeeded;
+}
+
+static std::string GetEndpointName(const char *aUrl)
+{
+    std::string name = aUrl;
+
+    // Strips the regular expression anchors of the resource path.
+    name.erase(std::remove(name.begin(), name.end(), '^'), name.end());
+    name.erase(std::remove(name.begin(), name.end(), '$'), name.end());
+
+    return name;
+}
+
+static Json::Value HistogramToJson(const Histogram &aHistogram)
+{
+    Json::Value histogram;
+    Json::Value bounds(Json::arrayValue);
+    Json::Value counts(Json::arrayValue);
+
+    for (uint8_t i = 0; i < Histogram::kNumBuckets - 1; i++)
+    {
+        bounds.append(aHistogram.GetUpperBound(i));
+    }
+
+    for (uint8_t i = 0; i < Histogram::kNumBuckets; i++)
+    {
+        counts.append(aHistogram.GetBucketCount(i));
+    }
+
+    histogram["count"]       = static_cast<Json::UInt64>(aHistogram.GetCount());
+    histogram["sum"]         = static_cast<Json::UInt64>(aHistogram.GetSum());
+    histogram["max"]         = aHistogram.GetMax();
+    histogram["upperBounds"] = bounds;
+    histogram["counts"]      = counts;
+
+    return histogram;
+}
+
 WebServer::WebServer(void)
     : mServer(new HttpServer())
+    , mOperationWorkerStopping(false)
 {
 }
 
 WebServer::~WebServer(void)
 {
+    StopOperationWorker();
     delete mServer;
 }
 
@@ -120,13 +186,14 @@ void WebServer::Init()
     }
 }
 
-void WebServer::StartWebServer(const char *aIfName, const char *aListenAddr, uint16_t aPort)
+void WebServer::StartWebServer(const char *aIfName, const char *aListenAddr, uint16_t aPort, size_t aThreadCount)
 {
     if (aListenAddr != nullptr)
     {
         mServer->config.address = aListenAddr;
     }
-    mServer->config.port = aPort;
+    mServer->config.port             = aPort;
+    mServer->config.thread_pool_size = std::max<size_t>(aThreadCount, 1);
     mWpanService.SetInterfaceName(aIfName);
     Init();
     ResponseGetQRCode();
@@ -137,7 +204,10 @@ void WebServer::StartWebServer(const char *aIfName, const char *aListenAddr, uin
     ResponseGetStatus();
     ResponseGetAvailableNetwork();
     ResponseCommission();
+    ResponseGetStatistics();
+    mAssetCache.Load(WEB_FILE_PATH);
     DefaultHttpResponse();
+    StartOperationWorker();
 
     try
     {
@@ -147,6 +217,8 @@ void WebServer::StartWebServer(const char *aIfName, const char *aListenAddr, uin
         otbrLogCrit("failed to start web server: %s", e.what());
         abort();
     }
+
+    StopOperationWorker();
 }
 
 void WebServer::StopWebServer(void)
@@ -162,35 +234,145 @@ void WebServer::StopWebServer(void)
 
 void WebServer::HandleHttpRequest(const char *aUrl, const char *aMethod, HttpRequestCallback aCallback)
 {
-    mServer->resource[aUrl][aMethod] = [aCallback, this](std::shared_ptr<HttpServer::Response> response,
-                                                         std::shared_ptr<HttpServer::Request>  request) {
-        try
-        {
-            std::string httpResponse;
-            if (aCallback != nullptr)
-            {
-                httpResponse = aCallback(request->content.string(), this);
-            }
+    std::string endpoint = GetEndpointName(aUrl);
+
+    mServer->resource[aUrl][aMethod] = [aCallback, endpoint, this](std::shared_ptr<HttpServer::Response> response,
+                                                                   std::shared_ptr<HttpServer::Request>  request) {
+        Timepoint receiveTime = Clock::now();
+        bool      succeeded;
+
+        OpenThreadClientPool::TakeSessionWaitTime();
+        succeeded = SendHttpResponse(*response, [aCallback, request, this]() {
+            return aCallback != nullptr ? aCallback(request->content.string(), this) : std::string();
+        });
+        RecordRequest(endpoint, receiveTime, Microseconds::zero(), succeeded);
+    };
+}
+
+void WebServer::HandleHttpRequestAsync(const char *aUrl, const char *aMethod, HttpRequestCallback aCallback)
+{
+    std::string endpoint = GetEndpointName(aUrl);
+
+    mServer->resource[aUrl][aMethod] = [aCallback, endpoint, this](std::shared_ptr<HttpServer::Response> response,
+                                                                   std::shared_ptr<HttpServer::Request>  request) {
+        Timepoint   receiveTime = Clock::now();
+        std::string content     = request->content.string();
+
+        // The response is sent once the operation completes and releases the last reference to it.
+        PostOperation([aCallback, endpoint, response, content, receiveTime, this]() {
+            Microseconds queueTime = std::chrono::duration_cast<Microseconds>(Clock::now() - receiveTime);
+            bool         succeeded;
+
+            OpenThreadClientPool::TakeSessionWaitTime();
+            succeeded = SendHttpResponse(*response, [aCallback, &content, this]() {
+                return aCallback != nullptr ? aCallback(content, this) : std::string();
+            });
+            RecordRequest(endpoint, receiveTime, queueTime, succeeded);
+        });
+    };
+}
+
+void WebServer::RecordRequest(const std::string &aEndpoint,
+                              Timepoint          aReceiveTime,
+                              Microseconds       aQueueTime,
+                              bool               aSucceeded)
+{
+    Microseconds latency         = std::chrono::duration_cast<Microseconds>(Clock::now() - aReceiveTime);
+    Microseconds sessionWaitTime = OpenThreadClientPool::TakeSessionWaitTime();
+
+    {
+        std::lock_guard<std::mutex> lock(mStatsMutex);
+        EndpointStats              &stats = mEndpointStats[aEndpoint];
+
+        stats.mRequestCount++;
+        stats.mFailureCount += aSucceeded ? 0 : 1;
+        stats.mLatency.Record(latency);
+        stats.mQueueTime.Record(aQueueTime);
+        stats.mSessionWaitTime.Record(sessionWaitTime);
+    }
+
+    if (latency >= Milliseconds(kSlowRequestThreshold))
+    {
+        otbrLogWarning("Request %s took %lld ms, queued %lld ms, waited %lld ms for OpenThread daemon",
+                       aEndpoint.c_str(), static_cast<long long>(latency.count() / 1000),
+                       static_cast<long long>(aQueueTime.count() / 1000),
+                       static_cast<long long>(sessionWaitTime.count() / 1000));
+    }
+}
+
+void WebServer::StartOperationWorker(void)
+{
+    std::lock_guard<std::mutex> lock(mOperationMutex);
+
+    VerifyOrExit(!mOperationWorker.joinable());
+
+    mOperationWorkerStopping = false;
+    mOperationWorker         = std::thread(&WebServer::RunOperations, this);
+
+exit:
+    return;
+}
+
+void WebServer::StopOperationWorker(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(mOperationMutex);
+
+        mOperationWorkerStopping = true;
+    }
+
+    mOperationCondition.notify_all();
+
+    if (mOperationWorker.joinable())
+    {
+        mOperationWorker.join();
+    }
+}
+
+void WebServer::PostOperation(std::function<void(void)> aOperation)
+{
+    {
+        std::lock_guard<std::mutex> lock(mOperationMutex);
+
+        mOperations.push_back(std::move(aOperation));
+    }
 
-            *response << OT_RESPONSE_SUCCESS_STATUS << OT_RESPONSE_HEADER_LENGTH << httpResponse.length()
-                      << OT_RESPONSE_PLACEHOLD << httpResponse;
-        } catch (std::exception &e)
+    mOperationCondition.notify_one();
+}
+
+void WebServer::RunOperations(void)
+{
+    std::unique_lock<std::mutex> lock(mOperationMutex);
+
+    while (!mOperationWorkerStopping)
+    {
+        std::function<void(void)> operation;
+
+        if (mOperations.empty())
         {
-            std::string content = e.what();
-            EscapeHtml(content);
-            *response << OT_RESPONSE_FAILURE_STATUS << OT_RESPONSE_HEADER_LENGTH << strlen(e.what())
-                      << OT_RESPONSE_PLACEHOLD << content;
+            mOperationCondition.wait(lock);
+            continue;
         }
-    };
+
+        operation = std::move(mOperations.front());
+        mOperations.pop_front();
+
+        lock.unlock();
+        operation();
+        operation = nullptr;
+        lock.lock();
+    }
+
+    // Pending responses are dropped along with their connections.
+    mOperations.clear();
 }
 
 void DefaultResourceSend(const HttpServer                            &aServer,
                          const std::shared_ptr<HttpServer::Response> &aResponse,
                          const std::shared_ptr<std::ifstream>        &aIfStream)
 {
-    static std::vector<char> buffer(OT_BUFFER_SIZE); // Safe when server is running on one thread
-
-    std::streamsize readLength;
+    std::vector<char> buffer(OT_BUFFER_SIZE);
+    std::streamsize   readLength;
 
     if ((readLength = aIfStream->read(&buffer[0], buffer.size()).gcount()) > 0)
     {
@@ -211,12 +393,98 @@ void DefaultResourceSend(const HttpServer                            &aServer,
     }
 }
 
+static bool AcceptsEncoding(const HttpServer::Request &aRequest, const char *aEncoding)
+{
+    auto              field = aRequest.header.find("Accept-Encoding");
+    std::stringstream codings;
+    std::string       coding;
+    bool              accepted = false;
+
+    VerifyOrExit(field != aRequest.header.end());
+
+    codings.str(field->second);
+    while (std::getline(codings, coding, ','))
+    {
+        size_t      begin = coding.find_first_not_of(' ');
+        size_t      end   = coding.find_first_of(" ;", begin);
+        std::string name  = (begin == std::string::npos) ? "" : coding.substr(begin, end - begin);
+
+        if (name == aEncoding)
+        {
+            size_t quality = coding.find("q=", end);
+
+            // A zero quality value explicitly refuses the coding.
+            accepted = (quality == std::string::npos) || (atof(coding.c_str() + quality + 2) > 0);
+            break;
+        }
+    }
+
+exit:
+    return accepted;
+}
+
+static bool IsNotModified(const HttpServer::Request &aRequest, const AssetCache::Asset &aAsset)
+{
+    auto ifNoneMatch     = aRequest.header.find("If-None-Match");
+    auto ifModifiedSince = aRequest.header.find("If-Modified-Since");
+
+    // If-None-Match takes precedence over If-Modified-Since (RFC 7232, section 6).
+    return (ifNoneMatch != aRequest.header.end()) ? (ifNoneMatch->second.find(aAsset.mEtag) != std::string::npos)
+                                                  : (ifModifiedSince != aRequest.header.end() &&
+                                                     ifModifiedSince->second == aAsset.mLastModified);
+}
+
+static void SendCachedAsset(HttpServer::Response    &aResponse,
+                            const HttpServer::Request &aRequest,
+                            const AssetCache::Asset   &aAsset)
+{
+    const std::string *content     = &aAsset.mContent;
+    const char        *encoding    = nullptr;
+    bool               notModified = IsNotModified(aRequest, aAsset);
+
+    aResponse << (notModified ? OT_RESPONSE_NOT_MODIFIED_STATUS : OT_RESPONSE_SUCCESS_STATUS)
+              << "Cache-Control: " << aAsset.mCacheControl << "\r\nETag: " << aAsset.mEtag
+              << "\r\nLast-Modified: " << aAsset.mLastModified << "\r\nVary: Accept-Encoding\r\n";
+    VerifyOrExit(!notModified, aResponse << OT_RESPONSE_HEADER_LENGTH << 0 << OT_RESPONSE_PLACEHOLD);
+
+    if (!aAsset.mBrotliContent.empty() && AcceptsEncoding(aRequest, "br"))
+    {
+        content  = &aAsset.mBrotliContent;
+        encoding = "br";
+    }
+    else if (!aAsset.mGzipContent.empty() && AcceptsEncoding(aRequest, "gzip"))
+    {
+        content  = &aAsset.mGzipContent;
+        encoding = "gzip";
+    }
+
+    if (encoding != nullptr)
+    {
+        aResponse << "Content-Encoding: " << encoding << "\r\n";
+    }
+
+    aResponse << "Content-Type: " << aAsset.mContentType << "\r\n"
+              << OT_RESPONSE_HEADER_LENGTH << content->size() << OT_RESPONSE_PLACEHOLD;
+    aResponse.write(content->data(), content->size());
+
+exit:
+    return;
+}
+
 void WebServer::DefaultHttpResponse(void)
 {
     mServer->default_resource[OT_REQUEST_METHOD_GET] = [this](std::shared_ptr<HttpServer::Response> response,
                                                               std::shared_ptr<HttpServer::Request>  request) {
         try
         {
+            const AssetCache::Asset *asset = mAssetCache.Find(request->path);
+
+            if (asset != nullptr)
+            {
+                SendCachedAsset(*response, *request, *asset);
+                return;
+            }
+
             auto webRootPath = boost::filesystem::canonical(WEB_FILE_PATH);
             auto path        = boost::filesystem::canonical(webRootPath / request->path);
 
@@ -332,9 +600,16 @@ std::string WebServer::HandleCommission(const std::string &aCommissionRequest, v
     return webServer->HandleCommission(aCommissionRequest);
 }
 
+std::string WebServer::HandleGetStatisticsRequest(const std::string &aGetStatisticsRequest, void *aUserData)
+{
+    WebServer *webServer = static_cast<WebServer *>(aUserData);
+
+    return webServer->HandleGetStatisticsRequest(aGetStatisticsRequest);
+}
+
 void WebServer::ResponseJoinNetwork(void)
 {
-    HandleHttpRequest(OT_JOIN_NETWORK_PATH, OT_REQUEST_METHOD_POST, HandleJoinNetworkRequest);
+    HandleHttpRequestAsync(OT_JOIN_NETWORK_PATH, OT_REQUEST_METHOD_POST, HandleJoinNetworkRequest);
 }
 
 void WebServer::ResponseGetQRCode(void)
@@ -344,7 +619,7 @@ void WebServer::ResponseGetQRCode(void)
 
 void WebServer::ResponseFormNetwork(void)
 {
-    HandleHttpRequest(OT_FORM_NETWORK_PATH, OT_REQUEST_METHOD_POST, HandleFormNetworkRequest);
+    HandleHttpRequestAsync(OT_FORM_NETWORK_PATH, OT_REQUEST_METHOD_POST, HandleFormNetworkRequest);
 }
 
 void WebServer::ResponseAddOnMeshPrefix(void)
@@ -369,7 +644,12 @@ void WebServer::ResponseGetAvailableNetwork(void)
 
 void WebServer::ResponseCommission(void)
 {
-    HandleHttpRequest(OT_COMMISSIONER_START_PATH, OT_REQUEST_METHOD_POST, HandleCommission);
+    HandleHttpRequestAsync(OT_COMMISSIONER_START_PATH, OT_REQUEST_METHOD_POST, HandleCommission);
+}
+
+void WebServer::ResponseGetStatistics(void)
+{
+    HandleHttpRequest(OT_GET_STATISTICS_PATH, OT_REQUEST_METHOD_GET, HandleGetStatisticsRequest);
 }
 
 std::string WebServer::HandleJoinNetworkRequest(const std::string &aJoinRequest)
@@ -406,8 +686,18 @@ std::string WebServer::HandleGetStatusRequest(const std::string &aGetStatusReque
 
 std::string WebServer::HandleGetAvailableNetworkResponse(const std::string &aGetAvailableNetworkRequest)
 {
+    bool        startScan;
+    std::string response;
+
     OTBR_UNUSED_VARIABLE(aGetAvailableNetworkRequest);
-    return mWpanService.HandleAvailableNetworkRequest();
+
+    response = mWpanService.HandleAvailableNetworkRequest(startScan);
+    if (startScan)
+    {
+        PostOperation([this]() { mWpanService.ScanNetworks(); });
+    }
+
+    return response;
 }
 
 std::string WebServer::HandleCommission(const std::string &aCommissionRequest)
@@ -415,5 +705,34 @@ std::string WebServer::HandleCommission(const std::string &aCommissionRequest)
     return mWpanService.HandleCommission(aCommissionRequest);
 }
 
+std::string WebServer::HandleGetStatisticsRequest(const std::string &aGetStatisticsRequest)
+{
+    Json::Value      root;
+    Json::Value      endpoints(Json::objectValue);
+    Json::FastWriter jsonWriter;
+
+    OTBR_UNUSED_VARIABLE(aGetStatisticsRequest);
+
+    {
+        std::lock_guard<std::mutex> lock(mStatsMutex);
+
+        for (const auto &entry : mEndpointStats)
+        {
+            Json::Value endpoint;
+
+            endpoint["requests"]      = static_cast<Json::UInt64>(entry.second.mRequestCount);
+            endpoint["failures"]      = static_cast<Json::UInt64>(entry.second.mFailureCount);
+            endpoint["latencyUs"]     = HistogramToJson(entry.second.mLatency);
+            endpoint["queueTimeUs"]   = HistogramToJson(entry.second.mQueueTime);
+            endpoint["sessionWaitUs"] = HistogramToJson(entry.second.mSessionWaitTime);
+            endpoints[entry.first]    = endpoint;
+        }
+    }
+
+    root["endpoints"] = endpoints;
+
+    return jsonWriter.write(root);
+}
+
 } // namespace Web
 } // namespace otbr
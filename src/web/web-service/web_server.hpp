@@ -37,9 +37,15 @@
 #include "openthread-br/config.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <net/if.h>
@@ -47,6 +53,9 @@
 
 #include <boost/asio/ip/tcp.hpp>
 
+#include "common/mainloop_stats.hpp"
+#include "common/time.hpp"
+#include "web/web-service/asset_cache.hpp"
 #include "web/web-service/wpan_service.hpp"
 
 namespace SimpleWeb {
@@ -81,14 +90,22 @@ public:
      * @param[in] aIfName      The pointer to the Thread interface name.
      * @param[in] aListenAddr  The http server listen address, can be nullptr for any address.
      * @param[in] aPort        The port of http server.
+     * @param[in] aThreadCount The number of threads serving http requests.
      */
-    void StartWebServer(const char *aIfName, const char *aListenAddr, uint16_t aPort);
+    void StartWebServer(const char *aIfName, const char *aListenAddr, uint16_t aPort, size_t aThreadCount);
 
     /**
      * This method stops the Web Server.
      */
     void StopWebServer(void);
 
+    /**
+     * This method sets how long network scan results are reused before the networks are scanned again.
+     *
+     * @param[in] aInterval  The scan refresh interval.
+     */
+    void SetScanRefreshInterval(Seconds aInterval) { mWpanService.SetScanRefreshInterval(aInterval); }
+
 private:
     typedef std::string (*HttpRequestCallback)(const std::string &aRequest, void *aUserData);
     static std::string HandleJoinNetworkRequest(const std::string &aJoinRequest, void *aUserData);
@@ -100,6 +117,7 @@ private:
     static std::string HandleGetAvailableNetworkResponse(const std::string &aGetAvailableNetworkRequest,
                                                          void              *aUserData);
     static std::string HandleCommission(const std::string &aCommissionRequest, void *aUserData);
+    static std::string HandleGetStatisticsRequest(const std::string &aGetStatisticsRequest, void *aUserData);
 
     std::string HandleJoinNetworkRequest(const std::string &aJoinRequest);
     std::string HandleGetQRCodeRequest(const std::string &aGetQRCodeRequest);
@@ -109,8 +127,10 @@ private:
     std::string HandleGetStatusRequest(const std::string &aGetStatusRequest);
     std::string HandleGetAvailableNetworkResponse(const std::string &aGetAvailableNetworkRequest);
     std::string HandleCommission(const std::string &aCommissionRequest);
+    std::string HandleGetStatisticsRequest(const std::string &aGetStatisticsRequest);
 
     void HandleHttpRequest(const char *aUrl, const char *aMethod, HttpRequestCallback aCallback);
+    void HandleHttpRequestAsync(const char *aUrl, const char *aMethod, HttpRequestCallback aCallback);
     void ResponseGetQRCode(void);
     void ResponseJoinNetwork(void);
     void ResponseFormNetwork(void);
@@ -120,11 +140,54 @@ private:
     void ResponseGetAvailableNetwork(void);
     void DefaultHttpResponse(void);
     void ResponseCommission(void);
+    void ResponseGetStatistics(void);
 
     void Init(void);
 
+    void StartOperationWorker(void);
+    void StopOperationWorker(void);
+    void PostOperation(std::function<void(void)> aOperation);
+    void RunOperations(void);
+
+    void RecordRequest(const std::string &aEndpoint, Timepoint aReceiveTime, Microseconds aQueueTime, bool aSucceeded);
+
+    enum
+    {
+        kSlowRequestThreshold = 1000, ///< Requests taking longer than this many milliseconds are logged.
+    };
+
+    /**
+     * This structure represents the counters and latencies of an http endpoint.
+     */
+    struct EndpointStats
+    {
+        EndpointStats(void)
+            : mRequestCount(0)
+            , mFailureCount(0)
+        {
+        }
+
+        uint64_t          mRequestCount;    ///< The number of handled requests.
+        uint64_t          mFailureCount;    ///< The number of requests answered with an error.
+        DurationHistogram mLatency;         ///< The time from receiving a request to having its response ready.
+        DurationHistogram mQueueTime;       ///< The time a request waited for the operation worker.
+        DurationHistogram mSessionWaitTime; ///< The time a request waited for an OpenThread daemon CLI session.
+    };
+
     HttpServer            *mServer;
     otbr::Web::WpanService mWpanService;
+    otbr::Web::AssetCache  mAssetCache;
+
+    // Long operations (e.g. scan, join) are queued to a single worker so they never block the http server threads
+    // and never run concurrently against the Thread interface.
+    std::thread                           mOperationWorker;
+    std::mutex                            mOperationMutex;
+    std::condition_variable               mOperationCondition;
+    std::deque<std::function<void(void)>> mOperations;
+    bool                                  mOperationWorkerStopping;
+
+    std::mutex                           mStatsMutex;
+    std::map<std::string, EndpointStats> mEndpointStats; ///< Keyed by the endpoint path.
 };
 
 } // namespace Web
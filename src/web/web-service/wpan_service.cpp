@@ -35,14 +35,21 @@
 
 #include "web/web-service/wpan_service.hpp"
 
+#include <algorithm>
 #include <sstream>
 
+#include <arpa/inet.h>
+#include <errno.h>
+#include <ifaddrs.h>
 #include <inttypes.h>
+#include <netinet/in.h>
 #include <stdio.h>
 #include <unistd.h>
 
+#include "common/api_strings.hpp"
 #include "common/byteswap.hpp"
 #include "common/code_utils.hpp"
+#include "common/types.hpp"
 
 namespace otbr {
 namespace Web {
@@ -52,19 +59,104 @@ namespace Web {
 #define CREDENTIAL_TYPE_NETWORK_KEY "networkKeyType"
 #define CREDENTIAL_TYPE_PSKD "pskdType"
 
+#if OTBR_ENABLE_DBUS_SERVER
+namespace {
+
+using ClientError = DBusBackend::ClientError;
+
+bool ParseNetworkKey(const std::string &aHex, std::vector<uint8_t> &aKey)
+{
+    aKey.resize(OT_NETWORK_KEY_LENGTH);
+
+    return otbr::Utils::Hex2Bytes(aHex.c_str(), aKey.data(), OT_NETWORK_KEY_LENGTH) == OT_NETWORK_KEY_LENGTH;
+}
+
+std::string Uint64ToHex(uint64_t aValue)
+{
+    char hex[sizeof(aValue) * 2 + 1];
+
+    snprintf(hex, sizeof(hex), "%016" PRIx64, aValue);
+
+    return hex;
+}
+
+// Reports the addresses of the Thread interface the way `ipaddr` output used to be classified.
+void AddInterfaceAddresses(const char *aIfName, const uint8_t *aMeshLocalPrefix, Json::Value &aNetworkInfo)
+{
+    static const uint8_t kRlocIid[] = {0x00, 0x00, 0x00, 0xff, 0xfe, 0x00};
+    struct ifaddrs      *ifAddrs;
+
+    VerifyOrExit(getifaddrs(&ifAddrs) == 0, otbrLogWarning("Failed to get interface addresses: %s", strerror(errno)));
+
+    for (struct ifaddrs *ifAddr = ifAddrs; ifAddr != nullptr; ifAddr = ifAddr->ifa_next)
+    {
+        const uint8_t *address;
+        char           addressString[INET6_ADDRSTRLEN];
+
+        if (ifAddr->ifa_addr == nullptr || ifAddr->ifa_addr->sa_family != AF_INET6 ||
+            strcmp(ifAddr->ifa_name, aIfName) != 0)
+        {
+            continue;
+        }
+
+        address = reinterpret_cast<const sockaddr_in6 *>(ifAddr->ifa_addr)->sin6_addr.s6_addr;
+        inet_ntop(AF_INET6, address, addressString, sizeof(addressString));
+
+        if (address[0] == 0xfe && (address[1] & 0xc0) == 0x80)
+        {
+            aNetworkInfo["IPv6:LinkLocalAddress"] = addressString;
+        }
+        else if (memcmp(address, aMeshLocalPrefix, OTBR_IP6_PREFIX_SIZE) == 0)
+        {
+            // Skip the RLOC and ALOCs, only the ML-EID identifies this device.
+            if (memcmp(address + OTBR_IP6_PREFIX_SIZE, kRlocIid, sizeof(kRlocIid)) != 0)
+            {
+                aNetworkInfo["IPv6:MeshLocalAddress"] = addressString;
+            }
+        }
+        else if (address[0] == 0xfd)
+        {
+            aNetworkInfo["IPv6:LocalAddress"] = addressString;
+        }
+        else
+        {
+            aNetworkInfo["IPv6:GlobalAddress"] = addressString;
+        }
+    }
+
+    freeifaddrs(ifAddrs);
+
+exit:
+    return;
+}
+
+} // namespace
+#endif // OTBR_ENABLE_DBUS_SERVER
+
 std::string WpanService::HandleGetQRCodeRequest()
 {
-    Json::Value                 root, networkInfo;
-    Json::FastWriter            jsonWriter;
-    std::string                 response;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
+    Json::Value      root, networkInfo;
+    Json::FastWriter jsonWriter;
+    std::string      response;
+    std::string      eui64;
+    int              ret = kWpanStatus_Ok;
+
+#if OTBR_ENABLE_DBUS_SERVER
+    uint64_t eui64Value;
+
+    // eui64 is the only required information to generate the QR code.
+    VerifyOrExit(mBackend.GetEui64(eui64Value) == ClientError::ERROR_NONE, ret = kWpanStatus_GetPropertyFailed);
+    eui64 = Uint64ToHex(eui64Value);
+#else
+    OpenThreadClientPool::Lease client(mClientPool);
     char                       *rval;
 
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
+    VerifyOrExit(client.IsValid(), ret = kWpanStatus_SetFailed);
 
     // eui64 is the only required information to generate the QR code.
-    VerifyOrExit((rval = client.Execute("eui64")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    VerifyOrExit((rval = client->Execute("eui64")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    eui64 = rval;
+#endif
 
 exit:
 
@@ -73,7 +165,7 @@ exit:
 
     if (ret == kWpanStatus_Ok)
     {
-        root["eui64"] = rval;
+        root["eui64"] = eui64;
     }
     else
     {
@@ -87,24 +179,22 @@ exit:
 
 std::string WpanService::HandleJoinNetworkRequest(const std::string &aJoinRequest)
 {
-    Json::Value                 root;
-    Json::Reader                reader;
-    Json::FastWriter            jsonWriter;
-    std::string                 response;
-    int                         index;
-    std::string                 credentialType;
-    std::string                 networkKey;
-    std::string                 pskd;
-    std::string                 prefix;
-    bool                        defaultRoute;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
-    char                       *rval;
-
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
+    Json::Value      root;
+    Json::Reader     reader;
+    Json::FastWriter jsonWriter;
+    std::string      response;
+    int              index;
+    uint16_t         channel = 0;
+    uint16_t         panId   = 0;
+    std::string      credentialType;
+    std::string      networkKey;
+    std::string      pskd;
+    std::string      prefix;
+    bool             defaultRoute;
+    int              ret = kWpanStatus_Ok;
 
     VerifyOrExit(reader.parse(aJoinRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
-    index          = root["index"].asUInt();
+    index          = root["index"].asInt();
     credentialType = root["credentialType"].asString();
     networkKey     = root["networkKey"].asString();
     pskd           = root["pskd"].asString();
@@ -116,33 +206,39 @@ std::string WpanService::HandleJoinNetworkRequest(const std::string &aJoinReques
         prefix += "/64";
     }
 
-    VerifyOrExit(client.FactoryReset(), ret = kWpanStatus_LeaveFailed);
+    if (credentialType == CREDENTIAL_TYPE_NETWORK_KEY)
+    {
+        std::lock_guard<std::mutex> lock(mScanMutex);
+
+        // The index refers to the scan results the client was shown, which a later scan may have replaced.
+        VerifyOrExit(index >= 0 && index < mNetworksCount, ret = kWpanStatus_NetworkNotFound);
+        VerifyOrExit(!root.isMember("scanId") || root["scanId"].asUInt() == mScanId,
+                     ret = kWpanStatus_NetworkNotFound);
+        channel = mNetworks[index].mChannel;
+        panId   = mNetworks[index].mPanId;
+    }
+
+#if OTBR_ENABLE_DBUS_SERVER
+    VerifyOrExit(mBackend.FactoryReset() == ClientError::ERROR_NONE, ret = kWpanStatus_LeaveFailed);
 
     if (credentialType == CREDENTIAL_TYPE_NETWORK_KEY)
     {
-        VerifyOrExit((ret = joinActiveDataset(client, networkKey, mNetworks[index].mChannel,
-                                              mNetworks[index].mPanId)) == kWpanStatus_Ok);
-        VerifyOrExit(client.Execute("ifconfig up") != nullptr, ret = kWpanStatus_JoinFailed);
+        std::vector<uint8_t> key;
+
+        VerifyOrExit(ParseNetworkKey(networkKey, key), ret = kWpanStatus_ParseRequestFailed);
+        VerifyOrExit(mBackend.Join(key, channel, panId) == ClientError::ERROR_NONE, ret = kWpanStatus_JoinFailed);
     }
     else if (credentialType == CREDENTIAL_TYPE_PSKD)
     {
-        VerifyOrExit(client.Execute("ifconfig up") != nullptr, ret = kWpanStatus_JoinFailed);
-        VerifyOrExit(client.Execute("joiner start %s", pskd.c_str()) != nullptr, ret = kWpanStatus_JoinFailed);
-        VerifyOrExit((rval = client.Read("Join ", 5000)) != nullptr, ret = kWpanStatus_JoinFailed);
-        if (strstr(rval, "Join success"))
-        {
-            ExitNow();
-        }
-        else if (strstr(rval, "Join failed [NotFound]"))
+        switch (mBackend.JoinWithPskd(pskd))
         {
+        case ClientError::ERROR_NONE:
+            break;
+        case ClientError::OT_ERROR_NOT_FOUND:
             ExitNow(ret = kWpanStatus_JoinFailed_NotFound);
-        }
-        else if (strstr(rval, "Join failed [Security]"))
-        {
+        case ClientError::OT_ERROR_SECURITY:
             ExitNow(ret = kWpanStatus_JoinFailed_Security);
-        }
-        else
-        {
+        default:
             ExitNow(ret = kWpanStatus_JoinFailed);
         }
     }
@@ -151,9 +247,53 @@ std::string WpanService::HandleJoinNetworkRequest(const std::string &aJoinReques
         ExitNow(ret = kWpanStatus_JoinFailed);
     }
 
-    VerifyOrExit(client.Execute("thread start") != nullptr, ret = kWpanStatus_JoinFailed);
-    VerifyOrExit(client.Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
+    VerifyOrExit(mBackend.AddOnMeshPrefix(prefix, defaultRoute) == ClientError::ERROR_NONE,
                  ret = kWpanStatus_SetFailed);
+#else
+    {
+        OpenThreadClientPool::Lease client(mClientPool);
+        char                       *rval;
+
+        VerifyOrExit(client.IsValid(), ret = kWpanStatus_SetFailed);
+        VerifyOrExit(client->FactoryReset(), ret = kWpanStatus_LeaveFailed);
+
+        if (credentialType == CREDENTIAL_TYPE_NETWORK_KEY)
+        {
+            VerifyOrExit((ret = joinActiveDataset(*client, networkKey, channel, panId)) == kWpanStatus_Ok);
+            VerifyOrExit(client->Execute("ifconfig up") != nullptr, ret = kWpanStatus_JoinFailed);
+        }
+        else if (credentialType == CREDENTIAL_TYPE_PSKD)
+        {
+            VerifyOrExit(client->Execute("ifconfig up") != nullptr, ret = kWpanStatus_JoinFailed);
+            VerifyOrExit(client->Execute("joiner start %s", pskd.c_str()) != nullptr, ret = kWpanStatus_JoinFailed);
+            VerifyOrExit((rval = client->Read("Join ", 5000)) != nullptr, ret = kWpanStatus_JoinFailed);
+            if (strstr(rval, "Join success"))
+            {
+                ExitNow();
+            }
+            else if (strstr(rval, "Join failed [NotFound]"))
+            {
+                ExitNow(ret = kWpanStatus_JoinFailed_NotFound);
+            }
+            else if (strstr(rval, "Join failed [Security]"))
+            {
+                ExitNow(ret = kWpanStatus_JoinFailed_Security);
+            }
+            else
+            {
+                ExitNow(ret = kWpanStatus_JoinFailed);
+            }
+        }
+        else
+        {
+            ExitNow(ret = kWpanStatus_JoinFailed);
+        }
+
+        VerifyOrExit(client->Execute("thread start") != nullptr, ret = kWpanStatus_JoinFailed);
+        VerifyOrExit(client->Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
+                     ret = kWpanStatus_SetFailed);
+    }
+#endif
 
 exit:
 
@@ -183,27 +323,23 @@ exit:
 
 std::string WpanService::HandleFormNetworkRequest(const std::string &aFormRequest)
 {
-    Json::Value                 root;
-    Json::FastWriter            jsonWriter;
-    Json::Reader                reader;
-    std::string                 response;
-    otbr::Psk::Pskc             psk;
-    char                        pskcStr[OT_PSKC_MAX_LENGTH * 2 + 1];
-    uint8_t                     extPanIdBytes[OT_EXTENDED_PANID_LENGTH];
-    std::string                 networkKey;
-    std::string                 prefix;
-    uint16_t                    channel;
-    std::string                 networkName;
-    std::string                 passphrase;
-    uint16_t                    panId;
-    uint64_t                    extPanId;
-    bool                        defaultRoute;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
-
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
+    Json::Value      root;
+    Json::FastWriter jsonWriter;
+    Json::Reader     reader;
+    std::string      response;
+    otbr::Psk::Pskc  psk;
+    const uint8_t   *pskc;
+    uint8_t          extPanIdBytes[OT_EXTENDED_PANID_LENGTH];
+    std::string      networkKey;
+    std::string      prefix;
+    uint16_t         channel;
+    std::string      networkName;
+    std::string      passphrase;
+    uint16_t         panId;
+    uint64_t         extPanId;
+    bool             defaultRoute;
+    int              ret = kWpanStatus_Ok;
 
-    pskcStr[OT_PSKC_MAX_LENGTH * 2] = '\0'; // for manipulating with strlen
     VerifyOrExit(reader.parse(aFormRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
     networkKey  = root["networkKey"].asString();
     prefix      = root["prefix"].asString();
@@ -216,21 +352,46 @@ std::string WpanService::HandleFormNetworkRequest(const std::string &aFormReques
     defaultRoute = root["defaultRoute"].asBool();
 
     otbr::Utils::Hex2Bytes(root["extPanId"].asString().c_str(), extPanIdBytes, OT_EXTENDED_PANID_LENGTH);
-    otbr::Utils::Bytes2Hex(psk.ComputePskc(extPanIdBytes, networkName.c_str(), passphrase.c_str()), OT_PSKC_MAX_LENGTH,
-                           pskcStr);
+    pskc = psk.ComputePskc(extPanIdBytes, networkName.c_str(), passphrase.c_str());
 
     if (prefix.find('/') == std::string::npos)
     {
         prefix += "/64";
     }
 
-    VerifyOrExit(client.FactoryReset(), ret = kWpanStatus_LeaveFailed);
-    VerifyOrExit((ret = formActiveDataset(client, networkKey, networkName, pskcStr, channel, extPanId, panId)) ==
-                 kWpanStatus_Ok);
-    VerifyOrExit(client.Execute("ifconfig up") != nullptr, ret = kWpanStatus_FormFailed);
-    VerifyOrExit(client.Execute("thread start") != nullptr, ret = kWpanStatus_FormFailed);
-    VerifyOrExit(client.Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
-                 ret = kWpanStatus_SetFailed);
+#if OTBR_ENABLE_DBUS_SERVER
+    {
+        std::vector<uint8_t> key;
+
+        VerifyOrExit(ParseNetworkKey(networkKey, key), ret = kWpanStatus_ParseRequestFailed);
+        VerifyOrExit(mBackend.FactoryReset() == ClientError::ERROR_NONE, ret = kWpanStatus_LeaveFailed);
+        VerifyOrExit(mBackend.Form(networkName, panId, extPanId, key,
+                                   std::vector<uint8_t>(pskc, pskc + OT_PSKC_MAX_LENGTH),
+                                   channel) == ClientError::ERROR_NONE,
+                     ret = kWpanStatus_FormFailed);
+        VerifyOrExit(mBackend.AddOnMeshPrefix(prefix, defaultRoute) == ClientError::ERROR_NONE,
+                     ret = kWpanStatus_SetFailed);
+    }
+#else
+    {
+        OpenThreadClientPool::Lease client(mClientPool);
+        char                        pskcStr[OT_PSKC_MAX_LENGTH * 2 + 1];
+
+        VerifyOrExit(client.IsValid(), ret = kWpanStatus_SetFailed);
+
+        pskcStr[OT_PSKC_MAX_LENGTH * 2] = '\0'; // for manipulating with strlen
+        otbr::Utils::Bytes2Hex(pskc, OT_PSKC_MAX_LENGTH, pskcStr);
+
+        VerifyOrExit(client->FactoryReset(), ret = kWpanStatus_LeaveFailed);
+        VerifyOrExit((ret = formActiveDataset(*client, networkKey, networkName, pskcStr, channel, extPanId, panId)) ==
+                     kWpanStatus_Ok);
+        VerifyOrExit(client->Execute("ifconfig up") != nullptr, ret = kWpanStatus_FormFailed);
+        VerifyOrExit(client->Execute("thread start") != nullptr, ret = kWpanStatus_FormFailed);
+        VerifyOrExit(client->Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
+                     ret = kWpanStatus_SetFailed);
+    }
+#endif
+
 exit:
 
     root.clear();
@@ -248,16 +409,13 @@ exit:
 
 std::string WpanService::HandleAddPrefixRequest(const std::string &aAddPrefixRequest)
 {
-    Json::Value                 root;
-    Json::FastWriter            jsonWriter;
-    Json::Reader                reader;
-    std::string                 response;
-    std::string                 prefix;
-    bool                        defaultRoute;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
-
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
+    Json::Value      root;
+    Json::FastWriter jsonWriter;
+    Json::Reader     reader;
+    std::string      response;
+    std::string      prefix;
+    bool             defaultRoute;
+    int              ret = kWpanStatus_Ok;
 
     VerifyOrExit(reader.parse(aAddPrefixRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
     prefix       = root["prefix"].asString();
@@ -268,9 +426,19 @@ std::string WpanService::HandleAddPrefixRequest(const std::string &aAddPrefixReq
         prefix += "/64";
     }
 
-    VerifyOrExit(client.Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
+#if OTBR_ENABLE_DBUS_SERVER
+    VerifyOrExit(mBackend.AddOnMeshPrefix(prefix, defaultRoute) == ClientError::ERROR_NONE,
                  ret = kWpanStatus_SetGatewayFailed);
-    VerifyOrExit(client.Execute("netdata register") != nullptr, ret = kWpanStatus_SetGatewayFailed);
+#else
+    {
+        OpenThreadClientPool::Lease client(mClientPool);
+
+        VerifyOrExit(client.IsValid(), ret = kWpanStatus_SetFailed);
+        VerifyOrExit(client->Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
+                     ret = kWpanStatus_SetGatewayFailed);
+        VerifyOrExit(client->Execute("netdata register") != nullptr, ret = kWpanStatus_SetGatewayFailed);
+    }
+#endif
 exit:
 
     root.clear();
@@ -288,15 +456,12 @@ exit:
 
 std::string WpanService::HandleDeletePrefixRequest(const std::string &aDeleteRequest)
 {
-    Json::Value                 root;
-    Json::FastWriter            jsonWriter;
-    Json::Reader                reader;
-    std::string                 response;
-    std::string                 prefix;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
-
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
+    Json::Value      root;
+    Json::FastWriter jsonWriter;
+    Json::Reader     reader;
+    std::string      response;
+    std::string      prefix;
+    int              ret = kWpanStatus_Ok;
 
     VerifyOrExit(reader.parse(aDeleteRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
     prefix = root["prefix"].asString();
@@ -306,8 +471,18 @@ std::string WpanService::HandleDeletePrefixRequest(const std::string &aDeleteReq
         prefix += "/64";
     }
 
-    VerifyOrExit(client.Execute("prefix remove %s", prefix.c_str()) != nullptr, ret = kWpanStatus_SetGatewayFailed);
-    VerifyOrExit(client.Execute("netdata register") != nullptr, ret = kWpanStatus_SetGatewayFailed);
+#if OTBR_ENABLE_DBUS_SERVER
+    VerifyOrExit(mBackend.RemoveOnMeshPrefix(prefix) == ClientError::ERROR_NONE, ret = kWpanStatus_SetGatewayFailed);
+#else
+    {
+        OpenThreadClientPool::Lease client(mClientPool);
+
+        VerifyOrExit(client.IsValid(), ret = kWpanStatus_SetFailed);
+        VerifyOrExit(client->Execute("prefix remove %s", prefix.c_str()) != nullptr,
+                     ret = kWpanStatus_SetGatewayFailed);
+        VerifyOrExit(client->Execute("netdata register") != nullptr, ret = kWpanStatus_SetGatewayFailed);
+    }
+#endif
 exit:
 
     root.clear();
@@ -325,63 +500,87 @@ exit:
 
 std::string WpanService::HandleStatusRequest()
 {
-    Json::Value                 root, networkInfo;
-    Json::FastWriter            jsonWriter;
-    std::string                 response, networkName, extPanId, propertyValue;
+    Json::Value      root, networkInfo;
+    Json::FastWriter jsonWriter;
+    std::string      response;
+    int              ret;
+
+    networkInfo["WPAN service"] = "uninitialized";
+
+#if OTBR_ENABLE_DBUS_SERVER
+    ret = getDBusStatus(networkInfo);
+#else
+    ret = getCliStatus(networkInfo);
+#endif
+
+    root["result"] = networkInfo;
+
+    if (ret != kWpanStatus_Ok)
+    {
+        root["result"] = WPAN_RESPONSE_FAILURE;
+        otbrLogErr("Wpan service error: %d", ret);
+    }
+    root["error"] = ret;
+    response      = jsonWriter.write(root);
+    return response;
+}
+
+#if !OTBR_ENABLE_DBUS_SERVER
+int WpanService::getCliStatus(Json::Value &aNetworkInfo)
+{
     int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
+    OpenThreadClientPool::Lease client(mClientPool);
     char                       *rval;
 
-    networkInfo["WPAN service"] = "uninitialized";
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
+    VerifyOrExit(client.IsValid(), ret = kWpanStatus_SetFailed);
 
-    VerifyOrExit((rval = client.Execute("state")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["RCP:State"] = rval;
+    VerifyOrExit((rval = client->Execute("state")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    aNetworkInfo["RCP:State"] = rval;
 
     if (!strcmp(rval, "disabled"))
     {
-        networkInfo["WPAN service"] = "offline";
+        aNetworkInfo["WPAN service"] = "offline";
         ExitNow();
     }
     else if (!strcmp(rval, "detached"))
     {
-        networkInfo["WPAN service"] = "associating";
+        aNetworkInfo["WPAN service"] = "associating";
         ExitNow();
     }
     else
     {
-        networkInfo["WPAN service"] = "associated";
+        aNetworkInfo["WPAN service"] = "associated";
     }
 
-    VerifyOrExit((rval = client.Execute("version")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["OpenThread:Version"] = rval;
+    VerifyOrExit((rval = client->Execute("version")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    aNetworkInfo["OpenThread:Version"] = rval;
 
-    VerifyOrExit((rval = client.Execute("version api")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["OpenThread:Version API"] = rval;
+    VerifyOrExit((rval = client->Execute("version api")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    aNetworkInfo["OpenThread:Version API"] = rval;
 
-    VerifyOrExit((rval = client.Execute("rcp version")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["RCP:Version"] = rval;
+    VerifyOrExit((rval = client->Execute("rcp version")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    aNetworkInfo["RCP:Version"] = rval;
 
-    VerifyOrExit((rval = client.Execute("eui64")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["RCP:EUI64"] = rval;
+    VerifyOrExit((rval = client->Execute("eui64")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    aNetworkInfo["RCP:EUI64"] = rval;
 
-    VerifyOrExit((rval = client.Execute("channel")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["RCP:Channel"] = rval;
+    VerifyOrExit((rval = client->Execute("channel")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    aNetworkInfo["RCP:Channel"] = rval;
 
-    VerifyOrExit((rval = client.Execute("txpower")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["RCP:TxPower"] = rval;
+    VerifyOrExit((rval = client->Execute("txpower")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    aNetworkInfo["RCP:TxPower"] = rval;
 
-    VerifyOrExit((rval = client.Execute("networkname")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["Network:Name"] = rval;
+    VerifyOrExit((rval = client->Execute("networkname")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    aNetworkInfo["Network:Name"] = rval;
 
-    VerifyOrExit((rval = client.Execute("extpanid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["Network:XPANID"] = rval;
+    VerifyOrExit((rval = client->Execute("extpanid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    aNetworkInfo["Network:XPANID"] = rval;
 
-    VerifyOrExit((rval = client.Execute("panid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["Network:PANID"] = rval;
+    VerifyOrExit((rval = client->Execute("panid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    aNetworkInfo["Network:PANID"] = rval;
 
-    VerifyOrExit((rval = client.Execute("partitionid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["Network:PartitionID"] = rval;
+    VerifyOrExit((rval = client->Execute("partitionid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    aNetworkInfo["Network:PartitionID"] = rval;
 
     {
         static const char kMeshLocalPrefixLocator[]       = "Mesh Local Prefix: ";
@@ -390,19 +589,19 @@ std::string WpanService::HandleStatusRequest()
         static const char linkLocalAddressToken[]         = "fe80";
         std::string       meshLocalPrefix                 = "";
 
-        VerifyOrExit((rval = client.Execute("dataset active")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+        VerifyOrExit((rval = client->Execute("dataset active")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
         rval = strstr(rval, kMeshLocalPrefixLocator);
         if (rval != nullptr)
         {
             rval += sizeof(kMeshLocalPrefixLocator) - 1;
-            *strstr(rval, "\r\n")               = '\0';
-            networkInfo["IPv6:MeshLocalPrefix"] = rval;
+            *strstr(rval, "\r\n")                = '\0';
+            aNetworkInfo["IPv6:MeshLocalPrefix"] = rval;
 
             meshLocalPrefix = rval;
             meshLocalPrefix.resize(meshLocalPrefix.find(":/"));
         }
 
-        VerifyOrExit((rval = client.Execute("ipaddr")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+        VerifyOrExit((rval = client->Execute("ipaddr")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
 
         for (rval = strtok(rval, "\r\n"); rval != nullptr; rval = strtok(nullptr, "\r\n"))
         {
@@ -415,7 +614,7 @@ std::string WpanService::HandleStatusRequest()
 
             if (strstr(rval, linkLocalAddressToken) == rval)
             {
-                networkInfo["IPv6:LinkLocalAddress"] = rval;
+                aNetworkInfo["IPv6:LinkLocalAddress"] = rval;
                 continue;
             }
 
@@ -425,58 +624,105 @@ std::string WpanService::HandleStatusRequest()
             {
                 if ((meshLocalPrefix.size() > 0) && (strstr(rval, meshLocalPrefix.c_str()) == rval))
                 {
-                    networkInfo["IPv6:MeshLocalAddress"] = rval;
+                    aNetworkInfo["IPv6:MeshLocalAddress"] = rval;
                     continue;
                 }
 
                 if (strstr(rval, localAddressToken) != rval)
                 {
-                    networkInfo["IPv6:GlobalAddress"] = rval;
+                    aNetworkInfo["IPv6:GlobalAddress"] = rval;
                 }
                 else
                 {
-                    networkInfo["IPv6:LocalAddress"] = rval;
+                    aNetworkInfo["IPv6:LocalAddress"] = rval;
                 }
             }
             else
             {
-                *meshLocalAddressToken              = '\0';
-                meshLocalPrefix                     = rval;
-                networkInfo["IPv6:MeshLocalPrefix"] = rval;
-                std::string la                      = networkInfo.get("IPv6:LocalAddress", "unknown").asString();
+                *meshLocalAddressToken               = '\0';
+                meshLocalPrefix                      = rval;
+                aNetworkInfo["IPv6:MeshLocalPrefix"] = rval;
+                std::string la                       = aNetworkInfo.get("IPv6:LocalAddress", "unknown").asString();
                 if (strstr(rval, la.c_str()) != nullptr)
                 {
-                    networkInfo["IPv6:MeshLocalAddress"] = networkInfo.get("IPv6:LocalAddress", "notfound").asString();
-                    networkInfo.removeMember("IPv6:LocalAddress");
+                    aNetworkInfo["IPv6:MeshLocalAddress"] =
+                        aNetworkInfo.get("IPv6:LocalAddress", "notfound").asString();
+                    aNetworkInfo.removeMember("IPv6:LocalAddress");
                 }
             }
         }
     }
 
 exit:
-    root["result"] = networkInfo;
+    return ret;
+}
+#endif // !OTBR_ENABLE_DBUS_SERVER
 
-    if (ret != kWpanStatus_Ok)
+#if OTBR_ENABLE_DBUS_SERVER
+int WpanService::getDBusStatus(Json::Value &aNetworkInfo)
+{
+    int                 ret = kWpanStatus_Ok;
+    DBusBackend::Status status;
+    char                buffer[OT_HEX_PREFIX_LENGTH + OT_PANID_LENGTH * 2 + 1];
+
+    VerifyOrExit(mBackend.GetStatus(status) == ClientError::ERROR_NONE, ret = kWpanStatus_GetPropertyFailed);
+    aNetworkInfo["RCP:State"] = status.mRole;
+
+    if (status.mRole == OTBR_ROLE_NAME_DISABLED)
     {
-        root["result"] = WPAN_RESPONSE_FAILURE;
-        otbrLogErr("Wpan service error: %d", ret);
+        aNetworkInfo["WPAN service"] = "offline";
+        ExitNow();
     }
-    root["error"] = ret;
-    response      = jsonWriter.write(root);
-    return response;
+    else if (status.mRole == OTBR_ROLE_NAME_DETACHED)
+    {
+        aNetworkInfo["WPAN service"] = "associating";
+        ExitNow();
+    }
+    else
+    {
+        aNetworkInfo["WPAN service"] = "associated";
+    }
+
+    aNetworkInfo["OpenThread:Version"] = status.mHostVersion;
+    aNetworkInfo["RCP:Version"]        = status.mRcpVersion;
+    aNetworkInfo["RCP:EUI64"]          = Uint64ToHex(status.mEui64);
+    aNetworkInfo["RCP:Channel"]        = status.mChannel;
+    aNetworkInfo["RCP:TxPower"]        = std::to_string(status.mTxPower) + " dBm";
+    aNetworkInfo["Network:Name"]       = status.mNetworkName;
+    aNetworkInfo["Network:XPANID"]     = Uint64ToHex(status.mExtPanId);
+    snprintf(buffer, sizeof(buffer), "0x%04x", status.mPanId);
+    aNetworkInfo["Network:PANID"]       = buffer;
+    aNetworkInfo["Network:PartitionID"] = status.mPartitionId;
+
+    if (status.mHasMeshLocalPrefix)
+    {
+        Ip6Prefix meshLocalPrefix;
+
+        memcpy(meshLocalPrefix.mPrefix.m8, status.mMeshLocalPrefix.data(), status.mMeshLocalPrefix.size());
+        meshLocalPrefix.mLength = status.mMeshLocalPrefix.size() * 8;
+
+        aNetworkInfo["IPv6:MeshLocalPrefix"] = meshLocalPrefix.ToString();
+        AddInterfaceAddresses(mIfName, status.mMeshLocalPrefix.data(), aNetworkInfo);
+    }
+
+exit:
+    return ret;
 }
+#endif // OTBR_ENABLE_DBUS_SERVER
 
-std::string WpanService::HandleAvailableNetworkRequest()
+std::string WpanService::HandleAvailableNetworkRequest(bool &aStartScan)
 {
-    Json::Value                 root, networks, networkInfo;
+    std::lock_guard<std::mutex> lock(mScanMutex);
+    Json::Value                 root, networkInfo(Json::arrayValue);
     Json::FastWriter            jsonWriter;
-    std::string                 response;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
+    Seconds                     maxAge;
 
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_ScanFailed);
-    VerifyOrExit((mNetworksCount = client.Scan(mNetworks, sizeof(mNetworks) / sizeof(mNetworks[0]))) > 0,
-                 ret = kWpanStatus_NetworkNotFound);
+    maxAge     = (mScanError == kWpanStatus_Ok) ? mScanRefreshInterval : Seconds(kFailedScanHoldTime);
+    aStartScan = !mScanInProgress && (mScanId == 0 || Clock::now() - mLastScanTime >= maxAge);
+    if (aStartScan)
+    {
+        mScanInProgress = true;
+    }
 
     for (int i = 0; i < mNetworksCount; i++)
     {
@@ -488,27 +734,109 @@ std::string WpanService::HandleAvailableNetworkRequest()
         networkInfo[i]["ha"] = hardwareAddress;
     }
 
-    root["result"] = networkInfo;
+    // While scanning, the results of the previous scan (if any) are returned along with `scanning`.
+    if (mScanInProgress || mScanError == kWpanStatus_Ok)
+    {
+        root["result"] = networkInfo;
+        root["error"]  = kWpanStatus_Ok;
+    }
+    else
+    {
+        root["result"] = WPAN_RESPONSE_FAILURE;
+        root["error"]  = mScanError;
+    }
+    root["scanning"] = mScanInProgress;
+    root["scanId"]   = mScanId;
+
+    return jsonWriter.write(root);
+}
+
+void WpanService::ScanNetworks(void)
+{
+    WpanNetworkInfo networks[OT_SCANNED_NET_BUFFER_SIZE];
+    int             count = 0;
+    int             ret   = kWpanStatus_Ok;
+
+#if OTBR_ENABLE_DBUS_SERVER
+    std::vector<DBusBackend::ActiveScanResult> results;
+
+    VerifyOrExit(mBackend.Scan(results) == ClientError::ERROR_NONE, ret = kWpanStatus_ScanFailed);
+
+    for (const DBusBackend::ActiveScanResult &result : results)
+    {
+        WpanNetworkInfo &network    = networks[count];
+        uint64_t         extAddress = result.mExtAddress;
+
+        network.mPanId   = result.mPanId;
+        network.mChannel = result.mChannel;
+        network.mRssi    = result.mRssi;
+        for (int i = OT_HARDWARE_ADDRESS_SIZE - 1; i >= 0; i--, extAddress >>= 8)
+        {
+            network.mHardwareAddress[i] = static_cast<uint8_t>(extAddress & 0xff);
+        }
+
+        if (++count == OT_SCANNED_NET_BUFFER_SIZE)
+        {
+            break;
+        }
+    }
+    VerifyOrExit(count > 0, ret = kWpanStatus_NetworkNotFound);
+#else
+    {
+        OpenThreadClientPool::Lease client(mClientPool);
+
+        VerifyOrExit(client.IsValid(), ret = kWpanStatus_ScanFailed);
+        VerifyOrExit((count = client->Scan(networks, sizeof(networks) / sizeof(networks[0]))) > 0,
+                     ret = kWpanStatus_NetworkNotFound);
+    }
+#endif
 
 exit:
     if (ret != kWpanStatus_Ok)
     {
-        root["result"] = WPAN_RESPONSE_FAILURE;
         otbrLogErr("Error is %d", ret);
+        count = 0;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mScanMutex);
+
+        std::copy(networks, networks + count, mNetworks);
+        mNetworksCount  = count;
+        mScanError      = ret;
+        mScanInProgress = false;
+        mLastScanTime   = Clock::now();
+        mScanId++;
     }
-    root["error"] = ret;
-    response      = jsonWriter.write(root);
-    return response;
 }
 
 int WpanService::GetWpanServiceStatus(std::string &aNetworkName, std::string &aExtPanId) const
 {
-    int                         status = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
+    int status = kWpanStatus_Ok;
+
+#if OTBR_ENABLE_DBUS_SERVER
+    DBusBackend::Status backendStatus;
+
+    VerifyOrExit(mBackend.GetStatus(backendStatus) == ClientError::ERROR_NONE, status = kWpanStatus_Down);
+    if (backendStatus.mRole == OTBR_ROLE_NAME_DISABLED)
+    {
+        status = kWpanStatus_Offline;
+    }
+    else if (backendStatus.mRole == OTBR_ROLE_NAME_DETACHED)
+    {
+        status = kWpanStatus_Associating;
+    }
+    else
+    {
+        aNetworkName = backendStatus.mNetworkName;
+        aExtPanId    = Uint64ToHex(backendStatus.mExtPanId);
+    }
+#else
+    OpenThreadClientPool::Lease client(mClientPool);
     const char                 *rval;
 
-    VerifyOrExit(client.Connect(), status = kWpanStatus_Uninitialized);
-    rval = client.Execute("state");
+    VerifyOrExit(client.IsValid(), status = kWpanStatus_Uninitialized);
+    rval = client->Execute("state");
     VerifyOrExit(rval != nullptr, status = kWpanStatus_Down);
     if (!strcmp(rval, "disabled"))
     {
@@ -520,14 +848,15 @@ int WpanService::GetWpanServiceStatus(std::string &aNetworkName, std::string &aE
     }
     else
     {
-        rval = client.Execute("networkname");
+        rval = client->Execute("networkname");
         VerifyOrExit(rval != nullptr, status = kWpanStatus_Down);
         aNetworkName = rval;
 
-        rval = client.Execute("extpanid");
+        rval = client->Execute("extpanid");
         VerifyOrExit(rval != nullptr, status = kWpanStatus_Down);
         aExtPanId = rval;
     }
+#endif
 
 exit:
 
@@ -548,21 +877,21 @@ std::string WpanService::HandleCommission(const std::string &aCommissionRequest)
     pskd = root["pskd"].asString();
 
     {
-        otbr::Web::OpenThreadClient client(mIfName);
+        OpenThreadClientPool::Lease client(mClientPool);
 
-        VerifyOrExit(client.Connect(), ret = kWpanStatus_Uninitialized);
+        VerifyOrExit(client.IsValid(), ret = kWpanStatus_Uninitialized);
 
         for (int i = 0; i < 5; i++)
         {
-            VerifyOrExit((rval = client.Execute("commissioner state")) != nullptr, ret = kWpanStatus_Down);
+            VerifyOrExit((rval = client->Execute("commissioner state")) != nullptr, ret = kWpanStatus_Down);
 
             if (strcmp(rval, "disabled") == 0)
             {
-                VerifyOrExit((rval = client.Execute("commissioner start")) != nullptr, ret = kWpanStatus_Down);
+                VerifyOrExit((rval = client->Execute("commissioner start")) != nullptr, ret = kWpanStatus_Down);
             }
             else if (strcmp(rval, "active") == 0)
             {
-                VerifyOrExit(client.Execute("commissioner joiner add * %s", pskd.c_str()) != nullptr,
+                VerifyOrExit(client->Execute("commissioner joiner add * %s", pskd.c_str()) != nullptr,
                              ret = kWpanStatus_Down);
                 root["error"] = ret;
                 ExitNow();
@@ -571,7 +900,7 @@ std::string WpanService::HandleCommission(const std::string &aCommissionRequest)
             sleep(1);
         }
 
-        client.Execute("commissioner stop");
+        client->Execute("commissioner stop");
     }
 
     ret = kWpanStatus_SetFailed;
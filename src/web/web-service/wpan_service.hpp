@@ -42,12 +42,16 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <mutex>
+
 #include <json/json.h>
 #include <json/writer.h>
 
 #include "common/logging.hpp"
+#include "common/time.hpp"
 #include "utils/hex.hpp"
 #include "utils/pskc.hpp"
+#include "web/web-service/dbus_backend.hpp"
 #include "web/web-service/ot_client.hpp"
 
 /**
@@ -56,6 +60,7 @@
 
 #define OT_EXTENDED_PANID_LENGTH 8
 #define OT_HARDWARE_ADDRESS_LENGTH 8
+#define OT_NETWORK_KEY_LENGTH 16
 #define OT_NETWORK_NAME_LENGTH 16
 #define OT_PANID_LENGTH 2
 #define OT_PSKC_MAX_LENGTH 16
@@ -71,6 +76,23 @@ namespace Web {
 class WpanService
 {
 public:
+    /**
+     * This constructor creates the wpan service.
+     */
+    WpanService(void)
+        : mNetworksCount(0)
+        , mScanId(0)
+        , mScanError(kWpanStatus_NetworkNotFound)
+        , mScanInProgress(false)
+        , mScanRefreshInterval(Seconds(kDefaultScanRefreshInterval))
+        , mClientPool(mIfName)
+#if OTBR_ENABLE_DBUS_SERVER
+        , mBackend(mIfName)
+#endif
+    {
+        mIfName[0] = '\0';
+    }
+
     /**
      * This method handles http request to get information to generate QR code.
      *
@@ -124,9 +146,29 @@ public:
     /**
      * This method handles http request to get available networks.
      *
+     * The response carries the results of the last scan. If they are older than the scan refresh interval, the
+     * response reports a scan in progress and @p aStartScan tells the caller to run `ScanNetworks()` in the
+     * background; clients poll until `scanning` is false.
+     *
+     * @param[out] aStartScan  Set to TRUE if the caller should start a scan.
+     *
      * @returns The string to the http response of getting available networks.
      */
-    std::string HandleAvailableNetworkRequest(void);
+    std::string HandleAvailableNetworkRequest(bool &aStartScan);
+
+    /**
+     * This method scans for available networks and refreshes the cached scan results.
+     *
+     * This method blocks until the scan completes.
+     */
+    void ScanNetworks(void);
+
+    /**
+     * This method sets how long the results of a successful scan are reused.
+     *
+     * @param[in] aInterval  The scan refresh interval.
+     */
+    void SetScanRefreshInterval(Seconds aInterval) { mScanRefreshInterval = aInterval; }
 
     /**
      * This method handles http request to commission device
@@ -144,6 +186,10 @@ public:
     {
         strncpy(mIfName, aIfName, sizeof(mIfName) - 1);
         mIfName[sizeof(mIfName) - 1] = '\0';
+        mClientPool.Clear();
+#if OTBR_ENABLE_DBUS_SERVER
+        mBackend.Reset();
+#endif
     }
 
     /**
@@ -181,12 +227,33 @@ private:
                                          uint16_t                     aChannel,
                                          uint16_t                     aPanId);
     static std::string escapeOtCliEscapable(const std::string &aArg);
+#if OTBR_ENABLE_DBUS_SERVER
+    int                getDBusStatus(Json::Value &aNetworkInfo);
+#else
+    int                getCliStatus(Json::Value &aNetworkInfo);
+#endif
+
+    enum
+    {
+        kDefaultScanRefreshInterval = 30, ///< Seconds the results of a successful scan are reused by default.
+        kFailedScanHoldTime         = 5,  ///< Seconds a failed scan is reported, long enough for pollers to see it.
+    };
 
-    WpanNetworkInfo mNetworks[OT_SCANNED_NET_BUFFER_SIZE];
-    int             mNetworksCount;
-    char            mIfName[IFNAMSIZ];
-    std::string     mNetworkName;
-    std::string     mExtPanId;
+    std::mutex                   mScanMutex;
+    WpanNetworkInfo              mNetworks[OT_SCANNED_NET_BUFFER_SIZE];
+    int                          mNetworksCount;
+    uint32_t                     mScanId; ///< Increases on every completed scan, so joins can detect stale indexes.
+    int                          mScanError;
+    bool                         mScanInProgress;
+    Timepoint                    mLastScanTime;
+    Seconds                      mScanRefreshInterval;
+    char                         mIfName[IFNAMSIZ];
+    std::string                  mNetworkName;
+    std::string                  mExtPanId;
+    mutable OpenThreadClientPool mClientPool;
+#if OTBR_ENABLE_DBUS_SERVER
+    mutable DBusBackend          mBackend;
+#endif
 
     enum
     {
@@ -0,0 +1,124 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file replaces the global allocation functions to count the heap allocations of benchmarks.
+ */
+
+#include "alloc_counter.hpp"
+
+#include <new>
+
+#include <stdlib.h>
+
+static thread_local uint64_t sAllocationCount = 0;
+
+namespace otbr {
+namespace Benchmark {
+
+uint64_t GetAllocationCount(void)
+{
+    return sAllocationCount;
+}
+
+} // namespace Benchmark
+} // namespace otbr
+
+static void *Allocate(size_t aSize)
+{
+    void *block;
+
+    ++sAllocationCount;
+
+    while ((block = malloc(aSize == 0 ? 1 : aSize)) == nullptr)
+    {
+        std::new_handler handler = std::get_new_handler();
+
+        if (handler == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+
+        handler();
+    }
+
+    return block;
+}
+
+void *operator new(size_t aSize)
+{
+    return Allocate(aSize);
+}
+
+void *operator new[](size_t aSize)
+{
+    return Allocate(aSize);
+}
+
+void *operator new(size_t aSize, const std::nothrow_t &) noexcept
+{
+    ++sAllocationCount;
+    return malloc(aSize == 0 ? 1 : aSize);
+}
+
+void *operator new[](size_t aSize, const std::nothrow_t &) noexcept
+{
+    ++sAllocationCount;
+    return malloc(aSize == 0 ? 1 : aSize);
+}
+
+void operator delete(void *aBlock) noexcept
+{
+    free(aBlock);
+}
+
+void operator delete[](void *aBlock) noexcept
+{
+    free(aBlock);
+}
+
+void operator delete(void *aBlock, size_t) noexcept
+{
+    free(aBlock);
+}
+
+void operator delete[](void *aBlock, size_t) noexcept
+{
+    free(aBlock);
+}
+
+void operator delete(void *aBlock, const std::nothrow_t &) noexcept
+{
+    free(aBlock);
+}
+
+void operator delete[](void *aBlock, const std::nothrow_t &) noexcept
+{
+    free(aBlock);
+}
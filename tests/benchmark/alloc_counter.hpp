@@ -0,0 +1,81 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for counting the heap allocations of benchmarks.
+ */
+
+#ifndef OTBR_BENCHMARK_ALLOC_COUNTER_HPP_
+#define OTBR_BENCHMARK_ALLOC_COUNTER_HPP_
+
+#include <stdint.h>
+
+#include <benchmark/benchmark.h>
+
+namespace otbr {
+namespace Benchmark {
+
+/**
+ * This function returns the number of heap allocations made by the calling thread so far.
+ *
+ * The count is maintained by the global `operator new` replaced in `alloc_counter.cpp`.
+ *
+ * @returns The number of heap allocations.
+ */
+uint64_t GetAllocationCount(void);
+
+/**
+ * This class reports the heap allocations per iteration of a benchmark as its "allocs" counter.
+ *
+ * It should be constructed right before the benchmark loop, so that the allocations of the setup are not counted.
+ */
+class AllocationCounter
+{
+public:
+    explicit AllocationCounter(benchmark::State &aState)
+        : mState(aState)
+        , mStartCount(GetAllocationCount())
+    {
+    }
+
+    ~AllocationCounter(void)
+    {
+        mState.counters["allocs"] = benchmark::Counter(static_cast<double>(GetAllocationCount() - mStartCount),
+                                                       benchmark::Counter::kAvgIterations);
+    }
+
+private:
+    benchmark::State &mState;
+    uint64_t          mStartCount;
+};
+
+} // namespace Benchmark
+} // namespace otbr
+
+#endif // OTBR_BENCHMARK_ALLOC_COUNTER_HPP_
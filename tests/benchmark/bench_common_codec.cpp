@@ -0,0 +1,120 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes benchmarks of the DNS name and IPv6 address codecs.
+ */
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "alloc_counter.hpp"
+#include "common/dns_utils.hpp"
+#include "common/types.hpp"
+
+using otbr::Benchmark::AllocationCounter;
+
+namespace {
+
+const char *const kDnsNames[] = {
+    "default.service.arpa.",
+    "_meshcop._udp.default.service.arpa.",
+    "OpenThread BorderRouter #3C1B._meshcop._udp.default.service.arpa.",
+};
+
+void BM_SplitFullDnsName(benchmark::State &aState)
+{
+    const std::string name = kDnsNames[aState.range(0)];
+
+    {
+        AllocationCounter counter(aState);
+
+        for (auto _ : aState)
+        {
+            benchmark::DoNotOptimize(SplitFullDnsName(name));
+        }
+    }
+
+    aState.SetItemsProcessed(aState.iterations());
+}
+BENCHMARK(BM_SplitFullDnsName)->DenseRange(0, 2);
+
+void BM_SplitFullDnsNameView(benchmark::State &aState)
+{
+    const std::string name = kDnsNames[aState.range(0)];
+
+    {
+        AllocationCounter counter(aState);
+
+        for (auto _ : aState)
+        {
+            benchmark::DoNotOptimize(SplitFullDnsNameView(name));
+        }
+    }
+
+    aState.SetItemsProcessed(aState.iterations());
+}
+BENCHMARK(BM_SplitFullDnsNameView)->DenseRange(0, 2);
+
+void BM_Ip6AddressToString(benchmark::State &aState)
+{
+    const otbr::Ip6Address address("fd11:22:0:0:a8b9:c8d7:e6f5:1234");
+
+    {
+        AllocationCounter counter(aState);
+
+        for (auto _ : aState)
+        {
+            benchmark::DoNotOptimize(address.ToString());
+        }
+    }
+
+    aState.SetItemsProcessed(aState.iterations());
+}
+BENCHMARK(BM_Ip6AddressToString);
+
+void BM_Ip6AddressFromString(benchmark::State &aState)
+{
+    otbr::Ip6Address address;
+
+    {
+        AllocationCounter counter(aState);
+
+        for (auto _ : aState)
+        {
+            benchmark::DoNotOptimize(otbr::Ip6Address::FromString("fd11:22::a8b9:c8d7:e6f5:1234", address));
+        }
+    }
+
+    aState.SetItemsProcessed(aState.iterations());
+}
+BENCHMARK(BM_Ip6AddressFromString);
+
+} // namespace
@@ -0,0 +1,167 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes benchmarks of the D-Bus message codec.
+ *
+ *   The "allocs" counter only includes C++ heap allocations, libdbus allocates the message buffers with `malloc()`.
+ */
+
+#include <tuple>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <dbus/dbus.h>
+
+#include "alloc_counter.hpp"
+#include "dbus/common/dbus_message_helper.hpp"
+
+using otbr::Benchmark::AllocationCounter;
+using otbr::DBus::ChildInfo;
+using otbr::DBus::NeighborInfo;
+using otbr::DBus::UniqueDBusMessage;
+
+namespace {
+
+std::vector<ChildInfo> MakeChildTable(size_t aNumChildren)
+{
+    std::vector<ChildInfo> childTable(aNumChildren);
+
+    for (size_t i = 0; i < aNumChildren; i++)
+    {
+        childTable[i].mExtAddress   = 0x1122334455667700 + i;
+        childTable[i].mTimeout      = 240;
+        childTable[i].mRloc16       = static_cast<uint16_t>(0x4401 + i);
+        childTable[i].mChildId      = static_cast<uint16_t>(i + 1);
+        childTable[i].mAverageRssi  = -60;
+        childTable[i].mLastRssi     = -58;
+        childTable[i].mRxOnWhenIdle = (i % 2 == 0);
+    }
+
+    return childTable;
+}
+
+std::vector<NeighborInfo> MakeNeighborTable(size_t aNumNeighbors)
+{
+    std::vector<NeighborInfo> neighborTable(aNumNeighbors);
+
+    for (size_t i = 0; i < aNumNeighbors; i++)
+    {
+        neighborTable[i].mExtAddress       = 0x8899aabbccddee00 + i;
+        neighborTable[i].mRloc16           = static_cast<uint16_t>((i + 1) << 10);
+        neighborTable[i].mLinkFrameCounter = 1000;
+        neighborTable[i].mAverageRssi      = -70;
+        neighborTable[i].mVersion          = 4;
+    }
+
+    return neighborTable;
+}
+
+void BM_DBusEncodeChildTable(benchmark::State &aState)
+{
+    const auto childTable = std::make_tuple(MakeChildTable(static_cast<size_t>(aState.range(0))));
+
+    {
+        AllocationCounter counter(aState);
+
+        for (auto _ : aState)
+        {
+            UniqueDBusMessage message(dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN));
+
+            benchmark::DoNotOptimize(otbr::DBus::TupleToDBusMessage(*message, childTable));
+        }
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_DBusEncodeChildTable)->Arg(1)->Arg(10)->Arg(64);
+
+void BM_DBusExtractChildTable(benchmark::State &aState)
+{
+    UniqueDBusMessage                  message(dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN));
+    std::tuple<std::vector<ChildInfo>> childTable;
+
+    otbr::DBus::TupleToDBusMessage(*message, std::make_tuple(MakeChildTable(static_cast<size_t>(aState.range(0)))));
+
+    {
+        AllocationCounter counter(aState);
+
+        for (auto _ : aState)
+        {
+            std::get<0>(childTable).clear();
+            benchmark::DoNotOptimize(otbr::DBus::DBusMessageToTuple(*message, childTable));
+        }
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_DBusExtractChildTable)->Arg(1)->Arg(10)->Arg(64);
+
+void BM_DBusEncodeNeighborTable(benchmark::State &aState)
+{
+    const auto neighborTable = std::make_tuple(MakeNeighborTable(static_cast<size_t>(aState.range(0))));
+
+    {
+        AllocationCounter counter(aState);
+
+        for (auto _ : aState)
+        {
+            UniqueDBusMessage message(dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN));
+
+            benchmark::DoNotOptimize(otbr::DBus::TupleToDBusMessage(*message, neighborTable));
+        }
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_DBusEncodeNeighborTable)->Arg(1)->Arg(10)->Arg(32);
+
+void BM_DBusExtractNeighborTable(benchmark::State &aState)
+{
+    UniqueDBusMessage                     message(dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN));
+    std::tuple<std::vector<NeighborInfo>> neighborTable;
+
+    otbr::DBus::TupleToDBusMessage(*message,
+                                   std::make_tuple(MakeNeighborTable(static_cast<size_t>(aState.range(0)))));
+
+    {
+        AllocationCounter counter(aState);
+
+        for (auto _ : aState)
+        {
+            std::get<0>(neighborTable).clear();
+            benchmark::DoNotOptimize(otbr::DBus::DBusMessageToTuple(*message, neighborTable));
+        }
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_DBusExtractNeighborTable)->Arg(1)->Arg(10)->Arg(32);
+
+} // namespace
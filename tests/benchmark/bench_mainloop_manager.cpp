@@ -0,0 +1,130 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes benchmarks of the mainloop manager.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <sys/select.h>
+#include <unistd.h>
+
+#include "common/mainloop_manager.hpp"
+
+namespace {
+
+class IdleProcessor : public otbr::MainloopProcessor
+{
+public:
+    void Update(otbr::MainloopContext &aMainloop) override { benchmark::DoNotOptimize(aMainloop.mTimeout); }
+    void Process(const otbr::MainloopContext &aMainloop) override { benchmark::DoNotOptimize(aMainloop.mMaxFd); }
+};
+
+void RunMainloopOnce(void)
+{
+    otbr::MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {0, 0};
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    otbr::MainloopManager::GetInstance().Update(mainloop);
+    select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+           &mainloop.mTimeout);
+    otbr::MainloopManager::GetInstance().Process(mainloop);
+}
+
+// Measures the cost of updating and processing N idle mainloop processors.
+void BM_MainloopManagerProcessors(benchmark::State &aState)
+{
+    std::vector<std::unique_ptr<IdleProcessor>> processors;
+
+    for (int64_t i = 0; i < aState.range(0); i++)
+    {
+        processors.emplace_back(new IdleProcessor());
+    }
+
+    for (auto _ : aState)
+    {
+        RunMainloopOnce();
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_MainloopManagerProcessors)->RangeMultiplier(4)->Range(1, 256);
+
+// Measures the cost of dispatching N persistently registered fds which are all readable.
+void BM_MainloopManagerFds(benchmark::State &aState)
+{
+    otbr::MainloopManager &manager = otbr::MainloopManager::GetInstance();
+    std::vector<int>       fds;
+    int64_t                counter = 0;
+
+    for (int64_t i = 0; i < aState.range(0); i++)
+    {
+        int     pipeFds[2];
+        uint8_t byte = 0;
+
+        if (pipe(pipeFds) != 0 || write(pipeFds[1], &byte, sizeof(byte)) != sizeof(byte))
+        {
+            aState.SkipWithError("Failed to create a pipe");
+            break;
+        }
+
+        fds.push_back(pipeFds[0]);
+        fds.push_back(pipeFds[1]);
+        manager.AddFd(pipeFds[0], otbr::MainloopContext::kReadFdSet, [&counter](uint8_t) { ++counter; });
+    }
+
+    for (auto _ : aState)
+    {
+        RunMainloopOnce();
+    }
+
+    for (size_t i = 0; i < fds.size(); i += 2)
+    {
+        manager.RemoveFd(fds[i]);
+    }
+    for (int fd : fds)
+    {
+        close(fd);
+    }
+
+    benchmark::DoNotOptimize(counter);
+    aState.SetItemsProcessed(counter);
+}
+BENCHMARK(BM_MainloopManagerFds)->RangeMultiplier(4)->Range(1, 256);
+
+} // namespace
@@ -0,0 +1,336 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes benchmarks of the data path of the posix Netif.
+ *
+ *   The NCP is replaced with a loopback `Netif::Dependencies`, so the numbers cover the TUN device,
+ *   the kernel IPv6 stack and `Netif`, and are a baseline for the data path without spinel encoding.
+ *   Creating the TUN device requires CAP_NET_ADMIN, the benchmarks are skipped otherwise.
+ */
+
+#define OTBR_LOG_TAG "BENCH"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "common/mainloop.hpp"
+#include "common/time.hpp"
+#include "common/types.hpp"
+#include "ncp/posix/netif.hpp"
+
+namespace {
+
+constexpr const char *kInterfaceName = "wpan-bench";
+constexpr uint16_t    kPort          = 12345;
+constexpr uint16_t    kBurstSize     = 32;
+constexpr size_t      kHeadersSize   = 40 + 8; ///< IPv6 and UDP headers.
+
+// fd00:db8::1/64 is configured on the interface, packets to fd00:db8::2 are routed to the NCP.
+const otIp6Address kLocalAddress = {{{0xfd, 0x00, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01}}};
+const otIp6Address kPeerAddress  = {{{0xfd, 0x00, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x02}}};
+
+uint64_t NowNs(void)
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(otbr::Clock::now().time_since_epoch()).count());
+}
+
+/**
+ * This class sinks the packets sent to the NCP and timestamps their arrival.
+ */
+class LoopbackNcp : public otbr::Netif::Dependencies
+{
+public:
+    otbrError Ip6Send(const uint8_t *aData, uint16_t aLength) override
+    {
+        uint64_t sentNs;
+
+        if (aLength >= kHeadersSize + sizeof(sentNs) && aData[6] == IPPROTO_UDP)
+        {
+            memcpy(&sentNs, aData + kHeadersSize, sizeof(sentNs));
+            mLatencyNs += NowNs() - sentNs;
+            mPackets++;
+            mBytes += aLength;
+        }
+
+        return OTBR_ERROR_NONE;
+    }
+
+    otbrError Ip6MulAddrUpdateSubscription(const otIp6Address &, bool) override { return OTBR_ERROR_NONE; }
+
+    uint64_t mPackets   = 0;
+    uint64_t mBytes     = 0;
+    uint64_t mLatencyNs = 0;
+};
+
+/**
+ * This class owns a `Netif` configured with `kLocalAddress` and drives it with a private mainloop.
+ */
+class NetifFixture
+{
+public:
+    NetifFixture(void)
+        : mNetif(mNcp)
+    {
+        std::vector<otbr::Ip6AddressInfo> addrInfos = {{kLocalAddress, 64, 0, true, false}};
+
+        mInitialized = (mNetif.Init(kInterfaceName) == OTBR_ERROR_NONE);
+        if (mInitialized)
+        {
+            mNetif.UpdateIp6UnicastAddresses(addrInfos);
+            mNetif.SetNetifState(true);
+            // Let the kernel install the routes of the address before sending traffic.
+            usleep(100 * 1000);
+        }
+    }
+
+    ~NetifFixture(void) { mNetif.Deinit(); }
+
+    bool IsInitialized(void) const { return mInitialized; }
+
+    // Returns false if nothing happened within the timeout.
+    bool RunOnce(void)
+    {
+        otbr::MainloopContext context;
+        int                   rval;
+
+        context.mMaxFd   = -1;
+        context.mTimeout = {1, 0};
+        FD_ZERO(&context.mReadFdSet);
+        FD_ZERO(&context.mWriteFdSet);
+        FD_ZERO(&context.mErrorFdSet);
+
+        mNetif.UpdateFdSet(&context);
+        rval = select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                      &context.mTimeout);
+        if (rval > 0)
+        {
+            mNetif.Process(&context);
+        }
+
+        return rval > 0;
+    }
+
+    LoopbackNcp mNcp;
+    otbr::Netif mNetif;
+    bool        mInitialized;
+};
+
+int OpenUdpSocket(const otIp6Address &aAddress, uint16_t aPort)
+{
+    int          fd = socket(AF_INET6, SOCK_DGRAM, 0);
+    sockaddr_in6 addr;
+    timeval      timeout = {1, 0};
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin6_family = AF_INET6;
+    addr.sin6_port   = htons(aPort);
+    memcpy(&addr.sin6_addr, &aAddress, sizeof(addr.sin6_addr));
+
+    if (fd >= 0 && (bind(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0 ||
+                    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) != 0))
+    {
+        close(fd);
+        fd = -1;
+    }
+
+    return fd;
+}
+
+uint16_t Checksum(const uint8_t *aData, size_t aLength, uint32_t aSum)
+{
+    for (size_t i = 0; i + 1 < aLength; i += 2)
+    {
+        aSum += static_cast<uint32_t>(aData[i] << 8 | aData[i + 1]);
+    }
+
+    if (aLength & 1)
+    {
+        aSum += static_cast<uint32_t>(aData[aLength - 1] << 8);
+    }
+
+    while (aSum >> 16)
+    {
+        aSum = (aSum & 0xffff) + (aSum >> 16);
+    }
+
+    return static_cast<uint16_t>(~aSum);
+}
+
+/**
+ * This function fills @p aPacket with an IPv6 UDP packet from `kPeerAddress` to `kLocalAddress`
+ * carrying the current time.
+ */
+void BuildUdpPacket(std::vector<uint8_t> &aPacket)
+{
+    uint16_t udpLength = static_cast<uint16_t>(aPacket.size() - 40);
+    uint64_t nowNs     = NowNs();
+    uint32_t sum;
+    uint16_t checksum;
+
+    memset(aPacket.data(), 0, kHeadersSize);
+    aPacket[0] = 0x60;
+    aPacket[4] = static_cast<uint8_t>(udpLength >> 8);
+    aPacket[5] = static_cast<uint8_t>(udpLength);
+    aPacket[6] = IPPROTO_UDP;
+    aPacket[7] = 64;
+    memcpy(&aPacket[8], kPeerAddress.mFields.m8, sizeof(kPeerAddress));
+    memcpy(&aPacket[24], kLocalAddress.mFields.m8, sizeof(kLocalAddress));
+    aPacket[40] = static_cast<uint8_t>(kPort >> 8);
+    aPacket[41] = static_cast<uint8_t>(kPort);
+    aPacket[42] = static_cast<uint8_t>(kPort >> 8);
+    aPacket[43] = static_cast<uint8_t>(kPort);
+    aPacket[44] = aPacket[4];
+    aPacket[45] = aPacket[5];
+    memcpy(&aPacket[kHeadersSize], &nowNs, sizeof(nowNs));
+
+    // The pseudo header covers the addresses, the UDP length and the next header.
+    sum      = udpLength + IPPROTO_UDP;
+    sum      = static_cast<uint16_t>(~Checksum(&aPacket[8], 32, sum));
+    checksum = Checksum(&aPacket[40], udpLength, sum);
+    checksum = (checksum == 0) ? 0xffff : checksum;
+
+    aPacket[46] = static_cast<uint8_t>(checksum >> 8);
+    aPacket[47] = static_cast<uint8_t>(checksum);
+}
+
+void ReportCounters(benchmark::State &aState, uint64_t aPackets, uint64_t aBytes, uint64_t aLatencyNs)
+{
+    aState.SetItemsProcessed(static_cast<int64_t>(aPackets));
+    aState.SetBytesProcessed(static_cast<int64_t>(aBytes));
+    aState.counters["latency_us"] = (aPackets == 0) ? 0 : static_cast<double>(aLatencyNs) / aPackets / 1000;
+    // CPU time per packet, the inverse of `items_per_second`.
+    aState.counters["cpu_per_packet"] =
+        benchmark::Counter(static_cast<double>(aPackets), benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+// Measures the path from a local socket through the TUN device to the NCP, in bursts of `kBurstSize` packets.
+void BM_NetifTunToNcp(benchmark::State &aState)
+{
+    NetifFixture         fixture;
+    std::vector<uint8_t> payload(static_cast<size_t>(aState.range(0)) - kHeadersSize);
+    sockaddr_in6         peer;
+    int                  fd = -1;
+
+    if (!fixture.IsInitialized() || (fd = OpenUdpSocket(kLocalAddress, kPort)) < 0)
+    {
+        aState.SkipWithError("Failed to set up the Netif, CAP_NET_ADMIN is required");
+        return;
+    }
+
+    memset(&peer, 0, sizeof(peer));
+    peer.sin6_family = AF_INET6;
+    peer.sin6_port   = htons(kPort);
+    memcpy(&peer.sin6_addr, &kPeerAddress, sizeof(peer.sin6_addr));
+
+    for (auto _ : aState)
+    {
+        uint64_t expected = fixture.mNcp.mPackets + kBurstSize;
+
+        for (uint16_t i = 0; i < kBurstSize; i++)
+        {
+            uint64_t nowNs = NowNs();
+
+            memcpy(payload.data(), &nowNs, sizeof(nowNs));
+            sendto(fd, payload.data(), payload.size(), 0, reinterpret_cast<sockaddr *>(&peer), sizeof(peer));
+        }
+
+        while (fixture.mNcp.mPackets < expected)
+        {
+            if (!fixture.RunOnce())
+            {
+                aState.SkipWithError("Timed out waiting for packets from the TUN device");
+                break;
+            }
+        }
+    }
+
+    ReportCounters(aState, fixture.mNcp.mPackets, fixture.mNcp.mBytes, fixture.mNcp.mLatencyNs);
+    close(fd);
+}
+BENCHMARK(BM_NetifTunToNcp)->Arg(64)->Arg(256)->Arg(1280);
+
+// Measures the path from the NCP through the TUN device to a local socket, in bursts of `kBurstSize` packets.
+void BM_NetifNcpToTun(benchmark::State &aState)
+{
+    NetifFixture         fixture;
+    std::vector<uint8_t> packet(static_cast<size_t>(aState.range(0)));
+    std::vector<uint8_t> buffer(packet.size());
+    uint64_t             packets   = 0;
+    uint64_t             latencyNs = 0;
+    int                  fd        = -1;
+
+    if (!fixture.IsInitialized() || (fd = OpenUdpSocket(kLocalAddress, kPort)) < 0)
+    {
+        aState.SkipWithError("Failed to set up the Netif, CAP_NET_ADMIN is required");
+        return;
+    }
+
+    for (auto _ : aState)
+    {
+        for (uint16_t i = 0; i < kBurstSize; i++)
+        {
+            BuildUdpPacket(packet);
+            fixture.mNetif.Ip6Receive(packet.data(), static_cast<uint16_t>(packet.size()));
+        }
+
+        fixture.RunOnce();
+
+        for (uint16_t i = 0; i < kBurstSize; i++)
+        {
+            uint64_t sentNs;
+
+            if (recv(fd, buffer.data(), buffer.size(), 0) < static_cast<ssize_t>(sizeof(sentNs)))
+            {
+                aState.SkipWithError("Timed out waiting for packets from the TUN device");
+                break;
+            }
+
+            memcpy(&sentNs, buffer.data(), sizeof(sentNs));
+            latencyNs += NowNs() - sentNs;
+            packets++;
+        }
+    }
+
+    ReportCounters(aState, packets, packets * packet.size(), latencyNs);
+    close(fd);
+}
+BENCHMARK(BM_NetifNcpToTun)->Arg(64)->Arg(256)->Arg(1280);
+
+} // namespace
@@ -0,0 +1,172 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes benchmarks of the REST request parser and JSON formatter.
+ */
+
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "alloc_counter.hpp"
+#include "rest/json.hpp"
+#include "rest/parser.hpp"
+#include "rest/request.hpp"
+
+using otbr::Benchmark::AllocationCounter;
+
+namespace {
+
+const char kGetRequest[] = "GET /node/dataset/active HTTP/1.1\r\n"
+                           "Host: 192.168.1.10:8081\r\n"
+                           "User-Agent: curl/8.5.0\r\n"
+                           "Accept: application/json\r\n"
+                           "\r\n";
+
+const char kPutRequest[] = "PUT /node/dataset/active HTTP/1.1\r\n"
+                           "Host: 192.168.1.10:8081\r\n"
+                           "Content-Type: application/json\r\n"
+                           "Content-Length: 56\r\n"
+                           "\r\n"
+                           "{\"NetworkName\":\"OpenThread-3c1b\",\"Channel\":15,\"PanId\":1}";
+
+void BM_RestParseRequest(benchmark::State &aState)
+{
+    const char         *requestString = (aState.range(0) == 0) ? kGetRequest : kPutRequest;
+    std::vector<char>   buffer(requestString, requestString + strlen(requestString));
+    otbr::rest::Request request(buffer);
+    otbr::rest::Parser  parser(&request);
+
+    {
+        AllocationCounter counter(aState);
+
+        for (auto _ : aState)
+        {
+            request.Reset();
+            parser.Init();
+            benchmark::DoNotOptimize(parser.Process(buffer.data(), buffer.size()));
+            benchmark::DoNotOptimize(request.IsComplete());
+        }
+    }
+
+    aState.SetItemsProcessed(aState.iterations());
+    aState.SetBytesProcessed(static_cast<int64_t>(aState.iterations() * buffer.size()));
+}
+BENCHMARK(BM_RestParseRequest)->Arg(0)->Arg(1);
+
+void BM_JsonNode(benchmark::State &aState)
+{
+    static const uint8_t kExtPanId[]   = {0xde, 0xad, 0x00, 0xbe, 0xef, 0x00, 0xca, 0xfe};
+    static const uint8_t kExtAddress[] = {0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xde, 0xf0};
+    otbr::rest::NodeInfo node;
+
+    memset(&node.mBaId, 0xab, sizeof(node.mBaId));
+    memset(&node.mRlocAddress, 0, sizeof(node.mRlocAddress));
+    memset(&node.mLeaderData, 0, sizeof(node.mLeaderData));
+    node.mRole        = "leader";
+    node.mNumOfRouter = 3;
+    node.mRloc16      = 0x4400;
+    node.mExtPanId    = kExtPanId;
+    node.mExtAddress  = kExtAddress;
+    node.mNetworkName = "OpenThread-3c1b";
+
+    {
+        AllocationCounter counter(aState);
+
+        for (auto _ : aState)
+        {
+            benchmark::DoNotOptimize(otbr::rest::Json::Node2JsonString(node));
+        }
+    }
+
+    aState.SetItemsProcessed(aState.iterations());
+}
+BENCHMARK(BM_JsonNode);
+
+void BM_JsonActiveDataset(benchmark::State &aState)
+{
+    otOperationalDataset dataset;
+
+    memset(&dataset, 0, sizeof(dataset));
+    dataset.mActiveTimestamp.mSeconds = 1;
+    dataset.mChannel                  = 15;
+    dataset.mPanId                    = 0x1234;
+    strcpy(dataset.mNetworkName.m8, "OpenThread-3c1b");
+    memset(&dataset.mNetworkKey, 0x5a, sizeof(dataset.mNetworkKey));
+    memset(&dataset.mExtendedPanId, 0xa5, sizeof(dataset.mExtendedPanId));
+    memset(&dataset.mPskc, 0x3c, sizeof(dataset.mPskc));
+    dataset.mComponents.mIsActiveTimestampPresent = true;
+    dataset.mComponents.mIsChannelPresent         = true;
+    dataset.mComponents.mIsPanIdPresent           = true;
+    dataset.mComponents.mIsNetworkNamePresent     = true;
+    dataset.mComponents.mIsNetworkKeyPresent      = true;
+    dataset.mComponents.mIsExtendedPanIdPresent   = true;
+    dataset.mComponents.mIsPskcPresent            = true;
+
+    {
+        AllocationCounter counter(aState);
+
+        for (auto _ : aState)
+        {
+            benchmark::DoNotOptimize(otbr::rest::Json::ActiveDataset2JsonString(dataset));
+        }
+    }
+
+    aState.SetItemsProcessed(aState.iterations());
+}
+BENCHMARK(BM_JsonActiveDataset);
+
+void BM_JsonParseActiveDataset(benchmark::State &aState)
+{
+    const std::string    json = "{\"ActiveTimestamp\":{\"Seconds\":1,\"Ticks\":0,\"Authoritative\":false},"
+                                "\"NetworkKey\":\"00112233445566778899aabbccddeeff\","
+                                "\"NetworkName\":\"OpenThread-3c1b\","
+                                "\"ExtPanId\":\"dead00beef00cafe\",\"PanId\":4660,\"Channel\":15}";
+    otOperationalDataset dataset;
+
+    {
+        AllocationCounter counter(aState);
+
+        for (auto _ : aState)
+        {
+            memset(&dataset, 0, sizeof(dataset));
+            benchmark::DoNotOptimize(otbr::rest::Json::JsonActiveDatasetString2Dataset(json, dataset));
+        }
+    }
+
+    aState.SetItemsProcessed(aState.iterations());
+    aState.SetBytesProcessed(static_cast<int64_t>(aState.iterations() * json.size()));
+}
+BENCHMARK(BM_JsonParseActiveDataset);
+
+} // namespace
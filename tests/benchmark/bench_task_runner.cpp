@@ -0,0 +1,201 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes benchmarks of the Task Runner.
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <sys/select.h>
+
+#include "common/task_runner.hpp"
+
+using otbr::TaskRunner;
+
+namespace {
+
+void RunTaskRunnerOnce(TaskRunner &aTaskRunner, const timeval &aTimeout)
+{
+    otbr::MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = aTimeout;
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    aTaskRunner.Update(mainloop);
+    select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+           &mainloop.mTimeout);
+    aTaskRunner.Process(mainloop);
+}
+
+TaskRunner::DelayedTaskQueue GetDelayedTaskQueue(const benchmark::State &aState)
+{
+    return aState.range(0) == 0 ? TaskRunner::DelayedTaskQueue::kHeap : TaskRunner::DelayedTaskQueue::kTimerWheel;
+}
+
+// Posts a batch of immediate tasks and runs them in one mainloop iteration.
+void BM_TaskRunnerPost(benchmark::State &aState)
+{
+    const int64_t kBatchSize = aState.range(0);
+    TaskRunner    taskRunner;
+    int64_t       counter = 0;
+
+    for (auto _ : aState)
+    {
+        for (int64_t i = 0; i < kBatchSize; i++)
+        {
+            taskRunner.Post([&counter]() { ++counter; });
+        }
+        RunTaskRunnerOnce(taskRunner, {0, 0});
+    }
+
+    benchmark::DoNotOptimize(counter);
+    aState.SetItemsProcessed(aState.iterations() * kBatchSize);
+}
+BENCHMARK(BM_TaskRunnerPost)->Arg(1)->Arg(64)->Arg(1024);
+
+// Posts a batch of delayed tasks which expire immediately and runs them in one mainloop iteration.
+void BM_TaskRunnerPostDelayed(benchmark::State &aState)
+{
+    const int64_t kBatchSize = aState.range(1);
+    TaskRunner    taskRunner(GetDelayedTaskQueue(aState));
+    int64_t       counter = 0;
+
+    for (auto _ : aState)
+    {
+        for (int64_t i = 0; i < kBatchSize; i++)
+        {
+            taskRunner.Post(otbr::Milliseconds::zero(), [&counter]() { ++counter; });
+        }
+        RunTaskRunnerOnce(taskRunner, {0, 0});
+    }
+
+    benchmark::DoNotOptimize(counter);
+    aState.SetItemsProcessed(aState.iterations() * kBatchSize);
+}
+BENCHMARK(BM_TaskRunnerPostDelayed)->ArgNames({"wheel", "batch"})->ArgsProduct({{0, 1}, {1, 64, 1024}});
+
+// Posts a batch of delayed tasks with random delays and cancels all of them.
+void BM_TaskRunnerCancel(benchmark::State &aState)
+{
+    const int64_t                   kBatchSize = aState.range(1);
+    TaskRunner                      taskRunner(GetDelayedTaskQueue(aState));
+    std::vector<TaskRunner::TaskId> taskIds;
+
+    taskIds.reserve(kBatchSize);
+
+    for (auto _ : aState)
+    {
+        for (int64_t i = 0; i < kBatchSize; i++)
+        {
+            taskIds.push_back(taskRunner.Post(otbr::Milliseconds(1000 + (i * 7919) % 60000), []() {}));
+        }
+        for (TaskRunner::TaskId taskId : taskIds)
+        {
+            taskRunner.Cancel(taskId);
+        }
+        taskIds.clear();
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * kBatchSize);
+}
+BENCHMARK(BM_TaskRunnerCancel)->ArgNames({"wheel", "batch"})->ArgsProduct({{0, 1}, {64, 1024}});
+
+// Measures the time between posting a task from another thread and running it on the mainloop,
+// which is blocked in `select()` and has to be woken up.
+void BM_TaskRunnerCrossThreadPostLatency(benchmark::State &aState)
+{
+    TaskRunner       taskRunner;
+    std::atomic_bool stopped{false};
+    std::thread      mainloop([&]() {
+        while (!stopped.load())
+        {
+            RunTaskRunnerOnce(taskRunner, {10, 0});
+        }
+    });
+
+    for (auto _ : aState)
+    {
+        std::atomic_bool done{false};
+        otbr::Timepoint  postTime = otbr::Clock::now();
+        otbr::Timepoint  runTime;
+
+        taskRunner.Post([&]() {
+            runTime = otbr::Clock::now();
+            done.store(true);
+        });
+
+        while (!done.load())
+        {
+        }
+
+        aState.SetIterationTime(std::chrono::duration<double>(runTime - postTime).count());
+    }
+
+    taskRunner.Post([&stopped]() { stopped.store(true); });
+    mainloop.join();
+}
+BENCHMARK(BM_TaskRunnerCrossThreadPostLatency)->UseManualTime();
+
+// Measures how late a delayed task runs after its deadline.
+void BM_TaskRunnerDelayedTaskLateness(benchmark::State &aState)
+{
+    static constexpr otbr::Milliseconds kDelay{1};
+
+    TaskRunner taskRunner(GetDelayedTaskQueue(aState));
+
+    for (auto _ : aState)
+    {
+        bool            done     = false;
+        otbr::Timepoint deadline = otbr::Clock::now() + kDelay;
+        otbr::Timepoint runTime;
+
+        taskRunner.Post(kDelay, [&]() {
+            runTime = otbr::Clock::now();
+            done    = true;
+        });
+
+        while (!done)
+        {
+            RunTaskRunnerOnce(taskRunner, {10, 0});
+        }
+
+        aState.SetIterationTime(std::chrono::duration<double>(runTime - deadline).count());
+    }
+}
+BENCHMARK(BM_TaskRunnerDelayedTaskLateness)->ArgName("wheel")->Arg(0)->Arg(1)->UseManualTime();
+
+} // namespace
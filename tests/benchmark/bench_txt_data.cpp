@@ -0,0 +1,128 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes benchmarks of the mDNS TXT data codec.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "alloc_counter.hpp"
+#include "mdns/mdns.hpp"
+
+using otbr::Benchmark::AllocationCounter;
+using otbr::Mdns::Publisher;
+
+namespace {
+
+// The TXT entries of a typical `_meshcop._udp` service. The binary values avoid NUL as they are C strings here.
+Publisher::TxtList MakeMeshcopTxtList(void)
+{
+    return Publisher::TxtList{
+        {"rv", "1"},
+        {"tv", "1.4.0"},
+        {"nn", "OpenThread-3c1b"},
+        {"vn", "OpenThread"},
+        {"mn", "BorderRouter"},
+        {"xp", "\xde\xad\xbe\xef\xca\xfe\xba\xbe"},
+        {"xa", "\x12\x34\x56\x78\x9a\xbc\xde\xf0"},
+        {"sb", "\x01\x02\x01\xb1"},
+        {"at", "\x01\x02\x03\x04\x05\x06\x07\x08"},
+        {"pt", "\x12\x34\x56\x78"},
+        {"dn", "DefaultDomain"},
+        {"id", "\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f\x10"},
+    };
+}
+
+void BM_EncodeTxtData(benchmark::State &aState)
+{
+    const Publisher::TxtList txtList = MakeMeshcopTxtList();
+    Publisher::TxtData       txtData;
+
+    {
+        AllocationCounter counter(aState);
+
+        for (auto _ : aState)
+        {
+            txtData.clear();
+            benchmark::DoNotOptimize(Publisher::EncodeTxtData(txtList, txtData));
+        }
+    }
+
+    aState.SetItemsProcessed(aState.iterations());
+    aState.SetBytesProcessed(static_cast<int64_t>(aState.iterations() * txtData.size()));
+}
+BENCHMARK(BM_EncodeTxtData);
+
+void BM_DecodeTxtData(benchmark::State &aState)
+{
+    Publisher::TxtData txtData;
+    Publisher::TxtList txtList;
+
+    Publisher::EncodeTxtData(MakeMeshcopTxtList(), txtData);
+
+    {
+        AllocationCounter counter(aState);
+
+        for (auto _ : aState)
+        {
+            txtList.clear();
+            benchmark::DoNotOptimize(
+                Publisher::DecodeTxtData(txtList, txtData.data(), static_cast<uint16_t>(txtData.size())));
+        }
+    }
+
+    aState.SetItemsProcessed(aState.iterations());
+    aState.SetBytesProcessed(static_cast<int64_t>(aState.iterations() * txtData.size()));
+}
+BENCHMARK(BM_DecodeTxtData);
+
+void BM_TxtReaderFind(benchmark::State &aState)
+{
+    Publisher::TxtData     txtData;
+    otbr::TxtReader::Entry entry;
+
+    Publisher::EncodeTxtData(MakeMeshcopTxtList(), txtData);
+
+    {
+        AllocationCounter counter(aState);
+
+        for (auto _ : aState)
+        {
+            // The `xa` key of the TREL and meshcop services, near the middle of the TXT data.
+            benchmark::DoNotOptimize(otbr::TxtReader(txtData).Find("xa", entry));
+        }
+    }
+
+    aState.SetItemsProcessed(aState.iterations());
+    aState.SetBytesProcessed(static_cast<int64_t>(aState.iterations() * txtData.size()));
+}
+BENCHMARK(BM_TxtReaderFind);
+
+} // namespace
@@ -0,0 +1,95 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes a minimal RcpHost for running the SRP Advertising Proxy and the ND Proxy
+ *   without OpenThread.
+ *
+ *   It shadows `src/ncp/rcp_host.hpp` for the benchmarks only, and provides just what the
+ *   Advertising Proxy and the ND Proxy use.
+ */
+
+#ifndef OTBR_TESTS_BENCHMARK_FAKE_RCP_HOST_HPP_
+#define OTBR_TESTS_BENCHMARK_FAKE_RCP_HOST_HPP_
+
+#include "openthread-br/config.h"
+
+#include <functional>
+#include <vector>
+
+#include <openthread/instance.h>
+
+#include "common/code_utils.hpp"
+#include "common/task_runner.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+namespace Ncp {
+
+struct ThreadStateSnapshot
+{
+    otChangedFlags mFlags;
+};
+
+class RcpHost : private NonCopyable
+{
+public:
+    using ThreadStateChangedCallback = std::function<void(const ThreadStateSnapshot &aSnapshot)>;
+
+    explicit RcpHost(otInstance *aInstance)
+        : mInstance(aInstance)
+    {
+    }
+
+    otInstance *GetInstance(void) { return mInstance; }
+
+    void RegisterResetHandler(std::function<void(void)> aHandler) { mResetHandlers.emplace_back(std::move(aHandler)); }
+
+    void AddThreadStateChangedCallback(otChangedFlags aFlagsMask, ThreadStateChangedCallback aCallback)
+    {
+        OTBR_UNUSED_VARIABLE(aFlagsMask);
+        mThreadStateChangedCallbacks.emplace_back(std::move(aCallback));
+    }
+
+    void PostTimerTask(Milliseconds aDelay, TaskRunner::Task<void> aTask)
+    {
+        mTaskRunner.Post(std::move(aDelay), std::move(aTask));
+    }
+
+private:
+    otInstance                             *mInstance;
+    TaskRunner                              mTaskRunner;
+    std::vector<std::function<void(void)>>  mResetHandlers;
+    std::vector<ThreadStateChangedCallback> mThreadStateChangedCallbacks;
+};
+
+} // namespace Ncp
+} // namespace otbr
+
+#endif // OTBR_TESTS_BENCHMARK_FAKE_RCP_HOST_HPP_
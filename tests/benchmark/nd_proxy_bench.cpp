@@ -0,0 +1,617 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a packet-rate benchmark of the ND Proxy on a synthetic backbone.
+ *
+ *   The ND Proxy runs on one end of a veth pair with a table of synthetic DUAs, and Neighbor
+ *   Solicitations for them are injected as raw Ethernet frames on the other end. For each table size,
+ *   multicast NS (answered from the raw ICMPv6 socket) and unicast NS (answered from the NFQUEUE) are
+ *   sent one at a time for the idle NS-to-NA latency, then with a window of outstanding NS for the
+ *   maximum rate.
+ *
+ *   Creating the veth pair and the NFQUEUE rule requires CAP_NET_ADMIN. Each solicited-node group
+ *   membership uses socket option memory, so large tables may need a larger `net.core.optmem_max`.
+ *
+ *   Usage: otbr-nd-proxy-bench [min-duas] [max-duas] [ns-per-phase] [window]
+ */
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <ifaddrs.h>
+#include <inttypes.h>
+#include <linux/if_packet.h>
+#include <net/ethernet.h>
+#include <net/if.h>
+#include <netinet/icmp6.h>
+#include <netinet/in.h>
+#include <netinet/ip6.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <openthread/backbone_router_ftd.h>
+
+#include "backbone_router/backbone_stats.hpp"
+#include "backbone_router/nd_proxy.hpp"
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/mainloop_manager.hpp"
+#include "common/time.hpp"
+#include "common/types.hpp"
+#include "ncp/rcp_host.hpp"
+#include "utils/system_utils.hpp"
+
+using namespace otbr;
+
+struct otInstance
+{
+};
+
+static otInstance sInstance;
+
+// Replaces the ND Proxy table of OpenThread, every DUA was registered right now.
+otError otBackboneRouterGetNdProxyInfo(otInstance                  *aInstance,
+                                       const otIp6Address          *aDua,
+                                       otBackboneRouterNdProxyInfo *aNdProxyInfo)
+{
+    OTBR_UNUSED_VARIABLE(aInstance);
+    OTBR_UNUSED_VARIABLE(aDua);
+
+    memset(aNdProxyInfo, 0, sizeof(*aNdProxyInfo));
+
+    return OT_ERROR_NONE;
+}
+
+namespace {
+
+constexpr const char *kProxyInterfaceName = "bbr-bench0";
+constexpr const char *kPeerInterfaceName  = "bbr-bench1";
+constexpr const char *kDomainPrefix       = "fd00:7d03:7d03:7d03::";
+constexpr int         kTimeoutMs          = 100;
+constexpr size_t      kNsFrameSize        = sizeof(ether_header) + sizeof(ip6_hdr) + sizeof(nd_neighbor_solicit) + 8;
+
+struct PhaseResult
+{
+    uint32_t              mSent     = 0;
+    uint32_t              mAnswered = 0;
+    Microseconds          mDuration{0};
+    std::vector<uint32_t> mLatenciesUs;
+};
+
+Ip6Address MakeDua(uint32_t aIndex)
+{
+    Ip6Address dua = Ip6Address::FromString(kDomainPrefix);
+
+    dua.m8[8]  = 0x02;
+    dua.m8[12] = static_cast<uint8_t>(aIndex >> 24);
+    dua.m8[13] = static_cast<uint8_t>(aIndex >> 16);
+    dua.m8[14] = static_cast<uint8_t>(aIndex >> 8);
+    dua.m8[15] = static_cast<uint8_t>(aIndex);
+
+    return dua;
+}
+
+uint32_t GetDuaIndex(const Ip6Address &aDua)
+{
+    return (static_cast<uint32_t>(aDua.m8[12]) << 24) | (static_cast<uint32_t>(aDua.m8[13]) << 16) |
+           (static_cast<uint32_t>(aDua.m8[14]) << 8) | aDua.m8[15];
+}
+
+uint32_t ChecksumAdd(uint32_t aSum, const uint8_t *aData, size_t aLength)
+{
+    for (size_t i = 0; i + 1 < aLength; i += 2)
+    {
+        aSum += (static_cast<uint32_t>(aData[i]) << 8) | aData[i + 1];
+    }
+
+    if (aLength & 1)
+    {
+        aSum += static_cast<uint32_t>(aData[aLength - 1]) << 8;
+    }
+
+    return aSum;
+}
+
+uint16_t Icmp6Checksum(const ip6_hdr &aIp6Header, const uint8_t *aPayload, uint16_t aLength)
+{
+    uint32_t sum = 0;
+
+    sum = ChecksumAdd(sum, aIp6Header.ip6_src.s6_addr, sizeof(aIp6Header.ip6_src));
+    sum = ChecksumAdd(sum, aIp6Header.ip6_dst.s6_addr, sizeof(aIp6Header.ip6_dst));
+    sum += aLength;
+    sum += IPPROTO_ICMPV6;
+    sum = ChecksumAdd(sum, aPayload, aLength);
+
+    while (sum >> 16)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    return htons(static_cast<uint16_t>(~sum));
+}
+
+bool GetMacAddress(const char *aIfName, uint8_t (&aMac)[ETH_ALEN])
+{
+    struct ifreq ifr;
+    int          fd = socket(AF_INET6, SOCK_DGRAM, 0);
+    bool         ok = false;
+
+    VerifyOrExit(fd >= 0);
+
+    memset(&ifr, 0, sizeof(ifr));
+    strncpy(ifr.ifr_name, aIfName, sizeof(ifr.ifr_name) - 1);
+    VerifyOrExit(ioctl(fd, SIOCGIFHWADDR, &ifr) == 0);
+    memcpy(aMac, ifr.ifr_hwaddr.sa_data, ETH_ALEN);
+    ok = true;
+
+exit:
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    return ok;
+}
+
+bool GetLinkLocalAddress(const char *aIfName, Ip6Address &aAddress)
+{
+    struct ifaddrs *ifAddrs = nullptr;
+    bool            found   = false;
+
+    VerifyOrExit(getifaddrs(&ifAddrs) == 0);
+
+    for (struct ifaddrs *ifAddr = ifAddrs; ifAddr != nullptr && !found; ifAddr = ifAddr->ifa_next)
+    {
+        const sockaddr_in6 *addr = reinterpret_cast<const sockaddr_in6 *>(ifAddr->ifa_addr);
+
+        if (addr != nullptr && addr->sin6_family == AF_INET6 && strcmp(ifAddr->ifa_name, aIfName) == 0 &&
+            IN6_IS_ADDR_LINKLOCAL(&addr->sin6_addr))
+        {
+            aAddress.CopyFrom(addr->sin6_addr);
+            found = true;
+        }
+    }
+
+exit:
+    if (ifAddrs != nullptr)
+    {
+        freeifaddrs(ifAddrs);
+    }
+
+    return found;
+}
+
+/**
+ * This class injects Neighbor Solicitations on the peer end of the veth pair and receives the answers.
+ */
+class BackbonePeer
+{
+public:
+    ~BackbonePeer(void)
+    {
+        if (mPacketSock >= 0)
+        {
+            close(mPacketSock);
+        }
+
+        if (mIcmp6Sock >= 0)
+        {
+            close(mIcmp6Sock);
+        }
+    }
+
+    bool Init(void)
+    {
+        struct sockaddr_ll  addr;
+        struct icmp6_filter filter;
+        bool                ok = false;
+
+        VerifyOrExit(GetMacAddress(kPeerInterfaceName, mMac) && GetMacAddress(kProxyInterfaceName, mProxyMac));
+
+        // The link-local address shows up once the link is up, DAD is disabled on the veth pair.
+        for (int i = 0; i < 20 && !GetLinkLocalAddress(kPeerInterfaceName, mLinkLocalAddress); i++)
+        {
+            usleep(100 * 1000);
+        }
+        VerifyOrExit(!mLinkLocalAddress.IsUnspecified());
+
+        mPacketSock = socket(AF_PACKET, SOCK_RAW | SOCK_NONBLOCK, htons(ETH_P_IPV6));
+        VerifyOrExit(mPacketSock >= 0);
+
+        memset(&addr, 0, sizeof(addr));
+        addr.sll_family   = AF_PACKET;
+        addr.sll_protocol = htons(ETH_P_IPV6);
+        addr.sll_ifindex  = static_cast<int>(if_nametoindex(kPeerInterfaceName));
+        VerifyOrExit(bind(mPacketSock, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) == 0);
+
+        mIcmp6Sock = socket(AF_INET6, SOCK_RAW | SOCK_NONBLOCK, IPPROTO_ICMPV6);
+        VerifyOrExit(mIcmp6Sock >= 0);
+        VerifyOrExit(setsockopt(mIcmp6Sock, SOL_SOCKET, SO_BINDTODEVICE, kPeerInterfaceName,
+                                static_cast<socklen_t>(strlen(kPeerInterfaceName))) == 0);
+
+        ICMP6_FILTER_SETBLOCKALL(&filter);
+        ICMP6_FILTER_SETPASS(ND_NEIGHBOR_ADVERT, &filter);
+        VerifyOrExit(setsockopt(mIcmp6Sock, IPPROTO_ICMPV6, ICMP6_FILTER, &filter, sizeof(filter)) == 0);
+
+        ok = true;
+
+    exit:
+        return ok;
+    }
+
+    // Sends a NS for `aTarget`, to its solicited-node multicast address or to the target itself.
+    bool SendNeighborSolicit(const Ip6Address &aTarget, bool aMulticast)
+    {
+        uint8_t              frame[kNsFrameSize];
+        ether_header        &ethernet = *reinterpret_cast<ether_header *>(frame);
+        ip6_hdr              ip6;
+        uint8_t             *icmp6   = frame + sizeof(ether_header) + sizeof(ip6_hdr);
+        nd_neighbor_solicit &ns      = *reinterpret_cast<nd_neighbor_solicit *>(icmp6);
+        uint8_t             *option  = icmp6 + sizeof(nd_neighbor_solicit);
+        const uint16_t       length  = sizeof(nd_neighbor_solicit) + 8;
+        Ip6Address           dst     = aMulticast ? aTarget.ToSolicitedNodeMulticastAddress() : aTarget;
+
+        memset(frame, 0, sizeof(frame));
+
+        if (aMulticast)
+        {
+            const uint8_t mac[ETH_ALEN] = {0x33, 0x33, dst.m8[12], dst.m8[13], dst.m8[14], dst.m8[15]};
+
+            memcpy(ethernet.ether_dhost, mac, ETH_ALEN);
+        }
+        else
+        {
+            memcpy(ethernet.ether_dhost, mProxyMac, ETH_ALEN);
+        }
+        memcpy(ethernet.ether_shost, mMac, ETH_ALEN);
+        ethernet.ether_type = htons(ETHERTYPE_IPV6);
+
+        memset(&ip6, 0, sizeof(ip6));
+        ip6.ip6_flow = htonl(6 << 28);
+        ip6.ip6_plen = htons(length);
+        ip6.ip6_nxt  = IPPROTO_ICMPV6;
+        ip6.ip6_hlim = 255;
+        mLinkLocalAddress.CopyTo(ip6.ip6_src);
+        dst.CopyTo(ip6.ip6_dst);
+
+        ns.nd_ns_type = ND_NEIGHBOR_SOLICIT;
+        aTarget.CopyTo(ns.nd_ns_target);
+        option[0] = ND_OPT_SOURCE_LINKADDR;
+        option[1] = 1;
+        memcpy(option + 2, mMac, ETH_ALEN);
+        ns.nd_ns_cksum = Icmp6Checksum(ip6, icmp6, length);
+
+        memcpy(frame + sizeof(ether_header), &ip6, sizeof(ip6));
+
+        return send(mPacketSock, frame, sizeof(frame), 0) == static_cast<ssize_t>(sizeof(frame));
+    }
+
+    // Waits up to `aTimeoutMs` for solicited NAs, and returns the DUA indexes of the NAs received.
+    std::vector<uint32_t> ReceiveNeighborAdverts(int aTimeoutMs)
+    {
+        std::vector<uint32_t> indexes;
+        struct pollfd         pfd = {mIcmp6Sock, POLLIN, 0};
+        uint8_t               packet[1500];
+        ssize_t               length;
+
+        VerifyOrExit(poll(&pfd, 1, aTimeoutMs) > 0);
+
+        while ((length = recv(mIcmp6Sock, packet, sizeof(packet), 0)) >= static_cast<ssize_t>(sizeof(nd_neighbor_advert)))
+        {
+            const nd_neighbor_advert &na = *reinterpret_cast<const nd_neighbor_advert *>(packet);
+            Ip6Address                target;
+
+            // The unsolicited NAs sent for new DUAs don't answer any NS.
+            if (!(na.nd_na_flags_reserved & ND_NA_FLAG_SOLICITED))
+            {
+                continue;
+            }
+
+            target.CopyFrom(na.nd_na_target);
+            indexes.push_back(GetDuaIndex(target));
+        }
+
+    exit:
+        return indexes;
+    }
+
+    void Drain(void)
+    {
+        uint8_t packet[1500];
+
+        usleep(kTimeoutMs * 1000);
+        while (recv(mIcmp6Sock, packet, sizeof(packet), 0) >= 0)
+        {
+        }
+    }
+
+private:
+    int        mPacketSock = -1;
+    int        mIcmp6Sock  = -1;
+    uint8_t    mMac[ETH_ALEN];
+    uint8_t    mProxyMac[ETH_ALEN];
+    Ip6Address mLinkLocalAddress;
+};
+
+/**
+ * This class runs the mainloop of the ND Proxy in its own thread, so that injecting NS doesn't delay it.
+ */
+class ProxyThread
+{
+public:
+    ProxyThread(void)
+        : mRunning(true)
+        , mThread([this]() {
+            while (mRunning)
+            {
+                RunMainloopOnce({0, 10000});
+            }
+        })
+    {
+    }
+
+    ~ProxyThread(void)
+    {
+        mRunning = false;
+        mThread.join();
+    }
+
+    static void RunMainloopOnce(timeval aTimeout)
+    {
+        MainloopContext mainloop;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = aTimeout;
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        MainloopManager::GetInstance().Update(mainloop);
+        select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+               &mainloop.mTimeout);
+        MainloopManager::GetInstance().Process(mainloop);
+    }
+
+private:
+    std::atomic<bool> mRunning;
+    std::thread       mThread;
+};
+
+// Sends `aCount` NS to the DUAs in turn, keeping up to `aWindow` of them unanswered. NS which are not
+// answered within `kTimeoutMs` are counted as lost.
+PhaseResult RunPhase(BackbonePeer &aPeer, uint32_t aNumDuas, bool aMulticast, uint32_t aCount, uint32_t aWindow)
+{
+    PhaseResult            result;
+    std::vector<Timepoint> sentTimes(aNumDuas);
+    std::vector<bool>      outstanding(aNumDuas, false);
+    uint32_t               numOutstanding = 0;
+    uint32_t               next           = 0;
+    Timepoint              begin          = Clock::now();
+
+    while (result.mSent < aCount || numOutstanding > 0)
+    {
+        std::vector<uint32_t> answered;
+
+        while (result.mSent < aCount && numOutstanding < aWindow && !outstanding[next])
+        {
+            sentTimes[next] = Clock::now();
+            if (aPeer.SendNeighborSolicit(MakeDua(next), aMulticast))
+            {
+                outstanding[next] = true;
+                numOutstanding++;
+            }
+            result.mSent++;
+            next = (next + 1) % aNumDuas;
+        }
+
+        answered = aPeer.ReceiveNeighborAdverts(kTimeoutMs);
+
+        if (answered.empty())
+        {
+            // Everything in flight is lost.
+            std::fill(outstanding.begin(), outstanding.end(), false);
+            numOutstanding = 0;
+            continue;
+        }
+
+        for (uint32_t index : answered)
+        {
+            if (index < aNumDuas && outstanding[index])
+            {
+                outstanding[index] = false;
+                numOutstanding--;
+                result.mAnswered++;
+                result.mLatenciesUs.push_back(static_cast<uint32_t>(
+                    std::chrono::duration_cast<Microseconds>(Clock::now() - sentTimes[index]).count()));
+            }
+        }
+    }
+
+    result.mDuration = std::chrono::duration_cast<Microseconds>(Clock::now() - begin);
+
+    return result;
+}
+
+uint32_t GetPercentile(std::vector<uint32_t> &aValues, uint32_t aPercentile)
+{
+    uint32_t value = 0;
+
+    if (!aValues.empty())
+    {
+        size_t index = std::min(aValues.size() - 1, aValues.size() * aPercentile / 100);
+
+        std::nth_element(aValues.begin(), aValues.begin() + index, aValues.end());
+        value = aValues[index];
+    }
+
+    return value;
+}
+
+void PrintResult(const char *aName, uint32_t aNumDuas, uint32_t aWindow, PhaseResult &aResult)
+{
+    double seconds = aResult.mDuration.count() / 1e6;
+
+    printf("%-9s duas %6" PRIu32 " window %3" PRIu32 " sent %7" PRIu32 " answered %7" PRIu32
+           " %9.0f NA/s p50 %6" PRIu32 " us p99 %6" PRIu32 " us\n",
+           aName, aNumDuas, aWindow, aResult.mSent, aResult.mAnswered, seconds > 0 ? aResult.mAnswered / seconds : 0,
+           GetPercentile(aResult.mLatenciesUs, 50), GetPercentile(aResult.mLatenciesUs, 99));
+}
+
+bool SetUpBackbone(void)
+{
+    bool ok = false;
+
+    VerifyOrExit(SystemUtils::ExecuteCommand("ip link add %s type veth peer name %s", kProxyInterfaceName,
+                                             kPeerInterfaceName) == 0);
+    VerifyOrExit(SystemUtils::ExecuteCommand("sysctl -qw net.ipv6.conf.%s.accept_dad=0", kProxyInterfaceName) == 0);
+    VerifyOrExit(SystemUtils::ExecuteCommand("sysctl -qw net.ipv6.conf.%s.accept_dad=0", kPeerInterfaceName) == 0);
+    VerifyOrExit(SystemUtils::ExecuteCommand("ip link set %s up", kProxyInterfaceName) == 0);
+    VerifyOrExit(SystemUtils::ExecuteCommand("ip link set %s up", kPeerInterfaceName) == 0);
+    ok = true;
+
+exit:
+    return ok;
+}
+
+void TearDownBackbone(void)
+{
+    SystemUtils::ExecuteCommand("ip link del %s", kProxyInterfaceName);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    uint32_t     minDuas = (argc > 1) ? std::stoul(argv[1]) : 100;
+    uint32_t     maxDuas = (argc > 2) ? std::stoul(argv[2]) : 10000;
+    uint32_t     count   = (argc > 3) ? std::stoul(argv[3]) : 20000;
+    uint32_t     window  = (argc > 4) ? std::stoul(argv[4]) : 64;
+    int          rval    = EXIT_SUCCESS;
+    Ip6Prefix    domainPrefix(kDomainPrefix, 64);
+    BackbonePeer peer;
+
+    VerifyOrExit(minDuas > 0 && maxDuas >= minDuas && count > 0 && window > 0 && window <= minDuas, {
+        fprintf(stderr, "Usage: %s [min-duas] [max-duas] [ns-per-phase] [window]\n", argv[0]);
+        rval = EXIT_FAILURE;
+    });
+
+    // Failures to join solicited-node groups are reported by the answer rate rather than one log each.
+    otbrLogInit("otbr-nd-proxy-bench", OTBR_LOG_ERR, /* aPrintStderr */ true, /* aSyslogDisable */ true);
+
+    VerifyOrExit(SetUpBackbone(), {
+        fprintf(stderr, "Failed to create the veth pair, CAP_NET_ADMIN is required\n");
+        rval = EXIT_FAILURE;
+    });
+
+    VerifyOrExit(peer.Init(), {
+        fprintf(stderr, "Failed to open the sockets on %s: %s\n", kPeerInterfaceName, strerror(errno));
+        rval = EXIT_FAILURE;
+    });
+
+    printf("duas %" PRIu32 "..%" PRIu32 " ns-per-phase %" PRIu32 " window %" PRIu32 "\n", minDuas, maxDuas, count,
+           window);
+
+    {
+        Ncp::RcpHost                        rcpHost(&sInstance);
+        BackboneRouter::BackboneRouterStats stats;
+        BackboneRouter::NdProxyManager      ndProxyManager(rcpHost, kProxyInterfaceName, stats);
+
+        ndProxyManager.Init();
+        ndProxyManager.Enable(domainPrefix);
+
+        VerifyOrExit(ndProxyManager.IsEnabled(), {
+            fprintf(stderr, "Failed to enable the ND Proxy, is ip6tables available?\n");
+            rval = EXIT_FAILURE;
+        });
+
+        for (uint32_t numDuas = minDuas; numDuas <= maxDuas; numDuas *= 10)
+        {
+            Timepoint begin = Clock::now();
+
+            for (uint32_t i = 0; i < numDuas; i++)
+            {
+                Ip6Address dua = MakeDua(i);
+
+                ndProxyManager.HandleBackboneRouterNdProxyEvent(OT_BACKBONE_ROUTER_NDPROXY_ADDED,
+                                                                reinterpret_cast<const otIp6Address *>(&dua));
+            }
+
+            printf("add       duas %6" PRIu32 " %9.0f DUA/s\n", numDuas,
+                   numDuas / (std::chrono::duration_cast<Microseconds>(Clock::now() - begin).count() / 1e6));
+
+            // Joins the solicited-node groups of the new DUAs.
+            ProxyThread::RunMainloopOnce({0, 0});
+            peer.Drain();
+
+            {
+                ProxyThread proxyThread;
+                PhaseResult result;
+
+                result = RunPhase(peer, numDuas, /* aMulticast */ true, std::min(count, 1000u), 1);
+                PrintResult("multicast", numDuas, 1, result);
+                result = RunPhase(peer, numDuas, /* aMulticast */ true, count, window);
+                PrintResult("multicast", numDuas, window, result);
+                result = RunPhase(peer, numDuas, /* aMulticast */ false, std::min(count, 1000u), 1);
+                PrintResult("unicast", numDuas, 1, result);
+                result = RunPhase(peer, numDuas, /* aMulticast */ false, count, window);
+                PrintResult("unicast", numDuas, window, result);
+            }
+
+            ndProxyManager.HandleBackboneRouterNdProxyEvent(OT_BACKBONE_ROUTER_NDPROXY_CLEARED, nullptr);
+            ProxyThread::RunMainloopOnce({0, 0});
+        }
+
+        printf("nfqueue verdicts %" PRIu64 " avg %" PRIu64 " us max %" PRIu32 " us\n",
+               stats.mNfqVerdictLatency.GetCount(),
+               stats.mNfqVerdictLatency.GetCount() > 0
+                   ? stats.mNfqVerdictLatency.GetSum() / stats.mNfqVerdictLatency.GetCount()
+                   : 0,
+               stats.mNfqVerdictLatency.GetMax());
+        printf("ns received %" PRIu64 " answered %" PRIu64 " dropped %" PRIu64 "\n", stats.mNsReceived,
+               stats.mNsAnswered, stats.mNsDropped);
+
+        ndProxyManager.Disable();
+    }
+
+exit:
+    TearDownBackbone();
+    return rval;
+}
@@ -0,0 +1,526 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2024, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+"""End-to-end performance scenarios of otbr-agent against simulated Thread nodes.
+
+Starts otbr-agent on a simulated RCP and N simulated ot-cli-ftd nodes attached to its network, then runs the
+selected scenarios:
+
+  srp    Each node registers its SRP services, reports the latency from the start of the SRP client until the
+         service instance is visible over mDNS on the infrastructure link.
+  dnssd  A storm of DNS-SD browse, service and host queries from the nodes to the DNS server of the border
+         router, reports queries per second and the query latency.
+  rest   Concurrent persistent connections polling the diagnostics endpoints of the REST server, reports requests
+         per second and the request latency.
+  dbus   Runs otbr-bench-dbus-server against the agent.
+
+The CPU time and the resident memory of otbr-agent are reported for every scenario.
+"""
+
+import argparse
+import http.client
+import json
+import os
+import random
+import shutil
+import subprocess
+import sys
+import threading
+import time
+
+SCENARIOS = ['srp', 'dnssd', 'rest', 'dbus']
+
+SERVICE_TYPE = '_otbrbench._udp'
+SRP_DOMAIN = 'default.service.arpa.'
+
+REST_ENDPOINTS = ['/diagnostics', '/diagnostics/topology/neighbors', '/node']
+
+
+def percentile(sorted_values, fraction):
+    if not sorted_values:
+        return 0.0
+    index = min(len(sorted_values) - 1, int(round(fraction * (len(sorted_values) - 1))))
+    return sorted_values[index]
+
+
+def latency_stats(latencies):
+    """Returns the latency statistics (in milliseconds) of a list of latencies in seconds."""
+    latencies = sorted(latencies)
+    return {
+        'samples': len(latencies),
+        'min_ms': latencies[0] * 1000 if latencies else 0.0,
+        'p50_ms': percentile(latencies, 0.50) * 1000,
+        'p95_ms': percentile(latencies, 0.95) * 1000,
+        'p99_ms': percentile(latencies, 0.99) * 1000,
+        'max_ms': latencies[-1] * 1000 if latencies else 0.0,
+    }
+
+
+def format_latency(stats):
+    return '{samples} samples, min {min_ms:.2f} ms, p50 {p50_ms:.2f} ms, p95 {p95_ms:.2f} ms, p99 {p99_ms:.2f} ms, ' \
+        'max {max_ms:.2f} ms'.format(**stats)
+
+
+class AgentMonitor(object):
+    """Measures the CPU time and the memory of otbr-agent during a scenario."""
+
+    def __init__(self, pid):
+        self.pid = pid
+        self.ticks_per_second = os.sysconf('SC_CLK_TCK')
+        self.start_time = None
+        self.start_ticks = None
+
+    def read_ticks(self):
+        with open('/proc/{}/stat'.format(self.pid)) as stat:
+            # The command name may contain spaces, the fields are counted from the closing parenthesis.
+            fields = stat.read().rsplit(')', 1)[1].split()
+        # utime and stime are the 14th and 15th fields.
+        return int(fields[11]) + int(fields[12])
+
+    def read_memory(self):
+        memory = {}
+        with open('/proc/{}/status'.format(self.pid)) as status:
+            for line in status:
+                name, _, value = line.partition(':')
+                if name in ('VmRSS', 'VmHWM'):
+                    memory[name] = int(value.split()[0])
+        return memory
+
+    def start(self):
+        self.start_time = time.monotonic()
+        self.start_ticks = self.read_ticks()
+
+    def stop(self):
+        elapsed = time.monotonic() - self.start_time
+        cpu_seconds = (self.read_ticks() - self.start_ticks) / self.ticks_per_second
+        memory = self.read_memory()
+
+        return {
+            'elapsed_s': elapsed,
+            'cpu_s': cpu_seconds,
+            'cpu_percent': cpu_seconds * 100 / elapsed if elapsed > 0 else 0.0,
+            'rss_kib': memory.get('VmRSS', 0),
+            'peak_rss_kib': memory.get('VmHWM', 0),
+        }
+
+
+class CliNode(object):
+    """A simulated Thread node running ot-cli-ftd, driven through its standard input and output."""
+
+    def __init__(self, path, node_id, work_dir):
+        self.id = node_id
+        self.lines = []
+        self.condition = threading.Condition()
+        self.process = subprocess.Popen([path, str(node_id)],
+                                        cwd=work_dir,
+                                        stdin=subprocess.PIPE,
+                                        stdout=subprocess.PIPE,
+                                        stderr=subprocess.STDOUT,
+                                        universal_newlines=True,
+                                        bufsize=1)
+        self.reader = threading.Thread(target=self.read_output, daemon=True)
+        self.reader.start()
+
+    def read_output(self):
+        for line in self.process.stdout:
+            line = line.strip().lstrip('> ').strip()
+            with self.condition:
+                self.lines.append(line)
+                self.condition.notify_all()
+
+    def command(self, command, timeout=10):
+        """Runs a CLI command and returns its output lines, excluding the final `Done`."""
+        with self.condition:
+            del self.lines[:]
+
+        self.process.stdin.write(command + '\n')
+        self.process.stdin.flush()
+
+        deadline = time.monotonic() + timeout
+        with self.condition:
+            while True:
+                for index, line in enumerate(self.lines):
+                    if line == 'Done':
+                        return self.lines[:index]
+                    if line.startswith('Error'):
+                        raise RuntimeError('node {}: {}: {}'.format(self.id, command, line))
+                remaining = deadline - time.monotonic()
+                if remaining <= 0:
+                    raise RuntimeError('node {}: {}: timed out'.format(self.id, command))
+                self.condition.wait(remaining)
+
+    def get_state(self):
+        output = [line for line in self.command('state') if line]
+        return output[-1] if output else ''
+
+    def stop(self):
+        if self.process.poll() is None:
+            self.process.terminate()
+            self.process.wait()
+
+
+class Bench(object):
+
+    def __init__(self, args):
+        self.args = args
+        self.agent = None
+        self.agent_log = None
+        self.nodes = []
+        self.results = {}
+
+    def ot_ctl(self, *command):
+        output = subprocess.run([self.args.ot_ctl] + list(command),
+                                stdout=subprocess.PIPE,
+                                stderr=subprocess.STDOUT,
+                                universal_newlines=True,
+                                timeout=30).stdout
+        lines = [line.strip() for line in output.splitlines() if line.strip()]
+        if 'Done' not in lines:
+            raise RuntimeError('ot-ctl {}: {}'.format(' '.join(command), output))
+        return lines[:lines.index('Done')]
+
+    def wait_for(self, condition, timeout, description):
+        deadline = time.monotonic() + timeout
+        while time.monotonic() < deadline:
+            try:
+                if condition():
+                    return
+            except (RuntimeError, subprocess.TimeoutExpired):
+                pass
+            time.sleep(0.5)
+        raise RuntimeError('timed out waiting for ' + description)
+
+    def start_agent(self):
+        radio_url = 'spinel+hdlc+forkpty://{}?forkpty-arg=1'.format(self.args.ot_rcp)
+
+        self.agent_log = open(os.path.join(self.args.work_dir, 'otbr-agent.log'), 'w')
+        self.agent = subprocess.Popen(
+            [self.args.agent, '-d', '5', '-I', self.args.thread_if, '-B', self.args.backbone_if, radio_url],
+            stdout=self.agent_log,
+            stderr=subprocess.STDOUT)
+
+        self.wait_for(lambda: self.ot_ctl('state') is not None, 30, 'otbr-agent')
+        subprocess.run([self.args.ot_ctl, 'factoryreset'], stdout=subprocess.DEVNULL, stderr=subprocess.STDOUT)
+        self.wait_for(lambda: self.ot_ctl('state') is not None, 30, 'otbr-agent after factory reset')
+
+        self.ot_ctl('dataset', 'init', 'new')
+        self.ot_ctl('dataset', 'channel', '11')
+        self.ot_ctl('dataset', 'commit', 'active')
+        self.ot_ctl('ifconfig', 'up')
+        self.ot_ctl('thread', 'start')
+        self.wait_for(lambda: self.ot_ctl('state') == ['leader'], 30, 'the border router to become leader')
+
+    def start_nodes(self):
+        dataset = self.ot_ctl('dataset', 'active', '-x')[0]
+
+        for node_id in range(2, 2 + self.args.nodes):
+            node = CliNode(self.args.ot_cli, node_id, self.args.work_dir)
+            self.nodes.append(node)
+            node.command('routerselectionjitter 1')
+            node.command('dataset set active ' + dataset)
+            node.command('ifconfig up')
+            node.command('thread start')
+
+        for node in self.nodes:
+            self.wait_for(lambda: node.get_state() in ('child', 'router'), 60, 'node {} to attach'.format(node.id))
+
+        print('{} nodes attached'.format(len(self.nodes)))
+
+    def stop(self):
+        for node in self.nodes:
+            node.stop()
+        if self.agent is not None:
+            self.agent.terminate()
+            self.agent.wait()
+            self.agent_log.close()
+
+    def run_scenario(self, name, scenario):
+        monitor = AgentMonitor(self.agent.pid)
+
+        print('\n== {}'.format(name))
+        monitor.start()
+        result = scenario()
+        agent = monitor.stop()
+
+        if result is None:
+            return
+
+        result['agent'] = agent
+        self.results[name] = result
+        print('otbr-agent: cpu {cpu_s:.2f} s ({cpu_percent:.1f}% over {elapsed_s:.1f} s), rss {rss_kib} KiB, '
+              'peak rss {peak_rss_kib} KiB'.format(**agent))
+
+    def instance_names(self, node):
+        return ['bench-{}-{}'.format(node.id, index) for index in range(self.args.services)]
+
+    def start_mdns_browser(self, seen):
+        """Browses the service type on the infrastructure link, records the time each instance is first seen."""
+        if shutil.which('avahi-browse'):
+            command = ['avahi-browse', '-p', '-k', SERVICE_TYPE]
+        elif shutil.which('dns-sd'):
+            command = ['dns-sd', '-B', SERVICE_TYPE, 'local.']
+        else:
+            return None
+
+        browser = subprocess.Popen(command, stdout=subprocess.PIPE, universal_newlines=True, bufsize=1)
+
+        def read_output():
+            for line in browser.stdout:
+                now = time.monotonic()
+                if line.startswith('+;'):
+                    # +;interface;protocol;name;type;domain
+                    name = line.split(';')[3]
+                elif ' Add ' in line and SERVICE_TYPE in line:
+                    name = line.split(SERVICE_TYPE + '.', 1)[1].strip()
+                else:
+                    continue
+                seen.setdefault(name, now)
+
+        threading.Thread(target=read_output, daemon=True).start()
+        return browser
+
+    def scenario_srp(self):
+        seen = {}
+        started = {}
+        browser = self.start_mdns_browser(seen)
+
+        if browser is None:
+            print('skipped: neither avahi-browse nor dns-sd is available')
+            return None
+
+        try:
+            for node in self.nodes:
+                node.command('srp client host name bench-host-{}'.format(node.id))
+                node.command('srp client host address auto')
+                for index, name in enumerate(self.instance_names(node)):
+                    node.command('srp client service add {} {} {}'.format(name, SERVICE_TYPE, 50000 + index))
+
+            for node in self.nodes:
+                started[node.id] = time.monotonic()
+                node.command('srp client autostart enable')
+
+            expected = {name: node.id for node in self.nodes for name in self.instance_names(node)}
+            deadline = time.monotonic() + self.args.timeout
+            while time.monotonic() < deadline and not all(name in seen for name in expected):
+                time.sleep(0.1)
+        finally:
+            browser.terminate()
+            browser.wait()
+
+        latencies = [seen[name] - started[node_id] for name, node_id in expected.items() if name in seen]
+        result = {
+            'instances': len(expected),
+            'missing': len(expected) - len(latencies),
+            'latency': latency_stats(latencies),
+        }
+
+        print('register to mDNS visible: {}'.format(format_latency(result['latency'])))
+        print('missing instances: {}'.format(result['missing']))
+        return result
+
+    def dns_queries(self, server):
+        """Returns the CLI commands of the DNS-SD queries sent in the storm."""
+        queries = ['dns browse {}.{} {} 53'.format(SERVICE_TYPE, SRP_DOMAIN, server)]
+
+        for node in self.nodes:
+            queries.append('dns resolve bench-host-{}.{} {} 53'.format(node.id, SRP_DOMAIN, server))
+            for name in self.instance_names(node):
+                queries.append('dns service {} {}.{} {} 53'.format(name, SERVICE_TYPE, SRP_DOMAIN, server))
+
+        return queries
+
+    def scenario_dnssd(self):
+        # The addresses of the Thread interface are local to the host, the queries are sent from the nodes.
+        server = self.ot_ctl('ipaddr', 'mleid')[0]
+        queries = self.dns_queries(server)
+        remaining = [self.args.queries]
+        lock = threading.Lock()
+        latencies = []
+        errors = {}
+
+        def run_worker(node):
+            while True:
+                with lock:
+                    if remaining[0] == 0:
+                        return
+                    remaining[0] -= 1
+
+                start = time.monotonic()
+                try:
+                    node.command(random.choice(queries), timeout=10)
+                except RuntimeError as error:
+                    with lock:
+                        message = str(error).rsplit(': ', 1)[-1]
+                        errors[message] = errors.get(message, 0) + 1
+                    continue
+
+                with lock:
+                    latencies.append(time.monotonic() - start)
+
+        start = time.monotonic()
+        workers = [threading.Thread(target=run_worker, args=(node,)) for node in self.nodes]
+        for worker in workers:
+            worker.start()
+        for worker in workers:
+            worker.join()
+        elapsed = time.monotonic() - start
+
+        result = {
+            'queries': self.args.queries,
+            'errors': errors,
+            'qps': len(latencies) / elapsed,
+            'latency': latency_stats(latencies),
+        }
+
+        print('{} queries to [{}]:53 from {} nodes, {:.1f} queries/s, errors {}'.format(
+            result['queries'], server, len(self.nodes), result['qps'], errors))
+        print('query latency: {}'.format(format_latency(result['latency'])))
+        return result
+
+    def scenario_rest(self):
+        lock = threading.Lock()
+        latencies = []
+        errors = [0]
+        deadline = time.monotonic() + self.args.duration
+
+        def run_worker():
+            connection = http.client.HTTPConnection('127.0.0.1', self.args.rest_port, timeout=10)
+            index = 0
+            while time.monotonic() < deadline:
+                path = REST_ENDPOINTS[index % len(REST_ENDPOINTS)]
+                index += 1
+                start = time.monotonic()
+                try:
+                    connection.request('GET', path, headers={'Accept': 'application/json'})
+                    response = connection.getresponse()
+                    response.read()
+                except (OSError, http.client.HTTPException):
+                    with lock:
+                        errors[0] += 1
+                    connection.close()
+                    continue
+                with lock:
+                    latencies.append(time.monotonic() - start)
+                    if response.status >= 400:
+                        errors[0] += 1
+            connection.close()
+
+        start = time.monotonic()
+        workers = [threading.Thread(target=run_worker) for _ in range(self.args.concurrency)]
+        for worker in workers:
+            worker.start()
+        for worker in workers:
+            worker.join()
+        elapsed = time.monotonic() - start
+
+        result = {
+            'requests': len(latencies),
+            'errors': errors[0],
+            'rps': len(latencies) / elapsed,
+            'latency': latency_stats(latencies),
+        }
+
+        print('{} requests on {} connections, {:.1f} requests/s, {} errors'.format(
+            result['requests'], self.args.concurrency, result['rps'], result['errors']))
+        print('request latency: {}'.format(format_latency(result['latency'])))
+        return result
+
+    def scenario_dbus(self):
+        if not self.args.dbus_bench or not os.access(self.args.dbus_bench, os.X_OK):
+            print('skipped: otbr-bench-dbus-server is not built')
+            return None
+
+        output = subprocess.run(
+            [self.args.dbus_bench,
+             str(self.args.dbus_iterations),
+             str(self.args.dbus_subscribers), self.args.thread_if],
+            stdout=subprocess.PIPE,
+            stderr=subprocess.STDOUT,
+            universal_newlines=True).stdout
+        print(output.rstrip())
+        return {'output': output.splitlines()}
+
+    def run(self):
+        self.start_agent()
+        self.start_nodes()
+
+        for name in self.args.scenarios:
+            self.run_scenario(name, getattr(self, 'scenario_' + name))
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('scenarios',
+                        nargs='*',
+                        help='scenarios to run (default: all, in the order {})'.format(' '.join(SCENARIOS)))
+    parser.add_argument('--agent', required=True, help='path of otbr-agent')
+    parser.add_argument('--ot-ctl', required=True, help='path of ot-ctl')
+    parser.add_argument('--ot-rcp', required=True, help='path of the simulation ot-rcp')
+    parser.add_argument('--ot-cli', required=True, help='path of the simulation ot-cli-ftd')
+    parser.add_argument('--dbus-bench', help='path of otbr-bench-dbus-server')
+    parser.add_argument('--work-dir', default='/tmp/otbr-bench', help='directory of the node settings and logs')
+    parser.add_argument('--thread-if', default='wpan0', help='Thread network interface of otbr-agent')
+    parser.add_argument('--backbone-if', default='lo', help='infrastructure network interface of otbr-agent')
+    parser.add_argument('--rest-port', type=int, default=8081, help='port of the REST server')
+    parser.add_argument('--nodes', type=int, default=5, help='number of simulated Thread nodes')
+    parser.add_argument('--services', type=int, default=4, help='number of SRP services registered by each node')
+    parser.add_argument('--timeout', type=float, default=60.0, help='seconds to wait for the SRP services')
+    parser.add_argument('--queries', type=int, default=5000, help='number of DNS-SD queries of the storm')
+    parser.add_argument('--concurrency', type=int, default=8, help='number of concurrent REST connections')
+    parser.add_argument('--duration', type=float, default=10.0, help='seconds to poll the REST server')
+    parser.add_argument('--dbus-iterations', type=int, default=1000, help='iterations of otbr-bench-dbus-server')
+    parser.add_argument('--dbus-subscribers', type=int, default=8, help='subscribers of otbr-bench-dbus-server')
+    parser.add_argument('--json', help='write the results to this file')
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+    args.scenarios = args.scenarios or SCENARIOS
+
+    for name in args.scenarios:
+        if name not in SCENARIOS:
+            sys.exit('unknown scenario: {}'.format(name))
+
+    shutil.rmtree(args.work_dir, ignore_errors=True)
+    os.makedirs(args.work_dir)
+
+    bench = Bench(args)
+    try:
+        bench.run()
+    finally:
+        bench.stop()
+
+    if args.json:
+        with open(args.json, 'w') as output:
+            json.dump(bench.results, output, indent=2)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,711 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a scale simulator of the SRP Advertising Proxy.
+ *
+ *   The Advertising Proxy is driven by synthetic SRP service updates from a fake SRP server and
+ *   publishes to a fake mDNS publisher which succeeds right away, so that what is measured is the
+ *   cost of the Advertising Proxy and the publishing queue of `Mdns::Publisher` themselves.
+ *
+ *   Usage: otbr-srp-scale-sim [hosts] [max-services] [max-txt-size] [renewals] [updates/s] [timeout-ms]
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <malloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/select.h>
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <openthread/srp_server.h>
+#include <openthread/thread.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/mainloop_manager.hpp"
+#include "common/time.hpp"
+#include "mdns/mdns.hpp"
+#include "ncp/rcp_host.hpp"
+#include "sdp_proxy/advertising_proxy.hpp"
+
+using namespace otbr;
+
+// The live bytes allocated on the heap, for measuring the memory used for each SRP host.
+static int64_t sHeapBytes = 0;
+
+void *operator new(size_t aSize)
+{
+    void *ptr = malloc(aSize == 0 ? 1 : aSize);
+
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    sHeapBytes += static_cast<int64_t>(malloc_usable_size(ptr));
+    return ptr;
+}
+
+void operator delete(void *aPtr) noexcept
+{
+    if (aPtr != nullptr)
+    {
+        sHeapBytes -= static_cast<int64_t>(malloc_usable_size(aPtr));
+        free(aPtr);
+    }
+}
+
+void operator delete(void *aPtr, size_t aSize) noexcept
+{
+    OTBR_UNUSED_VARIABLE(aSize);
+
+    operator delete(aPtr);
+}
+
+struct otInstance
+{
+};
+
+struct otSrpServerService
+{
+    std::string              mInstanceName;
+    std::vector<std::string> mSubTypeServiceNames;
+    uint16_t                 mPort;
+    std::vector<uint8_t>     mTxtData;
+    bool                     mIsDeleted;
+};
+
+struct otSrpServerHost
+{
+    uint32_t                        mIndex;
+    std::string                     mFullName;
+    std::vector<otIp6Address>       mAddresses;
+    std::vector<otSrpServerService> mServices;
+    bool                            mIsDeleted;
+};
+
+namespace {
+
+constexpr char kDomain[]      = "default.service.arpa.";
+constexpr char kServiceType[] = "_sim._udp";
+
+const otIp6Address kMeshLocalEid = {
+    {{0xfd, 0xde, 0xad, 0x00, 0xbe, 0xef, 0x00, 0x00, 0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xde, 0xf0}}};
+
+// A SRP service update which has been handed to the Advertising Proxy.
+struct SimUpdate
+{
+    std::unique_ptr<otSrpServerHost> mHost;
+    Timepoint                        mSubmitTime;
+    Timepoint                        mDeadline;
+    bool                             mIsDone;
+};
+
+struct PhaseResult
+{
+    uint32_t              mAcked;
+    uint32_t              mFailed;
+    uint32_t              mTimedOut;
+    uint32_t              mLate;
+    std::vector<uint32_t> mAckLatenciesUs;
+    Milliseconds          mWallTime;
+    Microseconds          mHandlerTime;
+    Microseconds          mMainloopTime;
+};
+
+otInstance                      sInstance;
+otSrpServerServiceUpdateHandler sUpdateHandler        = nullptr;
+void                           *sUpdateHandlerContext = nullptr;
+
+// The SRP hosts which have been accepted by the fake SRP server, indexed by `otSrpServerHost::mIndex`.
+std::vector<std::unique_ptr<otSrpServerHost>> sHosts;
+
+// The updates of the ongoing phase, the update ID of `sUpdates[i]` is `sFirstUpdateId + i`.
+std::vector<SimUpdate>     sUpdates;
+otSrpServerServiceUpdateId sFirstUpdateId = 1;
+PhaseResult                sResult;
+
+class FakePublisher : public Mdns::Publisher
+{
+public:
+    otbrError Start(void) override
+    {
+        mIsStarted = true;
+        return OTBR_ERROR_NONE;
+    }
+
+    void Stop(void) override { mIsStarted = false; }
+
+    bool IsStarted(void) const override { return mIsStarted; }
+
+protected:
+    otbrError PublishServiceImpl(const std::string &aHostName,
+                                 const std::string &aName,
+                                 const std::string &aType,
+                                 const SubTypeList &aSubTypeList,
+                                 uint16_t           aPort,
+                                 const TxtData     &aTxtData,
+                                 ResultCallback   &&aCallback) override
+    {
+        aCallback = HandleDuplicateServiceRegistration(aHostName, aName, aType, aSubTypeList, aPort, aTxtData,
+                                                       std::move(aCallback));
+        VerifyOrExit(!aCallback.IsNull());
+
+        AddServiceRegistration(MakeUnique<ServiceRegistration>(aHostName, aName, aType, aSubTypeList, aPort, aTxtData,
+                                                               std::move(aCallback), this));
+        FindServiceRegistration(aName, aType)->Complete(OTBR_ERROR_NONE);
+
+    exit:
+        return OTBR_ERROR_NONE;
+    }
+
+    otbrError PublishHostImpl(const std::string &aName,
+                              const AddressList &aAddresses,
+                              ResultCallback   &&aCallback) override
+    {
+        aCallback = HandleDuplicateHostRegistration(aName, aAddresses, std::move(aCallback));
+        VerifyOrExit(!aCallback.IsNull());
+
+        AddHostRegistration(MakeUnique<HostRegistration>(aName, aAddresses, std::move(aCallback), this));
+        FindHostRegistration(aName)->Complete(OTBR_ERROR_NONE);
+
+    exit:
+        return OTBR_ERROR_NONE;
+    }
+
+    otbrError PublishKeyImpl(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback) override
+    {
+        OTBR_UNUSED_VARIABLE(aName);
+        OTBR_UNUSED_VARIABLE(aKeyData);
+
+        std::move(aCallback)(OTBR_ERROR_NONE);
+        return OTBR_ERROR_NONE;
+    }
+
+    void UnpublishServiceImpl(const std::string &aName, const std::string &aType, ResultCallback &&aCallback) override
+    {
+        RemoveServiceRegistration(aName, aType, OTBR_ERROR_ABORTED);
+        std::move(aCallback)(OTBR_ERROR_NONE);
+    }
+
+    void UnpublishHostImpl(const std::string &aName, ResultCallback &&aCallback) override
+    {
+        RemoveHostRegistration(aName, OTBR_ERROR_ABORTED);
+        std::move(aCallback)(OTBR_ERROR_NONE);
+    }
+
+    void UnpublishKeyImpl(const std::string &aName, ResultCallback &&aCallback) override
+    {
+        OTBR_UNUSED_VARIABLE(aName);
+
+        std::move(aCallback)(OTBR_ERROR_NONE);
+    }
+
+    otbrError SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override
+    {
+        OTBR_UNUSED_VARIABLE(aType);
+        OTBR_UNUSED_VARIABLE(aInstanceName);
+
+        return OTBR_ERROR_NONE;
+    }
+
+    void UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override
+    {
+        OTBR_UNUSED_VARIABLE(aType);
+        OTBR_UNUSED_VARIABLE(aInstanceName);
+    }
+
+    otbrError SubscribeHostImpl(const std::string &aHostName) override
+    {
+        OTBR_UNUSED_VARIABLE(aHostName);
+
+        return OTBR_ERROR_NONE;
+    }
+
+    void UnsubscribeHostImpl(const std::string &aHostName) override { OTBR_UNUSED_VARIABLE(aHostName); }
+
+    void OnServiceResolveFailedImpl(const std::string &aType,
+                                    const std::string &aInstanceName,
+                                    int32_t            aErrorCode) override
+    {
+        OTBR_UNUSED_VARIABLE(aType);
+        OTBR_UNUSED_VARIABLE(aInstanceName);
+        OTBR_UNUSED_VARIABLE(aErrorCode);
+    }
+
+    void OnHostResolveFailedImpl(const std::string &aHostName, int32_t aErrorCode) override
+    {
+        OTBR_UNUSED_VARIABLE(aHostName);
+        OTBR_UNUSED_VARIABLE(aErrorCode);
+    }
+
+    otbrError DnsErrorToOtbrError(int32_t aError) override
+    {
+        return aError == 0 ? OTBR_ERROR_NONE : OTBR_ERROR_MDNS;
+    }
+
+private:
+    bool mIsStarted = false;
+};
+
+std::string HostName(uint32_t aHost)
+{
+    return "sim-host-" + std::to_string(aHost);
+}
+
+// Builds a host with a random number of services and random TXT sizes, which are reproducible.
+std::unique_ptr<otSrpServerHost> MakeHost(uint32_t      aHost,
+                                          uint32_t      aMaxServices,
+                                          uint32_t      aMaxTxtSize,
+                                          std::mt19937 &aRandom)
+{
+    std::unique_ptr<otSrpServerHost> host(new otSrpServerHost());
+    uint32_t                         numServices = 1 + aRandom() % aMaxServices;
+    otIp6Address                     omrAddress  = kMeshLocalEid;
+
+    host->mIndex     = aHost;
+    host->mFullName  = HostName(aHost) + "." + kDomain;
+    host->mIsDeleted = false;
+
+    // The mesh-local EID is filtered out by the Advertising Proxy, the OMR address is advertised.
+    omrAddress.mFields.m8[0]  = 0xfd;
+    omrAddress.mFields.m8[1]  = 0x00;
+    omrAddress.mFields.m8[12] = static_cast<uint8_t>(aHost >> 24);
+    omrAddress.mFields.m8[13] = static_cast<uint8_t>(aHost >> 16);
+    omrAddress.mFields.m8[14] = static_cast<uint8_t>(aHost >> 8);
+    omrAddress.mFields.m8[15] = static_cast<uint8_t>(aHost);
+    host->mAddresses.push_back(kMeshLocalEid);
+    host->mAddresses.push_back(omrAddress);
+
+    for (uint32_t i = 0; i < numServices; i++)
+    {
+        otSrpServerService service;
+        uint32_t           txtSize = 1 + aRandom() % aMaxTxtSize;
+        std::string        name    = HostName(aHost) + "-" + std::to_string(i);
+
+        service.mInstanceName = name + "." + kServiceType + "." + kDomain;
+        service.mPort         = static_cast<uint16_t>(1024 + i);
+        service.mIsDeleted    = false;
+
+        if (i % 2 == 1)
+        {
+            service.mSubTypeServiceNames.push_back("_s" + std::to_string(i) + "._sub." + kServiceType + "." + kDomain);
+        }
+
+        // A single TXT entry "k=vvv..." of `txtSize` bytes in total, including its length byte.
+        txtSize = std::max<uint32_t>(txtSize, 4);
+        service.mTxtData.push_back(static_cast<uint8_t>(std::min<uint32_t>(txtSize - 1, 255)));
+        service.mTxtData.push_back('k');
+        service.mTxtData.push_back('=');
+        service.mTxtData.resize(std::min<uint32_t>(txtSize, 256), 'v');
+
+        host->mServices.push_back(std::move(service));
+    }
+
+    return host;
+}
+
+void RunMainloopOnce(PhaseResult &aResult)
+{
+    MainloopContext mainloop;
+    Timepoint       begin;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {INT_MAX, INT_MAX};
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    MainloopManager::GetInstance().Update(mainloop);
+
+    // Wakes up regularly to submit updates and to expire them.
+    if (mainloop.mTimeout.tv_sec > 0 || mainloop.mTimeout.tv_usec > 10000)
+    {
+        mainloop.mTimeout = {0, 10000};
+    }
+
+    select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+           &mainloop.mTimeout);
+
+    begin = Clock::now();
+    MainloopManager::GetInstance().Process(mainloop);
+    aResult.mMainloopTime += std::chrono::duration_cast<Microseconds>(Clock::now() - begin);
+}
+
+// Hands `aHosts` as SRP service updates to the Advertising Proxy, `aRate` of them per second (or all
+// at once if it's 0), and waits until each of them has been acknowledged or has timed out.
+void RunPhase(const char                                   *aName,
+              std::vector<std::unique_ptr<otSrpServerHost>> aHosts,
+              uint32_t                                      aRate,
+              uint32_t                                      aTimeout)
+{
+    Timepoint begin     = Clock::now();
+    size_t    submitted = 0;
+    size_t    expired   = 0;
+    int64_t   heapBytes;
+    uint64_t  totalUs = 0;
+
+    sFirstUpdateId += static_cast<otSrpServerServiceUpdateId>(sUpdates.size());
+    sUpdates.clear();
+    sUpdates.resize(aHosts.size());
+    sResult = PhaseResult();
+    sResult.mAckLatenciesUs.reserve(aHosts.size());
+
+    for (size_t i = 0; i < aHosts.size(); i++)
+    {
+        sUpdates[i].mHost   = std::move(aHosts[i]);
+        sUpdates[i].mIsDone = false;
+    }
+
+    // Only what the Advertising Proxy and the publisher allocate is counted from now on.
+    heapBytes = sHeapBytes;
+
+    while (expired < sUpdates.size())
+    {
+        size_t due = sUpdates.size();
+
+        if (aRate != 0)
+        {
+            due = std::min<size_t>(due, std::chrono::duration_cast<Milliseconds>(Clock::now() - begin).count() *
+                                            aRate / 1000);
+        }
+
+        for (; submitted < due; submitted++)
+        {
+            SimUpdate &update = sUpdates[submitted];
+            Timepoint  start  = Clock::now();
+
+            update.mSubmitTime = start;
+            update.mDeadline   = start + Milliseconds(aTimeout);
+            sUpdateHandler(sFirstUpdateId + static_cast<otSrpServerServiceUpdateId>(submitted), update.mHost.get(),
+                           aTimeout, sUpdateHandlerContext);
+            sResult.mHandlerTime += std::chrono::duration_cast<Microseconds>(Clock::now() - start);
+        }
+
+        // Updates are submitted in the order of their deadlines, so they are done or expired in order.
+        for (Timepoint now = Clock::now(); expired < submitted; expired++)
+        {
+            SimUpdate &update = sUpdates[expired];
+
+            if (!update.mIsDone)
+            {
+                if (update.mDeadline > now)
+                {
+                    break;
+                }
+
+                update.mIsDone = true;
+                sResult.mTimedOut++;
+            }
+        }
+
+        if (expired < sUpdates.size())
+        {
+            RunMainloopOnce(sResult);
+        }
+    }
+
+    sResult.mWallTime = std::chrono::duration_cast<Milliseconds>(Clock::now() - begin);
+    std::sort(sResult.mAckLatenciesUs.begin(), sResult.mAckLatenciesUs.end());
+
+    for (uint32_t latency : sResult.mAckLatenciesUs)
+    {
+        totalUs += latency;
+    }
+
+    printf("%-10s updates %zu acked %" PRIu32 " failed %" PRIu32 " timed-out %" PRIu32 " late %" PRIu32
+           " wall %.3f s\n",
+           aName, sUpdates.size(), sResult.mAcked, sResult.mFailed, sResult.mTimedOut, sResult.mLate,
+           sResult.mWallTime.count() / 1000.0);
+    printf("%-10s busy %.1f us/update (handler %.1f us, mainloop %.1f us)\n", "",
+           (sResult.mHandlerTime + sResult.mMainloopTime).count() / static_cast<double>(sUpdates.size()),
+           sResult.mHandlerTime.count() / static_cast<double>(sUpdates.size()),
+           sResult.mMainloopTime.count() / static_cast<double>(sUpdates.size()));
+
+    if (!sResult.mAckLatenciesUs.empty())
+    {
+        const std::vector<uint32_t> &latencies = sResult.mAckLatenciesUs;
+
+        printf("%-10s ack latency ms avg %.3f p50 %.3f p90 %.3f p99 %.3f max %.3f\n", "",
+               totalUs / 1000.0 / latencies.size(), latencies[latencies.size() * 50 / 100] / 1000.0,
+               latencies[latencies.size() * 90 / 100] / 1000.0, latencies[latencies.size() * 99 / 100] / 1000.0,
+               latencies.back() / 1000.0);
+    }
+
+    printf("%-10s heap %+.1f KiB (%+.1f bytes/update)\n", "", (sHeapBytes - heapBytes) / 1024.0,
+           static_cast<double>(sHeapBytes - heapBytes) / sUpdates.size());
+}
+
+std::vector<std::unique_ptr<otSrpServerHost>> CopyHosts(void)
+{
+    std::vector<std::unique_ptr<otSrpServerHost>> hosts;
+
+    for (const auto &host : sHosts)
+    {
+        if (host != nullptr && !host->mIsDeleted)
+        {
+            hosts.emplace_back(new otSrpServerHost(*host));
+        }
+    }
+
+    return hosts;
+}
+
+} // namespace
+
+void otSrpServerSetServiceUpdateHandler(otInstance                     *aInstance,
+                                        otSrpServerServiceUpdateHandler aServiceHandler,
+                                        void                           *aContext)
+{
+    assert(aInstance == &sInstance);
+
+    sUpdateHandler        = aServiceHandler;
+    sUpdateHandlerContext = aContext;
+}
+
+void otSrpServerHandleServiceUpdateResult(otInstance *aInstance, otSrpServerServiceUpdateId aId, otError aError)
+{
+    size_t     index = aId - sFirstUpdateId;
+    SimUpdate *update;
+    Timepoint  now = Clock::now();
+
+    assert(aInstance == &sInstance);
+    OTBR_UNUSED_VARIABLE(aInstance);
+
+    VerifyOrExit(aId >= sFirstUpdateId && index < sUpdates.size());
+    update = &sUpdates[index];
+
+    if (update->mIsDone || now > update->mDeadline)
+    {
+        // The SRP server has already given up on this update.
+        sResult.mLate++;
+        ExitNow();
+    }
+
+    update->mIsDone = true;
+
+    if (aError != OT_ERROR_NONE)
+    {
+        sResult.mFailed++;
+        ExitNow();
+    }
+
+    sResult.mAcked++;
+    sResult.mAckLatenciesUs.push_back(
+        static_cast<uint32_t>(std::chrono::duration_cast<Microseconds>(now - update->mSubmitTime).count()));
+
+    // A deleted host is retained like the SRP server does until its key lease expires. The replaced host
+    // is kept in `update` until the next phase, so that it isn't freed while the phase is measured.
+    std::swap(sHosts[update->mHost->mIndex], update->mHost);
+
+exit:
+    return;
+}
+
+const otSrpServerHost *otSrpServerGetNextHost(otInstance *aInstance, const otSrpServerHost *aHost)
+{
+    size_t                 index = (aHost == nullptr) ? 0 : aHost->mIndex + 1;
+    const otSrpServerHost *next  = nullptr;
+
+    assert(aInstance == &sInstance);
+    OTBR_UNUSED_VARIABLE(aInstance);
+
+    for (; index < sHosts.size() && next == nullptr; index++)
+    {
+        next = sHosts[index].get();
+    }
+
+    return next;
+}
+
+const char *otSrpServerHostGetFullName(const otSrpServerHost *aHost)
+{
+    return aHost->mFullName.c_str();
+}
+
+const otIp6Address *otSrpServerHostGetAddresses(const otSrpServerHost *aHost, uint8_t *aAddressesNum)
+{
+    *aAddressesNum = static_cast<uint8_t>(aHost->mAddresses.size());
+    return aHost->mAddresses.data();
+}
+
+bool otSrpServerHostIsDeleted(const otSrpServerHost *aHost)
+{
+    return aHost->mIsDeleted;
+}
+
+const otSrpServerService *otSrpServerHostGetNextService(const otSrpServerHost    *aHost,
+                                                        const otSrpServerService *aService)
+{
+    const otSrpServerService *next = (aService == nullptr) ? aHost->mServices.data() : aService + 1;
+
+    return next < aHost->mServices.data() + aHost->mServices.size() ? next : nullptr;
+}
+
+const char *otSrpServerServiceGetInstanceName(const otSrpServerService *aService)
+{
+    return aService->mInstanceName.c_str();
+}
+
+bool otSrpServerServiceIsDeleted(const otSrpServerService *aService)
+{
+    return aService->mIsDeleted;
+}
+
+uint16_t otSrpServerServiceGetPort(const otSrpServerService *aService)
+{
+    return aService->mPort;
+}
+
+const uint8_t *otSrpServerServiceGetTxtData(const otSrpServerService *aService, uint16_t *aDataLength)
+{
+    *aDataLength = static_cast<uint16_t>(aService->mTxtData.size());
+    return aService->mTxtData.data();
+}
+
+const char *otSrpServerServiceGetSubTypeServiceNameAt(const otSrpServerService *aService, uint16_t aIndex)
+{
+    return aIndex < aService->mSubTypeServiceNames.size() ? aService->mSubTypeServiceNames[aIndex].c_str() : nullptr;
+}
+
+otError otSrpServerParseSubTypeServiceName(const char *aSubTypeServiceName, char *aLabel, uint8_t aLabelSize)
+{
+    otError     error = OT_ERROR_NONE;
+    const char *end   = strstr(aSubTypeServiceName, "._sub.");
+    size_t      length;
+
+    VerifyOrExit(end != nullptr, error = OT_ERROR_INVALID_ARGS);
+    length = static_cast<size_t>(end - aSubTypeServiceName);
+    VerifyOrExit(length < aLabelSize, error = OT_ERROR_NO_BUFS);
+
+    memcpy(aLabel, aSubTypeServiceName, length);
+    aLabel[length] = '\0';
+
+exit:
+    return error;
+}
+
+const otIp6Address *otThreadGetMeshLocalEid(otInstance *aInstance)
+{
+    assert(aInstance == &sInstance);
+    OTBR_UNUSED_VARIABLE(aInstance);
+
+    return &kMeshLocalEid;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t numHosts    = (argc > 1) ? std::stoul(argv[1]) : 1000;
+    uint32_t maxServices = (argc > 2) ? std::stoul(argv[2]) : 4;
+    uint32_t maxTxtSize  = (argc > 3) ? std::stoul(argv[3]) : 128;
+    uint32_t numRenewals = (argc > 4) ? std::stoul(argv[4]) : 1;
+    uint32_t rate        = (argc > 5) ? std::stoul(argv[5]) : 0;
+    uint32_t timeout     = (argc > 6) ? std::stoul(argv[6]) : 5000;
+    int      rval        = EXIT_SUCCESS;
+
+    std::mt19937                                  random(1);
+    std::vector<std::unique_ptr<otSrpServerHost>> hosts;
+
+    VerifyOrExit(numHosts > 0 && maxServices > 0 && maxTxtSize > 0, {
+        fprintf(stderr, "Usage: %s [hosts] [max-services] [max-txt-size] [renewals] [updates/s] [timeout-ms]\n",
+                argv[0]);
+        rval = EXIT_FAILURE;
+    });
+
+    otbrLogInit("otbr-srp-scale-sim", OTBR_LOG_WARNING, /* aPrintStderr */ true, /* aSyslogDisable */ true);
+
+    printf("hosts %" PRIu32 " max-services %" PRIu32 " max-txt-size %" PRIu32 " renewals %" PRIu32
+           " updates/s %" PRIu32 " timeout %" PRIu32 " ms\n",
+           numHosts, maxServices, maxTxtSize, numRenewals, rate, timeout);
+
+    {
+        Ncp::RcpHost     rcpHost(&sInstance);
+        FakePublisher    publisher;
+        AdvertisingProxy advertisingProxy(rcpHost, publisher);
+
+        publisher.Start();
+        advertisingProxy.SetEnabled(true);
+        sHosts.resize(numHosts);
+
+        for (uint32_t i = 0; i < numHosts; i++)
+        {
+            hosts.push_back(MakeHost(i, maxServices, maxTxtSize, random));
+        }
+        RunPhase("register", std::move(hosts), rate, timeout);
+
+        for (uint32_t i = 0; i < numRenewals; i++)
+        {
+            RunPhase("renew", CopyHosts(), rate, timeout);
+        }
+
+        // Every host changes the TXT data of its first service, and every 8th host also removes its
+        // last service.
+        hosts = CopyHosts();
+        for (auto &host : hosts)
+        {
+            host->mServices.front().mTxtData.back() ^= 1;
+
+            if (host->mIndex % 8 == 0 && host->mServices.size() > 1)
+            {
+                host->mServices.back().mIsDeleted = true;
+            }
+        }
+        RunPhase("update", std::move(hosts), rate, timeout);
+
+        hosts = CopyHosts();
+        for (auto &host : hosts)
+        {
+            host->mIsDeleted = true;
+
+            for (auto &service : host->mServices)
+            {
+                service.mIsDeleted = true;
+            }
+        }
+        RunPhase("remove", std::move(hosts), rate, timeout);
+
+        advertisingProxy.SetEnabled(false);
+        publisher.Stop();
+        sUpdates.clear();
+    }
+
+exit:
+    return rval;
+}
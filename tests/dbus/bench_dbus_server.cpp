@@ -0,0 +1,463 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a throughput benchmark of the otbr-agent D-Bus server.
+ *
+ *   The agent under test is expected to run with a simulated RCP and an active dataset, see `bench-server`.
+ */
+
+#include <algorithm>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include <dbus/dbus.h>
+
+#include "common/code_utils.hpp"
+#include "common/time.hpp"
+#include "dbus/common/constants.hpp"
+#include "dbus/common/dbus_message_helper.hpp"
+#include "dbus/common/dbus_resources.hpp"
+
+using otbr::Clock;
+using otbr::Microseconds;
+using otbr::Timepoint;
+using otbr::DBus::DBusMessageEncode;
+using otbr::DBus::DBusMessageEncodeToVariant;
+using otbr::DBus::DBusMessageExtractFromVariant;
+using otbr::DBus::TupleToDBusMessage;
+using otbr::DBus::UniqueDBusMessage;
+
+namespace {
+
+constexpr int     kSignalTimeoutMs = 5000;
+constexpr uint8_t kChannelTlvType  = 0;
+
+struct BenchmarkConfig
+{
+    std::string mInterfaceName  = "wpan0";
+    uint32_t    mNumIterations  = 1000;
+    uint32_t    mNumSubscribers = 8;
+    uint32_t    mPipelineDepth  = 32;
+};
+
+class BenchmarkPhase
+{
+public:
+    explicit BenchmarkPhase(const char *aName)
+        : mName(aName)
+        , mStartTime(Clock::now())
+        , mNumFailures(0)
+        , mNumBytes(0)
+    {
+    }
+
+    void AddSample(Microseconds aLatency) { mLatencies.push_back(static_cast<uint64_t>(aLatency.count())); }
+    void AddFailure(void) { mNumFailures++; }
+    void AddBytes(uint64_t aBytes) { mNumBytes += aBytes; }
+
+    void Print(void)
+    {
+        double   elapsed = std::chrono::duration<double>(Clock::now() - mStartTime).count();
+        uint64_t sum     = 0;
+        size_t   count   = mLatencies.size();
+
+        std::sort(mLatencies.begin(), mLatencies.end());
+
+        for (uint64_t latency : mLatencies)
+        {
+            sum += latency;
+        }
+
+        printf("%-12s %8zu %8" PRIu32 " %10.1f %8" PRIu64 " %8" PRIu64 " %8" PRIu64 " %8" PRIu64 " %8" PRIu64
+               " %10" PRIu64 "\n",
+               mName, count, mNumFailures, elapsed > 0 ? count / elapsed : 0.0, count ? sum / count : 0,
+               GetPercentile(50), GetPercentile(90), GetPercentile(99), count ? mLatencies.back() : 0,
+               count ? mNumBytes / count : 0);
+    }
+
+    static void PrintHeader(void)
+    {
+        printf("%-12s %8s %8s %10s %8s %8s %8s %8s %8s %10s\n", "phase", "samples", "failures", "ops/s", "avg(us)",
+               "p50(us)", "p90(us)", "p99(us)", "max(us)", "bytes/op");
+    }
+
+private:
+    uint64_t GetPercentile(uint32_t aPercent) const
+    {
+        return mLatencies.empty() ? 0 : mLatencies[(mLatencies.size() - 1) * aPercent / 100];
+    }
+
+    const char           *mName;
+    Timepoint             mStartTime;
+    std::vector<uint64_t> mLatencies;
+    uint32_t              mNumFailures;
+    uint64_t              mNumBytes;
+};
+
+BenchmarkConfig sConfig;
+
+UniqueDBusMessage NewMethodCall(const char *aInterface, const char *aMethod)
+{
+    return UniqueDBusMessage(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + sConfig.mInterfaceName).c_str(),
+                                                          (OTBR_DBUS_OBJECT_PREFIX + sConfig.mInterfaceName).c_str(),
+                                                          aInterface, aMethod));
+}
+
+UniqueDBusMessage CallAndWait(DBusConnection *aConnection, DBusMessage *aMessage)
+{
+    UniqueDBusMessage reply;
+    DBusError         error;
+
+    dbus_error_init(&error);
+    reply = UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(aConnection, aMessage, DBUS_TIMEOUT_USE_DEFAULT, &error));
+    dbus_error_free(&error);
+
+    return reply;
+}
+
+bool IsMethodReturn(const UniqueDBusMessage &aReply)
+{
+    return aReply != nullptr && dbus_message_get_type(aReply.get()) == DBUS_MESSAGE_TYPE_METHOD_RETURN;
+}
+
+uint64_t GetMessageSize(DBusMessage *aMessage)
+{
+    char *marshalled = nullptr;
+    int   length     = 0;
+
+    if (dbus_message_marshal(aMessage, &marshalled, &length))
+    {
+        dbus_free(marshalled);
+    }
+
+    return static_cast<uint64_t>(length);
+}
+
+UniqueDBusMessage NewGetPropertyCall(const char *aPropertyName)
+{
+    UniqueDBusMessage message = NewMethodCall(DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTY_GET_METHOD);
+
+    if (message != nullptr)
+    {
+        TupleToDBusMessage(*message,
+                           std::make_tuple(std::string(OTBR_DBUS_THREAD_INTERFACE), std::string(aPropertyName)));
+    }
+
+    return message;
+}
+
+// Measures the throughput of pipelined method calls, keeping up to `mPipelineDepth` requests in flight.
+void BenchmarkMethodCalls(DBusConnection *aConnection)
+{
+    BenchmarkPhase                                       phase("method");
+    std::vector<std::pair<DBusPendingCall *, Timepoint>> pendingCalls;
+    uint32_t                                             sent = 0;
+    std::vector<std::string>                             propertyNames{OTBR_DBUS_PROPERTY_PANID};
+
+    while (sent < sConfig.mNumIterations || !pendingCalls.empty())
+    {
+        while (sent < sConfig.mNumIterations && pendingCalls.size() < sConfig.mPipelineDepth)
+        {
+            UniqueDBusMessage message = NewMethodCall(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_PROPERTIES_METHOD);
+            DBusPendingCall  *pending = nullptr;
+
+            sent++;
+
+            if (message == nullptr || TupleToDBusMessage(*message, std::tie(propertyNames)) != OTBR_ERROR_NONE ||
+                !dbus_connection_send_with_reply(aConnection, message.get(), &pending, DBUS_TIMEOUT_USE_DEFAULT) ||
+                pending == nullptr)
+            {
+                phase.AddFailure();
+                continue;
+            }
+
+            pendingCalls.emplace_back(pending, Clock::now());
+        }
+
+        if (!pendingCalls.empty())
+        {
+            DBusPendingCall  *pending = pendingCalls.front().first;
+            UniqueDBusMessage reply;
+
+            // Replies are delivered in order, so blocking on the oldest request doesn't stall the pipeline.
+            dbus_pending_call_block(pending);
+            reply = UniqueDBusMessage(dbus_pending_call_steal_reply(pending));
+
+            if (IsMethodReturn(reply))
+            {
+                phase.AddSample(std::chrono::duration_cast<Microseconds>(Clock::now() - pendingCalls.front().second));
+                phase.AddBytes(GetMessageSize(reply.get()));
+            }
+            else
+            {
+                phase.AddFailure();
+            }
+
+            dbus_pending_call_unref(pending);
+            pendingCalls.erase(pendingCalls.begin());
+        }
+    }
+
+    phase.Print();
+}
+
+// Measures the round trip latency of `Properties.Get` and `Properties.GetAll`, one request at a time.
+void BenchmarkPropertyCalls(DBusConnection *aConnection, const char *aName, bool aGetAll)
+{
+    BenchmarkPhase phase(aName);
+    uint32_t       iterations = aGetAll ? std::max<uint32_t>(sConfig.mNumIterations / 10, 1) : sConfig.mNumIterations;
+
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        UniqueDBusMessage message;
+        UniqueDBusMessage reply;
+        Timepoint         start;
+
+        if (aGetAll)
+        {
+            message = NewMethodCall(DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTY_GET_ALL_METHOD);
+            if (message != nullptr)
+            {
+                TupleToDBusMessage(*message, std::make_tuple(std::string(OTBR_DBUS_THREAD_INTERFACE)));
+            }
+        }
+        else
+        {
+            message = NewGetPropertyCall(OTBR_DBUS_PROPERTY_PANID);
+        }
+
+        if (message == nullptr)
+        {
+            phase.AddFailure();
+            continue;
+        }
+
+        start = Clock::now();
+        reply = CallAndWait(aConnection, message.get());
+
+        if (IsMethodReturn(reply))
+        {
+            phase.AddSample(std::chrono::duration_cast<Microseconds>(Clock::now() - start));
+            phase.AddBytes(GetMessageSize(reply.get()));
+        }
+        else
+        {
+            phase.AddFailure();
+        }
+    }
+
+    phase.Print();
+}
+
+bool GetActiveDataset(DBusConnection *aConnection, std::vector<uint8_t> &aDataset)
+{
+    bool              found   = false;
+    UniqueDBusMessage message = NewGetPropertyCall(OTBR_DBUS_PROPERTY_ACTIVE_DATASET_TLVS);
+    UniqueDBusMessage reply;
+    DBusMessageIter   iter;
+
+    VerifyOrExit(message != nullptr);
+    reply = CallAndWait(aConnection, message.get());
+    VerifyOrExit(IsMethodReturn(reply) && dbus_message_iter_init(reply.get(), &iter));
+    VerifyOrExit(DBusMessageExtractFromVariant(&iter, aDataset) == OTBR_ERROR_NONE);
+    found = !aDataset.empty();
+
+exit:
+    return found;
+}
+
+// Returns the offset of the channel number in the Channel TLV of `aDataset`, or 0 if there isn't one.
+size_t FindChannelOffset(const std::vector<uint8_t> &aDataset)
+{
+    size_t offset = 0;
+
+    for (size_t i = 0; i + 2 <= aDataset.size(); i += 2 + aDataset[i + 1])
+    {
+        if (aDataset[i] == kChannelTlvType && aDataset[i + 1] == 3 && i + 5 <= aDataset.size())
+        {
+            offset = i + 3;
+            break;
+        }
+    }
+
+    return offset;
+}
+
+bool IsPropertiesChanged(DBusMessage *aMessage)
+{
+    return dbus_message_is_signal(aMessage, DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL);
+}
+
+// Measures the delay from a property change to its PropertiesChanged signal on each of `mNumSubscribers`
+// connections. The active dataset is toggled between two channels to trigger the signal.
+void BenchmarkSignalFanOut(DBusConnection *aConnection)
+{
+    BenchmarkPhase                phase("fan-out");
+    std::vector<DBusConnection *> subscribers;
+    std::vector<uint8_t>          dataset;
+    size_t                        channelOffset;
+    std::string matchRule = "type='signal',interface='" DBUS_INTERFACE_PROPERTIES "',path='" OTBR_DBUS_OBJECT_PREFIX +
+                            sConfig.mInterfaceName + "'";
+    uint32_t rounds = std::max<uint32_t>(sConfig.mNumIterations / 100, 1);
+
+    if (!GetActiveDataset(aConnection, dataset) || (channelOffset = FindChannelOffset(dataset)) == 0)
+    {
+        printf("%-12s skipped, there is no active dataset with a channel\n", "fan-out");
+        ExitNow();
+    }
+
+    for (uint32_t i = 0; i < sConfig.mNumSubscribers; i++)
+    {
+        DBusError       error;
+        DBusConnection *subscriber;
+
+        dbus_error_init(&error);
+        subscriber = dbus_bus_get_private(DBUS_BUS_SYSTEM, &error);
+        if (subscriber != nullptr)
+        {
+            dbus_bus_add_match(subscriber, matchRule.c_str(), &error);
+            subscribers.push_back(subscriber);
+        }
+        dbus_error_free(&error);
+    }
+
+    for (uint32_t round = 0; round < rounds; round++)
+    {
+        UniqueDBusMessage message = NewMethodCall(DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTY_SET_METHOD);
+        DBusMessageIter   iter;
+        std::vector<bool> received(subscribers.size(), false);
+        size_t            numReceived = 0;
+        Timepoint         start;
+
+        dataset[channelOffset + 1] = (dataset[channelOffset + 1] == 11) ? 12 : 11;
+
+        VerifyOrExit(message != nullptr);
+        dbus_message_iter_init_append(message.get(), &iter);
+        DBusMessageEncode(&iter, std::string(OTBR_DBUS_THREAD_INTERFACE));
+        DBusMessageEncode(&iter, std::string(OTBR_DBUS_PROPERTY_ACTIVE_DATASET_TLVS));
+        DBusMessageEncodeToVariant(&iter, dataset);
+
+        start = Clock::now();
+
+        if (!IsMethodReturn(CallAndWait(aConnection, message.get())))
+        {
+            phase.AddFailure();
+            continue;
+        }
+
+        while (numReceived < subscribers.size() && Clock::now() - start < std::chrono::milliseconds(kSignalTimeoutMs))
+        {
+            for (size_t i = 0; i < subscribers.size(); i++)
+            {
+                DBusMessage *signal;
+
+                dbus_connection_read_write(subscribers[i], 0);
+
+                while ((signal = dbus_connection_pop_message(subscribers[i])) != nullptr)
+                {
+                    if (!received[i] && IsPropertiesChanged(signal))
+                    {
+                        received[i] = true;
+                        numReceived++;
+                        phase.AddSample(std::chrono::duration_cast<Microseconds>(Clock::now() - start));
+                        phase.AddBytes(GetMessageSize(signal));
+                    }
+
+                    dbus_message_unref(signal);
+                }
+            }
+        }
+
+        for (size_t i = numReceived; i < subscribers.size(); i++)
+        {
+            phase.AddFailure();
+        }
+    }
+
+    phase.Print();
+
+exit:
+    for (DBusConnection *subscriber : subscribers)
+    {
+        dbus_connection_close(subscriber);
+        dbus_connection_unref(subscriber);
+    }
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    DBusError       error;
+    DBusConnection *connection;
+
+    if (argc > 1)
+    {
+        sConfig.mNumIterations = static_cast<uint32_t>(strtoul(argv[1], nullptr, 0));
+    }
+
+    if (argc > 2)
+    {
+        sConfig.mNumSubscribers = static_cast<uint32_t>(strtoul(argv[2], nullptr, 0));
+    }
+
+    if (argc > 3)
+    {
+        sConfig.mInterfaceName = argv[3];
+    }
+
+    dbus_error_init(&error);
+    connection = dbus_bus_get(DBUS_BUS_SYSTEM, &error);
+
+    if (connection == nullptr)
+    {
+        fprintf(stderr, "Failed to connect to the system bus: %s\n", error.message);
+        dbus_error_free(&error);
+        return EXIT_FAILURE;
+    }
+
+    printf("D-Bus server benchmark: %" PRIu32 " iterations, %" PRIu32 " subscribers, interface %s\n",
+           sConfig.mNumIterations, sConfig.mNumSubscribers, sConfig.mInterfaceName.c_str());
+    BenchmarkPhase::PrintHeader();
+
+    BenchmarkMethodCalls(connection);
+    BenchmarkPropertyCalls(connection, "get", /* aGetAll */ false);
+    BenchmarkPropertyCalls(connection, "get-all", /* aGetAll */ true);
+    BenchmarkSignalFanOut(connection);
+
+    dbus_connection_unref(connection);
+    dbus_error_free(&error);
+
+    return EXIT_SUCCESS;
+}
@@ -155,6 +155,59 @@ static void CheckFeatureFlagUpdate(ThreadApiDBus *aApi)
 #endif
 }
 
+static void CheckAsyncProperties(ThreadApiDBus *aApi, DBusConnection *aConnection)
+{
+    bool     getDone           = false;
+    bool     getPropertiesDone = false;
+    uint16_t channel           = 0;
+
+    TEST_ASSERT(aApi->GetPropertyAsync<uint16_t>(OTBR_DBUS_PROPERTY_CHANNEL,
+                                                 [&channel, &getDone](ClientError aError, const uint16_t &aChannel) {
+                                                     TEST_ASSERT(aError == ClientError::ERROR_NONE);
+                                                     channel = aChannel;
+                                                     getDone = true;
+                                                 }) == ClientError::ERROR_NONE);
+    TEST_ASSERT(aApi->GetPropertiesAsync({OTBR_DBUS_PROPERTY_CHANNEL, OTBR_DBUS_PROPERTY_NETWORK_NAME},
+                                         [&channel, &getPropertiesDone](ClientError aError, DBusMessageIter *aIter) {
+                                             uint16_t    channelResult;
+                                             std::string name;
+
+                                             TEST_ASSERT(aError == ClientError::ERROR_NONE);
+                                             TEST_ASSERT(otbr::DBus::DBusMessageExtractFromVariant(
+                                                             aIter, channelResult) == OTBR_ERROR_NONE);
+                                             TEST_ASSERT(channelResult == channel);
+                                             dbus_message_iter_next(aIter);
+                                             TEST_ASSERT(otbr::DBus::DBusMessageExtractFromVariant(aIter, name) ==
+                                                         OTBR_ERROR_NONE);
+                                             getPropertiesDone = true;
+                                         }) == ClientError::ERROR_NONE);
+
+    while (!getDone || !getPropertiesDone)
+    {
+        dbus_connection_read_write_dispatch(aConnection, 0);
+    }
+}
+
+static void CheckPropertyCache(ThreadApiDBus *aApi)
+{
+    std::string region;
+
+    aApi->SetPropertyCacheMaxAge(std::chrono::seconds(10));
+
+    TEST_ASSERT(aApi->GetRadioRegion(region) == ClientError::ERROR_NONE);
+    TEST_ASSERT(region == "US");
+    TEST_ASSERT(aApi->GetRadioRegion(region) == ClientError::ERROR_NONE);
+    TEST_ASSERT(region == "US");
+
+    // Setting a property drops the cached values.
+    TEST_ASSERT(aApi->SetRadioRegion("CA") == ClientError::ERROR_NONE);
+    TEST_ASSERT(aApi->GetRadioRegion(region) == ClientError::ERROR_NONE);
+    TEST_ASSERT(region == "CA");
+    TEST_ASSERT(aApi->SetRadioRegion("US") == ClientError::ERROR_NONE);
+
+    aApi->SetPropertyCacheMaxAge(std::chrono::milliseconds(0));
+}
+
 void CheckSrpServerInfo(ThreadApiDBus *aApi)
 {
     SrpServerInfo srpServerInfo;
@@ -435,6 +488,8 @@ int main()
     });
 
     CheckFeatureFlagUpdate(api.get());
+    CheckAsyncProperties(api.get(), connection.get());
+    CheckPropertyCache(api.get());
 
     while (!stepDone)
     {
@@ -0,0 +1,193 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include <gtest/gtest.h>
+
+#include "agent/handover.hpp"
+
+using otbr::Handover;
+using otbr::Ip6Address;
+using otbr::Ip6AddressInfo;
+using otbr::Mdns::Publisher;
+
+static Handover::State MakeState(void)
+{
+    Handover::State          state;
+    Publisher::PublishedHost host;
+    Publisher::HostedService service;
+    Ip6Address               address("fd00:db8::1");
+    otIp6Address             meshLocal;
+
+    memcpy(meshLocal.mFields.m8, Ip6Address("fdde:ad00:beef:0:0:ff:fe00:fc00").m8, sizeof(meshLocal.mFields.m8));
+    state.mIp6Addresses.emplace_back(meshLocal, 64, 3, true, true);
+    state.mIp6Addresses.emplace_back(meshLocal, 128, 14, false, false);
+
+    service.mName        = "printer";
+    service.mType        = "_ipp._tcp";
+    service.mSubTypeList = {"_color", "_duplex"};
+    service.mPort        = 631;
+    service.mTxtData     = {0x05, 'k', '=', 'v', 0x00, 0xff};
+
+    host.mName      = "host1";
+    host.mAddresses = {address, Ip6Address("fd00:db8::2")};
+    host.mServices  = {service};
+    state.mHosts.push_back(host);
+
+    host.mName = "host2";
+    host.mAddresses.clear();
+    host.mServices.clear();
+    state.mHosts.push_back(host);
+
+    return state;
+}
+
+static void ExpectEqual(const Ip6AddressInfo &aExpected, const Ip6AddressInfo &aActual)
+{
+    EXPECT_EQ(memcmp(aExpected.mAddress.mFields.m8, aActual.mAddress.mFields.m8, sizeof(aExpected.mAddress)), 0);
+    EXPECT_EQ(aExpected.mPrefixLength, aActual.mPrefixLength);
+    EXPECT_EQ(aExpected.mScope, aActual.mScope);
+    EXPECT_EQ(aExpected.mPreferred, aActual.mPreferred);
+    EXPECT_EQ(aExpected.mMeshLocal, aActual.mMeshLocal);
+}
+
+TEST(Handover, TestEncodeDecodeRoundTrip)
+{
+    Handover::State      state = MakeState();
+    Handover::State      decoded;
+    std::vector<uint8_t> buffer;
+
+    state.mTunFd = 7;
+    Handover::Encode(state, buffer);
+    ASSERT_EQ(Handover::Decode(buffer.data(), buffer.size(), decoded), OTBR_ERROR_NONE);
+
+    // The TUN device is passed beside the encoded state.
+    EXPECT_EQ(decoded.mTunFd, -1);
+
+    ASSERT_EQ(decoded.mIp6Addresses.size(), state.mIp6Addresses.size());
+    for (size_t i = 0; i < state.mIp6Addresses.size(); i++)
+    {
+        ExpectEqual(state.mIp6Addresses[i], decoded.mIp6Addresses[i]);
+    }
+
+    ASSERT_EQ(decoded.mHosts.size(), state.mHosts.size());
+    for (size_t i = 0; i < state.mHosts.size(); i++)
+    {
+        const Publisher::PublishedHost &expected = state.mHosts[i];
+        const Publisher::PublishedHost &actual   = decoded.mHosts[i];
+
+        EXPECT_EQ(actual.mName, expected.mName);
+        EXPECT_EQ(actual.mAddresses, expected.mAddresses);
+        ASSERT_EQ(actual.mServices.size(), expected.mServices.size());
+        for (size_t j = 0; j < expected.mServices.size(); j++)
+        {
+            EXPECT_EQ(actual.mServices[j].mName, expected.mServices[j].mName);
+            EXPECT_EQ(actual.mServices[j].mType, expected.mServices[j].mType);
+            EXPECT_EQ(actual.mServices[j].mSubTypeList, expected.mServices[j].mSubTypeList);
+            EXPECT_EQ(actual.mServices[j].mPort, expected.mServices[j].mPort);
+            EXPECT_EQ(actual.mServices[j].mTxtData, expected.mServices[j].mTxtData);
+        }
+    }
+}
+
+TEST(Handover, TestEncodeDecodeEmptyState)
+{
+    Handover::State      decoded = MakeState();
+    std::vector<uint8_t> buffer  = {0xaa};
+
+    Handover::Encode(Handover::State(), buffer);
+    ASSERT_EQ(Handover::Decode(buffer.data(), buffer.size(), decoded), OTBR_ERROR_NONE);
+    EXPECT_TRUE(decoded.mIp6Addresses.empty());
+    EXPECT_TRUE(decoded.mHosts.empty());
+}
+
+TEST(Handover, TestDecodeTruncatedState)
+{
+    Handover::State      decoded;
+    std::vector<uint8_t> buffer;
+
+    Handover::Encode(MakeState(), buffer);
+
+    for (size_t length = 0; length < buffer.size(); length++)
+    {
+        EXPECT_EQ(Handover::Decode(buffer.data(), length, decoded), OTBR_ERROR_PARSE) << "length " << length;
+    }
+}
+
+TEST(Handover, TestDecodeRejectsTrailingBytes)
+{
+    Handover::State      decoded;
+    std::vector<uint8_t> buffer;
+
+    Handover::Encode(MakeState(), buffer);
+    buffer.push_back(0);
+    EXPECT_EQ(Handover::Decode(buffer.data(), buffer.size(), decoded), OTBR_ERROR_PARSE);
+
+    // A state appended to another one is oversized as well.
+    buffer.pop_back();
+    buffer.insert(buffer.end(), buffer.begin(), buffer.end());
+    EXPECT_EQ(Handover::Decode(buffer.data(), buffer.size(), decoded), OTBR_ERROR_PARSE);
+}
+
+TEST(Handover, TestDecodeRejectsOversizedCounts)
+{
+    Handover::State      decoded;
+    std::vector<uint8_t> buffer;
+
+    // The counts of the encoded items are larger than what follows them.
+    Handover::Encode(Handover::State(), buffer);
+    buffer[5] = 0xff;
+    buffer[6] = 0xff;
+    EXPECT_EQ(Handover::Decode(buffer.data(), buffer.size(), decoded), OTBR_ERROR_PARSE);
+
+    Handover::Encode(Handover::State(), buffer);
+    buffer[7]  = 0xff;
+    buffer[8]  = 0xff;
+    buffer[9]  = 0xff;
+    buffer[10] = 0xff;
+    EXPECT_EQ(Handover::Decode(buffer.data(), buffer.size(), decoded), OTBR_ERROR_PARSE);
+}
+
+TEST(Handover, TestDecodeRejectsBadMagicAndVersion)
+{
+    Handover::State      decoded;
+    std::vector<uint8_t> buffer;
+
+    Handover::Encode(MakeState(), buffer);
+    ASSERT_EQ(Handover::Decode(buffer.data(), buffer.size(), decoded), OTBR_ERROR_NONE);
+
+    buffer[0] ^= 0xff;
+    EXPECT_EQ(Handover::Decode(buffer.data(), buffer.size(), decoded), OTBR_ERROR_PARSE);
+    buffer[0] ^= 0xff;
+
+    buffer[4] += 1;
+    EXPECT_EQ(Handover::Decode(buffer.data(), buffer.size(), decoded), OTBR_ERROR_PARSE);
+    buffer[4] = 0;
+    EXPECT_EQ(Handover::Decode(buffer.data(), buffer.size(), decoded), OTBR_ERROR_PARSE);
+}
@@ -89,11 +89,11 @@ TEST(AsyncTask, TestNoResultReturned)
             step1 = std::move(aNext);
             stepCount++;
         })
-        ->Then([&stepCount, &step2](AsyncTaskPtr aNext) {
+        .Then([&stepCount, &step2](AsyncTaskPtr aNext) {
             step2 = std::move(aNext);
             stepCount++;
         })
-        ->Then([&stepCount, &step3](AsyncTaskPtr aNext) {
+        .Then([&stepCount, &step3](AsyncTaskPtr aNext) {
             step3 = std::move(aNext);
             stepCount++;
         });
@@ -131,11 +131,11 @@ TEST(AsyncTask, TestMultipleStepsSuccess)
             step1 = std::move(aNext);
             stepCount++;
         })
-        ->Then([&stepCount, &step2](AsyncTaskPtr aNext) {
+        .Then([&stepCount, &step2](AsyncTaskPtr aNext) {
             step2 = std::move(aNext);
             stepCount++;
         })
-        ->Then([&stepCount, &step3](AsyncTaskPtr aNext) {
+        .Then([&stepCount, &step3](AsyncTaskPtr aNext) {
             step3 = std::move(aNext);
             stepCount++;
         });
@@ -179,11 +179,11 @@ TEST(AsyncTask, TestMultipleStepsFailedHalfWay)
             step1 = std::move(aNext);
             stepCount++;
         })
-        ->Then([&stepCount, &step2](AsyncTaskPtr aNext) {
+        .Then([&stepCount, &step2](AsyncTaskPtr aNext) {
             step2 = std::move(aNext);
             stepCount++;
         })
-        ->Then([&stepCount, &step3](AsyncTaskPtr aNext) {
+        .Then([&stepCount, &step3](AsyncTaskPtr aNext) {
             step3 = std::move(aNext);
             stepCount++;
         });
@@ -198,3 +198,27 @@ TEST(AsyncTask, TestMultipleStepsFailedHalfWay)
     EXPECT_EQ(resultHandlerCalledTimes, 1);
     EXPECT_EQ(error, OT_ERROR_BUSY);
 }
+
+TEST(AsyncTask, TestStepsShareTask)
+{
+    AsyncTaskPtr task;
+    AsyncTaskPtr step1;
+    AsyncTaskPtr step2;
+    otError      error = OT_ERROR_GENERIC;
+
+    task = std::make_shared<AsyncTask>([&error](otError aError, const std::string &) { error = aError; });
+    task->First([&step1](AsyncTaskPtr aNext) { step1 = std::move(aNext); })
+        .Then([&step2](AsyncTaskPtr aNext) { step2 = std::move(aNext); });
+    task->Run();
+
+    EXPECT_EQ(task, step1);
+    step1->SetResult(OT_ERROR_NONE, "");
+    EXPECT_EQ(task, step2);
+
+    task  = nullptr;
+    step1 = nullptr;
+    EXPECT_EQ(error, OT_ERROR_GENERIC);
+
+    step2->SetResult(OT_ERROR_NONE, "");
+    EXPECT_EQ(error, OT_ERROR_NONE);
+}
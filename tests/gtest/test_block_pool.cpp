@@ -0,0 +1,92 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/block_pool.hpp"
+
+using otbr::BlockPool;
+
+TEST(BlockPool, TestReusesFreedBlocks)
+{
+    BlockPool pool(4);
+    void     *block = pool.Allocate(100);
+
+    EXPECT_NE(block, nullptr);
+    EXPECT_EQ(pool.GetNumChunks(), 1u);
+    EXPECT_EQ(pool.GetNumFreeBlocks(100), 3u);
+
+    pool.Free(block, 100);
+    EXPECT_EQ(pool.GetNumFreeBlocks(100), 4u);
+
+    // A block of the same size class is served from the free list.
+    EXPECT_EQ(pool.Allocate(120), block);
+    EXPECT_EQ(pool.GetNumChunks(), 1u);
+    pool.Free(block, 120);
+}
+
+TEST(BlockPool, TestAddsChunksOnDemand)
+{
+    BlockPool           pool(2);
+    std::vector<void *> blocks;
+
+    for (int i = 0; i < 5; i++)
+    {
+        blocks.push_back(pool.Allocate(64));
+    }
+    EXPECT_EQ(pool.GetNumChunks(), 3u);
+    EXPECT_EQ(pool.GetNumFreeBlocks(64), 1u);
+
+    for (void *block : blocks)
+    {
+        pool.Free(block, 64);
+    }
+    EXPECT_EQ(pool.GetNumFreeBlocks(64), 6u);
+
+    // Blocks of another size class get a chunk of their own.
+    pool.Free(pool.Allocate(65), 65);
+    EXPECT_EQ(pool.GetNumChunks(), 4u);
+    EXPECT_EQ(pool.GetNumFreeBlocks(64), 6u);
+    EXPECT_EQ(pool.GetNumFreeBlocks(65), 2u);
+}
+
+TEST(BlockPool, TestLargeBlocksAreNotPooled)
+{
+    BlockPool pool(4);
+    void     *block = pool.Allocate(BlockPool::kMaxBlockSize + 1);
+
+    EXPECT_NE(block, nullptr);
+    EXPECT_EQ(pool.GetNumChunks(), 0u);
+    EXPECT_EQ(pool.GetNumFreeBlocks(BlockPool::kMaxBlockSize + 1), 0u);
+
+    pool.Free(block, BlockPool::kMaxBlockSize + 1);
+    pool.Free(nullptr, 16);
+    EXPECT_EQ(pool.GetNumChunks(), 0u);
+}
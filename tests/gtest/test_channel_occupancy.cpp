@@ -0,0 +1,111 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "utils/channel_occupancy.hpp"
+
+using otbr::ChannelOccupancy;
+
+static constexpr uint32_t kChannelMask = (1U << 11) | (1U << 15) | (1U << 20);
+
+static void RecordSamples(ChannelOccupancy &aOccupancy, uint8_t aChannel, int8_t aRssi, int aCount)
+{
+    for (int i = 0; i < aCount; i++)
+    {
+        aOccupancy.Record(aChannel, aRssi);
+    }
+}
+
+TEST(ChannelOccupancy, TestQualities)
+{
+    ChannelOccupancy                       occupancy;
+    std::vector<ChannelOccupancy::Quality> qualities;
+
+    EXPECT_TRUE(occupancy.GetQualities(kChannelMask).empty());
+
+    occupancy.Record(15, -60);
+    occupancy.Record(15, -90);
+    occupancy.Record(11, -100);
+    occupancy.Record(11, ChannelOccupancy::kInvalidRssi);
+    occupancy.Record(12, -50);
+
+    qualities = occupancy.GetQualities(kChannelMask);
+    ASSERT_EQ(qualities.size(), 2u);
+    EXPECT_EQ(qualities[0].mChannel, 11);
+    EXPECT_EQ(qualities[0].mOccupancy, 0);
+    EXPECT_EQ(qualities[0].mAverageRssi, -100);
+    EXPECT_EQ(qualities[0].mSampleCount, 1u);
+    EXPECT_EQ(qualities[1].mChannel, 15);
+    EXPECT_EQ(qualities[1].mOccupancy, ChannelOccupancy::kMaxOccupancy / 2);
+    EXPECT_EQ(qualities[1].mAverageRssi, -75);
+    EXPECT_EQ(qualities[1].mSampleCount, 2u);
+
+    occupancy.Clear();
+    EXPECT_TRUE(occupancy.GetQualities(kChannelMask).empty());
+}
+
+TEST(ChannelOccupancy, TestOccupancyFollowsRecentSamples)
+{
+    ChannelOccupancy                       occupancy;
+    std::vector<ChannelOccupancy::Quality> qualities;
+
+    RecordSamples(occupancy, 20, -50, ChannelOccupancy::kSampleWindow);
+    RecordSamples(occupancy, 20, -95, 4 * ChannelOccupancy::kSampleWindow);
+
+    qualities = occupancy.GetQualities(1U << 20);
+    ASSERT_EQ(qualities.size(), 1u);
+    EXPECT_LT(qualities[0].mOccupancy, ChannelOccupancy::kMaxOccupancy / 10);
+    EXPECT_LT(qualities[0].mAverageRssi, -85);
+}
+
+TEST(ChannelOccupancy, TestRecommend)
+{
+    ChannelOccupancy occupancy;
+    uint8_t          channel = 0;
+
+    EXPECT_FALSE(occupancy.Recommend(kChannelMask, channel));
+    EXPECT_FALSE(occupancy.Recommend(0, channel));
+
+    RecordSamples(occupancy, 11, -60, ChannelOccupancy::kMinSampleCount);
+    RecordSamples(occupancy, 15, -80, ChannelOccupancy::kMinSampleCount);
+
+    // Channel 20 is not sampled enough yet.
+    RecordSamples(occupancy, 20, -80, ChannelOccupancy::kMinSampleCount - 1);
+    EXPECT_FALSE(occupancy.Recommend(kChannelMask, channel));
+
+    occupancy.Record(20, -90);
+    ASSERT_TRUE(occupancy.Recommend(kChannelMask, channel));
+    EXPECT_EQ(channel, 20);
+
+    ASSERT_TRUE(occupancy.Recommend((1U << 11) | (1U << 15), channel));
+    EXPECT_EQ(channel, 15);
+
+    ASSERT_TRUE(occupancy.Recommend(1U << 11, channel));
+    EXPECT_EQ(channel, 11);
+}
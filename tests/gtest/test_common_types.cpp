@@ -32,7 +32,57 @@
 
 //-------------------------------------------------------------
 // Test for Ip6Address
-// TODO: Add Ip6Address tests
+
+TEST(Ip6Address, LessThanOperatorUsesNetworkByteOrder)
+{
+    using otbr::Ip6Address;
+
+    EXPECT_LT(Ip6Address("::1"), Ip6Address("::2"));
+    EXPECT_LT(Ip6Address("::ff"), Ip6Address("::100"));
+    EXPECT_LT(Ip6Address("fd00::ffff"), Ip6Address("fd00:1::"));
+    EXPECT_FALSE(Ip6Address("fd00::1") < Ip6Address("fd00::1"));
+}
+
+TEST(Ip6Address, ToCharsFollowsRfc5952)
+{
+    using otbr::Ip6Address;
+
+    char buffer[INET6_ADDRSTRLEN];
+
+    EXPECT_STREQ(Ip6Address("::").ToInfoString().AsCString(), "::");
+    EXPECT_STREQ(Ip6Address("::1").ToInfoString().AsCString(), "::1");
+    EXPECT_STREQ(Ip6Address("2001:0db8:0000:0000:0000:0000:0000:0001").ToInfoString().AsCString(), "2001:db8::1");
+    EXPECT_STREQ(Ip6Address("2001:db8:0:1:1:1:1:1").ToInfoString().AsCString(), "2001:db8:0:1:1:1:1:1");
+    EXPECT_STREQ(Ip6Address("2001:0:0:1:0:0:0:1").ToInfoString().AsCString(), "2001:0:0:1::1");
+    EXPECT_STREQ(Ip6Address("2001:db8:0:0:1:0:0:1").ToInfoString().AsCString(), "2001:db8::1:0:0:1");
+    EXPECT_STREQ(Ip6Address("fe80::abcd:ef01:2345:6789").ToInfoString().AsCString(), "fe80::abcd:ef01:2345:6789");
+    EXPECT_STREQ(Ip6Address("ff02:0:0:0:0:0:0:0").ToInfoString().AsCString(), "ff02::");
+    EXPECT_STREQ(Ip6Address("::ffff:192.0.2.1").ToInfoString().AsCString(), "::ffff:192.0.2.1");
+
+    EXPECT_EQ(Ip6Address("fd00::1").ToChars(buffer), buffer + strlen("fd00::1"));
+    EXPECT_STREQ(buffer, "fd00::1");
+}
+
+TEST(Ip6Address, AppendTo)
+{
+    std::string string = "addresses:";
+
+    otbr::Ip6Address("fd00::1").AppendTo(string);
+    string += ',';
+    otbr::Ip6Address("fe80::2").AppendTo(string);
+    EXPECT_EQ(string, "addresses:fd00::1,fe80::2");
+}
+
+TEST(Ip6Address, Hash)
+{
+    using otbr::Ip6Address;
+
+    std::hash<Ip6Address> hash;
+
+    EXPECT_EQ(hash(Ip6Address("fd00::1")), hash(Ip6Address("fd00::1")));
+    EXPECT_NE(hash(Ip6Address("fd00::1")), hash(Ip6Address("fd00::2")));
+    EXPECT_NE(hash(Ip6Address("fd00::1")), hash(Ip6Address("fd01::1")));
+}
 
 //-------------------------------------------------------------
 // Test for Ip6Prefix
@@ -58,6 +108,49 @@ TEST(Ip6Prefix, ConstructorWithAddressAndLength)
     EXPECT_EQ(prefix4.mLength, 128);
 }
 
+TEST(Ip6Prefix, ToInfoString)
+{
+    using otbr::Ip6Prefix;
+
+    EXPECT_STREQ(Ip6Prefix("::", 0).ToInfoString().AsCString(), "::/0");
+    EXPECT_STREQ(Ip6Prefix("2001:db8::", 64).ToInfoString().AsCString(), "2001:db8::/64");
+    EXPECT_STREQ(Ip6Prefix("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff", 128).ToInfoString().AsCString(),
+                 "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff/128");
+
+    std::string string;
+
+    Ip6Prefix("fd00::", 8).AppendTo(string);
+    EXPECT_EQ(string, "fd00::/8");
+}
+
+TEST(Ip6Prefix, Contains)
+{
+    using otbr::Ip6Address;
+    using otbr::Ip6Prefix;
+
+    EXPECT_TRUE(Ip6Prefix("::", 0).Contains(Ip6Address("2001:db8::1")));
+    EXPECT_TRUE(Ip6Prefix("fc00::", 7).Contains(Ip6Address("fd00::1")));
+    EXPECT_FALSE(Ip6Prefix("fc00::", 7).Contains(Ip6Address("fe80::1")));
+    EXPECT_TRUE(Ip6Prefix("2001:db8::", 64).Contains(Ip6Address("2001:db8::1234")));
+    EXPECT_FALSE(Ip6Prefix("2001:db8::", 64).Contains(Ip6Address("2001:db8:0:1::1234")));
+    EXPECT_TRUE(Ip6Prefix("2001:db8::ff00", 120).Contains(Ip6Address("2001:db8::ff12")));
+    EXPECT_FALSE(Ip6Prefix("2001:db8::ff00", 120).Contains(Ip6Address("2001:db8::fe12")));
+    EXPECT_TRUE(Ip6Prefix("2001:db8::1", 128).Contains(Ip6Address("2001:db8::1")));
+    EXPECT_FALSE(Ip6Prefix("2001:db8::1", 128).Contains(Ip6Address("2001:db8::2")));
+}
+
+TEST(Ip6Prefix, Hash)
+{
+    using otbr::Ip6Prefix;
+
+    std::hash<Ip6Prefix> hash;
+
+    // Bits beyond the prefix length are ignored, consistently with the equality operator.
+    EXPECT_EQ(Ip6Prefix("2001:db8::1", 64), Ip6Prefix("2001:db8::2", 64));
+    EXPECT_EQ(hash(Ip6Prefix("2001:db8::1", 64)), hash(Ip6Prefix("2001:db8::2", 64)));
+    EXPECT_NE(hash(Ip6Prefix("2001:db8::", 64)), hash(Ip6Prefix("2001:db8::", 48)));
+}
+
 TEST(Ip6Prefix, EqualityOperator)
 {
     using otbr::Ip6Prefix;
@@ -100,4 +193,43 @@ TEST(Ip6Prefix, EqualityOperator)
 
 //-------------------------------------------------------------
 // Test for MacAddress
-// TODO: Add MacAddress tests
+
+TEST(MacAddress, ToInfoString)
+{
+    otbr::MacAddress macAddress;
+
+    macAddress.m8[0] = 0x02;
+    macAddress.m8[5] = 0xab;
+    EXPECT_STREQ(macAddress.ToInfoString().AsCString(), "02:00:00:00:00:ab");
+    EXPECT_EQ(macAddress.ToString(), "02:00:00:00:00:ab");
+
+    std::string string = "mac:";
+
+    macAddress.AppendTo(string);
+    EXPECT_EQ(string, "mac:02:00:00:00:00:ab");
+}
+
+//-------------------------------------------------------------
+// Test for MdnsLatencyHistogram
+
+TEST(MdnsLatencyHistogram, Percentiles)
+{
+    otbr::MdnsLatencyHistogram histogram{};
+
+    EXPECT_EQ(histogram.GetPercentile(50), 0u);
+
+    for (uint32_t i = 0; i < 98; i++)
+    {
+        histogram.Record(5);
+    }
+    histogram.Record(10);
+    histogram.Record(60000);
+
+    EXPECT_EQ(histogram.mBuckets[0], 98u);
+    EXPECT_EQ(histogram.mBuckets[1], 1u);
+    EXPECT_EQ(histogram.mBuckets[otbr::MdnsLatencyHistogram::kNumBuckets - 1], 1u);
+
+    EXPECT_EQ(histogram.GetPercentile(50), 10u);
+    EXPECT_EQ(histogram.GetPercentile(99), 25u);
+    EXPECT_EQ(histogram.GetPercentile(100), 30000u);
+}
@@ -0,0 +1,91 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/counter_series.hpp"
+
+using otbr::Clock;
+using otbr::CounterSeries;
+using otbr::Seconds;
+using otbr::Timepoint;
+
+TEST(CounterSeries, TestDeltas)
+{
+    CounterSeries series(2, 4);
+    Timepoint     now       = Clock::now();
+    uint64_t      values[2] = {100, 5};
+
+    series.Record(now, values);
+    EXPECT_EQ(series.GetNumIntervals(), 0);
+    EXPECT_EQ(series.GetValue(0), 100u);
+    EXPECT_EQ(series.GetRatePerMinute(0), 0u);
+
+    values[0] = 160;
+    values[1] = 5;
+    series.Record(now + Seconds(30), values);
+
+    values[0] = 220;
+    values[1] = 2; // Restarted from zero.
+    series.Record(now + Seconds(60), values);
+
+    ASSERT_EQ(series.GetNumIntervals(), 2);
+    EXPECT_EQ(series.GetIntervalDuration(0), 30000u);
+    EXPECT_EQ(series.GetDelta(0, 0), 60u);
+    EXPECT_EQ(series.GetDelta(0, 1), 0u);
+    EXPECT_EQ(series.GetDelta(1, 0), 60u);
+    EXPECT_EQ(series.GetDelta(1, 1), 2u);
+    EXPECT_EQ(series.GetValue(0), 220u);
+    EXPECT_EQ(series.GetRatePerMinute(0), 120u);
+    EXPECT_EQ(series.GetRatePerMinute(1), 2u);
+}
+
+TEST(CounterSeries, TestDropsOldestIntervals)
+{
+    CounterSeries series(1, 3);
+    Timepoint     now = Clock::now();
+
+    for (uint64_t i = 0; i <= 5; i++)
+    {
+        uint64_t value = i * i;
+
+        series.Record(now + Seconds(i * 60), &value);
+    }
+
+    // The intervals ending at 3, 4 and 5 minutes are kept.
+    ASSERT_EQ(series.GetNumIntervals(), 3);
+    EXPECT_EQ(series.GetDelta(0, 0), 5u);
+    EXPECT_EQ(series.GetDelta(1, 0), 7u);
+    EXPECT_EQ(series.GetDelta(2, 0), 9u);
+    EXPECT_EQ(series.GetIntervalDuration(2), 60000u);
+    EXPECT_EQ(series.GetRatePerMinute(0), 7u);
+
+    series.Clear();
+    EXPECT_EQ(series.GetNumIntervals(), 0);
+    EXPECT_EQ(series.GetValue(0), 0u);
+}
@@ -0,0 +1,105 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "dbus/server/dbus_dispatch_table.hpp"
+
+using otbr::DBus::DBusDispatchTable;
+
+TEST(DBusDispatchTable, FindsRegisteredMembers)
+{
+    DBusDispatchTable<int> table;
+
+    EXPECT_TRUE(table.Add("io.openthread.BorderRouter", "Attach", 1));
+    EXPECT_TRUE(table.Add("io.openthread.BorderRouter", "Detach", 2));
+    EXPECT_TRUE(table.Add("org.freedesktop.DBus.Properties", "Get", 3));
+
+    ASSERT_NE(table.Find("io.openthread.BorderRouter", "Attach"), nullptr);
+    EXPECT_EQ(*table.Find("io.openthread.BorderRouter", "Attach"), 1);
+    ASSERT_NE(table.Find("io.openthread.BorderRouter", "Detach"), nullptr);
+    EXPECT_EQ(*table.Find("io.openthread.BorderRouter", "Detach"), 2);
+    ASSERT_NE(table.Find("org.freedesktop.DBus.Properties", "Get"), nullptr);
+    EXPECT_EQ(*table.Find("org.freedesktop.DBus.Properties", "Get"), 3);
+
+    EXPECT_EQ(table.Find("io.openthread.BorderRouter", "Get"), nullptr);
+    EXPECT_EQ(table.Find("org.freedesktop.DBus.Properties", "Attach"), nullptr);
+    EXPECT_EQ(table.Find("io.openthread", "BorderRouter.Attach"), nullptr);
+}
+
+TEST(DBusDispatchTable, KeepsTheFirstHandlerOfAMember)
+{
+    DBusDispatchTable<int> table;
+
+    EXPECT_TRUE(table.Add("io.openthread.BorderRouter", "Attach", 1));
+    EXPECT_FALSE(table.Add("io.openthread.BorderRouter", "Attach", 2));
+
+    ASSERT_NE(table.Find("io.openthread.BorderRouter", "Attach"), nullptr);
+    EXPECT_EQ(*table.Find("io.openthread.BorderRouter", "Attach"), 1);
+}
+
+TEST(DBusDispatchTable, IteratesTheMembersOfAnInterface)
+{
+    DBusDispatchTable<int>   table;
+    std::vector<std::string> members;
+
+    table.Add("io.openthread.BorderRouter", "PanId", 1);
+    table.Add("io.openthread.BorderRouter.Extra", "Channel", 2);
+    table.Add("io.openthread.BorderRouter", "Channel", 3);
+    table.Add("io.openthread.Border", "Eui64", 4);
+
+    EXPECT_TRUE(table.HasInterface("io.openthread.BorderRouter"));
+    EXPECT_FALSE(table.HasInterface("io.openthread"));
+
+    EXPECT_EQ(table.ForEachInInterface("io.openthread.BorderRouter",
+                                       [&members](const std::string &aMemberName, int) {
+                                           members.push_back(aMemberName);
+                                           return OT_ERROR_NONE;
+                                       }),
+              OT_ERROR_NONE);
+    EXPECT_EQ(members, (std::vector<std::string>{"Channel", "PanId"}));
+}
+
+TEST(DBusDispatchTable, StopsIteratingOnError)
+{
+    DBusDispatchTable<int> table;
+    int                    count = 0;
+
+    table.Add("io.openthread.BorderRouter", "Channel", 1);
+    table.Add("io.openthread.BorderRouter", "PanId", 2);
+
+    EXPECT_EQ(table.ForEachInInterface("io.openthread.BorderRouter",
+                                       [&count](const std::string &, int) {
+                                           count++;
+                                           return OT_ERROR_FAILED;
+                                       }),
+              OT_ERROR_FAILED);
+    EXPECT_EQ(count, 1);
+}
@@ -0,0 +1,164 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "dbus/server/dbus_table_delta.hpp"
+
+using otbr::DBus::DBusTableDelta;
+
+namespace {
+
+struct Entry
+{
+    int mKey;
+    int mValue;
+    int mAge;
+};
+
+using Table = DBusTableDelta<int, Entry>;
+
+void Update(Table &aTable, std::vector<Entry> aEntries)
+{
+    std::vector<std::pair<int, Entry>> entries;
+
+    for (const Entry &entry : aEntries)
+    {
+        entries.emplace_back(entry.mKey, entry);
+    }
+
+    aTable.Update(std::move(entries), [](const Entry &aLhs, const Entry &aRhs) { return aLhs.mValue == aRhs.mValue; });
+}
+
+std::vector<int> Keys(const std::vector<Entry> &aEntries)
+{
+    std::vector<int> keys;
+
+    for (const Entry &entry : aEntries)
+    {
+        keys.push_back(entry.mKey);
+    }
+
+    return keys;
+}
+
+} // namespace
+
+TEST(DBusTableDelta, FirstPollIsFull)
+{
+    Table        table;
+    Table::Delta delta;
+
+    Update(table, {{1, 10, 0}, {2, 20, 0}});
+    table.GetDelta(0, delta);
+
+    EXPECT_TRUE(delta.mFull);
+    EXPECT_EQ(Keys(delta.mChanged), (std::vector<int>{1, 2}));
+    EXPECT_TRUE(delta.mRemoved.empty());
+    EXPECT_NE(delta.mVersion, 0u);
+}
+
+TEST(DBusTableDelta, ReportsChangesSinceVersion)
+{
+    Table        table;
+    Table::Delta delta;
+    uint64_t     version;
+
+    Update(table, {{1, 10, 0}, {2, 20, 0}, {3, 30, 0}});
+    table.GetDelta(0, delta);
+    version = delta.mVersion;
+
+    // Ages change constantly and don't make an entry change.
+    Update(table, {{1, 10, 5}, {2, 20, 5}, {3, 30, 5}});
+    table.GetDelta(version, delta);
+    EXPECT_FALSE(delta.mFull);
+    EXPECT_EQ(delta.mVersion, version);
+    EXPECT_TRUE(delta.mChanged.empty());
+    EXPECT_TRUE(delta.mRemoved.empty());
+
+    Update(table, {{1, 10, 6}, {2, 21, 6}, {4, 40, 0}});
+    table.GetDelta(version, delta);
+    EXPECT_FALSE(delta.mFull);
+    EXPECT_NE(delta.mVersion, version);
+    EXPECT_EQ(Keys(delta.mChanged), (std::vector<int>{2, 4}));
+    EXPECT_EQ(delta.mChanged[0].mValue, 21);
+    EXPECT_EQ(Keys(delta.mRemoved), (std::vector<int>{3}));
+    EXPECT_EQ(delta.mRemoved[0].mValue, 30);
+
+    version = delta.mVersion;
+    table.GetDelta(version, delta);
+    EXPECT_FALSE(delta.mFull);
+    EXPECT_TRUE(delta.mChanged.empty());
+    EXPECT_TRUE(delta.mRemoved.empty());
+}
+
+TEST(DBusTableDelta, UnknownVersionIsFull)
+{
+    Table        table;
+    Table        other;
+    Table::Delta delta;
+
+    Update(table, {{1, 10, 0}});
+    Update(other, {{1, 10, 0}});
+    other.GetDelta(0, delta);
+
+    table.GetDelta(delta.mVersion ^ (1ULL << 63), delta);
+    EXPECT_TRUE(delta.mFull);
+    EXPECT_EQ(Keys(delta.mChanged), (std::vector<int>{1}));
+
+    table.GetDelta(delta.mVersion + 1, delta);
+    EXPECT_TRUE(delta.mFull);
+}
+
+TEST(DBusTableDelta, ForgottenRemovalsForceFullTable)
+{
+    Table              table;
+    Table::Delta       delta;
+    uint64_t           version;
+    std::vector<Entry> entries;
+
+    for (int i = 0; i < Table::kMaxRemovedEntries + 1; i++)
+    {
+        entries.push_back({i, i, 0});
+    }
+
+    Update(table, entries);
+    table.GetDelta(0, delta);
+    version = delta.mVersion;
+
+    Update(table, {{0, 0, 0}});
+    table.GetDelta(version, delta);
+    EXPECT_FALSE(delta.mFull);
+    EXPECT_EQ(delta.mRemoved.size(), static_cast<size_t>(Table::kMaxRemovedEntries));
+
+    Update(table, {});
+    table.GetDelta(version, delta);
+    EXPECT_TRUE(delta.mFull);
+    EXPECT_TRUE(delta.mChanged.empty());
+    EXPECT_TRUE(delta.mRemoved.empty());
+}
@@ -0,0 +1,108 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include "common/dns_name_key.hpp"
+
+using otbr::DnsNameKey;
+
+TEST(DnsNameKey, TestInternIgnoresCase)
+{
+    size_t     numInterned = DnsNameKey::GetNumInterned();
+    DnsNameKey key1        = DnsNameKey::Intern("MyHost.Local.");
+    DnsNameKey key2        = DnsNameKey::Intern("myhost.local.");
+    DnsNameKey key3        = DnsNameKey::Intern("other.local.");
+
+    EXPECT_FALSE(key1.IsNull());
+    EXPECT_EQ(key1, key2);
+    EXPECT_NE(key1, key3);
+    EXPECT_EQ(key1.GetHash(), key2.GetHash());
+    EXPECT_EQ(key1.GetName(), "myhost.local.");
+    EXPECT_EQ(DnsNameKey::GetNumInterned(), numInterned + 2);
+}
+
+TEST(DnsNameKey, TestCompositeName)
+{
+    DnsNameKey key = DnsNameKey::Intern("Instance", "_Test._udp");
+
+    EXPECT_EQ(key.GetName(), "instance._test._udp");
+    EXPECT_EQ(key, DnsNameKey::Find("INSTANCE._test._UDP"));
+    EXPECT_EQ(key, DnsNameKey::Find("instance", "_test._udp"));
+    EXPECT_NE(key, DnsNameKey::Find("instance", "_test._udp", '|'));
+}
+
+TEST(DnsNameKey, TestFindDoesNotIntern)
+{
+    size_t     numInterned = DnsNameKey::GetNumInterned();
+    DnsNameKey key         = DnsNameKey::Find("not-interned.local.");
+
+    EXPECT_TRUE(key.IsNull());
+    EXPECT_EQ(key, DnsNameKey());
+    EXPECT_EQ(key.GetName(), "");
+    EXPECT_EQ(DnsNameKey::GetNumInterned(), numInterned);
+}
+
+TEST(DnsNameKey, TestReleasedWithLastKey)
+{
+    size_t numInterned = DnsNameKey::GetNumInterned();
+
+    {
+        DnsNameKey key1 = DnsNameKey::Intern("released.local.");
+        DnsNameKey key2 = key1;
+        DnsNameKey key3 = std::move(key1);
+
+        EXPECT_TRUE(key1.IsNull());
+        EXPECT_EQ(key2, key3);
+        EXPECT_EQ(DnsNameKey::GetNumInterned(), numInterned + 1);
+
+        key2 = DnsNameKey();
+        EXPECT_FALSE(DnsNameKey::Find("released.local.").IsNull());
+    }
+
+    EXPECT_EQ(DnsNameKey::GetNumInterned(), numInterned);
+    EXPECT_TRUE(DnsNameKey::Find("released.local.").IsNull());
+}
+
+TEST(DnsNameKey, TestUnorderedMapKey)
+{
+    std::unordered_map<DnsNameKey, int, DnsNameKey::Hash> map;
+
+    map[DnsNameKey::Intern("Host1")] = 1;
+    map[DnsNameKey::Intern("host2")] = 2;
+
+    EXPECT_EQ(map.at(DnsNameKey::Find("HOST1")), 1);
+    EXPECT_EQ(map.at(DnsNameKey::Find("Host2")), 2);
+    EXPECT_EQ(map.count(DnsNameKey::Find("host3")), 0u);
+
+    map.erase(DnsNameKey::Find("host1"));
+    EXPECT_TRUE(DnsNameKey::Find("host1").IsNull());
+}
@@ -0,0 +1,179 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "utils/dns_upstream_cache.hpp"
+
+using otbr::DnsUpstreamCache;
+using otbr::Seconds;
+using otbr::Timepoint;
+
+static const uint16_t kTypeA   = 1;
+static const uint16_t kTypeSoa = 6;
+
+static void AppendUint16(std::vector<uint8_t> &aMessage, uint16_t aValue)
+{
+    aMessage.push_back(static_cast<uint8_t>(aValue >> 8));
+    aMessage.push_back(static_cast<uint8_t>(aValue));
+}
+
+static void AppendUint32(std::vector<uint8_t> &aMessage, uint32_t aValue)
+{
+    AppendUint16(aMessage, static_cast<uint16_t>(aValue >> 16));
+    AppendUint16(aMessage, static_cast<uint16_t>(aValue));
+}
+
+static uint32_t ReadUint32(const std::vector<uint8_t> &aMessage, size_t aOffset)
+{
+    return (static_cast<uint32_t>(aMessage[aOffset]) << 24) | (static_cast<uint32_t>(aMessage[aOffset + 1]) << 16) |
+           (static_cast<uint32_t>(aMessage[aOffset + 2]) << 8) | aMessage[aOffset + 3];
+}
+
+// Builds a message with the question "<aLabel>.com" of type A followed by the header counts of the records.
+static std::vector<uint8_t> MakeMessage(uint16_t    aId,
+                                        uint16_t    aFlags,
+                                        const char *aLabel,
+                                        uint16_t    aAnswerCount,
+                                        uint16_t    aAuthorityCount)
+{
+    std::vector<uint8_t> message;
+
+    AppendUint16(message, aId);
+    AppendUint16(message, aFlags);
+    AppendUint16(message, 1);
+    AppendUint16(message, aAnswerCount);
+    AppendUint16(message, aAuthorityCount);
+    AppendUint16(message, 0);
+
+    message.push_back(static_cast<uint8_t>(strlen(aLabel)));
+    message.insert(message.end(), aLabel, aLabel + strlen(aLabel));
+    message.push_back(3);
+    message.insert(message.end(), {'c', 'o', 'm', 0});
+    AppendUint16(message, kTypeA);
+    AppendUint16(message, 1);
+
+    return message;
+}
+
+// Appends a record named by a pointer to the question name.
+static void AppendRecord(std::vector<uint8_t>       &aMessage,
+                         uint16_t                    aType,
+                         uint32_t                    aTtl,
+                         const std::vector<uint8_t> &aData)
+{
+    aMessage.insert(aMessage.end(), {0xc0, 0x0c});
+    AppendUint16(aMessage, aType);
+    AppendUint16(aMessage, 1);
+    AppendUint32(aMessage, aTtl);
+    AppendUint16(aMessage, static_cast<uint16_t>(aData.size()));
+    aMessage.insert(aMessage.end(), aData.begin(), aData.end());
+}
+
+static std::vector<uint8_t> MakeSoaData(uint32_t aMinimum)
+{
+    std::vector<uint8_t> data = {0xc0, 0x0c, 0xc0, 0x0c};
+
+    for (int i = 0; i < 4; i++)
+    {
+        AppendUint32(data, 0);
+    }
+    AppendUint32(data, aMinimum);
+
+    return data;
+}
+
+TEST(DnsUpstreamCache, TestAnswersFromCacheWithDecreasedTtl)
+{
+    DnsUpstreamCache     cache;
+    Timepoint            now      = Timepoint() + Seconds(1000);
+    std::vector<uint8_t> response = MakeMessage(0x1234, 0x8180, "Example", 1, 0);
+    std::vector<uint8_t> query    = MakeMessage(0xabcd, 0x0100, "example", 0, 0);
+    std::vector<uint8_t> answer;
+    size_t               ttlOffset;
+
+    AppendRecord(response, kTypeA, 100, {192, 0, 2, 1});
+    ttlOffset = response.size() - 4 - 2 - 4;
+
+    EXPECT_FALSE(cache.Lookup(query.data(), query.size(), now, answer));
+    cache.Store(response.data(), response.size(), now);
+    EXPECT_EQ(cache.GetSize(), 1u);
+
+    ASSERT_TRUE(cache.Lookup(query.data(), query.size(), now + Seconds(30), answer));
+    ASSERT_EQ(answer.size(), response.size());
+    EXPECT_EQ(answer[0], 0xab);
+    EXPECT_EQ(answer[1], 0xcd);
+    EXPECT_EQ(ReadUint32(answer, ttlOffset), 70u);
+
+    EXPECT_FALSE(cache.Lookup(query.data(), query.size(), now + Seconds(100), answer));
+    EXPECT_EQ(cache.GetSize(), 0u);
+
+    EXPECT_EQ(cache.GetCounters().mHits, 1u);
+    EXPECT_EQ(cache.GetCounters().mMisses, 2u);
+}
+
+TEST(DnsUpstreamCache, TestCachesNegativeResponsesWithSoa)
+{
+    DnsUpstreamCache     cache;
+    Timepoint            now      = Timepoint() + Seconds(1000);
+    std::vector<uint8_t> response = MakeMessage(0x1234, 0x8183, "missing", 0, 1);
+    std::vector<uint8_t> query    = MakeMessage(0x4321, 0x0100, "missing", 0, 0);
+    std::vector<uint8_t> answer;
+
+    // The negative TTL is the SOA minimum as it is smaller than the TTL of the SOA record.
+    AppendRecord(response, kTypeSoa, 600, MakeSoaData(60));
+    cache.Store(response.data(), response.size(), now);
+
+    EXPECT_TRUE(cache.Lookup(query.data(), query.size(), now + Seconds(59), answer));
+    EXPECT_FALSE(cache.Lookup(query.data(), query.size(), now + Seconds(60), answer));
+}
+
+TEST(DnsUpstreamCache, TestSkipsUncacheableResponses)
+{
+    DnsUpstreamCache     cache;
+    Timepoint            now       = Timepoint() + Seconds(1000);
+    std::vector<uint8_t> noSoa     = MakeMessage(0x1234, 0x8183, "nosoa", 0, 0);
+    std::vector<uint8_t> truncated = MakeMessage(0x1234, 0x8380, "truncated", 1, 0);
+    std::vector<uint8_t> failure   = MakeMessage(0x1234, 0x8182, "failure", 0, 0);
+    std::vector<uint8_t> zeroTtl   = MakeMessage(0x1234, 0x8180, "zerottl", 1, 0);
+    std::vector<uint8_t> malformed = MakeMessage(0x1234, 0x8180, "malformed", 1, 0);
+
+    AppendRecord(truncated, kTypeA, 100, {192, 0, 2, 1});
+    AppendRecord(zeroTtl, kTypeA, 0, {192, 0, 2, 1});
+
+    for (const std::vector<uint8_t> *response : {&noSoa, &truncated, &failure, &zeroTtl, &malformed})
+    {
+        cache.Store(response->data(), response->size(), now);
+    }
+
+    EXPECT_EQ(cache.GetSize(), 0u);
+}
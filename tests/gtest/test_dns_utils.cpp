@@ -63,6 +63,19 @@ static void CheckSplitFullDnsName(const std::string &aFullName,
     EXPECT_EQ(aServiceName, info.mServiceName);
     EXPECT_EQ(aHostName, info.mHostName);
     EXPECT_EQ(aDomain, info.mDomain);
+
+    for (const std::string &name : {aFullName, aFullName + "."})
+    {
+        DnsNameView view = SplitFullDnsNameView(name);
+
+        EXPECT_EQ(aIsServiceInstance, view.IsServiceInstance());
+        EXPECT_EQ(aIsService, view.IsService());
+        EXPECT_EQ(aIsHost, view.IsHost());
+        EXPECT_EQ(aInstanceName, view.mInstanceName.ToString());
+        EXPECT_EQ(aServiceName, view.mServiceName.ToString());
+        EXPECT_EQ(aHostName, view.mHostName.ToString());
+        EXPECT_EQ(aDomain, view.mDomain.ToString() + ".");
+    }
 }
 
 TEST(DnsUtils, TestSplitFullDnsName)
@@ -92,3 +105,39 @@ TEST(DnsUtils, TestSplitFullDnsName)
     CheckSplitFullDnsName("com", false, false, true, "", "", "com", ".");
     CheckSplitFullDnsName("", false, false, true, "", "", "", ".");
 }
+
+TEST(DnsUtils, TestSplitFullNameViews)
+{
+    std::string      fullName = "Instance.Name._ipps._tcp.default.service.arpa.";
+    otbr::StringView instanceName;
+    otbr::StringView type;
+    otbr::StringView domain;
+
+    EXPECT_EQ(OTBR_ERROR_NONE, SplitFullServiceInstanceName(fullName, instanceName, type, domain));
+    EXPECT_EQ(fullName.data(), instanceName.Data());
+    EXPECT_EQ("Instance.Name", instanceName.ToString());
+    EXPECT_EQ("_ipps._tcp", type.ToString());
+    EXPECT_EQ("default.service.arpa", domain.ToString());
+    EXPECT_EQ(OTBR_ERROR_INVALID_ARGS, SplitFullServiceName(fullName, type, domain));
+    EXPECT_EQ(OTBR_ERROR_INVALID_ARGS, SplitFullHostName(fullName, instanceName, domain));
+
+    EXPECT_EQ(OTBR_ERROR_NONE, SplitFullServiceName("_meshcop._udp.local", type, domain));
+    EXPECT_EQ("_meshcop._udp", type.ToString());
+    EXPECT_EQ("local", domain.ToString());
+
+    EXPECT_EQ(OTBR_ERROR_NONE, SplitFullHostName("host.local.", instanceName, domain));
+    EXPECT_EQ("host", instanceName.ToString());
+    EXPECT_EQ("local", domain.ToString());
+}
+
+TEST(DnsUtils, TestDnsNamesEqual)
+{
+    EXPECT_TRUE(DnsLabelsEqual("_IPPS._tcp", "_ipps._TCP"));
+    EXPECT_FALSE(DnsLabelsEqual("_ipps._tcp", "_ipps._udp"));
+    EXPECT_FALSE(DnsLabelsEqual("local", "local."));
+
+    EXPECT_TRUE(DnsNamesEqual("Default.Service.Arpa", "default.service.arpa."));
+    EXPECT_TRUE(DnsNamesEqual("local.", "LOCAL"));
+    EXPECT_FALSE(DnsNamesEqual("local", "local.."));
+    EXPECT_FALSE(DnsNamesEqual("local", "locals"));
+}
@@ -0,0 +1,68 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/flat_set.hpp"
+
+TEST(FlatSet, TestAssignSortsAndRemovesDuplicates)
+{
+    otbr::FlatSet<int> set;
+    std::vector<int>   values   = {3, 1, 2, 3, 1};
+    std::vector<int>   expected = {1, 2, 3};
+
+    EXPECT_TRUE(set.IsEmpty());
+
+    set.Assign(values.begin(), values.end());
+    EXPECT_EQ(set.GetSize(), 3u);
+    EXPECT_EQ(std::vector<int>(set.begin(), set.end()), expected);
+    EXPECT_TRUE(set.Contains(2));
+    EXPECT_FALSE(set.Contains(4));
+}
+
+TEST(FlatSet, TestInsertAndErase)
+{
+    otbr::FlatSet<int> set;
+    std::vector<int>   expected = {1, 2, 3};
+
+    EXPECT_TRUE(set.Insert(3));
+    EXPECT_TRUE(set.Insert(1));
+    EXPECT_TRUE(set.Insert(2));
+    EXPECT_FALSE(set.Insert(2));
+    EXPECT_EQ(std::vector<int>(set.begin(), set.end()), expected);
+
+    EXPECT_TRUE(set.Erase(2));
+    EXPECT_FALSE(set.Erase(2));
+    EXPECT_FALSE(set.Contains(2));
+    EXPECT_EQ(set.GetSize(), 2u);
+
+    set.Clear();
+    EXPECT_TRUE(set.IsEmpty());
+}
@@ -41,6 +41,7 @@ public:
     InfraIfDependencyTest(void)
         : mInfraIfIndex(0)
         , mIsRunning(false)
+        , mSetInfraIfCount(0)
     {
     }
 
@@ -51,6 +52,7 @@ public:
         mInfraIfIndex = aInfraIfIndex;
         mIsRunning    = aIsRunning;
         mIp6Addresses = aIp6Addresses;
+        mSetInfraIfCount++;
 
         return OTBR_ERROR_NONE;
     }
@@ -58,6 +60,7 @@ public:
     unsigned int                  mInfraIfIndex;
     bool                          mIsRunning;
     std::vector<otbr::Ip6Address> mIp6Addresses;
+    uint32_t                      mSetInfraIfCount;
 };
 
 TEST(InfraIf, DepsSetInfraIfInvokedCorrectly_AfterSpecifyingInfraIf)
@@ -86,4 +89,28 @@ TEST(InfraIf, DepsSetInfraIfInvokedCorrectly_AfterSpecifyingInfraIf)
     EXPECT_THAT(testInfraIfDep.mIp6Addresses, ::testing::Contains(otbr::Ip6Address(kTestAddr)));
 }
 
+TEST(InfraIf, DepsSetInfraIfNotInvokedAgain_WhenStateUnchanged)
+{
+    const std::string fakeInfraIf = "wlx123";
+
+    otbr::Netif::Dependencies defaultNetifDep;
+    otbr::Netif               netif(defaultNetifDep);
+    EXPECT_EQ(netif.Init(fakeInfraIf), OTBR_ERROR_NONE);
+
+    InfraIfDependencyTest testInfraIfDep;
+    otbr::InfraIf         infraIf(testInfraIfDep);
+    infraIf.Init();
+
+    EXPECT_EQ(infraIf.SetInfraIf(fakeInfraIf.c_str()), OTBR_ERROR_NONE);
+    EXPECT_EQ(testInfraIfDep.mSetInfraIfCount, 1);
+
+    uint32_t generation = infraIf.GetStateGeneration();
+
+    EXPECT_EQ(infraIf.SetInfraIf(fakeInfraIf.c_str()), OTBR_ERROR_NONE);
+    EXPECT_EQ(infraIf.GetStateGeneration(), generation);
+    EXPECT_EQ(testInfraIfDep.mSetInfraIfCount, 1);
+
+    infraIf.Deinit();
+}
+
 #endif // __linux__
@@ -0,0 +1,101 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "utils/link_metrics_history.hpp"
+
+using otbr::Clock;
+using otbr::LinkMetricsHistory;
+using otbr::Seconds;
+using otbr::Timepoint;
+
+TEST(LinkMetricsHistory, TestSummary)
+{
+    LinkMetricsHistory          history;
+    LinkMetricsHistory::Summary summary;
+    Timepoint                   now = Clock::now();
+
+    EXPECT_FALSE(history.GetSummary(1, summary));
+
+    history.Record(1, {20, -70}, now);
+    history.Record(1, {10, -80}, now + Seconds(1));
+    history.Record(1, {30, -60}, now + Seconds(2));
+
+    ASSERT_TRUE(history.GetSummary(1, summary));
+    EXPECT_EQ(summary.mSampleCount, 3);
+    EXPECT_EQ(summary.mLatest.mLinkMargin, 30);
+    EXPECT_EQ(summary.mLatest.mRssi, -60);
+    EXPECT_EQ(summary.mMinLinkMargin, 10);
+    EXPECT_EQ(summary.mMinRssi, -80);
+    EXPECT_EQ(summary.mAverageLinkMargin, 20);
+    EXPECT_EQ(summary.mAverageRssi, -70);
+    EXPECT_TRUE(summary.mLastSampleTime == now + Seconds(2));
+}
+
+TEST(LinkMetricsHistory, TestRingDropsOldestSamples)
+{
+    LinkMetricsHistory          history;
+    LinkMetricsHistory::Summary summary;
+    Timepoint                   now = Clock::now();
+
+    history.Record(1, {0, -100}, now);
+
+    for (int i = 0; i < LinkMetricsHistory::kMaxSamples; i++)
+    {
+        history.Record(1, {40, -50}, now);
+    }
+
+    ASSERT_TRUE(history.GetSummary(1, summary));
+    EXPECT_EQ(summary.mSampleCount, LinkMetricsHistory::kMaxSamples);
+    EXPECT_EQ(summary.mMinLinkMargin, 40);
+    EXPECT_EQ(summary.mMinRssi, -50);
+    EXPECT_EQ(summary.mAverageLinkMargin, 40);
+    EXPECT_EQ(summary.mAverageRssi, -50);
+}
+
+TEST(LinkMetricsHistory, TestRemoveStale)
+{
+    LinkMetricsHistory history;
+    Timepoint          now   = Clock::now();
+    int                count = 0;
+
+    history.Record(1, {20, -70}, now);
+    history.Record(2, {20, -70}, now + Seconds(10));
+    EXPECT_EQ(history.GetNeighborCount(), 2u);
+
+    history.RemoveStale(now + Seconds(5));
+    EXPECT_EQ(history.GetNeighborCount(), 1u);
+
+    history.ForEach([&count](uint64_t aExtAddress, const LinkMetricsHistory::Summary &aSummary) {
+        EXPECT_EQ(aExtAddress, 2u);
+        EXPECT_EQ(aSummary.mSampleCount, 1);
+        count++;
+    });
+    EXPECT_EQ(count, 1);
+}
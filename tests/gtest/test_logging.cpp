@@ -34,6 +34,7 @@
 
 #include <gtest/gtest.h>
 
+#include "common/log_ring.hpp"
 #include "common/logging.hpp"
 
 TEST(Logging, TestLoggingHigherLevel)
@@ -128,3 +129,150 @@ TEST(Logging, TestLoggingDump)
     snprintf(cmd, sizeof(cmd), "grep '%s.*: foobar: 0020: 6f 66 20 74 65 78 74 00' /var/log/syslog", ident);
     EXPECT_EQ(system(cmd), 0);
 }
+
+static int sEvaluatedCount = 0;
+
+static int CountEvaluation(void)
+{
+    return ++sEvaluatedCount;
+}
+
+TEST(Logging, TestLoggingFilteredArgumentsNotEvaluated)
+{
+    sEvaluatedCount = 0;
+    otbrLogInit("otbr-test", OTBR_LOG_INFO, true, true);
+
+    otbrLogDebug("filtered %d", CountEvaluation());
+    EXPECT_EQ(sEvaluatedCount, 0);
+    EXPECT_FALSE(otbrLogIsEnabled(OTBR_LOG_DEBUG));
+
+    otbrLogInfo("emitted %d", CountEvaluation());
+    EXPECT_EQ(sEvaluatedCount, 1);
+    EXPECT_TRUE(otbrLogIsEnabled(OTBR_LOG_INFO));
+
+    otbrLogDeinit();
+}
+
+TEST(Logging, TestTagLevel)
+{
+    sEvaluatedCount = 0;
+    otbrLogInit("otbr-test", OTBR_LOG_INFO, true, true);
+
+    EXPECT_EQ(otbrLogSetTagLevel(OTBR_LOG_TAG, OTBR_LOG_DEBUG), OTBR_ERROR_NONE);
+    EXPECT_EQ(otbrLogGetTagLevel(OTBR_LOG_TAG), OTBR_LOG_DEBUG);
+    EXPECT_EQ(otbrLogGetTagLevel("OTHER"), OTBR_LOG_INFO);
+    EXPECT_EQ(otbrLogGetTagLevel(nullptr), OTBR_LOG_INFO);
+    EXPECT_TRUE(otbrLogIsEnabled(OTBR_LOG_DEBUG));
+
+    otbrLogDebug("emitted %d", CountEvaluation());
+    EXPECT_EQ(sEvaluatedCount, 1);
+
+    EXPECT_EQ(otbrLogSetTagLevel(OTBR_LOG_TAG, OTBR_LOG_WARNING), OTBR_ERROR_NONE);
+    otbrLogInfo("filtered %d", CountEvaluation());
+    EXPECT_EQ(sEvaluatedCount, 1);
+
+    EXPECT_EQ(otbrLogClearTagLevel(OTBR_LOG_TAG), OTBR_ERROR_NONE);
+    EXPECT_EQ(otbrLogClearTagLevel(OTBR_LOG_TAG), OTBR_ERROR_NOT_FOUND);
+    EXPECT_EQ(otbrLogGetTagLevel(OTBR_LOG_TAG), OTBR_LOG_INFO);
+
+    EXPECT_EQ(otbrLogSetTagLevel("", OTBR_LOG_DEBUG), OTBR_ERROR_INVALID_ARGS);
+    EXPECT_EQ(otbrLogSetTagLevel("A-VERY-LONG-LOG-TAG", OTBR_LOG_DEBUG), OTBR_ERROR_INVALID_ARGS);
+
+    EXPECT_EQ(otbrLogSetTagLevel(OTBR_LOG_TAG, OTBR_LOG_DEBUG), OTBR_ERROR_NONE);
+    otbrLogDeinit();
+    EXPECT_EQ(otbrLogGetTagLevel(OTBR_LOG_TAG), OTBR_LOG_INFO);
+}
+
+TEST(Logging, TestLogRateLimiter)
+{
+    otbr::LogRateLimiter limiter(100);
+    uint32_t             suppressed = 0;
+
+    EXPECT_TRUE(limiter.Allow(suppressed));
+    EXPECT_EQ(suppressed, 0u);
+
+    EXPECT_FALSE(limiter.Allow(suppressed));
+    EXPECT_FALSE(limiter.Allow(suppressed));
+
+    usleep(150 * 1000);
+
+    EXPECT_TRUE(limiter.Allow(suppressed));
+    EXPECT_EQ(suppressed, 2u);
+}
+
+TEST(Logging, TestLoggingAsync)
+{
+    char ident[32];
+    char cmd[128];
+
+    snprintf(ident, sizeof(ident), "otbr-test-%ld", clock());
+    otbrLogInit(ident, OTBR_LOG_INFO, true, false);
+    otbrLogSetAsyncEnabled(true);
+    otbrLog(OTBR_LOG_INFO, OTBR_LOG_TAG, "cool-async");
+    otbrLogDeinit();
+    sleep(0);
+
+    snprintf(cmd, sizeof(cmd), "grep '%s.*cool-async' /var/log/syslog", ident);
+    EXPECT_EQ(system(cmd), 0);
+}
+
+TEST(LogRing, TestPeekReturnsLinesInOrder)
+{
+    otbr::LogRing              ring;
+    otbr::LogRing::Line       *line;
+    const otbr::LogRing::Line *peeked;
+    uint32_t                   first;
+    uint32_t                   second;
+
+    EXPECT_EQ(ring.Peek(), nullptr);
+
+    ASSERT_NE(line = ring.Reserve(first), nullptr);
+    line->mLevel = OTBR_LOG_INFO;
+    snprintf(line->mText, sizeof(line->mText), "first");
+
+    ASSERT_NE(line = ring.Reserve(second), nullptr);
+    line->mLevel = OTBR_LOG_WARNING;
+    snprintf(line->mText, sizeof(line->mText), "second");
+
+    // A line is not visible before it is committed, even if a later line is.
+    ring.Commit(second);
+    EXPECT_EQ(ring.Peek(), nullptr);
+
+    ring.Commit(first);
+    ASSERT_NE(peeked = ring.Peek(), nullptr);
+    EXPECT_STREQ(peeked->mText, "first");
+    EXPECT_EQ(peeked->mLevel, OTBR_LOG_INFO);
+    ring.Release();
+
+    ASSERT_NE(peeked = ring.Peek(), nullptr);
+    EXPECT_STREQ(peeked->mText, "second");
+    ring.Release();
+
+    EXPECT_EQ(ring.Peek(), nullptr);
+}
+
+TEST(LogRing, TestDropsWhenFull)
+{
+    otbr::LogRing ring;
+    uint32_t      position;
+
+    for (uint32_t i = 0; i < otbr::LogRing::kNumSlots; i++)
+    {
+        otbr::LogRing::Line *line = ring.Reserve(position);
+
+        ASSERT_NE(line, nullptr);
+        snprintf(line->mText, sizeof(line->mText), "%u", i);
+        ring.Commit(position);
+    }
+
+    EXPECT_EQ(ring.Reserve(position), nullptr);
+    EXPECT_EQ(ring.Reserve(position), nullptr);
+    EXPECT_EQ(ring.GetDroppedCount(), 2u);
+
+    // Releasing the oldest line makes room for a new one.
+    ASSERT_NE(ring.Peek(), nullptr);
+    EXPECT_STREQ(ring.Peek()->mText, "0");
+    ring.Release();
+    EXPECT_NE(ring.Reserve(position), nullptr);
+    EXPECT_EQ(ring.GetDroppedCount(), 2u);
+}
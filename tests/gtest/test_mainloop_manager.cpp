@@ -0,0 +1,246 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include "common/mainloop_manager.hpp"
+
+static void RunMainloopOnce(void)
+{
+    int                   rval;
+    otbr::MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {0, 100000};
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    otbr::MainloopManager::GetInstance().Update(mainloop);
+    rval = otbr::MainloopManager::Poll(mainloop);
+    EXPECT_TRUE(rval >= 0 || errno == EINTR);
+
+    otbr::MainloopManager::GetInstance().Process(mainloop);
+}
+
+TEST(MainloopManager, TestPersistentFd)
+{
+    int     fds[2];
+    int     counter    = 0;
+    uint8_t lastEvents = 0;
+    uint8_t byte       = 0;
+    auto   &manager    = otbr::MainloopManager::GetInstance();
+
+    ASSERT_EQ(0, pipe(fds));
+
+    EXPECT_EQ(OTBR_ERROR_NONE, manager.AddFd(fds[0], otbr::MainloopContext::kReadFdSet, [&](uint8_t aEvents) {
+        lastEvents = aEvents;
+        ++counter;
+        EXPECT_EQ(1, read(fds[0], &byte, sizeof(byte)));
+    }));
+    EXPECT_EQ(OTBR_ERROR_DUPLICATED, manager.AddFd(fds[0], otbr::MainloopContext::kReadFdSet, [](uint8_t) {}));
+
+    RunMainloopOnce();
+    EXPECT_EQ(0, counter);
+
+    ASSERT_EQ(1, write(fds[1], &byte, sizeof(byte)));
+    RunMainloopOnce();
+    EXPECT_EQ(1, counter);
+    EXPECT_EQ(otbr::MainloopContext::kReadFdSet, lastEvents);
+
+    // The handler is not called when there is no interested event.
+    EXPECT_EQ(OTBR_ERROR_NONE, manager.UpdateFd(fds[0], 0));
+    ASSERT_EQ(1, write(fds[1], &byte, sizeof(byte)));
+    RunMainloopOnce();
+    EXPECT_EQ(1, counter);
+
+    EXPECT_EQ(OTBR_ERROR_NONE, manager.UpdateFd(fds[0], otbr::MainloopContext::kReadFdSet));
+    RunMainloopOnce();
+    EXPECT_EQ(2, counter);
+
+    manager.RemoveFd(fds[0]);
+    EXPECT_EQ(OTBR_ERROR_NOT_FOUND, manager.UpdateFd(fds[0], otbr::MainloopContext::kReadFdSet));
+    ASSERT_EQ(1, write(fds[1], &byte, sizeof(byte)));
+    RunMainloopOnce();
+    EXPECT_EQ(2, counter);
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST(MainloopManager, TestRemoveFdInHandler)
+{
+    int     fds[2];
+    int     counter = 0;
+    auto   &manager = otbr::MainloopManager::GetInstance();
+
+    ASSERT_EQ(0, pipe(fds));
+
+    EXPECT_EQ(OTBR_ERROR_NONE, manager.AddFd(fds[1], otbr::MainloopContext::kWriteFdSet, [&](uint8_t aEvents) {
+        EXPECT_EQ(otbr::MainloopContext::kWriteFdSet, aEvents);
+        ++counter;
+        manager.RemoveFd(fds[1]);
+    }));
+
+    RunMainloopOnce();
+    RunMainloopOnce();
+    EXPECT_EQ(1, counter);
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+class OrderRecorder : public otbr::MainloopProcessor
+{
+public:
+    OrderRecorder(Priority aPriority, char aName, std::string &aOrder)
+        : MainloopProcessor(aPriority)
+        , mName(aName)
+        , mOrder(aOrder)
+    {
+    }
+
+    void Update(otbr::MainloopContext &) override {}
+    void Process(const otbr::MainloopContext &) override { mOrder.push_back(mName); }
+
+private:
+    char         mName;
+    std::string &mOrder;
+};
+
+TEST(MainloopManager, TestProcessInPriorityOrder)
+{
+    std::string   order;
+    OrderRecorder management(otbr::MainloopProcessor::kPriorityManagement, 'm', order);
+    OrderRecorder network1(otbr::MainloopProcessor::kPriorityNetwork, 'n', order);
+    OrderRecorder radio(otbr::MainloopProcessor::kPriorityRadio, 'r', order);
+    OrderRecorder network2(otbr::MainloopProcessor::kPriorityNetwork, 'N', order);
+
+    RunMainloopOnce();
+
+    EXPECT_STREQ("rnNm", order.c_str());
+}
+
+TEST(MainloopStats, TestHistogram)
+{
+    otbr::DurationHistogram histogram;
+
+    histogram.Record(otbr::Microseconds(0));
+    histogram.Record(otbr::Microseconds(100));
+    histogram.Record(otbr::Microseconds(4999));
+    histogram.Record(otbr::Microseconds(-1));
+    histogram.Record(otbr::Milliseconds(200));
+
+    EXPECT_EQ(5u, histogram.GetCount());
+    EXPECT_EQ(100u + 4999u + 200000u, histogram.GetSum());
+    EXPECT_EQ(200000u, histogram.GetMax());
+    EXPECT_EQ(2u, histogram.GetBucketCount(0));
+    EXPECT_EQ(1u, histogram.GetBucketCount(1));
+    EXPECT_EQ(1u, histogram.GetBucketCount(3));
+    EXPECT_EQ(1u, histogram.GetBucketCount(otbr::Histogram::kNumBuckets - 1));
+
+    histogram.Clear();
+    EXPECT_EQ(0u, histogram.GetCount());
+    EXPECT_EQ(0u, histogram.GetBucketCount(0));
+}
+
+#if OTBR_ENABLE_MAINLOOP_STATS
+class NamedProcessor : public otbr::MainloopProcessor
+{
+public:
+    const char *GetName(void) const override { return "NamedProcessor"; }
+    void        Update(otbr::MainloopContext &) override {}
+    void        Process(const otbr::MainloopContext &) override {}
+};
+
+TEST(MainloopStats, TestProcessorStats)
+{
+    auto          &manager = otbr::MainloopManager::GetInstance();
+    NamedProcessor processor1;
+    NamedProcessor processor2;
+
+    manager.ClearStats();
+
+    RunMainloopOnce();
+    RunMainloopOnce();
+
+    const otbr::MainloopStats &stats = manager.GetStats();
+    auto                       it    = stats.mProcessorStats.find("NamedProcessor");
+
+    ASSERT_NE(stats.mProcessorStats.end(), it);
+    EXPECT_EQ(4u, it->second.mUpdateTime.GetCount());
+    EXPECT_EQ(4u, it->second.mProcessTime.GetCount());
+    EXPECT_EQ(2u, stats.mIterationTime.GetCount());
+    EXPECT_EQ(2u, stats.mFdWakeupCount + stats.mTimeoutWakeupCount);
+}
+
+TEST(MainloopStats, TestWakeupCount)
+{
+    int   fds[2];
+    char  byte    = 0;
+    auto &manager = otbr::MainloopManager::GetInstance();
+
+    ASSERT_EQ(0, pipe(fds));
+    EXPECT_EQ(OTBR_ERROR_NONE, manager.AddFd(fds[0], otbr::MainloopContext::kReadFdSet, [&](uint8_t) {
+        EXPECT_EQ(1, read(fds[0], &byte, sizeof(byte)));
+    }));
+
+    manager.ClearStats();
+
+    RunMainloopOnce();
+    EXPECT_EQ(0u, manager.GetStats().mFdWakeupCount);
+    EXPECT_EQ(1u, manager.GetStats().mTimeoutWakeupCount);
+
+    ASSERT_EQ(1, write(fds[1], &byte, sizeof(byte)));
+    RunMainloopOnce();
+    EXPECT_EQ(1u, manager.GetStats().mFdWakeupCount);
+    EXPECT_EQ(1u, manager.GetStats().mTimeoutWakeupCount);
+
+    manager.RemoveFd(fds[0]);
+    close(fds[0]);
+    close(fds[1]);
+}
+#endif // OTBR_ENABLE_MAINLOOP_STATS
+
+TEST(MainloopManager, TestCoarseClock)
+{
+    otbr::Timepoint now;
+
+    RunMainloopOnce();
+    now = otbr::CoarseClock::Now();
+    usleep(1000);
+    EXPECT_EQ(now, otbr::CoarseClock::Now());
+
+    RunMainloopOnce();
+    EXPECT_LT(now, otbr::CoarseClock::Now());
+    EXPECT_LE(otbr::CoarseClock::Now(), otbr::Clock::now());
+}
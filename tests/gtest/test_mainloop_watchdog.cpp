@@ -0,0 +1,96 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "common/mainloop_watchdog.hpp"
+#include "common/task_runner.hpp"
+
+using otbr::MainloopWatchdog;
+using otbr::Milliseconds;
+
+TEST(MainloopWatchdog, TestStallAttributedToTask)
+{
+    MainloopWatchdog       &watchdog = MainloopWatchdog::Get();
+    uint64_t                stalls   = watchdog.GetStallCount();
+    otbr::MainloopContext   mainloop;
+    otbr::TaskRunner        taskRunner;
+    uint32_t                postLine;
+    MainloopWatchdog::Stall stall;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {10, 0};
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    watchdog.Start(Milliseconds(20));
+
+    postLine = __LINE__ + 1;
+    taskRunner.Post([]() { usleep(200 * 1000); });
+
+    taskRunner.Update(mainloop);
+    watchdog.EnterProcessor("SlowProcessor");
+    taskRunner.Process(mainloop);
+    watchdog.LeaveProcessor();
+
+    watchdog.Stop();
+
+    // The stall is reported once though it lasts several watchdog periods.
+    EXPECT_EQ(watchdog.GetStallCount(), stalls + 1);
+
+    stall = watchdog.GetLastStall();
+    ASSERT_NE(stall.mProcessorName, nullptr);
+    EXPECT_STREQ(stall.mProcessorName, "SlowProcessor");
+    ASSERT_NE(stall.mTaskLocation.mFile, nullptr);
+    EXPECT_NE(strstr(stall.mTaskLocation.mFile, "test_mainloop_watchdog.cpp"), nullptr);
+    EXPECT_EQ(stall.mTaskLocation.mLine, postLine);
+    EXPECT_GE(stall.mDuration, Milliseconds(20));
+}
+
+TEST(MainloopWatchdog, TestNoStallBelowThreshold)
+{
+    MainloopWatchdog &watchdog = MainloopWatchdog::Get();
+    uint64_t          stalls   = watchdog.GetStallCount();
+
+    watchdog.Start(Milliseconds(1000));
+
+    for (int i = 0; i < 10; i++)
+    {
+        watchdog.EnterProcessor("FastProcessor");
+        usleep(10 * 1000);
+        watchdog.LeaveProcessor();
+    }
+
+    watchdog.Stop();
+
+    EXPECT_EQ(watchdog.GetStallCount(), stalls);
+}
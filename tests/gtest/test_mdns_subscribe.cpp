@@ -184,6 +184,21 @@ void CheckHostAdded(const Publisher::DiscoveredHostInfo &aHostInfo,
     EXPECT_EQ(AsSet(aAddresses), AsSet(aHostInfo.mAddresses));
 }
 
+TEST_F(MdnsTest, EncodeTxtDataIntoBuffer)
+{
+    uint8_t buffer[16];
+    size_t  length;
+
+    EXPECT_EQ(Publisher::EncodeTxtData(sTxtList1, buffer, sizeof(buffer), length), OTBR_ERROR_NONE);
+    EXPECT_EQ(Publisher::TxtData(buffer, buffer + length), sTxtData1);
+
+    EXPECT_EQ(Publisher::EncodeTxtData(Publisher::TxtList{}, buffer, sizeof(buffer), length), OTBR_ERROR_NONE);
+    EXPECT_EQ(length, 1u);
+    EXPECT_EQ(buffer[0], 0);
+
+    EXPECT_EQ(Publisher::EncodeTxtData(sTxtList1, buffer, sTxtData1.size() - 1, length), OTBR_ERROR_INVALID_ARGS);
+}
+
 TEST_F(MdnsTest, SubscribeHost)
 {
     std::unique_ptr<Publisher>    pub = CreatePublisher();
@@ -325,3 +340,84 @@ TEST_F(MdnsTest, SubscribeServiceType)
     CheckServiceInstanceAdded(lastInstanceInfo, "host2.local.", {sAddr4}, "service3", 44444, {});
     clearLastInstance();
 }
+
+TEST_F(MdnsTest, SubscribeServiceTypeWithFilter)
+{
+    std::unique_ptr<Publisher> pub = CreatePublisher();
+    std::vector<std::string>   matchedTypes;
+    std::vector<std::string>   otherTypes;
+
+    pub->AddSubscriptionCallbacks(
+        [&matchedTypes](const std::string &aType, const Publisher::DiscoveredInstanceInfo &) {
+            matchedTypes.push_back(aType);
+        },
+        nullptr, "_TEST._tcp");
+    pub->AddSubscriptionCallbacks(
+        [&otherTypes](const std::string &aType, const Publisher::DiscoveredInstanceInfo &) {
+            otherTypes.push_back(aType);
+        },
+        nullptr, "_other._tcp");
+    pub->SubscribeService("_test._tcp", "");
+
+    pub->PublishHost("host1", Publisher::AddressList{sAddr1}, NoOpCallback());
+    pub->PublishService("host1", "service1", "_test._tcp", {}, 11111, {}, NoOpCallback());
+    RunMainloopUntilTimeout(kTimeoutSeconds);
+    EXPECT_FALSE(matchedTypes.empty());
+    EXPECT_TRUE(otherTypes.empty());
+}
+
+TEST_F(MdnsTest, SubscribeServiceTypeSharedByUsers)
+{
+    std::unique_ptr<Publisher>        pub = CreatePublisher();
+    std::string                       lastServiceType;
+    Publisher::DiscoveredInstanceInfo lastInstanceInfo{};
+
+    auto clearLastInstance = [&lastServiceType, &lastInstanceInfo] {
+        lastServiceType  = "";
+        lastInstanceInfo = {};
+    };
+
+    pub->AddSubscriptionCallbacks(
+        [&lastServiceType, &lastInstanceInfo](const std::string                &aType,
+                                              Publisher::DiscoveredInstanceInfo aInstanceInfo) {
+            lastServiceType  = aType;
+            lastInstanceInfo = aInstanceInfo;
+        },
+        nullptr);
+    pub->SubscribeService("_test._tcp", "");
+
+    pub->PublishHost("host1", Publisher::AddressList{sAddr1, sAddr2}, NoOpCallback());
+    pub->PublishService("host1", "service1", "_test._tcp", {}, 11111, sTxtData1, NoOpCallback());
+    RunMainloopUntilTimeout(kTimeoutSeconds);
+    EXPECT_EQ("_test._tcp", lastServiceType);
+    CheckServiceInstanceAdded(lastInstanceInfo, "host1.local.", {sAddr1, sAddr2}, "service1", 11111, sTxtData1);
+    clearLastInstance();
+
+    // A second user of the service and a user of the instance are answered from the cache.
+    pub->SubscribeService("_test._tcp", "");
+    RunMainloopUntilTimeout(1);
+    EXPECT_EQ("_test._tcp", lastServiceType);
+    CheckServiceInstanceAdded(lastInstanceInfo, "host1.local.", {sAddr1, sAddr2}, "service1", 11111, sTxtData1);
+    clearLastInstance();
+
+    pub->SubscribeService("_TEST._tcp", "service1");
+    RunMainloopUntilTimeout(1);
+    EXPECT_EQ("_test._tcp", lastServiceType);
+    CheckServiceInstanceAdded(lastInstanceInfo, "host1.local.", {sAddr1, sAddr2}, "service1", 11111, sTxtData1);
+    clearLastInstance();
+
+    // The service is still browsed after one of its users unsubscribes.
+    pub->UnsubscribeService("_test._tcp", "");
+    pub->PublishService("host1", "service2", "_test._tcp", {}, 22222, {}, NoOpCallback());
+    RunMainloopUntilTimeout(kTimeoutSeconds);
+    EXPECT_EQ("_test._tcp", lastServiceType);
+    CheckServiceInstanceAdded(lastInstanceInfo, "host1.local.", {sAddr1, sAddr2}, "service2", 22222, {});
+    clearLastInstance();
+
+    // Once the service is not browsed, only the subscribed instance is reported.
+    pub->UnsubscribeService("_test._tcp", "");
+    pub->PublishService("host1", "service3", "_test._tcp", {}, 33333, {}, NoOpCallback());
+    RunMainloopUntilTimeout(kTimeoutSeconds);
+    EXPECT_NE("service3", lastInstanceInfo.mName);
+    clearLastInstance();
+}
@@ -0,0 +1,84 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/memory_usage.hpp"
+
+using otbr::EstimateHeapBytes;
+using otbr::MemoryUsage;
+using otbr::MemoryUsageRegistry;
+
+TEST(MemoryUsage, TestEstimateHeapBytes)
+{
+    std::string                          shortString = "a";
+    std::string                          longString(100, 'a');
+    std::vector<uint32_t>                vector;
+    std::unordered_map<std::string, int> map;
+
+    EXPECT_EQ(EstimateHeapBytes(shortString), 0u);
+    EXPECT_GE(EstimateHeapBytes(longString), 101u);
+
+    vector.reserve(10);
+    EXPECT_EQ(EstimateHeapBytes(vector), vector.capacity() * sizeof(uint32_t));
+
+    map[longString] = 1;
+    EXPECT_GT(EstimateHeapBytes(map), EstimateHeapBytes(longString));
+}
+
+TEST(MemoryUsage, TestRegistry)
+{
+    MemoryUsageRegistry     &registry = MemoryUsageRegistry::Get();
+    int                      owner1;
+    int                      owner2;
+    std::vector<std::string> names;
+
+    registry.Add(&owner1, "first", []() { return MemoryUsage{1, 10}; });
+    registry.Add(&owner2, "second", []() { return MemoryUsage{2, 20}; });
+    registry.Add(&owner1, "third", []() { return MemoryUsage{3, 30}; });
+
+    registry.ForEach([&names](const char *aName, const MemoryUsage &aUsage) {
+        names.push_back(aName);
+        EXPECT_EQ(aUsage.mBytes, aUsage.mEntries * 10u);
+    });
+    EXPECT_EQ(names, (std::vector<std::string>{"first", "second", "third"}));
+
+    registry.Remove(&owner1);
+    names.clear();
+    registry.ForEach([&names](const char *aName, const MemoryUsage &) { names.push_back(aName); });
+    EXPECT_EQ(names, std::vector<std::string>{"second"});
+
+    registry.Remove(&owner2);
+    names.clear();
+    registry.ForEach([&names](const char *aName, const MemoryUsage &) { names.push_back(aName); });
+    EXPECT_TRUE(names.empty());
+}
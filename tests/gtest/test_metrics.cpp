@@ -0,0 +1,133 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/metrics.hpp"
+
+using otbr::Metrics::Counter;
+using otbr::Metrics::Gauge;
+using otbr::Metrics::Histogram;
+using otbr::Metrics::Registry;
+
+TEST(Metrics, TestHistogram)
+{
+    Histogram histogram({10, 100});
+
+    histogram.Observe(0);
+    histogram.Observe(10);
+    histogram.Observe(11);
+    histogram.Observe(1000);
+
+    EXPECT_EQ(histogram.GetBucketCount(0), 2u);
+    EXPECT_EQ(histogram.GetBucketCount(1), 1u);
+    EXPECT_EQ(histogram.GetBucketCount(2), 1u);
+    EXPECT_EQ(histogram.GetCount(), 4u);
+    EXPECT_EQ(histogram.GetSum(), 1021u);
+}
+
+TEST(Metrics, TestCounterIsLockFree)
+{
+    Counter                  counter;
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < 4; i++)
+    {
+        threads.emplace_back([&counter]() {
+            for (int j = 0; j < 1000; j++)
+            {
+                counter.Increment();
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(counter.Get(), 4000u);
+}
+
+TEST(Metrics, TestRegistryReturnsExistingMetric)
+{
+    Registry  registry;
+    Counter  &counter1 = registry.AddCounter("test_shared_events", "Events.", "kind=\"a\"");
+    Counter  &counter2 = registry.AddCounter("test_shared_events", "Events.", "kind=\"a\"");
+    Counter  &counter3 = registry.AddCounter("test_shared_events", "Events.", "kind=\"b\"");
+
+    EXPECT_EQ(&counter1, &counter2);
+    EXPECT_NE(&counter1, &counter3);
+}
+
+TEST(Metrics, TestWriteOpenMetrics)
+{
+    Registry    registry;
+    Counter    &counter   = registry.AddCounter("test_requests", "Requests handled.", "method=\"get\"");
+    Gauge      &gauge     = registry.AddGauge("test_connections", "Open connections.");
+    Histogram  &histogram = registry.AddHistogram("test_latency_ms", "Latency.", {10}, "op=\"x\"");
+    std::string output;
+
+    counter.Increment(3);
+    gauge.Add(2);
+    gauge.Add(-1);
+    histogram.Observe(5);
+    histogram.Observe(50);
+
+    registry.WriteOpenMetrics(output);
+
+    EXPECT_NE(output.find("# TYPE test_requests counter\n"
+                          "# HELP test_requests Requests handled.\n"
+                          "test_requests_total{method=\"get\"} 3\n"),
+              std::string::npos);
+    EXPECT_NE(output.find("# TYPE test_connections gauge\n"
+                          "# HELP test_connections Open connections.\n"
+                          "test_connections 1\n"),
+              std::string::npos);
+    EXPECT_NE(output.find("test_latency_ms_bucket{op=\"x\",le=\"10\"} 1\n"
+                          "test_latency_ms_bucket{op=\"x\",le=\"+Inf\"} 2\n"
+                          "test_latency_ms_count{op=\"x\"} 2\n"
+                          "test_latency_ms_sum{op=\"x\"} 55\n"),
+              std::string::npos);
+    EXPECT_EQ(output.substr(output.size() - 6), "# EOF\n");
+}
+
+TEST(Metrics, TestProcessRegistryKeepsMetrics)
+{
+    Counter &counter = Registry::Get().AddCounter("test_process_events", "Events.");
+    uint64_t before  = counter.Get();
+
+    counter.Increment(2);
+
+    EXPECT_EQ(&Registry::Get().AddCounter("test_process_events", "Events."), &counter);
+    EXPECT_EQ(counter.Get() - before, 2u);
+}
@@ -0,0 +1,98 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/mpsc_queue.hpp"
+
+TEST(MpscQueue, TestSingleThread)
+{
+    otbr::MpscQueue<int> queue;
+    int                  value;
+
+    EXPECT_FALSE(queue.Pop(value));
+
+    queue.Push(1);
+    queue.Push(2);
+    EXPECT_TRUE(queue.Pop(value));
+    EXPECT_EQ(1, value);
+
+    queue.Push(3);
+    EXPECT_TRUE(queue.Pop(value));
+    EXPECT_EQ(2, value);
+    EXPECT_TRUE(queue.Pop(value));
+    EXPECT_EQ(3, value);
+    EXPECT_FALSE(queue.Pop(value));
+
+    // Make sure remaining elements are freed.
+    queue.Push(4);
+}
+
+TEST(MpscQueue, TestMultipleProducers)
+{
+    static constexpr int kNumProducers = 4;
+    static constexpr int kNumValues    = 10000;
+
+    otbr::MpscQueue<int>     queue;
+    std::vector<std::thread> producers;
+    std::vector<int>         lastValues(kNumProducers, -1);
+    int                      count = 0;
+    int                      value;
+
+    for (int i = 0; i < kNumProducers; i++)
+    {
+        producers.emplace_back([&queue, i]() {
+            for (int j = 0; j < kNumValues; j++)
+            {
+                queue.Push(i * kNumValues + j);
+            }
+        });
+    }
+
+    // Values from the same producer must be popped in the order they were pushed.
+    while (count < kNumProducers * kNumValues)
+    {
+        if (queue.Pop(value))
+        {
+            EXPECT_LT(lastValues[value / kNumValues], value % kNumValues);
+            lastValues[value / kNumValues] = value % kNumValues;
+            ++count;
+        }
+    }
+
+    for (auto &producer : producers)
+    {
+        producer.join();
+    }
+
+    EXPECT_FALSE(queue.Pop(value));
+}
@@ -38,6 +38,7 @@
 #include <netinet/in.h>
 #include <netinet/ip6.h>
 #include <netinet/udp.h>
+#include <poll.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -46,10 +47,12 @@
 #include <sys/select.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <unistd.h>
 #include <vector>
 
 #ifdef __linux__
 #include <linux/if_link.h>
+#include <linux/ipv6.h>
 #endif
 
 #include <openthread/ip6.h>
@@ -464,25 +467,75 @@ TEST(Netif, WpanIfStateChangesCorrectly_AfterSettingNetifState)
     netif.Deinit();
 }
 
-TEST(Netif, WpanIfRecvIp6PacketCorrectly_AfterReceivingFromNetif)
+// Udp Packet
+// Ip6 source: fd2a:c30c:87d3:1:ed1c:c91:ccb6:578a
+// Ip6 destination: fd2a:c30c:87d3:1:ed1c:c91:ccb6:578b
+// Udp destination port: 12345
+// Udp payload: "Hello Otbr Netif!"
+static const uint8_t kUdpPacket[] = {0x60, 0x0e, 0xea, 0x69, 0x00, 0x19, 0x11, 0x40, 0xfd, 0x2a, 0xc3, 0x0c, 0x87,
+                                     0xd3, 0x00, 0x01, 0xed, 0x1c, 0x0c, 0x91, 0xcc, 0xb6, 0x57, 0x8a, 0xfd, 0x2a,
+                                     0xc3, 0x0c, 0x87, 0xd3, 0x00, 0x01, 0xed, 0x1c, 0x0c, 0x91, 0xcc, 0xb6, 0x57,
+                                     0x8b, 0xe7, 0x08, 0x30, 0x39, 0x00, 0x19, 0x36, 0x81, 0x48, 0x65, 0x6c, 0x6c,
+                                     0x6f, 0x20, 0x4f, 0x74, 0x62, 0x72, 0x20, 0x4e, 0x65, 0x74, 0x69, 0x66, 0x21};
+
+// Runs one mainloop iteration of `aNetif`, which writes the packets queued by `Ip6Receive()` to the TUN device.
+static void ProcessNetif(otbr::Netif &aNetif)
 {
-    otbr::Netif netif(sDefaultNetifDependencies);
-    EXPECT_EQ(netif.Init("wpan0"), OTBR_ERROR_NONE);
+    otbr::MainloopContext context;
 
-    const otIp6Address kOmr = {
-        {0xfd, 0x2a, 0xc3, 0x0c, 0x87, 0xd3, 0x00, 0x01, 0xed, 0x1c, 0x0c, 0x91, 0xcc, 0xb6, 0x57, 0x8b}};
-    std::vector<otbr::Ip6AddressInfo> addrs = {
-        {kOmr, 64, 0, 1, 0},
-    };
-    netif.UpdateIp6UnicastAddresses(addrs);
-    netif.SetNetifState(true);
+    context.mMaxFd   = -1;
+    context.mTimeout = {0, 0};
+    FD_ZERO(&context.mReadFdSet);
+    FD_ZERO(&context.mWriteFdSet);
+    FD_ZERO(&context.mErrorFdSet);
+    aNetif.UpdateFdSet(&context);
+
+    // `UpdateFdSet()` puts the TUN fd into the error set, which must be cleared by `select()` before `Process()`.
+    EXPECT_GE(select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                     &context.mTimeout),
+              0);
+    aNetif.Process(&context);
+}
+
+// Processes `aNetif` until a UDP payload is received on `aSockFd`, for at most 100 ms.
+static bool ReceiveUdpPayload(otbr::Netif &aNetif, int aSockFd, std::string &aPayload)
+{
+    static constexpr int kMaxAttempts = 10;
+    static constexpr int kPollTimeout = 10; // In milliseconds.
+
+    uint8_t recvBuf[kMaxIp6Size];
+    bool    received = false;
+
+    for (int i = 0; i < kMaxAttempts && !received; i++)
+    {
+        struct pollfd pollFd = {aSockFd, POLLIN, 0};
+        ssize_t       n;
+
+        ProcessNetif(aNetif);
+
+        if (poll(&pollFd, 1, kPollTimeout) > 0 && (n = recv(aSockFd, recvBuf, sizeof(recvBuf), 0)) >= 0)
+        {
+            aPayload.assign(reinterpret_cast<const char *>(recvBuf), static_cast<size_t>(n));
+            received = true;
+        }
+    }
+
+    return received;
+}
+
+// Binds a UDP socket to the destination of `kUdpPacket` and waits until the kernel delivers packets written to the
+// TUN device to it. The kernel drops them while the address is tentative, which lasts for an unspecified time after
+// the link goes up, so a packet is resent until one gets through, for at most 5 seconds.
+static int OpenUdpSocketWhenReachable(otbr::Netif &aNetif)
+{
+    static constexpr int kMaxProbes = 50;
 
-    // Receive UDP packets on wpan address with specified port.
-    int                 sockFd;
     const uint16_t      port = 12345;
     struct sockaddr_in6 listenAddr;
     const char         *listenIp = "fd2a:c30c:87d3:1:ed1c:c91:ccb6:578b";
-    uint8_t             recvBuf[kMaxIp6Size];
+    int                 sockFd;
+    std::string         payload;
+    bool                reachable = false;
 
     if ((sockFd = socket(AF_INET6, SOCK_DGRAM, 0)) < 0)
     {
@@ -501,27 +554,132 @@ TEST(Netif, WpanIfRecvIp6PacketCorrectly_AfterReceivingFromNetif)
         exit(EXIT_FAILURE);
     }
 
-    // Udp Packet
-    // Ip6 source: fd2a:c30c:87d3:1:ed1c:c91:ccb6:578a
-    // Ip6 destination: fd2a:c30c:87d3:1:ed1c:c91:ccb6:578b
-    // Udp destination port: 12345
-    // Udp payload: "Hello Otbr Netif!"
-    const uint8_t udpPacket[] = {0x60, 0x0e, 0xea, 0x69, 0x00, 0x19, 0x11, 0x40, 0xfd, 0x2a, 0xc3, 0x0c, 0x87,
-                                 0xd3, 0x00, 0x01, 0xed, 0x1c, 0x0c, 0x91, 0xcc, 0xb6, 0x57, 0x8a, 0xfd, 0x2a,
-                                 0xc3, 0x0c, 0x87, 0xd3, 0x00, 0x01, 0xed, 0x1c, 0x0c, 0x91, 0xcc, 0xb6, 0x57,
-                                 0x8b, 0xe7, 0x08, 0x30, 0x39, 0x00, 0x19, 0x36, 0x81, 0x48, 0x65, 0x6c, 0x6c,
-                                 0x6f, 0x20, 0x4f, 0x74, 0x62, 0x72, 0x20, 0x4e, 0x65, 0x74, 0x69, 0x66, 0x21};
-    netif.Ip6Receive(udpPacket, sizeof(udpPacket));
-
-    socklen_t   len = sizeof(listenAddr);
-    int         n   = recvfrom(sockFd, (char *)recvBuf, kMaxIp6Size, MSG_WAITALL, (struct sockaddr *)&listenAddr, &len);
-    std::string udpPayload(reinterpret_cast<const char *>(recvBuf), n);
+    for (int i = 0; i < kMaxProbes && !reachable; i++)
+    {
+        aNetif.Ip6Receive(kUdpPacket, sizeof(kUdpPacket));
+        reachable = ReceiveUdpPayload(aNetif, sockFd, payload);
+    }
+
+    EXPECT_TRUE(reachable);
+    EXPECT_EQ(payload, "Hello Otbr Netif!");
+
+    return sockFd;
+}
+
+TEST(Netif, WpanIfRecvIp6PacketCorrectly_AfterReceivingFromNetif)
+{
+    otbr::Netif netif(sDefaultNetifDependencies);
+    EXPECT_EQ(netif.Init("wpan0"), OTBR_ERROR_NONE);
+
+    const otIp6Address kOmr = {
+        {0xfd, 0x2a, 0xc3, 0x0c, 0x87, 0xd3, 0x00, 0x01, 0xed, 0x1c, 0x0c, 0x91, 0xcc, 0xb6, 0x57, 0x8b}};
+    std::vector<otbr::Ip6AddressInfo> addrs = {
+        {kOmr, 64, 0, 1, 0},
+    };
+    netif.UpdateIp6UnicastAddresses(addrs);
+    netif.SetNetifState(true);
+
+    // Receive UDP packets on wpan address with specified port.
+    int         sockFd = OpenUdpSocketWhenReachable(netif);
+    std::string udpPayload;
+
+    netif.Ip6Receive(kUdpPacket, sizeof(kUdpPacket));
+    EXPECT_TRUE(ReceiveUdpPayload(netif, sockFd, udpPayload));
     EXPECT_EQ(udpPayload, "Hello Otbr Netif!");
 
     close(sockFd);
     netif.Deinit();
 }
 
+TEST(Netif, WpanIfRecvIp6PacketBurstCorrectly_AfterReceivingFromNetif)
+{
+    otbr::Netif netif(sDefaultNetifDependencies);
+    EXPECT_EQ(netif.Init("wpan0"), OTBR_ERROR_NONE);
+
+    const otIp6Address kOmr = {
+        {0xfd, 0x2a, 0xc3, 0x0c, 0x87, 0xd3, 0x00, 0x01, 0xed, 0x1c, 0x0c, 0x91, 0xcc, 0xb6, 0x57, 0x8b}};
+    std::vector<otbr::Ip6AddressInfo> addrs = {
+        {kOmr, 64, 0, 1, 0},
+    };
+    netif.UpdateIp6UnicastAddresses(addrs);
+    netif.SetNetifState(true);
+
+    int          sockFd     = OpenUdpSocketWhenReachable(netif);
+    const size_t kBurstSize = 8;
+
+    // Packets received in a burst are queued and written to the TUN device by `Process()`.
+    for (size_t i = 0; i < kBurstSize; i++)
+    {
+        netif.Ip6Receive(kUdpPacket, sizeof(kUdpPacket));
+    }
+
+    for (size_t i = 0; i < kBurstSize; i++)
+    {
+        std::string udpPayload;
+
+        EXPECT_TRUE(ReceiveUdpPayload(netif, sockFd, udpPayload));
+        EXPECT_EQ(udpPayload, "Hello Otbr Netif!");
+    }
+
+    close(sockFd);
+    netif.Deinit();
+}
+
+TEST(Netif, WpanIfRestoresUnicastAddress_AfterExternalRemoval)
+{
+    const char *wpan = "wpan0";
+
+    const otIp6Address kOmr = {
+        {0xfd, 0x2a, 0xc3, 0x0c, 0x87, 0xd3, 0x00, 0x01, 0xed, 0x1c, 0x0c, 0x91, 0xcc, 0xb6, 0x57, 0x8b}};
+    const char *kOmrStr = "fd2a:c30c:87d3:1:ed1c:c91:ccb6:578b";
+
+    otbr::Netif netif(sDefaultNetifDependencies);
+    EXPECT_EQ(netif.Init(wpan), OTBR_ERROR_NONE);
+
+    std::vector<otbr::Ip6AddressInfo> addrs = {
+        {kOmr, 64, 0, 1, 0},
+    };
+    netif.UpdateIp6UnicastAddresses(addrs);
+    netif.SetNetifState(true);
+    EXPECT_THAT(GetAllIp6Addrs(wpan), ::testing::Contains(kOmrStr));
+
+    // Remove the address behind the back of `Netif`.
+    struct in6_ifreq ifr6;
+    int              fd = socket(AF_INET6, SOCK_DGRAM, 0);
+
+    ASSERT_GE(fd, 0);
+    memset(&ifr6, 0, sizeof(ifr6));
+    memcpy(&ifr6.ifr6_addr, kOmr.mFields.m8, sizeof(ifr6.ifr6_addr));
+    ifr6.ifr6_prefixlen = 64;
+    ifr6.ifr6_ifindex   = static_cast<int>(if_nametoindex(wpan));
+    ASSERT_EQ(ioctl(fd, SIOCDIFADDR, &ifr6), 0);
+    close(fd);
+    EXPECT_THAT(GetAllIp6Addrs(wpan), ::testing::Not(::testing::Contains(kOmrStr)));
+
+    // The netlink event about the removal is expected to restore the address.
+    for (int i = 0; i < 10; i++)
+    {
+        otbr::MainloopContext context;
+
+        context.mMaxFd   = -1;
+        context.mTimeout = {0, 100000};
+        FD_ZERO(&context.mReadFdSet);
+        FD_ZERO(&context.mWriteFdSet);
+        FD_ZERO(&context.mErrorFdSet);
+        netif.UpdateFdSet(&context);
+        if (select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                   &context.mTimeout) <= 0)
+        {
+            continue;
+        }
+        netif.Process(&context);
+    }
+
+    EXPECT_THAT(GetAllIp6Addrs(wpan), ::testing::Contains(kOmrStr));
+
+    netif.Deinit();
+}
+
 class NetifDependencyTestIp6Send : public otbr::Netif::Dependencies
 {
 public:
@@ -722,4 +880,67 @@ TEST(Netif, WpanIfUpdateMulAddrSubscription_AfterAppJoiningMulGrp)
     netif.Deinit();
 }
 
+TEST(Netif, WpanIfSkipsMulAddrSubscription_AfterAppJoiningAndLeavingMulGrp)
+{
+    bool                      received = false;
+    otIp6Address              subscribedMulAddr;
+    bool                      isAdded = false;
+    NetifDependencyTestMulSub dependency(received, subscribedMulAddr, isAdded);
+    const char               *multicastGroup = "ff99::2";
+    const char               *wpan           = "wpan0";
+    int                       sockFd;
+    otbr::Netif               netif(dependency);
+    struct ipv6_mreq          mreq;
+    otbr::Timepoint           deadline;
+
+    EXPECT_EQ(netif.Init("wpan0"), OT_ERROR_NONE);
+
+    const otIp6Address kLl = {
+        {0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x14, 0x03, 0x32, 0x4c, 0xc2, 0xf8, 0xd0}};
+    std::vector<otbr::Ip6AddressInfo> addrs = {
+        {kLl, 64, 0, 1, 0},
+    };
+    netif.UpdateIp6UnicastAddresses(addrs);
+    netif.SetNetifState(true);
+
+    if ((sockFd = socket(AF_INET6, SOCK_DGRAM, 0)) < 0)
+    {
+        perror("socket creation failed");
+        exit(EXIT_FAILURE);
+    }
+
+    inet_pton(AF_INET6, multicastGroup, &(mreq.ipv6mr_multiaddr));
+    mreq.ipv6mr_interface = if_nametoindex(wpan);
+
+    // The kernel reports the join and the leave separately, both within the coalescing window.
+    ASSERT_EQ(setsockopt(sockFd, IPPROTO_IPV6, IPV6_JOIN_GROUP, &mreq, sizeof(mreq)), 0);
+    usleep(20000);
+    ASSERT_EQ(setsockopt(sockFd, IPPROTO_IPV6, IPV6_LEAVE_GROUP, &mreq, sizeof(mreq)), 0);
+
+    otbr::MainloopContext context;
+    deadline = otbr::Clock::now() + otbr::Milliseconds(500);
+    while (otbr::Clock::now() < deadline)
+    {
+        context.mMaxFd   = -1;
+        context.mTimeout = {0, 100000};
+        FD_ZERO(&context.mReadFdSet);
+        FD_ZERO(&context.mWriteFdSet);
+        FD_ZERO(&context.mErrorFdSet);
+
+        netif.UpdateFdSet(&context);
+        int rval = select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                          &context.mTimeout);
+        if (rval < 0)
+        {
+            perror("select failed");
+            exit(EXIT_FAILURE);
+        }
+        netif.Process(&context);
+    }
+
+    EXPECT_FALSE(received);
+    close(sockFd);
+    netif.Deinit();
+}
+
 #endif // __linux__
@@ -26,6 +26,10 @@
  *    POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <functional>
+#include <memory>
+#include <string>
+
 #include <gtest/gtest.h>
 
 #include "common/callback.hpp"
@@ -61,3 +65,34 @@ TEST(VerifyInvocation, CallbackResultIsExpected)
 
     EXPECT_EQ(ret, 25);
 }
+
+TEST(UniqueFunction, CapturesMoveOnlyValue)
+{
+    std::unique_ptr<int>           value(new int(5));
+    otbr::UniqueFunction<int(int)> add([value = std::move(value)](int x) { return *value + x; });
+    otbr::UniqueFunction<int(int)> moved;
+
+    EXPECT_TRUE(moved == nullptr);
+    moved = std::move(add);
+
+    EXPECT_TRUE(add == nullptr);
+    EXPECT_EQ(moved(1), 6);
+}
+
+TEST(UniqueFunction, StoresLargeCallableOnHeap)
+{
+    std::string                        str(100, 'a');
+    char                               padding[otbr::UniqueFunction<size_t(void)>::kInlineSize] = {1};
+    otbr::UniqueFunction<size_t(void)> size([str, padding]() { return str.size() + padding[0]; });
+    otbr::UniqueFunction<size_t(void)> moved(std::move(size));
+
+    EXPECT_EQ(moved(), 101u);
+}
+
+TEST(UniqueFunction, EmptyStdFunctionIsNull)
+{
+    std::function<void(void)>        empty;
+    otbr::UniqueFunction<void(void)> func(empty);
+
+    EXPECT_TRUE(func == nullptr);
+}
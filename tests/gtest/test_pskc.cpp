@@ -63,3 +63,26 @@ TEST(Pskc, Test_TruncatedNetworkNamePskc_OpenThread)
 
     EXPECT_THAT(std::vector<uint8_t>(actual, actual + OT_PSKC_LENGTH), ElementsAreArray(expected));
 }
+
+TEST(Pskc, Test_CachedPskcMatchesDerivedPskc)
+{
+    otbr::Psk::Pskc pskc;
+    uint8_t         extpanid[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07};
+    uint8_t         expected[] = {
+        0xb7, 0x83, 0x81, 0x27, 0x89, 0x91, 0x1e, 0xb4, 0xea, 0x76, 0x59, 0x6c, 0x9c, 0xed, 0x2a, 0x69,
+    };
+    uint8_t other[OT_PSKC_LENGTH];
+
+    otbr::Psk::Pskc::ClearCache();
+
+    // Derived, then served from the cache.
+    const uint8_t *actual = pskc.ComputePskc(extpanid, "OpenThread", "123456");
+    EXPECT_THAT(std::vector<uint8_t>(actual, actual + OT_PSKC_LENGTH), ElementsAreArray(expected));
+    actual = pskc.ComputePskc(extpanid, "OpenThread", "123456");
+    EXPECT_THAT(std::vector<uint8_t>(actual, actual + OT_PSKC_LENGTH), ElementsAreArray(expected));
+
+    // A different passphrase for the same network doesn't hit the cached entry.
+    actual = pskc.ComputePskc(extpanid, "OpenThread", "654321");
+    memcpy(other, actual, OT_PSKC_LENGTH);
+    EXPECT_NE(memcmp(other, expected, OT_PSKC_LENGTH), 0);
+}
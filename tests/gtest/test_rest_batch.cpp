@@ -0,0 +1,103 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "rest/batch.hpp"
+
+using otbr::rest::kBatchMaxPaths;
+using otbr::rest::ParseBatchPaths;
+
+TEST(RestBatch, ParsesAllowedPaths)
+{
+    std::vector<std::string> paths;
+
+    EXPECT_EQ(ParseBatchPaths("/node/state", paths), OTBR_ERROR_NONE);
+    EXPECT_EQ(paths, std::vector<std::string>({"/node/state"}));
+
+    EXPECT_EQ(ParseBatchPaths("/node,/node/ba-id,/node/counters,/node/state,/node/ext-address,/node/network-name,"
+                              "/node/rloc16,/node/leader-data,/node/num-of-router,/node/ext-panid,/node/rloc,"
+                              "/node/dataset/active,/node/dataset/pending",
+                              paths),
+              OTBR_ERROR_NONE);
+    ASSERT_EQ(paths.size(), 13u);
+    EXPECT_EQ(paths.front(), "/node");
+    EXPECT_EQ(paths.back(), "/node/dataset/pending");
+
+    // A resource may be read more than once.
+    EXPECT_EQ(ParseBatchPaths("/node/rloc16,/node/rloc16", paths), OTBR_ERROR_NONE);
+    EXPECT_EQ(paths, std::vector<std::string>({"/node/rloc16", "/node/rloc16"}));
+}
+
+TEST(RestBatch, RejectsUnknownPaths)
+{
+    std::vector<std::string> paths;
+
+    EXPECT_EQ(ParseBatchPaths("", paths), OTBR_ERROR_INVALID_ARGS);
+    EXPECT_EQ(ParseBatchPaths("/node/state,/node/unknown", paths), OTBR_ERROR_INVALID_ARGS);
+    EXPECT_TRUE(paths.empty());
+
+    // Resources which don't respond right away, change the network or aren't Json are not allowed.
+    EXPECT_EQ(ParseBatchPaths("/diagnostics", paths), OTBR_ERROR_INVALID_ARGS);
+    EXPECT_EQ(ParseBatchPaths("/events", paths), OTBR_ERROR_INVALID_ARGS);
+    EXPECT_EQ(ParseBatchPaths("/metrics", paths), OTBR_ERROR_INVALID_ARGS);
+    EXPECT_EQ(ParseBatchPaths("/node/scan", paths), OTBR_ERROR_INVALID_ARGS);
+    EXPECT_EQ(ParseBatchPaths("/batch", paths), OTBR_ERROR_INVALID_ARGS);
+
+    // Paths are matched exactly.
+    EXPECT_EQ(ParseBatchPaths("/node/state/", paths), OTBR_ERROR_INVALID_ARGS);
+    EXPECT_EQ(ParseBatchPaths("/NODE/STATE", paths), OTBR_ERROR_INVALID_ARGS);
+    EXPECT_EQ(ParseBatchPaths(" /node/state", paths), OTBR_ERROR_INVALID_ARGS);
+    EXPECT_EQ(ParseBatchPaths("/node/state?x=1", paths), OTBR_ERROR_INVALID_ARGS);
+
+    // Empty paths are not allowed.
+    EXPECT_EQ(ParseBatchPaths(",", paths), OTBR_ERROR_INVALID_ARGS);
+    EXPECT_EQ(ParseBatchPaths("/node/state,", paths), OTBR_ERROR_INVALID_ARGS);
+    EXPECT_EQ(ParseBatchPaths("/node/state,,/node/rloc", paths), OTBR_ERROR_INVALID_ARGS);
+}
+
+TEST(RestBatch, LimitsNumberOfPaths)
+{
+    std::vector<std::string> paths;
+    std::string              value = "/node/state";
+
+    for (size_t i = 1; i < kBatchMaxPaths; i++)
+    {
+        value += ",/node/state";
+    }
+
+    EXPECT_EQ(ParseBatchPaths(value, paths), OTBR_ERROR_NONE);
+    EXPECT_EQ(paths.size(), kBatchMaxPaths);
+
+    value += ",/node/state";
+    EXPECT_EQ(ParseBatchPaths(value, paths), OTBR_ERROR_INVALID_ARGS);
+    EXPECT_TRUE(paths.empty());
+}
@@ -0,0 +1,136 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <initializer_list>
+#include <string>
+
+#include "rest/cbor_writer.hpp"
+
+using otbr::rest::CborWriter;
+
+namespace {
+
+std::string Bytes(std::initializer_list<uint8_t> aBytes)
+{
+    return std::string(aBytes.begin(), aBytes.end());
+}
+
+std::string WriteNumber(int64_t aNumber)
+{
+    std::string output;
+
+    CborWriter(output).Number(aNumber);
+
+    return output;
+}
+
+// Returns the head of a text string of a length, which is followed by the characters.
+std::string WriteStringHead(size_t aLength)
+{
+    std::string output;
+    std::string string(aLength, 'a');
+
+    CborWriter(output).String(string.data(), string.size());
+    EXPECT_EQ(output.substr(output.size() - aLength), string);
+
+    return output.substr(0, output.size() - aLength);
+}
+
+} // namespace
+
+TEST(RestCborWriter, WritesUnsignedIntegers)
+{
+    EXPECT_EQ(WriteNumber(0), Bytes({0x00}));
+    EXPECT_EQ(WriteNumber(23), Bytes({0x17}));
+    EXPECT_EQ(WriteNumber(24), Bytes({0x18, 0x18}));
+    EXPECT_EQ(WriteNumber(255), Bytes({0x18, 0xff}));
+    EXPECT_EQ(WriteNumber(256), Bytes({0x19, 0x01, 0x00}));
+    EXPECT_EQ(WriteNumber(65535), Bytes({0x19, 0xff, 0xff}));
+    EXPECT_EQ(WriteNumber(65536), Bytes({0x1a, 0x00, 0x01, 0x00, 0x00}));
+    EXPECT_EQ(WriteNumber(4294967295), Bytes({0x1a, 0xff, 0xff, 0xff, 0xff}));
+    EXPECT_EQ(WriteNumber(4294967296), Bytes({0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00}));
+    EXPECT_EQ(WriteNumber(INT64_MAX), Bytes({0x1b, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff}));
+}
+
+TEST(RestCborWriter, WritesNegativeIntegers)
+{
+    EXPECT_EQ(WriteNumber(-1), Bytes({0x20}));
+    EXPECT_EQ(WriteNumber(-24), Bytes({0x37}));
+    EXPECT_EQ(WriteNumber(-25), Bytes({0x38, 0x18}));
+    EXPECT_EQ(WriteNumber(-256), Bytes({0x38, 0xff}));
+    EXPECT_EQ(WriteNumber(-257), Bytes({0x39, 0x01, 0x00}));
+    EXPECT_EQ(WriteNumber(-65536), Bytes({0x39, 0xff, 0xff}));
+    EXPECT_EQ(WriteNumber(-65537), Bytes({0x3a, 0x00, 0x01, 0x00, 0x00}));
+    EXPECT_EQ(WriteNumber(INT64_MIN), Bytes({0x3b, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff}));
+}
+
+TEST(RestCborWriter, WritesStringLengths)
+{
+    EXPECT_EQ(WriteStringHead(0), Bytes({0x60}));
+    EXPECT_EQ(WriteStringHead(23), Bytes({0x77}));
+    EXPECT_EQ(WriteStringHead(24), Bytes({0x78, 0x18}));
+    EXPECT_EQ(WriteStringHead(255), Bytes({0x78, 0xff}));
+    EXPECT_EQ(WriteStringHead(256), Bytes({0x79, 0x01, 0x00}));
+    EXPECT_EQ(WriteStringHead(65535), Bytes({0x79, 0xff, 0xff}));
+    EXPECT_EQ(WriteStringHead(65536), Bytes({0x7a, 0x00, 0x01, 0x00, 0x00}));
+}
+
+TEST(RestCborWriter, WritesStringsAndBytes)
+{
+    std::string   output;
+    CborWriter    writer(output);
+    const uint8_t bytes[] = {0x00, 0x01, 0xff};
+
+    writer.String("IETF").Key("a").HexString(bytes, sizeof(bytes)).HexString(bytes, 0);
+
+    EXPECT_EQ(output, Bytes({0x64, 'I', 'E', 'T', 'F', 0x61, 'a', 0x43, 0x00, 0x01, 0xff, 0x40}));
+}
+
+TEST(RestCborWriter, WritesSimpleValues)
+{
+    std::string output;
+
+    CborWriter(output).Bool(false).Bool(true).Null();
+
+    EXPECT_EQ(output, Bytes({0xf4, 0xf5, 0xf6}));
+}
+
+TEST(RestCborWriter, WritesNestedContainers)
+{
+    std::string output;
+    CborWriter  writer(output);
+
+    writer.BeginObject();
+    writer.Key("a").Number(1);
+    writer.Key("b").BeginArray().Number(2).BeginObject().EndObject().BeginArray().EndArray().EndArray();
+    writer.EndObject();
+
+    EXPECT_EQ(output, Bytes({0xbf, 0x61, 'a', 0x01, 0x61, 'b', 0x9f, 0x02, 0xbf, 0xff, 0x9f, 0xff, 0xff, 0xff}));
+}
@@ -0,0 +1,188 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include <vector>
+
+#include "rest/diag_store.hpp"
+
+using otbr::Timepoint;
+using otbr::rest::DiagStore;
+
+namespace {
+
+// A TLV type ignored by the Json serialization, so the union may hold any bytes.
+constexpr uint8_t kOpaqueType = 200;
+
+otNetworkDiagTlv MakeTlv(uint8_t aType, uint8_t aFill)
+{
+    otNetworkDiagTlv tlv;
+
+    memset(&tlv, aFill, sizeof(tlv));
+    tlv.mType = aType;
+
+    return tlv;
+}
+
+uint8_t *GetBytes(otNetworkDiagTlv &aTlv)
+{
+    return reinterpret_cast<uint8_t *>(&aTlv);
+}
+
+bool IsSameTlv(const otNetworkDiagTlv &aLhs, const otNetworkDiagTlv &aRhs)
+{
+    return memcmp(&aLhs, &aRhs, sizeof(otNetworkDiagTlv)) == 0;
+}
+
+// Stores a single TLV in a new store and returns it as unpacked.
+otNetworkDiagTlv RoundTrip(const otNetworkDiagTlv &aTlv, size_t &aPackedSize)
+{
+    DiagStore                     store;
+    std::vector<otNetworkDiagTlv> tlvs;
+    const DiagStore::Node        &node = store.Update("node", {aTlv}, Timepoint());
+
+    aPackedSize = node.mPacked.size();
+    DiagStore::GetTlvs(node, tlvs);
+    EXPECT_EQ(tlvs.size(), 1u);
+
+    return tlvs.empty() ? otNetworkDiagTlv() : tlvs[0];
+}
+
+} // namespace
+
+TEST(RestDiagStore, StoresNoTlvs)
+{
+    DiagStore                     store;
+    std::vector<otNetworkDiagTlv> tlvs = {MakeTlv(kOpaqueType, 0)};
+    const DiagStore::Node        &node = store.Update("node", {}, Timepoint());
+
+    EXPECT_TRUE(node.mPacked.empty());
+    DiagStore::GetTlvs(node, tlvs);
+    EXPECT_TRUE(tlvs.empty());
+}
+
+TEST(RestDiagStore, PacksMostlyZeroTlv)
+{
+    otNetworkDiagTlv tlv = MakeTlv(OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS, 0);
+    size_t           packedSize;
+
+    tlv.mData.mAddr16 = 0x1234;
+
+    EXPECT_TRUE(IsSameTlv(RoundTrip(tlv, packedSize), tlv));
+    EXPECT_LT(packedSize, sizeof(tlv) / 4);
+}
+
+TEST(RestDiagStore, PacksTlvWithoutZeros)
+{
+    otNetworkDiagTlv tlv = MakeTlv(kOpaqueType, 0xff);
+    size_t           packedSize;
+
+    EXPECT_TRUE(IsSameTlv(RoundTrip(tlv, packedSize), tlv));
+    EXPECT_EQ(packedSize, sizeof(tlv));
+}
+
+TEST(RestDiagStore, PacksZeroRunsAtBoundaries)
+{
+    size_t packedSize;
+
+    // A TLV of zeros is a single run from its first to its last byte, split in runs of at most 255 bytes.
+    {
+        otNetworkDiagTlv tlv = MakeTlv(OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS, 0);
+
+        EXPECT_TRUE(IsSameTlv(RoundTrip(tlv, packedSize), tlv));
+        EXPECT_EQ(packedSize, 2 * ((sizeof(tlv) + 254) / 255));
+    }
+
+    // Runs around the maximum run length, followed by a non-zero byte or by the end of the TLV.
+    for (size_t runLength : {1, 2, 254, 255, 256, 509, 510, 511})
+    {
+        otNetworkDiagTlv tlv = MakeTlv(kOpaqueType, 0xa5);
+
+        if (runLength + 1 >= sizeof(tlv))
+        {
+            continue;
+        }
+
+        memset(GetBytes(tlv) + 1, 0, runLength);
+        EXPECT_TRUE(IsSameTlv(RoundTrip(tlv, packedSize), tlv)) << "run of " << runLength;
+
+        memset(GetBytes(tlv) + 1, 0xa5, runLength);
+        memset(GetBytes(tlv) + sizeof(tlv) - runLength, 0, runLength);
+        EXPECT_TRUE(IsSameTlv(RoundTrip(tlv, packedSize), tlv)) << "trailing run of " << runLength;
+    }
+
+    // A single non-zero byte at the end of the TLV.
+    {
+        otNetworkDiagTlv tlv = MakeTlv(OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS, 0);
+
+        GetBytes(tlv)[sizeof(tlv) - 1] = 1;
+        EXPECT_TRUE(IsSameTlv(RoundTrip(tlv, packedSize), tlv));
+    }
+}
+
+TEST(RestDiagStore, MergesTlvsOfNode)
+{
+    DiagStore                     store;
+    std::vector<otNetworkDiagTlv> tlvs;
+    otNetworkDiagTlv              first   = MakeTlv(OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS, 0);
+    otNetworkDiagTlv              second  = MakeTlv(kOpaqueType, 0x5a);
+    otNetworkDiagTlv              updated = MakeTlv(OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS, 0);
+
+    first.mData.mAddr16   = 0x0400;
+    updated.mData.mAddr16 = 0x0401;
+
+    store.Update("node", {first, second}, Timepoint());
+    DiagStore::GetTlvs(store.Update("node", {updated}, Timepoint()), tlvs);
+
+    // The TLVs of the same type are replaced in place, the other TLVs are kept.
+    ASSERT_EQ(tlvs.size(), 2u);
+    EXPECT_TRUE(IsSameTlv(tlvs[0], updated));
+    EXPECT_TRUE(IsSameTlv(tlvs[1], second));
+}
+
+TEST(RestDiagStore, RemovesExpiredNodes)
+{
+    DiagStore store;
+    Timepoint start;
+    uint32_t  count = 0;
+
+    store.Update("a", {}, start);
+    store.Update("b", {}, start + otbr::Milliseconds(10));
+    store.Update("a", {}, start + otbr::Milliseconds(20));
+
+    // "a" was updated after the deadline, only "b" expires.
+    EXPECT_EQ(store.RemoveExpired(start + otbr::Milliseconds(15)), 1u);
+    store.ForEach([&count](const std::string &aKey, const DiagStore::Node &) {
+        EXPECT_EQ(aKey, "a");
+        count++;
+    });
+    EXPECT_EQ(count, 1u);
+}
@@ -0,0 +1,112 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "rest/entity_tag.hpp"
+#include "rest/response.hpp"
+
+using otbr::rest::Response;
+namespace EntityTag = otbr::rest::EntityTag;
+
+TEST(RestEntityTag, GeneratesTagFromBody)
+{
+    std::string tag = EntityTag::Generate("{\"state\":\"leader\"}");
+
+    // A strong tag of 16 hex digits in quotes, which only depends on the body.
+    ASSERT_EQ(tag.size(), 18u);
+    EXPECT_EQ(tag.front(), '"');
+    EXPECT_EQ(tag.back(), '"');
+    EXPECT_EQ(tag.find_first_not_of("0123456789abcdef", 1), 17u);
+    EXPECT_EQ(tag, EntityTag::Generate("{\"state\":\"leader\"}"));
+    EXPECT_NE(tag, EntityTag::Generate("{\"state\":\"router\"}"));
+
+    // The 64-bit FNV-1a offset basis is the hash of nothing.
+    EXPECT_EQ(EntityTag::Generate(""), "\"cbf29ce484222325\"");
+}
+
+TEST(RestEntityTag, MatchesIfNoneMatch)
+{
+    std::string tag = EntityTag::Generate("body");
+    std::string opaque(tag.begin() + 1, tag.end() - 1);
+
+    EXPECT_TRUE(EntityTag::Matches(tag, tag));
+    EXPECT_TRUE(EntityTag::Matches("*", tag));
+    EXPECT_TRUE(EntityTag::Matches(" * ", tag));
+    EXPECT_TRUE(EntityTag::Matches("W/" + tag, tag));
+    EXPECT_TRUE(EntityTag::Matches(tag, "W/" + tag));
+    EXPECT_TRUE(EntityTag::Matches("\"other\", " + tag, tag));
+    EXPECT_TRUE(EntityTag::Matches("\"other\",W/" + tag + " ,\"more\"", tag));
+
+    EXPECT_FALSE(EntityTag::Matches("", tag));
+    EXPECT_FALSE(EntityTag::Matches("\"other\"", tag));
+    EXPECT_FALSE(EntityTag::Matches(EntityTag::Generate("other body"), tag));
+    EXPECT_FALSE(EntityTag::Matches(opaque, tag));
+    EXPECT_FALSE(EntityTag::Matches("\"x" + opaque + "\"", tag));
+    EXPECT_FALSE(EntityTag::Matches("w/" + tag, tag));
+}
+
+TEST(RestEntityTag, RespondsNotModifiedOnMatch)
+{
+    std::string tag = EntityTag::Generate("body");
+    Response    response;
+    std::string serialized;
+
+    EntityTag::Respond(tag, tag, "body", response);
+
+    EXPECT_EQ(response.GetResponseCode(), "304 Not Modified");
+    EXPECT_EQ(response.GetBody(), "");
+    serialized = response.Serialize();
+    EXPECT_NE(serialized.find("\r\nETag: " + tag + "\r\n"), std::string::npos);
+}
+
+TEST(RestEntityTag, RespondsBodyOnMismatch)
+{
+    std::string tag = EntityTag::Generate("body");
+    Response    response;
+    std::string serialized;
+
+    EntityTag::Respond(EntityTag::Generate("old body"), tag, "body", response);
+
+    EXPECT_EQ(response.GetResponseCode(), "200 OK");
+    EXPECT_EQ(response.GetBody(), "body");
+    serialized = response.Serialize();
+    EXPECT_NE(serialized.find("\r\nETag: " + tag + "\r\n"), std::string::npos);
+}
+
+TEST(RestEntityTag, RespondsBodyWithoutIfNoneMatch)
+{
+    Response response;
+
+    EntityTag::Respond("", EntityTag::Generate("body"), "body", response);
+
+    EXPECT_EQ(response.GetResponseCode(), "200 OK");
+    EXPECT_EQ(response.GetBody(), "body");
+}
@@ -0,0 +1,314 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "rest/json_reader.hpp"
+
+using otbr::rest::JsonReader;
+using Token = JsonReader::Token;
+
+namespace {
+
+// Reads the tokens of a JSON text up to its end or its first error.
+std::vector<Token> ReadTokens(const std::string &aJson)
+{
+    JsonReader         reader(aJson);
+    std::vector<Token> tokens;
+
+    do
+    {
+        tokens.push_back(reader.Next());
+    } while (tokens.back() != Token::kEnd && tokens.back() != Token::kError);
+
+    return tokens;
+}
+
+bool IsValid(const std::string &aJson)
+{
+    return ReadTokens(aJson).back() == Token::kEnd;
+}
+
+// Reads a JSON text of a single string, returns whether it is valid and the decoded string.
+bool ReadString(const std::string &aJson, std::string &aString)
+{
+    JsonReader reader(aJson);
+    bool       valid = (reader.Next() == Token::kString);
+
+    aString = std::string(reader.GetString(), reader.GetStringLength());
+
+    return valid && reader.Next() == Token::kEnd;
+}
+
+// Reads a JSON text of a single number, returns whether it is valid and whether it is an unsigned integer.
+bool ReadUint(const std::string &aJson, bool &aIsUint, uint64_t &aValue)
+{
+    JsonReader reader(aJson);
+    bool       valid = (reader.Next() == Token::kNumber);
+
+    aIsUint = reader.GetUint(aValue);
+
+    return valid && reader.Next() == Token::kEnd;
+}
+
+std::string Nest(uint8_t aDepth)
+{
+    return std::string(aDepth, '[') + std::string(aDepth, ']');
+}
+
+} // namespace
+
+TEST(RestJsonReader, ReadsTokens)
+{
+    JsonReader reader(" {\"a\": [1, \"b\", true, false, null, {}], \"c\" : {\"d\":[]}}\n");
+    uint64_t   value;
+
+    EXPECT_EQ(reader.Next(), Token::kBeginObject);
+    EXPECT_EQ(reader.Next(), Token::kKey);
+    EXPECT_TRUE(reader.IsString("a"));
+    EXPECT_EQ(reader.Next(), Token::kBeginArray);
+    EXPECT_EQ(reader.Next(), Token::kNumber);
+    EXPECT_TRUE(reader.GetUint(value));
+    EXPECT_EQ(value, 1u);
+    EXPECT_EQ(reader.Next(), Token::kString);
+    EXPECT_TRUE(reader.IsString("b"));
+    EXPECT_EQ(reader.Next(), Token::kTrue);
+    EXPECT_EQ(reader.Next(), Token::kFalse);
+    EXPECT_EQ(reader.Next(), Token::kNull);
+    EXPECT_EQ(reader.Next(), Token::kBeginObject);
+    EXPECT_EQ(reader.Next(), Token::kEndObject);
+    EXPECT_EQ(reader.Next(), Token::kEndArray);
+    EXPECT_EQ(reader.Next(), Token::kKey);
+    EXPECT_TRUE(reader.IsString("c"));
+    EXPECT_EQ(reader.Next(), Token::kBeginObject);
+    EXPECT_EQ(reader.Next(), Token::kKey);
+    EXPECT_EQ(reader.Next(), Token::kBeginArray);
+    EXPECT_EQ(reader.Next(), Token::kEndArray);
+    EXPECT_EQ(reader.Next(), Token::kEndObject);
+    EXPECT_EQ(reader.Next(), Token::kEndObject);
+    EXPECT_EQ(reader.Next(), Token::kEnd);
+    EXPECT_EQ(reader.Next(), Token::kEnd);
+}
+
+TEST(RestJsonReader, RejectsMalformedInput)
+{
+    for (const char *json : {
+             "",           " ",          "{",         "[",          "]",          "{]",        "[}",
+             "{\"a\"}",    "{\"a\" 1}",  "{1:2}",     "{a:1}",      "[1 2]",      "[1,,2]",    "[,1]",
+             "1 2",        "{} {}",      "tru",       "nul",        "True",       "'a'",       "\"a",
+             "\"\\x\"",    "-",          "01",        "1.",         ".5",         "1e",        "1e+",
+             "+1",         "[1:2]",      "{\"a\":}",  "\"\t\"",     "\"\\",       "[1,",       "{\"a\":1,",
+         })
+    {
+        EXPECT_FALSE(IsValid(json)) << json;
+    }
+
+    // A truncated text is rejected at any length.
+    {
+        std::string json = "{\"a\":[1,true,\"\\u00e9\",{\"b\":null}],\"c\":-1.5e3}";
+
+        ASSERT_TRUE(IsValid(json));
+        for (size_t length = 0; length < json.size(); length++)
+        {
+            EXPECT_FALSE(IsValid(json.substr(0, length))) << json.substr(0, length);
+        }
+    }
+}
+
+TEST(RestJsonReader, RejectsTrailingCommas)
+{
+    EXPECT_FALSE(IsValid("[1,]"));
+    EXPECT_FALSE(IsValid("[[],]"));
+    EXPECT_FALSE(IsValid("{\"a\":1,}"));
+    EXPECT_FALSE(IsValid("{\"a\":{},}"));
+    EXPECT_FALSE(IsValid("1,"));
+}
+
+TEST(RestJsonReader, StopsAtFirstError)
+{
+    JsonReader reader("[1,]");
+
+    EXPECT_EQ(reader.Next(), Token::kBeginArray);
+    EXPECT_EQ(reader.Next(), Token::kNumber);
+    EXPECT_EQ(reader.Next(), Token::kError);
+    EXPECT_EQ(reader.Next(), Token::kError);
+}
+
+TEST(RestJsonReader, LimitsDepth)
+{
+    std::vector<Token> tokens;
+
+    EXPECT_TRUE(IsValid(Nest(JsonReader::kMaxDepth)));
+    EXPECT_TRUE(IsValid("{\"a\":" + Nest(JsonReader::kMaxDepth - 1) + "}"));
+
+    // The nesting is rejected at its first token exceeding the depth.
+    tokens = ReadTokens(Nest(JsonReader::kMaxDepth + 1));
+    EXPECT_EQ(tokens.size(), JsonReader::kMaxDepth + 1u);
+    EXPECT_EQ(tokens.back(), Token::kError);
+    EXPECT_FALSE(IsValid("{\"a\":" + Nest(JsonReader::kMaxDepth) + "}"));
+}
+
+TEST(RestJsonReader, LimitsStringLength)
+{
+    std::string longest(JsonReader::kMaxStringLength, 'a');
+    std::string string;
+
+    EXPECT_TRUE(ReadString("\"" + longest + "\"", string));
+    EXPECT_EQ(string, longest);
+    EXPECT_FALSE(ReadString("\"" + longest + "a\"", string));
+    EXPECT_TRUE(IsValid("{\"" + longest + "\":1}"));
+    EXPECT_FALSE(IsValid("{\"" + longest + "a\":1}"));
+
+    // The limit applies to the decoded string.
+    EXPECT_TRUE(ReadString("\"" + longest.substr(1) + "\\n\"", string));
+    EXPECT_FALSE(ReadString("\"" + longest.substr(1) + "\\u00e9\"", string));
+    EXPECT_TRUE(ReadString("\"" + longest.substr(2) + "\\u00e9\"", string));
+}
+
+TEST(RestJsonReader, DecodesEscapes)
+{
+    std::string string;
+
+    EXPECT_TRUE(ReadString("\"\\\"\\\\\\/\\b\\f\\n\\r\\t\"", string));
+    EXPECT_EQ(string, "\"\\/\b\f\n\r\t");
+
+    EXPECT_TRUE(ReadString("\"\\u0041\\u00e9\\u20AC\"", string));
+    EXPECT_EQ(string, "A\xc3\xa9\xe2\x82\xac");
+
+    // Non-ASCII characters are kept as they are.
+    EXPECT_TRUE(ReadString("\"\xc3\xa9\"", string));
+    EXPECT_EQ(string, "\xc3\xa9");
+
+    EXPECT_FALSE(ReadString("\"\\u004\"", string));
+    EXPECT_FALSE(ReadString("\"\\u00g0\"", string));
+    EXPECT_FALSE(ReadString("\"\\U0041\"", string));
+    EXPECT_FALSE(ReadString("\"\\u0000\"", string));
+}
+
+TEST(RestJsonReader, DecodesSurrogatePairs)
+{
+    std::string string;
+
+    EXPECT_TRUE(ReadString("\"\\ud83d\\ude00\"", string));
+    EXPECT_EQ(string, "\xf0\x9f\x98\x80");
+    EXPECT_TRUE(ReadString("\"\\uDBFF\\uDFFF\"", string));
+    EXPECT_EQ(string, "\xf4\x8f\xbf\xbf");
+
+    // A surrogate must be a high surrogate followed by a low surrogate.
+    EXPECT_FALSE(ReadString("\"\\ud83d\"", string));
+    EXPECT_FALSE(ReadString("\"\\ud83da\"", string));
+    EXPECT_FALSE(ReadString("\"\\ud83d\\u0041\"", string));
+    EXPECT_FALSE(ReadString("\"\\ud83d\\ud83d\"", string));
+    EXPECT_FALSE(ReadString("\"\\ude00\"", string));
+    EXPECT_FALSE(ReadString("\"\\ude00\\ud83d\"", string));
+}
+
+TEST(RestJsonReader, ReadsNumbers)
+{
+    bool     isUint;
+    uint64_t value;
+
+    EXPECT_TRUE(ReadUint("0", isUint, value));
+    EXPECT_TRUE(isUint);
+    EXPECT_EQ(value, 0u);
+
+    EXPECT_TRUE(ReadUint("1234567890", isUint, value));
+    EXPECT_TRUE(isUint);
+    EXPECT_EQ(value, 1234567890u);
+
+    EXPECT_TRUE(ReadUint("18446744073709551615", isUint, value));
+    EXPECT_TRUE(isUint);
+    EXPECT_EQ(value, UINT64_MAX);
+
+    // Numbers which aren't unsigned 64-bit integers are valid, but have no value.
+    for (const char *json : {"18446744073709551616", "99999999999999999999", "184467440737095516150", "-0", "-1",
+                             "0.5", "1.0", "1e2", "1E+2", "1e-2", "-12.5e10"})
+    {
+        EXPECT_TRUE(ReadUint(json, isUint, value)) << json;
+        EXPECT_FALSE(isUint) << json;
+    }
+}
+
+TEST(RestJsonReader, SkipsNestedContainers)
+{
+    JsonReader reader("{\"a\":{\"b\":[1,{\"c\":[[],{}]},\"]\"],\"d\":{}},\"e\":[[[2]]],\"f\":3,\"g\":\"}\"}");
+    uint64_t   value;
+
+    EXPECT_EQ(reader.Next(), Token::kBeginObject);
+
+    EXPECT_EQ(reader.Next(), Token::kKey);
+    EXPECT_TRUE(reader.IsString("a"));
+    EXPECT_TRUE(reader.SkipValue());
+
+    EXPECT_EQ(reader.Next(), Token::kKey);
+    EXPECT_TRUE(reader.IsString("e"));
+    EXPECT_EQ(reader.Next(), Token::kBeginArray);
+    EXPECT_TRUE(reader.Skip(Token::kBeginArray));
+
+    EXPECT_EQ(reader.Next(), Token::kKey);
+    EXPECT_TRUE(reader.IsString("f"));
+    EXPECT_TRUE(reader.SkipValue());
+
+    EXPECT_EQ(reader.Next(), Token::kKey);
+    EXPECT_TRUE(reader.IsString("g"));
+    EXPECT_EQ(reader.Next(), Token::kString);
+    EXPECT_TRUE(reader.IsString("}"));
+
+    EXPECT_EQ(reader.Next(), Token::kEndObject);
+    EXPECT_EQ(reader.Next(), Token::kEnd);
+
+    // Skipping a scalar value reads nothing more.
+    {
+        JsonReader scalar("[3,4]");
+
+        EXPECT_EQ(scalar.Next(), Token::kBeginArray);
+        EXPECT_EQ(scalar.Next(), Token::kNumber);
+        EXPECT_TRUE(scalar.Skip(Token::kNumber));
+        EXPECT_EQ(scalar.Next(), Token::kNumber);
+        EXPECT_TRUE(scalar.GetUint(value));
+        EXPECT_EQ(value, 4u);
+    }
+}
+
+TEST(RestJsonReader, FailsToSkipInvalidValue)
+{
+    JsonReader truncated("{\"a\":[1,{\"b\":2}");
+    JsonReader malformed("{\"a\":[1,{\"b\":2],\"c\":3}");
+
+    EXPECT_EQ(truncated.Next(), Token::kBeginObject);
+    EXPECT_EQ(truncated.Next(), Token::kKey);
+    EXPECT_FALSE(truncated.SkipValue());
+    EXPECT_EQ(truncated.Next(), Token::kError);
+
+    EXPECT_EQ(malformed.Next(), Token::kBeginObject);
+    EXPECT_EQ(malformed.Next(), Token::kKey);
+    EXPECT_FALSE(malformed.SkipValue());
+}
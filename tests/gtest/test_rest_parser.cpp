@@ -0,0 +1,201 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "rest/parser.hpp"
+#include "rest/request.hpp"
+
+using otbr::rest::HttpMethod;
+using otbr::rest::Parser;
+using otbr::rest::Request;
+
+namespace {
+
+// Parses the data read by a connection into its read buffer, like `Connection` does.
+class RequestReader
+{
+public:
+    RequestReader(void)
+        : mRequest(mBuffer)
+        , mParser(&mRequest)
+    {
+        mParser.Init();
+    }
+
+    // Appends the data to the read buffer and parses it, returns the number of bytes parsed.
+    size_t Read(const std::string &aData)
+    {
+        size_t offset = mBuffer.size();
+
+        mBuffer.insert(mBuffer.end(), aData.begin(), aData.end());
+
+        return mParser.Process(mBuffer.data() + offset, aData.size());
+    }
+
+    // Parses the data following a complete request, like `Connection` does once the request is handled.
+    size_t ReadNext(size_t aOffset)
+    {
+        mRequest.Reset();
+        mParser.Resume();
+
+        return mParser.Process(mBuffer.data() + aOffset, mBuffer.size() - aOffset);
+    }
+
+    std::vector<char> mBuffer;
+    Request           mRequest;
+    Parser            mParser;
+};
+
+const std::string kPostRequest = "POST /node/dataset/active/?verbose=1 HTTP/1.1\r\n"
+                                 "Host: localhost\r\n"
+                                 "Content-Type: application/json\r\n"
+                                 "Content-Length: 11\r\n"
+                                 "\r\n"
+                                 "{\"a\":true}\n";
+
+} // namespace
+
+TEST(RestParser, ParsesRequest)
+{
+    RequestReader    reader;
+    otbr::StringView value;
+
+    EXPECT_EQ(reader.Read(kPostRequest), kPostRequest.size());
+    ASSERT_TRUE(reader.mRequest.IsComplete());
+
+    EXPECT_EQ(reader.mRequest.GetMethod(), HttpMethod::kPost);
+    EXPECT_EQ(reader.mRequest.GetUrl(), "/node/dataset/active");
+    EXPECT_TRUE(reader.mRequest.GetQueryParameter("verbose", value));
+    EXPECT_EQ(value, "1");
+    EXPECT_EQ(reader.mRequest.GetHeaderValue("content-type"), "application/json");
+    EXPECT_EQ(reader.mRequest.GetBody(), "{\"a\":true}\n");
+    EXPECT_TRUE(reader.mRequest.IsKeepAlive());
+}
+
+TEST(RestParser, ParsesRequestSplitAcrossReads)
+{
+    // Every split point cuts the method, the url, a header field, a header value or the body.
+    for (size_t split = 1; split < kPostRequest.size(); split++)
+    {
+        RequestReader reader;
+
+        EXPECT_EQ(reader.Read(kPostRequest.substr(0, split)), split);
+        EXPECT_FALSE(reader.mRequest.IsComplete());
+        EXPECT_EQ(reader.Read(kPostRequest.substr(split)), kPostRequest.size() - split);
+        ASSERT_TRUE(reader.mRequest.IsComplete()) << "split at " << split;
+
+        EXPECT_EQ(reader.mRequest.GetUrl(), "/node/dataset/active") << "split at " << split;
+        EXPECT_EQ(reader.mRequest.GetHeaderValue("Host"), "localhost") << "split at " << split;
+        EXPECT_EQ(reader.mRequest.GetHeaderValue("Content-Type"), "application/json") << "split at " << split;
+        EXPECT_EQ(reader.mRequest.GetBody(), "{\"a\":true}\n") << "split at " << split;
+    }
+}
+
+TEST(RestParser, ParsesChunkedBodySplitAcrossReads)
+{
+    RequestReader reader;
+
+    reader.Read("PUT /node/state HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n3\r\nen");
+    reader.Read("a\r\n4\r\nble");
+    EXPECT_FALSE(reader.mRequest.IsComplete());
+    reader.Read("d\r\n0\r\n\r\n");
+    ASSERT_TRUE(reader.mRequest.IsComplete());
+
+    // The chunks are moved together over the chunk framing.
+    EXPECT_EQ(reader.mRequest.GetBody(), "enabled");
+}
+
+TEST(RestParser, RejectsOversizedHeaders)
+{
+    RequestReader reader;
+    std::string   request = "GET /node HTTP/1.1\r\nX-Padding: " + std::string(HTTP_MAX_HEADER_SIZE, 'a') + "\r\n\r\n";
+
+    EXPECT_LT(reader.Read(request), request.size());
+    EXPECT_FALSE(reader.mRequest.IsComplete());
+}
+
+TEST(RestParser, RejectsOversizedBodyBeforeReadingIt)
+{
+    RequestReader reader;
+    std::string   headers = "POST /node/dataset/active HTTP/1.1\r\nContent-Length: 16385\r\n\r\n";
+
+    EXPECT_LT(reader.Read(headers), headers.size());
+    EXPECT_FALSE(reader.mRequest.IsComplete());
+}
+
+TEST(RestParser, WaitsForBodyShorterThanContentLength)
+{
+    RequestReader reader;
+    std::string   request = "POST /node/state HTTP/1.1\r\nContent-Length: 10\r\n\r\nenable";
+
+    EXPECT_EQ(reader.Read(request), request.size());
+    EXPECT_FALSE(reader.mRequest.IsComplete());
+
+    EXPECT_EQ(reader.Read("d\"\"\""), 4u);
+    ASSERT_TRUE(reader.mRequest.IsComplete());
+    EXPECT_EQ(reader.mRequest.GetBody(), "enabled\"\"\"");
+}
+
+TEST(RestParser, StopsAtContentLengthOfLongerBody)
+{
+    RequestReader reader;
+    std::string   request = "POST /node/state HTTP/1.1\r\nContent-Length: 2\r\n\r\nonxx";
+    size_t        parsed;
+
+    parsed = reader.Read(request);
+    ASSERT_TRUE(reader.mRequest.IsComplete());
+    EXPECT_EQ(parsed, request.size() - 2);
+    EXPECT_EQ(reader.mRequest.GetBody(), "on");
+
+    // The remaining bytes are parsed as the next request, which is invalid.
+    EXPECT_LT(reader.ReadNext(parsed), 2u);
+    EXPECT_FALSE(reader.mRequest.IsComplete());
+}
+
+TEST(RestParser, ParsesPipelinedRequests)
+{
+    RequestReader reader;
+    std::string   first  = "GET /node/state HTTP/1.1\r\n\r\n";
+    std::string   second = "DELETE /node HTTP/1.1\r\nConnection: close\r\n\r\n";
+    size_t        parsed;
+
+    parsed = reader.Read(first + second);
+    ASSERT_TRUE(reader.mRequest.IsComplete());
+    EXPECT_EQ(parsed, first.size());
+    EXPECT_EQ(reader.mRequest.GetUrl(), "/node/state");
+
+    EXPECT_EQ(reader.ReadNext(parsed), second.size());
+    ASSERT_TRUE(reader.mRequest.IsComplete());
+    EXPECT_EQ(reader.mRequest.GetMethod(), HttpMethod::kDelete);
+    EXPECT_EQ(reader.mRequest.GetUrl(), "/node");
+    EXPECT_FALSE(reader.mRequest.IsKeepAlive());
+}
@@ -0,0 +1,148 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+
+#include "rest/rate_limiter.hpp"
+
+using otbr::Milliseconds;
+using otbr::Timepoint;
+using otbr::rest::RateLimiter;
+
+namespace {
+
+constexpr uint32_t     kBurst = 3;
+constexpr Milliseconds kInterval(100);
+
+in6_addr MakeAddress(const char *aAddress)
+{
+    in6_addr address;
+
+    EXPECT_EQ(inet_pton(AF_INET6, aAddress, &address), 1);
+
+    return address;
+}
+
+int sResourceA;
+int sResourceB;
+
+} // namespace
+
+TEST(RestRateLimiter, RefusesRequestsAfterBurst)
+{
+    RateLimiter limiter(kBurst, kInterval, 16);
+    in6_addr    client = MakeAddress("fd00::1");
+    Timepoint   now;
+
+    for (uint32_t i = 0; i < kBurst; i++)
+    {
+        EXPECT_EQ(limiter.Consume(client, &sResourceA, now), Milliseconds(0));
+    }
+
+    EXPECT_EQ(limiter.Consume(client, &sResourceA, now), kInterval);
+    EXPECT_EQ(limiter.Consume(client, &sResourceA, now + Milliseconds(40)), Milliseconds(60));
+}
+
+TEST(RestRateLimiter, RefillsOverTime)
+{
+    RateLimiter limiter(kBurst, kInterval, 16);
+    in6_addr    client = MakeAddress("fd00::1");
+    Timepoint   now;
+
+    for (uint32_t i = 0; i < kBurst; i++)
+    {
+        EXPECT_EQ(limiter.Consume(client, &sResourceA, now), Milliseconds(0));
+    }
+
+    // A token is added every interval.
+    now += kInterval;
+    EXPECT_EQ(limiter.Consume(client, &sResourceA, now), Milliseconds(0));
+    EXPECT_EQ(limiter.Consume(client, &sResourceA, now), kInterval);
+
+    // Partial intervals are carried over to the next token.
+    now += Milliseconds(150);
+    EXPECT_EQ(limiter.Consume(client, &sResourceA, now), Milliseconds(0));
+    EXPECT_EQ(limiter.Consume(client, &sResourceA, now), Milliseconds(50));
+    now += Milliseconds(50);
+    EXPECT_EQ(limiter.Consume(client, &sResourceA, now), Milliseconds(0));
+
+    // The bucket never holds more than a burst of tokens.
+    now += kInterval * 10;
+    for (uint32_t i = 0; i < kBurst; i++)
+    {
+        EXPECT_EQ(limiter.Consume(client, &sResourceA, now), Milliseconds(0));
+    }
+    EXPECT_EQ(limiter.Consume(client, &sResourceA, now), kInterval);
+}
+
+TEST(RestRateLimiter, IsolatesClientsAndResources)
+{
+    RateLimiter limiter(kBurst, kInterval, 16);
+    in6_addr    client = MakeAddress("fd00::1");
+    in6_addr    other  = MakeAddress("fd00::2");
+    Timepoint   now;
+
+    for (uint32_t i = 0; i < kBurst; i++)
+    {
+        EXPECT_EQ(limiter.Consume(client, &sResourceA, now), Milliseconds(0));
+    }
+    EXPECT_EQ(limiter.Consume(client, &sResourceA, now), kInterval);
+
+    // Neither another client nor another resource of the same client share the empty bucket.
+    for (uint32_t i = 0; i < kBurst; i++)
+    {
+        EXPECT_EQ(limiter.Consume(other, &sResourceA, now), Milliseconds(0));
+        EXPECT_EQ(limiter.Consume(client, &sResourceB, now), Milliseconds(0));
+    }
+    EXPECT_EQ(limiter.Consume(other, &sResourceA, now), kInterval);
+    EXPECT_EQ(limiter.Consume(client, &sResourceB, now), kInterval);
+}
+
+TEST(RestRateLimiter, AllowsRequestsWhenAllBucketsAreInUse)
+{
+    RateLimiter limiter(1, kInterval, 2);
+    in6_addr    first  = MakeAddress("fd00::1");
+    in6_addr    second = MakeAddress("fd00::2");
+    in6_addr    third  = MakeAddress("fd00::3");
+    Timepoint   now;
+
+    EXPECT_EQ(limiter.Consume(first, &sResourceA, now), Milliseconds(0));
+    EXPECT_EQ(limiter.Consume(second, &sResourceA, now), Milliseconds(0));
+
+    // There is no bucket left for a third client, which is not locked out.
+    EXPECT_EQ(limiter.Consume(third, &sResourceA, now), Milliseconds(0));
+    EXPECT_EQ(limiter.Consume(third, &sResourceA, now), Milliseconds(0));
+
+    // Once the bucket of the first client is full again, it is reused by the third client.
+    now += kInterval;
+    EXPECT_EQ(limiter.Consume(second, &sResourceA, now), Milliseconds(0));
+    EXPECT_EQ(limiter.Consume(third, &sResourceA, now), Milliseconds(0));
+    EXPECT_EQ(limiter.Consume(third, &sResourceA, now), kInterval);
+}
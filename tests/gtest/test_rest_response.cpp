@@ -0,0 +1,194 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "rest/response.hpp"
+
+#if OTBR_ENABLE_REST_COMPRESSION
+
+#include <string.h>
+#include <zlib.h>
+
+using otbr::rest::Response;
+
+namespace {
+
+// A Json body long enough to be compressed.
+std::string MakeBody(void)
+{
+    std::string body = "[";
+
+    for (int i = 0; i < 100; i++)
+    {
+        body += (i == 0 ? "" : ",");
+        body += "{\"rloc16\":" + std::to_string(i * 1024) + ",\"role\":\"router\"}";
+    }
+
+    return body + "]";
+}
+
+// Returns the value of a header of a response, or "(absent)".
+std::string GetHeader(const Response &aResponse, const std::string &aName)
+{
+    std::string headers;
+    std::string value = "(absent)";
+    size_t      start;
+
+    aResponse.SerializeHeaders(headers);
+    start = headers.find("\r\n" + aName + ": ");
+    if (start != std::string::npos)
+    {
+        start += aName.size() + 4;
+        value = headers.substr(start, headers.find("\r\n", start) - start);
+    }
+
+    return value;
+}
+
+// Compresses a body for a client sending the Accept-Encoding header, returns the content coding used.
+std::string Negotiate(const char *aAcceptEncoding)
+{
+    Response    response;
+    std::string body = MakeBody();
+
+    response.SetBody(body);
+    response.Compress(aAcceptEncoding);
+
+    return GetHeader(response, "Content-Encoding");
+}
+
+// Decompresses a body with zlib, gzip is told from the zlib wrapper of deflate by its header.
+std::string Inflate(const std::string &aCompressed, bool aGzip)
+{
+    z_stream    stream;
+    std::string output(64 * 1024, '\0');
+    int         ret;
+
+    memset(&stream, 0, sizeof(stream));
+    EXPECT_EQ(inflateInit2(&stream, aGzip ? MAX_WBITS + 16 : MAX_WBITS), Z_OK);
+
+    stream.next_in   = reinterpret_cast<Bytef *>(const_cast<char *>(aCompressed.data()));
+    stream.avail_in  = static_cast<uInt>(aCompressed.size());
+    stream.next_out  = reinterpret_cast<Bytef *>(&output[0]);
+    stream.avail_out = static_cast<uInt>(output.size());
+    ret              = inflate(&stream, Z_FINISH);
+    output.resize(stream.total_out);
+    inflateEnd(&stream);
+
+    EXPECT_EQ(ret, Z_STREAM_END);
+
+    return output;
+}
+
+} // namespace
+
+TEST(RestResponse, CompressesWithGzip)
+{
+    Response    response;
+    std::string body = MakeBody();
+
+    response.SetBody(body);
+    response.SetHeader("ETag", "\"0123456789abcdef\"");
+    response.Compress("gzip, deflate");
+
+    ASSERT_EQ(GetHeader(response, "Content-Encoding"), "gzip");
+    EXPECT_EQ(GetHeader(response, "Vary"), "Accept-Encoding");
+    EXPECT_EQ(GetHeader(response, "ETag"), "W/\"0123456789abcdef\"");
+    EXPECT_LT(response.GetBody().size(), MakeBody().size());
+    EXPECT_EQ(Inflate(response.GetBody(), /* aGzip */ true), MakeBody());
+}
+
+TEST(RestResponse, CompressesWithDeflate)
+{
+    Response    response;
+    std::string body = MakeBody();
+
+    response.SetBody(body);
+    response.Compress("deflate");
+
+    ASSERT_EQ(GetHeader(response, "Content-Encoding"), "deflate");
+    EXPECT_EQ(Inflate(response.GetBody(), /* aGzip */ false), MakeBody());
+}
+
+TEST(RestResponse, KeepsIdentity)
+{
+    Response    response;
+    std::string body      = MakeBody();
+    std::string shortBody = "{}";
+
+    response.SetBody(body);
+    response.Compress("");
+    EXPECT_EQ(GetHeader(response, "Content-Encoding"), "(absent)");
+    EXPECT_EQ(response.GetBody(), MakeBody());
+
+    response.SetBody(shortBody);
+    response.Compress("gzip");
+    EXPECT_EQ(GetHeader(response, "Content-Encoding"), "(absent)");
+    EXPECT_EQ(response.GetBody(), "{}");
+
+    EXPECT_EQ(Negotiate("identity"), "(absent)");
+    EXPECT_EQ(Negotiate("br, compress"), "(absent)");
+}
+
+TEST(RestResponse, NegotiatesQualityValues)
+{
+    // A zero quality value refuses a coding.
+    EXPECT_EQ(Negotiate("gzip;q=0"), "(absent)");
+    EXPECT_EQ(Negotiate("gzip;q=0.000, deflate"), "deflate");
+    EXPECT_EQ(Negotiate("gzip; q=0, deflate;q=0.0"), "(absent)");
+    EXPECT_EQ(Negotiate("GZIP;Q=0.001"), "gzip");
+
+    // The coding with the highest quality value is used, gzip is preferred when they are the same.
+    EXPECT_EQ(Negotiate("gzip;q=0.5, deflate;q=0.8"), "deflate");
+    EXPECT_EQ(Negotiate("deflate;q=0.8, gzip;q=0.8"), "gzip");
+    EXPECT_EQ(Negotiate("gzip;q=0.5, identity;q=0.9"), "(absent)");
+    EXPECT_EQ(Negotiate("gzip;q=1.0, identity;q=1"), "gzip");
+
+    // Invalid weights and other parameters are ignored.
+    EXPECT_EQ(Negotiate("gzip;q=2"), "gzip");
+    EXPECT_EQ(Negotiate("gzip;q=0.5;level=1, deflate;q=0.4"), "gzip");
+    EXPECT_EQ(Negotiate("gzip;level=1;q=0, deflate;q=0.4"), "deflate");
+}
+
+TEST(RestResponse, NegotiatesWildcard)
+{
+    EXPECT_EQ(Negotiate("*"), "gzip");
+    EXPECT_EQ(Negotiate("*;q=0.5"), "gzip");
+    EXPECT_EQ(Negotiate("*;q=0"), "(absent)");
+    EXPECT_EQ(Negotiate("gzip;q=0, *"), "deflate");
+    EXPECT_EQ(Negotiate("*;q=0, deflate"), "deflate");
+
+    // A listed coding takes its own quality value rather than the one of the wildcard.
+    EXPECT_EQ(Negotiate("*;q=0.9, gzip;q=0.1"), "deflate");
+    EXPECT_EQ(Negotiate("*;q=0.5, identity"), "(absent)");
+}
+
+#endif // OTBR_ENABLE_REST_COMPRESSION
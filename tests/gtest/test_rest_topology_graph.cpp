@@ -0,0 +1,183 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include <vector>
+
+#include "rest/topology_graph.hpp"
+
+using otbr::Timepoint;
+using otbr::rest::TopologyGraph;
+
+namespace {
+
+struct RouteEntry
+{
+    uint8_t mRouterId;
+    uint8_t mLinkQualityIn;
+    uint8_t mLinkQualityOut;
+};
+
+// Builds the diagnostic TLVs of a router with its links to other routers and its children.
+std::vector<otNetworkDiagTlv> MakeTlvs(uint16_t                       aRloc16,
+                                       const std::vector<RouteEntry> &aRoutes,
+                                       const std::vector<uint16_t>   &aChildIds = {})
+{
+    std::vector<otNetworkDiagTlv> tlvs(3);
+
+    memset(tlvs.data(), 0, sizeof(otNetworkDiagTlv) * tlvs.size());
+
+    tlvs[0].mType         = OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS;
+    tlvs[0].mData.mAddr16 = aRloc16;
+
+    // The route set includes the router itself.
+    tlvs[1].mType                                = OT_NETWORK_DIAGNOSTIC_TLV_ROUTE;
+    tlvs[1].mData.mRoute.mRouteData[0].mRouterId = aRloc16 >> 10;
+    tlvs[1].mData.mRoute.mRouteCount             = 1;
+    for (const RouteEntry &route : aRoutes)
+    {
+        otNetworkDiagRouteData &data = tlvs[1].mData.mRoute.mRouteData[tlvs[1].mData.mRoute.mRouteCount++];
+
+        data.mRouterId       = route.mRouterId;
+        data.mLinkQualityIn  = route.mLinkQualityIn;
+        data.mLinkQualityOut = route.mLinkQualityOut;
+    }
+
+    tlvs[2].mType = OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE;
+    for (uint16_t childId : aChildIds)
+    {
+        tlvs[2].mData.mChildTable.mTable[tlvs[2].mData.mChildTable.mCount++].mChildId = childId;
+    }
+
+    return tlvs;
+}
+
+// Routers 0, 1 and 2 in a line of good links, a poor shortcut from router 0 to router 2 and a child of router 1.
+void MakeConnectedGraph(TopologyGraph &aGraph)
+{
+    aGraph.Update(MakeTlvs(0x0000, {{1, 3, 3}, {2, 1, 1}}), Timepoint());
+    aGraph.Update(MakeTlvs(0x0400, {{0, 3, 3}, {2, 3, 2}}, {1}), Timepoint());
+    aGraph.Update(MakeTlvs(0x0800, {{1, 2, 3}}), Timepoint());
+}
+
+} // namespace
+
+TEST(RestTopologyGraph, FindsPathOfLeastCost)
+{
+    TopologyGraph       graph;
+    TopologyGraph::Path path;
+
+    MakeConnectedGraph(graph);
+    EXPECT_EQ(graph.GetNodeCount(), 4u);
+
+    // The shortcut costs 4, the path through router 1 costs 1 + 2.
+    ASSERT_TRUE(graph.FindPath(0x0000, 0x0800, path));
+    EXPECT_EQ(path.mCost, 3u);
+    EXPECT_EQ(path.mNodes, (std::vector<uint16_t>{0x0000, 0x0400, 0x0800}));
+
+    // A link to a child costs 1.
+    ASSERT_TRUE(graph.FindPath(0x0401, 0x0000, path));
+    EXPECT_EQ(path.mCost, 2u);
+    EXPECT_EQ(path.mNodes, (std::vector<uint16_t>{0x0401, 0x0400, 0x0000}));
+}
+
+TEST(RestTopologyGraph, FindsPathToItself)
+{
+    TopologyGraph       graph;
+    TopologyGraph::Path path;
+
+    MakeConnectedGraph(graph);
+
+    ASSERT_TRUE(graph.FindPath(0x0400, 0x0400, path));
+    EXPECT_EQ(path.mCost, 0u);
+    EXPECT_EQ(path.mNodes, (std::vector<uint16_t>{0x0400}));
+}
+
+TEST(RestTopologyGraph, FindsNoPathToUnreachableNode)
+{
+    TopologyGraph       graph;
+    TopologyGraph::Path path;
+
+    MakeConnectedGraph(graph);
+
+    // Router 3 is only linked in one direction.
+    graph.Update(MakeTlvs(0x0c00, {{2, 3, 0}}), Timepoint());
+
+    EXPECT_TRUE(graph.Contains(0x0c00));
+    EXPECT_FALSE(graph.FindPath(0x0000, 0x0c00, path));
+    EXPECT_TRUE(path.mNodes.empty());
+
+    EXPECT_FALSE(graph.Contains(0x1000));
+    EXPECT_FALSE(graph.FindPath(0x0000, 0x1000, path));
+    EXPECT_FALSE(graph.FindPath(0x1000, 0x1000, path));
+}
+
+TEST(RestTopologyGraph, GetsPartitions)
+{
+    TopologyGraph                      graph;
+    TopologyGraph::Path                path;
+    std::vector<std::vector<uint16_t>> partitions;
+
+    MakeConnectedGraph(graph);
+    graph.GetPartitions(partitions);
+    EXPECT_EQ(partitions, (std::vector<std::vector<uint16_t>>{{0x0000, 0x0400, 0x0401, 0x0800}}));
+
+    // Routers 4 and 5 only see each other.
+    graph.Update(MakeTlvs(0x1400, {{4, 3, 3}}, {2}), Timepoint());
+    graph.Update(MakeTlvs(0x1000, {{5, 3, 3}}), Timepoint());
+
+    graph.GetPartitions(partitions);
+    EXPECT_EQ(partitions,
+              (std::vector<std::vector<uint16_t>>{{0x0000, 0x0400, 0x0401, 0x0800}, {0x1000, 0x1400, 0x1402}}));
+    EXPECT_FALSE(graph.FindPath(0x0401, 0x1402, path));
+
+    // Router 5 links both partitions.
+    graph.Update(MakeTlvs(0x1400, {{4, 3, 3}, {2, 3, 3}}, {2}), Timepoint());
+
+    graph.GetPartitions(partitions);
+    EXPECT_EQ(partitions.size(), 1u);
+    EXPECT_TRUE(graph.FindPath(0x0401, 0x1402, path));
+}
+
+TEST(RestTopologyGraph, RemovesExpiredReports)
+{
+    TopologyGraph                      graph;
+    Timepoint                          start;
+    std::vector<std::vector<uint16_t>> partitions;
+
+    graph.Update(MakeTlvs(0x0000, {{1, 3, 3}}), start);
+    graph.Update(MakeTlvs(0x0800, {{1, 3, 3}}), start + otbr::Milliseconds(10));
+
+    // Router 1 is still reported by router 2 once the report of router 0 expires.
+    EXPECT_EQ(graph.RemoveExpired(start + otbr::Milliseconds(5)), 1u);
+    graph.GetPartitions(partitions);
+    EXPECT_EQ(partitions, (std::vector<std::vector<uint16_t>>{{0x0400, 0x0800}}));
+}
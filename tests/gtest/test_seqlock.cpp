@@ -0,0 +1,113 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <atomic>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "common/seqlock.hpp"
+
+struct TestValue
+{
+    uint32_t mSerial;
+    uint8_t  mBytes[61];
+    uint32_t mCheck;
+};
+
+static TestValue MakeTestValue(uint32_t aSerial)
+{
+    TestValue value;
+
+    memset(&value, 0, sizeof(value));
+    value.mSerial = aSerial;
+    memset(value.mBytes, static_cast<int>(aSerial & 0xff), sizeof(value.mBytes));
+    value.mCheck = ~aSerial;
+
+    return value;
+}
+
+TEST(SeqLock, TestStoreLoad)
+{
+    otbr::SeqLock<TestValue> seqLock;
+    TestValue                value = seqLock.Load();
+
+    EXPECT_EQ(0u, value.mSerial);
+    EXPECT_EQ(0u, value.mCheck);
+
+    seqLock.Store(MakeTestValue(7));
+    value = seqLock.Load();
+
+    EXPECT_EQ(7u, value.mSerial);
+    EXPECT_EQ(7u, value.mBytes[60]);
+    EXPECT_EQ(~7u, value.mCheck);
+}
+
+TEST(SeqLock, TestReadersSeeConsistentValues)
+{
+    static constexpr uint32_t kNumStores = 100000;
+
+    otbr::SeqLock<TestValue> seqLock;
+    std::atomic<bool>        done{false};
+    std::atomic<int>         inconsistent{0};
+    std::vector<std::thread> readers;
+
+    for (int i = 0; i < 2; i++)
+    {
+        readers.emplace_back([&]() {
+            uint32_t last = 0;
+
+            while (!done.load())
+            {
+                TestValue value = seqLock.Load();
+
+                if (value.mSerial != 0 && (value.mCheck != ~value.mSerial || value.mSerial < last ||
+                                           value.mBytes[0] != (value.mSerial & 0xff) ||
+                                           value.mBytes[60] != (value.mSerial & 0xff)))
+                {
+                    ++inconsistent;
+                }
+                last = value.mSerial;
+            }
+        });
+    }
+
+    for (uint32_t serial = 1; serial <= kNumStores; serial++)
+    {
+        seqLock.Store(MakeTestValue(serial));
+    }
+
+    done = true;
+    for (std::thread &reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_EQ(0, inconsistent.load());
+    EXPECT_EQ(kNumStores, seqLock.Load().mSerial);
+}
@@ -0,0 +1,76 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ncp/spinel_frame_trace.hpp"
+
+using otbr::Ncp::SpinelFrameTrace;
+
+TEST(SpinelFrameTrace, TestRecordsInOrder)
+{
+    SpinelFrameTrace                      trace;
+    std::vector<SpinelFrameTrace::Record> records;
+
+    trace.GetRecords(records);
+    EXPECT_TRUE(records.empty());
+
+    trace.Add(SpinelFrameTrace::kDirectionTx, 0x81, 3, 0x46, 12);
+    trace.Add(SpinelFrameTrace::kDirectionRx, 0x81, 6, 0x46, 14);
+    trace.GetRecords(records);
+
+    ASSERT_EQ(2u, records.size());
+    EXPECT_EQ(SpinelFrameTrace::kDirectionTx, records[0].mDirection);
+    EXPECT_EQ(0x81, records[0].mHeader);
+    EXPECT_EQ(3u, records[0].mCommand);
+    EXPECT_EQ(0x46u, records[0].mPropKey);
+    EXPECT_EQ(12u, records[0].mLength);
+    EXPECT_EQ(SpinelFrameTrace::kDirectionRx, records[1].mDirection);
+    EXPECT_EQ(6u, records[1].mCommand);
+    EXPECT_EQ(14u, records[1].mLength);
+    EXPECT_LE(records[0].mTimestamp, records[1].mTimestamp);
+}
+
+TEST(SpinelFrameTrace, TestOverwritesOldestRecords)
+{
+    static constexpr uint32_t kNumFrames = SpinelFrameTrace::kNumRecords + 10;
+
+    SpinelFrameTrace                      trace;
+    std::vector<SpinelFrameTrace::Record> records;
+
+    for (uint32_t i = 0; i < kNumFrames; i++)
+    {
+        trace.Add(SpinelFrameTrace::kDirectionTx, 0x80, 3, i, 4);
+    }
+    trace.GetRecords(records);
+
+    EXPECT_EQ(kNumFrames, trace.GetNumAdded());
+    ASSERT_EQ(SpinelFrameTrace::kNumRecords, records.size());
+    EXPECT_EQ(10u, records.front().mPropKey);
+    EXPECT_EQ(kNumFrames - 1, records.back().mPropKey);
+}
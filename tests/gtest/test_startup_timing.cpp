@@ -0,0 +1,65 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/startup_timing.hpp"
+
+using otbr::StartupTiming;
+
+TEST(StartupTiming, TestMarkKeepsFirstCompletion)
+{
+    StartupTiming &timing = StartupTiming::Get();
+
+    timing.Start();
+    EXPECT_FALSE(timing.IsMarked(StartupTiming::kPhaseHostInitialized));
+
+    EXPECT_TRUE(timing.Mark(StartupTiming::kPhaseHostInitialized));
+    EXPECT_TRUE(timing.IsMarked(StartupTiming::kPhaseHostInitialized));
+    EXPECT_FALSE(timing.IsMarked(StartupTiming::kPhaseReady));
+
+    uint32_t elapsed = timing.GetElapsedMs(StartupTiming::kPhaseHostInitialized);
+
+    EXPECT_FALSE(timing.Mark(StartupTiming::kPhaseHostInitialized));
+    EXPECT_EQ(timing.GetElapsedMs(StartupTiming::kPhaseHostInitialized), elapsed);
+
+    EXPECT_TRUE(timing.Mark(StartupTiming::kPhaseReady));
+    EXPECT_GE(timing.GetElapsedMs(StartupTiming::kPhaseReady), elapsed);
+    timing.LogSummary();
+
+    timing.Start();
+    EXPECT_FALSE(timing.IsMarked(StartupTiming::kPhaseHostInitialized));
+    EXPECT_FALSE(timing.IsMarked(StartupTiming::kPhaseReady));
+}
+
+TEST(StartupTiming, TestPhaseToString)
+{
+    EXPECT_STREQ(StartupTiming::PhaseToString(StartupTiming::kPhaseHostInitialized), "host");
+    EXPECT_STREQ(StartupTiming::PhaseToString(StartupTiming::kPhaseMdnsReady), "mdns");
+    EXPECT_STREQ(StartupTiming::PhaseToString(StartupTiming::kNumPhases), "unknown");
+}
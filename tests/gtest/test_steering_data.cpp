@@ -0,0 +1,101 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "utils/crc16.hpp"
+#include "utils/steering_data.hpp"
+
+TEST(Crc16, CheckValues)
+{
+    const uint8_t message[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    otbr::Crc16   ccitt(otbr::Crc16::kCcitt);
+    otbr::Crc16   ansi(otbr::Crc16::kAnsi);
+
+    ccitt.Update(message, sizeof(message));
+    ansi.Update(message, sizeof(message));
+
+    EXPECT_EQ(ccitt.Get(), 0x31c3);
+    EXPECT_EQ(ansi.Get(), 0xfee8);
+}
+
+TEST(Crc16, BytewiseMatchesSliced)
+{
+    uint8_t message[37];
+
+    for (size_t i = 0; i < sizeof(message); i++)
+    {
+        message[i] = static_cast<uint8_t>(i * 37 + 11);
+    }
+
+    for (otbr::Crc16::Polynomial polynomial : {otbr::Crc16::kCcitt, otbr::Crc16::kAnsi})
+    {
+        otbr::Crc16 bytewise(polynomial);
+        otbr::Crc16 sliced(polynomial);
+
+        for (uint8_t byte : message)
+        {
+            bytewise.Update(byte);
+        }
+        sliced.Update(message[0]);
+        sliced.Update(message + 1, sizeof(message) - 1);
+
+        EXPECT_EQ(bytewise.Get(), sliced.Get());
+    }
+}
+
+TEST(SteeringData, ComputeForJoinersMatchesPerJoiner)
+{
+    std::vector<uint8_t> eui64s;
+    otbr::SteeringData   perJoiner;
+    otbr::SteeringData   batch;
+
+    for (uint8_t i = 0; i < 100; i++)
+    {
+        const uint8_t eui64[] = {0x18, 0xb4, 0x30, 0x00, 0x00, 0x00, 0x00, i};
+
+        eui64s.insert(eui64s.end(), eui64, eui64 + sizeof(eui64));
+    }
+
+    perJoiner.Init(otbr::SteeringData::kMaxSizeOfBloomFilter);
+    batch.Init(otbr::SteeringData::kMaxSizeOfBloomFilter);
+
+    for (size_t i = 0; i < eui64s.size(); i += otbr::SteeringData::kSizeJoinerId)
+    {
+        uint8_t joinerId[otbr::SteeringData::kSizeJoinerId];
+
+        otbr::SteeringData::ComputeJoinerId(&eui64s[i], joinerId);
+        perJoiner.ComputeBloomFilter(joinerId);
+    }
+    batch.ComputeForJoiners(eui64s.data(), eui64s.size() / otbr::SteeringData::kSizeJoinerId);
+
+    EXPECT_EQ(memcmp(perJoiner.GetBloomFilter(), batch.GetBloomFilter(), otbr::SteeringData::kMaxSizeOfBloomFilter),
+              0);
+}
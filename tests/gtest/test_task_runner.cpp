@@ -33,7 +33,9 @@
 #include <gtest/gtest.h>
 #include <unistd.h>
 
+#include "common/mainloop_manager.hpp"
 #include "common/task_runner.hpp"
+#include "common/time.hpp"
 
 TEST(TaskRunner, TestSingleThread)
 {
@@ -251,6 +253,87 @@ TEST(TaskRunner, TestDelayedTasksOrder)
     EXPECT_STREQ("bac", str.c_str());
 }
 
+static void TestMixedTasksOrder(otbr::TaskRunner::DelayedTaskQueue aDelayedTaskQueue)
+{
+    std::string      str;
+    otbr::TaskRunner taskRunner(aDelayedTaskQueue);
+
+    taskRunner.Post([&]() { str.push_back('a'); });
+    taskRunner.Post(std::chrono::milliseconds(0), [&]() { str.push_back('b'); });
+    taskRunner.Post([&]() { str.push_back('c'); });
+    taskRunner.Post(std::chrono::milliseconds(0), [&]() { str.push_back('d'); });
+    taskRunner.Post(std::chrono::milliseconds(0), [&]() { str.push_back('e'); });
+    taskRunner.Post([&]() { str.push_back('f'); });
+
+    while (str.size() < 6)
+    {
+        int                   rval;
+        otbr::MainloopContext mainloop;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {2, 0};
+
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        taskRunner.Update(mainloop);
+        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                      &mainloop.mTimeout);
+        EXPECT_TRUE(rval >= 0 || errno == EINTR);
+
+        taskRunner.Process(mainloop);
+    }
+
+    // Make sure that immediate tasks and expired delayed tasks are executed in the order of posting.
+    EXPECT_STREQ("abcdef", str.c_str());
+}
+
+TEST(TaskRunner, TestMixedTasksOrder)
+{
+    TestMixedTasksOrder(otbr::TaskRunner::DelayedTaskQueue::kHeap);
+    TestMixedTasksOrder(otbr::TaskRunner::DelayedTaskQueue::kTimerWheel);
+}
+
+TEST(TaskRunner, TestDelayedTasksInVirtualTime)
+{
+    std::string      str;
+    otbr::TaskRunner taskRunner;
+    otbr::Timepoint  start;
+    otbr::Timepoint  realStart = otbr::RealClock::now();
+
+    otbr::Clock::EnableVirtualTime();
+    start = otbr::Clock::now();
+
+    taskRunner.Post(std::chrono::hours(2), [&]() { str.push_back('b'); });
+    taskRunner.Post(std::chrono::minutes(30), [&]() { str.push_back('a'); });
+
+    while (str.size() < 2)
+    {
+        otbr::MainloopContext mainloop;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {10, 0};
+
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        taskRunner.Update(mainloop);
+        EXPECT_GE(otbr::MainloopManager::Poll(mainloop), 0);
+
+        taskRunner.Process(mainloop);
+    }
+
+    // The tasks run at their deadlines in virtual time, without waiting for hours.
+    EXPECT_STREQ("ab", str.c_str());
+    EXPECT_GE(otbr::Clock::now() - start, std::chrono::hours(2));
+    EXPECT_LT(otbr::Clock::now() - start, std::chrono::hours(2) + std::chrono::seconds(10));
+    EXPECT_LT(otbr::RealClock::now() - realStart, std::chrono::seconds(10));
+
+    otbr::Clock::DisableVirtualTime();
+}
+
 TEST(TaskRunner, TestCancelDelayedTasks)
 {
     std::string              str;
@@ -347,3 +430,238 @@ TEST(TaskRunner, TestAllAPIs)
 
     EXPECT_EQ(30, counter.load());
 }
+
+TEST(TaskRunner, TestTimerWheelDelayedTasksOrder)
+{
+    std::string      str;
+    otbr::TaskRunner taskRunner(otbr::TaskRunner::DelayedTaskQueue::kTimerWheel);
+
+    taskRunner.Post(std::chrono::milliseconds(10), [&]() { str.push_back('a'); });
+    taskRunner.Post(std::chrono::milliseconds(9), [&]() { str.push_back('b'); });
+    taskRunner.Post(std::chrono::milliseconds(10), [&]() { str.push_back('c'); });
+    taskRunner.Post([&]() { str.push_back('d'); });
+
+    while (str.size() < 4)
+    {
+        int                   rval;
+        otbr::MainloopContext mainloop;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {2, 0};
+
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        taskRunner.Update(mainloop);
+        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                      &mainloop.mTimeout);
+        EXPECT_TRUE(rval >= 0 || errno == EINTR);
+
+        taskRunner.Process(mainloop);
+    }
+
+    // Make sure that tasks with smaller delay are executed earlier.
+    EXPECT_STREQ("dbac", str.c_str());
+}
+
+TEST(TaskRunner, TestTimerWheelCancelDelayedTasks)
+{
+    std::string              str;
+    otbr::TaskRunner         taskRunner(otbr::TaskRunner::DelayedTaskQueue::kTimerWheel);
+    otbr::TaskRunner::TaskId tid1, tid2, tid3;
+
+    tid1 = taskRunner.Post(std::chrono::milliseconds(10), [&]() { str.push_back('a'); });
+    tid2 = taskRunner.Post(std::chrono::milliseconds(20), [&]() { str.push_back('b'); });
+    tid3 = taskRunner.Post(std::chrono::milliseconds(30), [&]() { str.push_back('c'); });
+    taskRunner.Post(std::chrono::milliseconds(40), [&]() { str.push_back('d'); });
+
+    taskRunner.Cancel(tid2);
+    taskRunner.Post(std::chrono::milliseconds(10), [&]() { taskRunner.Cancel(tid3); });
+
+    while (str.size() < 2)
+    {
+        int                   rval;
+        otbr::MainloopContext mainloop;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {2, 0};
+
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        taskRunner.Update(mainloop);
+        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                      &mainloop.mTimeout);
+        EXPECT_TRUE(rval >= 0 || errno == EINTR);
+
+        taskRunner.Process(mainloop);
+    }
+
+    // Make sure the canceled tasks were not executed.
+    EXPECT_STREQ("ad", str.c_str());
+
+    // Make sure it's fine to cancel expired task IDs.
+    taskRunner.Cancel(tid1);
+    taskRunner.Cancel(tid2);
+}
+
+TEST(TaskRunner, TestProcessBudget)
+{
+    int              counter = 0;
+    otbr::TaskRunner taskRunner;
+
+    taskRunner.SetProcessBudget(2, std::chrono::milliseconds(0));
+
+    for (size_t i = 0; i < 5; ++i)
+    {
+        taskRunner.Post([&]() { ++counter; });
+    }
+
+    for (int expected : {2, 4, 5})
+    {
+        int                   rval;
+        otbr::MainloopContext mainloop;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {2, 0};
+
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        taskRunner.Update(mainloop);
+        if (expected != 2)
+        {
+            // Deferred tasks should not wait for the timeout.
+            EXPECT_EQ(0, mainloop.mTimeout.tv_sec);
+            EXPECT_EQ(0, mainloop.mTimeout.tv_usec);
+        }
+        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                      &mainloop.mTimeout);
+        EXPECT_TRUE(rval >= 0 || errno == EINTR);
+
+        taskRunner.Process(mainloop);
+        EXPECT_EQ(expected, counter);
+    }
+}
+
+static void ProcessTaskRunnerOnce(otbr::TaskRunner &aTaskRunner)
+{
+    int                   rval;
+    otbr::MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {0, 100000};
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    aTaskRunner.Update(mainloop);
+    rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                  &mainloop.mTimeout);
+    EXPECT_TRUE(rval >= 0 || errno == EINTR);
+
+    aTaskRunner.Process(mainloop);
+}
+
+TEST(TaskRunner, TestPostAndWaitFor)
+{
+    std::atomic<int> counter{0};
+    int              result = 0;
+    otbr::TaskRunner taskRunner;
+    otbrError        error;
+
+    // The mainloop is stalled, the task is canceled on timeout.
+    error = taskRunner.PostAndWaitFor<int>(std::chrono::milliseconds(10), [&]() { return ++counter; }, result);
+    EXPECT_EQ(OTBR_ERROR_TIMEOUT, error);
+    ProcessTaskRunnerOnce(taskRunner);
+    EXPECT_EQ(0, counter.load());
+
+    std::thread thread([&]() {
+        error = taskRunner.PostAndWaitFor<int>(std::chrono::seconds(10), [&]() { return ++counter; }, result);
+    });
+
+    while (counter.load() < 1)
+    {
+        ProcessTaskRunnerOnce(taskRunner);
+    }
+    thread.join();
+
+    EXPECT_EQ(OTBR_ERROR_NONE, error);
+    EXPECT_EQ(1, result);
+}
+
+TEST(TaskRunner, TestPostAndWaitForTimeoutWhileRunning)
+{
+    otbr::TaskRunner  taskRunner;
+    std::atomic<bool> started{false};
+    std::atomic<bool> finished{false};
+    std::atomic<bool> returned{false};
+    int               result = 0;
+    otbrError         error;
+
+    std::thread mainloop([&]() {
+        while (!returned.load())
+        {
+            ProcessTaskRunnerOnce(taskRunner);
+        }
+    });
+
+    // The task outlives the timeout once started, the caller must not return before it's done.
+    error = taskRunner.PostAndWaitFor<int>(
+        std::chrono::milliseconds(1),
+        [&]() {
+            started = true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            finished = true;
+            return 1;
+        },
+        result);
+
+    if (error == OTBR_ERROR_TIMEOUT)
+    {
+        // The task was canceled before the mainloop picked it up.
+        EXPECT_FALSE(started.load());
+    }
+    else
+    {
+        EXPECT_EQ(OTBR_ERROR_NONE, error);
+        EXPECT_TRUE(finished.load());
+        EXPECT_EQ(1, result);
+    }
+
+    returned = true;
+    mainloop.join();
+
+    EXPECT_EQ(started.load(), finished.load());
+}
+
+TEST(TaskRunner, TestTaskFuture)
+{
+    int                   counter = 0;
+    int                   result  = 0;
+    otbr::TaskRunner      taskRunner;
+    otbr::TaskFuture<int> future;
+
+    EXPECT_FALSE(future.IsValid());
+    EXPECT_EQ(OTBR_ERROR_INVALID_STATE, future.WaitFor(std::chrono::milliseconds(0), result));
+
+    future = taskRunner.PostWithFuture<int>([&]() { return ++counter; });
+    EXPECT_TRUE(future.IsValid());
+    EXPECT_EQ(OTBR_ERROR_TIMEOUT, future.WaitFor(std::chrono::milliseconds(0), result));
+    EXPECT_TRUE(future.Cancel());
+    ProcessTaskRunnerOnce(taskRunner);
+    EXPECT_EQ(0, counter);
+    EXPECT_EQ(OTBR_ERROR_ABORTED, future.WaitFor(std::chrono::milliseconds(0), result));
+    EXPECT_EQ(OTBR_ERROR_ABORTED, future.Wait(result));
+
+    future = taskRunner.PostWithFuture<int>([&]() { return ++counter; });
+    ProcessTaskRunnerOnce(taskRunner);
+    EXPECT_FALSE(future.Cancel());
+    EXPECT_EQ(OTBR_ERROR_NONE, future.WaitFor(std::chrono::milliseconds(0), result));
+    EXPECT_EQ(1, result);
+    EXPECT_EQ(OTBR_ERROR_INVALID_STATE, future.WaitFor(std::chrono::milliseconds(0), result));
+}
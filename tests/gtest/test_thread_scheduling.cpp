@@ -0,0 +1,85 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "common/thread_scheduling.hpp"
+
+using otbr::ThreadScheduling;
+
+TEST(ThreadScheduling, TestParseCpuList)
+{
+    std::vector<int> cpus;
+
+    EXPECT_TRUE(ThreadScheduling::ParseCpuList("1", cpus));
+    EXPECT_EQ(cpus, std::vector<int>({1}));
+
+    EXPECT_TRUE(ThreadScheduling::ParseCpuList("3,0-1", cpus));
+    EXPECT_EQ(cpus, std::vector<int>({0, 1, 3}));
+
+    EXPECT_TRUE(ThreadScheduling::ParseCpuList("2-3,3,1-2", cpus));
+    EXPECT_EQ(cpus, std::vector<int>({1, 2, 3}));
+
+    EXPECT_FALSE(ThreadScheduling::ParseCpuList("", cpus));
+    EXPECT_FALSE(ThreadScheduling::ParseCpuList("1,", cpus));
+    EXPECT_FALSE(ThreadScheduling::ParseCpuList("-1", cpus));
+    EXPECT_FALSE(ThreadScheduling::ParseCpuList("3-1", cpus));
+    EXPECT_FALSE(ThreadScheduling::ParseCpuList("1-", cpus));
+    EXPECT_FALSE(ThreadScheduling::ParseCpuList("1;2", cpus));
+    EXPECT_FALSE(ThreadScheduling::ParseCpuList("1024", cpus));
+}
+
+TEST(ThreadScheduling, TestApplyInvalidConfig)
+{
+    ThreadScheduling::Config config;
+
+    config.mMainloopNice = 20;
+    EXPECT_EQ(ThreadScheduling::Get().ApplyToMainloopThread(config), OTBR_ERROR_INVALID_ARGS);
+
+    config.mMainloopNice   = ThreadScheduling::kDefaultNice;
+    config.mManagementNice = -21;
+    EXPECT_EQ(ThreadScheduling::Get().ApplyToMainloopThread(config), OTBR_ERROR_INVALID_ARGS);
+
+    // The nice value doesn't apply to a real-time mainloop thread.
+    config.mManagementNice           = ThreadScheduling::kDefaultNice;
+    config.mMainloopRealtimePriority = 10;
+    config.mMainloopNice             = 5;
+    EXPECT_EQ(ThreadScheduling::Get().ApplyToMainloopThread(config), OTBR_ERROR_INVALID_ARGS);
+
+    config.mMainloopRealtimePriority = 100;
+    config.mMainloopNice             = ThreadScheduling::kDefaultNice;
+    EXPECT_EQ(ThreadScheduling::Get().ApplyToMainloopThread(config), OTBR_ERROR_INVALID_ARGS);
+}
+
+TEST(ThreadScheduling, TestApplyDefaultConfig)
+{
+    EXPECT_EQ(ThreadScheduling::Get().ApplyToMainloopThread(ThreadScheduling::Config()), OTBR_ERROR_NONE);
+    ThreadScheduling::Get().ApplyToManagementThread();
+}
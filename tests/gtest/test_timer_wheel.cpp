@@ -0,0 +1,179 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/timer_wheel.hpp"
+
+using otbr::Milliseconds;
+using otbr::Timepoint;
+using TimerWheel = otbr::TimerWheel<int>;
+
+TEST(TimerWheel, TestExpireInOrder)
+{
+    Timepoint  start = otbr::Clock::now();
+    TimerWheel wheel(start);
+    int        value;
+
+    wheel.Add(1, start + Milliseconds(10), 1);
+    wheel.Add(2, start + Milliseconds(9), 2);
+    wheel.Add(3, start + Milliseconds(10), 3);
+    wheel.Add(4, start + Milliseconds(5000), 4);
+    EXPECT_EQ(4u, wheel.GetSize());
+
+    EXPECT_FALSE(wheel.PopExpired(start + Milliseconds(8), value));
+    EXPECT_LE(wheel.GetNextDeadline(), start + Milliseconds(9));
+
+    EXPECT_TRUE(wheel.PopExpired(start + Milliseconds(10), value));
+    EXPECT_EQ(2, value);
+    EXPECT_TRUE(wheel.PopExpired(start + Milliseconds(10), value));
+    EXPECT_EQ(1, value);
+    EXPECT_TRUE(wheel.PopExpired(start + Milliseconds(10), value));
+    EXPECT_EQ(3, value);
+    EXPECT_FALSE(wheel.PopExpired(start + Milliseconds(10), value));
+
+    EXPECT_FALSE(wheel.PopExpired(start + Milliseconds(4999), value));
+    EXPECT_TRUE(wheel.PopExpired(start + Milliseconds(5000), value));
+    EXPECT_EQ(4, value);
+    EXPECT_TRUE(wheel.IsEmpty());
+    EXPECT_EQ(Timepoint::max(), wheel.GetNextDeadline());
+}
+
+TEST(TimerWheel, TestCancel)
+{
+    Timepoint  start = otbr::Clock::now();
+    TimerWheel wheel(start);
+    int        value;
+
+    wheel.Add(1, start + Milliseconds(10), 1);
+    wheel.Add(2, start + Milliseconds(100000), 2);
+    wheel.Add(3, start + Milliseconds(0), 3);
+
+    EXPECT_TRUE(wheel.Cancel(2));
+    EXPECT_FALSE(wheel.Cancel(2));
+    EXPECT_TRUE(wheel.Cancel(3));
+    EXPECT_EQ(1u, wheel.GetSize());
+
+    EXPECT_TRUE(wheel.PopExpired(start + Milliseconds(200000), value));
+    EXPECT_EQ(1, value);
+    EXPECT_FALSE(wheel.PopExpired(start + Milliseconds(200000), value));
+    EXPECT_FALSE(wheel.Cancel(1));
+}
+
+TEST(TimerWheel, TestPopEarlierThan)
+{
+    Timepoint  start = otbr::Clock::now();
+    TimerWheel wheel(start);
+    int        value;
+
+    wheel.Add(1, start + Milliseconds(10), 1);
+    wheel.Add(3, start + Milliseconds(10), 3);
+    wheel.Add(4, start + Milliseconds(20), 4);
+
+    EXPECT_FALSE(wheel.PopEarlierThan(start + Milliseconds(10), 1, value));
+    EXPECT_TRUE(wheel.PopEarlierThan(start + Milliseconds(10), 2, value));
+    EXPECT_EQ(1, value);
+    EXPECT_FALSE(wheel.PopEarlierThan(start + Milliseconds(10), 2, value));
+    EXPECT_TRUE(wheel.PopEarlierThan(start + Milliseconds(11), 2, value));
+    EXPECT_EQ(3, value);
+    EXPECT_FALSE(wheel.PopEarlierThan(start + Milliseconds(20), 4, value));
+    EXPECT_TRUE(wheel.PopExpired(start + Milliseconds(20), value));
+    EXPECT_EQ(4, value);
+    EXPECT_TRUE(wheel.IsEmpty());
+}
+
+TEST(TimerWheel, TestRandomDeadlines)
+{
+    Timepoint                          start = otbr::Clock::now();
+    TimerWheel                         wheel(start);
+    std::mt19937                       random(0);
+    std::uniform_int_distribution<int> distribution(0, 24 * 3600 * 1000);
+    std::vector<int>                   deadlines;
+    Timepoint                          now = start;
+    int                                value;
+    int                                lastDeadline = -1;
+    size_t                             count        = 0;
+
+    for (int i = 0; i < 2000; i++)
+    {
+        deadlines.push_back(distribution(random));
+        wheel.Add(i + 1, start + Milliseconds(deadlines.back()), i);
+    }
+
+    // Advance in irregular steps and make sure no timer expires early or out of order.
+    while (!wheel.IsEmpty())
+    {
+        Timepoint next = wheel.GetNextDeadline();
+
+        ASSERT_NE(Timepoint::max(), next);
+        now = std::max(now, next);
+
+        while (wheel.PopExpired(now, value))
+        {
+            EXPECT_LE(start + Milliseconds(deadlines[value]), now);
+            EXPECT_LE(lastDeadline, deadlines[value]);
+            lastDeadline = deadlines[value];
+            ++count;
+        }
+
+        now += Milliseconds(distribution(random) % 3000);
+    }
+
+    EXPECT_EQ(deadlines.size(), count);
+}
+
+TEST(TimerWheel, TestNoLateExpiration)
+{
+    Timepoint                          start = otbr::Clock::now();
+    TimerWheel                         wheel(start);
+    std::mt19937                       random(1);
+    std::uniform_int_distribution<int> distribution(1, 3600 * 1000);
+    std::vector<int>                   deadlines;
+    int                                value;
+
+    for (int i = 0; i < 500; i++)
+    {
+        deadlines.push_back(distribution(random));
+        wheel.Add(i + 1, start + Milliseconds(deadlines.back()), i);
+    }
+
+    // Only wake up at the reported deadlines, every timer must expire exactly at its deadline.
+    while (!wheel.IsEmpty())
+    {
+        Timepoint now = wheel.GetNextDeadline();
+
+        while (wheel.PopExpired(now, value))
+        {
+            EXPECT_EQ(start + Milliseconds(deadlines[value]), now);
+        }
+    }
+}
@@ -0,0 +1,89 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/tlv.hpp"
+
+TEST(TlvView, TestIterate)
+{
+    const uint8_t buffer[] = {0x01, 0x01, 0xaa, 0x02, 0x00, 0x03, 0xff, 0x00, 0x02, 0xbb, 0xcc};
+    otbr::TlvView view(buffer, sizeof(buffer));
+    uint8_t       types[3];
+    uint8_t       count = 0;
+
+    for (const otbr::Tlv &tlv : view)
+    {
+        ASSERT_LT(count, sizeof(types));
+        types[count++] = tlv.GetType();
+    }
+
+    ASSERT_EQ(count, 3);
+    EXPECT_EQ(types[0], 0x01);
+    EXPECT_EQ(types[1], 0x02);
+    EXPECT_EQ(types[2], 0x03);
+    EXPECT_TRUE(view.IsWellFormed());
+
+    ASSERT_NE(view.Find(0x03), nullptr);
+    EXPECT_EQ(view.Find(0x03)->GetLength(), 2);
+    EXPECT_EQ(view.Find(0x03)->GetValueUInt16(), 0xbbcc);
+    EXPECT_EQ(view.Find(0x04), nullptr);
+}
+
+TEST(TlvView, TestTruncatedTlvs)
+{
+    const uint8_t truncatedValue[]  = {0x01, 0x01, 0xaa, 0x02, 0x05, 0x00};
+    const uint8_t truncatedHeader[] = {0x01, 0x01, 0xaa, 0x02, 0xff, 0x00};
+    const uint8_t truncatedType[]   = {0x01, 0x01, 0xaa, 0x02};
+
+    for (const otbr::TlvView &view : {otbr::TlvView(truncatedValue, sizeof(truncatedValue)),
+                                      otbr::TlvView(truncatedHeader, sizeof(truncatedHeader)),
+                                      otbr::TlvView(truncatedType, sizeof(truncatedType))})
+    {
+        EXPECT_FALSE(view.IsWellFormed());
+        EXPECT_NE(view.Find(0x01), nullptr);
+        EXPECT_EQ(view.Find(0x02), nullptr);
+    }
+
+    EXPECT_TRUE(otbr::TlvView(truncatedValue, 0).IsWellFormed());
+    EXPECT_EQ(otbr::TlvView(truncatedValue, 0).begin(), otbr::TlvView(truncatedValue, 0).end());
+}
+
+TEST(TlvView, TestFindMultipleTypes)
+{
+    const uint8_t    buffer[] = {0x01, 0x01, 0xaa, 0x02, 0x00, 0x01, 0x01, 0xbb};
+    const uint8_t    types[]  = {0x02, 0x01, 0x05};
+    const otbr::Tlv *tlvs[sizeof(types)];
+
+    EXPECT_EQ(otbr::TlvView(buffer, sizeof(buffer)).Find(types, tlvs, sizeof(types)), 2);
+    ASSERT_NE(tlvs[0], nullptr);
+    EXPECT_EQ(tlvs[0]->GetLength(), 0);
+    ASSERT_NE(tlvs[1], nullptr);
+    EXPECT_EQ(tlvs[1]->GetValueUInt8(), 0xaa);
+    EXPECT_EQ(tlvs[2], nullptr);
+}
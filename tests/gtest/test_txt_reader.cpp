@@ -0,0 +1,103 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/txt_reader.hpp"
+
+using otbr::TxtReader;
+
+namespace {
+
+// "xa=\x01\x02" "" "Flag" "=orphan" "rv=1"
+const uint8_t kTxtData[] = {5, 'x', 'a', '=', 1, 2, 0, 4, 'F', 'l', 'a', 'g', 7, '=', 'o', 'r', 'p', 'h', 'a', 'n',
+                            4, 'r', 'v', '=', '1'};
+
+} // namespace
+
+TEST(TxtReader, ReadsEntriesInPlace)
+{
+    TxtReader        reader(kTxtData, sizeof(kTxtData));
+    TxtReader::Entry entry;
+
+    ASSERT_EQ(reader.ReadNext(entry), OTBR_ERROR_NONE);
+    EXPECT_EQ(entry.mKey, "xa");
+    EXPECT_FALSE(entry.mIsBooleanAttribute);
+    EXPECT_EQ(entry.mValue, &kTxtData[4]);
+    EXPECT_EQ(entry.mValueLength, 2);
+
+    ASSERT_EQ(reader.ReadNext(entry), OTBR_ERROR_NONE);
+    EXPECT_EQ(entry.mKey, "Flag");
+    EXPECT_TRUE(entry.mIsBooleanAttribute);
+    EXPECT_EQ(entry.mValue, nullptr);
+    EXPECT_EQ(entry.mValueLength, 0);
+
+    ASSERT_EQ(reader.ReadNext(entry), OTBR_ERROR_NONE);
+    EXPECT_TRUE(entry.mKey.IsEmpty());
+    EXPECT_EQ(entry.mValueLength, 6);
+
+    ASSERT_EQ(reader.ReadNext(entry), OTBR_ERROR_NONE);
+    EXPECT_EQ(entry.mKey, "rv");
+    EXPECT_EQ(entry.mValueLength, 1);
+    EXPECT_EQ(entry.mValue[0], '1');
+
+    EXPECT_EQ(reader.ReadNext(entry), OTBR_ERROR_NOT_FOUND);
+    EXPECT_EQ(reader.ReadNext(entry), OTBR_ERROR_NOT_FOUND);
+}
+
+TEST(TxtReader, FindsKeysIgnoringCase)
+{
+    const std::vector<uint8_t> txtData(kTxtData, kTxtData + sizeof(kTxtData));
+    TxtReader                  reader(txtData);
+    TxtReader::Entry           entry;
+
+    ASSERT_EQ(reader.ReadNext(entry), OTBR_ERROR_NONE);
+
+    // The search starts from the first entry whatever entries were read.
+    ASSERT_EQ(reader.Find("XA", entry), OTBR_ERROR_NONE);
+    EXPECT_EQ(entry.mValue, &txtData[4]);
+
+    ASSERT_EQ(reader.Find("flag", entry), OTBR_ERROR_NONE);
+    EXPECT_TRUE(entry.mIsBooleanAttribute);
+
+    EXPECT_EQ(reader.Find("nn", entry), OTBR_ERROR_NOT_FOUND);
+}
+
+TEST(TxtReader, RejectsTruncatedData)
+{
+    const uint8_t    txtData[] = {4, 'r', 'v', '=', '1', 5, 'x', 'a', '='};
+    TxtReader        reader(txtData, sizeof(txtData));
+    TxtReader::Entry entry;
+
+    ASSERT_EQ(reader.ReadNext(entry), OTBR_ERROR_NONE);
+    EXPECT_EQ(reader.ReadNext(entry), OTBR_ERROR_PARSE);
+
+    EXPECT_EQ(TxtReader(txtData, sizeof(txtData)).Find("rv", entry), OTBR_ERROR_NONE);
+    EXPECT_EQ(TxtReader(txtData, sizeof(txtData)).Find("xa", entry), OTBR_ERROR_PARSE);
+    EXPECT_EQ(TxtReader(nullptr, 0).Find("xa", entry), OTBR_ERROR_NOT_FOUND);
+}
@@ -0,0 +1,395 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <poll.h>
+#include <stdlib.h>
+
+#include <dbus/dbus.h>
+
+#include "common/code_utils.hpp"
+#include "common/time.hpp"
+#include "dbus/common/constants.hpp"
+#include "dbus/common/dbus_message_helper.hpp"
+#include "dbus/common/dbus_resources.hpp"
+#include "web/web-service/dbus_backend.hpp"
+
+using otbr::Clock;
+using otbr::Milliseconds;
+using otbr::Seconds;
+using otbr::Timepoint;
+using otbr::DBus::DBusMessageEncodeToVariant;
+using otbr::DBus::UniqueDBusMessage;
+using otbr::Web::DBusBackend;
+
+namespace {
+
+constexpr Seconds kWaitTimeout(10);
+
+/**
+ * This class implements a fake border agent listening on a private D-Bus address, which stands for the system bus.
+ *
+ * It answers the bus methods a client calls on connecting and the properties read by `DBusBackend::GetStatus()`
+ * right away, and holds the replies of scans until `ReleaseScans()`.
+ *
+ * libdbus reads the system bus address only once in a process, so there is a single agent shared by the tests.
+ */
+class FakeAgent
+{
+public:
+    FakeAgent(void)
+    {
+        DBusError error;
+        char     *address;
+
+        dbus_error_init(&error);
+        mServer = dbus_server_listen("unix:tmpdir=/tmp", &error);
+        EXPECT_NE(mServer, nullptr) << (dbus_error_is_set(&error) ? error.message : "");
+        dbus_error_free(&error);
+
+        dbus_server_set_new_connection_function(mServer, HandleNewConnection, this, nullptr);
+        dbus_server_set_watch_functions(mServer, AddWatch, RemoveWatch, ToggleWatch, this, nullptr);
+        dbus_server_set_timeout_functions(mServer, AddTimeout, RemoveTimeout, nullptr, nullptr, nullptr);
+
+        address  = dbus_server_get_address(mServer);
+        mAddress = address;
+        dbus_free(address);
+
+        mThread = std::thread([this]() { Run(); });
+    }
+
+    ~FakeAgent(void)
+    {
+        mRunning = false;
+        mThread.join();
+
+        for (auto &scan : mPendingScans)
+        {
+            dbus_message_unref(scan.second);
+        }
+
+        for (DBusConnection *connection : mConnections)
+        {
+            dbus_connection_close(connection);
+            dbus_connection_unref(connection);
+        }
+
+        dbus_server_disconnect(mServer);
+        dbus_server_unref(mServer);
+    }
+
+    static FakeAgent &Get(void)
+    {
+        static FakeAgent sAgent;
+
+        return sAgent;
+    }
+
+    void Reset(void)
+    {
+        mReleaseScans = false;
+        mNumScans     = 0;
+    }
+
+    const std::string &GetAddress(void) const { return mAddress; }
+    uint32_t           GetNumScans(void) const { return mNumScans; }
+    void               ReleaseScans(void) { mReleaseScans = true; }
+
+private:
+    static void HandleNewConnection(DBusServer *aServer, DBusConnection *aConnection, void *aContext)
+    {
+        FakeAgent *agent = static_cast<FakeAgent *>(aContext);
+
+        OTBR_UNUSED_VARIABLE(aServer);
+
+        dbus_connection_ref(aConnection);
+        dbus_connection_set_watch_functions(aConnection, AddWatch, RemoveWatch, ToggleWatch, agent, nullptr);
+        dbus_connection_set_timeout_functions(aConnection, AddTimeout, RemoveTimeout, nullptr, nullptr, nullptr);
+        dbus_connection_add_filter(aConnection, HandleMessage, agent, nullptr);
+        agent->mConnections.push_back(aConnection);
+    }
+
+    static DBusHandlerResult HandleMessage(DBusConnection *aConnection, DBusMessage *aMessage, void *aContext)
+    {
+        FakeAgent        *agent  = static_cast<FakeAgent *>(aContext);
+        DBusHandlerResult result = DBUS_HANDLER_RESULT_HANDLED;
+        UniqueDBusMessage reply;
+
+        VerifyOrExit(dbus_message_get_type(aMessage) == DBUS_MESSAGE_TYPE_METHOD_CALL,
+                     result = DBUS_HANDLER_RESULT_NOT_YET_HANDLED);
+
+        if (dbus_message_is_method_call(aMessage, DBUS_INTERFACE_DBUS, "Hello"))
+        {
+            const char *uniqueName = ":1.1";
+
+            reply = UniqueDBusMessage(dbus_message_new_method_return(aMessage));
+            dbus_message_append_args(reply.get(), DBUS_TYPE_STRING, &uniqueName, DBUS_TYPE_INVALID);
+        }
+        else if (dbus_message_is_method_call(aMessage, OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SCAN_METHOD))
+        {
+            agent->mPendingScans.emplace_back(aConnection, dbus_message_ref(aMessage));
+            agent->mNumScans++;
+        }
+        else if (dbus_message_is_method_call(aMessage, OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_PROPERTIES_METHOD))
+        {
+            reply = NewStatusReply(aMessage);
+        }
+        else if (!dbus_message_get_no_reply(aMessage))
+        {
+            reply = UniqueDBusMessage(dbus_message_new_method_return(aMessage));
+        }
+
+        if (reply != nullptr)
+        {
+            dbus_connection_send(aConnection, reply.get(), nullptr);
+        }
+
+    exit:
+        return result;
+    }
+
+    // Replies with the properties in the order `DBusBackend::GetStatus()` reads them.
+    static UniqueDBusMessage NewStatusReply(DBusMessage *aMessage)
+    {
+        UniqueDBusMessage    reply(dbus_message_new_method_return(aMessage));
+        std::vector<uint8_t> dataset = {7, 8, 0xfd, 0x00, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00};
+        DBusMessageIter      iter;
+        DBusMessageIter      subIter;
+
+        dbus_message_iter_init_append(reply.get(), &iter);
+        dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY, DBUS_TYPE_VARIANT_AS_STRING, &subIter);
+        DBusMessageEncodeToVariant(&subIter, std::string("leader"));
+        DBusMessageEncodeToVariant(&subIter, std::string("host"));
+        DBusMessageEncodeToVariant(&subIter, std::string("rcp"));
+        DBusMessageEncodeToVariant(&subIter, uint64_t{0x18b4300000000001});
+        DBusMessageEncodeToVariant(&subIter, uint16_t{11});
+        DBusMessageEncodeToVariant(&subIter, int8_t{0});
+        DBusMessageEncodeToVariant(&subIter, std::string("OpenThread"));
+        DBusMessageEncodeToVariant(&subIter, uint64_t{0xdead00beef00cafe});
+        DBusMessageEncodeToVariant(&subIter, uint16_t{0x1234});
+        DBusMessageEncodeToVariant(&subIter, uint32_t{1});
+        DBusMessageEncodeToVariant(&subIter, dataset);
+        dbus_message_iter_close_container(&iter, &subIter);
+
+        return reply;
+    }
+
+    static dbus_bool_t AddWatch(DBusWatch *aWatch, void *aContext)
+    {
+        static_cast<FakeAgent *>(aContext)->mWatches.push_back(aWatch);
+        return TRUE;
+    }
+
+    static void RemoveWatch(DBusWatch *aWatch, void *aContext)
+    {
+        std::vector<DBusWatch *> &watches = static_cast<FakeAgent *>(aContext)->mWatches;
+
+        watches.erase(std::remove(watches.begin(), watches.end(), aWatch), watches.end());
+    }
+
+    static void ToggleWatch(DBusWatch *aWatch, void *aContext)
+    {
+        OTBR_UNUSED_VARIABLE(aWatch);
+        OTBR_UNUSED_VARIABLE(aContext);
+    }
+
+    // The client waits for replies with its own timeouts, the fake agent never times out.
+    static dbus_bool_t AddTimeout(DBusTimeout *aTimeout, void *aContext)
+    {
+        OTBR_UNUSED_VARIABLE(aTimeout);
+        OTBR_UNUSED_VARIABLE(aContext);
+        return TRUE;
+    }
+
+    static void RemoveTimeout(DBusTimeout *aTimeout, void *aContext)
+    {
+        OTBR_UNUSED_VARIABLE(aTimeout);
+        OTBR_UNUSED_VARIABLE(aContext);
+    }
+
+    void Run(void)
+    {
+        while (mRunning)
+        {
+            std::vector<DBusWatch *> watches = mWatches;
+            std::vector<pollfd>      fds;
+
+            for (DBusWatch *watch : watches)
+            {
+                pollfd   fd    = {-1, 0, 0};
+                unsigned flags = dbus_watch_get_flags(watch);
+
+                if (dbus_watch_get_enabled(watch))
+                {
+                    fd.fd     = dbus_watch_get_unix_fd(watch);
+                    fd.events = ((flags & DBUS_WATCH_READABLE) ? POLLIN : 0) |
+                                ((flags & DBUS_WATCH_WRITABLE) ? POLLOUT : 0);
+                }
+                fds.push_back(fd);
+            }
+
+            poll(fds.data(), fds.size(), 10);
+
+            for (size_t i = 0; i < watches.size(); i++)
+            {
+                unsigned flags = 0;
+
+                // A watch may have been removed by handling an earlier one.
+                if (fds[i].revents == 0 || std::find(mWatches.begin(), mWatches.end(), watches[i]) == mWatches.end())
+                {
+                    continue;
+                }
+
+                flags |= (fds[i].revents & POLLIN) ? DBUS_WATCH_READABLE : 0;
+                flags |= (fds[i].revents & POLLOUT) ? DBUS_WATCH_WRITABLE : 0;
+                flags |= (fds[i].revents & POLLHUP) ? DBUS_WATCH_HANGUP : 0;
+                flags |= (fds[i].revents & POLLERR) ? DBUS_WATCH_ERROR : 0;
+                dbus_watch_handle(watches[i], flags);
+            }
+
+            if (mReleaseScans)
+            {
+                for (auto &scan : mPendingScans)
+                {
+                    UniqueDBusMessage reply(dbus_message_new_method_return(scan.second));
+
+                    dbus_connection_send(scan.first, reply.get(), nullptr);
+                    dbus_message_unref(scan.second);
+                }
+                mPendingScans.clear();
+            }
+
+            for (auto it = mConnections.begin(); it != mConnections.end();)
+            {
+                while (dbus_connection_dispatch(*it) == DBUS_DISPATCH_DATA_REMAINS)
+                {
+                }
+                dbus_connection_flush(*it);
+
+                if (dbus_connection_get_is_connected(*it))
+                {
+                    ++it;
+                    continue;
+                }
+
+                mPendingScans.erase(std::remove_if(mPendingScans.begin(), mPendingScans.end(),
+                                                   [it](const std::pair<DBusConnection *, DBusMessage *> &aScan) {
+                                                       bool isClosed = (aScan.first == *it);
+
+                                                       if (isClosed)
+                                                       {
+                                                           dbus_message_unref(aScan.second);
+                                                       }
+                                                       return isClosed;
+                                                   }),
+                                    mPendingScans.end());
+                dbus_connection_unref(*it);
+                it = mConnections.erase(it);
+            }
+        }
+    }
+
+    DBusServer                                             *mServer;
+    std::string                                             mAddress;
+    std::thread                                             mThread;
+    std::atomic<bool>                                       mRunning{true};
+    std::atomic<bool>                                       mReleaseScans{false};
+    std::atomic<uint32_t>                                   mNumScans{0};
+    std::vector<DBusWatch *>                                mWatches;
+    std::vector<DBusConnection *>                           mConnections;
+    std::vector<std::pair<DBusConnection *, DBusMessage *>> mPendingScans;
+};
+
+template <typename Predicate> bool WaitUntil(Predicate aPredicate)
+{
+    Timepoint deadline = Clock::now() + kWaitTimeout;
+
+    while (!aPredicate() && Clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(Milliseconds(1));
+    }
+
+    return aPredicate();
+}
+
+} // namespace
+
+TEST(WebDBusBackend, AnswersStatusDuringScan)
+{
+    FakeAgent                                 &agent = FakeAgent::Get();
+    std::vector<DBusBackend::ActiveScanResult> results;
+    std::atomic<bool>                          isScanDone{false};
+    std::atomic<bool>                          isStatusDone{false};
+    DBusBackend::ClientError                   scanError   = DBusBackend::ClientError::ERROR_DBUS;
+    DBusBackend::ClientError                   statusError = DBusBackend::ClientError::ERROR_DBUS;
+    DBusBackend::Status                        status;
+    std::thread                                scanThread;
+    std::thread                                statusThread;
+
+    agent.Reset();
+    ASSERT_EQ(setenv("DBUS_SYSTEM_BUS_ADDRESS", agent.GetAddress().c_str(), 1), 0);
+
+    {
+        DBusBackend backend("wpan0");
+
+        scanThread = std::thread([&]() {
+            scanError  = backend.Scan(results);
+            isScanDone = true;
+        });
+        EXPECT_TRUE(WaitUntil([&]() { return agent.GetNumScans() == 1; }));
+
+        // The scan is still running, the status is answered on the other connection meanwhile.
+        statusThread = std::thread([&]() {
+            statusError  = backend.GetStatus(status);
+            isStatusDone = true;
+        });
+        EXPECT_TRUE(WaitUntil([&]() { return isStatusDone.load(); }));
+        EXPECT_FALSE(isScanDone.load());
+
+        agent.ReleaseScans();
+        scanThread.join();
+        statusThread.join();
+    }
+
+    EXPECT_EQ(scanError, DBusBackend::ClientError::ERROR_NONE);
+    EXPECT_TRUE(results.empty());
+
+    EXPECT_EQ(statusError, DBusBackend::ClientError::ERROR_NONE);
+    EXPECT_EQ(status.mRole, "leader");
+    EXPECT_EQ(status.mChannel, 11);
+    EXPECT_EQ(status.mPanId, 0x1234);
+    EXPECT_TRUE(status.mHasMeshLocalPrefix);
+    EXPECT_EQ(status.mMeshLocalPrefix[0], 0xfd);
+}
@@ -0,0 +1,118 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <atomic>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "common/task_runner.hpp"
+#include "common/worker_pool.hpp"
+
+static void RunMainloopOnce(otbr::TaskRunner &aTaskRunner)
+{
+    int                   rval;
+    otbr::MainloopContext mainloop;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {10, 0};
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    aTaskRunner.Update(mainloop);
+    rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                  &mainloop.mTimeout);
+    EXPECT_EQ(1, rval);
+
+    aTaskRunner.Process(mainloop);
+}
+
+TEST(WorkerPool, TestWorkRunsOffMainloop)
+{
+    std::atomic<int> counter{0};
+
+    {
+        otbr::WorkerPool pool(4);
+
+        EXPECT_EQ(4u, pool.GetNumThreads());
+
+        for (int i = 0; i < 100; i++)
+        {
+            pool.Post([&counter]() { ++counter; });
+        }
+
+        while (counter.load() < 100)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    EXPECT_EQ(100, counter.load());
+}
+
+TEST(WorkerPool, TestContinuationRunsOnTaskRunner)
+{
+    otbr::TaskRunner  taskRunner;
+    otbr::WorkerPool  pool(2);
+    std::thread::id   mainThread = std::this_thread::get_id();
+    std::thread::id   workThread;
+    std::thread::id   continuationThread;
+    std::vector<int>  result;
+    std::atomic<bool> done{false};
+
+    pool.Post<std::vector<int>>(
+        [&workThread]() {
+            std::vector<int> values;
+
+            workThread = std::this_thread::get_id();
+            for (int i = 0; i < 1000; i++)
+            {
+                values.push_back(i * i);
+            }
+
+            return values;
+        },
+        taskRunner,
+        [&](std::vector<int> aValues) {
+            continuationThread = std::this_thread::get_id();
+            result             = std::move(aValues);
+            done               = true;
+        });
+
+    while (!done.load())
+    {
+        RunMainloopOnce(taskRunner);
+    }
+
+    EXPECT_NE(mainThread, workThread);
+    EXPECT_EQ(mainThread, continuationThread);
+    ASSERT_EQ(1000u, result.size());
+    EXPECT_EQ(999 * 999, result.back());
+}
@@ -30,27 +30,35 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <inttypes.h>
 #include <limits.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <time.h>
 
+#include <dirent.h>
 #include <netinet/in.h>
 #include <signal.h>
 
 #include <functional>
+#include <random>
+#include <string>
 #include <vector>
 
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 #include "common/mainloop.hpp"
 #include "common/mainloop_manager.hpp"
+#include "common/time.hpp"
+#include "common/types.hpp"
 #include "mdns/mdns.hpp"
 
 using namespace otbr;
 using namespace otbr::Mdns;
 
-static Publisher *sPublisher = nullptr;
+static Publisher *sPublisher  = nullptr;
+static bool       sShouldExit = false;
 
 typedef std::function<void(void)> TestRunner;
 
@@ -58,7 +66,7 @@ int RunMainloop(void)
 {
     int rval = 0;
 
-    while (true)
+    while (!sShouldExit)
     {
         MainloopContext mainloop;
 
@@ -205,6 +213,47 @@ void PublishMultipleServicesWithCustomHost(void)
     sPublisher->PublishKey("MultipleService22._meshcop._udp", keyData2, ErrorChecker("publish key for service22"));
 }
 
+void PublishHostAndServices(void)
+{
+    uint8_t                      xpanid[kSizeExtPanId]           = {0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48};
+    uint8_t                      hostAddr[OTBR_IP6_ADDRESS_SIZE] = {0};
+    Publisher::HostedServiceList services(2);
+    Publisher::TxtData           txtData;
+    Publisher::TxtList           txtList{
+        {"nn", "cool"},
+        {"xp", xpanid, sizeof(xpanid)},
+    };
+
+    otbrLogInfo("PublishHostAndServices");
+
+    hostAddr[0]  = 0x20;
+    hostAddr[1]  = 0x02;
+    hostAddr[15] = 0x01;
+
+    Publisher::EncodeTxtData(txtList, txtData);
+
+    services[0].mName    = "HostedService1";
+    services[0].mType    = "_meshcop._udp";
+    services[0].mPort    = 12345;
+    services[0].mTxtData = txtData;
+
+    services[1].mName        = "HostedService2";
+    services[1].mType        = "_meshcop._udp";
+    services[1].mSubTypeList = {"_cool"};
+    services[1].mPort        = 12345;
+    services[1].mTxtData     = txtData;
+
+    Ip6Address address(hostAddr);
+
+    sPublisher->PublishHostAndServices("custom-host", {address}, services, [services, address](otbrError aError) {
+        SuccessOrDie(aError, "publish the host and its services");
+
+        // Publishing the same host and services again is reported as success right away.
+        sPublisher->PublishHostAndServices("custom-host", {address}, services,
+                                           ErrorChecker("re-publish the host and its services"));
+    });
+}
+
 void PublishSingleService(void)
 {
     uint8_t            xpanid[kSizeExtPanId] = {0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48};
@@ -362,6 +411,299 @@ void PublishKeyWithServiceRemoved(void)
         });
 }
 
+static constexpr char kBenchmarkServiceType[] = "_otbr-bench._udp";
+
+struct BenchmarkConfig
+{
+    uint32_t mNumHosts         = 10;
+    uint32_t mNumServices      = 5;
+    uint32_t mNumTxtUpdates    = 50;
+    uint32_t mNumSubscriptions = 10;
+};
+
+struct BenchmarkPhase
+{
+    const char          *mName;
+    Timepoint            mStartTime;
+    uint32_t             mNumRequests = 0;
+    uint32_t             mNumFailures = 0;
+    uint32_t             mNumAborted  = 0;
+    uint32_t             mMaxLatency  = 0;
+    uint64_t             mSumLatency  = 0;
+    MdnsLatencyHistogram mLatency     = {};
+};
+
+static BenchmarkConfig             sBenchmarkConfig;
+static std::vector<BenchmarkPhase> sBenchmarkPhases;
+static std::function<void(void)>   sBenchmarkNextPhase;
+static std::mt19937                sBenchmarkRandom;
+static std::vector<std::string>    sBenchmarkSubscriptions;
+static uint32_t                    sBenchmarkOutstanding  = 0;
+static uint32_t                    sBenchmarkDiscovered   = 0;
+static uint64_t                    sBenchmarkSubscriberId = 0;
+static long                        sBenchmarkBaseRss      = 0;
+static int                         sBenchmarkBaseFds      = 0;
+
+// Returns the resident set size of this process in KiB, or -1 if it can't be read.
+long GetResidentSetSize(void)
+{
+    long  rss  = -1;
+    FILE *file = fopen("/proc/self/status", "r");
+    char  line[128];
+
+    VerifyOrExit(file != nullptr);
+
+    while (fgets(line, sizeof(line), file) != nullptr)
+    {
+        if (sscanf(line, "VmRSS: %ld kB", &rss) == 1)
+        {
+            break;
+        }
+    }
+
+    fclose(file);
+
+exit:
+    return rss;
+}
+
+// Returns the number of file descriptors opened by this process, or -1 if they can't be listed.
+int GetOpenFdCount(void)
+{
+    int            count = -1;
+    DIR           *dir   = opendir("/proc/self/fd");
+    struct dirent *entry;
+
+    VerifyOrExit(dir != nullptr);
+
+    count = 0;
+    while ((entry = readdir(dir)) != nullptr)
+    {
+        count += (entry->d_name[0] != '.');
+    }
+
+    // Excludes the descriptor of `dir` itself.
+    count--;
+    closedir(dir);
+
+exit:
+    return count;
+}
+
+std::string BenchmarkHostName(uint32_t aHost)
+{
+    return "bench-host-" + std::to_string(aHost);
+}
+
+std::string BenchmarkServiceName(uint32_t aHost, uint32_t aService)
+{
+    return "bench-svc-" + std::to_string(aHost) + "-" + std::to_string(aService);
+}
+
+Publisher::TxtData BenchmarkRandomTxtData(void)
+{
+    std::string        revision = std::to_string(sBenchmarkRandom());
+    std::string        padding(sBenchmarkRandom() % 64, 'x');
+    Publisher::TxtData txtData;
+    Publisher::TxtList txtList{{"rv", revision.c_str()}, {"pd", padding.c_str()}};
+
+    SuccessOrDie(Publisher::EncodeTxtData(txtList, txtData), "encode the TXT data");
+
+    return txtData;
+}
+
+void BenchmarkStartPhase(const char *aName, std::function<void(void)> aNextPhase)
+{
+    BenchmarkPhase phase;
+
+    otbrLogInfo("Benchmark phase: %s", aName);
+
+    phase.mName      = aName;
+    phase.mStartTime = Clock::now();
+    sBenchmarkPhases.push_back(phase);
+    sBenchmarkNextPhase = std::move(aNextPhase);
+
+    // Holds the phase open until all its requests are issued, in case some complete synchronously.
+    sBenchmarkOutstanding++;
+}
+
+void BenchmarkFinishRequest(void)
+{
+    std::function<void(void)> nextPhase;
+
+    VerifyOrExit(--sBenchmarkOutstanding == 0);
+
+    nextPhase = std::move(sBenchmarkNextPhase);
+    nextPhase();
+
+exit:
+    return;
+}
+
+Publisher::ResultCallback BenchmarkCallback(void)
+{
+    Timepoint start = Clock::now();
+
+    sBenchmarkOutstanding++;
+    sBenchmarkPhases.back().mNumRequests++;
+
+    return [start](otbrError aError) {
+        BenchmarkPhase &phase   = sBenchmarkPhases.back();
+        uint32_t        latency = static_cast<uint32_t>(
+            std::chrono::duration_cast<Milliseconds>(Clock::now() - start).count());
+
+        // A randomized TXT update may supersede a queued update of the same service.
+        VerifyOrExit(aError != OTBR_ERROR_ABORTED, phase.mNumAborted++);
+
+        if (aError != OTBR_ERROR_NONE)
+        {
+            otbrLogWarning("Benchmark request failed: %s", otbrErrorString(aError));
+            phase.mNumFailures++;
+        }
+
+        phase.mLatency.Record(latency);
+        phase.mSumLatency += latency;
+        phase.mMaxLatency = std::max(phase.mMaxLatency, latency);
+
+    exit:
+        BenchmarkFinishRequest();
+    };
+}
+
+void BenchmarkReport(void)
+{
+    long     rss      = GetResidentSetSize();
+    int      fds      = GetOpenFdCount();
+    uint32_t failures = 0;
+
+    printf("mDNS publisher benchmark: %" PRIu32 " hosts x %" PRIu32 " services, %" PRIu32 " TXT updates, %" PRIu32
+           " subscriptions\n",
+           sBenchmarkConfig.mNumHosts, sBenchmarkConfig.mNumServices, sBenchmarkConfig.mNumTxtUpdates,
+           sBenchmarkConfig.mNumSubscriptions);
+    printf("%-10s %8s %8s %8s %10s %8s %8s %8s %8s %8s\n", "phase", "requests", "failures", "aborted", "req/s",
+           "avg ms", "p50 ms", "p90 ms", "p99 ms", "max ms");
+
+    for (const BenchmarkPhase &phase : sBenchmarkPhases)
+    {
+        double seconds = std::chrono::duration<double>(
+                             (&phase == &sBenchmarkPhases.back() ? Clock::now() : (&phase + 1)->mStartTime) -
+                             phase.mStartTime)
+                             .count();
+
+        uint32_t completed = phase.mNumRequests - phase.mNumAborted;
+
+        printf("%-10s %8" PRIu32 " %8" PRIu32 " %8" PRIu32 " %10.1f %8" PRIu64 " %8" PRIu32 " %8" PRIu32 " %8" PRIu32
+               " %8" PRIu32 "\n",
+               phase.mName, phase.mNumRequests, phase.mNumFailures, phase.mNumAborted,
+               seconds > 0 ? completed / seconds : 0.0, completed > 0 ? phase.mSumLatency / completed : 0,
+               phase.mLatency.GetPercentile(50), phase.mLatency.GetPercentile(90), phase.mLatency.GetPercentile(99),
+               phase.mMaxLatency);
+        failures += phase.mNumFailures;
+    }
+
+    printf("discovered instances: %" PRIu32 "\n", sBenchmarkDiscovered);
+    printf("memory: %ld KiB at start, %ld KiB at end\n", sBenchmarkBaseRss, rss);
+    printf("open fds: %d at start, %d at end\n", sBenchmarkBaseFds, fds);
+
+    if (failures != 0)
+    {
+        otbrLogEmerg("Benchmark got %" PRIu32 " failed requests", failures);
+        exit(-1);
+    }
+
+    sShouldExit = true;
+}
+
+void BenchmarkUnpublish(void)
+{
+    sPublisher->UnsubscribeService(kBenchmarkServiceType, "");
+    for (const std::string &instanceName : sBenchmarkSubscriptions)
+    {
+        sPublisher->UnsubscribeService(kBenchmarkServiceType, instanceName);
+    }
+    sPublisher->RemoveSubscriptionCallbacks(sBenchmarkSubscriberId);
+
+    BenchmarkStartPhase("unpublish", BenchmarkReport);
+
+    for (uint32_t host = 0; host < sBenchmarkConfig.mNumHosts; host++)
+    {
+        for (uint32_t service = 0; service < sBenchmarkConfig.mNumServices; service++)
+        {
+            sPublisher->UnpublishService(BenchmarkServiceName(host, service), kBenchmarkServiceType,
+                                         BenchmarkCallback());
+        }
+
+        sPublisher->UnpublishHost(BenchmarkHostName(host), BenchmarkCallback());
+    }
+
+    BenchmarkFinishRequest();
+}
+
+void BenchmarkUpdateTxtData(void)
+{
+    long rss = GetResidentSetSize();
+    int  fds = GetOpenFdCount();
+
+    printf("memory per registration: %.2f KiB, fds per registration: %.3f\n",
+           static_cast<double>(rss - sBenchmarkBaseRss) / sBenchmarkPhases.back().mNumRequests,
+           static_cast<double>(fds - sBenchmarkBaseFds) / sBenchmarkPhases.back().mNumRequests);
+
+    sBenchmarkSubscriberId = sPublisher->AddSubscriptionCallbacks(
+        [](const std::string &, const Publisher::DiscoveredInstanceInfo &) { sBenchmarkDiscovered++; }, nullptr);
+    sPublisher->SubscribeService(kBenchmarkServiceType, "");
+
+    for (uint32_t i = 0; i < sBenchmarkConfig.mNumSubscriptions; i++)
+    {
+        uint32_t host    = sBenchmarkRandom() % sBenchmarkConfig.mNumHosts;
+        uint32_t service = sBenchmarkRandom() % sBenchmarkConfig.mNumServices;
+
+        sBenchmarkSubscriptions.push_back(BenchmarkServiceName(host, service));
+        sPublisher->SubscribeService(kBenchmarkServiceType, sBenchmarkSubscriptions.back());
+    }
+
+    BenchmarkStartPhase("update", BenchmarkUnpublish);
+
+    for (uint32_t i = 0; i < sBenchmarkConfig.mNumTxtUpdates; i++)
+    {
+        uint32_t host    = sBenchmarkRandom() % sBenchmarkConfig.mNumHosts;
+        uint32_t service = sBenchmarkRandom() % sBenchmarkConfig.mNumServices;
+
+        sPublisher->PublishService(BenchmarkHostName(host), BenchmarkServiceName(host, service), kBenchmarkServiceType,
+                                   Publisher::SubTypeList{}, static_cast<uint16_t>(10000 + service),
+                                   BenchmarkRandomTxtData(), BenchmarkCallback());
+    }
+
+    BenchmarkFinishRequest();
+}
+
+void RunBenchmark(void)
+{
+    sBenchmarkBaseRss = GetResidentSetSize();
+    sBenchmarkBaseFds = GetOpenFdCount();
+
+    BenchmarkStartPhase("publish", BenchmarkUpdateTxtData);
+
+    for (uint32_t host = 0; host < sBenchmarkConfig.mNumHosts; host++)
+    {
+        uint8_t hostAddr[OTBR_IP6_ADDRESS_SIZE] = {0xfd, 0x00};
+
+        hostAddr[14] = static_cast<uint8_t>(host >> 8);
+        hostAddr[15] = static_cast<uint8_t>(host);
+
+        sPublisher->PublishHost(BenchmarkHostName(host), {Ip6Address(hostAddr)}, BenchmarkCallback());
+
+        for (uint32_t service = 0; service < sBenchmarkConfig.mNumServices; service++)
+        {
+            sPublisher->PublishService(BenchmarkHostName(host), BenchmarkServiceName(host, service),
+                                       kBenchmarkServiceType, Publisher::SubTypeList{},
+                                       static_cast<uint16_t>(10000 + service), BenchmarkRandomTxtData(),
+                                       BenchmarkCallback());
+        }
+    }
+
+    BenchmarkFinishRequest();
+}
+
 otbrError Test(TestRunner aTestRunner)
 {
     otbrError error = OTBR_ERROR_NONE;
@@ -418,6 +760,38 @@ exit:
     return ret;
 }
 
+// Arguments: [hosts] [services-per-host] [txt-updates] [subscriptions] [random-seed]
+otbrError TestBenchmark(int aArgCount, char *aArgs[])
+{
+    otbrError error    = OTBR_ERROR_NONE;
+    uint32_t  seed     = static_cast<uint32_t>(time(nullptr));
+    uint32_t *values[] = {&sBenchmarkConfig.mNumHosts, &sBenchmarkConfig.mNumServices,
+                          &sBenchmarkConfig.mNumTxtUpdates, &sBenchmarkConfig.mNumSubscriptions, &seed};
+
+    VerifyOrExit(aArgCount <= static_cast<int>(sizeof(values) / sizeof(values[0])), error = OTBR_ERROR_INVALID_ARGS);
+
+    for (int i = 0; i < aArgCount; i++)
+    {
+        char         *end;
+        unsigned long value = strtoul(aArgs[i], &end, 0);
+
+        VerifyOrExit(*aArgs[i] != '\0' && *end == '\0' && value <= UINT32_MAX, error = OTBR_ERROR_INVALID_ARGS);
+        *values[i] = static_cast<uint32_t>(value);
+    }
+
+    VerifyOrExit(sBenchmarkConfig.mNumHosts > 0 && sBenchmarkConfig.mNumHosts <= UINT16_MAX,
+                 error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(sBenchmarkConfig.mNumServices > 0 && sBenchmarkConfig.mNumServices <= UINT16_MAX - 10000,
+                 error = OTBR_ERROR_INVALID_ARGS);
+
+    printf("random seed: %" PRIu32 "\n", seed);
+    sBenchmarkRandom.seed(seed);
+    error = Test(RunBenchmark);
+
+exit:
+    return error;
+}
+
 otbrError CheckTxtDataEncoderDecoder(void)
 {
     otbrError            error = OTBR_ERROR_NONE;
@@ -499,6 +873,9 @@ int main(int argc, char *argv[])
         case 'k':
             ret = Test(PublishSingleServiceWithKeyAfterwards);
             break;
+        case 'h':
+            ret = Test(PublishHostAndServices);
+            break;
         default:
             ret = Test(PublishSingleService);
             break;
@@ -529,6 +906,10 @@ int main(int argc, char *argv[])
         ret = Test(PublishKeyWithServiceRemoved);
         break;
 
+    case 'b':
+        ret = TestBenchmark(argc - 2, argv + 2);
+        break;
+
     default:
         ret = 1;
         break;
@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2024, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+"""Load test of the otbr REST server.
+
+Drives each endpoint with a number of concurrent persistent connections for a while and reports the requests per
+second, the p50/p99 latency and the memory of otbr-agent. The run fails if a threshold given on the command line
+is exceeded.
+"""
+
+import argparse
+import asyncio
+import json
+import socket
+import sys
+import time
+import urllib.parse
+
+DEFAULT_ENDPOINTS = ['/node', '/diagnostics', '/node/dataset/active']
+
+
+class Client(object):
+    """A client sending requests on a persistent HTTP/1.1 connection."""
+
+    def __init__(self, host, port):
+        self.host = host
+        self.port = port
+        self.reader = None
+        self.writer = None
+
+    async def request(self, path):
+        if self.writer is None:
+            self.reader, self.writer = await asyncio.open_connection(self.host, self.port)
+            self.writer.get_extra_info('socket').setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+
+        self.writer.write('GET {} HTTP/1.1\r\nHost: {}\r\nAccept: application/json\r\n\r\n'.format(
+            path, self.host).encode())
+        await self.writer.drain()
+
+        status_line = await self.reader.readline()
+        if not status_line:
+            raise ConnectionError('connection closed by server')
+        status = int(status_line.split()[1])
+
+        length = 0
+        keep_alive = True
+        while True:
+            line = await self.reader.readline()
+            if line in (b'\r\n', b''):
+                break
+            name, _, value = line.decode().partition(':')
+            name = name.strip().lower()
+            if name == 'content-length':
+                length = int(value)
+            elif name == 'connection' and value.strip().lower() == 'close':
+                keep_alive = False
+
+        await self.reader.readexactly(length)
+
+        if not keep_alive:
+            self.close()
+
+        return status
+
+    def close(self):
+        if self.writer is not None:
+            self.writer.close()
+            self.writer = None
+            self.reader = None
+
+
+def percentile(sorted_values, fraction):
+    if not sorted_values:
+        return 0.0
+    index = min(len(sorted_values) - 1, int(round(fraction * (len(sorted_values) - 1))))
+    return sorted_values[index]
+
+
+def read_memory(pid):
+    """Returns the resident and peak resident memory (in KiB) of a process."""
+    memory = {}
+    if pid is None:
+        return memory
+    with open('/proc/{}/status'.format(pid)) as status:
+        for line in status:
+            name, _, value = line.partition(':')
+            if name in ('VmRSS', 'VmHWM'):
+                memory[name] = int(value.split()[0])
+    return memory
+
+
+async def run_worker(host, port, path, deadline, latencies, errors):
+    client = Client(host, port)
+    try:
+        while time.monotonic() < deadline:
+            start = time.monotonic()
+            try:
+                status = await client.request(path)
+            except (OSError, ConnectionError, asyncio.IncompleteReadError, ValueError):
+                errors.append(None)
+                client.close()
+                continue
+            latencies.append(time.monotonic() - start)
+            if status >= 400:
+                errors.append(status)
+    finally:
+        client.close()
+
+
+async def run_level(host, port, path, concurrency, duration):
+    latencies = []
+    errors = []
+    start = time.monotonic()
+    deadline = start + duration
+
+    await asyncio.gather(*[
+        run_worker(host, port, path, deadline, latencies, errors) for _ in range(concurrency)
+    ])
+
+    elapsed = time.monotonic() - start
+    latencies.sort()
+
+    return {
+        'endpoint': path,
+        'concurrency': concurrency,
+        'requests': len(latencies),
+        'errors': len(errors),
+        'rps': len(latencies) / elapsed,
+        'p50_ms': percentile(latencies, 0.50) * 1000,
+        'p99_ms': percentile(latencies, 0.99) * 1000,
+    }
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--url', default='http://127.0.0.1:8081', help='base url of the REST server')
+    parser.add_argument('--endpoint',
+                        action='append',
+                        dest='endpoints',
+                        help='endpoint to load, may be repeated (default: {})'.format(', '.join(DEFAULT_ENDPOINTS)))
+    parser.add_argument('--concurrency', default='1,8,32', help='comma separated numbers of concurrent connections')
+    parser.add_argument('--duration', type=float, default=5.0, help='seconds to load each endpoint per level')
+    parser.add_argument('--pid', type=int, help='pid of otbr-agent to report the memory of')
+    parser.add_argument('--max-p99-ms', type=float, help='fail if the p99 latency of any run exceeds this')
+    parser.add_argument('--min-rps', type=float, help='fail if the requests per second of any run is below this')
+    parser.add_argument('--max-rss-kib', type=int, help='fail if the peak resident memory exceeds this')
+    parser.add_argument('--json', help='write the results to this file')
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+    url = urllib.parse.urlsplit(args.url)
+    endpoints = args.endpoints or DEFAULT_ENDPOINTS
+    levels = [int(level) for level in args.concurrency.split(',')]
+    results = []
+    failures = []
+
+    print('{:<24} {:>5} {:>9} {:>7} {:>10} {:>10} {:>10}'.format('endpoint', 'conns', 'requests', 'errors', 'req/s',
+                                                                  'p50 ms', 'p99 ms'))
+
+    for path in endpoints:
+        for level in levels:
+            result = asyncio.run(run_level(url.hostname, url.port or 80, path, level, args.duration))
+            result.update(read_memory(args.pid))
+            results.append(result)
+
+            print('{endpoint:<24} {concurrency:>5} {requests:>9} {errors:>7} {rps:>10.1f} {p50_ms:>10.2f} '
+                  '{p99_ms:>10.2f}'.format(**result))
+
+            if result['errors'] > 0:
+                failures.append('{} with {} connections: {} errors'.format(path, level, result['errors']))
+            if args.max_p99_ms is not None and result['p99_ms'] > args.max_p99_ms:
+                failures.append('{} with {} connections: p99 {:.2f} ms'.format(path, level, result['p99_ms']))
+            if args.min_rps is not None and result['rps'] < args.min_rps:
+                failures.append('{} with {} connections: {:.1f} req/s'.format(path, level, result['rps']))
+
+    memory = read_memory(args.pid)
+    if memory:
+        print('otbr-agent memory: rss {} KiB, peak rss {} KiB'.format(memory['VmRSS'], memory['VmHWM']))
+        if args.max_rss_kib is not None and memory['VmHWM'] > args.max_rss_kib:
+            failures.append('peak rss {} KiB'.format(memory['VmHWM']))
+
+    if args.json:
+        with open(args.json, 'w') as output:
+            json.dump({'results': results, 'memory': memory}, output, indent=2)
+
+    for failure in failures:
+        print('FAILED: ' + failure)
+
+    return 1 if failures else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -56,6 +56,15 @@ def get_error_from_url(url, result, index):
         result[index] = e
 
 
+def get_error_from_method(url, method, result, index):
+    try:
+        urllib.request.urlopen(urllib.request.Request(url, method=method))
+        assert False
+
+    except urllib.error.HTTPError as e:
+        result[index] = e
+
+
 def create_multi_thread(func, url, thread_num, response_data):
     threads = [None] * thread_num
 
@@ -77,6 +86,15 @@ def error404_check(data):
     return True
 
 
+def error405_check(data):
+    assert data is not None
+
+    assert (data.code == 405)
+    assert (data.headers["Allow"] == "GET")
+
+    return True
+
+
 def diagnostics_check(data):
     assert data is not None
 
@@ -440,6 +458,21 @@ def error_test(thread_num):
     print(" /v1/hello : all {}, valid {} ".format(thread_num, valid))
 
 
+def method_not_allowed_test():
+    url = rest_api_addr + "/diagnostics"
+    methods = ["POST", "PUT", "DELETE"]
+
+    response_data = [None] * len(methods)
+
+    for i, method in enumerate(methods):
+        get_error_from_method(url, method, response_data, i)
+
+    valid = [error405_check(data) for data in response_data].count(True)
+
+    print(" /diagnostics non-GET : all {}, valid {} ".format(
+        len(methods), valid))
+
+
 def main():
     node_test(200)
     node_rloc_test(200)
@@ -452,6 +485,7 @@ def main():
     node_ext_panid_test(200)
     diagnostics_test(20)
     error_test(10)
+    method_not_allowed_test()
 
     return 0
 
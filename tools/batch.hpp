@@ -0,0 +1,175 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the batch mode shared by the tools.
+ *
+ *   A batch reads one input per line and computes the outputs on all cores. The outputs are written
+ *   in input order, one per line, with an empty line for an invalid input so that outputs stay aligned
+ *   with inputs. The throughput is reported to stderr.
+ */
+
+#ifndef OTBR_TOOLS_BATCH_HPP_
+#define OTBR_TOOLS_BATCH_HPP_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace otbr {
+namespace Tools {
+
+/**
+ * This function splits a batch input line into whitespace-separated fields.
+ *
+ * @param[in] aLine  The input line.
+ *
+ * @returns The fields of the line.
+ */
+inline std::vector<std::string> SplitBatchLine(const std::string &aLine)
+{
+    std::istringstream       stream(aLine);
+    std::vector<std::string> fields;
+    std::string              field;
+
+    while (stream >> field)
+    {
+        fields.push_back(field);
+    }
+
+    return fields;
+}
+
+/**
+ * This function runs a batch.
+ *
+ * Empty lines and lines starting with `#` are skipped.
+ *
+ * @param[in] aPath     The path of the input file, or `-` for stdin.
+ * @param[in] aJobs     The number of worker threads, or 0 for one per core.
+ * @param[in] aCompute  A callable `bool(const std::vector<std::string> &aFields, std::string &aOutput)` which
+ *                      computes the output of one input. It's called concurrently from the worker threads.
+ *
+ * @returns EX_OK if all inputs were valid, or another `sysexits.h` code.
+ */
+template <typename Compute> int RunBatch(const char *aPath, unsigned aJobs, Compute aCompute)
+{
+    using Clock = std::chrono::steady_clock;
+
+    std::ifstream            file;
+    std::istream            *input = &std::cin;
+    std::vector<std::string> lines;
+    std::vector<std::string> outputs;
+    std::vector<char>        valid;
+    std::vector<std::thread> workers;
+    std::atomic<size_t>      next(0);
+    std::string              line;
+    size_t                   numInvalid = 0;
+    Clock::time_point        begin;
+    double                   seconds;
+
+    if (strcmp(aPath, "-") != 0)
+    {
+        file.open(aPath);
+        if (!file)
+        {
+            fprintf(stderr, "Failed to open %s\n", aPath);
+            return EX_NOINPUT;
+        }
+        input = &file;
+    }
+
+    while (std::getline(*input, line))
+    {
+        if (!line.empty() && line[0] != '#' && line.find_first_not_of(" \t\r") != std::string::npos)
+        {
+            lines.push_back(line);
+        }
+    }
+
+    outputs.resize(lines.size());
+    valid.resize(lines.size(), 0);
+
+    if (aJobs == 0)
+    {
+        aJobs = std::max(1u, std::thread::hardware_concurrency());
+    }
+    aJobs = static_cast<unsigned>(std::min<size_t>(aJobs, std::max<size_t>(lines.size(), 1)));
+
+    begin = Clock::now();
+
+    for (unsigned i = 0; i < aJobs; i++)
+    {
+        workers.emplace_back([&]() {
+            for (size_t index = next++; index < lines.size(); index = next++)
+            {
+                valid[index] = aCompute(SplitBatchLine(lines[index]), outputs[index]);
+            }
+        });
+    }
+
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+
+    seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+
+    for (size_t i = 0; i < lines.size(); i++)
+    {
+        if (!valid[i])
+        {
+            fprintf(stderr, "Invalid input: %s\n", lines[i].c_str());
+            outputs[i].clear();
+            numInvalid++;
+        }
+        printf("%s\n", outputs[i].c_str());
+    }
+
+    fprintf(stderr, "%zu inputs, %zu invalid, %u threads, %.3f s, %.1f inputs/s\n", lines.size(), numInvalid, aJobs,
+            seconds, seconds > 0 ? lines.size() / seconds : 0);
+
+    return numInvalid == 0 ? EX_OK : EX_DATAERR;
+}
+
+} // namespace Tools
+} // namespace otbr
+
+#endif // OTBR_TOOLS_BATCH_HPP_
@@ -32,8 +32,12 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <sysexits.h>
 
+#include <string>
+
+#include "batch.hpp"
 #include "common/code_utils.hpp"
 #include "utils/hex.hpp"
 #include "utils/pskc.hpp"
@@ -53,55 +57,85 @@ void help(void)
     printf("pskc - compute PSKc\n"
            "SYNTAX:\n"
            "    pskc <PASSPHRASE> <EXTPANID> <NETWORK_NAME>\n"
+           "    pskc -b <FILE|-> [JOBS]\n"
+           "        Computes the PSKc for each line of <PASSPHRASE> <EXTPANID> <NETWORK_NAME> in FILE or\n"
+           "        stdin, on JOBS threads (default: one per core), and prints one PSKc per line.\n"
            "EXAMPLE:\n"
-           "    pskc 654321 1122334455667788 OpenThread\n");
+           "    pskc 654321 1122334455667788 OpenThread\n"
+           "    pskc -b credentials.txt\n");
 }
 
-int printPSKc(const char *aPassphrase, const char *aExtPanId, const char *aNetworkName)
+int computePSKc(const char *aPassphrase, const char *aExtPanId, const char *aNetworkName, std::string &aPskc)
 {
     uint8_t extpanid[kSizeExtPanId];
     size_t  length;
     int     ret = -1;
+    char    pskcStr[OT_PSKC_LENGTH * 2 + 1];
 
     otbr::Psk::Pskc pskcComputer;
     const uint8_t  *pskc;
 
     length = strlen(aPassphrase);
-    VerifyOrExit(length > 0, printf("PASSPHRASE must not be empty.\n"));
+    VerifyOrExit(length > 0, fprintf(stderr, "PASSPHRASE must not be empty.\n"));
     VerifyOrExit(length <= kMaxPassphrase,
-                 printf("PASSPHRASE Passphrase must be no more than %d bytes.\n", kMaxPassphrase));
+                 fprintf(stderr, "PASSPHRASE Passphrase must be no more than %d bytes.\n", kMaxPassphrase));
 
     length = strlen(aExtPanId);
-    VerifyOrExit(length == kSizeExtPanId * 2, printf("EXTPANID length must be %d bytes.\n", kSizeExtPanId));
+    VerifyOrExit(length == kSizeExtPanId * 2, fprintf(stderr, "EXTPANID length must be %d bytes.\n", kSizeExtPanId));
     for (size_t i = 0; i < length; i++)
     {
         VerifyOrExit((aExtPanId[i] <= '9' && aExtPanId[i] >= '0') || (aExtPanId[i] <= 'f' && aExtPanId[i] >= 'a') ||
                          (aExtPanId[i] <= 'F' && aExtPanId[i] >= 'A'),
-                     printf("EXTPANID must be encoded in hex.\n"));
+                     fprintf(stderr, "EXTPANID must be encoded in hex.\n"));
     }
     otbr::Utils::Hex2Bytes(aExtPanId, extpanid, sizeof(extpanid));
 
     length = strlen(aNetworkName);
-    VerifyOrExit(length > 0, printf("NETWORK_NAME must not be empty.\n"));
+    VerifyOrExit(length > 0, fprintf(stderr, "NETWORK_NAME must not be empty.\n"));
     VerifyOrExit(length <= kMaxNetworkName,
-                 printf("NETWOR_KNAME length must be no more than %d bytes.\n", kMaxNetworkName));
+                 fprintf(stderr, "NETWOR_KNAME length must be no more than %d bytes.\n", kMaxNetworkName));
 
     pskc = pskcComputer.ComputePskc(extpanid, aNetworkName, aPassphrase);
-    for (int i = 0; i < 16; i++)
+    for (int i = 0; i < OT_PSKC_LENGTH; i++)
     {
-        printf("%02x", pskc[i]);
+        snprintf(pskcStr + i * 2, sizeof(pskcStr) - i * 2, "%02x", pskc[i]);
     }
-    printf("\n");
-    ret = 0;
+    aPskc = pskcStr;
+    ret   = 0;
 
 exit:
     return ret;
 }
 
+int printPSKc(const char *aPassphrase, const char *aExtPanId, const char *aNetworkName)
+{
+    std::string pskc;
+    int         ret = computePSKc(aPassphrase, aExtPanId, aNetworkName, pskc);
+
+    if (ret == 0)
+    {
+        printf("%s\n", pskc.c_str());
+    }
+
+    return ret;
+}
+
 int main(int argc, char *argv[])
 {
     int ret = 0;
 
+    if (argc >= 3 && argc <= 4 && strcmp(argv[1], "-b") == 0)
+    {
+        // The AES in PBKDF2 uses the AES-NI or ARMv8 crypto extensions when mbedtls is built with them.
+        ret = otbr::Tools::RunBatch(argv[2], (argc == 4) ? static_cast<unsigned>(atoi(argv[3])) : 0,
+                                    [](const std::vector<std::string> &aFields, std::string &aPskc) {
+                                        return aFields.size() == 3 &&
+                                               computePSKc(aFields[0].c_str(), aFields[1].c_str(), aFields[2].c_str(),
+                                                           aPskc) == 0;
+                                    });
+        ExitNow();
+    }
+
     VerifyOrExit(argc == 4, help(), ret = EX_USAGE);
     ret = printPSKc(argv[1], argv[2], argv[3]);
 
@@ -28,7 +28,7 @@
 
 /**
  * @file
- *   This file implements a simple tool to compute pskc.
+ *   This file implements a simple tool to compute steering data.
  */
 
 #include <mbedtls/sha256.h>
@@ -36,6 +36,10 @@
 #include <stdlib.h>
 #include <sysexits.h>
 
+#include <string>
+#include <vector>
+
+#include "batch.hpp"
 #include "common/code_utils.hpp"
 #include "utils/hex.hpp"
 #include "utils/steering_data.hpp"
@@ -45,20 +49,22 @@ void help(void)
     printf("steering-data - compute steering data\n"
            "SYNTAX:\n"
            "    steering-data [LENGTH] <JOINER_ID> ...\n"
+           "    steering-data -b <FILE|-> [JOBS]\n"
+           "        Computes the steering data for each line of [LENGTH] <JOINER_ID> ... in FILE or stdin,\n"
+           "        on JOBS threads (default: one per core), and prints one steering data per line.\n"
            "EXAMPLE:\n"
            "    steering-data 18b4300000000001\n"
            "    steering-data 15 18b4300000000001\n"
            "    steering-data 18b4300000000001 18b4300000000002\n");
 }
 
-int ComputeJoinerId(const char *aEui64, uint8_t *aJoinerId)
+int ParseEui64(const char *aEui64, uint8_t *aBytes)
 {
     int ret = -1;
 
     VerifyOrExit(strlen(aEui64) == otbr::SteeringData::kSizeJoinerId * 2);
-    VerifyOrExit(otbr::Utils::Hex2Bytes(aEui64, aJoinerId, otbr::SteeringData::kSizeJoinerId) ==
+    VerifyOrExit(otbr::Utils::Hex2Bytes(aEui64, aBytes, otbr::SteeringData::kSizeJoinerId) ==
                  otbr::SteeringData::kSizeJoinerId);
-    otbr::SteeringData::ComputeJoinerId(aJoinerId, aJoinerId);
     ret = 0;
 
 exit:
@@ -70,21 +76,20 @@ exit:
     return ret;
 }
 
-int main(int argc, char *argv[])
+int ComputeSteeringData(const std::vector<std::string> &aArgs, std::string &aSteeringData)
 {
-    otbr::SteeringData computer;
-    int                ret    = EX_USAGE;
-    int                length = 16;
-    int                i      = 1;
+    otbr::SteeringData   computer;
+    std::vector<uint8_t> eui64s;
+    int                  ret    = EX_USAGE;
+    int                  length = 16;
+    size_t               i      = 0;
+    char                 byte[3];
 
-    if (argc < 2)
-    {
-        ExitNow(help());
-    }
+    VerifyOrExit(!aArgs.empty());
 
-    if (strlen(argv[i]) != otbr::SteeringData::kSizeJoinerId * 2)
+    if (aArgs[i].size() != otbr::SteeringData::kSizeJoinerId * 2)
     {
-        length = atoi(argv[i]);
+        length = atoi(aArgs[i].c_str());
         VerifyOrExit(length > 0 && length <= otbr::SteeringData::kMaxSizeOfBloomFilter,
                      fprintf(stderr, "Invalid bloom filter length: %d\n", length));
 
@@ -93,22 +98,49 @@ int main(int argc, char *argv[])
 
     computer.Init(static_cast<uint8_t>(length));
 
-    for (; i < argc; ++i)
+    eui64s.resize((aArgs.size() - i) * otbr::SteeringData::kSizeJoinerId);
+    for (size_t j = 0; i + j < aArgs.size(); ++j)
     {
-        uint8_t joinerId[otbr::SteeringData::kSizeJoinerId];
-
-        VerifyOrExit(ComputeJoinerId(argv[i], joinerId) == 0, fprintf(stderr, "Invalid EUI64 : %s\n", argv[i]));
-        computer.ComputeBloomFilter(joinerId);
+        VerifyOrExit(ParseEui64(aArgs[i + j].c_str(), &eui64s[j * otbr::SteeringData::kSizeJoinerId]) == 0,
+                     fprintf(stderr, "Invalid EUI64 : %s\n", aArgs[i + j].c_str()));
     }
+    computer.ComputeForJoiners(eui64s.data(), eui64s.size() / otbr::SteeringData::kSizeJoinerId);
 
-    for (i = 0; i < length; i++)
+    aSteeringData.clear();
+    for (i = 0; i < static_cast<size_t>(length); i++)
     {
-        printf("%02x", computer.GetBloomFilter()[i]);
+        snprintf(byte, sizeof(byte), "%02x", computer.GetBloomFilter()[i]);
+        aSteeringData += byte;
     }
-    printf("\n");
 
     ret = EX_OK;
 
 exit:
     return ret;
 }
+
+int main(int argc, char *argv[])
+{
+    std::string steeringData;
+    int         ret = EX_USAGE;
+
+    if (argc < 2)
+    {
+        ExitNow(help());
+    }
+
+    if (argc >= 3 && argc <= 4 && strcmp(argv[1], "-b") == 0)
+    {
+        ret = otbr::Tools::RunBatch(argv[2], (argc == 4) ? static_cast<unsigned>(atoi(argv[3])) : 0,
+                                    [](const std::vector<std::string> &aFields, std::string &aSteeringData) {
+                                        return ComputeSteeringData(aFields, aSteeringData) == EX_OK;
+                                    });
+        ExitNow();
+    }
+
+    SuccessOrExit(ret = ComputeSteeringData(std::vector<std::string>(argv + 1, argv + argc), steeringData));
+    printf("%s\n", steeringData.c_str());
+
+exit:
+    return ret;
+}